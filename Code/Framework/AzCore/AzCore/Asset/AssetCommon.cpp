@@ -161,11 +161,10 @@ namespace AZ::Data
         {
             if (AssetManager::IsReady())
             {
-                AZStd::lock_guard<AZStd::recursive_mutex> assetLock(AssetManager::Instance().m_assetMutex);
-                auto it = AssetManager::Instance().m_assets.find(id);
-                if (it != AssetManager::Instance().m_assets.end())
+                Asset<AssetData> found = AssetManager::Instance().m_assets.Find(id, assetReferenceLoadBehavior);
+                if (found)
                 {
-                    return { it->second, assetReferenceLoadBehavior };
+                    return { found.Get(), assetReferenceLoadBehavior };
                 }
             }
             return {nullptr, assetReferenceLoadBehavior};
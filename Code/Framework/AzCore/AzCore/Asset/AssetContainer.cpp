@@ -10,6 +10,7 @@
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ::Data
 {
@@ -167,6 +168,7 @@ namespace AZ::Data
         // Add waiting assets ahead of time to hear signals for any which may already be loading
         AddWaitingAssets(waitingList);
         SetupPreloadLists(move(preloadDependencies), rootAssetId);
+        SortByPreloadDepth(dependencyInfoList);
 
         auto loadParamsCopyWithNoLoadingFilter = loadParams;
 
@@ -685,6 +687,57 @@ namespace AZ::Data
         return false;
     }
 
+    void AssetContainer::SortByPreloadDepth(AZStd::vector<AssetInfo>& dependencyInfoList) const
+    {
+        AZStd::lock_guard<AZStd::recursive_mutex> preloadGuard(m_preloadMutex);
+        if (m_preloadList.empty())
+        {
+            return;
+        }
+
+        // The depth of an asset is 0 if it has no preloads, otherwise it's one more than the deepest of its preloads.
+        // Circular preloads are reported and removed in SetupPreloadLists, but guard against them anyway by treating an asset
+        // that is still being visited as a leaf.
+        static constexpr uint32_t VisitingDepth = AZStd::numeric_limits<uint32_t>::max();
+        AZStd::unordered_map<AssetId, uint32_t> depths;
+        auto getDepth = [this, &depths](const AssetId& assetId, auto& getDepthRef) -> uint32_t
+        {
+            auto [depthEntry, inserted] = depths.emplace(assetId, VisitingDepth);
+            if (!inserted)
+            {
+                return depthEntry->second == VisitingDepth ? 0 : depthEntry->second;
+            }
+
+            uint32_t depth = 0;
+            auto preloadEntry = m_preloadList.find(assetId);
+            if (preloadEntry != m_preloadList.end())
+            {
+                for (const AssetId& preloadId : preloadEntry->second)
+                {
+                    // Assets with preloads list themselves as well, so they can wait on their own data.
+                    if (preloadId != assetId)
+                    {
+                        depth = AZStd::max(depth, getDepthRef(preloadId, getDepthRef) + 1);
+                    }
+                }
+            }
+            depths[assetId] = depth;
+            return depth;
+        };
+
+        for (const AssetInfo& assetInfo : dependencyInfoList)
+        {
+            getDepth(assetInfo.m_assetId, getDepth);
+        }
+
+        // Keep the catalog order for assets of the same depth.
+        AZStd::stable_sort(dependencyInfoList.begin(), dependencyInfoList.end(),
+            [&depths](const AssetInfo& lhs, const AssetInfo& rhs)
+            {
+                return depths[lhs.m_assetId] < depths[rhs.m_assetId];
+            });
+    }
+
     Asset<AssetData> AssetContainer::GetAssetData(const AssetId& assetId) const
     {
         AZStd::lock_guard<AZStd::recursive_mutex> dependenciesGuard(m_dependencyMutex);
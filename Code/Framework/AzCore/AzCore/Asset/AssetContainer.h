@@ -109,6 +109,10 @@ namespace AZ
             void SetupPreloadLists(PreloadAssetListType&& preloadList, const AZ::Data::AssetId& rootAssetId);
             bool HasPreloads(const AZ::Data::AssetId& assetId) const;
 
+            // Orders the dependencies so assets at the bottom of the preload graph are queued first. Every asset that waits on preloads
+            // can only finish its load once those preloads are ready, so issuing them first shortens the critical path of the container.
+            void SortByPreloadDepth(AZStd::vector<AssetInfo>& dependencyInfoList) const;
+
             // Remove a specific id from the list an asset is waiting for and complete the load if everything is ready
             void RemoveFromWaitingPreloads(const AZ::Data::AssetId& waitingId, const AZ::Data::AssetId& preloadAssetId);
             // Iterate over the list that was waiting for this asset and remove it from each
@@ -186,6 +186,7 @@ namespace AZ::Data
                 AZ_STRING_ARG(asset.GetId().ToFixedString())));
 
             const bool loadSucceeded = LoadData();
+            m_owner->UpdateDebugDataLoaded(asset, loadSucceeded);
 
             ASSET_DEBUG_OUTPUT(AZStd::string::format(
                 "LoadAndSignal - Post - Result: %s - Signal: %s - " AZ_STRING_FORMAT,
@@ -697,17 +698,17 @@ namespace AZ::Data
                     {
                         // this scope is used to control the scope of the lock.
                         AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                        for (const auto &assetEntry : m_assets)
+                        m_assets.ForEach([handler](AssetData* assetData)
                         {
                             // is the handler that handles this type, this handler we're removing?
-                            if (assetEntry.second->m_registeredHandler == handler)
+                            if (assetData->m_registeredHandler == handler)
                             {
                                 AZ_Error("AssetManager", false, "Asset handler for %s is being removed, when assetid %s is still loaded!\n",
-                                            assetEntry.second->GetType().ToString<AZ::OSString>().c_str(),
-                                            assetEntry.second->GetId().ToString<AZ::OSString>().c_str()); // this will write the name IF AVAILABLE
-                                assetEntry.second->UnregisterWithHandler();
+                                            assetData->GetType().ToString<AZ::OSString>().c_str(),
+                                            assetData->GetId().ToString<AZ::OSString>().c_str()); // this will write the name IF AVAILABLE
+                                assetData->UnregisterWithHandler();
                             }
-                        }
+                        });
                     }
                     it = m_handlers.erase(it);
                     handler->m_nHandledTypes--;
@@ -789,44 +790,20 @@ namespace AZ::Data
             return;
         }
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-        // First, release any containers that were loading this asset
-        for (auto asset = m_assets.begin();asset != m_assets.end();)
+        // Take a reference to every asset that became unused while releases were suspended. The asset map shards are only
+        // locked while collecting them, because releasing the references modifies the map.
+        AZStd::vector<Asset<AssetData>> unusedAssets;
+        m_assets.ForEach([&unusedAssets](AssetData* assetData)
         {
-            if (asset->second->m_useCount == 0)
-            {
-                auto releaseAsset = asset->second;
-                ++asset;
-                ReleaseAssetContainersForAsset(releaseAsset);
-            }
-            else
+            if (assetData->m_useCount == 0)
             {
-                ++asset;
+                unusedAssets.emplace_back(AssetLoadBehavior::Default).SetData(assetData);
             }
-        }
-
-        // Second, release the assets themselves
-
-        AZStd::vector<AssetData*> assetsToRelease;
-
-        for(auto&& asset : m_assets)
-        {
-            if(asset.second->m_weakUseCount == 0)
-            {
-                // Keep a separate list of assets to release, because releasing them will modify the m_assets list that we're
-                // currently looping on.
-                assetsToRelease.push_back(asset.second);
-            }
-        }
-
-        for(auto&& asset : assetsToRelease)
-        {
-            bool removeFromHash = asset->IsRegisterReadonlyAndShareable();
-            // default creation token implies that the asset was not created by the asset manager and therefore it cannot be in the asset map.
-            removeFromHash = asset->m_creationToken == s_defaultCreationToken ? false : removeFromHash;
+        });
 
-            ReleaseAsset(asset, asset->GetId(), asset->GetType(), removeFromHash, asset->m_creationToken);
-        }
+        // Dropping the references goes through the regular release path, which first releases any containers that were loading
+        // the asset, and then the asset itself if there aren't any weak references left either.
+        unusedAssets.clear();
     }
 
     AssetData::AssetStatus AssetManager::BlockUntilLoadComplete(const Asset<AssetData>& asset)
@@ -851,6 +828,95 @@ namespace AZ::Data
         return asset.GetStatus();
     }
 
+    //=========================================================================
+    // ShardedAssetMap
+    //=========================================================================
+    Asset<AssetData> AssetManager::ShardedAssetMap::Find(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior) const
+    {
+        Asset<AssetData> asset(assetReferenceLoadBehavior);
+
+        const Shard& shard = GetShard(assetId);
+        AZStd::scoped_lock<AZStd::mutex> shardLock(shard.m_mutex);
+        auto it = shard.m_assets.find(assetId);
+        if (it != shard.m_assets.end())
+        {
+            asset.SetData(it->second);
+        }
+        return asset;
+    }
+
+    bool AssetManager::ShardedAssetMap::Contains(const AssetId& assetId) const
+    {
+        const Shard& shard = GetShard(assetId);
+        AZStd::scoped_lock<AZStd::mutex> shardLock(shard.m_mutex);
+        return shard.m_assets.find(assetId) != shard.m_assets.end();
+    }
+
+    void AssetManager::ShardedAssetMap::Insert(const AssetId& assetId, AssetData* assetData)
+    {
+        Shard& shard = GetShard(assetId);
+        AZStd::scoped_lock<AZStd::mutex> shardLock(shard.m_mutex);
+        shard.m_assets.insert(AZStd::make_pair(assetId, assetData));
+    }
+
+    void AssetManager::ShardedAssetMap::Replace(const AssetId& assetId, AssetData* assetData)
+    {
+        Shard& shard = GetShard(assetId);
+        AZStd::scoped_lock<AZStd::mutex> shardLock(shard.m_mutex);
+        auto found = shard.m_assets.find(assetId);
+        if (found != shard.m_assets.end())
+        {
+            AZ_Assert(assetData->RTTI_GetType() == found->second->RTTI_GetType(), "New and old data types are mismatched!");
+            found->second->m_creationToken = AZ::Data::s_defaultCreationToken;
+            found->second = assetData;
+        }
+        else
+        {
+            shard.m_assets.insert(AZStd::make_pair(assetId, assetData));
+        }
+    }
+
+    bool AssetManager::ShardedAssetMap::EraseIfUnused(const AssetId& assetId, int creationToken)
+    {
+        Shard& shard = GetShard(assetId);
+        AZStd::scoped_lock<AZStd::mutex> shardLock(shard.m_mutex);
+        auto it = shard.m_assets.find(assetId);
+        // need to check the count again in here in case
+        // someone was trying to get the asset on another thread
+        // Set it to -1 so only this thread will attempt to clean up the cache and delete the asset
+        int expectedRefCount = 0;
+        // if the assetId is not in the map or if the identifierId
+        // do not match it implies that the asset has been already destroyed.
+        // if the usecount is non zero it implies that we cannot destroy this asset.
+        if (it != shard.m_assets.end() && it->second->m_creationToken == creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
+        {
+            shard.m_assets.erase(it);
+            return true;
+        }
+        return false;
+    }
+
+    size_t AssetManager::ShardedAssetMap::Size() const
+    {
+        size_t size = 0;
+        for (const Shard& shard : m_shards)
+        {
+            AZStd::scoped_lock<AZStd::mutex> shardLock(shard.m_mutex);
+            size += shard.m_assets.size();
+        }
+        return size;
+    }
+
+    AssetManager::ShardedAssetMap::Shard& AssetManager::ShardedAssetMap::GetShard(const AssetId& assetId)
+    {
+        return m_shards[AZStd::hash<AssetId>{}(assetId) % ShardCount];
+    }
+
+    const AssetManager::ShardedAssetMap::Shard& AssetManager::ShardedAssetMap::GetShard(const AssetId& assetId) const
+    {
+        return m_shards[AZStd::hash<AssetId>{}(assetId) % ShardCount];
+    }
+
     //=========================================================================
     // FindAsset
     //=========================================================================
@@ -869,16 +935,7 @@ namespace AZ::Data
         // If the catalog is not available, use the original assetId
         const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-        AssetMap::iterator it = m_assets.find(assetToFind);
-        if (it != m_assets.end())
-        {
-            Asset<AssetData> asset(assetReferenceLoadBehavior);
-            asset.SetData(it->second);
-
-            return asset;
-        }
-        return Asset<AssetData>(assetReferenceLoadBehavior);
+        return m_assets.Find(assetToFind, assetReferenceLoadBehavior);
     }
 
     AZStd::pair<AZ::IO::IStreamerTypes::Deadline, AZ::IO::IStreamerTypes::Priority> GetEffectiveDeadlineAndPriority(
@@ -1017,16 +1074,9 @@ namespace AZ::Data
             {
                 AZ_PROFILE_SCOPE(AzCore, "GetAsset: FindAsset");
 
-                AssetMap::iterator it = m_assets.find(assetInfo.m_assetId);
-                if (it != m_assets.end())
-                {
-                    assetData = it->second;
-                    asset.SetData(assetData);
-                }
-                else
-                {
-                    isNewEntry = true;
-                }
+                asset = m_assets.Find(assetInfo.m_assetId, assetReferenceLoadBehavior);
+                assetData = asset.Get();
+                isNewEntry = (assetData == nullptr);
             }
 
             {
@@ -1067,7 +1117,7 @@ namespace AZ::Data
                 if (isNewEntry && assetData->IsRegisterReadonlyAndShareable())
                 {
                     AZ_PROFILE_SCOPE(AzCore, "GetAsset: RegisterAsset");
-                    m_assets.insert(AZStd::make_pair(assetInfo.m_assetId, assetData));
+                    m_assets.Insert(assetInfo.m_assetId, assetData);
                 }
                 if (assetData->GetStatus() == AssetData::AssetStatus::NotLoaded)
                 {
@@ -1204,6 +1254,19 @@ namespace AZ::Data
         }
     }
 
+    void AssetManager::UpdateDebugDataLoaded(const AZ::Data::Asset<AZ::Data::AssetData>& asset, bool loadSucceeded)
+    {
+        if(!m_debugAssetEvents)
+        {
+            m_debugAssetEvents = AZ::Interface<IDebugAssetEvent>::Get();
+        }
+
+        if(m_debugAssetEvents)
+        {
+            m_debugAssetEvents->AssetDataLoaded(asset.GetId(), loadSucceeded);
+        }
+    }
+
     Asset<AssetData> AssetManager::FindOrCreateAsset(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior)
     {
         // Look up the asset id in the catalog, and use the result of that instead.
@@ -1240,8 +1303,7 @@ namespace AZ::Data
         AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
 
         // check if asset already exist
-        AssetMap::iterator it = m_assets.find(assetId);
-        if (it == m_assets.end())
+        if (!m_assets.Contains(assetId))
         {
             // find the asset type handler
             AssetHandlerMap::iterator handlerIt = m_handlers.find(assetType);
@@ -1259,7 +1321,7 @@ namespace AZ::Data
                     assetData->RegisterWithHandler(handler);
                     if (assetData->IsRegisterReadonlyAndShareable())
                     {
-                        m_assets.insert(AZStd::make_pair(assetId, assetData));
+                        m_assets.Insert(assetId, assetData);
                     }
 
                     Asset<AssetData> asset(assetReferenceLoadBehavior);
@@ -1293,19 +1355,10 @@ namespace AZ::Data
 
         if (removeAssetFromHash)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
-            AssetMap::iterator it = m_assets.find(assetId);
-            // need to check the count again in here in case
-           // someone was trying to get the asset on another thread
-           // Set it to -1 so only this thread will attempt to clean up the cache and delete the asset
-            int expectedRefCount = 0;
-            // if the assetId is not in the map or if the identifierId
-            // do not match it implies that the asset has been already destroyed.
-            // if the usecount is non zero it implies that we cannot destroy this asset.
-            if (it != m_assets.end() && it->second->m_creationToken == creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
+            // Only the shard of the asset is locked, so releases don't wait on loads holding m_assetMutex.
+            if (m_assets.EraseIfUnused(assetId, creationToken))
             {
                 wasInAssetsHash = true;
-                m_assets.erase(it);
                 destroyAsset = true;
             }
         }
@@ -1441,9 +1494,9 @@ namespace AZ::Data
 
         {
             AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            auto assetIter = m_assets.find(assetId);
+            Asset<AssetData> foundAsset = m_assets.Find(assetId, AZ::Data::AssetLoadBehavior::Default);
 
-            if (assetIter == m_assets.end() || assetIter->second->IsLoading())
+            if (!foundAsset || foundAsset->IsLoading())
             {
                 // Only existing assets can be reloaded.
                 ASSET_DEBUG_OUTPUT(AZStd::string::format("Asset does not exist or is already loading - reload abort - " AZ_STRING_FORMAT,
@@ -1487,14 +1540,14 @@ namespace AZ::Data
             AssetData* newAssetData = nullptr;
             AssetHandler* handler = nullptr;
 
-            bool preventAutoReload = isAutoReload && assetIter->second && !assetIter->second->HandleAutoReload();
+            bool preventAutoReload = isAutoReload && !foundAsset->HandleAutoReload();
 
             // when Asset<T>'s constructor is called (the one that takes an AssetData), it updates the AssetID
             // of the Asset<T> to be the real latest canonical assetId of the asset, so we cache that here instead of have it happen
             // implicitly and repeatedly for anything we call.
-            Asset<AssetData> currentAsset(assetIter->second, AZ::Data::AssetLoadBehavior::Default);
+            Asset<AssetData> currentAsset(foundAsset.Get(), AZ::Data::AssetLoadBehavior::Default);
 
-            if (!assetIter->second->IsRegisterReadonlyAndShareable() && !preventAutoReload)
+            if (!foundAsset->IsRegisterReadonlyAndShareable() && !preventAutoReload)
             {
                 // Reloading an "instance asset" is basically a no-op.
                 // We'll simply notify users to reload the asset.
@@ -1601,23 +1654,22 @@ namespace AZ::Data
         {
             AZ_Assert(asset.Get(), "Asset data for reload is missing.");
             AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            Asset<AssetData> found = m_assets.Find(asset.GetId(), AZ::Data::AssetLoadBehavior::Default);
             AZ_Assert(
-                m_assets.find(asset.GetId()) != m_assets.end(),
+                found,
                 "Unable to reload asset %s because it's not in the AssetManager's asset list.", asset.ToString<AZStd::string>().c_str());
             AZ_Assert(
-                m_assets.find(asset.GetId()) == m_assets.end() ||
-                    asset->RTTI_GetType() == m_assets.find(asset.GetId())->second->RTTI_GetType(),
+                !found || asset->RTTI_GetType() == found->RTTI_GetType(),
                 "New and old data types are mismatched!");
 
-            auto found = m_assets.find(asset.GetId());
-            if ((found == m_assets.end()) || (asset->RTTI_GetType() != found->second->RTTI_GetType()))
+            if (!found || (asset->RTTI_GetType() != found->RTTI_GetType()))
             {
                 return; // this will just lead to crashes down the line and the above asserts cover this.
             }
 
             AssetData* newData = asset.Get();
 
-            if (found->second != newData)
+            if (found.Get() != newData)
             {
                 // Notify users that we are about to change asset
                 AssetBus::Event(asset.GetId(), &AssetBus::Events::OnAssetPreReload, asset);
@@ -1672,9 +1724,6 @@ namespace AZ::Data
             bool requeue{ false };
             {
                 AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                auto found = m_assets.find(assetId);
-                AZ_Assert(found == m_assets.end() || asset.Get()->RTTI_GetType() == found->second->RTTI_GetType(),
-                    "New and old data types are mismatched!");
 
                 // if we are here it implies that we have two assets with the same asset id, and we are
                 // trying to replace the old asset with the new asset which was not created using the asset manager system.
@@ -1682,14 +1731,10 @@ namespace AZ::Data
                 // because of creation token mismatch when it's ref count finally goes to zero. Since the old asset is not shareable anymore
                 // manually setting the creationToken to default creation token will ensure that the asset is destroyed correctly.
                 asset.m_assetData->m_creationToken = ++m_creationTokenGenerator;
-                if (found != m_assets.end())
-                {
-                    found->second->m_creationToken = AZ::Data::s_defaultCreationToken;
-                }
 
                 // Held references to old data are retained, but replace the entry in the DB for future requests.
                 // Fire an OnAssetReloaded message so listeners can react to the new data.
-                m_assets[assetId] = asset.Get();
+                m_assets.Replace(assetId, asset.Get());
 
                 // Release the reload reference.
                 auto reloadInfo = m_reloads.find(assetId);
@@ -1845,6 +1890,7 @@ namespace AZ::Data
         AssetData* data = asset.Get();
         AZ_Assert(data, "NotifyAssetReady: asset is missing info!");
         data->m_status = AssetData::AssetStatus::Ready;
+        UpdateDebugStatus(asset);
 
         AssetLoadBus::Event(asset.GetId(), &AssetLoadBus::Events::OnAssetReady, asset); // Broadcast to any containers first
         AssetBus::Event(asset.GetId(), &AssetBus::Events::OnAssetReady, asset);
@@ -17,6 +17,7 @@
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -65,6 +66,8 @@ namespace AZ
 
             virtual void AssetStatusUpdate(AZ::Data::AssetId id, AZ::Data::AssetData::AssetStatus status) = 0;
             virtual void ReleaseAsset(AZ::Data::AssetId id) = 0;
+            //! Called on the loading thread once the handler finished deserializing the asset data, before any waiting on preloads.
+            virtual void AssetDataLoaded([[maybe_unused]] AZ::Data::AssetId id, [[maybe_unused]] bool loadSucceeded) {}
         };
 
         struct AssetContainerKey
@@ -357,6 +360,7 @@ namespace AZ
             void QueueAssetReload(AZ::Data::Asset<AZ::Data::AssetData> asset, bool signalLoaded);
 
             void UpdateDebugStatus(const AZ::Data::Asset<AZ::Data::AssetData>& asset);
+            void UpdateDebugDataLoaded(const AZ::Data::Asset<AZ::Data::AssetData>& asset, bool loadSucceeded);
 
             /**
             * Gets a root asset and dependencies as individual async loads if necessary.
@@ -403,11 +407,61 @@ namespace AZ
                 const AZ::Data::AssetStreamInfo& streamInfo, bool isReload,
                 AssetHandler* handler, const AssetLoadParameters& loadParameters, bool signalLoaded);
 
+            //! The asset map split into shards by AssetId hash, each one guarded by its own mutex. Finding and releasing assets
+            //! only lock the shard, so threads looking up or dropping the last reference to different assets don't contend
+            //! with each other or with loads holding m_assetMutex. Adding assets still requires m_assetMutex, which keeps the
+            //! check for an existing asset and the creation of a new one atomic.
+            class ShardedAssetMap
+            {
+            public:
+                static constexpr size_t ShardCount = 16;
+
+                //! Returns a reference to the asset with the given id, or an empty one. The reference is taken while the
+                //! shard is locked, so a concurrent release can't destroy the asset before the caller holds it.
+                Asset<AssetData> Find(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior) const;
+                bool Contains(const AssetId& assetId) const;
+                void Insert(const AssetId& assetId, AssetData* assetData);
+                //! Stores the asset data in place of any existing entry. The replaced data gets the default creation token,
+                //! because it isn't owned by the map anymore and needs to be destroyed once its last reference is released.
+                void Replace(const AssetId& assetId, AssetData* assetData);
+                //! Removes the asset if it's still the one with the given creation token and no references were taken
+                //! since its last one got released. Returns true if the caller is now responsible for destroying it.
+                bool EraseIfUnused(const AssetId& assetId, int creationToken);
+                size_t Size() const;
+
+                //! Calls the function with every stored asset data while its shard is locked. The function must not
+                //! release asset references, because that would lock the shard again.
+                template<typename Function>
+                void ForEach(Function&& function) const
+                {
+                    for (const Shard& shard : m_shards)
+                    {
+                        AZStd::scoped_lock<AZStd::mutex> shardLock(shard.m_mutex);
+                        for (const auto& assetEntry : shard.m_assets)
+                        {
+                            function(assetEntry.second);
+                        }
+                    }
+                }
+
+            private:
+                struct Shard
+                {
+                    mutable AZStd::mutex m_mutex;
+                    AssetMap m_assets;
+                };
+
+                Shard& GetShard(const AssetId& assetId);
+                const Shard& GetShard(const AssetId& assetId) const;
+
+                AZStd::array<Shard, ShardCount> m_shards;
+            };
+
             AssetHandlerMap         m_handlers;
             AssetCatalogMap         m_catalogs;
             AZStd::recursive_mutex  m_catalogMutex;     // lock when accessing the catalog map
-            AssetMap                m_assets;
-            AZStd::recursive_mutex  m_assetMutex;       // lock when accessing the asset map
+            ShardedAssetMap         m_assets;
+            AZStd::recursive_mutex  m_assetMutex;       // lock when adding assets to the asset map or changing their load state
 
             WeakAssetContainerMap   m_assetContainers;
             OwnedAssetContainerMap  m_ownedAssetContainers;
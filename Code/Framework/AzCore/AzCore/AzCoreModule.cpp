@@ -21,6 +21,7 @@
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/EBus/EventSchedulerSystemComponent.h>
 #include <AzCore/Task/TaskGraphSystemComponent.h>
+#include <AzCore/Component/ParallelTickSystemComponent.h>
 #include <AzCore/Statistics/StatisticalProfilerProxySystemComponent.h>
 
 namespace AZ
@@ -40,6 +41,7 @@ namespace AZ
             LoggerSystemComponent::CreateDescriptor(),
             EventSchedulerSystemComponent::CreateDescriptor(),
             TaskGraphSystemComponent::CreateDescriptor(),
+            ParallelTickSystemComponent::CreateDescriptor(),
 
 #if !defined(_RELEASE)
             Statistics::StatisticalProfilerProxySystemComponent::CreateDescriptor(),
@@ -58,6 +60,7 @@ namespace AZ
             azrtti_typeid<LoggerSystemComponent>(),
             azrtti_typeid<EventSchedulerSystemComponent>(),
             azrtti_typeid<TaskGraphSystemComponent>(),
+            azrtti_typeid<ParallelTickSystemComponent>(),
 
 #if !defined(_RELEASE)
             azrtti_typeid<Statistics::StatisticalProfilerProxySystemComponent>(),
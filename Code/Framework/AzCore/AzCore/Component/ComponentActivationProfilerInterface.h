@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/RTTI/RTTIMacros.h>
+#include <AzCore/std/chrono/chrono.h>
+
+namespace AZ
+{
+    class Component;
+
+    //! Receives the time spent in each Component::Activate call, so tools can attribute entity activation cost to component types.
+    //! Register an implementation with AZ::Interface; entities only time their component activations while it is capturing.
+    class ComponentActivationProfilerInterface
+    {
+    public:
+        AZ_RTTI(ComponentActivationProfilerInterface, "{5A0B7E0C-7D63-4E24-9B8A-3F5D3C2F6A41}");
+
+        virtual ~ComponentActivationProfilerInterface() = default;
+
+        //! Returns true if component activations should be timed and recorded.
+        virtual bool IsCapturing() const = 0;
+
+        //! Records the time the component spent in Activate. The time includes anything activated from within that call.
+        //! This can be called from any thread that activates entities.
+        virtual void RecordComponentActivation(const Component& component, AZStd::chrono::microseconds duration) = 0;
+    };
+} // namespace AZ
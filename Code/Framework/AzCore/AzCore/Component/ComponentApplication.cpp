@@ -15,12 +15,15 @@
 
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
+#include <AzCore/Component/ComponentDependencySortCache.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Date/DateFormat.h>
 
 #include <AzCore/Memory/AllocationRecords.h>
 
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Memory/OSMemory.h>
 
 #include <AzCore/Metrics/EventLoggerFactoryImpl.h>
 #include <AzCore/Metrics/JsonTraceEventLogger.h>
@@ -41,6 +44,7 @@
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/Settings/SettingsRegistryScriptUtils.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
 #include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
 #include <AzCore/Settings/SettingsRegistryOriginTracker.h>
 #include <AzCore/StringFunc/StringFunc.h>
@@ -71,6 +75,7 @@
 #endif // defined(AZ_ENABLE_DEBUG_TOOLS)
 
 #include <AzCore/Module/Environment.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/utility/charconv.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
@@ -96,6 +101,10 @@ namespace AZ::Metrics
 
 namespace AZ::Internal
 {
+    // Settings key which determines if the BehaviorContext is only reflected when it's first requested.
+    // On by default for applications that aren't tools, which rarely need scripting reflection during startup.
+    constexpr AZStd::string_view LazyBehaviorContextKey = "/O3DE/Application/LazyBehaviorContext";
+
     static bool ShouldCreateCoreMetricsLogger(SettingsRegistryInterface& settingsRegistry)
     {
 #if !defined(AZ_RELEASE_BUILD)
@@ -135,6 +144,34 @@ namespace AZ::Internal
 #endif
     }
 
+    //! Returns the inputs of the merged settings that aren't recorded in the file history of the Settings Registry.
+    //! The project and engine are located relative to the executable and the working directory, so both are part of the key.
+    static AZStd::string GetSettingsRegistrySnapshotKey(const AZ::CommandLine& commandLine)
+    {
+        AZStd::string snapshotKey = AZ_BUILD_CONFIGURATION_TYPE "\n";
+
+        char executablePath[AZ::IO::MaxPathLength];
+        if (AZ::Utils::GetExecutablePath(executablePath, AZ_ARRAY_SIZE(executablePath)).m_pathStored == AZ::Utils::ExecutablePathResult::Success)
+        {
+            snapshotKey += executablePath;
+        }
+        snapshotKey += '\n';
+
+        if (auto workingDirectory = AZ::Utils::ConvertToAbsolutePath("."); workingDirectory.has_value())
+        {
+            snapshotKey += workingDirectory->c_str();
+        }
+        snapshotKey += '\n';
+
+        AZ::CommandLine::ParamContainer arguments;
+        commandLine.Dump(arguments);
+        for (const AZStd::string& argument : arguments)
+        {
+            snapshotKey += argument;
+            snapshotKey += '\n';
+        }
+        return snapshotKey;
+    }
 } // namespace AZ::Internal
 
 namespace AZ
@@ -164,6 +201,14 @@ namespace AZ
     AZ_CONSOLEFREEFUNC(PrintEntityName, AZ::ConsoleFunctorFlags::Null,
         "Parameter: EntityId value, Prints the name of the entity to the console");
 
+    static void OnLargePageModeChanged(const int& largePageMode)
+    {
+        OSMemory::SetLargePageMode(static_cast<OSMemory::LargePageMode>(AZStd::clamp(largePageMode, 0, 2)));
+    }
+
+    AZ_CVAR(int, sys_largePageMode, 0, &OnLargePageModeChanged, AZ::ConsoleFunctorFlags::Null,
+        "Backs the heap arenas mapped from now on with large pages. 0=disabled, 1=transparent large pages, 2=reserved large pages");
+
     static EnvironmentVariable<ReflectionEnvironment> s_reflectionEnvironment;
     static const char* s_reflectionEnvironmentName = "ReflectionEnvironment";
 
@@ -380,7 +425,8 @@ namespace AZ
                     ->Value("No records", Debug::AllocationRecords::RECORD_NO_RECORDS)
                     ->Value("No stack trace", Debug::AllocationRecords::RECORD_STACK_NEVER)
                     ->Value("Stack trace when file/line missing", Debug::AllocationRecords::RECORD_STACK_IF_NO_FILE_LINE)
-                    ->Value("Stack trace always", Debug::AllocationRecords::RECORD_FULL);
+                    ->Value("Stack trace always", Debug::AllocationRecords::RECORD_FULL)
+                    ->Value("Sampled stack traces", Debug::AllocationRecords::RECORD_SAMPLED);
                 ec->Class<Descriptor>("System memory settings", "Settings for managing application memory usage")
                     ->ClassElement(Edit::ClassElements::EditorData, "")
                         ->Attribute(Edit::Attributes::AutoExpand, true)
@@ -784,8 +830,38 @@ namespace AZ
         // This can be moved to the ComponentApplication constructor if need be
         // This is reading the *.setreg files using SystemFile and merging the settings
         // to the settings registry.
+        // If a snapshot path is set, a snapshot of previously merged settings replaces merging the files when none of
+        // them changed.
+        SettingsRegistryInterface::FixedValueString snapshotPath;
+        const bool useSnapshot = m_startupParameters.m_loadSettingsRegistry &&
+            m_settingsRegistry->Get(snapshotPath, SettingsRegistrySnapshot::SnapshotPathKey) && !snapshotPath.empty();
+        const AZStd::string snapshotKey = useSnapshot ? Internal::GetSettingsRegistrySnapshotKey(m_commandLine) : AZStd::string{};
+        if (useSnapshot && SettingsRegistrySnapshot::Load(*m_settingsRegistry, snapshotPath.c_str(), snapshotKey))
+        {
+            // The snapshot already contains the command line settings, but the final merge of the command line also
+            // executes the command-line commands.
+            if constexpr (AZ::Internal::GetDevelopmentSettingsOverrides() >= AZ::Internal::DevelopmentSettingsOverrides::CommandLineOnly)
+            {
+                SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(*m_settingsRegistry, m_commandLine, true);
+            }
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(*m_settingsRegistry);
+        }
+        else
+        {
+            MergeSettingsToRegistry(*m_settingsRegistry);
+            if (useSnapshot)
+            {
+                SettingsRegistrySnapshot::Save(*m_settingsRegistry, snapshotPath.c_str(), snapshotKey);
+            }
+        }
 
-        MergeSettingsToRegistry(*m_settingsRegistry);
+        bool cacheDependencySorts = false;
+        m_settingsRegistry->Get(cacheDependencySorts, ComponentDependencySortCacheKey);
+        if (cacheDependencySorts)
+        {
+            m_dependencySortCache = AZStd::make_unique<ComponentDependencySortCache>();
+            AZ::Interface<ComponentDependencySortCache>::Register(m_dependencySortCache.get());
+        }
 
         m_systemEntity = AZStd::make_unique<AZ::Entity>(SystemEntityId, "SystemEntity");
         CreateCommon();
@@ -924,6 +1000,12 @@ namespace AZ
 
         m_systemEntity.reset();
 
+        if (m_dependencySortCache)
+        {
+            AZ::Interface<ComponentDependencySortCache>::Unregister(m_dependencySortCache.get());
+            m_dependencySortCache.reset();
+        }
+
         Sfmt::Destroy();
 
         // delete all descriptors left for application clean up
@@ -1094,6 +1176,11 @@ namespace AZ
                     descriptor->Reflect(context);
                 });
         }
+
+        if (m_dependencySortCache)
+        {
+            m_dependencySortCache->Clear();
+        }
     }
 
     //=========================================================================
@@ -1105,6 +1192,73 @@ namespace AZ
         {
             ReflectionEnvironment::GetReflectionManager()->Unreflect(descriptor->GetUuid());
         }
+
+        if (m_dependencySortCache)
+        {
+            m_dependencySortCache->Clear();
+        }
+    }
+
+    void ComponentApplication::ActivateEntities(AZStd::span<Entity* const> entities)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        AZStd::vector<Entity*> activatingEntities;
+        activatingEntities.reserve(entities.size());
+        for (Entity* entity : entities)
+        {
+            if (entity->BeginActivation())
+            {
+                activatingEntities.push_back(entity);
+            }
+        }
+
+        // Sorting puts entities with the same composition next to each other.
+        auto compositionLess = [](const Entity* lhs, const Entity* rhs)
+        {
+            const Entity::ComponentArrayType& lhsComponents = lhs->m_components;
+            const Entity::ComponentArrayType& rhsComponents = rhs->m_components;
+            if (lhsComponents.size() != rhsComponents.size())
+            {
+                return lhsComponents.size() < rhsComponents.size();
+            }
+            for (size_t i = 0; i < lhsComponents.size(); ++i)
+            {
+                const TypeId lhsType = azrtti_typeid(lhsComponents[i]);
+                const TypeId rhsType = azrtti_typeid(rhsComponents[i]);
+                if (lhsType != rhsType)
+                {
+                    return lhsType < rhsType;
+                }
+            }
+            return false;
+        };
+        AZStd::stable_sort(activatingEntities.begin(), activatingEntities.end(), compositionLess);
+
+        ComponentActivationProfilerInterface* activationProfiler = Entity::GetCapturingActivationProfiler();
+
+        for (auto groupBegin = activatingEntities.begin(); groupBegin != activatingEntities.end();)
+        {
+            auto groupEnd = AZStd::find_if(groupBegin + 1, activatingEntities.end(),
+                [&compositionLess, groupBegin](const Entity* entity)
+                {
+                    return compositionLess(*groupBegin, entity);
+                });
+
+            const size_t componentCount = (*groupBegin)->m_components.size();
+            for (size_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+            {
+                for (auto it = groupBegin; it != groupEnd; ++it)
+                {
+                    Entity::ActivateComponent(*(*it)->m_components[componentIndex], activationProfiler);
+                }
+            }
+            for (auto it = groupBegin; it != groupEnd; ++it)
+            {
+                (*it)->EndActivation();
+            }
+            groupBegin = groupEnd;
+        }
     }
 
     void ComponentApplication::RegisterEntityAddedEventHandler(EntityAddedEvent::Handler& handler)
@@ -1286,7 +1440,20 @@ namespace AZ
         ReflectionEnvironment::Init();
 
         ReflectionEnvironment::GetReflectionManager()->AddReflectContext<SerializeContext>();
-        ReflectionEnvironment::GetReflectionManager()->AddReflectContext<BehaviorContext>();
+
+        // Tools reflect to the BehaviorContext up front, runtime applications only pay for it once something uses it
+        ApplicationTypeQuery appType;
+        QueryApplicationType(appType);
+        bool lazyBehaviorContext = !appType.IsTool() && !m_startupParameters.m_createEditContext;
+        m_settingsRegistry->Get(lazyBehaviorContext, Internal::LazyBehaviorContextKey);
+        if (lazyBehaviorContext)
+        {
+            ReflectionEnvironment::GetReflectionManager()->AddLazyReflectContext<BehaviorContext>();
+        }
+        else
+        {
+            ReflectionEnvironment::GetReflectionManager()->AddReflectContext<BehaviorContext>();
+        }
         ReflectionEnvironment::GetReflectionManager()->AddReflectContext<JsonRegistrationContext>();
     }
 
@@ -1498,6 +1665,12 @@ namespace AZ
             m_lastTickTime = currentMonotonicTime;
         }
 
+        // Start a new frame in the frame arena, only if something has used it so it isn't created needlessly
+        if (auto frameArena = Environment::FindVariable<FrameArenaAllocator>(AzTypeInfo<FrameArenaAllocator>::Name()))
+        {
+            frameArena->AdvanceFrame();
+        }
+
         {
             AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ExecuteQueuedEvents");
             TickBus::ExecuteQueuedEvents();
@@ -24,6 +24,7 @@
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Settings/SettingsRegistryConsoleUtils.h>
 #include <AzCore/Settings/SettingsRegistryOriginTracker.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/conversions.h>
@@ -33,6 +34,7 @@
 namespace AZ
 {
     class BehaviorContext;
+    class ComponentDependencySortCache;
     class SerializeContext;
     class IConsole;
     class Module;
@@ -203,6 +205,16 @@ namespace AZ
 
         Descriptor& GetDescriptor() { return m_descriptor; }
 
+        /**
+         * Activates a group of initialized entities at once. Entities with the same components in the same order are
+         * activated together one component at a time, so the Activate function of each component type runs for all
+         * those entities in a row. Entities whose components can't be sorted are skipped, as with Entity::Activate.
+         * \note Entities are activated through the Entity implementation of Activate. The order in which entities are
+         *       activated isn't preserved and components of one entity can activate while other entities of the group are
+         *       still activating, so components must not deactivate or delete other entities of the group while activating.
+         */
+        void ActivateEntities(AZStd::span<Entity* const> entities);
+
         /**
          * Ticks all components using the \ref AZ::TickBus during simulation time. May not tick if the application is not active (i.e. not in focus)
          */
@@ -364,6 +376,9 @@ namespace AZ
 
         AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
 
+        //! Only created if the ComponentDependencySortCacheKey setting is enabled.
+        AZStd::unique_ptr<ComponentDependencySortCache> m_dependencySortCache;
+
         // ConsoleFunctorHandle is responsible for unregistering the Settings Registry Console
         // from the m_console member when it goes out of scope
         AZ::SettingsRegistryConsoleUtils::ConsoleFunctorHandle m_settingsRegistryConsoleFunctors;
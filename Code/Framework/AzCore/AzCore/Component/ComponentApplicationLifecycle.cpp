@@ -7,10 +7,52 @@
  */
 
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/time.h>
 
 namespace AZ::ComponentApplicationLifecycle
 {
+    static void PrintLifecycleTimeline([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+        if (settingsRegistry == nullptr)
+        {
+            return;
+        }
+
+        using FixedValueString = SettingsRegistryInterface::FixedValueString;
+        AZStd::vector<AZStd::pair<AZ::s64, FixedValueString>> timeline;
+        auto visitEvent = [settingsRegistry, &timeline](const AZ::SettingsRegistryInterface::VisitArgs& visitArgs)
+        {
+            AZ::s64 timeUs = 0;
+            if (settingsRegistry->Get(timeUs, visitArgs.m_jsonKeyPath))
+            {
+                timeline.emplace_back(timeUs, FixedValueString(visitArgs.m_fieldName));
+            }
+            return AZ::SettingsRegistryInterface::VisitResponse::Skip;
+        };
+        AZ::SettingsRegistryVisitorUtils::VisitObject(*settingsRegistry, visitEvent, ApplicationLifecycleTimelineKey);
+        if (timeline.empty())
+        {
+            return;
+        }
+
+        AZStd::sort(timeline.begin(), timeline.end());
+        AZ_TracePrintf("ComponentApplicationLifecycle", "Lifecycle timeline (ms since %s, ms since previous event):\n", timeline.front().second.c_str());
+        AZ::s64 previousTimeUs = timeline.front().first;
+        for (const auto& [timeUs, eventName] : timeline)
+        {
+            AZ_TracePrintf("ComponentApplicationLifecycle", "  %10.3f %10.3f %s\n",
+                (timeUs - timeline.front().first) / 1000.0, (timeUs - previousTimeUs) / 1000.0, eventName.c_str());
+            previousTimeUs = timeUs;
+        }
+    }
+    AZ_CONSOLEFREEFUNC(PrintLifecycleTimeline, AZ::ConsoleFunctorFlags::Null, "Prints the time each application lifecycle event was signaled");
+
     bool ValidateEvent(AZ::SettingsRegistryInterface& settingsRegistry, AZStd::string_view eventName)
     {
         using FixedValueString = SettingsRegistryInterface::FixedValueString;
@@ -33,6 +75,11 @@ namespace AZ::ComponentApplicationLifecycle
                 " or in *.setreg within the project", AZ_STRING_ARG(eventName), AZ_STRING_ARG(ApplicationLifecycleEventRegistrationKey));
             return false;
         }
+        // Record the time of the event first, so that handlers of the event can measure how long they take
+        auto eventTimelineKey = FixedValueString::format("%.*s/%.*s", AZ_STRING_ARG(ApplicationLifecycleTimelineKey),
+            AZ_STRING_ARG(eventName));
+        settingsRegistry.Set(eventTimelineKey, aznumeric_cast<AZ::s64>(AZStd::GetTimeNowMicroSecond()));
+
         // The Settings Registry key used to signal the event is a transient runtime key which is separate from the registration key
         auto eventSignalKey = FixedValueString::format("%.*s/%.*s", AZ_STRING_ARG(ApplicationLifecycleEventSignalKey),
             AZ_STRING_ARG(eventName));
@@ -23,6 +23,12 @@ namespace AZ::ComponentApplicationLifecycle
     //! where registering a lifecycle event would result in signaling the event.
     inline constexpr AZStd::string_view ApplicationLifecycleEventSignalKey = "/O3DE/Runtime/Application/LifecycleEvents";
 
+    //! Root Key where the time each lifecycle event was last signaled is recorded, in microseconds
+    //! Together the times form a timeline of the application startup and shutdown, which can be printed
+    //! with the PrintLifecycleTimeline console command.
+    //! This key section is runtime only as well
+    inline constexpr AZStd::string_view ApplicationLifecycleTimelineKey = "/O3DE/Runtime/Application/LifecycleTimeline";
+
     //! Validates that the event @eventName is stored in the array at ApplicationLifecycleEventRegistrationKey
     //! @param settingsRegistry registry where @eventName will be searched
     //! @param eventName name of key that validated that exists as an element in the ApplicationLifecycleEventRegistrationKey array
@@ -33,6 +39,7 @@ namespace AZ::ComponentApplicationLifecycle
     //! It validates if the @eventName is is part of the ApplicationLifecycleEventRegistrationKey array 
     //! It then appends the @eventName to the ApplicationLifecycleEventRegistrationKey merges the @eventValue into
     //! the SettingsRegistry at that key
+    //! The time the event is signaled is recorded underneath the ApplicationLifecycleTimelineKey
     //! NOTE: This function should only be invoked from ComponentApplication and its derived classes
     //! @param settingsRegistry registry where eventName should be set
     //! @param eventName name of key underneath the ApplicationLifecycleEventRegistrationKey to signal
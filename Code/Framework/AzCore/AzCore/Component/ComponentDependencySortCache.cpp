@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Component/ComponentDependencySortCache.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+
+namespace AZ
+{
+    Entity::DependencySortOutcome ComponentDependencySortCache::Sort(Entity::ComponentArrayType& inOutComponents)
+    {
+        // The sort removes null components, which changes the composition.
+        if (AZStd::find(inOutComponents.begin(), inOutComponents.end(), nullptr) != inOutComponents.end())
+        {
+            return Entity::DependencySort(inOutComponents);
+        }
+
+        const size_t hash = HashComposition(inOutComponents);
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            if (auto bucket = m_cachedSorts.find(hash); bucket != m_cachedSorts.end())
+            {
+                for (const CachedSort& cachedSort : bucket->second)
+                {
+                    if (MatchesComposition(cachedSort, inOutComponents))
+                    {
+                        Entity::ComponentArrayType sortedComponents;
+                        sortedComponents.reserve(inOutComponents.size());
+                        for (AZ::u32 index : cachedSort.m_sortedIndices)
+                        {
+                            sortedComponents.push_back(inOutComponents[index]);
+                        }
+                        inOutComponents = AZStd::move(sortedComponents);
+                        return AZ::Success();
+                    }
+                }
+            }
+        }
+
+        const Entity::ComponentArrayType unsortedComponents = inOutComponents;
+        Entity::DependencySortOutcome outcome = Entity::DependencySort(inOutComponents);
+        if (!outcome.IsSuccess())
+        {
+            return outcome;
+        }
+
+        CachedSort cachedSort;
+        cachedSort.m_componentTypes.reserve(unsortedComponents.size() * 2);
+        for (const Component* component : unsortedComponents)
+        {
+            const TypeId underlyingType = component->GetUnderlyingComponentType();
+
+            // Components with the same underlying type are ordered by their component ids, which usually differ between entities.
+            for (size_t i = 1; i < cachedSort.m_componentTypes.size(); i += 2)
+            {
+                if (cachedSort.m_componentTypes[i] == underlyingType)
+                {
+                    return outcome;
+                }
+            }
+
+            cachedSort.m_componentTypes.push_back(azrtti_typeid(component));
+            cachedSort.m_componentTypes.push_back(underlyingType);
+        }
+
+        cachedSort.m_sortedIndices.reserve(inOutComponents.size());
+        for (const Component* component : inOutComponents)
+        {
+            auto it = AZStd::find(unsortedComponents.begin(), unsortedComponents.end(), component);
+            cachedSort.m_sortedIndices.push_back(aznumeric_cast<AZ::u32>(it - unsortedComponents.begin()));
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        AZStd::vector<CachedSort>& bucket = m_cachedSorts[hash];
+        // Another thread may have sorted the same composition in the meantime.
+        auto matches = [&unsortedComponents](const CachedSort& existingSort)
+        {
+            return MatchesComposition(existingSort, unsortedComponents);
+        };
+        if (AZStd::none_of(bucket.begin(), bucket.end(), matches))
+        {
+            bucket.push_back(AZStd::move(cachedSort));
+            ++m_cachedSortCount;
+        }
+        return outcome;
+    }
+
+    void ComponentDependencySortCache::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_cachedSorts.clear();
+        m_cachedSortCount = 0;
+    }
+
+    size_t ComponentDependencySortCache::GetCachedSortCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_cachedSortCount;
+    }
+
+    size_t ComponentDependencySortCache::HashComposition(const Entity::ComponentArrayType& components)
+    {
+        size_t hash = components.size();
+        for (const Component* component : components)
+        {
+            AZStd::hash_combine(hash, azrtti_typeid(component), component->GetUnderlyingComponentType());
+        }
+        return hash;
+    }
+
+    bool ComponentDependencySortCache::MatchesComposition(const CachedSort& cachedSort, const Entity::ComponentArrayType& components)
+    {
+        if (cachedSort.m_componentTypes.size() != components.size() * 2)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < components.size(); ++i)
+        {
+            if (cachedSort.m_componentTypes[i * 2] != azrtti_typeid(components[i]) ||
+                cachedSort.m_componentTypes[i * 2 + 1] != components[i]->GetUnderlyingComponentType())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace AZ
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AZ
+{
+    //! Setting that enables caching the results of Entity::DependencySort. Defaults to false.
+    inline constexpr const char* ComponentDependencySortCacheKey = "/O3DE/AzCore/Entity/DependencySortCache/Enabled";
+
+    //! Caches the order Entity::DependencySort puts components in, keyed on the types of the components in the order they're
+    //! stored. Entities with the same composition, such as entities spawned from the same prefab, are then sorted by reordering
+    //! their components instead of evaluating the services of every component again.
+    //! The cache assumes that the services of a component only depend on its type, so it's cleared whenever component
+    //! descriptors are registered or unregistered. The ComponentApplication creates and registers the cache with AZ::Interface
+    //! when ComponentDependencySortCacheKey is set.
+    class ComponentDependencySortCache
+    {
+    public:
+        AZ_RTTI(ComponentDependencySortCache, "{6525A354-20C5-4FEC-BF34-59FF97C43501}");
+        AZ_CLASS_ALLOCATOR(ComponentDependencySortCache, SystemAllocator);
+
+        virtual ~ComponentDependencySortCache() = default;
+
+        //! Sorts the components in the same order as Entity::DependencySort. If components of the same types were sorted before,
+        //! the previous order is reused. Failed sorts aren't cached so they always report their details.
+        //! This function is thread safe.
+        Entity::DependencySortOutcome Sort(Entity::ComponentArrayType& inOutComponents);
+
+        //! Removes all cached sorts, for instance because the services of a component type changed.
+        void Clear();
+
+        //! Returns the number of distinct component compositions that have a cached sort.
+        size_t GetCachedSortCount() const;
+
+    private:
+        struct CachedSort
+        {
+            //! Type and underlying type of every component in the order they're stored in the entity.
+            AZStd::vector<TypeId> m_componentTypes;
+            //! For every position in the sorted array, the index of the component in the unsorted array.
+            AZStd::vector<AZ::u32> m_sortedIndices;
+        };
+
+        static size_t HashComposition(const Entity::ComponentArrayType& components);
+        static bool MatchesComposition(const CachedSort& cachedSort, const Entity::ComponentArrayType& components);
+
+        mutable AZStd::shared_mutex m_mutex;
+        AZStd::unordered_map<size_t, AZStd::vector<CachedSort>> m_cachedSorts;
+        size_t m_cachedSortCount = 0;
+    };
+} // namespace AZ
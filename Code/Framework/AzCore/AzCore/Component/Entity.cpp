@@ -7,6 +7,8 @@
  */
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/ComponentActivationProfilerInterface.h>
+#include <AzCore/Component/ComponentDependencySortCache.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/EntityIdSerializer.h>
 #include <AzCore/Component/EntitySerializer.h>
@@ -197,22 +199,59 @@ namespace AZ
     {
         AZ_PROFILE_FUNCTION(AzCore);
 
+        if (!BeginActivation())
+        {
+            return;
+        }
+
+        ComponentActivationProfilerInterface* activationProfiler = GetCapturingActivationProfiler();
+        for (ComponentArrayType::iterator it = m_components.begin(); it != m_components.end(); ++it)
+        {
+            ActivateComponent(**it, activationProfiler);
+        }
+
+        EndActivation();
+    }
+
+    ComponentActivationProfilerInterface* Entity::GetCapturingActivationProfiler()
+    {
+        ComponentActivationProfilerInterface* activationProfiler = AZ::Interface<ComponentActivationProfilerInterface>::Get();
+        return (activationProfiler && activationProfiler->IsCapturing()) ? activationProfiler : nullptr;
+    }
+
+    void Entity::ActivateComponent(Component& component, ComponentActivationProfilerInterface* activationProfiler)
+    {
+        if (!activationProfiler)
+        {
+            component.Activate();
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(AzCore, "Entity::ActivateComponent %s", component.RTTI_GetTypeName());
+        const auto activationStart = AZStd::chrono::steady_clock::now();
+        component.Activate();
+        activationProfiler->RecordComponentActivation(
+            component,
+            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - activationStart));
+    }
+
+    bool Entity::BeginActivation()
+    {
         AZ_Assert(m_state == State::Init, "Entity should be in Init state to be Activated!");
 
         const DependencySortOutcome sortOutcome = EvaluateDependenciesGetDetails();
         if (!sortOutcome.IsSuccess())
         {
             AZ_Error("Entity", false, "Entity '%s' %s cannot be activated. %s", m_name.c_str(), m_id.ToString().c_str(), sortOutcome.GetError().m_message.c_str());
-            return;
+            return false;
         }
 
         SetState(State::Activating);
+        return true;
+    }
 
-        for (ComponentArrayType::iterator it = m_components.begin(); it != m_components.end(); ++it)
-        {
-            ActivateComponent(**it);
-        }
-
+    void Entity::EndActivation()
+    {
         SetState(State::Active);
 
         EntityBus::Event(m_id, &EntityBus::Events::OnEntityActivated, m_id);
@@ -260,7 +299,14 @@ namespace AZ
 
         if (!m_isDependencyReady)
         {
-            outcome = DependencySort(m_components);
+            if (ComponentDependencySortCache* sortCache = AZ::Interface<ComponentDependencySortCache>::Get())
+            {
+                outcome = sortCache->Sort(m_components);
+            }
+            else
+            {
+                outcome = DependencySort(m_components);
+            }
             m_isDependencyReady = outcome.IsSuccess();
         }
 
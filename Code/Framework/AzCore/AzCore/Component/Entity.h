@@ -25,6 +25,7 @@ namespace AZ
 {
     class Transform;
     class TransformInterface;
+    class ComponentActivationProfilerInterface;
 
     //! An addressable container for a group of components. 
     //! An entity creates, initializes, activates, and deactivates its components.  
@@ -32,6 +33,7 @@ namespace AZ
     class Entity
     {
         friend class JsonEntitySerializer;
+        friend class ComponentApplication;
 
     public:
 
@@ -333,6 +335,7 @@ namespace AZ
         //! among components. If all dependencies are met, the required services can be
         //! activated before the components that depend on them. An entity will not be
         //! activated unless the sort succeeds.
+        //! If a ComponentDependencySortCache is registered, the sort is looked up in the cache first.
         //! @return A successful outcome is returned if the entity can
         //! determine an order in which to activate its components.
         //! Otherwise the failed outcome contains details on why the sort failed.
@@ -395,8 +398,22 @@ namespace AZ
         //! @return True if the entity is in a state in which that components can be added or removed, otherwise false.
         bool CanAddRemoveComponents() const;
 
+        //! Evaluates the dependencies and moves the entity to the State::Activating state.
+        //! @return False if the components can't be sorted, in which case the entity stays in the State::Init state.
+        bool BeginActivation();
+
+        //! Moves the entity to the State::Active state and signals that it's activated.
+        void EndActivation();
+
         // Helpers for child classes
         static void ActivateComponent(Component& component) { component.Activate(); }
+
+        //! Returns the registered ComponentActivationProfilerInterface if it is capturing, nullptr otherwise.
+        //! Query this once per batch of activations rather than per component.
+        static ComponentActivationProfilerInterface* GetCapturingActivationProfiler();
+
+        //! Activates the component and records how long that took when an activation profiler is provided.
+        static void ActivateComponent(Component& component, ComponentActivationProfilerInterface* activationProfiler);
         static void DeactivateComponent(Component& component) { component.Deactivate(); }
 
         //! The ID that the system uses to identify and address the entity.
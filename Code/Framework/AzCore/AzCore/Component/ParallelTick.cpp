@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ParallelTick.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace
+    {
+        bool ContainsAny(const AZStd::vector<Crc32>& lhs, const AZStd::vector<Crc32>& rhs)
+        {
+            for (const Crc32 resource : lhs)
+            {
+                if (AZStd::find(rhs.begin(), rhs.end(), resource) != rhs.end())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    void ParallelTickAccess::Read(Crc32 resource)
+    {
+        if (AZStd::find(m_reads.begin(), m_reads.end(), resource) == m_reads.end())
+        {
+            m_reads.push_back(resource);
+        }
+    }
+
+    void ParallelTickAccess::Write(Crc32 resource)
+    {
+        if (AZStd::find(m_writes.begin(), m_writes.end(), resource) == m_writes.end())
+        {
+            m_writes.push_back(resource);
+        }
+    }
+
+    void ParallelTickAccess::SetExclusive()
+    {
+        m_exclusive = true;
+    }
+
+    bool ParallelTickAccess::IsExclusive() const
+    {
+        return m_exclusive;
+    }
+
+    const AZStd::vector<Crc32>& ParallelTickAccess::GetReads() const
+    {
+        return m_reads;
+    }
+
+    const AZStd::vector<Crc32>& ParallelTickAccess::GetWrites() const
+    {
+        return m_writes;
+    }
+
+    bool ParallelTickAccess::ConflictsWith(const ParallelTickAccess& other) const
+    {
+        return m_exclusive || other.m_exclusive
+            || ContainsAny(m_writes, other.m_writes)
+            || ContainsAny(m_writes, other.m_reads)
+            || ContainsAny(m_reads, other.m_writes);
+    }
+
+    ParallelTickHandler::~ParallelTickHandler()
+    {
+        Disconnect();
+    }
+
+    void ParallelTickHandler::Connect()
+    {
+        if (!IsConnected())
+        {
+            IParallelTickScheduler* scheduler = Interface<IParallelTickScheduler>::Get();
+            AZ_Error("ParallelTick", scheduler != nullptr, "Failed to connect %s, there is no parallel tick scheduler", GetParallelTickName());
+            if (scheduler != nullptr)
+            {
+                scheduler->ConnectHandler(this);
+            }
+        }
+    }
+
+    void ParallelTickHandler::Disconnect()
+    {
+        if (IsConnected())
+        {
+            if (IParallelTickScheduler* scheduler = Interface<IParallelTickScheduler>::Get())
+            {
+                scheduler->DisconnectHandler(this);
+            }
+            m_connectedIndex = InvalidIndex;
+        }
+    }
+
+    bool ParallelTickHandler::IsConnected() const
+    {
+        return m_connectedIndex != InvalidIndex;
+    }
+
+    int ParallelTickHandler::GetParallelTickOrder() const
+    {
+        return TICK_DEFAULT;
+    }
+
+    const char* ParallelTickHandler::GetParallelTickName() const
+    {
+        return "ParallelTickHandler";
+    }
+}
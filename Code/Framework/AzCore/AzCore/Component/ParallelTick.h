@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+
+namespace AZ
+{
+    //! @class ParallelTickAccess
+    //! @brief Declares the data a ParallelTickHandler reads and writes during OnParallelTick.
+    //! Resources are arbitrary ids agreed on by the handlers that share the data, for instance AZ_CRC_CE("TransformData").
+    //! Two handlers conflict when one of them writes a resource the other one reads or writes, conflicting handlers of
+    //! the same tick order run one after another in the order they connected, all other handlers may run concurrently.
+    class ParallelTickAccess
+    {
+    public:
+        //! Declares that the handler reads the resource.
+        void Read(Crc32 resource);
+
+        //! Declares that the handler reads and writes the resource.
+        void Write(Crc32 resource);
+
+        //! Declares that the handler conflicts with every other handler of its tick order, for handlers that touch
+        //! shared state that can't be described with resources.
+        void SetExclusive();
+
+        bool IsExclusive() const;
+        const AZStd::vector<Crc32>& GetReads() const;
+        const AZStd::vector<Crc32>& GetWrites() const;
+
+        //! Returns true if the handlers with these accesses can't run concurrently.
+        bool ConflictsWith(const ParallelTickAccess& other) const;
+
+    private:
+        AZStd::vector<Crc32> m_reads;
+        AZStd::vector<Crc32> m_writes;
+        bool m_exclusive = false;
+    };
+
+    //! @class ParallelTickHandler
+    //! @brief Opt-in alternative to TickBus::Handler for ticking work that may run concurrently with other handlers.
+    //! Handlers of a tick order run on the task graph at the position of that tick order in the TickBus, after the
+    //! TickBus handlers of a lower tick order and before the ones of a higher tick order. OnParallelTick is called from
+    //! task worker threads, so it must only touch the data declared through GetParallelTickAccess.
+    //! Connect and Disconnect must be called from the main thread, and never from within OnParallelTick.
+    class ParallelTickHandler
+    {
+    public:
+        ParallelTickHandler() = default;
+        virtual ~ParallelTickHandler();
+
+        //! Connects the handler, the tick order and access of the handler are queried once when it connects.
+        void Connect();
+
+        //! Disconnects the handler.
+        void Disconnect();
+
+        bool IsConnected() const;
+
+        //! Signals that the application has issued a tick.
+        //! @param deltaTime The delta (in seconds) from the previous tick and the current time.
+        //! @param time The current time.
+        virtual void OnParallelTick(float deltaTime, ScriptTimePoint time) = 0;
+
+        //! Specifies the order in which a handler receives tick events relative to other handlers, see ComponentTickBus.
+        virtual int GetParallelTickOrder() const;
+
+        //! Declares the data the handler reads and writes during OnParallelTick.
+        virtual void GetParallelTickAccess(ParallelTickAccess& access) const = 0;
+
+        //! Name of the handler in the schedule shown by the tooling.
+        virtual const char* GetParallelTickName() const;
+
+    private:
+        friend class ParallelTickSystemComponent;
+
+        static constexpr uint32_t InvalidIndex = ~0u;
+
+        int m_connectedTickOrder = TICK_DEFAULT;
+        uint32_t m_connectedIndex = InvalidIndex;
+    };
+
+    //! @class IParallelTickScheduler
+    //! @brief This is an AZ::Interface<> for scheduling ParallelTickHandlers.
+    //! Users should not require any direct interaction with this interface besides tooling, ParallelTickHandler is a
+    //! self contained abstraction.
+    class IParallelTickScheduler
+    {
+    public:
+        AZ_RTTI(IParallelTickScheduler, "{6A3D1D9B-5E0C-4C8C-9B5E-2B7E43D1C8A4}");
+
+        //! Called for every stage of the schedule, handlers of a stage run concurrently after the stages before them.
+        //! @param tickOrder the tick order of the stage
+        //! @param stageIndex the index of the stage within its tick order
+        //! @param taskCount the number of tasks the handlers of the stage are split into
+        //! @param handlers the handlers of the stage in the order they're run within their tasks
+        using ScheduleVisitor = AZStd::function<void(int tickOrder, uint32_t stageIndex, uint32_t taskCount, const AZStd::vector<ParallelTickHandler*>& handlers)>;
+
+        IParallelTickScheduler() = default;
+        virtual ~IParallelTickScheduler() = default;
+
+        virtual void ConnectHandler(ParallelTickHandler* handler) = 0;
+        virtual void DisconnectHandler(ParallelTickHandler* handler) = 0;
+
+        //! Visits the current schedule in execution order.
+        virtual void VisitSchedule(const ScheduleVisitor& visitor) = 0;
+
+        AZ_DISABLE_COPY_MOVE(IParallelTickScheduler);
+    };
+}
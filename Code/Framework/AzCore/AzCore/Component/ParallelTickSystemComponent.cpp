@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ParallelTickSystemComponent.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    AZ_CVAR(bool, bg_parallelTickEnabled, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Runs parallel tick handlers on the task graph, when disabled they run on the main thread in schedule order");
+    AZ_CVAR(uint32_t, bg_parallelTickHandlersPerTask, 16, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum number of parallel tick handlers batched into a single task");
+
+    namespace
+    {
+        constexpr uint32_t NoStage = ~0u;
+
+        size_t HashAccess(const ParallelTickAccess& access)
+        {
+            AZStd::vector<Crc32> reads = access.GetReads();
+            AZStd::vector<Crc32> writes = access.GetWrites();
+            AZStd::sort(reads.begin(), reads.end());
+            AZStd::sort(writes.begin(), writes.end());
+
+            size_t hash = access.IsExclusive() ? 1 : 0;
+            for (const Crc32 resource : reads)
+            {
+                AZStd::hash_combine(hash, static_cast<uint32_t>(resource));
+            }
+            AZStd::hash_combine(hash, reads.size());
+            for (const Crc32 resource : writes)
+            {
+                AZStd::hash_combine(hash, static_cast<uint32_t>(resource));
+            }
+            return hash;
+        }
+    }
+
+    void ParallelTickSystemComponent::Reflect(ReflectContext* context)
+    {
+        if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
+        {
+            serializeContext->Class<ParallelTickSystemComponent, Component>()
+                ->Version(1);
+        }
+    }
+
+    void ParallelTickSystemComponent::GetProvidedServices(ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("ParallelTickService"));
+    }
+
+    void ParallelTickSystemComponent::GetIncompatibleServices(ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("ParallelTickService"));
+    }
+
+    void ParallelTickSystemComponent::GetDependentServices(ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        dependent.push_back(AZ_CRC_CE("TaskExecutorService"));
+    }
+
+    ParallelTickSystemComponent::ParallelTickSystemComponent() = default;
+
+    ParallelTickSystemComponent::~ParallelTickSystemComponent() = default;
+
+    void ParallelTickSystemComponent::Activate()
+    {
+        Interface<IParallelTickScheduler>::Register(this);
+    }
+
+    void ParallelTickSystemComponent::Deactivate()
+    {
+        // Handlers that are still connected are dropped, they can connect again once a scheduler is active
+        for (auto& [tickOrder, bucket] : m_buckets)
+        {
+            for (ParallelTickHandler* handler : bucket->m_handlers)
+            {
+                if (handler != nullptr)
+                {
+                    handler->m_connectedIndex = ParallelTickHandler::InvalidIndex;
+                }
+            }
+        }
+        m_buckets.clear();
+        Interface<IParallelTickScheduler>::Unregister(this);
+    }
+
+    void ParallelTickSystemComponent::ConnectHandler(ParallelTickHandler* handler)
+    {
+        const int tickOrder = handler->GetParallelTickOrder();
+        AZStd::unique_ptr<Bucket>& bucket = m_buckets[tickOrder];
+        if (bucket == nullptr)
+        {
+            bucket = AZStd::make_unique<Bucket>(tickOrder);
+        }
+        AZ_Assert(!bucket->m_running, "Parallel tick handlers can't connect from within OnParallelTick");
+
+        ParallelTickAccess access;
+        handler->GetParallelTickAccess(access);
+        bucket->m_accessHashes.push_back(HashAccess(access));
+        bucket->m_accesses.push_back(AZStd::move(access));
+        handler->m_connectedTickOrder = tickOrder;
+        handler->m_connectedIndex = aznumeric_cast<uint32_t>(bucket->m_handlers.size());
+        bucket->m_handlers.push_back(handler);
+        ++bucket->m_connectedCount;
+        bucket->m_dirty = true;
+
+        if (!bucket->BusIsConnected())
+        {
+            bucket->BusConnect();
+        }
+    }
+
+    void ParallelTickSystemComponent::DisconnectHandler(ParallelTickHandler* handler)
+    {
+        auto bucketIter = m_buckets.find(handler->m_connectedTickOrder);
+        if (bucketIter == m_buckets.end())
+        {
+            return;
+        }
+
+        Bucket& bucket = *bucketIter->second;
+        AZ_Assert(!bucket.m_running, "Parallel tick handlers can't disconnect from within OnParallelTick");
+        AZ_Assert(bucket.m_handlers[handler->m_connectedIndex] == handler, "Parallel tick handler index is out of sync");
+        bucket.m_handlers[handler->m_connectedIndex] = nullptr;
+        --bucket.m_connectedCount;
+        bucket.m_dirty = true;
+
+        if (bucket.m_connectedCount == 0)
+        {
+            bucket.BusDisconnect();
+        }
+    }
+
+    void ParallelTickSystemComponent::VisitSchedule(const ScheduleVisitor& visitor)
+    {
+        for (auto& [tickOrder, bucket] : m_buckets)
+        {
+            if (bucket->m_dirty || bucket->m_builtHandlersPerTask != bg_parallelTickHandlersPerTask)
+            {
+                bucket->Rebuild();
+            }
+            for (uint32_t stageIndex = 0; stageIndex < bucket->m_stages.size(); ++stageIndex)
+            {
+                const Stage& stage = bucket->m_stages[stageIndex];
+                visitor(tickOrder, stageIndex, stage.m_taskCount, stage.m_handlers);
+            }
+        }
+    }
+
+    AZStd::vector<uint32_t> ParallelTickSystemComponent::AssignStages(const AZStd::vector<ParallelTickAccess>& accesses)
+    {
+        // Tracks the last stage that read and that wrote each resource, so a handler only has to look at its own
+        // resources rather than at every handler before it
+        struct ResourceStages
+        {
+            uint32_t m_lastRead = NoStage;
+            uint32_t m_lastWrite = NoStage;
+        };
+        AZStd::unordered_map<Crc32, ResourceStages> resourceStages;
+
+        AZStd::vector<uint32_t> stages;
+        stages.reserve(accesses.size());
+        uint32_t firstAvailableStage = 0;
+        uint32_t lastStage = NoStage;
+        for (const ParallelTickAccess& access : accesses)
+        {
+            uint32_t stage = firstAvailableStage;
+            if (access.IsExclusive())
+            {
+                stage = (lastStage == NoStage) ? firstAvailableStage : lastStage + 1;
+            }
+            else
+            {
+                for (const Crc32 resource : access.GetReads())
+                {
+                    const ResourceStages& resourceStage = resourceStages[resource];
+                    if (resourceStage.m_lastWrite != NoStage)
+                    {
+                        stage = AZStd::max(stage, resourceStage.m_lastWrite + 1);
+                    }
+                }
+                for (const Crc32 resource : access.GetWrites())
+                {
+                    const ResourceStages& resourceStage = resourceStages[resource];
+                    if (resourceStage.m_lastWrite != NoStage)
+                    {
+                        stage = AZStd::max(stage, resourceStage.m_lastWrite + 1);
+                    }
+                    if (resourceStage.m_lastRead != NoStage)
+                    {
+                        stage = AZStd::max(stage, resourceStage.m_lastRead + 1);
+                    }
+                }
+            }
+
+            for (const Crc32 resource : access.GetReads())
+            {
+                ResourceStages& resourceStage = resourceStages[resource];
+                resourceStage.m_lastRead = (resourceStage.m_lastRead == NoStage) ? stage : AZStd::max(resourceStage.m_lastRead, stage);
+            }
+            for (const Crc32 resource : access.GetWrites())
+            {
+                resourceStages[resource].m_lastWrite = stage;
+            }
+
+            if (access.IsExclusive())
+            {
+                // Nothing after an exclusive handler may share or precede its stage
+                firstAvailableStage = stage + 1;
+            }
+            lastStage = (lastStage == NoStage) ? stage : AZStd::max(lastStage, stage);
+            stages.push_back(stage);
+        }
+        return stages;
+    }
+
+    ParallelTickSystemComponent::Bucket::Bucket(int tickOrder)
+        : m_tickOrder(tickOrder)
+    {
+        ;
+    }
+
+    ParallelTickSystemComponent::Bucket::~Bucket()
+    {
+        BusDisconnect();
+    }
+
+    void ParallelTickSystemComponent::Bucket::OnTick(float deltaTime, ScriptTimePoint time)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "ParallelTick: %d", m_tickOrder);
+
+        if (m_dirty || m_builtHandlersPerTask != bg_parallelTickHandlersPerTask)
+        {
+            Rebuild();
+        }
+
+        m_deltaTime = deltaTime;
+        m_time = time;
+        m_running = true;
+
+        // Without an active task graph, for instance in tools and tests, the handlers run in schedule order
+        TaskGraphActiveInterface* taskGraphActive = Interface<TaskGraphActiveInterface>::Get();
+        if (bg_parallelTickEnabled && m_taskCount > 1 && taskGraphActive != nullptr && taskGraphActive->IsTaskGraphActive())
+        {
+            TaskGraphEvent finishedEvent{ "ParallelTick Wait" };
+            m_taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else
+        {
+            RunSerial();
+        }
+
+        m_running = false;
+    }
+
+    int ParallelTickSystemComponent::Bucket::GetTickOrder()
+    {
+        return m_tickOrder;
+    }
+
+    void ParallelTickSystemComponent::Bucket::Rebuild()
+    {
+        // Remove the handlers that disconnected since the last rebuild, keeping the connection order
+        uint32_t connectedIndex = 0;
+        for (uint32_t index = 0; index < m_handlers.size(); ++index)
+        {
+            if (m_handlers[index] != nullptr)
+            {
+                if (connectedIndex != index)
+                {
+                    m_handlers[connectedIndex] = m_handlers[index];
+                    m_accesses[connectedIndex] = AZStd::move(m_accesses[index]);
+                    m_accessHashes[connectedIndex] = m_accessHashes[index];
+                }
+                m_handlers[connectedIndex]->m_connectedIndex = connectedIndex;
+                ++connectedIndex;
+            }
+        }
+        m_handlers.resize(connectedIndex);
+        m_accesses.resize(connectedIndex);
+        m_accessHashes.resize(connectedIndex);
+
+        // Within a stage handlers with the same access are placed next to each other so they share tasks
+        const AZStd::vector<uint32_t> handlerStages = AssignStages(m_accesses);
+        AZStd::vector<uint32_t> order(m_handlers.size());
+        for (uint32_t index = 0; index < order.size(); ++index)
+        {
+            order[index] = index;
+        }
+        AZStd::stable_sort(order.begin(), order.end(), [this, &handlerStages](uint32_t lhs, uint32_t rhs)
+        {
+            if (handlerStages[lhs] != handlerStages[rhs])
+            {
+                return handlerStages[lhs] < handlerStages[rhs];
+            }
+            return m_accessHashes[lhs] < m_accessHashes[rhs];
+        });
+
+        m_stages.clear();
+        for (const uint32_t index : order)
+        {
+            if (m_stages.size() <= handlerStages[index])
+            {
+                m_stages.resize(handlerStages[index] + 1);
+            }
+            m_stages[handlerStages[index]].m_handlers.push_back(m_handlers[index]);
+        }
+
+        m_builtHandlersPerTask = AZStd::max<uint32_t>(bg_parallelTickHandlersPerTask, 1);
+        m_taskCount = 0;
+        for (Stage& stage : m_stages)
+        {
+            const uint32_t handlerCount = aznumeric_cast<uint32_t>(stage.m_handlers.size());
+            stage.m_taskCount = (handlerCount + m_builtHandlersPerTask - 1) / m_builtHandlersPerTask;
+            m_taskCount += stage.m_taskCount;
+        }
+
+        // The graph is retained and resubmitted every tick until the handlers change
+        m_taskGraph.Reset();
+        static const TaskDescriptor descriptor{ "AZ::ParallelTick", "Tick" };
+        AZStd::vector<TaskToken> stageTokens;
+        stageTokens.reserve(m_stages.size());
+        for (uint32_t stageIndex = 0; stageIndex < m_stages.size(); ++stageIndex)
+        {
+            stageTokens.push_back(m_taskGraph.AddTaskGroup(descriptor, m_stages[stageIndex].m_taskCount, [this, stageIndex](uint32_t taskIndex)
+            {
+                RunTask(stageIndex, taskIndex);
+            }));
+            if (stageIndex > 0)
+            {
+                stageTokens[stageIndex - 1].Precedes(stageTokens[stageIndex]);
+            }
+        }
+
+        m_dirty = false;
+    }
+
+    void ParallelTickSystemComponent::Bucket::RunTask(uint32_t stageIndex, uint32_t taskIndex)
+    {
+        const AZStd::vector<ParallelTickHandler*>& handlers = m_stages[stageIndex].m_handlers;
+        const size_t first = static_cast<size_t>(taskIndex) * m_builtHandlersPerTask;
+        const size_t last = AZStd::min(first + m_builtHandlersPerTask, handlers.size());
+        for (size_t index = first; index < last; ++index)
+        {
+            handlers[index]->OnParallelTick(m_deltaTime, m_time);
+        }
+    }
+
+    void ParallelTickSystemComponent::Bucket::RunSerial()
+    {
+        for (const Stage& stage : m_stages)
+        {
+            for (ParallelTickHandler* handler : stage.m_handlers)
+            {
+                handler->OnParallelTick(m_deltaTime, m_time);
+            }
+        }
+    }
+}
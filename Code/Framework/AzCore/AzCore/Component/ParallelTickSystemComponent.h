@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/ParallelTick.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    //! @class ParallelTickSystemComponent
+    //! @brief Schedules ParallelTickHandlers on the task graph.
+    //! Handlers are bucketed by tick order, each bucket connects to the TickBus at its tick order. Within a bucket the
+    //! handlers are assigned to stages so that no two handlers of a stage conflict, the stages run one after another and
+    //! the handlers of a stage are batched into tasks that run concurrently. Handlers with the same access are batched
+    //! together, as they're usually the same kind of component working on the same kind of data.
+    //! The schedule is only rebuilt when handlers connect or disconnect.
+    class ParallelTickSystemComponent
+        : public Component
+        , public IParallelTickScheduler
+    {
+    public:
+        AZ_COMPONENT(ParallelTickSystemComponent, "{B4A9E2F1-3D6C-4F7A-8E1B-9C5D2A7F0E43}");
+
+        static void Reflect(ReflectContext* context);
+        static void GetProvidedServices(ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(ComponentDescriptor::DependencyArrayType& incompatible);
+        static void GetDependentServices(ComponentDescriptor::DependencyArrayType& dependent);
+
+        ParallelTickSystemComponent();
+        ~ParallelTickSystemComponent() override;
+
+        //! AZ::Component overrides.
+        //! @{
+        void Activate() override;
+        void Deactivate() override;
+        //! @}
+
+        //! IParallelTickScheduler interface
+        //! @{
+        void ConnectHandler(ParallelTickHandler* handler) override;
+        void DisconnectHandler(ParallelTickHandler* handler) override;
+        void VisitSchedule(const ScheduleVisitor& visitor) override;
+        //! @}
+
+        //! Assigns each access to a stage, so that accesses that conflict with an earlier access are in a later stage.
+        //! @param accesses the accesses in connection order
+        //! @return the stage of each access
+        static AZStd::vector<uint32_t> AssignStages(const AZStd::vector<ParallelTickAccess>& accesses);
+
+    private:
+        struct Stage
+        {
+            AZStd::vector<ParallelTickHandler*> m_handlers;
+            uint32_t m_taskCount = 0;
+        };
+
+        //! The handlers of a single tick order.
+        class Bucket
+            : public TickBus::Handler
+        {
+        public:
+            AZ_RTTI(ParallelTickSystemComponent::Bucket, "{0F6E3A5C-7B2D-4E91-A8C4-D35B1E9F6720}", TickEvents);
+
+            explicit Bucket(int tickOrder);
+            ~Bucket() override;
+
+            //! AZ::TickBus::Handler overrides.
+            //! @{
+            void OnTick(float deltaTime, ScriptTimePoint time) override;
+            int GetTickOrder() override;
+            //! @}
+
+            void Rebuild();
+            void RunTask(uint32_t stageIndex, uint32_t taskIndex);
+            void RunSerial();
+
+            int m_tickOrder = TICK_DEFAULT;
+
+            // Indexed by ParallelTickHandler::m_connectedIndex, disconnected handlers are removed on the next rebuild
+            AZStd::vector<ParallelTickHandler*> m_handlers;
+            AZStd::vector<ParallelTickAccess> m_accesses;
+            AZStd::vector<size_t> m_accessHashes;
+            uint32_t m_connectedCount = 0;
+
+            AZStd::vector<Stage> m_stages;
+            uint32_t m_taskCount = 0;
+            uint32_t m_builtHandlersPerTask = 0;
+            bool m_dirty = true;
+            bool m_running = false;
+            TaskGraph m_taskGraph{ "ParallelTick" };
+
+            float m_deltaTime = 0.0f;
+            ScriptTimePoint m_time;
+        };
+
+        AZStd::map<int, AZStd::unique_ptr<Bucket>> m_buckets;
+    };
+}
@@ -10,21 +10,150 @@
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Casting/lossy_cast.h>
-#include <limits>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 
 #include <AzCore/Compression/zstd_compression.h>
 
 using namespace AZ;
 
-ZStd::ZStd(IAllocator* workMemAllocator)
+ZStdContextPool::~ZStdContextPool()
+{
+    for (ZSTD_CCtx* context : m_compressionContexts)
+    {
+        ZSTD_freeCCtx(context);
+    }
+    for (ZSTD_DCtx* context : m_decompressionContexts)
+    {
+        ZSTD_freeDCtx(context);
+    }
+}
+
+ZStdContextPool& ZStdContextPool::GetGlobal()
+{
+    static ZStdContextPool s_pool;
+    return s_pool;
+}
+
+ZSTD_CCtx* ZStdContextPool::AcquireCompressionContext()
+{
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        if (!m_compressionContexts.empty())
+        {
+            ZSTD_CCtx* context = m_compressionContexts.back();
+            m_compressionContexts.pop_back();
+            return context;
+        }
+    }
+    return ZSTD_createCCtx();
+}
+
+void ZStdContextPool::ReleaseCompressionContext(ZSTD_CCtx* context)
+{
+    if (!context)
+    {
+        return;
+    }
+
+    ZSTD_CCtx_reset(context);
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        if (m_compressionContexts.size() < MaxPooledContexts)
+        {
+            m_compressionContexts.push_back(context);
+            return;
+        }
+    }
+    ZSTD_freeCCtx(context);
+}
+
+ZSTD_DCtx* ZStdContextPool::AcquireDecompressionContext()
+{
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        if (!m_decompressionContexts.empty())
+        {
+            ZSTD_DCtx* context = m_decompressionContexts.back();
+            m_decompressionContexts.pop_back();
+            return context;
+        }
+    }
+    return ZSTD_createDCtx();
+}
+
+void ZStdContextPool::ReleaseDecompressionContext(ZSTD_DCtx* context)
+{
+    if (!context)
+    {
+        return;
+    }
+
+    ZSTD_DCtx_reset(context);
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        if (m_decompressionContexts.size() < MaxPooledContexts)
+        {
+            m_decompressionContexts.push_back(context);
+            return;
+        }
+    }
+    ZSTD_freeDCtx(context);
+}
+
+size_t ZStdContextPool::Compress(const void* data, size_t dataSize, void* compressedData, size_t compressedDataSize, int compressionLevel)
+{
+    ZSTD_CCtx* context = AcquireCompressionContext();
+    if (!context)
+    {
+        return 0;
+    }
+
+    // The simple API ignores the streaming parameters a previous user may have left on the context.
+    size_t result = ZSTD_compressCCtx(context, compressedData, compressedDataSize, data, dataSize, compressionLevel);
+    ReleaseCompressionContext(context);
+    if (ZSTD_isError(result))
+    {
+        AZ_Error("ZStd", false, "ZStandard compression error: %s", ZSTD_getErrorName(result));
+        return 0;
+    }
+    return result;
+}
+
+size_t ZStdContextPool::Decompress(const void* compressedData, size_t compressedDataSize, void* data, size_t dataSize)
+{
+    ZSTD_DCtx* context = AcquireDecompressionContext();
+    if (!context)
+    {
+        return 0;
+    }
+
+    size_t result = ZSTD_decompressDCtx(context, data, dataSize, compressedData, compressedDataSize);
+    ReleaseDecompressionContext(context);
+    if (ZSTD_isError(result))
+    {
+        AZ_Error("ZStd", false, "ZStandard decompression error: %s", ZSTD_getErrorName(result));
+        return 0;
+    }
+    return result;
+}
+
+size_t ZStdContextPool::GetMaxCompressedSize(size_t dataSize)
+{
+    return ZSTD_compressBound(dataSize);
+}
+
+ZStd::ZStd(IAllocator* workMemAllocator, ZStdContextPool* contextPool)
 {
     m_workMemoryAllocator = workMemAllocator;
     if (!m_workMemoryAllocator)
     {
         m_workMemoryAllocator = &AllocatorInstance<SystemAllocator>::Get();
     }
+    m_contextPool = contextPool;
     m_streamCompression = nullptr;
     m_streamDecompression = nullptr;
+    m_pendingFlushSize = 0;
 }
 
 ZStd::~ZStd()
@@ -51,43 +180,114 @@ void ZStd::FreeMem(void* userData, void* address)
     allocator->DeAllocate(address);
 }
 
-void ZStd::StartCompressor(unsigned int compressionLevel)
+void ZStd::StartCompressor(unsigned int compressionLevel, const CompressionParameters& parameters)
 {
     AZ_Assert(!m_streamCompression, "Compressor already started!");
-    ZSTD_customMem customAlloc;
-    customAlloc.customAlloc = reinterpret_cast<ZSTD_allocFunction>(&AllocateMem);
-    customAlloc.customFree = &FreeMem;
-    customAlloc.opaque = nullptr;
+    if (m_contextPool)
+    {
+        m_streamCompression = m_contextPool->AcquireCompressionContext();
+    }
+    else
+    {
+        ZSTD_customMem customAlloc;
+        customAlloc.customAlloc = reinterpret_cast<ZSTD_allocFunction>(&AllocateMem);
+        customAlloc.customFree = &FreeMem;
+        customAlloc.opaque = m_workMemoryAllocator;
+        m_streamCompression = ZSTD_createCStream_advanced(customAlloc);
+    }
+    AZ_Assert(m_streamCompression, "ZStandard internal error - failed to create compression stream\n");
+    m_pendingFlushSize = 0;
+
+    // All parameters are set every time, pooled contexts keep the ones of their previous user.
+    size_t result = ZSTD_CCtx_setParameter(m_streamCompression, ZSTD_p_compressionLevel, compressionLevel);
+    AZ_Assert(!ZSTD_isError(result), "ZStandard internal error: %s", ZSTD_getErrorName(result));
+
+    result = ZSTD_CCtx_setParameter(m_streamCompression, ZSTD_p_nbWorkers, parameters.m_numWorkers);
+    if (ZSTD_isError(result))
+    {
+        AZ_Warning("ZStd", false, "Can't compress with %u workers (%s), compressing on the calling thread.",
+            parameters.m_numWorkers, ZSTD_getErrorName(result));
+        ZSTD_CCtx_setParameter(m_streamCompression, ZSTD_p_nbWorkers, 0);
+    }
 
-    AZ_UNUSED(compressionLevel);
-    m_streamCompression = (ZSTD_createCStream_advanced(customAlloc));
-    AZ_Assert( m_streamCompression , "ZStandard internal error - failed to create compression stream\n");
+    result = ZSTD_CCtx_setParameter(m_streamCompression, ZSTD_p_enableLongDistanceMatching, parameters.m_longDistanceMatching ? 1 : 0);
+    AZ_Assert(!ZSTD_isError(result), "ZStandard internal error: %s", ZSTD_getErrorName(result));
+
+    unsigned int windowLog = parameters.m_windowLog;
+    if (windowLog == 0 && parameters.m_longDistanceMatching)
+    {
+        windowLog = MaxWindowLog;
+    }
+    else if (windowLog != 0)
+    {
+        windowLog = AZStd::clamp<unsigned int>(windowLog, ZSTD_WINDOWLOG_MIN, MaxWindowLog);
+    }
+    result = ZSTD_CCtx_setParameter(m_streamCompression, ZSTD_p_windowLog, windowLog);
+    AZ_Assert(!ZSTD_isError(result), "ZStandard internal error: %s", ZSTD_getErrorName(result));
+    AZ_UNUSED(result);
 }
 
 void ZStd::StopCompressor()
 {
     AZ_Assert(m_streamCompression, "Compressor not started!");
-    ZSTD_endStream(m_streamCompression, nullptr);
-    FreeMem(m_workMemoryAllocator, m_streamCompression);
+    if (m_contextPool)
+    {
+        m_contextPool->ReleaseCompressionContext(m_streamCompression);
+    }
+    else
+    {
+        size_t result = ZSTD_freeCStream(m_streamCompression);
+        AZ_UNUSED(result);
+        AZ_Assert(!ZSTD_isError(result), "ZStandard internal error: %s", ZSTD_getErrorName(result));
+    }
     m_streamCompression = nullptr;
+    m_pendingFlushSize = 0;
 }
 
 void ZStd::ResetCompressor()
 {
     AZ_Assert(m_streamCompression, "Compressor not started!");
-    size_t r = ZSTD_resetCStream(m_streamCompression,0);
-    AZ_UNUSED(r);
-    AZ_Assert(!ZSTD_isError(r), "Can't reset compressor");
+    // Drops the frame in progress and keeps the parameters.
+    ZSTD_CCtx_reset(m_streamCompression);
+    m_pendingFlushSize = 0;
 }
 
 unsigned int ZStd::Compress(const void* data, unsigned int& dataSize, void* compressedData, unsigned int compressedDataSize, FlushType flushType)
 {
-    AZ_UNUSED(data);
-    AZ_UNUSED(dataSize);
-    AZ_UNUSED(compressedData);
-    AZ_UNUSED(compressedDataSize);
-    AZ_UNUSED(flushType);
-    return 0;
+    AZ_Assert(m_streamCompression, "Compressor not started!");
+    ZSTD_inBuffer inBuffer = { data, dataSize, 0 };
+    ZSTD_outBuffer outBuffer = { compressedData, compressedDataSize, 0 };
+
+    ZSTD_EndDirective endOp;
+    switch (flushType)
+    {
+    case FT_NO_FLUSH:
+        endOp = ZSTD_e_continue;
+        break;
+    case FT_FINISH:
+        endOp = ZSTD_e_end;
+        break;
+    default:
+        endOp = ZSTD_e_flush;
+    }
+
+    size_t result = ZSTD_compress_generic(m_streamCompression, &outBuffer, &inBuffer, endOp);
+    if (ZSTD_isError(result))
+    {
+        AZ_Assert(false, "ZStandard compression error: %s", ZSTD_getErrorName(result));
+        m_pendingFlushSize = 0;
+        return 0;
+    }
+
+    // For flushes the result is the amount of data still waiting to be written out.
+    m_pendingFlushSize = endOp == ZSTD_e_continue ? 0 : result;
+    dataSize -= azlossy_cast<unsigned int>(inBuffer.pos);
+    return azlossy_cast<unsigned int>(outBuffer.pos);
+}
+
+bool ZStd::IsFlushPending() const
+{
+    return m_pendingFlushSize != 0;
 }
 
 unsigned int ZStd::GetMinCompressedBufferSize(unsigned int sourceDataSize)
@@ -98,71 +298,70 @@ unsigned int ZStd::GetMinCompressedBufferSize(unsigned int sourceDataSize)
 void ZStd::StartDecompressor()
 {
     AZ_Assert(!m_streamDecompression, "Decompressor already started!");
-    ZSTD_customMem customAlloc;
-    customAlloc.customAlloc = reinterpret_cast<ZSTD_allocFunction>(&ZStd::AllocateMem);
-    customAlloc.customFree = &ZStd::FreeMem;
-    customAlloc.opaque = m_workMemoryAllocator;
-
-    m_streamDecompression = ZSTD_createDStream_advanced(customAlloc);
-    m_nextBlockSize = ZSTD_initDStream(m_streamDecompression);
-    AZ_Assert(!ZSTD_isError(m_nextBlockSize), "ZStandard internal error: %s", ZSTD_getErrorName(m_nextBlockSize));
+    if (m_contextPool)
+    {
+        m_streamDecompression = m_contextPool->AcquireDecompressionContext();
+    }
+    else
+    {
+        ZSTD_customMem customAlloc;
+        customAlloc.customAlloc = reinterpret_cast<ZSTD_allocFunction>(&ZStd::AllocateMem);
+        customAlloc.customFree = &ZStd::FreeMem;
+        customAlloc.opaque = m_workMemoryAllocator;
+        m_streamDecompression = ZSTD_createDStream_advanced(customAlloc);
+    }
+    AZ_Assert(m_streamDecompression, "ZStandard internal error - failed to create decompression stream\n");
 
-    //pointers will be set later....
-    m_inBuffer.pos = 0;
-    m_inBuffer.size = 0;
-    m_outBuffer.size = 0;
-    m_outBuffer.pos = 0;
-    m_compressedBufferIndex = 0;
+    size_t result = ZSTD_initDStream(m_streamDecompression);
+    AZ_UNUSED(result);
+    AZ_Assert(!ZSTD_isError(result), "ZStandard internal error: %s", ZSTD_getErrorName(result));
 }
 
 void ZStd::StopDecompressor()
 {
     AZ_Assert(m_streamDecompression, "Decompressor not started!");
-    size_t result = ZSTD_freeDStream(m_streamDecompression);
-    AZ_Verify(!ZSTD_isError(result), "ZStandard internal error: %s", ZSTD_getErrorName(result));
+    if (m_contextPool)
+    {
+        m_contextPool->ReleaseDecompressionContext(m_streamDecompression);
+    }
+    else
+    {
+        size_t result = ZSTD_freeDStream(m_streamDecompression);
+        AZ_Verify(!ZSTD_isError(result), "ZStandard internal error: %s", ZSTD_getErrorName(result));
+    }
     m_streamDecompression = nullptr;
 }
 
 void ZStd::ResetDecompressor(Header* header)
 {
     AZ_UNUSED(header);
+    AZ_Assert(m_streamDecompression, "Decompressor not started!");
+    size_t result = ZSTD_resetDStream(m_streamDecompression);
+    AZ_UNUSED(result);
+    AZ_Assert(!ZSTD_isError(result), "ZStandard internal error: %s", ZSTD_getErrorName(result));
 }
 
-void ZStd::SetupDecompressHeader(Header header)
-{
-    AZ_UNUSED(header);
-}
-
-unsigned int ZStd::Decompress(const void* compressedData, unsigned int compressedDataSize, void* outputData, unsigned int outputDataSize, size_t* sizeOfNextBlock)
+unsigned int ZStd::Decompress(const void* compressedData, unsigned int compressedDataSize, void* outputData, unsigned int& outputDataSize)
 {
     AZ_Assert(m_streamDecompression, "Decompressor not started!");
-    AZ_UNUSED(compressedDataSize);
-    const char* data = reinterpret_cast<const char*>(compressedData);
-    m_inBuffer.src = reinterpret_cast<const void*>(&data[m_compressedBufferIndex]);
-    m_inBuffer.size = m_nextBlockSize;
-    m_inBuffer.pos = 0;
+    ZSTD_inBuffer inBuffer = { compressedData, compressedDataSize, 0 };
+    ZSTD_outBuffer outBuffer = { outputData, outputDataSize, 0 };
 
-    m_outBuffer.dst = outputData;
-    m_outBuffer.size = outputDataSize;
-    m_outBuffer.pos = 0;
-
-    m_nextBlockSize = ZSTD_decompressStream(m_streamDecompression, &m_outBuffer, &m_inBuffer);
-    if (ZSTD_isError(m_nextBlockSize))
+    size_t result = ZSTD_decompressStream(m_streamDecompression, &outBuffer, &inBuffer);
+    if (ZSTD_isError(result))
     {
-        AZ_Assert(false, "ZStd streaming decompression error: %s", ZSTD_getErrorName(m_nextBlockSize));
-        return std::numeric_limits<unsigned int>::max();
+        AZ_Assert(false, "ZStd streaming decompression error: %s", ZSTD_getErrorName(result));
+        return 0;
     }
 
-    if (m_nextBlockSize == 0)
+    if (result == 0)
     {
-        m_nextBlockSize = ZSTD_resetDStream(m_streamDecompression);
+        // The frame is complete and flushed, the next data belongs to a new frame.
+        ZSTD_resetDStream(m_streamDecompression);
     }
 
-    m_compressedBufferIndex += azlossy_cast<unsigned int>(m_inBuffer.pos);
-
-    *sizeOfNextBlock = m_nextBlockSize;
-
-    return azlossy_cast<unsigned int>(m_outBuffer.pos); //return number of bytes decompressed
+    outputDataSize -= azlossy_cast<unsigned int>(outBuffer.pos);
+    return azlossy_cast<unsigned int>(inBuffer.pos);
 }
 
 bool ZStd::IsCompressorStarted() const
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #define ZSTD_STATIC_LINKING_ONLY
@@ -18,10 +20,67 @@ namespace AZ
 {
     class IAllocator;
 
+    /**
+     * Pool of zstd compression and decompression contexts.
+     * Creating a context allocates several hundred KB of tables, which dominates the cost of compressing small buffers,
+     * so contexts are returned to the pool when a compression ends and reused by the next one.
+     * The pooled contexts use the zstd default allocator, which lets the global pool outlive the AZ allocators. Thread safe.
+     */
+    class ZStdContextPool
+    {
+    public:
+        static constexpr size_t MaxPooledContexts = 8;
+
+        ZStdContextPool() = default;
+        ~ZStdContextPool();
+
+        /// Returns the process wide pool.
+        static ZStdContextPool& GetGlobal();
+
+        ZSTD_CCtx* AcquireCompressionContext();
+        /// Returns a context to the pool, any compression in progress is abandoned.
+        void ReleaseCompressionContext(ZSTD_CCtx* context);
+
+        ZSTD_DCtx* AcquireDecompressionContext();
+        /// Returns a context to the pool, any decompression in progress is abandoned.
+        void ReleaseDecompressionContext(ZSTD_DCtx* context);
+
+        /// Compresses a whole buffer into a single zstd frame with a pooled context.
+        /// \param compressedDataSize should be at least GetMaxCompressedSize(dataSize).
+        /// \return the size of the compressed frame, 0 if compression failed.
+        size_t Compress(const void* data, size_t dataSize, void* compressedData, size_t compressedDataSize, int compressionLevel = 1);
+        /// Decompresses a zstd frame with a pooled context.
+        /// \return the size of the decompressed data, 0 if decompression failed or the output buffer is too small.
+        size_t Decompress(const void* compressedData, size_t compressedDataSize, void* data, size_t dataSize);
+
+        static size_t GetMaxCompressedSize(size_t dataSize);
+
+    private:
+        AZStd::mutex m_mutex;
+        AZStd::fixed_vector<ZSTD_CCtx*, MaxPooledContexts> m_compressionContexts;
+        AZStd::fixed_vector<ZSTD_DCtx*, MaxPooledContexts> m_decompressionContexts;
+    };
+
     class ZStd
     {
     public:
-        ZStd(IAllocator* workMemAllocator = 0);
+        /// Streaming compression settings on top of the compression level.
+        struct CompressionParameters
+        {
+            /// Number of threads compressing in the background, 0 compresses on the calling thread.
+            /// Ignored (with a warning) if the zstd library was built without multithreading support.
+            unsigned int m_numWorkers = 0;
+            /// Finds matches far back in the stream, which helps large files with repeated content. Uses more memory.
+            bool m_longDistanceMatching = false;
+            /// Log2 of the match window, 0 uses the default of the compression level (27 with long distance matching).
+            /// Clamped to MaxWindowLog, the largest window every decompressor accepts without extra settings.
+            unsigned int m_windowLog = 0;
+        };
+
+        static constexpr unsigned int MaxWindowLog = 27;
+
+        /// \param contextPool if set, the zstd contexts are taken from the pool instead of being created with workMemAllocator.
+        ZStd(IAllocator* workMemAllocator = 0, ZStdContextPool* contextPool = nullptr);
         ~ZStd();
 
         enum FlushType
@@ -46,7 +105,7 @@ namespace AZ
 
         using Header = AZ::u32;     ///< Typedef for the  byte zstd header.
 
-        void StartCompressor(unsigned int compressionLevel = 1);
+        void StartCompressor(unsigned int compressionLevel = 1, const CompressionParameters& parameters = {});
         bool IsCompressorStarted() const;
         void StopCompressor();
         void ResetCompressor();
@@ -54,32 +113,37 @@ namespace AZ
         void StartDecompressor();
         bool IsDecompressorStarted() const;
         void StopDecompressor();
-        /// If you will use seek/sync points we require that you pass the header since the reset will reset all states and you can't really continue (unless from the start).
+        /// Every seek point starts a new zstd frame, which carries its own header, so the header is not needed to reset the decompressor.
         void ResetDecompressor(Header* header = nullptr);
 
         //////////////////////////////////////////////////////////////////////////
         // Compressor
         unsigned int GetMinCompressedBufferSize(unsigned int sourceDataSize);
 
+        /// Compresses data and updates dataSize with the number of bytes that were not consumed.
+        /// FT_NO_FLUSH may buffer the data, FT_PARTIAL_FLUSH, FT_SYNC_FLUSH, FT_FULL_FLUSH, FT_BLOCK and FT_TREES flush the
+        /// compressed data and FT_FINISH ends the frame, the next call starts a new frame.
+        /// \return number of compressed bytes written. When flushing call again while IsFlushPending() is true.
         unsigned int Compress(const void* data, unsigned int& dataSize, void* compressedData, unsigned int compressedDataSize, FlushType flushType = FT_NO_FLUSH);
+        /// True if the last flush or finish didn't fit in the compressed data buffer.
+        bool IsFlushPending() const;
         //////////////////////////////////////////////////////////////////////////
 
         //////////////////////////////////////////////////////////////////////////
         // Decompressor
-        unsigned int Decompress(const void* compressedData, unsigned int compressedDataSize, void* outputData, unsigned int outputDataSize, size_t* sizeOfNextBlock);
+        /// Decompresses data and updates outputDataSize with the space left in the output buffer.
+        /// Decompressed data that doesn't fit is kept and returned by the next call, even with no compressed data.
+        /// \return number of compressed bytes consumed.
+        unsigned int Decompress(const void* compressedData, unsigned int compressedDataSize, void* outputData, unsigned int& outputDataSize);
         //////////////////////////////////////////////////////////////////////////
     private:
         static void* AllocateMem(void* userData, size_t size);
         static void  FreeMem(void* userData, void* address);
 
-        void         SetupDecompressHeader(Header header);
-
         ZSTD_CStream*   m_streamCompression;
         ZSTD_DStream*   m_streamDecompression;
         IAllocator*     m_workMemoryAllocator;
-        ZSTD_inBuffer   m_inBuffer;
-        ZSTD_outBuffer  m_outBuffer;
-        size_t          m_nextBlockSize;
-        unsigned int    m_compressedBufferIndex;
+        ZStdContextPool* m_contextPool;
+        size_t          m_pendingFlushSize;
     };
 };
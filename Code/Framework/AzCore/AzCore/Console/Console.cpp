@@ -36,6 +36,16 @@ namespace AZ
         return count;
     }
 
+    size_t Console::CommandNameHash::operator()(AZStd::string_view name) const
+    {
+        return static_cast<AZ::u32>(AZ::Crc32(name.data(), name.size(), true));
+    }
+
+    bool Console::CommandNameEqual::operator()(AZStd::string_view lhs, AZStd::string_view rhs) const
+    {
+        return StringFunc::Equal(lhs, rhs, false);
+    }
+
     Console::Console()
         : m_head(nullptr)
     {
@@ -215,10 +225,7 @@ namespace AZ
 
     ConsoleFunctorBase* Console::FindCommand(AZStd::string_view command, ConsoleFunctorFlags ignoreAnyFlags)
     {
-        CVarFixedString lowerName(command);
-        AZStd::to_lower(lowerName.begin(), lowerName.end());
-
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        CommandMap::iterator iter = m_commands.find(command);
         if (iter != m_commands.end())
         {
             for (ConsoleFunctorBase* curr : iter->second)
@@ -317,9 +324,8 @@ namespace AZ
             return;
         }
 
-        CVarFixedString lowerName = functor->GetName();
-        AZStd::to_lower(lowerName.begin(), lowerName.end());
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        const AZStd::string_view name = functor->GetName();
+        CommandMap::iterator iter = m_commands.find(name);
         if (iter != m_commands.end())
         {
             // Validate we haven't already added this cvar
@@ -347,9 +353,10 @@ namespace AZ
                 }
             }
         }
-        m_commands[lowerName].emplace_back(functor);
+        m_commands[CVarFixedString(name)].emplace_back(functor);
         functor->Link(m_head);
         functor->m_console = this;
+        ++m_functorRegistryVersion;
     }
 
     void Console::UnregisterFunctor(ConsoleFunctorBase* functor)
@@ -360,9 +367,8 @@ namespace AZ
             return;
         }
 
-        CVarFixedString lowerName = functor->GetName();
-        AZStd::to_lower(lowerName.begin(), lowerName.end());
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        const AZStd::string_view name = functor->GetName();
+        CommandMap::iterator iter = m_commands.find(name);
         if (iter != m_commands.end())
         {
             AZStd::vector<ConsoleFunctorBase*>::iterator iter2 = AZStd::find(iter->second.begin(), iter->second.end(), functor);
@@ -378,6 +384,7 @@ namespace AZ
         }
         functor->Unlink(m_head);
         functor->m_console = nullptr;
+        ++m_functorRegistryVersion;
     }
 
     void Console::LinkDeferredFunctors(ConsoleFunctorBase*& deferredHead)
@@ -399,6 +406,7 @@ namespace AZ
     void Console::MoveFunctorsToDeferredHead(ConsoleFunctorBase*& deferredHead)
     {
         m_commands.clear();
+        ++m_functorRegistryVersion;
 
         // Re-initialize all of the current functors to a deferred state
         for (ConsoleFunctorBase* curr = m_head; curr != nullptr; curr = curr->m_next)
@@ -441,10 +449,7 @@ namespace AZ
         bool result = false;
         ConsoleFunctorFlags flags = ConsoleFunctorFlags::Null;
 
-        CVarFixedString lowerName(command);
-        AZStd::to_lower(lowerName.begin(), lowerName.end());
-
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        CommandMap::iterator iter = m_commands.find(command);
         if (iter != m_commands.end())
         {
             for (ConsoleFunctorBase* curr : iter->second)
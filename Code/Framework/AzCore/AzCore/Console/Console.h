@@ -99,7 +99,19 @@ namespace AZ
         AZ_DISABLE_COPY_MOVE(Console);
 
         ConsoleFunctorBase* m_head;
-        using CommandMap = AZStd::unordered_map<CVarFixedString, AZStd::vector<ConsoleFunctorBase*>>;
+        //! Command names are hashed by the CRC32 of their lowercase characters so that lookups are case insensitive
+        //! without copying and lowercasing the name that is searched for.
+        struct CommandNameHash
+        {
+            using is_transparent = void;
+            size_t operator()(AZStd::string_view name) const;
+        };
+        struct CommandNameEqual
+        {
+            using is_transparent = void;
+            bool operator()(AZStd::string_view lhs, AZStd::string_view rhs) const;
+        };
+        using CommandMap = AZStd::unordered_map<CVarFixedString, AZStd::vector<ConsoleFunctorBase*>, CommandNameHash, CommandNameEqual>;
         CommandMap m_commands;
         AZ::SettingsRegistryInterface::NotifyEventHandler m_consoleCommandKeyHandler;
         struct DeferredCommand
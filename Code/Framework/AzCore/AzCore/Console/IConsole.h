@@ -150,6 +150,10 @@ namespace AZ
         //! @param pointer to the modules set of ConsoleFunctors to register
         virtual void LinkDeferredFunctors(ConsoleFunctorBase*& deferredHead) = 0;
 
+        //! Returns a number that changes whenever a functor is registered with or unregistered from the console.
+        //! Used by ConsoleFunctorHandle to know when a cached functor pointer has to be resolved again.
+        AZ::u64 GetFunctorRegistryVersion() const;
+
         //! Returns the AZ::Event<> invoked whenever a console command is registered.
         using ConsoleCommandRegisteredEvent = AZ::Event<ConsoleFunctorBase*>;
         ConsoleCommandRegisteredEvent& GetConsoleCommandRegisteredEvent();
@@ -173,6 +177,36 @@ namespace AZ
         ConsoleCommandRegisteredEvent m_consoleCommandRegisteredEvent;
         ConsoleCommandInvokedEvent m_consoleCommandInvokedEvent;
         DispatchCommandNotFoundEvent m_dispatchCommandNotFoundEvent;
+        AZ::u64 m_functorRegistryVersion = 0;
+    };
+
+    //! @class ConsoleFunctorHandle
+    //! Caches the functor a console command name resolves to, so code that reads a cvar every frame only pays for the
+    //! name lookup once. The functor is looked up again whenever functors have been registered or unregistered since
+    //! it was cached, so the handle never refers to a functor that has been destroyed.
+    //! @note The console must outlive the handle.
+    class ConsoleFunctorHandle
+    {
+    public:
+        ConsoleFunctorHandle(
+            IConsole& console, AZStd::string_view command, ConsoleFunctorFlags ignoreAnyFlags = ConsoleFunctorFlags::IsInvisible);
+
+        //! Returns the functor registered under the command name, or nullptr if there isn't one.
+        ConsoleFunctorBase* Get();
+
+        //! Retrieves the value of the cvar without looking it up by name as long as the cached functor is still valid.
+        //! @param outValue reference to the instance to write the current cvar value to
+        //! @return GetValueResult::Success if the operation succeeded, or an error result if the operation failed
+        template<typename RETURN_TYPE>
+        GetValueResult GetValue(RETURN_TYPE& outValue);
+
+    private:
+        IConsole& m_console;
+        CVarFixedString m_command;
+        ConsoleFunctorFlags m_ignoreAnyFlags;
+        ConsoleFunctorBase* m_functor = nullptr;
+        AZ::u64 m_resolvedVersion = 0;
+        bool m_resolved = false;
     };
 
     inline auto IConsole::GetConsoleCommandRegisteredEvent() -> ConsoleCommandRegisteredEvent&
@@ -190,6 +224,11 @@ namespace AZ
         return m_dispatchCommandNotFoundEvent;
     }
 
+    inline AZ::u64 IConsole::GetFunctorRegistryVersion() const
+    {
+        return m_functorRegistryVersion;
+    }
+
     template<typename RETURN_TYPE>
     inline GetValueResult IConsole::GetCvarValue(AZStd::string_view command, RETURN_TYPE& outValue)
     {
@@ -200,6 +239,36 @@ namespace AZ
         }
         return cvarFunctor->GetValue(outValue);
     }
+
+    inline ConsoleFunctorHandle::ConsoleFunctorHandle(IConsole& console, AZStd::string_view command, ConsoleFunctorFlags ignoreAnyFlags)
+        : m_console(console)
+        , m_command(command)
+        , m_ignoreAnyFlags(ignoreAnyFlags)
+    {
+    }
+
+    inline ConsoleFunctorBase* ConsoleFunctorHandle::Get()
+    {
+        const AZ::u64 version = m_console.GetFunctorRegistryVersion();
+        if (!m_resolved || m_resolvedVersion != version)
+        {
+            m_functor = m_console.FindCommand(m_command, m_ignoreAnyFlags);
+            m_resolvedVersion = version;
+            m_resolved = true;
+        }
+        return m_functor;
+    }
+
+    template<typename RETURN_TYPE>
+    inline GetValueResult ConsoleFunctorHandle::GetValue(RETURN_TYPE& outValue)
+    {
+        ConsoleFunctorBase* cvarFunctor = Get();
+        if (cvarFunctor == nullptr)
+        {
+            return GetValueResult::ConsoleVarNotFound;
+        }
+        return cvarFunctor->GetValue(outValue);
+    }
 }
 
 template <typename _TYPE, typename = void>
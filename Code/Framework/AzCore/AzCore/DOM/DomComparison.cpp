@@ -45,11 +45,16 @@ namespace AZ::Dom
         {
             desiredKeys.clear();
             Path subPath = path;
-            for (auto it = after.MemberBegin(); it != after.MemberEnd(); ++it)
+            const Object::ContainerType& beforeMembers = before.GetObject();
+            size_t memberIndex = 0;
+            for (auto it = after.MemberBegin(); it != after.MemberEnd(); ++it, ++memberIndex)
             {
                 desiredKeys.insert(it->first.GetHash());
                 subPath.Push(it->first);
-                auto beforeIt = before.FindMember(it->first);
+                // Members usually keep their order between states, so check the same position before searching for the key.
+                auto beforeIt = memberIndex < beforeMembers.size() && beforeMembers[memberIndex].first == it->first
+                    ? beforeMembers.begin() + memberIndex
+                    : before.FindMember(it->first);
                 if (beforeIt == before.MemberEnd())
                 {
                     AddPatch(PatchOperation::AddOperation(subPath, it->second), PatchOperation::RemoveOperation(subPath));
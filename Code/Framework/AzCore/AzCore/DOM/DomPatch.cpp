@@ -114,21 +114,31 @@ namespace AZ::Dom
     }
 
     PatchOutcome PatchOperation::ApplyInPlace(Value& rootElement) const
+    {
+        return ApplyInPlace(rootElement, nullptr);
+    }
+
+    PatchOutcome PatchOperation::ApplyInPlace(Value& rootElement, PatchPathCache& cache) const
+    {
+        return ApplyInPlace(rootElement, &cache);
+    }
+
+    PatchOutcome PatchOperation::ApplyInPlace(Value& rootElement, PatchPathCache* cache) const
     {
         switch (m_type)
         {
         case Type::Add:
-            return ApplyAdd(rootElement);
+            return ApplyAdd(rootElement, cache);
         case Type::Remove:
-            return ApplyRemove(rootElement);
+            return ApplyRemove(rootElement, cache);
         case Type::Replace:
-            return ApplyReplace(rootElement);
+            return ApplyReplace(rootElement, cache);
         case Type::Copy:
-            return ApplyCopy(rootElement);
+            return ApplyCopy(rootElement, cache);
         case Type::Move:
-            return ApplyMove(rootElement);
+            return ApplyMove(rootElement, cache);
         case Type::Test:
-            return ApplyTest(rootElement);
+            return ApplyTest(rootElement, cache);
         }
         return AZ::Failure<AZStd::string>("Unsupported DOM patch operation specified");
     }
@@ -453,7 +463,7 @@ namespace AZ::Dom
     }
 
     AZ::Outcome<PatchOperation::PathContext, AZStd::string> PatchOperation::LookupPath(
-        Value& rootElement, const Path& path, ExistenceCheckFlags flags)
+        Value& rootElement, const Path& path, ExistenceCheckFlags flags, PatchPathCache* cache)
     {
         const bool verifyFullPath = (flags & ExistenceCheckFlags::VerifyFullPath) != ExistenceCheckFlags::DefaultExistenceCheck;
         const bool allowEndOfArray = (flags & ExistenceCheckFlags::AllowEndOfArray) != ExistenceCheckFlags::DefaultExistenceCheck;
@@ -481,7 +491,7 @@ namespace AZ::Dom
         PathEntry destinationIndex = target[target.Size() - 1];
         target.Pop();
 
-        Value* targetValue = rootElement.FindMutableChild(target);
+        Value* targetValue = cache ? cache->FindMutableValue(rootElement, target) : rootElement.FindMutableChild(target);
         if (targetValue == nullptr)
         {
             AZStd::string errorMessage = "Path not found: ";
@@ -529,9 +539,15 @@ namespace AZ::Dom
         return AZ::Success<PathContext>({ *targetValue, AZStd::move(destinationIndex) });
     }
 
-    PatchOutcome PatchOperation::ApplyAdd(Value& rootElement) const
+    Value& PatchOperation::GetValueAtPath(Value& rootElement, const Path& path, const PathContext& context)
     {
-        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::AllowEndOfArray);
+        // The context of the empty path is a temporary wrapper, so the root is used directly.
+        return path.IsEmpty() ? rootElement : context.m_value[context.m_key];
+    }
+
+    PatchOutcome PatchOperation::ApplyAdd(Value& rootElement, PatchPathCache* cache) const
+    {
+        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::AllowEndOfArray, cache);
         if (!pathLookup.IsSuccess())
         {
             return AZ::Failure(pathLookup.TakeError());
@@ -540,6 +556,11 @@ namespace AZ::Dom
         const PathEntry& destinationIndex = context.m_key;
         Value& targetValue = context.m_value;
 
+        if (cache)
+        {
+            cache->InvalidateSiblings(m_domPath);
+        }
+
         if (destinationIndex.IsIndex() || destinationIndex.IsEndOfArray())
         {
             if (destinationIndex.IsEndOfArray())
@@ -560,9 +581,9 @@ namespace AZ::Dom
         return AZ::Success();
     }
 
-    PatchOutcome PatchOperation::ApplyRemove(Value& rootElement) const
+    PatchOutcome PatchOperation::ApplyRemove(Value& rootElement, PatchPathCache* cache) const
     {
-        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath);
+        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath, cache);
         if (!pathLookup.IsSuccess())
         {
             return AZ::Failure(pathLookup.TakeError());
@@ -571,6 +592,11 @@ namespace AZ::Dom
         const PathEntry& destinationIndex = context.m_key;
         Value& targetValue = context.m_value;
 
+        if (cache)
+        {
+            cache->InvalidateSiblings(m_domPath);
+        }
+
         if (destinationIndex.IsIndex() || destinationIndex.IsEndOfArray())
         {
             size_t index = destinationIndex.IsEndOfArray() ? targetValue.ArraySize() - 1 : destinationIndex.GetIndex();
@@ -584,45 +610,56 @@ namespace AZ::Dom
         return AZ::Success();
     }
 
-    PatchOutcome PatchOperation::ApplyReplace(Value& rootElement) const
+    PatchOutcome PatchOperation::ApplyReplace(Value& rootElement, PatchPathCache* cache) const
     {
-        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath);
+        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath, cache);
         if (!pathLookup.IsSuccess())
         {
             return AZ::Failure(pathLookup.TakeError());
         }
 
-        rootElement[m_domPath] = GetValue();
+        if (cache)
+        {
+            cache->InvalidateChildren(m_domPath);
+        }
+        GetValueAtPath(rootElement, m_domPath, pathLookup.GetValue()) = GetValue();
         return AZ::Success();
     }
 
-    PatchOutcome PatchOperation::ApplyCopy(Value& rootElement) const
+    PatchOutcome PatchOperation::ApplyCopy(Value& rootElement, PatchPathCache* cache) const
     {
-        auto sourceLookup = LookupPath(rootElement, GetSourcePath(), ExistenceCheckFlags::VerifyFullPath);
+        auto sourceLookup = LookupPath(rootElement, GetSourcePath(), ExistenceCheckFlags::VerifyFullPath, cache);
         if (!sourceLookup.IsSuccess())
         {
             return AZ::Failure(sourceLookup.TakeError());
         }
 
-        auto destLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::DefaultExistenceCheck);
+        auto destLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::DefaultExistenceCheck, cache);
         if (!destLookup.IsSuccess())
         {
             return AZ::Failure(destLookup.TakeError());
         }
 
-        rootElement[m_domPath] = rootElement[GetSourcePath()];
+        Value valueToCopy = GetValueAtPath(rootElement, GetSourcePath(), sourceLookup.GetValue());
+        if (cache)
+        {
+            // The copy shares its containers with the source, so values inside the source can't be changed through the cache anymore.
+            cache->InvalidateChildren(GetSourcePath());
+            cache->InvalidateSiblings(m_domPath);
+        }
+        GetValueAtPath(rootElement, m_domPath, destLookup.GetValue()) = AZStd::move(valueToCopy);
         return AZ::Success();
     }
 
-    PatchOutcome PatchOperation::ApplyMove(Value& rootElement) const
+    PatchOutcome PatchOperation::ApplyMove(Value& rootElement, PatchPathCache* cache) const
     {
-        auto sourceLookup = LookupPath(rootElement, GetSourcePath(), ExistenceCheckFlags::VerifyFullPath);
+        auto sourceLookup = LookupPath(rootElement, GetSourcePath(), ExistenceCheckFlags::VerifyFullPath, cache);
         if (!sourceLookup.IsSuccess())
         {
             return AZ::Failure(sourceLookup.TakeError());
         }
 
-        auto destLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::DefaultExistenceCheck);
+        auto destLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::DefaultExistenceCheck, cache);
         if (!destLookup.IsSuccess())
         {
             return AZ::Failure(destLookup.TakeError());
@@ -630,6 +667,10 @@ namespace AZ::Dom
 
         const PathContext& sourceContext = sourceLookup.GetValue();
         Value valueToMove = sourceContext.m_value[sourceContext.m_key];
+        if (cache)
+        {
+            cache->InvalidateSiblings(GetSourcePath());
+        }
         if (sourceContext.m_key.IsEndOfArray())
         {
             sourceContext.m_value.ArrayPopBack();
@@ -643,11 +684,16 @@ namespace AZ::Dom
             sourceContext.m_value.EraseMember(sourceContext.m_key.GetKey());
         }
 
-        auto newDestLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::AllowEndOfArray);
+        auto newDestLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::AllowEndOfArray, cache);
         const PathContext& destContext = newDestLookup.GetValue();
         const PathEntry& destinationIndex = destContext.m_key;
         Value& targetValue = destContext.m_value;
 
+        if (cache)
+        {
+            cache->InvalidateSiblings(m_domPath);
+        }
+
         if (destinationIndex.IsIndex() || destinationIndex.IsEndOfArray())
         {
             const size_t index = destinationIndex.GetIndex();
@@ -669,15 +715,15 @@ namespace AZ::Dom
         return AZ::Success();
     }
 
-    PatchOutcome PatchOperation::ApplyTest(Value& rootElement) const
+    PatchOutcome PatchOperation::ApplyTest(Value& rootElement, PatchPathCache* cache) const
     {
-        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath);
+        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath, cache);
         if (!pathLookup.IsSuccess())
         {
             return AZ::Failure(pathLookup.TakeError());
         }
 
-        if (!Utils::DeepCompareIsEqual(rootElement[m_domPath], GetValue()))
+        if (!Utils::DeepCompareIsEqual(GetValueAtPath(rootElement, m_domPath, pathLookup.GetValue()), GetValue()))
         {
             return AZ::Failure<AZStd::string>("Test failed, values don't match");
         }
@@ -717,6 +763,89 @@ namespace AZ::Dom
         }
     } // namespace PatchApplicationStrategy
 
+    void PatchPathCache::Clear()
+    {
+        m_rootElement = nullptr;
+        m_values.Clear();
+    }
+
+    Value* PatchPathCache::FindMutableValue(Value& rootElement, const Path& path)
+    {
+        if (m_rootElement != &rootElement)
+        {
+            Clear();
+            m_rootElement = &rootElement;
+        }
+
+        if (path.IsEmpty())
+        {
+            return &rootElement;
+        }
+
+        for (const PathEntry& entry : path)
+        {
+            if (entry.IsEndOfArray())
+            {
+                // Looking up an end of array entry appends to the array, which moves the values in it.
+                m_values.Clear();
+                return rootElement.FindMutableChild(path);
+            }
+        }
+
+        Value* value = &rootElement;
+        size_t depth = 0;
+        if (const CachedValue* cachedValue = m_values.ValueAtPath(path, PrefixTreeMatch::PathAndParents))
+        {
+            value = cachedValue->m_value;
+            depth = cachedValue->m_depth;
+            if (depth == path.Size())
+            {
+                return value;
+            }
+        }
+
+        for (; depth < path.Size() && value != nullptr; ++depth)
+        {
+            value = value->FindMutableChild(path[depth]);
+        }
+        if (value != nullptr)
+        {
+            m_values.SetValue(path, CachedValue{ value, path.Size() });
+        }
+        return value;
+    }
+
+    void PatchPathCache::InvalidateChildren(const Path& path)
+    {
+        if (path.IsEmpty())
+        {
+            m_values.Clear();
+            return;
+        }
+
+        const CachedValue* cachedValue = m_values.ValueAtPath(path, PrefixTreeMatch::ExactPath);
+        if (cachedValue == nullptr)
+        {
+            m_values.EraseValue(path, true);
+            return;
+        }
+
+        // The value at the path itself doesn't move, only the values in its containers.
+        const CachedValue valueAtPath = *cachedValue;
+        m_values.EraseValue(path, true);
+        m_values.SetValue(path, valueAtPath);
+    }
+
+    void PatchPathCache::InvalidateSiblings(const Path& path)
+    {
+        if (path.Size() <= 1)
+        {
+            m_values.Clear();
+            return;
+        }
+        InvalidateChildren(Path(path.begin(), path.end() - 1));
+    }
+
     Patch::Patch(AZStd::initializer_list<PatchOperation> init)
         : m_operations(init)
     {
@@ -836,6 +965,35 @@ namespace AZ::Dom
     }
 
     AZ::Outcome<void, AZStd::string> Patch::ApplyInPlace(Value& rootElement, StrategyFunctor strategy) const
+    {
+        bool shouldContinue = true;
+        return ApplyInPlace(rootElement, nullptr, strategy, shouldContinue);
+    }
+
+    PatchOutcome Patch::ApplyInPlace(Value& rootElement, PatchPathCache& cache, StrategyFunctor strategy) const
+    {
+        bool shouldContinue = true;
+        return ApplyInPlace(rootElement, &cache, strategy, shouldContinue);
+    }
+
+    PatchOutcome Patch::ApplyAllInPlace(Value& rootElement, AZStd::span<const Patch> patches, StrategyFunctor strategy)
+    {
+        PatchPathCache cache;
+        PatchOutcome outcome = AZ::Success();
+        bool shouldContinue = true;
+        for (const Patch& patch : patches)
+        {
+            CombinePatchOutcomes(outcome, patch.ApplyInPlace(rootElement, &cache, strategy, shouldContinue));
+            if (!shouldContinue)
+            {
+                break;
+            }
+        }
+        return outcome;
+    }
+
+    PatchOutcome Patch::ApplyInPlace(
+        Value& rootElement, PatchPathCache* cache, const StrategyFunctor& strategy, bool& shouldContinue) const
     {
         PatchApplicationState state;
         state.m_currentState = &rootElement;
@@ -844,13 +1002,14 @@ namespace AZ::Dom
         for (const PatchOperation& operation : m_operations)
         {
             state.m_lastOperation = &operation;
-            CombinePatchOutcomes(state.m_outcome, operation.ApplyInPlace(rootElement));
+            CombinePatchOutcomes(state.m_outcome, cache ? operation.ApplyInPlace(rootElement, *cache) : operation.ApplyInPlace(rootElement));
             strategy(state);
             if (!state.m_shouldContinue)
             {
                 break;
             }
         }
+        shouldContinue = state.m_shouldContinue;
         return state.m_outcome;
     }
 
@@ -9,14 +9,18 @@
 #pragma once
 
 #include <AzCore/DOM/DomPath.h>
+#include <AzCore/DOM/DomPrefixTree.h>
 #include <AzCore/DOM/DomValue.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/span.h>
 
 namespace AZ::Dom
 {
     using PatchOutcome = AZ::Outcome<void, AZStd::string>;
     void CombinePatchOutcomes(PatchOutcome& lhs, PatchOutcome&& rhs);
 
+    class PatchPathCache;
+
     //! A patch operation that represents an atomic operation for mutating or validating a Value.
     //! PatchOperations can be created with helper methods in Patch. /see Patch
     class PatchOperation final
@@ -68,6 +72,9 @@ namespace AZ::Dom
 
         AZ::Outcome<Value, AZStd::string> Apply(Value rootElement) const;
         PatchOutcome ApplyInPlace(Value& rootElement) const;
+        //! Applies this operation in place, starting its path lookups from the values cached by earlier operations.
+        //! \see PatchPathCache
+        PatchOutcome ApplyInPlace(Value& rootElement, PatchPathCache& cache) const;
         AZ::Outcome<Value, AZStd::string> ApplyAndDenormalize(Value rootElement);
         PatchOutcome ApplyInPlaceAndDenormalize(Value& rootElement);
 
@@ -99,14 +106,20 @@ namespace AZ::Dom
         // and replaces them with the resolved path
         static bool DenormalizePath(Dom::Path& path, const Dom::Value& sourceValue);
         static AZ::Outcome<PathContext, AZStd::string> LookupPath(
-            Value& rootElement, const Path& path, ExistenceCheckFlags existenceCheckFlags = ExistenceCheckFlags::DefaultExistenceCheck);
-
-        PatchOutcome ApplyAdd(Value& rootElement) const;
-        PatchOutcome ApplyRemove(Value& rootElement) const;
-        PatchOutcome ApplyReplace(Value& rootElement) const;
-        PatchOutcome ApplyCopy(Value& rootElement) const;
-        PatchOutcome ApplyMove(Value& rootElement) const;
-        PatchOutcome ApplyTest(Value& rootElement) const;
+            Value& rootElement,
+            const Path& path,
+            ExistenceCheckFlags existenceCheckFlags = ExistenceCheckFlags::DefaultExistenceCheck,
+            PatchPathCache* cache = nullptr);
+        //! Returns the value a successfully looked up path refers to.
+        static Value& GetValueAtPath(Value& rootElement, const Path& path, const PathContext& context);
+
+        PatchOutcome ApplyInPlace(Value& rootElement, PatchPathCache* cache) const;
+        PatchOutcome ApplyAdd(Value& rootElement, PatchPathCache* cache) const;
+        PatchOutcome ApplyRemove(Value& rootElement, PatchPathCache* cache) const;
+        PatchOutcome ApplyReplace(Value& rootElement, PatchPathCache* cache) const;
+        PatchOutcome ApplyCopy(Value& rootElement, PatchPathCache* cache) const;
+        PatchOutcome ApplyMove(Value& rootElement, PatchPathCache* cache) const;
+        PatchOutcome ApplyTest(Value& rootElement, PatchPathCache* cache) const;
 
         AZStd::variant<AZStd::monostate, Value, Path> m_value;
         Path m_domPath;
@@ -115,6 +128,38 @@ namespace AZ::Dom
 
     AZ_DEFINE_ENUM_BITWISE_OPERATORS(PatchOperation::ExistenceCheckFlags);
 
+    //! Caches the values that the paths of patch operations resolve to, so that operations applied one after another to the same
+    //! DOM don't each have to resolve their path from the root. Use one cache for all patches applied to a DOM in one go, such
+    //! as a large patch or a batch of patches. Only operations applied with the cache keep it up to date, so it needs to be
+    //! cleared when the DOM is changed in any other way, including by a patch application strategy.
+    class PatchPathCache final
+    {
+    public:
+        //! Removes all cached values.
+        void Clear();
+
+    private:
+        friend class PatchOperation;
+
+        struct CachedValue
+        {
+            Value* m_value = nullptr;
+            //! The number of path entries it took to get to the value.
+            size_t m_depth = 0;
+        };
+
+        //! Looks up the value at the path, starting from the closest cached parent, and caches it.
+        Value* FindMutableValue(Value& rootElement, const Path& path);
+        //! Removes the cached values below the path, as the containers at the path are about to change.
+        void InvalidateChildren(const Path& path);
+        //! Removes the cached values for the path, its siblings and everything below them, as the container holding them is
+        //! about to change.
+        void InvalidateSiblings(const Path& path);
+
+        Value* m_rootElement = nullptr;
+        DomPrefixTree<CachedValue> m_values;
+    };
+
     class Patch;
 
     //! The current state of a Patch application operation.
@@ -195,6 +240,24 @@ namespace AZ::Dom
         //! \return an outcome with either the patched element or an error string
         PatchOutcome ApplyInPlace(Value& rootElement, StrategyFunctor strategy = PatchApplicationStrategy::HaltOnFailure) const;
 
+        //! Applies this patch to the given DOM element in place, using and updating the values cached for the paths of
+        //! earlier operations. This avoids resolving the path of every operation from the root.
+        //! \param rootElement The DOM element to patch.
+        //! \param cache The cache for rootElement, see PatchPathCache.
+        //! \param strategy A callback to be run after every patch application, see PatchApplicationState.
+        //! \return an outcome with either the patched element or an error string
+        PatchOutcome ApplyInPlace(
+            Value& rootElement, PatchPathCache& cache, StrategyFunctor strategy = PatchApplicationStrategy::HaltOnFailure) const;
+
+        //! Applies several patches to the given DOM element in place, in order. The paths the operations resolve to are cached
+        //! across all of the patches. If the strategy halts, none of the remaining patches are applied.
+        //! \param rootElement The DOM element to patch.
+        //! \param patches The patches to apply.
+        //! \param strategy A callback to be run after every patch application, see PatchApplicationState.
+        //! \return an outcome with either the patched element or an error string
+        static PatchOutcome ApplyAllInPlace(
+            Value& rootElement, AZStd::span<const Patch> patches, StrategyFunctor strategy = PatchApplicationStrategy::HaltOnFailure);
+
         //! Applies this patch to the given DOM element.
         //! After applying the patch, any "EndOfArray" patch entries are denormalized into their resolved paths.
         //! This operation mutates the underyling patch operations; make a copy if you wish to keep the original patch.
@@ -219,6 +282,8 @@ namespace AZ::Dom
         bool ContainsNormalizedEntries() const;
 
     private:
+        PatchOutcome ApplyInPlace(Value& rootElement, PatchPathCache* cache, const StrategyFunctor& strategy, bool& shouldContinue) const;
+
         OperationsContainer m_operations;
     };
 } // namespace AZ::Dom
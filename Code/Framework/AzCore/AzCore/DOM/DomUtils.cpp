@@ -153,6 +153,26 @@ namespace AZ::Dom::Utils
         return result;
     }
 
+    namespace Internal
+    {
+        // Objects are mostly compared against other versions of themselves, so the key is checked at the same position before
+        // searching for it, which keeps comparing objects with the same member order linear.
+        Object::ConstIterator FindMatchingMember(const Object::ContainerType& members, size_t expectedIndex, const KeyType& name)
+        {
+            if (expectedIndex < members.size() && members[expectedIndex].first == name)
+            {
+                return members.begin() + expectedIndex;
+            }
+            return AZStd::find_if(
+                members.begin(),
+                members.end(),
+                [&name](const Object::EntryType& entry)
+                {
+                    return entry.first == name;
+                });
+        }
+    } // namespace Internal
+
     bool DeepCompareIsEqual(const Value& lhs, const Value& rhs, const ComparisonParameters& parameters)
     {
         const Value::ValueType& lhsValue = lhs.GetInternalValue();
@@ -196,8 +216,8 @@ namespace AZ::Dom::Utils
                     for (size_t i = 0; i < ourValues.size(); ++i)
                     {
                         const Object::EntryType& lhsChild = ourValues[i];
-                        auto rhsIt = rhs.FindMember(lhsChild.first);
-                        if (rhsIt == rhs.MemberEnd() || !DeepCompareIsEqual(lhsChild.second, rhsIt->second, parameters))
+                        auto rhsIt = Internal::FindMatchingMember(theirValues, i, lhsChild.first);
+                        if (rhsIt == theirValues.end() || !DeepCompareIsEqual(lhsChild.second, rhsIt->second, parameters))
                         {
                             return false;
                         }
@@ -263,8 +283,8 @@ namespace AZ::Dom::Utils
                     for (size_t i = 0; i < ourProperties.size(); ++i)
                     {
                         const Object::EntryType& lhsChild = ourProperties[i];
-                        auto rhsIt = rhs.FindMember(lhsChild.first);
-                        if (rhsIt == rhs.MemberEnd() || !DeepCompareIsEqual(lhsChild.second, rhsIt->second, parameters))
+                        auto rhsIt = Internal::FindMatchingMember(theirProperties, i, lhsChild.first);
+                        if (rhsIt == theirProperties.end() || !DeepCompareIsEqual(lhsChild.second, rhsIt->second, parameters))
                         {
                             return false;
                         }
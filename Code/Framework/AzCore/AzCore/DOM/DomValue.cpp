@@ -24,7 +24,7 @@ namespace AZ::Dom
             }
             else
             {
-                refCountedPointer = AZStd::allocate_shared<T>(StdValueAllocator(), *refCountedPointer);
+                refCountedPointer = AZStd::allocate_shared<T>(ValueStorageAllocator(), *refCountedPointer);
                 return refCountedPointer;
             }
         }
@@ -142,7 +142,7 @@ namespace AZ::Dom
     }
 
     Value::Value(AZStd::any opaqueValue)
-        : m_value(AZStd::allocate_shared<AZStd::any>(StdValueAllocator(), AZStd::move(opaqueValue)))
+        : m_value(AZStd::allocate_shared<AZStd::any>(ValueStorageAllocator(), AZStd::move(opaqueValue)))
     {
     }
 
@@ -446,7 +446,7 @@ namespace AZ::Dom
 
     Value& Value::SetObject()
     {
-        m_value = AZStd::allocate_shared<Object>(StdValueAllocator());
+        m_value = AZStd::allocate_shared<Object>(ValueStorageAllocator());
         return *this;
     }
 
@@ -749,7 +749,7 @@ namespace AZ::Dom
 
     Value& Value::SetArray()
     {
-        m_value = AZStd::allocate_shared<Array>(StdValueAllocator());
+        m_value = AZStd::allocate_shared<Array>(ValueStorageAllocator());
         return *this;
     }
 
@@ -857,7 +857,7 @@ namespace AZ::Dom
 
     void Value::SetNode(AZ::Name name)
     {
-        m_value = AZStd::allocate_shared<Node>(StdValueAllocator(), AZStd::move(name));
+        m_value = AZStd::allocate_shared<Node>(ValueStorageAllocator(), AZStd::move(name));
     }
 
     void Value::SetNode(AZStd::string_view name)
@@ -1048,7 +1048,7 @@ namespace AZ::Dom
         }
         else
         {
-            SharedStringType sharedString = AZStd::allocate_shared<SharedStringContainer>(StdValueAllocator(), value.begin(), value.end());
+            SharedStringType sharedString = AZStd::allocate_shared<SharedStringContainer>(ValueStorageAllocator(), value.begin(), value.end());
             m_value = AZStd::move(sharedString);
         }
     }
@@ -1060,7 +1060,7 @@ namespace AZ::Dom
 
     void Value::SetOpaqueValue(AZStd::any value)
     {
-        m_value = AZStd::allocate_shared<AZStd::any>(StdValueAllocator(), AZStd::move(value));
+        m_value = AZStd::allocate_shared<AZStd::any>(ValueStorageAllocator(), AZStd::move(value));
     }
 
     void Value::SetNull()
@@ -43,9 +43,14 @@ namespace AZ::Dom
     };
 
     //! The allocator used by Value.
-    //! Value heap allocates shared_ptrs for its container storage (Array / Object / Node) alongside
+    //! Value heap allocates shared_ptrs for its container storage (Array / Object / Node) alongside the elements of those containers.
     AZ_ALLOCATOR_DEFAULT_GLOBAL_WRAPPER(ValueAllocator, AZ::SystemAllocator, "{5BC8B389-72C7-459E-B502-12E74D61869F}")
 
+    //! The allocator used for the ref counted storage of Value (Array / Object / Node, shared strings and opaque values).
+    //! These are small, fixed size allocations that are made and released for every container a document has, and every container
+    //! that's detached when a shared Value is changed, so they're pooled instead of going through the system allocator.
+    AZ_ALLOCATOR_DEFAULT_GLOBAL_WRAPPER(ValueStorageAllocator, AZ::ThreadPoolAllocator, "{6F5D41E2-0C3A-4C8A-9A8E-3D2B5E7C91A4}")
+
     using StdValueAllocator = ValueAllocator;
 
     class Value;
@@ -12,6 +12,10 @@
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Statistics/StatisticalProfilerProxy.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/time.h>
 
 AZ_DEFINE_BUDGET(Animation);
 AZ_DEFINE_BUDGET(Audio);
@@ -27,9 +31,46 @@ namespace AZ::Debug
     struct BudgetImpl
     {
         AZ_CLASS_ALLOCATOR(BudgetImpl, AZ::SystemAllocator);
-        // TODO: Budget implementation for tracking budget wall time per-core, memory, etc.
+        // TODO: Budget implementation for tracking memory, etc.
+
+        AZStd::atomic<AZStd::sys_time_t> m_frameTimeThresholdTicks{ 0 };
+        AZStd::atomic<AZStd::sys_time_t> m_frameTicks{ 0 };
+        AZStd::atomic<AZStd::sys_time_t> m_lastFrameTicks{ 0 };
+
+        AZStd::atomic<AZ::u64> m_frameCycles{ 0 };
+        AZStd::atomic<AZ::u64> m_frameInstructions{ 0 };
+        AZStd::atomic<AZ::u64> m_frameCacheMisses{ 0 };
+        AZStd::atomic<AZ::u64> m_frameBranchMisses{ 0 };
+        HardwareCounterValues m_lastFrameCounters;
     };
 
+    namespace
+    {
+        struct OpenBudgetRegion
+        {
+            const Budget* m_budget;
+            AZStd::sys_time_t m_startTick;
+            bool m_hasCounters;
+            HardwareCounterValues m_startCounters;
+        };
+
+        AZStd::atomic_bool s_hardwareCountersEnabled{ false };
+
+        // Regions of tracked budgets that are open on the calling thread, outermost first. Regions that are deeper than the
+        // capacity aren't tracked.
+        thread_local AZStd::fixed_vector<OpenBudgetRegion, 64> s_openBudgetRegions;
+
+        AZStd::sys_time_t MicrosecondsToTicks(AZStd::chrono::microseconds time)
+        {
+            return time.count() * AZStd::GetTimeTicksPerSecond() / 1000000;
+        }
+
+        AZStd::chrono::microseconds TicksToMicroseconds(AZStd::sys_time_t ticks)
+        {
+            return AZStd::chrono::microseconds(ticks * 1000000 / AZStd::GetTimeTicksPerSecond());
+        }
+    } // namespace
+
     Budget::Budget(const char* name)
         : Budget( name, Crc32(name) )
     {
@@ -54,20 +95,97 @@ namespace AZ::Debug
         }
     }
 
-    // TODO:Budgets Methods below are stubbed pending future work to both update budget data and visualize it
-
     void Budget::PerFrameReset()
     {
+        m_impl->m_lastFrameTicks.store(m_impl->m_frameTicks.exchange(0, AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+        m_impl->m_lastFrameCounters.m_cycles = m_impl->m_frameCycles.exchange(0, AZStd::memory_order_relaxed);
+        m_impl->m_lastFrameCounters.m_instructions = m_impl->m_frameInstructions.exchange(0, AZStd::memory_order_relaxed);
+        m_impl->m_lastFrameCounters.m_cacheMisses = m_impl->m_frameCacheMisses.exchange(0, AZStd::memory_order_relaxed);
+        m_impl->m_lastFrameCounters.m_branchMisses = m_impl->m_frameBranchMisses.exchange(0, AZStd::memory_order_relaxed);
     }
 
     void Budget::BeginProfileRegion()
     {
+        if (m_impl->m_frameTimeThresholdTicks.load(AZStd::memory_order_relaxed) == 0 || s_openBudgetRegions.full())
+        {
+            return;
+        }
+        // Only the outermost region of the budget reads the counters, as nested regions aren't counted.
+        bool isOutermost = true;
+        for (const OpenBudgetRegion& outerRegion : s_openBudgetRegions)
+        {
+            isOutermost = isOutermost && outerRegion.m_budget != this;
+        }
+
+        OpenBudgetRegion& region = s_openBudgetRegions.emplace_back();
+        region.m_budget = this;
+        region.m_hasCounters = isOutermost && s_hardwareCountersEnabled.load(AZStd::memory_order_relaxed) &&
+            Platform::ReadThreadHardwareCounters(region.m_startCounters);
+        region.m_startTick = AZStd::GetTimeNowTicks();
     }
 
     void Budget::EndProfileRegion()
     {
+        if (s_openBudgetRegions.empty() || s_openBudgetRegions.back().m_budget != this)
+        {
+            return;
+        }
+
+        const AZStd::sys_time_t endTick = AZStd::GetTimeNowTicks();
+        const OpenBudgetRegion region = s_openBudgetRegions.back();
+        s_openBudgetRegions.pop_back();
+        for (const OpenBudgetRegion& outerRegion : s_openBudgetRegions)
+        {
+            if (outerRegion.m_budget == this)
+            {
+                // The outer region of the budget covers this one.
+                return;
+            }
+        }
+        m_impl->m_frameTicks.fetch_add(endTick - region.m_startTick, AZStd::memory_order_relaxed);
+
+        if (HardwareCounterValues endCounters; region.m_hasCounters && Platform::ReadThreadHardwareCounters(endCounters))
+        {
+            const HardwareCounterValues counters = endCounters - region.m_startCounters;
+            m_impl->m_frameCycles.fetch_add(counters.m_cycles, AZStd::memory_order_relaxed);
+            m_impl->m_frameInstructions.fetch_add(counters.m_instructions, AZStd::memory_order_relaxed);
+            m_impl->m_frameCacheMisses.fetch_add(counters.m_cacheMisses, AZStd::memory_order_relaxed);
+            m_impl->m_frameBranchMisses.fetch_add(counters.m_branchMisses, AZStd::memory_order_relaxed);
+        }
+    }
+
+    void Budget::SetFrameTimeThreshold(AZStd::chrono::microseconds threshold)
+    {
+        m_impl->m_frameTimeThresholdTicks.store(AZStd::max<AZStd::sys_time_t>(MicrosecondsToTicks(threshold), 0));
+    }
+
+    AZStd::chrono::microseconds Budget::GetFrameTimeThreshold() const
+    {
+        return TicksToMicroseconds(m_impl->m_frameTimeThresholdTicks.load(AZStd::memory_order_relaxed));
+    }
+
+    AZStd::chrono::microseconds Budget::GetLastFrameTime() const
+    {
+        return TicksToMicroseconds(m_impl->m_lastFrameTicks.load(AZStd::memory_order_relaxed));
+    }
+
+    void Budget::SetHardwareCountersEnabled(bool enabled)
+    {
+        s_hardwareCountersEnabled.store(enabled);
+    }
+
+    bool Budget::AreHardwareCountersEnabled()
+    {
+        return s_hardwareCountersEnabled.load(AZStd::memory_order_relaxed);
+    }
+
+    HardwareCounterValues Budget::GetLastFrameHardwareCounters() const
+    {
+        return m_impl->m_lastFrameCounters;
     }
 
+    // TODO:Budgets Methods below are stubbed pending future work to both update budget data and visualize it
+
     void Budget::TrackAllocation(uint64_t)
     {
     }
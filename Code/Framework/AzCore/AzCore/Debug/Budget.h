@@ -8,7 +8,9 @@
 #pragma once
 
 #include <AzCore/Debug/BudgetTracker.h>
+#include <AzCore/Debug/HardwareCounters.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/std/chrono/chrono.h>
 
 namespace AZ::Debug
 {
@@ -26,6 +28,25 @@ namespace AZ::Debug
         void TrackAllocation(uint64_t bytes);
         void UntrackAllocation(uint64_t bytes);
 
+        //! Budgets with a frame time threshold track the wall time spent in their profile regions, summed over all threads.
+        //! Nested regions of the same budget on a thread are only counted once. A threshold of 0, the default, disables the
+        //! tracking. Changing the threshold while regions of the budget are open can misattribute the time of that frame.
+        void SetFrameTimeThreshold(AZStd::chrono::microseconds threshold);
+        AZStd::chrono::microseconds GetFrameTimeThreshold() const;
+
+        //! Returns the time tracked for the frame that ended with the last call to PerFrameReset. Regions are counted in the
+        //! frame they end in.
+        AZStd::chrono::microseconds GetLastFrameTime() const;
+
+        //! Enables reading the CPU hardware counters of the thread around the tracked regions of all budgets with a frame
+        //! time threshold. Reading the counters is a system call on most platforms, so this is disabled by default.
+        static void SetHardwareCountersEnabled(bool enabled);
+        static bool AreHardwareCountersEnabled();
+
+        //! Returns the hardware counters measured in the tracked regions during the frame that ended with the last call to
+        //! PerFrameReset. Only valid on the thread that calls PerFrameReset.
+        HardwareCounterValues GetLastFrameHardwareCounters() const;
+
         const char* Name() const
         {
             return m_name;
@@ -14,6 +14,7 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/function/function_template.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 
 namespace AZ::Debug
@@ -75,4 +76,17 @@ namespace AZ::Debug
         auto iter = m_impl->m_budgets.try_emplace(budgetName, budgetName, crc).first;
         extBudgetRef = &iter->second;
     }
+
+    void BudgetTracker::VisitBudgets(const AZStd::function<void(Budget&)>& visitor)
+    {
+        AZStd::scoped_lock lock{ m_mutex };
+
+        if (m_impl)
+        {
+            for (auto& [budgetName, budget] : m_impl->m_budgets)
+            {
+                visitor(budget);
+            }
+        }
+    }
 } // namespace AZ::Debug
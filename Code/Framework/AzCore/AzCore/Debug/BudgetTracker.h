@@ -10,6 +10,7 @@
 
 #include <AzCore/Module/Environment.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/function/function_fwd.h>
 #include <AzCore/std/parallel/mutex.h>
 
 namespace AZ::Debug
@@ -30,6 +31,9 @@ namespace AZ::Debug
 
         void GetBudget(Budget*& extBudgetRef, const char* budgetName, uint32_t crc);
 
+        //! Calls the visitor for every budget that was created so far. Budgets can't be created from inside the visitor.
+        void VisitBudgets(const AZStd::function<void(Budget&)>& visitor);
+
     private:
         struct BudgetTrackerImpl;
 
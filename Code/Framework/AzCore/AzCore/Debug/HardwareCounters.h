@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Debug
+{
+    //! Values of the CPU hardware counters of a thread, or the difference between two reads of them.
+    struct HardwareCounterValues
+    {
+        AZ::u64 m_cycles = 0;
+        AZ::u64 m_instructions = 0;
+        AZ::u64 m_cacheMisses = 0;
+        AZ::u64 m_branchMisses = 0;
+
+        HardwareCounterValues operator-(const HardwareCounterValues& rhs) const
+        {
+            return { m_cycles - rhs.m_cycles, m_instructions - rhs.m_instructions, m_cacheMisses - rhs.m_cacheMisses,
+                     m_branchMisses - rhs.m_branchMisses };
+        }
+
+        HardwareCounterValues& operator+=(const HardwareCounterValues& rhs)
+        {
+            m_cycles += rhs.m_cycles;
+            m_instructions += rhs.m_instructions;
+            m_cacheMisses += rhs.m_cacheMisses;
+            m_branchMisses += rhs.m_branchMisses;
+            return *this;
+        }
+
+        double GetInstructionsPerCycle() const
+        {
+            return m_cycles != 0 ? static_cast<double>(m_instructions) / static_cast<double>(m_cycles) : 0.0;
+        }
+    };
+
+    namespace Platform
+    {
+        //! Reads the hardware counters of the calling thread, which are opened by the first read on every thread.
+        //! Returns false if the platform or the system doesn't give access to the counters, for instance on Linux when
+        //! /proc/sys/kernel/perf_event_paranoid doesn't allow user space profiling.
+        //! @note A read is a system call on most platforms, so it's too expensive for fine grained regions.
+        bool ReadThreadHardwareCounters(HardwareCounterValues& values);
+    } // namespace Platform
+} // namespace AZ::Debug
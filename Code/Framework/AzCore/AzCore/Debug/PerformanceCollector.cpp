@@ -12,6 +12,9 @@
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/Date/DateFormat.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
 
 #include "PerformanceCollector.h"
 
@@ -31,6 +34,7 @@ namespace AZ::Debug
         {
             [[maybe_unused]] const auto statisticPtr = m_statisticsManager.AddStatistic(metricName, metricName, "us");
             AZ_Assert(statisticPtr, "Failed to add metric with name <%.*s>. Maybe already added?", AZ_STRING_ARG(metricName));
+            m_histograms.emplace(metricName, SampleHistogram{});
         }
         RestartPeriodicEventStamps();
     }
@@ -85,6 +89,11 @@ namespace AZ::Debug
             //It is time to write the statistical summaries to the Log file.
             RecordStatistics();
             m_statisticsManager.ResetAllStatistics();
+            for (auto& [metricName, histogram] : m_histograms)
+            {
+                histogram.Reset();
+            }
+            m_hardwareCounterSums.clear();
         }
         RestartPeriodicEventStamps();
 
@@ -98,18 +107,47 @@ namespace AZ::Debug
 
     }
 
-    void PerformanceCollector::RecordSample(AZStd::string_view metricName, AZStd::chrono::microseconds microSeconds)
+    void PerformanceCollector::RecordSample(
+        AZStd::string_view metricName,
+        AZStd::chrono::microseconds microSeconds,
+        const HardwareCounterValues* hardwareCounters)
     {
+        if (!m_hardwareCountersEnabled)
+        {
+            hardwareCounters = nullptr;
+        }
+
         if (m_dataLogType == DataLogType::LogStatistics)
         {
             m_statisticsManager.PushSampleForStatistic(metricName, aznumeric_caster(microSeconds.count()));
+            if (auto histogramIt = m_histograms.find(metricName); histogramIt != m_histograms.end())
+            {
+                histogramIt->second.PushSample(aznumeric_cast<AZ::u64>(AZStd::max<long long>(microSeconds.count(), 0)));
+            }
+            if (hardwareCounters)
+            {
+                HardwareCounterSums& counterSums = m_hardwareCounterSums[metricName];
+                counterSums.m_sums += *hardwareCounters;
+                ++counterSums.m_sampleCount;
+            }
         }
         else
         {
+            using EventObjectStorage = AZStd::fixed_vector<AZ::Metrics::EventField, 4>;
+            EventObjectStorage counterParams;
+            if (hardwareCounters)
+            {
+                counterParams.emplace_back(IPC, hardwareCounters->GetInstructionsPerCycle());
+                counterParams.emplace_back(INSTRUCTIONS, hardwareCounters->m_instructions);
+                counterParams.emplace_back(CACHE_MISSES, hardwareCounters->m_cacheMisses);
+                counterParams.emplace_back(BRANCH_MISSES, hardwareCounters->m_branchMisses);
+            }
+
             Metrics::CompleteArgs completeArgs;
             completeArgs.m_name = metricName;
             completeArgs.m_cat = m_logCategory;
             completeArgs.m_dur = microSeconds;
+            completeArgs.m_args = counterParams;
             m_eventLogger.RecordCompleteEvent(completeArgs);
         }
     }
@@ -138,7 +176,7 @@ namespace AZ::Debug
         AZ_Warning(LogName, !statistics.empty(), "There are no statistics to report.");
         for (const auto statistic : statistics)
         {
-            using EventObjectStorage = AZStd::fixed_vector<AZ::Metrics::EventField, 8>;
+            using EventObjectStorage = AZStd::fixed_vector<AZ::Metrics::EventField, 14>;
             EventObjectStorage statisticalParams;
             statisticalParams.emplace_back(AVG, statistic->GetAverage());
             statisticalParams.emplace_back(MIN, statistic->GetMinimum());
@@ -148,6 +186,21 @@ namespace AZ::Debug
             statisticalParams.emplace_back(VARIANCE, statistic->GetVariance());
             statisticalParams.emplace_back(STDEV, statistic->GetStdev());
             statisticalParams.emplace_back(MOST_RECENT_SAMPLE, statistic->GetMostRecentSample());
+            if (auto histogramIt = m_histograms.find(statistic->GetName()); histogramIt != m_histograms.end())
+            {
+                statisticalParams.emplace_back(P50, histogramIt->second.GetPercentile(0.5));
+                statisticalParams.emplace_back(P99, histogramIt->second.GetPercentile(0.99));
+            }
+            if (auto countersIt = m_hardwareCounterSums.find(statistic->GetName());
+                countersIt != m_hardwareCounterSums.end() && countersIt->second.m_sampleCount > 0)
+            {
+                const HardwareCounterValues& sums = countersIt->second.m_sums;
+                const double sampleCount = aznumeric_cast<double>(countersIt->second.m_sampleCount);
+                statisticalParams.emplace_back(IPC, sums.GetInstructionsPerCycle());
+                statisticalParams.emplace_back(INSTRUCTIONS, aznumeric_cast<double>(sums.m_instructions) / sampleCount);
+                statisticalParams.emplace_back(CACHE_MISSES, aznumeric_cast<double>(sums.m_cacheMisses) / sampleCount);
+                statisticalParams.emplace_back(BRANCH_MISSES, aznumeric_cast<double>(sums.m_branchMisses) / sampleCount);
+            }
 
             Metrics::CompleteArgs completeArgs;
             completeArgs.m_name = statistic->GetName();
@@ -217,6 +270,26 @@ namespace AZ::Debug
         m_waitTimeBeforeEachBatch = seconds;
     }
 
+    void PerformanceCollector::UpdateHardwareCountersEnabled(bool enabled)
+    {
+        if (m_hardwareCountersEnabled == enabled)
+        {
+            return;
+        }
+
+        if (m_numberOfCaptureBatches > 0)
+        {
+            AZ_Warning(LogName, false, "%s changes to control params are rejected while data is being captured.", __FUNCTION__);
+            return;
+        }
+
+        if (HardwareCounterValues counters; enabled && !Platform::ReadThreadHardwareCounters(counters))
+        {
+            AZ_Warning(LogName, false, "Hardware counters aren't available on this system, only durations will be reported.");
+        }
+        m_hardwareCountersEnabled = enabled;
+    }
+
     void PerformanceCollector::UpdateNumberOfCaptureBatches(AZ::u32 newValue)
     {
         if (m_numberOfCaptureBatches == newValue)
@@ -258,4 +331,59 @@ namespace AZ::Debug
         }
     }
 
+    size_t PerformanceCollector::SampleHistogram::GetBucketIndex(AZ::u64 value)
+    {
+        if (value < SubBucketCount)
+        {
+            return aznumeric_cast<size_t>(value);
+        }
+        // The top 3 bits of the value select the bucket within its power of two range.
+        const AZ::u32 exponent = AZ::Log2(value) - 1;
+        const AZ::u64 subBucket = (value >> (exponent - 3)) & (SubBucketCount - 1);
+        return (exponent - 2) * SubBucketCount + aznumeric_cast<size_t>(subBucket);
+    }
+
+    void PerformanceCollector::SampleHistogram::PushSample(AZ::u64 value)
+    {
+        ++m_buckets[GetBucketIndex(value)];
+        ++m_sampleCount;
+    }
+
+    double PerformanceCollector::SampleHistogram::GetPercentile(double fraction) const
+    {
+        if (m_sampleCount == 0)
+        {
+            return 0.0;
+        }
+
+        const double samples = aznumeric_cast<double>(m_sampleCount);
+        const AZ::u64 rank = AZStd::max<AZ::u64>(1, aznumeric_cast<AZ::u64>(AZStd::ceil(fraction * samples)));
+        AZ::u64 count = 0;
+        for (size_t bucketIndex = 0; bucketIndex < BucketCount; ++bucketIndex)
+        {
+            count += m_buckets[bucketIndex];
+            if (count < rank)
+            {
+                continue;
+            }
+
+            if (bucketIndex < SubBucketCount)
+            {
+                return aznumeric_cast<double>(bucketIndex);
+            }
+            // Report the middle of the bucket.
+            const size_t exponent = bucketIndex / SubBucketCount + 2;
+            const AZ::u64 lowerBound = (SubBucketCount + bucketIndex % SubBucketCount) << (exponent - 3);
+            const AZ::u64 width = AZ::u64{ 1 } << (exponent - 3);
+            return aznumeric_cast<double>(lowerBound) + aznumeric_cast<double>(width) * 0.5;
+        }
+        return 0.0;
+    }
+
+    void PerformanceCollector::SampleHistogram::Reset()
+    {
+        m_buckets.fill(0);
+        m_sampleCount = 0;
+    }
+
 } //namespace AZ::Debug
@@ -7,10 +7,13 @@
  */
 #pragma once
 
+#include <AzCore/Debug/HardwareCounters.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Metrics/JsonTraceEventLogger.h>
 #include <AzCore/Statistics/StatisticsManager.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
 
 namespace AZ::Debug
 {
@@ -33,6 +36,13 @@ namespace AZ::Debug
         static constexpr AZStd::string_view VARIANCE = "variance";
         static constexpr AZStd::string_view STDEV = "stdev";
         static constexpr AZStd::string_view MOST_RECENT_SAMPLE = "mostRecentSampleValue";
+        static constexpr AZStd::string_view P50 = "p50";
+        static constexpr AZStd::string_view P99 = "p99";
+        //! Properties added when hardware counters are enabled and available. Counts are averages per sample.
+        static constexpr AZStd::string_view IPC = "ipc";
+        static constexpr AZStd::string_view INSTRUCTIONS = "instructions";
+        static constexpr AZStd::string_view CACHE_MISSES = "cacheMisses";
+        static constexpr AZStd::string_view BRANCH_MISSES = "branchMisses";
 
         //! Function signature for the notification callback that will be dispatched
         //! each time a batch of frames are measured.
@@ -68,7 +78,12 @@ namespace AZ::Debug
         bool IsWaitingBeforeCapture();
 
         //! Records a measured value according to the current CaptureType.
-        void RecordSample(AZStd::string_view metricName, AZStd::chrono::microseconds microSeconds);
+        //! @param hardwareCounters Optional hardware counter deltas measured over the same time, which are reported with the
+        //!                         sample if hardware counters are enabled.
+        void RecordSample(
+            AZStd::string_view metricName,
+            AZStd::chrono::microseconds microSeconds,
+            const HardwareCounterValues* hardwareCounters = nullptr);
 
         //! This is similar to RecordSample(). Captures the elapsed time between
         //! two consecutive calls to this function for any given @metricName.
@@ -95,6 +110,13 @@ namespace AZ::Debug
         //! is already in effect.
         void UpdateWaitTimeBeforeEachBatch(AZStd::chrono::seconds seconds);
 
+        //! Enables measuring the CPU hardware counters of the thread in ScopeDuration, and reporting the counters passed to
+        //! RecordSample. Counters are only reported on platforms that give access to them, see ReadThreadHardwareCounters.
+        //! This function logs a warning and does nothing if a set of performance capture batches
+        //! is already in effect.
+        void UpdateHardwareCountersEnabled(bool enabled);
+        bool AreHardwareCountersEnabled() const { return m_hardwareCountersEnabled; }
+
         //! Calling this one with newValue > 0 will trigger json file creation
         //! and performance capture for as many batches.
         void UpdateNumberOfCaptureBatches(AZ::u32 newValue);
@@ -105,6 +127,28 @@ namespace AZ::Debug
 
         const AZStd::string& GetFileExtension() const { return m_fileExtension; }
 
+        //! Log-linear histogram of the samples of a metric, used to report percentiles with bounded memory.
+        //! Values below 8 have their own bucket, and every larger power of two range is split into 8 buckets, so the
+        //! reported percentiles are within 6.25% of the actual values.
+        class SampleHistogram
+        {
+        public:
+            void PushSample(AZ::u64 value);
+            //! Returns the estimated value below which the given fraction of the samples fall, or 0 without samples.
+            double GetPercentile(double fraction) const;
+            AZ::u64 GetSampleCount() const { return m_sampleCount; }
+            void Reset();
+
+        private:
+            static constexpr size_t SubBucketCount = 8;
+            static constexpr size_t BucketCount = SubBucketCount * 63;
+
+            static size_t GetBucketIndex(AZ::u64 value);
+
+            AZStd::array<AZ::u32, BucketCount> m_buckets{};
+            AZ::u64 m_sampleCount = 0;
+        };
+
     private:
         //! A helper function that loops across all statistics in @m_statisticsManager
         //! and reports each result into @m_eventLogger.
@@ -129,6 +173,16 @@ namespace AZ::Debug
 
         //! Only used when @m_captureType == CaptureType::LogStatistics.
         AZ::Statistics::StatisticsManager<AZStd::string> m_statisticsManager;
+        AZStd::unordered_map<AZStd::string, SampleHistogram> m_histograms;
+
+        //! Sums of the hardware counters recorded for a metric in the current batch.
+        struct HardwareCounterSums
+        {
+            HardwareCounterValues m_sums;
+            AZ::u64 m_sampleCount = 0;
+        };
+        AZStd::unordered_map<AZStd::string, HardwareCounterSums> m_hardwareCounterSums;
+        bool m_hardwareCountersEnabled = false;
 
         //! Only used to store the previous value when RecordPeriodicEvent() is called
         //! for any given metrics.
@@ -161,6 +215,8 @@ namespace AZ::Debug
             m_pushSample = !performanceCollector->IsWaitingBeforeCapture();
             if (m_pushSample)
             {
+                m_hasCounters = performanceCollector->AreHardwareCountersEnabled() &&
+                    Platform::ReadThreadHardwareCounters(m_startCounters);
                 m_startTime = AZStd::chrono::steady_clock::now();
             }
         }
@@ -174,11 +230,22 @@ namespace AZ::Debug
             }
             AZStd::chrono::steady_clock::time_point stopTime = AZStd::chrono::steady_clock::now();
             auto duration = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(stopTime - m_startTime);
-            m_performanceCollector->RecordSample(m_metricName, duration);
+            HardwareCounterValues stopCounters;
+            if (m_hasCounters && Platform::ReadThreadHardwareCounters(stopCounters))
+            {
+                const HardwareCounterValues counters = stopCounters - m_startCounters;
+                m_performanceCollector->RecordSample(m_metricName, duration, &counters);
+            }
+            else
+            {
+                m_performanceCollector->RecordSample(m_metricName, duration);
+            }
         }
 
     private:
         bool m_pushSample;
+        bool m_hasCounters = false;
+        HardwareCounterValues m_startCounters;
         PerformanceCollector* m_performanceCollector;
         const AZStd::string_view m_metricName;
         AZStd::chrono::steady_clock::time_point m_startTime;
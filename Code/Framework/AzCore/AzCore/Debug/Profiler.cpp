@@ -10,6 +10,8 @@
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Memory/AllocatorManager.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/time.h>
 
@@ -54,6 +56,22 @@ namespace AZ::Debug
     }
     AZ_CONSOLEFREEFUNC(ProfilerEndCapture, AZ::ConsoleFunctorFlags::DontReplicate, "End and dump an in-progress continuous capture");
 
+    void ProfilerCaptureAllocationSamples([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZStd::string captureFile = GenerateOutputFile("allocations");
+        AZ::IO::SystemFileStream stream(captureFile.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath);
+        if (stream.IsOpen() && AZ::AllocatorManager::Instance().WriteAllocationSamples(stream))
+        {
+            AZLOG_INFO("Wrote allocation samples to %s", captureFile.c_str());
+        }
+        else
+        {
+            AZLOG_ERROR("Failed to write allocation samples to %s", captureFile.c_str());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(ProfilerCaptureAllocationSamples, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Write the live allocation samples of the allocators recording in sampled mode");
+
     AZ::IO::FixedMaxPathString GetProfilerCaptureLocation()
     {
         AZ::IO::FixedMaxPathString captureOutput;
@@ -77,6 +77,19 @@ namespace AZ::Debug
         virtual void BeginRegion(const Budget* budget, const char* eventName, size_t eventNameArgCount, ...) = 0;
         virtual void EndRegion(const Budget* budget) = 0;
 
+        //! Records a region that was measured outside of the scopes of the calling thread, for example on the GPU.
+        //! The regions of each @trackName are presented like the regions of a separate thread.
+        //! The ticks use the time base of AZStd::GetTimeNowTicks(). Profilers without support for tracks ignore these regions.
+        virtual void RecordTrackRegion(
+            [[maybe_unused]] const Budget* budget,
+            [[maybe_unused]] const char* trackName,
+            [[maybe_unused]] const char* eventName,
+            [[maybe_unused]] AZ::s64 startTick,
+            [[maybe_unused]] AZ::s64 endTick,
+            [[maybe_unused]] AZ::u16 stackDepth)
+        {
+        }
+
         template<typename T>
         static void ReportCounter(const Budget* budget, const wchar_t* counterName, const T& value);
         static void ReportProfileEvent(const Budget* budget, const char* eventName);
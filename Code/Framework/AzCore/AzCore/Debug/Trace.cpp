@@ -11,6 +11,7 @@
 #include <AzCore/base.h>
 
 #include <AzCore/Debug/StackTracer.h>
+#include <AzCore/Debug/TraceAsyncOutput.h>
 #include <AzCore/Debug/TraceMessageBus.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Settings/SettingsRegistry.h>
@@ -68,6 +69,10 @@ namespace AZ::Debug
     static AZ::EnvironmentVariable<int> g_assertVerbosityLevel;
     static AZ::EnvironmentVariable<int> g_logVerbosityLevel;
 
+    // Environment var shared by all modules that queues trace output for a background thread when bg_traceAsyncOutput is set
+    static const char* asyncOutputUID = "TraceAsyncOutput";
+    static AZ::EnvironmentVariable<TraceAsyncOutput> g_asyncOutput;
+
     static AZ::EnvironmentVariable<bool> s_AssertsAutoBreak;
     AZ_CVAR(
         bool,
@@ -87,8 +92,41 @@ namespace AZ::Debug
         Debug::ITrace::Instance().SetAlwaysPrintCallstack(enable);
     }
 
+    static void AsyncOutputChanged(const bool& enable)
+    {
+        if (g_asyncOutput)
+        {
+            g_asyncOutput->SetEnabled(enable);
+        }
+    }
+
+    static void AsyncOutputMaxMessagesPerSecondChanged(const int& maxMessagesPerSecond)
+    {
+        if (g_asyncOutput)
+        {
+            g_asyncOutput->SetMaxMessagesPerSecond(static_cast<AZ::u32>(AZStd::max(maxMessagesPerSecond, 0)));
+        }
+    }
+
+    static void AsyncOutputWarningDedupChanged(const int& intervalMs)
+    {
+        if (g_asyncOutput)
+        {
+            g_asyncOutput->SetWarningDedupInterval(AZStd::chrono::milliseconds(intervalMs));
+        }
+    }
+
     AZ_CVAR_SCOPED(int, bg_traceLogLevel, static_cast<int>(LogLevel::Info), &TraceLevelChanged, ConsoleFunctorFlags::Null, "Enable trace message logging in release mode.  0=disabled, 1=errors, 2=warnings, 3=info, 4=debug, 5=trace.");
     AZ_CVAR_SCOPED(bool, bg_alwaysShowCallstack, false, &AlwaysShowCallstackChanged, ConsoleFunctorFlags::Null, "Force stack trace output without allowing ebus interception.");
+    AZ_CVAR_SCOPED(bool, bg_traceAsyncOutput, false, &AsyncOutputChanged, ConsoleFunctorFlags::Null,
+        "Queue trace output and write it to the trace handlers and the raw output stream from a background thread,"
+        " so logging threads don't wait on file loggers. The queue is flushed before asserts break and when the application crashes.");
+    AZ_CVAR_SCOPED(int, bg_traceAsyncMaxMessagesPerSecond, 0, &AsyncOutputMaxMessagesPerSecondChanged, ConsoleFunctorFlags::Null,
+        "Maximum number of trace messages queued per second when bg_traceAsyncOutput is enabled."
+        " Messages over the limit are dropped and counted. 0=unlimited.");
+    AZ_CVAR_SCOPED(int, bg_traceAsyncWarningDedupMs, 1000, &AsyncOutputWarningDedupChanged, ConsoleFunctorFlags::Null,
+        "When bg_traceAsyncOutput is enabled, warnings identical to one output less than this many milliseconds ago are counted"
+        " instead of output. 0=disabled.");
 
     // Allow redirection of trace raw output writes to stdout, stderr or to /dev/null
     static constexpr const char* fileStreamIdentifier = "raw_c_stream";
@@ -121,6 +159,10 @@ namespace AZ::Debug
         " Valid values are 0 = stdout, 1 = stderr, 2 = redirect to NUL");
 
 
+    // Writes a message to the debugger, the trace message handlers and the raw output stream.
+    // This is the synchronous part of Trace::Output, which the async output calls from its background thread.
+    static void OutputToSinks(const char* window, const char* message);
+
     /**
      * If any listener returns true, store the result so we don't outputs detailed information.
      */
@@ -149,6 +191,28 @@ namespace AZ::Debug
             g_logVerbosityLevel.Set(logLevel_full);
         }
 
+        g_asyncOutput = AZ::Environment::FindVariable<TraceAsyncOutput>(asyncOutputUID);
+        if (!g_asyncOutput)
+        {
+            g_asyncOutput = AZ::Environment::CreateVariable<TraceAsyncOutput>(asyncOutputUID, &OutputToSinks);
+            if (auto console = AZ::Interface<AZ::IConsole>::Get(); console != nullptr)
+            {
+                if (int maxMessagesPerSecond = 0;
+                    console->GetCvarValue("bg_traceAsyncMaxMessagesPerSecond", maxMessagesPerSecond) == AZ::GetValueResult::Success)
+                {
+                    AsyncOutputMaxMessagesPerSecondChanged(maxMessagesPerSecond);
+                }
+                if (int warningDedupMs = 0; console->GetCvarValue("bg_traceAsyncWarningDedupMs", warningDedupMs) == AZ::GetValueResult::Success)
+                {
+                    AsyncOutputWarningDedupChanged(warningDedupMs);
+                }
+                if (bool asyncOutput = false; console->GetCvarValue("bg_traceAsyncOutput", asyncOutput) == AZ::GetValueResult::Success)
+                {
+                    AsyncOutputChanged(asyncOutput);
+                }
+            }
+        }
+
         // Setup the raw C FILE* pointer to allow raw output to write to one of the std streams
         s_fileStream = AZ::Environment::FindVariable<FILE*>(fileStreamIdentifier);
         if (!s_fileStream)
@@ -181,6 +245,13 @@ namespace AZ::Debug
     // clean up the ignored assert container
     void Trace::Destroy()
     {
+        if (g_asyncOutput && g_asyncOutput.IsOwner())
+        {
+            // Stops the background thread, which can't outlive the module that owns the code it runs
+            g_asyncOutput->SetEnabled(false);
+            g_asyncOutput.Reset();
+        }
+
         g_ignoredAsserts = AZ::Environment::FindVariable<AZStd::unordered_set<size_t>>(ignoredAssertUID);
         if (g_ignoredAsserts)
         {
@@ -279,6 +350,7 @@ namespace AZ::Debug
             return; // Do not break when tests are running unless debugger is present
         }
 
+        FlushAsyncOutput();
         Platform::DebugBreak();
 
 #endif // AZ_ENABLE_DEBUG_TOOLS
@@ -286,6 +358,7 @@ namespace AZ::Debug
 
     void Debug::Trace::Crash()
     {
+        FlushAsyncOutput();
         int* p = nullptr;
         *p = 1;
     }
@@ -294,9 +367,18 @@ namespace AZ::Debug
     {
         AZ_TracePrintf("Exit", "Called Terminate() with exit code: 0x%x", exitCode);
         Instance().PrintCallstack("Exit");
+        FlushAsyncOutput();
         Platform::Terminate(exitCode);
     }
 
+    void Debug::Trace::FlushAsyncOutput()
+    {
+        if (g_asyncOutput)
+        {
+            g_asyncOutput->Flush();
+        }
+    }
+
     //=========================================================================
     // Assert
     // [8/3/2009]
@@ -512,6 +594,12 @@ namespace AZ::Debug
         azvsnprintf(message, g_maxMessageLength - 1, format, mark); // -1 to make room for the "/n" that will be appended below
         va_end(mark);
 
+        AZ::u32 suppressedCount = 0;
+        if (g_asyncOutput && g_asyncOutput->SuppressRepeatedWarning(fileName, line, message, suppressedCount))
+        {
+            return;
+        }
+
         TraceMessageResult result;
         TraceMessageBus::BroadcastResult(result, &TraceMessageBus::Events::OnPreWarning, window, fileName, line, funcName, message);
         if (result.m_value)
@@ -522,6 +610,11 @@ namespace AZ::Debug
         Output(window, "\n==================================================================\n");
         azsnprintf(header, g_maxMessageLength, "Trace::Warning\n %s(%d): '%s'\n", fileName, line, funcName);
         Output(window, header);
+        if (suppressedCount != 0)
+        {
+            azsnprintf(header, g_maxMessageLength, " (%u identical warnings were suppressed since this one was last output)\n", suppressedCount);
+            Output(window, header);
+        }
         azstrcat(message, g_maxMessageLength, "\n");
         Output(window, message);
 
@@ -569,6 +662,23 @@ namespace AZ::Debug
             window = g_dbgSystemWnd;
         }
 
+        if (g_asyncOutput)
+        {
+            // Output made while handling an exception is never queued, as the background thread may not get to run again
+            if (!DebugInternal::g_suppressEBusCalls && g_asyncOutput->Push(window, message) != TraceAsyncOutput::PushResult::Rejected)
+            {
+                return;
+            }
+
+            // Writes the queued messages first to keep the output in order
+            g_asyncOutput->Flush();
+        }
+
+        OutputToSinks(window, message);
+    }
+
+    static void OutputToSinks(const char* window, const char* message)
+    {
         Platform::OutputToDebugger(window, message);
 
         if (!DebugInternal::g_suppressEBusCalls)
@@ -584,7 +694,7 @@ namespace AZ::Debug
             }
         }
 
-        RawOutput(window, message);
+        ITrace::Instance().RawOutput(window, message);
     }
 
     void Trace::RawOutput(const char* window, const char* message)
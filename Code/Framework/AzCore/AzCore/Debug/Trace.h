@@ -163,6 +163,10 @@ namespace AZ
             /// Terminates the process with the specified exit code
             static void Terminate(int exitCode);
 
+            /// Writes the trace output that is queued while bg_traceAsyncOutput is enabled, on the calling thread.
+            /// Called before the application breaks, crashes or terminates, so that no queued message is lost.
+            static void FlushAsyncOutput();
+
             void Assert(const char* fileName, int line, const char* funcName, const char* format, ...) override;
             void Error(const char* fileName, int line, const char* funcName, const char* window, const char* format, ...) override;
             void Warning(const char* fileName, int line, const char* funcName, const char* window, const char* format, ...) override;
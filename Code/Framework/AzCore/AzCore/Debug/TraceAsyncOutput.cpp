@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/TraceAsyncOutput.h>
+
+#include <AzCore/std/hash.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::Debug
+{
+    namespace
+    {
+        // Set while a thread writes queued messages. Output made by the sinks on that thread is written synchronously,
+        // as queueing it could wait on a full ring that only this thread drains.
+        AZ_THREAD_LOCAL bool s_isDraining = false;
+
+        AZ::u64 GetTimeMs()
+        {
+            return AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(
+                AZStd::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        void CopyTruncated(char* destination, size_t destinationSize, const char* source)
+        {
+            const size_t length = AZStd::min(strlen(source), destinationSize - 1);
+            memcpy(destination, source, length);
+            destination[length] = '\0';
+        }
+    } // namespace
+
+    TraceAsyncOutput::TraceAsyncOutput(OutputFunction outputFunction, size_t capacity)
+        : m_outputFunction(outputFunction)
+    {
+        size_t slotCount = 2;
+        while (slotCount < capacity)
+        {
+            slotCount <<= 1;
+        }
+        m_mask = slotCount - 1;
+    }
+
+    TraceAsyncOutput::~TraceAsyncOutput()
+    {
+        SetEnabled(false);
+        Flush();
+    }
+
+    void TraceAsyncOutput::SetEnabled(bool enabled)
+    {
+        if (enabled && !m_slots)
+        {
+            // The ring is only allocated once the output is enabled, as most applications never enable it
+            m_slots = AZStd::make_unique<Slot[]>(m_mask + 1);
+            for (size_t i = 0; i <= m_mask; ++i)
+            {
+                m_slots[i].m_sequence.store(i, AZStd::memory_order_relaxed);
+            }
+        }
+
+        if (m_enabled.exchange(enabled) == enabled)
+        {
+            return;
+        }
+
+        if (enabled)
+        {
+            m_stopWriter = false;
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "Trace Async Output";
+            m_writerThread = AZStd::thread(threadDesc, [this]() { WriterLoop(); });
+        }
+        else
+        {
+            {
+                AZStd::scoped_lock lock(m_wakeMutex);
+                m_stopWriter = true;
+            }
+            m_wakeCondition.notify_one();
+            if (m_writerThread.joinable())
+            {
+                m_writerThread.join();
+            }
+            Flush();
+        }
+    }
+
+    bool TraceAsyncOutput::IsEnabled() const
+    {
+        return m_enabled.load(AZStd::memory_order_acquire);
+    }
+
+    void TraceAsyncOutput::SetMaxMessagesPerSecond(AZ::u32 maxMessagesPerSecond)
+    {
+        m_maxMessagesPerSecond = maxMessagesPerSecond;
+    }
+
+    void TraceAsyncOutput::SetWarningDedupInterval(AZStd::chrono::milliseconds interval)
+    {
+        m_warningDedupIntervalMs = static_cast<AZ::u64>(AZStd::max<AZStd::chrono::milliseconds::rep>(interval.count(), 0));
+    }
+
+    auto TraceAsyncOutput::Push(const char* window, const char* message) -> PushResult
+    {
+        if (!IsEnabled() || s_isDraining)
+        {
+            return PushResult::Rejected;
+        }
+
+        if (const AZ::u32 maxMessagesPerSecond = m_maxMessagesPerSecond.load(AZStd::memory_order_relaxed); maxMessagesPerSecond != 0)
+        {
+            const AZ::u64 nowMs = GetTimeMs();
+            AZ::u64 windowStartMs = m_rateWindowStartMs.load(AZStd::memory_order_relaxed);
+            if (nowMs - windowStartMs >= 1000 && m_rateWindowStartMs.compare_exchange_strong(windowStartMs, nowMs))
+            {
+                m_rateWindowCount = 0;
+            }
+            if (m_rateWindowCount.fetch_add(1, AZStd::memory_order_relaxed) >= maxMessagesPerSecond)
+            {
+                m_droppedCount.fetch_add(1, AZStd::memory_order_relaxed);
+                return PushResult::Dropped;
+            }
+        }
+
+        // Claims a slot by advancing the enqueue position past it. A slot is free for position p when its sequence is p,
+        // and holds a message for the consumer when its sequence is p + 1.
+        size_t position = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+        Slot* slot = nullptr;
+        for (;;)
+        {
+            slot = &m_slots[position & m_mask];
+            const size_t sequence = slot->m_sequence.load(AZStd::memory_order_acquire);
+            const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(position);
+            if (difference == 0)
+            {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1, AZStd::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // The ring is full.
+                return PushResult::Rejected;
+            }
+            else
+            {
+                position = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+            }
+        }
+
+        CopyTruncated(slot->m_window, MaxWindowLength, window);
+        CopyTruncated(slot->m_message, MaxMessageLength, message);
+        slot->m_sequence.store(position + 1, AZStd::memory_order_release);
+
+        if (m_writerWaiting.load(AZStd::memory_order_acquire))
+        {
+            m_wakeCondition.notify_one();
+        }
+        return PushResult::Queued;
+    }
+
+    void TraceAsyncOutput::Flush()
+    {
+        if (s_isDraining)
+        {
+            return;
+        }
+
+        while (PopAndOutput())
+        {
+        }
+        OutputDroppedCount();
+    }
+
+    bool TraceAsyncOutput::PopAndOutput()
+    {
+        // Checks for a queued message before locking, so flushing an empty ring is cheap on the synchronous output path.
+        if (!HasQueuedMessage())
+        {
+            return false;
+        }
+
+        AZStd::scoped_lock lock(m_drainMutex);
+
+        const size_t position = m_dequeuePosition.load(AZStd::memory_order_relaxed);
+        Slot& slot = m_slots[position & m_mask];
+        if (slot.m_sequence.load(AZStd::memory_order_acquire) != position + 1)
+        {
+            return false;
+        }
+
+        s_isDraining = true;
+        m_outputFunction(slot.m_window, slot.m_message);
+        s_isDraining = false;
+
+        // Frees the slot for the producer that wraps around to it.
+        slot.m_sequence.store(position + m_mask + 1, AZStd::memory_order_release);
+        m_dequeuePosition.store(position + 1, AZStd::memory_order_relaxed);
+        return true;
+    }
+
+    bool TraceAsyncOutput::HasQueuedMessage() const
+    {
+        if (!m_slots)
+        {
+            return false;
+        }
+
+        const size_t position = m_dequeuePosition.load(AZStd::memory_order_relaxed);
+        return m_slots[position & m_mask].m_sequence.load(AZStd::memory_order_acquire) == position + 1;
+    }
+
+    void TraceAsyncOutput::OutputDroppedCount()
+    {
+        if (m_droppedCount.load(AZStd::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+
+        AZStd::scoped_lock lock(m_drainMutex);
+        if (const AZ::u32 droppedCount = m_droppedCount.exchange(0); droppedCount != 0)
+        {
+            char message[128];
+            azsnprintf(message, AZ_ARRAY_SIZE(message), "%u trace messages were dropped by the output rate limit.\n", droppedCount);
+            s_isDraining = true;
+            m_outputFunction("TraceAsyncOutput", message);
+            s_isDraining = false;
+        }
+    }
+
+    void TraceAsyncOutput::WriterLoop()
+    {
+        // The writer waits for a bounded time, so a wake up that is missed between the checks below only delays the output.
+        constexpr auto MaxWaitTime = AZStd::chrono::milliseconds(10);
+
+        while (!m_stopWriter.load(AZStd::memory_order_acquire))
+        {
+            if (PopAndOutput())
+            {
+                continue;
+            }
+            OutputDroppedCount();
+
+            AZStd::unique_lock lock(m_wakeMutex);
+            m_writerWaiting.store(true, AZStd::memory_order_release);
+            if (!HasQueuedMessage() && !m_stopWriter)
+            {
+                m_wakeCondition.wait_for(lock, MaxWaitTime);
+            }
+            m_writerWaiting.store(false, AZStd::memory_order_relaxed);
+        }
+    }
+
+    bool TraceAsyncOutput::SuppressRepeatedWarning(const char* fileName, int line, const char* message, AZ::u32& suppressedCount)
+    {
+        suppressedCount = 0;
+        const AZ::u64 intervalMs = m_warningDedupIntervalMs.load(AZStd::memory_order_relaxed);
+        if (intervalMs == 0 || !IsEnabled())
+        {
+            return false;
+        }
+
+        size_t hash = AZStd::hash<AZStd::string_view>{}(fileName ? fileName : "");
+        AZStd::hash_combine(hash, line);
+        AZStd::hash_combine(hash, AZStd::string_view(message));
+
+        const AZ::u64 nowMs = GetTimeMs();
+        AZStd::scoped_lock lock(m_warningMutex);
+
+        WarningRecord* oldestRecord = &m_warningRecords[0];
+        for (WarningRecord& record : m_warningRecords)
+        {
+            if (record.m_hash == hash && record.m_lastOutputMs != 0)
+            {
+                if (nowMs - record.m_lastOutputMs < intervalMs)
+                {
+                    ++record.m_suppressedCount;
+                    return true;
+                }
+                suppressedCount = record.m_suppressedCount;
+                record.m_suppressedCount = 0;
+                record.m_lastOutputMs = nowMs;
+                return false;
+            }
+            if (record.m_lastOutputMs < oldestRecord->m_lastOutputMs)
+            {
+                oldestRecord = &record;
+            }
+        }
+
+        // The least recently output warning is forgotten, including how many times it was suppressed.
+        *oldestRecord = WarningRecord{ hash, nowMs, 0 };
+        return false;
+    }
+} // namespace AZ::Debug
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ::Debug
+{
+    //! Queues trace output so the threads that log don't wait on the output sinks, such as file loggers that flush.
+    //! Messages are copied into a bounded lock-free ring with multiple producers and a single consumer, and a background
+    //! thread writes them to the sinks in the order they were queued.
+    class TraceAsyncOutput
+    {
+    public:
+        using OutputFunction = void (*)(const char* window, const char* message);
+
+        static constexpr size_t MaxWindowLength = 128;
+        static constexpr size_t MaxMessageLength = 4096;
+        static constexpr size_t DefaultCapacity = 512;
+
+        enum class PushResult
+        {
+            Queued, //!< The message will be written by the background thread.
+            Dropped, //!< The message was discarded by the rate limit.
+            Rejected, //!< The caller has to write the message itself, after a Flush to keep the order of the output.
+        };
+
+        //! @param outputFunction writes a message to the output sinks, it's called on the background thread
+        //! @param capacity the number of messages the ring holds, rounded up to a power of two
+        TraceAsyncOutput(OutputFunction outputFunction, size_t capacity = DefaultCapacity);
+        ~TraceAsyncOutput();
+
+        //! Starts or stops the background thread. Queued messages are flushed when it's stopped.
+        void SetEnabled(bool enabled);
+        bool IsEnabled() const;
+
+        //! Limits the number of messages that are queued per second. Messages over the limit are counted and reported
+        //! in a single message once the background thread catches up. 0 disables the limit.
+        void SetMaxMessagesPerSecond(AZ::u32 maxMessagesPerSecond);
+
+        //! Warnings identical to one that was output less than this long ago are counted instead of output. 0 disables it.
+        void SetWarningDedupInterval(AZStd::chrono::milliseconds interval);
+
+        //! Queues a message for the background thread.
+        //! Messages are rejected when the output is disabled, when the ring is full and when called from the background
+        //! thread itself, for instance by a sink that reports an error.
+        PushResult Push(const char* window, const char* message);
+
+        //! Writes all the queued messages on the calling thread.
+        //! Called before writing output synchronously and when the application crashes, so no message is lost.
+        void Flush();
+
+        //! Counts a warning that is identical to one output less than the dedup interval ago, instead of outputting it.
+        //! @param suppressedCount if the warning isn't suppressed, set to the number of identical warnings that were
+        //!        suppressed since it was last output
+        //! @return true if the warning should be suppressed
+        bool SuppressRepeatedWarning(const char* fileName, int line, const char* message, AZ::u32& suppressedCount);
+
+    private:
+        struct Slot
+        {
+            AZStd::atomic<size_t> m_sequence{ 0 };
+            char m_window[MaxWindowLength];
+            char m_message[MaxMessageLength];
+        };
+
+        struct WarningRecord
+        {
+            size_t m_hash = 0;
+            AZ::u64 m_lastOutputMs = 0;
+            AZ::u32 m_suppressedCount = 0;
+        };
+
+        static constexpr size_t WarningRecordCount = 64;
+
+        bool HasQueuedMessage() const;
+        bool PopAndOutput();
+        void OutputDroppedCount();
+        void WriterLoop();
+
+        OutputFunction m_outputFunction;
+        AZStd::unique_ptr<Slot[]> m_slots;
+        size_t m_mask = 0;
+
+        // Producers only touch the enqueue position. The dequeue position is only changed while the drain mutex is held.
+        alignas(64) AZStd::atomic<size_t> m_enqueuePosition{ 0 };
+        alignas(64) AZStd::atomic<size_t> m_dequeuePosition{ 0 };
+
+        alignas(64) AZStd::atomic<AZ::u32> m_maxMessagesPerSecond{ 0 };
+        AZStd::atomic<AZ::u64> m_rateWindowStartMs{ 0 };
+        AZStd::atomic<AZ::u32> m_rateWindowCount{ 0 };
+        AZStd::atomic<AZ::u32> m_droppedCount{ 0 };
+
+        // Held while a message is popped and written, so Flush can drain the ring from any thread.
+        AZStd::mutex m_drainMutex;
+        AZStd::mutex m_wakeMutex;
+        AZStd::condition_variable m_wakeCondition;
+        AZStd::atomic_bool m_writerWaiting{ false };
+        AZStd::atomic_bool m_enabled{ false };
+        AZStd::atomic_bool m_stopWriter{ false };
+        AZStd::thread m_writerThread;
+
+        AZStd::mutex m_warningMutex;
+        WarningRecord m_warningRecords[WarningRecordCount];
+        AZStd::atomic<AZ::u64> m_warningDedupIntervalMs{ 0 };
+    };
+} // namespace AZ::Debug
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    /**
+     * EBusReadMostlyDispatchTraits is a custom mutex type and lock guards for buses that are dispatched to far more often than
+     * handlers connect or disconnect, such as notification buses that are sent to every frame.
+     *
+     * Features:
+     *   - Event dispatches don't lock a mutex. A dispatch only increments a counter that is shared with few or no other threads,
+     *     so dispatches on separate threads execute in parallel without contending on the bus.
+     *   - Bus connects / disconnects wait until no event dispatches are executing, and block new dispatches until they're done.
+     *     This makes connects / disconnects slower than with the default mutex.
+     *   - Event dispatches can call other event dispatches on the same bus recursively.
+     *
+     * Limitations:
+     *   - If the bus contains custom connect / disconnect logic, it must not call any event dispatches on the same bus.
+     *   - Bus connects / disconnects cannot happen within event dispatches on the same bus.
+     *   - Each bus context stores a counter per group of threads, which uses a few kilobytes of memory.
+     *
+     * Usage:
+     *   To use the traits, inherit from EBusReadMostlyDispatchTraits<BusType>:
+     *      class MyBus : public AZ::EBusReadMostlyDispatchTraits<MyBus>
+     *
+     *   Alternatively, you can directly define the specific traits via the following:
+     *      using MutexType = AZ::EBusReadMostlyDispatchMutex;
+     *
+     *      template <typename MutexType, bool IsLocklessDispatch>
+     *      using DispatchLockGuard = AZ::EBusReadMostlyDispatchLockGuard<AZ::EBus<MyBus>>;
+     *
+     *      template<typename MutexType>
+     *      using ConnectLockGuard = AZ::EBusReadMostlyConnectLockGuard<AZ::EBus<MyBus>>;
+     *
+     *      template<typename MutexType>
+     *      using CallstackTrackerLockGuard = AZ::EBusReadMostlyCallstackLockGuard<AZ::EBus<MyBus>>;
+     */
+
+    // Mutex that keeps a dispatch counter per group of threads instead of a single lock, so dispatching only writes to memory
+    // that other threads rarely use. Connects / disconnects announce themselves and then wait for all counters to reach zero.
+    class EBusReadMostlyDispatchMutex
+    {
+    public:
+        EBusReadMostlyDispatchMutex() = default;
+        ~EBusReadMostlyDispatchMutex() = default;
+
+        using DispatchCounter = AZStd::atomic<AZ::u32>;
+
+        // Registers a dispatch on the calling thread and returns the counter that needs to be passed to DispatchUnlock.
+        DispatchCounter& DispatchLock()
+        {
+            DispatchCounter& counter = GetDispatchCounter();
+            while (true)
+            {
+                // Both operations are sequentially consistent, so either the connect sees this counter or this dispatch sees
+                // the connect.
+                counter.fetch_add(1);
+                if (!m_connectPending.load())
+                {
+                    return counter;
+                }
+
+                // Back off and wait until the connect completes.
+                counter.fetch_sub(1, AZStd::memory_order_release);
+                m_connectMutex.lock();
+                m_connectMutex.unlock();
+            }
+        }
+
+        void DispatchUnlock(DispatchCounter& counter)
+        {
+            counter.fetch_sub(1, AZStd::memory_order_release);
+        }
+
+        void ConnectLock()
+        {
+            m_connectMutex.lock();
+            m_connectPending.store(true);
+            for (const DispatchCounterSlot& slot : m_dispatchCounters)
+            {
+                while (slot.m_counter.load() != 0)
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+        }
+
+        void ConnectUnlock()
+        {
+            m_connectPending.store(false, AZStd::memory_order_release);
+            m_connectMutex.unlock();
+        }
+
+        void CallstackMutexLock()
+        {
+            m_callstackMutex.lock();
+        }
+
+        void CallstackMutexUnlock()
+        {
+            m_callstackMutex.unlock();
+        }
+
+        // Locking the mutex directly, for instance when binding a bus pointer, behaves like a connect.
+        void lock()
+        {
+            ConnectLock();
+        }
+
+        void unlock()
+        {
+            ConnectUnlock();
+        }
+
+    private:
+        static constexpr size_t DispatchCounterCount = 32;
+
+        // Each counter is padded to the size of a cache line so threads using different counters don't share cache lines.
+        struct DispatchCounterSlot
+        {
+            DispatchCounter m_counter{ 0 };
+            char m_padding[64 - sizeof(DispatchCounter)];
+        };
+
+        DispatchCounter& GetDispatchCounter()
+        {
+            // Threads are assigned counters in the order they first dispatch, which spreads them evenly over the counters.
+            static AZStd::atomic<size_t> s_nextCounterIndex{ 0 };
+            static AZ_THREAD_LOCAL size_t s_counterIndex = 0;
+            if (s_counterIndex == 0)
+            {
+                s_counterIndex = (s_nextCounterIndex.fetch_add(1, AZStd::memory_order_relaxed) % DispatchCounterCount) + 1;
+            }
+            return m_dispatchCounters[s_counterIndex - 1].m_counter;
+        }
+
+        DispatchCounterSlot m_dispatchCounters[DispatchCounterCount];
+        AZStd::atomic_bool m_connectPending{ false };
+        AZStd::mutex m_connectMutex;
+        AZStd::mutex m_callstackMutex;
+    };
+
+    // Custom lock guard to handle Connection lock management.
+    // This waits for all dispatches to complete and blocks new ones until the guard is destroyed. It will assert and disallow
+    // connects from inside a dispatch, as the connect would wait for itself.
+    template<class EBusType>
+    class EBusReadMostlyConnectLockGuard
+    {
+    public:
+        EBusReadMostlyConnectLockGuard(EBusReadMostlyDispatchMutex& mutex, AZStd::adopt_lock_t)
+            : m_mutex(mutex)
+        {
+        }
+
+        explicit EBusReadMostlyConnectLockGuard(EBusReadMostlyDispatchMutex& mutex)
+            : m_mutex(mutex)
+        {
+            AZ_Assert(!EBusType::IsInDispatchThisThread(), "Can't connect/disconnect while inside an event dispatch.");
+            m_mutex.ConnectLock();
+        }
+
+        ~EBusReadMostlyConnectLockGuard()
+        {
+            m_mutex.ConnectUnlock();
+        }
+
+    private:
+        EBusReadMostlyConnectLockGuard(EBusReadMostlyConnectLockGuard const&) = delete;
+        EBusReadMostlyConnectLockGuard& operator=(EBusReadMostlyConnectLockGuard const&) = delete;
+        EBusReadMostlyDispatchMutex& m_mutex;
+    };
+
+    // Custom lock guard to handle Dispatch lock management.
+    // Only the outermost dispatch on a thread registers itself, as a recursive dispatch would otherwise wait for a pending
+    // connect that is waiting for the outer dispatch.
+    template<class EBusType>
+    class EBusReadMostlyDispatchLockGuard
+    {
+    public:
+        EBusReadMostlyDispatchLockGuard(EBusReadMostlyDispatchMutex& mutex, AZStd::adopt_lock_t)
+            : m_mutex(mutex)
+        {
+        }
+
+        explicit EBusReadMostlyDispatchLockGuard(EBusReadMostlyDispatchMutex& mutex)
+            : m_mutex(mutex)
+        {
+            if (!EBusType::IsInDispatchThisThread())
+            {
+                m_counter = &m_mutex.DispatchLock();
+            }
+        }
+
+        ~EBusReadMostlyDispatchLockGuard()
+        {
+            if (m_counter)
+            {
+                m_mutex.DispatchUnlock(*m_counter);
+            }
+        }
+
+    private:
+        EBusReadMostlyDispatchLockGuard(EBusReadMostlyDispatchLockGuard const&) = delete;
+        EBusReadMostlyDispatchLockGuard& operator=(EBusReadMostlyDispatchLockGuard const&) = delete;
+        EBusReadMostlyDispatchMutex& m_mutex;
+        EBusReadMostlyDispatchMutex::DispatchCounter* m_counter = nullptr;
+    };
+
+    // Custom lock guard to handle callstack tracking lock management.
+    // This uses a separate always-exclusive lock for the callstack tracking, as it's taken while dispatching.
+    template<class EBusType>
+    class EBusReadMostlyCallstackLockGuard
+    {
+    public:
+        EBusReadMostlyCallstackLockGuard(EBusReadMostlyDispatchMutex& mutex, AZStd::adopt_lock_t)
+            : m_mutex(mutex)
+        {
+        }
+
+        explicit EBusReadMostlyCallstackLockGuard(EBusReadMostlyDispatchMutex& mutex)
+            : m_mutex(mutex)
+        {
+            m_mutex.CallstackMutexLock();
+        }
+
+        ~EBusReadMostlyCallstackLockGuard()
+        {
+            m_mutex.CallstackMutexUnlock();
+        }
+
+    private:
+        EBusReadMostlyCallstackLockGuard(EBusReadMostlyCallstackLockGuard const&) = delete;
+        EBusReadMostlyCallstackLockGuard& operator=(EBusReadMostlyCallstackLockGuard const&) = delete;
+        EBusReadMostlyDispatchMutex& m_mutex;
+    };
+
+    // The EBusTraits that can be inherited from to automatically set up the MutexType and LockGuards.
+    // To inherit, use "class MyBus : public AZ::EBusReadMostlyDispatchTraits<MyBus>"
+    template<class BusType>
+    struct EBusReadMostlyDispatchTraits : EBusTraits
+    {
+        using MutexType = AZ::EBusReadMostlyDispatchMutex;
+
+        template<typename MutexType, bool IsLocklessDispatch>
+        using DispatchLockGuard = AZ::EBusReadMostlyDispatchLockGuard<AZ::EBus<BusType>>;
+
+        template<typename MutexType>
+        using ConnectLockGuard = AZ::EBusReadMostlyConnectLockGuard<AZ::EBus<BusType>>;
+
+        template<typename MutexType>
+        using CallstackTrackerLockGuard = AZ::EBusReadMostlyCallstackLockGuard<AZ::EBus<BusType>>;
+    };
+
+} // namespace AZ
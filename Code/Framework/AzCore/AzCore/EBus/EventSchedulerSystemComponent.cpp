@@ -63,15 +63,12 @@ namespace AZ
         TimeMs startTime = AZ::GetElapsedTimeMs();
         bool usingTimeslice = bg_maxScheduledEventProcessTimeMs != TimeMs{ 0 };
 
-        while (!m_queue.empty())
+        m_queue.Advance(startTime);
+        ScheduledEventHandle* expiredHandle = nullptr;
+        while (m_queue.PopExpired(expiredHandle))
         {
-            ScheduledEventHandle* handle = m_queue.top();
-            if (handle->GetExecuteTimeMs() > startTime)
-            {
-                break;
-            }
-            m_queue.pop();
-            m_pendingQueue.push(handle);
+            expiredHandle->m_queueHandle = TimingWheel<ScheduledEventHandle*>::InvalidHandle;
+            m_pendingQueue.push(expiredHandle);
         }
 
         while (!m_pendingQueue.empty())
@@ -108,10 +105,15 @@ namespace AZ
         {
             timedEvent->m_handle = AllocateHandle();
         }
+        else
+        {
+            // The event is being rescheduled, drop its current timer so it doesn't trigger twice
+            m_queue.Remove(timedEvent->m_handle->m_queueHandle);
+        }
         const bool ownsScheduledEvent = false;
         timedEvent->m_handle = new (timedEvent->m_handle) ScheduledEventHandle(TimeMs(currentMilliseconds + durationMs), durationMs, timedEvent, ownsScheduledEvent);
         timedEvent->m_timeInserted = currentMilliseconds;
-        m_queue.push(timedEvent->m_handle);
+        timedEvent->m_handle->m_queueHandle = m_queue.Insert(timedEvent->m_handle->GetExecuteTimeMs(), timedEvent->m_handle);
         return timedEvent->m_handle;
     }
 
@@ -127,7 +129,19 @@ namespace AZ
         const bool ownsScheduledEvent = true;
         timedEvent->m_handle = new (timedEvent->m_handle) ScheduledEventHandle(TimeMs(currentMilliseconds + durationMs), durationMs, timedEvent, ownsScheduledEvent);
         timedEvent->m_timeInserted = currentMilliseconds;
-        m_queue.push(timedEvent->m_handle);
+        timedEvent->m_handle->m_queueHandle = m_queue.Insert(timedEvent->m_handle->GetExecuteTimeMs(), timedEvent->m_handle);
+    }
+
+    void EventSchedulerSystemComponent::RemoveEvent(ScheduledEventHandle* handle)
+    {
+        handle->Clear();
+
+        // Handles that already left the queue are pending or triggering, they're freed once they're done triggering
+        if (m_queue.Remove(handle->m_queueHandle))
+        {
+            handle->m_queueHandle = TimingWheel<ScheduledEventHandle*>::InvalidHandle;
+            FreeHandle(handle);
+        }
     }
 
     AZStd::size_t EventSchedulerSystemComponent::GetHandleCount() const
@@ -142,7 +156,7 @@ namespace AZ
 
     AZStd::size_t EventSchedulerSystemComponent::GetQueueSize() const
     {
-        return m_queue.size();
+        return m_queue.GetSize();
     }
 
     void EventSchedulerSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
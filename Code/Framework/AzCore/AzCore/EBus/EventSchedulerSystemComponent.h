@@ -14,6 +14,7 @@
 #include <AzCore/EBus/ScheduledEventHandle.h>
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Time/TimingWheel.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/queue.h>
 
@@ -75,6 +76,7 @@ namespace AZ
         //! @{
         ScheduledEventHandle* AddEvent(ScheduledEvent* scheduledEvent, TimeMs durationMs) override;
         void AddCallback(const AZStd::function<void()>& callback, const Name& eventName, TimeMs durationMs) override;
+        void RemoveEvent(ScheduledEventHandle* handle) override;
         // @}
 
         //! EventSchedulerSystemComponent stats
@@ -96,8 +98,8 @@ namespace AZ
         // Bind the DumpStats member function to the console as 'EventSchedulerSystemComponent.DumpStats'
         AZ_CONSOLEFUNC(EventSchedulerSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dump EventSchedulerSystemComponent stats to the console window");
 
-        // Priority queues of scheduled events sorted by execution time
-        AZStd::priority_queue<ScheduledEventHandle*, AZStd::vector<ScheduledEventHandle*>, CompareScheduledEventPtrs> m_queue;
+        // Timing wheel of scheduled events by execution time, events that are due are prioritized by the pending queue
+        TimingWheel<ScheduledEventHandle*> m_queue;
         AZStd::priority_queue<ScheduledEventHandle*, AZStd::vector<ScheduledEventHandle*>, PrioritizeScheduledEventPtrs> m_pendingQueue;
         AZStd::deque<ScheduledEvent> m_ownedEvents;
         AZStd::vector<ScheduledEvent*> m_freeEvents;
@@ -48,6 +48,11 @@ namespace AZ
         //! @param durationMs a millisecond interval to run the scheduled callback
         virtual void AddCallback(const AZStd::function<void()>& callback, const Name& eventName, TimeMs durationMs) = 0;
 
+        //! Removes a scheduled event that was added with AddEvent.
+        //! The handle is released immediately if the event is still queued, otherwise it's released once the event is done triggering.
+        //! @param handle the handle returned by AddEvent
+        virtual void RemoveEvent(ScheduledEventHandle* handle) = 0;
+
         AZ_DISABLE_COPY_MOVE(IEventScheduler);
     };
 
@@ -117,7 +117,15 @@ namespace AZ
     {
         if (m_handle)
         {
-            m_handle->Clear();
+            IEventScheduler* eventScheduler = Interface<IEventScheduler>::Get();
+            if (eventScheduler)
+            {
+                eventScheduler->RemoveEvent(m_handle);
+            }
+            else
+            {
+                m_handle->Clear();
+            }
         }
         m_handle = nullptr;
     }
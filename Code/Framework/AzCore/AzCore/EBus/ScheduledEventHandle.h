@@ -9,9 +9,11 @@
 #pragma once
 
 #include <AzCore/Time/ITime.h>
+#include <AzCore/Time/TimingWheel.h>
 
 namespace AZ
 {
+    class EventSchedulerSystemComponent;
     class ScheduledEvent;
 
     //! @struct ScheduledEventHandle
@@ -64,6 +66,9 @@ namespace AZ
         TimeMs m_durationMs = TimeMs{ 0 };    //< interval time of the scheduled event
         ScheduledEvent* m_event = nullptr;    //< pointer to the scheduled event
         bool m_ownsScheduledEvent = false;    //< if the handle manages the memory of its own event
+        TimingWheel<ScheduledEventHandle*>::Handle m_queueHandle = TimingWheel<ScheduledEventHandle*>::InvalidHandle; //< timer of the handle in the event queue
+
+        friend class EventSchedulerSystemComponent;
     };
 }
 
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/ChunkedCompression.h>
+#include <AzCore/std/algorithm.h>
+
+#include <zstd.h>
+
+namespace AZ::IO::ChunkedCompression
+{
+    bool ReadHeader(Header& header, const void* data, size_t dataSize)
+    {
+        if (dataSize < sizeof(Header))
+        {
+            return false;
+        }
+        memcpy(&header, data, sizeof(Header));
+        if (header.m_magic != Magic || header.m_version != Version)
+        {
+            return false;
+        }
+        if (header.m_blockSize == 0)
+        {
+            return header.m_blockCount == 0 && header.m_uncompressedSize == 0;
+        }
+        const u64 expectedBlockCount = (header.m_uncompressedSize + header.m_blockSize - 1) / header.m_blockSize;
+        return expectedBlockCount == header.m_blockCount;
+    }
+
+    bool ReadBlockIndex(AZStd::vector<Block>& blocks, const Header& header, const void* data, size_t dataSize)
+    {
+        const size_t indexSize = GetIndexSize(header.m_blockCount);
+        if (dataSize < indexSize)
+        {
+            return false;
+        }
+
+        blocks.resize_no_construct(header.m_blockCount);
+        memcpy(blocks.data(), reinterpret_cast<const u8*>(data) + sizeof(Header), header.m_blockCount * sizeof(Block));
+
+        // Blocks are stored in order right after the index, so anything else means the data is corrupted.
+        u64 expectedOffset = indexSize;
+        for (const Block& block : blocks)
+        {
+            if (block.m_compressedOffset != expectedOffset)
+            {
+                return false;
+            }
+            expectedOffset += block.m_compressedSize;
+        }
+        return true;
+    }
+
+    u64 GetUncompressedBlockSize(const Header& header, u32 blockIndex)
+    {
+        const u64 blockStart = aznumeric_cast<u64>(blockIndex) * header.m_blockSize;
+        return AZStd::min<u64>(header.m_blockSize, header.m_uncompressedSize - blockStart);
+    }
+
+    bool Compress(AZStd::vector<u8>& output, const void* data, size_t dataSize, u32 blockSize, Codec codec, int compressionLevel)
+    {
+        if (codec != Codec::Stored && codec != Codec::ZStd)
+        {
+            AZ_Error("ChunkedCompression", false, "Codec %u can't be used to compress data, only to decompress.", aznumeric_cast<u32>(codec));
+            return false;
+        }
+        if (blockSize == 0 && dataSize != 0)
+        {
+            AZ_Error("ChunkedCompression", false, "The block size for chunked compression can't be zero.");
+            return false;
+        }
+
+        Header header;
+        header.m_codec = codec;
+        header.m_blockSize = blockSize;
+        header.m_uncompressedSize = dataSize;
+        header.m_blockCount = dataSize == 0 ? 0 : aznumeric_cast<u32>((dataSize + blockSize - 1) / blockSize);
+
+        const size_t headerOffset = output.size();
+        const size_t indexSize = GetIndexSize(header.m_blockCount);
+        output.resize(headerOffset + indexSize);
+
+        AZStd::vector<Block> blocks;
+        blocks.reserve(header.m_blockCount);
+
+        ZSTD_CCtx* context = codec == Codec::ZStd ? ZSTD_createCCtx() : nullptr;
+        const u8* source = reinterpret_cast<const u8*>(data);
+        bool result = true;
+        for (u32 i = 0; i < header.m_blockCount; ++i)
+        {
+            const size_t uncompressedSize = aznumeric_cast<size_t>(GetUncompressedBlockSize(header, i));
+            const u8* blockSource = source + aznumeric_cast<size_t>(i) * blockSize;
+
+            Block block;
+            block.m_compressedOffset = output.size() - headerOffset;
+
+            size_t compressedSize = uncompressedSize;
+            if (context)
+            {
+                const size_t writeOffset = output.size();
+                output.resize_no_construct(writeOffset + ZSTD_compressBound(uncompressedSize));
+                compressedSize = ZSTD_compressCCtx(
+                    context, output.data() + writeOffset, output.size() - writeOffset, blockSource, uncompressedSize, compressionLevel);
+                if (ZSTD_isError(compressedSize))
+                {
+                    AZ_Error("ChunkedCompression", false, "Failed to compress block %u: %s", i, ZSTD_getErrorName(compressedSize));
+                    result = false;
+                    break;
+                }
+                output.resize(writeOffset + compressedSize);
+            }
+
+            if (compressedSize >= uncompressedSize)
+            {
+                // Compression didn't help, so store the block as is so it doesn't need decompression either.
+                output.resize(aznumeric_cast<size_t>(headerOffset + block.m_compressedOffset));
+                output.insert(output.end(), blockSource, blockSource + uncompressedSize);
+                compressedSize = uncompressedSize;
+                block.m_flags |= BlockFlag_Stored;
+            }
+            block.m_compressedSize = aznumeric_cast<u32>(compressedSize);
+            blocks.push_back(block);
+        }
+        if (context)
+        {
+            ZSTD_freeCCtx(context);
+        }
+
+        if (!result)
+        {
+            output.resize(headerOffset);
+            return false;
+        }
+
+        memcpy(output.data() + headerOffset, &header, sizeof(Header));
+        memcpy(output.data() + headerOffset + sizeof(Header), blocks.data(), blocks.size() * sizeof(Block));
+        return true;
+    }
+
+    bool DecompressBlock(Codec codec, const Block& block, const void* compressed, void* uncompressed, size_t uncompressedSize,
+        const CompressionInfo* info)
+    {
+        if ((block.m_flags & BlockFlag_Stored) || codec == Codec::Stored)
+        {
+            if (block.m_compressedSize != uncompressedSize)
+            {
+                return false;
+            }
+            memcpy(uncompressed, compressed, uncompressedSize);
+            return true;
+        }
+
+        switch (codec)
+        {
+        case Codec::ZStd:
+        {
+            const size_t result = ZSTD_decompress(uncompressed, uncompressedSize, compressed, block.m_compressedSize);
+            return !ZSTD_isError(result) && result == uncompressedSize;
+        }
+        default:
+            if (info && info->m_decompressor)
+            {
+                return info->m_decompressor(*info, compressed, block.m_compressedSize, uncompressed, uncompressedSize);
+            }
+            AZ_Error("ChunkedCompression", false, "No decompressor available for codec %u.", aznumeric_cast<u32>(codec));
+            return false;
+        }
+    }
+} // namespace AZ::IO::ChunkedCompression
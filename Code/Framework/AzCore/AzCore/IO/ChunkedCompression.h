@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::IO
+{
+    //! Seekable compression format that stores data as a series of independently compressed blocks of a fixed uncompressed
+    //! size. A block index at the start of the data maps every block to its location in the compressed data, so any
+    //! uncompressed range can be read by reading and decompressing only the blocks that overlap it.
+    //! The layout is:
+    //!     Header
+    //!     Block[header.m_blockCount]
+    //!     Compressed blocks, in order.
+    //! All values are stored little endian.
+    namespace ChunkedCompression
+    {
+        //! Tag used in CompressionInfo::m_compressionTag to mark archive entries that are stored in the chunked format.
+        inline constexpr CompressionTag Tag{ 'C' | ('H' << 8) | ('N' << 16) | ('K' << 24) };
+        inline constexpr u32 Magic = Tag.m_code;
+        inline constexpr u16 Version = 1;
+
+        enum class Codec : u8
+        {
+            //! Blocks are stored without compression.
+            Stored = 0,
+            //! Blocks are individual zstd frames.
+            ZStd = 1,
+            //! Blocks are individual LZ4 blocks. AzCore doesn't include LZ4, so blocks with this codec are decompressed with the
+            //! CompressionInfo::m_decompressor provided by the archive.
+            LZ4 = 2
+        };
+
+        struct Header
+        {
+            u32 m_magic{ Magic };
+            u16 m_version{ Version };
+            Codec m_codec{ Codec::ZStd };
+            u8 m_reserved{ 0 };
+            //! Uncompressed size of every block except the last, which holds the remainder.
+            u32 m_blockSize{ 0 };
+            u32 m_blockCount{ 0 };
+            u64 m_uncompressedSize{ 0 };
+        };
+        static_assert(sizeof(Header) == 24, "The chunked compression header is part of the file format and can't change size.");
+
+        enum BlockFlags : u32
+        {
+            //! The block didn't compress and is stored as is, regardless of the codec.
+            BlockFlag_Stored = 1 << 0
+        };
+
+        struct Block
+        {
+            //! Offset of the compressed block relative to the start of the header.
+            u64 m_compressedOffset{ 0 };
+            u32 m_compressedSize{ 0 };
+            u32 m_flags{ 0 };
+        };
+        static_assert(sizeof(Block) == 16, "The chunked compression block index is part of the file format and can't change size.");
+
+        //! Size of the header and block index for the given number of blocks.
+        constexpr size_t GetIndexSize(u32 blockCount)
+        {
+            return sizeof(Header) + blockCount * sizeof(Block);
+        }
+
+        //! Validates and copies the header at the start of data. Returns false if data doesn't start with a supported header.
+        bool ReadHeader(Header& header, const void* data, size_t dataSize);
+        //! Reads the block index that follows the header. data needs to contain at least GetIndexSize(header.m_blockCount)
+        //! bytes. Returns false if the index doesn't match the header.
+        bool ReadBlockIndex(AZStd::vector<Block>& blocks, const Header& header, const void* data, size_t dataSize);
+
+        //! Compresses data into the chunked format and appends it to output. Blocks that don't get smaller are stored as is.
+        //! Only Codec::Stored and Codec::ZStd can be used to compress.
+        bool Compress(AZStd::vector<u8>& output, const void* data, size_t dataSize, u32 blockSize, Codec codec = Codec::ZStd,
+            int compressionLevel = 3);
+
+        //! Decompresses a single block. uncompressedSize needs to be the exact uncompressed size of the block. info is only
+        //! used for codecs that AzCore doesn't support, which are forwarded to info.m_decompressor.
+        bool DecompressBlock(Codec codec, const Block& block, const void* compressed, void* uncompressed, size_t uncompressedSize,
+            const CompressionInfo* info = nullptr);
+
+        //! Uncompressed size of the block at blockIndex.
+        u64 GetUncompressedBlockSize(const Header& header, u32 blockIndex);
+    } // namespace ChunkedCompression
+} // namespace AZ::IO
@@ -13,9 +13,17 @@
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
 
 namespace AZ::IO
 {
+    AZ_CVAR(uint32_t, io_zstdCompressionWorkers, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of background threads compressing each zstd stream, 0 compresses on the writing thread");
+    AZ_CVAR(bool, io_zstdLongDistanceMatching, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Enables zstd long distance matching for compressed streams, which helps large files with repeated content at the cost of memory");
+    AZ_CVAR(uint32_t, io_zstdWindowLog, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Log2 of the zstd match window for compressed streams, 0 uses the default of the compression level");
+
     CompressorZStd::CompressorZStd(unsigned int decompressionCachePerStream, unsigned int dataBufferSize)
         : m_compressedDataBufferSize(dataBufferSize)
         , m_decompressionCachePerStream(decompressionCachePerStream)
@@ -64,9 +72,7 @@ namespace AZ::IO
         zstdData->m_compressor = this;
         zstdData->m_uncompressedSize = 0;
         zstdData->m_zstdHeader = *reinterpret_cast<ZStd::Header*>(data);
-        dataSize -= sizeof(zstdData->m_zstdHeader);
-        data += sizeof(zstdData->m_zstdHeader);
-        zstdData->m_decompressNextOffset = sizeof(CompressorHeader) + sizeof(CompressorZStdHeader) + sizeof(ZStd::Header); // start after the headers
+        zstdData->m_decompressNextOffset = sizeof(CompressorHeader) + sizeof(CompressorZStdHeader); // start after the headers, the zstd frame carries its own header
 
         AZ_Error("CompressorZStd", hdr->m_numSeekPoints > 0, "We should have at least one seek point for the entire stream.");
 
@@ -259,43 +265,42 @@ namespace AZ::IO
             zstdData->m_decompressNextOffset = bestSeekPoint.m_compressedOffset;  // set next read point
             zstdData->m_decompressedCacheOffset = bestSeekPoint.m_uncompressedOffset; // set uncompressed offset
             zstdData->m_decompressedCacheDataSize = 0; // invalidate the cache
-            zstdData->m_zstd.ResetDecompressor(&zstdData->m_zstdHeader); // reset decompressor and setup the header.
+            zstdData->m_zstd.ResetDecompressor(); // reset decompressor, every seek point starts a new frame.
         }
 
         // decompress and move forward until the request is done
         while (byteSize > 0)
         {
-            // fill buffer with compressed data
+            // fill buffer with compressed data, at the end of the stream there can still be decompressed data buffered in zstd.
             SizeType compressedDataSize = FillCompressedBuffer(stream);
-            if (compressedDataSize == 0)
-            {
-                return numRead; // we are done reading and obviously we did not managed to read all data
-            }
             unsigned int processedCompressedData = 0;
-            while (byteSize > 0 && processedCompressedData < compressedDataSize) // decompressed data either until we are done with the request (byteSize == 0) or we need to fill the compression buffer again.
+            bool isProgressing = true;
+            bool hasProgressed = false;
+            while (byteSize > 0 && isProgressing) // decompressed data either until we are done with the request (byteSize == 0) or we need to fill the compression buffer again.
             {
                 // if we have data in the cache move to the next offset, we always move forward by default.
                 zstdData->m_decompressedCacheOffset += zstdData->m_decompressedCacheDataSize;
 
                 // decompress in the cache buffer
                 u32 availDecompressedCacheSize = m_decompressionCachePerStream; // reset buffer size
-                size_t nextBlockSize;
                 unsigned int processed = zstdData->m_zstd.Decompress(&m_compressedDataBuffer[processedCompressedData],
                                                                     static_cast<unsigned int>(compressedDataSize) - processedCompressedData,
                                                                     zstdData->m_decompressedCache,
-                                                                    availDecompressedCacheSize,
-                                                                    &nextBlockSize);
+                                                                    availDecompressedCacheSize);
                 zstdData->m_decompressedCacheDataSize = m_decompressionCachePerStream - availDecompressedCacheSize;
-                if (processed == 0)
-                {
-                    break; // we processed everything we could, load more compressed data.
-                }
+                // zstd consumes all the input it can, so without progress it needs more compressed data.
+                isProgressing = processed > 0 || zstdData->m_decompressedCacheDataSize > 0;
+                hasProgressed |= isProgressing;
                 processedCompressedData += processed;
                 // fill what we can from the cache
                 numRead += FillFromDecompressCache(zstdData, buffer, byteSize, offset);
             }
             // update next read position the the compressed stream
             zstdData->m_decompressNextOffset +=  processedCompressedData;
+            if (!hasProgressed)
+            {
+                return numRead; // we are done reading and obviously we did not managed to read all data
+            }
         }
         return numRead;
     }
@@ -318,6 +323,10 @@ namespace AZ::IO
         {
             unsigned int oldDataToCompress = dataToCompress;
             unsigned int compressedSize = zstdData->m_zstd.Compress(bytes, dataToCompress, m_compressedDataBuffer, m_compressedDataBufferSize);
+            if (compressedSize == 0 && oldDataToCompress == dataToCompress)
+            {
+                return 0; // compression error
+            }
             if (compressedSize)
             {
                 GenericStream* baseStream = stream->GetWrappedStream();
@@ -356,11 +365,12 @@ namespace AZ::IO
 
         m_lastReadStream = nullptr; // invalidate last read position, otherwise m_dataBuffer will be corrupted (as we are about to write in it).
 
+        // End the frame so decompression can start from the seek point without the data before it.
         unsigned int compressedSize;
         unsigned int dataToCompress = 0;
         do
         {
-            compressedSize = zstdData->m_zstd.Compress(nullptr, dataToCompress, m_compressedDataBuffer, m_compressedDataBufferSize, ZStd::FT_FULL_FLUSH);
+            compressedSize = zstdData->m_zstd.Compress(nullptr, dataToCompress, m_compressedDataBuffer, m_compressedDataBufferSize, ZStd::FT_FINISH);
             if (compressedSize)
             {
                 GenericStream* baseStream = stream->GetWrappedStream();
@@ -370,7 +380,7 @@ namespace AZ::IO
                     return false; // error we wrote less than than requested!
                 }
             }
-        } while (dataToCompress != 0);
+        } while (zstdData->m_zstd.IsFlushPending());
 
         CompressorZStdSeekPoint sp;
         sp.m_compressedOffset = stream->GetLength();
@@ -392,7 +402,11 @@ namespace AZ::IO
         zstdData->m_autoSeekSize = autoSeekDataSize;
         compressionLevel = AZ::GetClamp(compressionLevel, 1, 9); // remap to zlib levels
 
-        zstdData->m_zstd.StartCompressor(compressionLevel);
+        ZStd::CompressionParameters parameters;
+        parameters.m_numWorkers = io_zstdCompressionWorkers;
+        parameters.m_longDistanceMatching = io_zstdLongDistanceMatching;
+        parameters.m_windowLog = io_zstdWindowLog;
+        zstdData->m_zstd.StartCompressor(compressionLevel, parameters);
 
         stream->SetCompressorData(zstdData);
 
@@ -400,7 +414,7 @@ namespace AZ::IO
         {
             // add the first and always present seek point at the start of the compressed stream
             CompressorZStdSeekPoint sp;
-            sp.m_compressedOffset = sizeof(CompressorHeader) + sizeof(CompressorZStdHeader) + sizeof(zstdData->m_zstdHeader);
+            sp.m_compressedOffset = sizeof(CompressorHeader) + sizeof(CompressorZStdHeader);
             sp.m_uncompressedOffset = 0;
             zstdData->m_seekPoints.push_back(sp);
             return true;
@@ -430,7 +444,7 @@ namespace AZ::IO
                 {
                     baseStream->Write(compressedSize, m_compressedDataBuffer);
                 }
-            } while (dataToCompress != 0);
+            } while (zstdData->m_zstd.IsFlushPending());
 
             result = WriteHeaderAndData(stream);
             if (result)
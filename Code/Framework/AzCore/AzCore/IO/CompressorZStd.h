@@ -48,9 +48,11 @@ namespace AZ
         public:
             AZ_CLASS_ALLOCATOR(CompressorZStdData, AZ::SystemAllocator);
 
+            /// Without a dedicated allocator the zstd contexts come from the global pool, so opening many small streams
+            /// doesn't create new contexts.
             CompressorZStdData(IAllocator* zstdMemAllocator = 0)
+                : m_zstd(zstdMemAllocator, zstdMemAllocator ? nullptr : &ZStdContextPool::GetGlobal())
             {
-                m_zstd = zstdMemAllocator;
             }
 
             ZStd              m_zstd;
@@ -58,7 +60,7 @@ namespace AZ
             AZ::u64           m_decompressLastOffset{};     ///< Last valid offset in the compressed stream of the compressed data. Used only when we decompress.
             unsigned char*    m_decompressedCache{};      ///< Decompressed stream cache.
             unsigned int      m_decompressedCacheDataSize{};   ///< Number of valid bytes in the decompressed cache.
-            ZStd::Header      m_zstdHeader;                       ///< Stored 2 bytes header of the zlib when we reset the decompressor.
+            ZStd::Header      m_zstdHeader;                       ///< Magic number at the start of the first zstd frame.
             union
             {
                 AZ::u64       m_decompressedCacheOffset{};  ///< Used when decompressing. Decompressed cache is the data offset in the uncompressed data stream.
@@ -7,11 +7,13 @@
  */
 
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/Casting/numeric_cast.h>
 #include <ctype.h>
 #include <AzCore/Module/Environment.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/std/string/wildcard.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/functional.h>
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Debug/Profiler.h>
 
@@ -112,6 +114,38 @@ namespace AZ::IO
         return AZStd::nullopt;
     }
 
+    void FileIOBase::ReadBatch(FileReadBatch requests, ReadBatchCallback callback)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        for (FileReadRequest& request : requests)
+        {
+            ReadBatchRequest(request);
+        }
+        if (callback)
+        {
+            callback(requests);
+        }
+    }
+
+    void FileIOBase::ReadBatchRequest(FileReadRequest& request)
+    {
+        request.m_bytesRead = 0;
+        request.m_result = ResultCode::Error;
+
+        HandleType fileHandle = InvalidHandle;
+        if (!Open(request.m_filePath.c_str(), OpenMode::ModeRead | OpenMode::ModeBinary, fileHandle))
+        {
+            return;
+        }
+
+        if (Seek(fileHandle, aznumeric_cast<AZ::s64>(request.m_offset), SeekType::SeekFromStart))
+        {
+            Result result = Read(fileHandle, request.m_output, request.m_size, true, &request.m_bytesRead);
+            request.m_result = result.GetResultCode();
+        }
+        Close(fileHandle);
+    }
+
     SeekType GetSeekTypeFromFSeekMode(int mode)
     {
         switch (mode)
@@ -11,6 +11,7 @@
 #include <AzCore/std/function/function_fwd.h>
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/Path/Path_fwd.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/optional.h>
 #include <AzCore/std/string/fixed_string.h>
 #include <AzCore/std/string/string.h>
@@ -81,6 +82,21 @@ namespace AZ
             ResultCode m_resultCode;
         };
 
+        /// A single read in a batch submitted through FileIOBase::ReadBatch.
+        /// The read starts at m_offset in the file at m_filePath and reads exactly m_size bytes into m_output, which needs
+        /// to be at least m_size bytes large. The read needs to fall entirely inside the file, otherwise it fails.
+        /// m_bytesRead and m_result are filled in once the batch has completed.
+        struct FileReadRequest
+        {
+            AZStd::string m_filePath;
+            void* m_output{ nullptr };
+            AZ::u64 m_offset{ 0 };
+            AZ::u64 m_size{ 0 };
+            AZ::u64 m_bytesRead{ 0 };
+            ResultCode m_result{ ResultCode::Error };
+        };
+        using FileReadBatch = AZStd::vector<FileReadRequest>;
+
         /// The base class for file IO stack classes
         class FileIOBase
         {
@@ -232,6 +248,19 @@ namespace AZ
             {
                 return false;
             }
+
+            /// ReadBatch - Queues all reads in the batch at once and calls the callback once all of them have completed.
+            /// Implementations are free to run the reads in any order and in parallel, so the callback may be called from
+            /// another thread, and may also be called before ReadBatch returns. The batch is handed back to the callback with
+            /// the result of every read filled in. The output buffers need to stay alive until the callback has been called.
+            /// The default implementation reads the files one after the other on the calling thread.
+            /// You must include <AzCore/std/functional.h> if you use this
+            using ReadBatchCallback = AZStd::function<void(FileReadBatch& requests)>;
+            virtual void ReadBatch(FileReadBatch requests, ReadBatchCallback callback);
+
+        protected:
+            /// Synchronously runs a single read from a batch by opening, reading and closing the file.
+            void ReadBatchRequest(FileReadRequest& request);
         };
 
         /**
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ::IO
+{
+    MappedFile::MappedFile(MappedFile&& rhs)
+        : m_data(AZStd::exchange(rhs.m_data, nullptr))
+        , m_size(AZStd::exchange(rhs.m_size, 0))
+        , m_platformHandle(AZStd::exchange(rhs.m_platformHandle, nullptr))
+    {
+    }
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& rhs)
+    {
+        if (this != &rhs)
+        {
+            Close();
+            m_data = AZStd::exchange(rhs.m_data, nullptr);
+            m_size = AZStd::exchange(rhs.m_size, 0);
+            m_platformHandle = AZStd::exchange(rhs.m_platformHandle, nullptr);
+        }
+        return *this;
+    }
+
+    bool MappedFile::Open(const char* fileName)
+    {
+        Close();
+        return PlatformOpen(fileName);
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data)
+        {
+            PlatformClose();
+            m_data = nullptr;
+            m_size = 0;
+            m_platformHandle = nullptr;
+        }
+    }
+
+    bool MappedFile::IsOpen() const
+    {
+        return m_data != nullptr;
+    }
+
+    const u8* MappedFile::GetData() const
+    {
+        return m_data;
+    }
+
+    u64 MappedFile::GetSize() const
+    {
+        return m_size;
+    }
+} // namespace AZ::IO
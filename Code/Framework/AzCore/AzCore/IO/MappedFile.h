@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::IO
+{
+    //! Read-only memory mapping of an entire file. Reading from the mapped memory costs a page fault the first time a page
+    //! is touched instead of a system call and a copy for every read, which is much cheaper for many small reads from
+    //! the same file. The file can't be modified through the mapping and needs to stay unchanged while it's mapped.
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile(MappedFile&& rhs);
+        ~MappedFile();
+
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile& operator=(MappedFile&& rhs);
+
+        //! Maps the file at the provided path. The path needs to be an absolute path without aliases.
+        //! @return True if the file was mapped, false if the file couldn't be opened, is empty or the mapping failed.
+        bool Open(const char* fileName);
+        void Close();
+
+        bool IsOpen() const;
+        const u8* GetData() const;
+        u64 GetSize() const;
+
+    private:
+        bool PlatformOpen(const char* fileName);
+        void PlatformClose();
+
+        const u8* m_data{ nullptr };
+        u64 m_size{ 0 };
+        //! Handle used by platforms that need to keep an object alive for the duration of the mapping.
+        void* m_platformHandle{ nullptr };
+    };
+} // namespace AZ::IO
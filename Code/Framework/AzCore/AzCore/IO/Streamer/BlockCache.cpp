@@ -46,7 +46,8 @@ namespace AZ::IO
         }
 
         auto stackEntry = AZStd::make_shared<BlockCache>(
-            cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), false);
+            cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), false,
+            m_readAheadDepth);
         stackEntry->SetNext(AZStd::move(parent));
         return stackEntry;
     }
@@ -62,14 +63,16 @@ namespace AZ::IO
                 ->Value("SizeAlignment", BlockSize::SizeAlignment);
 
             serializeContext->Class<BlockCacheConfig, IStreamerStackConfig>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("CacheSizeMib", &BlockCacheConfig::m_cacheSizeMib)
-                ->Field("BlockSize", &BlockCacheConfig::m_blockSize);
+                ->Field("BlockSize", &BlockCacheConfig::m_blockSize)
+                ->Field("ReadAheadDepth", &BlockCacheConfig::m_readAheadDepth);
         }
     }
 
     static constexpr char CacheHitRateName[] = "Cache hit rate";
     static constexpr char CacheableName[] = "Cacheable";
+    static constexpr char PrefetchHitRateName[] = "Prefetch hit rate";
 
     void BlockCache::Section::Prefix(const Section& section)
     {
@@ -99,9 +102,10 @@ namespace AZ::IO
         m_blockOffset = 0; // Two merged sections do not support caching.
     }
 
-    BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites)
+    BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites, u32 readAheadDepth)
         : StreamStackEntry("Block cache")
         , m_alignment(alignment)
+        , m_readAheadDepth(readAheadDepth)
         , m_onlyEpilogWrites(onlyEpilogWrites)
     {
         AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
@@ -121,6 +125,9 @@ namespace AZ::IO
         m_cachedOffsets = AZStd::unique_ptr<u64[]>(new u64[m_numBlocks]);
         m_blockLastTouched = AZStd::unique_ptr<TimePoint[]>(new TimePoint[m_numBlocks]);
         m_inFlightRequests = AZStd::unique_ptr<FileRequest*[]>(new FileRequest*[m_numBlocks]);
+        m_blockFlags = AZStd::unique_ptr<u8[]>(new u8[m_numBlocks]());
+        // Keep a quarter of the blocks available for new data so there's room to detect which blocks are reused.
+        m_maxNumProtectedBlocks = m_numBlocks - AZStd::max(m_numBlocks / 4, 1u);
 
         ResetCache();
     }
@@ -278,6 +285,10 @@ namespace AZ::IO
 
         auto& data = AZStd::get<Requests::ReadData>(request->GetCommand());
 
+        // Readahead only helps reads that are smaller than a block because larger reads bypass the cache for the most part.
+        const bool readAhead = m_readAheadDepth > 0 && data.m_size < m_blockSize &&
+            TrackSequentialAccess(data.m_path, data.m_offset, data.m_size) >= s_sequentialRunThreshold;
+
         if (!SplitRequest(prolog, main, epilog, data.m_path, fileLength, data.m_offset, data.m_size,
             reinterpret_cast<u8*>(data.m_output)))
         {
@@ -355,6 +366,12 @@ namespace AZ::IO
             Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
         }
 
+        if (readAhead)
+        {
+            // Queue the readahead before the request is marked as completed as the path is owned by the request.
+            ReadAhead(data.m_path, fileLength, data.m_offset + data.m_size, data.m_sharedRead);
+        }
+
         if (fullyCached)
         {
             request->SetStatus(IStreamerTypes::RequestStatus::Completed);
@@ -362,6 +379,78 @@ namespace AZ::IO
         }
     }
 
+    u32 BlockCache::TrackSequentialAccess(const RequestPath& filePath, u64 offset, u64 size)
+    {
+        TimePoint now = AZStd::chrono::steady_clock::now();
+        SequentialStream* oldest = &m_sequentialStreams[0];
+        for (SequentialStream& stream : m_sequentialStreams)
+        {
+            if (stream.m_path == filePath)
+            {
+                stream.m_runLength = (stream.m_nextOffset == offset) ? stream.m_runLength + 1 : 0;
+                stream.m_nextOffset = offset + size;
+                stream.m_lastAccess = now;
+                return stream.m_runLength;
+            }
+            if (stream.m_lastAccess < oldest->m_lastAccess)
+            {
+                oldest = &stream;
+            }
+        }
+
+        oldest->m_path = filePath;
+        oldest->m_nextOffset = offset + size;
+        oldest->m_runLength = 0;
+        oldest->m_lastAccess = now;
+        return 0;
+    }
+
+    void BlockCache::ReadAhead(const RequestPath& filePath, u64 fileLength, u64 offset, bool sharedRead)
+    {
+        // The block the read ends in is already cached by the epilog, so start at the block after it.
+        u64 blockOffset = AZ_SIZE_ALIGN_UP(offset, aznumeric_cast<u64>(m_blockSize));
+        for (u32 i = 0; i < m_readAheadDepth && blockOffset < fileLength; ++i, blockOffset += m_blockSize)
+        {
+            // Leave at least half the cache for requests that are actually waiting for data.
+            if (!m_delayedSections.empty() || CalculateAvailableRequestSlots() <= aznumeric_cast<s32>(m_numBlocks / 2))
+            {
+                return;
+            }
+            if (FindInCache(filePath, blockOffset) != s_fileNotCached)
+            {
+                continue;
+            }
+            // Readahead is speculative so it's not allowed to push out blocks that are known to be reused.
+            u32 cacheLocation = RecycleOldestBlock(filePath, blockOffset, false);
+            if (cacheLocation == s_fileNotCached)
+            {
+                return;
+            }
+
+            FileRequest* readRequest = m_context->GetNewInternalRequest();
+            readRequest->CreateRead(nullptr, GetCacheBlockData(cacheLocation), m_blockSize, filePath, blockOffset,
+                AZStd::min(aznumeric_cast<u64>(m_blockSize), fileLength - blockOffset), sharedRead);
+            readRequest->SetCompletionCallback([this](FileRequest& request)
+                {
+                    AZ_PROFILE_FUNCTION(AzCore);
+                    CompleteRead(request);
+                });
+
+            Section section;
+            section.m_readOffset = blockOffset;
+            section.m_readSize = m_blockSize;
+            section.m_cacheBlockIndex = cacheLocation;
+            section.m_used = true;
+            m_pendingRequests.emplace(readRequest, section);
+
+            m_blockFlags[cacheLocation] |= BlockFlag_Prefetched;
+            m_inFlightRequests[cacheLocation] = readRequest;
+            m_numInFlightRequests++;
+            m_numPrefetches++;
+            m_next->QueueRequest(readRequest);
+        }
+    }
+
     void BlockCache::FlushCache(const RequestPath& filePath)
     {
         for (u32 i = 0; i < m_numBlocks; ++i)
@@ -394,6 +483,23 @@ namespace AZ::IO
             m_name, "Available slots", CalculateAvailableRequestSlots(),
             "The total number of slots available to processing cache-able requests with. If this value is low more memory may need to be "
             "allocated to the cache so more slots are available."));
+        if (m_readAheadDepth > 0)
+        {
+            statistics.push_back(Statistic::CreateInteger(
+                m_name, "Prefetched blocks", aznumeric_caster(m_numPrefetches),
+                "The total number of blocks that were read ahead because a file was being read sequentially."));
+            statistics.push_back(Statistic::CreatePercentage(
+                m_name, PrefetchHitRateName, CalculatePrefetchHitRatePercentage(),
+                "The percentage of blocks that were read ahead and later used by a request. Low values mean the readahead depth "
+                "is too large for the access patterns or the cache is too small to hold the blocks until they're needed."));
+            statistics.push_back(Statistic::CreateInteger(
+                m_name, "Wasted prefetches", aznumeric_caster(m_numPrefetchesWasted),
+                "The total number of blocks that were read ahead but were recycled or flushed before they were used."));
+        }
+        statistics.push_back(Statistic::CreateInteger(
+            m_name, "Protected blocks", m_numProtectedBlocks,
+            "The number of blocks that have been reused since they were read. These are only recycled when there are no other blocks "
+            "available, which prevents large one-off reads from flushing frequently used data out of the cache."));
 
         StreamStackEntry::CollectStatistics(statistics);
     }
@@ -408,6 +514,11 @@ namespace AZ::IO
         return m_cacheableStat.GetAverage();
     }
 
+    double BlockCache::CalculatePrefetchHitRatePercentage() const
+    {
+        return m_numPrefetches > 0 ? aznumeric_cast<double>(m_numPrefetchHits) / aznumeric_cast<double>(m_numPrefetches) : 0.0;
+    }
+
     s32 BlockCache::CalculateAvailableRequestSlots() const
     {
         return  aznumeric_cast<s32>(m_numBlocks) - m_numInFlightRequests - m_numMetaDataRetrievalInProgress -
@@ -429,6 +540,7 @@ namespace AZ::IO
 
     BlockCache::CacheResult BlockCache::ReadFromCache(FileRequest* request, Section& section, u32 cacheBlock)
     {
+        ProtectBlock(cacheBlock);
         if (!IsCacheBlockInFlight(cacheBlock))
         {
             TouchBlock(cacheBlock);
@@ -537,7 +649,8 @@ namespace AZ::IO
                 section.m_wait = nullptr;
             }
 
-            if (requestWasSuccessful)
+            // Readahead sections don't have an output as they only fill the cache.
+            if (requestWasSuccessful && section.m_output)
             {
                 memcpy(section.m_output, GetCacheBlockData(cacheBlockIndex) + section.m_blockOffset, section.m_copySize);
             }
@@ -691,25 +804,71 @@ namespace AZ::IO
         m_blockLastTouched[index] = AZStd::chrono::steady_clock::now();
     }
 
-    u32 BlockCache::RecycleOldestBlock(const RequestPath& filePath, u64 offset)
+    void BlockCache::ProtectBlock(u32 index)
+    {
+        AZ_Assert(index < m_numBlocks, "Index for protecting a cache entry in the BlockCache is out of bounds.");
+
+        if (m_blockFlags[index] & BlockFlag_Prefetched)
+        {
+            m_numPrefetchHits++;
+            Statistic::PlotImmediate(m_name, PrefetchHitRateName, CalculatePrefetchHitRatePercentage());
+        }
+        if (m_blockFlags[index] & BlockFlag_Protected)
+        {
+            m_blockFlags[index] = BlockFlag_Protected;
+            return;
+        }
+        m_blockFlags[index] = BlockFlag_Protected;
+        m_numProtectedBlocks++;
+
+        if (m_numProtectedBlocks > m_maxNumProtectedBlocks)
+        {
+            // Move the least recently used protected block back on probation.
+            u32 oldestIndex = s_fileNotCached;
+            for (u32 i = 0; i < m_numBlocks; ++i)
+            {
+                if (i != index && (m_blockFlags[i] & BlockFlag_Protected) &&
+                    (oldestIndex == s_fileNotCached || m_blockLastTouched[i] < m_blockLastTouched[oldestIndex]))
+                {
+                    oldestIndex = i;
+                }
+            }
+            if (oldestIndex != s_fileNotCached)
+            {
+                m_blockFlags[oldestIndex] &= ~BlockFlag_Protected;
+                m_numProtectedBlocks--;
+            }
+        }
+    }
+
+    u32 BlockCache::RecycleOldestBlock(const RequestPath& filePath, u64 offset, bool allowProtected)
     {
         AZ_Assert((offset & (m_blockSize - 1)) == 0, "The offset used to recycle a block cache needs to be a multiple of the block size.");
 
-        // Find the oldest cache block.
-        TimePoint oldest = m_blockLastTouched[0];
-        u32 oldestIndex = 0;
-        for (u32 i = 1; i < m_numBlocks; ++i)
+        // Find the oldest cache block that's on probation and if there are none, the oldest protected block.
+        u32 oldestIndex = s_fileNotCached;
+        u32 oldestProtectedIndex = s_fileNotCached;
+        for (u32 i = 0; i < m_numBlocks; ++i)
         {
-            if (m_blockLastTouched[i] < oldest && !m_inFlightRequests[i])
+            if (m_inFlightRequests[i])
             {
-                oldest = m_blockLastTouched[i];
-                oldestIndex = i;
+                continue;
             }
+            u32& candidate = (m_blockFlags[i] & BlockFlag_Protected) ? oldestProtectedIndex : oldestIndex;
+            if (candidate == s_fileNotCached || m_blockLastTouched[i] < m_blockLastTouched[candidate])
+            {
+                candidate = i;
+            }
+        }
+        if (oldestIndex == s_fileNotCached && allowProtected)
+        {
+            oldestIndex = oldestProtectedIndex;
         }
 
-        if (!IsCacheBlockInFlight(oldestIndex))
+        if (oldestIndex != s_fileNotCached)
         {
             // Recycle the block.
+            ResetCacheEntry(oldestIndex);
             m_cachedPaths[oldestIndex] = filePath;
             m_cachedOffsets[oldestIndex] = offset;
             TouchBlock(oldestIndex);
@@ -745,10 +904,19 @@ namespace AZ::IO
     {
         AZ_Assert(index < m_numBlocks, "Index for resetting a cache entry in the BlockCache is out of bounds.");
 
+        if (m_blockFlags[index] & BlockFlag_Prefetched)
+        {
+            m_numPrefetchesWasted++;
+        }
+        if (m_blockFlags[index] & BlockFlag_Protected)
+        {
+            m_numProtectedBlocks--;
+        }
         m_cachedPaths[index].Clear();
         m_cachedOffsets[index] = 0;
         m_blockLastTouched[index] = TimePoint::min();
         m_inFlightRequests[index] = nullptr;
+        m_blockFlags[index] = BlockFlag_None;
     }
 
     void BlockCache::ResetCache()
@@ -758,6 +926,7 @@ namespace AZ::IO
             ResetCacheEntry(i);
         }
         m_numInFlightRequests = 0;
+        m_numProtectedBlocks = 0;
     }
 
     void BlockCache::Report(const Requests::ReportData& data) const
@@ -783,6 +952,13 @@ namespace AZ::IO
             data.m_output.push_back(Statistic::CreateBoolean(
                 m_name, "Only epilog writes", m_onlyEpilogWrites,
                 "Whether or not only the epilog is considered or that both prolog and epilog are used for caching."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Readahead depth", m_readAheadDepth,
+                "The number of blocks that are read ahead when a file is read sequentially with reads smaller than a block. If "
+                "zero, readahead is disabled."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max protected blocks", m_maxNumProtectedBlocks,
+                "The maximum number of reused blocks that are protected from being recycled in favor of new data."));
             data.m_output.push_back(Statistic::CreateReferenceString(
                 m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
                 "The name of the node that follows this node or none."));
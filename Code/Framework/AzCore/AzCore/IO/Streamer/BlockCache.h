@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/IO/Streamer/RequestPath.h>
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
@@ -15,13 +16,13 @@
 #include <AzCore/Statistics/RunningStatistic.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AZ::IO
 {
-    class RequestPath;
     namespace Requests
     {
         struct ReadData;
@@ -55,13 +56,16 @@ namespace AZ::IO
         u32 m_cacheSizeMib{ 8 };
         //! The size of the individual blocks inside the cache.
         BlockSize m_blockSize{ BlockSize::MemoryAlignment };
+        //! The number of blocks to read ahead when a file is read sequentially with reads that are smaller than a block. Set
+        //! to 0 to disable readahead.
+        u32 m_readAheadDepth{ 0 };
     };
 
     class BlockCache
         : public StreamStackEntry
     {
     public:
-        BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites);
+        BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites, u32 readAheadDepth = 0);
         BlockCache(BlockCache&& rhs) = delete;
         BlockCache(const BlockCache& rhs) = delete;
         ~BlockCache() override;
@@ -85,10 +89,35 @@ namespace AZ::IO
 
         double CalculateHitRatePercentage() const;
         double CalculateCacheableRatePercentage() const;
+        double CalculatePrefetchHitRatePercentage() const;
         s32 CalculateAvailableRequestSlots() const;
 
     protected:
+        using TimePoint = AZStd::chrono::steady_clock::time_point;
+
         static constexpr u32 s_fileNotCached = static_cast<u32>(-1);
+        //! The number of files that are tracked for sequential access at the same time.
+        static constexpr size_t s_numTrackedStreams = 8;
+        //! The number of back-to-back reads a file needs before it's considered to be read sequentially.
+        static constexpr u32 s_sequentialRunThreshold = 2;
+
+        //! Blocks start out on probation and are protected once they're read from again. Blocks on probation are recycled first,
+        //! so a single scan through a large file can't push out blocks that are frequently used.
+        enum BlockFlags : u8
+        {
+            BlockFlag_None = 0,
+            BlockFlag_Protected = 1 << 0, //!< The block has been reused since it was read.
+            BlockFlag_Prefetched = 1 << 1 //!< The block was read ahead and hasn't been used yet.
+        };
+
+        //! Tracks where the last read of a file ended to detect sequential access.
+        struct SequentialStream
+        {
+            RequestPath m_path;
+            TimePoint m_lastAccess{ TimePoint::min() };
+            u64 m_nextOffset{ 0 };
+            u32 m_runLength{ 0 };
+        };
 
         enum class CacheResult
         {
@@ -114,8 +143,6 @@ namespace AZ::IO
             void Prefix(const Section& section);
         };
 
-        using TimePoint = AZStd::chrono::steady_clock::time_point;
-
         void ReadFile(FileRequest* request, Requests::ReadData& data);
         void ContinueReadFile(FileRequest* request, u64 fileLength);
         CacheResult ReadFromCache(FileRequest* request, Section& section, const RequestPath& filePath);
@@ -125,9 +152,13 @@ namespace AZ::IO
         bool SplitRequest(Section& prolog, Section& main, Section& epilog, const RequestPath& filePath, u64 fileLength,
             u64 offset, u64 size, u8* buffer) const;
 
+        u32 TrackSequentialAccess(const RequestPath& filePath, u64 offset, u64 size);
+        void ReadAhead(const RequestPath& filePath, u64 fileLength, u64 offset, bool sharedRead);
+
         u8* GetCacheBlockData(u32 index);
         void TouchBlock(u32 index);
-        AZ::u32 RecycleOldestBlock(const RequestPath& filePath, u64 offset);
+        void ProtectBlock(u32 index);
+        AZ::u32 RecycleOldestBlock(const RequestPath& filePath, u64 offset, bool allowProtected = true);
         u32 FindInCache(const RequestPath& filePath, u64 offset) const;
         bool IsCacheBlockInFlight(u32 index) const;
         void ResetCacheEntry(u32 index);
@@ -157,6 +188,18 @@ namespace AZ::IO
         AZStd::unique_ptr<TimePoint[]> m_blockLastTouched; // Array of m_numBlocks size.
         //! The file request that's currently read data into the cache block. If null, the block has been read.
         AZStd::unique_ptr<FileRequest*[]> m_inFlightRequests; // Array of m_numbBlocks size.
+        //! Combination of BlockFlags for the cache block.
+        AZStd::unique_ptr<u8[]> m_blockFlags; // Array of m_numBlocks size.
+
+        //! The most recently read files and where their last read ended.
+        AZStd::array<SequentialStream, s_numTrackedStreams> m_sequentialStreams;
+
+        u64 m_numPrefetches{ 0 }; //!< The number of blocks that were read ahead.
+        u64 m_numPrefetchHits{ 0 }; //!< The number of blocks that were read ahead and later used.
+        u64 m_numPrefetchesWasted{ 0 }; //!< The number of blocks that were read ahead but recycled or flushed before use.
+        u32 m_numProtectedBlocks{ 0 };
+        u32 m_maxNumProtectedBlocks{ 0 };
+        u32 m_readAheadDepth{ 0 };
 
         //! The number of requests waiting for meta data to be retrieved.
         s32 m_numMetaDataRetrievalInProgress{ 0 };
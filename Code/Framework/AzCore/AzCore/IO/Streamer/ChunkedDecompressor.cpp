@@ -0,0 +1,653 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/ChunkedDecompressor.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> ChunkedDecompressorConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        auto stackEntry = AZStd::make_shared<ChunkedDecompressor>(
+            m_maxNumReads, m_numThreads, m_maxNumCachedIndices, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void ChunkedDecompressorConfig::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<ChunkedDecompressorConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxNumReads", &ChunkedDecompressorConfig::m_maxNumReads)
+                ->Field("NumThreads", &ChunkedDecompressorConfig::m_numThreads)
+                ->Field("MaxNumCachedIndices", &ChunkedDecompressorConfig::m_maxNumCachedIndices);
+        }
+    }
+
+    // The number of bytes read from the start of a chunked file to get the header. This covers the index of files up to a few hundred
+    // blocks, so in most cases the index doesn't need a second read.
+    static constexpr size_t IndexProbeSize = 4096;
+
+    ChunkedDecompressor::ChunkedDecompressor(u32 maxNumReads, u32 numThreads, u32 maxNumCachedIndices, u32 alignment)
+        : StreamStackEntry("Chunked decompressor")
+        , m_maxNumReads(AZStd::max(maxNumReads, 1u))
+        , m_maxNumCachedIndices(maxNumCachedIndices)
+        , m_alignment(AZStd::max(alignment, 1u))
+    {
+        m_numThreads = numThreads != 0 ? AZStd::min(numThreads, AZStd::thread::hardware_concurrency()) : 0;
+        m_executor = AZStd::make_unique<TaskExecutor>(m_numThreads);
+        m_readSlots = AZStd::make_unique<ReadSlot[]>(m_maxNumReads);
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_bytesDecompressed.PushEntry(1);
+        m_decompressionDurationMicroSec.PushEntry(1);
+    }
+
+    ChunkedDecompressor::~ChunkedDecompressor()
+    {
+        // Stop the executor before the slots the tasks write to are released.
+        m_executor.reset();
+        for (u32 i = 0; i < m_maxNumReads; ++i)
+        {
+            if (m_readSlots[i].m_buffer)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(m_readSlots[i].m_buffer, m_readSlots[i].m_bufferSize, m_alignment);
+            }
+        }
+    }
+
+    void ChunkedDecompressor::QueueRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                if (IsChunkedRead(args))
+                {
+                    m_pendingReads.push_back(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool ChunkedDecompressor::ExecuteRequests()
+    {
+        bool result = false;
+        while (!m_pendingReads.empty() && m_numInFlightReads < m_maxNumReads)
+        {
+            StartRead(m_pendingReads.front());
+            m_pendingReads.pop_front();
+            result = true;
+        }
+        return StreamStackEntry::ExecuteRequests() || result;
+    }
+
+    void ChunkedDecompressor::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        s32 numAvailableSlots = aznumeric_cast<s32>(m_maxNumReads - m_numInFlightReads);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, numAvailableSlots);
+        status.m_isIdle = status.m_isIdle && IsIdle();
+    }
+
+    void ChunkedDecompressor::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        AZStd::reverse_copy(m_pendingReads.begin(), m_pendingReads.end(), AZStd::back_inserter(internalPending));
+
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        double totalBytesDecompressed = aznumeric_caster(m_bytesDecompressed.GetTotal());
+        double totalDecompressionDuration = aznumeric_caster(m_decompressionDurationMicroSec.GetTotal());
+
+        // Blocks are decompressed in parallel, so the slot that finishes first determines when new work can start.
+        AZStd::chrono::microseconds cumulativeDelay = AZStd::chrono::microseconds::max();
+        for (u32 i = 0; i < m_maxNumReads; ++i)
+        {
+            const ReadSlot& slot = m_readSlots[i];
+            if (slot.m_status == ReadSlotStatus::Unused || !slot.m_activeRequest)
+            {
+                continue;
+            }
+
+            const double bytesToDecompress = aznumeric_caster(slot.m_bufferSize);
+            auto decompressionDuration = AZStd::chrono::microseconds(
+                aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDuration) / (totalBytesDecompressed * AZStd::max(m_numThreads, 1u))));
+            AZStd::chrono::steady_clock::time_point completion;
+            if (slot.m_status == ReadSlotStatus::Decompressing)
+            {
+                auto timeInProcessing = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - slot.m_jobStartTime);
+                completion = now + (decompressionDuration > timeInProcessing ? decompressionDuration - timeInProcessing
+                                                                             : AZStd::chrono::microseconds(0));
+            }
+            else
+            {
+                // Internal read requests can start and complete before they're ever scheduled in which case the estimated
+                // time is not set.
+                completion = slot.m_activeRequest->GetEstimatedCompletion();
+                if (completion == AZStd::chrono::steady_clock::time_point())
+                {
+                    completion = now;
+                }
+                completion += decompressionDuration;
+            }
+            slot.m_activeRequest->SetEstimatedCompletion(completion);
+            cumulativeDelay = AZStd::min(cumulativeDelay, AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(completion - now));
+        }
+        if (cumulativeDelay == AZStd::chrono::microseconds::max())
+        {
+            cumulativeDelay = AZStd::chrono::microseconds(0);
+        }
+
+        // The read time will have already been added downstream. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto pendingIt = internalPending.rbegin(); pendingIt != internalPending.rend(); ++pendingIt)
+        {
+            EstimateCompressedReadRequest(*pendingIt, cumulativeDelay, totalDecompressionDuration, totalBytesDecompressed);
+        }
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompressedReadRequest(*requestIt, cumulativeDelay, totalDecompressionDuration, totalBytesDecompressed);
+        }
+    }
+
+    void ChunkedDecompressor::EstimateCompressedReadRequest(FileRequest* request, AZStd::chrono::microseconds& cumulativeDelay,
+        double totalDecompressionDurationUs, double totalBytesDecompressed) const
+    {
+        auto data = AZStd::get_if<Requests::CompressedReadData>(&request->GetCommand());
+        if (data && IsChunkedRead(*data))
+        {
+            // Only the blocks overlapping the read are decompressed, so estimate with the compression ratio of the whole file.
+            const CompressionInfo& info = data->m_compressionInfo;
+            const double ratio = info.m_uncompressedSize > 0
+                ? aznumeric_cast<double>(info.m_compressedSize) / aznumeric_cast<double>(info.m_uncompressedSize)
+                : 1.0;
+            const double bytesToDecompress = aznumeric_cast<double>(data->m_readSize) * ratio;
+            AZStd::chrono::microseconds processingTime = AZStd::chrono::microseconds(
+                aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDurationUs) / (totalBytesDecompressed * AZStd::max(m_numThreads, 1u))));
+
+            cumulativeDelay += processingTime;
+            request->SetEstimatedCompletion(request->GetEstimatedCompletion() + processingTime);
+        }
+    }
+
+    void ChunkedDecompressor::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        constexpr double usToSec = 1.0 / (1000.0 * 1000.0);
+
+        if (m_bytesDecompressed.GetNumRecorded() > 1) // There's always a default added.
+        {
+            statistics.push_back(Statistic::CreateInteger(
+                m_name, "Available read slots", m_maxNumReads - m_numInFlightReads,
+                "The number of slots available to queue read requests into. A slot stays in use until all the blocks for the read have "
+                "been decompressed."));
+            statistics.push_back(Statistic::CreateByteSize(
+                m_name, "Buffer memory", m_memoryUsage,
+                "The total amount of memory used by the decompressor for the compressed blocks that are being read or decompressed."));
+            statistics.push_back(Statistic::CreateFloat(
+                m_name, "Blocks per request (avg.)", m_blocksPerRequest.CalculateAverage(),
+                "The average number of blocks read and decompressed per request. If this is close to one for small reads, consider "
+                "a smaller block size when creating the archive to reduce the amount of data that's decompressed but not used."));
+            statistics.push_back(Statistic::CreateByteSize(
+                m_name, "Skipped compressed data", m_bytesSkipped,
+                "The total amount of compressed data that didn't need to be read or decompressed because it was outside the "
+                "requested ranges."));
+
+            const u64 indexLookups = m_indexCacheHits + m_indexCacheMisses;
+            statistics.push_back(Statistic::CreatePercentage(
+                m_name, "Index cache hit rate",
+                indexLookups > 0 ? aznumeric_cast<double>(m_indexCacheHits) / aznumeric_cast<double>(indexLookups) : 0.0,
+                "The percentage of reads for which the block index was already available. Misses need an additional read. Increase "
+                "the maximum number of cached indices if this value is low and a small set of files is frequently read."));
+
+            u64 totalBytesDecompressed = m_bytesDecompressed.GetTotal();
+            double totalDecompressionTimeSec = m_decompressionDurationMicroSec.GetTotal() * usToSec;
+            statistics.push_back(Statistic::CreateBytesPerSecond(
+                m_name, "Decompression Speed per request", totalBytesDecompressed / totalDecompressionTimeSec,
+                "The average speed at which the compressed data of a request is decompressed. Blocks are decompressed in parallel, so "
+                "adding threads increases this speed for reads that overlap multiple blocks."));
+        }
+
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    bool ChunkedDecompressor::IsChunkedRead(const Requests::CompressedReadData& data)
+    {
+        return data.m_compressionInfo.m_isCompressed &&
+            data.m_compressionInfo.m_compressionTag.m_code == ChunkedCompression::Tag.m_code;
+    }
+
+    bool ChunkedDecompressor::IsIdle() const
+    {
+        return m_pendingReads.empty() && m_numInFlightReads == 0;
+    }
+
+    void ChunkedDecompressor::StartRead(FileRequest* compressedRequest)
+    {
+        if (!m_next)
+        {
+            compressedRequest->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(compressedRequest);
+            return;
+        }
+
+        for (u32 i = 0; i < m_maxNumReads; ++i)
+        {
+            ReadSlot& slot = m_readSlots[i];
+            if (slot.m_status != ReadSlotStatus::Unused)
+            {
+                continue;
+            }
+
+            auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
+            AZ_Assert(data, "Compressed request that's starting a read in ChunkedDecompressor didn't contain compression read data.");
+            slot.m_compressedRequest = compressedRequest;
+            slot.m_failed = false;
+
+            AZ_Assert(m_numInFlightReads < m_maxNumReads,
+                "A FileRequest was queued for reading in ChunkedDecompressor, but there's no slots available.");
+            m_numInFlightReads++;
+
+            const CompressionInfo& info = data->m_compressionInfo;
+            slot.m_index = FindIndex(info.m_archiveFilename, info.m_offset);
+            if (slot.m_index)
+            {
+                ++m_indexCacheHits;
+                StartBlockRead(i);
+            }
+            else
+            {
+                ++m_indexCacheMisses;
+                StartIndexRead(i, AZStd::min(IndexProbeSize, info.m_compressedSize));
+            }
+            return;
+        }
+        AZ_Assert(false, "%u of %u read slots are use in the ChunkedDecompressor, but no empty slot was found.", m_numInFlightReads, m_maxNumReads);
+    }
+
+    u8* ChunkedDecompressor::AllocateBuffer(u32 slotIndex, u64 offset, u64 size)
+    {
+        ReadSlot& slot = m_readSlots[slotIndex];
+        AZ_Assert(!slot.m_buffer, "Read slot %u in the ChunkedDecompressor still has a buffer assigned.", slotIndex);
+
+        // The buffer is aligned down but the offset is not corrected. If the offset was adjusted it would mean the same data is read
+        // multiple times and negates the block cache's ability to detect these cases. By still adjusting it means that the reads between
+        // the BlockCache's prolog and epilog are read into aligned buffers.
+        slot.m_alignmentOffset = aznumeric_cast<size_t>(offset - AZ_SIZE_ALIGN_DOWN(offset, aznumeric_cast<u64>(m_alignment)));
+        slot.m_bufferSize = AZ_SIZE_ALIGN_UP(aznumeric_cast<size_t>(size) + slot.m_alignmentOffset, aznumeric_cast<size_t>(m_alignment));
+        slot.m_buffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(slot.m_bufferSize, m_alignment));
+        m_memoryUsage += slot.m_bufferSize;
+        return slot.m_buffer + slot.m_alignmentOffset;
+    }
+
+    void ChunkedDecompressor::StartIndexRead(u32 slotIndex, size_t indexSize)
+    {
+        ReadSlot& slot = m_readSlots[slotIndex];
+        auto data = AZStd::get_if<Requests::CompressedReadData>(&slot.m_compressedRequest->GetCommand());
+        const CompressionInfo& info = data->m_compressionInfo;
+
+        u8* output = AllocateBuffer(slotIndex, info.m_offset, indexSize);
+        FileRequest* indexReadRequest = m_context->GetNewInternalRequest();
+        indexReadRequest->CreateRead(slot.m_compressedRequest, output, slot.m_bufferSize - slot.m_alignmentOffset, info.m_archiveFilename,
+            info.m_offset, indexSize, info.m_isSharedPak);
+        indexReadRequest->SetCompletionCallback(
+            [this, slotIndex](FileRequest& request)
+            {
+                AZ_PROFILE_FUNCTION(AzCore);
+                FinishIndexRead(&request, slotIndex);
+            });
+        slot.m_activeRequest = indexReadRequest;
+        slot.m_status = ReadSlotStatus::ReadingIndex;
+        m_next->QueueRequest(indexReadRequest);
+    }
+
+    void ChunkedDecompressor::FinishIndexRead(FileRequest* readRequest, u32 slotIndex)
+    {
+        ReadSlot& slot = m_readSlots[slotIndex];
+        AZ_Assert(slot.m_activeRequest == readRequest, "Request in the index read slot isn't the same as request that's being completed.");
+
+        auto readData = AZStd::get_if<Requests::ReadData>(&readRequest->GetCommand());
+        AZ_Assert(readData, "Index read in ChunkedDecompressor didn't contain read data.");
+        const u64 bytesRead = readData->m_size;
+
+        if (readRequest->GetStatus() != IStreamerTypes::RequestStatus::Completed)
+        {
+            // The failed or canceled read marks the compressed request with the same status.
+            ReleaseSlot(slotIndex);
+            return;
+        }
+
+        auto data = AZStd::get_if<Requests::CompressedReadData>(&slot.m_compressedRequest->GetCommand());
+        const CompressionInfo& info = data->m_compressionInfo;
+        const u8* indexData = slot.m_buffer + slot.m_alignmentOffset;
+
+        auto index = AZStd::make_shared<BlockIndex>();
+        if (!ChunkedCompression::ReadHeader(index->m_header, indexData, bytesRead))
+        {
+            AZ_Error("ChunkedDecompressor", false, "File '%s' at offset %zu doesn't contain a valid chunked compression header.",
+                info.m_archiveFilename.GetRelativePathCStr(), info.m_offset);
+            FailRequest(slotIndex);
+            return;
+        }
+
+        const size_t indexSize = ChunkedCompression::GetIndexSize(index->m_header.m_blockCount);
+        if (indexSize > info.m_compressedSize || index->m_header.m_uncompressedSize != info.m_uncompressedSize)
+        {
+            AZ_Error("ChunkedDecompressor", false, "The chunked compression header in file '%s' at offset %zu doesn't match the archive.",
+                info.m_archiveFilename.GetRelativePathCStr(), info.m_offset);
+            FailRequest(slotIndex);
+            return;
+        }
+
+        if (indexSize > bytesRead)
+        {
+            // The index is larger than the initial probe, so read the full index.
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(slot.m_buffer, slot.m_bufferSize, m_alignment);
+            m_memoryUsage -= slot.m_bufferSize;
+            slot.m_buffer = nullptr;
+            StartIndexRead(slotIndex, indexSize);
+            return;
+        }
+
+        if (!ChunkedCompression::ReadBlockIndex(index->m_blocks, index->m_header, indexData, bytesRead))
+        {
+            AZ_Error("ChunkedDecompressor", false, "The chunked compression block index in file '%s' at offset %zu is corrupted.",
+                info.m_archiveFilename.GetRelativePathCStr(), info.m_offset);
+            FailRequest(slotIndex);
+            return;
+        }
+        index->m_archiveFilename = info.m_archiveFilename;
+        index->m_offset = info.m_offset;
+
+        AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(slot.m_buffer, slot.m_bufferSize, m_alignment);
+        m_memoryUsage -= slot.m_bufferSize;
+        slot.m_buffer = nullptr;
+
+        slot.m_index = index;
+        AddIndex(AZStd::move(index));
+        StartBlockRead(slotIndex);
+    }
+
+    void ChunkedDecompressor::StartBlockRead(u32 slotIndex)
+    {
+        ReadSlot& slot = m_readSlots[slotIndex];
+        auto data = AZStd::get_if<Requests::CompressedReadData>(&slot.m_compressedRequest->GetCommand());
+        const CompressionInfo& info = data->m_compressionInfo;
+        const BlockIndex& index = *slot.m_index;
+
+        if (data->m_readOffset + data->m_readSize > index.m_header.m_uncompressedSize)
+        {
+            AZ_Error("ChunkedDecompressor", false, "Read of %llu bytes at offset %llu is outside the %llu bytes of file '%s'.",
+                data->m_readSize, data->m_readOffset, index.m_header.m_uncompressedSize, info.m_archiveFilename.GetRelativePathCStr());
+            FailRequest(slotIndex);
+            return;
+        }
+        if (data->m_readSize == 0)
+        {
+            FileRequest* waitRequest = m_context->GetNewInternalRequest();
+            waitRequest->CreateWait(slot.m_compressedRequest);
+            waitRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(waitRequest);
+            ReleaseSlot(slotIndex);
+            return;
+        }
+
+        const u64 blockSize = index.m_header.m_blockSize;
+        slot.m_firstBlock = aznumeric_cast<u32>(data->m_readOffset / blockSize);
+        const u32 lastBlock = aznumeric_cast<u32>((data->m_readOffset + data->m_readSize - 1) / blockSize);
+        slot.m_blockCount = lastBlock - slot.m_firstBlock + 1;
+
+        // The blocks are stored in order, so the overlapping blocks can be read with a single read.
+        const ChunkedCompression::Block& first = index.m_blocks[slot.m_firstBlock];
+        const ChunkedCompression::Block& last = index.m_blocks[lastBlock];
+        const u64 readOffset = info.m_offset + first.m_compressedOffset;
+        const u64 readSize = (last.m_compressedOffset + last.m_compressedSize) - first.m_compressedOffset;
+        if (first.m_compressedOffset + readSize > info.m_compressedSize)
+        {
+            AZ_Error("ChunkedDecompressor", false, "The chunked compression block index in file '%s' at offset %zu points outside the file.",
+                info.m_archiveFilename.GetRelativePathCStr(), info.m_offset);
+            FailRequest(slotIndex);
+            return;
+        }
+        m_bytesSkipped += (info.m_compressedSize - ChunkedCompression::GetIndexSize(index.m_header.m_blockCount)) - readSize;
+        m_blocksPerRequest.PushEntry(slot.m_blockCount);
+
+        u8* output = AllocateBuffer(slotIndex, readOffset, readSize);
+        FileRequest* blockReadRequest = m_context->GetNewInternalRequest();
+        blockReadRequest->CreateRead(slot.m_compressedRequest, output, slot.m_bufferSize - slot.m_alignmentOffset, info.m_archiveFilename,
+            readOffset, readSize, info.m_isSharedPak);
+        blockReadRequest->SetCompletionCallback(
+            [this, slotIndex](FileRequest& request)
+            {
+                AZ_PROFILE_FUNCTION(AzCore);
+                FinishBlockRead(&request, slotIndex);
+            });
+        slot.m_activeRequest = blockReadRequest;
+        slot.m_status = ReadSlotStatus::ReadingBlocks;
+        m_next->QueueRequest(blockReadRequest);
+    }
+
+    void ChunkedDecompressor::FinishBlockRead(FileRequest* readRequest, u32 slotIndex)
+    {
+        ReadSlot& slot = m_readSlots[slotIndex];
+        AZ_Assert(slot.m_activeRequest == readRequest, "Request in the block read slot isn't the same as request that's being completed.");
+
+        if (readRequest->GetStatus() != IStreamerTypes::RequestStatus::Completed)
+        {
+            ReleaseSlot(slotIndex);
+            return;
+        }
+
+        // Add this wait so the compressed request isn't fully completed yet as only the read part is done. The
+        // last decompression task will finish this wait, which in turn will call FinishDecompression on the main
+        // streaming thread.
+        FileRequest* waitRequest = m_context->GetNewInternalRequest();
+        waitRequest->CreateWait(slot.m_compressedRequest);
+        waitRequest->SetCompletionCallback(
+            [this, slotIndex](FileRequest& request)
+            {
+                AZ_PROFILE_FUNCTION(AzCore);
+                FinishDecompression(&request, slotIndex);
+            });
+        slot.m_activeRequest = waitRequest;
+        slot.m_status = ReadSlotStatus::Decompressing;
+        slot.m_jobStartTime = AZStd::chrono::steady_clock::now();
+
+        AZ::TaskGraph graph{ "Chunked decompression" };
+        AZ::TaskDescriptor decompressDescriptor{ "Decompress block", "Streamer" };
+        AZ::TaskToken decompressTasks = graph.AddTaskGroup(decompressDescriptor, slot.m_blockCount,
+            [this, slotIndex](u32 taskIndex)
+            {
+                DecompressBlock(slotIndex, m_readSlots[slotIndex].m_firstBlock + taskIndex);
+            });
+        AZ::TaskToken completeTask = graph.AddTask(AZ::TaskDescriptor{ "Complete decompression", "Streamer" },
+            [this, slotIndex]()
+            {
+                ReadSlot& slot = m_readSlots[slotIndex];
+                slot.m_activeRequest->SetStatus(
+                    slot.m_failed ? IStreamerTypes::RequestStatus::Failed : IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(slot.m_activeRequest);
+                m_context->WakeUpSchedulingThread();
+            });
+        decompressTasks.Precedes(completeTask);
+        graph.Detach();
+        graph.SubmitOnExecutor(*m_executor);
+    }
+
+    void ChunkedDecompressor::DecompressBlock(u32 slotIndex, u32 blockIndex)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        ReadSlot& slot = m_readSlots[slotIndex];
+        if (slot.m_failed)
+        {
+            return;
+        }
+
+        auto data = AZStd::get_if<Requests::CompressedReadData>(&slot.m_compressedRequest->GetCommand());
+        const BlockIndex& index = *slot.m_index;
+        const ChunkedCompression::Block& block = index.m_blocks[blockIndex];
+        const u8* compressed = slot.m_buffer + slot.m_alignmentOffset +
+            (block.m_compressedOffset - index.m_blocks[slot.m_firstBlock].m_compressedOffset);
+
+        const u64 blockStart = aznumeric_cast<u64>(blockIndex) * index.m_header.m_blockSize;
+        const u64 blockSize = ChunkedCompression::GetUncompressedBlockSize(index.m_header, blockIndex);
+        const u64 readStart = AZStd::max(blockStart, data->m_readOffset);
+        const u64 readEnd = AZStd::min(blockStart + blockSize, data->m_readOffset + data->m_readSize);
+        u8* output = reinterpret_cast<u8*>(data->m_output) + (readStart - data->m_readOffset);
+
+        bool success;
+        if (readStart == blockStart && readEnd == blockStart + blockSize)
+        {
+            // The entire block is requested, so decompress straight into the output.
+            success = ChunkedCompression::DecompressBlock(index.m_header.m_codec, block, compressed, output,
+                aznumeric_cast<size_t>(blockSize), &data->m_compressionInfo);
+        }
+        else
+        {
+            // Only the first and last block can be partially requested, so the temporary buffer is needed at most twice per request.
+            AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[blockSize]);
+            success = ChunkedCompression::DecompressBlock(index.m_header.m_codec, block, compressed, decompressionBuffer.get(),
+                aznumeric_cast<size_t>(blockSize), &data->m_compressionInfo);
+            if (success)
+            {
+                memcpy(output, decompressionBuffer.get() + (readStart - blockStart), readEnd - readStart);
+            }
+        }
+
+        if (!success)
+        {
+            slot.m_failed = true;
+        }
+    }
+
+    void ChunkedDecompressor::FinishDecompression([[maybe_unused]] FileRequest* waitRequest, u32 slotIndex)
+    {
+        ReadSlot& slot = m_readSlots[slotIndex];
+        AZ_Assert(slot.m_activeRequest == waitRequest, "Decompression slot didn't contain the expected wait request.");
+
+        auto endTime = AZStd::chrono::steady_clock::now();
+        m_decompressionDurationMicroSec.PushEntry(
+            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(endTime - slot.m_jobStartTime).count());
+        m_bytesDecompressed.PushEntry(slot.m_bufferSize - slot.m_alignmentOffset);
+
+        if (slot.m_failed)
+        {
+            auto data = AZStd::get_if<Requests::CompressedReadData>(&slot.m_compressedRequest->GetCommand());
+            AZ_Error("ChunkedDecompressor", false, "Failed to decompress blocks %u to %u from file '%s' at offset %zu.",
+                slot.m_firstBlock, slot.m_firstBlock + slot.m_blockCount - 1,
+                data->m_compressionInfo.m_archiveFilename.GetRelativePathCStr(), data->m_compressionInfo.m_offset);
+        }
+        ReleaseSlot(slotIndex);
+    }
+
+    void ChunkedDecompressor::FailRequest(u32 slotIndex)
+    {
+        ReadSlot& slot = m_readSlots[slotIndex];
+        FileRequest* waitRequest = m_context->GetNewInternalRequest();
+        waitRequest->CreateWait(slot.m_compressedRequest);
+        waitRequest->SetStatus(IStreamerTypes::RequestStatus::Failed);
+        m_context->MarkRequestAsCompleted(waitRequest);
+        ReleaseSlot(slotIndex);
+    }
+
+    void ChunkedDecompressor::ReleaseSlot(u32 slotIndex)
+    {
+        ReadSlot& slot = m_readSlots[slotIndex];
+        if (slot.m_buffer)
+        {
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(slot.m_buffer, slot.m_bufferSize, m_alignment);
+            m_memoryUsage -= slot.m_bufferSize;
+            slot.m_buffer = nullptr;
+        }
+        slot.m_bufferSize = 0;
+        slot.m_alignmentOffset = 0;
+        slot.m_index.reset();
+        slot.m_compressedRequest = nullptr;
+        slot.m_activeRequest = nullptr;
+        slot.m_status = ReadSlotStatus::Unused;
+
+        AZ_Assert(m_numInFlightReads > 0, "Trying to release a read slot in ChunkedDecompressor, but no read requests are supposed to be queued.");
+        m_numInFlightReads--;
+    }
+
+    AZStd::shared_ptr<const ChunkedDecompressor::BlockIndex> ChunkedDecompressor::FindIndex(const RequestPath& archiveFilename, size_t offset)
+    {
+        for (auto it = m_indexCache.rbegin(); it != m_indexCache.rend(); ++it)
+        {
+            if ((*it)->m_offset == offset && (*it)->m_archiveFilename == archiveFilename)
+            {
+                AZStd::shared_ptr<const BlockIndex> index = *it;
+                // Move to the back to mark it as the most recently used.
+                m_indexCache.erase(AZStd::next(it).base());
+                m_indexCache.push_back(index);
+                return index;
+            }
+        }
+        return {};
+    }
+
+    void ChunkedDecompressor::AddIndex(AZStd::shared_ptr<const BlockIndex> index)
+    {
+        if (m_maxNumCachedIndices == 0)
+        {
+            return;
+        }
+        if (m_indexCache.size() >= m_maxNumCachedIndices)
+        {
+            m_indexCache.erase(m_indexCache.begin());
+        }
+        m_indexCache.push_back(AZStd::move(index));
+    }
+
+    void ChunkedDecompressor::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max number of reads", m_maxNumReads, "The maximum number of parallel reads this decompressor node will support."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Number of threads", m_numThreads,
+                "The number of threads that decompress blocks. The blocks of a single read are decompressed in parallel."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max number of cached indices", m_maxNumCachedIndices,
+                "The maximum number of block indices that are kept in memory. An index that isn't cached needs an additional read."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Alignment", m_alignment,
+                "The alignment for read buffers. This does not adjust the offset or read size in order to allow cache nodes to remain "
+                "effective."));
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                "The name of the node that follows this node or none."));
+            break;
+        };
+    }
+} // namespace AZ::IO
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/ChunkedCompression.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+}
+
+namespace AZ::IO
+{
+    namespace Requests
+    {
+        struct CompressedReadData;
+        struct ReportData;
+    }
+
+    struct ChunkedDecompressorConfig final :
+        public IStreamerStackConfig
+    {
+        AZ_RTTI(AZ::IO::ChunkedDecompressorConfig, "{5A0F1E6B-6C0B-4A4D-9C53-0E0C2F7D8B1A}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(ChunkedDecompressorConfig, AZ::SystemAllocator);
+
+        ~ChunkedDecompressorConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Maximum number of reads that are kept in flight.
+        u32 m_maxNumReads{ 4 };
+        //! Number of threads that decompress blocks. Use 0 to use one thread per hardware thread.
+        u32 m_numThreads{ 2 };
+        //! Maximum number of block indices that are kept in memory so they don't need to be read again.
+        u32 m_maxNumCachedIndices{ 64 };
+    };
+
+    //! Entry in the streaming stack that decompresses files from an archive that are stored in the
+    //! ChunkedCompression format. Unlike the FullFileDecompressor only the blocks that overlap the
+    //! requested range are read and decompressed, so partial reads from large compressed files are
+    //! about as cheap as reads from uncompressed files. The blocks of a request are decompressed in
+    //! parallel as tasks. A dedicated task executor is used so long decompressions don't block the
+    //! main task system.
+    //! This entry handles the compressed reads that are created by the FullFileDecompressor and
+    //! needs to be placed above it in the stack. Compressed reads in other formats are forwarded.
+    class ChunkedDecompressor
+        : public StreamStackEntry
+    {
+    public:
+        ChunkedDecompressor(u32 maxNumReads, u32 numThreads, u32 maxNumCachedIndices, u32 alignment);
+        ~ChunkedDecompressor() override;
+
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    private:
+        struct BlockIndex
+        {
+            RequestPath m_archiveFilename;
+            size_t m_offset{ 0 };
+            ChunkedCompression::Header m_header;
+            AZStd::vector<ChunkedCompression::Block> m_blocks;
+        };
+
+        enum class ReadSlotStatus : u8
+        {
+            Unused,
+            ReadingIndex,
+            ReadingBlocks,
+            Decompressing
+        };
+
+        struct ReadSlot
+        {
+            AZStd::chrono::steady_clock::time_point m_jobStartTime;
+            AZStd::shared_ptr<const BlockIndex> m_index;
+            FileRequest* m_compressedRequest{ nullptr };
+            // The internal read while reading or the wait request while decompressing.
+            FileRequest* m_activeRequest{ nullptr };
+            u8* m_buffer{ nullptr };
+            size_t m_bufferSize{ 0 };
+            // Offset into the buffer where the read data starts, which is added to keep reads aligned.
+            size_t m_alignmentOffset{ 0 };
+            u32 m_firstBlock{ 0 };
+            u32 m_blockCount{ 0 };
+            AZStd::atomic_bool m_failed{ false };
+            ReadSlotStatus m_status{ ReadSlotStatus::Unused };
+        };
+
+        static bool IsChunkedRead(const Requests::CompressedReadData& data);
+        bool IsIdle() const;
+
+        void StartRead(FileRequest* compressedRequest);
+        void StartIndexRead(u32 slot, size_t indexSize);
+        void FinishIndexRead(FileRequest* readRequest, u32 slot);
+        void StartBlockRead(u32 slot);
+        void FinishBlockRead(FileRequest* readRequest, u32 slot);
+        void FinishDecompression(FileRequest* waitRequest, u32 slot);
+        void FailRequest(u32 slot);
+        void ReleaseSlot(u32 slot);
+
+        void DecompressBlock(u32 slot, u32 blockIndex);
+        u8* AllocateBuffer(u32 slot, u64 offset, u64 size);
+
+        AZStd::shared_ptr<const BlockIndex> FindIndex(const RequestPath& archiveFilename, size_t offset);
+        void AddIndex(AZStd::shared_ptr<const BlockIndex> index);
+
+        void EstimateCompressedReadRequest(FileRequest* request, AZStd::chrono::microseconds& cumulativeDelay,
+            double totalDecompressionDurationUs, double totalBytesDecompressed) const;
+
+        void Report(const Requests::ReportData& data) const;
+
+        AZStd::deque<FileRequest*> m_pendingReads;
+
+        // Most recently used indices are at the back.
+        AZStd::vector<AZStd::shared_ptr<const BlockIndex>> m_indexCache;
+
+        AverageWindow<size_t, double, s_statisticsWindowSize> m_decompressionDurationMicroSec;
+        AverageWindow<size_t, double, s_statisticsWindowSize> m_bytesDecompressed;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_blocksPerRequest;
+
+        AZStd::unique_ptr<ReadSlot[]> m_readSlots;
+
+        size_t m_memoryUsage{ 0 }; //!< Amount of memory used for read buffers by the decompressor.
+        u64 m_indexCacheHits{ 0 };
+        u64 m_indexCacheMisses{ 0 };
+        u64 m_bytesSkipped{ 0 }; //!< Compressed bytes that didn't need to be read because they're outside the requested ranges.
+        u32 m_maxNumReads{ 4 };
+        u32 m_numInFlightReads{ 0 };
+        u32 m_maxNumCachedIndices{ 64 };
+        u32 m_numThreads{ 0 };
+        u32 m_alignment{ 0 };
+
+        // Destroyed first so no decompression tasks are running when the rest of the members are destroyed.
+        AZStd::unique_ptr<TaskExecutor> m_executor;
+    };
+} // namespace AZ::IO
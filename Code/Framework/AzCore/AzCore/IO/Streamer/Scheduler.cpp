@@ -11,6 +11,7 @@
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/sort.h>
 
@@ -21,7 +22,9 @@ namespace AZ::IO
     static constexpr const char* ImmediateReadsName = "Immediate reads";
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
 
-    Scheduler::Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment, u64 sizeAlignment, u64 granularity)
+    Scheduler::Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment, u64 sizeAlignment, u64 granularity,
+        u64 maxCoalescedReadSize)
+        : m_maxCoalescedReadSize(maxCoalescedReadSize)
     {
         AZ_Assert(IStreamerTypes::IsPowerOf2(memoryAlignment), "Memory alignment provided to AZ::IO::Scheduler isn't a power of two.");
         AZ_Assert(IStreamerTypes::IsPowerOf2(sizeAlignment), "Size alignment provided to AZ::IO::Scheduler isn't a power of two.");
@@ -79,6 +82,7 @@ namespace AZ::IO
     {
         AZ_Assert(m_isRunning, "Trying to queue a request when Streamer's scheduler isn't running.");
 
+        m_context.GetTraceRecorder().RecordQueued(request->m_request);
         {
             AZStd::scoped_lock lock(m_pendingRequestsLock);
             m_pendingRequests.push_back(AZStd::move(request));
@@ -90,6 +94,7 @@ namespace AZ::IO
     {
         AZ_Assert(m_isRunning, "Trying to queue a batch of requests when Streamer's scheduler isn't running.");
 
+        RecordQueuedRequests(requests);
         {
             AZStd::scoped_lock lock(m_pendingRequestsLock);
             m_pendingRequests.insert(m_pendingRequests.end(), requests.begin(), requests.end());
@@ -101,6 +106,7 @@ namespace AZ::IO
     {
         AZ_Assert(m_isRunning, "Trying to queue a batch of requests when Streamer's scheduler isn't running.");
 
+        RecordQueuedRequests(requests);
         {
             AZStd::scoped_lock lock(m_pendingRequestsLock);
             AZStd::move(requests.begin(), requests.end(), AZStd::back_inserter(m_pendingRequests));
@@ -108,6 +114,28 @@ namespace AZ::IO
         m_context.WakeUpSchedulingThread();
     }
 
+    void Scheduler::StartTraceCapture()
+    {
+        m_context.GetTraceRecorder().Start();
+    }
+
+    void Scheduler::StopTraceCapture(StreamerTrace::Trace& output)
+    {
+        m_context.GetTraceRecorder().Stop(output);
+    }
+
+    void Scheduler::RecordQueuedRequests(const AZStd::vector<FileRequestPtr>& requests)
+    {
+        StreamerTraceRecorder& recorder = m_context.GetTraceRecorder();
+        if (recorder.IsRecording())
+        {
+            for (const FileRequestPtr& request : requests)
+            {
+                recorder.RecordQueued(request->m_request);
+            }
+        }
+    }
+
     void Scheduler::SuspendProcessing()
     {
         m_isSuspended = true;
@@ -133,6 +161,17 @@ namespace AZ::IO
             SchedulerName, "Is suspended", m_isSuspended,
             "Whether or not the scheduler is suspended. When suspended the scheduler will not do any processing and effectively prevents "
             "Streamer from doing any work.", Statistic::GraphType::None));
+        if (m_maxCoalescedReadSize > 0)
+        {
+            statistics.push_back(Statistic::CreateInteger(
+                SchedulerName, "Coalesced reads", m_numCoalescedReads,
+                "The total number of reads that were created by merging reads from different requests that were close together in the "
+                "same file. This is common when many small assets are loaded from the same archive."));
+            statistics.push_back(Statistic::CreateFloat(
+                SchedulerName, "Requests per coalesced read", m_requestsPerCoalescedReadStat.CalculateAverage(),
+                "The average number of requests that are merged into a single read. Higher values mean fewer, larger reads are sent to "
+                "the storage drive."));
+        }
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         statistics.push_back(Statistic::CreateBoolean(
             SchedulerName, "Is idle", m_stackStatus.m_isIdle,
@@ -286,26 +325,16 @@ namespace AZ::IO
                 {
                     AZ_Assert(parentReadRequest->m_allocator,
                         "The read request was issued without a memory allocator or valid output address.");
-                    u64 recommendedSize = size;
-                    if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
-                    {
-                        recommendedSize = m_recommendations.CalculateRecommendedMemorySize(size, parentReadRequest->m_offset);
-                    }
-                    IStreamerTypes::RequestMemoryAllocatorResult allocation =
-                        parentReadRequest->m_allocator->Allocate(size, recommendedSize, m_recommendations.m_memoryAlignment);
-                    if (allocation.m_address == nullptr || allocation.m_size < parentReadRequest->m_size)
+                    if (!Thread_AllocateReadOutput(*parentReadRequest, AZStd::is_same_v<Command, Requests::ReadData>))
                     {
                         next->SetStatus(IStreamerTypes::RequestStatus::Failed);
                         m_context.MarkRequestAsCompleted(next);
                         return;
                     }
-                    parentReadRequest->m_output = allocation.m_address;
-                    parentReadRequest->m_outputSize = allocation.m_size;
-                    parentReadRequest->m_memoryType = allocation.m_type;
                     if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
                     {
                         args.m_output = parentReadRequest->m_output;
-                        args.m_outputSize = allocation.m_size;
+                        args.m_outputSize = parentReadRequest->m_outputSize;
                     }
                     else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
                     {
@@ -339,6 +368,13 @@ namespace AZ::IO
                 }
                 AZ_PROFILE_INTERVAL_START_COLORED(AzCore, next, ProfilerColor,
                     "Streamer queued %zu: %s", next->GetCommand().index(), parentReadRequest->m_path.GetRelativePath());
+                if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+                {
+                    if (Thread_CoalesceReads(next, args))
+                    {
+                        return;
+                    }
+                }
                 m_threadData.m_streamStack->QueueRequest(next);
             }
             else if constexpr (AZStd::is_same_v<Command, Requests::CancelData>)
@@ -368,6 +404,143 @@ namespace AZ::IO
         }, next->GetCommand());
     }
 
+    bool Scheduler::Thread_AllocateReadOutput(Requests::ReadRequestData& readRequest, bool useRecommendedSize)
+    {
+        AZ_Assert(readRequest.m_allocator, "The read request was issued without a memory allocator or valid output address.");
+
+        const u64 size = readRequest.m_size;
+        const u64 recommendedSize = useRecommendedSize ? m_recommendations.CalculateRecommendedMemorySize(size, readRequest.m_offset) : size;
+        IStreamerTypes::RequestMemoryAllocatorResult allocation =
+            readRequest.m_allocator->Allocate(size, recommendedSize, m_recommendations.m_memoryAlignment);
+        if (allocation.m_address == nullptr || allocation.m_size < size)
+        {
+            return false;
+        }
+        readRequest.m_output = allocation.m_address;
+        readRequest.m_outputSize = allocation.m_size;
+        readRequest.m_memoryType = allocation.m_type;
+        return true;
+    }
+
+    bool Scheduler::Thread_CoalesceReads(FileRequest* next, Requests::ReadData& data)
+    {
+        if (m_maxCoalescedReadSize == 0 || data.m_size >= m_maxCoalescedReadSize)
+        {
+            return false;
+        }
+
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        // If none of the drives provided an estimate, only merge reads that are directly next to each other.
+        const u64 maxGap = m_stackStatus.m_coalesceGap == AZStd::numeric_limits<u64>::max()
+            ? 0
+            : AZStd::min(m_stackStatus.m_coalesceGap, m_maxCoalescedReadSize);
+
+        u64 start = data.m_offset;
+        u64 end = data.m_offset + data.m_size;
+        AZStd::vector<FileRequest*>& candidates = m_threadData.m_coalesceCandidates;
+        candidates.clear();
+
+        // Merging a read can bring other reads within reach, so keep searching until nothing more is found.
+        auto& pending = m_context.GetPreparedRequests();
+        bool foundCandidate = true;
+        while (foundCandidate && candidates.size() < MaxCoalescedRequests)
+        {
+            foundCandidate = false;
+            size_t searchDepth = 0;
+            for (auto it = pending.begin(); it != pending.end() && searchDepth < MaxCoalesceSearchDepth; ++searchDepth)
+            {
+                auto candidate = AZStd::get_if<Requests::ReadData>(&(*it)->GetCommand());
+                if (candidate && candidate->m_sharedRead == data.m_sharedRead && candidate->m_path == data.m_path)
+                {
+                    const u64 candidateStart = candidate->m_offset;
+                    const u64 candidateEnd = candidate->m_offset + candidate->m_size;
+                    const u64 mergedStart = AZStd::min(start, candidateStart);
+                    const u64 mergedEnd = AZStd::max(end, candidateEnd);
+                    if (candidateStart <= end + maxGap && candidateEnd + maxGap >= start &&
+                        mergedEnd - mergedStart <= m_maxCoalescedReadSize)
+                    {
+                        start = mergedStart;
+                        end = mergedEnd;
+                        candidates.push_back(*it);
+                        it = pending.erase(it);
+                        foundCandidate = true;
+                        if (candidates.size() == MaxCoalescedRequests)
+                        {
+                            break;
+                        }
+                        continue;
+                    }
+                }
+                ++it;
+            }
+        }
+
+        // Prepare the merged reads the same way as the read they're merged into.
+        AZStd::vector<FileRequest*> requests;
+        requests.reserve(candidates.size() + 1);
+        requests.push_back(next);
+        for (FileRequest* candidate : candidates)
+        {
+            candidate->SetStatus(IStreamerTypes::RequestStatus::Processing);
+            auto& candidateData = AZStd::get<Requests::ReadData>(candidate->GetCommand());
+            auto parentReadRequest = candidate->GetCommandFromChain<Requests::ReadRequestData>();
+            if (parentReadRequest && parentReadRequest->m_output == nullptr)
+            {
+                if (!Thread_AllocateReadOutput(*parentReadRequest, true))
+                {
+                    candidate->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                    m_context.MarkRequestAsCompleted(candidate);
+                    continue;
+                }
+                candidateData.m_output = parentReadRequest->m_output;
+                candidateData.m_outputSize = parentReadRequest->m_outputSize;
+            }
+            AZ_PROFILE_INTERVAL_START_COLORED(AzCore, candidate, ProfilerColor,
+                "Streamer queued %zu: %s (coalesced)", candidate->GetCommand().index(), candidateData.m_path.GetRelativePathCStr());
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_processingSize += candidateData.m_size;
+#endif
+            requests.push_back(candidate);
+        }
+        candidates.clear();
+
+        if (requests.size() == 1)
+        {
+            return false;
+        }
+
+        m_threadData.m_lastFileOffset = end;
+        m_numCoalescedReads++;
+        m_requestsPerCoalescedReadStat.PushEntry(requests.size());
+
+        const u64 bufferSize = end - start;
+        const u64 alignment = m_recommendations.m_memoryAlignment;
+        u8* buffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(bufferSize, alignment));
+
+        FileRequest* coalescedRead = m_context.GetNewInternalRequest();
+        coalescedRead->CreateRead(nullptr, buffer, bufferSize, data.m_path, start, bufferSize, data.m_sharedRead);
+        coalescedRead->SetCompletionCallback(
+            [this, buffer, bufferSize, alignment, start, requests = AZStd::move(requests)](FileRequest& request)
+            {
+                AZ_PROFILE_SCOPE(AzCore, "Scheduler: coalesced read completed");
+                IStreamerTypes::RequestStatus status = request.GetStatus();
+                for (FileRequest* merged : requests)
+                {
+                    auto& mergedData = AZStd::get<Requests::ReadData>(merged->GetCommand());
+                    if (status == IStreamerTypes::RequestStatus::Completed)
+                    {
+                        memcpy(mergedData.m_output, buffer + (mergedData.m_offset - start), mergedData.m_size);
+                    }
+                    merged->SetStatus(status);
+                    m_context.MarkRequestAsCompleted(merged);
+                }
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(buffer, bufferSize, alignment);
+            });
+        m_threadData.m_streamStack->QueueRequest(coalescedRead);
+        return true;
+    }
+
     bool Scheduler::Thread_ExecuteRequests()
     {
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
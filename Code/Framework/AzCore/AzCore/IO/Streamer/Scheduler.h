@@ -28,14 +28,18 @@ namespace AZ::IO
     namespace Requests
     {
         struct CancelData;
+        struct ReadData;
+        struct ReadRequestData;
         struct RescheduleData;
     } // namespace Requests
 
     class Scheduler final
     {
     public:
+        //! @param maxCoalescedReadSize The largest read the scheduler will create when merging reads from different requests
+        //!     that are close together in the same file, such as assets in the same archive. Use 0 to disable merging.
         explicit Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment = AZCORE_GLOBAL_NEW_ALIGNMENT,
-            u64 sizeAlignment = 1, u64 granularity = 1_mib);
+            u64 sizeAlignment = 1, u64 granularity = 1_mib, u64 maxCoalescedReadSize = 0);
         ~Scheduler();
 
         void Start(const AZStd::thread_desc& threadDesc);
@@ -55,6 +59,11 @@ namespace AZ::IO
         //! Whether or not processing of requests has been suspended.
         bool IsSuspended() const;
 
+        //! Starts recording all read requests that are queued into a trace. If a capture is already running it's restarted.
+        void StartTraceCapture();
+        //! Stops recording read requests and moves the recorded trace into the output.
+        void StopTraceCapture(StreamerTrace::Trace& output);
+
         //! Collects various metrics that are recorded by streamer and its stream stack.
         //! This function is deliberately not thread safe. All stats use a sliding window and never
         //! allocate memory. This might mean in some cases that values of individual stats may not be
@@ -66,6 +75,13 @@ namespace AZ::IO
 
     private:
         inline static constexpr u32 ProfilerColor = 0x0080ffff; //!< A lite shade of blue. (See https://www.color-hex.com/color/0080ff).
+        //! The number of prepared requests that are checked for reads that can be merged with the next read. The prepared requests
+        //! are sorted so reads in the same file as the last read are at the front.
+        inline static constexpr size_t MaxCoalesceSearchDepth = 64;
+        //! The maximum number of requests that are merged into a single read.
+        inline static constexpr size_t MaxCoalescedRequests = 32;
+
+        void RecordQueuedRequests(const AZStd::vector<FileRequestPtr>& requests);
 
         void Thread_MainLoop();
         void Thread_QueueNextRequest();
@@ -74,6 +90,12 @@ namespace AZ::IO
         void Thread_ProcessTillIdle();
         void Thread_ProcessCancelRequest(FileRequest* request, Requests::CancelData& data);
         void Thread_ProcessRescheduleRequest(FileRequest* request, Requests::RescheduleData& data);
+        //! Allocates the output buffer for a read request that was queued with an allocator instead of a buffer.
+        bool Thread_AllocateReadOutput(Requests::ReadRequestData& readRequest, bool useRecommendedSize);
+        //! Merges prepared reads that are close to the provided read in the same file into a single read and queues it. The
+        //! results are copied back to the individual requests once the read completes.
+        //! @return True if the read was merged and queued, false if there was nothing to merge with.
+        bool Thread_CoalesceReads(FileRequest* next, Requests::ReadData& data);
 
         enum class Order
         {
@@ -91,6 +113,8 @@ namespace AZ::IO
             //! Requests pending in the Streaming stack entries. Cached here so it doesn't need to allocate
             //! and free memory whenever scheduling happens.
             AZStd::vector<FileRequest*> m_internalPendingRequests;
+            //! Reads that are merged into a single read. Cached here so it doesn't need to allocate memory for every read.
+            AZStd::vector<FileRequest*> m_coalesceCandidates;
             RequestPath m_lastFilePath; //!< Path of the last file queued for reading.
             AZStd::shared_ptr<StreamStackEntry> m_streamStack;
             u64 m_lastFileOffset{ 0 }; //!< Offset of into the last file queued after reading has completed.
@@ -101,6 +125,11 @@ namespace AZ::IO
         IStreamerTypes::Recommendations m_recommendations;
 
         StreamStackEntry::Status m_stackStatus;
+
+        //! The number of requests that were merged into a single read.
+        AverageWindow<u64, float, s_statisticsWindowSize> m_requestsPerCoalescedReadStat;
+        u64 m_numCoalescedReads{ 0 };
+        u64 m_maxCoalescedReadSize{ 0 };
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         AZStd::chrono::steady_clock::time_point m_processingStartTime;
         size_t m_processingSize{ 0 };
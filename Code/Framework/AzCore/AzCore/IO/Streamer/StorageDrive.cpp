@@ -142,6 +142,8 @@ namespace AZ::IO
 
     void StorageDrive::UpdateStatus(Status& status) const
     {
+        status.m_coalesceGap = AZStd::min(status.m_coalesceGap, CalculateCoalesceGap());
+
         // Only participate if there are actually any reads done.
         if (m_fileOpenCloseTimeAverage.GetNumRecorded() > 0)
         {
@@ -156,6 +158,14 @@ namespace AZ::IO
         }
     }
 
+    u64 StorageDrive::CalculateCoalesceGap() const
+    {
+        // Reading through a gap is cheaper than seeking over it as long as reading the gap takes less time than the seek.
+        const double bytesPerMicrosecond =
+            aznumeric_cast<double>(m_readSizeAverage.GetTotal()) / aznumeric_cast<double>(m_readTimeAverage.GetTotal().count());
+        return aznumeric_cast<u64>(bytesPerMicrosecond * aznumeric_cast<double>(s_averageSeekTime.count()));
+    }
+
     void StorageDrive::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now,
         AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
         StreamerContext::PreparedQueue::iterator pendingEnd)
@@ -77,6 +77,7 @@ namespace AZ::IO
 
         void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
             const RequestPath*& activeFile, u64& activeOffset) const;
+        u64 CalculateCoalesceGap() const;
 
         void Report(const Requests::ReportData& data) const;
 
@@ -40,6 +40,10 @@ namespace AZ
                 //! more requests can be issued. If it's negative the stack is saturated and no more requests
                 //! should be issued.
                 s32 m_numAvailableSlots{ std::numeric_limits<s32>::max() };
+                //! The largest gap in bytes between two reads from the same file that takes less time to read through than
+                //! to seek over. Reads that are closer together than this can be merged into a single read. If multiple drives
+                //! are in the stack, the smallest gap is used.
+                u64 m_coalesceGap{ std::numeric_limits<u64>::max() };
                 //! True if no node in the stack is doing any work or has any work pending.
                 bool m_isIdle{ true };
             };
@@ -320,6 +320,16 @@ namespace AZ::IO
         return request;
     }
 
+    void Streamer::StartTraceCapture()
+    {
+        m_streamStack->StartTraceCapture();
+    }
+
+    void Streamer::StopTraceCapture(StreamerTrace::Trace& output)
+    {
+        m_streamStack->StopTraceCapture(output);
+    }
+
     Streamer::Streamer(const AZStd::thread_desc& threadDesc, AZStd::unique_ptr<Scheduler> streamStack)
         : m_streamStack(AZStd::move(streamStack))
     {
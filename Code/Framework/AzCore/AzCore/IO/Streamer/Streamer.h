@@ -199,6 +199,11 @@ namespace AZ::IO
         //! Records the statistics to a profiler.
         void RecordStatistics();
 
+        //! Starts recording all read requests that are queued into a trace. If a capture is already running it's restarted.
+        void StartTraceCapture();
+        //! Stops recording read requests and moves the recorded trace into the output.
+        void StopTraceCapture(StreamerTrace::Trace& output);
+
         Streamer(const AZStd::thread_desc& threadDesc, AZStd::unique_ptr<Scheduler> streamStack);
         ~Streamer() override;
 
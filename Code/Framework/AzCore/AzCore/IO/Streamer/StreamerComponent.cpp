@@ -10,14 +10,17 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Streamer/BlockCache.h>
+#include <AzCore/IO/Streamer/ChunkedDecompressor.h>
 #include <AzCore/IO/Streamer/DedicatedCache.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
 #include <AzCore/IO/Streamer/StorageDrive.h>
 #include <AzCore/IO/Streamer/ReadSplitter.h>
 #include <AzCore/Interface/Interface.h>
@@ -27,6 +30,7 @@
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/conversions.h>
 #include <AzCore/UserSettings/UserSettings.h>
 
 namespace AZ
@@ -37,6 +41,19 @@ namespace AZ
     AZ_CVAR(AZ::CVarFixedString, cl_streamerProfile, "", nullptr, ConsoleFunctorFlags::Null,
         "Overrides the profile provided by the hardware.");
 
+    static constexpr const char* DefaultStreamerTracePath = "@user@/Streamer/Trace.strace";
+
+    static AZ::IO::FixedMaxPath ResolveStreamerTracePath(const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZ::IO::PathView path = arguments.empty() ? AZ::IO::PathView(DefaultStreamerTracePath) : AZ::IO::PathView(arguments.front());
+        AZ::IO::FixedMaxPath resolvedPath;
+        if (auto fileIO = AZ::IO::FileIOBase::GetInstance(); fileIO == nullptr || !fileIO->ResolvePath(resolvedPath, path))
+        {
+            resolvedPath = path;
+        }
+        return resolvedPath;
+    }
+
     StreamerComponent::StreamerComponent()
     {
         // Use platform appropriate defaults for the threading information.
@@ -103,8 +120,10 @@ namespace AZ
         }
         if (stack)
         {
+            AZ::u64 maxCoalescedReadSize = hardwareInfo.m_maxTransfer;
+            settingsRegistry->Get(maxCoalescedReadSize, "/Amazon/AzCore/Streamer/MaxCoalescedReadSize");
             return AZStd::make_unique<AZ::IO::Scheduler>(AZStd::move(stack), hardwareInfo.m_maxPhysicalSectorSize,
-                hardwareInfo.m_maxLogicalSectorSize, hardwareInfo.m_maxTransfer);
+                hardwareInfo.m_maxLogicalSectorSize, hardwareInfo.m_maxTransfer, maxCoalescedReadSize);
         }
         else
         {
@@ -196,6 +215,7 @@ namespace AZ
         }
 
         BlockCacheConfig::Reflect(context);
+        ChunkedDecompressorConfig::Reflect(context);
         DedicatedCacheConfig::Reflect(context);
         IStreamerStackConfig::Reflect(context);
         FullFileDecompressorConfig::Reflect(context);
@@ -241,4 +261,55 @@ namespace AZ
             m_streamer->QueueRequest(m_streamer->FlushCaches());
         }
     }
+
+    void StreamerComponent::StartStreamerTrace(const AZ::ConsoleCommandContainer&)
+    {
+        if (m_streamer)
+        {
+            m_streamer->StartTraceCapture();
+            AZ_Printf("Streamer", "Started recording a trace of the read requests.\n");
+        }
+    }
+
+    void StreamerComponent::StopStreamerTrace(const AZ::ConsoleCommandContainer& someStrings)
+    {
+        if (m_streamer)
+        {
+            AZ::IO::StreamerTrace::Trace trace;
+            m_streamer->StopTraceCapture(trace);
+
+            AZ::IO::FixedMaxPath path = ResolveStreamerTracePath(someStrings);
+            if (AZ::IO::StreamerTrace::Save(trace, path.c_str()))
+            {
+                AZ_Printf("Streamer", "Saved a trace with %zu read requests to '%s'.\n", trace.m_records.size(), path.c_str());
+            }
+        }
+    }
+
+    void StreamerComponent::ReplayStreamerTrace(const AZ::ConsoleCommandContainer& someStrings)
+    {
+        if (m_streamer)
+        {
+            AZ::IO::FixedMaxPath path = ResolveStreamerTracePath(someStrings);
+            AZ::IO::StreamerTrace::Trace trace;
+            if (!AZ::IO::StreamerTrace::Load(trace, path.c_str()))
+            {
+                return;
+            }
+
+            float timeScale = 1.0f;
+            if (someStrings.size() > 1)
+            {
+                timeScale = AZStd::stof(AZStd::string(someStrings[1]));
+            }
+
+            AZ::IO::StreamerTrace::ReplayResult result = AZ::IO::StreamerTrace::Replay(trace, *m_streamer, timeScale);
+            AZ_Printf("Streamer",
+                "Replayed %llu read requests from '%s' in %.3f ms. Read %llu bytes, average latency %.3f ms, max latency %.3f ms, "
+                "%llu missed deadlines, %llu failed requests.\n",
+                result.m_numRequests, path.c_str(), result.m_totalDuration.count() / 1000.0, result.m_bytesRead,
+                result.m_averageLatency.count() / 1000.0, result.m_maxLatency.count() / 1000.0, result.m_numMissedDeadlines,
+                result.m_numFailedRequests);
+        }
+    }
 } // namespace AZ
@@ -49,11 +49,21 @@ namespace AZ
 
         void ReportFileLocks(const AZ::ConsoleCommandContainer& someStrings);
         void FlushCaches(const AZ::ConsoleCommandContainer& someStrings);
+        void StartStreamerTrace(const AZ::ConsoleCommandContainer& someStrings);
+        void StopStreamerTrace(const AZ::ConsoleCommandContainer& someStrings);
+        void ReplayStreamerTrace(const AZ::ConsoleCommandContainer& someStrings);
 
         AZ_CONSOLEFUNC(StreamerComponent, ReportFileLocks, AZ::ConsoleFunctorFlags::Null,
             "Reports the files currently locked by AZ::IO::Streamer");
         AZ_CONSOLEFUNC(StreamerComponent, FlushCaches, AZ::ConsoleFunctorFlags::Null,
             "Flushes all caches used inside AZ::IO::Streamer");
+        AZ_CONSOLEFUNC(StreamerComponent, StartStreamerTrace, AZ::ConsoleFunctorFlags::Null,
+            "Starts recording all read requests queued in AZ::IO::Streamer");
+        AZ_CONSOLEFUNC(StreamerComponent, StopStreamerTrace, AZ::ConsoleFunctorFlags::Null,
+            "Stops recording read requests and saves the trace. Parameter: optional file path, defaults to @user@/Streamer/Trace.strace");
+        AZ_CONSOLEFUNC(StreamerComponent, ReplayStreamerTrace, AZ::ConsoleFunctorFlags::Null,
+            "Plays back a recorded trace and reports the load time and missed deadlines. "
+            "Parameters: file path and optional time scale, use 0 to queue all requests at once");
         
         AZStd::unique_ptr<AZ::IO::Streamer> m_streamer;
         int m_deviceThreadCpuId;
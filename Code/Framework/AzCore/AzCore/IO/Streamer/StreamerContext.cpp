@@ -114,6 +114,11 @@ namespace AZ
             return m_preparedRequests;
         }
 
+        StreamerTraceRecorder& StreamerContext::GetTraceRecorder()
+        {
+            return m_traceRecorder;
+        }
+
         void StreamerContext::MarkRequestAsCompleted(FileRequest* request)
         {
             AZStd::scoped_lock<AZStd::recursive_mutex> guard(m_completedGuard);
@@ -218,6 +223,10 @@ namespace AZ
                     IStreamerTypes::RequestStatus status = top->GetStatus();
                     FileRequest* parent = top->m_parent;
                     bool isInternal = top->m_usage == FileRequest::Usage::Internal;
+                    if (!isInternal)
+                    {
+                        m_traceRecorder.RecordCompleted(*top);
+                    }
 
                     {
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
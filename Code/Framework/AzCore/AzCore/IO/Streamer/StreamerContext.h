@@ -11,6 +11,7 @@
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamerContext_Platform.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
 #include <AzCore/Statistics/RunningStatistic.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/queue.h>
@@ -63,6 +64,9 @@ namespace AZ::IO
         //! Gets the prepared requests that are queued to be processed.
         const PreparedQueue& GetPreparedRequests() const;
 
+        //! Gets the recorder that captures the user read requests that pass through Streamer. This is thread safe.
+        StreamerTraceRecorder& GetTraceRecorder();
+
         //! Marks a request as completed so the main thread in Streamer can close it out.
         //! This can be safely called from multiple threads.
         void MarkRequestAsCompleted(FileRequest* request);
@@ -112,6 +116,8 @@ namespace AZ::IO
         // The prepared request queue is not guarded and should only be called from the main Streamer thread.
         PreparedQueue m_preparedRequests;
 
+        StreamerTraceRecorder m_traceRecorder;
+
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         //! By how much time the prediction was off. This mostly covers the latter part of scheduling, which
         //! gets more precise the closer the request gets to completion.
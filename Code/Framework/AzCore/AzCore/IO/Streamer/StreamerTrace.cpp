@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ::IO
+{
+    namespace StreamerTrace
+    {
+        bool Save(const Trace& trace, const char* filePath)
+        {
+            SystemFile file;
+            if (!file.Open(filePath, SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                AZ_Error("StreamerTrace", false, "Unable to open '%s' to write the streamer trace to.", filePath);
+                return false;
+            }
+
+            Header header;
+            header.m_recordCount = aznumeric_cast<u32>(trace.m_records.size());
+            header.m_pathCount = aznumeric_cast<u32>(trace.m_paths.size());
+            bool result = file.Write(&header, sizeof(header)) == sizeof(header);
+
+            const SystemFile::SizeType recordsSize = trace.m_records.size() * sizeof(Record);
+            result = result && file.Write(trace.m_records.data(), recordsSize) == recordsSize;
+
+            for (const AZStd::string& path : trace.m_paths)
+            {
+                const u32 length = aznumeric_cast<u32>(path.size());
+                result = result && file.Write(&length, sizeof(length)) == sizeof(length);
+                result = result && file.Write(path.data(), length) == length;
+            }
+
+            AZ_Error("StreamerTrace", result, "Failed to write the streamer trace to '%s'.", filePath);
+            return result;
+        }
+
+        bool Load(Trace& trace, const char* filePath)
+        {
+            SystemFile file;
+            if (!file.Open(filePath, SystemFile::SF_OPEN_READ_ONLY))
+            {
+                AZ_Error("StreamerTrace", false, "Unable to open streamer trace '%s'.", filePath);
+                return false;
+            }
+
+            Header header;
+            if (file.Read(sizeof(header), &header) != sizeof(header) || header.m_magic != Magic)
+            {
+                AZ_Error("StreamerTrace", false, "'%s' is not a streamer trace.", filePath);
+                return false;
+            }
+            if (header.m_version != Version)
+            {
+                AZ_Error("StreamerTrace", false, "Streamer trace '%s' is version %u, but only version %u is supported.",
+                    filePath, header.m_version, Version);
+                return false;
+            }
+
+            trace.m_records.resize_no_construct(header.m_recordCount);
+            const SystemFile::SizeType recordsSize = trace.m_records.size() * sizeof(Record);
+            bool result = file.Read(recordsSize, trace.m_records.data()) == recordsSize;
+
+            trace.m_paths.clear();
+            trace.m_paths.reserve(header.m_pathCount);
+            for (u32 i = 0; i < header.m_pathCount && result; ++i)
+            {
+                u32 length = 0;
+                result = file.Read(sizeof(length), &length) == sizeof(length);
+                if (result)
+                {
+                    AZStd::string& path = trace.m_paths.emplace_back();
+                    path.resize_no_construct(length);
+                    result = file.Read(length, path.data()) == length;
+                }
+            }
+
+            for (const Record& record : trace.m_records)
+            {
+                result = result && record.m_pathIndex < trace.m_paths.size();
+            }
+
+            if (!result)
+            {
+                AZ_Error("StreamerTrace", false, "Streamer trace '%s' is truncated or corrupted.", filePath);
+                trace.m_records.clear();
+                trace.m_paths.clear();
+            }
+            return result;
+        }
+
+        ReplayResult Replay(const Trace& trace, IStreamer& streamer, float timeScale)
+        {
+            using namespace AZStd::chrono;
+
+            ReplayResult result;
+            if (trace.m_records.empty())
+            {
+                return result;
+            }
+
+            AZStd::vector<const Record*> order;
+            order.reserve(trace.m_records.size());
+            for (const Record& record : trace.m_records)
+            {
+                order.push_back(&record);
+            }
+            // Records are stored in the order they were queued, but traces from other sources might not be. Ties are broken on the
+            // position in the trace so the original order is kept.
+            AZStd::sort(order.begin(), order.end(),
+                [](const Record* lhs, const Record* rhs)
+                {
+                    return lhs->m_queueTimeUs != rhs->m_queueTimeUs ? lhs->m_queueTimeUs < rhs->m_queueTimeUs : lhs < rhs;
+                });
+
+            // The completion callbacks are all called from Streamer's scheduling thread, so the results only need to be
+            // synchronized with this thread once all requests have completed.
+            struct ReplayState
+            {
+                ReplayResult m_result;
+                u64 m_totalLatencyUs{ 0 };
+                steady_clock::time_point m_lastCompletion;
+                AZStd::atomic<u64> m_numRemaining{ 0 };
+                AZStd::binary_semaphore m_completed;
+            };
+            ReplayState state;
+            state.m_numRemaining = order.size();
+
+            IStreamerTypes::DefaultRequestMemoryAllocator allocator;
+            const steady_clock::time_point startTime = steady_clock::now();
+            for (const Record* record : order)
+            {
+                if (timeScale > 0.0f)
+                {
+                    const steady_clock::time_point queueTarget =
+                        startTime + microseconds(aznumeric_cast<s64>(aznumeric_cast<double>(record->m_queueTimeUs) * timeScale));
+                    const steady_clock::time_point now = steady_clock::now();
+                    if (queueTarget > now)
+                    {
+                        AZStd::this_thread::sleep_for(duration_cast<microseconds>(queueTarget - now));
+                    }
+                }
+
+                const IStreamerTypes::Deadline deadline =
+                    record->m_deadlineUs == NoDeadline ? IStreamerTypes::s_noDeadline : IStreamerTypes::Deadline(record->m_deadlineUs);
+                const steady_clock::time_point queueTime = steady_clock::now();
+                const steady_clock::time_point deadlineTime =
+                    record->m_deadlineUs == NoDeadline ? steady_clock::time_point::max() : queueTime + deadline;
+
+                FileRequestPtr request = streamer.Read(trace.m_paths[record->m_pathIndex], allocator, record->m_size, deadline,
+                    record->m_priority, record->m_offset);
+                streamer.SetRequestCompleteCallback(request,
+                    [&state, &streamer, queueTime, deadlineTime, size = record->m_size](FileRequestHandle handle)
+                    {
+                        const steady_clock::time_point now = steady_clock::now();
+                        const u64 latency = aznumeric_cast<u64>(duration_cast<microseconds>(now - queueTime).count());
+                        state.m_totalLatencyUs += latency;
+                        state.m_result.m_maxLatency = AZStd::max(state.m_result.m_maxLatency, microseconds(latency));
+                        state.m_lastCompletion = now;
+                        if (streamer.GetRequestStatus(handle) == IStreamerTypes::RequestStatus::Completed)
+                        {
+                            state.m_result.m_bytesRead += size;
+                        }
+                        else
+                        {
+                            state.m_result.m_numFailedRequests++;
+                        }
+                        if (now > deadlineTime)
+                        {
+                            state.m_result.m_numMissedDeadlines++;
+                        }
+                        if (--state.m_numRemaining == 0)
+                        {
+                            state.m_completed.release();
+                        }
+                    });
+                // The request is released once it completes, which also releases the memory it read into.
+                streamer.QueueRequest(request);
+            }
+
+            state.m_completed.acquire();
+            // The allocator can still be in use for a short while after the last callback.
+            while (allocator.GetNumLocks() > 0)
+            {
+                AZStd::this_thread::yield();
+            }
+
+            result = state.m_result;
+            result.m_numRequests = order.size();
+            result.m_totalDuration = duration_cast<microseconds>(state.m_lastCompletion - startTime);
+            result.m_averageLatency = microseconds(state.m_totalLatencyUs / result.m_numRequests);
+            return result;
+        }
+    } // namespace StreamerTrace
+
+    void StreamerTraceRecorder::Start()
+    {
+        AZStd::scoped_lock lock(m_lock);
+        m_trace.m_paths.clear();
+        m_trace.m_records.clear();
+        m_inFlightRecords.clear();
+        m_pathIndices.clear();
+        m_startTime = AZStd::chrono::steady_clock::now();
+        m_isRecording = true;
+    }
+
+    void StreamerTraceRecorder::Stop(StreamerTrace::Trace& output)
+    {
+        AZStd::scoped_lock lock(m_lock);
+        m_isRecording = false;
+
+        output.m_paths = AZStd::move(m_trace.m_paths);
+        output.m_records.clear();
+        output.m_records.reserve(m_trace.m_records.size() - m_inFlightRecords.size());
+        AZStd::vector<u8> isInFlight(m_trace.m_records.size(), 0);
+        for (auto&& [request, index] : m_inFlightRecords)
+        {
+            isInFlight[index] = 1;
+        }
+        for (size_t i = 0; i < m_trace.m_records.size(); ++i)
+        {
+            if (!isInFlight[i])
+            {
+                output.m_records.push_back(m_trace.m_records[i]);
+            }
+        }
+
+        m_trace.m_paths.clear();
+        m_trace.m_records.clear();
+        m_inFlightRecords.clear();
+        m_pathIndices.clear();
+    }
+
+    bool StreamerTraceRecorder::IsRecording() const
+    {
+        return m_isRecording;
+    }
+
+    void StreamerTraceRecorder::RecordQueued(const FileRequest& request)
+    {
+        if (!m_isRecording)
+        {
+            return;
+        }
+
+        auto readRequest = AZStd::get_if<Requests::ReadRequestData>(&request.GetCommand());
+        if (!readRequest)
+        {
+            return;
+        }
+
+        const AZStd::chrono::steady_clock::time_point now = AZStd::chrono::steady_clock::now();
+        AZStd::string path = readRequest->m_path.GetAbsolutePathCStr();
+
+        AZStd::scoped_lock lock(m_lock);
+        if (!m_isRecording)
+        {
+            return;
+        }
+
+        StreamerTrace::Record record;
+        record.m_queueTimeUs = aznumeric_cast<u64>(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - m_startTime).count());
+        record.m_offset = readRequest->m_offset;
+        record.m_size = readRequest->m_size;
+        record.m_priority = readRequest->m_priority;
+        if (readRequest->m_deadline != FileRequest::s_noDeadlineTime)
+        {
+            // Requests queued with s_deadlineNow have a deadline that has already passed by the time they're queued.
+            record.m_deadlineUs = readRequest->m_deadline > now
+                ? AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(readRequest->m_deadline - now).count()
+                : 0;
+        }
+
+        auto [pathIt, inserted] = m_pathIndices.try_emplace(AZStd::move(path), aznumeric_cast<u32>(m_trace.m_paths.size()));
+        if (inserted)
+        {
+            m_trace.m_paths.push_back(pathIt->first);
+        }
+        record.m_pathIndex = pathIt->second;
+
+        m_inFlightRecords[&request] = m_trace.m_records.size();
+        m_trace.m_records.push_back(record);
+    }
+
+    void StreamerTraceRecorder::RecordCompleted(const FileRequest& request)
+    {
+        if (!m_isRecording)
+        {
+            return;
+        }
+
+        const AZStd::chrono::steady_clock::time_point now = AZStd::chrono::steady_clock::now();
+
+        AZStd::scoped_lock lock(m_lock);
+        auto it = m_inFlightRecords.find(&request);
+        if (it == m_inFlightRecords.end())
+        {
+            return;
+        }
+
+        StreamerTrace::Record& record = m_trace.m_records[it->second];
+        const u64 completionTimeUs =
+            aznumeric_cast<u64>(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - m_startTime).count());
+        record.m_durationUs = completionTimeUs - record.m_queueTimeUs;
+        record.m_status = aznumeric_cast<u8>(request.GetStatus());
+        m_inFlightRecords.erase(it);
+    }
+} // namespace AZ::IO
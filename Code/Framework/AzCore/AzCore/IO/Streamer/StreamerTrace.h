@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    class FileRequest;
+    class IStreamer;
+
+    //! Binary trace of the read requests processed by AZ::IO::Streamer. A trace captures the exact request stream of for
+    //! instance a level load, so it can be played back against different streaming stacks to compare their performance.
+    //! The layout is:
+    //!     Header
+    //!     Record[header.m_recordCount]
+    //!     Path table of header.m_pathCount entries, each stored as a u32 length followed by the characters of the path.
+    //! All values are stored little endian.
+    namespace StreamerTrace
+    {
+        inline constexpr u32 Magic = 'S' | ('T' << 8) | ('R' << 16) | ('C' << 24);
+        inline constexpr u32 Version = 1;
+        //! Value of Record::m_deadlineUs for requests that were queued without a deadline.
+        inline constexpr s64 NoDeadline = -1;
+
+        struct Header
+        {
+            u32 m_magic{ Magic };
+            u32 m_version{ Version };
+            u32 m_recordCount{ 0 };
+            u32 m_pathCount{ 0 };
+        };
+        static_assert(sizeof(Header) == 16, "The streamer trace header is part of the file format and can't change size.");
+
+        struct Record
+        {
+            //! Time the request was queued, in microseconds since the start of the capture.
+            u64 m_queueTimeUs{ 0 };
+            //! Time between queuing and completing the request, in microseconds.
+            u64 m_durationUs{ 0 };
+            u64 m_offset{ 0 };
+            u64 m_size{ 0 };
+            //! Deadline of the request relative to the time it was queued, in microseconds, or NoDeadline.
+            s64 m_deadlineUs{ NoDeadline };
+            //! Index into the path table.
+            u32 m_pathIndex{ 0 };
+            u8 m_priority{ 0 };
+            //! The IStreamerTypes::RequestStatus of the request when it completed.
+            u8 m_status{ 0 };
+            u16 m_padding{ 0 };
+        };
+        static_assert(sizeof(Record) == 48, "The streamer trace records are part of the file format and can't change size.");
+
+        struct Trace
+        {
+            AZStd::vector<AZStd::string> m_paths;
+            AZStd::vector<Record> m_records;
+        };
+
+        //! Writes the trace to the file at filePath. The path needs to be an absolute path without aliases.
+        bool Save(const Trace& trace, const char* filePath);
+        //! Reads a trace from the file at filePath. The path needs to be an absolute path without aliases.
+        bool Load(Trace& trace, const char* filePath);
+
+        struct ReplayResult
+        {
+            //! Time between queuing the first request and completing the last request.
+            AZStd::chrono::microseconds m_totalDuration{ 0 };
+            AZStd::chrono::microseconds m_averageLatency{ 0 };
+            AZStd::chrono::microseconds m_maxLatency{ 0 };
+            u64 m_bytesRead{ 0 };
+            u64 m_numRequests{ 0 };
+            u64 m_numFailedRequests{ 0 };
+            u64 m_numMissedDeadlines{ 0 };
+        };
+
+        //! Plays the trace back on the provided streamer and waits until all requests have completed. Requests are queued at
+        //! the same time offsets they were recorded at, multiplied by timeScale. Use a timeScale of 0 to queue all requests
+        //! at once. The deadlines and priorities of the recorded requests are kept so missed deadlines can be compared.
+        ReplayResult Replay(const Trace& trace, IStreamer& streamer, float timeScale = 1.0f);
+    } // namespace StreamerTrace
+
+    //! Records the read requests that are queued in AZ::IO::Streamer into a StreamerTrace. Recording can be started and
+    //! stopped from any thread. While not recording, the cost of the recording calls is limited to checking a flag.
+    class StreamerTraceRecorder
+    {
+    public:
+        void Start();
+        //! Stops recording and moves the recorded trace into the output. Requests that haven't completed yet are dropped.
+        void Stop(StreamerTrace::Trace& output);
+        bool IsRecording() const;
+
+        //! Records a request that's queued in Streamer. Only user read requests are recorded.
+        void RecordQueued(const FileRequest& request);
+        //! Records the completion of a request that was previously recorded with RecordQueued.
+        void RecordCompleted(const FileRequest& request);
+
+    private:
+        AZStd::mutex m_lock;
+        StreamerTrace::Trace m_trace;
+        AZStd::unordered_map<const FileRequest*, size_t> m_inFlightRecords;
+        AZStd::unordered_map<AZStd::string, u32> m_pathIndices;
+        AZStd::chrono::steady_clock::time_point m_startTime;
+        AZStd::atomic_bool m_isRecording{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Internal
+{
+    //! Opaque execution context with its own stack, defined by the platform implementation.
+    struct JobFiber;
+
+    /**
+     * Minimal fiber interface used by the work stealing job manager to suspend a waiting job without blocking the
+     * worker thread. A fiber is only ever switched to on the thread which created it, fibers never migrate between
+     * threads so thread local storage stays valid across a switch.
+     * On platforms without fiber support IsSupported returns false and the creation functions return nullptr, the job
+     * manager then falls back to assisting inline on the waiting job's stack.
+     */
+    namespace JobFiberPlatform
+    {
+        using EntryFunction = void (*)(void* userData);
+
+        bool IsSupported();
+
+        //! Wraps the calling thread's own stack in a fiber, required before switching to any other fiber on this thread.
+        JobFiber* ConvertCurrentThread();
+        //! Releases a fiber returned by ConvertCurrentThread, must be called on the same thread while running on it.
+        void RevertCurrentThread(JobFiber* fiber);
+
+        //! Creates a fiber which will call entry(userData) when first switched to, entry must never return.
+        JobFiber* Create(size_t stackSize, EntryFunction entry, void* userData);
+        //! Destroys a fiber returned by Create, the fiber must not be running.
+        void Destroy(JobFiber* fiber);
+
+        //! Saves the current context into from, which must be the fiber currently running, and resumes to.
+        void Switch(JobFiber* from, JobFiber* to);
+    } // namespace JobFiberPlatform
+} // namespace AZ::Internal
@@ -10,6 +10,7 @@
 
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/Internal/JobNotify.h>
+#include <AzCore/Memory/OSMemory.h>
 
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/lock.h>
@@ -30,47 +31,165 @@ bool CompareJobPriorities(AZ::s8 value, const Job* job)
     return value > job->GetPriority();
 }
 
+WorkQueue::WorkQueue()
+{
+    for (AZStd::atomic<Job*>& slot : m_ring)
+    {
+        slot.store(nullptr, AZStd::memory_order_relaxed);
+    }
+}
+
+bool WorkQueue::RingPush(Job* job)
+{
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed);
+    const AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+    if (bottom - top >= RingCapacity)
+    {
+        return false;
+    }
+
+    m_ring[bottom & RingMask].store(job, AZStd::memory_order_relaxed);
+    // publish the job before the new bottom becomes visible to thieves
+    AZStd::atomic_thread_fence(AZStd::memory_order_release);
+    m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+    return true;
+}
+
+Job* WorkQueue::RingPop()
+{
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+    m_bottom.store(bottom, AZStd::memory_order_relaxed);
+    // the new bottom must be visible before we read top, otherwise the owner and a thief could both take the last job
+    AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+    AZ::s64 top = m_top.load(AZStd::memory_order_relaxed);
+
+    Job* result = nullptr;
+    if (top <= bottom)
+    {
+        result = m_ring[bottom & RingMask].load(AZStd::memory_order_relaxed);
+        if (top == bottom)
+        {
+            // last job in the ring, race any thieves for it
+            if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+            {
+                result = nullptr;
+            }
+            m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        // ring was empty, restore bottom
+        m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+    }
+    return result;
+}
+
+Job* WorkQueue::RingSteal(bool& lostRace)
+{
+    lostRace = false;
+    AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+    AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_acquire);
+    if (top < bottom)
+    {
+        Job* result = m_ring[top & RingMask].load(AZStd::memory_order_relaxed);
+        if (m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+        {
+            return result;
+        }
+        // another thief or the owner took the job first
+        lostRace = true;
+    }
+    return nullptr;
+}
+
 void WorkQueue::LocalInsert(Job* job)
 {
-    LockGuard lock(m_lock);
-    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_queue.begin(),
-                                                                                   m_queue.end(),
+    if (job->GetPriority() == 0 && RingPush(job))
+    {
+        return;
+    }
+
+    // non-default priority or the ring is full, insert into the overflow queue based on the job's priority
+    LockGuard lock(m_overflowLock);
+    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_overflowQueue.begin(),
+                                                                                   m_overflowQueue.end(),
                                                                                    job->GetPriority(),
                                                                                    CompareJobPriorities);
-    m_queue.insert(locationToinsert, job);
+    m_overflowQueue.insert(locationToinsert, job);
+    m_overflowCount.fetch_add(1, AZStd::memory_order_release);
 }
 
-Job* WorkQueue::LocalPopFront()
+Job* WorkQueue::LocalPop()
 {
-    LockGuard lock(m_lock);
+    const bool hasOverflow = m_overflowCount.load(AZStd::memory_order_acquire) > 0;
 
-    Job* result = nullptr;
-    if (!m_queue.empty())
+    if (hasOverflow)
     {
-        result = m_queue.front();
-        m_queue.pop_front();
+        // higher priority jobs must run before anything in the ring
+        LockGuard lock(m_overflowLock);
+        if (!m_overflowQueue.empty() && m_overflowQueue.front()->GetPriority() > 0)
+        {
+            Job* result = m_overflowQueue.front();
+            m_overflowQueue.pop_front();
+            m_overflowCount.fetch_sub(1, AZStd::memory_order_release);
+            return result;
+        }
     }
 
-    return result;
+    if (Job* result = RingPop())
+    {
+        return result;
+    }
+
+    if (hasOverflow)
+    {
+        LockGuard lock(m_overflowLock);
+        if (!m_overflowQueue.empty())
+        {
+            Job* result = m_overflowQueue.front();
+            m_overflowQueue.pop_front();
+            m_overflowCount.fetch_sub(1, AZStd::memory_order_release);
+            return result;
+        }
+    }
+
+    return nullptr;
 }
 
-Job* WorkQueue::TryStealFront()
+Job* WorkQueue::TrySteal()
 {
     AZStd::exponential_backoff backoff;
     for (unsigned attempCount = 0; attempCount < TryStealSpinAttemps; ++attempCount)
     {
-        // Do a bounded spin with backoff to acquire the lock
-        if (m_lock.try_lock())
+        bool lostRace = false;
+        if (Job* result = RingSteal(lostRace))
+        {
+            return result;
+        }
+
+        if (m_overflowCount.load(AZStd::memory_order_acquire) > 0)
         {
-            Job* result = nullptr;
-            if (!m_queue.empty())
+            // Do a bounded spin with backoff to acquire the lock
+            if (m_overflowLock.try_lock())
             {
-                result = m_queue.front();
-                m_queue.pop_front();
-            }
+                Job* result = nullptr;
+                if (!m_overflowQueue.empty())
+                {
+                    result = m_overflowQueue.front();
+                    m_overflowQueue.pop_front();
+                    m_overflowCount.fetch_sub(1, AZStd::memory_order_release);
+                }
 
-            m_lock.unlock();
-            return result;
+                m_overflowLock.unlock();
+                return result;
+            }
+        }
+        else if (!lostRace)
+        {
+            // nothing to steal
+            return nullptr;
         }
 
         backoff.wait();
@@ -79,11 +198,19 @@ Job* WorkQueue::TryStealFront()
     return nullptr;
 }
 
+bool WorkQueue::HasStealableJobs() const
+{
+    return (m_bottom.load(AZStd::memory_order_relaxed) > m_top.load(AZStd::memory_order_relaxed)) ||
+        (m_overflowCount.load(AZStd::memory_order_relaxed) > 0);
+}
+
 
 AZ_THREAD_LOCAL JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::m_currentThreadInfo = nullptr;
 
 JobManagerWorkStealing::JobManagerWorkStealing(const JobManagerDesc& desc)
     : m_isAsynchronous(!desc.m_workerThreads.empty())
+    , m_useFibers(desc.m_enableFibers && JobFiberPlatform::IsSupported())
+    , m_fiberStackSize(desc.m_fiberStackSize)
     , m_workerThreads(AZStd::move(CreateWorkerThreads(desc)))
 {
     //allow workers to begin processing after they have all been created, needed to wait since they may access each others queues
@@ -197,7 +324,14 @@ void JobManagerWorkStealing::SuspendJobUntilReady(Job* job)
 
     if (IsAsynchronous())
     {
-        ProcessJobsAssist(info, job, nullptr);
+        if (info->m_currentFiber)
+        {
+            SuspendFiberUntilReady(info, job);
+        }
+        else
+        {
+            ProcessJobsAssist(info, job, nullptr);
+        }
     }
     else
     {
@@ -207,6 +341,110 @@ void JobManagerWorkStealing::SuspendJobUntilReady(Job* job)
     info->m_currentJob = job; //restore current job
 }
 
+void JobManagerWorkStealing::SuspendFiberUntilReady(ThreadInfo* info, Job* job)
+{
+    JobFiber* fiber = AcquireFiber(info);
+    if (!fiber)
+    {
+        //out of memory for fiber stacks, assist inline on this stack instead
+        ProcessJobsAssist(info, job, nullptr);
+        return;
+    }
+
+    //park the job on the current fiber, it is resumed by ProcessJobsFiber once the job's children are done
+    info->m_suspendedFibers.push_back({ info->m_currentFiber, job });
+    SwitchFiber(info, fiber);
+    AZ_Assert(job->GetDependentCount() == 0, "Suspended job fiber was resumed before the job was ready");
+}
+
+JobFiber* JobManagerWorkStealing::AcquireFiber(ThreadInfo* info)
+{
+    if (!info->m_freeFibers.empty())
+    {
+        JobFiber* fiber = info->m_freeFibers.back();
+        info->m_freeFibers.pop_back();
+        return fiber;
+    }
+
+    JobFiber* fiber = JobFiberPlatform::Create(m_fiberStackSize, &JobManagerWorkStealing::FiberMain, this);
+    if (fiber)
+    {
+        info->m_createdFibers.push_back(fiber);
+    }
+    return fiber;
+}
+
+JobFiber* JobManagerWorkStealing::PopReadyFiber(ThreadInfo* info)
+{
+    for (size_t i = 0; i < info->m_suspendedFibers.size(); ++i)
+    {
+        if (info->m_suspendedFibers[i].m_job->GetDependentCount() == 0)
+        {
+            JobFiber* fiber = info->m_suspendedFibers[i].m_fiber;
+            info->m_suspendedFibers[i] = info->m_suspendedFibers.back();
+            info->m_suspendedFibers.pop_back();
+            return fiber;
+        }
+    }
+    return nullptr;
+}
+
+void JobManagerWorkStealing::SwitchFiber(ThreadInfo* info, JobFiber* fiber)
+{
+    JobFiber* currentFiber = info->m_currentFiber;
+    info->m_currentFiber = fiber;
+    JobFiberPlatform::Switch(currentFiber, fiber);
+
+    //we are running on currentFiber again, now it's safe to reuse the fiber that switched back to us
+    RecycleFiber(info);
+}
+
+void JobManagerWorkStealing::RecycleFiber(ThreadInfo* info)
+{
+    if (info->m_fiberToRecycle)
+    {
+        info->m_freeFibers.push_back(info->m_fiberToRecycle);
+        info->m_fiberToRecycle = nullptr;
+    }
+}
+
+void JobManagerWorkStealing::FiberMain(void* userData)
+{
+    JobManagerWorkStealing* jobManager = static_cast<JobManagerWorkStealing*>(userData);
+    //fibers never leave the worker which created them, so the thread-local info is the creating worker's
+    ThreadInfo* info = m_currentThreadInfo;
+    RecycleFiber(info);
+    jobManager->ProcessJobsFiber(info);
+    AZ_Assert(false, "Pooled job fibers must switch back to the worker's root fiber on exit, not return");
+}
+
+void JobManagerWorkStealing::ProcessJobsFiber(ThreadInfo* info)
+{
+    while (true)
+    {
+        JobFiber* resumeFiber = nullptr;
+        ProcessJobsInternal(info, nullptr, nullptr, &resumeFiber);
+
+        if (!resumeFiber)
+        {
+            //quit requested, unwind back to the worker thread's own stack
+            AZ_Assert(info->m_suspendedFibers.empty(), "Job manager is shutting down while jobs are still suspended");
+            if (info->m_currentFiber == info->m_rootFiber)
+            {
+                return;
+            }
+            auto rootIt = AZStd::find(info->m_freeFibers.begin(), info->m_freeFibers.end(), info->m_rootFiber);
+            AZ_Assert(rootIt != info->m_freeFibers.end(), "Worker root fiber should be idle when shutting down");
+            info->m_freeFibers.erase(rootIt);
+            resumeFiber = info->m_rootFiber;
+        }
+
+        //this fiber only runs the scheduler, it can be reused as soon as we have switched away from it
+        info->m_fiberToRecycle = info->m_currentFiber;
+        SwitchFiber(info, resumeFiber);
+    }
+}
+
 void JobManagerWorkStealing::StartJobAndAssistUntilComplete(Job* job)
 {
     ThreadInfo* info = GetCurrentOrCreateThreadInfo();
@@ -307,7 +545,26 @@ void JobManagerWorkStealing::ProcessJobsWorker(ThreadInfo* info)
     //setup thread-local storage
     m_currentThreadInfo = info;
 
-    ProcessJobsInternal(info, nullptr, nullptr);
+    info->m_rootFiber = m_useFibers ? JobFiberPlatform::ConvertCurrentThread() : nullptr;
+    if (info->m_rootFiber)
+    {
+        info->m_currentFiber = info->m_rootFiber;
+        ProcessJobsFiber(info);
+
+        info->m_freeFibers.clear();
+        for (JobFiber* fiber : info->m_createdFibers)
+        {
+            JobFiberPlatform::Destroy(fiber);
+        }
+        info->m_createdFibers.clear();
+        info->m_currentFiber = nullptr;
+        JobFiberPlatform::RevertCurrentThread(info->m_rootFiber);
+        info->m_rootFiber = nullptr;
+    }
+    else
+    {
+        ProcessJobsInternal(info, nullptr, nullptr);
+    }
 
     m_currentThreadInfo = nullptr;
 }
@@ -322,10 +579,27 @@ void JobManagerWorkStealing::ProcessJobsAssist(ThreadInfo* info, Job* suspendedJ
     m_currentThreadInfo = oldInfo; //restore previous ThreadInfo, necessary as must be NULL when returning to user code to support multiple job contexts
 }
 
-void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag)
+void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag, JobFiber** resumeFiber)
 {
     AZ_Assert(IsAsynchronous(), "ProcessJobs is only to be used when we have worker threads (can be called on non-workers too though)");
 
+    //returns true when we should stop processing, because the job we are waiting for is ready, or (when running on fibers)
+    //a suspended job of this worker is ready and its fiber should be resumed
+    auto isWaitComplete = [this, info, suspendedJob, notifyFlag, resumeFiber]()
+    {
+        if ((suspendedJob && (suspendedJob->GetDependentCount() == 0)) ||
+            (notifyFlag && notifyFlag->load(AZStd::memory_order_acquire)))
+        {
+            return true;
+        }
+        if (resumeFiber && !info->m_suspendedFibers.empty())
+        {
+            *resumeFiber = PopReadyFiber(info);
+            return *resumeFiber != nullptr;
+        }
+        return false;
+    };
+
     //get thread local job queue
     WorkQueue* pendingJobs = info->m_isWorker ? &info->m_pendingJobs : nullptr;
     unsigned int victim = ((m_workerThreads.size() > 1) && (m_workerThreads[0] == info)) ? 1 : 0;
@@ -333,8 +607,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
     while (true)
     {
         //check if suspended job is ready, before we try to get a new job
-        if ((suspendedJob && (suspendedJob->GetDependentCount() == 0)) ||
-            (notifyFlag && notifyFlag->load(AZStd::memory_order_acquire)))
+        if (isWaitComplete())
         {
             return;
         }
@@ -343,7 +616,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
         Job* job = nullptr;
         {
             //go to sleep if the global queue is empty (but only if this thread is a worker and does not have a suspended job)
-            if (info->m_isWorker && !suspendedJob)
+            if (info->m_isWorker && !suspendedJob && info->m_suspendedFibers.empty())
             {
                 if (m_quitRequested)
                 {
@@ -382,8 +655,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
             }
 
             //check if suspended job is ready, before we try to get a new job
-            if ((suspendedJob && (suspendedJob->GetDependentCount() == 0)) ||
-                (notifyFlag && notifyFlag->load(AZStd::memory_order_acquire)))
+            if (isWaitComplete())
             {
                 return;
             }
@@ -404,7 +676,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
         if (!job && pendingJobs)
         {
             //nothing on the global queue, try to pop from the local queue
-            job = pendingJobs->LocalPopFront();
+            job = pendingJobs->LocalPop();
         }
 
         bool isTerminated = false;
@@ -425,8 +697,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 ++info->m_jobsDone;
 #endif
                 //check if our suspended job is ready, before we try running a new job
-                if ((suspendedJob && (suspendedJob->GetDependentCount() == 0)) ||
-                    (notifyFlag && notifyFlag->load(AZStd::memory_order_acquire)))
+                if (isWaitComplete())
                 {
                     return;
                 }
@@ -434,10 +705,10 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 //pop a new job from the local queue
                 if (pendingJobs)
                 {
-                    job = pendingJobs->LocalPopFront();
-                    if (job)
+                    job = pendingJobs->LocalPop();
+                    if (job && pendingJobs->HasStealableJobs())
                     {
-                        // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
+                        // not necessary, just an optimization - wakeup sleeping threads, there's work left for them to steal
                         ActivateWorker();
                     }
                 }
@@ -463,8 +734,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 while (!job)
                 {
                     //check if our suspended job is ready, before we try stealing a new job
-                    if ((suspendedJob && (suspendedJob->GetDependentCount() == 0)) ||
-                        (notifyFlag && notifyFlag->load(AZStd::memory_order_acquire)))
+                    if (isWaitComplete())
                     {
                         return;
                     }
@@ -473,7 +743,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     WorkQueue* victimQueue = &m_workerThreads[victim]->m_pendingJobs;
 
                     //attempt the steal
-                    job = victimQueue->TryStealFront();
+                    job = victimQueue->TrySteal();
                     if (job)
                     {
                         //success, continue with the stolen job
@@ -649,8 +919,12 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
 
         info->m_thread = AZStd::thread(
             threadDesc,
-            [this, info]()
+            [this, info, numaNode = desc.m_numaNode]()
             {
+                if (numaNode >= 0)
+                {
+                    OSMemory::SetCurrentThreadNumaNode(numaNode);
+                }
                 this->ProcessJobsWorker(info);
             }
         );
@@ -10,6 +10,7 @@
 
 // Included directly from JobManager.h
 
+#include <AzCore/Jobs/Internal/JobFiber.h>
 #include <AzCore/Jobs/Internal/JobManagerBase.h>
 #include <AzCore/Jobs/JobManagerDesc.h>
 #include <AzCore/Memory/PoolAllocator.h>
@@ -27,32 +28,59 @@ namespace AZ
 
     namespace Internal
     {
+        /**
+         * Per worker job queue, based on the bounded Chase-Lev work stealing deque.
+         * Only the owning worker may call LocalInsert and LocalPop, any thread may call TrySteal.
+         * Jobs with the default priority go into a lock-free ring buffer, the owner pushes and pops at the bottom (LIFO, which
+         * keeps forked jobs hot in the cache) while thieves take the oldest jobs from the top. Jobs with a non-default priority,
+         * or jobs which don't fit in the ring, go into a priority sorted overflow queue guarded by a lock. The overflow queue
+         * is only touched when its atomic job count is non-zero, so the common fork/join path never takes a lock.
+         */
         class WorkQueue final
         {
         public:
-            void LocalInsert(Job *job);
-            Job* LocalPopFront();
-            Job* TryStealFront();
+            WorkQueue();
+
+            void LocalInsert(Job* job);
+            Job* LocalPop();
+            Job* TrySteal();
+
+            //! Returns true if there are jobs which another worker could steal, limited utility for a concurrent container.
+            bool HasStealableJobs() const;
 
         private:
             enum
             {
                 TryStealSpinAttemps = 16,
             };
+            static constexpr AZ::s64 RingCapacity = 1024; // must be a power of two
+            static constexpr AZ::s64 RingMask = RingCapacity - 1;
+
+            bool RingPush(Job* job);
+            Job* RingPop();
+            Job* RingSteal(bool& lostRace);
+
             using LockType = AZStd::shared_mutex;
             using LockGuard = AZStd::lock_guard<LockType>;
 
-            AZStd::deque<Job*> m_queue;
-            LockType m_lock;
+            // m_top and m_bottom are separated by the ring to keep thieves and the owner on different cache lines.
+            AZStd::atomic<AZ::s64> m_top{ 0 };
+            AZStd::atomic<Job*> m_ring[RingCapacity];
+            AZStd::atomic<AZ::s64> m_bottom{ 0 };
+
+            AZStd::deque<Job*> m_overflowQueue;
+            AZStd::atomic_uint m_overflowCount{ 0 };
+            LockType m_overflowLock;
         };
 
         /**
          * Work stealing is in practice a very efficient way for processing fine grained jobs.
-         * IMPORTANT: Because we want to put worker threads to sleep we do have extra locks and condition
-         * variable in the code. In addition we are constantly kicking sleeping threads when we add jobs,
-         * this is NOT efficient. Once we have heavier job loads (in practice) try to optimize and remove
-         * those sticky points (if they are a problem). In addition we can think about writing a more advanced
-         * scheduler or use some off the shelf.
+         * Each worker owns a lock-free WorkQueue, jobs added from non-worker threads go through a global queue.
+         * Because we want to put worker threads to sleep we do have a lock around the global queue and a semaphore per worker.
+         * Sleeping workers are only woken when a job is added, or when a worker pops a job and still has stealable work
+         * left in its queue, so busy workers don't keep kicking each other while draining their own queue.
+         * With fibers enabled a worker suspending a job parks the job's fiber and keeps processing on a pooled fiber, the
+         * parked fiber is resumed by the same worker once the job's children are done. Fibers never leave their worker.
          */
         class JobManagerWorkStealing final
             : public JobManagerBase
@@ -100,6 +128,19 @@ namespace AZ
                 WorkQueue m_pendingJobs;
                 unsigned int m_workerId = JobManagerBase::InvalidWorkerThreadId;
 
+                // valid only on workers running on fibers, only ever accessed by the worker itself
+                struct SuspendedFiber
+                {
+                    JobFiber* m_fiber;
+                    Job* m_job;
+                };
+                JobFiber* m_rootFiber = nullptr; // the worker thread's own stack
+                JobFiber* m_currentFiber = nullptr;
+                JobFiber* m_fiberToRecycle = nullptr; // fiber we switched away from, returned to the free list after the switch
+                AZStd::vector<SuspendedFiber> m_suspendedFibers;
+                AZStd::vector<JobFiber*> m_freeFibers;
+                AZStd::vector<JobFiber*> m_createdFibers;
+
 #ifdef JOBMANAGER_ENABLE_STATS
                 unsigned int m_globalJobs = 0;
                 unsigned int m_jobsForked = 0;
@@ -114,7 +155,14 @@ namespace AZ
             void ProcessJobsWorker(ThreadInfo* info);
             void ProcessJobsAssist(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             void ProcessJobsSynchronous(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
-            void ProcessJobsInternal(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
+            void ProcessJobsInternal(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag, JobFiber** resumeFiber = nullptr);
+            void ProcessJobsFiber(ThreadInfo* info);
+            void SuspendFiberUntilReady(ThreadInfo* info, Job* job);
+            JobFiber* AcquireFiber(ThreadInfo* info);
+            JobFiber* PopReadyFiber(ThreadInfo* info);
+            void SwitchFiber(ThreadInfo* info, JobFiber* fiber);
+            static void RecycleFiber(ThreadInfo* info);
+            static void FiberMain(void* userData);
             ThreadList CreateWorkerThreads(const JobManagerDesc& jmDesc);
 #ifndef AZ_MONOLITHIC_BUILD
             ThreadInfo* CrossModuleFindAndSetWorkerThreadInfo() const;
@@ -123,6 +171,8 @@ namespace AZ
             ThreadInfo* GetCurrentOrCreateThreadInfo();
 
             bool m_isAsynchronous;
+            bool m_useFibers;
+            size_t m_fiberStackSize;
 
             ThreadList m_threads;
             mutable AZStd::mutex m_threadsMutex;
@@ -17,6 +17,7 @@
 
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/Memory/OSMemory.h>
 
 #include <AzCore/Console/IConsole.h>
 
@@ -25,6 +26,7 @@
 AZ_CVAR(float, cl_jobThreadsConcurrencyRatio, AZ_TRAIT_USE_JOB_THREADS_CONCURRENCY_RATIO, nullptr, AZ::ConsoleFunctorFlags::Null, "Legacy Job system multiplier on the number of hw threads the machine creates at initialization");
 AZ_CVAR(uint32_t, cl_jobThreadsNumReserved, 2, nullptr, AZ::ConsoleFunctorFlags::Null, "Legacy Job system number of hardware threads that are reserved for O3DE system threads");
 AZ_CVAR(uint32_t, cl_jobThreadsMinNumber, 3, nullptr, AZ::ConsoleFunctorFlags::Null, "Legacy Job system minimum number of worker threads to create after scaling the number of hw threads");
+AZ_CVAR(bool, cl_jobThreadsNumaNodes, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Legacy Job system spreads its worker threads over the NUMA nodes of the machine and binds each to its node");
 
 namespace AZ
 {
@@ -66,8 +68,13 @@ namespace AZ
         }
 
         threadDesc.m_cpuId = AFFINITY_MASK_USERTHREADS;
+        const unsigned int numaNodeCount = cl_jobThreadsNumaNodes ? OSMemory::GetNumaNodeCount() : 1;
         for (int i = 0; i < numberOfWorkerThreads; ++i)
         {
+            if (numaNodeCount > 1)
+            {
+                threadDesc.m_numaNode = i % static_cast<int>(numaNodeCount);
+            }
             desc.m_workerThreads.push_back(threadDesc);
         }
 
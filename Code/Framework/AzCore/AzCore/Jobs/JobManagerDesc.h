@@ -36,10 +36,18 @@ namespace AZ
         */
         int     m_stackSize;
 
-        JobManagerThreadDesc(int cpuId = -1, int priority = 0, int stackSize = -1)
+        /**
+         *  NUMA node the thread is bound to, see \ref AZ::OSMemory::SetCurrentThreadNumaNode. The thread then only runs
+         *  on the processors of that node and its allocations prefer the node's memory, overriding m_cpuId.
+         *  Default is -1, no binding.
+         */
+        int     m_numaNode;
+
+        JobManagerThreadDesc(int cpuId = -1, int priority = 0, int stackSize = -1, int numaNode = -1)
             : m_cpuId(cpuId)
             , m_priority(priority)
             , m_stackSize(stackSize)
+            , m_numaNode(numaNode)
         {
         }
     };
@@ -55,5 +63,18 @@ namespace AZ
 
         using DescList = AZStd::fixed_vector<JobManagerThreadDesc, 64>;
         DescList m_workerThreads; ///< List of worker threads to create
+
+        /**
+         *  Run the worker threads on fibers. A job which waits for its children (Job::WaitForChildren, or a
+         *  JobCompletion started and waited on from inside a job) then yields its fiber, and the worker carries on with
+         *  other jobs on a pooled fiber, instead of running them nested on top of the waiting job's stack.
+         *  Deep chains of waiting jobs no longer grow the worker stack. Ignored on platforms without fiber support.
+         */
+        bool m_enableFibers = false;
+
+        /**
+         *  Stack size of each pooled fiber, only used when m_enableFibers is set.
+         */
+        size_t m_fiberStackSize = 256 * 1024;
     };
 }
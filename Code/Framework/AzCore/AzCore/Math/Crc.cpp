@@ -8,12 +8,212 @@
 
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 
 #include <string.h>
 
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define AZ_CRC32_PCLMUL 1
+    #include <immintrin.h>
+    #if defined(__clang__) || defined(__GNUC__)
+        // The folding functions are compiled for PCLMULQDQ and SSE4.1 and only called when the CPU supports them.
+        #define AZ_CRC32_PCLMUL_TARGET __attribute__((target("pclmul,sse4.1")))
+    #else
+        #include <intrin.h>
+        #define AZ_CRC32_PCLMUL_TARGET
+    #endif
+#elif defined(__ARM_FEATURE_CRC32)
+    // ARMv8 has instructions for the same polynomial as the table.
+    #define AZ_CRC32_ARM 1
+    #include <arm_acle.h>
+#endif
+
 namespace AZ::Internal
 {
     template struct AggregateTypes<Crc32>;
+
+    namespace
+    {
+        // Slicing-by-8 tables, m_table[k][b] is the CRC of byte b followed by k zero bytes.
+        struct Crc32Tables
+        {
+            u32 m_table[8][256];
+        };
+
+        constexpr Crc32Tables CreateCrc32Tables()
+        {
+            Crc32Tables tables{};
+            for (u32 byte = 0; byte < 256; ++byte)
+            {
+                tables.m_table[0][byte] = crc_table[byte];
+            }
+            for (u32 byte = 0; byte < 256; ++byte)
+            {
+                for (size_t k = 1; k < 8; ++k)
+                {
+                    const u32 previous = tables.m_table[k - 1][byte];
+                    tables.m_table[k][byte] = (previous >> 8) ^ tables.m_table[0][previous & 0xff];
+                }
+            }
+            return tables;
+        }
+
+        constexpr Crc32Tables s_crc32Tables = CreateCrc32Tables();
+
+        u32 Crc32Software(u32 crc, const uint8_t* data, size_t size)
+        {
+            const auto& table = s_crc32Tables.m_table;
+            while (size >= 8)
+            {
+                const u32 low = crc ^ (u32(data[0]) | (u32(data[1]) << 8) | (u32(data[2]) << 16) | (u32(data[3]) << 24));
+                const u32 high = u32(data[4]) | (u32(data[5]) << 8) | (u32(data[6]) << 16) | (u32(data[7]) << 24);
+                crc = table[7][low & 0xff] ^ table[6][(low >> 8) & 0xff] ^ table[5][(low >> 16) & 0xff] ^ table[4][low >> 24]
+                    ^ table[3][high & 0xff] ^ table[2][(high >> 8) & 0xff] ^ table[1][(high >> 16) & 0xff] ^ table[0][high >> 24];
+                data += 8;
+                size -= 8;
+            }
+            while (size--)
+            {
+                crc = ComputeCrc32Octet(crc, *data++);
+            }
+            return crc;
+        }
+
+#if defined(AZ_CRC32_PCLMUL)
+        bool HasPclmul()
+        {
+#if defined(__clang__) || defined(__GNUC__)
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+#else
+            int cpuInfo[4];
+            __cpuid(cpuInfo, 1);
+            constexpr int PclmulBit = 1 << 1;
+            constexpr int Sse41Bit = 1 << 19;
+            return (cpuInfo[2] & PclmulBit) && (cpuInfo[2] & Sse41Bit);
+#endif
+        }
+
+        // Zero initialized before the dynamic initialization, so CRCs computed by other static initializers use the tables.
+        const bool s_hasPclmul = HasPclmul();
+
+        AZ_CRC32_PCLMUL_TARGET inline __m128i Crc32Fold16(__m128i value, __m128i next, __m128i constants)
+        {
+            const __m128i low = _mm_clmulepi64_si128(value, constants, 0x00);
+            const __m128i high = _mm_clmulepi64_si128(value, constants, 0x11);
+            return _mm_xor_si128(_mm_xor_si128(high, next), low);
+        }
+
+        // Folds 64 bytes at a time with carry-less multiplies, following "Fast CRC Computation for Generic Polynomials Using
+        // PCLMULQDQ Instruction" from Intel. The size must be at least 64 and a multiple of 16.
+        AZ_CRC32_PCLMUL_TARGET u32 Crc32Pclmul(u32 crc, const uint8_t* data, size_t size)
+        {
+            alignas(16) static constexpr uint64_t k1k2[] = { 0x0154442bd4, 0x01c6e41596 };
+            alignas(16) static constexpr uint64_t k3k4[] = { 0x01751997d0, 0x00ccaa009e };
+            alignas(16) static constexpr uint64_t k5k0[] = { 0x0163cd6124, 0x0000000000 };
+            alignas(16) static constexpr uint64_t poly[] = { 0x01db710641, 0x01f7011641 };
+
+            __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00));
+            __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10));
+            __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20));
+            __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30));
+            x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+            __m128i constants = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+            data += 64;
+            size -= 64;
+
+            while (size >= 64)
+            {
+                x1 = Crc32Fold16(x1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00)), constants);
+                x2 = Crc32Fold16(x2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10)), constants);
+                x3 = Crc32Fold16(x3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20)), constants);
+                x4 = Crc32Fold16(x4, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30)), constants);
+                data += 64;
+                size -= 64;
+            }
+
+            // Fold the four lanes into one, then the remaining 16 byte blocks.
+            constants = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+            x1 = Crc32Fold16(x1, x2, constants);
+            x1 = Crc32Fold16(x1, x3, constants);
+            x1 = Crc32Fold16(x1, x4, constants);
+            while (size >= 16)
+            {
+                x1 = Crc32Fold16(x1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), constants);
+                data += 16;
+                size -= 16;
+            }
+
+            // Fold 128 bits to 64 bits.
+            const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+            x2 = _mm_clmulepi64_si128(x1, constants, 0x10);
+            x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+            constants = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+            x2 = _mm_srli_si128(x1, 4);
+            x1 = _mm_and_si128(x1, mask32);
+            x1 = _mm_clmulepi64_si128(x1, constants, 0x00);
+            x1 = _mm_xor_si128(x1, x2);
+
+            // Barrett reduction to 32 bits.
+            constants = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+            x2 = _mm_and_si128(x1, mask32);
+            x2 = _mm_clmulepi64_si128(x2, constants, 0x10);
+            x2 = _mm_and_si128(x2, mask32);
+            x2 = _mm_clmulepi64_si128(x2, constants, 0x00);
+            x1 = _mm_xor_si128(x1, x2);
+            return static_cast<u32>(_mm_extract_epi32(x1, 1));
+        }
+#endif
+
+        u32 Crc32UpdateRaw(u32 crc, const uint8_t* data, size_t size)
+        {
+#if defined(AZ_CRC32_PCLMUL)
+            // Folding has a fixed setup cost, so short data like names stays on the tables.
+            if (size >= 64 && s_hasPclmul)
+            {
+                const size_t foldSize = size & ~size_t(15);
+                crc = Crc32Pclmul(crc, data, foldSize);
+                data += foldSize;
+                size -= foldSize;
+            }
+#elif defined(AZ_CRC32_ARM)
+            while (size >= 8)
+            {
+                uint64_t value;
+                memcpy(&value, data, sizeof(value));
+                crc = __crc32d(crc, value);
+                data += 8;
+                size -= 8;
+            }
+#endif
+            return Crc32Software(crc, data, size);
+        }
+    } // namespace
+
+    u32 Crc32Update(u32 crc, const void* data, size_t size, bool forceLowerCase)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+        if (!forceLowerCase)
+        {
+            return Crc32UpdateRaw(crc, bytes, size);
+        }
+
+        // Lower the case in small chunks so the fast path can still be used.
+        uint8_t lowerCase[256];
+        while (size > 0)
+        {
+            const size_t chunkSize = AZStd::min(size, sizeof(lowerCase));
+            for (size_t i = 0; i < chunkSize; ++i)
+            {
+                const uint8_t byte = bytes[i];
+                lowerCase[i] = (byte >= 'A' && byte <= 'Z') ? static_cast<uint8_t>(byte + 'a' - 'A') : byte;
+            }
+            crc = Crc32UpdateRaw(crc, lowerCase, chunkSize);
+            bytes += chunkSize;
+            size -= chunkSize;
+        }
+        return crc;
+    }
 }
 
 namespace AZ
@@ -40,7 +240,14 @@ namespace AZ
     //=========================================================================
     void Crc32::Add(const void* data, size_t size, bool forceLowerCase)
     {
-        Combine(Crc32{ data, size, forceLowerCase }, size);
+        if (!data)
+        {
+            Combine(0, size);
+            return;
+        }
+
+        // Continuing the CRC gives the same value as combining with the CRC of the data, without the cost of the combine.
+        m_value = Internal::Crc32Update(m_value ^ 0xffffffff, data, size, forceLowerCase) ^ 0xffffffff;
     }
 
     //=========================================================================
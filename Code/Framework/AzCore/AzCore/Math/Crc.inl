@@ -115,6 +115,11 @@ namespace AZ
             return crc_table[(static_cast<int>(currentCrc) ^ dataOctet) & 0xff] ^ (currentCrc >> 8);
         }
 
+        //! Runtime update of a running CRC (before the final inversion), with the same result as ComputeCrc32Octet.
+        //! Uses the CRC instructions of the CPU when available (carry-less multiply on x86, CRC32 on ARMv8) and
+        //! slicing-by-8 tables otherwise.
+        u32 Crc32Update(u32 crc, const void* data, size_t size, bool forceLowerCase);
+
         template<typename CharType>
         constexpr void Crc32Set(const CharType* data, size_t size, bool forceLowerCase, AZ::u32& value)
         {
@@ -126,6 +131,11 @@ namespace AZ
             else
             {
                 unsigned int crc = 0xffffffffL;
+                if (!az_builtin_is_constant_evaluated())
+                {
+                    value = Crc32Update(crc, buf, size, forceLowerCase) ^ 0xffffffffL;
+                    return;
+                }
                 if (size)
                 {
                     if (forceLowerCase)
@@ -173,6 +183,11 @@ namespace AZ
     {
         if (!view.empty())
         {
+            if (!az_builtin_is_constant_evaluated())
+            {
+                Add(view.data(), view.size(), true);
+                return;
+            }
             size_t len = view.size();
             u32 crc = static_cast<u32>(Crc32(view));
             Combine(crc, len);
@@ -184,11 +199,22 @@ namespace AZ
     //=========================================================================
     constexpr void Crc32::Add(const uint8_t* data, size_t size, bool forceLowerCase)
     {
+        if (data && !az_builtin_is_constant_evaluated())
+        {
+            // Continuing the CRC gives the same value as combining with the CRC of the data, without the cost of the combine.
+            m_value = Internal::Crc32Update(m_value ^ 0xffffffff, data, size, forceLowerCase) ^ 0xffffffff;
+            return;
+        }
         Combine(Crc32{ data, size, forceLowerCase }, size);
     }
 
     constexpr void Crc32::Add(const char* data, size_t size, bool forceLowerCase)
     {
+        if (data && !az_builtin_is_constant_evaluated())
+        {
+            m_value = Internal::Crc32Update(m_value ^ 0xffffffff, data, size, forceLowerCase) ^ 0xffffffff;
+            return;
+        }
         Combine(Crc32{ data, size, forceLowerCase }, size);
     }
 
@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathBatch.h>
+
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace MathBatch
+    {
+        namespace
+        {
+            using Simd::Vec4;
+
+            size_t GetBatchCount(size_t size)
+            {
+                return (size + Vector3Soa::BatchSize - 1) / Vector3Soa::BatchSize;
+            }
+
+            //! Loads a batch from an array that isn't padded, filling the elements past the end with zeros.
+            Vec4::FloatType LoadPartial(const float* values, size_t count)
+            {
+                if (count >= Vector3Soa::BatchSize)
+                {
+                    return Vec4::LoadUnaligned(values);
+                }
+
+                float batch[Vector3Soa::BatchSize] = {};
+                AZStd::copy(values, values + count, batch);
+                return Vec4::LoadUnaligned(batch);
+            }
+
+            //! Stores a batch to an array that isn't padded, dropping the elements past the end.
+            void StorePartial(float* values, size_t count, Vec4::FloatArgType batch)
+            {
+                if (count >= Vector3Soa::BatchSize)
+                {
+                    Vec4::StoreUnaligned(values, batch);
+                    return;
+                }
+
+                float batchValues[Vector3Soa::BatchSize];
+                Vec4::StoreUnaligned(batchValues, batch);
+                AZStd::copy(batchValues, batchValues + count, values);
+            }
+
+            //! Appends the indices of the lanes where the mask is set, ignoring the lanes past size.
+            void AppendVisibleIndices(Vec4::FloatArgType visibleMask, size_t first, size_t size, AZStd::vector<uint32_t>& visibleIndices)
+            {
+                int32_t lanes[Vector3Soa::BatchSize];
+                Vec4::StoreUnaligned(lanes, Vec4::CastToInt(visibleMask));
+                const size_t count = AZStd::min(Vector3Soa::BatchSize, size - first);
+                for (size_t lane = 0; lane < count; ++lane)
+                {
+                    if (lanes[lane] != 0)
+                    {
+                        visibleIndices.push_back(static_cast<uint32_t>(first + lane));
+                    }
+                }
+            }
+
+            void TransformBatches(const Matrix3x4& matrix, const Vector3Soa& input, Vector3Soa& output, bool includeTranslation)
+            {
+                Vec4::FloatType elements[3][4];
+                for (int32_t row = 0; row < 3; ++row)
+                {
+                    for (int32_t col = 0; col < 4; ++col)
+                    {
+                        elements[row][col] = Vec4::Splat(matrix.GetElement(row, col));
+                    }
+                    if (!includeTranslation)
+                    {
+                        elements[row][3] = Vec4::ZeroFloat();
+                    }
+                }
+
+                output.Resize(input.GetSize());
+                const float* inX = input.GetX();
+                const float* inY = input.GetY();
+                const float* inZ = input.GetZ();
+                float* outX = output.GetX();
+                float* outY = output.GetY();
+                float* outZ = output.GetZ();
+                for (size_t i = 0; i < input.GetPaddedSize(); i += Vector3Soa::BatchSize)
+                {
+                    const Vec4::FloatType x = Vec4::LoadUnaligned(inX + i);
+                    const Vec4::FloatType y = Vec4::LoadUnaligned(inY + i);
+                    const Vec4::FloatType z = Vec4::LoadUnaligned(inZ + i);
+                    float* outputs[3] = { outX + i, outY + i, outZ + i };
+                    for (int32_t row = 0; row < 3; ++row)
+                    {
+                        const Vec4::FloatType result = Vec4::Madd(
+                            elements[row][0], x, Vec4::Madd(elements[row][1], y, Vec4::Madd(elements[row][2], z, elements[row][3])));
+                        Vec4::StoreUnaligned(outputs[row], result);
+                    }
+                }
+            }
+        } // namespace
+
+        Vector3Soa::Vector3Soa(size_t size)
+        {
+            Resize(size);
+        }
+
+        Vector3Soa::Vector3Soa(AZStd::span<const Vector3> values)
+        {
+            Resize(values.size());
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                Set(i, values[i]);
+            }
+        }
+
+        void Vector3Soa::Resize(size_t size)
+        {
+            // The kernels also write to the padding, so clear it to make sure that new elements start at zero.
+            const size_t paddedSize = GetBatchCount(size) * BatchSize;
+            const size_t first = AZStd::min(size, m_size);
+            AZStd::fill(m_x.begin() + first, m_x.end(), 0.0f);
+            AZStd::fill(m_y.begin() + first, m_y.end(), 0.0f);
+            AZStd::fill(m_z.begin() + first, m_z.end(), 0.0f);
+            m_x.resize(paddedSize, 0.0f);
+            m_y.resize(paddedSize, 0.0f);
+            m_z.resize(paddedSize, 0.0f);
+            m_size = size;
+        }
+
+        void Vector3Soa::Clear()
+        {
+            m_x.clear();
+            m_y.clear();
+            m_z.clear();
+            m_size = 0;
+        }
+
+        size_t Vector3Soa::GetSize() const
+        {
+            return m_size;
+        }
+
+        void Vector3Soa::Set(size_t index, const Vector3& value)
+        {
+            AZ_Assert(index < m_size, "Index %zu is out of range for %zu values.", index, m_size);
+            m_x[index] = value.GetX();
+            m_y[index] = value.GetY();
+            m_z[index] = value.GetZ();
+        }
+
+        Vector3 Vector3Soa::Get(size_t index) const
+        {
+            AZ_Assert(index < m_size, "Index %zu is out of range for %zu values.", index, m_size);
+            return Vector3(m_x[index], m_y[index], m_z[index]);
+        }
+
+        void Vector3Soa::CopyTo(AZStd::span<Vector3> values) const
+        {
+            AZ_Assert(values.size() >= m_size, "Output has %zu elements, but %zu are required.", values.size(), m_size);
+            for (size_t i = 0; i < m_size; ++i)
+            {
+                values[i] = Get(i);
+            }
+        }
+
+        float* Vector3Soa::GetX()
+        {
+            return m_x.data();
+        }
+
+        float* Vector3Soa::GetY()
+        {
+            return m_y.data();
+        }
+
+        float* Vector3Soa::GetZ()
+        {
+            return m_z.data();
+        }
+
+        const float* Vector3Soa::GetX() const
+        {
+            return m_x.data();
+        }
+
+        const float* Vector3Soa::GetY() const
+        {
+            return m_y.data();
+        }
+
+        const float* Vector3Soa::GetZ() const
+        {
+            return m_z.data();
+        }
+
+        size_t Vector3Soa::GetPaddedSize() const
+        {
+            return m_x.size();
+        }
+
+        void TransformPoints(const Matrix3x4& matrix, const Vector3Soa& points, Vector3Soa& outPoints)
+        {
+            TransformBatches(matrix, points, outPoints, true);
+        }
+
+        void TransformPoints(const Transform& transform, const Vector3Soa& points, Vector3Soa& outPoints)
+        {
+            TransformBatches(Matrix3x4::CreateFromTransform(transform), points, outPoints, true);
+        }
+
+        void TransformVectors(const Matrix3x4& matrix, const Vector3Soa& vectors, Vector3Soa& outVectors)
+        {
+            TransformBatches(matrix, vectors, outVectors, false);
+        }
+
+        void Dot(const Vector3Soa& lhs, const Vector3Soa& rhs, AZStd::span<float> outDots)
+        {
+            AZ_Assert(lhs.GetSize() == rhs.GetSize(), "Vector arrays have different sizes, %zu and %zu.", lhs.GetSize(), rhs.GetSize());
+            AZ_Assert(outDots.size() >= lhs.GetSize(), "Output has %zu elements, but %zu are required.", outDots.size(), lhs.GetSize());
+
+            const size_t size = lhs.GetSize();
+            for (size_t i = 0; i < size; i += Vector3Soa::BatchSize)
+            {
+                const Vec4::FloatType dot = Vec4::Madd(
+                    Vec4::LoadUnaligned(lhs.GetX() + i),
+                    Vec4::LoadUnaligned(rhs.GetX() + i),
+                    Vec4::Madd(
+                        Vec4::LoadUnaligned(lhs.GetY() + i),
+                        Vec4::LoadUnaligned(rhs.GetY() + i),
+                        Vec4::Mul(Vec4::LoadUnaligned(lhs.GetZ() + i), Vec4::LoadUnaligned(rhs.GetZ() + i))));
+                StorePartial(outDots.data() + i, size - i, dot);
+            }
+        }
+
+        void Cross(const Vector3Soa& lhs, const Vector3Soa& rhs, Vector3Soa& outCross)
+        {
+            AZ_Assert(lhs.GetSize() == rhs.GetSize(), "Vector arrays have different sizes, %zu and %zu.", lhs.GetSize(), rhs.GetSize());
+
+            outCross.Resize(lhs.GetSize());
+            for (size_t i = 0; i < lhs.GetPaddedSize(); i += Vector3Soa::BatchSize)
+            {
+                const Vec4::FloatType lhsX = Vec4::LoadUnaligned(lhs.GetX() + i);
+                const Vec4::FloatType lhsY = Vec4::LoadUnaligned(lhs.GetY() + i);
+                const Vec4::FloatType lhsZ = Vec4::LoadUnaligned(lhs.GetZ() + i);
+                const Vec4::FloatType rhsX = Vec4::LoadUnaligned(rhs.GetX() + i);
+                const Vec4::FloatType rhsY = Vec4::LoadUnaligned(rhs.GetY() + i);
+                const Vec4::FloatType rhsZ = Vec4::LoadUnaligned(rhs.GetZ() + i);
+                Vec4::StoreUnaligned(outCross.GetX() + i, Vec4::Sub(Vec4::Mul(lhsY, rhsZ), Vec4::Mul(lhsZ, rhsY)));
+                Vec4::StoreUnaligned(outCross.GetY() + i, Vec4::Sub(Vec4::Mul(lhsZ, rhsX), Vec4::Mul(lhsX, rhsZ)));
+                Vec4::StoreUnaligned(outCross.GetZ() + i, Vec4::Sub(Vec4::Mul(lhsX, rhsY), Vec4::Mul(lhsY, rhsX)));
+            }
+        }
+
+        void NormalizeSafe(Vector3Soa& vectors, float tolerance)
+        {
+            const Vec4::FloatType toleranceSq = Vec4::Splat(tolerance * tolerance);
+            for (size_t i = 0; i < vectors.GetPaddedSize(); i += Vector3Soa::BatchSize)
+            {
+                const Vec4::FloatType x = Vec4::LoadUnaligned(vectors.GetX() + i);
+                const Vec4::FloatType y = Vec4::LoadUnaligned(vectors.GetY() + i);
+                const Vec4::FloatType z = Vec4::LoadUnaligned(vectors.GetZ() + i);
+                const Vec4::FloatType lengthSq = Vec4::Madd(x, x, Vec4::Madd(y, y, Vec4::Mul(z, z)));
+
+                // Short vectors, which includes the zero padding, are scaled by zero instead of the inverse length.
+                const Vec4::FloatType isLongEnough = Vec4::CmpGt(lengthSq, toleranceSq);
+                const Vec4::FloatType scale = Vec4::And(Vec4::SqrtInv(Vec4::Max(lengthSq, toleranceSq)), isLongEnough);
+                Vec4::StoreUnaligned(vectors.GetX() + i, Vec4::Mul(x, scale));
+                Vec4::StoreUnaligned(vectors.GetY() + i, Vec4::Mul(y, scale));
+                Vec4::StoreUnaligned(vectors.GetZ() + i, Vec4::Mul(z, scale));
+            }
+        }
+
+        void CullSpheres(
+            const Frustum& frustum, const Vector3Soa& centers, AZStd::span<const float> radii, AZStd::vector<uint32_t>& visibleIndices)
+        {
+            AZ_Assert(radii.size() >= centers.GetSize(), "Got %zu radii for %zu spheres.", radii.size(), centers.GetSize());
+
+            Vec4::FloatType planes[Frustum::PlaneId::MAX][4];
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Vector4 coefficients = frustum.GetPlane(planeId).GetPlaneEquationCoefficients();
+                for (int32_t i = 0; i < 4; ++i)
+                {
+                    planes[planeId][i] = Vec4::Splat(coefficients.GetElement(i));
+                }
+            }
+
+            const size_t size = centers.GetSize();
+            for (size_t i = 0; i < size; i += Vector3Soa::BatchSize)
+            {
+                const Vec4::FloatType x = Vec4::LoadUnaligned(centers.GetX() + i);
+                const Vec4::FloatType y = Vec4::LoadUnaligned(centers.GetY() + i);
+                const Vec4::FloatType z = Vec4::LoadUnaligned(centers.GetZ() + i);
+                const Vec4::FloatType negativeRadius = Vec4::Sub(Vec4::ZeroFloat(), LoadPartial(radii.data() + i, size - i));
+
+                // A sphere is outside when it's completely behind any of the planes.
+                Vec4::FloatType visibleMask = Vec4::CmpEq(Vec4::ZeroFloat(), Vec4::ZeroFloat());
+                for (const auto& plane : planes)
+                {
+                    const Vec4::FloatType distance = Vec4::Madd(plane[0], x, Vec4::Madd(plane[1], y, Vec4::Madd(plane[2], z, plane[3])));
+                    visibleMask = Vec4::And(visibleMask, Vec4::CmpGtEq(distance, negativeRadius));
+                }
+                AppendVisibleIndices(visibleMask, i, size, visibleIndices);
+            }
+        }
+
+        void CullAabbs(
+            const Frustum& frustum, const Vector3Soa& minimums, const Vector3Soa& maximums, AZStd::vector<uint32_t>& visibleIndices)
+        {
+            AZ_Assert(minimums.GetSize() == maximums.GetSize(), "Got %zu minimums for %zu maximums.", minimums.GetSize(), maximums.GetSize());
+
+            // An AABB is outside of a plane when its corner that is furthest along the plane normal is behind the plane.
+            // With the AABB center c and extents e that is dot(n, c) + dot(abs(n), e) + d.
+            Vec4::FloatType planes[Frustum::PlaneId::MAX][4];
+            Vec4::FloatType absNormals[Frustum::PlaneId::MAX][3];
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Vector4 coefficients = frustum.GetPlane(planeId).GetPlaneEquationCoefficients();
+                for (int32_t i = 0; i < 4; ++i)
+                {
+                    planes[planeId][i] = Vec4::Splat(coefficients.GetElement(i));
+                }
+                for (int32_t i = 0; i < 3; ++i)
+                {
+                    absNormals[planeId][i] = Vec4::Abs(planes[planeId][i]);
+                }
+            }
+
+            const Vec4::FloatType half = Vec4::Splat(0.5f);
+            const size_t size = minimums.GetSize();
+            for (size_t i = 0; i < size; i += Vector3Soa::BatchSize)
+            {
+                const Vec4::FloatType minX = Vec4::LoadUnaligned(minimums.GetX() + i);
+                const Vec4::FloatType minY = Vec4::LoadUnaligned(minimums.GetY() + i);
+                const Vec4::FloatType minZ = Vec4::LoadUnaligned(minimums.GetZ() + i);
+                const Vec4::FloatType maxX = Vec4::LoadUnaligned(maximums.GetX() + i);
+                const Vec4::FloatType maxY = Vec4::LoadUnaligned(maximums.GetY() + i);
+                const Vec4::FloatType maxZ = Vec4::LoadUnaligned(maximums.GetZ() + i);
+                const Vec4::FloatType centerX = Vec4::Mul(Vec4::Add(minX, maxX), half);
+                const Vec4::FloatType centerY = Vec4::Mul(Vec4::Add(minY, maxY), half);
+                const Vec4::FloatType centerZ = Vec4::Mul(Vec4::Add(minZ, maxZ), half);
+                const Vec4::FloatType extentX = Vec4::Mul(Vec4::Sub(maxX, minX), half);
+                const Vec4::FloatType extentY = Vec4::Mul(Vec4::Sub(maxY, minY), half);
+                const Vec4::FloatType extentZ = Vec4::Mul(Vec4::Sub(maxZ, minZ), half);
+
+                Vec4::FloatType visibleMask = Vec4::CmpEq(Vec4::ZeroFloat(), Vec4::ZeroFloat());
+                for (int32_t planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    const Vec4::FloatType* plane = planes[planeId];
+                    const Vec4::FloatType* absNormal = absNormals[planeId];
+                    const Vec4::FloatType centerDistance =
+                        Vec4::Madd(plane[0], centerX, Vec4::Madd(plane[1], centerY, Vec4::Madd(plane[2], centerZ, plane[3])));
+                    const Vec4::FloatType extentDistance =
+                        Vec4::Madd(absNormal[0], extentX, Vec4::Madd(absNormal[1], extentY, Vec4::Mul(absNormal[2], extentZ)));
+                    visibleMask = Vec4::And(visibleMask, Vec4::CmpGtEq(Vec4::Add(centerDistance, extentDistance), Vec4::ZeroFloat()));
+                }
+                AppendVisibleIndices(visibleMask, i, size, visibleIndices);
+            }
+        }
+    } // namespace MathBatch
+} // namespace AZ
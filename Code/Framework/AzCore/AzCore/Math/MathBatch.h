@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class Frustum;
+    class Matrix3x4;
+    class Transform;
+
+    //! Functions that process arrays of values four at a time using the Simd::Vec4 types.
+    //! Operating on many values in a structure-of-arrays layout avoids the shuffles the single value math types
+    //! need to compute dot products and transforms, which makes them much faster for large arrays.
+    namespace MathBatch
+    {
+        //! Stores Vector3 values as separate arrays of x, y and z components.
+        //! The arrays are padded to a multiple of the batch size, so whole batches can always be loaded and stored.
+        //! The values in the padding don't affect the results of the batch functions.
+        class Vector3Soa
+        {
+        public:
+            static constexpr size_t BatchSize = 4;
+
+            Vector3Soa() = default;
+            explicit Vector3Soa(size_t size);
+            explicit Vector3Soa(AZStd::span<const Vector3> values);
+
+            //! Resizes the arrays, new elements are set to zero.
+            void Resize(size_t size);
+            void Clear();
+            size_t GetSize() const;
+
+            void Set(size_t index, const Vector3& value);
+            Vector3 Get(size_t index) const;
+
+            //! Copies the values to the given array, which must have at least GetSize() elements.
+            void CopyTo(AZStd::span<Vector3> values) const;
+
+            //! Component arrays, which hold GetPaddedSize() elements.
+            //! @{
+            float* GetX();
+            float* GetY();
+            float* GetZ();
+            const float* GetX() const;
+            const float* GetY() const;
+            const float* GetZ() const;
+            //! @}
+
+            //! Number of elements in the component arrays, always a multiple of BatchSize.
+            size_t GetPaddedSize() const;
+
+        private:
+            AZStd::vector<float> m_x;
+            AZStd::vector<float> m_y;
+            AZStd::vector<float> m_z;
+            size_t m_size = 0;
+        };
+
+        //! Transforms all points by the given matrix. The output is resized to the size of the input.
+        void TransformPoints(const Matrix3x4& matrix, const Vector3Soa& points, Vector3Soa& outPoints);
+
+        //! Transforms all points by the given transform. The output is resized to the size of the input.
+        void TransformPoints(const Transform& transform, const Vector3Soa& points, Vector3Soa& outPoints);
+
+        //! Transforms all vectors by the given matrix, ignoring its translation. The output is resized to the size of the input.
+        void TransformVectors(const Matrix3x4& matrix, const Vector3Soa& vectors, Vector3Soa& outVectors);
+
+        //! Computes the dot product of each pair of vectors. outDots must have at least lhs.GetSize() elements.
+        void Dot(const Vector3Soa& lhs, const Vector3Soa& rhs, AZStd::span<float> outDots);
+
+        //! Computes the cross product of each pair of vectors. The output is resized to the size of the input.
+        void Cross(const Vector3Soa& lhs, const Vector3Soa& rhs, Vector3Soa& outCross);
+
+        //! Normalizes all vectors in place. Vectors with a length below the tolerance are set to zero.
+        void NormalizeSafe(Vector3Soa& vectors, float tolerance = Constants::Tolerance);
+
+        //! Appends the indices of all spheres that aren't completely outside of the frustum to visibleIndices.
+        //! radii must have at least centers.GetSize() elements.
+        void CullSpheres(
+            const Frustum& frustum, const Vector3Soa& centers, AZStd::span<const float> radii, AZStd::vector<uint32_t>& visibleIndices);
+
+        //! Appends the indices of all AABBs that aren't completely outside of the frustum to visibleIndices.
+        void CullAabbs(
+            const Frustum& frustum, const Vector3Soa& minimums, const Vector3Soa& maximums, AZStd::vector<uint32_t>& visibleIndices);
+    } // namespace MathBatch
+} // namespace AZ
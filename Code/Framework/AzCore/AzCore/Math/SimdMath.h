@@ -50,6 +50,7 @@ namespace AZ
 #include <AzCore/Math/SimdMathVec2.h>
 #include <AzCore/Math/SimdMathVec3.h>
 #include <AzCore/Math/SimdMathVec4.h>
+#include <AzCore/Math/SimdMathVec8.h>
 
 namespace AZ
 {
@@ -13,14 +13,177 @@
 #include <AzCore/std/time.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/containers/vector.h>
 
 #include <AzCore/Debug/StackTracer.h>
 
+#include <math.h>
+
 namespace AZ::Debug
 {
     // Many PC tools break with alloc/free size mismatches when the memory guard is enabled.  Disable for now
     //#define ENABLE_MEMORY_GUARD
 
+    static constexpr unsigned int AllocationSampleMaxStackLevels = 32;
+
+    struct AllocationSample
+    {
+        void* m_address;
+        size_t m_byteSize;
+        size_t m_weight;
+        unsigned int m_alignment;
+        unsigned int m_stackFramesCount;
+        AZ::u64 m_timeStamp;
+        StackFrame m_stackFrames[AllocationSampleMaxStackLevels];
+    };
+
+    /**
+     * Fixed size table of the live samples, keyed by address so a free on any thread can find its sample without a lock.
+     * An address hashes to a group of keys sharing a cache line, when a group is full the sample goes to one of the
+     * next groups and the group is flagged, so looking up an address that was never sampled (the common case on free)
+     * only reads a single group. A key is reserved while its sample is written and published with the address after.
+     */
+    struct AllocationSampleTable
+    {
+        static constexpr size_t GroupSize = 8;
+        static constexpr size_t GroupCountShift = 10;
+        static constexpr size_t GroupCount = size_t{ 1 } << GroupCountShift;
+        static constexpr size_t MaxProbeGroups = 4;
+
+        struct Group
+        {
+            AZStd::atomic<void*> m_keys[GroupSize];
+            AZStd::atomic<bool> m_overflowed;
+        };
+
+        static void* ReservedKey()
+        {
+            return reinterpret_cast<void*>(uintptr_t{ 1 });
+        }
+
+        static size_t GroupIndex(void* address)
+        {
+            const AZ::u64 hash = (static_cast<AZ::u64>(reinterpret_cast<uintptr_t>(address)) >> 4) * 0x9E3779B97F4A7C15ull;
+            return static_cast<size_t>(hash >> (64 - GroupCountShift));
+        }
+
+        //! Reserves a key for address, returns the sample to fill in or nullptr if the table is full around address.
+        AllocationSample* Reserve(void* address, AZStd::atomic<void*>*& key)
+        {
+            const size_t firstGroup = GroupIndex(address);
+            for (size_t probe = 0; probe < MaxProbeGroups; ++probe)
+            {
+                const size_t groupIndex = (firstGroup + probe) % GroupCount;
+                Group& group = m_groups[groupIndex];
+                for (size_t i = 0; i < GroupSize; ++i)
+                {
+                    void* expected = nullptr;
+                    if (group.m_keys[i].load(AZStd::memory_order_relaxed) == nullptr &&
+                        group.m_keys[i].compare_exchange_strong(expected, ReservedKey(), AZStd::memory_order_acquire))
+                    {
+                        key = &group.m_keys[i];
+                        return &m_samples[groupIndex * GroupSize + i];
+                    }
+                }
+                group.m_overflowed.store(true, AZStd::memory_order_relaxed);
+            }
+            return nullptr;
+        }
+
+        //! Returns the sample recorded for address, or nullptr if address wasn't sampled.
+        AllocationSample* Find(void* address, AZStd::atomic<void*>*& key)
+        {
+            const size_t firstGroup = GroupIndex(address);
+            for (size_t probe = 0; probe < MaxProbeGroups; ++probe)
+            {
+                const size_t groupIndex = (firstGroup + probe) % GroupCount;
+                Group& group = m_groups[groupIndex];
+                for (size_t i = 0; i < GroupSize; ++i)
+                {
+                    if (group.m_keys[i].load(AZStd::memory_order_acquire) == address)
+                    {
+                        key = &group.m_keys[i];
+                        return &m_samples[groupIndex * GroupSize + i];
+                    }
+                }
+                if (!group.m_overflowed.load(AZStd::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            return nullptr;
+        }
+
+        void Clear()
+        {
+            for (Group& group : m_groups)
+            {
+                for (AZStd::atomic<void*>& key : group.m_keys)
+                {
+                    key.store(nullptr, AZStd::memory_order_relaxed);
+                }
+                group.m_overflowed.store(false, AZStd::memory_order_relaxed);
+            }
+        }
+
+        Group m_groups[GroupCount];
+        AllocationSample m_samples[GroupCount * GroupSize];
+    };
+
+    namespace
+    {
+        // Bytes left before the thread takes its next sample. Sampling is a Poisson process over the bytes a thread
+        // allocates: the gaps between samples are drawn from an exponential distribution, so every byte has the same
+        // chance of being sampled and allocations can't alias with a fixed sampling period.
+        struct AllocationSamplerThreadState
+        {
+            AZ::s64 m_bytesUntilSample;
+            AZ::u64 m_random; ///< 0 until the thread's first allocation
+        };
+        AZ_THREAD_LOCAL AllocationSamplerThreadState s_allocationSamplerThreadState;
+
+        AZ::s64 NextSampleInterval(AllocationSamplerThreadState& state, size_t meanInterval)
+        {
+            // xorshift64*
+            state.m_random ^= state.m_random >> 12;
+            state.m_random ^= state.m_random << 25;
+            state.m_random ^= state.m_random >> 27;
+            const AZ::u64 bits = state.m_random * 0x2545F4914F6CDD1Dull;
+            const double uniform = (static_cast<double>(bits >> 11) + 1.0) * (1.0 / 9007199254740992.0); // (0, 1]
+            const double interval = -log(uniform) * static_cast<double>(meanInterval);
+            return static_cast<AZ::s64>(AZStd::GetMin(interval, 1e15)) + 1;
+        }
+
+        bool ShouldSampleAllocationSlow(AllocationSamplerThreadState& state, AZ::s64 byteSize)
+        {
+            const size_t meanInterval = AllocatorManager::Instance().GetAllocationSamplingInterval();
+            if (state.m_random == 0)
+            {
+                state.m_random = (static_cast<AZ::u64>(reinterpret_cast<uintptr_t>(&state)) ^ AZStd::GetTimeNowMicroSecond()) | 1;
+                state.m_bytesUntilSample = NextSampleInterval(state, meanInterval);
+                if (state.m_bytesUntilSample > byteSize)
+                {
+                    state.m_bytesUntilSample -= byteSize;
+                    return false;
+                }
+            }
+            state.m_bytesUntilSample = NextSampleInterval(state, meanInterval);
+            return true;
+        }
+
+        AZ_FORCE_INLINE bool ShouldSampleAllocation(size_t byteSize)
+        {
+            AllocationSamplerThreadState& state = s_allocationSamplerThreadState;
+            const AZ::s64 bytes = static_cast<AZ::s64>(byteSize);
+            if (state.m_bytesUntilSample > bytes)
+            {
+                state.m_bytesUntilSample -= bytes;
+                return false;
+            }
+            return ShouldSampleAllocationSlow(state, bytes);
+        }
+    } // namespace
+
     //=========================================================================
     // AllocationRecords
     // [9/16/2009]
@@ -41,8 +204,25 @@ namespace AZ::Debug
         , m_requestedAllocs(0)
         , m_requestedBytes(0)
         , m_requestedBytesPeak(0)
+        , m_droppedSamples(0)
+        , m_sampleTable(nullptr)
         , m_allocatorName(allocatorName)
     {
+        if (m_mode == RECORD_SAMPLED)
+        {
+            m_mode = RECORD_NO_RECORDS;
+            SetMode(RECORD_SAMPLED);
+        }
+    }
+
+    AllocationRecords::~AllocationRecords()
+    {
+        if (m_sampleTable)
+        {
+            m_sampleTable->~AllocationSampleTable();
+            m_records.get_allocator().deallocate(m_sampleTable, sizeof(AllocationSampleTable), alignof(AllocationSampleTable));
+            m_sampleTable = nullptr;
+        }
     }
 
     //=========================================================================
@@ -91,6 +271,14 @@ namespace AZ::Debug
         {
             return nullptr;
         }
+        if (m_mode == RECORD_SAMPLED)
+        {
+            if (ShouldSampleAllocation(byteSize))
+            {
+                RegisterSample(address, byteSize, alignment, stackSuppressCount + 1);
+            }
+            return nullptr;
+        }
 
         // memory guard
         if (m_memoryGuardSize == sizeof(Debug::GuardValue))
@@ -174,13 +362,7 @@ namespace AZ::Debug
         // statistics
         m_requestedBytes += byteSize;
 
-        size_t currentRequestedBytePeak;
-        size_t newRequestedBytePeak;
-        do
-        {
-            currentRequestedBytePeak = m_requestedBytesPeak.load(std::memory_order::memory_order_relaxed);
-            newRequestedBytePeak = AZStd::GetMax(currentRequestedBytePeak, m_requestedBytes.load(std::memory_order::memory_order_relaxed));
-        } while (!m_requestedBytesPeak.compare_exchange_weak(currentRequestedBytePeak, newRequestedBytePeak));
+        UpdatePeakBytes();
 
         ++m_requestedAllocs;
 
@@ -201,6 +383,15 @@ namespace AZ::Debug
         {
             return;
         }
+        if (m_mode == RECORD_SAMPLED)
+        {
+            UnregisterSample(address);
+            if (m_isMarkUnallocatedMemory)
+            {
+                memset(address, GetUnallocatedMarkValue(), byteSize);
+            }
+            return;
+        }
 
         AllocationInfo allocationInfo;
         {
@@ -300,6 +491,15 @@ namespace AZ::Debug
         {
             return;
         }
+        if (m_mode == RECORD_SAMPLED)
+        {
+            AZStd::atomic<void*>* key;
+            if (AllocationSample* sample = m_sampleTable->Find(address, key))
+            {
+                sample->m_byteSize = newSize;
+            }
+            return;
+        }
 
         AllocationInfo* allocationInfo;
         {
@@ -341,13 +541,7 @@ namespace AZ::Debug
         // statistics
         m_requestedBytes -= allocationInfo->m_byteSize;
         m_requestedBytes += newSize;
-        size_t currentRequestedBytePeak;
-        size_t newRequestedBytePeak;
-        do
-        {
-            currentRequestedBytePeak = m_requestedBytesPeak.load(std::memory_order::memory_order_relaxed);
-            newRequestedBytePeak = AZStd::GetMax(currentRequestedBytePeak, m_requestedBytes.load(std::memory_order::memory_order_relaxed));
-        } while (!m_requestedBytesPeak.compare_exchange_weak(currentRequestedBytePeak, newRequestedBytePeak));
+        UpdatePeakBytes();
         ++m_requestedAllocs;
 
         // update allocation size
@@ -364,6 +558,18 @@ namespace AZ::Debug
         {
             return;
         }
+        if (m_mode == RECORD_SAMPLED)
+        {
+            if (address)
+            {
+                UnregisterSample(address);
+            }
+            if (newAddress && ShouldSampleAllocation(byteSize))
+            {
+                RegisterSample(newAddress, byteSize, alignment, stackSuppressCount + 1);
+            }
+            return;
+        }
         if (!address)
         {
             RegisterAllocation(newAddress, byteSize, alignment, stackSuppressCount);
@@ -441,6 +647,11 @@ namespace AZ::Debug
 
         AllocatorManager::Instance().DebugBreak(address, *ai);
 
+        UpdatePeakBytes();
+    }
+
+    void AllocationRecords::UpdatePeakBytes()
+    {
         size_t currentRequestedBytePeak;
         size_t newRequestedBytePeak;
         do
@@ -450,6 +661,53 @@ namespace AZ::Debug
         } while (!m_requestedBytesPeak.compare_exchange_weak(currentRequestedBytePeak, newRequestedBytePeak));
     }
 
+    void AllocationRecords::RegisterSample(void* address, size_t byteSize, size_t alignment, unsigned int stackSuppressCount)
+    {
+        AZStd::atomic<void*>* key;
+        AllocationSample* sample = m_sampleTable->Reserve(address, key);
+        if (!sample)
+        {
+            ++m_droppedSamples;
+            return;
+        }
+
+        // The probability an allocation of byteSize is sampled is 1 - exp(-byteSize / interval), weighting the sample by
+        // the inverse makes the sum of the weights an unbiased estimate of the allocated bytes.
+        const double meanInterval = static_cast<double>(AZStd::GetMax<size_t>(AllocatorManager::Instance().GetAllocationSamplingInterval(), 1));
+        const double size = static_cast<double>(AZStd::GetMax<size_t>(byteSize, 1));
+        const size_t weight = static_cast<size_t>(size / (1.0 - exp(-size / meanInterval)));
+
+        sample->m_address = address;
+        sample->m_byteSize = byteSize;
+        sample->m_weight = weight;
+        sample->m_alignment = static_cast<unsigned int>(alignment);
+        sample->m_timeStamp = AZStd::GetTimeNowMicroSecond();
+        sample->m_stackFramesCount = AZStd::GetMin<unsigned int>(m_numStackLevels, AllocationSampleMaxStackLevels);
+        if (sample->m_stackFramesCount)
+        {
+            StackRecorder::Record(sample->m_stackFrames, sample->m_stackFramesCount, stackSuppressCount + 1);
+        }
+        key->store(address, AZStd::memory_order_release);
+
+        // statistics, estimated from the weights
+        m_requestedBytes += weight;
+        UpdatePeakBytes();
+        m_requestedAllocs += AZStd::GetMax<size_t>(weight / AZStd::GetMax<size_t>(byteSize, 1), 1);
+    }
+
+    bool AllocationRecords::UnregisterSample(void* address)
+    {
+        AZStd::atomic<void*>* key;
+        AllocationSample* sample = m_sampleTable->Find(address, key);
+        if (!sample)
+        {
+            return false;
+        }
+        m_requestedBytes -= sample->m_weight;
+        key->store(nullptr, AZStd::memory_order_release);
+        return true;
+    }
+
     //=========================================================================
     // EnumerateAllocations
     // [9/29/2009]
@@ -471,6 +729,29 @@ namespace AZ::Debug
             m_requestedBytesPeak = 0;
             m_requestedAllocs = 0;
         }
+        if ((mode == RECORD_SAMPLED) != (m_mode == RECORD_SAMPLED))
+        {
+            // Switching between sampled and full records, neither kind of record is valid for the other mode
+            {
+                AZStd::scoped_lock lock(m_recordsMutex);
+                m_records.clear();
+            }
+            if (m_sampleTable)
+            {
+                m_sampleTable->Clear();
+            }
+            m_requestedBytes = 0;
+            m_requestedBytesPeak = 0;
+            m_requestedAllocs = 0;
+            m_droppedSamples = 0;
+        }
+        if (mode == RECORD_SAMPLED && !m_sampleTable)
+        {
+            // The table is never released before destruction, a free on another thread may still be reading it
+            void* tableMemory = m_records.get_allocator().allocate(sizeof(AllocationSampleTable), alignof(AllocationSampleTable));
+            m_sampleTable = new (tableMemory) AllocationSampleTable();
+            m_sampleTable->Clear();
+        }
         m_mode = mode;
     }
 
@@ -483,6 +764,41 @@ namespace AZ::Debug
         // enumerate all allocations and stop if requested.
         // Since allocations can change during the iteration (code that prints out the records could allocate, which will
         // mutate m_records), we are going to make a copy and iterate the copy.
+        if (m_mode == RECORD_SAMPLED)
+        {
+            AZStd::vector<AllocationSample, AZStd::stateless_allocator> samplesCopy;
+            for (size_t i = 0; i < AllocationSampleTable::GroupCount * AllocationSampleTable::GroupSize; ++i)
+            {
+                const AZStd::atomic<void*>& key = m_sampleTable->m_groups[i / AllocationSampleTable::GroupSize].m_keys[i % AllocationSampleTable::GroupSize];
+                void* address = key.load(AZStd::memory_order_acquire);
+                if (address && address != AllocationSampleTable::ReservedKey())
+                {
+                    samplesCopy.push_back(m_sampleTable->m_samples[i]);
+                    // Drop the copy if the sample was freed while copying it
+                    if (key.load(AZStd::memory_order_acquire) != address)
+                    {
+                        samplesCopy.pop_back();
+                    }
+                }
+            }
+
+            for (AllocationSample& sample : samplesCopy)
+            {
+                AllocationInfo info;
+                info.m_byteSize = sample.m_byteSize;
+                info.m_alignment = sample.m_alignment;
+                info.m_timeStamp = sample.m_timeStamp;
+                info.m_sampleWeight = sample.m_weight;
+                info.m_stackFrames = sample.m_stackFramesCount ? sample.m_stackFrames : nullptr;
+                info.m_stackFramesCount = sample.m_stackFramesCount;
+                if (!cb(sample.m_address, info, static_cast<unsigned char>(sample.m_stackFramesCount)))
+                {
+                    break;
+                }
+            }
+            return;
+        }
+
         Debug::AllocationRecordsType recordsCopy;
         {
             AZStd::scoped_lock lock(m_recordsMutex);
@@ -21,6 +21,7 @@ namespace AZ
     namespace Debug
     {
         struct StackFrame;
+        struct AllocationSampleTable;
 
         /**
         * Allocation tracking information.
@@ -39,6 +40,7 @@ namespace AZ
             unsigned int m_stackFramesCount{};
 
             AZ::u64         m_timeStamp{}; ///< Timestamp for sorting/tracking allocations
+            size_t          m_sampleWeight{}; ///< Number of allocated bytes this record stands for in RECORD_SAMPLED mode, 0 otherwise
         };
 
         // We use OSAllocator which uses system calls to allocate memory, they are not recorded or tracked!
@@ -100,6 +102,7 @@ namespace AZ
                 RECORD_STACK_NEVER,             ///< Never record stack traces. All other info is stored.
                 RECORD_STACK_IF_NO_FILE_LINE,   ///< Record stack if fileName and lineNum are not available. (default)
                 RECORD_FULL,                    ///< Always record the full stack.
+                RECORD_SAMPLED,                 ///< Record the full stack of a sample of the allocations, see \ref AllocatorManager::SetAllocationSamplingInterval.
 
                 RECORD_MAX                      ///< Must be last
             };
@@ -109,6 +112,7 @@ namespace AZ
              */
 
             AllocationRecords(unsigned char stackRecordLevels, bool isMemoryGuard, bool isMarkUnallocatedMemory, const char* allocatorName);
+            ~AllocationRecords();
 
             unsigned int  MemoryGuardSize() const               { return m_memoryGuardSize; }
 
@@ -129,11 +133,16 @@ namespace AZ
             unsigned char   GetNumStackLevels() const           { return m_numStackLevels; }
 
             /// Not thread safe!!! Make sure you lock/unlock while you work with the records.
+            /// The map is empty in RECORD_SAMPLED mode, use \ref EnumerateAllocations instead.
             AZ_FORCE_INLINE Debug::AllocationRecordsType& GetMap()  { return m_records; }
 
-            /// Enumerates all allocations in a thread safe manner.
+            /// Enumerates all allocations in a thread safe manner. In RECORD_SAMPLED mode only the live samples are enumerated,
+            /// each with AllocationInfo::m_sampleWeight set.
             void    EnumerateAllocations(AllocationInfoCBType cb) const;
 
+            /// Returns the number of samples which were dropped because the sample table was full (RECORD_SAMPLED mode only).
+            size_t  DroppedSamples() const                      { return m_droppedSamples; }
+
             /// If marking is enabled it will set all memory we deallocate with 0xcd
             void    MarkUallocatedMemory(bool isMark)           { m_isMarkUnallocatedMemory = isMark; }
             bool    IsMarkUnallocatedMemory() const             { return m_isMarkUnallocatedMemory; }
@@ -145,6 +154,7 @@ namespace AZ
             void    AutoIntegrityCheck(bool enable)             { m_isAutoIntegrityCheck = enable; }
 
             /// Returns peak of requested memory. IMPORTANT: This is user requested memory! Any allocator overhead is NOT included.
+            /// In RECORD_SAMPLED mode the statistics are estimated from the sample weights.
             size_t  RequestedBytesPeak() const                  { return m_requestedBytesPeak; }
             /// Reset the peak allocation to the current requested memory.
             void    ResetPeakBytes()                            { m_requestedBytesPeak.store(m_requestedBytes); }
@@ -165,6 +175,13 @@ namespace AZ
             // @}
 
         protected:
+            // @{ RECORD_SAMPLED mode, these never take the records lock.
+            void    RegisterSample(void* address, size_t byteSize, size_t alignment, unsigned int stackSuppressCount);
+            bool    UnregisterSample(void* address);
+            // @}
+
+            void    UpdatePeakBytes();
+
             Debug::AllocationRecordsType    m_records;
             mutable AZStd::spin_mutex       m_recordsMutex;
             Mode                            m_mode;
@@ -177,6 +194,8 @@ namespace AZ
             AZStd::atomic<size_t>           m_requestedAllocs;
             AZStd::atomic<size_t>           m_requestedBytes;
             AZStd::atomic<size_t>           m_requestedBytesPeak;
+            AZStd::atomic<size_t>           m_droppedSamples;
+            AllocationSampleTable*          m_sampleTable;  ///< Created the first time RECORD_SAMPLED is set, kept until destruction.
 
             const char*                     m_allocatorName;
         };
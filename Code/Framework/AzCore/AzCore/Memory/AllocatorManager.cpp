@@ -14,6 +14,8 @@
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Memory/AllocationRecords.h>
 
+#include <AzCore/Debug/StackTracer.h>
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/containers/array.h>
@@ -261,7 +263,7 @@ AllocatorManager::DumpAllocators()
     memset(m_dumpInfo, 0, sizeof(m_dumpInfo));
 
     AZ_Printf(TAG, "%d allocators active\n", m_numAllocators);
-    AZ_Printf(TAG, "Index,Name,Used kb,Reserved kb,Consumed kb\n");
+    AZ_Printf(TAG, "Index,Name,Used kb,Reserved kb,Consumed kb,Thread cache hit %%,High water kb\n");
 
     for (int i = 0; i < m_numAllocators; i++)
     {
@@ -278,11 +280,126 @@ AllocatorManager::DumpAllocators()
         m_dumpInfo[i].m_used = usedBytes;
         m_dumpInfo[i].m_reserved = reservedBytes;
         m_dumpInfo[i].m_consumed = consumedBytes;
-        AZ_Printf(TAG, "%d,%s,%.2f,%.2f,%.2f\n", i, name, usedBytes / 1024.0f, reservedBytes / 1024.0f, consumedBytes / 1024.0f);
+        const AllocatorThreadCacheStats cacheStats = allocator->GetThreadCacheStats();
+        const size_t cacheAccesses = cacheStats.m_hits + cacheStats.m_misses;
+        const float cacheHitPercent = cacheAccesses ? 100.0f * cacheStats.m_hits / cacheAccesses : 0.0f;
+        const size_t highWaterMarkBytes = allocator->GetHighWaterMark();
+        AZ_Printf(TAG, "%d,%s,%.2f,%.2f,%.2f,%.1f,%.2f\n", i, name, usedBytes / 1024.0f, reservedBytes / 1024.0f, consumedBytes / 1024.0f, cacheHitPercent,
+            highWaterMarkBytes / 1024.0f);
     }
 
     AZ_Printf(TAG, "-,Totals,%.2f,%.2f,%.2f\n", totalUsedBytes / 1024.0f, totalReservedBytes / 1024.0f, totalConsumedBytes / 1024.0f);
 }
+namespace
+{
+    void WriteText(IO::GenericStream& stream, const char* text)
+    {
+        stream.Write(strlen(text), text);
+    }
+
+    void WriteJsonString(IO::GenericStream& stream, const char* text)
+    {
+        char buffer[512];
+        size_t length = 0;
+        buffer[length++] = '"';
+        for (const char* c = text; *c; ++c)
+        {
+            // Leave room for the longest escape sequence and the closing quote
+            if (length + 8 > sizeof(buffer))
+            {
+                stream.Write(length, buffer);
+                length = 0;
+            }
+            const unsigned char character = static_cast<unsigned char>(*c);
+            if (character == '"' || character == '\\')
+            {
+                buffer[length++] = '\\';
+                buffer[length++] = *c;
+            }
+            else if (character < 0x20)
+            {
+                length += azsnprintf(buffer + length, sizeof(buffer) - length, "\\u%04x", character);
+            }
+            else
+            {
+                buffer[length++] = *c;
+            }
+        }
+        buffer[length++] = '"';
+        stream.Write(length, buffer);
+    }
+} // namespace
+
+bool AllocatorManager::WriteAllocationSamples(IO::GenericStream& stream)
+{
+    if (!stream.CanWrite())
+    {
+        return false;
+    }
+
+    char buffer[256];
+    azsnprintf(buffer, sizeof(buffer), "{\"Type\":\"AllocationSamples\",\"Version\":1,\"SamplingIntervalBytes\":%zu,\"Allocators\":[",
+        GetAllocationSamplingInterval());
+    WriteText(stream, buffer);
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_allocatorListMutex);
+    bool firstAllocator = true;
+    for (int i = 0; i < m_numAllocators; ++i)
+    {
+        const Debug::AllocationRecords* records = m_allocators[i]->GetRecords();
+        if (!records || records->GetMode() != Debug::AllocationRecords::RECORD_SAMPLED)
+        {
+            continue;
+        }
+
+        WriteText(stream, firstAllocator ? "{\"Name\":" : ",{\"Name\":");
+        firstAllocator = false;
+        WriteJsonString(stream, m_allocators[i]->GetName());
+        azsnprintf(buffer, sizeof(buffer), ",\"DroppedSamples\":%zu,\"Samples\":[", records->DroppedSamples());
+        WriteText(stream, buffer);
+
+        bool firstSample = true;
+        records->EnumerateAllocations(
+            [&stream, &buffer, &firstSample](void* address, const Debug::AllocationInfo& info, unsigned char numStackLevels)
+            {
+                azsnprintf(buffer, sizeof(buffer), "%s{\"Address\":\"0x%zx\",\"Size\":%zu,\"Weight\":%zu,\"Alignment\":%u,\"TimeStamp\":%llu,\"Stack\":[",
+                    firstSample ? "" : ",", reinterpret_cast<size_t>(address), info.m_byteSize, info.m_sampleWeight, info.m_alignment,
+                    static_cast<unsigned long long>(info.m_timeStamp));
+                WriteText(stream, buffer);
+                firstSample = false;
+
+                bool firstFrame = true;
+                const unsigned char decodeStep = 40;
+                Debug::SymbolStorage::StackLine lines[decodeStep];
+                unsigned char iFrame = 0;
+                while (info.m_stackFrames && numStackLevels > 0)
+                {
+                    unsigned char numToDecode = AZStd::GetMin(decodeStep, numStackLevels);
+                    Debug::SymbolStorage::DecodeFrames(&info.m_stackFrames[iFrame], numToDecode, lines);
+                    for (unsigned char frame = 0; frame < numToDecode; ++frame)
+                    {
+                        if (info.m_stackFrames[iFrame + frame].IsValid())
+                        {
+                            if (!firstFrame)
+                            {
+                                WriteText(stream, ",");
+                            }
+                            firstFrame = false;
+                            WriteJsonString(stream, lines[frame]);
+                        }
+                    }
+                    numStackLevels -= numToDecode;
+                    iFrame += numToDecode;
+                }
+                WriteText(stream, "]}");
+                return true;
+            });
+        WriteText(stream, "]}");
+    }
+    WriteText(stream, "]}\n");
+    return true;
+}
+
 void AllocatorManager::GetAllocatorStats(size_t& allocatedBytes, size_t& capacityBytes, AZStd::vector<AllocatorStats>* outStats)
 {
     allocatedBytes = 0;
@@ -303,7 +420,9 @@ void AllocatorManager::GetAllocatorStats(size_t& allocatedBytes, size_t& capacit
             outStats->emplace(outStats->end(),
                 allocator->GetName(),
                 allocator->NumAllocatedBytes(),
-                allocator->Capacity());
+                allocator->Capacity(),
+                allocator->GetThreadCacheStats(),
+                allocator->GetHighWaterMark());
         }
     }
 }
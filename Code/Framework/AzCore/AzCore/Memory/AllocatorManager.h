@@ -9,6 +9,7 @@
 
 #include <AzCore/base.h>
 #include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/IAllocator.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/string.h>
@@ -22,6 +23,11 @@ namespace AZ
 {
     class IAllocator;
 
+    namespace IO
+    {
+        class GenericStream;
+    }
+
     /**
     * Global allocation manager. It has access to all
     * created allocators IAllocator interface. And control
@@ -79,6 +85,18 @@ namespace AZ
         /// Set memory track mode for all allocators already created.
         void    SetTrackingMode(AZ::Debug::AllocationRecords::Mode mode);
 
+        /// Average number of allocated bytes between two samples in AllocationRecords::RECORD_SAMPLED mode.
+        void    SetAllocationSamplingInterval(size_t bytes)     { m_allocationSamplingInterval = bytes; }
+        size_t  GetAllocationSamplingInterval() const           { return m_allocationSamplingInterval; }
+
+        /// Writes the live allocation samples of all allocators in RECORD_SAMPLED mode to stream, as JSON:
+        /// { "Type": "AllocationSamples", "Version": 1, "SamplingIntervalBytes": N,
+        ///   "Allocators": [ { "Name": "...", "DroppedSamples": N,
+        ///     "Samples": [ { "Address": "0x...", "Size": N, "Weight": N, "Alignment": N, "TimeStamp": N, "Stack": [ "...", ... ] } ] } ] }
+        /// Weight is the number of allocated bytes the sample stands for, the weights of a call stack sum to an estimate of
+        /// the live bytes allocated from it.
+        bool    WriteAllocationSamples(IO::GenericStream& stream);
+
         /// Especially for great code and engines...
         void    SetAllocatorLeaking(bool allowLeaking)  { m_isAllocatorLeaking = allowLeaking; }
 
@@ -104,15 +122,24 @@ namespace AZ
 
         struct AllocatorStats
         {
-            AllocatorStats(const char* name, size_t allocatedBytes, size_t capacityBytes)
+            AllocatorStats(
+                const char* name,
+                size_t allocatedBytes,
+                size_t capacityBytes,
+                AllocatorThreadCacheStats threadCacheStats = {},
+                size_t highWaterMarkBytes = 0)
                 : m_name(name)
                 , m_allocatedBytes(allocatedBytes)
                 , m_capacityBytes(capacityBytes)
+                , m_threadCacheStats(threadCacheStats)
+                , m_highWaterMarkBytes(highWaterMarkBytes)
             {}
 
             AZStd::string m_name;
             size_t m_allocatedBytes;
             size_t m_capacityBytes;
+            AllocatorThreadCacheStats m_threadCacheStats;
+            size_t m_highWaterMarkBytes; ///< 0 if the allocator doesn't track it.
         };
 
         void GetAllocatorStats(size_t& usedBytes, size_t& reservedBytes, AZStd::vector<AllocatorStats>* outStats = nullptr);
@@ -164,6 +191,7 @@ namespace AZ
         AZStd::atomic<int>  m_profilingRefcount;
 
         AZ::Debug::AllocationRecords::Mode m_defaultTrackingRecordMode;
+        AZStd::atomic<size_t> m_allocationSamplingInterval{ 512 * 1024 };
 
         static AllocatorManager g_allocMgr;    ///< The single instance of the allocator manager
     };
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Memory/OSMemory.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/lock.h>
+
+namespace AZ
+{
+    AZ_TYPE_INFO_WITH_NAME_IMPL(FrameArenaSchema, "FrameArenaSchema", "{0E4F8A63-5B1D-4C2A-8F67-9D3C2B7A1E05}");
+
+    namespace
+    {
+        // A thread's current bump block for one arena. Slots are direct mapped by arena id, an arena whose slot is
+        // taken by another arena simply carves a new block, so the table stays POD and needs no cleanup on thread exit.
+        struct FrameArenaThreadBlock
+        {
+            AZ::u64 m_arenaId;
+            AZ::u64 m_frameIndex;
+            char* m_cursor;
+            char* m_end;
+        };
+
+        constexpr size_t FrameArenaThreadBlockSlots = 4;
+        AZ_THREAD_LOCAL FrameArenaThreadBlock s_frameArenaThreadBlocks[FrameArenaThreadBlockSlots];
+
+        AZStd::atomic<AZ::u64> s_frameArenaNextId{ 1 };
+
+        constexpr size_t FrameArenaBlockAlignment = alignof(max_align_t);
+
+        char* AlignPointerUp(char* ptr, size_t alignment)
+        {
+            return reinterpret_cast<char*>(AZ::SizeAlignUp(reinterpret_cast<size_t>(ptr), alignment));
+        }
+    } // namespace
+
+    FrameArenaSchema::FrameArenaSchema()
+        : m_arenaId(s_frameArenaNextId.fetch_add(1, AZStd::memory_order_relaxed))
+    {
+    }
+
+    FrameArenaSchema::~FrameArenaSchema()
+    {
+        Release();
+    }
+
+    bool FrameArenaSchema::Create(const Descriptor& desc)
+    {
+        AZ_Assert(desc.m_frameCount >= 2 && desc.m_frameCount <= MaxFrameCount, "Frame arena supports 2 to %u frames, %u requested",
+            MaxFrameCount, desc.m_frameCount);
+        AZ_Assert(desc.m_threadBlockSize > 0 && desc.m_threadBlockSize <= desc.m_frameBufferSize,
+            "Frame arena thread block size must be in (0, frame buffer size]");
+
+        Release();
+
+        m_desc = desc;
+        m_desc.m_frameCount = AZStd::clamp(m_desc.m_frameCount, 2u, MaxFrameCount);
+        m_desc.m_threadBlockSize = AZ::SizeAlignUp(m_desc.m_threadBlockSize, FrameArenaBlockAlignment);
+
+        const OSMemory::LargePageMode largePageMode = OSMemory::GetLargePageMode();
+        const size_t largePageSize = OSMemory::GetLargePageSize();
+        for (unsigned int i = 0; i < m_desc.m_frameCount; ++i)
+        {
+            // Every frame touches its whole buffer, so the buffers are the first to benefit from large pages
+            if (largePageMode != OSMemory::LargePageMode::Disabled && largePageSize)
+            {
+                const size_t mappedSize = AZ::SizeAlignUp(m_desc.m_frameBufferSize, largePageSize);
+                m_frames[i].m_memory = static_cast<char*>(OSMemory::AllocatePages(mappedSize, largePageMode));
+                m_frames[i].m_mappedSize = m_frames[i].m_memory ? mappedSize : 0;
+            }
+            if (!m_frames[i].m_memory)
+            {
+                m_frames[i].m_memory = static_cast<char*>(AZ_OS_MALLOC(m_desc.m_frameBufferSize, FrameArenaBlockAlignment));
+            }
+            if (!m_frames[i].m_memory)
+            {
+                Release();
+                return false;
+            }
+            m_frames[i].m_offset.store(0, AZStd::memory_order_relaxed);
+        }
+        m_frameIndex.store(0, AZStd::memory_order_relaxed);
+        m_highWaterMark.store(0, AZStd::memory_order_relaxed);
+        return true;
+    }
+
+    void FrameArenaSchema::Release()
+    {
+        for (FrameBuffer& buffer : m_frames)
+        {
+            ResetFrame(buffer);
+            if (buffer.m_mappedSize)
+            {
+                OSMemory::FreePages(buffer.m_memory, buffer.m_mappedSize);
+                buffer.m_mappedSize = 0;
+            }
+            else if (buffer.m_memory)
+            {
+                AZ_OS_FREE(buffer.m_memory);
+            }
+            buffer.m_memory = nullptr;
+        }
+    }
+
+    FrameArenaSchema::pointer FrameArenaSchema::allocate(size_type byteSize, size_type alignment)
+    {
+        byteSize = AZStd::max<size_type>(byteSize, 1);
+        alignment = AZStd::max<size_type>(alignment, 1);
+
+        const AZ::u64 frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+        FrameBuffer& buffer = m_frames[frameIndex % m_desc.m_frameCount];
+
+        // Large allocations would waste most of a thread block, they bump the shared frame offset instead
+        if (byteSize + alignment > m_desc.m_threadBlockSize / 4)
+        {
+            return AllocateShared(buffer, byteSize, alignment);
+        }
+
+        FrameArenaThreadBlock& block = s_frameArenaThreadBlocks[m_arenaId % FrameArenaThreadBlockSlots];
+        if (block.m_arenaId == m_arenaId && block.m_frameIndex == frameIndex)
+        {
+            char* result = AlignPointerUp(block.m_cursor, alignment);
+            if (result + byteSize <= block.m_end)
+            {
+                block.m_cursor = result + byteSize;
+                return result;
+            }
+        }
+
+        char* blockMemory = static_cast<char*>(AllocateShared(buffer, m_desc.m_threadBlockSize, FrameArenaBlockAlignment));
+        if (!blockMemory)
+        {
+            return nullptr;
+        }
+        block.m_arenaId = m_arenaId;
+        block.m_frameIndex = frameIndex;
+        block.m_end = blockMemory + m_desc.m_threadBlockSize;
+
+        char* result = AlignPointerUp(blockMemory, alignment);
+        block.m_cursor = result + byteSize;
+        return result;
+    }
+
+    FrameArenaSchema::pointer FrameArenaSchema::AllocateShared(FrameBuffer& buffer, size_t byteSize, size_t alignment)
+    {
+        if (buffer.m_memory)
+        {
+            const size_t base = reinterpret_cast<size_t>(buffer.m_memory);
+            size_t offset = buffer.m_offset.load(AZStd::memory_order_relaxed);
+            while (true)
+            {
+                const size_t alignedOffset = AZ::SizeAlignUp(base + offset, alignment) - base;
+                if (alignedOffset + byteSize > m_desc.m_frameBufferSize)
+                {
+                    break;
+                }
+                if (buffer.m_offset.compare_exchange_weak(offset, alignedOffset + byteSize, AZStd::memory_order_relaxed))
+                {
+                    return buffer.m_memory + alignedOffset;
+                }
+            }
+        }
+        return AllocateOverflow(buffer, byteSize, alignment);
+    }
+
+    FrameArenaSchema::pointer FrameArenaSchema::AllocateOverflow(FrameBuffer& buffer, size_t byteSize, size_t alignment)
+    {
+        alignment = AZStd::max(alignment, alignof(OverflowChunk));
+        const size_t headerSize = AZ::SizeAlignUp(sizeof(OverflowChunk), alignment);
+        void* memory = AZ_OS_MALLOC(headerSize + byteSize, alignment);
+        if (!memory)
+        {
+            return nullptr;
+        }
+
+        OverflowChunk* chunk = static_cast<OverflowChunk*>(memory);
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_overflowMutex);
+            chunk->m_next = buffer.m_overflowChunks;
+            buffer.m_overflowChunks = chunk;
+        }
+        buffer.m_overflowBytes.fetch_add(headerSize + byteSize, AZStd::memory_order_relaxed);
+        return static_cast<char*>(memory) + headerSize;
+    }
+
+    void FrameArenaSchema::deallocate(pointer ptr, size_type byteSize, size_type alignment)
+    {
+        // Memory is released with its frame
+        (void)ptr;
+        (void)byteSize;
+        (void)alignment;
+    }
+
+    FrameArenaSchema::pointer FrameArenaSchema::reallocate(pointer ptr, size_type newSize, size_type newAlignment)
+    {
+        if (!ptr)
+        {
+            return allocate(newSize, newAlignment);
+        }
+        AZ_Assert(false, "Not supported!");
+        return nullptr;
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::get_allocated_size(pointer ptr, align_type alignment) const
+    {
+        // Allocation sizes are not tracked
+        (void)ptr;
+        (void)alignment;
+        return 0;
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::max_size() const
+    {
+        size_type capacity = 0;
+        for (unsigned int i = 0; i < m_desc.m_frameCount; ++i)
+        {
+            capacity += (m_frames[i].m_memory ? m_desc.m_frameBufferSize : 0) + m_frames[i].m_overflowBytes.load(AZStd::memory_order_relaxed);
+        }
+        return capacity;
+    }
+
+    size_t FrameArenaSchema::GetFrameUsedBytes(const FrameBuffer& buffer) const
+    {
+        return buffer.m_offset.load(AZStd::memory_order_relaxed) + buffer.m_overflowBytes.load(AZStd::memory_order_relaxed);
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::NumAllocatedBytes() const
+    {
+        size_type allocatedBytes = 0;
+        for (unsigned int i = 0; i < m_desc.m_frameCount; ++i)
+        {
+            allocatedBytes += GetFrameUsedBytes(m_frames[i]);
+        }
+        return allocatedBytes;
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::GetHighWaterMark() const
+    {
+        const AZ::u64 frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+        return AZStd::max(m_highWaterMark.load(AZStd::memory_order_relaxed), GetFrameUsedBytes(m_frames[frameIndex % m_desc.m_frameCount]));
+    }
+
+    void FrameArenaSchema::ResetFrame(FrameBuffer& buffer)
+    {
+        OverflowChunk* chunk;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_overflowMutex);
+            chunk = buffer.m_overflowChunks;
+            buffer.m_overflowChunks = nullptr;
+        }
+        while (chunk)
+        {
+            OverflowChunk* next = chunk->m_next;
+            AZ_OS_FREE(chunk);
+            chunk = next;
+        }
+        buffer.m_overflowBytes.store(0, AZStd::memory_order_relaxed);
+        buffer.m_offset.store(0, AZStd::memory_order_relaxed);
+    }
+
+    void FrameArenaSchema::AdvanceFrame()
+    {
+        const AZ::u64 frameIndex = m_frameIndex.load(AZStd::memory_order_relaxed);
+
+        const size_t usedBytes = GetFrameUsedBytes(m_frames[frameIndex % m_desc.m_frameCount]);
+        if (usedBytes > m_highWaterMark.load(AZStd::memory_order_relaxed))
+        {
+            m_highWaterMark.store(usedBytes, AZStd::memory_order_relaxed);
+        }
+
+        ResetFrame(m_frames[(frameIndex + 1) % m_desc.m_frameCount]);
+        // Publishes the reset buffer, threads that observe the new index also observe the cleared offsets
+        m_frameIndex.store(frameIndex + 1, AZStd::memory_order_release);
+    }
+
+    AZ::u64 FrameArenaSchema::GetFrameIndex() const
+    {
+        return m_frameIndex.load(AZStd::memory_order_acquire);
+    }
+
+    FrameArenaAllocator::FrameArenaAllocator()
+        : FrameArenaAllocator(Descriptor())
+    {
+    }
+
+    FrameArenaAllocator::FrameArenaAllocator(const Descriptor& desc)
+    {
+        GetSchema()->Create(desc);
+        PostCreate();
+    }
+
+    FrameArenaAllocator::~FrameArenaAllocator()
+    {
+        PreDestroy();
+    }
+
+    void FrameArenaAllocator::AdvanceFrame()
+    {
+        GetSchema()->AdvanceFrame();
+    }
+
+    AZ::u64 FrameArenaAllocator::GetFrameIndex() const
+    {
+        return GetSchema()->GetFrameIndex();
+    }
+} // namespace AZ
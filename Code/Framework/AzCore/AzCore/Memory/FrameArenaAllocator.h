@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Memory/SimpleSchemaAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Frame arena allocator schema
+     * Linear allocator for memory which only lives for a bounded number of frames. Allocations bump a pointer into the
+     * buffer of the current frame and are never freed individually, deallocate is a no-op. Instead every call to
+     * AdvanceFrame moves to the next of m_frameCount buffers and resets it, so memory allocated in a frame stays valid
+     * until AdvanceFrame has been called m_frameCount - 1 more times (double or triple buffering).
+     * Each thread bumps a private block carved from the frame buffer, so small allocations take no atomic operation.
+     * When a frame buffer is exhausted, allocations spill into OS allocated chunks released with the frame.
+     * Allocating is thread safe, AdvanceFrame must only be called from one thread, at a point where no thread still
+     * uses memory from the frame being reset.
+     */
+    class FrameArenaSchema
+        : public IAllocator
+    {
+    public:
+        AZ_TYPE_INFO_WITH_NAME_DECL(FrameArenaSchema);
+
+        static constexpr unsigned int MaxFrameCount = 3;
+
+        struct Descriptor
+        {
+            size_t m_frameBufferSize = 8 * 1024 * 1024; ///< Size of each frame buffer.
+            unsigned int m_frameCount = 2; ///< Number of frame buffers, 2 or 3.
+            size_t m_threadBlockSize = 64 * 1024; ///< Size of the per-thread blocks, larger allocations bump the frame buffer directly.
+        };
+
+        FrameArenaSchema();
+        ~FrameArenaSchema() override;
+
+        bool Create(const Descriptor& desc);
+
+        pointer allocate(size_type byteSize, size_type alignment) override;
+        void deallocate(pointer ptr, size_type byteSize, size_type alignment) override;
+        pointer reallocate(pointer ptr, size_type newSize, size_type newAlignment) override;
+        size_type get_allocated_size(pointer ptr, align_type alignment) const override;
+        size_type max_size() const override;
+
+        size_type NumAllocatedBytes() const override;
+        size_type GetHighWaterMark() const override;
+
+        /// Ends the current frame and resets the buffer of the oldest frame for reuse.
+        void AdvanceFrame();
+        /// Returns the number of times AdvanceFrame has been called.
+        AZ::u64 GetFrameIndex() const;
+
+        const Descriptor& GetDescriptor() const { return m_desc; }
+
+    protected:
+        FrameArenaSchema(const FrameArenaSchema&) = delete;
+        FrameArenaSchema& operator=(const FrameArenaSchema&) = delete;
+
+        struct OverflowChunk
+        {
+            OverflowChunk* m_next;
+        };
+
+        struct FrameBuffer
+        {
+            char* m_memory = nullptr;
+            size_t m_mappedSize = 0; ///< Size of the OSMemory mapping backing m_memory, 0 when it came from AZ_OS_MALLOC.
+            AZStd::atomic<size_t> m_offset{ 0 };
+            AZStd::atomic<size_t> m_overflowBytes{ 0 };
+            OverflowChunk* m_overflowChunks = nullptr; ///< Guarded by m_overflowMutex.
+        };
+
+        pointer AllocateShared(FrameBuffer& buffer, size_t byteSize, size_t alignment);
+        pointer AllocateOverflow(FrameBuffer& buffer, size_t byteSize, size_t alignment);
+        size_t GetFrameUsedBytes(const FrameBuffer& buffer) const;
+        void ResetFrame(FrameBuffer& buffer);
+        void Release();
+
+        Descriptor m_desc;
+        FrameBuffer m_frames[MaxFrameCount];
+        AZStd::atomic<AZ::u64> m_frameIndex{ 0 };
+        AZStd::atomic<size_t> m_highWaterMark{ 0 }; ///< Most bytes used by a single completed frame.
+        AZStd::mutex m_overflowMutex;
+        AZ::u64 m_arenaId = 0; ///< Unique per schema instance, used to key the thread local blocks.
+    };
+
+    /*!
+     * Frame arena allocator, see \ref FrameArenaSchema.
+     * Use for transient per-frame data, for example AZStd::vector<T, AZStdAlloc<FrameArenaAllocator>> built and consumed
+     * within a frame. The application advances the global instance once per tick, see ComponentApplication::Tick.
+     */
+    class FrameArenaAllocator
+        : public SimpleSchemaAllocator<FrameArenaSchema, /* ProfileAllocations */ false, /* ReportOutOfMemory */ true>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FrameArenaAllocator, SystemAllocator);
+
+        using Base = SimpleSchemaAllocator<FrameArenaSchema, false, true>;
+        using Descriptor = FrameArenaSchema::Descriptor;
+
+        AZ_RTTI(FrameArenaAllocator, "{6C7D0B8E-2E4F-4B37-9E0B-3B1E5A7F2C41}", Base);
+
+        FrameArenaAllocator();
+        explicit FrameArenaAllocator(const Descriptor& desc);
+        ~FrameArenaAllocator() override;
+
+        void AdvanceFrame();
+        AZ::u64 GetFrameIndex() const;
+
+        FrameArenaSchema* GetSchema() const
+        {
+            return static_cast<FrameArenaSchema*>(m_schema);
+        }
+    };
+} // namespace AZ
@@ -12,6 +12,7 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/Memory/OSMemory.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/containers/intrusive_list.h>
@@ -64,6 +65,9 @@ namespace AZ
 // Enabled mutex per bucket
 #define USE_MUTEX_PER_BUCKET
 
+// Enable per thread caches of free small blocks in front of the bucket locks
+#define USE_THREAD_CACHE
+
     //////////////////////////////////////////////////////////////////////////
 
     template<bool DebugAllocatorEnable>
@@ -337,6 +341,72 @@ namespace AZ
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
 
+#if defined(MULTITHREADED) && defined(USE_THREAD_CACHE)
+        // The thread cache keeps a magazine (a short free list) of small blocks per bucket for every thread. Small allocations
+        // and frees are served from the calling thread's magazine without taking the bucket lock. An empty magazine is refilled
+        // from its bucket, and a full one returns half of its blocks, in a single batch under the bucket lock.
+        // Blocks sitting in a magazine are counted as allocated by the bucket, but not by allocated().
+        static constexpr size_t THREAD_CACHE_MAGAZINE_BYTES = 2048;
+        static constexpr unsigned THREAD_CACHE_MIN_MAGAZINE_BLOCKS = 4;
+        // number of distinct allocators a thread can cache for, allocators beyond that use the locked path
+        static constexpr unsigned MAX_THREAD_CACHED_ALLOCATORS = 8;
+
+        struct thread_cache
+        {
+            struct magazine
+            {
+                free_link* mHead = nullptr;
+                unsigned mCount = 0;
+            };
+
+            AZStd::atomic<HpAllocator*> mOwner{ nullptr }; // null once the owning allocator is destroyed
+            thread_cache* mNext = nullptr; // next cache of the owning allocator, guarded by thread_cache_mutex()
+            magazine mMagazines[NUM_BUCKETS];
+            // only written by the thread the cache belongs to, read by the statistics
+            AZStd::atomic<size_t> mCachedBytes{ 0 };
+            AZStd::atomic<size_t> mHits{ 0 };
+            AZStd::atomic<size_t> mMisses{ 0 };
+        };
+
+        // the caches of a thread, one per allocator used on the thread, flushed back to their allocators on thread exit
+        struct thread_cache_table
+        {
+            ~thread_cache_table();
+
+            thread_cache* mCaches[MAX_THREAD_CACHED_ALLOCATORS] = {};
+            bool mDestroyed = false;
+        };
+
+        static inline unsigned thread_cache_magazine_capacity(unsigned bi)
+        {
+            return AZStd::GetMax(
+                THREAD_CACHE_MIN_MAGAZINE_BLOCKS, static_cast<unsigned>(THREAD_CACHE_MAGAZINE_BYTES / bucket_spacing_function_inverse(bi)));
+        }
+        // the cache counters have a single writer, so they don't need an atomic read-modify-write
+        static inline void thread_cache_add(AZStd::atomic<size_t>& counter, size_t value)
+        {
+            counter.store(counter.load(AZStd::memory_order_relaxed) + value, AZStd::memory_order_relaxed);
+        }
+        static inline void thread_cache_sub(AZStd::atomic<size_t>& counter, size_t value)
+        {
+            counter.store(counter.load(AZStd::memory_order_relaxed) - value, AZStd::memory_order_relaxed);
+        }
+
+        static AZStd::mutex& thread_cache_mutex();
+        static thread_cache_table& get_thread_cache_table();
+        thread_cache* get_thread_cache(bool create = true);
+        void* thread_cache_alloc(thread_cache* cache, unsigned bi);
+        void thread_cache_free(thread_cache* cache, void* ptr, unsigned bi);
+        void thread_cache_return(thread_cache* cache, unsigned bi, unsigned count);
+        void thread_cache_flush(thread_cache* cache);
+        void thread_cache_release_all();
+        size_t thread_cache_bytes() const;
+    public:
+        void thread_cache_purge();
+        void thread_cache_stats(size_t& hits, size_t& misses) const;
+    private:
+#endif
+
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
         {
@@ -411,6 +481,20 @@ namespace AZ
 
         void* tree_system_alloc(size_t size);
         void tree_system_free(void* ptr, size_t size);
+
+        // When a large page mode is set (see OSMemory::SetLargePageMode) the tree grows by whole large page mappings
+        // and bucket pages are carved from them instead of being allocated one by one from the OS.
+        // The record of each mapping is stored at its end, past the back fence of the tree block. Guarded by mTreeMutex.
+        struct large_chunk
+        {
+            large_chunk* mNext;
+            char* mBase;
+            size_t mMappedSize;
+        };
+        static constexpr size_t LARGE_CHUNK_RECORD_SIZE = AZ_SIZE_ALIGN_UP(sizeof(large_chunk), 16);
+        block_header* tree_grow_large(size_t sizeWithBlockHeaders, AZ::OSMemory::LargePageMode mode, size_t largePageSize);
+        large_chunk* tree_find_large_chunk(void* ptr) const;
+        bool tree_free_large_chunk(void* mem, size_t size);
         block_header* tree_extract(size_t size);
         block_header* tree_extract_aligned(size_t size, size_t alignment);
         block_header* tree_extract_bucket_page();
@@ -593,6 +677,14 @@ namespace AZ
         // threads through that lock
         size_t mTotalAllocatedSizeTree = 0;
         size_t mTotalCapacitySizeTree = 0;
+        large_chunk* mLargeChunks = nullptr;
+
+#if defined(MULTITHREADED) && defined(USE_THREAD_CACHE)
+        thread_cache* mThreadCaches = nullptr; // guarded by thread_cache_mutex()
+        // statistics of caches which were already released, guarded by thread_cache_mutex()
+        size_t mReleasedCacheHits = 0;
+        size_t mReleasedCacheMisses = 0;
+#endif
     public:
         HpAllocator();
         ~HpAllocator() override;
@@ -932,6 +1024,10 @@ namespace AZ
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+#if defined(MULTITHREADED) && defined(USE_THREAD_CACHE)
+            // give the blocks cached by this thread back, so their pages can be released
+            thread_cache_purge();
+#endif
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -946,7 +1042,11 @@ namespace AZ
         // return the total number of allocated memory
         inline size_t allocated() const
         {
+#if defined(MULTITHREADED) && defined(USE_THREAD_CACHE)
+            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree - thread_cache_bytes();
+#else
             return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
+#endif
         }
 
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
@@ -1057,6 +1157,9 @@ namespace AZ
             check();
         }
 
+#if defined(MULTITHREADED) && defined(USE_THREAD_CACHE)
+        thread_cache_release_all();
+#endif
         purge();
 
         if constexpr (DebugAllocatorEnable)
@@ -1174,6 +1277,23 @@ namespace AZ
     template<bool DebugAllocatorEnable>
     void* HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_system_alloc()
     {
+        if (AZ::OSMemory::GetLargePageMode() != AZ::OSMemory::LargePageMode::Disabled)
+        {
+#ifdef MULTITHREADED
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(mTreeMutex);
+#endif
+            if (void* ptr = tree_alloc_bucket_page())
+            {
+                // The page is accounted in the capacity of the large chunk
+                if (tree_find_large_chunk(ptr))
+                {
+                    return ptr;
+                }
+                // carved from a regular tree page (no large pages available), keep bucket pages separate from those
+                tree_free_bucket_page(ptr);
+            }
+        }
+
         void* ptr;
         ptr = SystemAlloc(m_poolPageSize, m_poolPageSize);
         mTotalCapacitySizeBuckets += m_poolPageSize;
@@ -1185,6 +1305,17 @@ namespace AZ
     void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_system_free(void* ptr)
     {
         HPPA_ASSERT(ptr);
+        {
+#ifdef MULTITHREADED
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(mTreeMutex);
+#endif
+            if (mLargeChunks && tree_find_large_chunk(ptr))
+            {
+                // the mapping itself is released by tree_purge once all of it is free
+                tree_free_bucket_page(ptr);
+                return;
+            }
+        }
         SystemFree(ptr);
         mTotalCapacitySizeBuckets -= m_poolPageSize;
     }
@@ -1207,6 +1338,12 @@ namespace AZ
         HPPA_ASSERT(size <= MAX_SMALL_ALLOCATION);
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#if defined(MULTITHREADED) && defined(USE_THREAD_CACHE)
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_alloc(cache, bi);
+        }
+#endif
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1236,6 +1373,12 @@ namespace AZ
     void* HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#if defined(MULTITHREADED) && defined(USE_THREAD_CACHE)
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_alloc(cache, bi);
+        }
+#endif
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1306,6 +1449,12 @@ namespace AZ
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#if defined(MULTITHREADED) && defined(USE_THREAD_CACHE)
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_free(cache, ptr, bi);
+        }
+#endif
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1325,6 +1474,12 @@ namespace AZ
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+#if defined(MULTITHREADED) && defined(USE_THREAD_CACHE)
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_free(cache, ptr, bi);
+        }
+#endif
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1336,6 +1491,274 @@ namespace AZ
         mBuckets[bi].free(p, ptr);
     }
 
+#if defined(MULTITHREADED) && defined(USE_THREAD_CACHE)
+    template<bool DebugAllocatorEnable>
+    AZStd::mutex& HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_mutex()
+    {
+        // guards the cache lists of all allocators, only taken when a thread starts or stops caching for an allocator
+        static AZStd::mutex s_mutex;
+        return s_mutex;
+    }
+
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::get_thread_cache_table() -> thread_cache_table&
+    {
+        static thread_local thread_cache_table s_table;
+        return s_table;
+    }
+
+    template<bool DebugAllocatorEnable>
+    HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_table::~thread_cache_table()
+    {
+        // allocations made after this point (by other thread local destructors) go through the locked path
+        mDestroyed = true;
+
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+        for (thread_cache*& cache : mCaches)
+        {
+            if (!cache)
+            {
+                continue;
+            }
+            if (HpAllocator* owner = cache->mOwner.load(AZStd::memory_order_relaxed))
+            {
+                owner->thread_cache_flush(cache);
+                thread_cache** link = &owner->mThreadCaches;
+                while (*link != cache)
+                {
+                    link = &(*link)->mNext;
+                }
+                *link = cache->mNext;
+                owner->mReleasedCacheHits += cache->mHits.load(AZStd::memory_order_relaxed);
+                owner->mReleasedCacheMisses += cache->mMisses.load(AZStd::memory_order_relaxed);
+            }
+            cache->~thread_cache();
+            AZStd::stateless_allocator().deallocate(cache, sizeof(thread_cache), alignof(thread_cache));
+            cache = nullptr;
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::get_thread_cache(bool create) -> thread_cache*
+    {
+        if constexpr (DebugAllocatorEnable)
+        {
+            // the debug allocator tracks every block, keep it on the locked path
+            return nullptr;
+        }
+        else
+        {
+            thread_cache_table& table = get_thread_cache_table();
+            if (table.mDestroyed)
+            {
+                return nullptr;
+            }
+            for (thread_cache* cache : table.mCaches)
+            {
+                if (cache && cache->mOwner.load(AZStd::memory_order_relaxed) == this)
+                {
+                    return cache;
+                }
+            }
+            if (!create)
+            {
+                return nullptr;
+            }
+
+            // first use of this allocator on this thread, take a free slot, or reuse the cache of a destroyed allocator
+            for (thread_cache*& cache : table.mCaches)
+            {
+                if (!cache)
+                {
+                    void* memory = AZStd::stateless_allocator().allocate(sizeof(thread_cache), alignof(thread_cache));
+                    if (!memory)
+                    {
+                        return nullptr;
+                    }
+                    cache = new (memory) thread_cache();
+                }
+                else if (cache->mOwner.load(AZStd::memory_order_relaxed) != nullptr)
+                {
+                    continue;
+                }
+
+                AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+                cache->mHits.store(0, AZStd::memory_order_relaxed);
+                cache->mMisses.store(0, AZStd::memory_order_relaxed);
+                cache->mOwner.store(this, AZStd::memory_order_relaxed);
+                cache->mNext = mThreadCaches;
+                mThreadCaches = cache;
+                return cache;
+            }
+            return nullptr;
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    void* HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_alloc(thread_cache* cache, unsigned bi)
+    {
+        typename thread_cache::magazine& magazine = cache->mMagazines[bi];
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        if (magazine.mHead)
+        {
+            thread_cache_add(cache->mHits, 1);
+        }
+        else
+        {
+            thread_cache_add(cache->mMisses, 1);
+
+            // refill half of the magazine in one go
+            const unsigned refillCount = AZStd::GetMax(1u, thread_cache_magazine_capacity(bi) / 2);
+            unsigned count = 0;
+            {
+#if defined(USE_MUTEX_PER_BUCKET)
+                AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+                for (; count < refillCount; ++count)
+                {
+                    page* p = mBuckets[bi].get_free_page();
+                    if (!p)
+                    {
+                        p = bucket_grow(elemSize, mBuckets[bi].marker());
+                        if (!p)
+                        {
+                            break;
+                        }
+                        mBuckets[bi].add_free_page(p);
+                    }
+                    free_link* block = static_cast<free_link*>(mBuckets[bi].alloc(p));
+                    block->mNext = magazine.mHead;
+                    magazine.mHead = block;
+                }
+                mTotalAllocatedSizeBuckets += count * elemSize;
+            }
+            if (count == 0)
+            {
+                return nullptr;
+            }
+            magazine.mCount += count;
+            thread_cache_add(cache->mCachedBytes, count * elemSize);
+        }
+
+        free_link* block = magazine.mHead;
+        magazine.mHead = block->mNext;
+        --magazine.mCount;
+        thread_cache_sub(cache->mCachedBytes, elemSize);
+        return block;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_free(thread_cache* cache, void* ptr, unsigned bi)
+    {
+        typename thread_cache::magazine& magazine = cache->mMagazines[bi];
+        const unsigned capacity = thread_cache_magazine_capacity(bi);
+        if (magazine.mCount < capacity)
+        {
+            thread_cache_add(cache->mHits, 1);
+        }
+        else
+        {
+            thread_cache_add(cache->mMisses, 1);
+            thread_cache_return(cache, bi, AZStd::GetMax(1u, capacity / 2));
+        }
+
+        free_link* block = static_cast<free_link*>(ptr);
+        block->mNext = magazine.mHead;
+        magazine.mHead = block;
+        ++magazine.mCount;
+        thread_cache_add(cache->mCachedBytes, bucket_spacing_function_inverse(bi));
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_return(thread_cache* cache, unsigned bi, unsigned count)
+    {
+        typename thread_cache::magazine& magazine = cache->mMagazines[bi];
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        count = AZStd::GetMin(count, magazine.mCount);
+        {
+#if defined(USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+            for (unsigned i = 0; i < count; ++i)
+            {
+                free_link* block = magazine.mHead;
+                magazine.mHead = block->mNext;
+                mBuckets[bi].free(ptr_get_page(block), block);
+            }
+            mTotalAllocatedSizeBuckets -= count * elemSize;
+        }
+        magazine.mCount -= count;
+        thread_cache_sub(cache->mCachedBytes, count * elemSize);
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_flush(thread_cache* cache)
+    {
+        for (unsigned bi = 0; bi < NUM_BUCKETS; ++bi)
+        {
+            if (cache->mMagazines[bi].mCount)
+            {
+                thread_cache_return(cache, bi, cache->mMagazines[bi].mCount);
+            }
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_release_all()
+    {
+        // IMPORTANT: like the rest of the destruction, this relies on no other thread using the allocator anymore
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+        while (thread_cache* cache = mThreadCaches)
+        {
+            thread_cache_flush(cache);
+            mReleasedCacheHits += cache->mHits.load(AZStd::memory_order_relaxed);
+            mReleasedCacheMisses += cache->mMisses.load(AZStd::memory_order_relaxed);
+            mThreadCaches = cache->mNext;
+            cache->mNext = nullptr;
+            // the cache memory belongs to its thread, which can reuse it for another allocator
+            cache->mOwner.store(nullptr, AZStd::memory_order_relaxed);
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_purge()
+    {
+        if (thread_cache* cache = get_thread_cache(false))
+        {
+            thread_cache_flush(cache);
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    size_t HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_bytes() const
+    {
+        size_t cachedBytes = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+        for (const thread_cache* cache = mThreadCaches; cache; cache = cache->mNext)
+        {
+            cachedBytes += cache->mCachedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return cachedBytes;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_stats(size_t& hits, size_t& misses) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+        hits = mReleasedCacheHits;
+        misses = mReleasedCacheMisses;
+        for (const thread_cache* cache = mThreadCaches; cache; cache = cache->mNext)
+        {
+            hits += cache->mHits.load(AZStd::memory_order_relaxed);
+            misses += cache->mMisses.load(AZStd::memory_order_relaxed);
+        }
+    }
+#endif // defined(MULTITHREADED) && defined(USE_THREAD_CACHE)
+
     template<bool DebugAllocatorEnable>
     size_t HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_ptr_size(void* ptr) const
     {
@@ -1542,6 +1965,20 @@ namespace AZ
     auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::tree_grow(size_t size) -> block_header*
     {
         const size_t sizeWithBlockHeaders = size + 3 * sizeof(block_header); // two fences plus one fake
+
+        const AZ::OSMemory::LargePageMode largePageMode = AZ::OSMemory::GetLargePageMode();
+        if (largePageMode != AZ::OSMemory::LargePageMode::Disabled)
+        {
+            if (const size_t largePageSize = AZ::OSMemory::GetLargePageSize(); largePageSize != 0)
+            {
+                if (block_header* bl = tree_grow_large(sizeWithBlockHeaders, largePageMode, largePageSize))
+                {
+                    return bl;
+                }
+                // fall back to regular pages
+            }
+        }
+
         const size_t newSize =
             (sizeWithBlockHeaders < m_treePageSize) ? AZ::SizeAlignUp(sizeWithBlockHeaders, m_treePageSize) : sizeWithBlockHeaders;
         HPPA_ASSERT(newSize >= sizeWithBlockHeaders);
@@ -1553,6 +1990,56 @@ namespace AZ
         return nullptr;
     }
 
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::tree_grow_large(
+        size_t sizeWithBlockHeaders, AZ::OSMemory::LargePageMode mode, size_t largePageSize) -> block_header*
+    {
+        const size_t mappedSize = AZ::SizeAlignUp(sizeWithBlockHeaders + LARGE_CHUNK_RECORD_SIZE, largePageSize);
+        char* mem = static_cast<char*>(AZ::OSMemory::AllocatePages(mappedSize, mode));
+        if (!mem)
+        {
+            return nullptr;
+        }
+        const size_t treeSize = mappedSize - LARGE_CHUNK_RECORD_SIZE;
+        large_chunk* chunk = new (mem + treeSize) large_chunk{ mLargeChunks, mem, mappedSize };
+        mLargeChunks = chunk;
+        mTotalCapacitySizeTree += mappedSize;
+        return tree_add_block(mem, treeSize);
+    }
+
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::tree_find_large_chunk(void* ptr) const -> large_chunk*
+    {
+        // only walked when pages are handed between the tree and the OS, the list holds one entry per large mapping
+        for (large_chunk* chunk = mLargeChunks; chunk; chunk = chunk->mNext)
+        {
+            if (ptr >= chunk->mBase && ptr < chunk->mBase + chunk->mMappedSize)
+            {
+                return chunk;
+            }
+        }
+        return nullptr;
+    }
+
+    template<bool DebugAllocatorEnable>
+    bool HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::tree_free_large_chunk(void* mem, size_t size)
+    {
+        for (large_chunk** link = &mLargeChunks; *link; link = &(*link)->mNext)
+        {
+            large_chunk* chunk = *link;
+            if (chunk->mBase == mem)
+            {
+                HPPA_ASSERT(size + LARGE_CHUNK_RECORD_SIZE == chunk->mMappedSize);
+                const size_t mappedSize = chunk->mMappedSize;
+                *link = chunk->mNext;
+                mTotalCapacitySizeTree -= mappedSize;
+                AZ::OSMemory::FreePages(mem, mappedSize);
+                return true;
+            }
+        }
+        return false;
+    }
+
     template<bool DebugAllocatorEnable>
     auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::tree_extract(size_t size) -> block_header*
     {
@@ -2029,7 +2516,10 @@ namespace AZ
             size_t size = memEnd - memStart;
             HPPA_ASSERT(((size_t)mem & (m_treePageAlignment - 1)) == 0);
             memset(mem, 0xff, sizeof(block_header));
-            tree_system_free(mem, size);
+            if (!tree_free_large_chunk(mem, size))
+            {
+                tree_system_free(mem, size);
+            }
         }
     }
 
@@ -2558,6 +3048,19 @@ namespace AZ
         m_allocator->purge();
     }
 
+    //=========================================================================
+    // GetThreadCacheStats
+    //=========================================================================
+    template<bool DebugAllocator>
+    AllocatorThreadCacheStats HphaSchemaBase<DebugAllocator>::GetThreadCacheStats() const
+    {
+        AllocatorThreadCacheStats stats;
+#if defined(MULTITHREADED) && defined(USE_THREAD_CACHE)
+        m_allocator->thread_cache_stats(stats.m_hits, stats.m_misses);
+#endif
+        return stats;
+    }
+
     template<bool DebugAllocator>
     size_t HphaSchemaBase<DebugAllocator>::GetMemoryGuardSize()
     {
@@ -37,6 +37,9 @@ namespace AZ
 
         size_type       NumAllocatedBytes() const override;
 
+        /// Small allocations and frees are served from per thread caches, these are the hit and miss counts of those caches.
+        AllocatorThreadCacheStats GetThreadCacheStats() const override;
+
         /// Return unused memory to the OS. Don't call this unless you really need free memory, it is slow.
         void            GarbageCollect() override;
 
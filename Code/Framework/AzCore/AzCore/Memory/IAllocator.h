@@ -56,6 +56,15 @@ namespace AZ
         bool m_marksUnallocatedMemory = false;
     };
 
+    /**
+    * Statistics of the per thread caches an allocator keeps in front of its locked paths.
+    */
+    struct AllocatorThreadCacheStats
+    {
+        size_t m_hits = 0; ///< Allocations and frees served by a thread cache without taking a lock.
+        size_t m_misses = 0; ///< Allocations and frees which had to go through the locked path to refill or drain a cache.
+    };
+
     /**
      * Allocator interface base class
      */
@@ -158,6 +167,18 @@ namespace AZ
             return 0;
         }
 
+        /// Returns the statistics of the allocator's thread caches, all zero if the allocator has none.
+        virtual AllocatorThreadCacheStats GetThreadCacheStats() const
+        {
+            return {};
+        }
+
+        /// Returns the highest number of bytes the allocator has had in use, 0 if the allocator doesn't track it.
+        virtual size_type GetHighWaterMark() const
+        {
+            return 0;
+        }
+
         /// Returns the capacity of the Allocator in bytes. If the return value is 0 the Capacity is undefined (usually depends on another
         /// allocator)
         //AZ_DEPRECATED_MESSAGE("Use max_size instead, which matches the STD interface")
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/OSMemory.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AZ::OSMemory
+{
+    namespace
+    {
+        // Constant initialized, the allocators read it during static initialization
+        AZStd::atomic<int> s_largePageMode{ static_cast<int>(LargePageMode::Disabled) };
+    } // namespace
+
+    void SetLargePageMode(LargePageMode mode)
+    {
+        s_largePageMode.store(static_cast<int>(mode), AZStd::memory_order_relaxed);
+    }
+
+    LargePageMode GetLargePageMode()
+    {
+        return static_cast<LargePageMode>(s_largePageMode.load(AZStd::memory_order_relaxed));
+    }
+} // namespace AZ::OSMemory
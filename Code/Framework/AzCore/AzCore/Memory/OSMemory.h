@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    /**
+     * Direct OS page mappings with control over the physical backing, for allocator arenas which are large enough that
+     * TLB misses and remote NUMA memory accesses become measurable.
+     * Unlike AZ_OS_MALLOC the memory is mapped straight from the OS and never comes from the C heap, every mapping is
+     * released with FreePages and its exact size.
+     * On platforms without support GetLargePageSize returns 0 and AllocatePages returns nullptr, callers then fall back
+     * to their regular allocation path.
+     */
+    namespace OSMemory
+    {
+        enum class LargePageMode : int
+        {
+            Disabled = 0, ///< Regular OS pages.
+            Transparent = 1, ///< Hint the OS to back the mapping with large pages when it can (Linux transparent huge pages).
+            Explicit = 2, ///< Reserved large pages (MAP_HUGETLB, MEM_LARGE_PAGES), falls back to Transparent when none are available.
+        };
+
+        //! Passed as NUMA node when the mapping has no node preference.
+        constexpr int AnyNumaNode = -1;
+
+        //! Large page mode used by the heap allocators when they grow their arenas, see HphaSchema and FrameArenaSchema.
+        //! Only affects memory mapped after the call. Disabled by default.
+        void SetLargePageMode(LargePageMode mode);
+        LargePageMode GetLargePageMode();
+
+        //! Size of a large page, 0 if the platform can't map memory with large pages.
+        size_t GetLargePageSize();
+
+        //! Maps byteSize bytes of zero initialized memory, aligned to at least the OS page size.
+        //! byteSize must be a multiple of GetLargePageSize() unless mode is Disabled.
+        //! When numaNode isn't AnyNumaNode the memory is preferably placed on that node, otherwise the OS places it on
+        //! the node of the thread which first touches it.
+        //! Returns nullptr on failure or when not supported.
+        void* AllocatePages(size_t byteSize, LargePageMode mode, int numaNode = AnyNumaNode);
+        //! Releases a mapping returned by AllocatePages, byteSize must be the size it was allocated with.
+        void FreePages(void* address, size_t byteSize);
+
+        //! Number of NUMA nodes of the machine, 1 when the machine or platform has no NUMA support.
+        unsigned int GetNumaNodeCount();
+        //! NUMA node of the processor the calling thread currently runs on, AnyNumaNode when unknown.
+        int GetCurrentNumaNode();
+        //! Restricts the calling thread to the processors of numaNode and makes it prefer memory from that node.
+        //! Returns false if the thread could not be bound.
+        bool SetCurrentThreadNumaNode(int numaNode);
+    } // namespace OSMemory
+} // namespace AZ
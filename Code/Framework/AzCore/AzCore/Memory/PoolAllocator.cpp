@@ -18,6 +18,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/intrusive_slist.h>
 #include <AzCore/std/containers/intrusive_list.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/thread.h>
@@ -31,6 +32,10 @@
 #define POOL_ALLOCATION_PAGE_SIZE (size_t{4} * size_t{1024})
 #define POOL_ALLOCATION_MIN_ALLOCATION_SIZE size_t{8}
 #define POOL_ALLOCATION_MAX_ALLOCATION_SIZE size_t{512}
+// Number of completely free pages kept for reuse by any bucket, further free pages are returned to the page allocator.
+#define POOL_ALLOCATION_MAX_FREE_PAGES size_t{32}
+// Number of elements freed from other threads after which the owning thread reclaims them on its next deallocation.
+#define POOL_ALLOCATION_REMOTE_FREE_BATCH size_t{64}
 
 namespace AZ
 {
@@ -408,8 +413,12 @@ namespace AZ
             ThreadPoolSchemaImpl::Page::FakeNodeLF,
             AZStd::lock_free_intrusive_stack_base_hook<ThreadPoolSchemaImpl::Page::FakeNodeLF>>;
 
+        /// Returns all elements other threads pushed on m_freedElements to their pages, must be called from the owning thread.
+        void DeAllocateFreedElements();
+
         AllocatorType m_allocator;
         FreedElementsStack m_freedElements;
+        AZStd::atomic<size_t> m_numFreedElements{ 0 }; ///< Upper bound of the elements in m_freedElements.
     };
 } // namespace AZ
 
@@ -859,6 +868,12 @@ namespace AZ
     //=========================================================================
     AZ_INLINE void PoolSchemaImpl::PushFreePage(Page* page)
     {
+        if (m_freePages.size() >= POOL_ALLOCATION_MAX_FREE_PAGES)
+        {
+            // Enough pages are cached, give the memory back instead of holding on to it until GarbageCollect
+            FreePage(page);
+            return;
+        }
         m_freePages.push_front(*page);
     }
 
@@ -1097,14 +1112,10 @@ namespace AZ
                 m_threads.push_back(threadData);
             }
         }
-        else
+        else if (!threadData->m_freedElements.empty())
         {
             // deallocate elements if they were freed from other threads
-            Page::FakeNodeLF* fakeLFNode;
-            while ((fakeLFNode = threadData->m_freedElements.pop()) != nullptr)
-            {
-                threadData->m_allocator.DeAllocate(fakeLFNode);
-            }
+            threadData->DeAllocateFreedElements();
         }
 
         return threadData->m_allocator.Allocate(byteSize, alignment);
@@ -1128,6 +1139,13 @@ namespace AZ
         {
             // we can free here
             threadData->m_allocator.DeAllocate(ptr);
+
+            // A thread that mostly frees memory allocated elsewhere rarely allocates, reclaim its remote frees in
+            // batches from here too, so pages don't stay pinned by elements waiting on the stack.
+            if (threadData->m_numFreedElements.load(AZStd::memory_order_relaxed) >= POOL_ALLOCATION_REMOTE_FREE_BATCH)
+            {
+                threadData->DeAllocateFreedElements();
+            }
         }
         else
         {
@@ -1139,6 +1157,8 @@ namespace AZ
             // otherwise we will assert the node is in the list
             fakeLFNode->m_next = 0;
 #endif
+            // count before pushing, so the owner never subtracts more elements than were counted
+            page->m_threadData->m_numFreedElements.fetch_add(1, AZStd::memory_order_relaxed);
             page->m_threadData->m_freedElements.push(*fakeLFNode);
         }
     }
@@ -1199,8 +1219,14 @@ namespace AZ
 #endif
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
-            m_freePages.push_front(*page);
+            if (m_freePages.size() < POOL_ALLOCATION_MAX_FREE_PAGES)
+            {
+                m_freePages.push_front(*page);
+                return;
+            }
         }
+        // Enough pages are cached, give the memory back instead of holding on to it until GarbageCollect
+        FreePage(page);
     }
 
     //=========================================================================
@@ -1214,10 +1240,7 @@ namespace AZ
         {
             if (threadData)
             {
-                for (auto fakeLFNode = threadData->m_freedElements.pop(); fakeLFNode; fakeLFNode = threadData->m_freedElements.pop())
-                {
-                    threadData->m_allocator.DeAllocate(fakeLFNode);
-                }
+                threadData->DeAllocateFreedElements();
                 threadData->m_allocator.GarbageCollect();
             }
         }
@@ -1263,9 +1286,31 @@ namespace AZ
     ThreadPoolData::~ThreadPoolData()
     {
         // deallocate elements if they were freed from other threads
-        for (ThreadPoolSchemaImpl::Page::FakeNodeLF* fakeLFNode = m_freedElements.pop(); fakeLFNode; fakeLFNode = m_freedElements.pop())
+        DeAllocateFreedElements();
+    }
+
+    //=========================================================================
+    // ThreadPoolData::DeAllocateFreedElements
+    //=========================================================================
+    void ThreadPoolData::DeAllocateFreedElements()
+    {
+        // Take the whole stack at once instead of popping element by element, other threads keep pushing to the
+        // now empty stack while we walk the detached chain.
+        size_t numFreedElements = 0;
+        ThreadPoolSchemaImpl::Page::FakeNodeLF* fakeLFNode = m_freedElements.pop_all();
+        while (fakeLFNode)
         {
+            ThreadPoolSchemaImpl::Page::FakeNodeLF* next = fakeLFNode->m_next;
+#ifdef AZ_DEBUG_BUILD
+            fakeLFNode->m_next = nullptr;
+#endif
             m_allocator.DeAllocate(fakeLFNode);
+            fakeLFNode = next;
+            ++numFreedElements;
+        }
+        if (numFreedElements)
+        {
+            m_numFreedElements.fetch_sub(numFreedElements, AZStd::memory_order_relaxed);
         }
     }
 
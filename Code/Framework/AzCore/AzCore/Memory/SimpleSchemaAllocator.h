@@ -134,6 +134,16 @@ namespace AZ
             return m_schema->NumAllocatedBytes();
         }
 
+        AllocatorThreadCacheStats GetThreadCacheStats() const override
+        {
+            return m_schema->GetThreadCacheStats();
+        }
+
+        size_type GetHighWaterMark() const override
+        {
+            return m_schema->GetHighWaterMark();
+        }
+
     protected:
         IAllocator* m_schema{};
     private:
@@ -50,6 +50,8 @@ namespace AZ
 
         size_type       NumAllocatedBytes() const override       { return m_subAllocator->NumAllocatedBytes(); }
 
+        AllocatorThreadCacheStats GetThreadCacheStats() const override { return m_subAllocator->GetThreadCacheStats(); }
+
         //////////////////////////////////////////////////////////////////////////
 
     protected:
@@ -16,14 +16,87 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace
 {
     static const char* s_moduleLoggingScope = "Module Manager";
+
+    // Settings key for the number of threads that read dynamic modules from disk before they're loaded, 0 disables prefetching
+    constexpr AZStd::string_view ModulePrefetchThreadCountKey = "/O3DE/ModuleManager/PrefetchThreadCount";
+    constexpr AZ::u64 DefaultModulePrefetchThreadCount = 4;
+
+    //! Reads the module files on a few threads while they're loaded, so that the OS loader maps them from the file cache
+    //! instead of faulting in the pages of one module after the other. The files are read in load order, so the threads
+    //! stay ahead of the loader. Loading and initializing the modules has to stay serial, it registers environment
+    //! variables, component descriptors and reflection which aren't thread safe.
+    class ModulePrefetcher
+    {
+    public:
+        explicit ModulePrefetcher(AZStd::vector<AZ::OSString>&& modulePaths)
+            : m_modulePaths(AZStd::move(modulePaths))
+        {
+            AZ::u64 threadCount = DefaultModulePrefetchThreadCount;
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+            {
+                settingsRegistry->Get(threadCount, ModulePrefetchThreadCountKey);
+            }
+            threadCount = AZStd::min<AZ::u64>(threadCount, m_modulePaths.size());
+            if (threadCount < 2)
+            {
+                // A single module is faster to just load
+                return;
+            }
+
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "Module Prefetch";
+            m_threads.reserve(threadCount);
+            for (AZ::u64 threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                m_threads.emplace_back(threadDesc, [this]() { PrefetchModules(); });
+            }
+        }
+
+        ~ModulePrefetcher()
+        {
+            for (AZStd::thread& thread : m_threads)
+            {
+                thread.join();
+            }
+        }
+
+    private:
+        void PrefetchModules()
+        {
+            constexpr AZ::IO::SystemFile::SizeType ReadSize = 1024 * 1024;
+            AZStd::vector<char> buffer(ReadSize);
+            for (size_t moduleIndex = m_nextModule++; moduleIndex < m_modulePaths.size(); moduleIndex = m_nextModule++)
+            {
+                const char* modulePath = m_modulePaths[moduleIndex].c_str();
+                AZ::IO::SystemFile moduleFile;
+                if (!AZ::IO::SystemFile::Exists(modulePath) || !moduleFile.Open(modulePath, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+                {
+                    // Modules that aren't a file path are resolved by the OS loader, they're just not prefetched
+                    continue;
+                }
+
+                while (moduleFile.Read(ReadSize, buffer.data()) == ReadSize)
+                {
+                }
+            }
+        }
+
+        AZStd::vector<AZ::OSString> m_modulePaths;
+        AZStd::vector<AZStd::thread> m_threads;
+        AZStd::atomic<size_t> m_nextModule{ 0 };
+    };
 }
 
 namespace AZ
@@ -517,6 +590,21 @@ namespace AZ
     {
         LoadModulesResult results;
 
+        // Only the modules that still have to be loaded from disk are prefetched
+        AZStd::vector<AZ::OSString> prefetchPaths;
+        if (lastStepToPerform >= ModuleInitializationSteps::Load)
+        {
+            for (const auto& moduleDescriptor : modules)
+            {
+                AZStd::shared_ptr<ModuleDataImpl> moduleData = GetLoadedModule(moduleDescriptor.m_dynamicLibraryPath);
+                if (!moduleData || moduleData->m_lastCompletedStep < ModuleInitializationSteps::Load)
+                {
+                    prefetchPaths.emplace_back(PreProcessModule(moduleDescriptor.m_dynamicLibraryPath));
+                }
+            }
+        }
+        ModulePrefetcher prefetcher(AZStd::move(prefetchPaths));
+
         Internal::ModuleManagerSearchPathTool moduleSearchPathHelper;
 
         // Load DLLs specified in the application descriptor
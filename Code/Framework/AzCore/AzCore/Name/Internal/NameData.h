@@ -47,13 +47,16 @@ namespace AZ
 
             AZStd::atomic_int m_useCount{ 0 };
             AZStd::string m_name;
-            Hash m_hash;
+            //! Atomic because the lock-free index of the NameDictionary reads it without holding a reference.
+            AZStd::atomic<Hash> m_hash;
 
             // TODO: We should be able to change this to a normal bool after introducing name dictionary garbage collection
             AZStd::atomic<bool> m_hashCollision{ false }; // Tracks whether the hash has been involved in a collision
             //! Stores a pointer to the name dictionary that created the NameData
             //! if the the name dictionary is destroyed, set back to nullptr
             NameDictionary* m_nameDictionary{};
+            //! Next NameData in the same bucket of the lock-free index of the NameDictionary.
+            AZStd::atomic<NameData*> m_nextInIndex{ nullptr };
         };
     }
 }
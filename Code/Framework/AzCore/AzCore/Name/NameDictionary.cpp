@@ -25,6 +25,10 @@ namespace AZ
         // Pointer which indicated that the NameDictonary associated with the AZ::Interface
         // was created by the Create function below
         static AZ::EnvironmentVariable<AZStd::unique_ptr<AZ::NameDictionary>> s_staticNameDictionary;
+
+        static constexpr size_t InitialIndexBucketCount = 1024;
+        // NameData can move to another bucket of the index while a reader walks it, so walks are limited to guarantee they end.
+        static constexpr size_t MaxIndexSteps = 64;
     }
 
     void NameDictionary::Create()
@@ -92,6 +96,9 @@ namespace AZ
         // This prevents our list head from being destroyed from a module that has shut down its AZ::Environment and
         // invalidating our list.
         m_deferredHead.m_linkedToDictionary = true;
+
+        m_indexBuckets.push_back(AZStd::make_unique<IndexBuckets>(NameDictionaryInternal::InitialIndexBucketCount));
+        m_index = m_indexBuckets.back().get();
     }
     
     NameDictionary::~NameDictionary()
@@ -125,11 +132,67 @@ namespace AZ
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
+
+        for (Internal::NameData* nameData : m_releasedNameData)
+        {
+            delete nameData;
+        }
+    }
+
+    NameDictionary::IndexBuckets::IndexBuckets(size_t bucketCount)
+        : m_heads(AZStd::make_unique<AZStd::atomic<Internal::NameData*>[]>(bucketCount))
+        , m_mask(bucketCount - 1)
+    {
+        AZ_Assert((bucketCount & m_mask) == 0, "The number of buckets in the NameDictionary index needs to be a power of two.");
+        for (size_t i = 0; i < bucketCount; ++i)
+        {
+            m_heads[i].store(nullptr, AZStd::memory_order_relaxed);
+        }
+    }
+
+    Name NameDictionary::FindInIndex(Name::Hash hash) const
+    {
+        const IndexBuckets* buckets = m_index.load(AZStd::memory_order_acquire);
+        Internal::NameData* nameData = buckets->m_heads[hash & buckets->m_mask].load(AZStd::memory_order_acquire);
+        for (size_t steps = 0; nameData != nullptr && steps < NameDictionaryInternal::MaxIndexSteps; ++steps)
+        {
+            if (nameData->m_hash.load(AZStd::memory_order_relaxed) == hash)
+            {
+                return TryAcquireName(nameData, hash);
+            }
+            nameData = nameData->m_nextInIndex.load(AZStd::memory_order_acquire);
+        }
+        return Name();
+    }
+
+    Name NameDictionary::TryAcquireName(Internal::NameData* nameData, Name::Hash hash)
+    {
+        // A reference can only be taken while the NameData is in use. This also guarantees the NameData isn't reused for
+        // another name while the reference is taken, as that requires the use count to drop to 0 first.
+        int useCount = nameData->m_useCount.load(AZStd::memory_order_relaxed);
+        while (useCount > 0)
+        {
+            if (nameData->m_useCount.compare_exchange_weak(useCount, useCount + 1, AZStd::memory_order_acquire, AZStd::memory_order_relaxed))
+            {
+                Name name(nameData);
+                --nameData->m_useCount; // The Name holds its own reference.
+
+                // The NameData could have been reused for another name while it was found in the index.
+                return nameData->m_hash.load(AZStd::memory_order_relaxed) == hash ? AZStd::move(name) : Name();
+            }
+        }
+        return Name();
     }
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        // Names that are in use are found in the lock-free index, unless the index changed while it was searched.
+        if (Name name = FindInIndex(hash); !name.IsEmpty())
+        {
+            return name;
+        }
+
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
 
         // The NameData m_useCount check is to avoid a multithread race condition
         // where thread B is in NameData::release and reduces the m_useCount to 0
@@ -227,16 +290,16 @@ namespace AZ
         Name::Hash hash = CalcHash(nameString);
 
         // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
+        // This path is faster than the loop below because FindInIndex() doesn't lock whereas the
+        // loop requires a lock to modify the dictionary.
+        Name name = FindInIndex(hash);
         if (name.GetStringView() == nameString)
         {
             return AZStd::move(name);
         }
 
         // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
 
         auto iter = m_dictionary.find(hash);
         bool collisionDetected = false;
@@ -245,10 +308,11 @@ namespace AZ
             // No existing entry, add a new one and we're done
             if (iter == m_dictionary.end())
             {
-                Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
+                Internal::NameData* nameData = CreateNameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
                 // Piecewise construct to prevent creating a temporary ScopedNameDataWrapper that destructs
                 m_dictionary.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
+                AddToIndex(nameData);
                 return Name(nameData);
             }
             // Found the desired entry, return it
@@ -281,7 +345,7 @@ namespace AZ
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
 
         auto dictIt = m_dictionary.find(hash);
         if (dictIt == m_dictionary.end())
@@ -297,7 +361,7 @@ namespace AZ
 
         Internal::NameData* nameData = dictIt->second.m_nameData;
 
-        // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
+        // Check m_hashCollision inside the m_mutex because a new collision could have happened
         // on another thread before taking the lock.
         if (nameData->m_hashCollision)
         {
@@ -311,8 +375,9 @@ namespace AZ
         int32_t expectedRefCount = 0;
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
+            RemoveFromIndex(nameData);
             m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            m_releasedNameData.push_back(nameData);
         }
 
         ReportStats();
@@ -384,6 +449,67 @@ namespace AZ
 #endif // AZ_DEBUG_BUILD
     }
 
+    Internal::NameData* NameDictionary::CreateNameData(AZStd::string_view name, Name::Hash hash)
+    {
+        if (m_releasedNameData.empty())
+        {
+            return aznew Internal::NameData(name, hash);
+        }
+
+        Internal::NameData* nameData = m_releasedNameData.back();
+        m_releasedNameData.pop_back();
+        nameData->m_name = name;
+        nameData->m_hash = hash;
+        nameData->m_hashCollision = false;
+        // Readers of the index can only take a reference once the use count is above 0, which happens after the NameData
+        // describes the new name.
+        nameData->m_useCount = 0;
+        return nameData;
+    }
+
+    void NameDictionary::AddToIndex(Internal::NameData* nameData)
+    {
+        IndexBuckets* buckets = m_index.load(AZStd::memory_order_relaxed);
+        if (m_dictionary.size() <= buckets->m_mask + 1)
+        {
+            AZStd::atomic<Internal::NameData*>& head = buckets->m_heads[nameData->m_hash & buckets->m_mask];
+            nameData->m_nextInIndex.store(head.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+            head.store(nameData, AZStd::memory_order_release);
+            return;
+        }
+
+        // Grow the index to keep the buckets short. This moves the NameData to the new buckets while readers may still be walking
+        // the old ones, which can make them miss a name and fall back to the dictionary, but every NameData they reach stays valid.
+        // The dictionary already contains the new NameData, so it's added along with the others.
+        auto newBuckets = AZStd::make_unique<IndexBuckets>((buckets->m_mask + 1) * 2);
+        for (auto& entry : m_dictionary)
+        {
+            Internal::NameData* entryData = entry.second.m_nameData;
+            AZStd::atomic<Internal::NameData*>& head = newBuckets->m_heads[entryData->m_hash & newBuckets->m_mask];
+            entryData->m_nextInIndex.store(head.load(AZStd::memory_order_relaxed), AZStd::memory_order_release);
+            head.store(entryData, AZStd::memory_order_relaxed);
+        }
+        m_index.store(newBuckets.get(), AZStd::memory_order_release);
+        m_indexBuckets.push_back(AZStd::move(newBuckets));
+    }
+
+    void NameDictionary::RemoveFromIndex(Internal::NameData* nameData)
+    {
+        IndexBuckets* buckets = m_index.load(AZStd::memory_order_relaxed);
+        AZStd::atomic<Internal::NameData*>* link = &buckets->m_heads[nameData->m_hash & buckets->m_mask];
+        while (Internal::NameData* current = link->load(AZStd::memory_order_relaxed))
+        {
+            if (current == nameData)
+            {
+                // The NameData keeps pointing to the rest of the bucket so readers that are on it can continue.
+                link->store(nameData->m_nextInIndex.load(AZStd::memory_order_relaxed), AZStd::memory_order_release);
+                return;
+            }
+            link = &current->m_nextInIndex;
+        }
+        AZ_Assert(false, "Name '%.*s' wasn't found in the index of the NameDictionary.", AZ_STRING_ARG(nameData->GetName()));
+    }
+
     Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
     {
         // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
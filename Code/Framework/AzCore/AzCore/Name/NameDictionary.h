@@ -9,9 +9,12 @@
 #pragma once
 
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
-#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
@@ -71,7 +74,7 @@ namespace AZ
         //! @return A Name instance holding a dictionary entry associated with the provided raw string.
         Name MakeName(AZStd::string_view name);
 
-        //! Search for an existing name in the dictionary by hash.
+        //! Search for an existing name in the dictionary by hash. Names that are in use are found without taking a lock.
         //! @param hash The key by which to search for the name.
         //! @return A Name instance. If the hash was not found, the Name will be empty.
         Name FindName(Name::Hash hash) const;
@@ -127,8 +130,38 @@ namespace AZ
             NameDictionary& m_nameDictionary;
         };
 
+        //! Buckets of the lock-free index that FindName searches before taking the lock. Each bucket is a list of NameData
+        //! linked through NameData::m_nextInIndex. The index is only changed while holding m_mutex.
+        struct IndexBuckets
+        {
+            AZ_CLASS_ALLOCATOR(IndexBuckets, AZ::OSAllocator);
+
+            explicit IndexBuckets(size_t bucketCount);
+
+            AZStd::unique_ptr<AZStd::atomic<Internal::NameData*>[]> m_heads;
+            size_t m_mask;
+        };
+
+        // Searches the lock-free index. This can miss names that are being added or removed by other threads.
+        Name FindInIndex(Name::Hash hash) const;
+        // Returns a Name for the NameData if it's in use and is stored under the provided hash, otherwise an empty Name.
+        static Name TryAcquireName(Internal::NameData* nameData, Name::Hash hash);
+        // Returns the NameData for the name, reusing released NameData if possible. Requires m_mutex to be locked.
+        Internal::NameData* CreateNameData(AZStd::string_view name, Name::Hash hash);
+        void AddToIndex(Internal::NameData* nameData);
+        void RemoveFromIndex(Internal::NameData* nameData);
+
         AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        mutable AZStd::mutex m_mutex;
+
+        //! The current buckets of the lock-free index.
+        AZStd::atomic<IndexBuckets*> m_index{ nullptr };
+        //! All buckets that were used by the index. Buckets that were replaced when the index grew are kept, as readers may
+        //! still be walking them.
+        AZStd::vector<AZStd::unique_ptr<IndexBuckets>> m_indexBuckets;
+        //! NameData that was released. Readers of the lock-free index can still hold a pointer to released NameData, so it's
+        //! reused for new names instead of being deleted until the dictionary is destroyed.
+        AZStd::vector<Internal::NameData*> m_releasedNameData;
 
         //! A fixed Name used as the head of a linked list of Name literals.
         //! These literals can be static and have lifecycles not coupled to the name dictionary,
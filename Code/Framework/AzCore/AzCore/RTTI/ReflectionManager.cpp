@@ -28,6 +28,7 @@ namespace AZ
         {
             RemoveReflectContext(azrtti_typeid(m_contexts.back().get()));
         }
+        m_lazyContexts.clear();
 
         // Clear the entry points
         m_entryPoints.clear();
@@ -48,10 +49,11 @@ namespace AZ
         auto entryIt = m_entryPoints.emplace(m_entryPoints.end(), typeId, reflectEntryPoint);
         m_typedEntryPoints.emplace(typeId, AZStd::move(entryIt));
 
-        // Call the new entry point with all known contexts
-        for (const auto& context : m_contexts)
+        // Call the new entry point with all known contexts. A lazy context requested by the entry point is appended to
+        // m_contexts and reflects all entry points itself, so only the contexts that existed before are visited.
+        for (size_t contextIndex = 0, contextCount = m_contexts.size(); contextIndex < contextCount; ++contextIndex)
         {
-            reflectEntryPoint(context.get());
+            reflectEntryPoint(m_contexts[contextIndex].get());
         }
     }
 
@@ -92,10 +94,10 @@ namespace AZ
         auto entryIt = m_entryPoints.emplace(m_entryPoints.end(), reflectEntryPoint);
         m_nonTypedEntryPoints.emplace(reflectEntryPoint, AZStd::move(entryIt));
 
-        // Call the new entry point with all known contexts
-        for (const auto& contextIt : m_contexts)
+        // Call the new entry point with all known contexts, see the typed overload
+        for (size_t contextIndex = 0, contextCount = m_contexts.size(); contextIndex < contextCount; ++contextIndex)
         {
-            reflectEntryPoint(contextIt.get());
+            reflectEntryPoint(m_contexts[contextIndex].get());
         }
     }
 
@@ -165,6 +167,31 @@ namespace AZ
         m_contexts.emplace_back(AZStd::move(context));
     }
 
+    //=========================================================================
+    // AddLazyReflectContext
+    //=========================================================================
+    void ReflectionManager::AddLazyReflectContext(AZStd::unique_ptr<ReflectContext>&& context)
+    {
+        // Early out if the context is already registered, lazily or not
+        const AZ::TypeId contextTypeId = azrtti_typeid(context.get());
+        for (const auto& lazyContext : m_lazyContexts)
+        {
+            if (azrtti_typeid(lazyContext.get()) == contextTypeId)
+            {
+                return;
+            }
+        }
+        for (const auto& existingContext : m_contexts)
+        {
+            if (azrtti_typeid(existingContext.get()) == contextTypeId)
+            {
+                return;
+            }
+        }
+
+        m_lazyContexts.emplace_back(AZStd::move(context));
+    }
+
     //=========================================================================
     // GetReflectContext
     //=========================================================================
@@ -178,6 +205,25 @@ namespace AZ
             }
         }
 
+        for (auto lazyContextIt = m_lazyContexts.begin(); lazyContextIt != m_lazyContexts.end(); ++lazyContextIt)
+        {
+            if (azrtti_typeid(lazyContextIt->get()) == contextTypeId)
+            {
+                // The context is added before reflecting, so that entry points registered or contexts requested while reflecting
+                // see it. Only the entry points that existed beforehand are visited, new ones reflect to it on registration.
+                ReflectContext* context = lazyContextIt->get();
+                m_contexts.emplace_back(AZStd::move(*lazyContextIt));
+                m_lazyContexts.erase(lazyContextIt);
+
+                auto entryIt = m_entryPoints.begin();
+                for (size_t entryCount = m_entryPoints.size(); entryCount > 0; --entryCount, ++entryIt)
+                {
+                    (*entryIt)(context);
+                }
+                return context;
+            }
+        }
+
         return nullptr;
     }
 
@@ -186,6 +232,16 @@ namespace AZ
     //=========================================================================
     void ReflectionManager::RemoveReflectContext(AZ::TypeId contextTypeId)
     {
+        // Lazy contexts that were never requested have nothing to unreflect
+        for (auto lazyContextIt = m_lazyContexts.begin(); lazyContextIt != m_lazyContexts.end(); ++lazyContextIt)
+        {
+            if (azrtti_typeid(lazyContextIt->get()) == contextTypeId)
+            {
+                m_lazyContexts.erase(lazyContextIt);
+                return;
+            }
+        }
+
         for (auto contextIt = m_contexts.begin(); contextIt != m_contexts.end(); ++contextIt)
         {
             ReflectContext* context = contextIt->get();
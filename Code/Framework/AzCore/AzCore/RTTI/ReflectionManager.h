@@ -49,7 +49,12 @@ namespace AZ
         template <typename ReflectContextT, typename = IsReflectContextT<ReflectContextT>>
         void AddReflectContext() { AddReflectContext(AZStd::make_unique<ReflectContextT>()); }
 
-        /// Gets a reflect context of the requested type
+        /// Creates a reflect context that is only reflected the first time it's requested through GetReflectContext.
+        /// Applications that never use the context, e.g. a server that doesn't run scripts, skip the cost of reflecting it.
+        template <typename ReflectContextT, typename = IsReflectContextT<ReflectContextT>>
+        void AddLazyReflectContext() { AddLazyReflectContext(AZStd::make_unique<ReflectContextT>()); }
+
+        /// Gets a reflect context of the requested type, reflects all registered entry points if it's a lazy context requested for the first time
         template <typename ReflectContextT, typename = IsReflectContextT<ReflectContextT>>
         ReflectContextT* GetReflectContext() { return azrtti_cast<ReflectContextT*>(GetReflectContext(azrtti_typeid<ReflectContextT>())); }
 
@@ -73,6 +78,8 @@ namespace AZ
         };
 
         AZStd::vector<AZStd::unique_ptr<ReflectContext>> m_contexts;
+        // Lazy contexts that haven't been requested yet, none of the entry points have been reflected to them
+        AZStd::vector<AZStd::unique_ptr<ReflectContext>> m_lazyContexts;
 
         using EntryPointList = AZStd::list<EntryPoint>;
         EntryPointList m_entryPoints;
@@ -81,6 +88,7 @@ namespace AZ
         AZStd::unordered_map<StaticReflectionFunctionPtr, EntryPointList::iterator> m_nonTypedEntryPoints;
 
         void AddReflectContext(AZStd::unique_ptr<ReflectContext>&& context);
+        void AddLazyReflectContext(AZStd::unique_ptr<ReflectContext>&& context);
         ReflectContext* GetReflectContext(AZ::TypeId contextTypeId);
         void RemoveReflectContext(AZ::TypeId contextTypeId);
     };
@@ -13,6 +13,7 @@
 #include <AzCore/Script/ScriptContextDebug.h>
 #include <AzCore/Script/ScriptProperty.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Script/lua/lua.h>
 #include <AzCore/IO/GenericStreams.h>
@@ -3482,24 +3483,26 @@ LUA_API const Node* lua_getDummyNode()
 
                 // there's no limit inherently in BehaviorContext (as there is no document limit in C++), but the LY supported limits default to 40 for Lua, ScriptCanvas, and ScriptEvents.
                 // this limit of 40 is however implicit, for now.
-                BehaviorArgument arguments[40];
+                // Only the arguments of this call are constructed, instead of all 40 every time a method is called.
+                AZStd::fixed_vector<BehaviorArgument, 40> arguments;
                 BehaviorArgument result;
                 ScriptContext::StackVariableAllocator tempData;
                 AZStd::allocator backupAllocator;
                 bool usedBackupAlloc  = false;
 
                 int numArguments = GetMin(static_cast<int>(thisPtr->m_method->GetNumArguments()), numElementsOnStack);
-                AZ_Assert(static_cast<int>(AZ_ARRAY_SIZE(arguments)) >= numArguments, "Increase the argument array size!");
+                AZ_Assert(static_cast<int>(arguments.capacity()) >= numArguments, "Increase the argument array size!");
 
                 // for each argument read a variable from the stack to a BehaviorArgument
                 for (int i = 0; i < numArguments; ++i)
                 {
                     const AZ::BehaviorParameter* parameter = thisPtr->m_method->GetArgument(i);
-                    arguments[i].Set(*parameter); // store the type of result we expect (pointer, const, etc.)
-                    if (!thisPtr->m_fromLua[i].first(lua, i + 1, arguments[i], thisPtr->m_fromLua[i].second, &tempData))
+                    BehaviorArgument& argument = arguments.emplace_back();
+                    argument.Set(*parameter); // store the type of result we expect (pointer, const, etc.)
+                    if (!thisPtr->m_fromLua[i].first(lua, i + 1, argument, thisPtr->m_fromLua[i].second, &tempData))
                     {
                         ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Lua failed to call method: cannot convert parameter %d from %s to %s",
-                            i + 1, arguments[i].m_name, parameter->m_name);
+                            i + 1, argument.m_name, parameter->m_name);
                         return 0;
                     }
                 }
@@ -3513,6 +3516,17 @@ LUA_API const Node* lua_getDummyNode()
                 }
                 int numResults = 0;
 
+                // The result callback only captures a pointer to this, so it fits into the small buffer of the
+                // AZStd::function and doesn't allocate on every call.
+                struct PushResultContext
+                {
+                    lua_State* m_lua;
+                    LuaScriptCaller* m_caller;
+                    BehaviorArgument* m_result;
+                    int* m_numResults;
+                };
+                PushResultContext pushResultContext{ lua, thisPtr, &result, &numResults };
+
                 if (thisPtr->m_resultToLua)
                 {
                     result.Set(*thisPtr->m_method->GetResult());
@@ -3522,18 +3536,18 @@ LUA_API const Node* lua_getDummyNode()
                         usedBackupAlloc  = thisPtr->m_prepareResult(result, thisPtr->m_resultClass, tempData, &backupAllocator); // pass temp memory and class info
                     }
 
-                    // TODO: Make it optional for EBuses only, make it light weight too, probably a virtual function for the store result.
-                    result.m_onAssignedResult = AZStd::function<void()>([&]()
+                    // TODO: Make it optional for EBuses only, probably a virtual function for the store result.
+                    result.m_onAssignedResult = AZStd::function<void()>([context = &pushResultContext]()
                     {
-                        if (result.m_value)
+                        if (context->m_result->m_value)
                         {
-                            thisPtr->m_resultToLua(lua, result);
-                            ++numResults;
+                            context->m_caller->m_resultToLua(context->m_lua, *context->m_result);
+                            ++*context->m_numResults;
                         }
                     });
                 }
 
-                bool isCalled = thisPtr->m_method->Call(arguments, numArguments, thisPtr->m_resultToLua ? &result : nullptr);
+                bool isCalled = thisPtr->m_method->Call(arguments.data(), numArguments, thisPtr->m_resultToLua ? &result : nullptr);
 
                 if (!isCalled)
                 {
@@ -5875,9 +5889,9 @@ LUA_API const Node* lua_getDummyNode()
     }
 
     //////////////////////////////////////////////////////////////////////////
-    void ScriptContext::GarbageCollectStep(int numberOfSteps)
+    bool ScriptContext::GarbageCollectStep(int numberOfSteps)
     {
-        lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps);
+        return lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps) != 0;
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -15,6 +15,7 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Debug/ProfilerReflection.h>
 #include <AzCore/Debug/TraceReflection.h>
 #include <AzCore/IO/FileIO.h>
@@ -31,6 +32,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/string/conversions.h>
 
 namespace AZ
@@ -302,6 +304,9 @@ ScriptContext*  ScriptSystemComponent::GetContext(ScriptContextId id)
 //=========================================================================
 void    ScriptSystemComponent::OnSystemTick()
 {
+    const AZStd::chrono::steady_clock::time_point gcDeadline =
+        AZStd::chrono::steady_clock::now() + AZStd::chrono::microseconds(m_garbageCollectorBudgetMicroseconds);
+
     for (size_t i = 0; i < m_contexts.size(); ++i)
     {
         ContextContainer& contextContainer = m_contexts[i];
@@ -310,7 +315,15 @@ void    ScriptSystemComponent::OnSystemTick()
             contextContainer.m_context->GetDebugContext()->ProcessDebugCommands();
         }
 
-        contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        AZ_PROFILE_SCOPE(AzCore, "ScriptSystemComponent::OnSystemTick: GarbageCollectStep");
+        bool isCycleFinished = contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+
+        // Spread the collection over the remaining frame budget instead of waiting for the debt to pile up,
+        // which otherwise shows up as a long step once the allocation rate is high.
+        while (!isCycleFinished && AZStd::chrono::steady_clock::now() < gcDeadline)
+        {
+            isCycleFinished = contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        }
     }
 }
 
@@ -871,6 +884,7 @@ void ScriptSystemComponent::Reflect(ReflectContext* reflection)
             ->Version(1)
             // ->Attribute(AZ::Edit::Attributes::SystemComponentTags, AZStd::vector<AZ::Crc32>({ AZ_CRC("AssetBuilder", 0xc739c7d7) }))
             ->Field("garbageCollectorSteps", &ScriptSystemComponent::m_defaultGarbageCollectorSteps)
+            ->Field("garbageCollectorBudgetMicroseconds", &ScriptSystemComponent::m_garbageCollectorBudgetMicroseconds)
             ;
 
         if (EditContext* editContext = serializeContext->GetEditContext())
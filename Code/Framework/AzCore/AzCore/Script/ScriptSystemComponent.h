@@ -124,6 +124,9 @@ namespace AZ
             int                                 m_tableReference = -2; //< The reference to the table returned by the script (default -2 == LUA_NOREF)
         };
         int m_defaultGarbageCollectorSteps;
+        /// Time in microseconds the garbage collector can keep stepping each system tick, after every context got its
+        /// steps. Zero only performs the steps of each context.
+        int m_garbageCollectorBudgetMicroseconds = 0;
 
         struct ContextContainer
         {
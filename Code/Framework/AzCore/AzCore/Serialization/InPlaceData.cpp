@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Serialization/InPlaceData.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ::InPlaceData
+{
+    Builder::Builder()
+    {
+        m_data.resize(sizeof(Header));
+    }
+
+    size_t Builder::Append(const void* data, size_t size, size_t alignment)
+    {
+        const size_t offset = AZ_SIZE_ALIGN_UP(m_data.size(), alignment);
+        m_data.resize(offset + size, 0);
+        memcpy(m_data.data() + offset, data, size);
+        return offset;
+    }
+
+    AZStd::vector<u8> Builder::Finish(const Uuid& rootType, size_t rootOffset)
+    {
+        AZ_Assert(rootOffset >= sizeof(Header) && rootOffset < m_data.size(), "The root offset %zu isn't part of the in-place data.", rootOffset);
+
+        // Pad the end so in-place data can be appended to other in-place data without breaking the alignment.
+        m_data.resize(AZ_SIZE_ALIGN_UP(m_data.size(), MaxAlignment), 0);
+
+        Header header;
+        header.m_size = m_data.size();
+        header.m_rootType = rootType;
+        header.m_rootOffset = rootOffset;
+        memcpy(m_data.data(), &header, sizeof(header));
+
+        AZStd::vector<u8> result = AZStd::move(m_data);
+        m_data.clear();
+        m_data.resize(sizeof(Header));
+        return result;
+    }
+
+    Blob::Blob(Blob&& rhs)
+        : m_mappedFile(AZStd::move(rhs.m_mappedFile))
+        , m_ownedData(AZStd::exchange(rhs.m_ownedData, nullptr))
+        , m_data(AZStd::exchange(rhs.m_data, nullptr))
+        , m_size(AZStd::exchange(rhs.m_size, 0))
+    {
+    }
+
+    Blob::~Blob()
+    {
+        Reset();
+    }
+
+    Blob& Blob::operator=(Blob&& rhs)
+    {
+        if (this != &rhs)
+        {
+            Reset();
+            m_mappedFile = AZStd::move(rhs.m_mappedFile);
+            m_ownedData = AZStd::exchange(rhs.m_ownedData, nullptr);
+            m_data = AZStd::exchange(rhs.m_data, nullptr);
+            m_size = AZStd::exchange(rhs.m_size, 0);
+        }
+        return *this;
+    }
+
+    bool Blob::Load(IO::GenericStream& stream)
+    {
+        Reset();
+
+        const IO::SizeType size = stream.GetLength() - stream.GetCurPos();
+        if (size < sizeof(Header))
+        {
+            AZ_Error("InPlaceData", false, "'%s' is too small to contain in-place data.", stream.GetFilename());
+            return false;
+        }
+
+        m_ownedData = azmalloc(aznumeric_cast<size_t>(size), MaxAlignment);
+        m_data = reinterpret_cast<const u8*>(m_ownedData);
+        m_size = aznumeric_cast<size_t>(size);
+        if (stream.Read(size, m_ownedData) != size)
+        {
+            AZ_Error("InPlaceData", false, "Unable to read the in-place data from '%s'.", stream.GetFilename());
+            Reset();
+            return false;
+        }
+        return Validate();
+    }
+
+    bool Blob::Load(const void* data, size_t size)
+    {
+        Reset();
+
+        if (size < sizeof(Header))
+        {
+            AZ_Error("InPlaceData", false, "The buffer is too small to contain in-place data.");
+            return false;
+        }
+
+        m_ownedData = azmalloc(size, MaxAlignment);
+        memcpy(m_ownedData, data, size);
+        m_data = reinterpret_cast<const u8*>(m_ownedData);
+        m_size = size;
+        return Validate();
+    }
+
+    bool Blob::Map(const char* filePath)
+    {
+        Reset();
+
+        if (!m_mappedFile.Open(filePath))
+        {
+            AZ_Error("InPlaceData", false, "Unable to map '%s'.", filePath);
+            return false;
+        }
+        m_data = m_mappedFile.GetData();
+        m_size = aznumeric_cast<size_t>(m_mappedFile.GetSize());
+        return Validate();
+    }
+
+    void Blob::Reset()
+    {
+        m_mappedFile.Close();
+        if (m_ownedData)
+        {
+            azfree(m_ownedData);
+            m_ownedData = nullptr;
+        }
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    bool Blob::IsLoaded() const
+    {
+        return m_data != nullptr;
+    }
+
+    const u8* Blob::GetData() const
+    {
+        return m_data;
+    }
+
+    size_t Blob::GetSize() const
+    {
+        return m_size;
+    }
+
+    bool Blob::Validate()
+    {
+        Header header;
+        if (m_size >= sizeof(Header))
+        {
+            memcpy(&header, m_data, sizeof(header));
+        }
+
+        const char* error = nullptr;
+        if (m_size < sizeof(Header) || header.m_magic != Magic)
+        {
+            error = "The data isn't in-place data.";
+        }
+        else if (header.m_version != Version)
+        {
+            error = "The in-place data is of an unsupported version.";
+        }
+        else if (header.m_size > m_size)
+        {
+            error = "The in-place data is truncated.";
+        }
+        else if (header.m_rootOffset < sizeof(Header) || header.m_rootOffset >= header.m_size)
+        {
+            error = "The root of the in-place data is outside of the data.";
+        }
+        else if (reinterpret_cast<uintptr_t>(m_data) % MaxAlignment != 0)
+        {
+            error = "The in-place data isn't aligned.";
+        }
+
+        if (error)
+        {
+            AZ_Error("InPlaceData", false, "%s", error);
+            Reset();
+            return false;
+        }
+
+        // Anything after the in-place data, such as padding added by the packaging, isn't part of it.
+        m_size = aznumeric_cast<size_t>(header.m_size);
+        return true;
+    }
+
+    const void* Blob::GetRoot(const Uuid& rootType) const
+    {
+        if (!m_data)
+        {
+            return nullptr;
+        }
+
+        const Header* header = reinterpret_cast<const Header*>(m_data);
+        if (header->m_rootType != rootType)
+        {
+            AZ_Error("InPlaceData", false, "The root of the in-place data is of type %s instead of the requested type %s.",
+                header->m_rootType.ToString<AZStd::string>().c_str(), rootType.ToString<AZStd::string>().c_str());
+            return nullptr;
+        }
+        return m_data + header->m_rootOffset;
+    }
+
+    bool Blob::Contains(const void* data, size_t size) const
+    {
+        const uintptr_t begin = reinterpret_cast<uintptr_t>(m_data);
+        const uintptr_t address = reinterpret_cast<uintptr_t>(data);
+        return m_data && address >= begin && address - begin <= m_size && size <= m_size - (address - begin);
+    }
+} // namespace AZ::InPlaceData
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/typetraits/is_trivially_copyable.h>
+
+namespace AZ::IO
+{
+    class GenericStream;
+}
+
+//! In-place data is a binary format for assets that mostly consist of arrays of plain data, such as vertex buffers or animation
+//! keys. The file is a single block that's used as-is after loading, so loading costs one allocation and one read, or no
+//! allocations at all if the file is memory mapped. Arrays address their elements relative to themselves, so the block
+//! doesn't need any pointer fix-ups and can be loaded at any address, including read-only mappings.
+//! The layout is:
+//!     Header
+//!     The root object, followed by the objects and array elements it refers to, each aligned to its own alignment.
+//! Only trivially copyable types can be stored, and the format uses the byte order of the platform it was built for.
+namespace AZ::InPlaceData
+{
+    inline constexpr u32 Magic = 'I' | ('P' << 8) | ('L' << 16) | ('D' << 24);
+    inline constexpr u32 Version = 1;
+    //! Alignment of the start of the data. Types stored in in-place data can't have a larger alignment.
+    inline constexpr size_t MaxAlignment = 16;
+
+    struct Header
+    {
+        u32 m_magic{ Magic };
+        u32 m_version{ Version };
+        //! Total size of the data, including this header.
+        u64 m_size{ 0 };
+        //! Type id of the root object.
+        Uuid m_rootType{ Uuid::CreateNull() };
+        //! Offset of the root object from the start of the data.
+        u64 m_rootOffset{ 0 };
+        u64 m_padding{ 0 };
+    };
+    static_assert(sizeof(Header) == 48, "The in-place data header is part of the file format and can't change size.");
+    static_assert(sizeof(Header) % MaxAlignment == 0, "The in-place data header needs to keep the data after it aligned.");
+
+    //! Array of trivially copyable elements stored in in-place data. Only objects that are part of in-place data can
+    //! refer to elements, as the elements are stored relative to the array itself.
+    template<typename T>
+    class Array
+    {
+        static_assert(AZStd::is_trivially_copyable_v<T>, "Only trivially copyable types can be stored in in-place data.");
+        static_assert(alignof(T) <= MaxAlignment, "The alignment of the element type is larger than in-place data supports.");
+
+    public:
+        const T* data() const
+        {
+            return m_size ? reinterpret_cast<const T*>(reinterpret_cast<const u8*>(this) + m_offset) : nullptr;
+        }
+        size_t size() const { return aznumeric_cast<size_t>(m_size); }
+        bool empty() const { return m_size == 0; }
+
+        const T* begin() const { return data(); }
+        const T* end() const { return data() + size(); }
+
+        const T& operator[](size_t index) const
+        {
+            AZ_Assert(index < m_size, "Index %zu is out of range for in-place array of size %llu.", index, m_size);
+            return data()[index];
+        }
+
+        AZStd::span<const T> AsSpan() const { return AZStd::span<const T>(data(), size()); }
+
+    private:
+        friend class Builder;
+
+        s64 m_offset{ 0 };
+        u64 m_size{ 0 };
+    };
+
+    //! Builds in-place data, typically from an asset builder. Objects are referred to by their offset in the data, as the
+    //! storage moves while the data grows.
+    //! Example:
+    //!     Builder builder;
+    //!     size_t rootOffset = builder.Add(MeshData{});
+    //!     builder.SetArray(rootOffset + offsetof(MeshData, m_positions), AZStd::span<const Vector3f>(positions));
+    //!     AZStd::vector<u8> data = builder.Finish<MeshData>(rootOffset);
+    class Builder
+    {
+    public:
+        Builder();
+
+        //! Appends a copy of the object and returns its offset.
+        template<typename T>
+        size_t Add(const T& value);
+
+        //! Returns the object at the provided offset. The reference is only valid until the next object or array is added.
+        template<typename T>
+        T& Get(size_t offset);
+
+        //! Copies the elements into the data and points the Array<T> stored at arrayOffset to them.
+        template<typename T>
+        void SetArray(size_t arrayOffset, AZStd::span<const T> elements);
+
+        //! Completes the header and returns the data. The builder is empty afterwards.
+        template<typename Root>
+        AZStd::vector<u8> Finish(size_t rootOffset);
+
+    private:
+        size_t Append(const void* data, size_t size, size_t alignment);
+        AZStd::vector<u8> Finish(const Uuid& rootType, size_t rootOffset);
+
+        AZStd::vector<u8> m_data;
+    };
+
+    //! Loaded in-place data. The data is either owned by the blob or memory mapped from a file.
+    class Blob
+    {
+    public:
+        Blob() = default;
+        Blob(const Blob&) = delete;
+        Blob(Blob&& rhs);
+        ~Blob();
+
+        Blob& operator=(const Blob&) = delete;
+        Blob& operator=(Blob&& rhs);
+
+        //! Reads the remainder of the stream into a single allocation.
+        bool Load(IO::GenericStream& stream);
+        //! Copies the data from the provided buffer.
+        bool Load(const void* data, size_t size);
+        //! Maps the file at the provided path instead of reading it. The path needs to be an absolute path without aliases.
+        bool Map(const char* filePath);
+        void Reset();
+
+        bool IsLoaded() const;
+        const u8* GetData() const;
+        size_t GetSize() const;
+
+        //! Returns the root object, or nullptr if nothing is loaded or the root isn't of the requested type.
+        template<typename Root>
+        const Root* GetRoot() const;
+
+        //! Checks that the elements of the array are inside the data. Use this when the data comes from a source that
+        //! isn't trusted.
+        template<typename T>
+        bool Contains(const Array<T>& array) const;
+
+    private:
+        bool Validate();
+        const void* GetRoot(const Uuid& rootType) const;
+        bool Contains(const void* data, size_t size) const;
+
+        IO::MappedFile m_mappedFile;
+        void* m_ownedData{ nullptr };
+        const u8* m_data{ nullptr };
+        size_t m_size{ 0 };
+    };
+
+    template<typename T>
+    size_t Builder::Add(const T& value)
+    {
+        static_assert(AZStd::is_trivially_copyable_v<T>, "Only trivially copyable types can be stored in in-place data.");
+        static_assert(alignof(T) <= MaxAlignment, "The alignment of the type is larger than in-place data supports.");
+        return Append(&value, sizeof(T), alignof(T));
+    }
+
+    template<typename T>
+    T& Builder::Get(size_t offset)
+    {
+        AZ_Assert(offset + sizeof(T) <= m_data.size(), "Offset %zu is outside of the in-place data being built.", offset);
+        return *reinterpret_cast<T*>(m_data.data() + offset);
+    }
+
+    template<typename T>
+    void Builder::SetArray(size_t arrayOffset, AZStd::span<const T> elements)
+    {
+        const size_t elementsOffset = elements.empty() ? arrayOffset : Append(elements.data(), elements.size_bytes(), alignof(T));
+        Array<T>& array = Get<Array<T>>(arrayOffset);
+        array.m_offset = aznumeric_cast<s64>(elementsOffset) - aznumeric_cast<s64>(arrayOffset);
+        array.m_size = elements.size();
+    }
+
+    template<typename Root>
+    AZStd::vector<u8> Builder::Finish(size_t rootOffset)
+    {
+        return Finish(AzTypeInfo<Root>::Uuid(), rootOffset);
+    }
+
+    template<typename Root>
+    const Root* Blob::GetRoot() const
+    {
+        const void* root = GetRoot(AzTypeInfo<Root>::Uuid());
+        return root && Contains(root, sizeof(Root)) ? reinterpret_cast<const Root*>(root) : nullptr;
+    }
+
+    template<typename T>
+    bool Blob::Contains(const Array<T>& array) const
+    {
+        return array.empty() ||
+            (Contains(&array, sizeof(array)) && array.size() <= GetSize() / sizeof(T) && Contains(array.data(), array.size() * sizeof(T)));
+    }
+} // namespace AZ::InPlaceData
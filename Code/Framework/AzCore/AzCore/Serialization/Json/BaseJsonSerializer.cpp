@@ -6,11 +6,14 @@
  *
  */
 
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
 #include <AzCore/Serialization/Json/JsonDeserializer.h>
 #include <AzCore/Serialization/Json/JsonSerializer.h>
 #include <AzCore/Serialization/Json/JsonSerializationResult.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace AZ
 {
@@ -125,15 +128,100 @@ namespace AZ
     JsonDeserializerContext::JsonDeserializerContext(JsonDeserializerSettings& settings)
         : JsonBaseContext(settings.m_metadata, settings.m_reporting,
             StackedString::Format::JsonPointer, settings.m_serializeContext, settings.m_registrationContext)
+        , m_parallelLoadThreshold(settings.m_parallelLoadThreshold)
         , m_clearContainers(settings.m_clearContainers)
     {
     }
 
+    JsonDeserializerContext::JsonDeserializerContext(JsonDeserializerContext& parent, JsonSerializationResult::JsonIssueCallback reporting)
+        : JsonBaseContext(parent.m_metadata, AZStd::move(reporting),
+            StackedString::Format::JsonPointer, parent.m_serializeContext, parent.m_registrationContext)
+        , m_clearContainers(parent.m_clearContainers)
+    {
+        // The parallel load threshold isn't copied because waiting for nested containers inside a task isn't supported.
+    }
+
     bool JsonDeserializerContext::ShouldClearContainers() const
     {
         return m_clearContainers;
     }
 
+    bool JsonDeserializerContext::ShouldLoadInParallel(size_t entryCount) const
+    {
+        return m_parallelLoadThreshold > 0 && entryCount >= m_parallelLoadThreshold;
+    }
+
+    void JsonDeserializerContext::LoadInParallel(size_t entryCount, const ParallelLoadFunction& load, const ParallelStoreFunction& store)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        struct Issue
+        {
+            AZStd::string m_message;
+            AZStd::string m_path;
+            JSR::ResultCode m_result;
+        };
+        struct Entry
+        {
+            AZStd::vector<Issue> m_issues;
+            JSR::ResultCode m_result{ JSR::Tasks::ReadField };
+        };
+        AZStd::vector<Entry> entries(entryCount);
+
+        auto loadEntries = [this, &entries, &load](size_t begin, size_t end)
+        {
+            Entry* currentEntry = nullptr;
+            JsonDeserializerContext entryContext(*this,
+                [&currentEntry](AZStd::string_view message, JSR::ResultCode result, AZStd::string_view path) -> JSR::ResultCode
+                {
+                    currentEntry->m_issues.push_back(Issue{ AZStd::string(message), AZStd::string(path), result });
+                    return result;
+                });
+            for (size_t i = begin; i < end; ++i)
+            {
+                currentEntry = &entries[i];
+                currentEntry->m_result = load(i, entryContext);
+            }
+        };
+
+        TaskGraphActiveInterface* taskGraphActive = Interface<TaskGraphActiveInterface>::Get();
+        if (entryCount > 1 && taskGraphActive && taskGraphActive->IsTaskGraphActive())
+        {
+            // A few batches per worker keeps the workers busy when entries take different amounts of time to load.
+            const size_t taskCount = AZStd::min<size_t>(entryCount, TaskExecutor::Instance().GetWorkerCount() * 4);
+            TaskGraph graph{ "Json parallel load" };
+            graph.AddTaskGroup(TaskDescriptor{ "Load json entries", "Serialization" }, aznumeric_cast<uint32_t>(taskCount),
+                [&loadEntries, entryCount, taskCount](uint32_t taskIndex)
+                {
+                    loadEntries(entryCount * taskIndex / taskCount, entryCount * (taskIndex + 1) / taskCount);
+                });
+            TaskGraphEvent finished{ "Json parallel load" };
+            graph.Submit(&finished);
+            finished.Wait();
+        }
+        else
+        {
+            loadEntries(0, entryCount);
+        }
+
+        AZStd::string path;
+        bool isReporting = true;
+        for (size_t i = 0; i < entryCount; ++i)
+        {
+            Entry& entry = entries[i];
+            if (isReporting)
+            {
+                for (const Issue& issue : entry.m_issues)
+                {
+                    path = m_path.Get();
+                    path += issue.m_path;
+                    GetReporter()(issue.m_message, issue.m_result, path);
+                }
+            }
+            isReporting = store(i, entry.m_result) && isReporting;
+        }
+    }
+
 
 
     //
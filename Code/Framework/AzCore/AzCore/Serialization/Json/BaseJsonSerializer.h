@@ -14,6 +14,8 @@
 #include <AzCore/Serialization/Json/JsonSerializationSettings.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/std/containers/stack.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
 
 namespace AZ
 {
@@ -101,7 +103,26 @@ namespace AZ
         //! Note that this does not apply to containers where elements have a fixed location such as smart pointers or AZStd::tuple.
         bool ShouldClearContainers() const;
 
+        //! Returns true if a container with the provided number of entries should load its entries with LoadInParallel.
+        bool ShouldLoadInParallel(size_t entryCount) const;
+
+        //! Loads an entry of a container. The provided context only needs to be used for that entry and its path is relative
+        //! to the path of the container.
+        using ParallelLoadFunction = AZStd::function<JsonSerializationResult::ResultCode(size_t index, JsonDeserializerContext& context)>;
+        //! Finishes loading an entry of a container, such as adding it to the container. This is called in order for every entry.
+        //! Return false to stop reporting any further issues, for instance because the load was halted. Entries after that still
+        //! get this call so they can be cleaned up.
+        using ParallelStoreFunction = AZStd::function<bool(size_t index, JsonSerializationResult::ResultCode result)>;
+        //! Calls load for all entries on the TaskExecutor, or in order if the TaskExecutor isn't active, and waits for them to
+        //! complete. Afterwards the issues an entry reported are passed to the reporter of this context, followed by a call to
+        //! store for that entry, so the order of reports is the same as when the entries are loaded one after the other.
+        void LoadInParallel(size_t entryCount, const ParallelLoadFunction& load, const ParallelStoreFunction& store);
+
     private:
+        // Creates a context for an entry that's loaded in parallel, which shares the metadata and contexts of the parent.
+        JsonDeserializerContext(JsonDeserializerContext& parent, JsonSerializationResult::JsonIssueCallback reporting);
+
+        size_t m_parallelLoadThreshold = 0;
         bool m_clearContainers = false;
     };
 
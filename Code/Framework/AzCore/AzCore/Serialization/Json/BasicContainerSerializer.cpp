@@ -7,6 +7,7 @@
  */
 
 #include <limits>
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/BasicContainerSerializer.h>
 #include <AzCore/Serialization/Json/JsonSerializationResult.h>
@@ -198,54 +199,127 @@ namespace AZ
             retVal.Combine(result);
         }
         rapidjson::SizeType arraySize = inputValue.Size();
-        for (rapidjson::SizeType i = 0; i < arraySize; ++i)
+        if ((classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER) && !container->IsFixedCapacity() &&
+            context.ShouldLoadInParallel(arraySize))
         {
-            ScopedContextPath subPath(context, i);
-
-            size_t expectedSize = container->Size(outputValue) + 1;
+            // The instances are loaded into separate storage so the container isn't touched until they're added in order.
+            AZStd::vector<void*> instances(arraySize, nullptr);
+            JSR::ResultCode haltedResult(JSR::Tasks::ReadField);
+            AZStd::string_view haltedMessage;
+            bool halted = false;
+            context.LoadInParallel(arraySize,
+                [this, &instances, &inputValue, classElement, flags](size_t index, JsonDeserializerContext& entryContext)
+                {
+                    ScopedContextPath subPath(entryContext, index);
+                    return ContinueLoading(&instances[index], classElement->m_typeId,
+                        inputValue[aznumeric_cast<rapidjson::SizeType>(index)], entryContext, flags);
+                },
+                [&instances, &retVal, &haltedResult, &haltedMessage, &halted, &context, outputValue, container, classElement](
+                    size_t index, JSR::ResultCode result)
+                {
+                    ScopedContextPath subPath(context, index);
 
-            if (expectedSize > capacity)
-            {
-                retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Skipped,
-                    "Unable to load more entries in basic container because it's full."));
-                break;
-            }
+                    size_t expectedSize = container->Size(outputValue) + 1;
+                    void* elementAddress = container->ReserveElement(outputValue, classElement);
+                    if (!elementAddress)
+                    {
+                        if (!halted)
+                        {
+                            halted = true;
+                            haltedResult = JSR::ResultCode(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic);
+                            haltedMessage = "Failed to allocate an item in the basic container.";
+                        }
+                        return false;
+                    }
+                    *reinterpret_cast<void**>(elementAddress) = instances[index];
 
-            void* elementAddress = container->ReserveElement(outputValue, classElement);
-            if (!elementAddress)
-            {
-                return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
-                    "Failed to allocate an item in the basic container.");
-            }
-            if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
-            {
-                *reinterpret_cast<void**>(elementAddress) = nullptr;
-            }
-            
-            JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, inputValue[i], context, flags);
-            if (result.GetProcessing() == JSR::Processing::Halted)
-            {
-                container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
-                return context.Report(retVal, "Failed to read element for basic container.");
-            }
-            else if (result.GetProcessing() == JSR::Processing::Altered)
+                    if (halted || result.GetProcessing() == JSR::Processing::Halted)
+                    {
+                        container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
+                        if (!halted)
+                        {
+                            halted = true;
+                            haltedResult = retVal;
+                            haltedMessage = "Failed to read element for basic container.";
+                        }
+                        return false;
+                    }
+                    else if (result.GetProcessing() == JSR::Processing::Altered)
+                    {
+                        container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
+                        retVal.Combine(result);
+                    }
+                    else
+                    {
+                        container->StoreElement(outputValue, elementAddress);
+                        if (container->Size(outputValue) != expectedSize)
+                        {
+                            retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
+                                "Unable to store element to basic container."));
+                        }
+                        else
+                        {
+                            retVal.Combine(result);
+                        }
+                    }
+                    return true;
+                });
+            if (halted)
             {
-                container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
-                retVal.Combine(result);
+                return context.Report(haltedResult, haltedMessage);
             }
-            else
+        }
+        else
+        {
+            for (rapidjson::SizeType i = 0; i < arraySize; ++i)
             {
-                container->StoreElement(outputValue, elementAddress);
-                if (container->Size(outputValue) != expectedSize)
+                ScopedContextPath subPath(context, i);
+
+                size_t expectedSize = container->Size(outputValue) + 1;
+
+                if (expectedSize > capacity)
                 {
-                    retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
-                        "Unable to store element to basic container."));
+                    retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Skipped,
+                        "Unable to load more entries in basic container because it's full."));
+                    break;
                 }
-                else
+
+                void* elementAddress = container->ReserveElement(outputValue, classElement);
+                if (!elementAddress)
+                {
+                    return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
+                        "Failed to allocate an item in the basic container.");
+                }
+                if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
                 {
+                    *reinterpret_cast<void**>(elementAddress) = nullptr;
+                }
+
+                JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, inputValue[i], context, flags);
+                if (result.GetProcessing() == JSR::Processing::Halted)
+                {
+                    container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
+                    return context.Report(retVal, "Failed to read element for basic container.");
+                }
+                else if (result.GetProcessing() == JSR::Processing::Altered)
+                {
+                    container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
                     retVal.Combine(result);
                 }
-            } 
+                else
+                {
+                    container->StoreElement(outputValue, elementAddress);
+                    if (container->Size(outputValue) != expectedSize)
+                    {
+                        retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
+                            "Unable to store element to basic container."));
+                    }
+                    else
+                    {
+                        retVal.Combine(result);
+                    }
+                } 
+            }
         }
 
         if (!retVal.HasDoneWork() && inputValue.Empty())
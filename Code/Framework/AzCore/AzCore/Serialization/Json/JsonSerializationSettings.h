@@ -36,6 +36,13 @@ namespace AZ
         //! any values in the container will be kept and not overwritten.
         //! Note that this does not apply to containers where elements have a fixed location such as smart pointers or AZStd::tuple.
         bool m_clearContainers = false;
+
+        //! If larger than zero, arrays of pointers and maps with at least this many entries load their entries concurrently on
+        //! the TaskExecutor. Containers inside those entries are loaded in order. Issues are still reported in document order,
+        //! but only after all entries of the container have been loaded, so the reporting callback can't change how an
+        //! individual entry is loaded. Only enable this for documents where the stored types can be loaded concurrently and
+        //! don't load from a task, as the load waits for the entries to complete.
+        size_t m_parallelLoadThreshold = 0;
     };
 
     //! Optional settings used while storing an object to a json value.
@@ -13,6 +13,7 @@
 #include <AzCore/Serialization/Json/MapSerializer.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string_view.h>
 
 namespace AZ
@@ -124,7 +125,19 @@ namespace AZ
             }
             retVal.Combine(result);
         }
-        if (inputValue.IsObject())
+        const rapidjson::SizeType entryCount = inputValue.IsObject() ? inputValue.MemberCount() : inputValue.Size();
+        if (containerSize == 0 && CanLoadElementsInParallel() && context.ShouldLoadInParallel(entryCount))
+        {
+            maximumSize = entryCount;
+            JSR::ResultCode result =
+                LoadElementsInParallel(outputValue, container, pairElement, pairContainer, keyElement, valueElement, inputValue, context);
+            if (result.GetProcessing() == JSR::Processing::Halted)
+            {
+                return context.Report(result, "Unable to load all entries for the associative container.");
+            }
+            retVal.Combine(result);
+        }
+        else if (inputValue.IsObject())
         {
             maximumSize = inputValue.MemberCount();
             // Don't early out here because an empty object is also considered a default object.
@@ -315,6 +328,202 @@ namespace AZ
         return context.Report(result, message);
     }
 
+    JsonSerializationResult::ResultCode JsonMapSerializer::LoadElementsInParallel(void* outputValue,
+        SerializeContext::IDataContainer* container, const SerializeContext::ClassElement* pairElement,
+        SerializeContext::IDataContainer* pairContainer, const SerializeContext::ClassElement* keyElement,
+        const SerializeContext::ClassElement* valueElement, const rapidjson::Value& inputValue, JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult;
+
+        struct Entry
+        {
+            const rapidjson::Value* m_key{ nullptr };
+            const rapidjson::Value* m_value{ nullptr };
+            AZStd::string_view m_name;
+            // Entries are reserved up front. Associative containers allocate reserved elements separately from the container, so
+            // they can be loaded independently from each other.
+            void* m_address{ nullptr };
+        };
+
+        const rapidjson::Value defaultValue(rapidjson::kObjectType);
+        AZStd::vector<Entry> entries;
+        if (inputValue.IsObject())
+        {
+            entries.reserve(inputValue.MemberCount());
+            for (auto& member : inputValue.GetObject())
+            {
+                Entry& entry = entries.emplace_back();
+                entry.m_name = AZStd::string_view(member.name.GetString(), member.name.GetStringLength());
+                entry.m_key = (entry.m_name == JsonSerialization::DefaultStringIdentifier) ? &defaultValue : &member.name;
+                entry.m_value = &member.value;
+            }
+        }
+        else
+        {
+            AZ_Assert(inputValue.IsArray(), "Maps can only be loaded from an object or an array.");
+            entries.reserve(inputValue.Size());
+            for (const rapidjson::Value& element : inputValue.GetArray())
+            {
+                Entry& entry = entries.emplace_back();
+                if (element.IsObject())
+                {
+                    const rapidjson::Value::ConstMemberIterator keyMember = element.FindMember(JsonSerialization::KeyFieldIdentifier);
+                    const rapidjson::Value::ConstMemberIterator valueMember = element.FindMember(JsonSerialization::ValueFieldIdentifier);
+                    entry.m_key = (keyMember != element.MemberEnd()) ? &keyMember->value : &defaultValue;
+                    entry.m_value = (valueMember != element.MemberEnd()) ? &valueMember->value : &defaultValue;
+                }
+            }
+        }
+
+        for (Entry& entry : entries)
+        {
+            if (entry.m_key)
+            {
+                entry.m_address = container->ReserveElement(outputValue, pairElement);
+                if (!entry.m_address)
+                {
+                    for (Entry& reservedEntry : entries)
+                    {
+                        if (reservedEntry.m_address)
+                        {
+                            container->FreeReservedElement(outputValue, reservedEntry.m_address, context.GetSerializeContext());
+                        }
+                    }
+                    return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
+                        "Failed to allocate an item for an associative container.");
+                }
+            }
+        }
+
+        auto pushPath = [&entries, &inputValue](JsonDeserializerContext& pathContext, size_t index)
+        {
+            if (inputValue.IsObject())
+            {
+                pathContext.PushPath(entries[index].m_name);
+            }
+            else
+            {
+                pathContext.PushPath(index);
+            }
+        };
+
+        auto loadEntry = [this, pairElement, pairContainer, keyElement, valueElement](
+            const Entry& entry, JsonDeserializerContext& entryContext) -> JSR::ResultCode
+        {
+            if (!entry.m_address)
+            {
+                return entryContext.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unsupported, AZStd::string::format(
+                    R"(Unsupported type for elements in an associative container. If the array for is used, an object with "%s" and "%s" is expected)",
+                    JsonSerialization::KeyFieldIdentifier, JsonSerialization::ValueFieldIdentifier));
+            }
+
+            void* keyAddress = pairContainer->GetElementByIndex(entry.m_address, pairElement, 0);
+            AZ_Assert(keyAddress, "Element reserved for associative container, but unable to retrieve address of the key.");
+            ContinuationFlags keyLoadFlags = ContinuationFlags::LoadAsNewInstance;
+            if (keyElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+            {
+                keyLoadFlags |= ContinuationFlags::ResolvePointer;
+                *reinterpret_cast<void**>(keyAddress) = nullptr;
+            }
+            JSR::ResultCode keyResult = ContinueLoading(keyAddress, keyElement->m_typeId, *entry.m_key, entryContext, keyLoadFlags);
+            if (keyResult.GetProcessing() == JSR::Processing::Halted)
+            {
+                return entryContext.Report(keyResult, "Failed to read key for associative container.");
+            }
+
+            void* valueAddress = pairContainer->GetElementByIndex(entry.m_address, pairElement, 1);
+            AZ_Assert(valueAddress, "Element reserved for associative container, but unable to retrieve address of the value.");
+            ContinuationFlags valueLoadFlags = ContinuationFlags::LoadAsNewInstance;
+            if (valueElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+            {
+                valueLoadFlags |= ContinuationFlags::ResolvePointer;
+                *reinterpret_cast<void**>(valueAddress) = nullptr;
+            }
+            JSR::ResultCode valueResult = ContinueLoading(valueAddress, valueElement->m_typeId, *entry.m_value, entryContext, valueLoadFlags);
+            if (valueResult.GetProcessing() == JSR::Processing::Halted)
+            {
+                return entryContext.Report(valueResult, "Failed to read value for associative container.");
+            }
+            return JSR::ResultCode::Combine(keyResult, valueResult);
+        };
+
+        JSR::ResultCode retVal(JSR::Tasks::ReadField);
+        bool halted = false;
+        context.LoadInParallel(entries.size(),
+            [&entries, &pushPath, &loadEntry](size_t index, JsonDeserializerContext& entryContext)
+            {
+                pushPath(entryContext, index);
+                JSR::ResultCode result = loadEntry(entries[index], entryContext);
+                entryContext.PopPath();
+                return result;
+            },
+            [&entries, &pushPath, &retVal, &halted, &context, outputValue, container, pairElement, pairContainer, keyElement](
+                size_t index, JSR::ResultCode result)
+            {
+                Entry& entry = entries[index];
+                if (halted || result.GetProcessing() == JSR::Processing::Halted)
+                {
+                    if (entry.m_address)
+                    {
+                        container->FreeReservedElement(outputValue, entry.m_address, context.GetSerializeContext());
+                    }
+                    if (!halted)
+                    {
+                        halted = true;
+                        retVal = result;
+                    }
+                    return false;
+                }
+                if (!entry.m_address)
+                {
+                    retVal.Combine(result);
+                    return true;
+                }
+
+                pushPath(context, index);
+                if (result.GetProcessing() == JSR::Processing::Altered)
+                {
+                    container->FreeReservedElement(outputValue, entry.m_address, context.GetSerializeContext());
+                    retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
+                        "Unable to fully process an element for the associative container."));
+                }
+                else
+                {
+                    // The container started out empty, so a key can only exist if the document has the same key multiple times.
+                    // In that case the last entry replaces the earlier ones.
+                    void* keyAddress = pairContainer->GetElementByIndex(entry.m_address, pairElement, 0);
+                    void* existingKeyValuePair =
+                        container->GetAssociativeContainerInterface()->GetElementByKey(outputValue, keyElement, keyAddress);
+                    if (existingKeyValuePair)
+                    {
+                        container->RemoveElement(outputValue, existingKeyValuePair, context.GetSerializeContext());
+                    }
+
+                    size_t expectedSize = container->Size(outputValue) + 1;
+                    container->StoreElement(outputValue, entry.m_address);
+                    if (container->Size(outputValue) != expectedSize)
+                    {
+                        retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
+                            "Unable to store the element that was read to the associative container."));
+                    }
+                    else
+                    {
+                        retVal.Combine(context.Report(result, result.GetProcessing() == JSR::Processing::Completed
+                            ? "Successfully loaded an entry into the associative container."
+                            : "Partially loaded an entry into the associative container."));
+                    }
+                }
+                context.PopPath();
+                return true;
+            });
+        return retVal;
+    }
+
+    bool JsonMapSerializer::CanLoadElementsInParallel() const
+    {
+        return true;
+    }
+
     JsonSerializationResult::Result JsonMapSerializer::Store(rapidjson::Value& outputValue, const void* inputValue, const void* defaultValue,
         const Uuid& valueTypeId, JsonSerializerContext& context, bool sortResult)
     {
@@ -510,6 +719,12 @@ namespace AZ
         }
     }
 
+    bool JsonUnorderedMultiMapSerializer::CanLoadElementsInParallel() const
+    {
+        // Entries in multi-maps can hold multiple values, which LoadElement adds one at a time.
+        return false;
+    }
+
     JsonSerializationResult::Result JsonUnorderedMultiMapSerializer::Store(rapidjson::Value& outputValue, const void* inputValue,
         const void* defaultValue, const Uuid& valueTypeId, JsonSerializerContext& context)
     {
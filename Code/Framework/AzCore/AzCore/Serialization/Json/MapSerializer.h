@@ -33,6 +33,14 @@ namespace AZ
             const SerializeContext::ClassElement* pairElement, SerializeContext::IDataContainer* pairContainer, 
             const SerializeContext::ClassElement* keyElement, const SerializeContext::ClassElement* valueElement, 
             const rapidjson::Value& key, const rapidjson::Value& value, JsonDeserializerContext& context, bool isMultiMap = false);
+        //! Loads all entries in the json object or array on the TaskExecutor and adds them to the container in document order.
+        //! This is used instead of LoadElement for containers that are empty and large enough to load in parallel.
+        virtual JsonSerializationResult::ResultCode LoadElementsInParallel(void* outputValue, SerializeContext::IDataContainer* container,
+            const SerializeContext::ClassElement* pairElement, SerializeContext::IDataContainer* pairContainer,
+            const SerializeContext::ClassElement* keyElement, const SerializeContext::ClassElement* valueElement,
+            const rapidjson::Value& inputValue, JsonDeserializerContext& context);
+        //! When this function returns true the entries of large maps can be loaded with LoadElementsInParallel.
+        virtual bool CanLoadElementsInParallel() const;
         
         virtual JsonSerializationResult::Result Store(rapidjson::Value& outputValue, const void* inputValue, const void* defaultValue,
             const Uuid& valueTypeId, JsonSerializerContext& context, bool sortResult);
@@ -67,6 +75,7 @@ namespace AZ
             const SerializeContext::ClassElement* pairElement, SerializeContext::IDataContainer* pairContainer,
             const SerializeContext::ClassElement* keyElement, const SerializeContext::ClassElement* valueElement,
             const rapidjson::Value& key, const rapidjson::Value& value, JsonDeserializerContext& context, bool isMultiMap = false) override;
+        bool CanLoadElementsInParallel() const override;
 
         using JsonMapSerializer::Store;
         JsonSerializationResult::Result Store(rapidjson::Value& outputValue, const void* inputValue, const void* defaultValue,
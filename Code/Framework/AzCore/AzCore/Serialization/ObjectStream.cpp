@@ -50,6 +50,8 @@
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/osstring.h>
 
 namespace AZ
@@ -187,6 +189,28 @@ namespace AZ
             StorageAddressResult GetElementStorageAddress(StorageAddressElement& storageAddressElement, const SerializeContext::ClassElement* classElement, const SerializeContext::DataElement& dataElement,
                 const SerializeContext::ClassData* dataElementClassData, void* parentClassPtr);
 
+            /// Entry in the load plan of a class. See FILTERFLAG_USE_LOAD_PLANS.
+            struct LoadPlanElement
+            {
+                u32 m_nameCrc{ 0 };
+                const SerializeContext::ClassElement* m_classElement{ nullptr };
+                /// Type id of the last stored element that was matched to m_classElement. Stored elements with this type can
+                /// use m_classElement directly without repeating the type checks.
+                Uuid m_matchedTypeId{ Uuid::CreateNull() };
+            };
+            /// Load plan of a class, sorted by name crc.
+            using LoadPlan = AZStd::vector<LoadPlanElement>;
+
+            bool UseLoadPlans() const;
+            /// Returns the load plan entry for the element with the provided name crc in the class, or nullptr if the class
+            /// has no element with that name. The plan is built the first time the class is seen.
+            LoadPlanElement* FindLoadPlanElement(const SerializeContext::ClassData& classData, u32 nameCrc);
+            /// Consumes the end tag of the element that was just read if the element has no child elements. Returns false
+            /// if there are child elements, in which case the flags that were read are kept for the next call to ReadElement.
+            bool TryReadElementEnd();
+            /// Reads the flags of the next binary element, or returns the flags that were already read by TryReadElementEnd.
+            IO::SizeType ReadBinaryFlags(u8& flagsSize);
+
             /// finalizes the stream after the user is done submitting his writes
             bool Finalize() override;
 
@@ -202,6 +226,10 @@ namespace AZ
             InplaceLoadRootInfoCB               m_inplaceLoadInfoCB;
             unsigned int                        m_version;
             SerializeContext::ErrorHandler      m_errorLogger;
+            AZStd::unordered_map<const SerializeContext::ClassData*, LoadPlan> m_loadPlans;
+            // Input streams can't always seek backwards, so flags read ahead by TryReadElementEnd are stored here.
+            u8                                  m_peekedFlags{ 0 };
+            bool                                m_hasPeekedFlags{ false };
             AZStd::atomic_int                   m_pending;
 
             // used for xml streams
@@ -618,7 +646,15 @@ namespace AZ
                     }
                     else
                     {
-                        for (size_t i = 0; i < parentClassInfo->m_elements.size(); ++i)
+                        // Stored elements that have been matched before in this stream can use the matching class element directly.
+                        LoadPlanElement* plannedElement =
+                            UseLoadPlans() && !isConvertedData ? FindLoadPlanElement(*parentClassInfo, element.m_nameCrc) : nullptr;
+                        if (plannedElement && plannedElement->m_matchedTypeId == element.m_id)
+                        {
+                            classElement = plannedElement->m_classElement;
+                        }
+
+                        for (size_t i = 0; classElement == nullptr && i < parentClassInfo->m_elements.size(); ++i)
                         {
                             const SerializeContext::ClassElement* childElement = &parentClassInfo->m_elements[i];
                             if (childElement->m_nameCrc == element.m_nameCrc)
@@ -680,6 +716,11 @@ namespace AZ
                             }
                         }
 
+                        if (plannedElement && classElement)
+                        {
+                            plannedElement->m_matchedTypeId = element.m_id;
+                        }
+
                         // If we can't resolve classElement while looking into members of a containing class, issue a warning.
                         // We can continue safely, but this constitutes loss of old data that users should be aware of.
                         if (classElement == nullptr)
@@ -841,8 +882,14 @@ namespace AZ
                     classData->m_container->ClearElements(dataAddress, m_sc);
                 }
 
-                // Read child nodes
-                result = LoadClass(stream, *convertedNode, classData, dataAddress, flags) && result;
+                // Read child nodes. Values that are loaded by a serializer rarely have child nodes, in which case only the end
+                // tag needs to be read.
+                const bool isLeafValue = UseLoadPlans() && !isConvertedData && convertedNode->m_classData == nullptr &&
+                    classData->m_serializer && classData->m_elements.empty() && !classData->m_container;
+                if (!isLeafValue || !TryReadElementEnd())
+                {
+                    result = LoadClass(stream, *convertedNode, classData, dataAddress, flags) && result;
+                }
 
                 if (classContainer)
                 {
@@ -1286,7 +1333,7 @@ namespace AZ
             }
             else /*ST_BINARY*/
             {
-                if (m_stream->GetCurPos() == m_stream->GetLength())
+                if (!m_hasPeekedFlags && m_stream->GetCurPos() == m_stream->GetLength())
                 {
                     // Reached the end of the stream. We may reach this state if we just skipped the root element
                     return false;
@@ -1294,7 +1341,7 @@ namespace AZ
 
                 // Read flags
                 u8 flagsSize = 0;
-                IO::SizeType nBytesRead = m_stream->Read(sizeof(u8), &flagsSize);
+                IO::SizeType nBytesRead = ReadBinaryFlags(flagsSize);
                 AZ_Assert(nBytesRead == sizeof(u8), "Failed trying to read binary element tag!");
                 (void)nBytesRead;
                 if (flagsSize == ST_BINARYFLAG_ELEMENT_END)
@@ -1421,6 +1468,71 @@ namespace AZ
             return true;
         }
 
+        bool ObjectStreamImpl::UseLoadPlans() const
+        {
+            return (m_filterDesc.m_flags & FILTERFLAG_USE_LOAD_PLANS) != 0 && GetType() == ST_BINARY;
+        }
+
+        ObjectStreamImpl::LoadPlanElement* ObjectStreamImpl::FindLoadPlanElement(const SerializeContext::ClassData& classData, u32 nameCrc)
+        {
+            auto [planIt, inserted] = m_loadPlans.try_emplace(&classData);
+            LoadPlan& plan = planIt->second;
+            if (inserted)
+            {
+                plan.reserve(classData.m_elements.size());
+                for (const SerializeContext::ClassElement& classElement : classData.m_elements)
+                {
+                    // Only the first element with a name is used when searching linearly, so the same is done here.
+                    auto it = AZStd::find_if(plan.begin(), plan.end(),
+                        [&classElement](const LoadPlanElement& entry) { return entry.m_nameCrc == classElement.m_nameCrc; });
+                    if (it == plan.end())
+                    {
+                        plan.push_back({ classElement.m_nameCrc, &classElement });
+                    }
+                }
+                AZStd::sort(plan.begin(), plan.end(),
+                    [](const LoadPlanElement& lhs, const LoadPlanElement& rhs) { return lhs.m_nameCrc < rhs.m_nameCrc; });
+            }
+
+            auto it = AZStd::lower_bound(plan.begin(), plan.end(), nameCrc,
+                [](const LoadPlanElement& entry, u32 crc) { return entry.m_nameCrc < crc; });
+            return it != plan.end() && it->m_nameCrc == nameCrc ? &*it : nullptr;
+        }
+
+        bool ObjectStreamImpl::TryReadElementEnd()
+        {
+            AZ_Assert(!m_hasPeekedFlags, "Element flags were read ahead twice.");
+            if (m_stream->GetCurPos() == m_stream->GetLength())
+            {
+                return true;
+            }
+
+            u8 flagsSize = 0;
+            if (m_stream->Read(sizeof(u8), &flagsSize) != sizeof(u8))
+            {
+                return true;
+            }
+            if (flagsSize == ST_BINARYFLAG_ELEMENT_END)
+            {
+                return true;
+            }
+
+            m_peekedFlags = flagsSize;
+            m_hasPeekedFlags = true;
+            return false;
+        }
+
+        IO::SizeType ObjectStreamImpl::ReadBinaryFlags(u8& flagsSize)
+        {
+            if (m_hasPeekedFlags)
+            {
+                flagsSize = m_peekedFlags;
+                m_hasPeekedFlags = false;
+                return sizeof(u8);
+            }
+            return m_stream->Read(sizeof(u8), &flagsSize);
+        }
+
         //=========================================================================
         // SkipElement
         // [1/19/2013]
@@ -1434,7 +1546,7 @@ namespace AZ
                 {
                     // Read flags
                     u8 flagsSize = 0;
-                    IO::SizeType nBytesRead = m_stream->Read(sizeof(u8), &flagsSize);
+                    IO::SizeType nBytesRead = ReadBinaryFlags(flagsSize);
                     AZ_Assert(nBytesRead == sizeof(u8), "Failed trying to read binary element tag!");
                     (void)nBytesRead;
                     if (flagsSize == ST_BINARYFLAG_ELEMENT_END)
@@ -145,6 +145,15 @@ namespace AZ
             * this is only to be rarely used, when reading data you know contains classes that you want to ignore silently, not for ignoring errors in general.
             */ 
             FILTERFLAG_IGNORE_UNKNOWN_CLASSES   = 1 << 1, 
+
+            /**
+            * If FILTERFLAG_USE_LOAD_PLANS is set, binary streams build a load plan for every class the first time it's loaded from the stream
+            * and reuse it for all following instances. The plan maps the name crcs of the stored elements directly to the reflected class
+            * elements and remembers which stored types were already verified against the reflected types, so repeated instances skip the
+            * per element search and type checks. Values without child elements are read directly without descending into them.
+            * This has no effect on the loaded data, only on the time it takes to load it, and is ignored for xml and json streams.
+            */
+            FILTERFLAG_USE_LOAD_PLANS           = 1 << 2,
             
         };
 
@@ -17,7 +17,9 @@
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
 #include <AzCore/std/ranges/split_view.h>
 
@@ -990,8 +992,7 @@ namespace AZ
                 return false;
             }
 
-            // Load the registry files in the sorted order.
-            for (RegistryFile& registryFile : fileList)
+            auto GetRegistryFilePath = [&folderPath, platformKeyOffset, platform](const RegistryFile& registryFile) -> const char*
             {
                 folderPath.Native().erase(platformKeyOffset); // Erase all characters after the platformKeyOffset
                 if (registryFile.m_isPlatformFile)
@@ -1001,16 +1002,72 @@ namespace AZ
                 }
 
                 folderPath /= registryFile.m_relativePath;
+                return folderPath.c_str();
+            };
+
+            const size_t numThreads = AZStd::min(
+                aznumeric_cast<size_t>(AZStd::max(AZStd::thread::hardware_concurrency(), 1u)), fileList.size() / MinFilesPerParseThread);
+            if (numThreads > 1)
+            {
+                // Reading and parsing the files is independent per file, so it's spread over a few short lived threads, as the
+                // registry is merged before the job and task systems are running. Only merging has to happen in the sorted order.
+                AZStd::vector<AZ::IO::FixedMaxPath> filePaths;
+                filePaths.reserve(fileList.size());
+                for (const RegistryFile& registryFile : fileList)
+                {
+                    filePaths.emplace_back(GetRegistryFilePath(registryFile));
+                }
+
+                AZStd::vector<ParsedSettingsFile> parsedFiles(fileList.size());
+                AZStd::atomic<size_t> nextFile{ 0 };
+                auto parseWorker = [this, &filePaths, &parsedFiles, &nextFile]()
+                {
+                    for (size_t index = nextFile++; index < parsedFiles.size(); index = nextFile++)
+                    {
+                        ParseSettingsFile(parsedFiles[index], filePaths[index].c_str(), parsedFiles[index].m_buffer);
+                    }
+                };
+
+                AZStd::thread_desc threadDesc;
+                threadDesc.m_name = "Settings Registry parse files";
+                AZStd::vector<AZStd::thread> threads;
+                // the calling thread takes part as well
+                threads.reserve(numThreads - 1);
+                for (size_t i = 1; i < numThreads; ++i)
+                {
+                    threads.emplace_back(threadDesc, parseWorker);
+                }
+                parseWorker();
+                for (AZStd::thread& thread : threads)
+                {
+                    thread.join();
+                }
 
-                if (!registryFile.m_isPatch)
+                // Merge the registry files in the sorted order.
+                for (size_t i = 0; i < fileList.size(); ++i)
                 {
-                    MergeSettingsFileInternal(folderPath.c_str(), Format::JsonMergePatch, rootKey, *scratchBuffer);
+                    MergeParsedSettingsFile(parsedFiles[i], filePaths[i].c_str(),
+                        fileList[i].m_isPatch ? Format::JsonPatch : Format::JsonMergePatch, rootKey);
+                    // Release the memory of each file once it's merged.
+                    parsedFiles[i] = {};
                 }
-                else
+            }
+            else
+            {
+                // Load the registry files in the sorted order.
+                for (RegistryFile& registryFile : fileList)
                 {
-                    MergeSettingsFileInternal(folderPath.c_str(), Format::JsonPatch, rootKey, *scratchBuffer);
+                    const char* filePath = GetRegistryFilePath(registryFile);
+                    if (!registryFile.m_isPatch)
+                    {
+                        MergeSettingsFileInternal(filePath, Format::JsonMergePatch, rootKey, *scratchBuffer);
+                    }
+                    else
+                    {
+                        MergeSettingsFileInternal(filePath, Format::JsonPatch, rootKey, *scratchBuffer);
+                    }
+                    scratchBuffer->clear();
                 }
-                scratchBuffer->clear();
             }
         }
         return true;
@@ -1318,45 +1375,75 @@ namespace AZ
     AZ::Outcome<void, AZStd::string>  SettingsRegistryImpl::MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey,
         AZStd::vector<char>& scratchBuffer)
     {
-        using namespace AZ::IO;
-        using namespace rapidjson;
+        ParsedSettingsFile parsedFile;
+        ParseSettingsFile(parsedFile, path, scratchBuffer);
+        return MergeParsedSettingsFile(parsedFile, path, format, rootKey);
+    }
 
-        Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
+    void SettingsRegistryImpl::ParseSettingsFile(ParsedSettingsFile& output, const char* path, AZStd::vector<char>& buffer) const
+    {
+        using namespace AZ::IO;
 
         FileReader fileReader(m_useFileIo ? AZ::IO::FileIOBase::GetInstance() : nullptr, path);
         if (!fileReader.IsOpen())
         {
-            pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
-                .AddMember(StringRef("Error"), StringRef("Unable to open registry file."), m_settings.GetAllocator())
-                .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
-            return AZ::Failure(AZStd::string::format(R"(Unable to open registry file "%s".)", path));
+            output.m_result = ParsedSettingsFile::Result::UnableToOpen;
+            return;
         }
 
         u64 fileSize = fileReader.Length();
         if (fileSize == 0)
         {
+            output.m_result = ParsedSettingsFile::Result::EmptyFile;
+            return;
+        }
+
+        buffer.clear();
+        buffer.resize_no_construct(fileSize + 1);
+        if (fileReader.Read(fileSize, buffer.data()) != fileSize)
+        {
+            output.m_result = ParsedSettingsFile::Result::UnableToRead;
+            return;
+        }
+        buffer[fileSize] = 0;
+
+        constexpr int flags = rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag;
+        output.m_document.ParseInsitu<flags>(buffer.data());
+        output.m_result = output.m_document.HasParseError() ? ParsedSettingsFile::Result::InvalidJson : ParsedSettingsFile::Result::Parsed;
+    }
+
+    AZ::Outcome<void, AZStd::string> SettingsRegistryImpl::MergeParsedSettingsFile(
+        ParsedSettingsFile& parsedFile, const char* path, Format format, AZStd::string_view rootKey)
+    {
+        using namespace AZ::IO;
+        using namespace rapidjson;
+
+        Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
+
+        switch (parsedFile.m_result)
+        {
+        case ParsedSettingsFile::Result::UnableToOpen:
+            pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
+                .AddMember(StringRef("Error"), StringRef("Unable to open registry file."), m_settings.GetAllocator())
+                .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
+            return AZ::Failure(AZStd::string::format(R"(Unable to open registry file "%s".)", path));
+        case ParsedSettingsFile::Result::EmptyFile:
             pointer.Create(m_settings, m_settings.GetAllocator())
                 .SetObject()
                 .AddMember(StringRef("Error"), StringRef("registry file is 0 bytes."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
             return AZ::Failure(AZStd::string::format(R"(Registry file "%s" is 0 bytes in length. There is no nothing to merge)", path));
-        }
-
-        scratchBuffer.clear();
-        scratchBuffer.resize_no_construct(fileSize + 1);
-        if (fileReader.Read(fileSize, scratchBuffer.data()) != fileSize)
-        {
+        case ParsedSettingsFile::Result::UnableToRead:
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Unable to read registry file."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
             return AZ::Failure(AZStd::string::format(R"(Unable to read registry file "%s".)", path));
+        default:
+            break;
         }
-        scratchBuffer[fileSize] = 0;
 
-        rapidjson::Document jsonPatch;
-        constexpr int flags = rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag;
-        jsonPatch.ParseInsitu<flags>(scratchBuffer.data());
-        if (jsonPatch.HasParseError())
+        rapidjson::Document& jsonPatch = parsedFile.m_document;
+        if (parsedFile.m_result == ParsedSettingsFile::Result::InvalidJson)
         {
             AZ::Outcome<void, AZStd::string> result;
             auto nativeUI = AZ::Interface<NativeUI::NativeUIRequests>::Get();
@@ -34,6 +34,8 @@ namespace AZ
         AZ_RTTI(AZ::SettingsRegistryImpl, "{E9C34190-F888-48CA-83C9-9F24B4E21D72}", AZ::SettingsRegistryInterface);
 
         static constexpr size_t MaxRegistryFolderEntries = 128;
+        //! The files in a registry folder are parsed on several threads when there are at least this many files per thread.
+        static constexpr size_t MinFilesPerParseThread = 4;
         
         SettingsRegistryImpl();
         //! @param useFileIo - If true attempt to redirect
@@ -116,6 +118,30 @@ namespace AZ
         bool ExtractFileDescription(RegistryFile& output, AZStd::string_view filename, const Specializations& specializations);
         AZ::Outcome<void, AZStd::string> MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey, AZStd::vector<char>& scratchBuffer);
 
+        //! A registry file that has been read and parsed, but not yet merged into the registry.
+        struct ParsedSettingsFile
+        {
+            enum class Result
+            {
+                Parsed,
+                UnableToOpen,
+                EmptyFile,
+                UnableToRead,
+                InvalidJson
+            };
+
+            Result m_result{ Result::UnableToOpen };
+            //! Only used when parsing several files at once, as the parsed document refers to the strings in the buffer.
+            AZStd::vector<char> m_buffer;
+            rapidjson::Document m_document;
+        };
+        //! Reads and parses a registry file into the buffer. This doesn't touch the registry, so several files can be parsed at
+        //! the same time.
+        void ParseSettingsFile(ParsedSettingsFile& output, const char* path, AZStd::vector<char>& buffer) const;
+        //! Merges a parsed registry file, or records why it couldn't be parsed.
+        AZ::Outcome<void, AZStd::string> MergeParsedSettingsFile(
+            ParsedSettingsFile& parsedFile, const char* path, Format format, AZStd::string_view rootKey);
+
         void SignalNotifier(AZStd::string_view jsonPath, SettingsType type);
 
         //! Locks the m_settingMutex but also checks to make sure that someone is not currently
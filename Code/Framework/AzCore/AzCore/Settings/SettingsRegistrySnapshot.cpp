@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Platform.h>
+#include <AzCore/Serialization/InPlaceData.h>
+#include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
+#include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::SettingsRegistrySnapshot
+{
+    namespace
+    {
+        struct SnapshotInput
+        {
+            //! Zero if the input doesn't exist.
+            u64 m_modificationTime;
+            //! The size of a file, or a hash of the names of the entries in a folder.
+            u64 m_size;
+            u64 m_pathOffset;
+            u32 m_pathLength;
+            u32 m_isFolder;
+        };
+
+        struct SnapshotData
+        {
+            AZ_TYPE_INFO(SnapshotData, "{3A0F6C4B-8E2D-4F71-9B57-C1D8A6E4F203}");
+
+            InPlaceData::Array<char> m_inputKey;
+            InPlaceData::Array<SnapshotInput> m_inputs;
+            //! The paths of all inputs, referred to by their offset and length.
+            InPlaceData::Array<char> m_paths;
+            //! All settings as a json patch that replaces the root of the registry.
+            InPlaceData::Array<char> m_settings;
+        };
+
+        // Opening the array with a single "add" to the root keeps null values, which a merge patch would remove.
+        constexpr AZStd::string_view SettingsPrefix = R"([{"op":"add","path":"","value":)";
+        constexpr AZStd::string_view SettingsPostfix = "}]";
+
+        SnapshotInput GetInputState(const char* path, bool isFolder)
+        {
+            SnapshotInput input{};
+            input.m_isFolder = isFolder;
+            if (!IO::SystemFile::Exists(path))
+            {
+                return input;
+            }
+
+            input.m_modificationTime = IO::SystemFile::ModificationTime(path);
+            if (!isFolder)
+            {
+                input.m_size = IO::SystemFile::Length(path);
+                return input;
+            }
+
+            // Not all platforms report modification times of folders, so also track which entries are in the folder to
+            // detect added or removed registry files. The entries are reported in no particular order, so the hashes of
+            // their names are added up.
+            size_t entryCount = 0;
+            size_t entryHashSum = 0;
+            IO::SystemFile::FindFiles((IO::FixedMaxPath(path) / "*").c_str(),
+                [&entryCount, &entryHashSum](const char* fileName, bool)
+                {
+                    const AZStd::string_view name(fileName);
+                    if (name != "." && name != "..")
+                    {
+                        ++entryCount;
+                        entryHashSum += AZStd::hash<AZStd::string_view>{}(name);
+                    }
+                    return true;
+                });
+            size_t listingHash = entryCount;
+            AZStd::hash_combine(listingHash, entryHashSum);
+            input.m_size = listingHash;
+            return input;
+        }
+
+        void CollectInputs(SettingsRegistryInterface& registry, AZStd::vector<AZStd::pair<AZStd::string, bool>>& inputs)
+        {
+            auto AddFolder = [&inputs](AZStd::string_view folder)
+            {
+                inputs.emplace_back(folder, true);
+
+                // Platform specific files are in a folder per platform. The history doesn't record which platform was used,
+                // so all of them are tracked.
+                IO::FixedMaxPath platformFolder(folder);
+                platformFolder /= SettingsRegistryInterface::PlatformFolder;
+                inputs.emplace_back(platformFolder.Native(), true);
+                IO::SystemFile::FindFiles((platformFolder / "*").c_str(),
+                    [&inputs, &platformFolder](const char* fileName, bool isFile)
+                    {
+                        const AZStd::string_view name(fileName);
+                        if (!isFile && name != "." && name != "..")
+                        {
+                            inputs.emplace_back((platformFolder / name).Native(), true);
+                        }
+                        return true;
+                    });
+            };
+
+            // The file history contains the paths of merged files, objects for merged folders and objects for errors. Files
+            // that failed to merge are recorded as well, so fixing them invalidates the snapshot.
+            auto CollectInput = [&registry, &inputs, &AddFolder](const SettingsRegistryInterface::VisitArgs& visitArgs)
+            {
+                AZStd::string path;
+                if (visitArgs.m_type.m_type == SettingsRegistryInterface::Type::String)
+                {
+                    if (registry.Get(path, visitArgs.m_jsonKeyPath))
+                    {
+                        inputs.emplace_back(AZStd::move(path), false);
+                    }
+                }
+                else if (visitArgs.m_type.m_type == SettingsRegistryInterface::Type::Object)
+                {
+                    SettingsRegistryInterface::FixedValueString key(visitArgs.m_jsonKeyPath);
+                    const size_t keyLength = key.size();
+                    key += "/Folder";
+                    if (registry.Get(path, key))
+                    {
+                        // Folders are recorded with a "/*" wildcard appended.
+                        AZStd::string_view folder(path);
+                        if (folder.ends_with("/*"))
+                        {
+                            folder.remove_suffix(2);
+                        }
+                        AddFolder(folder);
+                        return SettingsRegistryInterface::VisitResponse::Continue;
+                    }
+
+                    key.erase(keyLength);
+                    key += "/Path";
+                    if (registry.Get(path, key))
+                    {
+                        inputs.emplace_back(AZStd::move(path), false);
+                    }
+                }
+                return SettingsRegistryInterface::VisitResponse::Continue;
+            };
+            SettingsRegistryVisitorUtils::VisitArray(registry, CollectInput, AZ_SETTINGS_REGISTRY_HISTORY_KEY);
+
+            AZStd::sort(inputs.begin(), inputs.end());
+            inputs.erase(AZStd::unique(inputs.begin(), inputs.end()), inputs.end());
+        }
+    } // namespace
+
+    bool Save(SettingsRegistryInterface& registry, const char* snapshotPath, AZStd::string_view inputKey)
+    {
+        AZStd::vector<AZStd::pair<AZStd::string, bool>> inputPaths;
+        CollectInputs(registry, inputPaths);
+
+        AZStd::string paths;
+        AZStd::vector<SnapshotInput> inputs;
+        inputs.reserve(inputPaths.size());
+        for (const auto& [path, isFolder] : inputPaths)
+        {
+            SnapshotInput& input = inputs.emplace_back(GetInputState(path.c_str(), isFolder));
+            input.m_pathOffset = paths.size();
+            input.m_pathLength = aznumeric_cast<u32>(path.size());
+            paths += path;
+        }
+
+        AZStd::string settings(SettingsPrefix);
+        IO::ByteContainerStream<AZStd::string> settingsStream(&settings);
+        settingsStream.Seek(0, IO::GenericStream::ST_SEEK_END);
+        if (!SettingsRegistryMergeUtils::DumpSettingsRegistryToStream(registry, "", settingsStream, {}))
+        {
+            AZ_Error("Settings Registry", false, "Unable to store the settings for snapshot '%s'.", snapshotPath);
+            return false;
+        }
+        settings += SettingsPostfix;
+
+        InPlaceData::Builder builder;
+        const size_t rootOffset = builder.Add(SnapshotData{});
+        builder.SetArray(rootOffset + offsetof(SnapshotData, m_inputKey), AZStd::span<const char>(inputKey.data(), inputKey.size()));
+        builder.SetArray(rootOffset + offsetof(SnapshotData, m_inputs), AZStd::span<const SnapshotInput>(inputs));
+        builder.SetArray(rootOffset + offsetof(SnapshotData, m_paths), AZStd::span<const char>(paths.data(), paths.size()));
+        builder.SetArray(rootOffset + offsetof(SnapshotData, m_settings), AZStd::span<const char>(settings.data(), settings.size()));
+        const AZStd::vector<u8> data = builder.Finish<SnapshotData>(rootOffset);
+
+        // Write to a temporary file first so other processes never map a partially written snapshot.
+        const auto tempPath = IO::FixedMaxPathString::format("%s.%u.tmp", snapshotPath, AZ::Platform::GetCurrentProcessId());
+        IO::SystemFile file;
+        if (!file.Open(tempPath.c_str(),
+                IO::SystemFile::SF_OPEN_CREATE | IO::SystemFile::SF_OPEN_CREATE_PATH | IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Error("Settings Registry", false, "Unable to open '%s' to write the settings registry snapshot.", tempPath.c_str());
+            return false;
+        }
+        const bool written = file.Write(data.data(), data.size()) == data.size();
+        file.Close();
+
+        if (!written || !IO::SystemFile::Rename(tempPath.c_str(), snapshotPath, true))
+        {
+            AZ_Error("Settings Registry", false, "Unable to write the settings registry snapshot '%s'.", snapshotPath);
+            IO::SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool Load(SettingsRegistryInterface& registry, const char* snapshotPath, AZStd::string_view inputKey)
+    {
+        if (!IO::SystemFile::Exists(snapshotPath))
+        {
+            return false;
+        }
+
+        InPlaceData::Blob blob;
+        if (!blob.Map(snapshotPath))
+        {
+            return false;
+        }
+
+        const SnapshotData* snapshot = blob.GetRoot<SnapshotData>();
+        if (!snapshot || !blob.Contains(snapshot->m_inputKey) || !blob.Contains(snapshot->m_inputs) ||
+            !blob.Contains(snapshot->m_paths) || !blob.Contains(snapshot->m_settings))
+        {
+            AZ_Error("Settings Registry", false, "'%s' isn't a valid settings registry snapshot.", snapshotPath);
+            return false;
+        }
+
+        if (AZStd::string_view(snapshot->m_inputKey.data(), snapshot->m_inputKey.size()) != inputKey)
+        {
+            return false;
+        }
+
+        const AZStd::string_view paths(snapshot->m_paths.data(), snapshot->m_paths.size());
+        for (const SnapshotInput& input : snapshot->m_inputs)
+        {
+            if (input.m_pathOffset > paths.size() || input.m_pathLength > paths.size() - input.m_pathOffset ||
+                input.m_pathLength >= IO::MaxPathLength)
+            {
+                AZ_Error("Settings Registry", false, "'%s' isn't a valid settings registry snapshot.", snapshotPath);
+                return false;
+            }
+
+            const IO::FixedMaxPathString path(paths.substr(input.m_pathOffset, input.m_pathLength));
+            const SnapshotInput current = GetInputState(path.c_str(), input.m_isFolder != 0);
+            if (current.m_modificationTime != input.m_modificationTime || current.m_size != input.m_size)
+            {
+                return false;
+            }
+        }
+
+        const AZStd::string_view settings(snapshot->m_settings.data(), snapshot->m_settings.size());
+        return registry.MergeSettings(settings, SettingsRegistryInterface::Format::JsonPatch, "");
+    }
+} // namespace AZ::SettingsRegistrySnapshot
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/string/string_view.h>
+
+//! A snapshot stores the merged settings of a Settings Registry together with the files that were merged to create them,
+//! so a later process can restore the settings without discovering, parsing and merging those files again.
+//! The snapshot records the path, modification time and size of every file and folder in the file history of the
+//! registry, and is only loaded if none of those have changed and the input key matches. Settings that don't come from
+//! files recorded in the file history, such as environment variables or files read outside of MergeSettingsFile, aren't
+//! tracked, so the input key needs to capture anything else the merged settings depend on.
+namespace AZ::SettingsRegistrySnapshot
+{
+    //! Setting with the path to the snapshot file that ComponentApplication uses for its settings.
+    //! Snapshots are off unless this is set, typically with --regset on the command line.
+    inline constexpr AZStd::string_view SnapshotPathKey = "/O3DE/Settings/Snapshot/Path";
+
+    //! Stores all settings in the registry to a snapshot file at the provided path.
+    //! @param registry The registry to store. The file history of the registry determines which inputs are recorded.
+    //! @param snapshotPath The absolute path to the snapshot file. An existing snapshot is replaced.
+    //! @param inputKey Additional inputs of the settings, for instance the command line. A snapshot is only loaded by
+    //!     a call with the same key.
+    //! @return True if the snapshot was written, otherwise false.
+    bool Save(SettingsRegistryInterface& registry, const char* snapshotPath, AZStd::string_view inputKey);
+
+    //! Merges the settings in the snapshot file into the registry if the snapshot is still up to date.
+    //! @param registry The registry to merge the settings into. The snapshot replaces all settings in the registry.
+    //! @param snapshotPath The absolute path to the snapshot file.
+    //! @param inputKey The key the snapshot was saved with.
+    //! @return True if the snapshot was merged. False if the snapshot doesn't exist, was saved with a different key or any
+    //!     of the recorded inputs changed, in which case the registry is left untouched.
+    bool Load(SettingsRegistryInterface& registry, const char* snapshotPath, AZStd::string_view inputKey);
+} // namespace AZ::SettingsRegistrySnapshot
@@ -26,6 +26,14 @@ namespace AZ::Internal
         m_relocator = other.m_relocator;
         m_destroyer = other.m_destroyer;
 
+        // Tasks are relocated while the graph is being built, so the link information must travel with the lambda
+        m_dependencyCount = other.m_dependencyCount.load();
+        m_successorOffset = other.m_successorOffset;
+        m_inboundLinkCount = other.m_inboundLinkCount;
+        m_outboundLinkCount = other.m_outboundLinkCount;
+        m_graph = other.m_graph;
+        m_descriptor = other.m_descriptor;
+
         // We now own the lambda, so clear the moved-from task's destroyer
         other.m_destroyer = nullptr;
 
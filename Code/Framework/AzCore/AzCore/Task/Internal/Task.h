@@ -132,6 +132,14 @@ namespace AZ::Internal
 
         ~Task();
 
+        // Replace the embedded lambda while keeping the descriptor and the links to other tasks.
+        // NOTE: The task must not be in flight
+        template<typename Lambda>
+        void SetLambda(Lambda& lambda) = delete;
+
+        template<typename Lambda>
+        void SetLambda(Lambda&& lambda) noexcept;
+
         void Link(Task& other);
 
         // Indicates if this task is a root of the graph (with no dependencies)
@@ -145,10 +153,15 @@ namespace AZ::Internal
 
         uint8_t GetPriorityNumber() const noexcept;
 
+        bool PrefersCurrentWorker() const noexcept;
+
     private:
         friend class CompiledTaskGraph;
         friend class TaskWorker;
 
+        template<typename Lambda>
+        void EmplaceLambda(Lambda&& lambda) noexcept;
+
         // This relocation avoids branches needed if the lambda type is unknown
         template<typename Lambda>
         void TypedRelocate(Lambda&& lambda, char* destination);
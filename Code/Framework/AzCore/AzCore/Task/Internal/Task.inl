@@ -12,16 +12,33 @@ namespace AZ::Internal
     Task::Task(TaskDescriptor const& desc, Lambda&& lambda) noexcept
         : m_descriptor{ desc }
     {
+        EmplaceLambda(AZStd::forward<Lambda>(lambda));
+    }
+
+    template<typename Lambda>
+    void Task::SetLambda(Lambda&& lambda) noexcept
+    {
+        if (m_destroyer)
+        {
+            m_destroyer(m_lambda);
+        }
+        EmplaceLambda(AZStd::forward<Lambda>(lambda));
+    }
+
+    template<typename Lambda>
+    void Task::EmplaceLambda(Lambda&& lambda) noexcept
+    {
+        using LambdaType = AZStd::decay_t<Lambda>;
         static_assert(
-            sizeof(Lambda) <= BufferSize,
+            sizeof(LambdaType) <= BufferSize,
             "Task lambda has too much captured data, please capture no"
             "more than 56 bytes of data (likely by capturing a single reference/pointer to a container of data)");
         static_assert(
-            alignof(Lambda) <= alignof(max_align_t),
+            alignof(LambdaType) <= alignof(max_align_t),
             "Task lambda has extended alignment which isn't supported."
             "Please capture a reference/pointer to the data requiring an extended alignment instead");
 
-        TaskTypeEraser<Lambda> eraser;
+        TaskTypeEraser<LambdaType> eraser;
         m_invoker = eraser.ErasedInvoker();
         m_relocator = eraser.ErasedRelocator();
         m_destroyer = eraser.ErasedDestroyer();
@@ -71,6 +88,11 @@ namespace AZ::Internal
         return static_cast<uint8_t>(m_descriptor.priority);
     }
 
+    inline bool Task::PrefersCurrentWorker() const noexcept
+    {
+        return m_descriptor.preferCurrentWorker;
+    }
+
     inline void Task::Link(Task& other)
     {
         ++m_outboundLinkCount;
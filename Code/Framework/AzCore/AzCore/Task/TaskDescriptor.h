@@ -42,6 +42,11 @@ namespace AZ
         // that were queued before it provided they had not yet started
         TaskPriority priority = TaskPriority::MEDIUM;
 
+        // When a task of this kind becomes ready on a task worker (e.g. a successor released by the task that just
+        // finished there), enqueue it on that same worker instead of distributing it round-robin. This keeps dependent
+        // work on a warm cache, and idle workers will still steal it if the current worker falls behind.
+        bool preferCurrentWorker = false;
+
         // EXPERTS ONLY. A bitmask that restricts tasks of this kind to run only on cores
         // corresponding to a set bit. 0 is synonymous with all bits set
         uint32_t cpuMask = 0;
@@ -9,6 +9,7 @@
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
 
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
@@ -17,6 +18,7 @@
 #include <AzCore/std/parallel/semaphore.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
 #include <AzCore/Module/Environment.h>
 
 #include <random>
@@ -185,7 +187,8 @@ namespace AZ
                     }
                     else
                     {
-                        Task* task = m_queues[priority][status.head];
+                        // Other workers may steal from this queue, so only read the slot we are about to claim
+                        Task* task = m_queues[priority][head];
                         if (status.head.compare_exchange_weak(head, head + 1))
                         {
                             return task;
@@ -205,8 +208,11 @@ namespace AZ
             void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
             {
                 m_executor = &executor;
+                m_id = id;
 
                 m_threadName = AZStd::string::format("TaskWorker %u", id);
+                m_stealsStatName = AZStd::wstring::format(L"TaskWorker %u/Tasks stolen", id);
+                m_idleTimeStatName = AZStd::wstring::format(L"TaskWorker %u/Idle time (us)", id);
                 AZStd::thread_desc desc = {};
                 desc.m_name = m_threadName.c_str();
                 if (affinitize)
@@ -214,6 +220,9 @@ namespace AZ
                     desc.m_cpuId = 1 << id;
                 }
                 m_active.store(true, AZStd::memory_order_release);
+                // Workers start out blocked on their semaphore, so they are available to be woken for stealing
+                m_sleeping.store(true, AZStd::memory_order_release);
+                executor.m_sleepingWorkers.fetch_add(1, AZStd::memory_order_acq_rel);
 
                 m_thread = AZStd::thread{ desc,
                                           [this, &initSemaphore]
@@ -240,6 +249,17 @@ namespace AZ
                 return m_enabled;
             }
 
+            bool IsSleeping() const
+            {
+                return m_sleeping.load(AZStd::memory_order_acquire);
+            }
+
+            // Claims the sleeping flag set by this worker before blocking, returns true if the caller should wake it
+            bool TryClaimSleeping()
+            {
+                return m_sleeping.exchange(false, AZStd::memory_order_acq_rel);
+            }
+
             void Join()
             {
                 m_active.store(false, AZStd::memory_order_release);
@@ -254,53 +274,148 @@ namespace AZ
                 m_semaphore.release();
             }
 
+            // Enqueue from the worker's own thread, the worker is running so it doesn't need to be signaled
+            void EnqueueLocal(Task* task)
+            {
+                m_queue.Enqueue(task);
+            }
+
+            void Wake()
+            {
+                m_semaphore.release();
+            }
+
+            Task* TryDequeue()
+            {
+                return m_queue.TryDequeue();
+            }
+
+            uint32_t GetId() const
+            {
+                return m_id;
+            }
+
+            TaskWorkerStats GetStats() const
+            {
+                TaskWorkerStats stats;
+                stats.m_tasksExecuted = m_tasksExecuted.load(AZStd::memory_order_relaxed);
+                stats.m_tasksStolen = m_tasksStolen.load(AZStd::memory_order_relaxed);
+                stats.m_idleTimeUs = m_idleTimeUs.load(AZStd::memory_order_relaxed);
+                return stats;
+            }
+
             const char* GetThreadName() {return m_threadName.c_str();}
 
         private:
+            Task* NextTask()
+            {
+                Task* task = m_queue.TryDequeue();
+                if (!task)
+                {
+                    task = m_executor->TrySteal(*this);
+                    if (task)
+                    {
+                        m_tasksStolen.fetch_add(1, AZStd::memory_order_relaxed);
+                    }
+                }
+                return task;
+            }
+
+            void Execute(Task* task)
+            {
+                CompiledTaskGraph* graph = task->m_graph;
+                task->Invoke();
+                m_tasksExecuted.fetch_add(1, AZStd::memory_order_relaxed);
+
+                if (graph == nullptr)
+                {
+                    // Standalone tasks are owned by their submitter, which may reuse the task as soon as it has been invoked
+                    return;
+                }
+
+                // Decrement counts for all task successors
+                for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                {
+                    Task* successor = graph->m_successors[task->m_successorOffset + j];
+                    if (--successor->m_dependencyCount == 0)
+                    {
+                        m_executor->Submit(*successor);
+                    }
+                }
+
+                bool isRetained = graph->m_parent != nullptr;
+                if (graph->Release(m_executor->GetEventTracker()) == (isRetained ? 1u : 0u))
+                {
+                    m_executor->ReleaseGraph();
+                }
+            }
+
             void Run()
             {
                 while (m_active)
                 {
+                    const AZStd::sys_time_t idleStart = AZStd::GetTimeNowMicroSecond();
                     m_semaphore.acquire();
+                    if (TryClaimSleeping())
+                    {
+                        m_executor->m_sleepingWorkers.fetch_sub(1, AZStd::memory_order_acq_rel);
+                    }
+                    m_idleTimeUs.fetch_add(AZStd::GetTimeNowMicroSecond() - idleStart, AZStd::memory_order_relaxed);
 
                     if (!m_active)
                     {
                         return;
                     }
 
-                    Task* task = m_queue.TryDequeue();
-                    while (task)
+                    while (true)
                     {
-                        task->Invoke();
-                        // Decrement counts for all task successors
-                        for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                        Task* task = NextTask();
+                        while (task)
                         {
-                            Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
-                            if (--successor->m_dependencyCount == 0)
-                            {
-                                m_executor->Submit(*successor);
-                            }
+                            Execute(task);
+                            task = NextTask();
                         }
 
-                        bool isRetained = task->m_graph->m_parent != nullptr;
-                        if (task->m_graph->Release(m_executor->GetEventTracker()) == (isRetained ? 1u : 0u))
+                        // Advertise that we are about to sleep before the final check, so that a task enqueued on a
+                        // busy worker after the check will wake us to steal it
+                        m_sleeping.store(true, AZStd::memory_order_release);
+                        m_executor->m_sleepingWorkers.fetch_add(1, AZStd::memory_order_acq_rel);
+
+                        task = NextTask();
+                        if (!task)
                         {
-                            m_executor->ReleaseGraph();
+                            break;
                         }
 
-                        task = m_queue.TryDequeue();
+                        if (TryClaimSleeping())
+                        {
+                            m_executor->m_sleepingWorkers.fetch_sub(1, AZStd::memory_order_acq_rel);
+                        }
+                        Execute(task);
                     }
+
+                    AZ_PROFILE_DATAPOINT(AzCore, m_tasksStolen.load(AZStd::memory_order_relaxed), m_stealsStatName.c_str());
+                    AZ_PROFILE_DATAPOINT(AzCore, m_idleTimeUs.load(AZStd::memory_order_relaxed), m_idleTimeStatName.c_str());
                 }
             }
 
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
+            AZStd::atomic<bool> m_sleeping = false;
             AZStd::binary_semaphore m_semaphore;
 
             ::AZ::TaskExecutor* m_executor;
             TaskQueue m_queue;
+            uint32_t m_id = 0;
+
+            AZStd::atomic<uint64_t> m_tasksExecuted{ 0 };
+            AZStd::atomic<uint64_t> m_tasksStolen{ 0 };
+            AZStd::atomic<uint64_t> m_idleTimeUs{ 0 };
+
             AZStd::string m_threadName;
+            AZStd::wstring m_stealsStatName;
+            AZStd::wstring m_idleTimeStatName;
             friend class ::AZ::TaskExecutor;
         };
 
@@ -434,6 +549,15 @@ namespace AZ
 
     void TaskExecutor::Submit(Internal::Task& task)
     {
+        Internal::TaskWorker* currentWorker = GetTaskWorker();
+        if (currentWorker && task.PrefersCurrentWorker() && currentWorker->Enabled())
+        {
+            // Keep the task on the worker that released it, other workers can still steal it if they run dry
+            currentWorker->EnqueueLocal(&task);
+            WakeIdleWorker();
+            return;
+        }
+
         // TODO: Something more sophisticated is likely needed here.
         // First, we are completely ignoring affinity.
         // Second, some heuristics on core availability will help distribute work more effectively
@@ -445,7 +569,51 @@ namespace AZ
             nextWorker = ++m_lastSubmission % m_threadCount;
         }
 
-        m_workers[nextWorker].Enqueue(&task);
+        Internal::TaskWorker& worker = m_workers[nextWorker];
+        const bool workerWasSleeping = worker.IsSleeping();
+        worker.Enqueue(&task);
+        if (!workerWasSleeping)
+        {
+            // The chosen worker is busy, let an idle one steal the task rather than wait behind it
+            WakeIdleWorker();
+        }
+    }
+
+    Internal::Task* TaskExecutor::TrySteal(Internal::TaskWorker& thief)
+    {
+        for (uint32_t i = 1; i < m_threadCount; ++i)
+        {
+            Internal::TaskWorker& victim = m_workers[(thief.GetId() + i) % m_threadCount];
+            if (Internal::Task* task = victim.TryDequeue())
+            {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    void TaskExecutor::WakeIdleWorker()
+    {
+        if (m_sleepingWorkers.load(AZStd::memory_order_acquire) == 0)
+        {
+            return;
+        }
+
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            if (m_workers[i].TryClaimSleeping())
+            {
+                m_sleepingWorkers.fetch_sub(1, AZStd::memory_order_acq_rel);
+                m_workers[i].Wake();
+                return;
+            }
+        }
+    }
+
+    TaskWorkerStats TaskExecutor::GetWorkerStats(uint32_t workerIndex) const
+    {
+        AZ_Assert(workerIndex < m_threadCount, "Task worker index %u is out of range", workerIndex);
+        return m_workers[workerIndex].GetStats();
     }
 
     void TaskExecutor::ReleaseGraph()
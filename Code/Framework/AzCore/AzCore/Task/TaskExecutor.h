@@ -116,6 +116,15 @@ namespace AZ
         class TaskWorker;
     } // namespace Internal
 
+    // Per worker counters, also reported through the profiler as data points each time a worker goes idle
+    struct TaskWorkerStats
+    {
+        uint64_t m_tasksExecuted = 0;
+        // Tasks this worker took from the queue of another worker
+        uint64_t m_tasksStolen = 0;
+        uint64_t m_idleTimeUs = 0;
+    };
+
     class TaskExecutor final
     {
     public:
@@ -134,10 +143,18 @@ namespace AZ
         // that is currently active
         void Submit(Internal::CompiledTaskGraph& graph, TaskGraphEvent* event);
 
+        // Submit a single task for execution. A task that isn't part of a compiled task graph is owned by the caller, which must
+        // keep it alive until it has been invoked. The executor doesn't touch the task once its lambda was invoked, so the lambda
+        // may hand the task back to the caller for reuse as its last action
         void Submit(Internal::Task& task);
 
         Internal::CompiledTaskGraphTracker& GetEventTracker() {return m_eventTracker;}
 
+        uint32_t GetWorkerCount() const { return m_threadCount; }
+
+        // Returns a snapshot of the counters of the worker at workerIndex, values are updated concurrently
+        TaskWorkerStats GetWorkerStats(uint32_t workerIndex) const;
+
     private:
         friend class Internal::TaskWorker;
         friend class TaskGraphEvent;
@@ -147,9 +164,15 @@ namespace AZ
         void ReleaseGraph();
         void ReactivateTaskWorker();
 
+        // Attempts to take a task from any worker other than thief
+        Internal::Task* TrySteal(Internal::TaskWorker& thief);
+        // Wakes a sleeping worker, if there is one, so that it can steal queued work
+        void WakeIdleWorker();
+
         Internal::TaskWorker* m_workers;
         uint32_t m_threadCount = 0;
         AZStd::atomic<uint32_t> m_lastSubmission;
+        AZStd::atomic<uint32_t> m_sleepingWorkers{ 0 };
         AZStd::atomic<uint64_t> m_graphsRemaining;
 
         // Implement basic CompiledTaskGraph event breadcrumbs to help debug
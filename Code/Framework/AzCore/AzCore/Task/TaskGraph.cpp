@@ -65,9 +65,9 @@ namespace AZ
         AZ_Assert(!m_parent.m_submitted, "Cannot mutate a TaskGraph %s that was previously submitted.", m_parent.m_label);
 
         // Increment inbound/outbound edge counts
-        m_parent.m_tasks[m_index].Link(m_parent.m_tasks[comesAfter.m_index]);
+        m_parent.m_tasks[m_exitIndex].Link(m_parent.m_tasks[comesAfter.m_index]);
 
-        m_parent.m_links[m_index].emplace_back(comesAfter.m_index);
+        m_parent.m_links[m_exitIndex].emplace_back(comesAfter.m_index);
 
         ++m_parent.m_linkCount;
     }
@@ -103,9 +103,28 @@ namespace AZ
         }
         m_tasks.clear();
         m_links.clear();
+        m_dataParallelCounts.clear();
         m_linkCount = 0;
     }
 
+    Internal::Task& TaskGraph::GetTask(uint32_t index)
+    {
+        AZStd::vector<Internal::Task>& tasks = m_compiledTaskGraph ? m_compiledTaskGraph->Tasks() : m_tasks;
+        AZ_Assert(index < tasks.size(), "Task index %u is out of range in TaskGraph %s", index, m_label);
+        return tasks[index];
+    }
+
+    void TaskGraph::SetDataParallelCount(const TaskToken& token, uint32_t count)
+    {
+        AZ_Assert(!m_submitted, "Cannot update a data-parallel node of TaskGraph %s while it is in flight.", m_label);
+        AZ_Assert(&token.m_parent == this, "Task token does not belong to TaskGraph %s", m_label);
+        AZ_Assert(token.m_dataParallelNode != TaskToken::InvalidNode, "Task token does not refer to a data-parallel node");
+        AZ_Assert(
+            count <= token.m_exitIndex - token.m_index - 1,
+            "Data-parallel count %u exceeds the number of instances the node was created with in TaskGraph %s", count, m_label);
+        m_dataParallelCounts[token.m_dataParallelNode] = count;
+    }
+
     void TaskGraph::Submit(TaskGraphEvent* waitEvent)
     {
         // If this is a new empty task graph (and not a retained taskgraph that was previously run),
@@ -127,6 +146,10 @@ namespace AZ
 
     void TaskGraph::SubmitOnExecutor(TaskExecutor& executor, TaskGraphEvent* waitEvent)
     {
+        AZ_Assert(
+            m_retained || m_dataParallelCounts.empty(),
+            "TaskGraph %s contains data-parallel nodes and must not be detached", m_label);
+
         Internal::CompiledTaskGraphTracker& eventTracker = executor.GetEventTracker();
         if (!m_compiledTaskGraph)
         {
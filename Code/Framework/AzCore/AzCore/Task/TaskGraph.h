@@ -53,13 +53,20 @@ namespace AZ
     private:
         friend class TaskGraph;
 
+        static constexpr uint32_t InvalidNode = ~0u;
+
         void PrecedesInternal(TaskToken& comesAfter);
 
         // Only the TaskGraph should be creating TaskToken
         TaskToken(TaskGraph& parent, uint32_t index);
+        TaskToken(TaskGraph& parent, uint32_t entryIndex, uint32_t exitIndex, uint32_t dataParallelNode);
 
         TaskGraph& m_parent;
+        // Index of the task that inbound edges attach to
         uint32_t m_index;
+        // Index of the task that outbound edges leave from, differs from m_index for data-parallel nodes
+        uint32_t m_exitIndex;
+        uint32_t m_dataParallelNode = InvalidNode;
     };
 
     // A TaskGraphEvent may be used to block until one or more task graphs has finished executing. Usage
@@ -123,6 +130,34 @@ namespace AZ
         template <typename... Lambdas>
         AZStd::array<TaskToken, sizeof...(Lambdas)> AddTasks(TaskDescriptor const& descriptor, Lambdas&&... lambdas);
 
+        // Add taskCount tasks that may run concurrently, each invoking lambda(taskIndex). The returned token is used
+        // like any other, edges attach to the group as a whole. The lambda is copied into every task.
+        template<typename Lambda>
+        TaskToken AddTaskGroup(TaskDescriptor const& descriptor, uint32_t taskCount, Lambda&& lambda);
+
+        // Makes first precede last and returns a token representing both, edges into the returned token attach
+        // to first and edges out of it leave from last. Used to compose multi-stage nodes such as parallel scans.
+        TaskToken Chain(TaskToken& first, TaskToken& last);
+
+        // Add a data-parallel node made of up to maxInstances tasks that may run concurrently. Each instance invokes
+        // lambda(instanceIndex, instanceCount). The returned token is used like any other, edges attach to the node
+        // as a whole. The lambda is copied into every instance, so it must be copy constructible and small enough to
+        // fit alongside the instance bookkeeping (capture a pointer to your data).
+        // NOTE: Graphs containing data-parallel nodes must be retained
+        template<typename Lambda>
+        TaskToken AddDataParallelTask(TaskDescriptor const& descriptor, uint32_t maxInstances, Lambda&& lambda);
+
+        // Patch the number of instances of a data-parallel node that perform work on the next submission. Instances
+        // beyond the count are still scheduled but return immediately, so the compiled graph is reused as is.
+        // NOTE: This operation is invalid if the graph is in-flight
+        void SetDataParallelCount(const TaskToken& token, uint32_t count);
+
+        // Replace the lambda of a previously added task. On a retained graph this may be done between submissions
+        // to supply new per-task payloads without recompiling the graph or allocating.
+        // NOTE: This operation is invalid if the graph is in-flight
+        template<typename Lambda>
+        void UpdateTask(const TaskToken& token, Lambda&& lambda);
+
         // By default, you are responsible for retaining the TaskGraph, indicating you promise that
         // this TaskGraph will live as long as it takes for all constituent tasks to complete.
         // Once retained, this task graph can be resubmitted after completion without any
@@ -159,10 +194,16 @@ namespace AZ
         friend class TaskToken;
         friend class Internal::CompiledTaskGraph;
 
+        // Returns the task at index, from the compiled graph if the graph was already submitted once
+        Internal::Task& GetTask(uint32_t index);
+
         Internal::CompiledTaskGraph* m_compiledTaskGraph = nullptr;
 
         AZStd::vector<Internal::Task> m_tasks;
 
+        // Active instance count per data-parallel node, read by the instance tasks when they run
+        AZStd::vector<uint32_t> m_dataParallelCounts;
+
         // Task index |-> Dependent task indices
         AZStd::unordered_map<uint32_t, AZStd::vector<uint32_t>> m_links;
 
@@ -13,6 +13,15 @@ namespace AZ
     inline TaskToken::TaskToken(TaskGraph& parent, uint32_t index)
         : m_parent{ parent }
         , m_index{ index }
+        , m_exitIndex{ index }
+    {
+    }
+
+    inline TaskToken::TaskToken(TaskGraph& parent, uint32_t entryIndex, uint32_t exitIndex, uint32_t dataParallelNode)
+        : m_parent{ parent }
+        , m_index{ entryIndex }
+        , m_exitIndex{ exitIndex }
+        , m_dataParallelNode{ dataParallelNode }
     {
     }
 
@@ -54,6 +63,78 @@ namespace AZ
         return { AddTask(descriptor, AZStd::forward<Lambdas>(lambdas))... };
     }
 
+    template<typename Lambda>
+    TaskToken TaskGraph::AddTaskGroup(TaskDescriptor const& descriptor, uint32_t taskCount, Lambda&& lambda)
+    {
+        AZ_Assert(!m_submitted, "Cannot mutate a TaskGraph that was previously submitted or in flight.");
+        AZ_Assert(taskCount > 0, "Task group %s in graph %s needs at least one task", descriptor.taskName, m_label);
+
+        // The group is bracketed by two empty tasks so edges to and from it only need a single link each
+        const uint32_t entryIndex = aznumeric_cast<uint32_t>(m_tasks.size());
+        const uint32_t exitIndex = entryIndex + taskCount + 1;
+        m_tasks.reserve(m_tasks.size() + taskCount + 2);
+        m_tasks.emplace_back(descriptor, [] {});
+        for (uint32_t taskIndex = 0; taskIndex != taskCount; ++taskIndex)
+        {
+            m_tasks.emplace_back(
+                descriptor,
+                [taskIndex, lambda]()
+                {
+                    lambda(taskIndex);
+                });
+        }
+        m_tasks.emplace_back(descriptor, [] {});
+
+        for (uint32_t taskIndex = 0; taskIndex != taskCount; ++taskIndex)
+        {
+            const uint32_t groupTaskIndex = entryIndex + taskIndex + 1;
+            m_tasks[entryIndex].Link(m_tasks[groupTaskIndex]);
+            m_links[entryIndex].emplace_back(groupTaskIndex);
+            m_tasks[groupTaskIndex].Link(m_tasks[exitIndex]);
+            m_links[groupTaskIndex].emplace_back(exitIndex);
+        }
+        m_linkCount += 2 * taskCount;
+
+        return { *this, entryIndex, exitIndex, TaskToken::InvalidNode };
+    }
+
+    template<typename Lambda>
+    TaskToken TaskGraph::AddDataParallelTask(TaskDescriptor const& descriptor, uint32_t maxInstances, Lambda&& lambda)
+    {
+        const uint32_t node = aznumeric_cast<uint32_t>(m_dataParallelCounts.size());
+        m_dataParallelCounts.push_back(maxInstances);
+
+        TaskToken token = AddTaskGroup(
+            descriptor, maxInstances,
+            [graph = this, node, lambda = AZStd::forward<Lambda>(lambda)](uint32_t instance)
+            {
+                const uint32_t count = graph->m_dataParallelCounts[node];
+                if (instance < count)
+                {
+                    lambda(instance, count);
+                }
+            });
+        token.m_dataParallelNode = node;
+        return token;
+    }
+
+    template<typename Lambda>
+    void TaskGraph::UpdateTask(const TaskToken& token, Lambda&& lambda)
+    {
+        AZ_Assert(!m_submitted, "Cannot update a task of TaskGraph %s while it is in flight.", m_label);
+        AZ_Assert(&token.m_parent == this, "Task token does not belong to TaskGraph %s", m_label);
+        AZ_Assert(
+            token.m_index == token.m_exitIndex,
+            "UpdateTask can only be used on tokens of a single task in TaskGraph %s", m_label);
+        GetTask(token.m_index).SetLambda(AZStd::forward<Lambda>(lambda));
+    }
+
+    inline TaskToken TaskGraph::Chain(TaskToken& first, TaskToken& last)
+    {
+        first.Precedes(last);
+        return { *this, first.m_index, last.m_exitIndex, TaskToken::InvalidNode };
+    }
+
     inline bool TaskGraph::IsEmpty()
     {
         return m_tasks.empty();
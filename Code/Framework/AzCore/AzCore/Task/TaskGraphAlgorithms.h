@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+// Data-parallel building blocks for the TaskGraph, the TaskGraph counterparts of the job based helpers in
+// AzCore/Jobs/Algorithms.h. Each function adds the tasks needed for the operation to a graph and returns a
+// TaskToken for the whole operation, so it can be ordered against the rest of the graph with Precedes/Follows.
+// Nothing executes until the graph is submitted.
+//
+// parallel_for and parallel_reduce split the range adaptively: one task is added per hardware thread, and each
+// task repeatedly claims a slice of the remaining range which shrinks as the range drains (guided scheduling).
+// Tasks that start early or run on a fast core take more of the range, so uneven iterations balance out without
+// spawning new tasks at runtime. The grain size is the smallest slice a task will claim, pass 0 to let it be
+// derived from the range size.
+
+namespace AZ
+{
+    namespace Internal
+    {
+        // Number of slices the range is cut into per task when no grain size is supplied
+        constexpr size_t TaskGraphAutoGrainSlicesPerTask = 8;
+
+        inline uint32_t TaskGraphAlgorithmTaskCount(size_t count, size_t grainSize)
+        {
+            const size_t maxTasks = AZStd::max(1u, AZStd::thread::hardware_concurrency());
+            const size_t grainCount = (count + grainSize - 1) / grainSize;
+            return aznumeric_cast<uint32_t>(AZStd::clamp<size_t>(grainCount, 1, maxTasks));
+        }
+
+        inline size_t TaskGraphAutoGrainSize(size_t count, size_t grainSize)
+        {
+            if (grainSize != 0)
+            {
+                return grainSize;
+            }
+            const size_t maxTasks = AZStd::max(1u, AZStd::thread::hardware_concurrency());
+            return AZStd::max<size_t>(1, count / (maxTasks * TaskGraphAutoGrainSlicesPerTask));
+        }
+
+        // Shared range state for the guided scheduling of parallel_for and parallel_reduce
+        class TaskGraphRange
+        {
+        public:
+            TaskGraphRange(size_t begin, size_t end, size_t grainSize, uint32_t taskCount)
+                : m_next(begin)
+                , m_end(end)
+                , m_grainSize(grainSize)
+                , m_taskCount(taskCount)
+            {
+            }
+
+            // Claims the next slice of the range, returns false once the range is exhausted
+            bool Claim(size_t& sliceBegin, size_t& sliceEnd)
+            {
+                size_t current = m_next.load(AZStd::memory_order_relaxed);
+                while (current < m_end)
+                {
+                    const size_t remaining = m_end - current;
+                    const size_t slice = AZStd::min(remaining, AZStd::max(m_grainSize, remaining / (2 * m_taskCount)));
+                    if (m_next.compare_exchange_weak(current, current + slice, AZStd::memory_order_relaxed))
+                    {
+                        sliceBegin = current;
+                        sliceEnd = current + slice;
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+        private:
+            AZStd::atomic<size_t> m_next;
+            const size_t m_end;
+            const size_t m_grainSize;
+            const uint32_t m_taskCount;
+        };
+    } // namespace Internal
+
+    //! Adds tasks to graph that invoke function(index) for every index in [begin, end).
+    template<typename Function>
+    TaskToken parallel_for(
+        TaskGraph& graph, TaskDescriptor const& descriptor, size_t begin, size_t end, Function&& function, size_t grainSize = 0)
+    {
+        struct State
+        {
+            State(size_t rangeBegin, size_t rangeEnd, size_t grain, uint32_t taskCount, Function&& func)
+                : m_range(rangeBegin, rangeEnd, grain, taskCount)
+                , m_function(AZStd::forward<Function>(func))
+            {
+            }
+
+            Internal::TaskGraphRange m_range;
+            AZStd::decay_t<Function> m_function;
+        };
+
+        const size_t count = end > begin ? end - begin : 0;
+        grainSize = Internal::TaskGraphAutoGrainSize(count, grainSize);
+        const uint32_t taskCount = Internal::TaskGraphAlgorithmTaskCount(count, grainSize);
+        auto state = AZStd::make_shared<State>(begin, AZStd::max(begin, end), grainSize, taskCount, AZStd::forward<Function>(function));
+
+        return graph.AddTaskGroup(
+            descriptor, taskCount,
+            [state](uint32_t)
+            {
+                size_t sliceBegin;
+                size_t sliceEnd;
+                while (state->m_range.Claim(sliceBegin, sliceEnd))
+                {
+                    for (size_t index = sliceBegin; index != sliceEnd; ++index)
+                    {
+                        state->m_function(index);
+                    }
+                }
+            });
+    }
+
+    //! Adds tasks to graph that reduce [begin, end) into result. function(sliceBegin, sliceEnd, partial) folds a slice
+    //! into a partial value and returns it, reduction(a, b) combines two partial values. Slices are claimed in no
+    //! particular order, so reduction must be associative and commutative, and identity must be its identity value.
+    //! result is written once all the tasks of the reduce are done, it must outlive the graph execution.
+    template<typename T, typename Function, typename Reduction>
+    TaskToken parallel_reduce(
+        TaskGraph& graph,
+        TaskDescriptor const& descriptor,
+        size_t begin,
+        size_t end,
+        const T& identity,
+        Function&& function,
+        Reduction&& reduction,
+        T& result,
+        size_t grainSize = 0)
+    {
+        struct State
+        {
+            State(size_t rangeBegin, size_t rangeEnd, size_t grain, uint32_t taskCount, const T& identityValue, Function&& func,
+                Reduction&& reduce, T& out)
+                : m_range(rangeBegin, rangeEnd, grain, taskCount)
+                , m_partials(taskCount, identityValue)
+                , m_remainingTasks(taskCount)
+                , m_function(AZStd::forward<Function>(func))
+                , m_reduction(AZStd::forward<Reduction>(reduce))
+                , m_result(out)
+            {
+            }
+
+            Internal::TaskGraphRange m_range;
+            AZStd::vector<T> m_partials;
+            AZStd::atomic<uint32_t> m_remainingTasks;
+            AZStd::decay_t<Function> m_function;
+            AZStd::decay_t<Reduction> m_reduction;
+            T& m_result;
+        };
+
+        const size_t count = end > begin ? end - begin : 0;
+        grainSize = Internal::TaskGraphAutoGrainSize(count, grainSize);
+        const uint32_t taskCount = Internal::TaskGraphAlgorithmTaskCount(count, grainSize);
+        auto state = AZStd::make_shared<State>(
+            begin, AZStd::max(begin, end), grainSize, taskCount, identity, AZStd::forward<Function>(function),
+            AZStd::forward<Reduction>(reduction), result);
+
+        return graph.AddTaskGroup(
+            descriptor, taskCount,
+            [state](uint32_t taskIndex)
+            {
+                T& partial = state->m_partials[taskIndex];
+                size_t sliceBegin;
+                size_t sliceEnd;
+                while (state->m_range.Claim(sliceBegin, sliceEnd))
+                {
+                    partial = state->m_function(sliceBegin, sliceEnd, partial);
+                }
+
+                // The last task to finish folds the partial values together, avoiding an extra serial task
+                if (state->m_remainingTasks.fetch_sub(1, AZStd::memory_order_acq_rel) == 1)
+                {
+                    T total = state->m_partials[0];
+                    for (size_t i = 1; i < state->m_partials.size(); ++i)
+                    {
+                        total = state->m_reduction(total, state->m_partials[i]);
+                    }
+                    state->m_result = AZStd::move(total);
+                }
+            });
+    }
+
+    //! Adds tasks to graph that write the inclusive scan of [first, last) under op to the range starting at dFirst,
+    //! op must be associative and identity must be its identity value. The input is cut into contiguous blocks, the
+    //! first pass reduces each block, a serial step scans the block totals, and the second pass rescans each block
+    //! from its offset. The iterators must be random access and stay valid until the graph has executed.
+    template<typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+    TaskToken parallel_inclusive_scan(
+        TaskGraph& graph,
+        TaskDescriptor const& descriptor,
+        InputIt first,
+        InputIt last,
+        OutputIt dFirst,
+        const T& identity,
+        BinaryOp&& op,
+        size_t grainSize = 0)
+    {
+        struct State
+        {
+            State(InputIt in, OutputIt out, size_t count, uint32_t blockCount, const T& identityValue, BinaryOp&& binaryOp)
+                : m_first(in)
+                , m_dFirst(out)
+                , m_count(count)
+                , m_blockSize((count + blockCount - 1) / blockCount)
+                , m_blockTotals(blockCount, identityValue)
+                , m_identity(identityValue)
+                , m_op(AZStd::forward<BinaryOp>(binaryOp))
+            {
+            }
+
+            size_t BlockBegin(uint32_t block) const
+            {
+                return AZStd::min(m_count, block * m_blockSize);
+            }
+
+            size_t BlockEnd(uint32_t block) const
+            {
+                return AZStd::min(m_count, (block + 1) * m_blockSize);
+            }
+
+            InputIt m_first;
+            OutputIt m_dFirst;
+            size_t m_count;
+            size_t m_blockSize;
+            // Holds the block totals after the first pass, and the exclusive offset of each block after the serial step
+            AZStd::vector<T> m_blockTotals;
+            T m_identity;
+            AZStd::decay_t<BinaryOp> m_op;
+        };
+
+        const size_t count = last > first ? static_cast<size_t>(last - first) : 0;
+        grainSize = Internal::TaskGraphAutoGrainSize(count, grainSize);
+        // Blocks are contiguous and ordered, so there is no point in having more blocks than tasks
+        const uint32_t blockCount = Internal::TaskGraphAlgorithmTaskCount(count, grainSize);
+        auto state = AZStd::make_shared<State>(first, dFirst, count, blockCount, identity, AZStd::forward<BinaryOp>(op));
+
+        TaskToken reduceBlocks = graph.AddTaskGroup(
+            descriptor, blockCount,
+            [state](uint32_t block)
+            {
+                T total = state->m_identity;
+                for (size_t i = state->BlockBegin(block), end = state->BlockEnd(block); i != end; ++i)
+                {
+                    total = state->m_op(total, state->m_first[i]);
+                }
+                state->m_blockTotals[block] = AZStd::move(total);
+            });
+
+        TaskToken scanTotals = graph.AddTask(
+            descriptor,
+            [state]()
+            {
+                T offset = state->m_identity;
+                for (T& blockTotal : state->m_blockTotals)
+                {
+                    T next = state->m_op(offset, blockTotal);
+                    blockTotal = AZStd::move(offset);
+                    offset = AZStd::move(next);
+                }
+            });
+
+        TaskToken scanBlocks = graph.AddTaskGroup(
+            descriptor, blockCount,
+            [state](uint32_t block)
+            {
+                T running = state->m_blockTotals[block];
+                for (size_t i = state->BlockBegin(block), end = state->BlockEnd(block); i != end; ++i)
+                {
+                    running = state->m_op(running, state->m_first[i]);
+                    state->m_dFirst[i] = running;
+                }
+            });
+
+        TaskToken firstPass = graph.Chain(reduceBlocks, scanTotals);
+        return graph.Chain(firstPass, scanBlocks);
+    }
+} // namespace AZ
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    //! @class TimingWheel
+    //! @brief Hierarchical timing wheel with constant time insertion and removal of timers.
+    //! Timers are kept in millisecond slots across four levels of 256 slots each, so a level covers 256 times the range of
+    //! the level below it. Timers further out than the lowest level are moved down a level whenever the wheel of the level
+    //! below completes a revolution. Timers that expired while advancing the wheel are kept, ordered by the millisecond
+    //! they expired in, until they are popped, so users can limit how many timers they process per update.
+    template <typename VALUE_TYPE>
+    class TimingWheel
+    {
+    public:
+        using ValueType = VALUE_TYPE;
+
+        //! Identifies a timer, a handle remains valid until its timer is popped or removed.
+        using Handle = uint64_t;
+        static constexpr Handle InvalidHandle = ~Handle{ 0 };
+
+        static constexpr uint32_t SlotBits = 8;
+        static constexpr uint32_t SlotsPerLevel = 1 << SlotBits;
+        static constexpr uint32_t LevelCount = 4;
+
+        TimingWheel() = default;
+        ~TimingWheel() = default;
+
+        //! Removes all timers and restarts the wheel at the provided time.
+        //! @param currentTimeMs the time to restart the wheel at
+        void Reset(TimeMs currentTimeMs = TimeMs{ 0 });
+
+        //! Adds a timer, timers that expire at or before the current time of the wheel are immediately expired.
+        //! @param expireTimeMs absolute time at which the timer expires
+        //! @param value        value to return when the timer is popped
+        //! @return handle to the timer, used to remove it
+        Handle Insert(TimeMs expireTimeMs, const ValueType& value);
+
+        //! Removes a timer, whether it's still pending or already expired.
+        //! @param handle the handle of the timer to remove
+        //! @return boolean true if the timer was removed, false if the handle is no longer valid
+        bool Remove(Handle handle);
+
+        //! Returns the value of a timer.
+        //! @param handle the handle of the timer to fetch
+        //! @return pointer to the value of the timer, nullptr if the handle is no longer valid, invalidated by Insert
+        ValueType* Find(Handle handle);
+
+        //! Moves the wheel forward to the provided time, expiring all timers that expire at or before it.
+        //! Empty slots are skipped, so the cost depends on the number of timers rather than on the time passed.
+        //! @param currentTimeMs the time to advance the wheel to, the wheel never moves backwards
+        void Advance(TimeMs currentTimeMs);
+
+        //! Pops the earliest expired timer.
+        //! @param outValue the value of the popped timer
+        //! @return boolean true if an expired timer was popped, false if there are no expired timers
+        bool PopExpired(ValueType& outValue);
+
+        //! Returns true if there are expired timers waiting to be popped.
+        bool HasExpired() const;
+
+        //! Returns the time the wheel was last advanced to.
+        TimeMs GetCurrentTimeMs() const;
+
+        //! Returns the number of pending and expired timers.
+        AZStd::size_t GetSize() const;
+
+        //! Returns true if there are no pending or expired timers.
+        bool IsEmpty() const;
+
+    private:
+
+        static constexpr uint32_t InvalidIndex = ~uint32_t{ 0 };
+        static constexpr uint32_t SlotMask = SlotsPerLevel - 1;
+        static constexpr uint32_t SlotCount = SlotsPerLevel * LevelCount;
+        static constexpr uint32_t ExpiredList = SlotCount;
+        static constexpr uint32_t FreeList = SlotCount + 1;
+        static constexpr uint32_t BitmapWordBits = 64;
+        static constexpr uint32_t BitmapWordsPerLevel = SlotsPerLevel / BitmapWordBits;
+
+        struct Entry
+        {
+            ValueType m_value = {};
+            int64_t m_expireTimeMs = 0;
+            uint32_t m_prev = InvalidIndex;
+            uint32_t m_next = InvalidIndex;
+            uint32_t m_list = FreeList;
+            uint32_t m_generation = 0;
+        };
+
+        struct List
+        {
+            uint32_t m_head = InvalidIndex;
+            uint32_t m_tail = InvalidIndex;
+        };
+
+        static Handle MakeHandle(uint32_t index, uint32_t generation);
+        Entry* GetEntry(Handle handle);
+
+        uint32_t AllocateEntry();
+        void FreeEntry(uint32_t index);
+
+        void Schedule(uint32_t index);
+        void PushBack(uint32_t list, uint32_t index);
+        void Unlink(uint32_t index);
+        void Cascade(uint32_t level);
+        void ExpireSlot(uint32_t slot);
+        uint32_t FindNextOccupiedSlot(uint32_t startSlot) const;
+
+        AZStd::array<List, SlotCount> m_slots;
+        List m_expired;
+        AZStd::array<uint64_t, BitmapWordsPerLevel> m_occupiedSlots = {}; // Bit per non empty slot of the lowest level
+        AZStd::vector<Entry> m_entries;
+        uint32_t m_freeHead = InvalidIndex;
+        AZStd::size_t m_pendingCount = 0;
+        AZStd::size_t m_expiredCount = 0;
+        int64_t m_currentTimeMs = 0;
+    };
+}
+
+#include <AzCore/Time/TimingWheel.inl>
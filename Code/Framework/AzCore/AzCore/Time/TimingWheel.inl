@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ
+{
+    template <typename VALUE_TYPE>
+    inline void TimingWheel<VALUE_TYPE>::Reset(TimeMs currentTimeMs)
+    {
+        // Free the entries rather than clearing them so the generations keep outstanding handles invalid
+        for (uint32_t index = 0; index < static_cast<uint32_t>(m_entries.size()); ++index)
+        {
+            if (m_entries[index].m_list != FreeList)
+            {
+                FreeEntry(index);
+            }
+        }
+        m_slots.fill(List());
+        m_expired = List();
+        m_occupiedSlots.fill(0);
+        m_pendingCount = 0;
+        m_expiredCount = 0;
+        m_currentTimeMs = static_cast<int64_t>(currentTimeMs);
+    }
+
+    template <typename VALUE_TYPE>
+    inline typename TimingWheel<VALUE_TYPE>::Handle TimingWheel<VALUE_TYPE>::Insert(TimeMs expireTimeMs, const ValueType& value)
+    {
+        const uint32_t index = AllocateEntry();
+        Entry& entry = m_entries[index];
+        entry.m_value = value;
+        entry.m_expireTimeMs = static_cast<int64_t>(expireTimeMs);
+        Schedule(index);
+        return MakeHandle(index, entry.m_generation);
+    }
+
+    template <typename VALUE_TYPE>
+    inline bool TimingWheel<VALUE_TYPE>::Remove(Handle handle)
+    {
+        Entry* entry = GetEntry(handle);
+        if (entry == nullptr)
+        {
+            return false;
+        }
+        const uint32_t index = static_cast<uint32_t>(handle);
+        Unlink(index);
+        FreeEntry(index);
+        return true;
+    }
+
+    template <typename VALUE_TYPE>
+    inline typename TimingWheel<VALUE_TYPE>::ValueType* TimingWheel<VALUE_TYPE>::Find(Handle handle)
+    {
+        Entry* entry = GetEntry(handle);
+        return (entry != nullptr) ? &entry->m_value : nullptr;
+    }
+
+    template <typename VALUE_TYPE>
+    inline void TimingWheel<VALUE_TYPE>::Advance(TimeMs currentTimeMs)
+    {
+        const int64_t targetTimeMs = static_cast<int64_t>(currentTimeMs);
+        while (m_currentTimeMs < targetTimeMs)
+        {
+            if (m_pendingCount == 0)
+            {
+                m_currentTimeMs = targetTimeMs;
+                break;
+            }
+
+            // Jump to the next occupied slot of the lowest level, or to the end of its revolution if there is none
+            const uint32_t currentSlot = static_cast<uint32_t>(m_currentTimeMs) & SlotMask;
+            const uint32_t nextSlot = FindNextOccupiedSlot(currentSlot + 1);
+            const int64_t nextTimeMs = m_currentTimeMs - currentSlot + nextSlot;
+            if (nextTimeMs > targetTimeMs)
+            {
+                m_currentTimeMs = targetTimeMs;
+                break;
+            }
+
+            m_currentTimeMs = nextTimeMs;
+            if ((static_cast<uint32_t>(m_currentTimeMs) & SlotMask) == 0)
+            {
+                Cascade(1);
+            }
+            ExpireSlot(static_cast<uint32_t>(m_currentTimeMs) & SlotMask);
+        }
+    }
+
+    template <typename VALUE_TYPE>
+    inline bool TimingWheel<VALUE_TYPE>::PopExpired(ValueType& outValue)
+    {
+        const uint32_t index = m_expired.m_head;
+        if (index == InvalidIndex)
+        {
+            return false;
+        }
+        outValue = AZStd::move(m_entries[index].m_value);
+        Unlink(index);
+        FreeEntry(index);
+        return true;
+    }
+
+    template <typename VALUE_TYPE>
+    inline bool TimingWheel<VALUE_TYPE>::HasExpired() const
+    {
+        return m_expiredCount > 0;
+    }
+
+    template <typename VALUE_TYPE>
+    inline TimeMs TimingWheel<VALUE_TYPE>::GetCurrentTimeMs() const
+    {
+        return TimeMs{ m_currentTimeMs };
+    }
+
+    template <typename VALUE_TYPE>
+    inline AZStd::size_t TimingWheel<VALUE_TYPE>::GetSize() const
+    {
+        return m_pendingCount + m_expiredCount;
+    }
+
+    template <typename VALUE_TYPE>
+    inline bool TimingWheel<VALUE_TYPE>::IsEmpty() const
+    {
+        return GetSize() == 0;
+    }
+
+    template <typename VALUE_TYPE>
+    inline typename TimingWheel<VALUE_TYPE>::Handle TimingWheel<VALUE_TYPE>::MakeHandle(uint32_t index, uint32_t generation)
+    {
+        return (static_cast<Handle>(generation) << 32) | index;
+    }
+
+    template <typename VALUE_TYPE>
+    inline typename TimingWheel<VALUE_TYPE>::Entry* TimingWheel<VALUE_TYPE>::GetEntry(Handle handle)
+    {
+        const uint32_t index = static_cast<uint32_t>(handle);
+        const uint32_t generation = static_cast<uint32_t>(handle >> 32);
+        if (index >= m_entries.size())
+        {
+            return nullptr;
+        }
+        Entry& entry = m_entries[index];
+        if ((entry.m_list == FreeList) || (entry.m_generation != generation))
+        {
+            return nullptr;
+        }
+        return &entry;
+    }
+
+    template <typename VALUE_TYPE>
+    inline uint32_t TimingWheel<VALUE_TYPE>::AllocateEntry()
+    {
+        if (m_freeHead != InvalidIndex)
+        {
+            const uint32_t index = m_freeHead;
+            m_freeHead = m_entries[index].m_next;
+            return index;
+        }
+        m_entries.emplace_back();
+        return static_cast<uint32_t>(m_entries.size() - 1);
+    }
+
+    template <typename VALUE_TYPE>
+    inline void TimingWheel<VALUE_TYPE>::FreeEntry(uint32_t index)
+    {
+        Entry& entry = m_entries[index];
+        entry.m_value = ValueType();
+        entry.m_list = FreeList;
+        entry.m_prev = InvalidIndex;
+        entry.m_next = m_freeHead;
+        ++entry.m_generation;
+        m_freeHead = index;
+    }
+
+    template <typename VALUE_TYPE>
+    inline void TimingWheel<VALUE_TYPE>::Schedule(uint32_t index)
+    {
+        int64_t expireTimeMs = m_entries[index].m_expireTimeMs;
+        if (expireTimeMs <= m_currentTimeMs)
+        {
+            PushBack(ExpiredList, index);
+            return;
+        }
+
+        // Pick the lowest level whose range covers the remaining time
+        const uint64_t remainingTimeMs = static_cast<uint64_t>(expireTimeMs - m_currentTimeMs);
+        uint32_t level = 0;
+        while ((level < LevelCount - 1) && (remainingTimeMs >= (uint64_t{ 1 } << (SlotBits * (level + 1)))))
+        {
+            ++level;
+        }
+
+        // Timers beyond the range of the highest level are parked at its furthest slot, they're rescheduled when it cascades
+        constexpr uint64_t MaxRemainingTimeMs = (uint64_t{ 1 } << (SlotBits * LevelCount)) - 1;
+        if (remainingTimeMs > MaxRemainingTimeMs)
+        {
+            expireTimeMs = m_currentTimeMs + static_cast<int64_t>(MaxRemainingTimeMs);
+        }
+
+        const uint32_t slot = static_cast<uint32_t>(static_cast<uint64_t>(expireTimeMs) >> (SlotBits * level)) & SlotMask;
+        PushBack(level * SlotsPerLevel + slot, index);
+    }
+
+    template <typename VALUE_TYPE>
+    inline void TimingWheel<VALUE_TYPE>::PushBack(uint32_t list, uint32_t index)
+    {
+        List& target = (list == ExpiredList) ? m_expired : m_slots[list];
+        Entry& entry = m_entries[index];
+        entry.m_list = list;
+        entry.m_prev = target.m_tail;
+        entry.m_next = InvalidIndex;
+        if (target.m_tail != InvalidIndex)
+        {
+            m_entries[target.m_tail].m_next = index;
+        }
+        else
+        {
+            target.m_head = index;
+        }
+        target.m_tail = index;
+
+        if (list == ExpiredList)
+        {
+            ++m_expiredCount;
+        }
+        else
+        {
+            ++m_pendingCount;
+            if (list < SlotsPerLevel)
+            {
+                m_occupiedSlots[list / BitmapWordBits] |= uint64_t{ 1 } << (list % BitmapWordBits);
+            }
+        }
+    }
+
+    template <typename VALUE_TYPE>
+    inline void TimingWheel<VALUE_TYPE>::Unlink(uint32_t index)
+    {
+        Entry& entry = m_entries[index];
+        const uint32_t list = entry.m_list;
+        List& source = (list == ExpiredList) ? m_expired : m_slots[list];
+        if (entry.m_prev != InvalidIndex)
+        {
+            m_entries[entry.m_prev].m_next = entry.m_next;
+        }
+        else
+        {
+            source.m_head = entry.m_next;
+        }
+        if (entry.m_next != InvalidIndex)
+        {
+            m_entries[entry.m_next].m_prev = entry.m_prev;
+        }
+        else
+        {
+            source.m_tail = entry.m_prev;
+        }
+        entry.m_prev = InvalidIndex;
+        entry.m_next = InvalidIndex;
+
+        if (list == ExpiredList)
+        {
+            --m_expiredCount;
+        }
+        else
+        {
+            --m_pendingCount;
+            if ((list < SlotsPerLevel) && (source.m_head == InvalidIndex))
+            {
+                m_occupiedSlots[list / BitmapWordBits] &= ~(uint64_t{ 1 } << (list % BitmapWordBits));
+            }
+        }
+    }
+
+    template <typename VALUE_TYPE>
+    inline void TimingWheel<VALUE_TYPE>::Cascade(uint32_t level)
+    {
+        const uint32_t slot = static_cast<uint32_t>(static_cast<uint64_t>(m_currentTimeMs) >> (SlotBits * level)) & SlotMask;
+        List& source = m_slots[level * SlotsPerLevel + slot];
+        while (source.m_head != InvalidIndex)
+        {
+            // Timers of the current slot expire within the range of the lower levels now, or they're parked again
+            const uint32_t index = source.m_head;
+            Unlink(index);
+            Schedule(index);
+        }
+
+        if ((slot == 0) && (level + 1 < LevelCount))
+        {
+            Cascade(level + 1);
+        }
+    }
+
+    template <typename VALUE_TYPE>
+    inline void TimingWheel<VALUE_TYPE>::ExpireSlot(uint32_t slot)
+    {
+        List& source = m_slots[slot];
+        while (source.m_head != InvalidIndex)
+        {
+            const uint32_t index = source.m_head;
+            Unlink(index);
+            PushBack(ExpiredList, index);
+        }
+    }
+
+    template <typename VALUE_TYPE>
+    inline uint32_t TimingWheel<VALUE_TYPE>::FindNextOccupiedSlot(uint32_t startSlot) const
+    {
+        if (startSlot >= SlotsPerLevel)
+        {
+            return SlotsPerLevel;
+        }
+        uint32_t word = startSlot / BitmapWordBits;
+        uint64_t bits = m_occupiedSlots[word] & (~uint64_t{ 0 } << (startSlot % BitmapWordBits));
+        for (;;)
+        {
+            if (bits != 0)
+            {
+                return word * BitmapWordBits + static_cast<uint32_t>(az_ctz_u64(bits));
+            }
+            if (++word >= BitmapWordsPerLevel)
+            {
+                return SlotsPerLevel;
+            }
+            bits = m_occupiedSlots[word];
+        }
+    }
+}
@@ -34,6 +34,7 @@ set(FILES
     Casting/numeric_cast_internal.h
     Component/Component.cpp
     Component/Component.h
+    Component/ComponentActivationProfilerInterface.h
     Component/ComponentApplication.cpp
     Component/ComponentApplication.h
     Component/ComponentApplicationBus.h
@@ -41,6 +42,8 @@ set(FILES
     Component/ComponentApplicationLifecycle.h
     Component/ComponentBus.cpp
     Component/ComponentBus.h
+    Component/ComponentDependencySortCache.cpp
+    Component/ComponentDependencySortCache.h
     Component/ComponentExport.h
     Component/Entity.cpp
     Component/Entity.h
@@ -56,6 +59,10 @@ set(FILES
     Component/NamedEntityId.h
     Component/NonUniformScaleBus.cpp
     Component/NonUniformScaleBus.h
+    Component/ParallelTick.cpp
+    Component/ParallelTick.h
+    Component/ParallelTickSystemComponent.cpp
+    Component/ParallelTickSystemComponent.h
     Component/TickBus.h
     Component/TransformBus.h
     Compression/compression.cpp
@@ -82,6 +89,7 @@ set(FILES
     Debug/Budget.cpp
     Debug/BudgetTracker.h
     Debug/BudgetTracker.cpp
+    Debug/HardwareCounters.h
     Debug/MemoryProfiler.h
     Debug/PerformanceCollector.h
     Debug/PerformanceCollector.cpp
@@ -95,6 +103,8 @@ set(FILES
     Debug/Timer.h
     Debug/Trace.cpp
     Debug/Trace.h
+    Debug/TraceAsyncOutput.cpp
+    Debug/TraceAsyncOutput.h
     Debug/TraceMessageBus.h
     Debug/TraceReflection.cpp
     Debug/TraceReflection.h
@@ -126,6 +136,7 @@ set(FILES
     EBus/BusImpl.h
     EBus/EBus.h
     EBus/EBusEnvironment.cpp
+    EBus/EBusReadMostlyDispatchTraits.h
     EBus/EBusSharedDispatchTraits.h
     EBus/Environment.h
     EBus/Event.h
@@ -149,6 +160,8 @@ set(FILES
     Instance/InstancePool.h
     Interface/Interface.h
     IO/ByteContainerStream.h
+    IO/ChunkedCompression.cpp
+    IO/ChunkedCompression.h
     IO/CompressionBus.h
     IO/CompressionBus.cpp
     IO/Compressor.cpp
@@ -165,6 +178,8 @@ set(FILES
     IO/FileReader.h
     IO/IOUtils.h
     IO/IOUtils.cpp
+    IO/MappedFile.cpp
+    IO/MappedFile.h
     IO/IStreamer.h
     IO/IStreamerProfiler.h
     IO/IStreamerTypes.h
@@ -187,6 +202,8 @@ set(FILES
     IO/TextStreamWriters.h
     IO/Streamer/BlockCache.h
     IO/Streamer/BlockCache.cpp
+    IO/Streamer/ChunkedDecompressor.h
+    IO/Streamer/ChunkedDecompressor.cpp
     IO/Streamer/DedicatedCache.h
     IO/Streamer/DedicatedCache.cpp
     IO/Streamer/FileRange.h
@@ -212,6 +229,8 @@ set(FILES
     IO/Streamer/Streamer.h
     IO/Streamer/StreamerContext.h
     IO/Streamer/StreamerContext.cpp
+    IO/Streamer/StreamerTrace.h
+    IO/Streamer/StreamerTrace.cpp
     IO/Streamer/StreamerComponent.cpp
     IO/Streamer/StreamerComponent.h
     IO/Streamer/StreamStackEntry.h
@@ -219,6 +238,7 @@ set(FILES
     IPC/SharedMemory.cpp
     IPC/SharedMemory.h
     Jobs/Algorithms.h
+    Jobs/Internal/JobFiber.h
     Jobs/Internal/JobManagerBase.cpp
     Jobs/Internal/JobManagerBase.h
     Jobs/Internal/JobManagerWorkStealing.cpp
@@ -303,6 +323,8 @@ set(FILES
     Math/Internal/SimdMathVec4_neon.inl
     Math/Internal/SimdMathVec4_scalar.inl
     Math/Internal/SimdMathVec4_sse.inl
+    Math/Internal/SimdMathVec8_avx.inl
+    Math/Internal/SimdMathVec8_vec4.inl
     Math/Internal/SimdMathCommon_neon.inl
     Math/Internal/SimdMathCommon_neonDouble.inl
     Math/Internal/SimdMathCommon_neonQuad.inl
@@ -317,6 +339,8 @@ set(FILES
     Math/IntersectSegment.h
     Math/LineSegment.cpp
     Math/LineSegment.h
+    Math/MathBatch.cpp
+    Math/MathBatch.h
     Math/MathIntrinsics.h
     Math/MathReflection.cpp
     Math/MathReflection.h
@@ -365,6 +389,7 @@ set(FILES
     Math/SimdMathVec2.h
     Math/SimdMathVec3.h
     Math/SimdMathVec4.h
+    Math/SimdMathVec8.h
     Math/Sha1.h
     Math/Spline.cpp
     Math/Spline.h
@@ -411,6 +436,8 @@ set(FILES
     Memory/ChildAllocatorSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
     Memory/HphaAllocator.cpp
     Memory/HphaAllocator.h
     Memory/IAllocator.h
@@ -421,6 +448,8 @@ set(FILES
     Memory/NewAndDelete.inl
     Memory/OSAllocator.cpp
     Memory/OSAllocator.h
+    Memory/OSMemory.cpp
+    Memory/OSMemory.h
     Memory/PoolAllocator.cpp
     Memory/PoolAllocator.h
     Memory/SimpleSchemaAllocator.h
@@ -548,6 +577,8 @@ set(FILES
     Serialization/EditContextConstants.inl
     Serialization/IdUtils.inl
     Serialization/IdUtils.h
+    Serialization/InPlaceData.cpp
+    Serialization/InPlaceData.h
     Serialization/Utils.h
     Serialization/SerializationUtils.cpp
     Serialization/ObjectStream.cpp
@@ -637,6 +668,8 @@ set(FILES
     Settings/SettingsRegistryOriginTracker.h
     Settings/SettingsRegistryScriptUtils.cpp
     Settings/SettingsRegistryScriptUtils.h
+    Settings/SettingsRegistrySnapshot.cpp
+    Settings/SettingsRegistrySnapshot.h
     Settings/SettingsRegistryVisitorUtils.cpp
     Settings/SettingsRegistryVisitorUtils.h
     Settings/TextParser.cpp
@@ -678,6 +711,7 @@ set(FILES
     Task/TaskGraph.cpp
     Task/TaskGraph.h
     Task/TaskGraph.inl
+    Task/TaskGraphAlgorithms.h
     Task/TaskGraphSystemComponent.h
     Task/TaskGraphSystemComponent.cpp
     Threading/ThreadSafeDeque.h
@@ -689,6 +723,8 @@ set(FILES
     Time/ITime.h
     Time/TimeSystem.cpp
     Time/TimeSystem.h
+    Time/TimingWheel.h
+    Time/TimingWheel.inl
     UserSettings/UserSettings.cpp
     UserSettings/UserSettings.h
     UserSettings/UserSettingsComponent.cpp
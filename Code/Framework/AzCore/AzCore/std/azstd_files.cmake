@@ -95,6 +95,9 @@ set(FILES
     containers/fixed_unordered_map.h
     containers/fixed_unordered_set.h
     containers/fixed_vector.h
+    containers/flat_hash_map.h
+    containers/flat_hash_set.h
+    containers/flat_hash_table.h
     containers/forward_list.h
     containers/intrusive_list.h
     containers/intrusive_set.h
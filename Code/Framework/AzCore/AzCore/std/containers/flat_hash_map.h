@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/flat_hash_table.h>
+#include <AzCore/std/tuple.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashMapTableTraits
+        {
+            using key_type = Key;
+            using key_equal = EqualKey;
+            using hasher = Hasher;
+            using mapped_type = MappedType;
+            using value_type = AZStd::pair<Key, MappedType>;
+            using allocator_type = Allocator;
+            static constexpr bool is_set = false;
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value.first; }
+        };
+    }
+
+    /**
+     * Hash map that stores its elements in a single open addressing array instead of one node per element.
+     * It has the same interface as \ref unordered_map without the bucket interface, and is much more cache friendly
+     * for lookups in large maps with small values.
+     * \note Unlike unordered_map, any insertion can move the elements, which invalidates all iterators, pointers and
+     * references to them. Keep using unordered_map when stable element addresses are needed.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_map
+        : public Internal::flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>>
+    {
+        using this_type = flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>;
+        using base_type = Internal::flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>>;
+    public:
+        using key_type = typename base_type::key_type;
+        using mapped_type = MappedType;
+        using value_type = typename base_type::value_type;
+        using hasher = typename base_type::hasher;
+        using key_equal = typename base_type::key_equal;
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        flat_hash_map() = default;
+
+        explicit flat_hash_map(size_type capacity, const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(capacity, hash, keyEqual, allocator)
+        {
+        }
+
+        explicit flat_hash_map(const allocator_type& allocator)
+            : base_type(0, hasher(), key_equal(), allocator)
+        {
+        }
+
+        template<class InputIterator>
+        flat_hash_map(InputIterator first, InputIterator last, size_type capacity = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(capacity, hash, keyEqual, allocator)
+        {
+            base_type::insert(first, last);
+        }
+
+        flat_hash_map(std::initializer_list<value_type> list, size_type capacity = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(capacity, hash, keyEqual, allocator)
+        {
+            base_type::insert(list);
+        }
+
+        flat_hash_map(const flat_hash_map&) = default;
+        flat_hash_map(flat_hash_map&&) = default;
+        flat_hash_map& operator=(const flat_hash_map&) = default;
+        flat_hash_map& operator=(flat_hash_map&&) = default;
+
+        using base_type::insert;
+
+        template<class M>
+        AZStd::pair<iterator, bool> insert_or_assign(const key_type& key, M&& value)
+        {
+            AZStd::pair<iterator, bool> result = try_emplace(key, AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+
+        template<class M>
+        AZStd::pair<iterator, bool> insert_or_assign(key_type&& key, M&& value)
+        {
+            AZStd::pair<iterator, bool> result = try_emplace(AZStd::move(key), AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+
+        //! Only constructs the value when there is no element with the key.
+        template<class... Args>
+        AZStd::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+        {
+            return base_type::EmplaceUnique(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(key),
+                AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+        }
+
+        template<class... Args>
+        AZStd::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args)
+        {
+            // The key is only moved from after the lookup failed.
+            return base_type::EmplaceUnique(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::move(key)),
+                AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+        }
+
+        mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+
+        mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(AZStd::move(key)).first->second;
+        }
+
+        mapped_type& at(const key_type& key)
+        {
+            iterator it = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(it != base_type::end(), "Element with key is not present");
+            return it->second;
+        }
+
+        const mapped_type& at(const key_type& key) const
+        {
+            const_iterator it = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(it != base_type::end(), "Element with key is not present");
+            return it->second;
+        }
+    };
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& left, flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+} // namespace AZStd
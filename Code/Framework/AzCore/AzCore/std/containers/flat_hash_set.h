@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/flat_hash_table.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashSetTableTraits
+        {
+            using key_type = Key;
+            using key_equal = EqualKey;
+            using hasher = Hasher;
+            using value_type = Key;
+            using allocator_type = Allocator;
+            static constexpr bool is_set = true;
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value; }
+        };
+    }
+
+    /**
+     * Hash set that stores its elements in a single open addressing array instead of one node per element.
+     * It has the same interface as \ref unordered_set without the bucket interface.
+     * \note Unlike unordered_set, any insertion can move the elements, which invalidates all iterators, pointers and
+     * references to them.
+     */
+    template<class Key, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_set
+        : public Internal::flat_hash_table<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator>>
+    {
+        using base_type = Internal::flat_hash_table<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator>>;
+    public:
+        using key_type = typename base_type::key_type;
+        using value_type = typename base_type::value_type;
+        using hasher = typename base_type::hasher;
+        using key_equal = typename base_type::key_equal;
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        flat_hash_set() = default;
+
+        explicit flat_hash_set(size_type capacity, const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(capacity, hash, keyEqual, allocator)
+        {
+        }
+
+        explicit flat_hash_set(const allocator_type& allocator)
+            : base_type(0, hasher(), key_equal(), allocator)
+        {
+        }
+
+        template<class InputIterator>
+        flat_hash_set(InputIterator first, InputIterator last, size_type capacity = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(capacity, hash, keyEqual, allocator)
+        {
+            base_type::insert(first, last);
+        }
+
+        flat_hash_set(std::initializer_list<value_type> list, size_type capacity = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(capacity, hash, keyEqual, allocator)
+        {
+            base_type::insert(list);
+        }
+
+        flat_hash_set(const flat_hash_set&) = default;
+        flat_hash_set(flat_hash_set&&) = default;
+        flat_hash_set& operator=(const flat_hash_set&) = default;
+        flat_hash_set& operator=(flat_hash_set&&) = default;
+    };
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_set<Key, Hasher, EqualKey, Allocator>& left, flat_hash_set<Key, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+} // namespace AZStd
@@ -0,0 +1,776 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/typetraits/alignment_of.h>
+#include <AzCore/std/utils.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   include <emmintrin.h>
+#endif
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        /**
+         * Open addressing hash table in the style of the Swiss tables from Abseil.
+         * Every slot has a control byte, which is either empty, deleted or holds 7 bits of the hash of the value in the slot.
+         * Lookups compare a whole group of control bytes at once and only compare the keys of the slots whose hash bits match.
+         * The values are stored in a single allocation, so unlike \ref hash_table the values move when the table grows,
+         * and iterators, pointers and references are invalidated by any insertion.
+         */
+        namespace FlatHashControl
+        {
+            using ctrl_t = int8_t;
+
+            static constexpr ctrl_t Empty = -128; // 0b10000000
+            static constexpr ctrl_t Deleted = -2; // 0b11111110
+            static constexpr ctrl_t Sentinel = -1; // 0b11111111, marks the end of the control bytes for the iterators.
+
+            AZ_FORCE_INLINE bool IsFull(ctrl_t ctrl) { return ctrl >= 0; }
+            AZ_FORCE_INLINE bool IsEmptyOrDeleted(ctrl_t ctrl) { return ctrl < Sentinel; }
+        }
+
+        //! Set of matching group positions, which can be iterated with a range based for loop.
+        template<class MaskType, size_t Width, int Shift>
+        class FlatHashBitMask
+        {
+        public:
+            explicit FlatHashBitMask(MaskType mask) : m_mask(mask) {}
+
+            explicit operator bool() const { return m_mask != 0; }
+
+            uint32_t LowestBitSet() const { return CountTrailingZeros() >> Shift; }
+            uint32_t TrailingZeros() const { return m_mask ? (CountTrailingZeros() >> Shift) : static_cast<uint32_t>(Width); }
+            uint32_t LeadingZeros() const
+            {
+                constexpr uint32_t unusedBits = sizeof(MaskType) * 8 - (Width << Shift);
+                return m_mask ? ((CountLeadingZeros() - unusedBits) >> Shift) : static_cast<uint32_t>(Width);
+            }
+
+            FlatHashBitMask begin() const { return *this; }
+            FlatHashBitMask end() const { return FlatHashBitMask(0); }
+            uint32_t operator*() const { return LowestBitSet(); }
+            FlatHashBitMask& operator++() { m_mask &= (m_mask - 1); return *this; }
+            bool operator!=(const FlatHashBitMask& rhs) const { return m_mask != rhs.m_mask; }
+
+        private:
+            uint32_t CountTrailingZeros() const
+            {
+                if constexpr (sizeof(MaskType) == 8)
+                {
+                    return static_cast<uint32_t>(az_ctz_u64(m_mask));
+                }
+                else
+                {
+                    return static_cast<uint32_t>(az_ctz_u32(m_mask));
+                }
+            }
+
+            uint32_t CountLeadingZeros() const
+            {
+                if constexpr (sizeof(MaskType) == 8)
+                {
+                    return static_cast<uint32_t>(az_clz_u64(m_mask));
+                }
+                else
+                {
+                    return static_cast<uint32_t>(az_clz_u32(m_mask));
+                }
+            }
+
+            MaskType m_mask;
+        };
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        //! Compares 16 control bytes at once with SSE2.
+        struct FlatHashGroup
+        {
+            static constexpr size_t Width = 16;
+            using BitMask = FlatHashBitMask<uint32_t, Width, 0>;
+
+            explicit FlatHashGroup(const FlatHashControl::ctrl_t* ctrl)
+                : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+            {
+            }
+
+            BitMask Match(FlatHashControl::ctrl_t hash) const
+            {
+                return BitMask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hash), m_ctrl))));
+            }
+
+            BitMask MatchEmpty() const
+            {
+                return Match(FlatHashControl::Empty);
+            }
+
+            BitMask MatchEmptyOrDeleted() const
+            {
+                return BitMask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(FlatHashControl::Sentinel), m_ctrl))));
+            }
+
+            __m128i m_ctrl;
+        };
+#else
+        //! Compares 8 control bytes at once with 64 bit integer operations.
+        struct FlatHashGroup
+        {
+            static constexpr size_t Width = 8;
+            using BitMask = FlatHashBitMask<uint64_t, Width, 3>;
+
+            static constexpr uint64_t LowBits = 0x0101010101010101ull;
+            static constexpr uint64_t HighBits = 0x8080808080808080ull;
+
+            explicit FlatHashGroup(const FlatHashControl::ctrl_t* ctrl)
+            {
+                memcpy(&m_ctrl, ctrl, sizeof(m_ctrl));
+            }
+
+            BitMask Match(FlatHashControl::ctrl_t hash) const
+            {
+                // This can report a false positive for a byte directly after a match, which is fine because the keys get compared.
+                const uint64_t x = m_ctrl ^ (LowBits * static_cast<uint8_t>(hash));
+                return BitMask((x - LowBits) & ~x & HighBits);
+            }
+
+            BitMask MatchEmpty() const
+            {
+                // Empty is the only value with the high bit set and the second lowest bit cleared.
+                return BitMask((m_ctrl & (~m_ctrl << 6)) & HighBits);
+            }
+
+            BitMask MatchEmptyOrDeleted() const
+            {
+                // Empty and Deleted are the only values with the high bit set and the lowest bit cleared.
+                return BitMask((m_ctrl & (~m_ctrl << 7)) & HighBits);
+            }
+
+            uint64_t m_ctrl;
+        };
+#endif
+
+        /**
+         * Shared implementation of flat_hash_map and flat_hash_set. Traits must provide key_type, value_type, hasher,
+         * key_equal, allocator_type, is_set and a static key_from_value function.
+         */
+        template<class Traits>
+        class flat_hash_table
+        {
+            using this_type = flat_hash_table<Traits>;
+            using ctrl_t = FlatHashControl::ctrl_t;
+            using Group = FlatHashGroup;
+
+        public:
+            using key_type = typename Traits::key_type;
+            using value_type = typename Traits::value_type;
+            using hasher = typename Traits::hasher;
+            using key_equal = typename Traits::key_equal;
+            using allocator_type = typename Traits::allocator_type;
+
+            using size_type = AZStd::size_t;
+            using difference_type = AZStd::ptrdiff_t;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using pointer = value_type*;
+            using const_pointer = const value_type*;
+
+            template<bool IsConst>
+            class iterator_impl
+            {
+                friend class flat_hash_table;
+                template<bool>
+                friend class iterator_impl;
+
+            public:
+                using iterator_category = AZStd::forward_iterator_tag;
+                using value_type = typename Traits::value_type;
+                using difference_type = AZStd::ptrdiff_t;
+                using pointer = AZStd::conditional_t<IsConst, const value_type*, value_type*>;
+                using reference = AZStd::conditional_t<IsConst, const value_type&, value_type&>;
+
+                iterator_impl() = default;
+
+                template<bool OtherIsConst, class = AZStd::enable_if_t<IsConst && !OtherIsConst>>
+                iterator_impl(const iterator_impl<OtherIsConst>& rhs)
+                    : m_ctrl(rhs.m_ctrl)
+                    , m_slot(rhs.m_slot)
+                {
+                }
+
+                reference operator*() const { return *m_slot; }
+                pointer operator->() const { return m_slot; }
+
+                iterator_impl& operator++()
+                {
+                    ++m_ctrl;
+                    ++m_slot;
+                    SkipEmptyOrDeleted();
+                    return *this;
+                }
+
+                iterator_impl operator++(int)
+                {
+                    iterator_impl result = *this;
+                    ++*this;
+                    return result;
+                }
+
+                friend bool operator==(const iterator_impl& lhs, const iterator_impl& rhs) { return lhs.m_ctrl == rhs.m_ctrl; }
+                friend bool operator!=(const iterator_impl& lhs, const iterator_impl& rhs) { return lhs.m_ctrl != rhs.m_ctrl; }
+
+            private:
+                iterator_impl(const ctrl_t* ctrl, value_type* slot)
+                    : m_ctrl(ctrl)
+                    , m_slot(slot)
+                {
+                }
+
+                void SkipEmptyOrDeleted()
+                {
+                    // The sentinel after the last slot stops the loop.
+                    while (FlatHashControl::IsEmptyOrDeleted(*m_ctrl))
+                    {
+                        ++m_ctrl;
+                        ++m_slot;
+                    }
+                }
+
+                const ctrl_t* m_ctrl = nullptr;
+                value_type* m_slot = nullptr;
+            };
+
+            using const_iterator = iterator_impl<true>;
+            using iterator = AZStd::conditional_t<Traits::is_set, const_iterator, iterator_impl<false>>;
+
+            flat_hash_table() = default;
+
+            flat_hash_table(size_type capacity, const hasher& hash, const key_equal& keyEqual, const allocator_type& allocator)
+                : m_hasher(hash)
+                , m_keyEqual(keyEqual)
+                , m_allocator(allocator)
+            {
+                reserve(capacity);
+            }
+
+            flat_hash_table(const flat_hash_table& rhs)
+                : m_hasher(rhs.m_hasher)
+                , m_keyEqual(rhs.m_keyEqual)
+                , m_allocator(rhs.m_allocator)
+            {
+                CopyFrom(rhs);
+            }
+
+            flat_hash_table(flat_hash_table&& rhs)
+                : m_hasher(AZStd::move(rhs.m_hasher))
+                , m_keyEqual(AZStd::move(rhs.m_keyEqual))
+                , m_allocator(AZStd::move(rhs.m_allocator))
+            {
+                StealFrom(rhs);
+            }
+
+            ~flat_hash_table()
+            {
+                DestroyAndDeallocate();
+            }
+
+            flat_hash_table& operator=(const flat_hash_table& rhs)
+            {
+                if (this != &rhs)
+                {
+                    clear();
+                    m_hasher = rhs.m_hasher;
+                    m_keyEqual = rhs.m_keyEqual;
+                    CopyFrom(rhs);
+                }
+                return *this;
+            }
+
+            flat_hash_table& operator=(flat_hash_table&& rhs)
+            {
+                if (this != &rhs)
+                {
+                    DestroyAndDeallocate();
+                    m_hasher = AZStd::move(rhs.m_hasher);
+                    m_keyEqual = AZStd::move(rhs.m_keyEqual);
+                    m_allocator = AZStd::move(rhs.m_allocator);
+                    StealFrom(rhs);
+                }
+                return *this;
+            }
+
+            iterator begin()
+            {
+                if (m_size == 0)
+                {
+                    return end();
+                }
+                iterator it(m_ctrl, m_slots);
+                it.SkipEmptyOrDeleted();
+                return it;
+            }
+            const_iterator begin() const { return const_cast<this_type*>(this)->begin(); }
+            const_iterator cbegin() const { return begin(); }
+            iterator end() { return iterator(m_ctrl + m_capacity, m_slots + m_capacity); }
+            const_iterator end() const { return const_cast<this_type*>(this)->end(); }
+            const_iterator cend() const { return end(); }
+
+            bool empty() const { return m_size == 0; }
+            size_type size() const { return m_size; }
+            size_type max_size() const { return AZStd::numeric_limits<difference_type>::max() / sizeof(value_type); }
+            //! Number of slots, the table grows when more than 7/8 of them are used.
+            size_type capacity() const { return m_capacity; }
+            float load_factor() const { return m_capacity ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.0f; }
+
+            hasher hash_function() const { return m_hasher; }
+            key_equal key_eq() const { return m_keyEqual; }
+            allocator_type get_allocator() const { return m_allocator; }
+
+            void clear()
+            {
+                if (m_capacity == 0)
+                {
+                    return;
+                }
+                DestroyValues();
+                ResetCtrl();
+                m_size = 0;
+                m_growthLeft = CapacityToGrowth(m_capacity);
+            }
+
+            //! Makes sure that count elements can be stored without growing the table.
+            void reserve(size_type count)
+            {
+                if (count > m_size + m_growthLeft)
+                {
+                    Resize(NormalizeCapacity(GrowthToLowerboundCapacity(count)));
+                }
+            }
+
+            //! Resizes the table to at least the given number of slots, which also removes the deleted slots.
+            void rehash(size_type capacity)
+            {
+                if (capacity == 0 && m_size == 0)
+                {
+                    DestroyAndDeallocate();
+                    return;
+                }
+                Resize(NormalizeCapacity(AZStd::max(capacity, GrowthToLowerboundCapacity(m_size))));
+            }
+
+            AZStd::pair<iterator, bool> insert(const value_type& value)
+            {
+                return EmplaceUnique(Traits::key_from_value(value), value);
+            }
+
+            AZStd::pair<iterator, bool> insert(value_type&& value)
+            {
+                return EmplaceUnique(Traits::key_from_value(value), AZStd::move(value));
+            }
+
+            iterator insert(const_iterator, const value_type& value)
+            {
+                return insert(value).first;
+            }
+
+            iterator insert(const_iterator, value_type&& value)
+            {
+                return insert(AZStd::move(value)).first;
+            }
+
+            template<class InputIterator>
+            void insert(InputIterator first, InputIterator last)
+            {
+                for (; first != last; ++first)
+                {
+                    insert(*first);
+                }
+            }
+
+            void insert(std::initializer_list<value_type> list)
+            {
+                reserve(m_size + list.size());
+                insert(list.begin(), list.end());
+            }
+
+            template<class... Args>
+            AZStd::pair<iterator, bool> emplace(Args&&... args)
+            {
+                // The key is needed to look for an existing element, so the value is constructed first.
+                value_type value(AZStd::forward<Args>(args)...);
+                return insert(AZStd::move(value));
+            }
+
+            template<class... Args>
+            iterator emplace_hint(const_iterator, Args&&... args)
+            {
+                return emplace(AZStd::forward<Args>(args)...).first;
+            }
+
+            iterator find(const key_type& key)
+            {
+                const size_type slot = FindSlot(key, HashKey(key));
+                return slot != InvalidSlot ? IteratorAt(slot) : end();
+            }
+
+            const_iterator find(const key_type& key) const
+            {
+                return const_cast<this_type*>(this)->find(key);
+            }
+
+            bool contains(const key_type& key) const
+            {
+                return FindSlot(key, HashKey(key)) != InvalidSlot;
+            }
+
+            size_type count(const key_type& key) const
+            {
+                return contains(key) ? 1 : 0;
+            }
+
+            iterator erase(const_iterator it)
+            {
+                iterator next(it.m_ctrl, const_cast<value_type*>(it.m_slot));
+                ++next;
+                EraseSlot(static_cast<size_type>(it.m_ctrl - m_ctrl));
+                return next;
+            }
+
+            iterator erase(const_iterator first, const_iterator last)
+            {
+                while (first != last)
+                {
+                    first = erase(first);
+                }
+                return iterator(last.m_ctrl, const_cast<value_type*>(last.m_slot));
+            }
+
+            size_type erase(const key_type& key)
+            {
+                const size_type slot = FindSlot(key, HashKey(key));
+                if (slot == InvalidSlot)
+                {
+                    return 0;
+                }
+                EraseSlot(slot);
+                return 1;
+            }
+
+            void swap(this_type& rhs)
+            {
+                AZStd::swap(m_ctrl, rhs.m_ctrl);
+                AZStd::swap(m_slots, rhs.m_slots);
+                AZStd::swap(m_size, rhs.m_size);
+                AZStd::swap(m_capacity, rhs.m_capacity);
+                AZStd::swap(m_growthLeft, rhs.m_growthLeft);
+                AZStd::swap(m_hasher, rhs.m_hasher);
+                AZStd::swap(m_keyEqual, rhs.m_keyEqual);
+                AZStd::swap(m_allocator, rhs.m_allocator);
+            }
+
+            friend bool operator==(const this_type& lhs, const this_type& rhs)
+            {
+                if (lhs.size() != rhs.size())
+                {
+                    return false;
+                }
+                for (const value_type& value : lhs)
+                {
+                    const_iterator it = rhs.find(Traits::key_from_value(value));
+                    if (it == rhs.end() || !(*it == value))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            friend bool operator!=(const this_type& lhs, const this_type& rhs)
+            {
+                return !(lhs == rhs);
+            }
+
+        protected:
+            static constexpr size_type InvalidSlot = AZStd::numeric_limits<size_type>::max();
+
+            //! Inserts a new element constructed from args when there is no element with the key.
+            template<class... Args>
+            AZStd::pair<iterator, bool> EmplaceUnique(const key_type& key, Args&&... args)
+            {
+                const size_t hash = HashKey(key);
+                const size_type existingSlot = FindSlot(key, hash);
+                if (existingSlot != InvalidSlot)
+                {
+                    return { IteratorAt(existingSlot), false };
+                }
+
+                const size_type slot = PrepareInsert(hash);
+                AZStd::construct_at(m_slots + slot, AZStd::forward<Args>(args)...);
+                return { IteratorAt(slot), true };
+            }
+
+            iterator IteratorAt(size_type slot)
+            {
+                return iterator(m_ctrl + slot, m_slots + slot);
+            }
+
+        private:
+            static constexpr size_type MinCapacity = Group::Width - 1;
+            static constexpr size_type NumClonedBytes = Group::Width - 1;
+
+            static ctrl_t H2(size_t hash) { return static_cast<ctrl_t>(hash & 0x7F); }
+            static size_t H1(size_t hash) { return hash >> 7; }
+
+            // Capacities are always 2^n - 1, so they can be used as a mask for the probe positions.
+            static size_type NormalizeCapacity(size_type count)
+            {
+                size_type capacity = MinCapacity;
+                while (capacity < count)
+                {
+                    capacity = capacity * 2 + 1;
+                }
+                return capacity;
+            }
+
+            // At least one slot must stay empty to end the probe sequences, capacity / 8 is 0 for the smallest 8 wide table.
+            static size_type CapacityToGrowth(size_type capacity)
+            {
+                return (Group::Width == 8 && capacity == 7) ? 6 : capacity - capacity / 8;
+            }
+
+            static size_type GrowthToLowerboundCapacity(size_type growth)
+            {
+                return (Group::Width == 8 && growth == 7) ? 8 : growth + (growth > 0 ? (growth - 1) / 7 : 0);
+            }
+
+            size_t HashKey(const key_type& key) const
+            {
+                // Mix the hash, the identity hashes of integers would otherwise only fill a few bits of H2.
+                uint64_t hash = static_cast<uint64_t>(m_hasher(key));
+                hash ^= hash >> 33;
+                hash *= 0xff51afd7ed558ccdull;
+                hash ^= hash >> 33;
+                return static_cast<size_t>(hash);
+            }
+
+            size_type FindSlot(const key_type& key, size_t hash) const
+            {
+                if (m_capacity == 0)
+                {
+                    return InvalidSlot;
+                }
+
+                size_type offset = H1(hash) & m_capacity;
+                size_type probeIndex = 0;
+                for (;;)
+                {
+                    const Group group(m_ctrl + offset);
+                    for (uint32_t i : group.Match(H2(hash)))
+                    {
+                        const size_type slot = (offset + i) & m_capacity;
+                        if (m_keyEqual(Traits::key_from_value(m_slots[slot]), key))
+                        {
+                            return slot;
+                        }
+                    }
+                    if (group.MatchEmpty())
+                    {
+                        return InvalidSlot;
+                    }
+                    probeIndex += Group::Width;
+                    offset = (offset + probeIndex) & m_capacity;
+                }
+            }
+
+            size_type FindFirstNonFull(size_t hash) const
+            {
+                size_type offset = H1(hash) & m_capacity;
+                size_type probeIndex = 0;
+                for (;;)
+                {
+                    const auto mask = Group(m_ctrl + offset).MatchEmptyOrDeleted();
+                    if (mask)
+                    {
+                        return (offset + mask.LowestBitSet()) & m_capacity;
+                    }
+                    probeIndex += Group::Width;
+                    offset = (offset + probeIndex) & m_capacity;
+                }
+            }
+
+            size_type PrepareInsert(size_t hash)
+            {
+                if (m_capacity == 0)
+                {
+                    Resize(MinCapacity);
+                }
+
+                size_type slot = FindFirstNonFull(hash);
+                if (m_growthLeft == 0 && m_ctrl[slot] != FlatHashControl::Deleted)
+                {
+                    // Rehash in place when at least half of the used slots are deleted, otherwise grow.
+                    Resize(m_size * 2 <= CapacityToGrowth(m_capacity) ? m_capacity : m_capacity * 2 + 1);
+                    slot = FindFirstNonFull(hash);
+                }
+
+                ++m_size;
+                m_growthLeft -= (m_ctrl[slot] == FlatHashControl::Empty) ? 1 : 0;
+                SetCtrl(slot, H2(hash));
+                return slot;
+            }
+
+            void SetCtrl(size_type slot, ctrl_t value)
+            {
+                // The first bytes are cloned after the sentinel, so groups can be loaded at any position without wrapping.
+                m_ctrl[slot] = value;
+                m_ctrl[((slot - NumClonedBytes) & m_capacity) + NumClonedBytes] = value;
+            }
+
+            void ResetCtrl()
+            {
+                memset(m_ctrl, FlatHashControl::Empty, m_capacity + Group::Width);
+                m_ctrl[m_capacity] = FlatHashControl::Sentinel;
+            }
+
+            void EraseSlot(size_type slot)
+            {
+                AZStd::destroy_at(m_slots + slot);
+                --m_size;
+
+                // The slot can become empty again when no probe sequence could have passed it while searching for an
+                // empty slot, which is the case when there is an empty slot in the group window around it.
+                const size_type slotBefore = (slot - Group::Width) & m_capacity;
+                const auto emptyAfter = Group(m_ctrl + slot).MatchEmpty();
+                const auto emptyBefore = Group(m_ctrl + slotBefore).MatchEmpty();
+                const bool wasNeverFull = emptyBefore && emptyAfter &&
+                    (emptyAfter.TrailingZeros() + emptyBefore.LeadingZeros()) < Group::Width;
+
+                SetCtrl(slot, wasNeverFull ? FlatHashControl::Empty : FlatHashControl::Deleted);
+                m_growthLeft += wasNeverFull ? 1 : 0;
+            }
+
+            void Allocate(size_type capacity)
+            {
+                m_capacity = capacity;
+                const size_type slotOffset = SlotOffset(capacity);
+                void* memory = m_allocator.allocate(slotOffset + capacity * sizeof(value_type), alignment_of<value_type>::value);
+                m_ctrl = reinterpret_cast<ctrl_t*>(memory);
+                m_slots = reinterpret_cast<value_type*>(reinterpret_cast<char*>(memory) + slotOffset);
+                ResetCtrl();
+                m_growthLeft = CapacityToGrowth(capacity) - m_size;
+            }
+
+            void Deallocate(ctrl_t* ctrl, size_type capacity)
+            {
+                m_allocator.deallocate(ctrl, SlotOffset(capacity) + capacity * sizeof(value_type), alignment_of<value_type>::value);
+            }
+
+            static size_type SlotOffset(size_type capacity)
+            {
+                constexpr size_type alignment = alignment_of<value_type>::value;
+                return (capacity + Group::Width + alignment - 1) & ~(alignment - 1);
+            }
+
+            void Resize(size_type newCapacity)
+            {
+                ctrl_t* oldCtrl = m_ctrl;
+                value_type* oldSlots = m_slots;
+                const size_type oldCapacity = m_capacity;
+
+                Allocate(newCapacity);
+                for (size_type i = 0; i < oldCapacity; ++i)
+                {
+                    if (FlatHashControl::IsFull(oldCtrl[i]))
+                    {
+                        const size_t hash = HashKey(Traits::key_from_value(oldSlots[i]));
+                        const size_type slot = FindFirstNonFull(hash);
+                        SetCtrl(slot, H2(hash));
+                        AZStd::construct_at(m_slots + slot, AZStd::move(oldSlots[i]));
+                        AZStd::destroy_at(oldSlots + i);
+                    }
+                }
+
+                if (oldCapacity > 0)
+                {
+                    Deallocate(oldCtrl, oldCapacity);
+                }
+            }
+
+            void CopyFrom(const flat_hash_table& rhs)
+            {
+                reserve(rhs.size());
+                for (const value_type& value : rhs)
+                {
+                    // The keys are known to be unique, so the values can be placed without looking for them.
+                    const size_type slot = PrepareInsert(HashKey(Traits::key_from_value(value)));
+                    AZStd::construct_at(m_slots + slot, value);
+                }
+            }
+
+            void StealFrom(flat_hash_table& rhs)
+            {
+                m_ctrl = rhs.m_ctrl;
+                m_slots = rhs.m_slots;
+                m_size = rhs.m_size;
+                m_capacity = rhs.m_capacity;
+                m_growthLeft = rhs.m_growthLeft;
+                rhs.m_ctrl = nullptr;
+                rhs.m_slots = nullptr;
+                rhs.m_size = 0;
+                rhs.m_capacity = 0;
+                rhs.m_growthLeft = 0;
+            }
+
+            void DestroyValues()
+            {
+                if constexpr (!AZStd::is_trivially_destructible_v<value_type>)
+                {
+                    for (size_type i = 0; i < m_capacity; ++i)
+                    {
+                        if (FlatHashControl::IsFull(m_ctrl[i]))
+                        {
+                            AZStd::destroy_at(m_slots + i);
+                        }
+                    }
+                }
+            }
+
+            void DestroyAndDeallocate()
+            {
+                if (m_capacity == 0)
+                {
+                    return;
+                }
+                DestroyValues();
+                Deallocate(m_ctrl, m_capacity);
+                m_ctrl = nullptr;
+                m_slots = nullptr;
+                m_size = 0;
+                m_capacity = 0;
+                m_growthLeft = 0;
+            }
+
+            ctrl_t* m_ctrl = nullptr;
+            value_type* m_slots = nullptr;
+            size_type m_size = 0;
+            size_type m_capacity = 0;
+            size_type m_growthLeft = 0;
+            hasher m_hasher;
+            key_equal m_keyEqual;
+            allocator_type m_allocator;
+        };
+    } // namespace Internal
+} // namespace AZStd
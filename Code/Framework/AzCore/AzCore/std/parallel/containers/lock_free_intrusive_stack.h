@@ -112,6 +112,11 @@ namespace AZStd
         ///a pointer to the popped value
         pointer pop();
 
+        ///Detaches all values from the stack with a single atomic operation. Returns the former top of the stack or
+        ///NULL if it was empty, the detached values stay linked through their hook nodes. The caller owns the chain and
+        ///is responsible for clearing the hook nodes in debug builds.
+        pointer pop_all();
+
         ///Tests if the stack is empty, limited utility for a concurrent container.
         bool empty() const;
 
@@ -196,6 +201,12 @@ namespace AZStd
         }
     }
 
+    template<typename T, typename Hook>
+    inline typename lock_free_intrusive_stack<T, Hook>::pointer lock_free_intrusive_stack<T, Hook>::pop_all()
+    {
+        return m_top.exchange(NULL, memory_order_acq_rel);
+    }
+
     template<typename T, typename Hook>
     inline bool lock_free_intrusive_stack<T, Hook>::empty() const
     {
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/Internal/JobFiber.h>
+
+namespace AZ::Internal::JobFiberPlatform
+{
+    bool IsSupported()
+    {
+        return false;
+    }
+
+    JobFiber* ConvertCurrentThread()
+    {
+        return nullptr;
+    }
+
+    void RevertCurrentThread([[maybe_unused]] JobFiber* fiber)
+    {
+    }
+
+    JobFiber* Create([[maybe_unused]] size_t stackSize, [[maybe_unused]] EntryFunction entry, [[maybe_unused]] void* userData)
+    {
+        return nullptr;
+    }
+
+    void Destroy([[maybe_unused]] JobFiber* fiber)
+    {
+    }
+
+    void Switch([[maybe_unused]] JobFiber* from, [[maybe_unused]] JobFiber* to)
+    {
+    }
+} // namespace AZ::Internal::JobFiberPlatform
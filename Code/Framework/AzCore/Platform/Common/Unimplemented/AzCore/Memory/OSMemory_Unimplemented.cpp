@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/OSMemory.h>
+
+namespace AZ::OSMemory
+{
+    size_t GetLargePageSize()
+    {
+        return 0;
+    }
+
+    void* AllocatePages([[maybe_unused]] size_t byteSize, [[maybe_unused]] LargePageMode mode, [[maybe_unused]] int numaNode)
+    {
+        return nullptr;
+    }
+
+    void FreePages([[maybe_unused]] void* address, [[maybe_unused]] size_t byteSize)
+    {
+    }
+
+    unsigned int GetNumaNodeCount()
+    {
+        return 1;
+    }
+
+    int GetCurrentNumaNode()
+    {
+        return AnyNumaNode;
+    }
+
+    bool SetCurrentThreadNumaNode([[maybe_unused]] int numaNode)
+    {
+        return false;
+    }
+} // namespace AZ::OSMemory
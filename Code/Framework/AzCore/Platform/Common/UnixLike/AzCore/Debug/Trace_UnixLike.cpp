@@ -107,6 +107,9 @@ namespace AZ::Debug
 #if defined(AZ_ENABLE_DEBUG_TOOLS)
     void ExceptionHandler(int signal)
     {
+        // Writes the trace output queued for the background thread before the process exits
+        Debug::Trace::FlushAsyncOutput();
+
         char message[MaxMessageLength];
         // Trace::RawOutput
         Debug::Trace::Instance().RawOutput(nullptr, "==================================================================\n");
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/MappedFile.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    bool MappedFile::PlatformOpen(const char* fileName)
+    {
+        int fileDescriptor = open(fileName, O_RDONLY);
+        if (fileDescriptor == -1)
+        {
+            return false;
+        }
+
+        struct stat fileStats;
+        if (fstat(fileDescriptor, &fileStats) != 0 || fileStats.st_size <= 0)
+        {
+            close(fileDescriptor);
+            return false;
+        }
+
+        const size_t size = aznumeric_cast<size_t>(fileStats.st_size);
+        void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+        // The mapping keeps its own reference to the file, so the descriptor isn't needed anymore.
+        close(fileDescriptor);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_data = reinterpret_cast<const u8*>(data);
+        m_size = size;
+        return true;
+    }
+
+    void MappedFile::PlatformClose()
+    {
+        munmap(const_cast<u8*>(m_data), aznumeric_cast<size_t>(m_size));
+    }
+} // namespace AZ::IO
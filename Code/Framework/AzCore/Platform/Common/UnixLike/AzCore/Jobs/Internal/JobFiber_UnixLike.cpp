@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/Internal/JobFiber.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+namespace AZ::Internal
+{
+    struct JobFiber
+    {
+        AZ_CLASS_ALLOCATOR(JobFiber, SystemAllocator);
+
+        ucontext_t m_context;
+        void* m_mapping = nullptr; // stack mapping including the guard page, null for a converted thread
+        size_t m_mappingSize = 0;
+        JobFiberPlatform::EntryFunction m_entry = nullptr;
+        void* m_userData = nullptr;
+    };
+
+    namespace JobFiberPlatform
+    {
+        namespace
+        {
+            // makecontext only passes int arguments, so the fiber pointer is split in two halves
+            void FiberStart(unsigned int high, unsigned int low)
+            {
+                const AZ::u64 address = (static_cast<AZ::u64>(high) << 32) | static_cast<AZ::u64>(low);
+                JobFiber* fiber = reinterpret_cast<JobFiber*>(static_cast<uintptr_t>(address));
+                fiber->m_entry(fiber->m_userData);
+                AZ_Assert(false, "Job fiber entry function returned, the fiber has nothing to return to");
+            }
+        } // namespace
+
+        bool IsSupported()
+        {
+            return true;
+        }
+
+        JobFiber* ConvertCurrentThread()
+        {
+            // the context is filled in on the first switch away from this thread
+            return aznew JobFiber;
+        }
+
+        void RevertCurrentThread(JobFiber* fiber)
+        {
+            delete fiber;
+        }
+
+        JobFiber* Create(size_t stackSize, EntryFunction entry, void* userData)
+        {
+            const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            stackSize = AZ::SizeAlignUp(stackSize, pageSize);
+
+            // one extra page below the stack is left inaccessible, so an overflow faults instead of corrupting memory
+            const size_t mappingSize = stackSize + pageSize;
+            void* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (mapping == MAP_FAILED)
+            {
+                return nullptr;
+            }
+            mprotect(mapping, pageSize, PROT_NONE);
+
+            JobFiber* fiber = aznew JobFiber;
+            fiber->m_mapping = mapping;
+            fiber->m_mappingSize = mappingSize;
+            fiber->m_entry = entry;
+            fiber->m_userData = userData;
+
+            if (getcontext(&fiber->m_context) != 0)
+            {
+                Destroy(fiber);
+                return nullptr;
+            }
+            fiber->m_context.uc_stack.ss_sp = static_cast<char*>(mapping) + pageSize;
+            fiber->m_context.uc_stack.ss_size = stackSize;
+            fiber->m_context.uc_link = nullptr;
+
+            const AZ::u64 address = static_cast<AZ::u64>(reinterpret_cast<uintptr_t>(fiber));
+            makecontext(
+                &fiber->m_context, reinterpret_cast<void (*)()>(&FiberStart), 2, static_cast<unsigned int>(address >> 32),
+                static_cast<unsigned int>(address & 0xffffffff));
+            return fiber;
+        }
+
+        void Destroy(JobFiber* fiber)
+        {
+            if (fiber->m_mapping)
+            {
+                munmap(fiber->m_mapping, fiber->m_mappingSize);
+            }
+            delete fiber;
+        }
+
+        void Switch(JobFiber* from, JobFiber* to)
+        {
+            [[maybe_unused]] const int result = swapcontext(&from->m_context, &to->m_context);
+            AZ_Assert(result == 0, "Failed to switch job fiber");
+        }
+    } // namespace JobFiberPlatform
+} // namespace AZ::Internal
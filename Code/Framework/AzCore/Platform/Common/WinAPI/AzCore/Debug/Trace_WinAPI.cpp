@@ -205,6 +205,8 @@ namespace AZ::Debug
         Debug::Trace::Instance().Output(nullptr, message);
 
         Debug::Trace::Instance().PrintCallstack(nullptr, 0, ExceptionInfo->ContextRecord);
+        // Exception handlers may read the logs, so queued trace output is written before they are called
+        Debug::Trace::FlushAsyncOutput();
 
         bool result = false;
         Debug::TraceMessageBus::BroadcastResult(result, &Debug::TraceMessageBus::Events::OnException, message);
@@ -217,6 +219,7 @@ namespace AZ::Debug
         }
         
         Debug::Trace::Instance().Output(nullptr, "==================================================================\n");
+        Debug::Trace::FlushAsyncOutput();
 
         // allowing continue of execution is not valid here.  This handler gets called for serious exceptions.
         // programs wanting things like a message box can implement them on a case-by-case basis, but we want no such 
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/std/string/conversions.h>
+
+namespace AZ::IO
+{
+    bool MappedFile::PlatformOpen(const char* fileName)
+    {
+        AZStd::wstring fileNameW;
+        AZStd::to_wstring(fileNameW, fileName);
+
+        HANDLE file = CreateFileW(fileNameW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        // The mapping keeps its own reference to the file, so the file handle isn't needed anymore.
+        CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr)
+        {
+            CloseHandle(mapping);
+            return false;
+        }
+
+        m_data = reinterpret_cast<const u8*>(data);
+        m_size = aznumeric_cast<u64>(fileSize.QuadPart);
+        m_platformHandle = mapping;
+        return true;
+    }
+
+    void MappedFile::PlatformClose()
+    {
+        UnmapViewOfFile(m_data);
+        CloseHandle(reinterpret_cast<HANDLE>(m_platformHandle));
+    }
+} // namespace AZ::IO
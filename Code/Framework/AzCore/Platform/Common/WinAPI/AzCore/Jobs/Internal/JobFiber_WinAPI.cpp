@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/Jobs/Internal/JobFiber.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AZ::Internal
+{
+    struct JobFiber
+    {
+        AZ_CLASS_ALLOCATOR(JobFiber, SystemAllocator);
+
+        LPVOID m_fiber = nullptr;
+        bool m_convertedThread = false; // true if we converted the thread and must convert it back on release
+        JobFiberPlatform::EntryFunction m_entry = nullptr;
+        void* m_userData = nullptr;
+    };
+
+    namespace JobFiberPlatform
+    {
+        namespace
+        {
+            VOID CALLBACK FiberStart(LPVOID parameter)
+            {
+                JobFiber* fiber = static_cast<JobFiber*>(parameter);
+                fiber->m_entry(fiber->m_userData);
+                AZ_Assert(false, "Job fiber entry function returned, the fiber has nothing to return to");
+            }
+        } // namespace
+
+        bool IsSupported()
+        {
+            return true;
+        }
+
+        JobFiber* ConvertCurrentThread()
+        {
+            JobFiber* fiber = aznew JobFiber;
+            if (IsThreadAFiber())
+            {
+                fiber->m_fiber = GetCurrentFiber();
+            }
+            else
+            {
+                fiber->m_fiber = ConvertThreadToFiberEx(nullptr, FIBER_FLAG_FLOAT_SWITCH);
+                fiber->m_convertedThread = true;
+            }
+
+            if (!fiber->m_fiber)
+            {
+                delete fiber;
+                return nullptr;
+            }
+            return fiber;
+        }
+
+        void RevertCurrentThread(JobFiber* fiber)
+        {
+            if (fiber->m_convertedThread)
+            {
+                ConvertFiberToThread();
+            }
+            delete fiber;
+        }
+
+        JobFiber* Create(size_t stackSize, EntryFunction entry, void* userData)
+        {
+            JobFiber* fiber = aznew JobFiber;
+            fiber->m_entry = entry;
+            fiber->m_userData = userData;
+            // commit a small part of the stack up front, the rest is committed on demand
+            fiber->m_fiber = CreateFiberEx(0, stackSize, FIBER_FLAG_FLOAT_SWITCH, &FiberStart, fiber);
+            if (!fiber->m_fiber)
+            {
+                delete fiber;
+                return nullptr;
+            }
+            return fiber;
+        }
+
+        void Destroy(JobFiber* fiber)
+        {
+            DeleteFiber(fiber->m_fiber);
+            delete fiber;
+        }
+
+        void Switch([[maybe_unused]] JobFiber* from, JobFiber* to)
+        {
+            SwitchToFiber(to->m_fiber);
+        }
+    } // namespace JobFiberPlatform
+} // namespace AZ::Internal
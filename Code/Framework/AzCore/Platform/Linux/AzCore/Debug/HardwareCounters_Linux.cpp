@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/HardwareCounters.h>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace AZ::Debug::Platform
+{
+    namespace
+    {
+        // The counters of a thread are opened as a single group, so they're read with one system call and are scheduled
+        // onto the performance monitoring unit together.
+        class ThreadCounterGroup
+        {
+        public:
+            static constexpr int CounterCount = 4;
+
+            ThreadCounterGroup()
+            {
+                constexpr AZ::u64 counterConfigs[CounterCount] = {
+                    PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+                };
+
+                for (int i = 0; i < CounterCount; ++i)
+                {
+                    perf_event_attr attributes{};
+                    attributes.type = PERF_TYPE_HARDWARE;
+                    attributes.size = sizeof(perf_event_attr);
+                    attributes.config = counterConfigs[i];
+                    attributes.disabled = i == 0 ? 1 : 0;
+                    attributes.exclude_kernel = 1;
+                    attributes.exclude_hv = 1;
+                    attributes.read_format = PERF_FORMAT_GROUP;
+
+                    // Counts the calling thread on any CPU.
+                    const int groupFd = i == 0 ? -1 : m_fds[0];
+                    m_fds[i] = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, groupFd, 0));
+                    if (m_fds[i] < 0)
+                    {
+                        Close();
+                        return;
+                    }
+                }
+
+                ioctl(m_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+                ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+            }
+
+            ~ThreadCounterGroup()
+            {
+                Close();
+            }
+
+            bool Read(HardwareCounterValues& values) const
+            {
+                if (m_fds[0] < 0)
+                {
+                    return false;
+                }
+
+                struct
+                {
+                    AZ::u64 m_count;
+                    AZ::u64 m_values[CounterCount];
+                } groupValues;
+                if (read(m_fds[0], &groupValues, sizeof(groupValues)) != static_cast<ssize_t>(sizeof(groupValues)))
+                {
+                    return false;
+                }
+
+                values.m_cycles = groupValues.m_values[0];
+                values.m_instructions = groupValues.m_values[1];
+                values.m_cacheMisses = groupValues.m_values[2];
+                values.m_branchMisses = groupValues.m_values[3];
+                return true;
+            }
+
+        private:
+            void Close()
+            {
+                for (int& fd : m_fds)
+                {
+                    if (fd >= 0)
+                    {
+                        close(fd);
+                        fd = -1;
+                    }
+                }
+            }
+
+            int m_fds[CounterCount] = { -1, -1, -1, -1 };
+        };
+    } // namespace
+
+    bool ReadThreadHardwareCounters(HardwareCounterValues& values)
+    {
+        static thread_local ThreadCounterGroup s_counterGroup;
+        return s_counterGroup.Read(values);
+    }
+} // namespace AZ::Debug::Platform
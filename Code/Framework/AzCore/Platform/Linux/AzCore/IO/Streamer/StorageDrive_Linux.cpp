@@ -0,0 +1,1461 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <climits>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/std/typetraits/is_unsigned.h>
+#include <AzCore/StringFunc/StringFunc.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char FileSwitchesName[] = "File switches";
+    static constexpr char SeeksName[] = "Seeks";
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    // User data for submissions that don't complete a read, such as cancellations. Reads use their read slot.
+    static constexpr u64 NonReadUserData = std::numeric_limits<u64>::max();
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableDirectReads(true)
+        , m_enableRegisteredBuffers(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // IoUring
+    //
+
+    // The ring is driven through the raw system calls so there's no dependency on liburing.
+    bool StorageDriveLinux::IoUring::Create(u32 entryCount)
+    {
+        io_uring_params params{};
+        const int ringFd = aznumeric_caster(syscall(__NR_io_uring_setup, entryCount, &params));
+        if (ringFd < 0)
+        {
+            return false;
+        }
+        m_ringFd = ringFd;
+
+        m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool isSingleMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (isSingleMapping)
+        {
+            m_submissionRingSize = AZStd::max(m_submissionRingSize, m_completionRingSize);
+            m_completionRingSize = m_submissionRingSize;
+        }
+
+        void* submissionRing = mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringFd, IORING_OFF_SQ_RING);
+        if (submissionRing == MAP_FAILED)
+        {
+            Destroy();
+            return false;
+        }
+        m_submissionRing = submissionRing;
+
+        if (isSingleMapping)
+        {
+            m_completionRing = m_submissionRing;
+        }
+        else
+        {
+            void* completionRing = mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                m_ringFd, IORING_OFF_CQ_RING);
+            if (completionRing == MAP_FAILED)
+            {
+                Destroy();
+                return false;
+            }
+            m_completionRing = completionRing;
+        }
+
+        m_submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* submissionEntries = mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringFd, IORING_OFF_SQES);
+        if (submissionEntries == MAP_FAILED)
+        {
+            Destroy();
+            return false;
+        }
+        m_submissionEntries = reinterpret_cast<io_uring_sqe*>(submissionEntries);
+
+        u8* submissionRingBase = reinterpret_cast<u8*>(m_submissionRing);
+        m_submissionHead = reinterpret_cast<unsigned*>(submissionRingBase + params.sq_off.head);
+        m_submissionTail = reinterpret_cast<unsigned*>(submissionRingBase + params.sq_off.tail);
+        m_submissionArray = reinterpret_cast<unsigned*>(submissionRingBase + params.sq_off.array);
+        m_submissionMask = *reinterpret_cast<unsigned*>(submissionRingBase + params.sq_off.ring_mask);
+
+        u8* completionRingBase = reinterpret_cast<u8*>(m_completionRing);
+        m_completionHead = reinterpret_cast<unsigned*>(completionRingBase + params.cq_off.head);
+        m_completionTail = reinterpret_cast<unsigned*>(completionRingBase + params.cq_off.tail);
+        m_completionMask = *reinterpret_cast<unsigned*>(completionRingBase + params.cq_off.ring_mask);
+        m_completionEntries = reinterpret_cast<io_uring_cqe*>(completionRingBase + params.cq_off.cqes);
+
+        // The eventfd is signaled for every completion and wakes up the streamer thread when it's suspended.
+        m_eventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (m_eventFd < 0 || syscall(__NR_io_uring_register, m_ringFd, IORING_REGISTER_EVENTFD, &m_eventFd, 1) != 0)
+        {
+            Destroy();
+            return false;
+        }
+        return true;
+    }
+
+    void StorageDriveLinux::IoUring::Destroy()
+    {
+        if (m_submissionEntries)
+        {
+            munmap(m_submissionEntries, m_submissionEntriesSize);
+        }
+        if (m_completionRing && m_completionRing != m_submissionRing)
+        {
+            munmap(m_completionRing, m_completionRingSize);
+        }
+        if (m_submissionRing)
+        {
+            munmap(m_submissionRing, m_submissionRingSize);
+        }
+        if (m_eventFd >= 0)
+        {
+            close(m_eventFd);
+        }
+        // Closing the ring also releases the registered buffers and eventfd.
+        if (m_ringFd >= 0)
+        {
+            close(m_ringFd);
+        }
+        *this = IoUring{};
+    }
+
+    io_uring_sqe* StorageDriveLinux::IoUring::GetSubmissionEntry()
+    {
+        const unsigned tail = *m_submissionTail;
+        const unsigned head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+        if (tail - head > m_submissionMask)
+        {
+            return nullptr;
+        }
+
+        const unsigned index = tail & m_submissionMask;
+        io_uring_sqe* entry = &m_submissionEntries[index];
+        ::memset(entry, 0, sizeof(io_uring_sqe));
+        m_submissionArray[index] = index;
+        // Publish the entry to the kernel, it's not consumed until the next io_uring_enter call.
+        __atomic_store_n(m_submissionTail, tail + 1, __ATOMIC_RELEASE);
+        m_unsubmittedCount++;
+        return entry;
+    }
+
+    bool StorageDriveLinux::IoUring::Submit()
+    {
+        while (m_unsubmittedCount > 0)
+        {
+            const int submitted = aznumeric_caster(syscall(__NR_io_uring_enter, m_ringFd, m_unsubmittedCount, 0, 0, nullptr, 0));
+            if (submitted > 0)
+            {
+                m_unsubmittedCount -= AZStd::min(m_unsubmittedCount, static_cast<unsigned>(submitted));
+            }
+            else if (submitted < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            else if (submitted < 0 && (errno == EAGAIN || errno == EBUSY))
+            {
+                // The kernel is out of resources or the completion queue is full. The entries stay queued and will be
+                // submitted once reads have completed.
+                return true;
+            }
+            else
+            {
+                AZ_Error("StorageDriveLinux", false, "io_uring_enter failed with error: %i (%s)\n", errno, strerror(errno));
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //
+    // FileReadInformation
+    //
+
+    void StorageDriveLinux::FileReadInformation::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    void StorageDriveLinux::FileReadInformation::Clear()
+    {
+        if (m_sectorAlignedOutput)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        *this = FileReadInformation{};
+    }
+
+    //
+    // StorageDriveLinux
+    //
+    StorageDriveLinux::StorageDriveLinux(const AZStd::vector<AZStd::string_view>& drivePaths, u32 maxFileHandles,
+        u32 maxMetaDataCacheEntries, size_t physicalSectorSize, size_t logicalSectorSize, u32 ioChannelCount, s32 overCommit,
+        ConstructionOptions options)
+        : m_maxFileHandles(maxFileHandles)
+        , m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_ioChannelCount(ioChannelCount)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        AZ_Assert(!drivePaths.empty(), "StorageDriveLinux requires at least one drive path to work.");
+
+        // Get drive paths
+        m_drivePaths.reserve(drivePaths.size());
+        for (AZStd::string_view drivePath : drivePaths)
+        {
+            AZStd::string path(drivePath);
+            // Erase the trailing slash, except for the root, so mount points compare the same as other paths.
+            if (path.size() > 1 && path.back() == AZ_CORRECT_FILESYSTEM_SEPARATOR)
+            {
+                path.pop_back();
+            }
+            m_drivePaths.push_back(AZStd::move(path));
+        }
+
+        // Create name for statistics. The name will include all mount points on this physical device
+        // for instance "Storage drive (/,/home)".
+        m_name = "Storage drive (";
+        AZ::StringFunc::Join(m_name, m_drivePaths, ',');
+        m_name += ')';
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created.\n", m_name.c_str());
+        }
+
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 512;
+            AZ_Error("StorageDriveLinux", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinux", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinux requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        // Cap the IO channels to the maximum
+        if (m_ioChannelCount == 0)
+        {
+            m_ioChannelCount = MaxIoChannels;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received io channel count of 0 for %s. Picking a count of %u instead.\n", m_name.c_str(), MaxIoChannels);
+        }
+        else
+        {
+            m_ioChannelCount = AZ::GetMin(m_ioChannelCount, MaxIoChannels);
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_ioChannelCount) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the number of IO channels (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_ioChannelCount);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_ioChannelCount);
+        }
+
+        m_constructionOptions.m_stagingBufferSize =
+            aznumeric_cast<u32>(AZ_SIZE_ALIGN_UP(m_constructionOptions.m_stagingBufferSize, m_physicalSectorSize));
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinux requires a power-of-2 for maxMetaDataCacheEntries. Received %zu", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        AZ_Assert(m_activeReads_Count == 0, "%s destroyed while %u reads are still in flight.", m_name.c_str(), m_activeReads_Count);
+
+        for (int file : m_fileCache_handles)
+        {
+            if (file >= 0)
+            {
+                close(file);
+            }
+        }
+        m_ring.Destroy();
+        if (m_stagingBuffers)
+        {
+            azfree(m_stagingBuffers, AZ::SystemAllocator);
+        }
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (AZStd::holds_alternative<Requests::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<Requests::ReadRequestData>(request->GetCommand());
+            if (IsServicedByThisDrive(readRequest.m_path.GetAbsolutePath()))
+            {
+                FileRequest* read = m_context->GetNewInternalRequest();
+                read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                    readRequest.m_offset, readRequest.m_size);
+                m_context->PushPreparedRequest(read);
+                return;
+            }
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    m_pendingReadRequests.push_back(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    m_pendingRequests.push_back(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        if (!m_pendingReadRequests.empty())
+        {
+            // With io_uring keep issuing reads until all IO channels are in use, the kernel receives them in a single
+            // submission. Synchronous reads are done one at a time so the scheduler gets a chance to reorder.
+            do
+            {
+                FileRequest* request = m_pendingReadRequests.front();
+                if (!ReadRequest(request))
+                {
+                    break;
+                }
+                m_pendingReadRequests.pop_front();
+                hasWorked = true;
+            } while (m_ring.IsActive() && !m_pendingReadRequests.empty());
+        }
+        else if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit(
+                [this, request](auto&& args)
+                {
+                    using Command = AZStd::decay_t<decltype(args)>;
+                    if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+                    {
+                        FileExistsRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+                    {
+                        FileMetaDataRetrievalRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else
+                    {
+                        AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                        return false;
+                    }
+                },
+                request->GetCommand());
+        }
+
+        if (m_ring.IsActive())
+        {
+            m_ring.Submit();
+        }
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+        status.m_coalesceGap = AZStd::min(status.m_coalesceGap, CalculateCoalesceGap());
+        status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+    }
+
+    u64 StorageDriveLinux::CalculateCoalesceGap() const
+    {
+        if (!m_constructionOptions.m_hasSeekPenalty)
+        {
+            // Without a seek penalty only reads that are directly adjacent benefit from being merged.
+            return 0;
+        }
+        // Reading through a gap is cheaper than seeking over it as long as reading the gap takes less time than the seek.
+        const double bytesPerMicrosecond =
+            aznumeric_cast<double>(m_readSizeAverage.GetTotal()) / aznumeric_cast<double>(m_readTimeAverage.GetTotal().count());
+        return aznumeric_cast<u64>(bytesPerMicrosecond * aznumeric_cast<double>(s_averageSeekTime.count()));
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+        StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot
+        AZStd::chrono::steady_clock::time_point earliestSlot = AZStd::chrono::steady_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots_readInfo.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                FileReadInformation& read = m_readSlots_readInfo[i];
+                u64 totalBytesRead = m_readSizeAverage.GetTotal();
+                double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+                auto readCommand = AZStd::get_if<Requests::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                AZStd::chrono::steady_clock::time_point endTime =
+                    read.m_startTime + Statistic::TimeValue(aznumeric_cast<u64>((readCommand->m_size * totalReadTime) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::steady_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds getFileExistsTimeAverage = m_getFileExistsTimeAverage.CalculateAverage();
+                startTime += getFileExistsTimeAverage;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds getFileExistsTimeAverage = m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+                startTime += getFileExistsTimeAverage;
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    AZStd::chrono::microseconds fileOpenCloseTimeAverage = m_fileOpenCloseTimeAverage.CalculateAverage();
+                    startTime += fileOpenCloseTimeAverage;
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += Statistic::TimeValue(aznumeric_cast<u64>((readSize * totalReadTime) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequestChecked(FileRequest* request,
+        AZStd::chrono::steady_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        AZStd::visit([&, this](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData> ||
+                          AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                if (IsServicedByThisDrive(args.m_compressionInfo.m_archiveFilename.GetAbsolutePath()))
+                {
+                    EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+                }
+            }
+        }, request->GetCommand());
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_ioChannelCount)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    void StorageDriveLinux::InitializeCaches()
+    {
+        m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::steady_clock::time_point::min());
+        m_fileCache_paths.resize(m_maxFileHandles);
+        m_fileCache_handles.resize(m_maxFileHandles, -1);
+        m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+        m_fileCache_isDirect.resize(m_maxFileHandles, false);
+
+        m_readSlots_readInfo.resize(m_ioChannelCount);
+        m_readSlots_ioVectors.resize(m_ioChannelCount);
+        m_readSlots_active.resize(m_ioChannelCount);
+
+        // Only reads that have to be aligned for direct reads need to go through a staging buffer.
+        const size_t stagingBufferSize = m_constructionOptions.m_stagingBufferSize;
+        if (m_constructionOptions.m_enableDirectReads && stagingBufferSize > 0)
+        {
+            m_stagingBuffers = reinterpret_cast<u8*>(azmalloc(stagingBufferSize * m_ioChannelCount, m_physicalSectorSize, AZ::SystemAllocator));
+            m_freeStagingBuffers.reserve(m_ioChannelCount);
+            for (u32 i = m_ioChannelCount; i > 0; --i)
+            {
+                m_freeStagingBuffers.push_back(i - 1);
+            }
+        }
+
+        if (m_ring.Create(m_ioChannelCount))
+        {
+            if (m_stagingBuffers && m_constructionOptions.m_enableRegisteredBuffers)
+            {
+                AZStd::vector<iovec> buffers(m_ioChannelCount);
+                for (u32 i = 0; i < m_ioChannelCount; ++i)
+                {
+                    buffers[i].iov_base = m_stagingBuffers + i * stagingBufferSize;
+                    buffers[i].iov_len = stagingBufferSize;
+                }
+                m_ring.m_hasRegisteredBuffers =
+                    syscall(__NR_io_uring_register, m_ring.m_ringFd, IORING_REGISTER_BUFFERS, buffers.data(), m_ioChannelCount) == 0;
+                AZ_Warning("StorageDriveLinux", m_ring.m_hasRegisteredBuffers || m_constructionOptions.m_minimalReporting,
+                    "Unable to register %zu bytes of staging buffers for %s (Error: %i), likely due to the locked memory limit. "
+                    "Staging buffers will be used unregistered.\n", stagingBufferSize * m_ioChannelCount, m_name.c_str(), errno);
+            }
+        }
+        else
+        {
+            AZ_Warning("StorageDriveLinux", m_constructionOptions.m_minimalReporting,
+                "io_uring is not available for %s (Error: %i). Reads will be done synchronously.\n", m_name.c_str(), errno);
+        }
+
+        m_cachesInitialized = true;
+    }
+
+    auto StorageDriveLinux::OpenFile(int& fileHandle, size_t& cacheSlot, FileRequest* request, const Requests::ReadData& data) -> OpenFileResult
+    {
+        int file = -1;
+
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            file = m_fileCache_handles[cacheIndex];
+            AZ_Assert(file >= 0, "Found the file '%s' in cache, but file handle is invalid.\n", data.m_path.GetRelativePath());
+        }
+        else
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            bool isDirect = false;
+            // Adding explicit scope here for profiling file Open & Close
+            {
+                AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                // Depending on configuration, reads are direct, which means they bypass the page cache.
+                if (m_constructionOptions.m_enableDirectReads)
+                {
+                    file = ::open(data.m_path.GetAbsolutePathCStr(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+                    isDirect = file >= 0;
+                }
+                // Not all file systems support direct reads, in which case this drive falls back to buffered reads.
+                if (file < 0)
+                {
+                    file = ::open(data.m_path.GetAbsolutePathCStr(), O_RDONLY | O_CLOEXEC);
+                }
+
+                if (file < 0)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                CloseFile(cacheIndex);
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_isDirect[cacheIndex] = isDirect;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+        }
+
+        AZ_Assert(file >= 0, "While searching for file '%s' in StorageDriveLinux::OpenFile failed to detect a problem.",
+            data.m_path.GetRelativePath());
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::now();
+        fileHandle = file;
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (!m_cachesInitialized)
+        {
+            InitializeCaches();
+        }
+
+        if (m_activeReads_Count >= m_ioChannelCount)
+        {
+            return false;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+
+        return ReadRequest(request, readSlot);
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request, size_t readSlot)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (m_ring.IsActive() && m_activeReads_Count == 0 && !m_context->GetStreamerThreadSynchronizer().AreIoEventsAvailable())
+        {
+            // There are no more IO event slots available so delay executing this request until one becomes available.
+            return false;
+        }
+
+        auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        int file = -1;
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(file, fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        u64 readSize = data->m_size;
+        u64 readOffs = data->m_offset;
+        void* output = data->m_output;
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        readInfo.m_request = request;
+        readInfo.m_fileHandleIndex = fileCacheSlot;
+
+        if (m_fileCache_isDirect[fileCacheSlot])
+        {
+            // Check alignment of the file read information: size, offset, and address.
+            // If any are unaligned to the sector sizes, make adjustments and read into an aligned buffer.
+            // See StorageDriveWin::ReadRequest for a diagram of the adjustments.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+
+            // Align the offset down to next lowest sector and change the size to compensate. The size of the adjustment
+            // is stored in copyBackOffset so only the requested data is copied back once the read completes.
+            if (!alignedOffs)
+            {
+                readOffs = AZ_SIZE_ALIGN_DOWN(readOffs, m_logicalSectorSize);
+                u64 offsetCorrection = data->m_offset - readOffs;
+                readInfo.m_copyBackOffset = offsetCorrection;
+                readSize = data->m_size + offsetCorrection;
+            }
+
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u64 alignedReadSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            // Once everything is aligned, read into a staging buffer if one is available and large enough, otherwise
+            // allocate a temporary buffer.
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            if (!isAligned)
+            {
+                readSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (readSize <= m_constructionOptions.m_stagingBufferSize && !m_freeStagingBuffers.empty())
+                {
+                    readInfo.m_stagingBufferIndex = m_freeStagingBuffers.back();
+                    m_freeStagingBuffers.pop_back();
+                    output = m_stagingBuffers + readInfo.m_stagingBufferIndex * size_t{ m_constructionOptions.m_stagingBufferSize };
+                }
+                else
+                {
+                    readInfo.AllocateAlignedBuffer(readSize, m_physicalSectorSize);
+                    output = readInfo.m_sectorAlignedOutput;
+                }
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+        readInfo.m_readOutput = output;
+
+        AZ_Assert(readSize <= std::numeric_limits<u32>::max(), "Read of %llu bytes is too large for StorageDriveLinux.", readSize);
+
+        bool isSynchronous = !m_ring.IsActive();
+        if (!isSynchronous)
+        {
+            io_uring_sqe* entry = m_ring.GetSubmissionEntry();
+            if (!entry)
+            {
+                // The submission queue is sized to the number of IO channels, so this only happens if too many other
+                // operations such as cancellations have been queued. Try again later.
+                if (readInfo.m_stagingBufferIndex != InvalidStagingBufferIndex)
+                {
+                    m_freeStagingBuffers.push_back(readInfo.m_stagingBufferIndex);
+                }
+                readInfo.Clear();
+                return false;
+            }
+
+            entry->fd = file;
+            entry->off = readOffs;
+            entry->user_data = readSlot;
+            if (readInfo.m_stagingBufferIndex != InvalidStagingBufferIndex && m_ring.m_hasRegisteredBuffers)
+            {
+                entry->opcode = IORING_OP_READ_FIXED;
+                entry->addr = reinterpret_cast<u64>(output);
+                entry->len = aznumeric_cast<u32>(readSize);
+                entry->buf_index = aznumeric_cast<u16>(readInfo.m_stagingBufferIndex);
+            }
+            else
+            {
+                iovec& ioVector = m_readSlots_ioVectors[readSlot];
+                ioVector.iov_base = output;
+                ioVector.iov_len = readSize;
+                entry->opcode = IORING_OP_READV;
+                entry->addr = reinterpret_cast<u64>(&ioVector);
+                entry->len = 1;
+            }
+        }
+
+        auto now = AZStd::chrono::steady_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+            if (!isSynchronous)
+            {
+                // Only wait on the ring's completions while reads are in flight.
+                m_context->GetStreamerThreadSynchronizer().RegisterIoEvent(m_ring.m_eventFd);
+            }
+        }
+        readInfo.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        if (m_activeCacheSlot == fileCacheSlot)
+        {
+            m_fileSwitchPercentageStat.PushSample(0.0);
+            m_seekPercentageStat.PushSample(m_activeOffset == data->m_offset ? 0.0 : 1.0);
+        }
+        else
+        {
+            m_fileSwitchPercentageStat.PushSample(1.0);
+            m_seekPercentageStat.PushSample(0.0);
+        }
+
+        Statistic::PlotImmediate(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, SeeksName, m_seekPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = readOffs + readSize;
+
+        if (isSynchronous)
+        {
+            s64 result;
+            {
+                AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest ::pread");
+                result = ::pread(file, output, readSize, aznumeric_cast<off_t>(readOffs));
+            }
+            FinalizeSingleRequest(readSlot, result >= 0 ? result : -errno);
+        }
+
+        return true;
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now address any active reads and ask the kernel to cancel them. Reads
+        // that are canceled complete with ECANCELED, reads that are already being serviced by the device complete as usual.
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && m_readSlots_readInfo[readSlot].m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+                if (io_uring_sqe* entry = m_ring.IsActive() ? m_ring.GetSubmissionEntry() : nullptr; entry != nullptr)
+                {
+                    entry->opcode = IORING_OP_ASYNC_CANCEL;
+                    entry->fd = -1;
+                    entry->addr = readSlot;
+                    entry->user_data = NonReadUserData;
+                }
+            }
+        }
+        if (m_ring.IsActive())
+        {
+            m_ring.Submit();
+        }
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<Requests::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        AZ_Assert(IsServicedByThisDrive(fileExists.m_path.GetAbsolutePath()),
+            "FileExistsRequest was queued on a StorageDriveLinux that doesn't service files on the given path '%s'.",
+            fileExists.m_path.GetRelativePath());
+
+        size_t cacheIndex = FindInFileHandleCache(fileExists.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        cacheIndex = FindInMetaDataCache(fileExists.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat attributes;
+        if (::stat(fileExists.m_path.GetAbsolutePathCStr(), &attributes) == 0 && S_ISREG(attributes.st_mode))
+        {
+            cacheIndex = GetNextMetaDataCacheSlot();
+            m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+            m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(attributes.st_size);
+            fileExists.m_found = true;
+
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<Requests::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat attributes;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            AZ_Assert(m_fileCache_handles[cacheIndex] >= 0,
+                "File path '%s' doesn't have an associated file handle.", m_fileCache_paths[cacheIndex].GetRelativePath());
+            if (::fstat(m_fileCache_handles[cacheIndex], &attributes) != 0)
+            {
+                StreamStackEntry::QueueRequest(request);
+                return;
+            }
+        }
+        else if (::stat(command.m_path.GetAbsolutePathCStr(), &attributes) != 0 || !S_ISREG(attributes.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(attributes.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(attributes.st_size);
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::CloseFile(size_t cacheIndex)
+    {
+        if (m_fileCache_handles[cacheIndex] >= 0)
+        {
+            AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Closing '%s' but it has %u active reads\n",
+                m_fileCache_paths[cacheIndex].GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+            ::close(m_fileCache_handles[cacheIndex]);
+            m_fileCache_handles[cacheIndex] = -1;
+        }
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                CloseFile(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            cacheIndex = FindInMetaDataCache(filePath);
+            if (cacheIndex != InvalidMetaDataCacheIndex)
+            {
+                m_metaDataCache_paths[cacheIndex].Clear();
+                m_metaDataCache_fileSize[cacheIndex] = 0;
+            }
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            // Clear file handle cache
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                CloseFile(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            // Clear meta data cache
+            auto metaDataCacheSize = m_metaDataCache_paths.size();
+            m_metaDataCache_paths.clear();
+            m_metaDataCache_fileSize.clear();
+            m_metaDataCache_front = 0;
+            m_metaDataCache_paths.resize(metaDataCacheSize);
+            m_metaDataCache_fileSize.resize(metaDataCacheSize);
+        }
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        if (!m_ring.IsActive() || m_activeReads_Count == 0)
+        {
+            return false;
+        }
+
+        bool hasWorked = false;
+        unsigned head = *m_ring.m_completionHead;
+        const unsigned tail = __atomic_load_n(m_ring.m_completionTail, __ATOMIC_ACQUIRE);
+        while (head != tail)
+        {
+            const io_uring_cqe& completion = m_ring.m_completionEntries[head & m_ring.m_completionMask];
+            const u64 userData = completion.user_data;
+            const s64 result = completion.res;
+            // Release the completion entry before doing any work that could queue new submissions.
+            __atomic_store_n(m_ring.m_completionHead, ++head, __ATOMIC_RELEASE);
+
+            if (userData == NonReadUserData)
+            {
+                continue;
+            }
+
+            const size_t readSlot = aznumeric_caster(userData);
+            AZ_Assert(readSlot < m_readSlots_active.size() && m_readSlots_active[readSlot],
+                "io_uring completed a read for slot %zu which isn't active.", readSlot);
+            hasWorked = true;
+            FinalizeSingleRequest(readSlot, result);
+
+            // There's now a slot available to queue the next request, if there is one.
+            if (!m_pendingReadRequests.empty())
+            {
+                FileRequest* request = m_pendingReadRequests.front();
+                if (ReadRequest(request, readSlot))
+                {
+                    m_pendingReadRequests.pop_front();
+                }
+            }
+        }
+        return hasWorked;
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(size_t readSlot, s64 result)
+    {
+        const size_t numBytesTransferred = result > 0 ? aznumeric_cast<size_t>(result) : 0;
+        m_activeReads_ByteCount += numBytesTransferred;
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::steady_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+            if (m_ring.IsActive())
+            {
+                m_context->GetStreamerThreadSynchronizer().UnregisterIoEvent(m_ring.m_eventFd);
+            }
+        }
+
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+
+        auto readCommand = AZStd::get_if<Requests::ReadData>(&fileReadInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the io_uring read did not contain a read request.");
+
+        const bool isCanceled = result == -ECANCELED;
+        const bool encounteredError = result < 0 && !isCanceled;
+        AZ_Error("StorageDriveLinux", !encounteredError, "File read operation completed with error code %i (%s)\n",
+            aznumeric_cast<int>(-result), strerror(aznumeric_cast<int>(-result)));
+
+        // The request could be reading more due to alignment requirements. It should however never read less that the amount of
+        // requested data.
+        const bool isSuccess = !encounteredError && !isCanceled && (fileReadInfo.m_copyBackOffset + readCommand->m_size <= numBytesTransferred);
+        if (isSuccess && fileReadInfo.m_readOutput != readCommand->m_output)
+        {
+            auto offsetAddress = reinterpret_cast<u8*>(fileReadInfo.m_readOutput) + fileReadInfo.m_copyBackOffset;
+            ::memcpy(readCommand->m_output, offsetAddress, readCommand->m_size);
+        }
+
+        fileReadInfo.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+
+        m_fileCache_activeReads[fileReadInfo.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        if (fileReadInfo.m_stagingBufferIndex != InvalidStagingBufferIndex)
+        {
+            m_freeStagingBuffers.push_back(fileReadInfo.m_stagingBufferIndex);
+        }
+        fileReadInfo.Clear();
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::steady_clock::time_point oldest = AZStd::chrono::steady_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot()
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    size_t StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinux::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    bool StorageDriveLinux::IsServicedByThisDrive(AZ::IO::PathView filePath) const
+    {
+        // Mount points are matched by path, so a path that crosses into a mount point of another device through a
+        // symbolic link is still serviced by this drive. Resolving the device of every path would need a stat per request.
+        for (const AZStd::string& drivePath : m_drivePaths)
+        {
+            if (filePath.IsAbsolute() && filePath.IsRelativeTo(AZ::IO::PathView(drivePath)))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateBytesPerSecond(m_name, "Read Speed", totalBytesRead / totalReadTimeSec,
+                "The average read speed in megabytes per second this drive achieved. This is the maximum achievable speed for reading from "
+                "disk. If this is lower than expected it may indicate that there's an overhead from the operating system, the drive has "
+                "seen a lot of use or other applications are using the same drive. Disabling direct reads through the Settings Registry "
+                "can increase the read speeds as the operating system can cache files, but this will typically only accelerate files that "
+                "are read multiple times and will be slower for the first read. Artificial tests can therefore be misleading if the same "
+                "files are repeatedly loaded."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "File Open & Close", m_fileOpenCloseTimeAverage.CalculateAverage(), m_fileOpenCloseTimeAverage.GetMinimum(),
+                m_fileOpenCloseTimeAverage.GetMaximum(),
+                "The average amount of time needed to open and close file handles. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file exists", m_getFileExistsTimeAverage.CalculateAverage(),
+                m_getFileExistsTimeAverage.GetMinimum(), m_getFileExistsTimeAverage.GetMaximum(),
+                "The average amount of time needed to check if a file exists. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file meta data", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage(),
+                m_getFileMetaDataRetrievalTimeAverage.GetMinimum(), m_getFileMetaDataRetrievalTimeAverage.GetMaximum(),
+                "The average amount of time in microseconds needed to retrieve file information. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots(),
+                "The total number of available slots to queue requests on. The lower this number, the more active this node is. A small "
+                "number is ideal as it means there are a few requests available for immediate processing next once a request "
+                "completes. If this is value is often negative then increasing the over-commit value, but keep in mind that too many "
+                "over-committed reduces the ability of scheduler to order requests."));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetAverage(), m_fileSwitchPercentageStat.GetMinimum(),
+                m_fileSwitchPercentageStat.GetMaximum(),
+                "The percentage of file requests that required switching to a different file. When running from loose file this should be "
+                "close to 100% as that would indicate mostly full file reads. When running from archives this should be as close to 0 as "
+                "possible as that would indicate efficiently running from archives."));
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, SeeksName, m_seekPercentageStat.GetAverage(), m_seekPercentageStat.GetMinimum(), m_seekPercentageStat.GetMaximum(),
+                "The percentage of file reads that required seeking within a file. For loose files this should be lose to zero to indicate "
+                "no partial file reads. For archives this value is typically high, which is not a problem, but lower values indicate more "
+                "efficient scheduling and archive layout which will result in better hardware cache utilization."));
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage(), m_directReadsPercentageStat.GetMinimum(),
+                m_directReadsPercentageStat.GetMaximum(),
+                "The percentage of direct reads that did not require any additional aligning. If this number isn't close to 100 percent "
+                "performance will suffer as data needs to be copied from the staging buffers. The best way to avoid this is by adding a "
+                "block cache and/or read splitter in front of this node."));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            {
+                AZStd::string drivePaths;
+                AZ::StringFunc::Join(drivePaths, m_drivePaths, ' ');
+                data.m_output.push_back(Statistic::CreatePersistentString(
+                    m_name, "Drive paths", AZStd::move(drivePaths), "The mount points this node monitors."));
+                data.m_output.push_back(Statistic::CreateInteger(
+                    m_name, "Max file handles", m_maxFileHandles,
+                    "The maximum number of file handles this drive node will cache. Increasing this will allow files that are read "
+                    "multiple times to be processed faster. It's recommended to have this set to at least the largest number of archives "
+                    "that can be in use at the same time."));
+                data.m_output.push_back(Statistic::CreateInteger(
+                    m_name, "Max meta data cache", m_metaDataCache_paths.size(),
+                    "The maximum number of meta data like file sizes this drive node will cache."));
+                data.m_output.push_back(Statistic::CreateByteSize(
+                    m_name, "Physical sector size", m_physicalSectorSize,
+                    "The sector size used by the hardware. For optimal performance memory alignment and read sizes need to be multiples of "
+                    "this value."));
+                data.m_output.push_back(Statistic::CreateByteSize(
+                    m_name, "Logical sector size", m_logicalSectorSize,
+                    "The sector size used by the operating system. This is typically the same or smaller than the physical sector size. If "
+                    "the physical sector size alignment can't be met, this is the next best size to align to."));
+                data.m_output.push_back(Statistic::CreateInteger(
+                    m_name, "IO channel count", m_ioChannelCount,
+                    "The amount of requests the hardware can process in parallel. This is also the depth of the io_uring."));
+                data.m_output.push_back(Statistic::CreateInteger(
+                    m_name, "Overcommit", m_overCommit,
+                    "The number of additional requests this node will accept. Higher numbers means that drives don't have to wait for the "
+                    "scheduler to provide new request to process and the next request can immediately start reading. If this value is too "
+                    "high though it will negatively impact the scheduler's ability to order and prioritize requests, which can lead to "
+                    "poorer hardware and software cache performance and slower cancellations, among others."));
+                data.m_output.push_back(Statistic::CreateByteSize(
+                    m_name, "Staging buffer size", m_constructionOptions.m_stagingBufferSize,
+                    "The size of each of the staging buffers unaligned direct reads are read into. Larger unaligned reads allocate a "
+                    "temporary buffer."));
+                data.m_output.push_back(Statistic::CreateBoolean(
+                    m_name, "Has seek penalty", m_constructionOptions.m_hasSeekPenalty,
+                    "Whether or not the hardware has a penalty for seeking. This refers to drives that need to physically position a read "
+                    "head to retrieve data, which can cause additional seek times for non-consecutive reads. This does not refer to seeks "
+                    "impacting hardware cache performance."));
+                data.m_output.push_back(Statistic::CreateBoolean(
+                    m_name, "Direct reads enabled", m_constructionOptions.m_enableDirectReads,
+                    "Whether or not this drive will use the operating system's page cache (buffered) or not (direct). Buffered reads are "
+                    "beneficial when reading the same file frequently, which happens during development. Direct typically is faster "
+                    "when reading the initial file as there's much less the operating system has to do, but subsequential reads are "
+                    "slower. Direct is optimal for released games and dedicated servers as these don't often read the same file."));
+                data.m_output.push_back(Statistic::CreateBoolean(
+                    m_name, "io_uring active", m_ring.IsActive(),
+                    "Whether or not reads are issued asynchronously through io_uring. If not, reads are done synchronously one at a "
+                    "time, which typically happens when io_uring is blocked inside a container. Only known after the first read."));
+                data.m_output.push_back(Statistic::CreateBoolean(
+                    m_name, "Registered buffers", m_ring.m_hasRegisteredBuffers,
+                    "Whether or not the staging buffers are registered with io_uring. Registering can fail if the locked memory limit "
+                    "of the process is too low."));
+                data.m_output.push_back(Statistic::CreateBoolean(
+                    m_name, "Minimal reporting", m_constructionOptions.m_minimalReporting,
+                    "Whether or not this node only reports issues or reports all information."));
+                data.m_output.push_back(Statistic::CreateReferenceString(
+                    m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                    "The name of the node that follows this node or none."));
+            }
+            break;
+        case IStreamerTypes::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] >= 0)
+                    {
+                        data.m_output.push_back(
+                            Statistic::CreatePersistentString(m_name, "File lock", m_fileCache_paths[i].GetRelativePath().Native()));
+                    }
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
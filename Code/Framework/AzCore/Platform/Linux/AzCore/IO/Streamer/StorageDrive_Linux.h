@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+#include <sys/uio.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace AZ::IO::Requests
+{
+    struct ReadData;
+    struct ReportData;
+}
+
+namespace AZ::IO
+{
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! The size of each of the staging buffers that reads which don't meet the alignment requirements of direct reads
+            //! are read into. One buffer is created per IO channel and the buffers are registered with the io_uring so the
+            //! kernel doesn't have to map them for every read. Larger unaligned reads use a temporary buffer instead.
+            u32 m_stagingBufferSize{ 256 * 1024 };
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Use direct reads (O_DIRECT) for the fastest possible read speeds by bypassing the page cache. This results in
+            //! a faster read the first time a file is read, but subsequent reads will possibly be slower as those could have
+            //! been serviced from the faster OS cache. Direct reads have alignment restrictions. Many of the other stream stack
+            //! entries are (optionally) aware and make adjustments. For the most optimal performance align read buffers to the
+            //! physicalSectorSize. File systems that don't support direct reads, such as tmpfs, automatically use buffered reads.
+            u8 m_enableDirectReads : 1;
+            //! Register the staging buffers with the io_uring. This avoids the kernel mapping the buffers for every read, but
+            //! counts towards the locked memory limit (RLIMIT_MEMLOCK) of the process. If registering fails the buffers are
+            //! used unregistered.
+            u8 m_enableRegisteredBuffers : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that's optimized for use on Linux. Reads are issued asynchronously through
+        //! io_uring, so multiple reads can be in flight at the same time. If io_uring isn't available, for instance because
+        //! the kernel is too old or because it's blocked by a container's seccomp profile, reads are done synchronously.
+        //! @param drivePaths The mount points that are serviced by this device. A single device can have multiple mount
+        //!     points. Use "/" to service every absolute path.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntires The maximum number of files to keep meta data, such as the file size, to cache. Only
+        //!     a small number are needed when running from archives, but it's recommended that a larger number are kept open
+        //!     when reading from loose files.
+        //! @param physicalSectorSize The minimal sector size as instructed by the device. When direct reads are used the output
+        //!     buffer needs to be aligned to this value.
+        //! @param logicalSectorSize The minimal sector size as instructed by the device. When direct reads are used the
+        //!     file size and read offset need to be aligned to this value.
+        //! @param ioChannelCount The maximum number of requests that the IO controller driving the device supports. This value
+        //!     will be capped by the maximum number of parallel requests that can be issued per thread.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. An over-commit that is too large can negatively impact the
+        //!     scheduler's ability to re-order requests for optimal read order. A negative value will under-commit and will
+        //!     avoid saturating the IO controller which can be needed if the drive is used by other applications.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(const AZStd::vector<AZStd::string_view>& drivePaths, u32 maxFileHandles, u32 maxMetaDataCacheEntries,
+            size_t physicalSectorSize, size_t logicalSectorSize, u32 ioChannelCount, s32 overCommit, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        //! Maximum number of reads that can be in flight at the same time.
+        static constexpr u32 MaxIoChannels = 256;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr u32 InvalidStagingBufferIndex = std::numeric_limits<u32>::max();
+
+        struct IoUring
+        {
+            int m_ringFd{ -1 };
+            int m_eventFd{ -1 };
+
+            void* m_submissionRing{ nullptr };
+            size_t m_submissionRingSize{ 0 };
+            unsigned* m_submissionHead{ nullptr };
+            unsigned* m_submissionTail{ nullptr };
+            unsigned* m_submissionArray{ nullptr };
+            unsigned m_submissionMask{ 0 };
+            io_uring_sqe* m_submissionEntries{ nullptr };
+            size_t m_submissionEntriesSize{ 0 };
+
+            void* m_completionRing{ nullptr };
+            size_t m_completionRingSize{ 0 };
+            unsigned* m_completionHead{ nullptr };
+            unsigned* m_completionTail{ nullptr };
+            unsigned m_completionMask{ 0 };
+            io_uring_cqe* m_completionEntries{ nullptr };
+
+            unsigned m_unsubmittedCount{ 0 };
+            bool m_hasRegisteredBuffers{ false };
+
+            bool Create(u32 entryCount);
+            void Destroy();
+            bool IsActive() const { return m_ringFd >= 0; }
+            //! Returns a cleared submission entry ready to be filled in, or null if the submission queue is full.
+            io_uring_sqe* GetSubmissionEntry();
+            //! Hands all filled in submission entries to the kernel. Entries the kernel can't accept right now stay queued
+            //! and are submitted with the next call. Returns false if the kernel rejected the entries.
+            bool Submit();
+        };
+
+        struct FileReadInformation
+        {
+            AZStd::chrono::steady_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr };    // Internally allocated buffer that is sector aligned.
+            void* m_readOutput{ nullptr };             // The buffer the read is issued into.
+            size_t m_copyBackOffset{ 0 };
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            u32 m_stagingBufferIndex{ InvalidStagingBufferIndex };
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        void InitializeCaches();
+        OpenFileResult OpenFile(int& fileHandle, size_t& cacheSlot, FileRequest* request, const Requests::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        bool ReadRequest(FileRequest* request, size_t readSlot);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot();
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+        bool IsServicedByThisDrive(AZ::IO::PathView filePath) const;
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        void EstimateCompletionTimeForRequestChecked(FileRequest* request,
+            AZStd::chrono::steady_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+        u64 CalculateCoalesceGap() const;
+
+        void CloseFile(size_t cacheIndex);
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        bool FinalizeReads();
+        //! Completes the read in the given slot. result is the number of bytes read or a negative errno value.
+        void FinalizeSingleRequest(size_t readSlot, s64 result);
+
+        void Report(const Requests::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_seekPercentageStat;
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+#endif
+        AZStd::chrono::steady_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        IoUring m_ring;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::vector<iovec> m_readSlots_ioVectors;
+        AZStd::vector<bool> m_readSlots_active;
+
+        AZStd::vector<AZStd::chrono::steady_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+        AZStd::vector<bool> m_fileCache_isDirect;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        AZStd::vector<AZStd::string> m_drivePaths;
+
+        //! One staging buffer per IO channel for reads that need to be aligned, allocated as a single block.
+        u8* m_stagingBuffers{ nullptr };
+        AZStd::vector<u32> m_freeStagingBuffers;
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_ioChannelCount{ 1 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
+#include <AzCore/std/containers/unordered_set.h>
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    static bool ReadBlockQueueValue(const AZ::IO::FixedMaxPath& deviceDirectory, const char* name, u64& value)
+    {
+        AZ::IO::FixedMaxPath queuePath = deviceDirectory / "queue" / name;
+        FILE* file = fopen(queuePath.c_str(), "r");
+        if (!file)
+        {
+            return false;
+        }
+        unsigned long long result = 0;
+        const bool isRead = fscanf(file, "%llu", &result) == 1;
+        fclose(file);
+        if (isRead)
+        {
+            value = result;
+        }
+        return isRead;
+    }
+
+    static bool CollectBlockDevice(const char* deviceDirectory, DriveInformation& information, bool reportHardware)
+    {
+        // Partitions don't have their own request queue, so use the one of the disk the partition is on.
+        char resolvedPath[PATH_MAX];
+        if (!realpath(deviceDirectory, resolvedPath))
+        {
+            return false;
+        }
+        AZ::IO::FixedMaxPath devicePath(resolvedPath);
+        if (access((devicePath / "partition").c_str(), F_OK) == 0)
+        {
+            devicePath = devicePath.ParentPath();
+        }
+
+        u64 logicalBlockSize = 0;
+        if (!ReadBlockQueueValue(devicePath, "logical_block_size", logicalBlockSize))
+        {
+            // Devices such as the ones backing overlay or network file systems don't have a block queue.
+            return false;
+        }
+        u64 physicalBlockSize = logicalBlockSize;
+        u64 maxSectorsKib = 0;
+        u64 requestCount = 0;
+        u64 rotational = 1;
+        ReadBlockQueueValue(devicePath, "physical_block_size", physicalBlockSize);
+        ReadBlockQueueValue(devicePath, "max_sectors_kb", maxSectorsKib);
+        ReadBlockQueueValue(devicePath, "nr_requests", requestCount);
+        ReadBlockQueueValue(devicePath, "rotational", rotational);
+
+        if (reportHardware)
+        {
+            AZ_Printf(
+                "Streamer",
+                "Block device '%s':\n"
+                "    Drive type: %s\n"
+                "    Max transfer: %llu kb\n"
+                "    Max IO count: %llu\n"
+                "    Physical sector size: %llu bytes\n"
+                "    Logical sector size: %llu bytes\n",
+                devicePath.Filename().Native().c_str(), rotational ? "HDD" : "SSD", maxSectorsKib, requestCount, physicalBlockSize,
+                logicalBlockSize);
+        }
+
+        information.m_physicalSectorSize = AZStd::max(information.m_physicalSectorSize, aznumeric_cast<size_t>(physicalBlockSize));
+        information.m_logicalSectorSize = AZStd::max(information.m_logicalSectorSize, aznumeric_cast<size_t>(logicalBlockSize));
+        information.m_maxTransfer = AZStd::max(information.m_maxTransfer, aznumeric_cast<size_t>(maxSectorsKib * 1024));
+        information.m_ioChannelCount = AZStd::max(information.m_ioChannelCount, aznumeric_cast<u32>(requestCount));
+        information.m_hasSeekPenalty = information.m_hasSeekPenalty || rotational != 0;
+        return true;
+    }
+
+    static void CollectUsedDevices(AZStd::unordered_set<dev_t>& devices)
+    {
+        auto settingsRegistry = SettingsRegistry::Get();
+        if (!settingsRegistry)
+        {
+            return;
+        }
+
+        auto CollectDevice = [&devices](const AZ::SettingsRegistryInterface::VisitArgs& visitArgs)
+        {
+            AZ::IO::FixedMaxPath runtimePath;
+            struct stat attributes;
+            if (visitArgs.m_registry.Get(runtimePath.Native(), visitArgs.m_jsonKeyPath) && ::stat(runtimePath.c_str(), &attributes) == 0)
+            {
+                devices.insert(attributes.st_dev);
+            }
+            return AZ::SettingsRegistryInterface::VisitResponse::Skip;
+        };
+        AZ::SettingsRegistryVisitorUtils::VisitObject(*settingsRegistry, CollectDevice, SettingsRegistryMergeUtils::FilePathsRootKey);
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& hardwareInfo, bool addAllDrives, bool reportHardware)
+    {
+        // Linux presents all mounted devices as a single file tree, so a single drive services all absolute paths. The drive
+        // is configured for the most restrictive requirements of the devices that are in use.
+        DriveInformation driveInformation;
+        driveInformation.m_paths.emplace_back("/");
+        driveInformation.m_profile = "Generic";
+        driveInformation.m_physicalSectorSize = 0;
+        driveInformation.m_logicalSectorSize = 0;
+        driveInformation.m_hasSeekPenalty = false;
+
+        bool hasDevice = false;
+        if (addAllDrives)
+        {
+            if (DIR* blockDevices = opendir("/sys/block"); blockDevices != nullptr)
+            {
+                while (dirent* entry = readdir(blockDevices))
+                {
+                    if (entry->d_name[0] != '.')
+                    {
+                        AZ::IO::FixedMaxPath devicePath = AZ::IO::FixedMaxPath("/sys/block") / entry->d_name;
+                        hasDevice = CollectBlockDevice(devicePath.c_str(), driveInformation, reportHardware) || hasDevice;
+                    }
+                }
+                closedir(blockDevices);
+            }
+        }
+        else
+        {
+            AZStd::unordered_set<dev_t> devices;
+            CollectUsedDevices(devices);
+            for (dev_t device : devices)
+            {
+                AZ::IO::FixedMaxPath devicePath(AZ::IO::FixedMaxPathString::format("/sys/dev/block/%u:%u", major(device), minor(device)));
+                if (CollectBlockDevice(devicePath.c_str(), driveInformation, reportHardware))
+                {
+                    hasDevice = true;
+                }
+                else if (reportHardware)
+                {
+                    AZ_Printf("Streamer", "Skipping device %u:%u because it's not a block device.\n", major(device), minor(device));
+                }
+            }
+        }
+
+        if (!hasDevice)
+        {
+            // Paths can be on file systems without a block device, such as the overlay file system of a container. Reads still
+            // go through the drive, so use the common defaults which CollectIoHardwareInformation falls back to as well.
+            driveInformation.m_physicalSectorSize = 4096;
+            driveInformation.m_logicalSectorSize = 512;
+            driveInformation.m_maxTransfer = 512_kib;
+            driveInformation.m_ioChannelCount = 32;
+            if (reportHardware)
+            {
+                AZ_Printf("Streamer", "No block devices found for the paths in use, using default drive settings.\n");
+            }
+        }
+
+        hardwareInfo.m_maxPhysicalSectorSize = AZStd::max(hardwareInfo.m_maxPhysicalSectorSize, driveInformation.m_physicalSectorSize);
+        hardwareInfo.m_maxLogicalSectorSize = AZStd::max(hardwareInfo.m_maxLogicalSectorSize, driveInformation.m_logicalSectorSize);
+        hardwareInfo.m_maxPageSize = AZStd::max(hardwareInfo.m_maxPageSize, aznumeric_cast<size_t>(sysconf(_SC_PAGESIZE)));
+        hardwareInfo.m_maxTransfer = AZStd::max(hardwareInfo.m_maxTransfer, driveInformation.m_maxTransfer);
+        hardwareInfo.m_profile = driveInformation.m_profile;
+
+        DriveList driveList;
+        driveList.push_back(AZStd::move(driveInformation));
+        hardwareInfo.m_platformData = AZStd::make_any<DriveList>(AZStd::move(driveList));
+        return hasDevice;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, bool includeAllHardware, bool reportHardware)
+    {
+        if (!CollectHardwareInfo(info, includeAllHardware, reportHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/std/utils.h>
+
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace AZ::Platform
+{
+    namespace
+    {
+        void ResetEvent(int eventFd)
+        {
+            eventfd_t value;
+            // The events are non-blocking, so this only fails if the event wasn't signaled.
+            [[maybe_unused]] int result = eventfd_read(eventFd, &value);
+        }
+    } // namespace
+
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_events[0].fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        m_events[0].events = POLLIN;
+        AZ_Assert(m_events[0].fd >= 0, "Failed to create a required event for IO Scheduler (Error: %i).", errno);
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        AZ_Assert(m_eventCount == 1, "There are still %u IO events registered with the IO Scheduler.",
+            static_cast<unsigned int>(m_eventCount - 1));
+        if (m_events[0].fd >= 0)
+        {
+            close(m_events[0].fd);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        AZ_Assert(m_events[0].fd >= 0, "There is no synchronization event created for the main streamer thread to use to suspend.");
+
+        int result;
+        do
+        {
+            result = poll(m_events, m_eventCount, -1);
+        } while (result < 0 && errno == EINTR);
+
+        if (result > 0)
+        {
+            for (nfds_t i = 0; i < m_eventCount; ++i)
+            {
+                if (m_events[i].revents & POLLIN)
+                {
+                    ResetEvent(m_events[i].fd);
+                }
+                m_events[i].revents = 0;
+            }
+            m_threadWakeUpQueued.store(false, AZStd::memory_order_release);
+        }
+        else
+        {
+            AZ_Assert(false, "Unexpected wait result: %i (Error: %i).", result, errno);
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        AZ_Assert(m_events[0].fd >= 0, "There is no synchronization event created for the main streamer thread to use to resume.");
+        if (!m_threadWakeUpQueued.exchange(true, AZStd::memory_order_acq_rel))
+        {
+            eventfd_write(m_events[0].fd, 1);
+        }
+    }
+
+    void StreamerContextThreadSync::RegisterIoEvent(int eventFd)
+    {
+        AZ_Assert(AreIoEventsAvailable(), "There are no more slots available to register a new IO event in.");
+        m_events[m_eventCount].fd = eventFd;
+        m_events[m_eventCount].events = POLLIN;
+        m_events[m_eventCount].revents = 0;
+        m_eventCount++;
+    }
+
+    void StreamerContextThreadSync::UnregisterIoEvent(int eventFd)
+    {
+        for (nfds_t i = 1; i < m_eventCount; ++i)
+        {
+            if (m_events[i].fd == eventFd)
+            {
+                m_eventCount--;
+                AZStd::swap(m_events[i], m_events[m_eventCount]);
+                return;
+            }
+        }
+
+        AZ_Assert(false, "IO event couldn't be unregistered as it wasn't found.");
+    }
+
+    bool StreamerContextThreadSync::AreIoEventsAvailable() const
+    {
+        return m_eventCount < MaxIoEvents + 1;
+    }
+} // namespace AZ::Platform
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/parallel/atomic.h>
+
+#include <poll.h>
+
+namespace AZ::Platform
+{
+    //! Suspends the streamer thread until it's woken up by another thread or until one of the registered IO events,
+    //! such as the eventfd of an io_uring, signals that IO has completed.
+    class StreamerContextThreadSync
+    {
+    public:
+        static constexpr size_t MaxIoEvents = 63;
+
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Adds an eventfd that wakes up the streamer thread when it's signaled. The counter of the eventfd is reset
+        //! when the streamer thread wakes up.
+        void RegisterIoEvent(int eventFd);
+        void UnregisterIoEvent(int eventFd);
+        bool AreIoEventsAvailable() const;
+
+    private:
+        // Note: The first event is reserved for the synchronization of the scheduler thread with the rest of the
+        // engine. The remaining events are registered by Streamer's internals.
+        pollfd m_events[MaxIoEvents + 1]{};
+        nfds_t m_eventCount{ 1 }; // The first event is for external wake up calls.
+        AZStd::atomic<bool> m_threadWakeUpQueued{ false }; //!< Avoids redundant writes to the wake up event.
+    };
+} // namespace AZ::Platform
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/OSMemory.h>
+#include <AzCore/std/algorithm.h>
+
+#include <fcntl.h>
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace AZ::OSMemory
+{
+    namespace
+    {
+        // The OS is queried through small sysfs/procfs files, read with plain syscalls since this runs inside the
+        // allocators and must not allocate
+        constexpr size_t MaxNumaNodes = 64;
+
+        size_t ReadSmallFile(const char* path, char* buffer, size_t bufferSize)
+        {
+            const int fd = open(path, O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+            {
+                return 0;
+            }
+            const ssize_t bytesRead = read(fd, buffer, bufferSize - 1);
+            close(fd);
+            const size_t length = bytesRead > 0 ? static_cast<size_t>(bytesRead) : 0;
+            buffer[length] = '\0';
+            return length;
+        }
+
+        const char* ParseUnsigned(const char* text, unsigned long& value)
+        {
+            value = 0;
+            while (*text >= '0' && *text <= '9')
+            {
+                value = value * 10 + static_cast<unsigned long>(*text - '0');
+                ++text;
+            }
+            return text;
+        }
+
+        // Calls visitor for each number in a sysfs list such as "0-7,16-23"
+        template<class Visitor>
+        void ForEachInList(const char* text, Visitor&& visitor)
+        {
+            while (*text >= '0' && *text <= '9')
+            {
+                unsigned long first;
+                unsigned long last;
+                text = ParseUnsigned(text, first);
+                last = first;
+                if (*text == '-')
+                {
+                    text = ParseUnsigned(text + 1, last);
+                }
+                for (unsigned long i = first; i <= last; ++i)
+                {
+                    visitor(i);
+                }
+                if (*text != ',')
+                {
+                    break;
+                }
+                ++text;
+            }
+        }
+
+        size_t QueryLargePageSize()
+        {
+            char buffer[64];
+            unsigned long value = 0;
+            // Transparent huge pages are PMD sized, explicit ones default to the same size on the common architectures
+            if (ReadSmallFile("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", buffer, sizeof(buffer)))
+            {
+                ParseUnsigned(buffer, value);
+            }
+            return static_cast<size_t>(value);
+        }
+
+        unsigned int QueryNumaNodeCount()
+        {
+            char buffer[256];
+            unsigned long highestNode = 0;
+            if (ReadSmallFile("/sys/devices/system/node/online", buffer, sizeof(buffer)))
+            {
+                ForEachInList(buffer, [&highestNode](unsigned long node) { highestNode = AZStd::max(highestNode, node); });
+            }
+            return static_cast<unsigned int>(AZStd::min<unsigned long>(highestNode + 1, MaxNumaNodes));
+        }
+
+        void* MapPages(size_t byteSize, int extraFlags)
+        {
+            void* address = mmap(nullptr, byteSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | extraFlags, -1, 0);
+            return address == MAP_FAILED ? nullptr : address;
+        }
+
+        // Transparent huge pages are only used for ranges aligned to the large page, so over-map and trim both ends
+        void* MapAlignedPages(size_t byteSize, size_t alignment)
+        {
+            char* mapping = static_cast<char*>(MapPages(byteSize + alignment, 0));
+            if (!mapping)
+            {
+                return nullptr;
+            }
+            char* address = reinterpret_cast<char*>(AZ::SizeAlignUp(reinterpret_cast<size_t>(mapping), alignment));
+            if (address != mapping)
+            {
+                munmap(mapping, address - mapping);
+            }
+            const size_t tailSize = (mapping + byteSize + alignment) - (address + byteSize);
+            if (tailSize)
+            {
+                munmap(address + byteSize, tailSize);
+            }
+            return address;
+        }
+    } // namespace
+
+    size_t GetLargePageSize()
+    {
+        static const size_t largePageSize = QueryLargePageSize();
+        return largePageSize;
+    }
+
+    void* AllocatePages(size_t byteSize, LargePageMode mode, int numaNode)
+    {
+        const size_t largePageSize = GetLargePageSize();
+        if (largePageSize == 0)
+        {
+            mode = LargePageMode::Disabled;
+        }
+        AZ_Assert(mode == LargePageMode::Disabled || byteSize % largePageSize == 0,
+            "Large page mappings must be a multiple of %zu bytes, %zu requested", largePageSize, byteSize);
+
+        void* address = nullptr;
+        if (mode == LargePageMode::Explicit)
+        {
+            // Fails when no huge pages are reserved (vm.nr_hugepages), fall back to transparent ones
+            address = MapPages(byteSize, MAP_HUGETLB);
+        }
+        if (!address && mode != LargePageMode::Disabled)
+        {
+            address = MapAlignedPages(byteSize, largePageSize);
+            if (address)
+            {
+                madvise(address, byteSize, MADV_HUGEPAGE);
+            }
+        }
+        if (!address && mode == LargePageMode::Disabled)
+        {
+            address = MapPages(byteSize, 0);
+        }
+
+        if (address && numaNode >= 0 && static_cast<unsigned int>(numaNode) < GetNumaNodeCount())
+        {
+            // Only a preference, the kernel still falls back to other nodes when this one runs out of memory
+            const unsigned long nodeMask = 1ul << numaNode;
+            syscall(SYS_mbind, address, byteSize, MPOL_PREFERRED, &nodeMask, MaxNumaNodes, 0);
+        }
+        return address;
+    }
+
+    void FreePages(void* address, size_t byteSize)
+    {
+        if (address)
+        {
+            munmap(address, byteSize);
+        }
+    }
+
+    unsigned int GetNumaNodeCount()
+    {
+        static const unsigned int numaNodeCount = QueryNumaNodeCount();
+        return numaNodeCount;
+    }
+
+    int GetCurrentNumaNode()
+    {
+        unsigned int cpu = 0;
+        unsigned int node = 0;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+        {
+            return AnyNumaNode;
+        }
+        return static_cast<int>(node);
+    }
+
+    bool SetCurrentThreadNumaNode(int numaNode)
+    {
+        if (numaNode < 0 || static_cast<unsigned int>(numaNode) >= GetNumaNodeCount())
+        {
+            return false;
+        }
+
+        char path[64];
+        char buffer[1024];
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", numaNode);
+        if (!ReadSmallFile(path, buffer, sizeof(buffer)))
+        {
+            return false;
+        }
+
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        ForEachInList(buffer, [&cpuSet](unsigned long cpu)
+            {
+                if (cpu < CPU_SETSIZE)
+                {
+                    CPU_SET(cpu, &cpuSet);
+                }
+            });
+        if (CPU_COUNT(&cpuSet) == 0 || sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+        {
+            return false;
+        }
+
+        const unsigned long nodeMask = 1ul << numaNode;
+        return syscall(SYS_set_mempolicy, MPOL_PREFERRED, &nodeMask, MaxNumaNodes) == 0;
+    }
+} // namespace AZ::OSMemory
@@ -31,11 +31,15 @@ set(FILES
     ../Common/Apple/AzCore/Process/ProcessInfo_Apple.cpp
     ../Common/UnixLike/AzCore/Debug/StackTracer_UnixLike.cpp
     ../Common/Apple/AzCore/Debug/Trace_Apple.cpp
+    ../Common/Unimplemented/AzCore/Debug/HardwareCounters_Unimplemented.cpp
+    ../Common/Unimplemented/AzCore/Jobs/Internal/JobFiber_Unimplemented.cpp
+    ../Common/Unimplemented/AzCore/Memory/OSMemory_Unimplemented.cpp
     ../Common/Apple/AzCore/IO/SystemFile_Apple.cpp
     ../Common/Apple/AzCore/IO/SystemFile_Apple.h
     ../Common/Default/AzCore/IO/Streamer/StreamerConfiguration_Default.cpp
     ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.cpp
     ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.h
+    ../Common/UnixLike/AzCore/IO/MappedFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/SystemFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.h
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.cpp
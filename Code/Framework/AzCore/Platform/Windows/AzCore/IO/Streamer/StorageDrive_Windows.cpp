@@ -286,9 +286,23 @@ namespace AZ::IO
     {
         StreamStackEntry::UpdateStatus(status);
         status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+        status.m_coalesceGap = AZStd::min(status.m_coalesceGap, CalculateCoalesceGap());
         status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
     }
 
+    u64 StorageDriveWin::CalculateCoalesceGap() const
+    {
+        if (!m_constructionOptions.m_hasSeekPenalty)
+        {
+            // Without a seek penalty only reads that are directly adjacent benefit from being merged.
+            return 0;
+        }
+        // Reading through a gap is cheaper than seeking over it as long as reading the gap takes less time than the seek.
+        const double bytesPerMicrosecond =
+            aznumeric_cast<double>(m_readSizeAverage.GetTotal()) / aznumeric_cast<double>(m_readTimeAverage.GetTotal().count());
+        return aznumeric_cast<u64>(bytesPerMicrosecond * aznumeric_cast<double>(s_averageSeekTime.count()));
+    }
+
     void StorageDriveWin::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
         StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd)
     {
@@ -137,6 +137,7 @@ namespace AZ::IO
         void EstimateCompletionTimeForRequestChecked(FileRequest* request,
             AZStd::chrono::steady_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const;
         s32 CalculateNumAvailableSlots() const;
+        u64 CalculateCoalesceGap() const;
 
         void FlushCache(const RequestPath& filePath);
         void FlushEntireCache();
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/Memory/OSMemory.h>
+
+namespace AZ::OSMemory
+{
+    namespace
+    {
+        // MEM_LARGE_PAGES requires the "Lock pages in memory" privilege, which has to be enabled on the process token
+        // even when the account holds it
+        bool EnableLockMemoryPrivilege()
+        {
+            HANDLE token = nullptr;
+            if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+            {
+                return false;
+            }
+
+            TOKEN_PRIVILEGES privileges = {};
+            privileges.PrivilegeCount = 1;
+            privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+            bool enabled = LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) &&
+                AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr) && GetLastError() == ERROR_SUCCESS;
+            CloseHandle(token);
+            return enabled;
+        }
+
+        bool HasLargePagePrivilege()
+        {
+            static const bool hasPrivilege = EnableLockMemoryPrivilege();
+            return hasPrivilege;
+        }
+
+        void* VirtualAllocOnNode(size_t byteSize, DWORD allocationType, int numaNode)
+        {
+            if (numaNode >= 0 && static_cast<unsigned int>(numaNode) < GetNumaNodeCount())
+            {
+                return VirtualAllocExNuma(GetCurrentProcess(), nullptr, byteSize, allocationType, PAGE_READWRITE, static_cast<DWORD>(numaNode));
+            }
+            return VirtualAlloc(nullptr, byteSize, allocationType, PAGE_READWRITE);
+        }
+    } // namespace
+
+    size_t GetLargePageSize()
+    {
+        static const size_t largePageSize = GetLargePageMinimum();
+        return largePageSize;
+    }
+
+    void* AllocatePages(size_t byteSize, LargePageMode mode, int numaNode)
+    {
+        const size_t largePageSize = GetLargePageSize();
+        if (largePageSize == 0)
+        {
+            mode = LargePageMode::Disabled;
+        }
+        AZ_Assert(mode == LargePageMode::Disabled || byteSize % largePageSize == 0,
+            "Large page mappings must be a multiple of %zu bytes, %zu requested", largePageSize, byteSize);
+
+        // Windows has no transparent large pages, both modes try locked large pages first
+        void* address = nullptr;
+        if (mode != LargePageMode::Disabled && HasLargePagePrivilege())
+        {
+            address = VirtualAllocOnNode(byteSize, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, numaNode);
+        }
+        if (!address)
+        {
+            address = VirtualAllocOnNode(byteSize, MEM_RESERVE | MEM_COMMIT, numaNode);
+        }
+        return address;
+    }
+
+    void FreePages(void* address, [[maybe_unused]] size_t byteSize)
+    {
+        if (address)
+        {
+            VirtualFree(address, 0, MEM_RELEASE);
+        }
+    }
+
+    unsigned int GetNumaNodeCount()
+    {
+        static const unsigned int numaNodeCount = []()
+        {
+            ULONG highestNode = 0;
+            return GetNumaHighestNodeNumber(&highestNode) ? static_cast<unsigned int>(highestNode) + 1 : 1u;
+        }();
+        return numaNodeCount;
+    }
+
+    int GetCurrentNumaNode()
+    {
+        PROCESSOR_NUMBER processor;
+        GetCurrentProcessorNumberEx(&processor);
+        USHORT node = 0;
+        if (!GetNumaProcessorNodeEx(&processor, &node))
+        {
+            return AnyNumaNode;
+        }
+        return static_cast<int>(node);
+    }
+
+    bool SetCurrentThreadNumaNode(int numaNode)
+    {
+        if (numaNode < 0 || static_cast<unsigned int>(numaNode) >= GetNumaNodeCount())
+        {
+            return false;
+        }
+
+        // Memory is taken from the node of the processor a thread runs on by default, binding the thread is enough
+        GROUP_AFFINITY affinity = {};
+        if (!GetNumaNodeProcessorMaskEx(static_cast<USHORT>(numaNode), &affinity) || affinity.Mask == 0)
+        {
+            return false;
+        }
+        return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != 0;
+    }
+} // namespace AZ::OSMemory
@@ -34,8 +34,11 @@ set(FILES
     ../Common/WinAPI/AzCore/Process/ProcessInfo_WinAPI.cpp
     AzCore/Debug/StackTracer_Windows.cpp
     ../Common/WinAPI/AzCore/Debug/Trace_WinAPI.cpp
+    ../Common/Unimplemented/AzCore/Debug/HardwareCounters_Unimplemented.cpp
+    ../Common/WinAPI/AzCore/Jobs/Internal/JobFiber_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.h
+    ../Common/WinAPI/AzCore/IO/MappedFile_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.h
     AzCore/IO/SystemFile_Platform.h
@@ -51,6 +54,7 @@ set(FILES
     AzCore/IPC/SharedMemory_Windows.cpp
     ../Common/WinAPI/AzCore/Memory/OSAllocator_WinAPI.h
     AzCore/Memory/OSAllocator_Platform.h
+    AzCore/Memory/OSMemory_Windows.cpp
     AzCore/Math/Random_Platform.h
     AzCore/Math/Random_Windows.cpp
     AzCore/Math/Random_Windows.h
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "UserTypes.h"
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/flat_hash_set.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <random>
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+namespace UnitTest
+{
+    class FlatHashedContainers
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(FlatHashedContainers, FlatHashMap_InsertFindErase_MatchesUnorderedMap)
+    {
+        AZStd::flat_hash_map<int, int> flatMap;
+        AZStd::unordered_map<int, int> nodeMap;
+
+        // Keep the key range small, so the table sees many erased slots being reused.
+        unsigned int seed = 1;
+        for (int i = 0; i < 20000; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const int key = static_cast<int>((seed >> 8) % 1000);
+            switch ((seed >> 4) % 3)
+            {
+            case 0:
+                flatMap[key] = i;
+                nodeMap[key] = i;
+                break;
+            case 1:
+                EXPECT_EQ(nodeMap.erase(key), flatMap.erase(key));
+                break;
+            case 2:
+                EXPECT_EQ(nodeMap.contains(key), flatMap.contains(key));
+                break;
+            }
+            ASSERT_EQ(nodeMap.size(), flatMap.size());
+        }
+
+        size_t numVisited = 0;
+        for (const auto& [key, value] : flatMap)
+        {
+            auto it = nodeMap.find(key);
+            ASSERT_NE(nodeMap.end(), it);
+            EXPECT_EQ(it->second, value);
+            ++numVisited;
+        }
+        EXPECT_EQ(nodeMap.size(), numVisited);
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_EraseIterator_ReturnsNextElement)
+    {
+        AZStd::flat_hash_map<int, int> flatMap;
+        for (int i = 0; i < 100; ++i)
+        {
+            flatMap.emplace(i, i * 2);
+        }
+
+        for (auto it = flatMap.begin(); it != flatMap.end();)
+        {
+            it = (it->first % 2) ? flatMap.erase(it) : AZStd::next(it);
+        }
+
+        EXPECT_EQ(50, flatMap.size());
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_EQ(i % 2 == 0, flatMap.contains(i));
+        }
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_TryEmplaceAndInsertOrAssign)
+    {
+        AZStd::flat_hash_map<AZStd::string, AZStd::string> flatMap;
+
+        auto [it, inserted] = flatMap.try_emplace("first", "one");
+        EXPECT_TRUE(inserted);
+        EXPECT_EQ("one", it->second);
+
+        AZStd::string key = "first";
+        AZStd::tie(it, inserted) = flatMap.try_emplace(AZStd::move(key), "two");
+        EXPECT_FALSE(inserted);
+        EXPECT_EQ("one", it->second);
+        // The key is only moved from when the element gets inserted.
+        EXPECT_EQ("first", key);
+
+        AZStd::tie(it, inserted) = flatMap.insert_or_assign("first", AZStd::string("three"));
+        EXPECT_FALSE(inserted);
+        EXPECT_EQ("three", flatMap.at("first"));
+
+        flatMap["second"] = "four";
+        EXPECT_EQ(2, flatMap.size());
+        EXPECT_EQ("four", flatMap.at("second"));
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_CopyMoveAndSwap)
+    {
+        AZStd::flat_hash_map<int, AZStd::string> flatMap{ { 1, "one" }, { 2, "two" }, { 3, "three" } };
+
+        AZStd::flat_hash_map<int, AZStd::string> copy = flatMap;
+        EXPECT_EQ(flatMap, copy);
+
+        AZStd::flat_hash_map<int, AZStd::string> moved = AZStd::move(copy);
+        EXPECT_EQ(flatMap, moved);
+        EXPECT_TRUE(copy.empty());
+        EXPECT_TRUE(copy.begin() == copy.end());
+
+        AZStd::flat_hash_map<int, AZStd::string> other{ { 4, "four" } };
+        moved.swap(other);
+        EXPECT_EQ(1, moved.size());
+        EXPECT_EQ(flatMap, other);
+
+        other.clear();
+        EXPECT_TRUE(other.empty());
+        EXPECT_NE(flatMap, other);
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_Reserve_DoesNotGrowOnInsert)
+    {
+        AZStd::flat_hash_map<int, int> flatMap;
+        flatMap.reserve(1000);
+        const size_t capacity = flatMap.capacity();
+        EXPECT_GE(capacity, 1000);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            flatMap.emplace(i, i);
+        }
+        EXPECT_EQ(capacity, flatMap.capacity());
+
+        flatMap.clear();
+        flatMap.rehash(0);
+        EXPECT_EQ(0, flatMap.capacity());
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashSet_UniqueKeys)
+    {
+        AZStd::flat_hash_set<AZ::Crc32> flatSet{ AZ::Crc32("a"), AZ::Crc32("b"), AZ::Crc32("a") };
+        EXPECT_EQ(2, flatSet.size());
+        EXPECT_FALSE(flatSet.insert(AZ::Crc32("b")).second);
+        EXPECT_TRUE(flatSet.insert(AZ::Crc32("c")).second);
+        EXPECT_EQ(1, flatSet.count(AZ::Crc32("c")));
+        EXPECT_EQ(1, flatSet.erase(AZ::Crc32("a")));
+        EXPECT_EQ(flatSet.end(), flatSet.find(AZ::Crc32("a")));
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Compares the node based AZStd::unordered_map with AZStd::flat_hash_map for the key types that are used the most.
+    template<class Map>
+    class BM_FlatHashMap
+        : public benchmark::Fixture
+    {
+        using key_type = typename Map::key_type;
+
+        void internalSetUp()
+        {
+            constexpr size_t count = 10000;
+
+            std::mt19937_64 rng(1);
+            m_keys.reserve(count);
+            m_missingKeys.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                m_keys.push_back(MakeKey(rng()));
+                m_missingKeys.push_back(MakeKey(rng()));
+            }
+        }
+
+        static key_type MakeKey(uint64_t value)
+        {
+            if constexpr (AZStd::is_same_v<key_type, AZ::Uuid>)
+            {
+                return AZ::Uuid::CreateData(reinterpret_cast<const AZStd::byte*>(&value), sizeof(value));
+            }
+            else if constexpr (AZStd::is_same_v<key_type, AZ::EntityId>)
+            {
+                return AZ::EntityId(value);
+            }
+            else
+            {
+                return key_type(static_cast<AZ::u32>(value));
+            }
+        }
+
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void TearDown(const benchmark::State&) override
+        {
+            m_keys = {};
+            m_missingKeys = {};
+        }
+        void TearDown(benchmark::State&) override
+        {
+            m_keys = {};
+            m_missingKeys = {};
+        }
+
+        void Insert(benchmark::State& state)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                Map map;
+                for (const key_type& key : m_keys)
+                {
+                    map.emplace(key, 1);
+                }
+                benchmark::DoNotOptimize(map.size());
+            }
+            state.SetItemsProcessed(state.iterations() * m_keys.size());
+        }
+
+        void FindHit(benchmark::State& state)
+        {
+            Map map;
+            for (const key_type& key : m_keys)
+            {
+                map.emplace(key, 1);
+            }
+            for ([[maybe_unused]] auto _ : state)
+            {
+                int sum = 0;
+                for (const key_type& key : m_keys)
+                {
+                    sum += map.find(key)->second;
+                }
+                benchmark::DoNotOptimize(sum);
+            }
+            state.SetItemsProcessed(state.iterations() * m_keys.size());
+        }
+
+        void FindMiss(benchmark::State& state)
+        {
+            Map map;
+            for (const key_type& key : m_keys)
+            {
+                map.emplace(key, 1);
+            }
+            for ([[maybe_unused]] auto _ : state)
+            {
+                size_t misses = 0;
+                for (const key_type& key : m_missingKeys)
+                {
+                    misses += map.find(key) == map.end();
+                }
+                benchmark::DoNotOptimize(misses);
+            }
+            state.SetItemsProcessed(state.iterations() * m_missingKeys.size());
+        }
+
+        void Iterate(benchmark::State& state)
+        {
+            Map map;
+            for (const key_type& key : m_keys)
+            {
+                map.emplace(key, 1);
+            }
+            for ([[maybe_unused]] auto _ : state)
+            {
+                int sum = 0;
+                for (const auto& element : map)
+                {
+                    sum += element.second;
+                }
+                benchmark::DoNotOptimize(sum);
+            }
+            state.SetItemsProcessed(state.iterations() * map.size());
+        }
+
+        AZStd::vector<key_type> m_keys;
+        AZStd::vector<key_type> m_missingKeys;
+    };
+
+#define AZ_FLAT_HASH_MAP_BENCHMARKS(Name, ...) \
+    BENCHMARK_TEMPLATE_F(BM_FlatHashMap, Name##_Insert, __VA_ARGS__)(benchmark::State& state) { this->Insert(state); } \
+    BENCHMARK_TEMPLATE_F(BM_FlatHashMap, Name##_FindHit, __VA_ARGS__)(benchmark::State& state) { this->FindHit(state); } \
+    BENCHMARK_TEMPLATE_F(BM_FlatHashMap, Name##_FindMiss, __VA_ARGS__)(benchmark::State& state) { this->FindMiss(state); } \
+    BENCHMARK_TEMPLATE_F(BM_FlatHashMap, Name##_Iterate, __VA_ARGS__)(benchmark::State& state) { this->Iterate(state); }
+
+    AZ_FLAT_HASH_MAP_BENCHMARKS(UnorderedMap_Uuid, AZStd::unordered_map<AZ::Uuid, int>)
+    AZ_FLAT_HASH_MAP_BENCHMARKS(FlatHashMap_Uuid, AZStd::flat_hash_map<AZ::Uuid, int>)
+    AZ_FLAT_HASH_MAP_BENCHMARKS(UnorderedMap_EntityId, AZStd::unordered_map<AZ::EntityId, int>)
+    AZ_FLAT_HASH_MAP_BENCHMARKS(FlatHashMap_EntityId, AZStd::flat_hash_map<AZ::EntityId, int>)
+    AZ_FLAT_HASH_MAP_BENCHMARKS(UnorderedMap_Crc32, AZStd::unordered_map<AZ::Crc32, int>)
+    AZ_FLAT_HASH_MAP_BENCHMARKS(FlatHashMap_Crc32, AZStd::flat_hash_map<AZ::Crc32, int>)
+
+#undef AZ_FLAT_HASH_MAP_BENCHMARKS
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
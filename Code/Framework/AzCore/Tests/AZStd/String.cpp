@@ -1225,6 +1225,35 @@ namespace UnitTest
         EXPECT_TRUE(cstr4.empty());
     }
 
+    TEST_F(String, HashBytes_RuntimeMatchesCompileTime)
+    {
+        constexpr AZStd::string_view Text = "Every length from empty to more than one 48 byte block of the long input loop.";
+        constexpr size_t TextSize = Text.size();
+        struct HashValues
+        {
+            AZ::u64 m_values[TextSize + 1]{};
+        };
+        constexpr HashValues compileTimeValues = [Text]() constexpr
+        {
+            HashValues values;
+            for (size_t size = 0; size <= Text.size(); ++size)
+            {
+                values.m_values[size] = AZStd::hash_bytes(Text.data(), size);
+            }
+            return values;
+        }();
+
+        AZStd::set<AZ::u64> uniqueValues;
+        for (size_t size = 0; size <= TextSize; ++size)
+        {
+            EXPECT_EQ(compileTimeValues.m_values[size], AZStd::hash_bytes(Text.data(), size)) << "size " << size;
+            uniqueValues.insert(compileTimeValues.m_values[size]);
+        }
+        EXPECT_EQ(TextSize + 1, uniqueValues.size());
+
+        EXPECT_EQ(static_cast<size_t>(AZStd::hash_bytes(Text.data(), TextSize)), AZStd::hash<AZStd::string_view>{}(Text));
+    }
+
     TEST_F(String, StringViewModifierTest)
     {
         AZStd::string_view emptyView1;
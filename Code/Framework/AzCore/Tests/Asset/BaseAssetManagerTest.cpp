@@ -50,9 +50,14 @@ namespace UnitTest
         return m_ownedAssetContainers;
     }
 
-    const AssetManager::AssetMap& TestAssetManager::GetAssets() const
+    size_t TestAssetManager::GetAssetCount() const
     {
-        return m_assets;
+        return m_assets.Size();
+    }
+
+    bool TestAssetManager::HasAsset(const AssetId& assetId) const
+    {
+        return m_assets.Contains(assetId);
     }
 
     void BaseAssetManagerTest::SetUp()
@@ -37,7 +37,8 @@ namespace UnitTest
 
         const AZ::Data::AssetManager::OwnedAssetContainerMap& GetAssetContainers() const;
 
-        const AssetMap& GetAssets() const;
+        size_t GetAssetCount() const;
+        bool HasAsset(const AssetId& assetId) const;
 
         // Expose these methods so that they can be queried by the unit tests.
         using AssetManager::GetAssetInternal;
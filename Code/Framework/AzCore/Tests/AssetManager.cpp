@@ -806,21 +806,19 @@ namespace UnitTest
 
         AssetManager::Instance().DispatchEvents();
 
-        auto&& assets = m_testAssetManager->GetAssets();
-
-        EXPECT_EQ(assets.size(), 1);
-        EXPECT_NE(assets.find(MyAsset1Id), assets.end());
+        EXPECT_EQ(m_testAssetManager->GetAssetCount(), 1);
+        EXPECT_TRUE(m_testAssetManager->HasAsset(MyAsset1Id));
 
         AssetManager::Instance().ResumeAssetRelease();
         
         // Sleep to allow for the assets to release
         int retryCount = 100;
-        while ((--retryCount>0) && assets.size() > 0)
+        while ((--retryCount>0) && m_testAssetManager->GetAssetCount() > 0)
         {
             AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
         }
 
-        EXPECT_EQ(assets.size(), 0);
+        EXPECT_EQ(m_testAssetManager->GetAssetCount(), 0);
     }
 
     TEST_F(AssetManagerTest, AssetManager_SuspendResumeAssetRelease_ReusedAssetIsNotReleased)
@@ -836,11 +834,9 @@ namespace UnitTest
 
         asset = AssetManager::Instance().GetAsset<AssetWithCustomData>(MyAsset1Id, AssetLoadBehavior::Default);
 
-        auto&& assets = m_testAssetManager->GetAssets();
-
         AssetManager::Instance().ResumeAssetRelease();
 
-        EXPECT_EQ(assets.size(), 1);
-        EXPECT_NE(assets.find(MyAsset1Id), assets.end());
+        EXPECT_EQ(m_testAssetManager->GetAssetCount(), 1);
+        EXPECT_TRUE(m_testAssetManager->HasAsset(MyAsset1Id));
     }
 }
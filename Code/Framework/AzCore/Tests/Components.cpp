@@ -11,7 +11,9 @@
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Math/Sfmt.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/ComponentActivationProfilerInterface.h>
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/ComponentDependencySortCache.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/EntityUtils.h>
 
@@ -775,6 +777,197 @@ namespace UnitTest
         EXPECT_TRUE(components[4]->RTTI_IsTypeOf(AzTypeInfo<ComponentC>::Uuid()));
     }
 
+    TEST_F(ComponentDependency, DependencySortCache_SameComposition_SortsLikeDependencySort)
+    {
+        ComponentDependencySortCache sortCache;
+
+        CreateComponents_ABCDE();
+        Entity::ComponentArrayType expectedComponents = m_entity->GetComponents();
+        ASSERT_TRUE(Entity::DependencySort(expectedComponents).IsSuccess());
+
+        // The first sort fills the cache, the second one reuses it.
+        for (int sort = 0; sort < 2; ++sort)
+        {
+            Entity::ComponentArrayType components = m_entity->GetComponents();
+            ASSERT_TRUE(sortCache.Sort(components).IsSuccess());
+            EXPECT_EQ(expectedComponents, components);
+        }
+        EXPECT_EQ(1, sortCache.GetCachedSortCount());
+
+        Entity entity2;
+        entity2.CreateComponent<ComponentA>();
+        entity2.CreateComponent<ComponentB>();
+        entity2.CreateComponent<ComponentC>();
+        entity2.CreateComponent<ComponentD>();
+        entity2.CreateComponent<ComponentE>();
+        Entity::ComponentArrayType components2 = entity2.GetComponents();
+        ASSERT_TRUE(sortCache.Sort(components2).IsSuccess());
+        EXPECT_EQ(1, sortCache.GetCachedSortCount());
+        ASSERT_EQ(expectedComponents.size(), components2.size());
+        for (size_t i = 0; i < components2.size(); ++i)
+        {
+            EXPECT_EQ(azrtti_typeid(expectedComponents[i]), azrtti_typeid(components2[i]));
+        }
+    }
+
+    TEST_F(ComponentDependency, DependencySortCache_Clear_CausesComponentSort)
+    {
+        ComponentDependencySortCache sortCache;
+
+        CreateComponents_ABCDE();
+        Entity::ComponentArrayType components = m_entity->GetComponents();
+        ASSERT_TRUE(sortCache.Sort(components).IsSuccess());
+
+        m_descriptorComponentA->m_isDependent = true; // now A should depend on D
+        sortCache.Clear();
+        EXPECT_EQ(0, sortCache.GetCachedSortCount());
+
+        components = m_entity->GetComponents();
+        ASSERT_TRUE(sortCache.Sort(components).IsSuccess());
+        EXPECT_TRUE(components[0]->RTTI_IsTypeOf(AzTypeInfo<ComponentD>::Uuid()));
+        EXPECT_TRUE(components[1]->RTTI_IsTypeOf(AzTypeInfo<ComponentA>::Uuid()));
+    }
+
+    TEST_F(ComponentDependency, DependencySortCache_FailedSort_IsNotCached)
+    {
+        ComponentDependencySortCache sortCache;
+
+        m_entity->CreateComponent<ComponentC>(); // C requires B
+        Entity::ComponentArrayType components = m_entity->GetComponents();
+        EXPECT_FALSE(sortCache.Sort(components).IsSuccess());
+        EXPECT_EQ(0, sortCache.GetCachedSortCount());
+    }
+
+    TEST_F(ComponentDependency, ActivateEntities_MixedCompositions_AllEntitiesActiveAndSorted)
+    {
+        CreateComponents_ABCDE();
+        m_entity->Init();
+
+        AZStd::vector<AZStd::unique_ptr<Entity>> entities;
+        for (int i = 0; i < 3; ++i)
+        {
+            auto& entity = entities.emplace_back(AZStd::make_unique<Entity>());
+            entity->CreateComponent<ComponentP>();
+            if (i != 1)
+            {
+                entity->CreateComponent<ComponentA>();
+                entity->CreateComponent<ComponentB>();
+                entity->CreateComponent<ComponentC>();
+                entity->CreateComponent<ComponentD>();
+                entity->CreateComponent<ComponentE>();
+            }
+            entity->Init();
+        }
+
+        AZStd::vector<Entity*> entitiesToActivate = { entities[0].get(), m_entity, entities[1].get(), entities[2].get() };
+        m_componentApp->ActivateEntities(AZStd::span<Entity* const>(entitiesToActivate));
+
+        for (Entity* entity : entitiesToActivate)
+        {
+            EXPECT_EQ(Entity::State::Active, entity->GetState());
+        }
+
+        const Entity::ComponentArrayType& components = m_entity->GetComponents();
+        EXPECT_TRUE(components[0]->RTTI_IsTypeOf(AzTypeInfo<ComponentA>::Uuid()));
+        EXPECT_TRUE(components[1]->RTTI_IsTypeOf(AzTypeInfo<ComponentD>::Uuid()));
+        EXPECT_TRUE(components[2]->RTTI_IsTypeOf(AzTypeInfo<ComponentE>::Uuid()));
+        EXPECT_TRUE(components[3]->RTTI_IsTypeOf(AzTypeInfo<ComponentB>::Uuid()));
+        EXPECT_TRUE(components[4]->RTTI_IsTypeOf(AzTypeInfo<ComponentC>::Uuid()));
+        // Components that provide no services are sorted last.
+        EXPECT_TRUE(entities[0]->GetComponents().back()->RTTI_IsTypeOf(AzTypeInfo<ComponentP>::Uuid()));
+
+        for (Entity* entity : entitiesToActivate)
+        {
+            entity->Deactivate();
+        }
+    }
+
+    TEST_F(ComponentDependency, ActivateEntities_UnsortableEntity_IsSkipped)
+    {
+        m_entity->CreateComponent<ComponentC>(); // C requires B
+        m_entity->Init();
+
+        Entity entity;
+        entity.CreateComponent<ComponentP>();
+        entity.Init();
+
+        AZStd::vector<Entity*> entitiesToActivate = { m_entity, &entity };
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_componentApp->ActivateEntities(AZStd::span<Entity* const>(entitiesToActivate));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        EXPECT_EQ(Entity::State::Init, m_entity->GetState());
+        EXPECT_EQ(Entity::State::Active, entity.GetState());
+        entity.Deactivate();
+    }
+
+    class TestActivationProfiler : public ComponentActivationProfilerInterface
+    {
+    public:
+        TestActivationProfiler()
+        {
+            AZ::Interface<ComponentActivationProfilerInterface>::Register(this);
+        }
+
+        ~TestActivationProfiler() override
+        {
+            AZ::Interface<ComponentActivationProfilerInterface>::Unregister(this);
+        }
+
+        bool IsCapturing() const override
+        {
+            return m_isCapturing;
+        }
+
+        void RecordComponentActivation(const Component& component, [[maybe_unused]] AZStd::chrono::microseconds duration) override
+        {
+            m_activatedTypes.push_back(azrtti_typeid(component));
+        }
+
+        bool m_isCapturing = true;
+        AZStd::vector<AZ::TypeId> m_activatedTypes;
+    };
+
+    TEST_F(ComponentDependency, ActivateEntities_ActivationProfilerCapturing_RecordsEveryComponent)
+    {
+        TestActivationProfiler activationProfiler;
+
+        CreateComponents_ABCDE();
+        m_entity->Init();
+
+        Entity entity;
+        entity.CreateComponent<ComponentP>();
+        entity.Init();
+
+        AZStd::vector<Entity*> entitiesToActivate = { m_entity, &entity };
+        m_componentApp->ActivateEntities(AZStd::span<Entity* const>(entitiesToActivate));
+
+        ASSERT_EQ(6, activationProfiler.m_activatedTypes.size());
+        EXPECT_EQ(1, AZStd::count(
+            activationProfiler.m_activatedTypes.begin(), activationProfiler.m_activatedTypes.end(), AzTypeInfo<ComponentP>::Uuid()));
+
+        m_entity->Deactivate();
+        entity.Deactivate();
+    }
+
+    TEST_F(ComponentDependency, EntityActivate_ActivationProfilerNotCapturing_RecordsNothing)
+    {
+        TestActivationProfiler activationProfiler;
+        activationProfiler.m_isCapturing = false;
+
+        CreateComponents_ABCDE();
+        m_entity->Init();
+        m_entity->Activate();
+        EXPECT_EQ(Entity::State::Active, m_entity->GetState());
+        EXPECT_TRUE(activationProfiler.m_activatedTypes.empty());
+
+        activationProfiler.m_isCapturing = true;
+        m_entity->Deactivate();
+        m_entity->Activate();
+        EXPECT_EQ(5, activationProfiler.m_activatedTypes.size());
+        m_entity->Deactivate();
+    }
+
     TEST_F(ComponentDependency, IsComponentReadyToRemove_ExaminesRequiredServices)
     {
         ComponentB* componentB = m_entity->CreateComponent<ComponentB>();
@@ -2053,5 +2246,53 @@ namespace Benchmark
 
     BENCHMARK(BM_ComponentDependencySort)->Arg(6)->Arg(60);
 
+    static void BM_ComponentDependencySortCached(::benchmark::State& state)
+    {
+        // descriptors are cleaned up when ComponentApplication shuts down
+        aznew UnitTest::ComponentADescriptor;
+        aznew UnitTest::ComponentB::DescriptorType;
+        aznew UnitTest::ComponentC::DescriptorType;
+        aznew UnitTest::ComponentD::DescriptorType;
+        aznew UnitTest::ComponentE::DescriptorType;
+        aznew UnitTest::ComponentE2::DescriptorType;
+
+        ComponentApplication componentApp;
+
+        ComponentApplication::Descriptor desc;
+        desc.m_useExistingAllocator = true;
+        AZ::ComponentApplication::StartupParameters startupParameters;
+        startupParameters.m_loadSettingsRegistry = false;
+        Entity* systemEntity = componentApp.Create(desc, startupParameters);
+        systemEntity->Init();
+
+        ComponentDependencySortCache sortCache;
+        AZStd::vector<Component*> components;
+        AZ_Assert((state.range(0) % 6) == 0, "Multiple of 6 required");
+        while ((int)components.size() < state.range(0))
+        {
+            components.push_back(aznew UnitTest::ComponentA());
+            components.push_back(aznew UnitTest::ComponentB());
+            components.push_back(aznew UnitTest::ComponentC());
+            components.push_back(aznew UnitTest::ComponentD());
+            components.push_back(aznew UnitTest::ComponentE());
+            components.push_back(aznew UnitTest::ComponentE2());
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // sorting a copy of the unsorted components hits the cache after the first iteration
+            AZStd::vector<Component*> sortedComponents = components;
+            Entity::DependencySortOutcome outcome = sortCache.Sort(sortedComponents);
+            benchmark::DoNotOptimize(outcome.IsSuccess());
+        }
+
+        for (Component* component : components)
+        {
+            delete component;
+        }
+    }
+
+    BENCHMARK(BM_ComponentDependencySortCached)->Arg(6)->Arg(60);
+
 } // Benchmark
 #endif // HAVE_BENCHMARK
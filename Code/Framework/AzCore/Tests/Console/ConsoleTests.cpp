@@ -275,6 +275,34 @@ namespace AZ
         TestCVarHelper(testInit, "testInit", "testInit 1", "testInit asdf", int32_t(100), int32_t(0), int32_t(1));
     }
 
+    TEST_F(ConsoleTests, CVar_FunctorHandle_ResolvesCaseInsensitiveAndTracksUnregister)
+    {
+        AZ::IConsole* console = m_console.get();
+
+        testInt32 = 7;
+        ConsoleFunctorHandle int32Handle(*console, "TESTINT32");
+        int32_t int32Value = 0;
+        EXPECT_EQ(GetValueResult::Success, int32Handle.GetValue(int32Value));
+        EXPECT_EQ(7, int32Value);
+
+        console->PerformCommand("testInt32 9");
+        EXPECT_EQ(GetValueResult::Success, int32Handle.GetValue(int32Value));
+        EXPECT_EQ(9, int32Value);
+
+        ConsoleFunctorHandle scopedHandle(*console, "testHandleScoped");
+        int32_t scopedValue = 0;
+        EXPECT_EQ(GetValueResult::ConsoleVarNotFound, scopedHandle.GetValue(scopedValue));
+        {
+            AZ_CVAR_SCOPED(int32_t, testHandleScoped, 3, nullptr, ConsoleFunctorFlags::Null, "");
+            EXPECT_EQ(GetValueResult::Success, scopedHandle.GetValue(scopedValue));
+            EXPECT_EQ(3, scopedValue);
+        }
+        // The functor has been unregistered, so the handle has to resolve again instead of using the destroyed functor
+        EXPECT_EQ(GetValueResult::ConsoleVarNotFound, scopedHandle.GetValue(scopedValue));
+        EXPECT_EQ(GetValueResult::Success, int32Handle.GetValue(int32Value));
+        testInt32 = {};
+    }
+
     TEST_F(ConsoleTests, CVar_GetSetTest_FormatConversion)
     {
         AZ::IConsole* console = m_console.get();
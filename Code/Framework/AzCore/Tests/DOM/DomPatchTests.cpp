@@ -580,4 +580,50 @@ namespace AZ::Dom::Tests
 
         EXPECT_FALSE(info.m_forwardPatches.ContainsNormalizedEntries());
     }
+    TEST_F(DomPatchTests, ApplyAllInPlace_MatchesApplyingPatchesInOrder)
+    {
+        AZStd::vector<Patch> patches;
+        patches.push_back(Patch({ PatchOperation::ReplaceOperation(Path("/obj/foo"), Value(false)),
+                                  PatchOperation::AddOperation(Path("/obj/baz"), Value(1)),
+                                  PatchOperation::ReplaceOperation(Path("/obj/bar"), Value(true)) }));
+        // Copying makes the source and the copy share their containers, so changing the source afterwards can't change the copy.
+        patches.push_back(Patch({ PatchOperation::CopyOperation(Path("/copy"), Path("/obj")),
+                                  PatchOperation::ReplaceOperation(Path("/obj/baz"), Value(2)),
+                                  PatchOperation::RemoveOperation(Path("/arr/0")),
+                                  PatchOperation::ReplaceOperation(Path("/arr/0"), Value(42)),
+                                  PatchOperation::AddOperation(Path("/arr/-"), Value(5)) }));
+        patches.push_back(Patch({ PatchOperation::MoveOperation(Path("/arr/1"), Path("/node/0")),
+                                  PatchOperation::ReplaceOperation(Path("/node/0"), Value(7)),
+                                  PatchOperation::ReplaceOperation(Path("/arr/1"), Value(8)),
+                                  PatchOperation::TestOperation(Path("/copy/baz"), Value(1)),
+                                  PatchOperation::TestOperation(Path("/obj/baz"), Value(2)) }));
+
+        Value expected = m_dataset;
+        for (const Patch& patch : patches)
+        {
+            EXPECT_TRUE(patch.ApplyInPlace(expected).IsSuccess());
+        }
+
+        Value result = m_dataset;
+        EXPECT_TRUE(Patch::ApplyAllInPlace(result, patches).IsSuccess());
+        EXPECT_TRUE(Utils::DeepCompareIsEqual(result, expected));
+        EXPECT_EQ(result["copy"]["baz"].GetInt64(), 1);
+        EXPECT_EQ(result["obj"]["baz"].GetInt64(), 2);
+        EXPECT_EQ(result["arr"][0].GetInt64(), 42);
+        EXPECT_EQ(result["arr"][1].GetInt64(), 8);
+        EXPECT_EQ(result["node"][0].GetInt64(), 7);
+    }
+
+    TEST_F(DomPatchTests, ApplyAllInPlace_HaltsOnFailure)
+    {
+        AZStd::vector<Patch> patches;
+        patches.push_back(Patch({ PatchOperation::ReplaceOperation(Path("/obj/foo"), Value(false)) }));
+        patches.push_back(Patch({ PatchOperation::RemoveOperation(Path("/missing")) }));
+        patches.push_back(Patch({ PatchOperation::ReplaceOperation(Path("/obj/bar"), Value(true)) }));
+
+        Value result = m_dataset;
+        EXPECT_FALSE(Patch::ApplyAllInPlace(result, patches).IsSuccess());
+        EXPECT_FALSE(result["obj"]["foo"].GetBool());
+        EXPECT_FALSE(result["obj"]["bar"].GetBool());
+    }
 } // namespace AZ::Dom::Tests
@@ -115,6 +115,25 @@ namespace AZ::Dom::Tests
         PerformValueChecks();
     }
 
+    TEST_F(DomValueTests, DeepCompare_ObjectsWithDifferentMemberOrder)
+    {
+        Value lhs(Type::Object);
+        Value rhs(Type::Object);
+        for (int i = 0; i < 5; ++i)
+        {
+            lhs.AddMember(AZStd::string::format("Key%i", i), Value(i));
+            rhs.AddMember(AZStd::string::format("Key%i", 4 - i), Value(4 - i));
+        }
+        EXPECT_TRUE(Utils::DeepCompareIsEqual(lhs, rhs));
+
+        rhs["Key2"] = Value(42);
+        EXPECT_FALSE(Utils::DeepCompareIsEqual(lhs, rhs));
+
+        rhs.RemoveMember("Key2");
+        rhs.AddMember("Key5", Value(2));
+        EXPECT_FALSE(Utils::DeepCompareIsEqual(lhs, rhs));
+    }
+
     TEST_F(DomValueTests, NestedObjects)
     {
         m_value.SetObject();
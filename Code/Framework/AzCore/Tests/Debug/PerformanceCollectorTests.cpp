@@ -214,4 +214,81 @@ namespace UnitTest
         ASSERT_EQ(testFileExtention, actualExtension);
     }
 
+    TEST_F(PerformanceCollectorTest, CreatePerformanceCollector_CollectStatistics_ValidatePercentiles)
+    {
+        constexpr AZStd::string_view PerfParam1("param1");
+        const AZ::u32 frameCountPerCaptureBatch = 1000;
+
+        auto paramList = AZStd::to_array<AZStd::string_view>({ PerfParam1 });
+        AZ::Debug::PerformanceCollector performanceCollector("PerformanceCollectorTest", paramList, [](AZ::u32) {});
+        performanceCollector.UpdateFrameCountPerCaptureBatch(frameCountPerCaptureBatch);
+        performanceCollector.UpdateWaitTimeBeforeEachBatch(AZStd::chrono::seconds(0));
+        performanceCollector.UpdateNumberOfCaptureBatches(1);
+
+        // Records the values 1 to 1000, the last FrameTick completes the batch.
+        for (AZ::u32 frame = 0; frame <= frameCountPerCaptureBatch; ++frame)
+        {
+            performanceCollector.FrameTick();
+            if (frame < frameCountPerCaptureBatch)
+            {
+                performanceCollector.RecordSample(PerfParam1, AZStd::chrono::microseconds(frame + 1));
+            }
+        }
+
+        rapidjson::Document jsonDoc;
+        jsonDoc.Parse(performanceCollector.GetOutputDataBuffer().c_str());
+        ASSERT_FALSE(jsonDoc.HasParseError());
+        ASSERT_TRUE(jsonDoc.IsArray());
+        ASSERT_EQ(jsonDoc.Size(), 1);
+
+        auto argsObj = jsonDoc[0]["args"].GetObject();
+        ASSERT_TRUE(argsObj.HasMember(AZ::Debug::PerformanceCollector::P50.data()));
+        ASSERT_TRUE(argsObj.HasMember(AZ::Debug::PerformanceCollector::P99.data()));
+
+        // The histogram reports the percentiles within 6.25% of the actual values.
+        EXPECT_NEAR(argsObj[AZ::Debug::PerformanceCollector::P50.data()].GetDouble(), 500.0, 500.0 * 0.0625);
+        EXPECT_NEAR(argsObj[AZ::Debug::PerformanceCollector::P99.data()].GetDouble(), 990.0, 990.0 * 0.0625);
+    }
+
+    TEST_F(PerformanceCollectorTest, CreatePerformanceCollector_CollectHardwareCounters_ValidateStatisticalOutput)
+    {
+        constexpr AZStd::string_view PerfParam1("param1");
+        const AZ::u32 frameCountPerCaptureBatch = 10;
+
+        auto paramList = AZStd::to_array<AZStd::string_view>({ PerfParam1 });
+        AZ::Debug::PerformanceCollector performanceCollector("PerformanceCollectorTest", paramList, [](AZ::u32) {});
+        performanceCollector.UpdateFrameCountPerCaptureBatch(frameCountPerCaptureBatch);
+        performanceCollector.UpdateWaitTimeBeforeEachBatch(AZStd::chrono::seconds(0));
+        performanceCollector.UpdateHardwareCountersEnabled(true);
+        performanceCollector.UpdateNumberOfCaptureBatches(1);
+
+        // The counters are passed explicitly, so the output doesn't depend on the counters being available on this system.
+        AZ::Debug::HardwareCounterValues counters;
+        counters.m_cycles = 200;
+        counters.m_instructions = 300;
+        counters.m_cacheMisses = 4;
+        counters.m_branchMisses = 2;
+        for (AZ::u32 frame = 0; frame <= frameCountPerCaptureBatch; ++frame)
+        {
+            performanceCollector.FrameTick();
+            if (frame < frameCountPerCaptureBatch)
+            {
+                performanceCollector.RecordSample(PerfParam1, AZStd::chrono::microseconds(10), &counters);
+            }
+        }
+
+        rapidjson::Document jsonDoc;
+        jsonDoc.Parse(performanceCollector.GetOutputDataBuffer().c_str());
+        ASSERT_FALSE(jsonDoc.HasParseError());
+        ASSERT_TRUE(jsonDoc.IsArray());
+        ASSERT_EQ(jsonDoc.Size(), 1);
+
+        auto argsObj = jsonDoc[0]["args"].GetObject();
+        ASSERT_TRUE(argsObj.HasMember(AZ::Debug::PerformanceCollector::IPC.data()));
+        EXPECT_DOUBLE_EQ(argsObj[AZ::Debug::PerformanceCollector::IPC.data()].GetDouble(), 1.5);
+        EXPECT_DOUBLE_EQ(argsObj[AZ::Debug::PerformanceCollector::INSTRUCTIONS.data()].GetDouble(), 300.0);
+        EXPECT_DOUBLE_EQ(argsObj[AZ::Debug::PerformanceCollector::CACHE_MISSES.data()].GetDouble(), 4.0);
+        EXPECT_DOUBLE_EQ(argsObj[AZ::Debug::PerformanceCollector::BRANCH_MISSES.data()].GetDouble(), 2.0);
+    }
+
 }//namespace UnitTest
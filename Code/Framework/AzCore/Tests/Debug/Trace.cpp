@@ -9,6 +9,7 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Console/Console.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/TraceAsyncOutput.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/SystemFile.h>
 
@@ -243,4 +244,108 @@ namespace UnitTest
 
         traceInstance.Destroy();
     }
+
+    struct TraceAsyncOutputTests
+        : LeakDetectionFixture
+    {
+        static void RecordOutput(const char* window, const char* message)
+        {
+            s_outputMessages->push_back(AZStd::string::format("%s: %s", window, message));
+        }
+
+        void SetUp() override
+        {
+            s_outputMessages = &m_outputMessages;
+        }
+
+        void TearDown() override
+        {
+            s_outputMessages = nullptr;
+            m_outputMessages = {};
+        }
+
+        inline static AZStd::vector<AZStd::string>* s_outputMessages = nullptr;
+        AZStd::vector<AZStd::string> m_outputMessages;
+    };
+
+    TEST_F(TraceAsyncOutputTests, Push_MoreMessagesThanCapacity_WritesAllMessagesInOrder)
+    {
+        using PushResult = AZ::Debug::TraceAsyncOutput::PushResult;
+        constexpr size_t Capacity = 4;
+        constexpr int MessageCount = 100;
+
+        AZ::Debug::TraceAsyncOutput asyncOutput(&RecordOutput, Capacity);
+        EXPECT_EQ(PushResult::Rejected, asyncOutput.Push("UnitTest", "Disabled"));
+
+        asyncOutput.SetEnabled(true);
+        for (int i = 0; i < MessageCount; ++i)
+        {
+            const AZStd::string message = AZStd::string::format("%d", i);
+            if (asyncOutput.Push("UnitTest", message.c_str()) == PushResult::Rejected)
+            {
+                // The caller writes the message itself after flushing, as Trace::Output does
+                asyncOutput.Flush();
+                RecordOutput("UnitTest", message.c_str());
+            }
+        }
+        asyncOutput.SetEnabled(false);
+
+        ASSERT_EQ(MessageCount, m_outputMessages.size());
+        for (int i = 0; i < MessageCount; ++i)
+        {
+            EXPECT_EQ(AZStd::string::format("UnitTest: %d", i), m_outputMessages[i]);
+        }
+    }
+
+    TEST_F(TraceAsyncOutputTests, Push_OverRateLimit_DropsAndReportsMessages)
+    {
+        using PushResult = AZ::Debug::TraceAsyncOutput::PushResult;
+
+        AZ::Debug::TraceAsyncOutput asyncOutput(&RecordOutput);
+        asyncOutput.SetMaxMessagesPerSecond(2);
+        asyncOutput.SetEnabled(true);
+
+        // The messages are pushed well within a second, so the ones after the second are over the limit
+        int droppedCount = 0;
+        for (int i = 0; i < 5; ++i)
+        {
+            droppedCount += asyncOutput.Push("UnitTest", "Message") == PushResult::Dropped ? 1 : 0;
+        }
+        asyncOutput.SetEnabled(false);
+
+        EXPECT_EQ(3, droppedCount);
+        ASSERT_GE(m_outputMessages.size(), 3);
+        EXPECT_EQ("UnitTest: Message", m_outputMessages[0]);
+        EXPECT_EQ("UnitTest: Message", m_outputMessages[1]);
+
+        // The background thread may report the drops in more than one message while they are counted
+        int reportedDropCount = 0;
+        for (size_t i = 2; i < m_outputMessages.size(); ++i)
+        {
+            int count = 0;
+            EXPECT_EQ(1, azsscanf(m_outputMessages[i].c_str(), "TraceAsyncOutput: %d trace messages were dropped", &count));
+            reportedDropCount += count;
+        }
+        EXPECT_EQ(3, reportedDropCount);
+    }
+
+    TEST_F(TraceAsyncOutputTests, SuppressRepeatedWarning_IdenticalWarningsWithinInterval_AreCounted)
+    {
+        AZ::Debug::TraceAsyncOutput asyncOutput(&RecordOutput);
+        asyncOutput.SetWarningDedupInterval(AZStd::chrono::milliseconds(20));
+        asyncOutput.SetEnabled(true);
+
+        AZ::u32 suppressedCount = 0;
+        EXPECT_FALSE(asyncOutput.SuppressRepeatedWarning("File.cpp", 10, "Warning", suppressedCount));
+        EXPECT_TRUE(asyncOutput.SuppressRepeatedWarning("File.cpp", 10, "Warning", suppressedCount));
+        EXPECT_TRUE(asyncOutput.SuppressRepeatedWarning("File.cpp", 10, "Warning", suppressedCount));
+        EXPECT_FALSE(asyncOutput.SuppressRepeatedWarning("File.cpp", 11, "Warning", suppressedCount));
+        EXPECT_FALSE(asyncOutput.SuppressRepeatedWarning("File.cpp", 10, "Other warning", suppressedCount));
+
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(40));
+        EXPECT_FALSE(asyncOutput.SuppressRepeatedWarning("File.cpp", 10, "Warning", suppressedCount));
+        EXPECT_EQ(2, suppressedCount);
+
+        asyncOutput.SetEnabled(false);
+    }
 }
@@ -7,6 +7,8 @@
  */
 
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/EBus/EBusReadMostlyDispatchTraits.h>
+#include <AzCore/EBus/EBusSharedDispatchTraits.h>
 #include <AzCore/EBus/Results.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/chrono/chrono.h>
@@ -66,6 +68,42 @@ namespace BusImplementation
         using BusIdOrderCompare = AZStd::conditional_t<AddressPolicy != EBusAddressPolicy::ByIdAndOrdered, AZ::NullBusIdCompare, AZStd::less<int>>;
     };
 
+    // Traits for the benchmark bus using the shared dispatch mutex
+    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy>
+    class SharedDispatchTraits
+        : public Traits<addressPolicy, handlerPolicy>
+    {
+    public:
+        using MutexType = AZ::EBusSharedDispatchMutex;
+
+        template<typename MutexType, bool IsLocklessDispatch>
+        using DispatchLockGuard = AZ::EBusSharedDispatchMutexDispatchLockGuard<AZ::EBus<Interface, SharedDispatchTraits>>;
+
+        template<typename MutexType>
+        using ConnectLockGuard = AZ::EBusSharedDispatchMutexConnectLockGuard<AZ::EBus<Interface, SharedDispatchTraits>>;
+
+        template<typename MutexType>
+        using CallstackTrackerLockGuard = AZ::EBusSharedDispatchMutexCallstackLockGuard<AZ::EBus<Interface, SharedDispatchTraits>>;
+    };
+
+    // Traits for the benchmark bus using the read mostly dispatch mutex
+    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy>
+    class ReadMostlyDispatchTraits
+        : public Traits<addressPolicy, handlerPolicy>
+    {
+    public:
+        using MutexType = AZ::EBusReadMostlyDispatchMutex;
+
+        template<typename MutexType, bool IsLocklessDispatch>
+        using DispatchLockGuard = AZ::EBusReadMostlyDispatchLockGuard<AZ::EBus<Interface, ReadMostlyDispatchTraits>>;
+
+        template<typename MutexType>
+        using ConnectLockGuard = AZ::EBusReadMostlyConnectLockGuard<AZ::EBus<Interface, ReadMostlyDispatchTraits>>;
+
+        template<typename MutexType>
+        using CallstackTrackerLockGuard = AZ::EBusReadMostlyCallstackLockGuard<AZ::EBus<Interface, ReadMostlyDispatchTraits>>;
+    };
+
     template <typename Bus>
     class HandlerCommon
         : public Bus::Handler
@@ -214,6 +252,21 @@ EBUS_TEST_ALIAS(ManyOrderedToOne, ByIdAndOrdered, Single)
 EBUS_TEST_ALIAS(ManyOrderedToMany, ByIdAndOrdered, Multiple)
 EBUS_TEST_ALIAS(ManyOrderedToManyOrdered, ByIdAndOrdered, MultipleAndOrdered)
 
+// Benchmark bus instantiations with custom dispatch locking
+template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy>
+using SharedDispatchTestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::SharedDispatchTraits<addressPolicy, handlerPolicy>>;
+template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy>
+using ReadMostlyDispatchTestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::ReadMostlyDispatchTraits<addressPolicy, handlerPolicy>>;
+
+#define EBUS_DISPATCH_TEST_ALIAS(BusType, TestBusType, AddressPolicy, HandlerPolicy)                            \
+    using BusType = TestBusType<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy>;    \
+    namespace testing { namespace internal { template<> std::string GetTypeName<BusType>() { return #BusType; } } }
+
+EBUS_DISPATCH_TEST_ALIAS(OneToManySharedDispatch, SharedDispatchTestBus, Single, Multiple)
+EBUS_DISPATCH_TEST_ALIAS(ManyToManySharedDispatch, SharedDispatchTestBus, ById, Multiple)
+EBUS_DISPATCH_TEST_ALIAS(OneToManyReadMostlyDispatch, ReadMostlyDispatchTestBus, Single, Multiple)
+EBUS_DISPATCH_TEST_ALIAS(ManyToManyReadMostlyDispatch, ReadMostlyDispatchTestBus, ById, Multiple)
+
 // Handler for multi-address buses
 template <typename Bus, AZ::EBusAddressPolicy addressPolicy = Bus::Traits::AddressPolicy>
 class Handler
@@ -4469,6 +4522,17 @@ namespace Benchmark
     cb(fn, OneToManyOrdered, OneToMany)         \
     BUS_BENCHMARK_PRIVATE_LIST_ID(cb, fn)
 
+// Internal macro callback for listing the buses with custom dispatch locking that require ids
+#define BUS_BENCHMARK_PRIVATE_LIST_DISPATCH_ID(cb, fn)  \
+    cb(fn, ManyToManySharedDispatch, ManyToMany)        \
+    cb(fn, ManyToManyReadMostlyDispatch, ManyToMany)
+
+// Internal macro callback for listing all buses with custom dispatch locking
+#define BUS_BENCHMARK_PRIVATE_LIST_DISPATCH(cb, fn)     \
+    cb(fn, OneToManySharedDispatch, OneToMany)          \
+    cb(fn, OneToManyReadMostlyDispatch, OneToMany)      \
+    BUS_BENCHMARK_PRIVATE_LIST_DISPATCH_ID(cb, fn)
+
 // Internal macro callback for registering a benchmark
 #define BUS_BENCHMARK_PRIVATE_REGISTER(fn, BusDef, SettingsFn) BENCHMARK_TEMPLATE(fn, BusDef)->Apply(&BenchmarkSettings::SettingsFn);
 
@@ -4478,6 +4542,12 @@ namespace Benchmark
 // Register a benchmark for all bus permutations
 #define BUS_BENCHMARK_REGISTER_ALL(fn) BUS_BENCHMARK_PRIVATE_LIST_ALL(BUS_BENCHMARK_PRIVATE_REGISTER, fn)
 
+// Register a benchmark for all buses with custom dispatch locking requiring ids
+#define BUS_BENCHMARK_REGISTER_DISPATCH_ID(fn) BUS_BENCHMARK_PRIVATE_LIST_DISPATCH_ID(BUS_BENCHMARK_PRIVATE_REGISTER, fn)
+
+// Register a benchmark for all buses with custom dispatch locking
+#define BUS_BENCHMARK_REGISTER_DISPATCH(fn) BUS_BENCHMARK_PRIVATE_LIST_DISPATCH(BUS_BENCHMARK_PRIVATE_REGISTER, fn)
+
     //////////////////////////////////////////////////////////////////////////
     // Single Threaded Events/Broadcasts
     //////////////////////////////////////////////////////////////////////////
@@ -4514,6 +4584,7 @@ namespace Benchmark
         }
     }
     BUS_BENCHMARK_PRIVATE_LIST_ALL(BUS_BENCHMARK_PRIVATE_REGISTER_CONNECTION, BM_EBus_BusConnect);
+    BUS_BENCHMARK_PRIVATE_LIST_DISPATCH(BUS_BENCHMARK_PRIVATE_REGISTER_CONNECTION, BM_EBus_BusConnect);
 
     template <typename Bus>
     static void BM_EBus_BusDisconnect(::benchmark::State& state)
@@ -4532,6 +4603,7 @@ namespace Benchmark
         }
     }
     BUS_BENCHMARK_PRIVATE_LIST_ALL(BUS_BENCHMARK_PRIVATE_REGISTER_CONNECTION, BM_EBus_BusDisconnect);
+    BUS_BENCHMARK_PRIVATE_LIST_DISPATCH(BUS_BENCHMARK_PRIVATE_REGISTER_CONNECTION, BM_EBus_BusDisconnect);
 
 #undef BUS_BENCHMARK_PRIVATE_REGISTER_CONNECTION
 
@@ -4565,6 +4637,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ALL(BM_EBus_Broadcast);
+    BUS_BENCHMARK_REGISTER_DISPATCH(BM_EBus_Broadcast);
 
     template <typename Bus>
     static void BM_EBus_BroadcastResult(::benchmark::State& state)
@@ -4579,6 +4652,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ALL(BM_EBus_BroadcastResult);
+    BUS_BENCHMARK_REGISTER_DISPATCH(BM_EBus_BroadcastResult);
 
     template <typename Bus>
     static void BM_EBus_Event(::benchmark::State& state)
@@ -4591,6 +4665,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_Event);
+    BUS_BENCHMARK_REGISTER_DISPATCH_ID(BM_EBus_Event);
 
     template <typename Bus>
     static void BM_EBus_EventResult(::benchmark::State& state)
@@ -4605,6 +4680,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_EventResult);
+    BUS_BENCHMARK_REGISTER_DISPATCH_ID(BM_EBus_EventResult);
 
     template <typename Bus>
     static void BM_EBus_EventCached(::benchmark::State& state)
@@ -4805,6 +4881,31 @@ namespace Benchmark
         }
     }
     BENCHMARK(BM_EBus_Multithreaded_Lockless)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    template <typename Bus>
+    static void BM_EBus_Multithreaded_CustomDispatch(::benchmark::State& state)
+    {
+        AZStd::unique_ptr<BM_EBusEnvironment<Bus>> ebusBenchmarkEnv;
+        if (state.thread_index() == 0)
+        {
+            ebusBenchmarkEnv = AZStd::make_unique<BM_EBusEnvironment<Bus>>();
+            ebusBenchmarkEnv->SetUpBenchmark();
+            ebusBenchmarkEnv->Connect(state);
+        }
+
+        while (state.KeepRunning())
+        {
+            Bus::Broadcast(&Bus::Events::OnWait);
+        };
+
+        if (state.thread_index() == 0)
+        {
+            ebusBenchmarkEnv->Disconnect(state);
+            ebusBenchmarkEnv->TearDownBenchmark();
+        }
+    }
+    BENCHMARK_TEMPLATE(BM_EBus_Multithreaded_CustomDispatch, OneToManySharedDispatch)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+    BENCHMARK_TEMPLATE(BM_EBus_Multithreaded_CustomDispatch, OneToManyReadMostlyDispatch)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
 }
 
 #endif // HAVE_BENCHMARK
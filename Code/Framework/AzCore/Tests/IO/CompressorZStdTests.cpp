@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/Compression/zstd_compression.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/CompressorStream.h>
+#include <AzCore/IO/CompressorZStd.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class CompressorZStdTestFixture
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            // Compressible but not trivially repeating data.
+            m_data.resize(DataSize);
+            AZ::u32 seed = 1;
+            for (size_t i = 0; i < m_data.size(); ++i)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                m_data[i] = static_cast<AZ::u8>('a' + ((seed >> 24) % 8));
+            }
+        }
+
+        void TearDown() override
+        {
+            m_data = {};
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        static constexpr size_t DataSize = 1024 * 1024;
+        AZStd::vector<AZ::u8> m_data;
+    };
+
+    TEST_F(CompressorZStdTestFixture, CompressorStream_WriteThenRead_DataMatches)
+    {
+        AZStd::vector<AZ::u8> compressed;
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> byteStream(&compressed);
+            AZ::IO::CompressorStream stream(&byteStream, false);
+            ASSERT_TRUE(stream.WriteCompressedHeader(AZ::IO::CompressorZStd::TypeId(), 5, 256 * 1024));
+            // Seek points are only added between writes.
+            constexpr size_t chunkSize = 64 * 1024;
+            for (size_t offset = 0; offset < m_data.size(); offset += chunkSize)
+            {
+                EXPECT_EQ(chunkSize, stream.Write(chunkSize, m_data.data() + offset));
+            }
+            stream.Close();
+        }
+        EXPECT_LT(compressed.size(), m_data.size());
+
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> byteStream(&compressed);
+        AZ::IO::CompressorStream stream(&byteStream, false);
+        ASSERT_TRUE(stream.IsCompressed());
+        EXPECT_EQ(m_data.size(), stream.GetUncompressedLength());
+
+        AZStd::vector<AZ::u8> decompressed(m_data.size());
+        EXPECT_EQ(m_data.size(), stream.ReadAtOffset(decompressed.size(), decompressed.data(), 0));
+        EXPECT_EQ(m_data, decompressed);
+
+        // Reading from the middle restarts from the closest seek point.
+        constexpr size_t offset = 700 * 1024;
+        AZStd::vector<AZ::u8> part(1000);
+        EXPECT_EQ(part.size(), stream.ReadAtOffset(part.size(), part.data(), offset));
+        EXPECT_TRUE(AZStd::equal(part.begin(), part.end(), m_data.begin() + offset));
+        stream.Close();
+    }
+
+    TEST_F(CompressorZStdTestFixture, ContextPool_CompressThenDecompress_DataMatches)
+    {
+        AZ::ZStdContextPool pool;
+        AZStd::vector<AZ::u8> compressed(AZ::ZStdContextPool::GetMaxCompressedSize(m_data.size()));
+        AZStd::vector<AZ::u8> decompressed(m_data.size());
+
+        // The second round reuses the contexts of the first one.
+        for (int i = 0; i < 2; ++i)
+        {
+            size_t compressedSize = pool.Compress(m_data.data(), m_data.size(), compressed.data(), compressed.size(), 3);
+            ASSERT_GT(compressedSize, 0u);
+            EXPECT_EQ(m_data.size(), pool.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size()));
+            EXPECT_EQ(m_data, decompressed);
+        }
+    }
+
+    TEST_F(CompressorZStdTestFixture, StreamingCompress_LongDistanceMatching_DataMatches)
+    {
+        AZ::ZStd::CompressionParameters parameters;
+        parameters.m_longDistanceMatching = true;
+        parameters.m_windowLog = 20; // keeps the window buffer small, the default with long distance matching is 128 MB
+
+        AZ::ZStdContextPool pool;
+        AZ::ZStd zstd(nullptr, &pool);
+        zstd.StartCompressor(3, parameters);
+
+        AZStd::vector<AZ::u8> compressed(AZ::ZStdContextPool::GetMaxCompressedSize(m_data.size()));
+        unsigned int compressedSize = 0;
+        unsigned int dataSize = static_cast<unsigned int>(m_data.size());
+        compressedSize += zstd.Compress(m_data.data(), dataSize, compressed.data(), static_cast<unsigned int>(compressed.size()));
+        EXPECT_EQ(0u, dataSize);
+        do
+        {
+            compressedSize += zstd.Compress(nullptr, dataSize, compressed.data() + compressedSize,
+                static_cast<unsigned int>(compressed.size()) - compressedSize, AZ::ZStd::FT_FINISH);
+        } while (zstd.IsFlushPending());
+        zstd.StopCompressor();
+
+        AZStd::vector<AZ::u8> decompressed(m_data.size());
+        EXPECT_EQ(m_data.size(), pool.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size()));
+        EXPECT_EQ(m_data, decompressed);
+    }
+} // namespace UnitTest
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+
+namespace UnitTest
+{
+    class MappedFileTestFixture
+        : public LeakDetectionFixture
+    {
+    public:
+        AZ::IO::Path CreateTestFile(const char* fileName, const void* data, AZ::u64 size)
+        {
+            AZ::IO::Path path = m_tempDirectory.GetDirectoryAsPath() / fileName;
+            AZ::IO::SystemFile file;
+            EXPECT_TRUE(file.Open(path.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY));
+            file.Write(data, size);
+            return path;
+        }
+
+    protected:
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+    };
+
+    TEST_F(MappedFileTestFixture, Open_ExistingFile_MappingMatchesFileContents)
+    {
+        const char data[] = "Memory mapped file contents";
+        AZ::IO::Path path = CreateTestFile("Mapped.bin", data, sizeof(data));
+
+        AZ::IO::MappedFile mappedFile;
+        ASSERT_TRUE(mappedFile.Open(path.c_str()));
+        EXPECT_TRUE(mappedFile.IsOpen());
+        ASSERT_EQ(sizeof(data), mappedFile.GetSize());
+        EXPECT_EQ(0, memcmp(data, mappedFile.GetData(), sizeof(data)));
+
+        mappedFile.Close();
+        EXPECT_FALSE(mappedFile.IsOpen());
+        EXPECT_EQ(nullptr, mappedFile.GetData());
+        EXPECT_EQ(0, mappedFile.GetSize());
+    }
+
+    TEST_F(MappedFileTestFixture, Open_MissingOrEmptyFile_ReturnsFalse)
+    {
+        AZ::IO::MappedFile mappedFile;
+        EXPECT_FALSE(mappedFile.Open((m_tempDirectory.GetDirectoryAsPath() / "Missing.bin").c_str()));
+
+        AZ::IO::Path emptyPath = CreateTestFile("Empty.bin", nullptr, 0);
+        EXPECT_FALSE(mappedFile.Open(emptyPath.c_str()));
+        EXPECT_FALSE(mappedFile.IsOpen());
+    }
+
+    TEST_F(MappedFileTestFixture, MoveConstruct_OpenFile_MappingIsTransferred)
+    {
+        const char data[] = "Moved mapping";
+        AZ::IO::Path path = CreateTestFile("Moved.bin", data, sizeof(data));
+
+        AZ::IO::MappedFile source;
+        ASSERT_TRUE(source.Open(path.c_str()));
+        const AZ::u8* mappedData = source.GetData();
+
+        AZ::IO::MappedFile target(AZStd::move(source));
+        EXPECT_FALSE(source.IsOpen());
+        EXPECT_TRUE(target.IsOpen());
+        EXPECT_EQ(mappedData, target.GetData());
+        EXPECT_EQ(0, memcmp(data, target.GetData(), sizeof(data)));
+    }
+} // namespace UnitTest
@@ -21,8 +21,10 @@
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_list.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
@@ -68,9 +70,11 @@ namespace UnitTest
         JobManager* m_jobManager = nullptr;
         JobContext* m_jobContext = nullptr;
         unsigned int m_numWorkerThreads;
+        bool m_enableFibers;
     public:
-        DefaultJobManagerSetupFixture(unsigned int numWorkerThreads = 0)
+        DefaultJobManagerSetupFixture(unsigned int numWorkerThreads = 0, bool enableFibers = false)
             : m_numWorkerThreads(numWorkerThreads)
+            , m_enableFibers(enableFibers)
         {
         }
 
@@ -79,6 +83,7 @@ namespace UnitTest
             LeakDetectionFixture::SetUp();
 
             JobManagerDesc desc;
+            desc.m_enableFibers = m_enableFibers;
             JobManagerThreadDesc threadDesc;
 #if AZ_TRAIT_SET_JOB_PROCESSOR_ID
             threadDesc.m_cpuId = 0; // Don't set processors IDs on windows
@@ -427,6 +432,66 @@ namespace UnitTest
     }
     // FibonacciJob2Example-End
 
+    // Each job starts a single child and waits for it, without fibers every level nests on the worker's stack
+    class WaitChainJob
+        : public Job
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(WaitChainJob, ThreadPoolAllocator);
+
+        WaitChainJob(int depth, AZStd::atomic_int* completed, JobContext* context = nullptr)
+            : Job(true, context)
+            , m_depth(depth)
+            , m_completed(completed)
+        {
+        }
+        void Process() override
+        {
+            if (m_depth > 0)
+            {
+                StartAsChild(aznew WaitChainJob(m_depth - 1, m_completed, m_context));
+                WaitForChildren();
+            }
+            m_completed->fetch_add(1);
+        }
+    private:
+        int m_depth;
+        AZStd::atomic_int* m_completed;
+    };
+
+    class JobFiberTest
+        : public DefaultJobManagerSetupFixture
+    {
+    public:
+        JobFiberTest()
+            : DefaultJobManagerSetupFixture(0, true)
+        {
+        }
+    };
+
+    TEST_F(JobFiberTest, WaitForChildren_FibonacciWithFibers_CorrectResult)
+    {
+        int result = 0;
+        Job* job = aznew FibonacciJob2(g_fibonacciFast, &result, m_jobContext);
+        JobCompletion doneJob(m_jobContext);
+        job->SetDependent(&doneJob);
+        job->Start();
+        doneJob.StartAndWaitForCompletion();
+        EXPECT_EQ(g_fibonacciFastResult, result);
+    }
+
+    TEST_F(JobFiberTest, WaitForChildren_DeepWaitChain_AllJobsComplete)
+    {
+        constexpr int depth = 500;
+        AZStd::atomic_int completed{ 0 };
+        Job* job = aznew WaitChainJob(depth, &completed, m_jobContext);
+        JobCompletion doneJob(m_jobContext);
+        job->SetDependent(&doneJob);
+        job->Start();
+        doneJob.StartAndWaitForCompletion();
+        EXPECT_EQ(depth + 1, completed.load());
+    }
+
     // MergeSortJobExample-Begin
     class MergeSortJobJoin
         : public Job
@@ -1548,6 +1613,162 @@ namespace UnitTest
     {
         RunTest();
     }
+
+    class WorkQueueTestJob
+        : public Job
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(WorkQueueTestJob, ThreadPoolAllocator);
+
+        WorkQueueTestJob(AZ::s8 priority, JobContext* context)
+            : Job(false, context, false, priority)
+        {
+        }
+    protected:
+        void Process() override {}
+    };
+
+    class WorkQueueTest
+        : public DefaultJobManagerSetupFixture
+    {
+    };
+
+    TEST_F(WorkQueueTest, LocalPop_DefaultPriorityJobs_PoppedMostRecentFirst)
+    {
+        Internal::WorkQueue queue;
+        WorkQueueTestJob job1(0, m_jobContext);
+        WorkQueueTestJob job2(0, m_jobContext);
+        WorkQueueTestJob job3(0, m_jobContext);
+        queue.LocalInsert(&job1);
+        queue.LocalInsert(&job2);
+        queue.LocalInsert(&job3);
+
+        EXPECT_TRUE(queue.HasStealableJobs());
+        EXPECT_EQ(&job3, queue.LocalPop());
+        EXPECT_EQ(&job2, queue.LocalPop());
+        EXPECT_EQ(&job1, queue.LocalPop());
+        EXPECT_EQ(nullptr, queue.LocalPop());
+        EXPECT_FALSE(queue.HasStealableJobs());
+    }
+
+    TEST_F(WorkQueueTest, TrySteal_DefaultPriorityJobs_StealsOldestFirst)
+    {
+        Internal::WorkQueue queue;
+        WorkQueueTestJob job1(0, m_jobContext);
+        WorkQueueTestJob job2(0, m_jobContext);
+        queue.LocalInsert(&job1);
+        queue.LocalInsert(&job2);
+
+        EXPECT_EQ(&job1, queue.TrySteal());
+        EXPECT_EQ(&job2, queue.LocalPop());
+        EXPECT_EQ(nullptr, queue.TrySteal());
+    }
+
+    TEST_F(WorkQueueTest, LocalPop_MixedPriorities_RunsHigherPriorityFirst)
+    {
+        Internal::WorkQueue queue;
+        WorkQueueTestJob low(-1, m_jobContext);
+        WorkQueueTestJob normal(0, m_jobContext);
+        WorkQueueTestJob high(1, m_jobContext);
+        queue.LocalInsert(&low);
+        queue.LocalInsert(&normal);
+        queue.LocalInsert(&high);
+
+        EXPECT_EQ(&high, queue.LocalPop());
+        EXPECT_EQ(&normal, queue.LocalPop());
+        EXPECT_EQ(&low, queue.LocalPop());
+        EXPECT_EQ(nullptr, queue.LocalPop());
+    }
+
+    TEST_F(WorkQueueTest, LocalInsert_MoreJobsThanRingCapacity_AllJobsReturned)
+    {
+        constexpr size_t numJobs = 4096;
+        AZStd::vector<AZStd::unique_ptr<WorkQueueTestJob>> jobs;
+        Internal::WorkQueue queue;
+        for (size_t i = 0; i < numJobs; ++i)
+        {
+            jobs.emplace_back(aznew WorkQueueTestJob(0, m_jobContext));
+            queue.LocalInsert(jobs.back().get());
+        }
+
+        AZStd::unordered_set<Job*> popped;
+        while (Job* job = queue.LocalPop())
+        {
+            EXPECT_TRUE(popped.insert(job).second);
+        }
+        EXPECT_EQ(numJobs, popped.size());
+    }
+
+    TEST_F(WorkQueueTest, TrySteal_ConcurrentThieves_EachJobTakenOnce)
+    {
+        constexpr size_t numJobs = 20000;
+        constexpr size_t numThieves = 3;
+        AZStd::vector<AZStd::unique_ptr<WorkQueueTestJob>> jobs;
+        jobs.reserve(numJobs);
+        for (size_t i = 0; i < numJobs; ++i)
+        {
+            jobs.emplace_back(aznew WorkQueueTestJob(0, m_jobContext));
+        }
+
+        AZStd::unordered_map<Job*, size_t> jobIndices;
+        for (size_t i = 0; i < numJobs; ++i)
+        {
+            jobIndices[jobs[i].get()] = i;
+        }
+
+        Internal::WorkQueue queue;
+        AZStd::atomic<size_t> numTaken{ 0 };
+        AZStd::vector<AZStd::atomic<int>> takenCounts(numJobs);
+        auto markTaken = [&](Job* job)
+        {
+            takenCounts[jobIndices.at(job)].fetch_add(1);
+            numTaken.fetch_add(1);
+        };
+
+        AZStd::atomic_bool ownerDone{ false };
+        AZStd::vector<AZStd::thread> thieves;
+        for (size_t i = 0; i < numThieves; ++i)
+        {
+            thieves.emplace_back([&]()
+            {
+                while (!ownerDone.load() || queue.HasStealableJobs())
+                {
+                    if (Job* job = queue.TrySteal())
+                    {
+                        markTaken(job);
+                    }
+                }
+            });
+        }
+
+        for (size_t i = 0; i < numJobs; ++i)
+        {
+            queue.LocalInsert(jobs[i].get());
+            if ((i % 3) == 0)
+            {
+                if (Job* job = queue.LocalPop())
+                {
+                    markTaken(job);
+                }
+            }
+        }
+        while (Job* job = queue.LocalPop())
+        {
+            markTaken(job);
+        }
+        ownerDone = true;
+
+        for (AZStd::thread& thief : thieves)
+        {
+            thief.join();
+        }
+
+        EXPECT_EQ(numJobs, numTaken.load());
+        for (size_t i = 0; i < numJobs; ++i)
+        {
+            EXPECT_EQ(1, takenCounts[i].load());
+        }
+    }
 } // UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -1918,6 +2139,200 @@ namespace Benchmark
             RunMultipleCalculatePiJobsWithRandomDepthAndRandomPriority(LARGE_NUMBER_OF_JOBS);
         }
     }
+
+    //! Recursively forks two children until the depth is exhausted, the children land in the worker's local queue.
+    class TestJobForkJoin : public Job
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TestJobForkJoin, ThreadPoolAllocator);
+
+        TestJobForkJoin(AZ::u32 depth, JobContext* context)
+            : Job(true, context)
+            , m_depth(depth)
+        {
+        }
+
+        void Process() override
+        {
+            if (m_depth == 0)
+            {
+                benchmark::DoNotOptimize(CalculatePi(JobBenchmarkFixture::LIGHT_WEIGHT_JOB_CALCULATE_PI_DEPTH));
+                return;
+            }
+            StartAsChild(aznew TestJobForkJoin(m_depth - 1, m_context));
+            StartAsChild(aznew TestJobForkJoin(m_depth - 1, m_context));
+            WaitForChildren();
+        }
+    private:
+        const AZ::u32 m_depth;
+    };
+
+    BENCHMARK_DEFINE_F(JobBenchmarkFixture, ForkJoinTree)(benchmark::State& state)
+    {
+        const AZ::u32 depth = static_cast<AZ::u32>(state.range(0));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            JobCompletion doneJob(m_jobContext);
+            Job* rootJob = aznew TestJobForkJoin(depth, m_jobContext);
+            rootJob->SetDependent(&doneJob);
+            rootJob->Start();
+            doneJob.StartAndWaitForCompletion();
+        }
+        state.SetItemsProcessed(state.iterations() * ((static_cast<int64_t>(2) << depth) - 1));
+    }
+    BENCHMARK_REGISTER_F(JobBenchmarkFixture, ForkJoinTree)->Arg(10)->Arg(14);
+
+    //! The locked deque the job manager used for its worker queues before the lock-free WorkQueue, kept here as a reference.
+    class LockedJobQueue
+    {
+    public:
+        void LocalInsert(Job* job)
+        {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_lock);
+            const auto locationToInsert = AZStd::upper_bound(m_queue.begin(), m_queue.end(), job->GetPriority(),
+                [](AZ::s8 value, const Job* queuedJob) { return value > queuedJob->GetPriority(); });
+            m_queue.insert(locationToInsert, job);
+        }
+
+        Job* LocalPop()
+        {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_lock);
+            Job* result = nullptr;
+            if (!m_queue.empty())
+            {
+                result = m_queue.front();
+                m_queue.pop_front();
+            }
+            return result;
+        }
+
+        Job* TrySteal()
+        {
+            AZStd::exponential_backoff backoff;
+            for (unsigned attemptCount = 0; attemptCount < 16; ++attemptCount)
+            {
+                if (m_lock.try_lock())
+                {
+                    Job* result = nullptr;
+                    if (!m_queue.empty())
+                    {
+                        result = m_queue.front();
+                        m_queue.pop_front();
+                    }
+                    m_lock.unlock();
+                    return result;
+                }
+                backoff.wait();
+            }
+            return nullptr;
+        }
+
+    private:
+        AZStd::deque<Job*> m_queue;
+        AZStd::shared_mutex m_lock;
+    };
+
+    class WorkQueueBenchmarkJob : public Job
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(WorkQueueBenchmarkJob, ThreadPoolAllocator);
+
+        WorkQueueBenchmarkJob(JobContext* context)
+            : Job(false, context)
+        {
+        }
+    protected:
+        void Process() override {}
+    };
+
+    //! Thread 0 acts as the owning worker, pushing jobs and popping half of them back, while the other threads steal.
+    class WorkQueueBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t NumJobs = 512;
+
+        template<typename QueueType>
+        void RunBenchmark(benchmark::State& state)
+        {
+            if (state.thread_index() == 0)
+            {
+                m_jobManager = aznew JobManager(JobManagerDesc{});
+                m_jobContext = aznew JobContext(*m_jobManager);
+                m_jobs.reserve(NumJobs);
+                for (size_t i = 0; i < NumJobs; ++i)
+                {
+                    m_jobs.push_back(aznew WorkQueueBenchmarkJob(m_jobContext));
+                }
+                m_queue = aznew QueueType;
+                m_ownerRunning = true;
+            }
+
+            if (state.thread_index() == 0)
+            {
+                QueueType& queue = *static_cast<QueueType*>(m_queue);
+                for ([[maybe_unused]] auto _ : state)
+                {
+                    for (size_t i = 0; i < m_jobs.size(); ++i)
+                    {
+                        queue.LocalInsert(m_jobs[i]);
+                        if (i & 1)
+                        {
+                            benchmark::DoNotOptimize(queue.LocalPop());
+                        }
+                    }
+                    while (queue.LocalPop())
+                    {
+                    }
+                }
+                m_ownerRunning = false;
+                state.SetItemsProcessed(state.iterations() * m_jobs.size());
+            }
+            else
+            {
+                QueueType& queue = *static_cast<QueueType*>(m_queue);
+                for ([[maybe_unused]] auto _ : state)
+                {
+                    while (m_ownerRunning)
+                    {
+                        benchmark::DoNotOptimize(queue.TrySteal());
+                    }
+                }
+            }
+
+            if (state.thread_index() == 0)
+            {
+                delete static_cast<QueueType*>(m_queue);
+                m_queue = nullptr;
+                for (Job* job : m_jobs)
+                {
+                    delete job;
+                }
+                m_jobs = {};
+                delete m_jobContext;
+                delete m_jobManager;
+            }
+        }
+
+    protected:
+        JobManager* m_jobManager = nullptr;
+        JobContext* m_jobContext = nullptr;
+        AZStd::vector<Job*> m_jobs;
+        void* m_queue = nullptr;
+        AZStd::atomic_bool m_ownerRunning{ false };
+    };
+
+    BENCHMARK_DEFINE_F(WorkQueueBenchmarkFixture, LockFreeWorkQueue)(benchmark::State& state)
+    {
+        RunBenchmark<Internal::WorkQueue>(state);
+    }
+    BENCHMARK_REGISTER_F(WorkQueueBenchmarkFixture, LockFreeWorkQueue)->ThreadRange(1, 8)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(WorkQueueBenchmarkFixture, LockedWorkQueue)(benchmark::State& state)
+    {
+        RunBenchmark<LockedJobQueue>(state);
+    }
+    BENCHMARK_REGISTER_F(WorkQueueBenchmarkFixture, LockedWorkQueue)->ThreadRange(1, 8)->UseRealTime();
 } // Benchmark
 
 #endif // HAVE_BENCHMARK
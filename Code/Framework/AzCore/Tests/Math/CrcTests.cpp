@@ -116,4 +116,44 @@ namespace UnitTest
         EXPECT_EQ(AZ::Crc32(0x4727dc92), constEvalIntValue);
     }
 
+    TEST_F(Crc32Fixture, Runtime_MatchesCompileTime)
+    {
+        // Long enough to go through the 64 byte folding at runtime, with every tail length.
+        constexpr AZStd::string_view Text =
+            "The Quick Brown Fox Jumps Over The Lazy Dog, THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG. 0123456789 !?";
+        constexpr size_t TextSize = Text.size();
+        struct CrcValues
+        {
+            AZ::u32 m_caseSensitive[TextSize + 1]{};
+            AZ::u32 m_lowerCase[TextSize + 1]{};
+        };
+        constexpr CrcValues compileTimeValues = [Text]() constexpr
+        {
+            CrcValues values;
+            for (size_t size = 0; size <= Text.size(); ++size)
+            {
+                values.m_caseSensitive[size] = AZ::Crc32(Text.data(), size, false);
+                values.m_lowerCase[size] = AZ::Crc32(Text.data(), size, true);
+            }
+            return values;
+        }();
+
+        for (size_t size = 0; size <= TextSize; ++size)
+        {
+            EXPECT_EQ(compileTimeValues.m_caseSensitive[size], AZ::u32(AZ::Crc32(Text.data(), size, false))) << "size " << size;
+            EXPECT_EQ(compileTimeValues.m_lowerCase[size], AZ::u32(AZ::Crc32(Text.data(), size, true))) << "size " << size;
+        }
+    }
+
+    TEST_F(Crc32Fixture, Add_Runtime_MatchesCrcOfWholeData)
+    {
+        const AZStd::string_view text = "Some data that is added in two parts, long enough for the 64 byte folding of the CPU path.";
+        for (size_t split = 0; split <= text.size(); ++split)
+        {
+            AZ::Crc32 crc(text.data(), split, false);
+            crc.Add(text.data() + split, text.size() - split, false);
+            EXPECT_EQ(AZ::Crc32(text.data(), text.size(), false), crc) << "split " << split;
+        }
+    }
+
 }
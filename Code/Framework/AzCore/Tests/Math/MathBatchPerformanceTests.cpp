@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/MathBatch.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <random>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Compares the batch functions with the same work done with the single value math types.
+    class BM_MathBatch
+        : public benchmark::Fixture
+    {
+        void internalSetUp()
+        {
+            constexpr size_t count = 10000;
+
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif(-100.0f, 100.0f);
+            std::uniform_real_distribution<float> unifRadius(0.1f, 5.0f);
+
+            m_vectors.resize(count);
+            m_otherVectors.resize(count);
+            m_radii.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                m_vectors[i] = AZ::Vector3(unif(rng), unif(rng), unif(rng));
+                m_otherVectors[i] = AZ::Vector3(unif(rng), unif(rng), unif(rng));
+                m_radii[i] = unifRadius(rng);
+            }
+            m_vectorSoa = AZ::MathBatch::Vector3Soa(AZStd::span<const AZ::Vector3>(m_vectors.data(), m_vectors.size()));
+            m_otherVectorSoa = AZ::MathBatch::Vector3Soa(AZStd::span<const AZ::Vector3>(m_otherVectors.data(), m_otherVectors.size()));
+
+            m_transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateRotationZ(0.5f), AZ::Vector3(1.0f, 2.0f, 3.0f));
+            m_frustum = AZ::Frustum(
+                AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, AZ::Constants::HalfPi, 1.0f, 100.0f));
+        }
+
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        std::vector<AZ::Vector3> m_vectors;
+        std::vector<AZ::Vector3> m_otherVectors;
+        AZStd::vector<float> m_radii;
+        AZ::MathBatch::Vector3Soa m_vectorSoa;
+        AZ::MathBatch::Vector3Soa m_otherVectorSoa;
+        AZ::Transform m_transform;
+        AZ::Frustum m_frustum;
+    };
+
+    BENCHMARK_F(BM_MathBatch, TransformPoints_Scalar)(benchmark::State& state)
+    {
+        std::vector<AZ::Vector3> results(m_vectors.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < m_vectors.size(); ++i)
+            {
+                results[i] = m_transform.TransformPoint(m_vectors[i]);
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectors.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformPoints_Batch)(benchmark::State& state)
+    {
+        AZ::MathBatch::Vector3Soa results;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::MathBatch::TransformPoints(m_transform, m_vectorSoa, results);
+            benchmark::DoNotOptimize(results.GetX());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectors.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, Dot_Scalar)(benchmark::State& state)
+    {
+        AZStd::vector<float> results(m_vectors.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < m_vectors.size(); ++i)
+            {
+                results[i] = m_vectors[i].Dot(m_otherVectors[i]);
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectors.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, Dot_Batch)(benchmark::State& state)
+    {
+        AZStd::vector<float> results(m_vectors.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::MathBatch::Dot(m_vectorSoa, m_otherVectorSoa, results);
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectors.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, Cross_Scalar)(benchmark::State& state)
+    {
+        std::vector<AZ::Vector3> results(m_vectors.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < m_vectors.size(); ++i)
+            {
+                results[i] = m_vectors[i].Cross(m_otherVectors[i]);
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectors.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, Cross_Batch)(benchmark::State& state)
+    {
+        AZ::MathBatch::Vector3Soa results;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::MathBatch::Cross(m_vectorSoa, m_otherVectorSoa, results);
+            benchmark::DoNotOptimize(results.GetX());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectors.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, CullSpheres_Scalar)(benchmark::State& state)
+    {
+        AZStd::vector<uint32_t> visibleIndices;
+        visibleIndices.reserve(m_vectors.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            visibleIndices.clear();
+            for (size_t i = 0; i < m_vectors.size(); ++i)
+            {
+                if (m_frustum.IntersectSphere(m_vectors[i], m_radii[i]) != AZ::IntersectResult::Exterior)
+                {
+                    visibleIndices.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            benchmark::DoNotOptimize(visibleIndices.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectors.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, CullSpheres_Batch)(benchmark::State& state)
+    {
+        AZStd::vector<uint32_t> visibleIndices;
+        visibleIndices.reserve(m_vectors.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            visibleIndices.clear();
+            AZ::MathBatch::CullSpheres(m_frustum, m_vectorSoa, m_radii, visibleIndices);
+            benchmark::DoNotOptimize(visibleIndices.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectors.size());
+    }
+} // namespace Benchmark
+
+#endif
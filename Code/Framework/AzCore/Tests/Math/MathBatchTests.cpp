@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/MathBatch.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+namespace UnitTest
+{
+    namespace
+    {
+        // Six values, so the last batch is only partially used.
+        const AZ::Vector3 testVectors[] = { AZ::Vector3(1.0f, 2.0f, 3.0f),    AZ::Vector3(-4.0f, 0.5f, 2.0f),  AZ::Vector3(0.0f, 0.0f, 0.0f),
+                                            AZ::Vector3(10.0f, -20.0f, 5.0f), AZ::Vector3(0.25f, 0.75f, -1.0f), AZ::Vector3(3.0f, 4.0f, 0.0f) };
+    } // namespace
+
+    TEST(MATH_Batch, Vector3SoaStoresValues)
+    {
+        AZ::MathBatch::Vector3Soa vectors(testVectors);
+        EXPECT_EQ(vectors.GetSize(), AZStd::size(testVectors));
+        EXPECT_EQ(vectors.GetPaddedSize() % AZ::MathBatch::Vector3Soa::BatchSize, 0);
+
+        AZ::Vector3 copies[AZStd::size(testVectors)];
+        vectors.CopyTo(copies);
+        for (size_t i = 0; i < AZStd::size(testVectors); ++i)
+        {
+            EXPECT_THAT(vectors.Get(i), IsClose(testVectors[i]));
+            EXPECT_THAT(copies[i], IsClose(testVectors[i]));
+        }
+
+        vectors.Resize(2);
+        vectors.Resize(4);
+        EXPECT_THAT(vectors.Get(1), IsClose(testVectors[1]));
+        EXPECT_THAT(vectors.Get(3), IsClose(AZ::Vector3::CreateZero()));
+    }
+
+    TEST(MATH_Batch, TransformPointsMatchesTransform)
+    {
+        const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationZ(0.7f) * AZ::Quaternion::CreateRotationX(-0.3f), AZ::Vector3(5.0f, -2.0f, 1.0f));
+        const AZ::Matrix3x4 matrix = AZ::Matrix3x4::CreateFromTransform(transform);
+
+        const AZ::MathBatch::Vector3Soa vectors(testVectors);
+        AZ::MathBatch::Vector3Soa points;
+        AZ::MathBatch::TransformPoints(transform, vectors, points);
+        AZ::MathBatch::Vector3Soa rotatedVectors;
+        AZ::MathBatch::TransformVectors(matrix, vectors, rotatedVectors);
+
+        ASSERT_EQ(points.GetSize(), AZStd::size(testVectors));
+        ASSERT_EQ(rotatedVectors.GetSize(), AZStd::size(testVectors));
+        for (size_t i = 0; i < AZStd::size(testVectors); ++i)
+        {
+            EXPECT_THAT(points.Get(i), IsClose(transform.TransformPoint(testVectors[i])));
+            EXPECT_THAT(rotatedVectors.Get(i), IsClose(matrix.TransformVector(testVectors[i])));
+        }
+    }
+
+    TEST(MATH_Batch, DotCrossAndNormalizeMatchVector3)
+    {
+        const AZ::MathBatch::Vector3Soa lhs(testVectors);
+        AZ::MathBatch::Vector3Soa rhs(lhs.GetSize());
+        for (size_t i = 0; i < lhs.GetSize(); ++i)
+        {
+            rhs.Set(i, testVectors[(i + 1) % AZStd::size(testVectors)]);
+        }
+
+        float dots[AZStd::size(testVectors)];
+        AZ::MathBatch::Dot(lhs, rhs, dots);
+        AZ::MathBatch::Vector3Soa cross;
+        AZ::MathBatch::Cross(lhs, rhs, cross);
+        AZ::MathBatch::Vector3Soa normalized = lhs;
+        AZ::MathBatch::NormalizeSafe(normalized);
+
+        for (size_t i = 0; i < lhs.GetSize(); ++i)
+        {
+            EXPECT_NEAR(dots[i], lhs.Get(i).Dot(rhs.Get(i)), 1e-4f);
+            EXPECT_THAT(cross.Get(i), IsClose(lhs.Get(i).Cross(rhs.Get(i))));
+            EXPECT_THAT(normalized.Get(i), IsClose(testVectors[i].GetNormalizedSafe()));
+        }
+    }
+
+    TEST(MATH_Batch, CullingMatchesFrustumIntersection)
+    {
+        const AZ::Frustum frustum(
+            AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, AZ::Constants::HalfPi, 1.0f, 100.0f));
+
+        const AZ::Vector3 centers[] = { AZ::Vector3(0.0f, 10.0f, 0.0f), AZ::Vector3(0.0f, -10.0f, 0.0f), AZ::Vector3(12.0f, 10.0f, 0.0f),
+                                        AZ::Vector3(0.0f, 101.0f, 0.0f), AZ::Vector3(0.0f, 50.0f, 49.0f) };
+        const float radii[] = { 1.0f, 5.0f, 3.0f, 2.0f, 0.5f };
+
+        const AZ::MathBatch::Vector3Soa centerSoa(centers);
+        AZ::MathBatch::Vector3Soa minimums(AZStd::size(centers));
+        AZ::MathBatch::Vector3Soa maximums(AZStd::size(centers));
+        AZStd::vector<uint32_t> expectedSphereIndices;
+        AZStd::vector<uint32_t> expectedAabbIndices;
+        for (size_t i = 0; i < AZStd::size(centers); ++i)
+        {
+            minimums.Set(i, centers[i] - AZ::Vector3(radii[i]));
+            maximums.Set(i, centers[i] + AZ::Vector3(radii[i]));
+            if (frustum.IntersectSphere(centers[i], radii[i]) != AZ::IntersectResult::Exterior)
+            {
+                expectedSphereIndices.push_back(static_cast<uint32_t>(i));
+            }
+            if (frustum.IntersectAabb(minimums.Get(i), maximums.Get(i)) != AZ::IntersectResult::Exterior)
+            {
+                expectedAabbIndices.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        AZStd::vector<uint32_t> visibleIndices;
+        AZ::MathBatch::CullSpheres(frustum, centerSoa, radii, visibleIndices);
+        EXPECT_EQ(visibleIndices, expectedSphereIndices);
+
+        visibleIndices.clear();
+        AZ::MathBatch::CullAabbs(frustum, minimums, maximums, visibleIndices);
+        EXPECT_EQ(visibleIndices, expectedAabbIndices);
+    }
+} // namespace UnitTest
@@ -3084,4 +3084,96 @@ namespace UnitTest
     {
         TestZeroVectorInt<Simd::Vec4>();
     }
+
+    TEST(MATH_SimdMath, TestLoadStoreVec8)
+    {
+        const float testFloats[8] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+        const int32_t testInts[8] = { -1, 2, -3, 4, -5, 6, -7, 8 };
+        float floatResults[8] = {};
+        int32_t intResults[8] = {};
+
+        Simd::Vec8::StoreUnaligned(floatResults, Simd::Vec8::LoadUnaligned(testFloats));
+        Simd::Vec8::StoreUnaligned(intResults, Simd::Vec8::LoadUnaligned(testInts));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(floatResults[i], testFloats[i]);
+            EXPECT_EQ(intResults[i], testInts[i]);
+        }
+
+        const Simd::Vec8::FloatType vec8 = Simd::Vec8::LoadUnaligned(testFloats);
+        EXPECT_EQ(Simd::Vec4::SelectFirst(Simd::Vec8::GetLow(vec8)), 1.0f);
+        EXPECT_EQ(Simd::Vec4::SelectFourth(Simd::Vec8::GetHigh(vec8)), 8.0f);
+
+        Simd::Vec8::StoreUnaligned(floatResults, Simd::Vec8::FromVec4(Simd::Vec8::GetHigh(vec8), Simd::Vec8::GetLow(vec8)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(floatResults[i], testFloats[(i + 4) % 8]);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestArithmeticVec8)
+    {
+        const float testValues1[8] = { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f, 7.0f, -8.0f };
+        const float testValues2[8] = { 2.0f, 2.0f, 2.0f, 2.0f, -4.0f, -4.0f, -4.0f, -4.0f };
+        const Simd::Vec8::FloatType vec1 = Simd::Vec8::LoadUnaligned(testValues1);
+        const Simd::Vec8::FloatType vec2 = Simd::Vec8::LoadUnaligned(testValues2);
+
+        float sums[8];
+        float products[8];
+        float madds[8];
+        float quotients[8];
+        float absolutes[8];
+        Simd::Vec8::StoreUnaligned(sums, Simd::Vec8::Add(vec1, vec2));
+        Simd::Vec8::StoreUnaligned(products, Simd::Vec8::Mul(vec1, vec2));
+        Simd::Vec8::StoreUnaligned(madds, Simd::Vec8::Madd(vec1, vec2, Simd::Vec8::Splat(1.0f)));
+        Simd::Vec8::StoreUnaligned(quotients, Simd::Vec8::Div(vec1, vec2));
+        Simd::Vec8::StoreUnaligned(absolutes, Simd::Vec8::Abs(vec1));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_NEAR(sums[i], testValues1[i] + testValues2[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(products[i], testValues1[i] * testValues2[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(madds[i], testValues1[i] * testValues2[i] + 1.0f, AZ::Constants::Tolerance);
+            EXPECT_NEAR(quotients[i], testValues1[i] / testValues2[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(absolutes[i], fabsf(testValues1[i]), AZ::Constants::Tolerance);
+        }
+
+        const int32_t testInts[8] = { 1, -2, 3, -4, 5, -6, 7, -8 };
+        int32_t intProducts[8];
+        Simd::Vec8::StoreUnaligned(intProducts, Simd::Vec8::Mul(Simd::Vec8::LoadUnaligned(testInts), Simd::Vec8::Splat(3)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(intProducts[i], testInts[i] * 3);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestCompareSelectVec8)
+    {
+        const float testValues1[8] = { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f, 7.0f, -8.0f };
+        const float testValues2[8] = { 2.0f, -2.0f, 2.0f, 2.0f, -4.0f, -4.0f, 7.0f, -9.0f };
+        const Simd::Vec8::FloatType vec1 = Simd::Vec8::LoadUnaligned(testValues1);
+        const Simd::Vec8::FloatType vec2 = Simd::Vec8::LoadUnaligned(testValues2);
+
+        const Simd::Vec8::FloatType greater = Simd::Vec8::CmpGt(vec1, vec2);
+        int32_t expectedMask = 0;
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            expectedMask |= (testValues1[i] > testValues2[i]) ? (1 << i) : 0;
+        }
+        EXPECT_EQ(Simd::Vec8::GetMask(greater), expectedMask);
+        EXPECT_EQ(Simd::Vec8::GetMask(Simd::Vec8::CmpLtEq(vec1, vec2)), ~expectedMask & 0xFF);
+
+        float maximums[8];
+        Simd::Vec8::StoreUnaligned(maximums, Simd::Vec8::Select(vec1, vec2, greater));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(maximums[i], AZStd::max(testValues1[i], testValues2[i]));
+        }
+
+        int32_t truncated[8];
+        Simd::Vec8::StoreUnaligned(truncated, Simd::Vec8::ConvertToInt(Simd::Vec8::Mul(vec1, Simd::Vec8::Splat(1.5f))));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(truncated[i], static_cast<int32_t>(testValues1[i] * 1.5f));
+        }
+    }
 }
@@ -12,6 +12,7 @@
 
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Debug/StackTracer.h>
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <AzCore/std/parallel/thread.h>
@@ -439,6 +440,157 @@ namespace UnitTest
         EXPECT_EQ(result, nullptr);
     }
 
+    /**
+     * Tests the RECORD_SAMPLED mode of AllocationRecords
+     */
+    class AllocationRecordsSamplingTest
+        : public MemoryTrackingFixture
+    {
+    public:
+        void SetUp() override
+        {
+            MemoryTrackingFixture::SetUp();
+            m_previousSamplingInterval = AZ::AllocatorManager::Instance().GetAllocationSamplingInterval();
+            AZ::AllocatorManager::Instance().SetAllocationSamplingInterval(s_samplingInterval);
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorManager::Instance().SetAllocationSamplingInterval(m_previousSamplingInterval);
+            MemoryTrackingFixture::TearDown();
+        }
+
+    protected:
+        static constexpr size_t s_samplingInterval = 4 * 1024;
+        size_t m_previousSamplingInterval = 0;
+    };
+
+    TEST_F(AllocationRecordsSamplingTest, SampledMode_SampleWeights_EstimateLiveBytes)
+    {
+        AllocationRecords records(16, false, false, "SamplingTestRecords");
+        records.SetMode(AllocationRecords::RECORD_SAMPLED);
+
+        // The records never touch the memory, so addresses can be synthesized
+        constexpr size_t allocationSize = 256;
+        constexpr size_t allocationCount = 20000;
+        const uintptr_t baseAddress = 0x10000000;
+        for (size_t i = 0; i < allocationCount; ++i)
+        {
+            records.RegisterAllocation(reinterpret_cast<void*>(baseAddress + i * allocationSize), allocationSize, 16, 0);
+        }
+
+        // Around one sample every s_samplingInterval bytes, with a relative error of about 1 / sqrt(sample count)
+        const size_t liveBytes = allocationSize * allocationCount;
+        EXPECT_GT(records.RequestedBytes(), liveBytes * 8 / 10);
+        EXPECT_LT(records.RequestedBytes(), liveBytes * 12 / 10);
+        EXPECT_EQ(0, records.DroppedSamples());
+        EXPECT_TRUE(records.GetMap().empty());
+
+        size_t sampleCount = 0;
+        size_t weightSum = 0;
+        records.EnumerateAllocations(
+            [&](void* address, const AllocationInfo& info, unsigned char numStackLevels)
+            {
+                const uintptr_t offset = reinterpret_cast<uintptr_t>(address) - baseAddress;
+                EXPECT_EQ(0, offset % allocationSize);
+                EXPECT_EQ(allocationSize, info.m_byteSize);
+                EXPECT_GE(info.m_sampleWeight, allocationSize);
+                EXPECT_NE(nullptr, info.m_stackFrames);
+                EXPECT_EQ(16, numStackLevels);
+                ++sampleCount;
+                weightSum += info.m_sampleWeight;
+                return true;
+            });
+        EXPECT_GT(sampleCount, 0);
+        EXPECT_EQ(records.RequestedBytes(), weightSum);
+
+        for (size_t i = 0; i < allocationCount; ++i)
+        {
+            records.UnregisterAllocation(reinterpret_cast<void*>(baseAddress + i * allocationSize), allocationSize, 16, nullptr);
+        }
+        EXPECT_EQ(0, records.RequestedBytes());
+
+        sampleCount = 0;
+        records.EnumerateAllocations(
+            [&sampleCount](void*, const AllocationInfo&, unsigned char)
+            {
+                ++sampleCount;
+                return true;
+            });
+        EXPECT_EQ(0, sampleCount);
+    }
+
+    TEST_F(AllocationRecordsSamplingTest, SampledMode_ManyThreads_SamplesAreFreedOnAnyThread)
+    {
+        AllocationRecords records(8, false, false, "SamplingTestRecords");
+        records.SetMode(AllocationRecords::RECORD_SAMPLED);
+
+        constexpr size_t threadCount = 8;
+        constexpr size_t allocationSize = 128;
+        constexpr size_t allocationsPerThread = 10000;
+        const uintptr_t baseAddress = 0x10000000;
+
+        // Each thread registers its own range and unregisters the range of its neighbour
+        AZStd::atomic<size_t> registeredThreads{ 0 };
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&, threadIndex]()
+                {
+                    const uintptr_t ownRange = baseAddress + threadIndex * allocationsPerThread * allocationSize;
+                    for (size_t i = 0; i < allocationsPerThread; ++i)
+                    {
+                        records.RegisterAllocation(reinterpret_cast<void*>(ownRange + i * allocationSize), allocationSize, 8, 0);
+                    }
+                    ++registeredThreads;
+                    while (registeredThreads < threadCount)
+                    {
+                        AZStd::this_thread::yield();
+                    }
+
+                    const uintptr_t neighbourRange = baseAddress + ((threadIndex + 1) % threadCount) * allocationsPerThread * allocationSize;
+                    for (size_t i = 0; i < allocationsPerThread; ++i)
+                    {
+                        records.UnregisterAllocation(reinterpret_cast<void*>(neighbourRange + i * allocationSize), allocationSize, 8, nullptr);
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, records.RequestedBytes());
+        EXPECT_GT(records.RequestedBytesPeak(), 0);
+    }
+
+    TEST_F(AllocationRecordsSamplingTest, WriteAllocationSamples_SampledAllocators_WritesJson)
+    {
+        AZ::AllocatorManager::Instance().SetTrackingMode(AllocationRecords::RECORD_SAMPLED);
+
+        AZStd::vector<void*> allocations;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            allocations.push_back(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(512, 8));
+        }
+
+        AZStd::vector<char> output;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&output);
+        EXPECT_TRUE(AZ::AllocatorManager::Instance().WriteAllocationSamples(stream));
+
+        for (void* allocation : allocations)
+        {
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(allocation);
+        }
+        AZ::AllocatorManager::Instance().SetTrackingMode(AllocationRecords::RECORD_FULL);
+
+        const AZStd::string_view json(output.data(), output.size());
+        EXPECT_TRUE(json.starts_with(R"({"Type":"AllocationSamples","Version":1,)"));
+        EXPECT_NE(AZStd::string_view::npos, json.find(R"("Name":"SystemAllocator")"));
+        EXPECT_NE(AZStd::string_view::npos, json.find(R"("Size":512,)"));
+    }
+
     /**
      * Tests ThreadPoolAllocator
      */
@@ -726,6 +878,84 @@ namespace UnitTest
         run();
     }
 
+    class RemoteFreeThreadPoolAllocator
+        : public ThreadPoolBase<RemoteFreeThreadPoolAllocator>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(RemoteFreeThreadPoolAllocator, SystemAllocator);
+        AZ_TYPE_INFO(RemoteFreeThreadPoolAllocator, "{5A0C2E7B-93D4-4F61-8B2A-6E1F0C3D9A47}");
+
+        using Base = ThreadPoolBase<RemoteFreeThreadPoolAllocator>;
+    };
+
+    TEST_F(ThreadPoolAllocatorTest, ProducerConsumer_ElementsFreedOnOtherThread_ReturnToOwningThread)
+    {
+        IAllocator& poolAllocator = AllocatorInstance<RemoteFreeThreadPoolAllocator>::Get();
+        constexpr size_t numRounds = 16;
+        constexpr size_t numAllocationsPerRound = 2048;
+        constexpr size_t allocationSize = 64;
+
+        AZStd::vector<void*> allocations;
+        allocations.reserve(numAllocationsPerRound);
+        for (size_t round = 0; round < numRounds; ++round)
+        {
+            for (size_t i = 0; i < numAllocationsPerRound; ++i)
+            {
+                allocations.push_back(poolAllocator.Allocate(allocationSize, 8));
+                ASSERT_NE(nullptr, allocations.back());
+            }
+            // Everything allocated this round was reclaimed from the previous round's remote frees
+            EXPECT_EQ(numAllocationsPerRound * allocationSize, poolAllocator.NumAllocatedBytes());
+
+            AZStd::thread consumer(
+                [&poolAllocator, &allocations]()
+                {
+                    for (void* address : allocations)
+                    {
+                        poolAllocator.DeAllocate(address);
+                    }
+                });
+            consumer.join();
+            allocations.clear();
+        }
+
+        void* address = poolAllocator.Allocate(allocationSize, 8);
+        EXPECT_EQ(allocationSize, poolAllocator.NumAllocatedBytes());
+        poolAllocator.DeAllocate(address);
+        EXPECT_EQ(0, poolAllocator.NumAllocatedBytes());
+        poolAllocator.GarbageCollect();
+    }
+
+    TEST_F(ThreadPoolAllocatorTest, DeAllocate_ManyElementsFreedOnOtherThread_ReclaimedWithoutAllocating)
+    {
+        IAllocator& poolAllocator = AllocatorInstance<RemoteFreeThreadPoolAllocator>::Get();
+        constexpr size_t numRemoteFrees = 256;
+        constexpr size_t allocationSize = 32;
+
+        AZStd::vector<void*> remoteFreed;
+        for (size_t i = 0; i < numRemoteFrees; ++i)
+        {
+            remoteFreed.push_back(poolAllocator.Allocate(allocationSize, 8));
+        }
+        void* localFreed = poolAllocator.Allocate(allocationSize, 8);
+        EXPECT_EQ((numRemoteFrees + 1) * allocationSize, poolAllocator.NumAllocatedBytes());
+
+        AZStd::thread consumer(
+            [&poolAllocator, &remoteFreed]()
+            {
+                for (void* address : remoteFreed)
+                {
+                    poolAllocator.DeAllocate(address);
+                }
+            });
+        consumer.join();
+
+        // A thread which only frees from now on still takes its elements back once enough are waiting
+        poolAllocator.DeAllocate(localFreed);
+        EXPECT_EQ(0, poolAllocator.NumAllocatedBytes());
+        poolAllocator.GarbageCollect();
+    }
+
     /**
      * Tests azmalloc,azmallocex/azfree.
      */
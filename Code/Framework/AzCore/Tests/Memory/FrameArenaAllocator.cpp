@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class FrameArenaAllocatorTest
+        : public LeakDetectionFixture
+    {
+    protected:
+        static AZ::FrameArenaAllocator::Descriptor SmallDescriptor(unsigned int frameCount)
+        {
+            AZ::FrameArenaAllocator::Descriptor desc;
+            desc.m_frameBufferSize = 256 * 1024;
+            desc.m_frameCount = frameCount;
+            desc.m_threadBlockSize = 4 * 1024;
+            return desc;
+        }
+    };
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_WithinFrame_ReturnsDistinctAlignedMemory)
+    {
+        AZ::FrameArenaAllocator allocator(SmallDescriptor(2));
+
+        AZStd::vector<char*> allocations;
+        for (size_t i = 0; i < 256; ++i)
+        {
+            const size_t alignment = size_t{ 1 } << (i % 7);
+            char* ptr = static_cast<char*>(allocator.allocate(24, alignment));
+            ASSERT_NE(nullptr, ptr);
+            EXPECT_EQ(0, reinterpret_cast<size_t>(ptr) % alignment);
+            memset(ptr, static_cast<int>(i), 24);
+            allocations.push_back(ptr);
+        }
+
+        for (size_t i = 0; i < allocations.size(); ++i)
+        {
+            for (size_t byte = 0; byte < 24; ++byte)
+            {
+                ASSERT_EQ(static_cast<char>(i), allocations[i][byte]);
+            }
+        }
+        EXPECT_GE(allocator.NumAllocatedBytes(), 256 * 24);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, AdvanceFrame_KeepsPreviousFramesUntilBufferWrapsAround)
+    {
+        constexpr unsigned int frameCount = 3;
+        AZ::FrameArenaAllocator allocator(SmallDescriptor(frameCount));
+
+        void* firstFrameAllocation = allocator.allocate(64, 8);
+        ASSERT_NE(nullptr, firstFrameAllocation);
+        memset(firstFrameAllocation, 0xab, 64);
+
+        for (unsigned int frame = 1; frame < frameCount; ++frame)
+        {
+            allocator.AdvanceFrame();
+            void* ptr = allocator.allocate(64, 8);
+            EXPECT_NE(firstFrameAllocation, ptr);
+            memset(ptr, 0, 64);
+        }
+        // The first frame's memory is still intact while the other buffers are in use
+        EXPECT_EQ(static_cast<unsigned char>(0xab), static_cast<unsigned char*>(firstFrameAllocation)[63]);
+
+        // Once the frame index wraps around the first buffer is reset and reused from its start
+        allocator.AdvanceFrame();
+        EXPECT_EQ(frameCount, allocator.GetFrameIndex());
+        EXPECT_EQ(firstFrameAllocation, allocator.allocate(64, 8));
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_FrameBufferExhausted_SpillsAndReleasesWithFrame)
+    {
+        AZ::FrameArenaAllocator allocator(SmallDescriptor(2));
+        const size_t frameBufferSize = allocator.GetSchema()->GetDescriptor().m_frameBufferSize;
+
+        for (size_t i = 0; i < 8; ++i)
+        {
+            void* ptr = allocator.allocate(frameBufferSize / 2, 16);
+            ASSERT_NE(nullptr, ptr);
+            memset(ptr, 0, frameBufferSize / 2);
+        }
+        EXPECT_GE(allocator.NumAllocatedBytes(), 4 * frameBufferSize);
+
+        allocator.AdvanceFrame();
+        allocator.AdvanceFrame();
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+        EXPECT_GE(allocator.GetHighWaterMark(), 4 * frameBufferSize);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_ManyThreads_AllocationsDoNotOverlap)
+    {
+        AZ::FrameArenaAllocator allocator(SmallDescriptor(2));
+
+        constexpr size_t threadCount = 8;
+        constexpr size_t allocationsPerThread = 2000;
+        AZStd::vector<AZStd::vector<unsigned char*>> threadAllocations(threadCount);
+
+        for (size_t frame = 0; frame < 4; ++frame)
+        {
+            AZStd::vector<AZStd::thread> threads;
+            for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                threads.emplace_back(
+                    [&allocator, &threadAllocations, threadIndex]()
+                    {
+                        AZStd::vector<unsigned char*>& allocations = threadAllocations[threadIndex];
+                        allocations.clear();
+                        for (size_t i = 0; i < allocationsPerThread; ++i)
+                        {
+                            unsigned char* ptr = static_cast<unsigned char*>(allocator.allocate(32, 8));
+                            memset(ptr, static_cast<int>(threadIndex), 32);
+                            allocations.push_back(ptr);
+                        }
+                    });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                for (unsigned char* ptr : threadAllocations[threadIndex])
+                {
+                    ASSERT_EQ(threadIndex, ptr[0]);
+                    ASSERT_EQ(threadIndex, ptr[31]);
+                }
+            }
+            allocator.AdvanceFrame();
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTest, AZStdContainer_UsesGlobalFrameArena)
+    {
+        AZ::IAllocator& frameArena = AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get();
+        const size_t allocatedBefore = frameArena.NumAllocatedBytes();
+        {
+            AZStd::vector<int, AZ::AZStdAlloc<AZ::FrameArenaAllocator>> values;
+            for (int i = 0; i < 1000; ++i)
+            {
+                values.push_back(i);
+            }
+            EXPECT_EQ(999, values.back());
+        }
+        EXPECT_GE(frameArena.NumAllocatedBytes(), allocatedBefore + 1000 * sizeof(int));
+    }
+
+    TEST_F(FrameArenaAllocatorTest, HighWaterMark_ReportedInAllocatorManagerStats)
+    {
+        AZ::FrameArenaAllocator allocator(SmallDescriptor(2));
+        allocator.allocate(16 * 1024, 16);
+        allocator.AdvanceFrame();
+        allocator.allocate(1024, 16);
+
+        size_t allocatedBytes = 0;
+        size_t capacityBytes = 0;
+        AZStd::vector<AZ::AllocatorManager::AllocatorStats> stats;
+        AZ::AllocatorManager::Instance().GetAllocatorStats(allocatedBytes, capacityBytes, &stats);
+
+        // Other frame arenas may be registered under the same name, look for one reporting this allocator's peak
+        auto statsIt = AZStd::find_if(stats.begin(), stats.end(),
+            [&allocator](const AZ::AllocatorManager::AllocatorStats& allocatorStats)
+            {
+                return allocatorStats.m_name == allocator.GetName() && allocatorStats.m_highWaterMarkBytes >= 16 * 1024;
+            });
+        EXPECT_NE(stats.end(), statsIt);
+    }
+} // namespace UnitTest
@@ -9,6 +9,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -106,4 +107,64 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class HphaSchemaThreadCacheTest
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(HphaSchemaThreadCacheTest, SmallAllocations_ManyThreads_ServedFromThreadCaches)
+    {
+        AZ::HphaSchema schema;
+        const size_t allocatedBefore = schema.NumAllocatedBytes();
+
+        constexpr size_t numThreads = 4;
+        constexpr size_t numAllocations = 1000;
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([&schema, threadIndex]()
+            {
+                AZStd::vector<void*, AZ::OSStdAllocator> allocations;
+                for (size_t round = 0; round < 10; ++round)
+                {
+                    for (size_t i = 0; i < numAllocations; ++i)
+                    {
+                        allocations.push_back(schema.allocate(s_smallAllocationSizes[(i + threadIndex) % s_smallAllocationSizes.size()], 8));
+                    }
+                    for (void* allocation : allocations)
+                    {
+                        schema.deallocate(allocation);
+                    }
+                    allocations.clear();
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // blocks cached by the threads were returned when the threads exited
+        EXPECT_EQ(allocatedBefore, schema.NumAllocatedBytes());
+
+        const AZ::AllocatorThreadCacheStats stats = schema.GetThreadCacheStats();
+        EXPECT_GT(stats.m_hits, stats.m_misses);
+        EXPECT_EQ(numThreads * numAllocations * 10 * 2, stats.m_hits + stats.m_misses);
+    }
+
+    TEST_F(HphaSchemaThreadCacheTest, CachedBlocks_NotReportedAsAllocated)
+    {
+        AZ::HphaSchema schema;
+        const size_t allocatedBefore = schema.NumAllocatedBytes();
+
+        void* allocation = schema.allocate(64, 8);
+        EXPECT_EQ(allocatedBefore + 64, schema.NumAllocatedBytes());
+        schema.deallocate(allocation, 64);
+        EXPECT_EQ(allocatedBefore, schema.NumAllocatedBytes());
+
+        // garbage collection flushes this thread's cache, so the pages can be released
+        schema.GarbageCollect();
+        EXPECT_EQ(allocatedBefore, schema.NumAllocatedBytes());
+    }
 }
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/HphaAllocator.h>
+#include <AzCore/Memory/OSMemory.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace UnitTest
+{
+    class OSMemoryTestFixture
+        : public LeakDetectionFixture
+    {
+    public:
+        void TearDown() override
+        {
+            AZ::OSMemory::SetLargePageMode(AZ::OSMemory::LargePageMode::Disabled);
+            LeakDetectionFixture::TearDown();
+        }
+    };
+
+    class OSMemoryLargePageModeTest
+        : public OSMemoryTestFixture
+        , public ::testing::WithParamInterface<AZ::OSMemory::LargePageMode>
+    {
+    };
+
+    TEST_P(OSMemoryLargePageModeTest, AllocatePages_WriteAndFree_Succeeds)
+    {
+        const AZ::OSMemory::LargePageMode mode = GetParam();
+        const size_t largePageSize = AZ::OSMemory::GetLargePageSize();
+        if (mode != AZ::OSMemory::LargePageMode::Disabled && largePageSize == 0)
+        {
+            GTEST_SKIP() << "Large pages are not supported on this platform";
+        }
+
+        const size_t byteSize = largePageSize ? 2 * largePageSize : 64 * 1024;
+        char* memory = static_cast<char*>(AZ::OSMemory::AllocatePages(byteSize, mode));
+        if (!memory)
+        {
+            // Regular pages must always be available where the platform implements the mapping at all
+            EXPECT_EQ(0, largePageSize);
+            return;
+        }
+
+        EXPECT_EQ(0, memory[0]);
+        EXPECT_EQ(0, memory[byteSize - 1]);
+        memset(memory, 0xab, byteSize);
+        EXPECT_EQ(static_cast<char>(0xab), memory[byteSize / 2]);
+
+        AZ::OSMemory::FreePages(memory, byteSize);
+    }
+
+    INSTANTIATE_TEST_CASE_P(
+        OSMemory,
+        OSMemoryLargePageModeTest,
+        ::testing::Values(
+            AZ::OSMemory::LargePageMode::Disabled, AZ::OSMemory::LargePageMode::Transparent, AZ::OSMemory::LargePageMode::Explicit));
+
+    TEST_F(OSMemoryTestFixture, NumaNodes_CurrentNodeInRange)
+    {
+        const unsigned int numaNodeCount = AZ::OSMemory::GetNumaNodeCount();
+        EXPECT_GE(numaNodeCount, 1u);
+
+        const int currentNode = AZ::OSMemory::GetCurrentNumaNode();
+        if (currentNode != AZ::OSMemory::AnyNumaNode)
+        {
+            EXPECT_GE(currentNode, 0);
+            EXPECT_LT(static_cast<unsigned int>(currentNode), numaNodeCount);
+        }
+
+        EXPECT_FALSE(AZ::OSMemory::SetCurrentThreadNumaNode(static_cast<int>(numaNodeCount)));
+    }
+
+    TEST_F(OSMemoryTestFixture, HphaSchema_LargePageMode_AllocationsAreReturned)
+    {
+        AZ::OSMemory::SetLargePageMode(AZ::OSMemory::LargePageMode::Transparent);
+
+        AZ::HphaSchema schema;
+        AZStd::vector<AZStd::pair<void*, size_t>> allocations;
+        // Small bucket sizes, tree sizes and sizes above the tree limit, which map their own memory
+        const size_t sizes[] = { 16, 100, 512, 4 * 1024, 100 * 1024, 4 * 1024 * 1024 };
+        for (int i = 0; i < 64; ++i)
+        {
+            for (size_t size : sizes)
+            {
+                void* address = schema.allocate(size, 16);
+                ASSERT_NE(nullptr, address);
+                memset(address, i, size);
+                allocations.emplace_back(address, size);
+            }
+        }
+
+        // Allocations made before the mode change must still be freed correctly
+        AZ::OSMemory::SetLargePageMode(AZ::OSMemory::LargePageMode::Disabled);
+        void* regularAddress = schema.allocate(256, 16);
+        ASSERT_NE(nullptr, regularAddress);
+        allocations.emplace_back(regularAddress, 256);
+
+        for (const auto& [address, size] : allocations)
+        {
+            schema.deallocate(address, size, 16);
+        }
+        EXPECT_EQ(0, schema.NumAllocatedBytes());
+
+        schema.GarbageCollect();
+        EXPECT_EQ(0, schema.NumAllocatedBytes());
+    }
+} // namespace UnitTest
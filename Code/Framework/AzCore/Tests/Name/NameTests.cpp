@@ -439,6 +439,42 @@ namespace UnitTest
         }
     }
 
+    TEST_F(NameTest, NameConstructFromHash_NamesReleasedAndReusedWhileIndexGrows_OnlyNamesInUseAreFound)
+    {
+        // Create enough names to grow the index of the dictionary a few times.
+        constexpr size_t nameCount = 5000;
+        AZStd::vector<AZ::Name> names;
+        names.reserve(nameCount);
+        for (size_t i = 0; i < nameCount; ++i)
+        {
+            names.emplace_back(AZStd::string::format("name %zu", i));
+        }
+
+        // Release every other name so its data gets reused by the names created afterwards.
+        AZStd::vector<AZStd::pair<AZ::Name::Hash, AZStd::string>> releasedNames;
+        for (size_t i = 0; i < nameCount; i += 2)
+        {
+            releasedNames.emplace_back(names[i].GetHash(), names[i].GetStringView());
+            names[i] = AZ::Name();
+        }
+        for (size_t i = 0; i < nameCount; i += 2)
+        {
+            names[i] = AZ::Name(AZStd::string::format("other name %zu", i));
+        }
+
+        for (const AZ::Name& name : names)
+        {
+            AZ::Name nameFromHash(name.GetHash());
+            EXPECT_EQ(name.GetStringView(), nameFromHash.GetStringView());
+            EXPECT_EQ(name, nameFromHash);
+        }
+        for (const auto& [hash, nameString] : releasedNames)
+        {
+            AZ::Name nameFromHash(hash);
+            EXPECT_NE(nameString, nameFromHash.GetStringView());
+        }
+    }
+
     TEST_F(NameTest, NameComparisonTest)
     {
         AZ::Name a{"a"};
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ParallelTick.h>
+#include <AzCore/Component/ParallelTickSystemComponent.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class ParallelTickTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_parallelTickComponent = AZStd::make_unique<AZ::ParallelTickSystemComponent>();
+            m_parallelTickComponent->Activate();
+        }
+
+        void TearDown() override
+        {
+            m_parallelTickComponent->Deactivate();
+            m_parallelTickComponent.reset();
+        }
+
+        AZStd::unique_ptr<AZ::ParallelTickSystemComponent> m_parallelTickComponent;
+    };
+
+    class TestParallelTicker
+        : public AZ::ParallelTickHandler
+    {
+    public:
+        TestParallelTicker(uint32_t id, int tickOrder, AZStd::vector<uint32_t>& tickedIds)
+            : m_id(id)
+            , m_tickOrder(tickOrder)
+            , m_tickedIds(tickedIds)
+        {
+        }
+
+        void OnParallelTick(float, AZ::ScriptTimePoint) override
+        {
+            m_tickedIds.push_back(m_id);
+        }
+
+        int GetParallelTickOrder() const override
+        {
+            return m_tickOrder;
+        }
+
+        void GetParallelTickAccess(AZ::ParallelTickAccess& access) const override
+        {
+            access = m_access;
+        }
+
+        uint32_t m_id;
+        int m_tickOrder;
+        AZ::ParallelTickAccess m_access;
+        AZStd::vector<uint32_t>& m_tickedIds;
+    };
+
+    class TestSerialTicker
+        : public AZ::TickBus::Handler
+    {
+    public:
+        TestSerialTicker(uint32_t id, int tickOrder, AZStd::vector<uint32_t>& tickedIds)
+            : m_id(id)
+            , m_tickOrder(tickOrder)
+            , m_tickedIds(tickedIds)
+        {
+            BusConnect();
+        }
+
+        void OnTick(float, AZ::ScriptTimePoint) override
+        {
+            m_tickedIds.push_back(m_id);
+        }
+
+        int GetTickOrder() override
+        {
+            return m_tickOrder;
+        }
+
+        uint32_t m_id;
+        int m_tickOrder;
+        AZStd::vector<uint32_t>& m_tickedIds;
+    };
+
+    TEST_F(ParallelTickTests, AssignStages_ConflictsAreOrdered)
+    {
+        const AZ::Crc32 transforms = AZ_CRC_CE("Transforms");
+        const AZ::Crc32 velocities = AZ_CRC_CE("Velocities");
+
+        AZStd::vector<AZ::ParallelTickAccess> accesses(6);
+        accesses[0].Write(velocities);
+        accesses[1].Read(velocities);
+        accesses[1].Write(transforms);
+        accesses[2].Read(transforms);
+        accesses[3].Read(transforms);
+        accesses[4].Write(velocities);
+        // accesses[5] doesn't touch any shared data
+
+        const AZStd::vector<uint32_t> stages = AZ::ParallelTickSystemComponent::AssignStages(accesses);
+        const AZStd::vector<uint32_t> expectedStages = { 0, 1, 2, 2, 2, 0 };
+        EXPECT_EQ(stages, expectedStages);
+    }
+
+    TEST_F(ParallelTickTests, AssignStages_ExclusiveRunsAlone)
+    {
+        AZStd::vector<AZ::ParallelTickAccess> accesses(4);
+        accesses[0].Read(AZ_CRC_CE("Transforms"));
+        accesses[2].SetExclusive();
+
+        const AZStd::vector<uint32_t> stages = AZ::ParallelTickSystemComponent::AssignStages(accesses);
+        const AZStd::vector<uint32_t> expectedStages = { 0, 0, 1, 2 };
+        EXPECT_EQ(stages, expectedStages);
+    }
+
+    TEST_F(ParallelTickTests, OnTick_RunsBetweenTickBusHandlers)
+    {
+        AZStd::vector<uint32_t> tickedIds;
+        TestSerialTicker serialEarly(0, AZ::TICK_PLACEMENT, tickedIds);
+        TestSerialTicker serialLate(3, AZ::TICK_UI, tickedIds);
+        TestParallelTicker writer(1, AZ::TICK_GAME, tickedIds);
+        writer.m_access.Write(AZ_CRC_CE("Transforms"));
+        TestParallelTicker reader(2, AZ::TICK_GAME, tickedIds);
+        reader.m_access.Read(AZ_CRC_CE("Transforms"));
+
+        // The reader conflicts with the writer that connected before it, so it runs in the next stage
+        writer.Connect();
+        reader.Connect();
+
+        AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint{});
+        const AZStd::vector<uint32_t> expectedIds = { 0, 1, 2, 3 };
+        EXPECT_EQ(tickedIds, expectedIds);
+
+        // Disconnected handlers are dropped from the schedule
+        tickedIds.clear();
+        writer.Disconnect();
+        AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint{});
+        const AZStd::vector<uint32_t> expectedIdsAfterDisconnect = { 0, 2, 3 };
+        EXPECT_EQ(tickedIds, expectedIdsAfterDisconnect);
+    }
+
+    TEST_F(ParallelTickTests, VisitSchedule_ReportsStages)
+    {
+        AZStd::vector<uint32_t> tickedIds;
+        AZStd::vector<AZStd::unique_ptr<TestParallelTicker>> tickers;
+        for (uint32_t id = 0; id < 4; ++id)
+        {
+            tickers.push_back(AZStd::make_unique<TestParallelTicker>(id, AZ::TICK_DEFAULT, tickedIds));
+            tickers.back()->m_access.Read(AZ_CRC_CE("Transforms"));
+        }
+        tickers[1]->m_access.Write(AZ_CRC_CE("Velocities"));
+        tickers[3]->m_access.Read(AZ_CRC_CE("Velocities"));
+        for (auto& ticker : tickers)
+        {
+            ticker->Connect();
+        }
+
+        AZStd::vector<size_t> stageSizes;
+        m_parallelTickComponent->VisitSchedule([&stageSizes](int tickOrder, uint32_t stageIndex, uint32_t taskCount, const AZStd::vector<AZ::ParallelTickHandler*>& handlers)
+        {
+            EXPECT_EQ(tickOrder, AZ::TICK_DEFAULT);
+            EXPECT_EQ(stageIndex, stageSizes.size());
+            EXPECT_GE(taskCount, 1);
+            stageSizes.push_back(handlers.size());
+        });
+        const AZStd::vector<size_t> expectedStageSizes = { 3, 1 };
+        EXPECT_EQ(stageSizes, expectedStageSizes);
+    }
+}
@@ -1268,4 +1268,31 @@ namespace UnitTest
         m_reflection.reset();
         EXPECT_FALSE(TestReflectedClass::s_isReflected);
     }
+
+    TEST_F(ReflectionManagerTest, LazyContext_ReflectsOnFirstGet)
+    {
+        m_reflection->AddLazyReflectContext<AZ::SerializeContext>();
+
+        TestReflectedClass::s_isReflected = false;
+        m_reflection->Reflect(&TestReflectedClass::Reflect);
+        EXPECT_FALSE(TestReflectedClass::s_isReflected);
+
+        EXPECT_NE(m_reflection->GetReflectContext<AZ::SerializeContext>(), nullptr);
+        EXPECT_TRUE(TestReflectedClass::s_isReflected);
+
+        m_reflection->Unreflect(&TestReflectedClass::Reflect);
+        EXPECT_FALSE(TestReflectedClass::s_isReflected);
+    }
+
+    TEST_F(ReflectionManagerTest, LazyContext_RemovedBeforeGet_NothingUnreflected)
+    {
+        m_reflection->AddLazyReflectContext<AZ::SerializeContext>();
+        m_reflection->Reflect(&TestReflectedClass::Reflect);
+
+        // Unreflecting an entry point that was never reflected would flip the flag
+        TestReflectedClass::s_isReflected = true;
+        m_reflection->RemoveReflectContext<AZ::SerializeContext>();
+        EXPECT_TRUE(TestReflectedClass::s_isReflected);
+        EXPECT_EQ(m_reflection->GetReflectContext<AZ::SerializeContext>(), nullptr);
+    }
 }
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathReflection.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    namespace ScriptBenchmarkInternal
+    {
+        static int GlobalAdd(int lhs, int rhs)
+        {
+            return lhs + rhs;
+        }
+    } // namespace ScriptBenchmarkInternal
+
+    //! Measures the cost of calling BehaviorContext methods from Lua. Every benchmark iteration runs a Lua loop,
+    //! so the cost of executing the script string is spread over many calls.
+    class ScriptCallBenchmarkFixture : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr int CallsPerIteration = 1000;
+
+        void SetUp(const ::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            SetUpScript();
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            SetUpScript();
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            TearDownScript();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            TearDownScript();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+    protected:
+        void SetUpScript()
+        {
+            m_behavior = aznew AZ::BehaviorContext();
+            AZ::MathReflect(m_behavior);
+            m_behavior->Method("ScriptBenchmarkGlobalAdd", &ScriptBenchmarkInternal::GlobalAdd);
+
+            m_script = aznew AZ::ScriptContext();
+            m_script->BindTo(m_behavior);
+            m_script->Execute(R"(
+                function BenchmarkGlobalCall(count)
+                    local sum = 0
+                    for i = 1, count do
+                        sum = ScriptBenchmarkGlobalAdd(sum, 1)
+                    end
+                    return sum
+                end
+
+                function BenchmarkValueTypeCall(count)
+                    local lhs = Vector3(1, 2, 3)
+                    local rhs = Vector3(3, 2, 1)
+                    local sum = 0
+                    for i = 1, count do
+                        sum = sum + lhs:Dot(rhs)
+                    end
+                    return sum
+                end
+
+                function BenchmarkValueTypeResult(count)
+                    local lhs = Vector3(1, 2, 3)
+                    local rhs = Vector3(3, 2, 1)
+                    local result = lhs
+                    for i = 1, count do
+                        result = lhs + rhs
+                    end
+                    return result
+                end
+            )");
+        }
+
+        void TearDownScript()
+        {
+            delete m_script;
+            m_script = nullptr;
+            delete m_behavior;
+            m_behavior = nullptr;
+        }
+
+        void RunBenchmark(::benchmark::State& state, const char* functionName)
+        {
+            const AZStd::string script = AZStd::string::format("%s(%d)", functionName, CallsPerIteration);
+            for ([[maybe_unused]] auto _ : state)
+            {
+                m_script->Execute(script.c_str());
+            }
+            state.SetItemsProcessed(state.iterations() * CallsPerIteration);
+        }
+
+        AZ::BehaviorContext* m_behavior = nullptr;
+        AZ::ScriptContext* m_script = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(ScriptCallBenchmarkFixture, BM_LuaCallGlobalMethod)(::benchmark::State& state)
+    {
+        RunBenchmark(state, "BenchmarkGlobalCall");
+    }
+    BENCHMARK_REGISTER_F(ScriptCallBenchmarkFixture, BM_LuaCallGlobalMethod);
+
+    BENCHMARK_DEFINE_F(ScriptCallBenchmarkFixture, BM_LuaCallValueTypeMethod)(::benchmark::State& state)
+    {
+        RunBenchmark(state, "BenchmarkValueTypeCall");
+    }
+    BENCHMARK_REGISTER_F(ScriptCallBenchmarkFixture, BM_LuaCallValueTypeMethod);
+
+    BENCHMARK_DEFINE_F(ScriptCallBenchmarkFixture, BM_LuaCallValueTypeResult)(::benchmark::State& state)
+    {
+        RunBenchmark(state, "BenchmarkValueTypeResult");
+    }
+    BENCHMARK_REGISTER_F(ScriptCallBenchmarkFixture, BM_LuaCallValueTypeResult);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
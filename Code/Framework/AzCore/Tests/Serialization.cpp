@@ -2027,6 +2027,56 @@ TEST_F(SerializeBasicTest, BasicTypeTest_Succeed)
         test.run();
     }
 
+    TEST_F(Serialization, ContainersTest_BinaryWithLoadPlans_LoadsSameDataForEveryInstance)
+    {
+        using namespace ContainersTest;
+
+        m_serializeContext->Class<ContainersStruct>()
+            ->Field("m_vector", &ContainersStruct::m_vector)
+            ->Field("m_fixedVector", &ContainersStruct::m_fixedVector)
+            ->Field("m_list", &ContainersStruct::m_list)
+            ->Field("m_unorderedMap", &ContainersStruct::m_unorderedMap)
+            ->Field("m_bitset", &ContainersStruct::m_bitset);
+
+        ContainersStruct testData;
+        testData.m_vector = { 1, 2, 3 };
+        testData.m_fixedVector.push_back(4);
+        testData.m_list.push_back(5);
+        testData.m_unorderedMap.insert(AZStd::make_pair(6, 6.f));
+        testData.m_bitset.set(7);
+
+        // Multiple instances are stored so the later ones are loaded through the plan built for the first one.
+        constexpr int NumInstances = 3;
+        AZStd::vector<char> binaryBuffer;
+        IO::ByteContainerStream<AZStd::vector<char>> binaryStream(&binaryBuffer);
+        ObjectStream* binaryObjStream = ObjectStream::Create(&binaryStream, *m_serializeContext, ObjectStream::ST_BINARY);
+        for (int i = 0; i < NumInstances; ++i)
+        {
+            binaryObjStream->WriteClass(&testData);
+        }
+        binaryObjStream->Finalize();
+
+        int numLoaded = 0;
+        binaryStream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+        ObjectStream::FilterDescriptor filter(nullptr, ObjectStream::FILTERFLAG_USE_LOAD_PLANS | ObjectStream::FILTERFLAG_STRICT);
+        bool result = ObjectStream::LoadBlocking(&binaryStream, *m_serializeContext,
+            [&testData, &numLoaded](void* classPtr, const AZ::Uuid& classId, SerializeContext*)
+            {
+                EXPECT_EQ(SerializeTypeInfo<ContainersStruct>::GetUuid(), classId);
+                auto data = reinterpret_cast<ContainersStruct*>(classPtr);
+                EXPECT_EQ(testData.m_vector, data->m_vector);
+                EXPECT_EQ(testData.m_fixedVector, data->m_fixedVector);
+                EXPECT_EQ(testData.m_list, data->m_list);
+                ASSERT_EQ(1, data->m_unorderedMap.size());
+                EXPECT_EQ(6.f, data->m_unorderedMap[6]);
+                EXPECT_EQ(testData.m_bitset, data->m_bitset);
+                delete data;
+                ++numLoaded;
+            }, filter);
+        EXPECT_TRUE(result);
+        EXPECT_EQ(NumInstances, numLoaded);
+    }
+
     TEST_F(Serialization, AssociativeContainerPtrTest)
     {
         using namespace ContainersTest;
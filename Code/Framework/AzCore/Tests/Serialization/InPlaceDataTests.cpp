@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Serialization/InPlaceData.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+
+namespace UnitTest
+{
+    struct InPlaceKey
+    {
+        float m_time;
+        float m_value;
+    };
+
+    struct InPlaceTrack
+    {
+        AZ_TYPE_INFO(InPlaceTrack, "{4B1C5C3C-7E36-4A43-9E44-2E4D71E0C6B5}");
+
+        AZ::u32 m_id;
+        AZ::InPlaceData::Array<InPlaceKey> m_keys;
+        AZ::InPlaceData::Array<AZ::u16> m_indices;
+    };
+
+    struct InPlaceOtherRoot
+    {
+        AZ_TYPE_INFO(InPlaceOtherRoot, "{0D9C1E1B-61F4-4B55-8F5B-7B0A1A6D0C2E}");
+        AZ::u32 m_value;
+    };
+
+    class InPlaceDataTests
+        : public LeakDetectionFixture
+    {
+    public:
+        AZStd::vector<AZ::u8> BuildTrack()
+        {
+            AZ::InPlaceData::Builder builder;
+            InPlaceTrack track{};
+            track.m_id = 42;
+            const size_t rootOffset = builder.Add(track);
+            builder.SetArray(rootOffset + offsetof(InPlaceTrack, m_keys), AZStd::span<const InPlaceKey>(m_keys));
+            builder.SetArray(rootOffset + offsetof(InPlaceTrack, m_indices), AZStd::span<const AZ::u16>(m_indices));
+            return builder.Finish<InPlaceTrack>(rootOffset);
+        }
+
+        void VerifyTrack(const AZ::InPlaceData::Blob& blob)
+        {
+            const InPlaceTrack* track = blob.GetRoot<InPlaceTrack>();
+            ASSERT_NE(nullptr, track);
+            EXPECT_EQ(42, track->m_id);
+            EXPECT_TRUE(blob.Contains(track->m_keys));
+            EXPECT_TRUE(blob.Contains(track->m_indices));
+            ASSERT_EQ(m_keys.size(), track->m_keys.size());
+            for (size_t i = 0; i < m_keys.size(); ++i)
+            {
+                EXPECT_EQ(m_keys[i].m_time, track->m_keys[i].m_time);
+                EXPECT_EQ(m_keys[i].m_value, track->m_keys[i].m_value);
+            }
+            ASSERT_EQ(m_indices.size(), track->m_indices.size());
+            EXPECT_TRUE(AZStd::equal(m_indices.begin(), m_indices.end(), track->m_indices.begin()));
+        }
+
+    protected:
+        AZStd::vector<InPlaceKey> m_keys{ { 0.0f, 1.0f }, { 0.5f, 2.0f }, { 1.0f, 3.0f } };
+        AZStd::vector<AZ::u16> m_indices{ 3, 1, 4, 1, 5 };
+    };
+
+    TEST_F(InPlaceDataTests, Load_FromStream_ArraysMatchSourceData)
+    {
+        AZStd::vector<AZ::u8> data = BuildTrack();
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream(&data);
+
+        AZ::InPlaceData::Blob blob;
+        ASSERT_TRUE(blob.Load(stream));
+        VerifyTrack(blob);
+    }
+
+    TEST_F(InPlaceDataTests, Map_FromFile_ArraysMatchSourceData)
+    {
+        AZStd::vector<AZ::u8> data = BuildTrack();
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        AZ::IO::Path path = tempDirectory.GetDirectoryAsPath() / "Track.inplace";
+        {
+            AZ::IO::SystemFile file;
+            ASSERT_TRUE(file.Open(path.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY));
+            file.Write(data.data(), data.size());
+        }
+
+        AZ::InPlaceData::Blob blob;
+        ASSERT_TRUE(blob.Map(path.c_str()));
+        VerifyTrack(blob);
+    }
+
+    TEST_F(InPlaceDataTests, GetRoot_DifferentType_ReturnsNull)
+    {
+        AZStd::vector<AZ::u8> data = BuildTrack();
+        AZ::InPlaceData::Blob blob;
+        ASSERT_TRUE(blob.Load(data.data(), data.size()));
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_EQ(nullptr, blob.GetRoot<InPlaceOtherRoot>());
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(InPlaceDataTests, Load_TruncatedData_Fails)
+    {
+        AZStd::vector<AZ::u8> data = BuildTrack();
+        AZ::InPlaceData::Blob blob;
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(blob.Load(data.data(), data.size() - 16));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(blob.IsLoaded());
+    }
+} // namespace UnitTest
@@ -294,6 +294,7 @@ namespace JsonSerializationTests
     public:
         using Container = AZStd::vector<SimpleClass>;
         using BaseClassContainer = AZStd::vector<AZStd::shared_ptr<BaseClass>>;
+        using PointerContainer = AZStd::vector<SimpleClass*>;
 
         using JsonBasicContainerSerializerTests::RegisterAdditional;
         void RegisterAdditional(AZStd::unique_ptr<AZ::SerializeContext>& serializeContext) override
@@ -304,6 +305,7 @@ namespace JsonSerializationTests
             serializeContext->RegisterGenericType<AZStd::shared_ptr<BaseClass>>();
             serializeContext->RegisterGenericType<AZStd::shared_ptr<SimpleInheritence>>();
             serializeContext->RegisterGenericType<BaseClassContainer>();
+            serializeContext->RegisterGenericType<PointerContainer>();
         }
     };
 
@@ -334,6 +336,53 @@ namespace JsonSerializationTests
         Expect_DocStrEq("[{},{}]");
     }
 
+    TEST_F(JsonVectorSerializerTests, Load_PointersInParallel_SameResultAndReportsAsLoadingInOrder)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        m_jsonDocument->Parse(R"([{ "var1": 1 }, { "var1": 2 }, 42, { "var1": 4, "var2": 8.0 }])");
+        ASSERT_FALSE(m_jsonDocument->HasParseError());
+
+        auto load = [this](PointerContainer& instance, AZStd::vector<AZStd::string>& reports)
+        {
+            AZ::ScopedContextReporter reporter(*m_jsonDeserializationContext,
+                [&reports](AZStd::string_view message, ResultCode result, AZStd::string_view path) -> ResultCode
+                {
+                    reports.push_back(AZStd::string::format("%.*s: %.*s", AZ_STRING_ARG(path), AZ_STRING_ARG(message)));
+                    return result;
+                });
+            return m_serializer->Load(&instance, azrtti_typeid(&instance), *m_jsonDocument, *m_jsonDeserializationContext);
+        };
+
+        PointerContainer expected;
+        AZStd::vector<AZStd::string> expectedReports;
+        ResultCode expectedResult = load(expected, expectedReports);
+
+        m_deserializationSettings->m_parallelLoadThreshold = 2;
+        ResetJsonContexts();
+        PointerContainer instance;
+        AZStd::vector<AZStd::string> reports;
+        ResultCode result = load(instance, reports);
+
+        EXPECT_EQ(expectedResult.GetProcessing(), result.GetProcessing());
+        EXPECT_EQ(expectedResult.GetOutcome(), result.GetOutcome());
+        EXPECT_EQ(expectedReports, reports);
+        ASSERT_EQ(expected.size(), instance.size());
+        for (size_t i = 0; i < instance.size(); ++i)
+        {
+            EXPECT_TRUE(instance[i]->Equals(*expected[i], true));
+        }
+
+        for (SimpleClass* value : expected)
+        {
+            delete value;
+        }
+        for (SimpleClass* value : instance)
+        {
+            delete value;
+        }
+    }
+
     TEST_F(JsonVectorSerializerTests, Store_VectorValuesAreInheritedClassWithAllDefaults_DoesNotReturnDefaultsUsed)
     {
         using namespace AZ::JsonSerializationResult;
@@ -606,6 +606,45 @@ namespace JsonSerializationTests
         EXPECT_STRCASEEQ("World", entry->second.c_str());
     }
 
+    TEST_F(JsonMapSerializerTests, Load_EntriesInParallel_SameResultAndReportsAsLoadingInOrder)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        m_jsonDocument->Parse(R"(
+            {
+                "Hello": "World",
+                "Parallel": "Load",
+                "Loading": "Test"
+            })");
+        ASSERT_FALSE(m_jsonDocument->HasParseError());
+
+        auto load = [this](StringMap& values, AZStd::vector<AZStd::string>& reports)
+        {
+            AZ::ScopedContextReporter reporter(*m_jsonDeserializationContext,
+                [&reports](AZStd::string_view message, ResultCode result, AZStd::string_view path) -> ResultCode
+                {
+                    reports.push_back(AZStd::string::format("%.*s: %.*s", AZ_STRING_ARG(path), AZ_STRING_ARG(message)));
+                    return result;
+                });
+            return m_unorderedMapSerializer.Load(&values, azrtti_typeid(&values), *m_jsonDocument, *m_jsonDeserializationContext);
+        };
+
+        StringMap expected;
+        AZStd::vector<AZStd::string> expectedReports;
+        ResultCode expectedResult = load(expected, expectedReports);
+
+        m_deserializationSettings->m_parallelLoadThreshold = 2;
+        ResetJsonContexts();
+        StringMap values;
+        AZStd::vector<AZStd::string> reports;
+        ResultCode result = load(values, reports);
+
+        EXPECT_EQ(expectedResult.GetProcessing(), result.GetProcessing());
+        EXPECT_EQ(expectedResult.GetOutcome(), result.GetOutcome());
+        EXPECT_EQ(expectedReports, reports);
+        EXPECT_EQ(expected, values);
+    }
+
     TEST_F(JsonMapSerializerTests, Load_ExplicitlyFailValueLoading_CatastrophicEventPropagated)
     {
         using namespace AZ::JsonSerializationResult;
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Math/MathReflection.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Resembles a component in a prefab or asset, a few scalars, a string and a small array.
+    struct SerializationBenchmarkElement
+    {
+        AZ_TYPE_INFO(SerializationBenchmarkElement, "{5D0C8E51-2A1B-4F7C-9E36-81B4C27A0D93}");
+
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        AZStd::string m_name;
+        AZStd::vector<float> m_weights;
+        AZ::u64 m_id = 0;
+        float m_scale = 1.0f;
+        bool m_enabled = true;
+
+        static void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<SerializationBenchmarkElement>()
+                ->Field("Position", &SerializationBenchmarkElement::m_position)
+                ->Field("Name", &SerializationBenchmarkElement::m_name)
+                ->Field("Weights", &SerializationBenchmarkElement::m_weights)
+                ->Field("Id", &SerializationBenchmarkElement::m_id)
+                ->Field("Scale", &SerializationBenchmarkElement::m_scale)
+                ->Field("Enabled", &SerializationBenchmarkElement::m_enabled);
+        }
+    };
+
+    struct SerializationBenchmarkDocument
+    {
+        AZ_TYPE_INFO(SerializationBenchmarkDocument, "{B83F1E2A-64D7-4C09-A5E1-3F927D6C1B48}");
+
+        AZStd::vector<SerializationBenchmarkElement> m_elements;
+
+        static void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<SerializationBenchmarkDocument>()
+                ->Field("Elements", &SerializationBenchmarkDocument::m_elements);
+        }
+    };
+
+    //! Measures loading the same data through the json serializer and through the ObjectStream in its xml and binary
+    //! formats. The range argument is the number of elements in the document.
+    class SerializationBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpInternal(state);
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpInternal(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            TearDownInternal();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDownInternal();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void SetUpInternal(const ::benchmark::State& state)
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_registrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            AZ::MathReflect(m_serializeContext.get());
+            AZ::JsonSystemComponent::Reflect(m_registrationContext.get());
+            SerializationBenchmarkElement::Reflect(*m_serializeContext);
+            SerializationBenchmarkDocument::Reflect(*m_serializeContext);
+
+            const size_t elementCount = static_cast<size_t>(state.range(0));
+            m_document.m_elements.resize(elementCount);
+            for (size_t index = 0; index < elementCount; ++index)
+            {
+                SerializationBenchmarkElement& element = m_document.m_elements[index];
+                const float offset = static_cast<float>(index);
+                element.m_position = AZ::Vector3(offset, offset * 2.0f, -offset);
+                element.m_name = AZStd::string::format("Element_%zu", index);
+                element.m_weights = { 0.25f, 0.5f, 0.75f, offset };
+                element.m_id = 0x10000 + index;
+                element.m_scale = 1.0f + offset * 0.01f;
+                element.m_enabled = (index % 3) != 0;
+            }
+        }
+
+        void TearDownInternal()
+        {
+            m_document = {};
+
+            m_registrationContext->EnableRemoveReflection();
+            AZ::JsonSystemComponent::Reflect(m_registrationContext.get());
+            m_registrationContext->DisableRemoveReflection();
+
+            m_registrationContext.reset();
+            m_serializeContext.reset();
+        }
+
+        AZStd::string StoreJsonText()
+        {
+            AZ::JsonSerializerSettings settings;
+            settings.m_serializeContext = m_serializeContext.get();
+            settings.m_registrationContext = m_registrationContext.get();
+
+            rapidjson::Document document;
+            AZ::JsonSerialization::Store(document, document.GetAllocator(), m_document, settings);
+            AZStd::string text;
+            AZ::JsonSerializationUtils::WriteJsonString(document, text);
+            return text;
+        }
+
+        AZStd::vector<char> SaveObjectStream(AZ::DataStream::StreamType streamType)
+        {
+            AZStd::vector<char> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            AZ::Utils::SaveObjectToStream(stream, streamType, &m_document, m_serializeContext.get());
+            return buffer;
+        }
+
+        void LoadObjectStream(::benchmark::State& state, AZ::DataStream::StreamType streamType)
+        {
+            const AZStd::vector<char> buffer = SaveObjectStream(streamType);
+            for ([[maybe_unused]] auto _ : state)
+            {
+                SerializationBenchmarkDocument document;
+                AZ::Utils::LoadObjectFromBufferInPlace(buffer.data(), buffer.size(), document, m_serializeContext.get());
+                benchmark::DoNotOptimize(document.m_elements.data());
+            }
+            state.SetBytesProcessed(state.iterations() * buffer.size());
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_registrationContext;
+        SerializationBenchmarkDocument m_document;
+    };
+
+    BENCHMARK_DEFINE_F(SerializationBenchmark, JsonLoadFromText)(benchmark::State& state)
+    {
+        const AZStd::string text = StoreJsonText();
+
+        AZ::JsonDeserializerSettings settings;
+        settings.m_serializeContext = m_serializeContext.get();
+        settings.m_registrationContext = m_registrationContext.get();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto parsed = AZ::JsonSerializationUtils::ReadJsonString(text);
+            SerializationBenchmarkDocument document;
+            AZ::JsonSerialization::Load(document, parsed.GetValue(), settings);
+            benchmark::DoNotOptimize(document.m_elements.data());
+        }
+        state.SetBytesProcessed(state.iterations() * text.size());
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SerializationBenchmark, JsonLoadFromText)->Arg(100)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(SerializationBenchmark, JsonStoreToText)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(StoreJsonText());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SerializationBenchmark, JsonStoreToText)->Arg(100)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(SerializationBenchmark, ObjectStreamLoadXml)(benchmark::State& state)
+    {
+        LoadObjectStream(state, AZ::DataStream::ST_XML);
+    }
+    BENCHMARK_REGISTER_F(SerializationBenchmark, ObjectStreamLoadXml)->Arg(100)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(SerializationBenchmark, ObjectStreamLoadBinary)(benchmark::State& state)
+    {
+        LoadObjectStream(state, AZ::DataStream::ST_BINARY);
+    }
+    BENCHMARK_REGISTER_F(SerializationBenchmark, ObjectStreamLoadBinary)->Arg(100)->Arg(10000)->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
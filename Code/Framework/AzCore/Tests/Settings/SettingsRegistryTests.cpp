@@ -13,6 +13,7 @@
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
@@ -1599,6 +1600,44 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/5"));
     }
 
+    TEST_F(SettingsRegistryTest, MergeSettingsFolder_ManyFiles_FilesAppliedInAlphabeticOrder)
+    {
+        // Enough files for them to be parsed on several threads.
+        constexpr int fileCount = 4 * AZ::SettingsRegistryImpl::MinFilesPerParseThread;
+        constexpr int invalidFile = 7;
+        for (int i = 0; i < fileCount; ++i)
+        {
+            CreateTestFile(AZStd::string::format("File%02i.setreg", i), i == invalidFile
+                ? AZStd::string(R"({ "Last": )")
+                : AZStd::string::format(R"({ "Last": %i, "File%02i": true })", i, i));
+        }
+        CreateTestFile("File99.setregpatch", R"([ { "op": "replace", "path": "/Last", "value": 99 } ])");
+
+        auto result = m_registry->MergeSettingsFolder((m_tempDirectory.GetDirectoryAsFixedMaxPath() / AZ::SettingsRegistryInterface::RegistryFolder).Native(), { "editor", "test" }, {});
+        EXPECT_TRUE(result);
+
+        s64 last = 0;
+        EXPECT_TRUE(m_registry->Get(last, "/Last"));
+        EXPECT_EQ(99, last);
+        for (int i = 0; i < fileCount; ++i)
+        {
+            const AZStd::string fileKey = AZStd::string::format("/File%02i", i);
+            const AZStd::string historyKey = AZStd::string::format(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/%i", i + 1);
+            if (i == invalidFile)
+            {
+                EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, m_registry->GetType(fileKey));
+                EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, m_registry->GetType(historyKey));
+            }
+            else
+            {
+                EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Boolean, m_registry->GetType(fileKey));
+                AZStd::string historyPath;
+                EXPECT_TRUE(m_registry->Get(historyPath, historyKey));
+                EXPECT_TRUE(historyPath.ends_with(AZStd::string::format("File%02i.setreg", i)));
+            }
+        }
+    }
+
     TEST_F(SettingsRegistryTest, MergeSettingsFolder_JsonPatchFiles_FilesAppliedInAlphabeticAndSpecializationOrder)
     {
         CreateTestFile("Memory.setreg", R"({ "Memory": 0, "MemoryRoot": true })");
@@ -1744,4 +1783,82 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File1"));
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File2"));
     }
+
+    //
+    // SettingsRegistrySnapshot
+    //
+
+    TEST_F(SettingsRegistryTest, SettingsRegistrySnapshot_SaveAndLoad_MergedSettingsRestored)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        CreateTestFile("Memory.editor.setreg", R"({ "Memory": 1, "Name": "Editor" })");
+        ASSERT_TRUE(m_registry->MergeSettingsFolder((m_tempDirectory.GetDirectoryAsFixedMaxPath() / AZ::SettingsRegistryInterface::RegistryFolder).Native(), { "editor" }, {}));
+        ASSERT_TRUE(m_registry->MergeSettings(R"([{ "op": "add", "path": "/Null", "value": null }])", AZ::SettingsRegistryInterface::Format::JsonPatch));
+
+        const auto snapshotPath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "Settings.snapshot";
+        ASSERT_TRUE(AZ::SettingsRegistrySnapshot::Save(*m_registry, snapshotPath.c_str(), "key"));
+
+        AZ::SettingsRegistryImpl loadedRegistry;
+        ASSERT_TRUE(AZ::SettingsRegistrySnapshot::Load(loadedRegistry, snapshotPath.c_str(), "key"));
+
+        AZ::s64 memory = -1;
+        EXPECT_TRUE(loadedRegistry.Get(memory, "/Memory"));
+        EXPECT_EQ(1, memory);
+        AZ::SettingsRegistryInterface::FixedValueString name;
+        EXPECT_TRUE(loadedRegistry.Get(name, "/Name"));
+        EXPECT_STREQ("Editor", name.c_str());
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Null, loadedRegistry.GetType("/Null"));
+
+        AZ::SettingsRegistryInterface::FixedValueString historyPath;
+        EXPECT_TRUE(loadedRegistry.Get(historyPath, AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1"));
+        EXPECT_TRUE(historyPath.ends_with("Memory.setreg"));
+    }
+
+    TEST_F(SettingsRegistryTest, SettingsRegistrySnapshot_LoadWithDifferentKey_SnapshotNotLoaded)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        ASSERT_TRUE(m_registry->MergeSettingsFolder((m_tempDirectory.GetDirectoryAsFixedMaxPath() / AZ::SettingsRegistryInterface::RegistryFolder).Native(), {}, {}));
+
+        const auto snapshotPath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "Settings.snapshot";
+        ASSERT_TRUE(AZ::SettingsRegistrySnapshot::Save(*m_registry, snapshotPath.c_str(), "key"));
+
+        AZ::SettingsRegistryImpl loadedRegistry;
+        EXPECT_FALSE(AZ::SettingsRegistrySnapshot::Load(loadedRegistry, snapshotPath.c_str(), "other key"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, loadedRegistry.GetType("/Memory"));
+    }
+
+    TEST_F(SettingsRegistryTest, SettingsRegistrySnapshot_InputFileChanged_SnapshotNotLoaded)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        ASSERT_TRUE(m_registry->MergeSettingsFolder((m_tempDirectory.GetDirectoryAsFixedMaxPath() / AZ::SettingsRegistryInterface::RegistryFolder).Native(), {}, {}));
+
+        const auto snapshotPath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "Settings.snapshot";
+        ASSERT_TRUE(AZ::SettingsRegistrySnapshot::Save(*m_registry, snapshotPath.c_str(), "key"));
+
+        CreateTestFile("Memory.setreg", R"({ "Memory": 1000 })");
+
+        AZ::SettingsRegistryImpl loadedRegistry;
+        EXPECT_FALSE(AZ::SettingsRegistrySnapshot::Load(loadedRegistry, snapshotPath.c_str(), "key"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, loadedRegistry.GetType("/Memory"));
+    }
+
+    TEST_F(SettingsRegistryTest, SettingsRegistrySnapshot_FileAddedToFolder_SnapshotNotLoaded)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        ASSERT_TRUE(m_registry->MergeSettingsFolder((m_tempDirectory.GetDirectoryAsFixedMaxPath() / AZ::SettingsRegistryInterface::RegistryFolder).Native(), {}, {}));
+
+        const auto snapshotPath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "Settings.snapshot";
+        ASSERT_TRUE(AZ::SettingsRegistrySnapshot::Save(*m_registry, snapshotPath.c_str(), "key"));
+
+        CreateTestFile("Added.setreg", R"({ "Added": true })");
+
+        AZ::SettingsRegistryImpl loadedRegistry;
+        EXPECT_FALSE(AZ::SettingsRegistrySnapshot::Load(loadedRegistry, snapshotPath.c_str(), "key"));
+    }
+
+    TEST_F(SettingsRegistryTest, SettingsRegistrySnapshot_MissingSnapshot_ReturnsFalseWithoutErrors)
+    {
+        const auto snapshotPath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "Settings.snapshot";
+        EXPECT_FALSE(AZ::SettingsRegistrySnapshot::Load(*m_registry, snapshotPath.c_str(), "key"));
+    }
 } // namespace SettingsRegistryTests
@@ -61,11 +61,11 @@ namespace AZ::IO
             AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
         }
 
-        void CreateTestEnvironmentImplementation(bool onlyEpilogWrites)
+        void CreateTestEnvironmentImplementation(bool onlyEpilogWrites, u32 readAheadDepth = 0)
         {
             using ::testing::_;
 
-            m_cache = AZStd::make_shared<BlockCache>(m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites);
+            m_cache = AZStd::make_shared<BlockCache>(m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites, readAheadDepth);
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             m_cache->SetNext(m_mock);
             EXPECT_CALL(*m_mock, SetContext(_)).Times(1);
@@ -1167,4 +1167,90 @@ namespace AZ::IO
         EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
         ProcessRead(m_buffer, m_path, 512, m_blockSize - 1024, IStreamerTypes::RequestStatus::Completed);
     }
+
+    // File    |------------------------------------------------|
+    // Request   |-|
+    // Cache   [   v    ][    x   ][   x    ][   x    ][   x    ]
+    // Cache   [   v    ][    x   ][   x    ][   x    ][   x    ]
+    TEST_F(Streamer_BlockCacheGenericTest, Eviction_ScanThroughCache_ReusedBlockIsNotRecycled)
+    {
+        using ::testing::_;
+
+        m_cacheSize = 4 * m_blockSize;
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        // Read the first block twice so it's marked as reused.
+        EXPECT_CALL(*this, ReadFile(_, _, 0, m_blockSize)).Times(1);
+        ProcessRead(m_buffer, m_path, 256, 1024, IStreamerTypes::RequestStatus::Completed);
+        ProcessRead(m_buffer, m_path, 2048, 1024, IStreamerTypes::RequestStatus::Completed);
+
+        // Read one time from more blocks than the cache can hold.
+        for (u64 i = 1; i < 5; ++i)
+        {
+            EXPECT_CALL(*this, ReadFile(_, _, i * m_blockSize, m_blockSize)).Times(1);
+            ProcessRead(m_buffer, m_path, i * m_blockSize + 256, 1024, IStreamerTypes::RequestStatus::Completed);
+        }
+
+        // The first block should still be in the cache.
+        ProcessRead(m_buffer, m_path, 4096, 1024, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(4096, 1024);
+    }
+
+    /////////////////////////////////////////////////////////////
+    // Block cache with readahead.
+    /////////////////////////////////////////////////////////////
+    class Streamer_BlockCacheReadAheadTest
+        : public BlockCacheTest
+    {
+    public:
+        void CreateTestEnvironment()
+        {
+            CreateTestEnvironmentImplementation(false, 2);
+        }
+    };
+
+    // File    |------------------------------------------------|
+    // Request |-||-||-||-|
+    // Cache   [   v    ][    p   ][   p    ][   p    ][   x    ]
+    TEST_F(Streamer_BlockCacheReadAheadTest, ReadAhead_SequentialSmallReads_NextBlocksArePrefetched)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        const u64 readSize = m_blockSize / 4;
+        EXPECT_CALL(*this, ReadFile(_, _, 0, m_blockSize)).Times(1);
+        EXPECT_CALL(*this, ReadFile(_, _, m_blockSize, m_blockSize)).Times(1);
+        EXPECT_CALL(*this, ReadFile(_, _, 2 * m_blockSize, m_blockSize)).Times(1);
+        EXPECT_CALL(*this, ReadFile(_, _, 3 * m_blockSize, m_blockSize)).Times(1);
+
+        for (u64 i = 0; i < 5; ++i)
+        {
+            ProcessRead(m_buffer, m_path, i * readSize, readSize, IStreamerTypes::RequestStatus::Completed);
+            VerifyReadBuffer(i * readSize, readSize);
+        }
+
+        // The fifth read is served from the first block that was read ahead.
+        EXPECT_GT(m_cache->CalculatePrefetchHitRatePercentage(), 0.0);
+    }
+
+    // File    |------------------------------------------------|
+    // Request |-|      |-|     |-|
+    // Cache   [   v    ][    v   ][   v    ][   x    ][   x    ]
+    TEST_F(Streamer_BlockCacheReadAheadTest, ReadAhead_RandomSmallReads_NoBlocksArePrefetched)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(3);
+        for (u64 i = 0; i < 3; ++i)
+        {
+            ProcessRead(m_buffer, m_path, i * m_blockSize, 1024, IStreamerTypes::RequestStatus::Completed);
+        }
+        EXPECT_EQ(0.0, m_cache->CalculatePrefetchHitRatePercentage());
+    }
 } // namespace AZ::IO
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <AzCore/IO/ChunkedCompression.h>
+#include <AzCore/IO/Streamer/ChunkedDecompressor.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class ChunkedDecompressorTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<ChunkedDecompressor>
+    {
+    public:
+        static constexpr u32 m_arbitrarilyLargeAlignment = 4096;
+
+        ChunkedDecompressor CreateInstance() override
+        {
+            return ChunkedDecompressor(2, 2, 4, m_arbitrarilyLargeAlignment);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_ChunkedDecompressorConformityTests, StreamStackEntryConformityTests, ChunkedDecompressorTestDescription);
+
+    class Streamer_ChunkedCompressionTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        void CreateData(size_t size)
+        {
+            // Repeating values so zstd is able to compress the blocks.
+            m_data.resize(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                m_data[i] = aznumeric_cast<u8>((i / 7) & 0x3f);
+            }
+        }
+
+        AZStd::vector<u8> m_data;
+    };
+
+    TEST_F(Streamer_ChunkedCompressionTest, Compress_RoundTripAllBlocks_DataMatches)
+    {
+        constexpr u32 blockSize = 16 * 1024;
+        CreateData(5 * blockSize + 123);
+
+        AZStd::vector<u8> compressed;
+        ASSERT_TRUE(ChunkedCompression::Compress(compressed, m_data.data(), m_data.size(), blockSize));
+        EXPECT_LT(compressed.size(), m_data.size());
+
+        ChunkedCompression::Header header;
+        ASSERT_TRUE(ChunkedCompression::ReadHeader(header, compressed.data(), compressed.size()));
+        EXPECT_EQ(6, header.m_blockCount);
+        EXPECT_EQ(m_data.size(), header.m_uncompressedSize);
+
+        AZStd::vector<ChunkedCompression::Block> blocks;
+        ASSERT_TRUE(ChunkedCompression::ReadBlockIndex(blocks, header, compressed.data(), compressed.size()));
+
+        AZStd::vector<u8> decompressed(m_data.size());
+        for (u32 i = 0; i < header.m_blockCount; ++i)
+        {
+            const size_t size = aznumeric_cast<size_t>(ChunkedCompression::GetUncompressedBlockSize(header, i));
+            ASSERT_TRUE(ChunkedCompression::DecompressBlock(header.m_codec, blocks[i], compressed.data() + blocks[i].m_compressedOffset,
+                decompressed.data() + aznumeric_cast<size_t>(i) * blockSize, size));
+        }
+        EXPECT_EQ(m_data, decompressed);
+    }
+
+    TEST_F(Streamer_ChunkedCompressionTest, ReadHeader_InvalidMagic_ReturnsFalse)
+    {
+        CreateData(1024);
+        AZStd::vector<u8> compressed;
+        ASSERT_TRUE(ChunkedCompression::Compress(compressed, m_data.data(), m_data.size(), 256));
+        compressed[0] ^= 0xff;
+
+        ChunkedCompression::Header header;
+        EXPECT_FALSE(ChunkedCompression::ReadHeader(header, compressed.data(), compressed.size()));
+    }
+
+    class Streamer_ChunkedDecompressorTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        static constexpr u32 BlockSize = 4 * 1024;
+
+        void TearDown() override
+        {
+            m_decompressor.reset();
+            m_mock.reset();
+
+            delete m_context;
+            m_context = nullptr;
+
+            UnitTest::LeakDetectionFixture::TearDown();
+        }
+
+        void SetupEnvironment(u32 maxNumReads, u32 numThreads, u32 maxNumCachedIndices)
+        {
+            m_data.resize(m_fakeFileLength);
+            u32* values = reinterpret_cast<u32*>(m_data.data());
+            for (u64 i = 0; i < (m_fakeFileLength >> 2); ++i)
+            {
+                values[i] = aznumeric_caster(i << 2);
+            }
+            ASSERT_TRUE(ChunkedCompression::Compress(m_archive, m_data.data(), m_data.size(), BlockSize));
+
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_decompressor = AZStd::make_shared<ChunkedDecompressor>(maxNumReads, numThreads, maxNumCachedIndices,
+                ChunkedDecompressorTestDescription::m_arbitrarilyLargeAlignment);
+
+            m_context = new StreamerContext();
+            m_decompressor->SetContext(*m_context);
+            m_decompressor->SetNext(m_mock);
+
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::Return;
+
+            EXPECT_CALL(*m_mock, ExecuteRequests()).WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+            ON_CALL(*m_mock, QueueRequest(_))
+                .WillByDefault(Invoke(this, &Streamer_ChunkedDecompressorTest::PrepareReadRequest));
+        }
+
+        void PrepareReadRequest(FileRequest* request)
+        {
+            auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+            ASSERT_NE(nullptr, data);
+
+            m_bytesRead += data->m_size;
+            if (data->m_offset + data->m_size > m_archive.size())
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            }
+            else
+            {
+                memcpy(data->m_output, m_archive.data() + data->m_offset, data->m_size);
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            }
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        CompressionInfo CreateCompressionInfo()
+        {
+            CompressionInfo compressionInfo;
+            compressionInfo.m_compressionTag = ChunkedCompression::Tag;
+            compressionInfo.m_compressedSize = m_archive.size();
+            compressionInfo.m_isCompressed = true;
+            compressionInfo.m_offset = 0;
+            compressionInfo.m_uncompressedSize = m_fakeFileLength;
+            return compressionInfo;
+        }
+
+        void ProcessCompressedRead(AZStd::unique_ptr<u32[]>& buffer, u64 offset, u64 size, IStreamerTypes::RequestStatus expectedResult)
+        {
+            buffer = AZStd::unique_ptr<u32[]>(new u32[(size >> 2) + 1]);
+
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, CreateCompressionInfo(), buffer.get(), offset, size);
+            bool result = true;
+            auto completed = [&result, expectedResult](const FileRequest& request)
+            {
+                result = result && request.GetStatus() == expectedResult;
+            };
+            request->SetCompletionCallback(completed);
+
+            m_decompressor->QueueRequest(request);
+            bool hasCompleted = false;
+            while (m_decompressor->ExecuteRequests() || !hasCompleted)
+            {
+                StreamStackEntry::Status status;
+                m_decompressor->UpdateStatus(status);
+                if (status.m_isIdle)
+                {
+                    hasCompleted = true;
+                }
+
+                m_context->FinalizeCompletedRequests();
+            }
+
+            EXPECT_TRUE(result);
+        }
+
+        void VerifyReadBuffer(const u32* buffer, u64 offset, u64 size)
+        {
+            size = size >> 2;
+            for (u64 i = 0; i < size; ++i)
+            {
+                // Using assert here because in case of a problem EXPECT would
+                // cause a large amount of log noise.
+                ASSERT_EQ(buffer[i], offset + (i << 2));
+            }
+        }
+
+        AZStd::vector<u8> m_data;
+        AZStd::vector<u8> m_archive;
+        StreamerContext* m_context{ nullptr };
+        AZStd::shared_ptr<ChunkedDecompressor> m_decompressor;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        u64 m_fakeFileLength{ 256 * 1024 };
+        u64 m_bytesRead{ 0 };
+    };
+
+    TEST_F(Streamer_ChunkedDecompressorTest, ChunkedRead_FullRead_SuccessfullyReadData)
+    {
+        SetupEnvironment(1, 1, 4);
+        EXPECT_CALL(*m_mock, QueueRequest(::testing::_)).Times(::testing::AtLeast(2));
+
+        AZStd::unique_ptr<u32[]> buffer;
+        ProcessCompressedRead(buffer, 0, m_fakeFileLength, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(buffer.get(), 0, m_fakeFileLength);
+    }
+
+    TEST_F(Streamer_ChunkedDecompressorTest, ChunkedRead_PartialReadAcrossBlocks_SuccessfullyReadDataAndSkipsOtherBlocks)
+    {
+        SetupEnvironment(1, 2, 4);
+        EXPECT_CALL(*m_mock, QueueRequest(::testing::_)).Times(::testing::AtLeast(2));
+
+        const u64 offset = BlockSize * 10 + 256;
+        const u64 size = BlockSize * 2;
+        AZStd::unique_ptr<u32[]> buffer;
+        ProcessCompressedRead(buffer, offset, size, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(buffer.get(), offset, size);
+        EXPECT_LT(m_bytesRead, m_archive.size());
+    }
+
+    TEST_F(Streamer_ChunkedDecompressorTest, ChunkedRead_RepeatedRead_IndexIsCachedAndOnlyBlocksAreRead)
+    {
+        SetupEnvironment(1, 1, 4);
+        // Two reads for the first request, index and blocks, but only a block read for the second.
+        EXPECT_CALL(*m_mock, QueueRequest(::testing::_)).Times(3);
+
+        AZStd::unique_ptr<u32[]> buffer;
+        ProcessCompressedRead(buffer, 0, BlockSize, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(buffer.get(), 0, BlockSize);
+        ProcessCompressedRead(buffer, BlockSize * 3, BlockSize, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(buffer.get(), BlockSize * 3, BlockSize);
+    }
+
+    TEST_F(Streamer_ChunkedDecompressorTest, ChunkedRead_CorruptedHeader_RequestIsCompletedWithFailedState)
+    {
+        SetupEnvironment(1, 1, 4);
+        EXPECT_CALL(*m_mock, QueueRequest(::testing::_)).Times(1);
+        m_archive[0] ^= 0xff;
+
+        AZStd::unique_ptr<u32[]> buffer;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        ProcessCompressedRead(buffer, 0, m_fakeFileLength, IStreamerTypes::RequestStatus::Failed);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(Streamer_ChunkedDecompressorTest, ChunkedRead_NonChunkedCompressedRead_ForwardedToNextEntry)
+    {
+        SetupEnvironment(1, 1, 4);
+        EXPECT_CALL(*m_mock, QueueRequest(::testing::_))
+            .WillOnce([this](FileRequest* request)
+            {
+                EXPECT_NE(nullptr, AZStd::get_if<Requests::CompressedReadData>(&request->GetCommand()));
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+            });
+
+        CompressionInfo compressionInfo = CreateCompressionInfo();
+        compressionInfo.m_compressionTag.m_code = 0;
+        u32 buffer[4];
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), buffer, 0, sizeof(buffer));
+        m_decompressor->QueueRequest(request);
+        m_context->FinalizeCompletedRequests();
+    }
+} // namespace AZ::IO
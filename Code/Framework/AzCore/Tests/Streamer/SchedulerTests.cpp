@@ -56,7 +56,7 @@ namespace AZ::IO
 
             auto isIdle = m_isStackIdle.load();
             m_isStackIdle = true;
-            m_streamer = aznew IO::Streamer(AZStd::thread_desc{}, AZStd::make_unique<Scheduler>(m_mock));
+            m_streamer = aznew IO::Streamer(AZStd::thread_desc{}, AZStd::make_unique<Scheduler>(m_mock, AZCORE_GLOBAL_NEW_ALIGNMENT, 1, 1_mib, m_maxCoalescedReadSize));
             m_isStackIdle = isIdle;
             Interface<IO::IStreamer>::Register(m_streamer);
         }
@@ -160,6 +160,17 @@ namespace AZ::IO
         Streamer* m_streamer{ nullptr };
         AZStd::shared_ptr<StreamStackEntryMock> m_mock;
         AZStd::atomic_bool m_isStackIdle = false;
+        u64 m_maxCoalescedReadSize{ 0 };
+    };
+
+    class Streamer_SchedulerCoalesceTest
+        : public Streamer_SchedulerTest
+    {
+    public:
+        Streamer_SchedulerCoalesceTest()
+        {
+            m_maxCoalescedReadSize = 64;
+        }
     };
 
     TEST_F(Streamer_SchedulerTest, QueueNextRequest_QueueUnclaimedFireAndForgetReadWithAllocator_AllocatorCalledAndMemoryFreedAgain)
@@ -378,4 +389,74 @@ namespace AZ::IO
 
         EXPECT_EQ(Iterations + 1, counter);
     }
+
+    TEST_F(Streamer_SchedulerCoalesceTest, QueueNextRequest_AdjacentReadsInSameFile_ReadsAreMergedIntoSingleRead)
+    {
+        using ::testing::_;
+        using ::testing::AtLeast;
+
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AtLeast(1));
+        EXPECT_CALL(*m_mock, UpdateCompletionEstimates(_, _, _, _)).Times(AtLeast(1));
+        EXPECT_CALL(*m_mock, PrepareRequest(_))
+            .Times(2)
+            .WillRepeatedly([this](FileRequest* request)
+                {
+                    auto readData = AZStd::get_if<Requests::ReadRequestData>(&request->GetCommand());
+                    ASSERT_NE(nullptr, readData);
+                    FileRequest* read = m_streamerContext->GetNewInternalRequest();
+                    read->CreateRead(request, readData->m_output, readData->m_outputSize, readData->m_path,
+                        readData->m_offset, readData->m_size);
+                    m_streamerContext->PushPreparedRequest(read);
+                });
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AtLeast(1));
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .Times(1)
+            .WillOnce([this](FileRequest* request)
+                {
+                    auto readData = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+                    ASSERT_NE(nullptr, readData);
+                    EXPECT_EQ(0, readData->m_offset);
+                    EXPECT_EQ(16, readData->m_size);
+                    auto output = reinterpret_cast<uint8_t*>(readData->m_output);
+                    for (size_t i = 0; i < readData->m_size; ++i)
+                    {
+                        output[i] = azlossy_cast<uint8_t>(readData->m_offset + i);
+                    }
+                    request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                    m_streamerContext->MarkRequestAsCompleted(request);
+                });
+
+        AZStd::atomic_int counter = 2;
+        AZStd::binary_semaphore sync;
+        auto wait = [&sync, &counter](FileRequestHandle)
+        {
+            if (--counter == 0)
+            {
+                sync.release();
+            }
+        };
+
+        uint8_t buffer0[8];
+        uint8_t buffer1[8];
+        FileRequestPtr read0 = m_streamer->Read("TestPath", buffer0, sizeof(buffer0), sizeof(buffer0), IStreamerTypes::s_noDeadline,
+            IStreamerTypes::s_priorityMedium, 0);
+        FileRequestPtr read1 = m_streamer->Read("TestPath", buffer1, sizeof(buffer1), sizeof(buffer1), IStreamerTypes::s_noDeadline,
+            IStreamerTypes::s_priorityMedium, sizeof(buffer0));
+        m_streamer->SetRequestCompleteCallback(read0, wait);
+        m_streamer->SetRequestCompleteCallback(read1, wait);
+
+        m_streamer->SuspendProcessing();
+        m_streamer->QueueRequest(read0);
+        m_streamer->QueueRequest(read1);
+        m_streamer->ResumeProcessing();
+
+        ASSERT_TRUE(sync.try_acquire_for(AZStd::chrono::seconds(5)));
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_streamer->GetRequestStatus(read0));
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_streamer->GetRequestStatus(read1));
+        for (size_t i = 0; i < sizeof(buffer0); ++i)
+        {
+            EXPECT_EQ(i, buffer0[i]);
+            EXPECT_EQ(i + sizeof(buffer0), buffer1[i]);
+        }
+    }
 } // namespace AZ::IO
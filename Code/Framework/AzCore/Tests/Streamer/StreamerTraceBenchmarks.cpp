@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/IO/Streamer/BlockCache.h>
+#include <AzCore/IO/Streamer/ReadSplitter.h>
+#include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzTest/Utils.h>
+#include <Tests/FileIOBaseTestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AZ::IO;
+
+    //! Replays a synthetic trace that resembles a level load against different streaming stacks. The trace interleaves
+    //! sequential reads through a few large archives with small reads at random offsets, and gives every read a deadline.
+    //! Recorded traces from the StopStreamerTrace console command can be replayed in the engine with ReplayStreamerTrace.
+    class StreamerTraceReplayBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr AZ::u32 NumFiles = 4;
+        static constexpr AZ::u64 FileSize = 8_mib;
+        static constexpr AZ::u32 NumRequests = 1024;
+        static constexpr AZ::u64 SequentialReadSize = 64_kib;
+        static constexpr AZ::u64 SmallReadSize = 4_kib;
+
+        enum class Stack : int64_t
+        {
+            Drive,
+            BlockCache,
+            ReadSplitterAndBlockCache
+        };
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpInternal();
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpInternal();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            TearDownInternal();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDownInternal();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::unique_ptr<Streamer> CreateStreamer(Stack stackType)
+        {
+            HardwareInformation hardware;
+            CollectIoHardwareInformation(hardware, true, false);
+
+            StorageDriveConfig driveConfig;
+            AZStd::shared_ptr<StreamStackEntry> stack = driveConfig.AddStreamStackEntry(hardware, nullptr);
+            if (stackType != Stack::Drive)
+            {
+                BlockCacheConfig cacheConfig;
+                cacheConfig.m_readAheadDepth = 2;
+                stack = cacheConfig.AddStreamStackEntry(hardware, AZStd::move(stack));
+            }
+            if (stackType == Stack::ReadSplitterAndBlockCache)
+            {
+                ReadSplitterConfig splitterConfig;
+                stack = splitterConfig.AddStreamStackEntry(hardware, AZStd::move(stack));
+            }
+            return AZStd::make_unique<Streamer>(AZStd::thread_desc{}, AZStd::make_unique<Scheduler>(AZStd::move(stack),
+                hardware.m_maxPhysicalSectorSize, hardware.m_maxLogicalSectorSize, hardware.m_maxTransfer, hardware.m_maxTransfer));
+        }
+
+    protected:
+        void SetUpInternal()
+        {
+            m_prevFileIO = FileIOBase::GetInstance();
+            FileIOBase::SetInstance(&m_fileIO);
+            m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+
+            AZStd::vector<AZ::u8> data(FileSize);
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                data[i] = static_cast<AZ::u8>(i);
+            }
+            for (AZ::u32 i = 0; i < NumFiles; ++i)
+            {
+                AZ::IO::Path path = m_tempDirectory->GetDirectoryAsPath() / AZStd::string::format("Archive%u.pak", i);
+                SystemFile file;
+                file.Open(path.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_WRITE_ONLY);
+                file.Write(data.data(), data.size());
+                m_trace.m_paths.push_back(path.Native());
+            }
+
+            AZ::u64 sequentialOffsets[NumFiles] = {};
+            AZ::u32 random = 0x12345678;
+            auto nextRandom = [&random]()
+            {
+                random = random * 1664525 + 1013904223;
+                return random >> 8;
+            };
+            for (AZ::u32 i = 0; i < NumRequests; ++i)
+            {
+                StreamerTrace::Record& record = m_trace.m_records.emplace_back();
+                record.m_queueTimeUs = i * 50;
+                record.m_pathIndex = nextRandom() % NumFiles;
+                if (i % 4 == 0)
+                {
+                    record.m_size = SmallReadSize;
+                    record.m_offset = (nextRandom() % (FileSize / SmallReadSize)) * SmallReadSize;
+                    record.m_deadlineUs = 50000;
+                    record.m_priority = IStreamerTypes::s_priorityHigh;
+                }
+                else
+                {
+                    AZ::u64& offset = sequentialOffsets[record.m_pathIndex];
+                    record.m_size = SequentialReadSize;
+                    record.m_offset = offset;
+                    offset = (offset + SequentialReadSize) % FileSize;
+                    record.m_deadlineUs = 200000;
+                    record.m_priority = IStreamerTypes::s_priorityMedium;
+                }
+            }
+        }
+
+        void TearDownInternal()
+        {
+            m_trace = {};
+            m_tempDirectory.reset();
+            FileIOBase::SetInstance(m_prevFileIO);
+        }
+
+        StreamerTrace::Trace m_trace;
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+        UnitTest::TestFileIOBase m_fileIO;
+        FileIOBase* m_prevFileIO{ nullptr };
+    };
+
+    BENCHMARK_DEFINE_F(StreamerTraceReplayBenchmark, Replay)(::benchmark::State& state)
+    {
+        const Stack stackType = static_cast<Stack>(state.range(0));
+        // A time scale of 0 queues everything at once, which measures throughput. A time scale of 1 keeps the recorded timing,
+        // which measures how well the deadlines are met.
+        const float timeScale = static_cast<float>(state.range(1));
+
+        AZ::u64 missedDeadlines = 0;
+        AZ::u64 failedRequests = 0;
+        AZ::u64 bytesRead = 0;
+        double totalLatencyUs = 0.0;
+        double maxLatencyUs = 0.0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            AZStd::unique_ptr<Streamer> streamer = CreateStreamer(stackType);
+            state.ResumeTiming();
+
+            StreamerTrace::ReplayResult result = StreamerTrace::Replay(m_trace, *streamer, timeScale);
+
+            state.PauseTiming();
+            missedDeadlines += result.m_numMissedDeadlines;
+            failedRequests += result.m_numFailedRequests;
+            totalLatencyUs += static_cast<double>(result.m_averageLatency.count());
+            maxLatencyUs = AZStd::max(maxLatencyUs, static_cast<double>(result.m_maxLatency.count()));
+            bytesRead += result.m_bytesRead;
+            streamer.reset();
+            state.ResumeTiming();
+        }
+
+        state.SetBytesProcessed(bytesRead);
+        const double iterations = static_cast<double>(state.iterations());
+        state.counters["MissedDeadlines"] = static_cast<double>(missedDeadlines) / iterations;
+        state.counters["FailedRequests"] = static_cast<double>(failedRequests) / iterations;
+        state.counters["AverageLatencyUs"] = totalLatencyUs / iterations;
+        state.counters["MaxLatencyUs"] = maxLatencyUs;
+    }
+    BENCHMARK_REGISTER_F(StreamerTraceReplayBenchmark, Replay)
+        ->ArgNames({ "Stack", "TimeScale" })
+        ->Args({ 0, 0 })
+        ->Args({ 1, 0 })
+        ->Args({ 2, 0 })
+        ->Args({ 0, 1 })
+        ->Args({ 1, 1 })
+        ->Args({ 2, 1 })
+        ->Unit(::benchmark::kMillisecond)
+        ->UseRealTime();
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
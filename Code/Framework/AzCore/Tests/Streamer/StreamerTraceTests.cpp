@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+#include <Tests/FileIOBaseTestTypes.h>
+
+namespace AZ::IO
+{
+    class Streamer_StreamerTraceTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            UnitTest::LeakDetectionFixture::SetUp();
+            m_prevFileIO = FileIOBase::GetInstance();
+            FileIOBase::SetInstance(&m_fileIO);
+            m_context = AZStd::make_unique<StreamerContext>();
+        }
+
+        void TearDown() override
+        {
+            m_context.reset();
+            FileIOBase::SetInstance(m_prevFileIO);
+            UnitTest::LeakDetectionFixture::TearDown();
+        }
+
+        FileRequestPtr CreateRead(const char* path, u64 offset, u64 size, IStreamerTypes::Priority priority)
+        {
+            FileRequestPtr request = m_context->GetNewExternalRequest();
+            request->m_request.CreateReadRequest(RequestPath(AZ::IO::PathView(path)), m_buffer, sizeof(m_buffer), offset, size,
+                FileRequest::s_noDeadlineTime, priority);
+            return request;
+        }
+
+    protected:
+        AZStd::unique_ptr<StreamerContext> m_context;
+        UnitTest::TestFileIOBase m_fileIO;
+        FileIOBase* m_prevFileIO{ nullptr };
+        char m_buffer[64];
+    };
+
+    TEST_F(Streamer_StreamerTraceTest, Recorder_QueueAndCompleteReads_RecordsAreCreatedInQueueOrder)
+    {
+        StreamerTraceRecorder recorder;
+        recorder.Start();
+
+        FileRequestPtr read0 = CreateRead("TestFile0.bin", 16, 32, IStreamerTypes::s_priorityHigh);
+        FileRequestPtr read1 = CreateRead("TestFile1.bin", 0, 64, IStreamerTypes::s_priorityLow);
+        FileRequestPtr read2 = CreateRead("TestFile0.bin", 48, 8, IStreamerTypes::s_priorityMedium);
+        recorder.RecordQueued(read0->m_request);
+        recorder.RecordQueued(read1->m_request);
+        recorder.RecordQueued(read2->m_request);
+
+        read1->m_request.SetStatus(IStreamerTypes::RequestStatus::Failed);
+        recorder.RecordCompleted(read1->m_request);
+        read0->m_request.SetStatus(IStreamerTypes::RequestStatus::Completed);
+        recorder.RecordCompleted(read0->m_request);
+        read2->m_request.SetStatus(IStreamerTypes::RequestStatus::Completed);
+        recorder.RecordCompleted(read2->m_request);
+
+        StreamerTrace::Trace trace;
+        recorder.Stop(trace);
+        EXPECT_FALSE(recorder.IsRecording());
+
+        ASSERT_EQ(3, trace.m_records.size());
+        // Reads from the same file share the same path.
+        ASSERT_EQ(2, trace.m_paths.size());
+        EXPECT_EQ(trace.m_records[0].m_pathIndex, trace.m_records[2].m_pathIndex);
+        EXPECT_NE(trace.m_records[0].m_pathIndex, trace.m_records[1].m_pathIndex);
+
+        EXPECT_EQ(16, trace.m_records[0].m_offset);
+        EXPECT_EQ(32, trace.m_records[0].m_size);
+        EXPECT_EQ(IStreamerTypes::s_priorityHigh, trace.m_records[0].m_priority);
+        EXPECT_EQ(StreamerTrace::NoDeadline, trace.m_records[0].m_deadlineUs);
+        EXPECT_EQ(static_cast<u8>(IStreamerTypes::RequestStatus::Completed), trace.m_records[0].m_status);
+        EXPECT_EQ(static_cast<u8>(IStreamerTypes::RequestStatus::Failed), trace.m_records[1].m_status);
+        EXPECT_LE(trace.m_records[0].m_queueTimeUs, trace.m_records[1].m_queueTimeUs);
+        EXPECT_LE(trace.m_records[1].m_queueTimeUs, trace.m_records[2].m_queueTimeUs);
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, Recorder_StopWithReadInFlight_InFlightReadIsDropped)
+    {
+        StreamerTraceRecorder recorder;
+        recorder.Start();
+
+        FileRequestPtr read0 = CreateRead("TestFile0.bin", 0, 32, IStreamerTypes::s_priorityMedium);
+        FileRequestPtr read1 = CreateRead("TestFile0.bin", 32, 32, IStreamerTypes::s_priorityMedium);
+        recorder.RecordQueued(read0->m_request);
+        recorder.RecordQueued(read1->m_request);
+        read1->m_request.SetStatus(IStreamerTypes::RequestStatus::Completed);
+        recorder.RecordCompleted(read1->m_request);
+
+        StreamerTrace::Trace trace;
+        recorder.Stop(trace);
+
+        ASSERT_EQ(1, trace.m_records.size());
+        EXPECT_EQ(32, trace.m_records[0].m_offset);
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, Recorder_NotStarted_NothingIsRecorded)
+    {
+        StreamerTraceRecorder recorder;
+
+        FileRequestPtr read = CreateRead("TestFile0.bin", 0, 32, IStreamerTypes::s_priorityMedium);
+        recorder.RecordQueued(read->m_request);
+        read->m_request.SetStatus(IStreamerTypes::RequestStatus::Completed);
+        recorder.RecordCompleted(read->m_request);
+
+        StreamerTrace::Trace trace;
+        recorder.Stop(trace);
+        EXPECT_TRUE(trace.m_records.empty());
+        EXPECT_TRUE(trace.m_paths.empty());
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, SaveAndLoad_RoundTrip_TraceIsIdentical)
+    {
+        StreamerTrace::Trace trace;
+        trace.m_paths.push_back("C:/Project/Cache/pc/level.pak");
+        trace.m_paths.push_back("/project/cache/linux/textures.pak");
+        for (u32 i = 0; i < 16; ++i)
+        {
+            StreamerTrace::Record& record = trace.m_records.emplace_back();
+            record.m_queueTimeUs = i * 100;
+            record.m_durationUs = i * 10 + 5;
+            record.m_offset = i * 4096;
+            record.m_size = 4096;
+            record.m_deadlineUs = (i % 2) ? StreamerTrace::NoDeadline : i * 1000;
+            record.m_pathIndex = i % 2;
+            record.m_priority = static_cast<u8>(i * 16);
+            record.m_status = static_cast<u8>(IStreamerTypes::RequestStatus::Completed);
+        }
+
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        AZ::IO::Path tracePath = tempDirectory.GetDirectoryAsPath() / "Trace.strace";
+        ASSERT_TRUE(StreamerTrace::Save(trace, tracePath.c_str()));
+
+        StreamerTrace::Trace loaded;
+        ASSERT_TRUE(StreamerTrace::Load(loaded, tracePath.c_str()));
+        EXPECT_EQ(trace.m_paths, loaded.m_paths);
+        ASSERT_EQ(trace.m_records.size(), loaded.m_records.size());
+        EXPECT_EQ(0, memcmp(trace.m_records.data(), loaded.m_records.data(), trace.m_records.size() * sizeof(StreamerTrace::Record)));
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, Load_NotATrace_ReturnsFalse)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        AZ::IO::Path tracePath = tempDirectory.GetDirectoryAsPath() / "NotATrace.strace";
+        {
+            SystemFile file;
+            ASSERT_TRUE(file.Open(tracePath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_WRITE_ONLY));
+            const char data[] = "This is not a streamer trace.";
+            file.Write(data, sizeof(data));
+        }
+
+        StreamerTrace::Trace loaded;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(StreamerTrace::Load(loaded, tracePath.c_str()));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+} // namespace AZ::IO
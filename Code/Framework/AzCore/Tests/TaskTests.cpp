@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Task/TaskGraph.h>
+#include <AzCore/Task/TaskGraphAlgorithms.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
@@ -624,6 +625,216 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphTestFixture, RetainedGraph_UpdateTask_NewPayloadUsedOnResubmit)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph{ "UpdateTask" };
+        auto a = graph.AddTask(defaultTD, [&] { x = 1; });
+        auto b = graph.AddTask(defaultTD, [&] { x *= 3; });
+        a.Precedes(b);
+
+        TaskGraphEvent ev1{ "ev1" };
+        graph.SubmitOnExecutor(*m_executor, &ev1);
+        ev1.Wait();
+        EXPECT_EQ(3, x);
+
+        graph.UpdateTask(a, [&] { x = 5; });
+
+        TaskGraphEvent ev2{ "ev2" };
+        graph.SubmitOnExecutor(*m_executor, &ev2);
+        ev2.Wait();
+        EXPECT_EQ(15, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, DataParallelTask_PatchedCount_OnlyActiveInstancesRun)
+    {
+        constexpr uint32_t maxInstances = 16;
+        AZStd::atomic<uint32_t> instanceMask = 0;
+        AZStd::atomic<uint32_t> reportedCount = 0;
+        AZStd::atomic<int> order = 0;
+
+        TaskGraph graph{ "DataParallel" };
+        auto before = graph.AddTask(defaultTD, [&] { order = 1; });
+        auto parallel = graph.AddDataParallelTask(
+            defaultTD, maxInstances,
+            [&instanceMask, &reportedCount, &order](uint32_t index, uint32_t count)
+            {
+                EXPECT_EQ(1, order.load());
+                instanceMask |= 1u << index;
+                reportedCount = count;
+            });
+        auto after = graph.AddTask(defaultTD, [&] { order = 2; });
+        before.Precedes(parallel);
+        parallel.Precedes(after);
+
+        TaskGraphEvent ev1{ "ev1" };
+        graph.SubmitOnExecutor(*m_executor, &ev1);
+        ev1.Wait();
+        EXPECT_EQ(0xffffu, instanceMask.load());
+        EXPECT_EQ(maxInstances, reportedCount.load());
+        EXPECT_EQ(2, order.load());
+
+        instanceMask = 0;
+        graph.SetDataParallelCount(parallel, 3);
+
+        TaskGraphEvent ev2{ "ev2" };
+        graph.SubmitOnExecutor(*m_executor, &ev2);
+        ev2.Wait();
+        EXPECT_EQ(0b111u, instanceMask.load());
+        EXPECT_EQ(3u, reportedCount.load());
+        EXPECT_EQ(2, order.load());
+    }
+
+    TEST_F(TaskGraphTestFixture, ParallelFor_VisitsEveryIndexOnce)
+    {
+        constexpr size_t count = 10000;
+        AZStd::vector<AZStd::atomic<int>> visits(count);
+        AZStd::atomic<int> order = 0;
+
+        TaskGraph graph{ "ParallelFor" };
+        auto before = graph.AddTask(defaultTD, [&] { order = 1; });
+        auto loop = AZ::parallel_for(graph, defaultTD, 0, count,
+            [&visits, &order](size_t index)
+            {
+                EXPECT_EQ(1, order.load());
+                ++visits[index];
+            });
+        auto after = graph.AddTask(defaultTD, [&] { order = 2; });
+        before.Precedes(loop);
+        loop.Precedes(after);
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(2, order.load());
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_EQ(1, visits[i].load());
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, ParallelFor_EmptyRange_DoesNothing)
+    {
+        AZStd::atomic<int> calls = 0;
+        TaskGraph graph{ "ParallelForEmpty" };
+        AZ::parallel_for(graph, defaultTD, 5, 5, [&calls](size_t) { ++calls; });
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+        EXPECT_EQ(0, calls.load());
+    }
+
+    TEST_F(TaskGraphTestFixture, ParallelReduce_SumsRange)
+    {
+        constexpr size_t count = 12345;
+        uint64_t sum = 0;
+
+        TaskGraph graph{ "ParallelReduce" };
+        AZ::parallel_reduce(graph, defaultTD, 0, count, uint64_t{ 0 },
+            [](size_t sliceBegin, size_t sliceEnd, uint64_t partial)
+            {
+                for (size_t i = sliceBegin; i != sliceEnd; ++i)
+                {
+                    partial += i;
+                }
+                return partial;
+            },
+            [](uint64_t lhs, uint64_t rhs) { return lhs + rhs; },
+            sum, 16);
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+        EXPECT_EQ(static_cast<uint64_t>(count) * (count - 1) / 2, sum);
+    }
+
+    TEST_F(TaskGraphTestFixture, ParallelInclusiveScan_MatchesSerialScan)
+    {
+        constexpr size_t count = 5000;
+        AZStd::vector<int> input(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            input[i] = static_cast<int>(i % 7) - 3;
+        }
+        AZStd::vector<int> output(count, 0);
+
+        TaskGraph graph{ "ParallelScan" };
+        AZ::parallel_inclusive_scan(graph, defaultTD, input.begin(), input.end(), output.begin(), 0,
+            [](int lhs, int rhs) { return lhs + rhs; }, 64);
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        int running = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            running += input[i];
+            EXPECT_EQ(running, output[i]);
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, PreferCurrentWorker_WideGraph_AllTasksExecuted)
+    {
+        constexpr int fanOut = 256;
+        TaskDescriptor localTD = defaultTD;
+        localTD.preferCurrentWorker = true;
+
+        AZStd::atomic<int> x = 0;
+        TaskGraph graph{ "PreferCurrentWorker" };
+        auto root = graph.AddTask(defaultTD, [&] { x = 1; });
+        auto join = graph.AddTask(localTD, [&] { x += 1; });
+        for (int i = 0; i < fanOut; ++i)
+        {
+            auto inner = graph.AddTask(localTD, [&] { x += 2; });
+            root.Precedes(inner);
+            inner.Precedes(join);
+        }
+
+        AZ::TaskWorkerStats before;
+        for (uint32_t i = 0; i < m_executor->GetWorkerCount(); ++i)
+        {
+            before.m_tasksExecuted += m_executor->GetWorkerStats(i).m_tasksExecuted;
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(2 + 2 * fanOut, x);
+
+        uint64_t executed = 0;
+        for (uint32_t i = 0; i < m_executor->GetWorkerCount(); ++i)
+        {
+            executed += m_executor->GetWorkerStats(i).m_tasksExecuted;
+        }
+        EXPECT_EQ(static_cast<uint64_t>(fanOut + 2), executed - before.m_tasksExecuted);
+    }
+
+    TEST_F(TaskGraphTestFixture, StandaloneTask_ResubmittedAfterInvocation)
+    {
+        constexpr int submissions = 64;
+
+        AZStd::atomic<int> x = 0;
+        AZStd::binary_semaphore invoked;
+        Task task(defaultTD, [&]
+            {
+                ++x;
+                invoked.release();
+            });
+
+        for (int i = 0; i < submissions; ++i)
+        {
+            m_executor->Submit(task);
+            invoked.acquire();
+        }
+
+        EXPECT_EQ(submissions, x);
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Time/TimingWheel.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // Mimics connection and packet timeouts, most timers are refreshed or cancelled long before they expire
+    static constexpr int64_t TimerDurationMs = 1000;
+    static constexpr int64_t FrameTimeMs = 16;
+
+    struct HeapTimer
+    {
+        int64_t m_expireTimeMs;
+        uint32_t m_timerId;
+
+        bool operator <(const HeapTimer& rhs) const
+        {
+            return rhs.m_expireTimeMs < m_expireTimeMs;
+        }
+    };
+
+    // Baseline, the priority queue with lazy removal that TimeoutQueue and EventSchedulerSystemComponent used
+    static void BM_TimerHeap_ScheduleCancelExpire(benchmark::State& state)
+    {
+        const uint32_t timerCount = aznumeric_cast<uint32_t>(state.range(0));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::priority_queue<HeapTimer> heap;
+            AZStd::unordered_set<uint32_t> cancelledTimers;
+            int64_t currentTimeMs = 0;
+            uint32_t expiredCount = 0;
+            for (uint32_t frame = 0; frame < 64; ++frame)
+            {
+                for (uint32_t i = 0; i < timerCount; ++i)
+                {
+                    const uint32_t timerId = frame * timerCount + i;
+                    heap.push(HeapTimer{ currentTimeMs + TimerDurationMs + (i % 64), timerId });
+                    if ((i & 1) != 0)
+                    {
+                        cancelledTimers.insert(timerId);
+                    }
+                }
+                currentTimeMs += FrameTimeMs;
+                while (!heap.empty() && heap.top().m_expireTimeMs <= currentTimeMs)
+                {
+                    expiredCount += cancelledTimers.erase(heap.top().m_timerId) == 0 ? 1 : 0;
+                    heap.pop();
+                }
+            }
+            benchmark::DoNotOptimize(expiredCount);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * 64);
+    }
+    BENCHMARK(BM_TimerHeap_ScheduleCancelExpire)->Arg(1000)->Arg(10000);
+
+    static void BM_TimingWheel_ScheduleCancelExpire(benchmark::State& state)
+    {
+        const uint32_t timerCount = aznumeric_cast<uint32_t>(state.range(0));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::TimingWheel<uint32_t> wheel;
+            int64_t currentTimeMs = 0;
+            uint32_t expiredCount = 0;
+            for (uint32_t frame = 0; frame < 64; ++frame)
+            {
+                for (uint32_t i = 0; i < timerCount; ++i)
+                {
+                    const uint32_t timerId = frame * timerCount + i;
+                    const auto handle = wheel.Insert(AZ::TimeMs{ currentTimeMs + TimerDurationMs + (i % 64) }, timerId);
+                    if ((i & 1) != 0)
+                    {
+                        wheel.Remove(handle);
+                    }
+                }
+                currentTimeMs += FrameTimeMs;
+                wheel.Advance(AZ::TimeMs{ currentTimeMs });
+                uint32_t timerId = 0;
+                while (wheel.PopExpired(timerId))
+                {
+                    ++expiredCount;
+                }
+            }
+            benchmark::DoNotOptimize(expiredCount);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * 64);
+    }
+    BENCHMARK(BM_TimingWheel_ScheduleCancelExpire)->Arg(1000)->Arg(10000);
+
+    static void BM_TimerHeap_Reschedule(benchmark::State& state)
+    {
+        const uint32_t timerCount = aznumeric_cast<uint32_t>(state.range(0));
+        AZStd::priority_queue<HeapTimer> heap;
+        AZStd::vector<int64_t> expireTimes(timerCount);
+        for (uint32_t i = 0; i < timerCount; ++i)
+        {
+            expireTimes[i] = TimerDurationMs;
+            heap.push(HeapTimer{ expireTimes[i], i });
+        }
+
+        int64_t currentTimeMs = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // Every timer is refreshed each frame, stale heap entries are skipped when they reach the top
+            currentTimeMs += FrameTimeMs;
+            for (uint32_t i = 0; i < timerCount; ++i)
+            {
+                expireTimes[i] = currentTimeMs + TimerDurationMs;
+                heap.push(HeapTimer{ expireTimes[i], i });
+            }
+            while (!heap.empty() && heap.top().m_expireTimeMs <= currentTimeMs)
+            {
+                heap.pop();
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_TimerHeap_Reschedule)->Arg(1000)->Arg(10000);
+
+    static void BM_TimingWheel_Reschedule(benchmark::State& state)
+    {
+        const uint32_t timerCount = aznumeric_cast<uint32_t>(state.range(0));
+        AZ::TimingWheel<uint32_t> wheel;
+        AZStd::vector<AZ::TimingWheel<uint32_t>::Handle> handles(timerCount);
+        for (uint32_t i = 0; i < timerCount; ++i)
+        {
+            handles[i] = wheel.Insert(AZ::TimeMs{ TimerDurationMs }, i);
+        }
+
+        int64_t currentTimeMs = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            currentTimeMs += FrameTimeMs;
+            for (uint32_t i = 0; i < timerCount; ++i)
+            {
+                wheel.Remove(handles[i]);
+                handles[i] = wheel.Insert(AZ::TimeMs{ currentTimeMs + TimerDurationMs }, i);
+            }
+            wheel.Advance(AZ::TimeMs{ currentTimeMs });
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_TimingWheel_Reschedule)->Arg(1000)->Arg(10000);
+}
+
+#endif
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Time/TimingWheel.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using TestTimingWheel = AZ::TimingWheel<uint32_t>;
+
+    class TimingWheelTests
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(TimingWheelTests, TestExpiresAtExpireTime)
+    {
+        TestTimingWheel wheel;
+        wheel.Insert(AZ::TimeMs{ 10 }, 1);
+        EXPECT_EQ(wheel.GetSize(), 1);
+
+        uint32_t value = 0;
+        wheel.Advance(AZ::TimeMs{ 9 });
+        EXPECT_FALSE(wheel.PopExpired(value));
+
+        wheel.Advance(AZ::TimeMs{ 10 });
+        EXPECT_TRUE(wheel.PopExpired(value));
+        EXPECT_EQ(value, 1);
+        EXPECT_TRUE(wheel.IsEmpty());
+    }
+
+    TEST_F(TimingWheelTests, TestInsertExpiredItem)
+    {
+        TestTimingWheel wheel;
+        wheel.Advance(AZ::TimeMs{ 100 });
+        wheel.Insert(AZ::TimeMs{ 50 }, 1);
+        EXPECT_TRUE(wheel.HasExpired());
+
+        uint32_t value = 0;
+        EXPECT_TRUE(wheel.PopExpired(value));
+        EXPECT_EQ(value, 1);
+    }
+
+    TEST_F(TimingWheelTests, TestExpiresInOrderAcrossLevels)
+    {
+        TestTimingWheel wheel;
+        const AZ::TimeMs expireTimes[] = { AZ::TimeMs{ 5000000 }, AZ::TimeMs{ 70000 }, AZ::TimeMs{ 300 }, AZ::TimeMs{ 20000000 }, AZ::TimeMs{ 3 } };
+        for (uint32_t i = 0; i < AZ_ARRAY_SIZE(expireTimes); ++i)
+        {
+            wheel.Insert(expireTimes[i], i);
+        }
+
+        // Advance in uneven steps so both the skipping of empty slots and the cascading between levels are exercised
+        AZStd::vector<uint32_t> expiredOrder;
+        for (AZ::TimeMs currentTimeMs = AZ::TimeMs{ 0 }; currentTimeMs <= AZ::TimeMs{ 20000000 }; currentTimeMs += AZ::TimeMs{ 997 })
+        {
+            wheel.Advance(currentTimeMs);
+            uint32_t value = 0;
+            while (wheel.PopExpired(value))
+            {
+                EXPECT_LE(expireTimes[value], currentTimeMs);
+                EXPECT_GT(expireTimes[value], currentTimeMs - AZ::TimeMs{ 997 });
+                expiredOrder.push_back(value);
+            }
+        }
+        wheel.Advance(AZ::TimeMs{ 20000000 });
+        uint32_t value = 0;
+        while (wheel.PopExpired(value))
+        {
+            expiredOrder.push_back(value);
+        }
+
+        const AZStd::vector<uint32_t> expectedOrder = { 4, 2, 1, 0, 3 };
+        EXPECT_EQ(expiredOrder, expectedOrder);
+        EXPECT_TRUE(wheel.IsEmpty());
+    }
+
+    TEST_F(TimingWheelTests, TestBeyondRange)
+    {
+        TestTimingWheel wheel;
+        const AZ::TimeMs expireTimeMs = AZ::TimeMs{ int64_t{ 1 } << 34 };
+        wheel.Insert(expireTimeMs, 1);
+
+        uint32_t value = 0;
+        wheel.Advance(expireTimeMs - AZ::TimeMs{ 1 });
+        EXPECT_FALSE(wheel.PopExpired(value));
+        wheel.Advance(expireTimeMs);
+        EXPECT_TRUE(wheel.PopExpired(value));
+    }
+
+    TEST_F(TimingWheelTests, TestRemove)
+    {
+        TestTimingWheel wheel;
+        const TestTimingWheel::Handle first = wheel.Insert(AZ::TimeMs{ 10 }, 1);
+        const TestTimingWheel::Handle second = wheel.Insert(AZ::TimeMs{ 100000 }, 2);
+        wheel.Insert(AZ::TimeMs{ 10 }, 3);
+
+        EXPECT_TRUE(wheel.Remove(first));
+        EXPECT_FALSE(wheel.Remove(first));
+        EXPECT_EQ(wheel.Find(first), nullptr);
+        EXPECT_EQ(*wheel.Find(second), 2);
+        EXPECT_TRUE(wheel.Remove(second));
+        EXPECT_EQ(wheel.GetSize(), 1);
+
+        // Reusing the entry of a removed timer must not revive its handle
+        const TestTimingWheel::Handle fourth = wheel.Insert(AZ::TimeMs{ 20 }, 4);
+        EXPECT_NE(fourth, first);
+        EXPECT_FALSE(wheel.Remove(first));
+
+        uint32_t value = 0;
+        wheel.Advance(AZ::TimeMs{ 100000 });
+        EXPECT_TRUE(wheel.PopExpired(value));
+        EXPECT_EQ(value, 3);
+        EXPECT_TRUE(wheel.PopExpired(value));
+        EXPECT_EQ(value, 4);
+        EXPECT_FALSE(wheel.PopExpired(value));
+    }
+
+    TEST_F(TimingWheelTests, TestRemoveExpired)
+    {
+        TestTimingWheel wheel;
+        const TestTimingWheel::Handle handle = wheel.Insert(AZ::TimeMs{ 10 }, 1);
+        wheel.Advance(AZ::TimeMs{ 20 });
+        EXPECT_TRUE(wheel.HasExpired());
+        EXPECT_TRUE(wheel.Remove(handle));
+        EXPECT_FALSE(wheel.HasExpired());
+    }
+
+    TEST_F(TimingWheelTests, TestReset)
+    {
+        TestTimingWheel wheel;
+        const TestTimingWheel::Handle handle = wheel.Insert(AZ::TimeMs{ 10 }, 1);
+        wheel.Reset(AZ::TimeMs{ 1000 });
+        EXPECT_TRUE(wheel.IsEmpty());
+        EXPECT_EQ(wheel.GetCurrentTimeMs(), AZ::TimeMs{ 1000 });
+        EXPECT_FALSE(wheel.Remove(handle));
+    }
+}
@@ -31,6 +31,7 @@ set(FILES
     AZStd/DequeAndSimilar.cpp
     AZStd/Examples.cpp
     AZStd/ExpectedTests.cpp
+    AZStd/FlatHashed.cpp
     AZStd/FunctionalBasic.cpp
     AZStd/FunctorsBind.cpp
     AZStd/Hashed.cpp
@@ -91,6 +92,7 @@ set(FILES
     DOM/DomValueBenchmarks.cpp
     DOM/DomPrefixTreeTests.cpp
     DOM/DomPrefixTreeBenchmarks.cpp
+    EBus/EBusReadMostlyDispatchMutexTests.cpp
     EBus/EBusSharedDispatchMutexTests.cpp
     EBus/ScheduledEventTests.cpp
     EBus.cpp
@@ -101,7 +103,9 @@ set(FILES
     FileIOBaseTestTypes.h
     Geometry2DUtils.cpp
     Interface.cpp
+    IO/CompressorZStdTests.cpp
     IO/FileReaderTests.cpp
+    IO/MappedFileTests.cpp
     IO/Path/PathReflectTests.cpp
     IO/Path/PathTests.cpp
     IPC.cpp
@@ -123,6 +127,8 @@ set(FILES
     Math/IntersectionTestHelpers.cpp
     Math/IntersectionTestHelpers.h
     Math/IntersectionTests.cpp
+    Math/MathBatchPerformanceTests.cpp
+    Math/MathBatchTests.cpp
     Math/MathIntrinsicsTests.cpp
     Math/IntersectPointTest.cpp
     Math/MathStringsTests.cpp
@@ -160,9 +166,11 @@ set(FILES
     Math/Vector4PerformanceTests.cpp
     Math/Vector4Tests.cpp
     Memory/AllocatorBenchmarks.cpp
+    Memory/FrameArenaAllocator.cpp
     Memory/HphaAllocator.cpp
     Memory/HphaAllocatorErrorDetection.cpp
     Memory/LeakDetection.cpp
+    Memory/OSMemory.cpp
     Memory.cpp
     Metrics/EventLoggerFactoryTests.cpp
     Metrics/EventLoggerReflectUtilsTests.cpp
@@ -176,12 +184,14 @@ set(FILES
     OrderedEventBenchmarks.cpp
     OrderedEventTests.cpp
     OutcomeTests.cpp
+    ParallelTickTests.cpp
     Patching.cpp
     RemappableId.cpp
     RTTI/IsTypeofBenchmarks.cpp
     RTTI/TypeSafeIntegralTests.cpp
     Rtti.cpp
     Script.cpp
+    ScriptBenchmarks.cpp
     ScriptMath.cpp
     Serialization/Json/ArraySerializerTests.cpp
     Serialization/Json/AnySerializerTests.cpp
@@ -224,6 +234,8 @@ set(FILES
     Serialization/Json/UnorderedSetSerializerTests.cpp
     Serialization/Json/UnsupportedTypesSerializerTests.cpp
     Serialization/Json/UuidSerializerTests.cpp
+    Serialization/InPlaceDataTests.cpp
+    Serialization/SerializationBenchmarks.cpp
     Serialization.cpp
     SerializeContextFixture.h
     Settings/CommandLineTests.cpp
@@ -243,6 +255,7 @@ set(FILES
     StatisticalProfilerHelpers.h
     StatisticalProfilerTests.cpp
     Streamer/BlockCacheTests.cpp
+    Streamer/ChunkedDecompressorTests.cpp
     Streamer/DedicatedCacheTests.cpp
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
@@ -252,6 +265,8 @@ set(FILES
     Streamer/StreamStackEntryConformityTests.h
     Streamer/StreamStackEntryMock.h
     Streamer/StreamStackEntryTests.cpp
+    Streamer/StreamerTraceBenchmarks.cpp
+    Streamer/StreamerTraceTests.cpp
     StreamerTests.cpp
     StringFunc.cpp
     SystemFileTest.cpp
@@ -259,6 +274,8 @@ set(FILES
     TaskTests.cpp
     TickBusTest.cpp
     Time/TimeTests.cpp
+    Time/TimingWheelBenchmarks.cpp
+    Time/TimingWheelTests.cpp
     UUIDTests.cpp
     XML.cpp
 )
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Archetype/ArchetypeStorage.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace AzFramework
+{
+    ArchetypeStorage::ArchetypeStorage()
+    {
+        // The root archetype, the starting point of the transitions of entities that have no data yet
+        m_archetypes.emplace_back();
+    }
+
+    ArchetypeStorage::~ArchetypeStorage()
+    {
+        for (Archetype& archetype : m_archetypes)
+        {
+            while (archetype.m_entityCount > 0)
+            {
+                FreeRow(aznumeric_cast<uint32_t>(&archetype - m_archetypes.data()), archetype.m_entityCount - 1);
+            }
+        }
+    }
+
+    ArchetypeDataTypeIndex ArchetypeStorage::RegisterDataType(const ArchetypeDataType& dataType)
+    {
+        if (const auto iter = m_dataTypeIndices.find(dataType.m_typeId); iter != m_dataTypeIndices.end())
+        {
+            return iter->second;
+        }
+
+        const ArchetypeDataTypeIndex dataTypeIndex = aznumeric_cast<ArchetypeDataTypeIndex>(m_dataTypes.size());
+        m_dataTypes.push_back(dataType);
+        m_dataTypeIndices.emplace(dataType.m_typeId, dataTypeIndex);
+        return dataTypeIndex;
+    }
+
+    ArchetypeDataTypeIndex ArchetypeStorage::FindDataTypeIndex(const AZ::TypeId& typeId) const
+    {
+        const auto iter = m_dataTypeIndices.find(typeId);
+        return (iter != m_dataTypeIndices.end()) ? iter->second : InvalidArchetypeDataTypeIndex;
+    }
+
+    void* ArchetypeStorage::AddData(AZ::EntityId entityId, ArchetypeDataTypeIndex dataTypeIndex)
+    {
+        AZ_Assert(m_iterationDepth == 0, "Data can't be added while iterating the archetype storage");
+        AZ_Assert(dataTypeIndex < m_dataTypes.size(), "Invalid archetype data type index %u", dataTypeIndex);
+
+        EntityLocation& location = m_entityLocations[entityId];
+        if (FindColumn(m_archetypes[location.m_archetypeIndex], dataTypeIndex) >= 0)
+        {
+            return nullptr;
+        }
+
+        MoveEntity(entityId, location, GetAddTransition(location.m_archetypeIndex, dataTypeIndex));
+        Archetype& archetype = m_archetypes[location.m_archetypeIndex];
+        return GetColumnData(archetype, aznumeric_cast<uint32_t>(FindColumn(archetype, dataTypeIndex)), location.m_row);
+    }
+
+    bool ArchetypeStorage::RemoveData(AZ::EntityId entityId, ArchetypeDataTypeIndex dataTypeIndex)
+    {
+        AZ_Assert(m_iterationDepth == 0, "Data can't be removed while iterating the archetype storage");
+
+        const auto iter = m_entityLocations.find(entityId);
+        if (iter == m_entityLocations.end() || FindColumn(m_archetypes[iter->second.m_archetypeIndex], dataTypeIndex) < 0)
+        {
+            return false;
+        }
+
+        MoveEntity(entityId, iter->second, GetRemoveTransition(iter->second.m_archetypeIndex, dataTypeIndex));
+        if (iter->second.m_archetypeIndex == 0)
+        {
+            m_entityLocations.erase(iter);
+        }
+        return true;
+    }
+
+    void* ArchetypeStorage::FindData(AZ::EntityId entityId, ArchetypeDataTypeIndex dataTypeIndex)
+    {
+        const auto iter = m_entityLocations.find(entityId);
+        if (iter == m_entityLocations.end())
+        {
+            return nullptr;
+        }
+
+        Archetype& archetype = m_archetypes[iter->second.m_archetypeIndex];
+        const int32_t column = FindColumn(archetype, dataTypeIndex);
+        return (column >= 0) ? GetColumnData(archetype, aznumeric_cast<uint32_t>(column), iter->second.m_row) : nullptr;
+    }
+
+    void ArchetypeStorage::RemoveEntity(AZ::EntityId entityId)
+    {
+        AZ_Assert(m_iterationDepth == 0, "Entities can't be removed while iterating the archetype storage");
+
+        const auto iter = m_entityLocations.find(entityId);
+        if (iter != m_entityLocations.end())
+        {
+            FreeRow(iter->second.m_archetypeIndex, iter->second.m_row);
+            m_entityLocations.erase(iter);
+        }
+    }
+
+    bool ArchetypeStorage::HasEntity(AZ::EntityId entityId) const
+    {
+        return m_entityLocations.find(entityId) != m_entityLocations.end();
+    }
+
+    uint32_t ArchetypeStorage::GetEntityCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_entityLocations.size());
+    }
+
+    uint32_t ArchetypeStorage::GetArchetypeCount() const
+    {
+        // The root archetype never stores any entities
+        return aznumeric_cast<uint32_t>(m_archetypes.size() - 1);
+    }
+
+    int32_t ArchetypeStorage::FindColumn(const Archetype& archetype, ArchetypeDataTypeIndex dataTypeIndex) const
+    {
+        const auto iter = AZStd::lower_bound(archetype.m_dataTypes.begin(), archetype.m_dataTypes.end(), dataTypeIndex);
+        return (iter != archetype.m_dataTypes.end() && *iter == dataTypeIndex)
+            ? aznumeric_cast<int32_t>(iter - archetype.m_dataTypes.begin())
+            : -1;
+    }
+
+    void* ArchetypeStorage::GetColumnData(Archetype& archetype, uint32_t column, uint32_t row) const
+    {
+        const uint32_t chunk = row / archetype.m_chunkCapacity;
+        const uint32_t chunkRow = row % archetype.m_chunkCapacity;
+        const size_t size = m_dataTypes[archetype.m_dataTypes[column]].m_size;
+        return archetype.m_chunks[chunk] + archetype.m_columnOffsets[column] + chunkRow * size;
+    }
+
+    AZ::EntityId* ArchetypeStorage::GetEntityIds(Archetype& archetype, uint32_t chunk) const
+    {
+        // The entity ids are the first array of every chunk
+        return reinterpret_cast<AZ::EntityId*>(archetype.m_chunks[chunk]);
+    }
+
+    uint32_t ArchetypeStorage::FindOrCreateArchetype(AZStd::vector<ArchetypeDataTypeIndex> dataTypes)
+    {
+        AZStd::sort(dataTypes.begin(), dataTypes.end());
+        for (uint32_t archetypeIndex = 0; archetypeIndex < m_archetypes.size(); ++archetypeIndex)
+        {
+            if (m_archetypes[archetypeIndex].m_dataTypes == dataTypes)
+            {
+                return archetypeIndex;
+            }
+        }
+
+        Archetype archetype;
+        archetype.m_dataTypes = AZStd::move(dataTypes);
+        archetype.m_columnOffsets.resize(archetype.m_dataTypes.size());
+
+        size_t rowSize = sizeof(AZ::EntityId);
+        archetype.m_chunkAlignment = alignof(AZ::EntityId);
+        for (const ArchetypeDataTypeIndex dataTypeIndex : archetype.m_dataTypes)
+        {
+            rowSize += m_dataTypes[dataTypeIndex].m_size;
+            archetype.m_chunkAlignment = AZStd::max(archetype.m_chunkAlignment, m_dataTypes[dataTypeIndex].m_alignment);
+        }
+
+        // Find the largest capacity for which the arrays and their alignment padding still fit in a chunk
+        const auto computeLayout = [this, &archetype](uint32_t capacity)
+        {
+            size_t offset = capacity * sizeof(AZ::EntityId);
+            for (size_t column = 0; column < archetype.m_dataTypes.size(); ++column)
+            {
+                const ArchetypeDataType& dataType = m_dataTypes[archetype.m_dataTypes[column]];
+                offset = AZ::SizeAlignUp(offset, dataType.m_alignment);
+                archetype.m_columnOffsets[column] = offset;
+                offset += capacity * dataType.m_size;
+            }
+            return offset;
+        };
+
+        uint32_t capacity = AZStd::max<uint32_t>(aznumeric_cast<uint32_t>(ChunkSizeBytes / rowSize), 1);
+        while (capacity > 1 && computeLayout(capacity) > ChunkSizeBytes)
+        {
+            --capacity;
+        }
+        archetype.m_chunkCapacity = capacity;
+        archetype.m_chunkSizeBytes = computeLayout(capacity);
+
+        m_archetypes.push_back(AZStd::move(archetype));
+        return aznumeric_cast<uint32_t>(m_archetypes.size() - 1);
+    }
+
+    uint32_t ArchetypeStorage::GetAddTransition(uint32_t archetypeIndex, ArchetypeDataTypeIndex dataTypeIndex)
+    {
+        if (const auto iter = m_archetypes[archetypeIndex].m_addTransitions.find(dataTypeIndex);
+            iter != m_archetypes[archetypeIndex].m_addTransitions.end())
+        {
+            return iter->second;
+        }
+
+        AZStd::vector<ArchetypeDataTypeIndex> dataTypes = m_archetypes[archetypeIndex].m_dataTypes;
+        dataTypes.push_back(dataTypeIndex);
+        const uint32_t targetArchetypeIndex = FindOrCreateArchetype(AZStd::move(dataTypes));
+        m_archetypes[archetypeIndex].m_addTransitions.emplace(dataTypeIndex, targetArchetypeIndex);
+        m_archetypes[targetArchetypeIndex].m_removeTransitions.emplace(dataTypeIndex, archetypeIndex);
+        return targetArchetypeIndex;
+    }
+
+    uint32_t ArchetypeStorage::GetRemoveTransition(uint32_t archetypeIndex, ArchetypeDataTypeIndex dataTypeIndex)
+    {
+        if (const auto iter = m_archetypes[archetypeIndex].m_removeTransitions.find(dataTypeIndex);
+            iter != m_archetypes[archetypeIndex].m_removeTransitions.end())
+        {
+            return iter->second;
+        }
+
+        AZStd::vector<ArchetypeDataTypeIndex> dataTypes = m_archetypes[archetypeIndex].m_dataTypes;
+        dataTypes.erase(AZStd::find(dataTypes.begin(), dataTypes.end(), dataTypeIndex));
+        const uint32_t targetArchetypeIndex = FindOrCreateArchetype(AZStd::move(dataTypes));
+        m_archetypes[archetypeIndex].m_removeTransitions.emplace(dataTypeIndex, targetArchetypeIndex);
+        m_archetypes[targetArchetypeIndex].m_addTransitions.emplace(dataTypeIndex, archetypeIndex);
+        return targetArchetypeIndex;
+    }
+
+    uint32_t ArchetypeStorage::AllocateRow(uint32_t archetypeIndex, AZ::EntityId entityId)
+    {
+        Archetype& archetype = m_archetypes[archetypeIndex];
+        const uint32_t row = archetype.m_entityCount++;
+        const uint32_t chunk = row / archetype.m_chunkCapacity;
+        if (chunk == archetype.m_chunks.size())
+        {
+            archetype.m_chunks.push_back(static_cast<AZStd::byte*>(azmalloc(archetype.m_chunkSizeBytes, archetype.m_chunkAlignment)));
+        }
+        GetEntityIds(archetype, chunk)[row % archetype.m_chunkCapacity] = entityId;
+        return row;
+    }
+
+    void ArchetypeStorage::FreeRow(uint32_t archetypeIndex, uint32_t row)
+    {
+        Archetype& archetype = m_archetypes[archetypeIndex];
+        const uint32_t lastRow = archetype.m_entityCount - 1;
+        for (uint32_t column = 0; column < archetype.m_dataTypes.size(); ++column)
+        {
+            const ArchetypeDataType& dataType = m_dataTypes[archetype.m_dataTypes[column]];
+            void* data = GetColumnData(archetype, column, row);
+            dataType.m_destruct(data);
+            if (row != lastRow)
+            {
+                void* lastData = GetColumnData(archetype, column, lastRow);
+                dataType.m_moveConstruct(data, lastData);
+                dataType.m_destruct(lastData);
+            }
+        }
+
+        if (row != lastRow)
+        {
+            // Keep the rows dense, so that every chunk but the last one is full
+            const AZ::EntityId movedEntityId = GetEntityIds(archetype, lastRow / archetype.m_chunkCapacity)[lastRow % archetype.m_chunkCapacity];
+            GetEntityIds(archetype, row / archetype.m_chunkCapacity)[row % archetype.m_chunkCapacity] = movedEntityId;
+            m_entityLocations[movedEntityId].m_row = row;
+        }
+
+        --archetype.m_entityCount;
+        if (archetype.m_entityCount % archetype.m_chunkCapacity == 0)
+        {
+            azfree(archetype.m_chunks.back());
+            archetype.m_chunks.pop_back();
+        }
+    }
+
+    void ArchetypeStorage::MoveEntity(AZ::EntityId entityId, EntityLocation& location, uint32_t targetArchetypeIndex)
+    {
+        const uint32_t sourceArchetypeIndex = location.m_archetypeIndex;
+        const uint32_t sourceRow = location.m_row;
+
+        if (targetArchetypeIndex != 0)
+        {
+            const uint32_t targetRow = AllocateRow(targetArchetypeIndex, entityId);
+            Archetype& sourceArchetype = m_archetypes[sourceArchetypeIndex];
+            Archetype& targetArchetype = m_archetypes[targetArchetypeIndex];
+            for (uint32_t targetColumn = 0; targetColumn < targetArchetype.m_dataTypes.size(); ++targetColumn)
+            {
+                const ArchetypeDataTypeIndex dataTypeIndex = targetArchetype.m_dataTypes[targetColumn];
+                const int32_t sourceColumn = FindColumn(sourceArchetype, dataTypeIndex);
+                if (sourceColumn >= 0)
+                {
+                    m_dataTypes[dataTypeIndex].m_moveConstruct(
+                        GetColumnData(targetArchetype, targetColumn, targetRow),
+                        GetColumnData(sourceArchetype, aznumeric_cast<uint32_t>(sourceColumn), sourceRow));
+                }
+            }
+            location.m_archetypeIndex = targetArchetypeIndex;
+            location.m_row = targetRow;
+        }
+        else
+        {
+            location.m_archetypeIndex = 0;
+            location.m_row = 0;
+        }
+
+        // Every data type of the source row was moved from or isn't kept, either way it's destructed here
+        if (sourceArchetypeIndex != 0)
+        {
+            FreeRow(sourceArchetypeIndex, sourceRow);
+        }
+    }
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
+
+namespace AzFramework
+{
+    using ArchetypeDataTypeIndex = uint32_t;
+    static constexpr ArchetypeDataTypeIndex InvalidArchetypeDataTypeIndex = ~0u;
+
+    //! Type erased description of a data type that can be stored in an ArchetypeStorage.
+    struct ArchetypeDataType
+    {
+        template <typename DATA_TYPE>
+        static ArchetypeDataType Create();
+
+        AZ::TypeId m_typeId;
+        const char* m_name = nullptr;
+        size_t m_size = 0;
+        size_t m_alignment = 0;
+        void (*m_moveConstruct)(void* destination, void* source) = nullptr;
+        void (*m_destruct)(void* data) = nullptr;
+    };
+
+    //! @class ArchetypeStorage
+    //! @brief Stores the hot data of entities in contiguous per-type arrays.
+    //! Entities are grouped by archetype, the set of data types they have. Each archetype stores its entities in fixed
+    //! size chunks, and each chunk stores one contiguous array per data type, so iterating a data type over many
+    //! entities touches memory linearly instead of chasing one heap allocated component per entity.
+    //! Adding or removing a data type moves the entity to another archetype, which invalidates pointers to the data of
+    //! any entity of the two archetypes. Data should be looked up again after structural changes, and structural changes
+    //! are not allowed while iterating.
+    //! The storage is not thread safe, although the chunks returned by ForEachChunk may be processed concurrently.
+    class ArchetypeStorage
+    {
+    public:
+        AZ_RTTI(ArchetypeStorage, "{5D2B8C71-9E4A-4F36-B1D7-3A6C0E8F2B95}");
+        AZ_CLASS_ALLOCATOR(ArchetypeStorage, AZ::SystemAllocator);
+
+        //! Size of a chunk, small enough to stay in L2 while a chunk is processed.
+        static constexpr size_t ChunkSizeBytes = 16 * 1024;
+
+        ArchetypeStorage();
+        virtual ~ArchetypeStorage();
+
+        AZ_DISABLE_COPY_MOVE(ArchetypeStorage);
+
+        //! Registers a data type, data types are identified by their AZ type id.
+        //! @return the index of the data type, registering a type again returns the same index
+        ArchetypeDataTypeIndex RegisterDataType(const ArchetypeDataType& dataType);
+        template <typename DATA_TYPE>
+        ArchetypeDataTypeIndex RegisterDataType();
+
+        //! Returns the index of a registered data type, or InvalidArchetypeDataTypeIndex.
+        ArchetypeDataTypeIndex FindDataTypeIndex(const AZ::TypeId& typeId) const;
+
+        //! Adds the data type to the entity, or assigns it if the entity already has that data type.
+        //! @return the data of the entity, valid until the next structural change
+        template <typename DATA_TYPE, typename... ARGS>
+        DATA_TYPE& EmplaceData(AZ::EntityId entityId, ARGS&&... args);
+
+        //! Removes the data type from the entity.
+        //! @return false if the entity doesn't have the data type
+        template <typename DATA_TYPE>
+        bool RemoveData(AZ::EntityId entityId);
+        bool RemoveData(AZ::EntityId entityId, ArchetypeDataTypeIndex dataTypeIndex);
+
+        //! Returns the data of the entity, valid until the next structural change, or nullptr.
+        template <typename DATA_TYPE>
+        DATA_TYPE* FindData(AZ::EntityId entityId);
+        void* FindData(AZ::EntityId entityId, ArchetypeDataTypeIndex dataTypeIndex);
+
+        //! Removes all the data of the entity.
+        void RemoveEntity(AZ::EntityId entityId);
+
+        bool HasEntity(AZ::EntityId entityId) const;
+        uint32_t GetEntityCount() const;
+        uint32_t GetArchetypeCount() const;
+
+        //! Calls the function for every chunk of every archetype that contains all of the data types.
+        //! The function is called as func(uint32_t count, const AZ::EntityId* entityIds, DATA_TYPES*... data), each
+        //! array has count elements and the arrays are parallel.
+        template <typename... DATA_TYPES, typename FUNCTION>
+        void ForEachChunk(FUNCTION&& func);
+
+        //! Calls the function as func(AZ::EntityId entityId, DATA_TYPES&... data) for every entity that has all of the
+        //! data types, chunk by chunk.
+        template <typename... DATA_TYPES, typename FUNCTION>
+        void ForEach(FUNCTION&& func);
+
+    private:
+        //! Allocates uninitialized memory for the data type, or returns nullptr if the entity already has it.
+        void* AddData(AZ::EntityId entityId, ArchetypeDataTypeIndex dataTypeIndex);
+
+        struct Archetype
+        {
+            //! Sorted, so that the same set of data types always maps to the same archetype.
+            AZStd::vector<ArchetypeDataTypeIndex> m_dataTypes;
+            //! The offset of each data type array within a chunk, parallel to m_dataTypes.
+            AZStd::vector<size_t> m_columnOffsets;
+            AZStd::vector<AZStd::byte*> m_chunks;
+            AZStd::unordered_map<ArchetypeDataTypeIndex, uint32_t> m_addTransitions;
+            AZStd::unordered_map<ArchetypeDataTypeIndex, uint32_t> m_removeTransitions;
+            size_t m_chunkSizeBytes = 0;
+            size_t m_chunkAlignment = 0;
+            uint32_t m_chunkCapacity = 0;
+            uint32_t m_entityCount = 0;
+        };
+
+        struct EntityLocation
+        {
+            uint32_t m_archetypeIndex = 0;
+            uint32_t m_row = 0;
+        };
+
+        //! Returns the column of the data type in the archetype, or -1.
+        int32_t FindColumn(const Archetype& archetype, ArchetypeDataTypeIndex dataTypeIndex) const;
+        void* GetColumnData(Archetype& archetype, uint32_t column, uint32_t row) const;
+        AZ::EntityId* GetEntityIds(Archetype& archetype, uint32_t chunk) const;
+
+        uint32_t FindOrCreateArchetype(AZStd::vector<ArchetypeDataTypeIndex> dataTypes);
+        uint32_t GetAddTransition(uint32_t archetypeIndex, ArchetypeDataTypeIndex dataTypeIndex);
+        uint32_t GetRemoveTransition(uint32_t archetypeIndex, ArchetypeDataTypeIndex dataTypeIndex);
+
+        //! Appends an uninitialized row for the entity to the archetype.
+        uint32_t AllocateRow(uint32_t archetypeIndex, AZ::EntityId entityId);
+        //! Destructs the row and moves the last row of the archetype into it.
+        void FreeRow(uint32_t archetypeIndex, uint32_t row);
+        //! Moves the entity to another archetype, data types the target archetype doesn't have are destructed.
+        void MoveEntity(AZ::EntityId entityId, EntityLocation& location, uint32_t targetArchetypeIndex);
+
+        AZStd::vector<ArchetypeDataType> m_dataTypes;
+        AZStd::unordered_map<AZ::TypeId, ArchetypeDataTypeIndex> m_dataTypeIndices;
+
+        //! Archetype 0 has no data types, entities are never stored in it.
+        AZStd::vector<Archetype> m_archetypes;
+        AZStd::unordered_map<AZ::EntityId, EntityLocation> m_entityLocations;
+        uint32_t m_iterationDepth = 0;
+    };
+
+    //! @class ArchetypeComponentData
+    //! @brief Keeps the hot data of a regular component in the archetype storage while the component is active.
+    //! The component keeps serializing, reflecting to the editor and handling EBus requests as usual. On Activate it
+    //! moves its data into the storage so that systems can iterate it contiguously with ArchetypeStorage::ForEachChunk,
+    //! and on Deactivate it moves the data back into the component.
+    template <typename DATA_TYPE>
+    class ArchetypeComponentData
+    {
+    public:
+        ArchetypeComponentData() = default;
+        ~ArchetypeComponentData();
+
+        AZ_DISABLE_COPY_MOVE(ArchetypeComponentData);
+
+        //! Moves the data into the storage.
+        void Attach(AZ::EntityId entityId, DATA_TYPE& data);
+
+        //! Moves the data back out of the storage.
+        void Detach(DATA_TYPE& data);
+
+        bool IsAttached() const;
+
+        //! Returns the attached data, valid until the next structural change of the storage, or nullptr.
+        DATA_TYPE* Get() const;
+
+    private:
+        AZ::EntityId m_entityId;
+    };
+}
+
+#include <AzFramework/Archetype/ArchetypeStorage.inl>
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzFramework
+{
+    namespace ArchetypeInternal
+    {
+        template <typename... DATA_TYPES, typename FUNCTION, size_t... INDICES>
+        inline void InvokeChunkFunction(
+            FUNCTION& func, uint32_t count, const AZ::EntityId* entityIds, AZStd::byte* chunkData, const size_t* columnOffsets,
+            AZStd::index_sequence<INDICES...>)
+        {
+            func(count, entityIds, reinterpret_cast<DATA_TYPES*>(chunkData + columnOffsets[INDICES])...);
+        }
+    }
+
+    template <typename DATA_TYPE>
+    inline ArchetypeDataType ArchetypeDataType::Create()
+    {
+        ArchetypeDataType dataType;
+        dataType.m_typeId = azrtti_typeid<DATA_TYPE>();
+        dataType.m_name = AZ::AzTypeInfo<DATA_TYPE>::Name();
+        dataType.m_size = sizeof(DATA_TYPE);
+        dataType.m_alignment = alignof(DATA_TYPE);
+        dataType.m_moveConstruct = [](void* destination, void* source)
+        {
+            new (destination) DATA_TYPE(AZStd::move(*static_cast<DATA_TYPE*>(source)));
+        };
+        dataType.m_destruct = [](void* data)
+        {
+            static_cast<DATA_TYPE*>(data)->~DATA_TYPE();
+        };
+        return dataType;
+    }
+
+    template <typename DATA_TYPE>
+    inline ArchetypeDataTypeIndex ArchetypeStorage::RegisterDataType()
+    {
+        return RegisterDataType(ArchetypeDataType::Create<DATA_TYPE>());
+    }
+
+    template <typename DATA_TYPE, typename... ARGS>
+    inline DATA_TYPE& ArchetypeStorage::EmplaceData(AZ::EntityId entityId, ARGS&&... args)
+    {
+        const ArchetypeDataTypeIndex dataTypeIndex = RegisterDataType<DATA_TYPE>();
+        if (void* data = AddData(entityId, dataTypeIndex))
+        {
+            return *new (data) DATA_TYPE(AZStd::forward<ARGS>(args)...);
+        }
+
+        DATA_TYPE& existing = *static_cast<DATA_TYPE*>(FindData(entityId, dataTypeIndex));
+        existing = DATA_TYPE(AZStd::forward<ARGS>(args)...);
+        return existing;
+    }
+
+    template <typename DATA_TYPE>
+    inline bool ArchetypeStorage::RemoveData(AZ::EntityId entityId)
+    {
+        return RemoveData(entityId, FindDataTypeIndex(azrtti_typeid<DATA_TYPE>()));
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE* ArchetypeStorage::FindData(AZ::EntityId entityId)
+    {
+        return static_cast<DATA_TYPE*>(FindData(entityId, FindDataTypeIndex(azrtti_typeid<DATA_TYPE>())));
+    }
+
+    template <typename... DATA_TYPES, typename FUNCTION>
+    inline void ArchetypeStorage::ForEachChunk(FUNCTION&& func)
+    {
+        constexpr size_t DataTypeCount = sizeof...(DATA_TYPES);
+        const AZStd::array<ArchetypeDataTypeIndex, DataTypeCount> dataTypeIndices = { FindDataTypeIndex(azrtti_typeid<DATA_TYPES>())... };
+        for (const ArchetypeDataTypeIndex dataTypeIndex : dataTypeIndices)
+        {
+            if (dataTypeIndex == InvalidArchetypeDataTypeIndex)
+            {
+                // No entity can have an unregistered data type
+                return;
+            }
+        }
+
+        ++m_iterationDepth;
+        AZStd::array<size_t, DataTypeCount> columnOffsets;
+        for (Archetype& archetype : m_archetypes)
+        {
+            if (archetype.m_entityCount == 0)
+            {
+                continue;
+            }
+
+            bool matches = true;
+            for (size_t i = 0; i < DataTypeCount && matches; ++i)
+            {
+                const int32_t column = FindColumn(archetype, dataTypeIndices[i]);
+                matches = column >= 0;
+                columnOffsets[i] = matches ? archetype.m_columnOffsets[column] : 0;
+            }
+            if (!matches)
+            {
+                continue;
+            }
+
+            for (uint32_t chunk = 0; chunk < archetype.m_chunks.size(); ++chunk)
+            {
+                AZStd::byte* chunkData = archetype.m_chunks[chunk];
+                const uint32_t count = AZStd::min(archetype.m_entityCount - chunk * archetype.m_chunkCapacity, archetype.m_chunkCapacity);
+                ArchetypeInternal::InvokeChunkFunction<DATA_TYPES...>(
+                    func, count, GetEntityIds(archetype, chunk), chunkData, columnOffsets.data(), AZStd::index_sequence_for<DATA_TYPES...>{});
+            }
+        }
+        --m_iterationDepth;
+    }
+
+    template <typename... DATA_TYPES, typename FUNCTION>
+    inline void ArchetypeStorage::ForEach(FUNCTION&& func)
+    {
+        ForEachChunk<DATA_TYPES...>([&func](uint32_t count, const AZ::EntityId* entityIds, DATA_TYPES*... data)
+        {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                func(entityIds[i], data[i]...);
+            }
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline ArchetypeComponentData<DATA_TYPE>::~ArchetypeComponentData()
+    {
+        AZ_Assert(!IsAttached(), "ArchetypeComponentData destroyed while attached, Detach should be called on Deactivate");
+    }
+
+    template <typename DATA_TYPE>
+    inline void ArchetypeComponentData<DATA_TYPE>::Attach(AZ::EntityId entityId, DATA_TYPE& data)
+    {
+        ArchetypeStorage* storage = AZ::Interface<ArchetypeStorage>::Get();
+        AZ_Assert(storage != nullptr, "Failed to attach archetype data, there is no archetype storage");
+        AZ_Assert(!IsAttached(), "Archetype data is already attached");
+        if (storage != nullptr && !IsAttached())
+        {
+            m_entityId = entityId;
+            storage->EmplaceData<DATA_TYPE>(m_entityId, AZStd::move(data));
+        }
+    }
+
+    template <typename DATA_TYPE>
+    inline void ArchetypeComponentData<DATA_TYPE>::Detach(DATA_TYPE& data)
+    {
+        if (DATA_TYPE* attachedData = Get())
+        {
+            data = AZStd::move(*attachedData);
+            AZ::Interface<ArchetypeStorage>::Get()->RemoveData<DATA_TYPE>(m_entityId);
+        }
+        m_entityId.SetInvalid();
+    }
+
+    template <typename DATA_TYPE>
+    inline bool ArchetypeComponentData<DATA_TYPE>::IsAttached() const
+    {
+        return m_entityId.IsValid();
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE* ArchetypeComponentData<DATA_TYPE>::Get() const
+    {
+        ArchetypeStorage* storage = AZ::Interface<ArchetypeStorage>::Get();
+        return (storage != nullptr && IsAttached()) ? storage->FindData<DATA_TYPE>(m_entityId) : nullptr;
+    }
+}
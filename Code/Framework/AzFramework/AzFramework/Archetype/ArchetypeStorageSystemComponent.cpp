@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Archetype/ArchetypeStorageSystemComponent.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace AzFramework
+{
+    void ArchetypeStorageSystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<ArchetypeStorageSystemComponent, AZ::Component>()
+                ->Version(1);
+        }
+    }
+
+    void ArchetypeStorageSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("ArchetypeStorageService"));
+    }
+
+    void ArchetypeStorageSystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("ArchetypeStorageService"));
+    }
+
+    ArchetypeStorageSystemComponent::ArchetypeStorageSystemComponent()
+    {
+        AZ::Interface<ArchetypeStorage>::Register(&m_storage);
+    }
+
+    ArchetypeStorageSystemComponent::~ArchetypeStorageSystemComponent()
+    {
+        AZ_Assert(m_storage.GetEntityCount() == 0, "All archetype data must be detached before shutdown");
+        AZ::Interface<ArchetypeStorage>::Unregister(&m_storage);
+    }
+
+    void ArchetypeStorageSystemComponent::Activate()
+    {
+    }
+
+    void ArchetypeStorageSystemComponent::Deactivate()
+    {
+    }
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzFramework/Archetype/ArchetypeStorage.h>
+
+namespace AzFramework
+{
+    //! Owns the ArchetypeStorage and registers it with AZ::Interface<ArchetypeStorage>.
+    //! The storage is registered on construction, so that components can attach their data while they activate
+    //! regardless of the activation order of the system components.
+    class ArchetypeStorageSystemComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ArchetypeStorageSystemComponent, "{8E3F6A2D-1C7B-4D95-A0E4-6B2D9F5C3A18}");
+
+        static void Reflect(AZ::ReflectContext* context);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        ArchetypeStorageSystemComponent();
+        ~ArchetypeStorageSystemComponent() override;
+
+        //! AZ::Component overrides.
+        //! @{
+        void Activate() override;
+        void Deactivate() override;
+        //! @}
+
+    private:
+        ArchetypeStorage m_storage;
+    };
+}
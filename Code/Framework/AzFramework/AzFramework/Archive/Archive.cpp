@@ -22,6 +22,7 @@
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/string/wildcard.h>
 #include <AzCore/std/sort.h>
@@ -51,10 +52,17 @@ namespace AZ::IO
     AZ_CVAR(int32_t, az_archive_verbosity, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Sets the verbosity level for logging Archive operations\n"
         ">=1 - Turns on verbose logging of all operations");
+    AZ_CVAR(int32_t, az_archive_open_pack_threads, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum number of threads used to read the central directories of archives when several packs are opened at once.\n"
+        "0 - Use as many threads as there are hardware threads\n"
+        "1 - Open the packs one after the other on the calling thread");
 }
 
 namespace AZ::IO::ArchiveInternal
 {
+    // flags of the archives opened through OpenPack and OpenPacks
+    inline constexpr int PackArchiveFlags = INestedArchive::FLAGS_OPTIMIZED_READ_ONLY | INestedArchive::FLAGS_ABSOLUTE_PATHS;
+
     // this is the start of indexation of pseudofiles:
     // to the actual index , this offset is added to get the valid handle
     static constexpr size_t PseudoFileIdxOffset = 1;
@@ -1131,10 +1139,27 @@ namespace AZ::IO
 
     bool Archive::OpenPackCommon(AZStd::string_view szBindRoot, AZStd::string_view szFullPath,
         AZStd::intrusive_ptr<AZ::IO::MemoryBlock> pData, bool addLevels)
+    {
+        bool usePrefabSystemForLevels = false;
+        AzFramework::ApplicationRequests::Bus::BroadcastResult(
+            usePrefabSystemForLevels, &AzFramework::ApplicationRequests::IsPrefabSystemEnabled);
+
+        PreparedPack pack;
+        if (!PreparePack(pack, szBindRoot, szFullPath, pData, addLevels && !usePrefabSystemForLevels))
+        {
+            return false;
+        }
+        MountPreparedPacks({ &pack, 1 }, usePrefabSystemForLevels);
+        return true;
+    }
+
+    bool Archive::PreparePack(PreparedPack& pack, AZStd::string_view szBindRoot, AZStd::string_view szFullPath,
+        AZStd::intrusive_ptr<AZ::IO::MemoryBlock> pData, bool scanForLevels)
     {
         // setup PackDesc before the duplicate test
-        PackDesc desc;
+        PackDesc& desc = pack.m_desc;
         desc.m_strFileName = szFullPath;
+        pack.m_bindRoot = szBindRoot;
 
         if (AZ::IO::FixedMaxPath pathBindRoot; !AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(pathBindRoot, szBindRoot))
         {
@@ -1147,24 +1172,14 @@ namespace AZ::IO
             desc.m_pathBindRoot = pathBindRoot.LexicallyNormal().String();
         }
 
-        // hold the lock from the point we query the zip array,
-        // so we don't end up adding a given archive twice
+        // maybe the pack has already been opened. This is checked again when mounting,
+        // as another thread can open the same pack in the mean time
+        if (IsPackMounted(desc))
         {
-            AZStd::unique_lock lock(m_csZips);
-            // try to find this - maybe the pack has already been opened
-            for (auto it = m_arrZips.begin(); it != m_arrZips.end(); ++it)
-            {
-                if (AZ::IO::PathView archiveFilePath = it->pZip->GetFilePath();
-                    archiveFilePath == desc.m_strFileName && it->m_pathBindRoot == desc.m_pathBindRoot)
-                {
-                    return true; // already opened
-                }
-            }
+            return true; // already opened
         }
 
-        const int flags = INestedArchive::FLAGS_OPTIMIZED_READ_ONLY | INestedArchive::FLAGS_ABSOLUTE_PATHS;
-
-        desc.pArchive = OpenArchive(szFullPath, szBindRoot, flags, pData);
+        desc.pArchive = OpenArchive(szFullPath, szBindRoot, ArchiveInternal::PackArchiveFlags, pData);
         if (!desc.pArchive)
         {
             return false; // couldn't open the archive
@@ -1173,92 +1188,222 @@ namespace AZ::IO
         AZ_TracePrintf("Archive", "Opening archive file %.*s\n", AZ_STRING_ARG(szFullPath));
         desc.pZip = static_cast<NestedArchive*>(desc.pArchive.get())->GetCache();
 
-        AZStd::unique_lock lock(m_csZips);
-        // Insert the archive lexically but before any override archives
-        // This allows us to order the archives allowing the later archives
-        // that have priority for same name files. This supports the
-        // patching of the base program underneath the mods/override archives
-        // All we have to do is name the archive appropriately to make
-        // sure later archives added to the current set of archives sort higher
-        // and therefore get used instead of lower sorted archives
-        AZ::IO::PathView nextBundle;
-        ZipArray::reverse_iterator revItZip = m_arrZips.rbegin();
-        for (; revItZip != m_arrZips.rend(); ++revItZip)
+        pack.m_bundleManifest = GetBundleManifest(desc.pZip);
+        if (pack.m_bundleManifest)
         {
-            nextBundle = revItZip->GetFullPath();
-            if (desc.GetFullPath() > revItZip->GetFullPath())
-            {
-                break;
-            }
+            pack.m_bundleCatalog = GetBundleCatalog(desc.pZip, pack.m_bundleManifest->GetCatalogName());
         }
 
-        AZStd::shared_ptr<AzFramework::AssetRegistry> bundleCatalog;
-        auto bundleManifest = GetBundleManifest(desc.pZip);
-        if (bundleManifest)
+        // [LYN-2376] Remove once legacy slice support is removed
+        if (scanForLevels)
         {
-            bundleCatalog = GetBundleCatalog(desc.pZip, bundleManifest->GetCatalogName());
+            // Note that manifest version two and above will contain level directory information inside them
+            // otherwise we will fallback to scanning the archive for levels.
+            if (pack.m_bundleManifest && pack.m_bundleManifest->GetBundleVersion() >= 2)
+            {
+                pack.m_levelDirs = pack.m_bundleManifest->GetLevelDirectories();
+            }
+            else
+            {
+                pack.m_levelDirs = ScanForLevels(desc.pZip);
+            }
         }
+        return true;
+    }
 
-        // If this archive is loaded before the serialize context is available, then the manifest and catalog will need to be loaded later.
-        if (!bundleManifest || !bundleCatalog)
+    bool Archive::IsPackMounted(const PackDesc& desc) const
+    {
+        AZStd::shared_lock lock(m_csZips);
+        for (auto it = m_arrZips.begin(); it != m_arrZips.end(); ++it)
         {
-            m_archivesWithCatalogsToLoad.push_back(
-                ArchivesWithCatalogsToLoad(szFullPath, szBindRoot, flags, nextBundle, desc.m_strFileName));
+            if (AZ::IO::PathView archiveFilePath = it->pZip->GetFilePath();
+                archiveFilePath == desc.m_strFileName && it->m_pathBindRoot == desc.m_pathBindRoot)
+            {
+                return true;
+            }
         }
+        return false;
+    }
 
-        bool usePrefabSystemForLevels = false;
-        AzFramework::ApplicationRequests::Bus::BroadcastResult(
-            usePrefabSystemForLevels, &AzFramework::ApplicationRequests::IsPrefabSystemEnabled);
-
-        if (usePrefabSystemForLevels)
-        {
-            m_arrZips.insert(revItZip.base(), desc);
-        }
-        else
+    void Archive::MountPreparedPacks(AZStd::span<PreparedPack> packs, bool usePrefabSystemForLevels)
+    {
+        // All packs are added under a single lock, so searches either see none or all of them
+        AZStd::unique_lock lock(m_csZips);
+        for (PreparedPack& pack : packs)
         {
-            // [LYN-2376] Remove once legacy slice support is removed
-            AZStd::vector<AZ::IO::Path> levelDirs;
+            PackDesc& desc = pack.m_desc;
+            if (!desc.pArchive)
+            {
+                continue;
+            }
 
-            if (addLevels)
+            bool alreadyMounted = false;
+            for (auto it = m_arrZips.begin(); it != m_arrZips.end(); ++it)
             {
-                // Note that manifest version two and above will contain level directory information inside them
-                // otherwise we will fallback to scanning the archive for levels.
-                if (bundleManifest && bundleManifest->GetBundleVersion() >= 2)
+                if (AZ::IO::PathView archiveFilePath = it->pZip->GetFilePath();
+                    archiveFilePath == desc.m_strFileName && it->m_pathBindRoot == desc.m_pathBindRoot)
                 {
-                    levelDirs = bundleManifest->GetLevelDirectories();
+                    alreadyMounted = true;
+                    break;
                 }
-                else
+            }
+            if (alreadyMounted)
+            {
+                desc.pArchive = nullptr;
+                continue;
+            }
+
+            // Insert the archive lexically but before any override archives
+            // This allows us to order the archives allowing the later archives
+            // that have priority for same name files. This supports the
+            // patching of the base program underneath the mods/override archives
+            // All we have to do is name the archive appropriately to make
+            // sure later archives added to the current set of archives sort higher
+            // and therefore get used instead of lower sorted archives
+            ZipArray::reverse_iterator revItZip = m_arrZips.rbegin();
+            for (; revItZip != m_arrZips.rend(); ++revItZip)
+            {
+                pack.m_nextBundle = revItZip->GetFullPath();
+                if (desc.GetFullPath() > revItZip->GetFullPath())
                 {
-                    levelDirs = ScanForLevels(desc.pZip);
+                    break;
                 }
             }
 
-            if (!levelDirs.empty())
+            // If this archive is loaded before the serialize context is available, then the manifest and catalog will need to be loaded later.
+            if (!pack.m_bundleManifest || !pack.m_bundleCatalog)
+            {
+                m_archivesWithCatalogsToLoad.push_back(ArchivesWithCatalogsToLoad(
+                    desc.m_strFileName.Native(), pack.m_bindRoot, ArchiveInternal::PackArchiveFlags, pack.m_nextBundle, desc.m_strFileName));
+            }
+
+            if (!usePrefabSystemForLevels && !pack.m_levelDirs.empty())
             {
                 desc.m_containsLevelPak = true;
             }
 
             m_arrZips.insert(revItZip.base(), desc);
+        }
+
+        // This lock is for m_arrZips.
+        // Unlock it now because the modification is complete, and events responding to these signals
+        // will attempt to lock the same mutex, causing the application to lock up.
+        lock.unlock();
 
-            // This lock is for m_arrZips.
-            // Unlock it now because the modification is complete, and events responding to this signal
-            // will attempt to lock the same mutex, causing the application to lock up.
-            lock.unlock();
-            m_levelOpenEvent.Signal(levelDirs);
+        for (PreparedPack& pack : packs)
+        {
+            if (!pack.m_desc.pArchive)
+            {
+                continue;
+            }
+
+            if (!usePrefabSystemForLevels)
+            {
+                m_levelOpenEvent.Signal(pack.m_levelDirs);
+            }
+
+            if (pack.m_bundleManifest && pack.m_bundleCatalog)
+            {
+                AZ::IO::ArchiveNotificationBus::Broadcast(
+                    [](AZ::IO::ArchiveNotifications* archiveNotifications, const char* bundleName,
+                       AZStd::shared_ptr<AzFramework::AssetBundleManifest> bundleManifest, const AZ::IO::FixedMaxPath& nextBundle,
+                       AZStd::shared_ptr<AzFramework::AssetRegistry> bundleCatalog)
+                    {
+                        archiveNotifications->BundleOpened(bundleName, bundleManifest, nextBundle.c_str(), bundleCatalog);
+                    },
+                    pack.m_desc.m_strFileName.c_str(), pack.m_bundleManifest, pack.m_nextBundle, pack.m_bundleCatalog);
+            }
         }
+    }
+
+    bool Archive::OpenPackBatchCommon(AZStd::string_view szBindRoot, AZStd::span<const AZ::IO::FixedMaxPath> packPaths,
+        AZStd::vector<AZ::IO::FixedMaxPathString>* pFullPaths, bool addLevels)
+    {
+        bool usePrefabSystemForLevels = false;
+        AzFramework::ApplicationRequests::Bus::BroadcastResult(
+            usePrefabSystemForLevels, &AzFramework::ApplicationRequests::IsPrefabSystemEnabled);
+        const bool scanForLevels = addLevels && !usePrefabSystemForLevels;
 
-        if (bundleManifest && bundleCatalog)
+        // Reading the central directories is the expensive part of opening a pack and is independent per pack,
+        // so it's spread over several threads. The job manager isn't guaranteed to be running yet when the
+        // packs are opened during startup, so short lived threads are used instead
+        AZStd::vector<PreparedPack> packs(packPaths.size());
+        AZStd::vector<uint8_t> prepared(packPaths.size(), 0);
+        AZStd::atomic<size_t> nextPack{ 0 };
+        auto prepareWorker = [&]()
         {
-            AZ::IO::ArchiveNotificationBus::Broadcast(
-                [](AZ::IO::ArchiveNotifications* archiveNotifications, const char* bundleName,
-                   AZStd::shared_ptr<AzFramework::AssetBundleManifest> bundleManifest, const AZ::IO::FixedMaxPath& nextBundle,
-                   AZStd::shared_ptr<AzFramework::AssetRegistry> bundleCatalog)
-                {
-                    archiveNotifications->BundleOpened(bundleName, bundleManifest, nextBundle.c_str(), bundleCatalog);
-                },
-                desc.m_strFileName.c_str(), bundleManifest, nextBundle, bundleCatalog);
+            for (size_t index = nextPack++; index < packPaths.size(); index = nextPack++)
+            {
+                prepared[index] = PreparePack(packs[index], szBindRoot, packPaths[index].Native(), nullptr, scanForLevels) ? 1 : 0;
+            }
+        };
+
+        size_t numThreads = az_archive_open_pack_threads > 0
+            ? aznumeric_cast<size_t>(static_cast<int32_t>(az_archive_open_pack_threads))
+            : AZStd::max(AZStd::thread::hardware_concurrency(), 1u);
+        numThreads = AZStd::min(numThreads, packPaths.size());
+
+        AZStd::vector<AZStd::thread> threads;
+        if (numThreads > 1)
+        {
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "Archive open packs";
+            // the calling thread takes part as well
+            threads.reserve(numThreads - 1);
+            for (size_t i = 1; i < numThreads; ++i)
+            {
+                threads.emplace_back(threadDesc, prepareWorker);
+            }
         }
-        return true;
+        prepareWorker();
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // The packs are mounted in the order they were provided in, which gives the same result as opening them one by one
+        MountPreparedPacks(packs, usePrefabSystemForLevels);
+
+        bool bAllOk = true;
+        for (size_t i = 0; i < packPaths.size(); ++i)
+        {
+            bAllOk = prepared[i] && bAllOk;
+            if (pFullPaths)
+            {
+                pFullPaths->emplace_back(packPaths[i].Native());
+            }
+        }
+        return bAllOk;
+    }
+
+    bool Archive::OpenPackBatch(AZStd::string_view szBindRootIn, AZStd::span<const AZStd::string_view> packPaths,
+        AZStd::vector<AZ::IO::FixedMaxPathString>* pFullPaths)
+    {
+        AZ_Assert(!szBindRootIn.empty(), "Bind Root should not be empty");
+
+        auto szBindRoot = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(szBindRootIn);
+        if (!szBindRoot)
+        {
+            AZ_Assert(false, "Unable to resolve path for bindroot %.*s", aznumeric_cast<int>(szBindRootIn.size()), szBindRootIn.data());
+            return false;
+        }
+
+        AZStd::vector<AZ::IO::FixedMaxPath> files;
+        files.reserve(packPaths.size());
+        for (AZStd::string_view packPath : packPaths)
+        {
+            auto szFullPath = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(packPath);
+            if (!szFullPath)
+            {
+                AZ_Assert(false, "Unable to resolve path for filepath %.*s", aznumeric_cast<int>(packPath.size()), packPath.data());
+                return false;
+            }
+            files.emplace_back(AZStd::move(*szFullPath));
+        }
+
+        // Mount the packs in alphabetical order, the same as OpenPacks does for the packs matching a wildcard
+        AZStd::sort(files.begin(), files.end());
+        return OpenPackBatchCommon(szBindRoot->Native(), files, pFullPaths, true);
     }
 
 
@@ -1391,16 +1536,7 @@ namespace AZ::IO
 
             // Open files in alphabetical order.
             AZStd::sort(files.begin(), files.end());
-            bool bAllOk = true;
-            for (const AZ::IO::FixedMaxPath& file : files)
-            {
-                bAllOk = OpenPackCommon(szDir, file.Native(), nullptr, addLevels) && bAllOk;
-
-                if (pFullPaths)
-                {
-                    pFullPaths->emplace_back(AZStd::move(file.Native()));
-                }
-            }
+            bool bAllOk = OpenPackBatchCommon(szDir, files, pFullPaths, addLevels);
 
             FindClose(fileIterator);
             return bAllOk;
@@ -1452,7 +1588,7 @@ namespace AZ::IO
     CCachedFileData::~CCachedFileData()
     {
         // forced destruction
-        if (m_pFileData)
+        if (m_pFileData && !m_isMappedData)
         {
             AZ::AllocatorInstance<AZ::OSAllocator>::Get().DeAllocate(m_pFileData);
             m_pFileData = nullptr;
@@ -1514,6 +1650,14 @@ namespace AZ::IO
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
             if (!m_pFileData)
             {
+                if (const void* mappedData = m_pZip->GetMappedFileData(m_pFileEntry))
+                {
+                    // stored files can be used straight from the memory mapped archive without a copy
+                    m_isMappedData = true;
+                    m_pFileData = const_cast<void*>(mappedData);
+                    return m_pFileData;
+                }
+
                 // don't try to decompress if its not actually compressed
                 decompress = decompress && m_pFileEntry->IsCompressed();
 
@@ -1566,8 +1710,8 @@ namespace AZ::IO
         if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
         {
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
-            // Uncompressed read.
-            if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadFile(m_pFileEntry, nullptr, pBuffer))
+            // Uncompressed read of only the requested range.
+            if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadFileRange(m_pFileEntry, pBuffer, nFileOffset, nReadSize))
             {
                 return -1;
             }
@@ -56,6 +56,7 @@ namespace AZ::IO
         // the cache is refreshed. Otherwise, it returns whatever cache is (nullptr if the data isn't cached yet)
         // decompress can be harmlessly set to true if you want the data back decompressed.
         // set them to false only if you want to operate on the raw data while its still compressed.
+        // For files stored without compression in a memory mapped archive this points into the read-only mapping.
         void* GetData(bool bRefreshCache = true, bool decompress = true);
         // Uncompress file data directly to provided memory.
         bool GetDataTo(void* pFileData, int nDataSize, bool bDecompress = true);
@@ -69,6 +70,8 @@ namespace AZ::IO
         uint32_t GetFileDataOffset();
 
         void* m_pFileData;
+        // true if m_pFileData points into the memory mapped archive instead of an allocated buffer
+        bool m_isMappedData = false;
 
         // the zip file in which this file is opened
         ZipDir::CachePtr m_pZip;
@@ -128,6 +131,19 @@ namespace AZ::IO
         };
         using ZipArray = AZStd::vector<PackDesc, AZ::OSStdAllocator>;
 
+        // a pack that has been read and is ready to be mounted. Packs can be read on any thread,
+        // but are mounted on the thread that opens them
+        struct PreparedPack
+        {
+            PackDesc m_desc; // pArchive is nullptr if the pack was already opened
+            AZStd::string m_bindRoot; // the binding root as it was provided to open the pack with
+            AZStd::shared_ptr<AzFramework::AssetBundleManifest> m_bundleManifest;
+            AZStd::shared_ptr<AzFramework::AssetRegistry> m_bundleCatalog;
+            // [LYN-2376] Remove once legacy slice support is removed
+            AZStd::vector<AZ::IO::Path> m_levelDirs;
+            AZ::IO::PathView m_nextBundle;
+        };
+
         // ArchiveFindDataSet entire purpose is to keep a reference to the intrusive_ptr of ArchiveFindData
         // so that it doesn't go out of scope
         using ArchiveFindDataSet = AZStd::set<AZStd::intrusive_ptr<AZ::IO::FindData>>;
@@ -183,6 +199,7 @@ namespace AZ::IO
         bool ClosePack(AZStd::string_view pName) override;
         bool OpenPacks(AZStd::string_view pWildcard, AZStd::vector<AZ::IO::FixedMaxPathString>* pFullPaths = nullptr) override;
         bool OpenPacks(AZStd::string_view szBindRoot, AZStd::string_view pWildcard, AZStd::vector<AZ::IO::FixedMaxPathString>* pFullPaths = nullptr) override;
+        bool OpenPackBatch(AZStd::string_view szBindRoot, AZStd::span<const AZStd::string_view> packPaths, AZStd::vector<AZ::IO::FixedMaxPathString>* pFullPaths = nullptr) override;
 
         // closes pack files by the path and wildcard
         bool ClosePacks(AZStd::string_view pWildcard) override;
@@ -277,6 +294,13 @@ namespace AZ::IO
 
         bool OpenPackCommon(AZStd::string_view szBindRoot, AZStd::string_view pName, AZStd::intrusive_ptr<AZ::IO::MemoryBlock> pData = nullptr, bool addLevels = true);
         bool OpenPacksCommon(AZStd::string_view szDir, AZStd::string_view pWildcardIn, AZStd::vector<AZ::IO::FixedMaxPathString>* pFullPaths = nullptr, bool addLevels = true);
+        bool OpenPackBatchCommon(AZStd::string_view szBindRoot, AZStd::span<const AZ::IO::FixedMaxPath> packPaths, AZStd::vector<AZ::IO::FixedMaxPathString>* pFullPaths, bool addLevels);
+
+        // reads the pack and everything needed to mount it. Safe to call from multiple threads at once
+        bool PreparePack(PreparedPack& pack, AZStd::string_view szBindRoot, AZStd::string_view szFullPath, AZStd::intrusive_ptr<AZ::IO::MemoryBlock> pData, bool scanForLevels);
+        // adds the prepared packs to the searched archives in one go and sends out the notifications for them
+        void MountPreparedPacks(AZStd::span<PreparedPack> packs, bool usePrefabSystemForLevels);
+        bool IsPackMounted(const PackDesc& desc) const;
 
         ZipDir::FileEntry* FindPakFileEntry(AZStd::string_view szPath) const;
 
@@ -8,6 +8,7 @@
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/functional.h> // for function<> in the find files callback.
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Archive/ArchiveFileIO.h>
 #include <AzFramework/Archive/IArchive.h>
 
@@ -263,6 +264,81 @@ namespace AZ::IO
         return m_archive->IsFileExist(filePath);
     }
 
+    void ArchiveFileIO::ReadBatch(IO::FileReadBatch requests, ReadBatchCallback callback)
+    {
+        if (!m_archive)
+        {
+            if (GetDirectInstance())
+            {
+                GetDirectInstance()->ReadBatch(AZStd::move(requests), AZStd::move(callback));
+                return;
+            }
+            FileIOBase::ReadBatch(AZStd::move(requests), AZStd::move(callback));
+            return;
+        }
+
+        FileIOBase* directInstance = GetDirectInstance();
+        if (!directInstance || directInstance == this)
+        {
+            FileIOBase::ReadBatch(AZStd::move(requests), AZStd::move(callback));
+            return;
+        }
+
+        // Split the batch into the files that will come from an archive and files that are read from disk, following the
+        // same search order FOpen uses.
+        const FileSearchPriority priority = m_archive->GetPakPriority();
+        IO::FileReadBatch looseRequests;
+        AZStd::vector<size_t> looseIndices;
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            IO::FileReadRequest& request = requests[i];
+            const bool isLoose = priority != FileSearchPriority::PakOnly &&
+                m_archive->IsFileExist(request.m_filePath, FileSearchLocation::OnDisk) &&
+                (priority == FileSearchPriority::FileFirst || !m_archive->IsFileExist(request.m_filePath, FileSearchLocation::InPak));
+            if (isLoose)
+            {
+                looseRequests.push_back(AZStd::move(request));
+                looseIndices.push_back(i);
+            }
+            else
+            {
+                ReadBatchRequest(request);
+            }
+        }
+
+        if (looseRequests.empty())
+        {
+            if (callback)
+            {
+                callback(requests);
+            }
+            return;
+        }
+
+        struct BatchState
+        {
+            IO::FileReadBatch m_requests;
+            AZStd::vector<size_t> m_looseIndices;
+            ReadBatchCallback m_callback;
+        };
+        auto state = AZStd::make_shared<BatchState>();
+        state->m_requests = AZStd::move(requests);
+        state->m_looseIndices = AZStd::move(looseIndices);
+        state->m_callback = AZStd::move(callback);
+        directInstance->ReadBatch(AZStd::move(looseRequests),
+            [state](IO::FileReadBatch& completedRequests)
+            {
+                for (size_t i = 0; i < completedRequests.size(); ++i)
+                {
+                    state->m_requests[state->m_looseIndices[i]] = AZStd::move(completedRequests[i]);
+                }
+                if (state->m_callback)
+                {
+                    state->m_callback(state->m_requests);
+                }
+            });
+    }
+
     AZ::u64 ArchiveFileIO::ModificationTime(const char* filePath)
     {
         IO::HandleType openFile = IO::InvalidHandle;
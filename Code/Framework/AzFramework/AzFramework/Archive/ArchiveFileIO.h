@@ -73,6 +73,9 @@ namespace AZ::IO
         using FileIOBase::ResolvePath;
         bool ReplaceAlias(AZ::IO::FixedMaxPath& replacedAliasPath, const AZ::IO::PathView& path) const override;
         bool GetFilename(IO::HandleType fileHandle, char* filename, AZ::u64 filenameSize) const override;
+        //! Files that are read from an archive are read on the calling thread. All loose files are passed on as a single
+        //! batch to the direct instance, so they can be queued together.
+        void ReadBatch(IO::FileReadBatch requests, ReadBatchCallback callback) override;
         ////////////////////////////////////////////////////////////////////////////////////////////
 
     protected:
@@ -12,6 +12,7 @@
 #include <AzCore/EBus/Event.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -106,6 +107,10 @@ namespace AZ::IO
         // opens pack files by the path and wildcard
         virtual bool OpenPacks(AZStd::string_view pBindingRoot, AZStd::string_view pWildcard,
             AZStd::vector<AZ::IO::FixedMaxPathString>* pFullPaths = nullptr) = 0;
+        // opens all the listed pack files at once. The central directories of the packs are read in parallel and the packs
+        // are mounted together once all of them have been read, in alphabetical order like OpenPacks does for a wildcard
+        virtual bool OpenPackBatch(AZStd::string_view pBindingRoot, AZStd::span<const AZStd::string_view> packPaths,
+            AZStd::vector<AZ::IO::FixedMaxPathString>* pFullPaths = nullptr) = 0;
         // closes pack files by the path and wildcard
         virtual bool ClosePacks(AZStd::string_view pWildcard) = 0;
         //returns if a archive exists matching the wildcard
@@ -16,6 +16,11 @@
 #include <AzCore/std/string/string.h>
 #include <AzFramework/Archive/Codec.h>
 
+namespace AZ::IO::ZipDir
+{
+    struct CompressedFileData;
+}
+
 namespace AZ::IO
 {
     // This represents one particular archive.
@@ -125,6 +130,13 @@ namespace AZ::IO
         //   needed to update CRC if UpdateFileContinuousSegment() was used with nOverwriteSeekPos
         virtual int UpdateFileCRC(AZStd::string_view szRelativePath, AZ::Crc32 dwCRC) = 0;
 
+        // Summary:
+        //   Adds a new file to the zip or update an existing one, with data that's already compressed.
+        // Description:
+        //   The data comes from ZipDir::Cache::CompressFileData, which can run on other threads than the one
+        //   writing the archive, or from ReadCompressedFile on another archive to copy a file without recompressing it.
+        virtual int UpdateCompressedFile(AZStd::string_view szRelativePath, const ZipDir::CompressedFileData& data) = 0;
+
         // Summary:
         //   Deletes the file from the archive.
         virtual int RemoveFile(AZStd::string_view szRelativePath) = 0;
@@ -156,6 +168,12 @@ namespace AZ::IO
         // Note:
         //    Must be at least the size returned by GetFileSize.
         virtual int ReadFile(Handle, void* pBuffer) = 0;
+        // Summary:
+        //   Get the CRC32 of the uncompressed data of the file.
+        virtual AZ::Crc32 GetFileCRC(Handle) = 0;
+        // Summary:
+        //   Reads the data of the file as it's stored in the archive, without uncompressing it.
+        virtual int ReadCompressedFile(Handle, ZipDir::CompressedFileData& outData) = 0;
 
         // Summary:
         //   Get the full path to the archive file.
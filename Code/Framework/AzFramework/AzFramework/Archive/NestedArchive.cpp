@@ -153,6 +153,23 @@ namespace AZ::IO
         return m_pCache->UpdateFile(fullPath, pUncompressed, nSize, nCompressionMethod, nCompressionLevel, codec);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // Adds a new file to the zip or update an existing one, with data that's already compressed
+    int NestedArchive::UpdateCompressedFile(AZStd::string_view szRelativePath, const ZipDir::CompressedFileData& data)
+    {
+        if (m_nFlags & FLAGS_READ_ONLY)
+        {
+            return ZipDir::ZD_ERROR_INVALID_CALL;
+        }
+
+        AZ::IO::FixedMaxPathString fullPath = AdjustPath(szRelativePath);
+        if (fullPath.empty())
+        {
+            return ZipDir::ZD_ERROR_INVALID_PATH;
+        }
+        return m_pCache->UpdateCompressedFile(fullPath, data);
+    }
+
     //////////////////////////////////////////////////////////////////////////
     //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
     int NestedArchive::StartContinuousFileUpdate(AZStd::string_view szRelativePath, uint64_t nSize)
@@ -214,6 +231,20 @@ namespace AZ::IO
         return m_pCache->ReadFile(reinterpret_cast<ZipDir::FileEntry*>(fileHandle), nullptr, pBuffer);
     }
 
+    // returns the CRC32 of the file (unpacked) by the handle
+    AZ::Crc32 NestedArchive::GetFileCRC(Handle fileHandle)
+    {
+        AZ_Assert(m_pCache->IsOwnerOf(reinterpret_cast<ZipDir::FileEntry*>(fileHandle)), "File handle is not owned by archive");
+        return AZ::Crc32(reinterpret_cast<ZipDir::FileEntry*>(fileHandle)->desc.lCRC32);
+    }
+
+    // reads the file as it's stored in the archive, without uncompressing it
+    int NestedArchive::ReadCompressedFile(Handle fileHandle, ZipDir::CompressedFileData& outData)
+    {
+        AZ_Assert(m_pCache->IsOwnerOf(reinterpret_cast<ZipDir::FileEntry*>(fileHandle)), "File Handle is not owned by archive");
+        return m_pCache->ReadCompressedFileData(reinterpret_cast<ZipDir::FileEntry*>(fileHandle), outData);
+    }
+
     AZ::IO::PathView NestedArchive::GetFullPath() const
     {
         return m_pCache->GetFilePath();
@@ -59,6 +59,9 @@ namespace AZ::IO
 
         int UpdateFileCRC(AZStd::string_view szRelativePath, AZ::Crc32 dwCRC) override;
 
+        // Adds a new file to the zip or update an existing one, with data that's already compressed
+        int UpdateCompressedFile(AZStd::string_view szRelativePath, const ZipDir::CompressedFileData& data) override;
+
         // deletes the file from the archive
         int RemoveFile(AZStd::string_view szRelativePath) override;
 
@@ -80,6 +83,12 @@ namespace AZ::IO
         // reads the file into the preallocated buffer (must be at least the size of GetFileSize())
         int ReadFile(Handle fileHandle, void* pBuffer) override;
 
+        // returns the CRC32 of the file (unpacked) by the handle
+        AZ::Crc32 GetFileCRC(Handle fileHandle) override;
+
+        // reads the file as it's stored in the archive, without uncompressing it
+        int ReadCompressedFile(Handle fileHandle, ZipDir::CompressedFileData& outData) override;
+
         // returns the full path to the archive file
         AZ::IO::PathView GetFullPath() const override;
 
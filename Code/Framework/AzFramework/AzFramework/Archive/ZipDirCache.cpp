@@ -89,6 +89,8 @@ namespace AZ::IO::ZipDir
             , m_szRelativePath(AZ::IO::PosixPathSeparator)
             , m_bCommitted(false)
         {
+            // the index only covers the entries that were read from the archive
+            m_pCache->m_fileEntryIndex.clear();
             // Update the cache string pool with the relative path to the file
             auto pathIt = m_pCache->m_relativePathPool.emplace(AZ::IO::PathView(szRelativePath, AZ::IO::PosixPathSeparator).LexicallyNormal());
             m_szRelativePath = *pathIt.first;
@@ -144,12 +146,14 @@ namespace AZ::IO::ZipDir
                     }
             }
 
+            m_mappedFile.Close();
             if (m_fileHandle != AZ::IO::InvalidHandle)                      // RelinkZip() might have closed the file
             {
                 AZ::IO::FileIOBase::GetDirectInstance()->Close(m_fileHandle);
                 m_fileHandle = AZ::IO::InvalidHandle;
             }
         }
+        m_fileEntryIndex.clear();
         m_treeDir.Clear();
     }
 
@@ -225,15 +229,29 @@ namespace AZ::IO::ZipDir
 
     // Adds a new file to the zip or update an existing one
     // adds a directory (creates several nested directories if needed)
+    int Cache::CompressData(const void* pUncompressed, size_t nSize, void* pCompressed, size_t* pSizeCompressed, int nCompressionLevel, CompressionCodec::Codec codec)
+    {
+        switch (codec)
+        {
+        case CompressionCodec::Codec::ZSTD:
+            return ZipRawCompressZSTD(pUncompressed, pSizeCompressed, pCompressed, nSize, nCompressionLevel);
+
+        case CompressionCodec::Codec::ZLIB:
+            return ZipRawCompress(pUncompressed, pSizeCompressed, pCompressed, nSize, nCompressionLevel);
+
+        case CompressionCodec::Codec::LZ4:
+            return ZipRawCompressLZ4(pUncompressed, pSizeCompressed, pCompressed, nSize, nCompressionLevel);
+        }
+        return Z_ERRNO;
+    }
+
     ErrorEnum Cache::UpdateFile(AZStd::string_view szRelativePathSrc, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod, int nCompressionLevel, CompressionCodec::Codec codec)
     {
         AZStd::intrusive_ptr<AZ::IO::MemoryBlock> memoryBlock;
 
         // we'll need the compressed data
-        void* pCompressed = nullptr;
         const void* dataBuffer{};
         size_t nSizeCompressed;
-        int nError = Z_ERRNO;
 
         if (nSize == 0)
         {
@@ -244,38 +262,68 @@ namespace AZ::IO::ZipDir
         case ZipFile::METHOD_DEFLATE:
             nSizeCompressed = GetCompressedSizeEstimate(nSize, codec);
             memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(nSizeCompressed);
-            pCompressed = memoryBlock->m_address.get();
-            dataBuffer = pCompressed;
-
-            switch (codec)
+            dataBuffer = memoryBlock->m_address.get();
+            if (Z_OK != CompressData(pUncompressed, nSize, memoryBlock->m_address.get(), &nSizeCompressed, nCompressionLevel, codec))
             {
-            case CompressionCodec::Codec::ZSTD:
-                nError = ZipRawCompressZSTD(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
-                break;
+                return ZD_ERROR_ZLIB_FAILED;
+            }
+            break;
 
-            case CompressionCodec::Codec::ZLIB:
-                nError = ZipRawCompress(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
-                break;
+        case ZipFile::METHOD_STORE:
+            dataBuffer = pUncompressed;
+            nSizeCompressed = nSize;
+            break;
 
-            case CompressionCodec::Codec::LZ4:
-                nError = ZipRawCompressLZ4(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
-                break;
-            }
-            if (Z_OK != nError)
+        default:
+            return ZD_ERROR_UNSUPPORTED;
+        }
+
+        return WriteFileData(szRelativePathSrc, dataBuffer, nSizeCompressed, nSize, AZ::Crc32(pUncompressed, nSize), nCompressionMethod);
+    }
+
+    ErrorEnum Cache::CompressFileData(CompressedFileData& outData, AZStd::vector<char>&& uncompressed, uint32_t nCompressionMethod, int nCompressionLevel, CompressionCodec::Codec codec)
+    {
+        outData.m_uncompressedSize = uncompressed.size();
+        outData.m_crc32 = AZ::Crc32(uncompressed.data(), uncompressed.size());
+
+        if (uncompressed.empty())
+        {
+            nCompressionMethod = ZipFile::METHOD_STORE;
+        }
+        switch (nCompressionMethod)
+        {
+        case ZipFile::METHOD_DEFLATE:
+        {
+            size_t nSizeCompressed = GetCompressedSizeEstimate(uncompressed.size(), codec);
+            outData.m_data.resize_no_construct(nSizeCompressed);
+            if (Z_OK != CompressData(uncompressed.data(), uncompressed.size(), outData.m_data.data(), &nSizeCompressed, nCompressionLevel, codec))
             {
+                outData.m_data.clear();
                 return ZD_ERROR_ZLIB_FAILED;
             }
+            outData.m_data.resize(nSizeCompressed);
             break;
+        }
 
         case ZipFile::METHOD_STORE:
-            dataBuffer = pUncompressed;
-            nSizeCompressed = nSize;
+            outData.m_data = AZStd::move(uncompressed);
             break;
 
         default:
             return ZD_ERROR_UNSUPPORTED;
         }
 
+        outData.m_compressionMethod = nCompressionMethod;
+        return ZD_ERROR_SUCCESS;
+    }
+
+    ErrorEnum Cache::UpdateCompressedFile(AZStd::string_view szRelativePathSrc, const CompressedFileData& data)
+    {
+        return WriteFileData(szRelativePathSrc, data.m_data.data(), data.m_data.size(), data.m_uncompressedSize, data.m_crc32, data.m_compressionMethod);
+    }
+
+    ErrorEnum Cache::WriteFileData(AZStd::string_view szRelativePathSrc, const void* dataBuffer, size_t nSizeCompressed, uint64_t nSize, AZ::Crc32 dwCRC32, uint32_t nCompressionMethod)
+    {
         // create or find the file entry.. this object will rollback (delete the object
         // if the operation fails) if needed.
         FileEntryTransactionAdd pFileEntry(this, szRelativePathSrc);
@@ -285,7 +333,7 @@ namespace AZ::IO::ZipDir
             return ZD_ERROR_INVALID_PATH;
         }
 
-        pFileEntry->OnNewFileData(pUncompressed, nSize, aznumeric_cast<uint32_t>(nSizeCompressed), nCompressionMethod, false);
+        pFileEntry->OnNewFileData(dwCRC32, nSize, aznumeric_cast<uint32_t>(nSizeCompressed), nCompressionMethod, false);
         // since we changed the time, we'll have to update CDR
         m_nFlags |= FLAGS_CDR_DIRTY;
 
@@ -555,6 +603,7 @@ namespace AZ::IO::ZipDir
     // deletes the file from the archive
     ErrorEnum Cache::RemoveFile(AZStd::string_view szRelativePathSrc)
     {
+        m_fileEntryIndex.clear();
         AZ::IO::PathView szRelativePath{ szRelativePathSrc };
 
         AZStd::string_view fileName; // the name of the file to delete
@@ -596,6 +645,7 @@ namespace AZ::IO::ZipDir
     // deletes the directory, with all its descendants (files and subdirs)
     ErrorEnum Cache::RemoveDir(AZStd::string_view szRelativePathSrc)
     {
+        m_fileEntryIndex.clear();
         AZ::IO::PathView szRelativePath{ szRelativePathSrc };
 
         AZStd::string_view dirName; // the name of the dir to delete
@@ -636,6 +686,7 @@ namespace AZ::IO::ZipDir
     // deletes all files and directories in this archive
     ErrorEnum Cache::RemoveAll()
     {
+        m_fileEntryIndex.clear();
         ErrorEnum e = m_treeDir.RemoveAll();
         if (e == ZD_ERROR_SUCCESS)
         {
@@ -666,36 +717,62 @@ namespace AZ::IO::ZipDir
             return nError;
         }
 
-        if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
-        {
-            return ZD_ERROR_IO_FAILED;
-        }
-
         AZStd::intrusive_ptr<AZ::IO::MemoryBlock> memoryBlock;
 
         void* pBuffer = pCompressed; // the buffer where the compressed data will go
 
-        if (pFileEntry->nMethod == 0 && pUncompressed)
+        if (const uint8_t* pMappedData = GetMappedData(pFileEntry))
         {
-            // we can directly read into the uncompress buffer
-            pBuffer = pUncompressed;
-        }
-
-        if (!pBuffer)
-        {
-            if (!pUncompressed)
+            if (!pCompressed && !pUncompressed)
             {
-                // what's the sense of it - no buffers at all?
                 return ZD_ERROR_INVALID_CALL;
             }
 
-            memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(pFileEntry->desc.lSizeCompressed);
-            pBuffer = memoryBlock->m_address.get();
+            // the data is already in memory, so compressed data only needs to be copied if it's explicitly requested
+            // and can otherwise be uncompressed straight from the mapping
+            if (pCompressed)
+            {
+                memcpy(pCompressed, pMappedData, pFileEntry->desc.lSizeCompressed);
+            }
+            if (pFileEntry->nMethod == 0 && pUncompressed)
+            {
+                memcpy(pUncompressed, pMappedData, pFileEntry->desc.lSizeCompressed);
+                pBuffer = pUncompressed;
+            }
+            else
+            {
+                pBuffer = const_cast<uint8_t*>(pMappedData);
+            }
         }
-
-        if (!AZ::IO::FileIOBase::GetDirectInstance()->Read(m_fileHandle, pBuffer, pFileEntry->desc.lSizeCompressed, true))
+        else
         {
-            return ZD_ERROR_IO_FAILED;
+            if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
+            {
+                return ZD_ERROR_IO_FAILED;
+            }
+
+            if (pFileEntry->nMethod == 0 && pUncompressed)
+            {
+                // we can directly read into the uncompress buffer
+                pBuffer = pUncompressed;
+            }
+
+            if (!pBuffer)
+            {
+                if (!pUncompressed)
+                {
+                    // what's the sense of it - no buffers at all?
+                    return ZD_ERROR_INVALID_CALL;
+                }
+
+                memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(pFileEntry->desc.lSizeCompressed);
+                pBuffer = memoryBlock->m_address.get();
+            }
+
+            if (!AZ::IO::FileIOBase::GetDirectInstance()->Read(m_fileHandle, pBuffer, pFileEntry->desc.lSizeCompressed, true))
+            {
+                return ZD_ERROR_IO_FAILED;
+            }
         }
 
         // if there's a buffer for uncompressed data, uncompress it to that buffer
@@ -729,14 +806,114 @@ namespace AZ::IO::ZipDir
     }
 
 
+    ErrorEnum Cache::ReadCompressedFileData(FileEntry* pFileEntry, CompressedFileData& outData)
+    {
+        if (!pFileEntry)
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
+        outData.m_uncompressedSize = pFileEntry->desc.lSizeUncompressed;
+        outData.m_crc32 = AZ::Crc32(pFileEntry->desc.lCRC32);
+        outData.m_compressionMethod = pFileEntry->nMethod;
+        outData.m_data.resize_no_construct(pFileEntry->desc.lSizeCompressed);
+        if (outData.m_data.empty())
+        {
+            return ZD_ERROR_SUCCESS;
+        }
+        return ReadFile(pFileEntry, outData.m_data.data(), nullptr);
+    }
+
+    ErrorEnum Cache::ReadFileRange(FileEntry* pFileEntry, void* pBuffer, uint64_t nOffset, uint64_t nSize)
+    {
+        if (!pFileEntry || !pBuffer || pFileEntry->nMethod != ZipFile::METHOD_STORE)
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
+        if (nOffset + nSize > pFileEntry->desc.lSizeUncompressed)
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
+        if (nSize == 0)
+        {
+            return ZD_ERROR_SUCCESS;
+        }
+
+        ErrorEnum nError = Refresh(pFileEntry);
+        if (nError != ZD_ERROR_SUCCESS)
+        {
+            return nError;
+        }
+
+        if (const uint8_t* pMappedData = GetMappedData(pFileEntry))
+        {
+            memcpy(pBuffer, pMappedData + nOffset, nSize);
+            return ZD_ERROR_SUCCESS;
+        }
+
+        if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset + nOffset, AZ::IO::SeekType::SeekFromStart))
+        {
+            return ZD_ERROR_IO_FAILED;
+        }
+
+        if (!AZ::IO::FileIOBase::GetDirectInstance()->Read(m_fileHandle, pBuffer, nSize, true))
+        {
+            return ZD_ERROR_IO_FAILED;
+        }
+        return ZD_ERROR_SUCCESS;
+    }
+
+    const void* Cache::GetMappedFileData(FileEntry* pFileEntry)
+    {
+        if (!pFileEntry || pFileEntry->nMethod != ZipFile::METHOD_STORE || !m_mappedFile.IsOpen())
+        {
+            return nullptr;
+        }
+
+        if (Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return nullptr;
+        }
+        return GetMappedData(pFileEntry);
+    }
+
+    const uint8_t* Cache::GetMappedData(FileEntry* pFileEntry) const
+    {
+        if (!m_mappedFile.IsOpen() || pFileEntry->nFileDataOffset == FileEntryBase::INVALID_DATA_OFFSET)
+        {
+            return nullptr;
+        }
+
+        const uint64_t nDataEnd = static_cast<uint64_t>(pFileEntry->nFileDataOffset) + pFileEntry->desc.lSizeCompressed;
+        if (nDataEnd > m_mappedFile.GetSize())
+        {
+            AZ_Warning("Archive", false, "File data at offset %" PRIu32 " is outside the bounds of archive %s", pFileEntry->nFileDataOffset, m_strFilePath.c_str());
+            return nullptr;
+        }
+        return m_mappedFile.GetData() + pFileEntry->nFileDataOffset;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // finds the file by exact path
     FileEntry* Cache::FindFile(AZStd::string_view szPathSrc, [[maybe_unused]] bool bFullInfo)
     {
         AZ::IO::PathView szPath{ szPathSrc };
 
-        ZipDir::FindFile fd(GetRoot());
-        FileEntry* fileEntry = fd.FindExact(szPath);
+        FileEntry* fileEntry = nullptr;
+        if (!m_fileEntryIndex.empty())
+        {
+            if (auto it = m_fileEntryIndex.find(szPath); it != m_fileEntryIndex.end())
+            {
+                fileEntry = it->second;
+            }
+        }
+        else
+        {
+            ZipDir::FindFile fd(GetRoot());
+            fileEntry = fd.FindExact(szPath);
+        }
         if (!fileEntry)
         {
             if (az_archive_zip_directory_cache_verbosity)
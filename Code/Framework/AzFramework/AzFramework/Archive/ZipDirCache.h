@@ -16,6 +16,7 @@
 #pragma once
 
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/MappedFile.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/unordered_set.h>
@@ -55,6 +56,14 @@ namespace AZ::IO::ZipDir
         // adds a directory (creates several nested directories if needed)
         ErrorEnum UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = ZipFile::METHOD_STORE, int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB);
 
+        // Compresses the data of a file so it can be added with UpdateCompressedFile
+        // doesn't access any archive, so files can be compressed on several threads while another thread writes them
+        static ErrorEnum CompressFileData(CompressedFileData& outData, AZStd::vector<char>&& uncompressed, uint32_t nCompressionMethod = ZipFile::METHOD_STORE, int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB);
+
+        // Adds a new file to the zip or update an existing one, with data that's already compressed
+        // the data either comes from CompressFileData or from ReadCompressedFileData on another archive
+        ErrorEnum UpdateCompressedFile(AZStd::string_view szRelativePath, const CompressedFileData& data);
+
         //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
         ErrorEnum StartContinuousFileUpdate(AZStd::string_view szRelativePath, uint64_t nSize);
 
@@ -82,6 +91,22 @@ namespace AZ::IO::ZipDir
 
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
+        // reads the data of a file entry without uncompressing it, so it can be copied to another archive with UpdateCompressedFile
+        ErrorEnum ReadCompressedFileData(FileEntry* pFileEntry, CompressedFileData& outData);
+
+        // reads nSize bytes starting at nOffset from a stored (uncompressed) file entry
+        ErrorEnum ReadFileRange(FileEntry* pFileEntry, void* pBuffer, uint64_t nOffset, uint64_t nSize);
+
+        // returns a pointer to the data of a stored (uncompressed) file entry inside the memory mapped archive,
+        // or nullptr if the archive isn't memory mapped or the file entry is compressed.
+        // The data is read-only and stays valid for as long as this cache is alive.
+        const void* GetMappedFileData(FileEntry* pFileEntry);
+
+        bool IsMemoryMapped() const
+        {
+            return m_mappedFile.IsOpen();
+        }
+
         void Free(void* ptr)
         {
             azfree(ptr);
@@ -118,6 +143,10 @@ namespace AZ::IO::ZipDir
         // writes out the file data in the queue into the given file. Empties the queue
         bool WriteZipFiles(AZStd::vector<AZStd::intrusive_ptr<FileDataRecord>>& queFiles, AZ::IO::HandleType fTmp);
 
+        // returns the compressed data of the file entry inside the memory mapped archive, or nullptr if the archive
+        // isn't memory mapped or the entry doesn't fit inside the mapping
+        const uint8_t* GetMappedData(FileEntry* pFileEntry) const;
+
         bool WriteCompressedData(uint8_t* data, size_t size, bool encrypt);
         bool WriteNullData(size_t size);
 
@@ -125,14 +154,24 @@ namespace AZ::IO::ZipDir
         ZipFile::CrySignedCDRHeader& GetSignedHeader() { return m_headerSignature; }
         ZipFile::CryCustomExtendedHeader& GetExtendedHeader() { return m_headerExtended; }
 
-        size_t GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec);
+        static size_t GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec);
+
+        // compresses nSize bytes with the codec, returns one of the Z_* errors (Z_OK upon success)
+        static int CompressData(const void* pUncompressed, size_t nSize, void* pCompressed, size_t* pSizeCompressed, int nCompressionLevel, CompressionCodec::Codec codec);
+
+        // writes the (compressed) data of a file and creates or updates its entry
+        ErrorEnum WriteFileData(AZStd::string_view szRelativePath, const void* dataBuffer, size_t nSizeCompressed, uint64_t nSize, AZ::Crc32 dwCRC32, uint32_t nCompressionMethod);
 
     protected:
         friend class CacheFactory;
         friend class FileEntryTransactionAdd;
         FileEntryTree m_treeDir;
+        // flat index over the full paths in m_treeDir for read-only caches. Empty if the tree needs to be searched instead
+        FileEntryIndex m_fileEntryIndex;
         AZ::IO::HandleType m_fileHandle = AZ::IO::InvalidHandle;
         AZ::IO::Path m_strFilePath;
+        // read-only archives are memory mapped so reads don't need to go through the file handle
+        AZ::IO::MappedFile m_mappedFile;
 
         // String Pool for persistently storing paths as long as they reside in the cache
         AZStd::unordered_set<AZ::IO::Path> m_relativePathPool;
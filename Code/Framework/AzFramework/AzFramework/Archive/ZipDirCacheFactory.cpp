@@ -26,6 +26,10 @@
 
 namespace AZ::IO::ZipDir
 {
+    AZ_CVAR(bool, az_archive_memory_map, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled, read-only archives are memory mapped and files stored without compression are read\n"
+        "straight from the mapping instead of through a seek and read on the archive file handle.");
+
     // this sets the window size of the blocks of data read from the end of the file to find the Central Directory Record
     // since normally there are no
     static constexpr size_t CDRSearchWindowSize = 0x100;
@@ -34,6 +38,7 @@ namespace AZ::IO::ZipDir
         m_nCDREndPos = 0;
         m_bBuildFileEntryMap = false; // we only need it for validation/debugging
         m_bBuildFileEntryTree = true; // we need it to actually build the optimized structure of directories
+        m_bBuildFileEntryIndex = (nFlags & FLAGS_READ_ONLY) != 0; // read-only caches use a flat index for fast lookups
         m_bBuildOptimizedFileEntry = false;
         m_nInitMethod = nInitMethod;
         m_nFlags = nFlags;
@@ -89,6 +94,15 @@ namespace AZ::IO::ZipDir
                 AZ_Warning("Archive", false, R"(ZD_ERROR_IO_FAILED: Could not read the CDR of the pack file "%s".)", pCache->m_strFilePath.c_str());
                 return {};
             }
+
+            if (az_archive_memory_map)
+            {
+                // The mapping is an optimization only, so if it fails the reads fall back to the file handle
+                if (auto resolvedPath = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(AZ::IO::PathView(szFileName)); resolvedPath)
+                {
+                    pCache->m_mappedFile.Open(resolvedPath->c_str());
+                }
+            }
         }
         else
         {
@@ -164,6 +178,7 @@ namespace AZ::IO::ZipDir
         Adjuster.RefreshEOFOffsets();
 
         m_treeFileEntries.Swap(rwCache.m_treeDir);
+        m_fileEntryIndex.swap(rwCache.m_fileEntryIndex);
         m_CDR_buffer.swap(rwCache.m_CDR_buffer);   // CDR Buffer contain actually the string pool for the tree directory.
 
         // very important: we need this offset to be able to add to the zip file
@@ -313,6 +328,7 @@ namespace AZ::IO::ZipDir
         memset(&m_CDREnd, 0, sizeof(m_CDREnd));
         m_mapFileEntries.clear();
         m_treeFileEntries.Clear();
+        m_fileEntryIndex.clear();
         m_encryptedHeaders = ZipFile::HEADERS_NOT_ENCRYPTED;
     }
 
@@ -471,6 +487,11 @@ namespace AZ::IO::ZipDir
             return false;
         }
 
+        if (m_bBuildFileEntryIndex)
+        {
+            m_fileEntryIndex.reserve(m_CDREnd.numEntriesTotal);
+        }
+
         // now we've read the complete CDR - parse it.
         ZipFile::CDRFileHeader* pFile = (ZipFile::CDRFileHeader*)(&pBuffer[0]);
         const uint8_t* pEndOfData = &pBuffer[0] + m_CDREnd.lCDRSize;
@@ -574,7 +595,17 @@ namespace AZ::IO::ZipDir
 
         if (m_bBuildFileEntryTree)
         {
-            m_treeFileEntries.Add(strFilePath, fileEntry);
+            FileEntry* pFile = m_treeFileEntries.Add(strFilePath);
+            // if the path is already in the archive the first entry is kept
+            if (pFile && !pFile->IsInitialized())
+            {
+                static_cast<FileEntryBase&>(*pFile) = fileEntry;
+                if (m_bBuildFileEntryIndex)
+                {
+                    // the path points into the CDR buffer, which is moved into the cache together with the tree
+                    m_fileEntryIndex.emplace(AZ::IO::PathView(strFilePath), pFile);
+                }
+            }
         }
     }
 
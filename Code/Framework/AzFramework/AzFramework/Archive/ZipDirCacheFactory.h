@@ -95,11 +95,14 @@ namespace AZ::IO::ZipDir
         FileEntryMap m_mapFileEntries;
 
         FileEntryTree m_treeFileEntries;
+        // only built for read-only caches, as those can't change after they're read
+        FileEntryIndex m_fileEntryIndex;
 
         AZStd::vector<uint8_t> m_CDR_buffer;
 
         bool m_bBuildFileEntryMap;
         bool m_bBuildFileEntryTree;
+        bool m_bBuildFileEntryIndex;
         bool m_bBuildOptimizedFileEntry;
         ZipFile::EHeaderEncryptionType m_encryptedHeaders;
         ZipFile::EHeaderSignatureType m_signedHeaders;
@@ -828,6 +828,12 @@ namespace AZ::IO::ZipDir
     // sets the current time to modification time
     // calculates CRC32 for the new data
     void FileEntry::OnNewFileData(const void* pUncompressed, uint64_t nSize, uint64_t nCompressedSize, uint32_t nCompressionMethod, bool bContinuous)
+    {
+        // we'll need CRC32 of the file to pack it
+        OnNewFileData(AZ::Crc32(pUncompressed, nSize), nSize, nCompressedSize, nCompressionMethod, bContinuous);
+    }
+
+    void FileEntry::OnNewFileData(AZ::Crc32 dwCRC32, uint64_t nSize, uint64_t nCompressedSize, uint32_t nCompressionMethod, bool bContinuous)
     {
         time_t nTime;
         time(&nTime);
@@ -848,8 +854,7 @@ namespace AZ::IO::ZipDir
             this->desc.lSizeUncompressed = aznumeric_cast<uint32_t>(nSize);
         }
 
-        // we'll need CRC32 of the file to pack it
-        this->desc.lCRC32 = AZ::Crc32(pUncompressed, nSize);
+        this->desc.lCRC32 = dwCRC32;
 
         this->nMethod = static_cast<uint16_t>(nCompressionMethod);
     }
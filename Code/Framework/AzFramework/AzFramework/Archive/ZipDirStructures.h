@@ -15,6 +15,8 @@
 #include <AzCore/base.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
 
@@ -159,6 +161,17 @@ namespace AZ::IO::ZipDir
     // fread wrapper with file in memory  support
     int64_t FRead(CZipFile* zipFile, void* data, size_t nElemSize, size_t nCount);
 
+    // the data of a file that's compressed before it's added to an archive with Cache::UpdateCompressedFile,
+    // so files can be compressed on other threads than the one writing the archive
+    struct CompressedFileData
+    {
+        // the compressed data, or the uncompressed data when the method is METHOD_STORE
+        AZStd::vector<char> m_data;
+        uint64_t m_uncompressedSize = 0;
+        AZ::Crc32 m_crc32;
+        uint32_t m_compressionMethod = ZipFile::METHOD_STORE;
+    };
+
     // ftell wrapper with file in memory support
     int64_t FTell(CZipFile* zipFile);
 
@@ -227,6 +240,10 @@ namespace AZ::IO::ZipDir
         // calculates CRC32 for the new data
         void OnNewFileData(const void* pUncompressed, uint64_t nSize, uint64_t nCompressedSize, uint32_t nCompressionMethod, bool bContinuous);
 
+        // sets the current time to modification time
+        // uses the CRC32 that was already calculated for the new data
+        void OnNewFileData(AZ::Crc32 dwCRC32, uint64_t nSize, uint64_t nCompressedSize, uint32_t nCompressionMethod, bool bContinuous);
+
         uint64_t GetModificationTime();
 
         bool IsCompressed() const
@@ -12,6 +12,7 @@
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -80,4 +81,8 @@ namespace AZ::IO::ZipDir
         SubdirMap m_mapDirs;
         FileMap m_mapFiles;
     };
+
+    // flat lookup table of full relative paths to the file entries owned by a FileEntryTree.
+    // The paths are hashed and compared with the same rules as the tree so lookups give the same result
+    using FileEntryIndex = AZStd::unordered_map<AZ::IO::PathView, FileEntry*>;
 }
@@ -600,19 +600,27 @@ namespace AzFramework
                     prevRegistry = AZStd::move(m_registry);
                     m_registry.reset(aznew AssetRegistry());
                 }
-                AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
+                if (AssetRegistry::IsBinaryCatalog(bytes))
+                {
+                    // Catalogs written by the Asset Processor use the binary format, which is read without going through the ObjectStream.
+                    m_registry->LoadFromBinaryCatalog(bytes);
+                }
+                else
+                {
+                    AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
 #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
-                ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
-                    AZStd::chrono::milliseconds(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING_INTERVAL_MS),
-                    [this, &catalogStream, &serializeContext]
-                    {
-                        AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
-                    },
-                        "Asset Catalog Loading Thread"
-                        );
+                    ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
+                        AZStd::chrono::milliseconds(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING_INTERVAL_MS),
+                        [this, &catalogStream, &serializeContext]
+                        {
+                            AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+                        },
+                            "Asset Catalog Loading Thread"
+                            );
 #else
-                AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+                    AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
 #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
+                }
 
                 AZ_TracePrintf("AssetCatalog", "Loaded registry containing %u assets.\n", m_registry->m_assetIdToInfo.size());
 
@@ -836,8 +844,8 @@ namespace AzFramework
                     if (!isNewAsset && isCatalogInitialize)
                     {
                         // Nothing to do here - catalog initialize messages are intended to sync with the AP catalog.
-                        // Since this asset is already known, just stop processing to avoid triggering reloads.
-                        return;
+                        // Since this asset is already known, just skip it to avoid triggering reloads.
+                        continue;
                     }
 
 #if defined(AZ_ENABLE_TRACING)
@@ -170,6 +170,29 @@ namespace AzFramework
             }
         }
 
+        //---------------------------------------------------------------------
+        RequestPrefetchAssets::RequestPrefetchAssets(AZStd::vector<AZ::Uuid> assetUuids)
+            : BaseAssetProcessorMessage(true)
+            , m_assetUuids(AZStd::move(assetUuids))
+        {
+        }
+
+        unsigned int RequestPrefetchAssets::GetMessageType() const
+        {
+            return RequestPrefetchAssets::MessageType;
+        }
+
+        void RequestPrefetchAssets::Reflect(AZ::ReflectContext* context)
+        {
+            auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
+            if (serialize)
+            {
+                serialize->Class<RequestPrefetchAssets, BaseAssetProcessorMessage>()
+                    ->Version(1)
+                    ->Field("AssetUuids", &RequestPrefetchAssets::m_assetUuids);
+            }
+        }
+
         //---------------------------------------------------------------------
         void RequestAssetProcessorStatus::Reflect(AZ::ReflectContext* context)
         {
@@ -1609,9 +1632,10 @@ namespace AzFramework
             if (serialize)
             {
                 serialize->Class<BulkAssetNotificationMessage, BaseAssetProcessorMessage>()
-                    ->Version(1)
+                    ->Version(2)
                     ->Field("Type", &BulkAssetNotificationMessage::m_type)
-                    ->Field("Messages", &BulkAssetNotificationMessage::m_messages);
+                    ->Field("Messages", &BulkAssetNotificationMessage::m_messages)
+                    ->Field("IsCatalogInitialize", &BulkAssetNotificationMessage::m_isCatalogInitialize);
             }
         }
 
@@ -177,6 +177,28 @@ namespace AzFramework
             AZ::OSString m_searchTerm; // the name of a source file, or a heuristic
         };
 
+        /**
+        * Used to hint the AP that a set of assets is about to be needed, for example the assets referenced by a level that is being opened.
+        * Any queued jobs of those assets are moved ahead of the regular jobs, but stay behind assets that were explicitly escalated.
+        * Like RequestEscalateAsset, there is no response to this request and it doesn't fence.
+        */
+        class RequestPrefetchAssets
+            : public BaseAssetProcessorMessage
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(RequestPrefetchAssets, AZ::OSAllocator);
+            AZ_RTTI(RequestPrefetchAssets, "{57021CC4-351E-48F6-963E-560A059DBD70}", BaseAssetProcessorMessage);
+            static void Reflect(AZ::ReflectContext* context);
+            static constexpr unsigned int MessageType = AZ_CRC_CE("AssetSystem::RequestPrefetchAssets");
+
+            RequestPrefetchAssets() = default;
+            ~RequestPrefetchAssets() override = default;
+            explicit RequestPrefetchAssets(AZStd::vector<AZ::Uuid> assetUuids);
+            unsigned int GetMessageType() const override;
+
+            AZStd::vector<AZ::Uuid> m_assetUuids; // the uuids of the assets, which are the uuids of their source files.
+        };
+
 
         //////////////////////////////////////////////////////////////////////////
         //! Request the status of the asset processor
@@ -644,6 +666,9 @@ namespace AzFramework
 
             AssetNotificationMessage::NotificationType m_type;
             AZStd::vector<AssetNotificationMessage> m_messages;
+            //! True when the messages only sync a newly connected tool with the catalog,
+            //! false when they are live updates that need to notify about changed assets.
+            bool m_isCatalogInitialize = true;
         };
 
         // SaveAssetCatalogRequest
@@ -8,11 +8,13 @@
  */
 
 #include <AzFramework/Asset/AssetRegistry.h>
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/ranges/transform_view.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/IO/SystemFile.h> // for max path
+#include <AzCore/std/sort.h>
 
 namespace AssetRegistryInternal
 {
@@ -42,6 +44,136 @@ namespace AssetRegistryInternal
 
         return AZ::Uuid::CreateData(name | AZStd::views::transform(TransformPath));
     }
+
+    // The binary catalog starts with this signature, followed by the header. All values are stored little endian.
+    // Records are written member by member, so their stride doesn't depend on the struct alignment of the platform.
+    constexpr char BinaryCatalogSignature[8] = { 'A', 'Z', 'B', 'C', 'A', 'T', 'L', 'G' };
+    constexpr AZ::u32 BinaryCatalogVersion = 1;
+
+    struct BinaryCatalogHeader
+    {
+        AZ::u32 m_version = BinaryCatalogVersion;
+        AZ::u32 m_assetInfoCount = 0;
+        AZ::u32 m_pathCount = 0;
+        AZ::u32 m_legacyIdCount = 0;
+        AZ::u32 m_realIdToLegacyIdCount = 0;
+        AZ::u32 m_dependencyListCount = 0;
+        AZ::u32 m_dependencyCount = 0;
+        AZ::u32 m_stringTableSize = 0;
+    };
+
+    class BinaryCatalogWriter
+    {
+    public:
+        explicit BinaryCatalogWriter(AZStd::vector<char>& buffer)
+            : m_buffer(buffer)
+        {
+        }
+
+        template<typename T>
+        void Write(const T& value)
+        {
+            static_assert(AZStd::is_trivially_copyable_v<T>, "Only trivially copyable values can be written to a binary catalog.");
+            const size_t offset = m_buffer.size();
+            m_buffer.resize_no_construct(offset + sizeof(T));
+            memcpy(m_buffer.data() + offset, &value, sizeof(T));
+        }
+
+        void Write(const AZ::Data::AssetId& assetId)
+        {
+            Write(assetId.m_guid);
+            Write(assetId.m_subId);
+        }
+
+        void WriteBytes(const char* data, size_t size)
+        {
+            m_buffer.insert(m_buffer.end(), data, data + size);
+        }
+
+    private:
+        AZStd::vector<char>& m_buffer;
+    };
+
+    class BinaryCatalogReader
+    {
+    public:
+        explicit BinaryCatalogReader(AZStd::span<const char> buffer)
+            : m_buffer(buffer)
+        {
+        }
+
+        template<typename T>
+        T Read()
+        {
+            static_assert(AZStd::is_trivially_copyable_v<T>, "Only trivially copyable values can be read from a binary catalog.");
+            T value{};
+            if (sizeof(T) > m_buffer.size() - m_offset)
+            {
+                m_isValid = false;
+                return value;
+            }
+            memcpy(&value, m_buffer.data() + m_offset, sizeof(T));
+            m_offset += sizeof(T);
+            return value;
+        }
+
+        AZ::Data::AssetId ReadAssetId()
+        {
+            AZ::Data::AssetId assetId;
+            assetId.m_guid = Read<AZ::Uuid>();
+            assetId.m_subId = Read<AZ::u32>();
+            return assetId;
+        }
+
+        AZStd::span<const char> ReadBytes(size_t size)
+        {
+            if (size > m_buffer.size() - m_offset)
+            {
+                m_isValid = false;
+                return {};
+            }
+            AZStd::span<const char> bytes = m_buffer.subspan(m_offset, size);
+            m_offset += size;
+            return bytes;
+        }
+
+        //! Returns false if the reader tried to read past the end of the buffer.
+        bool IsValid() const
+        {
+            return m_isValid;
+        }
+
+    private:
+        AZStd::span<const char> m_buffer;
+        size_t m_offset = 0;
+        bool m_isValid = true;
+    };
+
+    //! Returns pointers to all entries of the map, sorted by their keys.
+    //! Entries with equal keys, which only exist in multimaps, are sorted by their values, so the order is always deterministic.
+    template<typename Map>
+    AZStd::vector<const typename Map::value_type*> GetSortedEntries(const Map& map)
+    {
+        AZStd::vector<const typename Map::value_type*> entries;
+        entries.reserve(map.size());
+        for (const auto& entry : map)
+        {
+            entries.push_back(&entry);
+        }
+        AZStd::sort(entries.begin(), entries.end(),
+            [](const typename Map::value_type* lhs, const typename Map::value_type* rhs)
+            {
+                if constexpr (AZStd::is_same_v<typename Map::key_type, typename Map::mapped_type>)
+                {
+                    if (!(lhs->first < rhs->first) && !(rhs->first < lhs->first))
+                    {
+                        return lhs->second < rhs->second;
+                    }
+                }
+                return lhs->first < rhs->first;
+            });
+        return entries;
+    }
 }
 
 namespace AzFramework
@@ -232,6 +364,220 @@ namespace AzFramework
         m_assetPathToId.insert_key(CreateUUIDForName(assetPath)).first->second = AZStd::move(id);
     }
 
+    void AssetRegistry::SaveToBinaryCatalog(AZStd::vector<char>& outBuffer) const
+    {
+        const auto assetInfos = GetSortedEntries(m_assetIdToInfo);
+        const auto paths = GetSortedEntries(m_assetPathToId);
+        const auto legacyIds = GetSortedEntries(m_legacyAssetIdToRealAssetId);
+        const auto realIdsToLegacyIds = GetSortedEntries(m_realAssetIdToLegacyAssetIdMap);
+        // The order of the dependencies within each list is kept.
+        const auto dependencyLists = GetSortedEntries(m_assetDependencies);
+
+        size_t dependencyCount = 0;
+        for (const auto* dependencyList : dependencyLists)
+        {
+            dependencyCount += dependencyList->second.size();
+        }
+
+        size_t stringTableSize = 0;
+        for (const auto* assetInfo : assetInfos)
+        {
+            stringTableSize += assetInfo->second.m_relativePath.size();
+        }
+
+        BinaryCatalogHeader header;
+        header.m_assetInfoCount = aznumeric_cast<AZ::u32>(assetInfos.size());
+        header.m_pathCount = aznumeric_cast<AZ::u32>(paths.size());
+        header.m_legacyIdCount = aznumeric_cast<AZ::u32>(legacyIds.size());
+        header.m_realIdToLegacyIdCount = aznumeric_cast<AZ::u32>(realIdsToLegacyIds.size());
+        header.m_dependencyListCount = aznumeric_cast<AZ::u32>(dependencyLists.size());
+        header.m_dependencyCount = aznumeric_cast<AZ::u32>(dependencyCount);
+        header.m_stringTableSize = aznumeric_cast<AZ::u32>(stringTableSize);
+
+        outBuffer.clear();
+        BinaryCatalogWriter writer(outBuffer);
+        writer.WriteBytes(BinaryCatalogSignature, sizeof(BinaryCatalogSignature));
+        writer.Write(header);
+
+        AZ::u32 stringOffset = 0;
+        for (const auto* assetInfo : assetInfos)
+        {
+            const AZ::u32 pathLength = aznumeric_cast<AZ::u32>(assetInfo->second.m_relativePath.size());
+            writer.Write(assetInfo->first);
+            writer.Write(assetInfo->second.m_assetId);
+            writer.Write(assetInfo->second.m_assetType);
+            writer.Write(assetInfo->second.m_sizeBytes);
+            writer.Write(stringOffset);
+            writer.Write(pathLength);
+            stringOffset += pathLength;
+        }
+
+        for (const auto* path : paths)
+        {
+            writer.Write(path->first);
+            writer.Write(path->second);
+        }
+
+        for (const auto* legacyId : legacyIds)
+        {
+            writer.Write(legacyId->first);
+            writer.Write(legacyId->second);
+        }
+
+        for (const auto* realIdToLegacyId : realIdsToLegacyIds)
+        {
+            writer.Write(realIdToLegacyId->first);
+            writer.Write(realIdToLegacyId->second);
+        }
+
+        for (const auto* dependencyList : dependencyLists)
+        {
+            writer.Write(dependencyList->first);
+            writer.Write(aznumeric_cast<AZ::u32>(dependencyList->second.size()));
+        }
+
+        for (const auto* dependencyList : dependencyLists)
+        {
+            for (const AZ::Data::ProductDependency& dependency : dependencyList->second)
+            {
+                writer.Write(dependency.m_assetId);
+                writer.Write(dependency.m_flags.to_ullong());
+            }
+        }
+
+        for (const auto* assetInfo : assetInfos)
+        {
+            writer.WriteBytes(assetInfo->second.m_relativePath.data(), assetInfo->second.m_relativePath.size());
+        }
+    }
+
+    bool AssetRegistry::LoadFromBinaryCatalog(AZStd::span<const char> buffer)
+    {
+        auto clearAll = [this]()
+        {
+            Clear();
+            m_legacyAssetIdToRealAssetId = {};
+            m_realAssetIdToLegacyAssetIdMap = {};
+        };
+        clearAll();
+
+        if (!IsBinaryCatalog(buffer))
+        {
+            AZ_Error("AssetRegistry", false, "The buffer doesn't contain a binary asset catalog.");
+            return false;
+        }
+
+        BinaryCatalogReader reader(buffer.subspan(sizeof(BinaryCatalogSignature)));
+        const BinaryCatalogHeader header = reader.Read<BinaryCatalogHeader>();
+        if (header.m_version != BinaryCatalogVersion)
+        {
+            AZ_Error("AssetRegistry", false, "Unsupported binary asset catalog version %u, expected version %u.", header.m_version, BinaryCatalogVersion);
+            return false;
+        }
+
+        // The string table is stored after all records, so it's looked up separately to fill in the paths while reading the asset infos.
+        constexpr size_t AssetInfoRecordSize = (sizeof(AZ::Uuid) + sizeof(AZ::u32)) * 2 + sizeof(AZ::Uuid) + sizeof(AZ::u64) + sizeof(AZ::u32) * 2;
+        constexpr size_t AssetIdPairRecordSize = (sizeof(AZ::Uuid) + sizeof(AZ::u32)) * 2;
+        constexpr size_t PathRecordSize = sizeof(AZ::Uuid) * 2 + sizeof(AZ::u32);
+        constexpr size_t DependencyListRecordSize = sizeof(AZ::Uuid) + sizeof(AZ::u32) * 2;
+        constexpr size_t DependencyRecordSize = sizeof(AZ::Uuid) + sizeof(AZ::u32) + sizeof(AZ::u64);
+        const size_t recordsSize = header.m_assetInfoCount * AssetInfoRecordSize + header.m_pathCount * PathRecordSize +
+            (header.m_legacyIdCount + header.m_realIdToLegacyIdCount) * AssetIdPairRecordSize +
+            header.m_dependencyListCount * DependencyListRecordSize + header.m_dependencyCount * DependencyRecordSize;
+        const size_t stringTableOffset = sizeof(BinaryCatalogSignature) + sizeof(BinaryCatalogHeader) + recordsSize;
+        if (stringTableOffset + header.m_stringTableSize != buffer.size())
+        {
+            AZ_Error("AssetRegistry", false, "The binary asset catalog is truncated or corrupted.");
+            return false;
+        }
+        const AZStd::span<const char> stringTable = buffer.subspan(stringTableOffset, header.m_stringTableSize);
+
+        // Reserve all maps up front, so they don't rehash while hundreds of thousands of entries get added.
+        m_assetIdToInfo.reserve(header.m_assetInfoCount);
+        for (AZ::u32 i = 0; i < header.m_assetInfoCount; ++i)
+        {
+            const AZ::Data::AssetId id = reader.ReadAssetId();
+            AZ::Data::AssetInfo& assetInfo = m_assetIdToInfo.insert_key(id).first->second;
+            assetInfo.m_assetId = reader.ReadAssetId();
+            assetInfo.m_assetType = reader.Read<AZ::Uuid>();
+            assetInfo.m_sizeBytes = reader.Read<AZ::u64>();
+            const AZ::u32 pathOffset = reader.Read<AZ::u32>();
+            const AZ::u32 pathLength = reader.Read<AZ::u32>();
+            if (pathLength > stringTable.size() || pathOffset > stringTable.size() - pathLength)
+            {
+                AZ_Error("AssetRegistry", false, "The binary asset catalog contains an invalid path for asset %s.", id.ToString<AZStd::string>().c_str());
+                clearAll();
+                return false;
+            }
+            assetInfo.m_relativePath.assign(stringTable.data() + pathOffset, pathLength);
+        }
+
+        m_assetPathToId.reserve(header.m_pathCount);
+        for (AZ::u32 i = 0; i < header.m_pathCount; ++i)
+        {
+            const AZ::Uuid pathHash = reader.Read<AZ::Uuid>();
+            m_assetPathToId.insert_key(pathHash).first->second = reader.ReadAssetId();
+        }
+
+        m_legacyAssetIdToRealAssetId.reserve(header.m_legacyIdCount);
+        for (AZ::u32 i = 0; i < header.m_legacyIdCount; ++i)
+        {
+            const AZ::Data::AssetId legacyId = reader.ReadAssetId();
+            m_legacyAssetIdToRealAssetId.insert_key(legacyId).first->second = reader.ReadAssetId();
+        }
+
+        m_realAssetIdToLegacyAssetIdMap.reserve(header.m_realIdToLegacyIdCount);
+        for (AZ::u32 i = 0; i < header.m_realIdToLegacyIdCount; ++i)
+        {
+            const AZ::Data::AssetId realId = reader.ReadAssetId();
+            const AZ::Data::AssetId legacyId = reader.ReadAssetId();
+            m_realAssetIdToLegacyAssetIdMap.emplace(realId, legacyId);
+        }
+
+        AZStd::vector<AZStd::vector<AZ::Data::ProductDependency>*> dependencyLists;
+        dependencyLists.reserve(header.m_dependencyListCount);
+        m_assetDependencies.reserve(header.m_dependencyListCount);
+        size_t totalDependencyCount = 0;
+        for (AZ::u32 i = 0; i < header.m_dependencyListCount; ++i)
+        {
+            const AZ::Data::AssetId id = reader.ReadAssetId();
+            const AZ::u32 dependencyCount = reader.Read<AZ::u32>();
+            totalDependencyCount += dependencyCount;
+            if (totalDependencyCount > header.m_dependencyCount)
+            {
+                AZ_Error("AssetRegistry", false, "The binary asset catalog contains an invalid dependency count for asset %s.", id.ToString<AZStd::string>().c_str());
+                clearAll();
+                return false;
+            }
+            AZStd::vector<AZ::Data::ProductDependency>& dependencies = m_assetDependencies[id];
+            dependencies.resize(dependencyCount);
+            dependencyLists.push_back(&dependencies);
+        }
+
+        for (AZStd::vector<AZ::Data::ProductDependency>* dependencies : dependencyLists)
+        {
+            for (AZ::Data::ProductDependency& dependency : *dependencies)
+            {
+                dependency.m_assetId = reader.ReadAssetId();
+                dependency.m_flags = AZStd::bitset<64>(reader.Read<AZ::u64>());
+            }
+        }
+
+        if (!reader.IsValid() || totalDependencyCount != header.m_dependencyCount)
+        {
+            AZ_Error("AssetRegistry", false, "The binary asset catalog is truncated or corrupted.");
+            clearAll();
+            return false;
+        }
+        return true;
+    }
+
+    bool AssetRegistry::IsBinaryCatalog(AZStd::span<const char> buffer)
+    {
+        return buffer.size() >= sizeof(BinaryCatalogSignature) + sizeof(BinaryCatalogHeader) &&
+            memcmp(buffer.data(), BinaryCatalogSignature, sizeof(BinaryCatalogSignature)) == 0;
+    }
+
     void AssetRegistry::AddRegistry(AZStd::shared_ptr<AssetRegistry> assetRegistry)
     {
         for (const auto& element : assetRegistry->m_assetIdToInfo)
@@ -11,6 +11,7 @@
 
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
@@ -63,6 +64,18 @@ namespace AzFramework
 
         static void ReflectSerialize(AZ::SerializeContext* serializeContext);
 
+        //! Writes the registry in the binary catalog format, which is much faster to load than the ObjectStream format.
+        //! The format consists of fixed-stride records followed by a string table for the relative paths.
+        //! Records are sorted by their keys, so the output doesn't depend on the iteration order of the maps.
+        void SaveToBinaryCatalog(AZStd::vector<char>& outBuffer) const;
+
+        //! Replaces the contents of the registry with the binary catalog stored in the buffer.
+        //! Returns false and leaves the registry empty if the buffer isn't a valid binary catalog.
+        bool LoadFromBinaryCatalog(AZStd::span<const char> buffer);
+
+        //! Returns true if the buffer starts with the signature of the binary catalog format.
+        static bool IsBinaryCatalog(AZStd::span<const char> buffer);
+
     private:
         // Add another registry to our existing registry data.  Intended to be called by AssetCatalog::AddDeltaCatalog
         void AddRegistry(AZStd::shared_ptr<AssetRegistry> assetRegistry);
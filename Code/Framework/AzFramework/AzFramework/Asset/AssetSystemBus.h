@@ -266,6 +266,13 @@ namespace AzFramework
              **/
             virtual bool EscalateAssetBySearchTerm(AZStd::string_view searchTerm) = 0;
 
+            /** Hint that a set of assets is about to be needed, for example all the assets referenced by a level that is being opened.
+             *  Queued jobs of those assets are moved ahead of the regular jobs, but behind explicitly escalated assets.
+             *  This is an async request - the return value only indicates whether it was sent.
+             *  @param assetUuids - the uuids of the assets, which are the m_guid part of their AssetIds.
+            **/
+            virtual bool PrefetchAssetsByUuid(const AZStd::vector<AZ::Uuid>& assetUuids) = 0;
+
             //! Show the AssetProcessor App
             virtual void ShowAssetProcessor() = 0;
             //! Show an asset in the AssetProcessor App
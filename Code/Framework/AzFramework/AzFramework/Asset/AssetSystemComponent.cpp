@@ -206,7 +206,7 @@ namespace AzFramework
                         switch(bulkMessage.m_type)
                         {
                         case AssetNotificationMessage::AssetChanged:
-                            notificationInterface->AssetChanged(bulkMessage.m_messages, true);
+                            notificationInterface->AssetChanged(bulkMessage.m_messages, bulkMessage.m_isCatalogInitialize);
                             break;
                         case AssetNotificationMessage::AssetRemoved:
                             notificationInterface->AssetRemoved(bulkMessage.m_messages);
@@ -246,6 +246,7 @@ namespace AzFramework
             BaseAssetProcessorMessage::Reflect(context);
             RequestAssetStatus::Reflect(context);
             RequestEscalateAsset::Reflect(context);
+            RequestPrefetchAssets::Reflect(context);
             ResponseAssetProcessorStatus::Reflect(context);
             RequestAssetProcessorStatus::Reflect(context);
             ResponseAssetStatus::Reflect(context);
@@ -865,6 +866,18 @@ namespace AzFramework
             return false; // not sent.
         }
 
+        bool AssetSystemComponent::PrefetchAssetsByUuid(const AZStd::vector<AZ::Uuid>& assetUuids)
+        {
+            if (!assetUuids.empty() && ConnectedWithAssetProcessor())
+            {
+                RequestPrefetchAssets request(assetUuids);
+                SendRequest(request);
+                return true;
+            }
+
+            return false; // not sent.
+        }
+
         void AssetSystemComponent::GetUnresolvedProductReferences(AZ::Data::AssetId assetId, AZ::u32& unresolvedAssetIdReferences, AZ::u32& unresolvedPathReferences)
         {
             AZ_Assert(m_socketConn.get(), "SocketConnection doesn't exist!  Ensure AssetSystemComponent::Init was called");
@@ -145,6 +145,7 @@ namespace AzFramework
 
             bool EscalateAssetByUuid(const AZ::Uuid& assetUuid) override;
             bool EscalateAssetBySearchTerm(AZStd::string_view searchTerm) override;
+            bool PrefetchAssetsByUuid(const AZStd::vector<AZ::Uuid>& assetUuids) override;
 
             void ShowAssetProcessor() override;
             void ShowInAssetProcessor(const AZStd::string& assetPath) override;
@@ -8,6 +8,7 @@
 #include <AzFramework/AzFrameworkModule.h>
 
 // Component includes
+#include <AzFramework/Archetype/ArchetypeStorageSystemComponent.h>
 #include <AzFramework/Asset/AssetCatalogComponent.h>
 #include <AzFramework/Asset/CustomAssetTypeComponent.h>
 #include <AzFramework/Asset/AssetSystemComponent.h>
@@ -57,6 +58,7 @@ namespace AzFramework
             AzFramework::AzFrameworkConfigurationSystemComponent::CreateDescriptor(),
 
             AzFramework::OctreeSystemComponent::CreateDescriptor(),
+            AzFramework::ArchetypeStorageSystemComponent::CreateDescriptor(),
             AzFramework::SpawnableSystemComponent::CreateDescriptor(),
             Physics::MaterialSystemComponent::CreateDescriptor(),
         });
@@ -67,6 +69,7 @@ namespace AzFramework
         return AZ::ComponentTypeList
         {
             azrtti_typeid<AzFramework::OctreeSystemComponent>(),
+            azrtti_typeid<AzFramework::ArchetypeStorageSystemComponent>(),
         };
     }
 }
@@ -7,6 +7,7 @@
  */
 
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformUpdateQueueBus.h>
 #include <AzFramework/Visibility/EntityBoundsUnionBus.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -158,6 +159,14 @@ namespace AzFramework
 
     void TransformComponent::Deactivate()
     {
+        if (m_transformUpdateQueued || m_transformUpdateInBatch)
+        {
+            if (AzFramework::ITransformUpdateQueue* updateQueue = AZ::Interface<AzFramework::ITransformUpdateQueue>::Get())
+            {
+                updateQueue->DequeueTransformUpdate(this);
+            }
+        }
+
         AZ::TransformNotificationBus::Event(m_parentId, &AZ::TransformNotificationBus::Events::OnChildRemoved, GetEntityId());
         auto parentTransform = AZ::TransformBus::FindFirstHandler(m_parentId);
         if (parentTransform)
@@ -632,7 +641,8 @@ namespace AzFramework
     {
         // Called when our parent transform changes
         // Ignore the event until we've already derived our local transform.
-        if (m_parentTM)
+        // The update queue already computed our transforms when it's sending the notifications of our parent.
+        if (m_parentTM && !m_transformUpdateInBatch)
         {
             if (m_onParentChangedBehavior == AZ::OnParentChangedBehavior::Update)
             {
@@ -663,6 +673,11 @@ namespace AzFramework
             m_localTM = m_worldTM;
         }
 
+        if (QueueTransformUpdate(true))
+        {
+            return;
+        }
+
         AZ::TransformNotificationBus::Event(
             m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
@@ -685,11 +700,39 @@ namespace AzFramework
             m_worldTM = m_localTM;
         }
 
+        if (QueueTransformUpdate(false))
+        {
+            return;
+        }
+
         AZ::TransformNotificationBus::Event(
             m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
     }
 
+    bool TransformComponent::QueueTransformUpdate(bool keepWorldTM)
+    {
+        // Activation and deactivation keep notifying immediately, as other components expect the transform to be final then.
+        if (!m_entity || m_entity->GetState() != AZ::Entity::State::Active)
+        {
+            return false;
+        }
+
+        AzFramework::ITransformUpdateQueue* updateQueue = AZ::Interface<AzFramework::ITransformUpdateQueue>::Get();
+        if (updateQueue == nullptr)
+        {
+            return false;
+        }
+
+        m_keepWorldTMOnUpdate = keepWorldTM;
+        if (!m_transformUpdateQueued)
+        {
+            m_transformUpdateQueued = true;
+            updateQueue->QueueTransformUpdate(this);
+        }
+        return true;
+    }
+
     bool TransformComponent::AreMoveRequestsAllowed() const
     {
         // Don't allow static transform to be moved while entity is activated.
@@ -25,6 +25,7 @@ namespace AzToolsFramework
 namespace AzFramework
 {
     class GameEntityContextComponent;
+    class TransformUpdateQueue;
 
     /// @deprecated Use AZ::TransformConfig
     using TransformComponentConfiguration = AZ::TransformConfig;
@@ -41,6 +42,7 @@ namespace AzFramework
         AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface);
 
         friend class AzToolsFramework::Components::TransformComponent;
+        friend class TransformUpdateQueue;
 
         using ParentActivationTransformMode = AZ::TransformConfig::ParentActivationTransformMode;
 
@@ -162,6 +164,10 @@ namespace AzFramework
         void ComputeWorldTM();
         //////////////////////////////////////////////////////////////////////////
 
+        //! Queues the notifications and the update of the children if deferred transform updates are enabled.
+        //! Returns false if the change needs to be sent immediately.
+        bool QueueTransformUpdate(bool keepWorldTM);
+
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
@@ -190,5 +196,8 @@ namespace AzFramework
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
         /// Behavior for this entity's transform when its parent's transform changes.
         AZ::OnParentChangedBehavior m_onParentChangedBehavior = AZ::OnParentChangedBehavior::Update;
+        bool m_transformUpdateQueued = false; ///< If set, the transform is in the ITransformUpdateQueue.
+        bool m_keepWorldTMOnUpdate = false; ///< If set, the queued update derives the localTM from the worldTM.
+        bool m_transformUpdateInBatch = false; ///< If set, the ITransformUpdateQueue is updating this transform.
     };
 }   // namespace AZ
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformUpdateQueue.h>
+#include <AzFramework/Visibility/EntityBoundsUnionBus.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
+
+namespace AzFramework
+{
+    void TransformUpdateQueue::Connect()
+    {
+        bool enabled = false;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            settingsRegistry->Get(enabled, DeferredTransformUpdatesKey);
+            settingsRegistry->Get(m_perEntityNotifications, DeferredTransformPerEntityNotificationsKey);
+        }
+
+        if (!enabled || m_connected)
+        {
+            return;
+        }
+
+        AZ::Interface<ITransformUpdateQueue>::Register(this);
+        AZ::TickBus::Handler::BusConnect();
+        m_connected = true;
+    }
+
+    void TransformUpdateQueue::Disconnect()
+    {
+        if (!m_connected)
+        {
+            return;
+        }
+
+        ProcessTransformUpdates();
+
+        AZ::TickBus::Handler::BusDisconnect();
+        AZ::Interface<ITransformUpdateQueue>::Unregister(this);
+        m_connected = false;
+
+        // Transforms queued by the listeners of the last batch update their hierarchies immediately, as they would without
+        // the queue.
+        AZStd::vector<TransformComponent*> remainingTransforms;
+        remainingTransforms.swap(m_queuedTransforms);
+        for (TransformComponent* transform : remainingTransforms)
+        {
+            transform->m_transformUpdateQueued = false;
+            if (transform->m_keepWorldTMOnUpdate)
+            {
+                transform->ComputeLocalTM();
+            }
+            else
+            {
+                transform->ComputeWorldTM();
+            }
+        }
+    }
+
+    void TransformUpdateQueue::QueueTransformUpdate(TransformComponent* transform)
+    {
+        m_queuedTransforms.push_back(transform);
+    }
+
+    void TransformUpdateQueue::DequeueTransformUpdate(TransformComponent* transform)
+    {
+        if (transform->m_transformUpdateQueued)
+        {
+            if (auto it = AZStd::find(m_queuedTransforms.begin(), m_queuedTransforms.end(), transform); it != m_queuedTransforms.end())
+            {
+                m_queuedTransforms.erase(it);
+            }
+            transform->m_transformUpdateQueued = false;
+        }
+
+        if (transform->m_transformUpdateInBatch)
+        {
+            if (auto it = AZStd::find(m_batchTransforms.begin(), m_batchTransforms.end(), transform); it != m_batchTransforms.end())
+            {
+                *it = nullptr;
+            }
+            transform->m_transformUpdateInBatch = false;
+        }
+    }
+
+    void TransformUpdateQueue::ProcessTransformUpdates()
+    {
+        if (m_processing || m_queuedTransforms.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        m_processing = true;
+
+        // Transforms queued by listeners of this batch are processed by the next call.
+        m_processingTransforms.swap(m_queuedTransforms);
+
+        // Transforms that are reached by a queued ancestor are added as part of the ancestor's hierarchy.
+        for (TransformComponent* transform : m_processingTransforms)
+        {
+            if (!HasQueuedAncestor(transform))
+            {
+                AddHierarchy(transform);
+            }
+        }
+        ComputeBatch();
+
+        for (size_t i = 0; i < m_batchTransforms.size(); ++i)
+        {
+            TransformComponent* transform = m_batchTransforms[i];
+            transform->m_localTM = m_batchLocalTMs[i];
+            transform->m_worldTM = m_batchWorldTMs[i];
+        }
+        for (const auto& [child, parentIndex] : m_keepWorldChildren)
+        {
+            child->m_localTM = m_batchWorldTMs[parentIndex].GetInverse() * child->m_worldTM;
+        }
+        for (TransformComponent* transform : m_processingTransforms)
+        {
+            transform->m_transformUpdateQueued = false;
+        }
+        m_processingTransforms.clear();
+
+        // All transforms are up to date before the first notification, so listeners can query any of them.
+        IEntityBoundsUnion* boundsUnion = AZ::Interface<IEntityBoundsUnion>::Get();
+        for (size_t i = 0; i < m_batchTransforms.size(); ++i)
+        {
+            // Listeners can deactivate entities that are later in the batch.
+            TransformComponent* transform = m_batchTransforms[i];
+            if (transform == nullptr)
+            {
+                continue;
+            }
+
+            if (m_perEntityNotifications)
+            {
+                AZ::TransformNotificationBus::Event(
+                    transform->m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_batchLocalTMs[i],
+                    m_batchWorldTMs[i]);
+                transform->m_transformChangedEvent.Signal(m_batchLocalTMs[i], m_batchWorldTMs[i]);
+            }
+
+            if (boundsUnion != nullptr)
+            {
+                boundsUnion->OnTransformUpdated(transform->GetEntity());
+            }
+        }
+
+        TransformUpdateBatch batch;
+        batch.m_entityIds = AZStd::span<const AZ::EntityId>(m_batchEntityIds);
+        batch.m_localTMs = AZStd::span<const AZ::Transform>(m_batchLocalTMs);
+        batch.m_worldTMs = AZStd::span<const AZ::Transform>(m_batchWorldTMs);
+        TransformUpdateNotificationBus::Broadcast(&TransformUpdateNotificationBus::Events::OnTransformsUpdated, batch);
+
+        ClearBatch();
+        m_processing = false;
+    }
+
+    int TransformUpdateQueue::GetTickOrder()
+    {
+        // Process the updates after all other handlers had a chance to move entities this frame.
+        return AZ::ComponentTickBus::TICK_LAST;
+    }
+
+    void TransformUpdateQueue::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        ProcessTransformUpdates();
+    }
+
+    bool TransformUpdateQueue::HasQueuedAncestor(const TransformComponent* transform) const
+    {
+        for (AZ::TransformInterface* parentInterface = transform->m_parentTM; parentInterface != nullptr;
+             parentInterface = parentInterface->GetParent())
+        {
+            const TransformComponent* parent = azrtti_cast<const TransformComponent*>(parentInterface);
+            if (parent == nullptr)
+            {
+                return false;
+            }
+            if (parent->m_transformUpdateQueued)
+            {
+                return true;
+            }
+            // A parent that keeps its world transform stops the changes of its ancestors from reaching its children.
+            if (parent->m_onParentChangedBehavior != AZ::OnParentChangedBehavior::Update)
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    void TransformUpdateQueue::AddHierarchy(TransformComponent* root)
+    {
+        auto AddEntry = [this](TransformComponent* transform, AZ::s32 parentIndex, bool keepWorldTM)
+        {
+            m_batchTransforms.push_back(transform);
+            m_batchEntityIds.push_back(transform->GetEntityId());
+            m_batchParentIndices.push_back(parentIndex);
+            m_batchLocalTMs.push_back(transform->m_localTM);
+            m_batchWorldTMs.push_back(transform->m_worldTM);
+            m_batchKeepWorldTMs.push_back(keepWorldTM);
+            transform->m_transformUpdateInBatch = true;
+        };
+
+        // The transforms of the root were already updated when it was queued.
+        AddEntry(root, -1, false);
+
+        // Visiting the hierarchy breadth first keeps every parent in front of its children.
+        AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get();
+        for (size_t parentIndex = m_batchTransforms.size() - 1; parentIndex < m_batchTransforms.size(); ++parentIndex)
+        {
+            m_children.clear();
+            AZ::TransformHierarchyInformationBus::Event(
+                m_batchEntityIds[parentIndex], &AZ::TransformHierarchyInformationBus::Events::GatherChildren, m_children);
+            for (AZ::EntityId childId : m_children)
+            {
+                AZ::Entity* childEntity = componentApplication ? componentApplication->FindEntity(childId) : nullptr;
+                TransformComponent* child =
+                    childEntity ? azrtti_cast<TransformComponent*>(childEntity->GetTransform()) : nullptr;
+                // Other transform implementations keep handling the notifications of their parent.
+                if (child == nullptr || child->m_parentTM == nullptr)
+                {
+                    continue;
+                }
+
+                const AZ::s32 childParentIndex = aznumeric_cast<AZ::s32>(parentIndex);
+                if (child->m_transformUpdateQueued)
+                {
+                    AddEntry(child, childParentIndex, child->m_keepWorldTMOnUpdate);
+                }
+                else if (child->m_onParentChangedBehavior == AZ::OnParentChangedBehavior::Update)
+                {
+                    AddEntry(child, childParentIndex, false);
+                }
+                else
+                {
+                    m_keepWorldChildren.emplace_back(child, childParentIndex);
+                }
+            }
+        }
+    }
+
+    void TransformUpdateQueue::ComputeBatch()
+    {
+        for (size_t i = 0; i < m_batchTransforms.size(); ++i)
+        {
+            const AZ::s32 parentIndex = m_batchParentIndices[i];
+            if (parentIndex < 0)
+            {
+                continue;
+            }
+
+            const AZ::Transform& parentWorldTM = m_batchWorldTMs[parentIndex];
+            if (m_batchKeepWorldTMs[i])
+            {
+                m_batchLocalTMs[i] = parentWorldTM.GetInverse() * m_batchWorldTMs[i];
+            }
+            else
+            {
+                m_batchWorldTMs[i] = parentWorldTM * m_batchLocalTMs[i];
+            }
+        }
+    }
+
+    void TransformUpdateQueue::ClearBatch()
+    {
+        for (TransformComponent* transform : m_batchTransforms)
+        {
+            if (transform != nullptr)
+            {
+                transform->m_transformUpdateInBatch = false;
+            }
+        }
+
+        m_batchTransforms.clear();
+        m_batchEntityIds.clear();
+        m_batchParentIndices.clear();
+        m_batchLocalTMs.clear();
+        m_batchWorldTMs.clear();
+        m_batchKeepWorldTMs.clear();
+        m_keepWorldChildren.clear();
+    }
+} // namespace AzFramework
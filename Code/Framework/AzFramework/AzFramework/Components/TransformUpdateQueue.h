@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Components/TransformUpdateQueueBus.h>
+
+namespace AzFramework
+{
+    //! Collects the transforms that changed during a frame and updates their hierarchies once per frame.
+    //! Deferred updates are opt-in through the DeferredTransformUpdatesKey setting. When it isn't set, Connect does nothing
+    //! and transforms keep updating and notifying immediately.
+    class TransformUpdateQueue
+        : public ITransformUpdateQueue
+        , private AZ::TickBus::Handler
+    {
+    public:
+        TransformUpdateQueue() = default;
+
+        void Connect();
+        void Disconnect();
+
+        // ITransformUpdateQueue overrides ...
+        void QueueTransformUpdate(TransformComponent* transform) override;
+        void DequeueTransformUpdate(TransformComponent* transform) override;
+        void ProcessTransformUpdates() override;
+
+    private:
+        // TickBus overrides ...
+        int GetTickOrder() override;
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        //! Returns true if a change to one of the ancestors of the transform reaches the transform.
+        bool HasQueuedAncestor(const TransformComponent* transform) const;
+        //! Adds the transform and all descendants its change reaches to the batch in hierarchy order.
+        void AddHierarchy(TransformComponent* root);
+        //! Computes the transforms of all entries in the batch from their parents.
+        void ComputeBatch();
+        void ClearBatch();
+
+        AZStd::vector<TransformComponent*> m_queuedTransforms;
+        AZStd::vector<TransformComponent*> m_processingTransforms;
+
+        //! Structure of arrays with one entry per updated transform, in hierarchy order.
+        //! @{
+        AZStd::vector<TransformComponent*> m_batchTransforms; //!< Set to null if the transform is dequeued while notifying.
+        AZStd::vector<AZ::EntityId> m_batchEntityIds;
+        AZStd::vector<AZ::s32> m_batchParentIndices; //!< Index of the parent in the batch, or -1 for roots.
+        AZStd::vector<AZ::Transform> m_batchLocalTMs;
+        AZStd::vector<AZ::Transform> m_batchWorldTMs;
+        AZStd::vector<bool> m_batchKeepWorldTMs; //!< Whether the local transform is derived from the world transform.
+        //! @}
+
+        //! Children that keep their world transform when their parent moves, with the index of their parent in the batch.
+        //! Their local transform is updated but their hierarchy isn't, so they aren't part of the batch.
+        AZStd::vector<AZStd::pair<TransformComponent*, AZ::s32>> m_keepWorldChildren;
+
+        AZStd::vector<AZ::EntityId> m_children; //!< Scratch storage for gathering children.
+
+        bool m_connected = false;
+        bool m_processing = false;
+        bool m_perEntityNotifications = true;
+    };
+} // namespace AzFramework
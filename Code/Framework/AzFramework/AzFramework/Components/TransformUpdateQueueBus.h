@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/span.h>
+
+namespace AzFramework
+{
+    class TransformComponent;
+
+    //! Setting that enables deferred transform updates for game entities.
+    inline constexpr const char* DeferredTransformUpdatesKey = "/O3DE/AzFramework/Transform/DeferredUpdates/Enabled";
+    //! Setting that controls whether deferred transform updates still send OnTransformChanged for every moved entity, in
+    //! addition to the batched notification. Defaults to true, as most listeners only handle the per entity notification.
+    inline constexpr const char* DeferredTransformPerEntityNotificationsKey =
+        "/O3DE/AzFramework/Transform/DeferredUpdates/PerEntityNotifications";
+
+    //! Queues changes to transforms so the hierarchy is updated and notified once per frame instead of on every change.
+    //! While active, setting the local or world transform of an active entity only updates that entity's own transforms.
+    //! The world transforms of its descendants are updated, and all notifications are sent, when the queue is processed.
+    //! @note The world transforms of descendants of a moved entity are stale until the queue is processed.
+    class ITransformUpdateQueue
+    {
+    public:
+        AZ_RTTI(ITransformUpdateQueue, "{5E1B8C2D-7A43-4F96-B0D1-3C9E6A2F84B7}");
+
+        //! Adds a transform whose local or world transform changed. A transform is queued at most once.
+        virtual void QueueTransformUpdate(TransformComponent* transform) = 0;
+
+        //! Removes a transform from the queue, for instance because its entity deactivates.
+        virtual void DequeueTransformUpdate(TransformComponent* transform) = 0;
+
+        //! Updates the hierarchies of all queued transforms and sends the notifications.
+        //! @note During normal operation this is called every frame in OnTick but can
+        //! also be called explicitly (e.g. For testing purposes).
+        virtual void ProcessTransformUpdates() = 0;
+
+    protected:
+        ~ITransformUpdateQueue() = default;
+    };
+
+    //! The transforms that were updated by a single call to ITransformUpdateQueue::ProcessTransformUpdates.
+    //! The arrays are in hierarchy order, so a parent always comes before its children, and are only valid for the
+    //! duration of the notification.
+    struct TransformUpdateBatch
+    {
+        AZStd::span<const AZ::EntityId> m_entityIds;
+        AZStd::span<const AZ::Transform> m_localTMs;
+        AZStd::span<const AZ::Transform> m_worldTMs;
+    };
+
+    //! Notifications sent when deferred transform updates are processed.
+    class TransformUpdateNotifications
+        : public AZ::EBusTraits
+    {
+    public:
+        //! Sent once after all queued transforms and their descendants have been updated.
+        virtual void OnTransformsUpdated(const TransformUpdateBatch& batch) = 0;
+
+    protected:
+        ~TransformUpdateNotifications() = default;
+    };
+    using TransformUpdateNotificationBus = AZ::EBus<TransformUpdateNotifications>;
+} // namespace AzFramework
@@ -7,6 +7,9 @@
  */
 #include <AzFramework/IO/LocalFileIO.h>
 #include <sys/stat.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/IO/IOUtils.h>
 #include <AzCore/IO/Path/Path.h>
@@ -14,6 +17,8 @@
 #include <AzCore/Casting/lossy_cast.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/StringFunc/StringFunc.h>
@@ -237,6 +242,71 @@ namespace AZ
             return ResultCode::Success;
         }
 
+        void LocalFileIO::ReadBatch(FileReadBatch requests, ReadBatchCallback callback)
+        {
+            auto streamer = AZ::Interface<IStreamer>::Get();
+            if (!streamer)
+            {
+                FileIOBase::ReadBatch(AZStd::move(requests), AZStd::move(callback));
+                return;
+            }
+
+            // The batch is kept alive by the completion callbacks until the last read has finished. Every request writes to its
+            // own entry, so only the number of remaining reads needs to be synchronized.
+            struct BatchState
+            {
+                FileReadBatch m_requests;
+                ReadBatchCallback m_callback;
+                AZStd::atomic<size_t> m_numRemaining{ 0 };
+            };
+            auto state = AZStd::make_shared<BatchState>();
+            state->m_requests = AZStd::move(requests);
+            state->m_callback = AZStd::move(callback);
+
+            AZStd::vector<FileRequestPtr> streamerRequests;
+            streamerRequests.reserve(state->m_requests.size());
+            AZ::IO::FixedMaxPath resolvedPath;
+            for (FileReadRequest& request : state->m_requests)
+            {
+                request.m_bytesRead = 0;
+                request.m_result = ResultCode::Error;
+                if (!ResolvePath(resolvedPath, AZ::IO::PathView(request.m_filePath)))
+                {
+                    continue;
+                }
+
+                FileRequestPtr& streamerRequest = streamerRequests.emplace_back(streamer->Read(resolvedPath.Native(),
+                    request.m_output, aznumeric_cast<size_t>(request.m_size), aznumeric_cast<size_t>(request.m_size),
+                    IStreamerTypes::s_noDeadline, IStreamerTypes::s_priorityMedium, aznumeric_cast<size_t>(request.m_offset)));
+                streamer->SetRequestCompleteCallback(streamerRequest,
+                    [state, streamer, &request](FileRequestHandle handle)
+                    {
+                        void* buffer = nullptr;
+                        if (streamer->GetRequestStatus(handle) == IStreamerTypes::RequestStatus::Completed &&
+                            streamer->GetReadRequestResult(handle, buffer, request.m_bytesRead))
+                        {
+                            request.m_result = request.m_bytesRead == request.m_size ? ResultCode::Success : ResultCode::Error;
+                        }
+                        if (--state->m_numRemaining == 0 && state->m_callback)
+                        {
+                            state->m_callback(state->m_requests);
+                        }
+                    });
+            }
+
+            if (streamerRequests.empty())
+            {
+                if (state->m_callback)
+                {
+                    state->m_callback(state->m_requests);
+                }
+                return;
+            }
+
+            state->m_numRemaining = streamerRequests.size();
+            streamer->QueueRequestBatch(AZStd::move(streamerRequests));
+        }
+
         bool LocalFileIO::IsReadOnly(const char* filePath)
         {
             char resolvedPath[AZ_MAX_PATH_LEN];
@@ -72,6 +72,12 @@ namespace AZ
             bool ReplaceAlias(AZ::IO::FixedMaxPath& replacedAliasPath, const AZ::IO::PathView& path) const override;
 
             bool GetFilename(HandleType fileHandle, char* filename, AZ::u64 filenameSize) const override;
+
+            //! Queues the reads on AZ::IO::Streamer if it's available so they're scheduled, and where possible combined,
+            //! together. The callback will be called from Streamer's thread in that case. Without Streamer the reads are done
+            //! one after the other on the calling thread.
+            void ReadBatch(FileReadBatch requests, ReadBatchCallback callback) override;
+
             bool ConvertToAbsolutePath(const char* path, char* absolutePath, AZ::u64 maxLength) const;
 
         private:
@@ -29,6 +29,7 @@ namespace AzPhysics
     AZ_CLASS_ALLOCATOR_IMPL(OverlapRequest, AZ::SystemAllocator);
     AZ_CLASS_ALLOCATOR_IMPL(SceneQueryHit, AZ::SystemAllocator);
     AZ_CLASS_ALLOCATOR_IMPL(SceneQueryHits, AZ::SystemAllocator);
+    AZ_CLASS_ALLOCATOR_IMPL(SceneQueryBatchHits, AZ::SystemAllocator);
 
     namespace Internal
     {
@@ -411,4 +412,28 @@ namespace AzPhysics
         }
     }
 
+    void SceneQueryBatchHits::Resize(size_t requestCount)
+    {
+        m_resultFlags.assign(requestCount, SceneQuery::ResultFlags::Invalid);
+        m_distances.resize(requestCount);
+        m_bodyHandles.resize(requestCount);
+        m_entityIds.resize(requestCount);
+        m_shapes.resize(requestCount);
+        m_physicsMaterialIds.resize(requestCount);
+        m_positions.resize(requestCount);
+        m_normals.resize(requestCount);
+    }
+
+    void SceneQueryBatchHits::SetHit(size_t index, const SceneQueryHit& hit)
+    {
+        m_resultFlags[index] = hit.m_resultFlags;
+        m_distances[index] = hit.m_distance;
+        m_bodyHandles[index] = hit.m_bodyHandle;
+        m_entityIds[index] = hit.m_entityId;
+        m_shapes[index] = hit.m_shape;
+        m_physicsMaterialIds[index] = hit.m_physicsMaterialId;
+        m_positions[index] = hit.m_position;
+        m_normals[index] = hit.m_normal;
+    }
+
 } // namespace Physics
@@ -311,6 +311,36 @@ namespace AzPhysics
 
         AZStd::vector<SceneQueryHit> m_hits;
     };
+
+    //! Structure that contains the closest hit of each request of a batched SceneQuery, as a structure of arrays.
+    //! Every array holds one element per request, in the order of the requests.
+    struct SceneQueryBatchHits
+    {
+        AZ_CLASS_ALLOCATOR_DECL;
+
+        //! Resizes the arrays to hold the hits of requestCount requests, and marks all of them as not hit.
+        //! The capacity of the arrays is kept, so reusing the structure across batches doesn't allocate.
+        void Resize(size_t requestCount);
+
+        //! Returns the number of requests the arrays hold hits for.
+        size_t GetSize() const { return m_resultFlags.size(); }
+
+        //! Returns true if the request at index hit something.
+        bool HasHit(size_t index) const { return m_resultFlags[index] != SceneQuery::ResultFlags::Invalid; }
+
+        //! Stores the hit of the request at index.
+        void SetHit(size_t index, const SceneQueryHit& hit);
+
+        //! Flags used to determine what members are valid for each request, Invalid if the request didn't hit anything.
+        AZStd::vector<SceneQuery::ResultFlags> m_resultFlags;
+        AZStd::vector<float> m_distances;
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> m_bodyHandles;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<Physics::Shape*> m_shapes;
+        AZStd::vector<Physics::MaterialId> m_physicsMaterialIds;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_normals;
+    };
 }
 
 namespace AZ
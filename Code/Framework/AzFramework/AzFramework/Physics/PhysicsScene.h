@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/span.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
@@ -145,6 +146,20 @@ namespace AzPhysics
         //! @return Returns a list of SceneQueryHits. Will be in the same order as supplied in SceneQueryRequests.
         virtual SceneQueryHitsList QuerySceneBatch(SceneHandle sceneHandle, const SceneQueryRequests& requests) = 0;
 
+        //! Make many blocking ray casts into the scene, executed in parallel.
+        //! Only the closest hit of each request is reported, the request's filter callback may be called from several threads at once.
+        //! @param sceneHandle A handle to the scene to make the scene queries with.
+        //! @param requests The ray casts to make.
+        //! @param results Receives the closest hit of each request, in the same order as the requests.
+        virtual void QuerySceneRayCastBatch(SceneHandle sceneHandle, AZStd::span<const RayCastRequest> requests, SceneQueryBatchHits& results) = 0;
+
+        //! Make many blocking shape casts into the scene, executed in parallel.
+        //! Only the closest hit of each request is reported, the request's filter callback may be called from several threads at once.
+        //! @param sceneHandle A handle to the scene to make the scene queries with.
+        //! @param requests The shape casts to make.
+        //! @param results Receives the closest hit of each request, in the same order as the requests.
+        virtual void QuerySceneShapeCastBatch(SceneHandle sceneHandle, AZStd::span<const ShapeCastRequest> requests, SceneQueryBatchHits& results) = 0;
+
         //! Make a non-blocking query into the scene.
         //! @param sceneHandle A handle to the scene to make the scene query with.
         //! @param requestId A user defined value to identify the request when the callback is called.
@@ -362,6 +377,18 @@ namespace AzPhysics
         //! @return Returns a list of SceneQueryHits. Will be in the same order as supplied in SceneQueryRequests.
         virtual SceneQueryHitsList QuerySceneBatch(const SceneQueryRequests& requests) = 0;
 
+        //! Make many blocking ray casts into the scene, executed in parallel.
+        //! Only the closest hit of each request is reported, the request's filter callback may be called from several threads at once.
+        //! @param requests The ray casts to make.
+        //! @param results Receives the closest hit of each request, in the same order as the requests.
+        virtual void QuerySceneRayCastBatch(AZStd::span<const RayCastRequest> requests, SceneQueryBatchHits& results) = 0;
+
+        //! Make many blocking shape casts into the scene, executed in parallel.
+        //! Only the closest hit of each request is reported, the request's filter callback may be called from several threads at once.
+        //! @param requests The shape casts to make.
+        //! @param results Receives the closest hit of each request, in the same order as the requests.
+        virtual void QuerySceneShapeCastBatch(AZStd::span<const ShapeCastRequest> requests, SceneQueryBatchHits& results) = 0;
+
         //! Make a non-blocking query into the scene.
         //! @param requestId A user defined valid to identify the request when the callback is called.
         //! @param request The request to make. Should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
@@ -13,6 +13,7 @@
 #include <AzCore/std/sort.h>
 #include <AzCore/std/typetraits/typetraits.h>
 #include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnableCloneProgram.h>
 
 namespace AzFramework
 {
@@ -401,6 +402,8 @@ namespace AzFramework
     {
     }
 
+    Spawnable::~Spawnable() = default;
+
     const Spawnable::EntityList& Spawnable::GetEntities() const
     {
         return m_entities;
@@ -443,6 +446,15 @@ namespace AzFramework
         return m_entities.empty();
     }
 
+    SpawnableCloneProgram& Spawnable::GetCloneProgram() const
+    {
+        if (!m_cloneProgram)
+        {
+            m_cloneProgram = AZStd::make_unique<SpawnableCloneProgram>();
+        }
+        return *m_cloneProgram;
+    }
+
     SpawnableMetaData& Spawnable::GetMetaData()
     {
         return m_metaData;
@@ -23,6 +23,8 @@ namespace AZ
 
 namespace AzFramework
 {
+    class SpawnableCloneProgram;
+
     class Spawnable final
         : public AZ::Data::AssetData
     {
@@ -155,7 +157,7 @@ namespace AzFramework
         explicit Spawnable(const AZ::Data::AssetId& id, AssetStatus status = AssetStatus::NotLoaded);
         Spawnable(const Spawnable& rhs) = delete;
         Spawnable(Spawnable&& other) = delete;
-        ~Spawnable() override = default;
+        ~Spawnable() override;
 
         Spawnable& operator=(const Spawnable& rhs) = delete;
         Spawnable& operator=(Spawnable&& other) = delete;
@@ -170,6 +172,10 @@ namespace AzFramework
         SpawnableMetaData& GetMetaData();
         const SpawnableMetaData& GetMetaData() const;
 
+        //! Returns the cache the SpawnableEntitiesManager uses to speed up repeated spawns of this spawnable, creating it if needed.
+        //! Only intended to be used by the thread that processes spawn requests.
+        SpawnableCloneProgram& GetCloneProgram() const;
+
         static void Reflect(AZ::ReflectContext* context);
 
     private:
@@ -182,6 +188,7 @@ namespace AzFramework
         EntityList m_entities;
 
         mutable AZStd::atomic<int32_t> m_shareState{ ShareState::NotShared };
+        mutable AZStd::unique_ptr<SpawnableCloneProgram> m_cloneProgram;
     };
 
     using SpawnableAsset = AZ::Data::Asset<AzFramework::Spawnable>;
@@ -51,7 +51,7 @@ namespace AzFramework
         Spawnable* spawnable = asset.GetAs<Spawnable>();
         AZ_Assert(spawnable, "Loaded asset data handed to the SpawnableAssetHandler didn't contain a Spawanble.");
 
-        AZ::ObjectStream::FilterDescriptor filter(assetLoadFilterCB);
+        AZ::ObjectStream::FilterDescriptor filter(assetLoadFilterCB, AZ::ObjectStream::FILTERFLAG_USE_LOAD_PLANS);
         if (AZ::Utils::LoadObjectFromStreamInPlace(*stream, *spawnable, nullptr /*SerializeContext*/, filter))
         {
             SpawnableAssetUtils::ResolveEntityAliases(spawnable, asset.GetHint(), AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(stream->GetStreamingDeadline()), stream->GetStreamingPriority(), assetLoadFilterCB);
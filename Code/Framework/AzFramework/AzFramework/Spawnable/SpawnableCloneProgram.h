@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class Component;
+    class Entity;
+}
+
+namespace AzFramework
+{
+    //! Creates a copy of a component prototype, with the entity ids it references remapped through the map. Ids that aren't in
+    //! the map are kept as is. Registered with the SpawnableEntitiesManager for component types that can be copied much faster
+    //! than through the SerializeContext.
+    using ComponentCloneFunction = AZ::Component* (*)(
+        const AZ::Component& prototype, const AZStd::unordered_map<AZ::EntityId, AZ::EntityId>& prototypeToCloneMap);
+
+    //! Records for every entity of a spawnable how its components are cloned, so repeated spawns don't need to look up the clone
+    //! functions again. Built by the SpawnableEntitiesManager when the spawnable is first spawned and rebuilt when the entities of
+    //! the spawnable or the registered clone functions change.
+    class SpawnableCloneProgram final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SpawnableCloneProgram, AZ::SystemAllocator);
+
+        struct ComponentStep
+        {
+            const AZ::Component* m_prototype{ nullptr };
+            ComponentCloneFunction m_clone{ nullptr };
+        };
+
+        struct EntityProgram
+        {
+            //! The prototype and its components are used to detect changes to the entities of the spawnable.
+            const AZ::Entity* m_prototype{ nullptr };
+            AZStd::vector<ComponentStep> m_components;
+            //! True if every component has a clone function. Otherwise the entity is cloned through the SerializeContext.
+            bool m_canFastClone{ false };
+        };
+
+        AZStd::vector<EntityProgram> m_entities;
+        //! The version of the registered clone functions this program was built with, 0 if it hasn't been built yet.
+        uint32_t m_cloneFunctionsVersion{ 0 };
+    };
+} // namespace AzFramework
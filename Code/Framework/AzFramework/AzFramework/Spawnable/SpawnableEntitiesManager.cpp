@@ -8,9 +8,14 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Components/TransformComponent.h>
@@ -43,6 +48,9 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            settingsRegistry->Get(m_parallelCloneThreshold, "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold");
+            settingsRegistry->Get(m_activationBudgetUs, "/O3DE/AzFramework/Spawnables/ActivationBudgetUs");
         }
     }
 
@@ -229,6 +237,23 @@ namespace AzFramework
         return result;
     }
 
+    void SpawnableEntitiesManager::RegisterComponentCloneFunction(const AZ::TypeId& componentType, ComponentCloneFunction cloneFunction)
+    {
+        AZ_Assert(
+            cloneFunction != nullptr, "Clone function for component type %s can't be null.",
+            componentType.ToString<AZStd::string>().c_str());
+        m_componentCloneFunctions[componentType] = cloneFunction;
+        m_componentCloneFunctionsVersion++;
+    }
+
+    void SpawnableEntitiesManager::UnregisterComponentCloneFunction(const AZ::TypeId& componentType)
+    {
+        if (m_componentCloneFunctions.erase(componentType) != 0)
+        {
+            m_componentCloneFunctionsVersion++;
+        }
+    }
+
     auto SpawnableEntitiesManager::ProcessQueue(Queue& queue) -> CommandQueueStatus
     {
         // Process delayed requests first.
@@ -410,6 +435,202 @@ namespace AzFramework
         }
     }
 
+    const SpawnableCloneProgram::EntityProgram& SpawnableEntitiesManager::GetEntityCloneProgram(
+        const Spawnable& spawnable, size_t entityIndex)
+    {
+        SpawnableCloneProgram& program = spawnable.GetCloneProgram();
+        const Spawnable::EntityList& entities = spawnable.GetEntities();
+        if (program.m_cloneFunctionsVersion != m_componentCloneFunctionsVersion || program.m_entities.size() != entities.size())
+        {
+            program.m_entities.clear();
+            program.m_entities.resize(entities.size());
+            program.m_cloneFunctionsVersion = m_componentCloneFunctionsVersion;
+        }
+
+        // Entities can be replaced or have components added after the program was built, for instance by a reload or an alias,
+        // so the recorded prototypes are compared against the current ones.
+        SpawnableCloneProgram::EntityProgram& entityProgram = program.m_entities[entityIndex];
+        const AZ::Entity& prototype = *entities[entityIndex];
+        const AZ::Entity::ComponentArrayType& components = prototype.GetComponents();
+        bool isUpToDate = entityProgram.m_prototype == &prototype && entityProgram.m_components.size() == components.size();
+        for (size_t i = 0; isUpToDate && i < components.size(); ++i)
+        {
+            isUpToDate = entityProgram.m_components[i].m_prototype == components[i];
+        }
+
+        if (!isUpToDate)
+        {
+            entityProgram.m_prototype = &prototype;
+            entityProgram.m_components.clear();
+            entityProgram.m_components.reserve(components.size());
+            entityProgram.m_canFastClone = true;
+            for (const AZ::Component* component : components)
+            {
+                auto it = m_componentCloneFunctions.find(azrtti_typeid(component));
+                ComponentCloneFunction cloneFunction = it != m_componentCloneFunctions.end() ? it->second : nullptr;
+                entityProgram.m_components.push_back({ component, cloneFunction });
+                entityProgram.m_canFastClone = entityProgram.m_canFastClone && cloneFunction != nullptr;
+            }
+        }
+        return entityProgram;
+    }
+
+    AZ::Entity* SpawnableEntitiesManager::CloneSpawnableEntity(
+        const Spawnable& spawnable, size_t entityIndex, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        const AZ::Entity& prototype = *spawnable.GetEntities()[entityIndex];
+        if (!m_componentCloneFunctions.empty())
+        {
+            if (const SpawnableCloneProgram::EntityProgram& program = GetEntityCloneProgram(spawnable, entityIndex);
+                program.m_canFastClone)
+            {
+                // Matches the remapper, which keeps the existing mapping of an id.
+                if (prototypeToCloneMap.find(prototype.GetId()) == prototypeToCloneMap.end())
+                {
+                    prototypeToCloneMap.emplace(prototype.GetId(), AZ::Entity::MakeId());
+                }
+                return FastCloneEntity(program, prototypeToCloneMap);
+            }
+        }
+        return CloneSingleEntity(prototype, prototypeToCloneMap, serializeContext);
+    }
+
+    AZ::Entity* SpawnableEntitiesManager::FastCloneEntity(
+        const SpawnableCloneProgram::EntityProgram& program, const EntityIdMap& prototypeToCloneMap)
+    {
+        const AZ::Entity& prototype = *program.m_prototype;
+        auto idIt = prototypeToCloneMap.find(prototype.GetId());
+        AZ_Assert(idIt != prototypeToCloneMap.end(), "Entity '%s' (%s) has no id to clone to.", prototype.GetName().c_str(),
+            prototype.GetId().ToString().c_str());
+
+        // The dependency order of the components isn't copied, the clone sorts its components again when it's initialized.
+        AZ::Entity* clone = aznew AZ::Entity(idIt->second, prototype.GetName());
+        clone->SetRuntimeActiveByDefault(prototype.IsRuntimeActiveByDefault());
+        for (const SpawnableCloneProgram::ComponentStep& step : program.m_components)
+        {
+            AZ::Component* componentClone = step.m_clone(*step.m_prototype, prototypeToCloneMap);
+            AZ_Assert(componentClone, "Unable to clone component for entity '%s' (%s).", prototype.GetName().c_str(),
+                prototype.GetId().ToString().c_str());
+            componentClone->SetId(step.m_prototype->GetId());
+            [[maybe_unused]] bool result = clone->AddComponent(componentClone);
+            AZ_Assert(result, "Unable to add cloned component to entity '%s' (%s).", prototype.GetName().c_str(),
+                prototype.GetId().ToString().c_str());
+        }
+        return clone;
+    }
+
+    void SpawnableEntitiesManager::CloneEntitiesInParallel(
+        const Spawnable& spawnable,
+        const EntityIdMap& prototypeToCloneMap,
+        AZ::SerializeContext& serializeContext,
+        AZ::Entity** clones)
+    {
+        const Spawnable::EntityList& entityPrototypes = spawnable.GetEntities();
+
+        // The clone programs are updated up front so the jobs only read them.
+        const SpawnableCloneProgram::EntityProgram* programs = nullptr;
+        if (!m_componentCloneFunctions.empty())
+        {
+            for (size_t i = 0; i < entityPrototypes.size(); ++i)
+            {
+                GetEntityCloneProgram(spawnable, i);
+            }
+            programs = spawnable.GetCloneProgram().m_entities.data();
+        }
+
+        // Every id that needs remapping is already in the map, so the ids can be looked up instead of generated. This keeps the
+        // map read-only and allows the jobs to share it.
+        auto cloneRange = [this, &entityPrototypes, &prototypeToCloneMap, &serializeContext, programs, clones](size_t begin, size_t end)
+        {
+            auto idMapper = [&prototypeToCloneMap](const AZ::EntityId& originalId) -> AZ::EntityId
+            {
+                auto it = prototypeToCloneMap.find(originalId);
+                return it != prototypeToCloneMap.end() ? it->second : originalId;
+            };
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (programs != nullptr && programs[i].m_canFastClone)
+                {
+                    clones[i] = FastCloneEntity(programs[i], prototypeToCloneMap);
+                    continue;
+                }
+
+                AZ::Entity* clone = serializeContext.CloneObject(entityPrototypes[i].get());
+                AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+                AZ::IdUtils::Remapper<AZ::EntityId>::RemapIdsAndIdRefs(clone, idMapper, &serializeContext);
+                clones[i] = clone;
+            }
+        };
+
+        // Small ranges aren't worth the overhead of a job.
+        constexpr size_t MinEntitiesPerJob = 64;
+        const size_t entityCount = entityPrototypes.size();
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        size_t jobCount = 1;
+        if (jobContext != nullptr)
+        {
+            const size_t workerCount = AZStd::max<size_t>(jobContext->GetJobManager().GetNumWorkerThreads(), 1);
+            jobCount = AZStd::min(workerCount, (entityCount + MinEntitiesPerJob - 1) / MinEntitiesPerJob);
+        }
+        if (jobCount <= 1)
+        {
+            cloneRange(0, entityCount);
+            return;
+        }
+
+        // The calling thread clones the first range while the jobs clone the others.
+        AZ::JobCompletion completion(jobContext);
+        for (size_t job = 1; job < jobCount; ++job)
+        {
+            const size_t begin = entityCount * job / jobCount;
+            const size_t end = entityCount * (job + 1) / jobCount;
+            AZ::Job* cloneJob = AZ::CreateJobFunction(
+                [&cloneRange, begin, end]()
+                {
+                    cloneRange(begin, end);
+                },
+                true, jobContext);
+            cloneJob->SetDependent(&completion);
+            cloneJob->Start();
+        }
+        cloneRange(0, entityCount / jobCount);
+        completion.StartAndWaitForCompletion();
+    }
+
+    bool SpawnableEntitiesManager::AddSpawnedEntitiesToGameContext(SpawnAllEntitiesCommand& request)
+    {
+        Ticket& ticket = *request.m_ticket;
+        const size_t newEntitiesEnd = ticket.m_spawnedEntities.size();
+        const auto startTime = AZStd::chrono::steady_clock::now();
+        const AZStd::chrono::microseconds budget(m_activationBudgetUs);
+
+        // Add to the game context, now the entities are active
+        while (request.m_nextEntityToAdd < newEntitiesEnd)
+        {
+            AZ::Entity* clone = ticket.m_spawnedEntities[request.m_nextEntityToAdd++];
+            clone->SetEntitySpawnTicketId(request.m_ticketId);
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+
+            // Always add at least one entity per frame, so the request makes progress with any budget.
+            if (m_activationBudgetUs != 0 && request.m_nextEntityToAdd < newEntitiesEnd &&
+                AZStd::chrono::steady_clock::now() - startTime >= budget)
+            {
+                return false;
+            }
+        }
+
+        // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
+        if (request.m_completionCallback)
+        {
+            auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + request.m_newEntitiesBegin;
+            request.m_completionCallback(
+                request.m_ticketId, SpawnableConstEntityContainerView(newEntitiesBegin, ticket.m_spawnedEntities.end()));
+        }
+
+        ticket.m_currentRequestId++;
+        return true;
+    }
+
     void SpawnableEntitiesManager::InitializeEntityIdMappings(
         const Spawnable::EntityList& entities, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned)
     {
@@ -445,6 +666,12 @@ namespace AzFramework
 
     auto SpawnableEntitiesManager::ProcessRequest(SpawnAllEntitiesCommand& request) -> CommandResult
     {
+        // Continue adding the entities that didn't fit in the activation budget of the previous frame.
+        if (request.m_entitiesCloned)
+        {
+            return AddSpawnedEntitiesToGameContext(request) ? CommandResult::Executed : CommandResult::Requeue;
+        }
+
         Ticket& ticket = *request.m_ticket;
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
@@ -475,7 +702,24 @@ namespace AzFramework
 
                 auto aliasIt = aliases.begin();
                 auto aliasEnd = aliases.end();
-                if (aliasIt == aliasEnd)
+                if (aliasIt == aliasEnd && m_parallelCloneThreshold != 0 && entitiesToSpawnSize >= m_parallelCloneThreshold)
+                {
+                    // The id map only changes for entities that are already spawned, which can only happen if the prototypes
+                    // contain duplicate ids. Refreshing all ids first therefore gives the same map the serial loop below would
+                    // use for each entity, and leaves it unchanged while the entities are cloned.
+                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+                    {
+                        RefreshEntityIdMapping(
+                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                        spawnedEntityIndices.push_back(i);
+                    }
+
+                    spawnedEntities.resize(spawnedEntitiesInitialCount + entitiesToSpawnSize);
+                    CloneEntitiesInParallel(
+                        *ticket.m_spawnable, ticket.m_entityIdReferenceMap, *request.m_serializeContext,
+                        spawnedEntities.data() + spawnedEntitiesInitialCount);
+                }
+                else if (aliasIt == aliasEnd)
                 {
                     for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
                     {
@@ -484,7 +728,7 @@ namespace AzFramework
                             entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
                         spawnedEntities.emplace_back(
-                            CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                            CloneSpawnableEntity(*ticket.m_spawnable, i, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                         spawnedEntityIndices.push_back(i);
                     }
                 }
@@ -536,22 +780,12 @@ namespace AzFramework
                     request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(newEntitiesBegin, newEntitiesEnd));
                 }
 
-                // Add to the game context, now the entities are active
-                for (auto it = newEntitiesBegin; it != newEntitiesEnd; ++it)
-                {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
-                }
-
-                // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
-                if (request.m_completionCallback)
-                {
-                    request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(newEntitiesBegin, newEntitiesEnd));
-                }
-
-                ticket.m_currentRequestId++;
-                return CommandResult::Executed;
+                // Later requests on this ticket wait until all entities are added, as the ticket's current request id only
+                // advances after that.
+                request.m_newEntitiesBegin = spawnedEntitiesInitialCount;
+                request.m_nextEntityToAdd = spawnedEntitiesInitialCount;
+                request.m_entitiesCloned = true;
+                return AddSpawnedEntitiesToGameContext(request) ? CommandResult::Executed : CommandResult::Requeue;
             }
         }
         return CommandResult::Requeue;
@@ -606,8 +840,8 @@ namespace AzFramework
                             RefreshEntityIdMapping(
                                 entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                            spawnedEntities.push_back(
-                                CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                            spawnedEntities.push_back(CloneSpawnableEntity(
+                                *ticket.m_spawnable, index, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                             spawnedEntityIndices.push_back(index);
                         }
                     }
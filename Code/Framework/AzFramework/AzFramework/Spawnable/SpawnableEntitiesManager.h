@@ -16,6 +16,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzFramework/Spawnable/SpawnableCloneProgram.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 
 namespace AZ
@@ -88,6 +89,16 @@ namespace AzFramework
 
         CommandQueueStatus ProcessQueue(CommandQueuePriority priority);
 
+        //
+        // The following functions are not thread safe and need to be called before spawning entities that use the component type.
+        //
+
+        //! Registers a function that clones components of the given type without going through the SerializeContext. Entities
+        //! for which all components have a clone function are cloned with those functions, which is considerably faster for
+        //! entities that are spawned often such as projectiles or pickups.
+        void RegisterComponentCloneFunction(const AZ::TypeId& componentType, ComponentCloneFunction cloneFunction);
+        void UnregisterComponentCloneFunction(const AZ::TypeId& componentType);
+
     protected:
         enum class CommandResult : bool
         {
@@ -134,6 +145,13 @@ namespace AzFramework
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            //! Once the entities are cloned they're added to the game entity context, possibly over several frames if the
+            //! activation budget runs out. These track the progress between frames.
+            //! @{
+            size_t m_newEntitiesBegin{ 0 };
+            size_t m_nextEntityToAdd{ 0 };
+            bool m_entitiesCloned{ false };
+            //! @}
         };
         struct SpawnEntitiesCommand final
         {
@@ -277,6 +295,24 @@ namespace AzFramework
             const AZ::Entity::ComponentArrayType& componentPrototypes,
             EntityIdMap& prototypeToCloneMap,
             AZ::SerializeContext& serializeContext);
+        //! Returns the clone program for the entity at the index in the spawnable, rebuilding it if the entity or the registered
+        //! clone functions changed since it was built.
+        const SpawnableCloneProgram::EntityProgram& GetEntityCloneProgram(const Spawnable& spawnable, size_t entityIndex);
+        //! Clones the entity at the index in the spawnable, using the registered clone functions if possible.
+        AZ::Entity* CloneSpawnableEntity(
+            const Spawnable& spawnable, size_t entityIndex, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+        //! Clones an entity with the registered clone functions. The id of the prototype needs to be in the id map.
+        AZ::Entity* FastCloneEntity(const SpawnableCloneProgram::EntityProgram& program, const EntityIdMap& prototypeToCloneMap);
+        //! Clones all prototypes in parallel jobs over ranges of entities and stores the clones in the same order.
+        //! This requires that the id map already holds the ids for all prototypes, as the jobs only read from it.
+        void CloneEntitiesInParallel(
+            const Spawnable& spawnable,
+            const EntityIdMap& prototypeToCloneMap,
+            AZ::SerializeContext& serializeContext,
+            AZ::Entity** clones);
+        //! Adds the entities cloned by the request to the game entity context until the activation budget runs out.
+        //! Returns true once all entities are added and the request is complete.
+        bool AddSpawnedEntitiesToGameContext(SpawnAllEntitiesCommand& request);
         
         CommandResult ProcessRequest(SpawnAllEntitiesCommand& request);
         CommandResult ProcessRequest(SpawnEntitiesCommand& request);
@@ -311,6 +347,17 @@ namespace AzFramework
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! SpawnAllEntities requests for spawnables without aliases and with at least this many entities clone them in parallel
+        //! jobs. Configured through "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold", 0 disables parallel cloning.
+        AZ::u64 m_parallelCloneThreshold { 0 };
+        //! Time in microseconds that SpawnAllEntities requests can spend per frame on adding entities to the game entity context,
+        //! the remaining entities are added in the next frames. Configured through
+        //! "/O3DE/AzFramework/Spawnables/ActivationBudgetUs", 0 adds all entities at once.
+        AZ::u64 m_activationBudgetUs { 0 };
+
+        AZStd::unordered_map<AZ::TypeId, ComponentCloneFunction> m_componentCloneFunctions;
+        //! Incremented whenever the clone functions change so the clone programs of spawnables are rebuilt.
+        uint32_t m_componentCloneFunctionsVersion { 1 };
 
         AZStd::unordered_map<EntitySpawnTicket::Id, Ticket*> m_entitySpawnTicketMap;
         AZStd::atomic_int m_totalTickets{ 0 };
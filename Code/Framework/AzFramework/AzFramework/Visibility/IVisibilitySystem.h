@@ -19,6 +19,7 @@
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 
 namespace AzFramework
@@ -62,6 +63,8 @@ namespace AzFramework
             const AZStd::vector<VisibilityEntry*>& m_entries;
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
+        //! Receives the visible entries found by one worker of EnumerateParallel.
+        using EnumerateParallelCallback = AZStd::function<void(uint32_t workerIndex, AZStd::span<VisibilityEntry* const> visibleEntries)>;
 
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
@@ -104,6 +107,24 @@ namespace AzFramework
         //! @param callback the callback to invoke when a node is visible
         virtual void Enumerate(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects a frustum against the visibility system, also culling the individual entries of each node.
+        //! Unlike Enumerate, NodeData::m_entries only contains the entries whose bounds overlap the frustum, and the
+        //! entries are only valid for the duration of the callback.
+        //! @param frustum the frustum to test against
+        //! @param callback the callback to invoke when a node has visible entries
+        virtual void EnumerateVisibleEntries(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
+
+        //! Intersects a frustum against the visibility system using multiple tasks, culling the individual entries like
+        //! EnumerateVisibleEntries. The traversal is split into contiguous ranges of nodes from the top of the tree, one per
+        //! worker, and each worker invokes the callback once with all visible entries it found.
+        //! The callback is invoked concurrently from multiple threads, the call returns after all workers are done.
+        //! Workers that don't find any visible entries don't invoke the callback, and the entries are only valid for the
+        //! duration of the callback.
+        //! @param frustum the frustum to test against
+        //! @param workerCount the maximum number of workers to split the traversal across
+        //! @param callback the callback to invoke with the visible entries of a worker
+        virtual void EnumerateParallel(const AZ::Frustum& frustum, uint32_t workerCount, const EnumerateParallelCallback& callback) const = 0;
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
@@ -8,7 +8,9 @@
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace AzFramework
 {
@@ -16,6 +18,8 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(float,    bg_octreeLooseness,           1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Factor between 1 and 2 that the bounds of octree nodes are expanded by, so entries that straddle a split plane still fit in a child node. Read when a scene is created");
+    AZ_CVAR(bool,     bg_octreeDeferUpdates,       false, nullptr, AZ::ConsoleFunctorFlags::Null, "If set to true, inserts and updates are queued and applied by the next query, so entries can move while other threads enumerate. Read when a scene is created");
 
     static uint32_t GetChildNodeCount()
     {
@@ -24,17 +28,142 @@ namespace AzFramework
         return (bg_octreeUseQuadtree) ? QuadtreeNodeChildCount : OctreeNodeChildCount;
     }
 
+    //! The planes of a frustum with each component splatted, for testing four entry bounds against a plane at once.
+    struct OctreeFrustumPlanes
+    {
+        explicit OctreeFrustumPlanes(const AZ::Frustum& frustum)
+        {
+            for (int planeId = 0; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+            {
+                const AZ::Vector4 plane = frustum.GetPlane(static_cast<AZ::Frustum::PlaneId>(planeId)).GetPlaneEquationCoefficients();
+                m_normalX[planeId] = AZ::Simd::Vec4::Splat(plane.GetX());
+                m_normalY[planeId] = AZ::Simd::Vec4::Splat(plane.GetY());
+                m_normalZ[planeId] = AZ::Simd::Vec4::Splat(plane.GetZ());
+                m_distance[planeId] = AZ::Simd::Vec4::Splat(plane.GetW());
+                m_useMaxX[planeId] = plane.GetX() >= 0.0f;
+                m_useMaxY[planeId] = plane.GetY() >= 0.0f;
+                m_useMaxZ[planeId] = plane.GetZ() >= 0.0f;
+            }
+        }
+
+        AZ::Simd::Vec4::FloatType m_normalX[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_normalY[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_normalZ[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_distance[AZ::Frustum::PlaneId::MAX];
+        //! Whether the corner of a box that's furthest along the plane normal uses the maximum of each axis.
+        //! @{
+        bool m_useMaxX[AZ::Frustum::PlaneId::MAX];
+        bool m_useMaxY[AZ::Frustum::PlaneId::MAX];
+        bool m_useMaxZ[AZ::Frustum::PlaneId::MAX];
+        //! @}
+    };
+
+    void OctreeNode::EntryBounds::PushBack(const AZ::Aabb& aabb)
+    {
+        if (m_count == m_minX.size())
+        {
+            const size_t paddedSize = m_count + 4;
+            m_minX.resize(paddedSize);
+            m_minY.resize(paddedSize);
+            m_minZ.resize(paddedSize);
+            m_maxX.resize(paddedSize);
+            m_maxY.resize(paddedSize);
+            m_maxZ.resize(paddedSize);
+        }
+        Set(m_count++, aabb);
+    }
+
+    void OctreeNode::EntryBounds::Set(size_t index, const AZ::Aabb& aabb)
+    {
+        AZ_Assert(index < m_count, "Entry bounds index %zu is out of range", index);
+        const AZ::Vector3& min = aabb.GetMin();
+        const AZ::Vector3& max = aabb.GetMax();
+        m_minX[index] = min.GetX();
+        m_minY[index] = min.GetY();
+        m_minZ[index] = min.GetZ();
+        m_maxX[index] = max.GetX();
+        m_maxY[index] = max.GetY();
+        m_maxZ[index] = max.GetZ();
+    }
+
+    AZ::Aabb OctreeNode::EntryBounds::Get(size_t index) const
+    {
+        AZ_Assert(index < m_count, "Entry bounds index %zu is out of range", index);
+        return AZ::Aabb::CreateFromMinMax(
+            AZ::Vector3(m_minX[index], m_minY[index], m_minZ[index]), AZ::Vector3(m_maxX[index], m_maxY[index], m_maxZ[index]));
+    }
+
+    void OctreeNode::EntryBounds::SwapAndPop(size_t index)
+    {
+        AZ_Assert(index < m_count, "Entry bounds index %zu is out of range", index);
+        const size_t lastIndex = --m_count;
+        if (index < lastIndex)
+        {
+            m_minX[index] = m_minX[lastIndex];
+            m_minY[index] = m_minY[lastIndex];
+            m_minZ[index] = m_minZ[lastIndex];
+            m_maxX[index] = m_maxX[lastIndex];
+            m_maxY[index] = m_maxY[lastIndex];
+            m_maxZ[index] = m_maxZ[lastIndex];
+        }
+    }
+
+    void OctreeNode::EntryBounds::Clear()
+    {
+        m_minX.clear();
+        m_minY.clear();
+        m_minZ.clear();
+        m_maxX.clear();
+        m_maxY.clear();
+        m_maxZ.clear();
+        m_count = 0;
+    }
+
+    uint32_t OctreeNode::EntryBounds::OverlapsFrustum4(size_t index, const OctreeFrustumPlanes& planes) const
+    {
+        using namespace AZ::Simd;
+
+        // This is the same test as ShapeIntersection::Overlaps(frustum, aabb): a box is outside if the corner that is
+        // furthest along the normal of any plane is behind that plane.
+        const Vec4::FloatType minX = Vec4::LoadUnaligned(&m_minX[index]);
+        const Vec4::FloatType minY = Vec4::LoadUnaligned(&m_minY[index]);
+        const Vec4::FloatType minZ = Vec4::LoadUnaligned(&m_minZ[index]);
+        const Vec4::FloatType maxX = Vec4::LoadUnaligned(&m_maxX[index]);
+        const Vec4::FloatType maxY = Vec4::LoadUnaligned(&m_maxY[index]);
+        const Vec4::FloatType maxZ = Vec4::LoadUnaligned(&m_maxZ[index]);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+        Vec4::FloatType overlaps = Vec4::CmpEq(zero, zero);
+        for (int planeId = 0; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+        {
+            const Vec4::FloatType cornerX = planes.m_useMaxX[planeId] ? maxX : minX;
+            const Vec4::FloatType cornerY = planes.m_useMaxY[planeId] ? maxY : minY;
+            const Vec4::FloatType cornerZ = planes.m_useMaxZ[planeId] ? maxZ : minZ;
+            Vec4::FloatType distance = Vec4::Madd(cornerX, planes.m_normalX[planeId], planes.m_distance[planeId]);
+            distance = Vec4::Madd(cornerY, planes.m_normalY[planeId], distance);
+            distance = Vec4::Madd(cornerZ, planes.m_normalZ[planeId], distance);
+            overlaps = Vec4::And(overlaps, Vec4::CmpGt(distance, zero));
+        }
+
+        int32_t lanes[4];
+        Vec4::StoreUnaligned(lanes, Vec4::CastToInt(overlaps));
+        return (lanes[0] ? 0x1 : 0) | (lanes[1] ? 0x2 : 0) | (lanes[2] ? 0x4 : 0) | (lanes[3] ? 0x8 : 0);
+    }
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
+        , m_looseBounds(bounds)
     {
         ;
     }
 
     OctreeNode::OctreeNode(OctreeNode&& rhs)
         : m_bounds(rhs.m_bounds)
+        , m_looseBounds(rhs.m_looseBounds)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
+        , m_entryBounds(AZStd::move(rhs.m_entryBounds))
     {
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
@@ -46,9 +175,11 @@ namespace AzFramework
     OctreeNode& OctreeNode::operator=(OctreeNode&& rhs)
     {
         m_bounds = rhs.m_bounds;
+        m_looseBounds = rhs.m_looseBounds;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
+        m_entryBounds = AZStd::move(rhs.m_entryBounds);
 
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
@@ -59,20 +190,19 @@ namespace AzFramework
         return *this;
     }
 
-    void OctreeNode::Insert(OctreeScene& octreeScene, VisibilityEntry* entry)
+    void OctreeNode::Insert(OctreeScene& octreeScene, VisibilityEntry* entry, const AZ::Aabb& boundingVolume)
     {
         AZ_Assert(entry->m_internalNode == nullptr, "Double-insertion: Insert invoked for an entry already bound to the OctreeScene");
 
         // If this is not a leaf node, try to insert into the child nodes
         if (m_children != nullptr)
         {
-            const AZ::Aabb boundingVolume = entry->m_boundingVolume;
             const uint32_t childCount = GetChildNodeCount();
             for (uint32_t child = 0; child < childCount; ++child)
             {
-                if (AZ::ShapeIntersection::Contains(m_children[child].m_bounds, boundingVolume))
+                if (AZ::ShapeIntersection::Contains(m_children[child].m_looseBounds, boundingVolume))
                 {
-                    return m_children[child].Insert(octreeScene, entry);
+                    return m_children[child].Insert(octreeScene, entry, boundingVolume);
                 }
             }
         }
@@ -83,26 +213,27 @@ namespace AzFramework
         {
             // If we're not already split, and our entry list gets too large, split this node
             Split(octreeScene);
-            Insert(octreeScene, entry);
+            Insert(octreeScene, entry, boundingVolume);
         }
         else
         {
             m_entries.push_back(entry);
+            m_entryBounds.PushBack(boundingVolume);
             entry->m_internalNode = this;
             entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
         }
     }
 
-    void OctreeNode::Update(OctreeScene& octreeScene, VisibilityEntry* entry)
+    void OctreeNode::Update(OctreeScene& octreeScene, VisibilityEntry* entry, const AZ::Aabb& boundingVolume)
     {
         AZ_Assert(entry->m_internalNode == this, "Update invoked for an entry bound to a different OctreeNode");
 
-        const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_bounds, boundingVolume))
+        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_looseBounds, boundingVolume))
         {
             // Entry moved, but is still fully contained within the current node
             // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
             // even when one of the child nodes would be an adequate fit, due to this early out check
+            m_entryBounds.Set(entry->m_internalNodeIndex, boundingVolume);
             return;
         }
 
@@ -114,10 +245,10 @@ namespace AzFramework
         OctreeNode* insertCheck = this;
         while (insertCheck != nullptr)
         {
-            if (AZ::ShapeIntersection::Contains(insertCheck->m_bounds, boundingVolume) || !insertCheck->m_parent)
+            if (AZ::ShapeIntersection::Contains(insertCheck->m_looseBounds, boundingVolume) || !insertCheck->m_parent)
             {
                 // Insert here if the entry is fully contained or if we've reached the root node
-                return insertCheck->Insert(octreeScene, entry);
+                return insertCheck->Insert(octreeScene, entry, boundingVolume);
             }
             insertCheck = insertCheck->m_parent;
         }
@@ -138,6 +269,7 @@ namespace AzFramework
             m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
         }
         m_entries.pop_back();
+        m_entryBounds.SwapAndPop(removeIndex);
 
         if (m_parent != nullptr)
         {
@@ -147,7 +279,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(aabb, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(aabb, m_looseBounds))
         {
             EnumerateHelper(aabb, callback);
         }
@@ -155,7 +287,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(sphere, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(sphere, m_looseBounds))
         {
             EnumerateHelper(sphere, callback);
         }
@@ -163,7 +295,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(hemisphere, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(hemisphere, m_looseBounds))
         {
             EnumerateHelper(hemisphere, callback);
         }
@@ -171,7 +303,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(capsule, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(capsule, m_looseBounds))
         {
             EnumerateHelper(capsule, callback);
         }
@@ -179,18 +311,129 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(frustum, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(frustum, m_looseBounds))
         {
             EnumerateHelper(frustum, callback);
         }
     }
 
+    void OctreeNode::EnumerateVisibleEntries(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        if (AZ::ShapeIntersection::Overlaps(frustum, m_looseBounds))
+        {
+            const OctreeFrustumPlanes planes(frustum);
+            AZStd::vector<VisibilityEntry*> visibleEntries;
+            EnumerateVisibleEntriesHelper(frustum, planes, visibleEntries, callback);
+        }
+    }
+
+    void OctreeNode::EnumerateParallel(
+        const AZ::Frustum& frustum, uint32_t workerCount, const IVisibilityScene::EnumerateParallelCallback& callback) const
+    {
+        if (workerCount == 0 || !AZ::ShapeIntersection::Overlaps(frustum, m_looseBounds))
+        {
+            return;
+        }
+
+        // A work item culls the entries of a single node, or of a node and all of its descendants
+        struct WorkItem
+        {
+            const OctreeNode* m_node;
+            bool m_recursive;
+        };
+
+        // Expand the top levels of the tree breadth first until there are a few items per worker, so the ranges
+        // stay balanced when some subtrees are much larger than others
+        const size_t targetItemCount = static_cast<size_t>(workerCount) * 4;
+        AZStd::vector<WorkItem> workItems{ { this, true } };
+        AZStd::vector<WorkItem> nextWorkItems;
+        bool expanded = true;
+        while (expanded && workItems.size() < targetItemCount)
+        {
+            expanded = false;
+            nextWorkItems.clear();
+            for (const WorkItem& workItem : workItems)
+            {
+                const OctreeNode* node = workItem.m_node;
+                if (!workItem.m_recursive || node->m_children == nullptr)
+                {
+                    nextWorkItems.push_back(workItem);
+                    continue;
+                }
+
+                expanded = true;
+                if (!node->m_entries.empty())
+                {
+                    nextWorkItems.push_back({ node, false });
+                }
+                const uint32_t childCount = node->GetChildNodeCount();
+                for (uint32_t child = 0; child < childCount; ++child)
+                {
+                    if (AZ::ShapeIntersection::Overlaps(frustum, node->m_children[child].m_looseBounds))
+                    {
+                        nextWorkItems.push_back({ &node->m_children[child], true });
+                    }
+                }
+            }
+            workItems.swap(nextWorkItems);
+        }
+
+        if (workItems.empty())
+        {
+            return;
+        }
+
+        const OctreeFrustumPlanes planes(frustum);
+        const uint32_t taskCount = AZStd::min(workerCount, aznumeric_cast<uint32_t>(workItems.size()));
+        auto cullRange = [&frustum, &planes, &workItems, &callback, taskCount](uint32_t taskIndex)
+        {
+            const size_t begin = workItems.size() * taskIndex / taskCount;
+            const size_t end = workItems.size() * (taskIndex + 1) / taskCount;
+            AZStd::vector<VisibilityEntry*> visibleEntries;
+            for (size_t index = begin; index < end; ++index)
+            {
+                if (workItems[index].m_recursive)
+                {
+                    workItems[index].m_node->GatherVisibleEntries(frustum, planes, visibleEntries);
+                }
+                else
+                {
+                    workItems[index].m_node->AppendVisibleEntries(planes, visibleEntries);
+                }
+            }
+
+            if (!visibleEntries.empty())
+            {
+                callback(taskIndex, AZStd::span<VisibilityEntry* const>(visibleEntries));
+            }
+        };
+
+        // Without an active task graph, for instance in tools and tests, the ranges are culled one after another
+        AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (taskCount > 1 && taskGraphActive != nullptr && taskGraphActive->IsTaskGraphActive())
+        {
+            static const AZ::TaskDescriptor descriptor{ "AzFramework::OctreeNode::EnumerateParallel", "Visibility" };
+            AZ::TaskGraph taskGraph{ "OctreeEnumerateParallel" };
+            taskGraph.AddTaskGroup(descriptor, taskCount, cullRange);
+            AZ::TaskGraphEvent finishedEvent{ "OctreeEnumerateParallel Wait" };
+            taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else
+        {
+            for (uint32_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+            {
+                cullRange(taskIndex);
+            }
+        }
+    }
+
     void OctreeNode::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
@@ -219,6 +462,11 @@ namespace AzFramework
         return m_children == nullptr;
     }
 
+    const AZ::Aabb& OctreeNode::GetLooseBounds() const
+    {
+        return m_looseBounds;
+    }
+
     void OctreeNode::TryMerge(OctreeScene& octreeScene)
     {
         if (IsLeaf())
@@ -249,12 +497,12 @@ namespace AzFramework
     template <typename T>
     void OctreeNode::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_bounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
+        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_looseBounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
 
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
@@ -263,7 +511,7 @@ namespace AzFramework
             const uint32_t childCount = GetChildNodeCount();
             for (uint32_t child = 0; child < childCount; ++child)
             {
-                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_bounds))
+                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_looseBounds))
                 {
                     m_children[child].EnumerateHelper(boundingVolume, callback);
                 }
@@ -271,6 +519,96 @@ namespace AzFramework
         }
     }
 
+    void OctreeNode::EnumerateVisibleEntriesHelper(
+        const AZ::Frustum& frustum,
+        const OctreeFrustumPlanes& planes,
+        AZStd::vector<VisibilityEntry*>& visibleEntries,
+        const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        // Everything below a node that is fully inside the frustum is visible, so there is nothing left to cull
+        if (AZ::ShapeIntersection::Contains(frustum, m_looseBounds))
+        {
+            EnumerateNoCull(callback);
+            return;
+        }
+
+        if (!m_entries.empty())
+        {
+            visibleEntries.clear();
+            AppendVisibleEntries(planes, visibleEntries);
+            if (!visibleEntries.empty())
+            {
+                callback({m_looseBounds, visibleEntries});
+            }
+        }
+
+        if (m_children != nullptr)
+        {
+            const uint32_t childCount = GetChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                if (AZ::ShapeIntersection::Overlaps(frustum, m_children[child].m_looseBounds))
+                {
+                    m_children[child].EnumerateVisibleEntriesHelper(frustum, planes, visibleEntries, callback);
+                }
+            }
+        }
+    }
+
+    void OctreeNode::AppendVisibleEntries(const OctreeFrustumPlanes& planes, AZStd::vector<VisibilityEntry*>& visibleEntries) const
+    {
+        const size_t entryCount = m_entries.size();
+        for (size_t first = 0; first < entryCount; first += 4)
+        {
+            // The bounds are padded to a multiple of four, the padding lanes are ignored
+            const uint32_t overlaps = m_entryBounds.OverlapsFrustum4(first, planes);
+            const size_t laneCount = AZStd::min<size_t>(4, entryCount - first);
+            for (size_t lane = 0; lane < laneCount; ++lane)
+            {
+                if (overlaps & (1u << lane))
+                {
+                    visibleEntries.push_back(m_entries[first + lane]);
+                }
+            }
+        }
+    }
+
+    void OctreeNode::GatherVisibleEntries(
+        const AZ::Frustum& frustum, const OctreeFrustumPlanes& planes, AZStd::vector<VisibilityEntry*>& visibleEntries) const
+    {
+        if (AZ::ShapeIntersection::Contains(frustum, m_looseBounds))
+        {
+            GatherAllEntries(visibleEntries);
+            return;
+        }
+
+        AppendVisibleEntries(planes, visibleEntries);
+        if (m_children != nullptr)
+        {
+            const uint32_t childCount = GetChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                if (AZ::ShapeIntersection::Overlaps(frustum, m_children[child].m_looseBounds))
+                {
+                    m_children[child].GatherVisibleEntries(frustum, planes, visibleEntries);
+                }
+            }
+        }
+    }
+
+    void OctreeNode::GatherAllEntries(AZStd::vector<VisibilityEntry*>& entries) const
+    {
+        entries.insert(entries.end(), m_entries.begin(), m_entries.end());
+        if (m_children != nullptr)
+        {
+            const uint32_t childCount = GetChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                m_children[child].GatherAllEntries(entries);
+            }
+        }
+    }
+
     void OctreeNode::Split(OctreeScene& octreeScene)
     {
         AZ_Assert(m_children == nullptr, "Split invoked on an octreeScene node that has already been split");
@@ -281,6 +619,8 @@ namespace AzFramework
         {
             const AZ::Vector3 childExtent = (m_bounds.GetMax() - m_bounds.GetMin()) * 0.5f;
             const AZ::Aabb childBound = AZ::Aabb::CreateFromMinMax(m_bounds.GetMin(), m_bounds.GetMin() + childExtent);
+            // Each side of a loose child grows by half of the extra size
+            const AZ::Vector3 childLooseMargin = childExtent * ((octreeScene.GetLooseness() - 1.0f) * 0.5f);
             const uint32_t childCount = GetChildNodeCount();
 
             for (uint32_t child = 0; child < childCount; ++child)
@@ -306,17 +646,23 @@ namespace AzFramework
                 }
 
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
+                m_children[child].m_looseBounds = AZ::Aabb::CreateFromMinMax(
+                    m_children[child].m_bounds.GetMin() - childLooseMargin, m_children[child].m_bounds.GetMax() + childLooseMargin);
                 m_children[child].m_parent = this;
             }
         }
 
         // Re-partition our entry set across ourself and our child nodes
         AZStd::vector<VisibilityEntry*> entrySet(AZStd::move(m_entries));
-        for (VisibilityEntry* entry : entrySet)
+        EntryBounds entryBounds(AZStd::move(m_entryBounds));
+        m_entries.clear();
+        m_entryBounds.Clear();
+        for (size_t i = 0; i < entrySet.size(); ++i)
         {
+            VisibilityEntry* entry = entrySet[i];
             entry->m_internalNode = nullptr;
             entry->m_internalNodeIndex = 0;
-            Insert(octreeScene, entry);
+            Insert(octreeScene, entry, entryBounds.Get(i));
         }
     }
 
@@ -328,13 +674,17 @@ namespace AzFramework
         const uint32_t childCount = GetChildNodeCount();
         for (uint32_t child = 0; child < childCount; ++child)
         {
-            for (VisibilityEntry* childEntry : m_children[child].m_entries)
+            OctreeNode& childNode = m_children[child];
+            for (size_t i = 0; i < childNode.m_entries.size(); ++i)
             {
+                VisibilityEntry* childEntry = childNode.m_entries[i];
                 childEntry->m_internalNode = this;
                 childEntry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size());
                 m_entries.push_back(childEntry);
+                m_entryBounds.PushBack(childNode.m_entryBounds.Get(i));
             }
-            m_children[child].m_entries.clear();
+            childNode.m_entries.clear();
+            childNode.m_entryBounds.Clear();
         }
 
         octreeScene.ReleaseChildNodes(m_childNodeIndex);
@@ -343,10 +693,14 @@ namespace AzFramework
     }
 
     OctreeScene::OctreeScene(const AZ::Name& sceneName)
-        : m_sceneName(sceneName)
+        : m_looseness(AZ::GetClamp(static_cast<float>(bg_octreeLooseness), 1.0f, 2.0f))
+        , m_deferUpdates(bg_octreeDeferUpdates)
+        , m_sceneName(sceneName)
         , m_root(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-bg_octreeMaxWorldExtents), AZ::Vector3(bg_octreeMaxWorldExtents)))
     {
         AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
+        AZ_Warning("OctreeScene", m_looseness == static_cast<float>(bg_octreeLooseness),
+            "bg_octreeLooseness %f is out of range and was clamped to %f", static_cast<float>(bg_octreeLooseness), m_looseness);
     }
 
     OctreeScene::~OctreeScene()
@@ -366,21 +720,65 @@ namespace AzFramework
 
     void OctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
     {
+        if (m_deferUpdates)
+        {
+            // Store the bounds now, the entry may be changed again before the update is applied
+            AZStd::lock_guard<AZStd::mutex> queueLock(m_queuedUpdatesMutex);
+            m_queuedUpdates[&entry] = entry.m_boundingVolume;
+            m_hasQueuedUpdates = true;
+            return;
+        }
+
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        InsertOrUpdateEntryImpl(entry, entry.m_boundingVolume);
+    }
+
+    void OctreeScene::InsertOrUpdateEntryImpl(VisibilityEntry& entry, const AZ::Aabb& boundingVolume)
+    {
         if (entry.m_internalNode != nullptr)
         {
-            static_cast<OctreeNode*>(entry.m_internalNode)->Update(*this, &entry);
+            static_cast<OctreeNode*>(entry.m_internalNode)->Update(*this, &entry, boundingVolume);
         }
         else
         {
-            m_root.Insert(*this, &entry);
+            m_root.Insert(*this, &entry, boundingVolume);
             ++m_entryCount;
         }
     }
 
+    void OctreeScene::ApplyQueuedUpdates() const
+    {
+        if (!m_hasQueuedUpdates)
+        {
+            return;
+        }
+
+        // Queries can't change the logical contents of the scene, but they do apply the changes that were queued before them
+        OctreeScene* scene = const_cast<OctreeScene*>(this);
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::unordered_map<VisibilityEntry*, AZ::Aabb> queuedUpdates;
+        {
+            AZStd::lock_guard<AZStd::mutex> queueLock(m_queuedUpdatesMutex);
+            queuedUpdates.swap(m_queuedUpdates);
+            m_hasQueuedUpdates = false;
+        }
+
+        for (auto& [entry, boundingVolume] : queuedUpdates)
+        {
+            scene->InsertOrUpdateEntryImpl(*entry, boundingVolume);
+        }
+    }
+
     void OctreeScene::RemoveEntry(VisibilityEntry& entry)
     {
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (m_deferUpdates)
+        {
+            // The entry may be destroyed after it's removed, so it can't stay in the queue
+            AZStd::lock_guard<AZStd::mutex> queueLock(m_queuedUpdatesMutex);
+            m_queuedUpdates.erase(&entry);
+        }
+
         if (entry.m_internalNode)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Remove(*this, &entry);
@@ -390,45 +788,77 @@ namespace AzFramework
 
     void OctreeScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
+        ApplyQueuedUpdates();
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
         m_root.Enumerate(aabb, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
+        ApplyQueuedUpdates();
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
         m_root.Enumerate(sphere, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
+        ApplyQueuedUpdates();
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
         m_root.Enumerate(hemisphere, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Capsule & capsule, const IVisibilityScene::EnumerateCallback& callback) const
     {
+        ApplyQueuedUpdates();
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
         m_root.Enumerate(capsule, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
+        ApplyQueuedUpdates();
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
         m_root.Enumerate(frustum, callback);
     }
 
+    void OctreeScene::EnumerateVisibleEntries(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        ApplyQueuedUpdates();
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateVisibleEntries(frustum, callback);
+    }
+
+    void OctreeScene::EnumerateParallel(
+        const AZ::Frustum& frustum, uint32_t workerCount, const IVisibilityScene::EnumerateParallelCallback& callback) const
+    {
+        ApplyQueuedUpdates();
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateParallel(frustum, workerCount, callback);
+    }
+
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
+        ApplyQueuedUpdates();
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
         m_root.EnumerateNoCull(callback);
     }
 
     uint32_t OctreeScene::GetEntryCount() const
     {
+        ApplyQueuedUpdates();
         return m_entryCount;
     }
 
+    float OctreeScene::GetLooseness() const
+    {
+        return m_looseness;
+    }
+
+    bool OctreeScene::IsDeferringUpdates() const
+    {
+        return m_deferUpdates;
+    }
+
     uint32_t OctreeScene::GetNodeCount() const
     {
         return m_nodeCount;
@@ -14,15 +14,21 @@
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 
 namespace AzFramework
 {
     class OctreeSystemComponent;
     class OctreeScene;
+    struct OctreeFrustumPlanes;
 
     //! An internal node within the tree.
     //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
+    //! In a loose octree the bounds that contain the objects are larger than the bounds the node was split from, so objects
+    //! that straddle the split planes can still go into a child node.
     class OctreeNode
         : public VisibilityNode
     {
@@ -36,12 +42,12 @@ namespace AzFramework
 
         OctreeNode& operator=(OctreeNode&& rhs);
 
-        //! Inserts a VisibilityEntry into this OctreeNode, potentially triggering a split.
-        void Insert(OctreeScene& octreeScene, VisibilityEntry* entry);
+        //! Inserts a VisibilityEntry with the provided bounds into this OctreeNode, potentially triggering a split.
+        void Insert(OctreeScene& octreeScene, VisibilityEntry* entry, const AZ::Aabb& boundingVolume);
 
-        //! Updates a VisibilityEntry that is currently bound to this OctreeNode.
+        //! Updates a VisibilityEntry that is currently bound to this OctreeNode to the provided bounds.
         //! The provided entry must be bound to this node, but may no longer be bound to this node upon function exit.
-        void Update(OctreeScene& octreeScene, VisibilityEntry* entry);
+        void Update(OctreeScene& octreeScene, VisibilityEntry* entry, const AZ::Aabb& boundingVolume);
 
         //! Removes a VisibilityEntry from this OctreeNode.
         //! The provided entry must be bound to this node.
@@ -56,6 +62,14 @@ namespace AzFramework
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const;
         //! @}
 
+        //! Recursively enumerates the entries of any OctreeNodes and their children that intersect the frustum.
+        //! The entries of nodes that are only partially inside the frustum are culled individually, four at a time.
+        void EnumerateVisibleEntries(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const;
+
+        //! Splits the nodes that intersect the frustum into up to workerCount ranges and culls their entries in parallel.
+        void EnumerateParallel(
+            const AZ::Frustum& frustum, uint32_t workerCount, const IVisibilityScene::EnumerateParallelCallback& callback) const;
+
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
@@ -68,7 +82,48 @@ namespace AzFramework
         //! Returns true if this is a leaf node.
         bool IsLeaf() const;
 
+        //! Returns the bounds that contain all entries bound to this node.
+        const AZ::Aabb& GetLooseBounds() const;
+
     private:
+        //! The bounds of the entries as one array per component, in the same order as m_entries.
+        //! The arrays are padded to a multiple of four elements so entries can always be loaded four at a time.
+        struct EntryBounds
+        {
+            void PushBack(const AZ::Aabb& aabb);
+            void Set(size_t index, const AZ::Aabb& aabb);
+            AZ::Aabb Get(size_t index) const;
+            //! Moves the last bounds to the provided index and removes the last bounds.
+            void SwapAndPop(size_t index);
+            void Clear();
+
+            //! Returns a mask with bit i set if the bounds at index + i overlap the frustum.
+            uint32_t OverlapsFrustum4(size_t index, const OctreeFrustumPlanes& planes) const;
+
+            AZStd::vector<float> m_minX;
+            AZStd::vector<float> m_minY;
+            AZStd::vector<float> m_minZ;
+            AZStd::vector<float> m_maxX;
+            AZStd::vector<float> m_maxY;
+            AZStd::vector<float> m_maxZ;
+            size_t m_count = 0;
+        };
+
+        void EnumerateVisibleEntriesHelper(
+            const AZ::Frustum& frustum,
+            const OctreeFrustumPlanes& planes,
+            AZStd::vector<VisibilityEntry*>& visibleEntries,
+            const IVisibilityScene::EnumerateCallback& callback) const;
+
+        //! Appends the entries of this node whose bounds overlap the frustum.
+        void AppendVisibleEntries(const OctreeFrustumPlanes& planes, AZStd::vector<VisibilityEntry*>& visibleEntries) const;
+
+        //! Recursively appends the entries of this node and its children whose bounds overlap the frustum.
+        void GatherVisibleEntries(
+            const AZ::Frustum& frustum, const OctreeFrustumPlanes& planes, AZStd::vector<VisibilityEntry*>& visibleEntries) const;
+
+        //! Recursively appends the entries of this node and its children without any culling.
+        void GatherAllEntries(AZStd::vector<VisibilityEntry*>& entries) const;
 
         void TryMerge(OctreeScene& octreeScene);
 
@@ -83,9 +138,11 @@ namespace AzFramework
         static constexpr uint32_t InvalidChildNodeIndex = 0xFFFFFFFF;
         uint32_t m_childNodeIndex = InvalidChildNodeIndex;
         AZ::Aabb m_bounds;
+        AZ::Aabb m_looseBounds; //< The bounds expanded by the looseness of the scene, these contain all entries of the node.
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
+        EntryBounds m_entryBounds;
     };
 
     //! Implementation of the visibility system interface.
@@ -111,10 +168,19 @@ namespace AzFramework
         void Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateVisibleEntries(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateParallel(
+            const AZ::Frustum& frustum, uint32_t workerCount, const IVisibilityScene::EnumerateParallelCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
         uint32_t GetEntryCount() const override;
         //! @}
 
+        //! Returns the factor the bounds of the nodes are expanded by to get their loose bounds.
+        float GetLooseness() const;
+
+        //! Returns true if inserts and updates are queued and only applied by the next query.
+        bool IsDeferringUpdates() const;
+
         //! Stats
         //! @{
         uint32_t GetNodeCount() const;
@@ -129,8 +195,20 @@ namespace AzFramework
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
 
+        //! Applies the queued inserts and updates, if any. Queries call this before taking the shared lock.
+        void ApplyQueuedUpdates() const;
+        void InsertOrUpdateEntryImpl(VisibilityEntry& entry, const AZ::Aabb& boundingVolume);
+
         mutable AZStd::shared_mutex m_sharedMutex;
 
+        //! Inserts and updates that haven't been applied yet, with the bounds the entries had when they were queued.
+        //! This allows entries to be moved while other threads are enumerating the scene.
+        mutable AZStd::mutex m_queuedUpdatesMutex;
+        mutable AZStd::unordered_map<VisibilityEntry*, AZ::Aabb> m_queuedUpdates;
+        mutable AZStd::atomic_bool m_hasQueuedUpdates{ false };
+        float m_looseness = 1.0f; //< Read from bg_octreeLooseness when the scene is created.
+        bool m_deferUpdates = false; //< Read from bg_octreeDeferUpdates when the scene is created.
+
         AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
         OctreeNode m_root; //< The root node for the octreeSystemComponent.
 
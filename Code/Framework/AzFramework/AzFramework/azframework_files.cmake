@@ -14,6 +14,11 @@ set(FILES
     API/ApplicationAPI.cpp
     Application/Application.cpp
     Application/Application.h
+    Archetype/ArchetypeStorage.cpp
+    Archetype/ArchetypeStorage.h
+    Archetype/ArchetypeStorage.inl
+    Archetype/ArchetypeStorageSystemComponent.cpp
+    Archetype/ArchetypeStorageSystemComponent.h
     Archive/Archive.cpp
     Archive/Archive.h
     Archive/ArchiveBus.h
@@ -128,6 +133,9 @@ set(FILES
     Components/EditorEntityEvents.h
     Components/TransformComponent.cpp
     Components/TransformComponent.h
+    Components/TransformUpdateQueue.cpp
+    Components/TransformUpdateQueue.h
+    Components/TransformUpdateQueueBus.h
     Components/CameraBus.h
     Components/ConsoleBus.h
     Components/ConsoleBus.cpp
@@ -347,6 +355,7 @@ set(FILES
     Spawnable/SpawnableAssetHandler.cpp
     Spawnable/SpawnableAssetUtils.h
     Spawnable/SpawnableAssetUtils.cpp
+    Spawnable/SpawnableCloneProgram.h
     Spawnable/SpawnableEntitiesContainer.h
     Spawnable/SpawnableEntitiesContainer.cpp
     Spawnable/SpawnableEntitiesInterface.h
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzFramework/Archetype/ArchetypeStorage.h>
+
+namespace UnitTest
+{
+    struct ArchetypePosition
+    {
+        AZ_TYPE_INFO(ArchetypePosition, "{1B6F0C2E-7D3A-4E58-9A41-C2F85D3B6E07}");
+
+        float m_x = 0.0f;
+        float m_y = 0.0f;
+    };
+
+    struct ArchetypeVelocity
+    {
+        AZ_TYPE_INFO(ArchetypeVelocity, "{3E9A5D17-4B2C-4F80-8D6E-A71C0B9F2D54}");
+
+        float m_x = 0.0f;
+        float m_y = 0.0f;
+    };
+
+    struct ArchetypeName
+    {
+        AZ_TYPE_INFO(ArchetypeName, "{6C4D8E21-0F5B-4A93-B7E2-95D3A1C6F048}");
+
+        // Not trivially movable, makes sure data is moved and destructed when entities change archetype
+        AZStd::unique_ptr<AZStd::string> m_name;
+    };
+
+    class ArchetypeStorageTests
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(ArchetypeStorageTests, EmplaceData_EntityMovesBetweenArchetypes)
+    {
+        AzFramework::ArchetypeStorage storage;
+        const AZ::EntityId entityId(1);
+
+        storage.EmplaceData<ArchetypePosition>(entityId, ArchetypePosition{ 1.0f, 2.0f });
+        EXPECT_EQ(storage.GetArchetypeCount(), 1);
+        ArchetypeName& name = storage.EmplaceData<ArchetypeName>(entityId);
+        name.m_name = AZStd::make_unique<AZStd::string>("Projectile");
+        EXPECT_EQ(storage.GetArchetypeCount(), 2);
+
+        ASSERT_NE(storage.FindData<ArchetypePosition>(entityId), nullptr);
+        EXPECT_EQ(storage.FindData<ArchetypePosition>(entityId)->m_y, 2.0f);
+        ASSERT_NE(storage.FindData<ArchetypeName>(entityId), nullptr);
+        EXPECT_EQ(*storage.FindData<ArchetypeName>(entityId)->m_name, "Projectile");
+        EXPECT_EQ(storage.FindData<ArchetypeVelocity>(entityId), nullptr);
+
+        EXPECT_TRUE(storage.RemoveData<ArchetypePosition>(entityId));
+        EXPECT_FALSE(storage.RemoveData<ArchetypePosition>(entityId));
+        EXPECT_EQ(*storage.FindData<ArchetypeName>(entityId)->m_name, "Projectile");
+
+        EXPECT_TRUE(storage.RemoveData<ArchetypeName>(entityId));
+        EXPECT_FALSE(storage.HasEntity(entityId));
+    }
+
+    TEST_F(ArchetypeStorageTests, RemoveEntity_KeepsOtherEntitiesIntact)
+    {
+        AzFramework::ArchetypeStorage storage;
+        constexpr uint32_t EntityCount = 5000;
+        for (uint32_t i = 0; i < EntityCount; ++i)
+        {
+            storage.EmplaceData<ArchetypePosition>(AZ::EntityId(i), ArchetypePosition{ aznumeric_cast<float>(i), 0.0f });
+            storage.EmplaceData<ArchetypeName>(AZ::EntityId(i)).m_name = AZStd::make_unique<AZStd::string>(AZStd::to_string(i));
+        }
+
+        for (uint32_t i = 0; i < EntityCount; i += 2)
+        {
+            storage.RemoveEntity(AZ::EntityId(i));
+        }
+        EXPECT_EQ(storage.GetEntityCount(), EntityCount / 2);
+
+        for (uint32_t i = 1; i < EntityCount; i += 2)
+        {
+            ASSERT_NE(storage.FindData<ArchetypePosition>(AZ::EntityId(i)), nullptr);
+            EXPECT_EQ(storage.FindData<ArchetypePosition>(AZ::EntityId(i))->m_x, aznumeric_cast<float>(i));
+            EXPECT_EQ(*storage.FindData<ArchetypeName>(AZ::EntityId(i))->m_name, AZStd::to_string(i));
+        }
+    }
+
+    TEST_F(ArchetypeStorageTests, ForEachChunk_VisitsMatchingArchetypes)
+    {
+        AzFramework::ArchetypeStorage storage;
+        constexpr uint32_t EntityCount = 3000;
+        for (uint32_t i = 0; i < EntityCount; ++i)
+        {
+            storage.EmplaceData<ArchetypePosition>(AZ::EntityId(i));
+            if (i % 3 == 0)
+            {
+                storage.EmplaceData<ArchetypeVelocity>(AZ::EntityId(i), ArchetypeVelocity{ 1.0f, 2.0f });
+            }
+        }
+
+        uint32_t chunkCount = 0;
+        uint32_t movedCount = 0;
+        storage.ForEachChunk<ArchetypePosition, ArchetypeVelocity>(
+            [&](uint32_t count, const AZ::EntityId*, ArchetypePosition* positions, ArchetypeVelocity* velocities)
+            {
+                EXPECT_LE(count * (sizeof(ArchetypePosition) + sizeof(ArchetypeVelocity)), AzFramework::ArchetypeStorage::ChunkSizeBytes);
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    positions[i].m_x += velocities[i].m_x;
+                    positions[i].m_y += velocities[i].m_y;
+                }
+                ++chunkCount;
+                movedCount += count;
+            });
+        EXPECT_GT(chunkCount, 1);
+        EXPECT_EQ(movedCount, EntityCount / 3);
+
+        uint32_t positionCount = 0;
+        storage.ForEach<ArchetypePosition>([&positionCount](AZ::EntityId entityId, const ArchetypePosition& position)
+        {
+            const float expected = (static_cast<AZ::u64>(entityId) % 3 == 0) ? 2.0f : 0.0f;
+            EXPECT_EQ(position.m_y, expected);
+            ++positionCount;
+        });
+        EXPECT_EQ(positionCount, EntityCount);
+    }
+
+    TEST_F(ArchetypeStorageTests, ArchetypeComponentData_AttachAndDetach)
+    {
+        AzFramework::ArchetypeStorage storage;
+        AZ::Interface<AzFramework::ArchetypeStorage>::Register(&storage);
+
+        ArchetypeVelocity componentData{ 3.0f, 4.0f };
+        AzFramework::ArchetypeComponentData<ArchetypeVelocity> attachedData;
+        attachedData.Attach(AZ::EntityId(7), componentData);
+        ASSERT_NE(attachedData.Get(), nullptr);
+        EXPECT_EQ(attachedData.Get()->m_y, 4.0f);
+
+        // Systems update the data in the storage while the component is active
+        storage.ForEach<ArchetypeVelocity>([](AZ::EntityId, ArchetypeVelocity& velocity)
+        {
+            velocity.m_y = 5.0f;
+        });
+
+        attachedData.Detach(componentData);
+        EXPECT_FALSE(attachedData.IsAttached());
+        EXPECT_EQ(componentData.m_y, 5.0f);
+        EXPECT_FALSE(storage.HasEntity(AZ::EntityId(7)));
+
+        AZ::Interface<AzFramework::ArchetypeStorage>::Unregister(&storage);
+    }
+}
@@ -312,6 +312,54 @@ namespace UnitTest
         EXPECT_TRUE(AZStd::any_of(fullPaths.cbegin(), fullPaths.cend(), [](auto& path) { return path.ends_with("two.pak"); }));
     }
 
+    TEST_F(ArchiveTestFixture, TestArchiveOpenPackBatch_MountsAllPaks_Works)
+    {
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        constexpr AZStd::string_view dataString = "HELLO WORLD";
+        constexpr size_t numPaks = 4;
+        AZStd::vector<AZStd::string> pakPaths;
+        AZStd::vector<AZStd::string> filePaths;
+        for (size_t i = 0; i < numPaks; ++i)
+        {
+            AZStd::string& pakPath = pakPaths.emplace_back(AZStd::string::format("@usercache@/batch%zu.pak", i));
+            AZStd::string& filePath = filePaths.emplace_back(AZStd::string::format("batch/file%zu.txt", i));
+
+            archive->ClosePack(pakPath.c_str());
+            fileIo->Remove(pakPath.c_str());
+
+            auto pArchive = archive->OpenArchive(pakPath.c_str(), {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+            ASSERT_NE(nullptr, pArchive);
+            EXPECT_EQ(0, pArchive->UpdateFile(filePath.c_str(), dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_STORE, 0));
+            pArchive.reset();
+            EXPECT_TRUE(IsPackValid(pakPath.c_str()));
+        }
+
+        // Pass the paks out of order, they're mounted in alphabetical order regardless
+        AZStd::vector<AZStd::string_view> batch{ pakPaths[2], pakPaths[0], pakPaths[3], pakPaths[1] };
+        AZStd::vector<AZ::IO::FixedMaxPathString> fullPaths;
+        EXPECT_TRUE(archive->OpenPackBatch("@products@", batch, &fullPaths));
+        ASSERT_EQ(numPaks, fullPaths.size());
+        for (size_t i = 0; i < numPaks; ++i)
+        {
+            EXPECT_TRUE(fullPaths[i].ends_with(AZStd::string::format("batch%zu.pak", i)));
+            EXPECT_TRUE(archive->IsFileExist(filePaths[i].c_str(), AZ::IO::FileSearchLocation::InPak));
+        }
+
+        // Opening the same paks again doesn't mount them twice
+        EXPECT_TRUE(archive->OpenPackBatch("@products@", batch));
+
+        for (const AZStd::string& pakPath : pakPaths)
+        {
+            EXPECT_TRUE(archive->ClosePack(pakPath.c_str()));
+        }
+        EXPECT_FALSE(archive->IsFileExist(filePaths[0].c_str(), AZ::IO::FileSearchLocation::InPak));
+    }
+
     TEST_F(ArchiveTestFixture, TestArchiveFGetCachedFileData_LooseFile)
     {
         // ------setup loose file FGetCachedFileData tests -------------------------
@@ -51,4 +51,77 @@ namespace UnitTest
 
         EXPECT_THAT(id2Set, ::testing::UnorderedElementsAre());
     }
+
+    TEST_F(AssetRegistry, BinaryCatalogRoundTrip)
+    {
+        AzFramework::AssetRegistry registry;
+
+        AZ::Data::AssetId assetId1("{914F8E72-5EBB-461E-A029-90B07DD7D0E4}", 1);
+        AZ::Data::AssetId assetId2("{8735EA11-CB48-41D5-8D63-2A5AFB269952}", 0);
+        AZ::Data::AssetId legacyId("{C94A4B65-5F1E-48C6-9704-42BB6CF61E11}", 2);
+
+        AZ::Data::AssetInfo assetInfo1;
+        assetInfo1.m_assetId = assetId1;
+        assetInfo1.m_assetType = AZ::Uuid("{153CC980-91FC-4766-92CE-67222DF91F3C}");
+        assetInfo1.m_sizeBytes = 1234;
+        assetInfo1.m_relativePath = "textures/test.dds";
+        registry.RegisterAsset(assetId1, assetInfo1);
+
+        AZ::Data::AssetInfo assetInfo2;
+        assetInfo2.m_assetId = assetId2;
+        assetInfo2.m_relativePath = "levels/test/test.spawnable";
+        registry.RegisterAsset(assetId2, assetInfo2);
+
+        registry.RegisterLegacyAssetMapping(legacyId, assetId1);
+        registry.RegisterAssetDependency(assetId2, AZ::Data::ProductDependency(assetId1, AZStd::bitset<64>(5)));
+
+        AZStd::vector<char> buffer;
+        registry.SaveToBinaryCatalog(buffer);
+        EXPECT_TRUE(AzFramework::AssetRegistry::IsBinaryCatalog(buffer));
+
+        AzFramework::AssetRegistry loadedRegistry;
+        ASSERT_TRUE(loadedRegistry.LoadFromBinaryCatalog(buffer));
+
+        ASSERT_EQ(loadedRegistry.m_assetIdToInfo.size(), 2);
+        const AZ::Data::AssetInfo& loadedAssetInfo1 = loadedRegistry.m_assetIdToInfo[assetId1];
+        EXPECT_EQ(loadedAssetInfo1.m_assetId, assetId1);
+        EXPECT_EQ(loadedAssetInfo1.m_assetType, assetInfo1.m_assetType);
+        EXPECT_EQ(loadedAssetInfo1.m_sizeBytes, assetInfo1.m_sizeBytes);
+        EXPECT_EQ(loadedAssetInfo1.m_relativePath, assetInfo1.m_relativePath);
+        EXPECT_EQ(loadedRegistry.m_assetIdToInfo[assetId2].m_relativePath, assetInfo2.m_relativePath);
+
+        EXPECT_EQ(loadedRegistry.GetAssetIdByPath("textures/test.dds"), assetId1);
+        EXPECT_EQ(loadedRegistry.GetAssetIdByLegacyAssetId(legacyId), assetId1);
+        EXPECT_THAT(loadedRegistry.GetLegacyMappingSubsetFromRealIds({ assetId1 }), ::testing::UnorderedElementsAre(::testing::Pair(legacyId, assetId1)));
+
+        const AZStd::vector<AZ::Data::ProductDependency> dependencies = loadedRegistry.GetAssetDependencies(assetId2);
+        ASSERT_EQ(dependencies.size(), 1);
+        EXPECT_EQ(dependencies[0].m_assetId, assetId1);
+        EXPECT_EQ(dependencies[0].m_flags, AZStd::bitset<64>(5));
+
+        // Saving the loaded registry again produces the same bytes, since the records are sorted.
+        AZStd::vector<char> savedAgainBuffer;
+        loadedRegistry.SaveToBinaryCatalog(savedAgainBuffer);
+        EXPECT_EQ(buffer, savedAgainBuffer);
+    }
+
+    TEST_F(AssetRegistry, TruncatedBinaryCatalogFailsToLoad)
+    {
+        AzFramework::AssetRegistry registry;
+        AZ::Data::AssetId assetId("{914F8E72-5EBB-461E-A029-90B07DD7D0E4}", 1);
+        AZ::Data::AssetInfo assetInfo;
+        assetInfo.m_assetId = assetId;
+        assetInfo.m_relativePath = "textures/test.dds";
+        registry.RegisterAsset(assetId, assetInfo);
+
+        AZStd::vector<char> buffer;
+        registry.SaveToBinaryCatalog(buffer);
+        buffer.pop_back();
+
+        AzFramework::AssetRegistry loadedRegistry;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(loadedRegistry.LoadFromBinaryCatalog(buffer));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_TRUE(loadedRegistry.m_assetIdToInfo.empty());
+    }
 }
@@ -9,6 +9,7 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/functional.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -378,6 +379,38 @@ namespace UnitTest
             run();
         }
 
+        TEST_F(FolderFixture, ReadBatch_MixOfValidAndInvalidReads_ResultsAreReportedPerRequest)
+        {
+            CreateTestFiles();
+
+            char buffers[4][32] = {};
+            FileReadBatch batch;
+            batch.push_back({ m_file01Name.Native(), buffers[0], 0, 4 });
+            batch.push_back({ m_file02Name.Native(), buffers[1], 8, 4 });
+            batch.push_back({ (m_fileRoot / "doesNotExist.txt").Native(), buffers[2], 0, 4 });
+            batch.push_back({ m_file03Name.Native(), buffers[3], 10, sizeof(buffers[3]) });
+
+            LocalFileIO local;
+            bool callbackCalled = false;
+            local.ReadBatch(AZStd::move(batch),
+                [&callbackCalled](FileReadBatch& requests)
+                {
+                    callbackCalled = true;
+                    ASSERT_EQ(4, requests.size());
+                    EXPECT_EQ(ResultCode::Success, requests[0].m_result);
+                    EXPECT_EQ(4, requests[0].m_bytesRead);
+                    EXPECT_EQ(ResultCode::Success, requests[1].m_result);
+                    EXPECT_EQ(4, requests[1].m_bytesRead);
+                    EXPECT_EQ(ResultCode::Error, requests[2].m_result);
+                    // Reads need to fall entirely inside the file.
+                    EXPECT_EQ(ResultCode::Error, requests[3].m_result);
+                });
+
+            EXPECT_TRUE(callbackCalled);
+            EXPECT_EQ(0, strncmp(buffers[0], "this", 4));
+            EXPECT_EQ(0, strncmp(buffers[1], "just", 4));
+        }
+
         class PermissionsTest
             : public FolderFixture
         {
@@ -332,6 +332,118 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    BENCHMARK_F(BM_Octree, EnumerateVisibleEntriesFrustum1000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->EnumerateVisibleEntries(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateVisibleEntriesFrustum10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->EnumerateVisibleEntries(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateVisibleEntriesFrustum100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->EnumerateVisibleEntries(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateVisibleEntriesFrustum1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->EnumerateVisibleEntries(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateParallelFrustum1000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->EnumerateParallel(queryData.frustum, 4, [](uint32_t, AZStd::span<AzFramework::VisibilityEntry* const>) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateParallelFrustum10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->EnumerateParallel(queryData.frustum, 4, [](uint32_t, AZStd::span<AzFramework::VisibilityEntry* const>) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateParallelFrustum100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->EnumerateParallel(queryData.frustum, 4, [](uint32_t, AZStd::span<AzFramework::VisibilityEntry* const>) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateParallelFrustum1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->EnumerateParallel(queryData.frustum, 4, [](uint32_t, AZStd::span<AzFramework::VisibilityEntry* const>) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
 }
 
 #endif
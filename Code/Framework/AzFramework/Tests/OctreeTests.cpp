@@ -9,7 +9,9 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
@@ -362,6 +364,151 @@ namespace UnitTest
         EnumerateMultipleEntriesHelper(m_octreeScene, bound1, bound2, bound3);
     }
 
+    // Compares the entries found by EnumerateVisibleEntries and EnumerateParallel against testing every entry against the frustum
+    void EnumerateVisibleEntriesMatchesBruteForceHelper(IVisibilityScene* visScene)
+    {
+        std::mt19937 randomEngine(1234);
+        std::uniform_real_distribution<float> positionDistribution(-0.9f, 0.9f);
+        std::uniform_real_distribution<float> sizeDistribution(0.01f, 0.2f);
+
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(257);
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            const AZ::Vector3 center(positionDistribution(randomEngine), positionDistribution(randomEngine), positionDistribution(randomEngine));
+            entry.m_boundingVolume = AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(sizeDistribution(randomEngine)));
+            visScene->InsertOrUpdateEntry(entry);
+        }
+
+        std::uniform_real_distribution<float> angleDistribution(0.0f, AZ::Constants::TwoPi);
+        for (int frustumIndex = 0; frustumIndex < 32; ++frustumIndex)
+        {
+            const AZ::Vector3 frustumOrigin(positionDistribution(randomEngine), positionDistribution(randomEngine), positionDistribution(randomEngine));
+            const AZ::Quaternion frustumDirection = AZ::Quaternion::CreateRotationZ(angleDistribution(randomEngine)) *
+                AZ::Quaternion::CreateRotationX(angleDistribution(randomEngine) * 0.25f - AZ::Constants::QuarterPi);
+            const AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(frustumDirection, frustumOrigin);
+            const AZ::Frustum frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, AZ::Constants::HalfPi, 0.1f, 1.5f));
+
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            visScene->EnumerateVisibleEntries(frustum, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+
+            AZStd::vector<VisibilityEntry*> expectedEntries;
+            for (AzFramework::VisibilityEntry& entry : visEntries)
+            {
+                if (AZ::ShapeIntersection::Overlaps(frustum, entry.m_boundingVolume))
+                {
+                    expectedEntries.push_back(&entry);
+                }
+            }
+
+            // Every worker reports its entries once, and together they find the same entries
+            constexpr uint32_t WorkerCount = 3;
+            AZStd::vector<VisibilityEntry*> parallelEntries;
+            uint32_t reportedWorkers = 0;
+            visScene->EnumerateParallel(frustum, WorkerCount,
+                [&parallelEntries, &reportedWorkers](uint32_t workerIndex, AZStd::span<VisibilityEntry* const> visibleEntries)
+                {
+                    ASSERT_LT(workerIndex, WorkerCount);
+                    EXPECT_EQ(reportedWorkers & (1u << workerIndex), 0u);
+                    reportedWorkers |= 1u << workerIndex;
+                    parallelEntries.insert(parallelEntries.end(), visibleEntries.begin(), visibleEntries.end());
+                });
+
+            AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+            AZStd::sort(expectedEntries.begin(), expectedEntries.end());
+            AZStd::sort(parallelEntries.begin(), parallelEntries.end());
+            EXPECT_EQ(gatheredEntries, expectedEntries);
+            EXPECT_EQ(parallelEntries, expectedEntries);
+        }
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            visScene->RemoveEntry(entry);
+        }
+    }
+
+    TEST_F(OctreeTests, EnumerateVisibleEntries_RandomEntries_MatchesOverlappingEntries)
+    {
+        m_console->PerformCommand("bg_octreeNodeMaxEntries 4");
+        EnumerateVisibleEntriesMatchesBruteForceHelper(m_octreeScene);
+    }
+
+    TEST_F(OctreeTests, EnumerateVisibleEntries_LooseOctree_MatchesOverlappingEntries)
+    {
+        m_console->PerformCommand("bg_octreeNodeMaxEntries 4");
+        m_console->PerformCommand("bg_octreeLooseness 1.5");
+        OctreeScene* looseScene = azdynamic_cast<OctreeScene*>(m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeLooseUnitTestScene")));
+        m_console->PerformCommand("bg_octreeLooseness 1.0");
+        ASSERT_NE(looseScene, nullptr);
+        EXPECT_FLOAT_EQ(looseScene->GetLooseness(), 1.5f);
+
+        EnumerateVisibleEntriesMatchesBruteForceHelper(looseScene);
+
+        m_octreeSystemComponent->DestroyVisibilityScene(looseScene);
+    }
+
+    TEST_F(OctreeTests, LooseOctree_EntryStraddlesSplitPlane_EntryIsStoredInChildNode)
+    {
+        m_console->PerformCommand("bg_octreeLooseness 1.5");
+        OctreeScene* looseScene = azdynamic_cast<OctreeScene*>(m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeLooseUnitTestScene")));
+        m_console->PerformCommand("bg_octreeLooseness 1.0");
+        ASSERT_NE(looseScene, nullptr);
+
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.1f), AZ::Vector3(0.1f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3(0.9f));
+
+        // The second entry splits the root, the first entry straddles the split planes but fits in the loose bounds of a child
+        for (AzFramework::IVisibilityScene* visScene : { static_cast<IVisibilityScene*>(m_octreeScene), static_cast<IVisibilityScene*>(looseScene) })
+        {
+            visScene->InsertOrUpdateEntry(visEntry[0]);
+            visScene->InsertOrUpdateEntry(visEntry[1]);
+            const OctreeNode* straddlingNode = static_cast<const OctreeNode*>(visEntry[0].m_internalNode);
+            ASSERT_NE(straddlingNode, nullptr);
+            EXPECT_EQ(straddlingNode->IsLeaf(), visScene == looseScene);
+            EXPECT_TRUE(AZ::ShapeIntersection::Contains(straddlingNode->GetLooseBounds(), visEntry[0].m_boundingVolume));
+            visScene->RemoveEntry(visEntry[0]);
+            visScene->RemoveEntry(visEntry[1]);
+        }
+
+        m_octreeSystemComponent->DestroyVisibilityScene(looseScene);
+    }
+
+    TEST_F(OctreeTests, DeferredUpdates_InsertAndRemove_AppliedByNextQuery)
+    {
+        m_console->PerformCommand("bg_octreeDeferUpdates true");
+        OctreeScene* deferredScene = azdynamic_cast<OctreeScene*>(m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeDeferredUnitTestScene")));
+        m_console->PerformCommand("bg_octreeDeferUpdates false");
+        ASSERT_NE(deferredScene, nullptr);
+        EXPECT_TRUE(deferredScene->IsDeferringUpdates());
+
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        deferredScene->InsertOrUpdateEntry(visEntry[0]);
+        deferredScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_TRUE(visEntry[0].m_internalNode == nullptr);
+        EXPECT_TRUE(visEntry[1].m_internalNode == nullptr);
+
+        // Removing an entry before its insert is applied drops the insert
+        deferredScene->RemoveEntry(visEntry[1]);
+        ValidateEntryCountEqualsExpectedCount(deferredScene, 1);
+        EXPECT_TRUE(visEntry[0].m_internalNode != nullptr);
+        EXPECT_TRUE(visEntry[1].m_internalNode == nullptr);
+
+        // The queued bounds are used, even if the entry changes again before the update is applied
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.6f), AZ::Vector3(0.9f));
+        deferredScene->InsertOrUpdateEntry(visEntry[0]);
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        deferredScene->Enumerate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.5f), AZ::Vector3(1.0f)), [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+        ASSERT_EQ(gatheredEntries.size(), 1u);
+        EXPECT_EQ(gatheredEntries[0], &visEntry[0]);
+
+        deferredScene->RemoveEntry(visEntry[0]);
+        ValidateEntryCountEqualsExpectedCount(deferredScene, 0);
+        m_octreeSystemComponent->DestroyVisibilityScene(deferredScene);
+    }
+
     TEST_F(OctreeTests, InsertOrUpdateEntry_OverFillRootNodeWithLargeEntries_EntriesAreNotLost)
     {
         // Validate that the octree works if you exceed the max entry count with large entries,
@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 #include <AzFramework/Application/Application.h>
@@ -108,6 +109,8 @@ namespace UnitTest
             LeakDetectionFixture::SetUp();
 
             m_application = new TestApplication();
+            // The spawnable entities manager reads its settings when it's created during startup.
+            SetUpSettings(*AZ::SettingsRegistry::Get());
             AZ::ComponentApplication::Descriptor descriptor;
             AZ::ComponentApplication::StartupParameters startupParameters;
             startupParameters.m_loadSettingsRegistry = false;
@@ -151,6 +154,10 @@ namespace UnitTest
             LeakDetectionFixture::TearDown();
         }
 
+        virtual void SetUpSettings([[maybe_unused]] AZ::SettingsRegistryInterface& settingsRegistry)
+        {
+        }
+
         void ProcessQueueTillEmtpy()
         {
             for (size_t i=0; i<1000; ++i) // Don't do this indefinitely to avoid deadlocking on a failing test.
@@ -631,6 +638,172 @@ namespace UnitTest
         ProcessQueueTillEmtpy();
     }
 
+    class SpawnableEntitiesManagerParallelCloneTest : public SpawnableEntitiesManagerTest
+    {
+    public:
+        void SetUpSettings(AZ::SettingsRegistryInterface& settingsRegistry) override
+        {
+            // Clone every request in parallel and add entities to the game context over multiple frames.
+            settingsRegistry.Set("/O3DE/AzFramework/Spawnables/ParallelCloneThreshold", AZ::u64(1));
+            settingsRegistry.Set("/O3DE/AzFramework/Spawnables/ActivationBudgetUs", AZ::u64(1));
+        }
+    };
+
+    TEST_F(SpawnableEntitiesManagerParallelCloneTest, SpawnAllEntities_AllEntitiesReferenceOtherEntities_EntityIdsAreMappedCorrectly)
+    {
+        for (EntityReferenceScheme refScheme : {
+                EntityReferenceScheme::AllReferenceFirst, EntityReferenceScheme::AllReferenceLast,
+                EntityReferenceScheme::AllReferenceThemselves, EntityReferenceScheme::AllReferenceNextCircular,
+                EntityReferenceScheme::AllReferencePreviousCircular })
+        {
+            constexpr size_t NumEntities = 200;
+            FillSpawnable(NumEntities);
+            CreateEntityReferences(refScheme);
+
+            size_t spawnedEntitiesCount = 0;
+            auto callback = [this, refScheme, &spawnedEntitiesCount]
+                (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                spawnedEntitiesCount += entities.size();
+                ValidateEntityReferences(refScheme, NumEntities, entities);
+            };
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = AZStd::move(callback);
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+            ProcessQueueTillEmtpy();
+
+            EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+        }
+    }
+
+    TEST_F(SpawnableEntitiesManagerParallelCloneTest, SpawnAllEntities_ActivationBudgetExceeded_EntitiesAddedOverMultipleFrames)
+    {
+        static constexpr size_t NumEntities = 200;
+        FillSpawnable(NumEntities);
+
+        size_t spawnedEntitiesCount = 0;
+        size_t completionCount = 0;
+        auto callback = [&spawnedEntitiesCount, &completionCount](
+                            AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            spawnedEntitiesCount += entities.size();
+            ++completionCount;
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+
+        // The first entity is always added, but adding it takes longer than the budget so the request continues next frame.
+        EXPECT_EQ(
+            AzFramework::SpawnableEntitiesManager::CommandQueueStatus::HasCommandsLeft,
+            m_manager->ProcessQueue(
+                AzFramework::SpawnableEntitiesManager::CommandQueuePriority::High |
+                AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular));
+        EXPECT_EQ(0u, completionCount);
+
+        ProcessQueueTillEmtpy();
+        EXPECT_EQ(1u, completionCount);
+        EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+    }
+
+    class SpawnableEntitiesManagerFastCloneTest : public SpawnableEntitiesManagerTest
+    {
+    public:
+        void SetUp() override
+        {
+            SpawnableEntitiesManagerTest::SetUp();
+            s_cloneCount = 0;
+            m_manager->RegisterComponentCloneFunction(azrtti_typeid<SourceSpawnableComponent>(), &CloneSourceSpawnableComponent);
+            m_manager->RegisterComponentCloneFunction(
+                azrtti_typeid<ComponentWithEntityReference>(), &CloneComponentWithEntityReference);
+        }
+
+        static AZ::Component* CloneSourceSpawnableComponent(const AZ::Component&, const AzFramework::SpawnableEntitiesManager::EntityIdMap&)
+        {
+            ++s_cloneCount;
+            return aznew SourceSpawnableComponent();
+        }
+
+        static AZ::Component* CloneComponentWithEntityReference(
+            const AZ::Component& prototype, const AzFramework::SpawnableEntitiesManager::EntityIdMap& prototypeToCloneMap)
+        {
+            ++s_cloneCount;
+            auto clone = aznew ComponentWithEntityReference();
+            const AZ::EntityId reference = static_cast<const ComponentWithEntityReference&>(prototype).m_entityReference;
+            auto it = prototypeToCloneMap.find(reference);
+            clone->m_entityReference = it != prototypeToCloneMap.end() ? it->second : reference;
+            return clone;
+        }
+
+        static inline size_t s_cloneCount = 0;
+    };
+
+    TEST_F(SpawnableEntitiesManagerFastCloneTest, SpawnAllEntities_AllComponentsHaveCloneFunctions_EntitiesClonedWithCloneFunctions)
+    {
+        constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular);
+
+        size_t spawnedEntitiesCount = 0;
+        auto callback = [this, &spawnedEntitiesCount](
+                            AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            spawnedEntitiesCount += entities.size();
+            ValidateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular, NumEntities, entities);
+        };
+
+        // Spawn twice so the second spawn uses the cached clone program.
+        for (int spawns = 0; spawns < 2; ++spawns)
+        {
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = callback;
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+            ProcessQueueTillEmtpy();
+        }
+
+        EXPECT_EQ(NumEntities * 2, spawnedEntitiesCount);
+        // Each entity has two components.
+        EXPECT_EQ(NumEntities * 2 * 2, s_cloneCount);
+    }
+
+    TEST_F(SpawnableEntitiesManagerFastCloneTest, SpawnAllEntities_ComponentWithoutCloneFunction_EntitiesClonedWithSerializeContext)
+    {
+        m_manager->UnregisterComponentCloneFunction(azrtti_typeid<ComponentWithEntityReference>());
+
+        constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceFirst);
+
+        auto callback = [this](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ValidateEntityReferences(EntityReferenceScheme::AllReferenceFirst, NumEntities, entities);
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(0u, s_cloneCount);
+    }
+
+    TEST_F(SpawnableEntitiesManagerFastCloneTest, SpawnEntities_AllComponentsHaveCloneFunctions_ForwardReferencesWork)
+    {
+        constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceLast);
+
+        auto callback = [this](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ValidateEntityReferences(EntityReferenceScheme::AllReferenceLast, NumEntities, entities);
+        };
+        AzFramework::SpawnEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnEntities(*m_ticket, { 0, 1, 2, 3 }, AZStd::move(optionalArgs));
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(NumEntities * 2, s_cloneCount);
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_AllAliasesWithDisabled_NoEntitiesSpawned)
     {
         using namespace AzFramework;
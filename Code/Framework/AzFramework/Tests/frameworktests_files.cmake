@@ -12,6 +12,7 @@ set(FILES
     Spawnable/SpawnableEntitiesManagerTests.cpp
     Spawnable/SpawnableScriptMediatorTests.cpp
     Spawnable/SpawnableTests.cpp
+    ArchetypeStorageTests.cpp
     ArchiveCompressionTests.cpp
     ArchiveTests.cpp
     BehaviorEntityTests.cpp
@@ -16,23 +16,27 @@ namespace AzNetworking
     void TimeoutQueue::Reset()
     {
         m_timeoutItemMap.clear();
-        m_timeoutItemQueue = TimeoutItemQueue();
+        m_timeoutItemWheel.Reset();
         m_nextTimeoutId = TimeoutId{0};
     }
 
     TimeoutId TimeoutQueue::RegisterItem(uint64_t userData, AZ::TimeMs timeoutMs)
     {
         const TimeoutId timeoutId = m_nextTimeoutId;
-        const AZ::TimeMs timeoutTimeMs = AZ::GetElapsedTimeMs() + timeoutMs;
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        const AZ::TimeMs timeoutTimeMs = currentTimeMs + timeoutMs;
         AZLOG(TimeoutQueue, "Pushing timeoutid %u with user data %" PRIu64 " to expire at time %u",
             aznumeric_cast<uint32_t>(timeoutId),
             userData,
             aznumeric_cast<uint32_t>(timeoutTimeMs)
         );
 
-        TimeoutQueueItem queueItem(timeoutId, timeoutTimeMs);
-        m_timeoutItemMap[timeoutId] = TimeoutItem(userData, timeoutMs);
-        m_timeoutItemQueue.push(queueItem);
+        // Keep the wheel current so it doesn't have to catch up on time that passed while it was empty
+        m_timeoutItemWheel.Advance(currentTimeMs);
+
+        TimeoutMapItem& mapItem = m_timeoutItemMap[timeoutId];
+        mapItem.m_item = TimeoutItem(userData, timeoutMs);
+        mapItem.m_wheelHandle = m_timeoutItemWheel.Insert(timeoutTimeMs, timeoutId);
         ++m_nextTimeoutId;
 
         return timeoutId;
@@ -43,14 +47,19 @@ namespace AzNetworking
         TimeoutItemMap::iterator iter = m_timeoutItemMap.find(timeoutId);
         if (iter != m_timeoutItemMap.end())
         {
-            return &(iter->second);
+            return &(iter->second.m_item);
         }
         return nullptr;
     }
 
     void TimeoutQueue::RemoveItem(TimeoutId timeoutId)
     {
-        m_timeoutItemMap.erase(timeoutId);
+        TimeoutItemMap::iterator iter = m_timeoutItemMap.find(timeoutId);
+        if (iter != m_timeoutItemMap.end())
+        {
+            m_timeoutItemWheel.Remove(iter->second.m_wheelHandle);
+            m_timeoutItemMap.erase(iter);
+        }
     }
 
     void TimeoutQueue::UpdateTimeouts(const TimeoutHandler& timeoutHandler, int32_t maxTimeouts)
@@ -61,18 +70,9 @@ namespace AzNetworking
             maxTimeouts = INT_MAX;
         }
         AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
-        while (m_timeoutItemQueue.size() > 0)
+        m_timeoutItemWheel.Advance(currentTimeMs);
+        while (m_timeoutItemWheel.HasExpired())
         {
-            const TimeoutQueueItem queueItem = m_timeoutItemQueue.top();
-            const TimeoutId    itemTimeoutId = queueItem.m_timeoutId;
-            const AZ::TimeMs   itemTimeoutMs = queueItem.m_timeoutTimeMs;
-
-            // Head item has not timed out yet, we can terminate because we've run out of timed out items
-            if (itemTimeoutMs >= currentTimeMs)
-            {
-                break;
-            }
-
             ++numTimeouts;
 
             if (numTimeouts >= maxTimeouts)
@@ -82,7 +82,8 @@ namespace AzNetworking
             }
 
             // Pop the item, we're either going to time it out or reinsert it
-            m_timeoutItemQueue.pop();
+            TimeoutId itemTimeoutId = TimeoutId{ 0 };
+            m_timeoutItemWheel.PopExpired(itemTimeoutId);
 
             TimeoutItemMap::iterator iter = m_timeoutItemMap.find(itemTimeoutId);
             if (iter == m_timeoutItemMap.end())
@@ -91,13 +92,13 @@ namespace AzNetworking
                 continue;
             }
 
-            TimeoutItem mapItem = iter->second;
+            iter->second.m_wheelHandle = TimeoutItemWheel::InvalidHandle;
+            TimeoutItem mapItem = iter->second.m_item;
 
             // Check to see if the item has been refreshed since it was inserted
             if (mapItem.m_nextTimeoutTimeMs > currentTimeMs)
             {
-                TimeoutQueueItem reQueueItem(itemTimeoutId, mapItem.m_nextTimeoutTimeMs);
-                m_timeoutItemQueue.push(reQueueItem);
+                iter->second.m_wheelHandle = m_timeoutItemWheel.Insert(mapItem.m_nextTimeoutTimeMs, itemTimeoutId);
                 continue;
             }
 
@@ -108,9 +109,12 @@ namespace AzNetworking
             if (result == TimeoutResult::Refresh)
             {
                 mapItem.UpdateTimeoutTime(currentTimeMs);
-                // Re-insert into priority queue
-                TimeoutQueueItem reQueueItem(itemTimeoutId, mapItem.m_nextTimeoutTimeMs);
-                m_timeoutItemQueue.push(reQueueItem);
+                // Re-insert into the timing wheel, the handler may have removed the item in the meantime
+                iter = m_timeoutItemMap.find(itemTimeoutId);
+                if (iter != m_timeoutItemMap.end())
+                {
+                    iter->second.m_wheelHandle = m_timeoutItemWheel.Insert(mapItem.m_nextTimeoutTimeMs, itemTimeoutId);
+                }
                 continue;
             }
 
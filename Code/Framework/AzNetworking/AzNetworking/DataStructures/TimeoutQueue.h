@@ -9,9 +9,9 @@
 #pragma once
 
 #include <AzCore/Time/ITime.h>
+#include <AzCore/Time/TimingWheel.h>
 #include <AzCore/RTTI/TypeSafeIntegral.h>
 #include <AzCore/std/containers/map.h>
-#include <AzCore/std/containers/queue.h>
 
 namespace AzNetworking
 {
@@ -25,6 +25,7 @@ namespace AzNetworking
 
     //! @class TimeoutQueue
     //! @brief class for managing timeout items.
+    //! Items are ordered by an AZ::TimingWheel, so registering, refreshing and removing items takes constant time.
     class TimeoutQueue
     {
     public:
@@ -70,22 +71,19 @@ namespace AzNetworking
 
     private:
 
-        struct TimeoutQueueItem
-        {
-            TimeoutQueueItem(TimeoutId timeoutId, AZ::TimeMs timeoutTimeMs);
-
-            bool operator < (const TimeoutQueueItem &rhs) const;
+        using TimeoutItemWheel = AZ::TimingWheel<TimeoutId>;
 
-            TimeoutId m_timeoutId;
-            AZ::TimeMs m_timeoutTimeMs;
+        struct TimeoutMapItem
+        {
+            TimeoutItem m_item;
+            TimeoutItemWheel::Handle m_wheelHandle = TimeoutItemWheel::InvalidHandle;
         };
 
-        using TimeoutItemMap   = AZStd::map<TimeoutId, TimeoutItem>;
-        using TimeoutItemQueue = AZStd::priority_queue<TimeoutQueueItem>;
+        using TimeoutItemMap = AZStd::map<TimeoutId, TimeoutMapItem>;
 
         TimeoutId        m_nextTimeoutId = TimeoutId{ 0 };
         TimeoutItemMap   m_timeoutItemMap;
-        TimeoutItemQueue m_timeoutItemQueue;
+        TimeoutItemWheel m_timeoutItemWheel;
     };
 }
 
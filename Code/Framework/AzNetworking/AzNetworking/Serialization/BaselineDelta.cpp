@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/BaselineDelta.h>
+
+namespace AzNetworking
+{
+    // The encoded data starts with the size of the data as a 7-bit varint, followed by runs:
+    // a control byte below 0x80 is a run of (control + 1) unchanged bytes,
+    // a control byte of 0x80 and above is followed by (control - 0x7F) changed bytes, XOR-ed with the baseline.
+    static constexpr uint32_t MaxRunLength = 128;
+    static constexpr uint8_t LiteralRunFlag = 0x80;
+
+    static inline uint8_t GetBaselineByte(const uint8_t* baseline, uint32_t baselineSize, uint32_t index)
+    {
+        return (index < baselineSize) ? baseline[index] : 0;
+    }
+
+    bool EncodeBaselineDelta
+    (
+        const uint8_t* baseline,
+        uint32_t baselineSize,
+        const uint8_t* data,
+        uint32_t dataSize,
+        uint8_t* outBuffer,
+        uint32_t outCapacity,
+        uint32_t& outSize
+    )
+    {
+        if (baseline == nullptr)
+        {
+            baselineSize = 0;
+        }
+
+        uint32_t outIndex = 0;
+        uint32_t remainingSize = dataSize;
+        do
+        {
+            if (outIndex >= outCapacity)
+            {
+                return false;
+            }
+            const uint8_t sizeByte = static_cast<uint8_t>(remainingSize & 0x7F);
+            remainingSize >>= 7;
+            outBuffer[outIndex++] = sizeByte | ((remainingSize > 0) ? 0x80 : 0x00);
+        } while (remainingSize > 0);
+
+        uint32_t index = 0;
+        while (index < dataSize)
+        {
+            uint32_t runLength = 0;
+            while ((index + runLength < dataSize) && (runLength < MaxRunLength)
+                && (data[index + runLength] == GetBaselineByte(baseline, baselineSize, index + runLength)))
+            {
+                ++runLength;
+            }
+
+            if (runLength > 0)
+            {
+                if (outIndex >= outCapacity)
+                {
+                    return false;
+                }
+                outBuffer[outIndex++] = static_cast<uint8_t>(runLength - 1);
+                index += runLength;
+                continue;
+            }
+
+            // A single unchanged byte between changed bytes is cheaper to send as part of the changed bytes
+            while ((index + runLength < dataSize) && (runLength < MaxRunLength))
+            {
+                const uint32_t next = index + runLength;
+                const bool nextUnchanged = data[next] == GetBaselineByte(baseline, baselineSize, next);
+                const bool followingUnchanged = (next + 1 >= dataSize) || (data[next + 1] == GetBaselineByte(baseline, baselineSize, next + 1));
+                if (nextUnchanged && followingUnchanged)
+                {
+                    break;
+                }
+                ++runLength;
+            }
+
+            if (outIndex + 1 + runLength > outCapacity)
+            {
+                return false;
+            }
+            outBuffer[outIndex++] = static_cast<uint8_t>(LiteralRunFlag + runLength - 1);
+            for (uint32_t runIndex = 0; runIndex < runLength; ++runIndex, ++index)
+            {
+                outBuffer[outIndex++] = data[index] ^ GetBaselineByte(baseline, baselineSize, index);
+            }
+        }
+
+        outSize = outIndex;
+        return true;
+    }
+
+    bool DecodeBaselineDelta
+    (
+        const uint8_t* baseline,
+        uint32_t baselineSize,
+        const uint8_t* delta,
+        uint32_t deltaSize,
+        uint8_t* outBuffer,
+        uint32_t outCapacity,
+        uint32_t& outSize
+    )
+    {
+        if (baseline == nullptr)
+        {
+            baselineSize = 0;
+        }
+
+        uint32_t deltaIndex = 0;
+        uint32_t dataSize = 0;
+        for (uint32_t shift = 0;; shift += 7)
+        {
+            if ((deltaIndex >= deltaSize) || (shift > 28))
+            {
+                return false;
+            }
+            const uint8_t sizeByte = delta[deltaIndex++];
+            dataSize |= static_cast<uint32_t>(sizeByte & 0x7F) << shift;
+            if ((sizeByte & 0x80) == 0)
+            {
+                break;
+            }
+        }
+
+        if (dataSize > outCapacity)
+        {
+            return false;
+        }
+
+        uint32_t index = 0;
+        while (index < dataSize)
+        {
+            if (deltaIndex >= deltaSize)
+            {
+                return false;
+            }
+
+            const uint8_t control = delta[deltaIndex++];
+            if (control < LiteralRunFlag)
+            {
+                const uint32_t runLength = static_cast<uint32_t>(control) + 1;
+                if (index + runLength > dataSize)
+                {
+                    return false;
+                }
+                for (uint32_t runIndex = 0; runIndex < runLength; ++runIndex, ++index)
+                {
+                    outBuffer[index] = GetBaselineByte(baseline, baselineSize, index);
+                }
+            }
+            else
+            {
+                const uint32_t runLength = static_cast<uint32_t>(control - LiteralRunFlag) + 1;
+                if ((index + runLength > dataSize) || (deltaIndex + runLength > deltaSize))
+                {
+                    return false;
+                }
+                for (uint32_t runIndex = 0; runIndex < runLength; ++runIndex, ++index)
+                {
+                    outBuffer[index] = delta[deltaIndex++] ^ GetBaselineByte(baseline, baselineSize, index);
+                }
+            }
+        }
+
+        outSize = dataSize;
+        return deltaIndex == deltaSize;
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AzNetworking
+{
+    //! Delta encodes serialized data against a baseline the remote endpoint already has, typically the last state it acknowledged.
+    //! The data is XOR-ed with the baseline, so that the serialized values that didn't change turn into zeros, and the runs of zeros are
+    //! run-length encoded. Numbers are serialized in network byte order, so small changes of a quantized value only leave its low bytes.
+    //! The data doesn't need to have the same size as the baseline, the bytes past the end of the baseline are treated as zeros.
+    //! @param baseline       the baseline the remote endpoint has, nullptr for none
+    //! @param baselineSize   the size of the baseline in bytes
+    //! @param data           the data to encode
+    //! @param dataSize       the size of the data in bytes
+    //! @param outBuffer      the buffer to write the encoded data to
+    //! @param outCapacity    the capacity of the output buffer in bytes
+    //! @param outSize        on success, the size of the encoded data in bytes
+    //! @return boolean true on success, false if the output buffer is too small
+    bool EncodeBaselineDelta
+    (
+        const uint8_t* baseline,
+        uint32_t baselineSize,
+        const uint8_t* data,
+        uint32_t dataSize,
+        uint8_t* outBuffer,
+        uint32_t outCapacity,
+        uint32_t& outSize
+    );
+
+    //! Decodes data encoded by EncodeBaselineDelta against the same baseline.
+    //! @param baseline       the baseline the data was encoded against, nullptr for none
+    //! @param baselineSize   the size of the baseline in bytes
+    //! @param delta          the encoded data
+    //! @param deltaSize      the size of the encoded data in bytes
+    //! @param outBuffer      the buffer to write the decoded data to
+    //! @param outCapacity    the capacity of the output buffer in bytes
+    //! @param outSize        on success, the size of the decoded data in bytes
+    //! @return boolean true on success, false if the encoded data is malformed or the output buffer is too small
+    bool DecodeBaselineDelta
+    (
+        const uint8_t* baseline,
+        uint32_t baselineSize,
+        const uint8_t* delta,
+        uint32_t deltaSize,
+        uint8_t* outBuffer,
+        uint32_t outCapacity,
+        uint32_t& outSize
+    );
+}
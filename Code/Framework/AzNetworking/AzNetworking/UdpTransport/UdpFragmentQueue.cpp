@@ -24,7 +24,12 @@ namespace AzNetworking
         {
             const SequenceId fragmentSequence = static_cast<SequenceId>(item.m_userData & 0xFF);
             AZLOG(NET_FragmentQueue, "Timing out unreliable fragmented packet %u", static_cast<uint32_t>(fragmentSequence));
-            m_packetFragments.erase(fragmentSequence);
+            auto packetFragments = m_packetFragments.find(fragmentSequence);
+            if (packetFragments != m_packetFragments.end())
+            {
+                ReleaseFragments(packetFragments->second);
+                m_packetFragments.erase(packetFragments);
+            }
             return TimeoutResult::Delete;
         });
     }
@@ -45,11 +50,12 @@ namespace AzNetworking
 
     PacketDispatchResult UdpFragmentQueue::ProcessReceivedChunk(UdpConnection* connection, IConnectionListener& connectionListener, UdpPacketHeader& header, ISerializer& serializer)
     {
-        AZStd::unique_ptr<CorePackets::FragmentedPacket> packet = AZStd::make_unique<CorePackets::FragmentedPacket>();
+        FragmentPtr packet = AcquireFragment();
 
         if (!serializer.Serialize(*packet, "Packet"))
         {
             AZLOG(NET_FragmentQueue, "Fragment failed serialization");
+            ReleaseFragment(AZStd::move(packet));
             return PacketDispatchResult::Failure;
         }
 
@@ -69,6 +75,7 @@ namespace AzNetworking
         {
             // Too old to process
             AZLOG(NET_FragmentQueue, "Fragment sequence ID is outside our tracked window");
+            ReleaseFragment(AZStd::move(packet));
             return PacketDispatchResult::Failure;
         }
 
@@ -76,6 +83,7 @@ namespace AzNetworking
         {
             // Received packet is a duplicate of one already forwarded to gameplay
             AZLOG(NET_FragmentQueue, "Received duplicate of fragmented packet %u, discarding", static_cast<uint32_t>(fragmentSequence));
+            ReleaseFragment(AZStd::move(packet));
             return PacketDispatchResult::Success;
         }
 
@@ -95,10 +103,19 @@ namespace AzNetworking
         {
             // Either we disagree on the number of chunks, or chunkIndex is bigger than the expected size, bail and disconnect
             AZLOG(NET_FragmentQueue, "Malformed chunk metadata in fragmented packet, chunkIndex %u, chunkCount %u, reservedSize %u", chunkIndex, chunkCount, static_cast<uint32_t>(packetFragments.size()));
+            ReleaseFragment(AZStd::move(packet));
             return PacketDispatchResult::Failure;
         }
 
-        packetFragments[chunkIndex] = AZStd::move(packet);
+        if (packetFragments[chunkIndex] != nullptr)
+        {
+            // Keep the chunk we already have, and reuse the duplicate
+            ReleaseFragment(AZStd::move(packet));
+        }
+        else
+        {
+            packetFragments[chunkIndex] = AZStd::move(packet);
+        }
 
         uint32_t totalPacketSize = 0;
         for (uint32_t index = 0; index < packetFragments.size(); ++index)
@@ -137,6 +154,7 @@ namespace AzNetworking
         }
 
         // We can erase all the chunks now, packet is completed
+        ReleaseFragments(packetFragments);
         m_packetFragments.erase(fragmentSequence);
 
         NetworkOutputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
@@ -169,4 +187,33 @@ namespace AzNetworking
 
         return handledPacket;
     }
+
+    UdpFragmentQueue::FragmentPtr UdpFragmentQueue::AcquireFragment()
+    {
+        if (m_fragmentPool.empty())
+        {
+            return AZStd::make_unique<CorePackets::FragmentedPacket>();
+        }
+
+        FragmentPtr fragment = AZStd::move(m_fragmentPool.back());
+        m_fragmentPool.pop_back();
+        return fragment;
+    }
+
+    void UdpFragmentQueue::ReleaseFragment(FragmentPtr fragment)
+    {
+        if (fragment != nullptr && m_fragmentPool.size() < MaxPooledFragments)
+        {
+            m_fragmentPool.push_back(AZStd::move(fragment));
+        }
+    }
+
+    void UdpFragmentQueue::ReleaseFragments(PacketFragments& packetFragments)
+    {
+        for (FragmentPtr& fragment : packetFragments)
+        {
+            ReleaseFragment(AZStd::move(fragment));
+        }
+        packetFragments.clear();
+    }
 }
@@ -50,12 +50,27 @@ namespace AzNetworking
 
     private:
 
+        using FragmentPtr = AZStd::unique_ptr<CorePackets::FragmentedPacket>;
+        using PacketFragments = AZStd::vector<FragmentPtr>;
+
+        //! Returns a fragment from the pool, or a new one if the pool is empty.
+        FragmentPtr AcquireFragment();
+
+        //! Returns a fragment to the pool for reuse.
+        void ReleaseFragment(FragmentPtr fragment);
+
+        //! Returns the fragments of a completed or timed out packet to the pool.
+        void ReleaseFragments(PacketFragments& packetFragments);
+
         TimeoutQueue m_timeoutQueue;
         SequenceGenerator m_sequenceGenerator;
 
-        using PacketFragments = AZStd::vector<AZStd::unique_ptr<CorePackets::FragmentedPacket>>;
         AZStd::unordered_map<SequenceId, PacketFragments> m_packetFragments;
 
+        // Fragments kept for reuse, so receiving a chunk doesn't allocate
+        static constexpr uint32_t MaxPooledFragments = 64;
+        PacketFragments m_fragmentPool;
+
         static constexpr uint32_t PacketWindowAckCount = 16384; // The total number of packet id's to track
         using PacketAckContainer = RingbufferBitset<PacketWindowAckCount>;
 
@@ -17,6 +17,9 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/MathUtils.h>
 
 namespace AzNetworking
@@ -38,6 +41,8 @@ namespace AzNetworking
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(bool, net_FragmentsAlwaysReliable, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether fragmented packets should be reliable by default or use their source packet's reliability type");
+    AZ_CVAR(bool, net_UdpBatchSends, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, outgoing packets are queued and flushed together during the network interface update, with a single system call on platforms that support it");
+    AZ_CVAR(uint32_t, net_UdpDecodeShardCount, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Number of job threads decrypting and decompressing the received packets, with the connections sharded across them. 0 or 1 decodes on the game thread"); // WARN: needs to be set before creating the network interface
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
@@ -66,6 +71,20 @@ namespace AzNetworking
     {
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
         m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressor);
+        m_socket->SetBatchSends(net_UdpBatchSends);
+
+        // Each decode shard gets its own compressor, as compressors don't support concurrent use
+        const uint32_t decodeShardCount = net_UdpDecodeShardCount;
+        if (decodeShardCount > 1)
+        {
+            m_decodeShards.reserve(decodeShardCount);
+            for (uint32_t shardIndex = 0; shardIndex < decodeShardCount; ++shardIndex)
+            {
+                AZStd::unique_ptr<DecodeShard> shard = AZStd::make_unique<DecodeShard>();
+                shard->m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressor);
+                m_decodeShards.push_back(AZStd::move(shard));
+            }
+        }
     }
 
     UdpNetworkInterface::~UdpNetworkInterface()
@@ -176,6 +195,10 @@ namespace AzNetworking
         }
 
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+
+        // Send the packets queued since the last update
+        m_socket->FlushSends();
+
         const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
         if (packets == nullptr)
         {
@@ -183,6 +206,8 @@ namespace AzNetworking
             return;
         }
 
+        PredecodePackets(*packets);
+
         for (uint32_t i = 0; i < packets->size(); ++i)
         {
             const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
@@ -217,48 +242,37 @@ namespace AzNetworking
                 continue;
             }
 
+            UdpPacketHeader header;
+            const uint8_t* decodedPacketData = nullptr;
             int32_t decodedPacketSize = 0;
-            m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
-            const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
-            m_decryptBuffer.Resize(decodedPacketSize);
-
-            if (decodedPacketSize == 0)
+            uint32_t flagBytes = 0;
+            DecodeResult decodeResult = DecodeResult::Skipped;
+            if (i < m_predecodedPackets.size() && m_predecodedPackets[i].m_isDecoded)
             {
-                // OpenSSL may have consumed packets during handshake negotiation
-                continue;
+                const PredecodedPacket& predecodedPacket = m_predecodedPackets[i];
+                decodeResult = predecodedPacket.m_result;
+                header = predecodedPacket.m_header;
+                decodedPacketData = predecodedPacket.m_data;
+                decodedPacketSize = predecodedPacket.m_size;
+                flagBytes = predecodedPacket.m_flagBytes;
             }
-            else if (decodedPacketSize < 0)
+            else
             {
-                // Late unencrypted handshake packets or just random garbage can show up, discard and continue
-                continue;
+                decodeResult = DecodeReceivedPacket(*connection, packet, m_compressor.get(), m_decryptBuffer, m_decompressBuffer,
+                    header, decodedPacketData, decodedPacketSize, flagBytes);
             }
 
-            connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
-
-            // Decode the packet flag bitset first since it's always uncompressed
-            UdpPacketHeader header;
+            if (decodeResult == DecodeResult::Skipped)
             {
-                NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
-                if (!header.SerializePacketFlags(flagSerializer))
-                {
-                    continue;
-                }
-                // Adjust decoded tracking to represent the payload now that we've grabbed the flags
-                decodedPacketData = flagSerializer.GetUnreadData();
-                decodedPacketSize = flagSerializer.GetUnreadSize();
-                GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
+                continue;
             }
 
-            if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
+            connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
+            GetMetrics().m_recvBytesUncompressed += flagBytes;
+
+            if (decodeResult == DecodeResult::Failed)
             {
-                // Only the payload is compressed
-                if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
-                {
-                    AZLOG_WARN("Failed to decompress packet!");
-                    continue;
-                }
-                decodedPacketData = m_decompressBuffer.GetBuffer();
-                decodedPacketSize = static_cast<int32_t>(m_decompressBuffer.GetSize());
+                continue;
             }
             GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
 
@@ -341,6 +355,9 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        // Send the packets queued during this update, such as acks, heartbeats and retransmits
+        m_socket->FlushSends();
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
@@ -436,9 +453,9 @@ namespace AzNetworking
         m_packetTimeoutQueue.RegisterItem(ConstructTimeoutId(connectionId, packetId, reliability), packetTimeoutMs);
     }
 
-    bool UdpNetworkInterface::DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
+    bool UdpNetworkInterface::DecompressPacket(ICompressor* compressor, const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
     {
-        if (!m_compressor) // should probably have some compression handshake than relying on existence of compressor
+        if (!compressor) // should probably have some compression handshake than relying on existence of compressor
         {
             AZLOG_ERROR("Decompress called without a compressor.");
             return false;
@@ -448,7 +465,7 @@ namespace AzNetworking
         AZStd::size_t bytesConsumed = 0;
 
         packetBufferOut.Resize(packetBufferOut.GetCapacity());
-        const CompressorError compErr = m_compressor->Decompress(packetBuffer, packetSize, packetBufferOut.GetBuffer(), packetBufferOut.GetCapacity(), bytesConsumed, uncompSize);
+        const CompressorError compErr = compressor->Decompress(packetBuffer, packetSize, packetBufferOut.GetBuffer(), packetBufferOut.GetCapacity(), bytesConsumed, uncompSize);
         packetBufferOut.Resize(aznumeric_cast<uint32_t>(uncompSize)); // Decompress will fail if larger than buffer size, so this cast is safe
 
         if (compErr != CompressorError::Ok)
@@ -465,6 +482,175 @@ namespace AzNetworking
         return true;
     }
 
+    UdpNetworkInterface::DecodeResult UdpNetworkInterface::DecodeReceivedPacket
+    (
+        UdpConnection& connection,
+        const UdpReaderThread::ReceivedPacket& packet,
+        ICompressor* compressor,
+        UdpPacketEncodingBuffer& decryptBuffer,
+        UdpPacketEncodingBuffer& decompressBuffer,
+        UdpPacketHeader& outHeader,
+        const uint8_t*& outData,
+        int32_t& outSize,
+        uint32_t& outFlagBytes
+    ) const
+    {
+        outFlagBytes = 0;
+
+        int32_t decodedPacketSize = 0;
+        decryptBuffer.Resize(decryptBuffer.GetCapacity());
+        const uint8_t* decodedPacketData = connection.GetDtlsEndpoint().DecodePacket(connection, packet.m_buffer, packet.m_receivedBytes, decryptBuffer.GetBuffer(), decodedPacketSize);
+        decryptBuffer.Resize(AZStd::max(decodedPacketSize, 0));
+
+        if (decodedPacketSize == 0)
+        {
+            // OpenSSL may have consumed packets during handshake negotiation
+            return DecodeResult::Skipped;
+        }
+        else if (decodedPacketSize < 0)
+        {
+            // Late unencrypted handshake packets or just random garbage can show up, discard and continue
+            return DecodeResult::Skipped;
+        }
+
+        // Decode the packet flag bitset first since it's always uncompressed
+        {
+            NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
+            if (!outHeader.SerializePacketFlags(flagSerializer))
+            {
+                return DecodeResult::Failed;
+            }
+            // Adjust decoded tracking to represent the payload now that we've grabbed the flags
+            decodedPacketData = flagSerializer.GetUnreadData();
+            decodedPacketSize = flagSerializer.GetUnreadSize();
+            outFlagBytes = flagSerializer.GetReadSize();
+        }
+
+        if (compressor && outHeader.IsPacketFlagSet(PacketFlag::Compressed))
+        {
+            // Only the payload is compressed
+            if (!DecompressPacket(compressor, decodedPacketData, decodedPacketSize, decompressBuffer))
+            {
+                AZLOG_WARN("Failed to decompress packet!");
+                return DecodeResult::Failed;
+            }
+            decodedPacketData = decompressBuffer.GetBuffer();
+            decodedPacketSize = static_cast<int32_t>(decompressBuffer.GetSize());
+        }
+
+        outData = decodedPacketData;
+        outSize = decodedPacketSize;
+        return DecodeResult::Success;
+    }
+
+    void UdpNetworkInterface::PredecodePackets(const UdpReaderThread::ReceivedPackets& packets)
+    {
+        m_predecodedPackets.clear();
+        if (m_decodeShards.size() <= 1 || packets.empty() || AZ::JobContext::GetGlobalContext() == nullptr)
+        {
+            return;
+        }
+
+        // Only the packets of established connections are decoded ahead of time, new connections are accepted on the game thread
+        const uint32_t shardCount = aznumeric_cast<uint32_t>(m_decodeShards.size());
+        m_predecodedPackets.resize(packets.size());
+        bool hasPredecodedPackets = false;
+        for (uint32_t i = 0; i < packets.size(); ++i)
+        {
+            const UdpReaderThread::ReceivedPacket& packet = packets[i];
+            if (packet.m_receivedBytes <= 0)
+            {
+                continue;
+            }
+
+            UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
+            if (connection == nullptr)
+            {
+                continue;
+            }
+
+            // Connections in the middle of a DTLS handshake may need to respond, so their packets are decoded on the game thread
+            const ConnectionState connectionState = connection->GetConnectionState();
+            if (connectionState == ConnectionState::Disconnecting || connectionState == ConnectionState::Disconnected
+                || (m_socket->IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting()))
+            {
+                continue;
+            }
+
+            // All the packets of a connection go to the same shard, so their decode order and DTLS state are preserved
+            PredecodedPacket& predecodedPacket = m_predecodedPackets[i];
+            predecodedPacket.m_connection = connection;
+            predecodedPacket.m_shardIndex = static_cast<uint32_t>(connection->GetConnectionId()) % shardCount;
+            hasPredecodedPackets = true;
+        }
+
+        if (!hasPredecodedPackets)
+        {
+            return;
+        }
+
+        AZ::JobCompletion completion;
+        for (uint32_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+        {
+            AZ::Job* decodeJob = AZ::CreateJobFunction([this, shardIndex, &packets]()
+                {
+                    PredecodeShard(shardIndex, packets);
+                }, true, nullptr); //auto-deletes
+            decodeJob->SetDependent(&completion);
+            decodeJob->Start();
+        }
+        completion.StartAndWaitForCompletion();
+
+        // The shard payload buffers don't move anymore, resolve the payload addresses
+        for (PredecodedPacket& predecodedPacket : m_predecodedPackets)
+        {
+            if (predecodedPacket.m_isDecoded && predecodedPacket.m_result == DecodeResult::Success && predecodedPacket.m_data == nullptr)
+            {
+                predecodedPacket.m_data = m_decodeShards[predecodedPacket.m_shardIndex]->m_payloads.data() + predecodedPacket.m_payloadOffset;
+            }
+        }
+    }
+
+    void UdpNetworkInterface::PredecodeShard(uint32_t shardIndex, const UdpReaderThread::ReceivedPackets& packets)
+    {
+        DecodeShard& shard = *m_decodeShards[shardIndex];
+        shard.m_payloads.clear();
+
+        for (uint32_t i = 0; i < packets.size(); ++i)
+        {
+            PredecodedPacket& predecodedPacket = m_predecodedPackets[i];
+            if (predecodedPacket.m_connection == nullptr || predecodedPacket.m_shardIndex != shardIndex)
+            {
+                continue;
+            }
+
+            const UdpReaderThread::ReceivedPacket& packet = packets[i];
+            const uint8_t* decodedPacketData = nullptr;
+            predecodedPacket.m_result = DecodeReceivedPacket(*predecodedPacket.m_connection, packet, shard.m_compressor.get(),
+                shard.m_decryptBuffer, shard.m_decompressBuffer, predecodedPacket.m_header, decodedPacketData, predecodedPacket.m_size,
+                predecodedPacket.m_flagBytes);
+            predecodedPacket.m_isDecoded = true;
+
+            if (predecodedPacket.m_result != DecodeResult::Success)
+            {
+                continue;
+            }
+
+            if (decodedPacketData >= packet.m_buffer && decodedPacketData < packet.m_buffer + packet.m_receivedBytes)
+            {
+                // The payload was passed through, it stays in the receive buffer of the reader thread
+                predecodedPacket.m_data = decodedPacketData;
+            }
+            else
+            {
+                // The payload is in the decode buffers of the shard, which are reused by the next packet
+                predecodedPacket.m_data = nullptr;
+                predecodedPacket.m_payloadOffset = aznumeric_cast<uint32_t>(shard.m_payloads.size());
+                shard.m_payloads.insert(shard.m_payloads.end(), decodedPacketData, decodedPacketData + predecodedPacket.m_size);
+            }
+        }
+    }
+
     PacketId UdpNetworkInterface::SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence)
     {
         AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packet.GetPacketType()), connection.GetRemoteAddress().GetString().c_str());
@@ -550,12 +736,17 @@ namespace AzNetworking
             const uint8_t* chunkStart = packetData;
             const SequenceId fragmentedSequence = connection.m_fragmentQueue.GetNextFragmentedSequenceId();
             uint32_t bytesRemaining = packetSize;
-            ChunkBuffer chunkBuffer;
+
+            // The fragment is reused for all the chunks, each chunk is copied once into its buffer
+            CorePackets::FragmentedPacket fragmentedPacket;
+            fragmentedPacket.SetUnfragmentedSequence(ToSequenceId(localPacketId));
+            fragmentedPacket.SetFragmentSequence(fragmentedSequence);
+            fragmentedPacket.SetChunkCount(aznumeric_cast<uint8_t>(numChunks));
             for (uint32_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
             {
                 const uint32_t nextChunkSize = AZStd::min(bytesRemaining, chunkSize);
-                chunkBuffer.CopyValues(chunkStart, nextChunkSize);
-                CorePackets::FragmentedPacket fragmentedPacket(ToSequenceId(localPacketId), fragmentedSequence, aznumeric_cast<uint8_t>(chunkIndex), aznumeric_cast<uint8_t>(numChunks), chunkBuffer);
+                fragmentedPacket.SetChunkIndex(aznumeric_cast<uint8_t>(chunkIndex));
+                fragmentedPacket.ModifyChunkBuffer().CopyValues(chunkStart, nextChunkSize);
                 const SequenceId chunkReliableId = (net_FragmentsAlwaysReliable || reliabilityType == ReliabilityType::Reliable)
                     ? connection.m_reliableQueue.GetNextSequenceId()
                     : InvalidSequenceId;
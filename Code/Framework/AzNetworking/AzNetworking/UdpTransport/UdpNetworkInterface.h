@@ -129,11 +129,45 @@ namespace AzNetworking
         void RegisterWithTimeoutQueue(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability, const ConnectionMetrics& metrics);
 
         //! Decompresses an incoming packet data buffer.
+        //! @param compressor      the compressor to decompress with
         //! @param packetBuffer    the compressed packet buffer to decode
         //! @param packetSize      the size of the compressed packet buffer
         //! @param packetBufferOut the decoded data
         //! @return boolean true on success, false on failure
-        bool DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
+        bool DecompressPacket(ICompressor* compressor, const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
+
+        enum class DecodeResult
+        {
+            Skipped, // The payload was consumed by the DTLS handshake or is garbage, the packet doesn't count as received
+            Failed,  // The packet was received, but its flags or its compressed payload are invalid
+            Success
+        };
+
+        //! Decrypts the payload of a received packet, reads its packet flags and decompresses it.
+        //! Only the state of the provided connection is modified, so packets of different connections can be decoded concurrently.
+        //! @param connection       the connection the packet was received on
+        //! @param packet           the received packet
+        //! @param compressor       the compressor to decompress with, must not be shared with concurrent decodes
+        //! @param decryptBuffer    buffer for the decrypted payload
+        //! @param decompressBuffer buffer for the decompressed payload
+        //! @param outHeader        on success, the header holding the packet flags
+        //! @param outData          on success, the payload following the packet flags
+        //! @param outSize          on success, the size of the payload
+        //! @param outFlagBytes     the size of the packet flags
+        //! @return the result of the decode
+        DecodeResult DecodeReceivedPacket(UdpConnection& connection, const UdpReaderThread::ReceivedPacket& packet, ICompressor* compressor,
+            UdpPacketEncodingBuffer& decryptBuffer, UdpPacketEncodingBuffer& decompressBuffer, UdpPacketHeader& outHeader,
+            const uint8_t*& outData, int32_t& outSize, uint32_t& outFlagBytes) const;
+
+        //! Decodes the received packets of the established connections on the job threads, with the connections sharded across
+        //! net_UdpDecodeShardCount jobs. Does nothing if sharding is disabled.
+        //! @param packets the packets received since the last update
+        void PredecodePackets(const UdpReaderThread::ReceivedPackets& packets);
+
+        //! Decodes the packets of one shard, called from the job threads.
+        //! @param shardIndex index of the shard to decode
+        //! @param packets    the packets received since the last update
+        void PredecodeShard(uint32_t shardIndex, const UdpReaderThread::ReceivedPackets& packets);
 
         //! Sends a packet to the remote connection.
         //! @param connection         the UdpConnection instance to send the packet on
@@ -194,6 +228,31 @@ namespace AzNetworking
         UdpPacketEncodingBuffer m_decryptBuffer;
         UdpPacketEncodingBuffer m_decompressBuffer;
 
+        // A received packet decoded ahead of its dispatch on the game thread
+        struct PredecodedPacket
+        {
+            UdpConnection* m_connection = nullptr; // The connection the packet is decoded for, nullptr if it is decoded on the game thread
+            bool m_isDecoded = false;
+            DecodeResult m_result = DecodeResult::Skipped;
+            UdpPacketHeader m_header;
+            const uint8_t* m_data = nullptr;
+            int32_t m_size = 0;
+            uint32_t m_flagBytes = 0;
+            uint32_t m_shardIndex = 0;
+            uint32_t m_payloadOffset = 0; // Offset of the payload in the shard when the decode didn't leave it in the received packet
+        };
+
+        // The resources of a decode job, which are only used by one job thread at a time
+        struct DecodeShard
+        {
+            AZStd::unique_ptr<ICompressor> m_compressor;
+            UdpPacketEncodingBuffer m_decryptBuffer;
+            UdpPacketEncodingBuffer m_decompressBuffer;
+            AZStd::vector<uint8_t> m_payloads;
+        };
+        AZStd::vector<AZStd::unique_ptr<DecodeShard>> m_decodeShards;
+        AZStd::vector<PredecodedPacket> m_predecodedPackets;
+
         friend class UdpReliableQueue;
         friend class UdpConnection; // For access to private RequestDisconnect() method
     };
@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AzNetworking
 {
@@ -176,7 +177,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -185,18 +185,36 @@ namespace AzNetworking
                     break;
                 }
 
+                // Receive as many packets as fit in the buffer with a single call, each one into its own MTU sized slot
+                const uint32_t freeSlots = aznumeric_cast<uint32_t>((receiveBuffer.GetCapacity() - bufferHead - 1) / MaxUdpTransmissionUnit);
+                const uint32_t freePackets = aznumeric_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t batchSize = AZStd::min(AZStd::min(freeSlots, freePackets), UdpSocket::MaxBatchSize);
+                if (batchSize == 0)
+                {
+                    break;
+                }
+
+                IpAddress addresses[UdpSocket::MaxBatchSize];
+                int32_t receivedSizes[UdpSocket::MaxBatchSize];
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                receiveBuffer.Resize(bufferHead + batchSize * MaxUdpTransmissionUnit);
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                const int32_t receivedCount = socket->ReceiveBatch(addresses, receivedSizes, dstData, MaxUdpTransmissionUnit, batchSize);
+                uint32_t bufferTail = bufferHead;
+                for (int32_t index = 0; index < receivedCount; ++index)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    if (receivedSizes[index] > 0)
+                    {
+                        const uint32_t slotOffset = index * MaxUdpTransmissionUnit;
+                        receivedPackets.push_back(ReceivedPacket(addresses[index], dstData + slotOffset, receivedSizes[index]));
+                        bufferTail = bufferHead + slotOffset + receivedSizes[index];
+                    }
                 }
-                else
+                receiveBuffer.Resize(bufferTail);
+
+                if (receivedCount < static_cast<int32_t>(batchSize))
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // The socket has no more data
                     break;
                 }
             }
@@ -96,6 +96,7 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        FlushSends();
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -191,41 +192,190 @@ namespace AzNetworking
 
         if (receivedBytes < 0)
         {
-            const int32_t error = GetLastNetworkError();
+            return HandleReceiveError();
+        }
+
+        if (receivedBytes == 0)
+        {
+            return 0;
+        }
+
+        m_recvPackets++;
+        m_recvBytes += receivedBytes;
+        return receivedBytes;
+    }
+
+    int32_t UdpSocket::ReceiveBatch(IpAddress* outAddresses, int32_t* outSizes, uint8_t* outData, uint32_t stride, uint32_t count) const
+    {
+        AZ_Assert(stride > 0, "Invalid data size for receive");
+        AZ_Assert(outData != nullptr, "NULL data pointer passed to receive");
+        AZ_Assert(count <= MaxBatchSize, "Receive batch exceeds MaxBatchSize");
 
-            if (ErrorIsWouldBlock(error)) // Filter would block messages
+        if (!IsOpen() || count == 0)
+        {
+            return 0;
+        }
+
+        count = AZStd::min(count, MaxBatchSize);
+
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        mmsghdr messages[MaxBatchSize];
+        iovec buffers[MaxBatchSize];
+        sockaddr_in fromAddresses[MaxBatchSize];
+        memset(messages, 0, sizeof(mmsghdr) * count);
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            buffers[index].iov_base = outData + index * stride;
+            buffers[index].iov_len = stride;
+            messages[index].msg_hdr.msg_name = &fromAddresses[index];
+            messages[index].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[index].msg_hdr.msg_iov = &buffers[index];
+            messages[index].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int32_t receivedCount = ::recvmmsg(static_cast<int32_t>(m_socketFd), messages, count, MSG_DONTWAIT, nullptr);
+        if (receivedCount < 0)
+        {
+            return HandleReceiveError();
+        }
+
+        for (int32_t index = 0; index < receivedCount; ++index)
+        {
+            outAddresses[index] = IpAddress(ByteOrder::Network, fromAddresses[index].sin_addr.s_addr, fromAddresses[index].sin_port);
+            outSizes[index] = static_cast<int32_t>(messages[index].msg_len);
+            if (outSizes[index] > 0)
             {
-                return 0;
+                m_recvPackets++;
+                m_recvBytes += outSizes[index];
             }
+        }
+        return receivedCount;
+#else
+        int32_t receivedCount = 0;
+        while (receivedCount < static_cast<int32_t>(count))
+        {
+            const int32_t receivedBytes = Receive(outAddresses[receivedCount], outData + receivedCount * stride, stride);
+            if (receivedBytes <= 0)
+            {
+                return (receivedCount > 0) ? receivedCount : receivedBytes;
+            }
+            outSizes[receivedCount++] = receivedBytes;
+        }
+        return receivedCount;
+#endif
+    }
 
-            bool ignoreForciblyClosedError = false;
-            if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+    void UdpSocket::FlushSends() const
+    {
+        if (m_queuedSends.empty())
+        {
+            return;
+        }
+
+        if (IsOpen())
+        {
+#if AZ_TRAIT_USE_SOCKET_MMSG
+            const uint32_t count = aznumeric_cast<uint32_t>(m_queuedSends.size());
+            mmsghdr messages[MaxBatchSize];
+            iovec buffers[MaxBatchSize];
+            sockaddr_in destAddresses[MaxBatchSize];
+            memset(messages, 0, sizeof(mmsghdr) * count);
+            memset(destAddresses, 0, sizeof(sockaddr_in) * count);
+            for (uint32_t index = 0; index < count; ++index)
             {
-                if (ignoreForciblyClosedError)
+                const QueuedSend& queuedSend = m_queuedSends[index];
+                destAddresses[index].sin_family = AF_INET;
+                destAddresses[index].sin_addr.s_addr = queuedSend.m_address.GetAddress(ByteOrder::Network);
+                destAddresses[index].sin_port = queuedSend.m_address.GetPort(ByteOrder::Network);
+                buffers[index].iov_base = m_queuedSendBuffer.GetBuffer() + queuedSend.m_offset;
+                buffers[index].iov_len = queuedSend.m_size;
+                messages[index].msg_hdr.msg_name = &destAddresses[index];
+                messages[index].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                messages[index].msg_hdr.msg_iov = &buffers[index];
+                messages[index].msg_hdr.msg_iovlen = 1;
+            }
+
+            uint32_t sentCount = 0;
+            while (sentCount < count)
+            {
+                const int32_t result = ::sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentCount, count - sentCount, 0);
+                if (result <= 0)
                 {
-                    return 0;
+                    const int32_t error = GetLastNetworkError();
+                    if (!ErrorIsWouldBlock(error)) // Filter would block messages
+                    {
+                        AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                    }
+                    break;
                 }
-                else
+                sentCount += static_cast<uint32_t>(result);
+            }
+#else
+            for (const QueuedSend& queuedSend : m_queuedSends)
+            {
+                if (SendTo(queuedSend.m_address, m_queuedSendBuffer.GetBuffer() + queuedSend.m_offset, queuedSend.m_size) < 0)
                 {
-                    return SocketOpResultError;
+                    const int32_t error = GetLastNetworkError();
+                    if (!ErrorIsWouldBlock(error)) // Filter would block messages
+                    {
+                        AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                    }
                 }
             }
-
-            AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+#endif
         }
 
-        if (receivedBytes <= 0)
+        m_queuedSends.clear();
+        m_queuedSendBuffer.Resize(0);
+    }
+
+    int32_t UdpSocket::HandleReceiveError() const
+    {
+        const int32_t error = GetLastNetworkError();
+
+        if (ErrorIsWouldBlock(error)) // Filter would block messages
         {
             return 0;
         }
 
-        m_recvPackets++;
-        m_recvBytes += receivedBytes;
-        return receivedBytes;
+        bool ignoreForciblyClosedError = false;
+        if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+        {
+            if (ignoreForciblyClosedError)
+            {
+                return 0;
+            }
+            else
+            {
+                return SocketOpResultError;
+            }
+        }
+
+        AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        return 0;
     }
 
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
+    {
+        if (!m_batchSends || size > MaxUdpTransmissionUnit)
+        {
+            return SendTo(address, data, size);
+        }
+
+        if (m_queuedSends.full() || (m_queuedSendBuffer.GetSize() + size > m_queuedSendBuffer.GetCapacity()))
+        {
+            FlushSends();
+        }
+
+        const uint32_t offset = aznumeric_cast<uint32_t>(m_queuedSendBuffer.GetSize());
+        memcpy(m_queuedSendBuffer.GetBufferEnd(), data, size);
+        m_queuedSendBuffer.Resize(offset + size);
+        m_queuedSends.push_back(QueuedSend{ address, offset, size });
+        return static_cast<int32_t>(size);
+    }
+
+    int32_t UdpSocket::SendTo(const IpAddress& address, const uint8_t* data, uint32_t size) const
     {
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
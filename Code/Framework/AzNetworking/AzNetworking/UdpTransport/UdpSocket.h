@@ -42,6 +42,9 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! Maximum number of payloads received or sent with a single system call.
+        static constexpr uint32_t MaxBatchSize = 64;
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -93,6 +96,23 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives several payloads from the UDP socket, with a single system call on platforms that support it.
+        //! The payloads are written to consecutive slots of the output buffer.
+        //! @param outAddresses on success, the address of the endpoint that sent each payload
+        //! @param outSizes     on success, the number of bytes received for each payload
+        //! @param outData      address of the first slot to write the received data to
+        //! @param stride       size of each slot of the output buffer, the maximum size of a payload
+        //! @param count        maximum number of payloads to receive, must not exceed MaxBatchSize
+        //! @return number of payloads received, < 0 on error
+        int32_t ReceiveBatch(IpAddress* outAddresses, int32_t* outSizes, uint8_t* outData, uint32_t stride, uint32_t count) const;
+
+        //! Enables or disables the batching of sends, batched payloads are queued until FlushSends() is called.
+        //! @param batchSends if true, payloads are queued and sent together with as few system calls as the platform allows
+        void SetBatchSends(bool batchSends);
+
+        //! Sends all the payloads queued while batching sends.
+        void FlushSends() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -130,7 +150,23 @@ namespace AzNetworking
 
     private:
 
+        //! Sends a single payload immediately.
+        int32_t SendTo(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+
+        //! Filters the error of a failed receive, returns 0 if the error can be ignored.
+        int32_t HandleReceiveError() const;
+
+        struct QueuedSend
+        {
+            IpAddress m_address;
+            uint32_t m_offset = 0;
+            uint32_t m_size = 0;
+        };
+
         SocketFd m_socketFd = InvalidSocketFd;
+        bool m_batchSends = false;
+        mutable AZStd::fixed_vector<QueuedSend, MaxBatchSize> m_queuedSends;
+        mutable ByteBuffer<MaxBatchSize * MaxUdpTransmissionUnit> m_queuedSendBuffer;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
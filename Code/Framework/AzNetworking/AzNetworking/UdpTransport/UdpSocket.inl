@@ -15,6 +15,15 @@ namespace AzNetworking
         return (m_socketFd > SocketFd{ 0 });
     }
 
+    inline void UdpSocket::SetBatchSends(bool batchSends)
+    {
+        if (!batchSends)
+        {
+            FlushSends();
+        }
+        m_batchSends = batchSends;
+    }
+
     inline SocketFd UdpSocket::GetSocketFd() const
     {
         return m_socketFd;
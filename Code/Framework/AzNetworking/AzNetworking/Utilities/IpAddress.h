@@ -89,6 +89,10 @@ namespace AzNetworking
         //! @return forth dotted quad of the internal Ipv4Address
         uint8_t GetQuadD() const;
 
+        //! Returns true if the address is in the loopback range, meaning the remote endpoint runs on this machine.
+        //! @return boolean true if the address is a 127.x.x.x address
+        bool IsLoopback() const;
+
         //! Returns the address in a human readable string form.
         //! @return the address in a human readable string form
         IpString GetString() const;
@@ -30,6 +30,11 @@ namespace AzNetworking
         return uint8_t((m_ipv4Address) & 0xFF);
     }
 
+    inline bool IpAddress::IsLoopback() const
+    {
+        return GetQuadA() == 127;
+    }
+
     inline bool IpAddress::operator ==(const IpAddress& rhs) const
     {
         return (m_ipv4Address == rhs.m_ipv4Address) && (m_port == rhs.m_port);
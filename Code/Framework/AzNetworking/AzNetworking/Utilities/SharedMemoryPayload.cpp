@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/SharedMemoryPayload.h>
+#include <AzNetworking/Utilities/IpAddress.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IPC/SharedMemory.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/std/limits.h>
+
+namespace AzNetworking
+{
+    AZ_CVAR(bool, net_SharedMemoryPayloads, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Send large payloads to endpoints on the same machine through shared memory instead of the socket");
+    AZ_CVAR(uint32_t, net_SharedMemoryPayloadMinBytes, 64 * 1024, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The minimum payload size in bytes to send through shared memory, smaller payloads are cheaper to send through the socket");
+
+    SharedMemoryPayload::SharedMemoryPayload() = default;
+
+    SharedMemoryPayload::~SharedMemoryPayload()
+    {
+        Close();
+    }
+
+    bool SharedMemoryPayload::Create([[maybe_unused]] const void* data, [[maybe_unused]] size_t size)
+    {
+        Close();
+
+#if AZ_TRAIT_SUPPORT_IPC
+        if (size == 0 || size > AZStd::numeric_limits<unsigned int>::max())
+        {
+            return false;
+        }
+
+        const AZ::Uuid::FixedString uuid = AZ::Uuid::CreateRandom().ToFixedString(false, false);
+        NameString name = NameString::format("AzNetworkingPayload_%s", uuid.c_str());
+
+        auto sharedMemory = AZStd::make_unique<AZ::SharedMemory>();
+        if (sharedMemory->Create(name.c_str(), aznumeric_cast<unsigned int>(size)) != AZ::SharedMemory::CreatedNew)
+        {
+            return false;
+        }
+
+        // Only the handle keeps the block alive, the sender doesn't need it mapped once the payload is copied.
+        if (!sharedMemory->Map(AZ::SharedMemory::ReadWrite, aznumeric_cast<unsigned int>(size)))
+        {
+            return false;
+        }
+        memcpy(sharedMemory->Data(), data, size);
+        sharedMemory->UnMap();
+
+        m_sharedMemory = AZStd::move(sharedMemory);
+        m_name = name;
+        m_size = size;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool SharedMemoryPayload::Open([[maybe_unused]] const char* name, [[maybe_unused]] size_t size)
+    {
+        Close();
+
+#if AZ_TRAIT_SUPPORT_IPC
+        if (size == 0 || size > AZStd::numeric_limits<unsigned int>::max())
+        {
+            return false;
+        }
+
+        auto sharedMemory = AZStd::make_unique<AZ::SharedMemory>();
+        if (!sharedMemory->Open(name) || !sharedMemory->Map(AZ::SharedMemory::ReadOnly, aznumeric_cast<unsigned int>(size)))
+        {
+            return false;
+        }
+
+        if (sharedMemory->DataSize() < size)
+        {
+            return false;
+        }
+
+        m_sharedMemory = AZStd::move(sharedMemory);
+        m_name = name;
+        m_size = size;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void SharedMemoryPayload::Close()
+    {
+        if (m_sharedMemory)
+        {
+            m_sharedMemory->Close();
+            m_sharedMemory.reset();
+        }
+        m_name.clear();
+        m_size = 0;
+    }
+
+    bool SharedMemoryPayload::IsOpen() const
+    {
+        return m_sharedMemory != nullptr;
+    }
+
+    const SharedMemoryPayload::NameString& SharedMemoryPayload::GetName() const
+    {
+        return m_name;
+    }
+
+    const uint8_t* SharedMemoryPayload::GetData() const
+    {
+        if (m_sharedMemory && m_sharedMemory->IsMapped())
+        {
+            return reinterpret_cast<const uint8_t*>(m_sharedMemory->Data());
+        }
+        return nullptr;
+    }
+
+    size_t SharedMemoryPayload::GetSize() const
+    {
+        return m_size;
+    }
+
+    bool ShouldUseSharedMemoryPayload([[maybe_unused]] const IpAddress& remoteAddress, [[maybe_unused]] size_t size)
+    {
+#if AZ_TRAIT_SUPPORT_IPC
+        return net_SharedMemoryPayloads && remoteAddress.IsLoopback() && size >= net_SharedMemoryPayloadMinBytes;
+#else
+        return false;
+#endif
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/fixed_string.h>
+
+namespace AZ
+{
+    class SharedMemory;
+}
+
+namespace AzNetworking
+{
+    class IpAddress;
+
+    //! @class SharedMemoryPayload
+    //! @brief Hands a large payload to a process on the same machine through a named shared memory block.
+    //! The sender copies the payload into the block once and only sends the block name and size over its connection, the
+    //! receiver reads the payload in place instead of reassembling it from packets. The sender has to keep the payload alive
+    //! until the receiver has opened it.
+    class SharedMemoryPayload
+    {
+    public:
+        static constexpr uint32_t MaxNameLength = 64;
+        using NameString = AZStd::fixed_string<MaxNameLength>;
+
+        SharedMemoryPayload();
+        ~SharedMemoryPayload();
+
+        //! Creates a uniquely named shared memory block holding a copy of the payload.
+        //! @param data pointer to the payload
+        //! @param size size of the payload in bytes
+        //! @return boolean true on success, false if shared memory is unavailable and the payload has to go through the connection
+        bool Create(const void* data, size_t size);
+
+        //! Opens a payload created by another process.
+        //! @param name name of the payload as returned by GetName on the sending side
+        //! @param size size of the payload in bytes
+        //! @return boolean true on success, false if the payload doesn't exist or is smaller than expected
+        bool Open(const char* name, size_t size);
+
+        //! Releases the shared memory block, it is destroyed once no process has it open anymore.
+        void Close();
+
+        //! Returns true if a payload was created or opened.
+        //! @return boolean true if a payload was created or opened
+        bool IsOpen() const;
+
+        //! Returns the name the receiving process opens the payload with.
+        //! @return the name of the payload
+        const NameString& GetName() const;
+
+        //! Returns the payload data, only valid on the receiving side.
+        //! @return pointer to the payload data, nullptr if the payload wasn't opened
+        const uint8_t* GetData() const;
+
+        //! Returns the size of the payload in bytes.
+        //! @return the size of the payload in bytes
+        size_t GetSize() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(SharedMemoryPayload);
+
+        AZStd::unique_ptr<AZ::SharedMemory> m_sharedMemory;
+        NameString m_name;
+        size_t m_size = 0;
+    };
+
+    //! Returns true if a payload of the given size to the given remote address should be sent as a SharedMemoryPayload.
+    //! This is the case for payloads larger than net_SharedMemoryPayloadMinBytes to loopback addresses on platforms supporting
+    //! shared memory, unless net_SharedMemoryPayloads is disabled.
+    //! @param remoteAddress address of the receiving endpoint
+    //! @param size          size of the payload in bytes
+    //! @return boolean true if the payload should be sent through shared memory
+    bool ShouldUseSharedMemoryPayload(const IpAddress& remoteAddress, size_t size);
+}
@@ -49,6 +49,8 @@ set(FILES
     PacketLayer/IPacketHeader.h
     Serialization/AbstractValue.h
     Serialization/AzContainerSerializers.h
+    Serialization/BaselineDelta.cpp
+    Serialization/BaselineDelta.h
     Serialization/DeltaSerializer.cpp
     Serialization/DeltaSerializer.h
     Serialization/DeltaSerializer.inl
@@ -136,6 +138,8 @@ set(FILES
     Utilities/NetworkIncludes.h
     Utilities/QuantizedValues.h
     Utilities/QuantizedValues.inl
+    Utilities/SharedMemoryPayload.cpp
+    Utilities/SharedMemoryPayload.h
     Utilities/TimedThread.cpp
     Utilities/TimedThread.h
 )
\ No newline at end of file
@@ -11,4 +11,23 @@
 
 namespace UnitTest
 {
+    TEST(FixedSizeVectorBitsetTests, EqualityComparesValidBits)
+    {
+        AzNetworking::FixedSizeVectorBitset<64> lhs;
+        AzNetworking::FixedSizeVectorBitset<64> rhs;
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.Resize(11);
+        EXPECT_TRUE(lhs != rhs);
+        rhs.Resize(11);
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.SetBit(9, true);
+        EXPECT_TRUE(lhs != rhs);
+        rhs.SetBit(9, true);
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.SetBit(2, true);
+        EXPECT_FALSE(lhs == rhs);
+    }
 }
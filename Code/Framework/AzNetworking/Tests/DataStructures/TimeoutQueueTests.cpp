@@ -7,8 +7,89 @@
  */
 
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
+#include <AzCore/Time/TimeSystem.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 namespace UnitTest
 {
+    class TimeoutQueueTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            m_timeSystem->SetElapsedTimeMsDebug(AZ::TimeMs{ 1000 });
+        }
+
+        void TearDown() override
+        {
+            m_timeSystem.reset();
+        }
+
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+    };
+
+#if !defined(AZ_RELEASE_BUILD)
+    TEST_F(TimeoutQueueTests, TestTimeoutAndDelete)
+    {
+        AzNetworking::TimeoutQueue timeoutQueue;
+        timeoutQueue.RegisterItem(1, AZ::TimeMs{ 100 });
+        timeoutQueue.RegisterItem(2, AZ::TimeMs{ 200 });
+
+        AZStd::vector<uint64_t> timedOut;
+        auto handler = [&timedOut](AzNetworking::TimeoutQueue::TimeoutItem& item)
+        {
+            timedOut.push_back(item.m_userData);
+            return AzNetworking::TimeoutResult::Delete;
+        };
+
+        m_timeSystem->SetElapsedTimeMsDebug(AZ::TimeMs{ 1050 });
+        timeoutQueue.UpdateTimeouts(handler);
+        EXPECT_TRUE(timedOut.empty());
+
+        m_timeSystem->SetElapsedTimeMsDebug(AZ::TimeMs{ 1300 });
+        timeoutQueue.UpdateTimeouts(handler);
+        const AZStd::vector<uint64_t> expected = { 1, 2 };
+        EXPECT_EQ(timedOut, expected);
+
+        m_timeSystem->SetElapsedTimeMsDebug(AZ::TimeMs{ 2000 });
+        timeoutQueue.UpdateTimeouts(handler);
+        EXPECT_EQ(timedOut.size(), 2);
+    }
+
+    TEST_F(TimeoutQueueTests, TestRefreshAndRemove)
+    {
+        AzNetworking::TimeoutQueue timeoutQueue;
+        const AzNetworking::TimeoutId refreshedId = timeoutQueue.RegisterItem(1, AZ::TimeMs{ 100 });
+        const AzNetworking::TimeoutId removedId = timeoutQueue.RegisterItem(2, AZ::TimeMs{ 100 });
+
+        uint32_t timeoutCount = 0;
+        auto handler = [&timeoutCount](AzNetworking::TimeoutQueue::TimeoutItem&)
+        {
+            ++timeoutCount;
+            return AzNetworking::TimeoutResult::Refresh;
+        };
+
+        // Refreshing the item pushes its timeout back, removing an item cancels it
+        m_timeSystem->SetElapsedTimeMsDebug(AZ::TimeMs{ 1080 });
+        timeoutQueue.RetrieveItem(refreshedId)->UpdateTimeoutTime(AZ::GetElapsedTimeMs());
+        timeoutQueue.RemoveItem(removedId);
+        EXPECT_EQ(timeoutQueue.RetrieveItem(removedId), nullptr);
+
+        m_timeSystem->SetElapsedTimeMsDebug(AZ::TimeMs{ 1150 });
+        timeoutQueue.UpdateTimeouts(handler);
+        EXPECT_EQ(timeoutCount, 0);
+
+        m_timeSystem->SetElapsedTimeMsDebug(AZ::TimeMs{ 1200 });
+        timeoutQueue.UpdateTimeouts(handler);
+        EXPECT_EQ(timeoutCount, 1);
+
+        // The handler asked for a refresh, so the item times out again one timeout later
+        m_timeSystem->SetElapsedTimeMsDebug(AZ::TimeMs{ 1350 });
+        timeoutQueue.UpdateTimeouts(handler);
+        EXPECT_EQ(timeoutCount, 2);
+        EXPECT_NE(timeoutQueue.RetrieveItem(refreshedId), nullptr);
+    }
+#endif
 }
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/BaselineDelta.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Utilities/QuantizedValues.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class BaselineDeltaTests
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        static void ExpectRoundTrip(const AZStd::vector<uint8_t>& baseline, const AZStd::vector<uint8_t>& data, uint32_t& outEncodedSize)
+        {
+            AZStd::vector<uint8_t> encoded(data.size() * 2 + 8);
+            AZStd::vector<uint8_t> decoded(data.size());
+            uint32_t decodedSize = 0;
+
+            const uint8_t* baselineData = baseline.empty() ? nullptr : baseline.data();
+            ASSERT_TRUE(AzNetworking::EncodeBaselineDelta(baselineData, static_cast<uint32_t>(baseline.size()),
+                data.data(), static_cast<uint32_t>(data.size()), encoded.data(), static_cast<uint32_t>(encoded.size()), outEncodedSize));
+            ASSERT_TRUE(AzNetworking::DecodeBaselineDelta(baselineData, static_cast<uint32_t>(baseline.size()),
+                encoded.data(), outEncodedSize, decoded.data(), static_cast<uint32_t>(decoded.size()), decodedSize));
+            EXPECT_EQ(decodedSize, data.size());
+            EXPECT_EQ(decoded, data);
+        }
+
+        // Serializes a transform-like state, a quantized position and an id
+        static AZStd::vector<uint8_t> SerializeState(float x, float y, float z, uint32_t id)
+        {
+            AZStd::array<uint8_t, 64> buffer;
+            AzNetworking::NetworkInputSerializer serializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+            AzNetworking::QuantizedValues<3, 2, -1024, 1024> position(AZ::Vector3(x, y, z));
+            serializer.Serialize(position, "Position");
+            serializer.Serialize(id, "Id");
+            return AZStd::vector<uint8_t>(buffer.begin(), buffer.begin() + serializer.GetSize());
+        }
+    };
+
+    TEST_F(BaselineDeltaTests, UnchangedDataEncodesToARun)
+    {
+        AZStd::vector<uint8_t> data(200);
+        for (size_t index = 0; index < data.size(); ++index)
+        {
+            data[index] = static_cast<uint8_t>(index * 13);
+        }
+
+        uint32_t encodedSize = 0;
+        ExpectRoundTrip(data, data, encodedSize);
+        // The size and two runs of unchanged bytes
+        EXPECT_EQ(encodedSize, 4);
+    }
+
+    TEST_F(BaselineDeltaTests, NoBaseline)
+    {
+        AZStd::vector<uint8_t> data = { 0, 0, 0, 1, 2, 3, 0, 4, 0, 0, 0, 0, 5 };
+        uint32_t encodedSize = 0;
+        ExpectRoundTrip({}, data, encodedSize);
+    }
+
+    TEST_F(BaselineDeltaTests, DifferentSizes)
+    {
+        AZStd::vector<uint8_t> baseline = { 1, 2, 3, 4, 5, 6, 7, 8 };
+        AZStd::vector<uint8_t> longer = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0, 0 };
+        AZStd::vector<uint8_t> shorter = { 1, 2, 9 };
+        uint32_t encodedSize = 0;
+        ExpectRoundTrip(baseline, longer, encodedSize);
+        ExpectRoundTrip(baseline, shorter, encodedSize);
+    }
+
+    TEST_F(BaselineDeltaTests, SmallQuantizedChangesAreSmall)
+    {
+        const AZStd::vector<uint8_t> baseline = SerializeState(100.0f, 20.0f, -300.0f, 1234);
+        const AZStd::vector<uint8_t> current = SerializeState(100.1f, 20.0f, -300.0f, 1234);
+
+        uint32_t encodedSize = 0;
+        ExpectRoundTrip(baseline, current, encodedSize);
+        EXPECT_LT(encodedSize, current.size());
+    }
+
+    TEST_F(BaselineDeltaTests, MalformedDeltaFails)
+    {
+        AZStd::vector<uint8_t> baseline = { 1, 2, 3, 4 };
+        AZStd::array<uint8_t, 16> decoded;
+        uint32_t decodedSize = 0;
+
+        // Claims 4 bytes, but the run of unchanged bytes covers 8
+        const AZStd::array<uint8_t, 2> overrun = { 4, 7 };
+        EXPECT_FALSE(AzNetworking::DecodeBaselineDelta(baseline.data(), 4, overrun.data(), 2, decoded.data(), 16, decodedSize));
+
+        // Claims 4 changed bytes, but only has 2
+        const AZStd::array<uint8_t, 4> truncated = { 4, 0x83, 1, 2 };
+        EXPECT_FALSE(AzNetworking::DecodeBaselineDelta(baseline.data(), 4, truncated.data(), 4, decoded.data(), 16, decodedSize));
+
+        // Doesn't fit in the output
+        const AZStd::array<uint8_t, 2> tooLarge = { 32, 31 };
+        EXPECT_FALSE(AzNetworking::DecodeBaselineDelta(baseline.data(), 4, tooLarge.data(), 2, decoded.data(), 16, decodedSize));
+    }
+}
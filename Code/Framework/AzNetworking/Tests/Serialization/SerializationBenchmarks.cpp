@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzNetworking/Serialization/BaselineDelta.h>
+#include <AzNetworking/Serialization/HashSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Utilities/QuantizedValues.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Resembles the replicated state of a networked entity, a quantized transform and a few gameplay values.
+    struct EntityState
+    {
+        AzNetworking::QuantizedValues<3, 2, -1024, 1024> m_position;
+        AzNetworking::QuantizedValues<3, 2, -4, 4> m_velocity;
+        uint64_t m_entityId = 0;
+        uint32_t m_flags = 0;
+        float m_health = 100.0f;
+        bool m_active = true;
+
+        bool Serialize(AzNetworking::ISerializer& serializer)
+        {
+            return serializer.Serialize(m_position, "Position")
+                && serializer.Serialize(m_velocity, "Velocity")
+                && serializer.Serialize(m_entityId, "EntityId")
+                && serializer.Serialize(m_flags, "Flags")
+                && serializer.Serialize(m_health, "Health")
+                && serializer.Serialize(m_active, "Active");
+        }
+    };
+
+    class NetworkSerializationBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t NumEntities = 256;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpInternal();
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpInternal();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            TearDownInternal();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDownInternal();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void SetUpInternal()
+        {
+            m_entities.resize(NumEntities);
+            for (uint32_t index = 0; index < NumEntities; ++index)
+            {
+                const float offset = static_cast<float>(index);
+                m_entities[index].m_position = AZ::Vector3(offset, offset * 0.5f, -offset);
+                m_entities[index].m_velocity = AZ::Vector3(0.1f, 0.0f, -0.1f);
+                m_entities[index].m_entityId = 0x1000 + index;
+                m_entities[index].m_flags = index & 0xF;
+            }
+            m_buffer.resize(NumEntities * sizeof(EntityState) * 2);
+        }
+
+        void TearDownInternal()
+        {
+            m_entities = {};
+            m_buffer = {};
+        }
+
+        uint32_t WriteEntities(AZStd::vector<EntityState>& entities, uint8_t* buffer)
+        {
+            AzNetworking::NetworkInputSerializer serializer(buffer, static_cast<uint32_t>(m_buffer.size()));
+            for (EntityState& entity : entities)
+            {
+                entity.Serialize(serializer);
+            }
+            return serializer.GetSize();
+        }
+
+        AZStd::vector<EntityState> m_entities;
+        AZStd::vector<uint8_t> m_buffer;
+    };
+
+    BENCHMARK_F(NetworkSerializationBenchmark, WriteEntityStates)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(WriteEntities(m_entities, m_buffer.data()));
+        }
+        state.SetItemsProcessed(state.iterations() * NumEntities);
+    }
+
+    BENCHMARK_F(NetworkSerializationBenchmark, ReadEntityStates)(benchmark::State& state)
+    {
+        const uint32_t size = WriteEntities(m_entities, m_buffer.data());
+        AZStd::vector<EntityState> entities(NumEntities);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AzNetworking::NetworkOutputSerializer serializer(m_buffer.data(), size);
+            for (EntityState& entity : entities)
+            {
+                entity.Serialize(serializer);
+            }
+            benchmark::DoNotOptimize(entities.data());
+        }
+        state.SetItemsProcessed(state.iterations() * NumEntities);
+    }
+
+    BENCHMARK_F(NetworkSerializationBenchmark, HashEntityStates)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AzNetworking::HashSerializer serializer;
+            for (EntityState& entity : m_entities)
+            {
+                entity.Serialize(serializer);
+            }
+            benchmark::DoNotOptimize(serializer.GetHash());
+        }
+        state.SetItemsProcessed(state.iterations() * NumEntities);
+    }
+
+    BENCHMARK_F(NetworkSerializationBenchmark, EncodeDecodeBaselineDelta)(benchmark::State& state)
+    {
+        const uint32_t baselineSize = WriteEntities(m_entities, m_buffer.data());
+        AZStd::vector<uint8_t> baseline(m_buffer.begin(), m_buffer.begin() + baselineSize);
+
+        // Every fourth entity moved since the baseline.
+        for (uint32_t index = 0; index < NumEntities; index += 4)
+        {
+            m_entities[index].m_position = AZ::Vector3(static_cast<float>(index) + 1.0f, 0.0f, 0.0f);
+        }
+        const uint32_t currentSize = WriteEntities(m_entities, m_buffer.data());
+
+        AZStd::vector<uint8_t> encoded(currentSize * 2 + 8);
+        AZStd::vector<uint8_t> decoded(currentSize);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            uint32_t encodedSize = 0;
+            uint32_t decodedSize = 0;
+            AzNetworking::EncodeBaselineDelta(baseline.data(), baselineSize, m_buffer.data(), currentSize,
+                encoded.data(), static_cast<uint32_t>(encoded.size()), encodedSize);
+            AzNetworking::DecodeBaselineDelta(baseline.data(), baselineSize, encoded.data(), encodedSize,
+                decoded.data(), static_cast<uint32_t>(decoded.size()), decodedSize);
+            benchmark::DoNotOptimize(decodedSize);
+        }
+        state.SetBytesProcessed(state.iterations() * currentSize);
+    }
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
@@ -9,6 +9,7 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -255,6 +256,52 @@ namespace UnitTest
         EXPECT_EQ(ackState, PacketAckState::Nacked); // Testing that PacketId is not flagged as acked
     }
 
+    TEST_F(UdpTransportTests, BatchedSendAndReceive)
+    {
+        constexpr uint16_t ReceivePort = 12346;
+        constexpr uint32_t PacketCount = 8;
+
+        UdpSocket receiveSocket;
+        UdpSocket sendSocket;
+        ASSERT_TRUE(receiveSocket.Open(ReceivePort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(sendSocket.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        sendSocket.SetBatchSends(true);
+
+        DtlsEndpoint dtlsEndpoint;
+        ConnectionQuality connectionQuality;
+        const IpAddress receiveAddress(127, 0, 0, 1, ReceivePort);
+        for (uint32_t index = 0; index < PacketCount; ++index)
+        {
+            const uint8_t payload[2] = { aznumeric_cast<uint8_t>(index), aznumeric_cast<uint8_t>(index + 1) };
+            EXPECT_EQ(sendSocket.Send(receiveAddress, payload, sizeof(payload), false, dtlsEndpoint, connectionQuality), 2);
+        }
+        EXPECT_EQ(sendSocket.GetSentPackets(), PacketCount);
+
+        // Send the queued packets
+        sendSocket.FlushSends();
+
+        IpAddress addresses[UdpSocket::MaxBatchSize];
+        int32_t sizes[UdpSocket::MaxBatchSize];
+        uint8_t data[UdpSocket::MaxBatchSize * MaxUdpTransmissionUnit];
+        uint32_t receivedCount = 0;
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while (receivedCount < PacketCount && (AZ::GetElapsedTimeMs() - startTimeMs) < AZ::TimeMs{ 1000 })
+        {
+            const int32_t count = receiveSocket.ReceiveBatch(addresses, sizes, data, MaxUdpTransmissionUnit, UdpSocket::MaxBatchSize);
+            for (int32_t index = 0; index < count; ++index)
+            {
+                EXPECT_EQ(sizes[index], 2);
+                EXPECT_EQ(data[index * MaxUdpTransmissionUnit], aznumeric_cast<uint8_t>(receivedCount));
+                EXPECT_EQ(data[index * MaxUdpTransmissionUnit + 1], aznumeric_cast<uint8_t>(receivedCount + 1));
+                ++receivedCount;
+            }
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+
+        EXPECT_EQ(receivedCount, PacketCount);
+        EXPECT_EQ(receiveSocket.GetRecvPackets(), PacketCount);
+    }
+
     TEST_F(UdpTransportTests, TestSingleClient)
     {
         TestUdpServer testServer;
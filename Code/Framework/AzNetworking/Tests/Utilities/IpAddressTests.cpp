@@ -23,4 +23,11 @@ namespace UnitTest
         EXPECT_EQ(ip.GetString(), "127.0.0.1:12345");
         EXPECT_EQ(ip.GetIpString(), "127.0.0.1");
     }
+
+    TEST(IpAddressTests, TestIsLoopback)
+    {
+        EXPECT_TRUE(AzNetworking::IpAddress(127, 0, 0, 1, 12345).IsLoopback());
+        EXPECT_TRUE(AzNetworking::IpAddress(127, 10, 20, 30, 12345).IsLoopback());
+        EXPECT_FALSE(AzNetworking::IpAddress(192, 168, 0, 1, 12345).IsLoopback());
+    }
 }
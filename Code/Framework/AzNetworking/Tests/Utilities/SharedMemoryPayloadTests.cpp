@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/IpAddress.h>
+#include <AzNetworking/Utilities/SharedMemoryPayload.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace UnitTest
+{
+    class SharedMemoryPayloadTests
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(SharedMemoryPayloadTests, ShouldUseSharedMemoryPayload_RemoteAddress_ReturnsFalse)
+    {
+        EXPECT_FALSE(AzNetworking::ShouldUseSharedMemoryPayload(AzNetworking::IpAddress(192, 168, 0, 1, 12345), 1024 * 1024));
+    }
+
+    TEST_F(SharedMemoryPayloadTests, ShouldUseSharedMemoryPayload_SmallPayload_ReturnsFalse)
+    {
+        EXPECT_FALSE(AzNetworking::ShouldUseSharedMemoryPayload(AzNetworking::IpAddress(127, 0, 0, 1, 12345), 16));
+    }
+
+#if AZ_TRAIT_SUPPORT_IPC
+    TEST_F(SharedMemoryPayloadTests, CreateThenOpen_DataMatches)
+    {
+        AZStd::vector<uint8_t> data(256 * 1024);
+        for (size_t index = 0; index < data.size(); ++index)
+        {
+            data[index] = static_cast<uint8_t>(index * 31);
+        }
+
+        AzNetworking::SharedMemoryPayload sender;
+        ASSERT_TRUE(sender.Create(data.data(), data.size()));
+        EXPECT_FALSE(sender.GetName().empty());
+        EXPECT_EQ(sender.GetSize(), data.size());
+
+        AzNetworking::SharedMemoryPayload receiver;
+        ASSERT_TRUE(receiver.Open(sender.GetName().c_str(), sender.GetSize()));
+        ASSERT_NE(receiver.GetData(), nullptr);
+        EXPECT_EQ(memcmp(receiver.GetData(), data.data(), data.size()), 0);
+
+        receiver.Close();
+        sender.Close();
+        EXPECT_FALSE(receiver.IsOpen());
+        EXPECT_FALSE(sender.IsOpen());
+    }
+
+    TEST_F(SharedMemoryPayloadTests, Open_UnknownName_Fails)
+    {
+        AzNetworking::SharedMemoryPayload receiver;
+        EXPECT_FALSE(receiver.Open("AzNetworkingPayload_DoesNotExist", 1024));
+        EXPECT_FALSE(receiver.IsOpen());
+    }
+#endif
+}
@@ -15,9 +15,11 @@ set(FILES
     DataStructures/FixedSizeVectorBitsetTests.cpp
     DataStructures/RingBufferBitsetTests.cpp
     DataStructures/TimeoutQueueTests.cpp
+    Serialization/BaselineDeltaTests.cpp
     Serialization/DeltaSerializerTests.cpp
     Serialization/HashSerializerTests.cpp
     Serialization/NetworkInputOutputSerializerTests.cpp
+    Serialization/SerializationBenchmarks.cpp
     Serialization/StringifySerializerTests.cpp
     Serialization/TrackChangedSerializerTests.cpp
     Serialization/TypeValidatingSerializerTests.cpp
@@ -27,4 +29,5 @@ set(FILES
     Utilities/IpAddressTests.cpp
     Utilities/NetworkCommonTests.cpp
     Utilities/QuantizedValuesTests.cpp
+    Utilities/SharedMemoryPayloadTests.cpp
 )
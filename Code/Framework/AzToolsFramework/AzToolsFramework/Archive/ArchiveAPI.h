@@ -88,6 +88,23 @@ namespace AzToolsFramework
             const AZStd::string& archivePath,
             const AZStd::string& workingDirectory,
             const AZStd::string& listFilePath) = 0;
+
+        //! Add files to an archive provided from a file listing, like AddFilesToArchive
+        //! Files that didn't change since a previous version of the archive are copied from it instead of being compressed again
+        //! A file didn't change when one of the previous archives has an entry at the same path with the same size and CRC32
+        //! @param archivePath The path of the archive to add to
+        //! @param workingDirectory A directory that will be the starting path of the list of files to add
+        //! @param listFilePath Full path to a text file that contains the list of files to add
+        //! @param previousArchivePaths Paths of the previous versions of the archive, the ones that don't exist are skipped
+        //! @return Future (bool) which can obtain the success value of the operation
+        [[nodiscard]] virtual std::future<bool> AddFilesToArchiveIncremental(
+            const AZStd::string& archivePath,
+            const AZStd::string& workingDirectory,
+            const AZStd::string& listFilePath,
+            [[maybe_unused]] const AZStd::vector<AZStd::string>& previousArchivePaths)
+        {
+            return AddFilesToArchive(archivePath, workingDirectory, listFilePath);
+        }
     };
 
     using ArchiveCommandsBus = AZ::EBus<ArchiveCommands>;
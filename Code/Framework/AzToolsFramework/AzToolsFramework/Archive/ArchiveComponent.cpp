@@ -10,9 +10,14 @@
 
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Serialization/EditContext.h>
 
 #include <AzFramework/Archive/INestedArchive.h>
+#include <AzFramework/Archive/ZipDirCache.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Process/ProcessCommunicator.h>
 #include <AzFramework/Process/ProcessWatcher.h>
@@ -73,6 +78,151 @@ namespace AzToolsFramework
             }
         }
 
+        using ArchivePtr = AZStd::intrusive_ptr<AZ::IO::INestedArchive>;
+
+        // A file of the list that's being added to an archive, either compressed or found unchanged in a previous archive.
+        struct PendingFile
+        {
+            AZ::IO::ZipDir::CompressedFileData m_data;
+            // The previous archive the file is copied from, or null if the file was compressed.
+            AZ::IO::INestedArchive* m_previousArchive = nullptr;
+            AZ::IO::INestedArchive::Handle m_previousFile = nullptr;
+            bool m_success = false;
+        };
+
+        // Reads and compresses a file. This doesn't touch the archive being written, so it runs on the job threads.
+        void PreparePendingFile(
+            const AZ::IO::Path& basePath, AZStd::string_view filePath, const AZStd::vector<ArchivePtr>& previousArchives, PendingFile& outFile)
+        {
+            AZStd::vector<char> fileBuffer;
+            if (!ReadFile(basePath / filePath, AZ::IO::OpenMode::ModeRead, fileBuffer))
+            {
+                AZ_Error(s_traceName, false, "Error encountered while reading '%.*s' to add to archive", AZ_STRING_ARG(filePath));
+                return;
+            }
+
+            if (!previousArchives.empty())
+            {
+                const AZ::Crc32 fileCRC(fileBuffer.data(), fileBuffer.size());
+                for (const ArchivePtr& previousArchive : previousArchives)
+                {
+                    AZ::IO::INestedArchive::Handle previousFile = previousArchive->FindFile(filePath);
+                    if (previousFile && previousArchive->GetFileSize(previousFile) == fileBuffer.size() &&
+                        previousArchive->GetFileCRC(previousFile) == fileCRC)
+                    {
+                        outFile.m_previousArchive = previousArchive.get();
+                        outFile.m_previousFile = previousFile;
+                        outFile.m_success = true;
+                        return;
+                    }
+                }
+            }
+
+            int result = AZ::IO::ZipDir::Cache::CompressFileData(
+                outFile.m_data, AZStd::move(fileBuffer), s_compressionMethod, s_compressionLevel, s_compressionCodec);
+            outFile.m_success = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
+            AZ_Error(s_traceName, outFile.m_success, "Error %d encountered while compressing '%.*s'", result, AZ_STRING_ARG(filePath));
+        }
+
+        // Writes a prepared file to the archive, copying its compressed data from the previous archive if it's unchanged.
+        bool WritePendingFile(AZ::IO::INestedArchive& archive, AZStd::string_view filePath, PendingFile& file)
+        {
+            if (!file.m_success)
+            {
+                return false;
+            }
+
+            if (file.m_previousArchive)
+            {
+                int result = file.m_previousArchive->ReadCompressedFile(file.m_previousFile, file.m_data);
+                if (result != AZ::IO::ZipDir::ZD_ERROR_SUCCESS)
+                {
+                    AZ_Error(
+                        s_traceName, false, "Error %d encountered while copying '%.*s' from archive '%.*s'", result, AZ_STRING_ARG(filePath),
+                        AZ_STRING_ARG(file.m_previousArchive->GetFullPath().Native()));
+                    return false;
+                }
+            }
+
+            int result = archive.UpdateCompressedFile(filePath, file.m_data);
+            const bool success = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
+            AZ_Error(
+                s_traceName, success, "Error %d encountered while adding '%.*s' to archive '%.*s'", result, AZ_STRING_ARG(filePath),
+                AZ_STRING_ARG(archive.GetFullPath().Native()));
+
+            // Release the data right away, a batch of compressed files can take a lot of memory.
+            file.m_data = {};
+            return success;
+        }
+
+        // Adds the files to the archive in the order of the list. The files are read and compressed in batches on the job
+        // threads, while the calling thread writes the previous batch. Limiting the number of files in flight bounds the
+        // memory used for the compressed data. Files that have the same size and CRC32 as an entry of one of the previous
+        // archives are copied from it instead of being compressed again.
+        bool AddFiles(
+            AZ::IO::INestedArchive& archive, const AZ::IO::Path& basePath, const AZStd::vector<AZStd::string>& files,
+            const AZStd::vector<ArchivePtr>& previousArchives)
+        {
+            bool success = true; // starts true and turns false when any error is encountered.
+
+            AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            if (jobContext == nullptr)
+            {
+                for (const AZStd::string& filePath : files)
+                {
+                    PendingFile file;
+                    PreparePendingFile(basePath, filePath, previousArchives, file);
+                    success = WritePendingFile(archive, filePath, file) && success;
+                }
+                return success;
+            }
+
+            constexpr size_t FilesPerWorkerInBatch = 4;
+            const size_t batchSize = AZStd::max<size_t>(jobContext->GetJobManager().GetNumWorkerThreads(), 1) * FilesPerWorkerInBatch;
+
+            AZStd::vector<PendingFile> batches[2];
+            size_t batchBegins[2] = { 0, 0 };
+            size_t current = 0;
+            auto writeBatch = [&archive, &files, &success](AZStd::vector<PendingFile>& batch, size_t batchBegin)
+            {
+                for (size_t i = 0; i < batch.size(); ++i)
+                {
+                    success = WritePendingFile(archive, files[batchBegin + i], batch[i]) && success;
+                }
+                batch.clear();
+            };
+
+            for (size_t begin = 0; begin < files.size(); begin += batchSize)
+            {
+                AZStd::vector<PendingFile>& batch = batches[current];
+                batch.resize(AZStd::min(batchSize, files.size() - begin));
+                batchBegins[current] = begin;
+
+                AZ::JobCompletion completion(jobContext);
+                for (size_t i = 0; i < batch.size(); ++i)
+                {
+                    AZ::Job* prepareJob = AZ::CreateJobFunction(
+                        [&basePath, &files, &previousArchives, &batch, begin, i]()
+                        {
+                            PreparePendingFile(basePath, files[begin + i], previousArchives, batch[i]);
+                        },
+                        true, jobContext);
+                    prepareJob->SetDependent(&completion);
+                    prepareJob->Start();
+                }
+
+                // Write the previous batch while this one is being compressed.
+                const size_t previous = 1 - current;
+                writeBatch(batches[previous], batchBegins[previous]);
+
+                completion.StartAndWaitForCompletion();
+                current = previous;
+            }
+            writeBatch(batches[1 - current], batchBegins[1 - current]);
+
+            return success;
+        }
+
     } // namespace ArchiveUtils
 
     void ArchiveComponent::Activate()
@@ -460,6 +610,16 @@ namespace AzToolsFramework
         const AZStd::string& archivePath,
         const AZStd::string& workingDirectory,
         const AZStd::string& listFilePath)
+    {
+        return AddFilesToArchiveIncremental(archivePath, workingDirectory, listFilePath, {});
+    }
+
+
+    std::future<bool> ArchiveComponent::AddFilesToArchiveIncremental(
+        const AZStd::string& archivePath,
+        const AZStd::string& workingDirectory,
+        const AZStd::string& listFilePath,
+        const AZStd::vector<AZStd::string>& previousArchivePaths)
     {
         if (!CheckParamsForAdd(workingDirectory, listFilePath))
         {
@@ -468,7 +628,7 @@ namespace AzToolsFramework
             return p.get_future();
         }
 
-        auto FnAddFilesToArchive = [this, archivePath, workingDirectory, listFilePath](std::promise<bool>&& p) -> void
+        auto FnAddFilesToArchive = [this, archivePath, workingDirectory, listFilePath, previousArchivePaths](std::promise<bool>&& p) -> void
         {
             auto archive = m_archive->OpenArchive(archivePath);
             if (!archive)
@@ -478,35 +638,33 @@ namespace AzToolsFramework
                 return;
             }
 
-            bool success = true; // starts true and turns false when any error is encountered.
-            AZ::IO::Path basePath{ workingDirectory };
-
-            auto PerLineCallback = [&success, &basePath, &archive](AZStd::string_view filePathLine) -> void
+            AZStd::vector<ArchiveUtils::ArchivePtr> previousArchives;
+            for (const AZStd::string& previousArchivePath : previousArchivePaths)
             {
-                AZStd::vector<char> fileBuffer;
-                AZ::IO::Path fullPath = (basePath / filePathLine);
-                if (ArchiveUtils::ReadFile(fullPath, AZ::IO::OpenMode::ModeRead, fileBuffer))
+                if (!m_fileIO->Exists(previousArchivePath.c_str()))
                 {
-                    int result = archive->UpdateFile(
-                        filePathLine, fileBuffer.data(), fileBuffer.size(), s_compressionMethod,
-                        s_compressionLevel, s_compressionCodec);
+                    continue;
+                }
 
-                    bool thisSuccess = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
-                    success = (success && thisSuccess);
-                    AZ_Error(
-                        s_traceName, thisSuccess, "Error %d encountered while adding '%.*s' to archive '%.*s'", result,
-                        AZ_STRING_ARG(filePathLine), AZ_STRING_ARG(archive->GetFullPath().Native()));
+                if (auto previousArchive = m_archive->OpenArchive(previousArchivePath, {}, AZ::IO::INestedArchive::FLAGS_READ_ONLY))
+                {
+                    previousArchives.push_back(AZStd::move(previousArchive));
                 }
                 else
                 {
-                    AZ_Error(
-                        s_traceName, false, "Error encountered while reading '%.*s' to add to archive '%.*s'", AZ_STRING_ARG(filePathLine),
-                        AZ_STRING_ARG(archive->GetFullPath().Native()));
+                    AZ_Warning(s_traceName, false, "Failed to open previous archive file '%s', its files will be compressed again", previousArchivePath.c_str());
                 }
-            };
+            }
+
+            AZStd::vector<AZStd::string> files;
+            ArchiveUtils::ProcessFileList(listFilePath, [&files](AZStd::string_view filePathLine)
+            {
+                files.emplace_back(filePathLine);
+            });
 
-            ArchiveUtils::ProcessFileList(listFilePath, PerLineCallback);
+            bool success = ArchiveUtils::AddFiles(*archive, AZ::IO::Path{ workingDirectory }, files, previousArchives);
 
+            previousArchives.clear();
             archive.reset();
             p.set_value(success);
         };
@@ -70,6 +70,12 @@ namespace AzToolsFramework
             const AZStd::string& archivePath,
             const AZStd::string& workingDirectory,
             const AZStd::string& listFilePath) override;
+
+        [[nodiscard]] std::future<bool> AddFilesToArchiveIncremental(
+            const AZStd::string& archivePath,
+            const AZStd::string& workingDirectory,
+            const AZStd::string& listFilePath,
+            const AZStd::vector<AZStd::string>& previousArchivePaths) override;
         //////////////////////////////////////////////////////////////////////////
 
     private:
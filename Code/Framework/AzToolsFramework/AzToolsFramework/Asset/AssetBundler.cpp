@@ -55,12 +55,13 @@ namespace AzToolsFramework
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<AssetBundleSettings>()
-                ->Version(3)
+                ->Version(4)
                 ->Field("AssetFileInfoListPath", &AssetBundleSettings::m_assetFileInfoListPath)
                 ->Field("BundleFilePath", &AssetBundleSettings::m_bundleFilePath)
                 ->Field("BundleVersion", &AssetBundleSettings::m_bundleVersion)
                 ->Field("maxBundleSize", &AssetBundleSettings::m_maxBundleSizeInMB)
-                ->Field("comment", &AssetBundleSettings::m_comment);
+                ->Field("comment", &AssetBundleSettings::m_comment)
+                ->Field("loadOrderTracePath", &AssetBundleSettings::m_loadOrderTracePath);
         }
     }
 
@@ -59,6 +59,9 @@ namespace AzToolsFramework
         int m_bundleVersion = AzFramework::AssetBundleManifest::CurrentBundleVersion;
         AZ::u64 m_maxBundleSizeInMB = MaxBundleSizeInMB;
         AZStd::string m_comment;
+        // optional AZ::IO::StreamerTrace captured while loading the game. Assets are written to the bundles in the order they were
+        // first read in the trace, so the reads at runtime go through the bundles sequentially.
+        AZStd::string m_loadOrderTracePath;
     };
 
    /*
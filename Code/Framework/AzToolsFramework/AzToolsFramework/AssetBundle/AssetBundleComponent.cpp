@@ -10,10 +10,16 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Debug/Trace.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/conversions.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/StringFunc/StringFunc.h>
@@ -29,6 +35,7 @@ namespace AzToolsFramework
 {
     const char* logWindowName = "AssetBundle";
     const char tempBundleFileSuffix[] = "_temp";
+    const char previousBundleFileSuffix[] = "_prev";
     const int NumOfBytesInMB = 1024 * 1024;
     const int ManifestFileSizeBufferInBytes = 10 * 1024; // 10 KB
     const float AssetCatalogFileSizeBufferPercentage = 1.0f;
@@ -88,7 +95,105 @@ namespace AzToolsFramework
         bool m_result = false;
     };
 
-    
+    //! This helper class keeps the bundle files of a previous build of an asset bundle while the new bundles are created,
+    //! so the files that didn't change can be copied from them instead of being compressed again.
+    //! The previous bundle files are deleted when it goes out of scope.
+    struct PreviousBundleFiles
+    {
+        PreviousBundleFiles() = default;
+
+        AZ_DISABLE_COPY_MOVE(PreviousBundleFiles)
+
+        ~PreviousBundleFiles()
+        {
+            AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+            for (const AZStd::string& filePath : m_filePaths)
+            {
+                if (!fileIO->Remove(filePath.c_str()))
+                {
+                    AZ_Warning(logWindowName, false, "Failed to delete previous bundle file (%s)", filePath.c_str());
+                }
+            }
+        }
+
+        AZStd::vector<AZStd::string> m_filePaths;
+    };
+
+    //! Orders the files by the first time they were read in the streamer trace, so the reads of the traced load go through
+    //! the bundles sequentially. Files that weren't read in the trace go after the others and keep their order.
+    bool OrderByLoadOrder(AZStd::vector<AssetFileInfo>& fileInfoList, const char* traceFilePath)
+    {
+        AZ::IO::StreamerTrace::Trace trace;
+        if (!AZ::IO::StreamerTrace::Load(trace, traceFilePath))
+        {
+            AZ_Error(logWindowName, false, "Failed to load the load order trace (%s).\n", traceFilePath);
+            return false;
+        }
+
+        auto normalizePath = [](AZStd::string path)
+        {
+            AZStd::replace(path.begin(), path.end(), '\\', '/');
+            AZStd::to_lower(path.begin(), path.end());
+            return path;
+        };
+
+        AZStd::unordered_map<AZStd::string, size_t> fileIndices;
+        for (size_t i = 0; i < fileInfoList.size(); ++i)
+        {
+            fileIndices.emplace(normalizePath(fileInfoList[i].m_assetRelativePath), i);
+        }
+
+        // The trace has the absolute paths of the files that were read, so a path matches the asset whose relative path
+        // is the longest suffix of it that starts after a separator.
+        constexpr size_t NotLoaded = AZStd::numeric_limits<size_t>::max();
+        AZStd::vector<size_t> pathFileIndices(trace.m_paths.size(), NotLoaded);
+        for (size_t pathIndex = 0; pathIndex < trace.m_paths.size(); ++pathIndex)
+        {
+            const AZStd::string path = normalizePath(trace.m_paths[pathIndex]);
+            for (size_t separator = path.find('/'); separator != AZStd::string::npos; separator = path.find('/', separator + 1))
+            {
+                if (auto it = fileIndices.find(path.substr(separator + 1)); it != fileIndices.end())
+                {
+                    pathFileIndices[pathIndex] = it->second;
+                    break;
+                }
+            }
+        }
+
+        // The records are stored in the order the requests were queued.
+        AZStd::vector<size_t> loadOrder(fileInfoList.size(), NotLoaded);
+        size_t loadedFileCount = 0;
+        for (const AZ::IO::StreamerTrace::Record& record : trace.m_records)
+        {
+            const size_t fileIndex = record.m_pathIndex < pathFileIndices.size() ? pathFileIndices[record.m_pathIndex] : NotLoaded;
+            if (fileIndex != NotLoaded && loadOrder[fileIndex] == NotLoaded)
+            {
+                loadOrder[fileIndex] = loadedFileCount++;
+            }
+        }
+
+        AZStd::vector<size_t> order(fileInfoList.size());
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            order[i] = i;
+        }
+        AZStd::stable_sort(order.begin(), order.end(), [&loadOrder](size_t lhs, size_t rhs)
+        {
+            return loadOrder[lhs] < loadOrder[rhs];
+        });
+
+        AZStd::vector<AssetFileInfo> orderedFileInfoList;
+        orderedFileInfoList.reserve(fileInfoList.size());
+        for (size_t fileIndex : order)
+        {
+            orderedFileInfoList.emplace_back(AZStd::move(fileInfoList[fileIndex]));
+        }
+        fileInfoList = AZStd::move(orderedFileInfoList);
+
+        AZ_TracePrintf(logWindowName, "Ordered %zu of %zu files by the load order trace (%s).\n", loadedFileCount, fileInfoList.size(), traceFilePath);
+        return true;
+    }
+
     void AssetBundleComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -284,20 +389,34 @@ namespace AzToolsFramework
 
         AZStd::string assetAlias = PlatformAddressedAssetCatalog::GetAssetRootForPlatform(platformId);
 
+        PreviousBundleFiles previousBundleFiles;
         if (fileIO->Exists(bundleFilePath.c_str()))
         {
-            // This will delete both the parent bundle as well as all the dependent bundles mentioned in the manifest file of the parent bundle.
-            if (!DeleteBundleFiles(bundleFilePath.Native()))
+            // This will move both the parent bundle as well as all the dependent bundles mentioned in the manifest file of the parent bundle.
+            if (!MoveBundleFilesToPrevious(bundleFilePath.Native(), previousBundleFiles.m_filePaths))
             {
                 return false;
             }
         }
 
+        const AZStd::vector<AssetFileInfo>* fileInfoList = &assetFileInfoList.m_fileInfoList;
+        AZStd::vector<AssetFileInfo> orderedFileInfoList;
+        if (!assetBundleSettings.m_loadOrderTracePath.empty())
+        {
+            AZ::IO::Path loadOrderTracePath = AZ::IO::Path(AZStd::string_view{ AZ::Utils::GetEnginePath() }) / assetBundleSettings.m_loadOrderTracePath;
+            orderedFileInfoList = assetFileInfoList.m_fileInfoList;
+            if (!OrderByLoadOrder(orderedFileInfoList, loadOrderTracePath.c_str()))
+            {
+                return false;
+            }
+            fileInfoList = &orderedFileInfoList;
+        }
+
         bool usePrefabSystemForLevels = false;
         AzFramework::ApplicationRequests::Bus::BroadcastResult(
             usePrefabSystemForLevels, &AzFramework::ApplicationRequests::IsPrefabSystemEnabled);
 
-        for (const AzToolsFramework::AssetFileInfo& assetFileInfo : assetFileInfoList.m_fileInfoList)
+        for (const AzToolsFramework::AssetFileInfo& assetFileInfo : *fileInfoList)
         {
             AZ::u64 fileSize = 0;
             AZStd::string fullAssetFilePath;
@@ -338,7 +457,7 @@ namespace AzToolsFramework
             else
             {
                 // add all files to the archive as a batch and update the bundle size
-                if (!InjectFiles(fileEntries, tempBundleFilePath, assetAlias.c_str()))
+                if (!InjectFiles(fileEntries, tempBundleFilePath, assetAlias.c_str(), previousBundleFiles.m_filePaths))
                 {
                     return false;
                 }
@@ -361,7 +480,7 @@ namespace AzToolsFramework
             {
                 // if we are here it implies that adding file size to the remaining increases the size over the max size 
                 // and therefore we can add the pending files and the delta catalog to the bundle
-                if (!AddCatalogAndFilesToBundle(deltaCatalogEntries, fileEntries, tempBundleFilePath, assetAlias.c_str(), platformId))
+                if (!AddCatalogAndFilesToBundle(deltaCatalogEntries, fileEntries, tempBundleFilePath, assetAlias.c_str(), platformId, previousBundleFiles.m_filePaths))
                 {
                     return false;
                 }
@@ -398,7 +517,7 @@ namespace AzToolsFramework
         }
 
 
-        if (!AddCatalogAndFilesToBundle(deltaCatalogEntries, fileEntries, tempBundleFilePath, assetAlias.c_str(), platformId))
+        if (!AddCatalogAndFilesToBundle(deltaCatalogEntries, fileEntries, tempBundleFilePath, assetAlias.c_str(), platformId, previousBundleFiles.m_filePaths))
         {
             return false;
         }
@@ -465,7 +584,7 @@ namespace AzToolsFramework
         return CreateAssetBundleFromList(assetBundleSettings, assetFileInfoList);
     }
 
-    bool AssetBundleComponent::AddCatalogAndFilesToBundle(const AZStd::vector<AZStd::string>& deltaCatalogEntries, const AZStd::vector<AZStd::string>& fileEntries, const AZStd::string& bundleFilePath, const char* assetAlias, const AzFramework::PlatformId& platformId)
+    bool AssetBundleComponent::AddCatalogAndFilesToBundle(const AZStd::vector<AZStd::string>& deltaCatalogEntries, const AZStd::vector<AZStd::string>& fileEntries, const AZStd::string& bundleFilePath, const char* assetAlias, const AzFramework::PlatformId& platformId, const AZStd::vector<AZStd::string>& previousBundleFilePaths)
     {
         AZStd::string bundleFolder;
         AzFramework::StringFunc::Path::GetFullPath(bundleFilePath.c_str(), bundleFolder);
@@ -477,7 +596,7 @@ namespace AzToolsFramework
 
         if (fileEntries.size())
         {
-            if (!InjectFiles(fileEntries, bundleFilePath, assetAlias))
+            if (!InjectFiles(fileEntries, bundleFilePath, assetAlias, previousBundleFilePaths))
             {
                 return false;
             }
@@ -597,6 +716,50 @@ namespace AzToolsFramework
         return true;
     }
 
+    bool AssetBundleComponent::MoveBundleFilesToPrevious(const AZStd::string& assetBundleFilePath, AZStd::vector<AZStd::string>& previousBundleFilePaths)
+    {
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        AZStd::string bundleFolder;
+        AzFramework::StringFunc::Path::GetFullPath(assetBundleFilePath.c_str(), bundleFolder);
+
+        AZStd::vector<AZStd::string> bundleFilePaths{ assetBundleFilePath };
+        AZStd::unique_ptr<AzFramework::AssetBundleManifest> manifest(GetManifestFromBundle(assetBundleFilePath));
+        if (manifest)
+        {
+            for (const AZStd::string& filename : manifest->GetDependentBundleNames())
+            {
+                AZStd::string dependentBundlesFilePath;
+                AzFramework::StringFunc::Path::ConstructFull(bundleFolder.c_str(), filename.c_str(), dependentBundlesFilePath, true);
+                bundleFilePaths.emplace_back(AZStd::move(dependentBundlesFilePath));
+            }
+        }
+
+        for (const AZStd::string& bundleFilePath : bundleFilePaths)
+        {
+            if (!fileIO->Exists(bundleFilePath.c_str()))
+            {
+                AZ_Warning(logWindowName, false, "Dependent bundle file (%s) does not exist", bundleFilePath.c_str());
+                continue;
+            }
+
+            // a previous bundle file can be left behind if the creation of the bundles was interrupted
+            AZStd::string previousBundleFilePath = bundleFilePath + previousBundleFileSuffix;
+            if (fileIO->Exists(previousBundleFilePath.c_str()))
+            {
+                fileIO->Remove(previousBundleFilePath.c_str());
+            }
+
+            if (!fileIO->Rename(bundleFilePath.c_str(), previousBundleFilePath.c_str()))
+            {
+                AZ_Error(logWindowName, false, "Failed to move bundle file (%s) to (%s)", bundleFilePath.c_str(), previousBundleFilePath.c_str());
+                return false;
+            }
+            previousBundleFilePaths.emplace_back(AZStd::move(previousBundleFilePath));
+        }
+
+        return true;
+    }
+
     bool AssetBundleComponent::InjectFile(const AZStd::string& filePath, const AZStd::string& archiveFilePath, const char* workingDirectory)
     {
         AZ_TracePrintf(logWindowName, "Injecting file (%s) into bundle (%s).\n", filePath.c_str(), archiveFilePath.c_str());
@@ -631,7 +794,7 @@ namespace AzToolsFramework
         return InjectFile(filePath, sourcePak, workingDir.c_str());
     }
 
-    bool AssetBundleComponent::InjectFiles(const AZStd::vector<AZStd::string>& fileEntries, const AZStd::string& sourcePak, const char* workingDirectory)
+    bool AssetBundleComponent::InjectFiles(const AZStd::vector<AZStd::string>& fileEntries, const AZStd::string& sourcePak, const char* workingDirectory, const AZStd::vector<AZStd::string>& previousBundleFilePaths)
     {
         if (!fileEntries.size())
         {
@@ -670,7 +833,7 @@ namespace AzToolsFramework
         }
 
         std::future<bool> filesAdded;
-        AzToolsFramework::ArchiveCommandsBus::BroadcastResult(filesAdded, &AzToolsFramework::ArchiveCommands::AddFilesToArchive, sourcePak, workingDirectory, listFilePath);
+        AzToolsFramework::ArchiveCommandsBus::BroadcastResult(filesAdded, &AzToolsFramework::ArchiveCommands::AddFilesToArchiveIncremental, sourcePak, workingDirectory, listFilePath, previousBundleFilePaths);
         bool filesAddedToArchive = filesAdded.get();
         if (!filesAddedToArchive)
         {
@@ -57,8 +57,9 @@ namespace AzToolsFramework
         static bool InjectFile(const AZStd::string& filePath, const AZStd::string& sourcePak, const char* workingDirectory);
 
         //! Inject the files with relative filePaths with respect to the working directory into the bundle at sourcePak
+        //! Files that are unchanged in one of the previous bundle files are copied from it instead of being compressed again
         //! Returns true if the file at filePath was successfully injected into the bundle at sourcePak
-        static bool InjectFiles(const AZStd::vector<AZStd::string>& fileEntries, const AZStd::string& sourcePak, const char* workingDirectory);
+        static bool InjectFiles(const AZStd::vector<AZStd::string>& fileEntries, const AZStd::string& sourcePak, const char* workingDirectory, const AZStd::vector<AZStd::string>& previousBundleFilePaths = {});
 
         //! Removes any known non-asset entries from a list of files that exist in a bundle. 
         //! Currently removes entries such as a Delta Asset Catalog if one exists, and the bundle itself.
@@ -83,12 +84,16 @@ namespace AzToolsFramework
         //! This will delete both the parent bundle as well as all the dependent bundles mentioned in the manifest file of the parent bundle.
         bool DeleteBundleFiles(const AZStd::string& assetBundleFilePath);
 
+        //! Renames both the parent bundle as well as all the dependent bundles mentioned in the manifest file of the parent bundle,
+        //! so they can be used as the previous bundle files while the new bundles are created.
+        bool MoveBundleFilesToPrevious(const AZStd::string& assetBundleFilePath, AZStd::vector<AZStd::string>& previousBundleFilePaths);
+
         //! Adds the manifest file to all the bundles
         //! The parent bundle manifest file is special since it will contain information of all dependent bundles names.
         bool AddManifestFileToBundles(const AZStd::vector<AZStd::pair<AZStd::string, AZStd::string>>& bundlePathDeltaCatalogPair, const AZStd::vector<AZStd::string>& dependentBundleNames, const AZStd::string& bundleFolder, const AzToolsFramework::AssetBundleSettings& assetBundleSettings, const AZStd::vector<AZ::IO::Path>& levelDirs);
 
         //! Adds the delta catalog and any remaining files to the bundle
         //! We only create the delta catalog once we are sure about what all the files that will go in it. 
-        bool AddCatalogAndFilesToBundle(const AZStd::vector<AZStd::string>& deltaCatalogEntries, const AZStd::vector<AZStd::string>& fileEntries, const AZStd::string& bundleFilePath, const char* assetAlias, const AzFramework::PlatformId& platformId);
+        bool AddCatalogAndFilesToBundle(const AZStd::vector<AZStd::string>& deltaCatalogEntries, const AZStd::vector<AZStd::string>& fileEntries, const AZStd::string& bundleFilePath, const char* assetAlias, const AzFramework::PlatformId& platformId, const AZStd::vector<AZStd::string>& previousBundleFilePaths);
     };
 }
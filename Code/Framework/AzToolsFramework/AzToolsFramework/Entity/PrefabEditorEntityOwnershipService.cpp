@@ -6,11 +6,13 @@
  *
  */
 
+#include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Script/ScriptSystemBus.h>
 #include <AzCore/StringFunc/StringFunc.h>
 #include <AzFramework/API/ApplicationAPI.h>
+#include <AzFramework/Asset/AssetSystemBus.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Spawnable/RootSpawnableInterface.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
@@ -22,6 +24,7 @@
 #include <AzToolsFramework/Prefab/Instance/InstanceUpdateExecutorInterface.h>
 #include <AzToolsFramework/Prefab/PrefabDomUtils.h>
 #include <AzToolsFramework/Prefab/PrefabLoader.h>
+#include <AzToolsFramework/Prefab/PrefabLoadProfiler.h>
 #include <AzToolsFramework/Prefab/PrefabFocusInterface.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityMapperInterface.h>
 #include <AzToolsFramework/Prefab/PrefabSystemComponentInterface.h>
@@ -30,6 +33,45 @@
 
 namespace AzToolsFramework
 {
+    namespace
+    {
+        // Hints the Asset Processor about the assets the level is going to load, so their queued jobs get processed first.
+        void PrefetchLevelAssets(AZStd::string_view filename)
+        {
+            bool sourceInfoFound = false;
+            AZ::Data::AssetInfo sourceInfo;
+            AZStd::string watchFolder;
+            AssetSystemRequestBus::BroadcastResult(
+                sourceInfoFound, &AssetSystemRequestBus::Events::GetSourceInfoBySourcePath, AZStd::string(filename).c_str(), sourceInfo,
+                watchFolder);
+            if (!sourceInfoFound)
+            {
+                return;
+            }
+
+            AZStd::vector<AZ::Data::AssetInfo> productsInfo;
+            AssetSystemRequestBus::Broadcast(
+                &AssetSystemRequestBus::Events::GetAssetsProducedBySourceUUID, sourceInfo.m_assetId.m_guid, productsInfo);
+
+            AZStd::vector<AZ::Uuid> assetUuids;
+            for (const AZ::Data::AssetInfo& productInfo : productsInfo)
+            {
+                AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> dependencies = AZ::Failure(AZStd::string());
+                AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                    dependencies, &AZ::Data::AssetCatalogRequestBus::Events::GetAllProductDependencies, productInfo.m_assetId);
+                if (dependencies.IsSuccess())
+                {
+                    for (const AZ::Data::ProductDependency& dependency : dependencies.GetValue())
+                    {
+                        assetUuids.push_back(dependency.m_assetId.m_guid);
+                    }
+                }
+            }
+
+            AzFramework::AssetSystemRequestBus::Broadcast(&AzFramework::AssetSystemRequestBus::Events::PrefetchAssetsByUuid, assetUuids);
+        }
+    } // namespace
+
     PrefabEditorEntityOwnershipService::PrefabEditorEntityOwnershipService(const AzFramework::EntityContextId& entityContextId,
         AZ::SerializeContext* serializeContext)
         : m_entityContextId(entityContextId)
@@ -240,6 +282,13 @@ namespace AzToolsFramework
     {
         Reset();
 
+        // The capture ends once the propagation that creates the root instance is done, see PrefabLoadProfiler.
+        if (auto* loadProfiler = AZ::Interface<Prefab::PrefabLoadProfilerInterface>::Get();
+            loadProfiler && Prefab::PrefabLoadProfiler::IsEnabled())
+        {
+            loadProfiler->BeginCapture(filename);
+        }
+
         const size_t bufSize = stream.GetLength();
         AZStd::unique_ptr<char[]> buf(new char[bufSize]);
         AZ::IO::SizeType bytes = stream.Read(bufSize, buf.get());
@@ -255,6 +304,8 @@ namespace AzToolsFramework
         m_rootInstance->SetTemplateSourcePath(m_loaderInterface->GenerateRelativePath(filename));
         m_rootInstance->SetContainerEntityName("Level");
 
+        PrefetchLevelAssets(filename);
+
         auto instanceUpdateExecutorInterface = AZ::Interface<Prefab::InstanceUpdateExecutorInterface>::Get();
         if (!instanceUpdateExecutorInterface)
         {
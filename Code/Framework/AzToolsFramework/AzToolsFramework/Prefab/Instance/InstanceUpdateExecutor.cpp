@@ -11,6 +11,7 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzToolsFramework/Entity/EditorEntityContextBus.h>
 #include <AzToolsFramework/Entity/EditorEntityHelpers.h>
 #include <AzToolsFramework/Entity/PrefabEditorEntityOwnershipInterface.h>
@@ -19,6 +20,7 @@
 #include <AzToolsFramework/Prefab/Instance/InstanceDomGeneratorInterface.h>
 #include <AzToolsFramework/Prefab/Instance/TemplateInstanceMapperInterface.h>
 #include <AzToolsFramework/Prefab/PrefabDomUtils.h>
+#include <AzToolsFramework/Prefab/PrefabLoadProfilerInterface.h>
 #include <AzToolsFramework/Prefab/PrefabPublicInterface.h>
 #include <AzToolsFramework/Prefab/PrefabPublicNotificationBus.h>
 #include <AzToolsFramework/Prefab/PrefabSystemComponentInterface.h>
@@ -220,6 +222,9 @@ namespace AzToolsFramework
                             continue;
                         }
 
+                        // Attributes the DOM generation and entity creation below to this instance's prefab when profiling loads.
+                        ScopedPrefabLoadProfile instanceLoadProfile(PrefabLoadStage::InstanceLoad, instanceToUpdate->GetTemplateSourcePath());
+
                         // Gets a copy of instance DOM from focused or root prefab template.
                         PrefabDom instanceDom;
                         m_instanceDomGeneratorInterface->GetInstanceDomFromTemplate(instanceDom, *instanceToUpdate);
@@ -235,6 +240,15 @@ namespace AzToolsFramework
                             continue;
                         }
 
+                        // Instances whose DOM didn't change, because the change didn't reach them or got hidden by an override,
+                        // don't need to be loaded at all.
+                        PrefabDomReference cachedInstanceDom = instanceToUpdate->GetCachedInstanceDom();
+                        if (m_isRootPrefabInstanceLoaded && cachedInstanceDom.has_value() &&
+                            AZ::JsonSerialization::Compare(cachedInstanceDom->get(), instanceDom) == AZ::JsonSerializerCompareResult::Equal)
+                        {
+                            continue;
+                        }
+
                         // Loads instance object from the generated instance DOM.
                         EntityList newEntities;
                         if (PrefabDomUtils::LoadInstanceFromPrefabDom(*instanceToUpdate, newEntities, instanceDom,
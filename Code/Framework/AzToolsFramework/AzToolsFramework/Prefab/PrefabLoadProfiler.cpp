@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzToolsFramework/Prefab/PrefabLoadProfiler.h>
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Date/DateFormat.h>
+#include <AzCore/Debug/PerformanceCollector.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Metrics/JsonTraceEventLogger.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/StringFunc/StringFunc.h>
+
+AZ_CVAR(
+    bool,
+    ed_prefabLoadProfiler,
+    false,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Attributes the time spent loading levels to prefab files and component types, see ed_PrintPrefabLoadReport");
+
+namespace AzToolsFramework
+{
+    namespace Prefab
+    {
+        static const char* GetStageName(PrefabLoadStage stage)
+        {
+            switch (stage)
+            {
+            case PrefabLoadStage::TemplateLoad:
+                return "TemplateLoad";
+            case PrefabLoadStage::InstanceLoad:
+                return "InstanceLoad";
+            case PrefabLoadStage::ComponentActivation:
+                return "ComponentActivation";
+            }
+            return "";
+        }
+
+        static void PrintPrefabLoadReport(const AZ::ConsoleCommandContainer& arguments)
+        {
+            auto* loadProfiler = AZ::Interface<PrefabLoadProfilerInterface>::Get();
+            if (!loadProfiler)
+            {
+                AZ_Warning(PrefabLoadProfiler::LogName, false, "The prefab load profiler isn't available.");
+                return;
+            }
+
+            PrefabLoadReportSortKey sortKey = PrefabLoadReportSortKey::TotalTime;
+            if (!arguments.empty())
+            {
+                if (AZ::StringFunc::Equal(arguments.front(), "avg"))
+                {
+                    sortKey = PrefabLoadReportSortKey::AverageTime;
+                }
+                else if (AZ::StringFunc::Equal(arguments.front(), "max"))
+                {
+                    sortKey = PrefabLoadReportSortKey::MaxTime;
+                }
+                else if (AZ::StringFunc::Equal(arguments.front(), "count"))
+                {
+                    sortKey = PrefabLoadReportSortKey::Count;
+                }
+            }
+
+            // Only the most expensive entries are printed unless a row count is given
+            size_t maxRows = 20;
+            if (arguments.size() > 1)
+            {
+                maxRows = aznumeric_cast<size_t>(AZStd::max(AZ::StringFunc::ToInt(AZStd::string(arguments[1]).c_str()), 0));
+            }
+
+            const PrefabLoadReport report = loadProfiler->GetReport(sortKey);
+            AZ_TracePrintf(
+                PrefabLoadProfiler::LogName, "Prefab load report for '%s' (%.3f ms%s):\n", report.m_captureName.c_str(),
+                report.m_captureDuration.count() / 1000.0, loadProfiler->IsCapturing() ? ", capture in progress" : "");
+
+            auto printCosts = [maxRows](const char* title, const AZStd::vector<PrefabLoadCostEntry>& costs)
+            {
+                AZ_TracePrintf(PrefabLoadProfiler::LogName, "  %s (total ms, avg ms, max ms, count):\n", title);
+                for (size_t row = 0; row < costs.size() && row < maxRows; ++row)
+                {
+                    const PrefabLoadCostEntry& cost = costs[row];
+                    AZ_TracePrintf(
+                        PrefabLoadProfiler::LogName, "    %10.3f %10.3f %10.3f %8llu %s\n", cost.m_totalTime.count() / 1000.0,
+                        cost.GetAverageTime().count() / 1000.0, cost.m_maxTime.count() / 1000.0, cost.m_count, cost.m_name.c_str());
+                }
+            };
+            printCosts("Component activation by type", report.m_componentActivations);
+            printCosts("Prefab template loads, excluding nested prefabs", report.m_templateLoads);
+            printCosts("Prefab instance loads, excluding component activation", report.m_instanceLoads);
+        }
+        AZ_CONSOLEFREEFUNC(
+            "ed_PrintPrefabLoadReport",
+            PrintPrefabLoadReport,
+            AZ::ConsoleFunctorFlags::Null,
+            "Prints the cost of the most recent level load captured with ed_prefabLoadProfiler. "
+            "Optional arguments: sort key (total, avg, max, count) and row count");
+
+        void PrefabLoadProfiler::RegisterPrefabLoadProfilerInterface()
+        {
+            AZ::Interface<PrefabLoadProfilerInterface>::Register(this);
+            AZ::Interface<AZ::ComponentActivationProfilerInterface>::Register(this);
+            PrefabPublicNotificationBus::Handler::BusConnect();
+        }
+
+        void PrefabLoadProfiler::UnregisterPrefabLoadProfilerInterface()
+        {
+            PrefabPublicNotificationBus::Handler::BusDisconnect();
+            AZ::Interface<AZ::ComponentActivationProfilerInterface>::Unregister(this);
+            AZ::Interface<PrefabLoadProfilerInterface>::Unregister(this);
+        }
+
+        bool PrefabLoadProfiler::IsEnabled()
+        {
+            return ed_prefabLoadProfiler;
+        }
+
+        void PrefabLoadProfiler::BeginCapture(AZStd::string_view captureName)
+        {
+            {
+                AZStd::scoped_lock costsLock(m_costsMutex);
+                m_templateLoadCosts.clear();
+                m_instanceLoadCosts.clear();
+                m_componentActivationCosts.clear();
+            }
+
+            m_loadStack.clear();
+            m_captureThreadId = AZStd::this_thread::get_id();
+            m_captureName = captureName;
+            m_captureStartTime = AZStd::chrono::steady_clock::now();
+            m_captureDuration = AZStd::chrono::microseconds(0);
+            m_isRootPrefabInstanceLoaded = false;
+            m_isCapturing = true;
+        }
+
+        void PrefabLoadProfiler::EndCapture()
+        {
+            if (!m_isCapturing)
+            {
+                return;
+            }
+
+            m_isCapturing = false;
+            m_loadStack.clear();
+            m_captureDuration =
+                AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - m_captureStartTime);
+
+            const AZ::IO::Path reportPath = WriteReportFile();
+            AZ_TracePrintf(
+                LogName, "Captured the load of '%s' (%.3f ms). Report written to '%s', see ed_PrintPrefabLoadReport.\n",
+                m_captureName.c_str(), m_captureDuration.count() / 1000.0, reportPath.c_str());
+        }
+
+        bool PrefabLoadProfiler::IsCapturing() const
+        {
+            return m_isCapturing;
+        }
+
+        void PrefabLoadProfiler::BeginLoad(PrefabLoadStage stage, AZ::IO::PathView prefabPath)
+        {
+            if (!m_isCapturing || AZStd::this_thread::get_id() != m_captureThreadId)
+            {
+                return;
+            }
+
+            m_loadStack.push_back({ stage, AZStd::string(prefabPath.Native()), AZStd::chrono::steady_clock::now() });
+        }
+
+        void PrefabLoadProfiler::EndLoad()
+        {
+            // the capture may have started or ended while the load was in progress
+            if (!m_isCapturing || AZStd::this_thread::get_id() != m_captureThreadId || m_loadStack.empty())
+            {
+                return;
+            }
+
+            LoadFrame loadFrame = AZStd::move(m_loadStack.back());
+            m_loadStack.pop_back();
+
+            const auto loadTime =
+                AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - loadFrame.m_startTime);
+            if (!m_loadStack.empty())
+            {
+                m_loadStack.back().m_nestedTime += loadTime;
+            }
+
+            AZStd::scoped_lock costsLock(m_costsMutex);
+            AddCost(
+                loadFrame.m_stage == PrefabLoadStage::TemplateLoad ? m_templateLoadCosts : m_instanceLoadCosts, loadFrame.m_prefabPath,
+                loadTime - loadFrame.m_nestedTime);
+        }
+
+        void PrefabLoadProfiler::RecordComponentActivation(const AZ::Component& component, AZStd::chrono::microseconds duration)
+        {
+            if (!m_isCapturing)
+            {
+                return;
+            }
+
+            if (!m_loadStack.empty() && AZStd::this_thread::get_id() == m_captureThreadId)
+            {
+                m_loadStack.back().m_nestedTime += duration;
+            }
+
+            AZStd::scoped_lock costsLock(m_costsMutex);
+            AddCost(m_componentActivationCosts, component.RTTI_GetTypeName(), duration);
+        }
+
+        void PrefabLoadProfiler::AddCost(
+            AZStd::unordered_map<AZStd::string, PrefabLoadCostEntry>& costs,
+            AZStd::string_view name,
+            AZStd::chrono::microseconds duration)
+        {
+            AZStd::string costName(name);
+            PrefabLoadCostEntry& cost = costs[costName];
+            if (cost.m_count == 0)
+            {
+                cost.m_name = AZStd::move(costName);
+            }
+
+            cost.m_totalTime += duration;
+            cost.m_maxTime = AZStd::max(cost.m_maxTime, duration);
+            ++cost.m_count;
+        }
+
+        PrefabLoadReport PrefabLoadProfiler::GetReport(PrefabLoadReportSortKey sortKey) const
+        {
+            PrefabLoadReport report;
+            report.m_captureName = m_captureName;
+            report.m_captureDuration = m_isCapturing
+                ? AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - m_captureStartTime)
+                : m_captureDuration;
+
+            auto getSortedCosts = [sortKey](const AZStd::unordered_map<AZStd::string, PrefabLoadCostEntry>& costs)
+            {
+                AZStd::vector<PrefabLoadCostEntry> sortedCosts;
+                sortedCosts.reserve(costs.size());
+                for (const auto& [name, cost] : costs)
+                {
+                    sortedCosts.push_back(cost);
+                }
+
+                auto costKey = [sortKey](const PrefabLoadCostEntry& cost) -> AZ::u64
+                {
+                    switch (sortKey)
+                    {
+                    case PrefabLoadReportSortKey::AverageTime:
+                        return aznumeric_cast<AZ::u64>(cost.GetAverageTime().count());
+                    case PrefabLoadReportSortKey::MaxTime:
+                        return aznumeric_cast<AZ::u64>(cost.m_maxTime.count());
+                    case PrefabLoadReportSortKey::Count:
+                        return cost.m_count;
+                    default:
+                        return aznumeric_cast<AZ::u64>(cost.m_totalTime.count());
+                    }
+                };
+                AZStd::sort(
+                    sortedCosts.begin(), sortedCosts.end(),
+                    [&costKey](const PrefabLoadCostEntry& lhs, const PrefabLoadCostEntry& rhs)
+                    {
+                        const AZ::u64 lhsKey = costKey(lhs);
+                        const AZ::u64 rhsKey = costKey(rhs);
+                        return lhsKey != rhsKey ? lhsKey > rhsKey : lhs.m_name < rhs.m_name;
+                    });
+                return sortedCosts;
+            };
+
+            AZStd::scoped_lock costsLock(m_costsMutex);
+            report.m_templateLoads = getSortedCosts(m_templateLoadCosts);
+            report.m_instanceLoads = getSortedCosts(m_instanceLoadCosts);
+            report.m_componentActivations = getSortedCosts(m_componentActivationCosts);
+            return report;
+        }
+
+        AZ::IO::Path PrefabLoadProfiler::WriteReportFile() const
+        {
+            AZ::IO::Path reportPath;
+            AZ::SettingsRegistryInterface* settingsRegistry = AZ::SettingsRegistry::Get();
+            if (!settingsRegistry || !settingsRegistry->Get(reportPath.Native(), AZ::SettingsRegistryMergeUtils::FilePathKey_ProjectUserPath))
+            {
+                return {};
+            }
+
+            AZ::Date::Iso8601TimestampString utcTimestamp;
+            AZ::Date::GetFilenameCompatibleFormatNowWithMicroseconds(utcTimestamp);
+            reportPath /= AZStd::string::format("Performance_PrefabLoad_%s.json", utcTimestamp.c_str());
+
+            auto stream = AZStd::make_unique<AZ::IO::SystemFileStream>(reportPath.c_str(), AZ::IO::OpenMode::ModeWrite);
+            if (!stream->IsOpen())
+            {
+                AZ_Warning(LogName, false, "Failed to open '%s' for writing the prefab load report.", reportPath.c_str());
+                return {};
+            }
+
+            // Same layout as the statistics written by the PerformanceCollector: one complete event per entry,
+            // with the average as its duration and the summary in its arguments
+            AZ::Metrics::JsonTraceEventLogger eventLogger(AZStd::move(stream));
+            const PrefabLoadReport report = GetReport(PrefabLoadReportSortKey::TotalTime);
+            auto recordCosts = [&eventLogger](PrefabLoadStage stage, const AZStd::vector<PrefabLoadCostEntry>& costs)
+            {
+                const AZStd::string category = AZStd::string::format("PrefabLoad:%s", GetStageName(stage));
+                for (const PrefabLoadCostEntry& cost : costs)
+                {
+                    AZStd::fixed_vector<AZ::Metrics::EventField, 5> costParams;
+                    costParams.emplace_back("total", aznumeric_cast<AZ::s64>(cost.m_totalTime.count()));
+                    costParams.emplace_back(AZ::Debug::PerformanceCollector::AVG, aznumeric_cast<AZ::s64>(cost.GetAverageTime().count()));
+                    costParams.emplace_back(AZ::Debug::PerformanceCollector::MAX, aznumeric_cast<AZ::s64>(cost.m_maxTime.count()));
+                    costParams.emplace_back(AZ::Debug::PerformanceCollector::SAMPLE_COUNT, cost.m_count);
+                    costParams.emplace_back(AZ::Debug::PerformanceCollector::UNITS, "us");
+
+                    AZ::Metrics::CompleteArgs completeArgs;
+                    completeArgs.m_name = cost.m_name;
+                    completeArgs.m_cat = category;
+                    completeArgs.m_dur = cost.GetAverageTime();
+                    completeArgs.m_args = costParams;
+                    eventLogger.RecordCompleteEvent(completeArgs);
+                }
+            };
+            recordCosts(PrefabLoadStage::ComponentActivation, report.m_componentActivations);
+            recordCosts(PrefabLoadStage::TemplateLoad, report.m_templateLoads);
+            recordCosts(PrefabLoadStage::InstanceLoad, report.m_instanceLoads);
+            return reportPath;
+        }
+
+        void PrefabLoadProfiler::OnRootPrefabInstanceLoaded()
+        {
+            m_isRootPrefabInstanceLoaded = true;
+        }
+
+        void PrefabLoadProfiler::OnPrefabInstancePropagationEnd()
+        {
+            // The level's entities are all created and activated once the propagation that loaded the root instance is done
+            if (m_isCapturing && m_isRootPrefabInstanceLoaded)
+            {
+                EndCapture();
+            }
+        }
+    } // namespace Prefab
+} // namespace AzToolsFramework
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/ComponentActivationProfilerInterface.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzToolsFramework/Prefab/PrefabLoadProfilerInterface.h>
+#include <AzToolsFramework/Prefab/PrefabPublicNotificationBus.h>
+
+namespace AzToolsFramework
+{
+    namespace Prefab
+    {
+        //! Attributes the time spent loading a level to prefab files and component types.
+        //! A capture starts when the editor starts loading a level (see ed_prefabLoadProfiler) and ends once the propagation that
+        //! creates the root prefab instance is done. The results can be printed with ed_PrintPrefabLoadReport, and are written to a
+        //! Performance_PrefabLoad_<time>.json trace file next to the PerformanceCollector outputs.
+        class PrefabLoadProfiler final
+            : public PrefabLoadProfilerInterface
+            , public AZ::ComponentActivationProfilerInterface
+            , private PrefabPublicNotificationBus::Handler
+        {
+        public:
+            AZ_RTTI(PrefabLoadProfiler, "{8E0F6B52-95C4-4B36-8C8E-6A1D2E7F0C93}", PrefabLoadProfilerInterface, AZ::ComponentActivationProfilerInterface);
+
+            static constexpr char LogName[] = "PrefabLoadProfiler";
+
+            void RegisterPrefabLoadProfilerInterface();
+            void UnregisterPrefabLoadProfilerInterface();
+
+            //! Returns true if level loads should be captured, which is controlled by the ed_prefabLoadProfiler CVar.
+            static bool IsEnabled();
+
+            // PrefabLoadProfilerInterface and ComponentActivationProfilerInterface overrides ...
+            void BeginCapture(AZStd::string_view captureName) override;
+            void EndCapture() override;
+            bool IsCapturing() const override;
+            void BeginLoad(PrefabLoadStage stage, AZ::IO::PathView prefabPath) override;
+            void EndLoad() override;
+            PrefabLoadReport GetReport(PrefabLoadReportSortKey sortKey) const override;
+            void RecordComponentActivation(const AZ::Component& component, AZStd::chrono::microseconds duration) override;
+
+            //! Writes the report in the Google Trace Json format used by the PerformanceCollector.
+            //! @return The path of the written file, or an empty path if it couldn't be written.
+            AZ::IO::Path WriteReportFile() const;
+
+        private:
+            // PrefabPublicNotificationBus overrides ...
+            void OnPrefabInstancePropagationEnd() override;
+            void OnRootPrefabInstanceLoaded() override;
+
+            static void AddCost(
+                AZStd::unordered_map<AZStd::string, PrefabLoadCostEntry>& costs,
+                AZStd::string_view name,
+                AZStd::chrono::microseconds duration);
+
+            //! A load in progress. Time spent in the loads and activations nested inside it is subtracted from its own.
+            struct LoadFrame
+            {
+                PrefabLoadStage m_stage;
+                AZStd::string m_prefabPath;
+                AZStd::chrono::steady_clock::time_point m_startTime;
+                AZStd::chrono::microseconds m_nestedTime{ 0 };
+            };
+            AZStd::vector<LoadFrame> m_loadStack; //!< Only touched from the thread that began the capture.
+            AZStd::thread_id m_captureThreadId;
+
+            AZStd::atomic_bool m_isCapturing{ false };
+            bool m_isRootPrefabInstanceLoaded = false;
+            AZStd::string m_captureName;
+            AZStd::chrono::steady_clock::time_point m_captureStartTime;
+            AZStd::chrono::microseconds m_captureDuration{ 0 };
+
+            //! Guards the cost maps, since entities may be activated from any thread.
+            mutable AZStd::mutex m_costsMutex;
+            AZStd::unordered_map<AZStd::string, PrefabLoadCostEntry> m_templateLoadCosts;
+            AZStd::unordered_map<AZStd::string, PrefabLoadCostEntry> m_instanceLoadCosts;
+            AZStd::unordered_map<AZStd::string, PrefabLoadCostEntry> m_componentActivationCosts;
+        };
+    } // namespace Prefab
+} // namespace AzToolsFramework
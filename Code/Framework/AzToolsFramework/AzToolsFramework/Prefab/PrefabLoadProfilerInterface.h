@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/RTTI/RTTIMacros.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AzToolsFramework
+{
+    namespace Prefab
+    {
+        //! The stages of a level or prefab load that the PrefabLoadProfiler attributes time to.
+        enum class PrefabLoadStage
+        {
+            TemplateLoad, //!< Reading and parsing a prefab file into a template, excluding its nested prefabs.
+            InstanceLoad, //!< Creating the entities of an instance from its template DOM, excluding component activation.
+            ComponentActivation, //!< Component::Activate calls, attributed per component type.
+        };
+
+        enum class PrefabLoadReportSortKey
+        {
+            TotalTime,
+            AverageTime,
+            MaxTime,
+            Count,
+        };
+
+        //! Accumulated cost of one prefab file or component type during a capture.
+        struct PrefabLoadCostEntry
+        {
+            AZStd::string m_name;
+            AZStd::chrono::microseconds m_totalTime{ 0 };
+            AZStd::chrono::microseconds m_maxTime{ 0 };
+            AZ::u64 m_count = 0;
+
+            AZStd::chrono::microseconds GetAverageTime() const
+            {
+                return m_count > 0 ? m_totalTime / m_count : AZStd::chrono::microseconds(0);
+            }
+        };
+
+        struct PrefabLoadReport
+        {
+            AZStd::string m_captureName;
+            AZStd::chrono::microseconds m_captureDuration{ 0 };
+            AZStd::vector<PrefabLoadCostEntry> m_templateLoads;
+            AZStd::vector<PrefabLoadCostEntry> m_instanceLoads;
+            AZStd::vector<PrefabLoadCostEntry> m_componentActivations;
+        };
+
+        /*!
+         * PrefabLoadProfilerInterface
+         * Interface for attributing the time spent loading levels and prefabs in the editor to prefab files and component types.
+         */
+        class PrefabLoadProfilerInterface
+        {
+        public:
+            AZ_RTTI(PrefabLoadProfilerInterface, "{3C8E5E0B-41F2-4B0C-A7C3-2B7F4D6E9A15}");
+
+            virtual ~PrefabLoadProfilerInterface() = default;
+
+            //! Starts a new capture, discarding the results of the previous one.
+            virtual void BeginCapture(AZStd::string_view captureName) = 0;
+
+            //! Stops the current capture. Its results stay available until the next capture begins.
+            virtual void EndCapture() = 0;
+
+            virtual bool IsCapturing() const = 0;
+
+            //! Begins timing a template or instance load of the prefab at the given path.
+            //! Loads can nest, time spent in nested loads is only attributed to the innermost one.
+            virtual void BeginLoad(PrefabLoadStage stage, AZ::IO::PathView prefabPath) = 0;
+            virtual void EndLoad() = 0;
+
+            //! Returns the results of the current or most recent capture, sorted from the highest cost down.
+            virtual PrefabLoadReport GetReport(PrefabLoadReportSortKey sortKey) const = 0;
+        };
+
+        //! Times the enclosing scope as a load of the given prefab while a PrefabLoadProfiler capture is running.
+        class ScopedPrefabLoadProfile
+        {
+        public:
+            ScopedPrefabLoadProfile(PrefabLoadStage stage, AZ::IO::PathView prefabPath)
+            {
+                if (auto* loadProfiler = AZ::Interface<PrefabLoadProfilerInterface>::Get(); loadProfiler && loadProfiler->IsCapturing())
+                {
+                    m_loadProfiler = loadProfiler;
+                    m_loadProfiler->BeginLoad(stage, prefabPath);
+                }
+            }
+
+            ~ScopedPrefabLoadProfile()
+            {
+                if (m_loadProfiler)
+                {
+                    m_loadProfiler->EndLoad();
+                }
+            }
+
+            ScopedPrefabLoadProfile(const ScopedPrefabLoadProfile&) = delete;
+            ScopedPrefabLoadProfile& operator=(const ScopedPrefabLoadProfile&) = delete;
+
+        private:
+            PrefabLoadProfilerInterface* m_loadProfiler = nullptr;
+        };
+    } // namespace Prefab
+} // namespace AzToolsFramework
@@ -19,6 +19,7 @@
 #include <AzToolsFramework/API/EditorAssetSystemAPI.h>
 #include <AzToolsFramework/API/ToolsApplicationAPI.h>
 #include <AzToolsFramework/Prefab/PrefabDomUtils.h>
+#include <AzToolsFramework/Prefab/PrefabLoadProfilerInterface.h>
 #include <AzToolsFramework/Prefab/PrefabPublicNotificationBus.h>
 #include <AzToolsFramework/Prefab/PrefabSystemComponentInterface.h>
 #include <Prefab/ProceduralPrefabSystemComponentInterface.h>
@@ -354,6 +355,9 @@ namespace AzToolsFramework
 
         TemplateId PrefabLoader::LoadTemplateFromFile(AZ::IO::PathView filePath, AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet)
         {
+            AZ_PROFILE_FUNCTION(AzToolsFramework);
+            ScopedPrefabLoadProfile loadProfile(PrefabLoadStage::TemplateLoad, filePath);
+
             if (!IsValidPrefabPath(filePath))
             {
                 AZ_Error(
@@ -384,6 +388,9 @@ namespace AzToolsFramework
         TemplateId PrefabLoader::LoadTemplateFromString(
             AZStd::string_view content, AZ::IO::PathView originPath)
         {
+            AZ_PROFILE_FUNCTION(AzToolsFramework);
+            ScopedPrefabLoadProfile loadProfile(PrefabLoadStage::TemplateLoad, originPath);
+
             AZStd::unordered_set<AZ::IO::Path> progressedFilePathsSet;
             TemplateId newTemplateId = LoadTemplateFromString(content, originPath, progressedFilePathsSet);
             return newTemplateId;
@@ -38,6 +38,7 @@ namespace AzToolsFramework
             AZ::Interface<PrefabSystemComponentInterface>::Register(this);
 
             m_prefabLoader.RegisterPrefabLoaderInterface();
+            m_prefabLoadProfiler.RegisterPrefabLoadProfilerInterface();
             m_instanceToTemplatePropagator.RegisterInstanceToTemplateInterface();
             m_instanceUpdateExecutor.RegisterInstanceUpdateExecutorInterface();
             m_prefabPublicHandler.RegisterPrefabPublicHandlerInterface();
@@ -58,6 +59,7 @@ namespace AzToolsFramework
             m_prefabPublicHandler.UnregisterPrefabPublicHandlerInterface();
             m_instanceUpdateExecutor.UnregisterInstanceUpdateExecutorInterface();
             m_instanceToTemplatePropagator.UnregisterInstanceToTemplateInterface();
+            m_prefabLoadProfiler.UnregisterPrefabLoadProfilerInterface();
             m_prefabLoader.UnregisterPrefabLoaderInterface();
 
             AZ::Interface<PrefabSystemComponentInterface>::Unregister(this);
@@ -339,9 +341,15 @@ namespace AzToolsFramework
             TemplateId targetTemplateId = linkToUpdate.GetTargetTemplateId();
             PrefabDomValue& linkedInstanceDom = linkToUpdate.GetLinkedInstanceDom();
 
+            // A copy of the linked DOM is only needed when it's not yet known whether the target template changed.
+            const bool isTemplateUpdated = targetTemplateIdToLinkIdMap[targetTemplateId].second;
+
             // create an empty Dom to hold the temp allocations so they are cleared when we leave this scope:
-            PrefabDom linkedDomBeforeUpdate; 
-            linkedDomBeforeUpdate.CopyFrom(linkedInstanceDom, linkedDomBeforeUpdate.GetAllocator());
+            PrefabDom linkedDomBeforeUpdate;
+            if (!isTemplateUpdated)
+            {
+                linkedDomBeforeUpdate.CopyFrom(linkedInstanceDom, linkedDomBeforeUpdate.GetAllocator());
+            }
 
             // the following call modifies the linkedInstanceDom to have the updated changes.
             // Most of the time, this modifies the actual linkedInstanceDom to have patches.
@@ -359,8 +367,7 @@ namespace AzToolsFramework
             // targetTemplateIdToLinkIdMap[targetTemplateId].second is true, there is no need to compare it again, as it will have
             // already added its links to the queue.
             
-            bool isTemplateUpdated = targetTemplateIdToLinkIdMap[targetTemplateId].second;
-            if (!isTemplateUpdated || AZ::JsonSerialization::Compare(linkedDomBeforeUpdate, linkedInstanceDom) != AZ::JsonSerializerCompareResult::Equal)
+            if (!isTemplateUpdated && AZ::JsonSerialization::Compare(linkedDomBeforeUpdate, linkedInstanceDom) != AZ::JsonSerializerCompareResult::Equal)
             {
                 targetTemplateIdToLinkIdMap[targetTemplateId].second = true;
             }
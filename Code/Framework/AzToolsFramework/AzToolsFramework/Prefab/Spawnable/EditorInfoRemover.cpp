@@ -7,6 +7,10 @@
  */
 
 #include <AzCore/Component/ComponentExport.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
@@ -57,10 +61,17 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
     {
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
         {
-            serializeContext->Class<EditorInfoRemover, PrefabProcessor>()->Version(1);
+            serializeContext->Class<EditorInfoRemover, PrefabProcessor>()
+                ->Version(2)
+                ->Field("ExportEntitiesInParallel", &EditorInfoRemover::m_exportEntitiesInParallel);
         }
     }
 
+    void EditorInfoRemover::SetExportEntitiesInParallel(bool exportEntitiesInParallel)
+    {
+        m_exportEntitiesInParallel = exportEntitiesInParallel;
+    }
+
     void EditorInfoRemover::GetEntitiesFromInstance(AzToolsFramework::Prefab::Instance& instance, EntityList& hierarchyEntities)
     {
         instance.GetAllEntitiesInHierarchy(
@@ -149,17 +160,9 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
 
     EditorInfoRemover::ExportEntityResult EditorInfoRemover::ExportEntity(AZ::Entity* sourceEntity, PrefabProcessorContext& context)
     {
-        // For export, components can assume they're initialized, but not activated.
-        if (sourceEntity->GetState() == AZ::Entity::State::Constructed)
-        {
-            sourceEntity->Init();
-        }
-
         auto exportEntity = AZStd::make_unique<AZ::Entity>(sourceEntity->GetId(), sourceEntity->GetName().c_str());
         exportEntity->SetRuntimeActiveByDefault(sourceEntity->IsRuntimeActiveByDefault());
 
-        AddEntityIdIfEditorOnly(sourceEntity);
-
         const AZ::Entity::ComponentArrayType& editorComponents = sourceEntity->GetComponents();
         EntityList exportedEntities;
         for (AZ::Component* component : editorComponents)
@@ -193,6 +196,94 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         return AZ::Success(AZStd::move(exportEntity));
     }
 
+    EditorInfoRemover::ExportEntitiesResult EditorInfoRemover::ExportEntities(
+        const EntityList& sourceEntities,
+        PrefabProcessorContext& context,
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>>& exportEntities)
+    {
+        // For export, components can assume they're initialized, but not activated. Initializing connects to buses and
+        // the editor-only check queries one, so both are done up front instead of on the job threads.
+        for (AZ::Entity* entity : sourceEntities)
+        {
+            if (entity->GetState() == AZ::Entity::State::Constructed)
+            {
+                entity->Init();
+            }
+            AddEntityIdIfEditorOnly(entity);
+        }
+
+        const size_t entityCount = sourceEntities.size();
+        exportEntities.resize(entityCount);
+        AZStd::vector<AZStd::string> errors(entityCount);
+
+        auto exportRange = [this, &sourceEntities, &context, &exportEntities, &errors](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                auto result = ExportEntity(sourceEntities[i], context);
+                if (result)
+                {
+                    exportEntities[i] = result.TakeValue();
+                }
+                else
+                {
+                    errors[i] = result.TakeError();
+                }
+            }
+        };
+
+        // Small ranges aren't worth the overhead of a job.
+        constexpr size_t MinEntitiesPerJob = 32;
+        AZ::JobContext* jobContext = m_exportEntitiesInParallel ? AZ::JobContext::GetGlobalContext() : nullptr;
+        size_t jobCount = 1;
+        if (jobContext != nullptr)
+        {
+            const size_t workerCount = AZStd::max<size_t>(jobContext->GetJobManager().GetNumWorkerThreads(), 1);
+            jobCount = AZStd::min(workerCount, (entityCount + MinEntitiesPerJob - 1) / MinEntitiesPerJob);
+        }
+
+        if (jobCount <= 1)
+        {
+            exportRange(0, entityCount);
+        }
+        else
+        {
+            // The calling thread exports the first range while the jobs export the others.
+            AZ::JobCompletion completion(jobContext);
+            const size_t entitiesPerJob = (entityCount + jobCount - 1) / jobCount;
+            for (size_t begin = entitiesPerJob; begin < entityCount; begin += entitiesPerJob)
+            {
+                const size_t end = AZStd::min(begin + entitiesPerJob, entityCount);
+                AZ::Job* exportJob = AZ::CreateJobFunction(
+                    [&exportRange, begin, end]()
+                    {
+                        exportRange(begin, end);
+                    },
+                    true, jobContext);
+                exportJob->SetDependent(&completion);
+                exportJob->Start();
+            }
+            exportRange(0, AZStd::min(entitiesPerJob, entityCount));
+            completion.StartAndWaitForCompletion();
+        }
+
+        // Report the first failure in entity order, so the result doesn't depend on how the work was split.
+        for (size_t i = 0; i < entityCount; ++i)
+        {
+            if (!exportEntities[i])
+            {
+                return AZ::Failure(AZStd::string::format(
+                    "Entity '%s' %s - export entity failed. Error: %s",
+                    sourceEntities[i]->GetName().c_str(),
+                    sourceEntities[i]->GetId().ToString().c_str(),
+                    errors[i].c_str())
+                );
+            }
+        }
+
+        return AZ::Success();
+    }
+
     bool EditorInfoRemover::ReadComponentAttribute(
         AZ::Component* component,
         AZ::Edit::Attribute* attribute,
@@ -528,20 +619,10 @@ exportComponent, prefabProcessorContext);
         SetEditorOnlyEntityHandlerFromCandidates(sourceEntities);
 
         // export entities.
-        for (AZ::Entity* entity : sourceEntities)
+        auto exportResult = ExportEntities(sourceEntities, prefabProcessorContext, exportEntitiesOwner);
+        if (!exportResult)
         {
-            auto result = ExportEntity(entity, prefabProcessorContext);
-            if (!result)
-            {
-                return AZ::Failure(AZStd::string::format(
-                    "Entity '%s' %s - export entity failed. Error: %s",
-                    entity->GetName().c_str(),
-                    entity->GetId().ToString().c_str(),
-                    result.GetError().c_str())
-                );
-            }
-
-            exportEntitiesOwner.emplace_back(result.TakeValue());
+            return exportResult;
         }
 
         const auto nonOwningEntityView = exportEntitiesOwner | AZStd::views::transform([](const auto& entity) { return entity.get(); });
@@ -48,6 +48,10 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
             AZ::SerializeContext* serializeContext,
             PrefabProcessorContext& prefabProcessorContext);
 
+        //! Exports the entities of a prefab on several job threads. This requires the BuildGameEntity and runtime export
+        //! callbacks of all components to be safe to call for different entities at the same time.
+        void SetExportEntitiesInParallel(bool exportEntitiesInParallel);
+
         static void Reflect(AZ::ReflectContext* context);
 
      protected:
@@ -72,6 +76,12 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         using ExportEntityResult = AZ::Outcome<AZStd::unique_ptr<AZ::Entity>, AZStd::string>;
         ExportEntityResult ExportEntity(AZ::Entity* sourceEntity, PrefabProcessorContext& context);
 
+        using ExportEntitiesResult = AZ::Outcome<void, AZStd::string>;
+        ExportEntitiesResult ExportEntities(
+            const EntityList& sourceEntities,
+            PrefabProcessorContext& context,
+            AZStd::vector<AZStd::unique_ptr<AZ::Entity>>& exportEntities);
+
         using ResolveExportedComponentResult = AZ::Outcome<AZ::ExportedComponent, AZStd::string>;
         ResolveExportedComponentResult ResolveExportedComponent(
             AZ::ExportedComponent& component, PrefabProcessorContext& prefabProcessorContext);
@@ -102,5 +112,6 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
             aznew UiEditorOnlyEntityHandler() };
         ComponentRequirementsValidator m_componentRequirementsValidator;
         EntityIdSet m_editorOnlyEntityIds;
+        bool m_exportEntitiesInParallel{ false };
     };
 } // namespace AzToolsFramework::Prefab::PrefabConversionUtils
@@ -113,8 +113,7 @@ namespace AzToolsFramework
 
             //generate undo/redo patches
             const AZStd::string& entityAliasPath = m_instanceToTemplateInterface->GenerateEntityAliasPath(entityId);
-            PrefabUndoUtils::GenerateAndAppendPatch(m_redoPatch, initialState, endState, entityAliasPath);
-            PrefabUndoUtils::GenerateAndAppendPatch(m_undoPatch, endState, initialState, entityAliasPath);
+            PrefabUndoUtils::GenerateAndAppendPatchAndInverse(m_redoPatch, m_undoPatch, initialState, endState, entityAliasPath);
 
             // Preemptively updates the cached DOM to prevent reloading instance DOM.
             if (updateCache)
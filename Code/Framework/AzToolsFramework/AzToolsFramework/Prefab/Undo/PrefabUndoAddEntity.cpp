@@ -63,10 +63,9 @@ namespace AzToolsFramework
                 }
                 else
                 {
-                    PrefabUndoUtils::GenerateAndAppendPatch(
-                        m_redoPatch, parentEntityDomBeforeAddingEntity, parentEntityDomAfterAddingEntity, parentEntityAliasPath);
-                    PrefabUndoUtils::GenerateAndAppendPatch(
-                        m_undoPatch, parentEntityDomAfterAddingEntity, parentEntityDomBeforeAddingEntity, parentEntityAliasPath);
+                    PrefabUndoUtils::GenerateAndAppendPatchAndInverse(
+                        m_redoPatch, m_undoPatch, parentEntityDomBeforeAddingEntity, parentEntityDomAfterAddingEntity,
+                        parentEntityAliasPath);
                 }
             }
             else
@@ -85,10 +84,9 @@ namespace AzToolsFramework
                     }
                     else
                     {
-                        PrefabUndoUtils::GenerateAndAppendPatch(
-                            m_redoPatch, *parentEntityDomInFocusedTemplate, parentEntityDomAfterAddingEntity, parentEntityAliasPath);
-                        PrefabUndoUtils::GenerateAndAppendPatch(
-                            m_undoPatch, parentEntityDomAfterAddingEntity, *parentEntityDomInFocusedTemplate, parentEntityAliasPath);
+                        PrefabUndoUtils::GenerateAndAppendPatchAndInverse(
+                            m_redoPatch, m_undoPatch, *parentEntityDomInFocusedTemplate, parentEntityDomAfterAddingEntity,
+                            parentEntityAliasPath);
                     }
                 }
             }
@@ -89,10 +89,9 @@ namespace AzToolsFramework
                         continue;
                     }
 
-                    PrefabUndoUtils::GenerateAndAppendPatch(
-                        m_redoPatch, parentEntityDomBeforeRemoving, parentEntityDomAfterRemovingChildren, parentEntityAliasPath);
-                    PrefabUndoUtils::GenerateAndAppendPatch(
-                        m_undoPatch, parentEntityDomAfterRemovingChildren, parentEntityDomBeforeRemoving, parentEntityAliasPath);
+                    PrefabUndoUtils::GenerateAndAppendPatchAndInverse(
+                        m_redoPatch, m_undoPatch, parentEntityDomBeforeRemoving, parentEntityDomAfterRemovingChildren,
+                        parentEntityAliasPath);
                 }
                 else
                 {
@@ -111,10 +110,9 @@ namespace AzToolsFramework
                             continue;
                         }
 
-                        PrefabUndoUtils::GenerateAndAppendPatch(
-                            m_redoPatch, *parentEntityDomInFocusedTemplate, parentEntityDomAfterRemovingChildren, parentEntityAliasPath);
-                        PrefabUndoUtils::GenerateAndAppendPatch(
-                            m_undoPatch, parentEntityDomAfterRemovingChildren, *parentEntityDomInFocusedTemplate, parentEntityAliasPath);
+                        PrefabUndoUtils::GenerateAndAppendPatchAndInverse(
+                            m_redoPatch, m_undoPatch, *parentEntityDomInFocusedTemplate, parentEntityDomAfterRemovingChildren,
+                            parentEntityAliasPath);
                     }
                 }
 
@@ -16,6 +16,49 @@ namespace AzToolsFramework
     {
         namespace PrefabUndoUtils
         {
+            namespace Internal
+            {
+                //! Builds the patches that revert the given patches, which were created by comparing from domValueBeforeUpdate.
+                //! Created patches only replace values that exist on both sides, add members and trailing array entries, or remove
+                //! them. So walking them backwards and looking up the previous values in place restores the original state.
+                bool InvertPatches(PrefabDom& inversePatches, const PrefabDom& patches, const PrefabDomValue& domValueBeforeUpdate)
+                {
+                    for (rapidjson::SizeType index = patches.Size(); index > 0; --index)
+                    {
+                        const PrefabDomValue& patch = patches[index - 1];
+                        auto opIter = patch.FindMember("op");
+                        auto pathIter = patch.FindMember("path");
+                        if (opIter == patch.MemberEnd() || !opIter->value.IsString() ||
+                            pathIter == patch.MemberEnd() || !pathIter->value.IsString())
+                        {
+                            return false;
+                        }
+
+                        const AZStd::string_view op(opIter->value.GetString(), opIter->value.GetStringLength());
+                        const AZStd::string path(pathIter->value.GetString(), pathIter->value.GetStringLength());
+                        if (op == "add")
+                        {
+                            AppendRemovePatch(inversePatches, path);
+                        }
+                        else if (op == "replace" || op == "remove")
+                        {
+                            const PrefabDomValue* valueBeforeUpdate = PrefabDomPath(path.c_str()).Get(domValueBeforeUpdate);
+                            if (!valueBeforeUpdate)
+                            {
+                                return false;
+                            }
+                            AppendUpdateValuePatch(
+                                inversePatches, *valueBeforeUpdate, path, op == "replace" ? PatchType::Edit : PatchType::Add);
+                        }
+                        else
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+            } // namespace Internal
+
             void AppendAddEntityPatch(
                 PrefabDom& patches,
                 const PrefabDomValue& newEntityDom,
@@ -91,6 +134,46 @@ namespace AzToolsFramework
                 }
             }
 
+            void GenerateAndAppendPatchAndInverse(
+                PrefabDom& patches,
+                PrefabDom& inversePatches,
+                const PrefabDomValue& domValueBeforeUpdate,
+                const PrefabDomValue& domValueAfterUpdate,
+                const AZStd::string& pathToValue)
+            {
+                AZ_Assert(patches.IsArray(), "GenerateAndAppendPatchAndInverse - Provided patches should be an array object DOM value.");
+                AZ_Assert(inversePatches.IsArray(),
+                    "GenerateAndAppendPatchAndInverse - Provided inverse patches should be an array object DOM value.");
+
+                auto instanceToTemplateInterface = AZ::Interface<InstanceToTemplateInterface>::Get();
+                AZ_Assert(instanceToTemplateInterface, "GenerateAndAppendPatchAndInverse - Could not get InstanceToTemplateInterface.");
+
+                PrefabDom newPatches(&(patches.GetAllocator()));
+                instanceToTemplateInterface->GeneratePatch(newPatches, domValueBeforeUpdate, domValueAfterUpdate);
+
+                PrefabDom newInversePatches(&(inversePatches.GetAllocator()));
+                newInversePatches.SetArray();
+                if (!Internal::InvertPatches(newInversePatches, newPatches, domValueBeforeUpdate))
+                {
+                    AZ_Warning("Prefab", false, "GenerateAndAppendPatchAndInverse - "
+                        "Could not invert the generated patches. Comparing the DOM states again instead.");
+                    newInversePatches.SetArray();
+                    instanceToTemplateInterface->GeneratePatch(newInversePatches, domValueAfterUpdate, domValueBeforeUpdate);
+                }
+
+                instanceToTemplateInterface->PrependPathToPatchPaths(newPatches, pathToValue);
+                instanceToTemplateInterface->PrependPathToPatchPaths(newInversePatches, pathToValue);
+
+                for (auto& newPatch : newPatches.GetArray())
+                {
+                    patches.PushBack(newPatch.Move(), patches.GetAllocator());
+                }
+                for (auto& newInversePatch : newInversePatches.GetArray())
+                {
+                    inversePatches.PushBack(newInversePatch.Move(), inversePatches.GetAllocator());
+                }
+            }
+
             void UpdateEntityInPrefabDom(
                 PrefabDomReference prefabDom, const PrefabDomValue& entityDom, const AZStd::string& entityAliasPath)
             {
@@ -57,6 +57,21 @@ namespace AzToolsFramework
                 const PrefabDomValue& domValueAfterUpdate,
                 const AZStd::string& pathToValue);
 
+            //! Create patches by comparing DOM states before and after update, and append them to a patch array.
+            //! The inverse patches are built from the created patches and the state before update, and appended to another array.
+            //! This is cheaper than comparing the DOM states a second time in the other direction.
+            //! @param patches An array object of DOM values which stores redo patches.
+            //! @param inversePatches An array object of DOM values which stores undo patches.
+            //! @param domValueBeforeUpdate The DOM presenting state of the value before update.
+            //! @param domValueAfterUpdate The DOM presenting state of the value after update.
+            //! @param pathToValue The given path to the value.
+            void GenerateAndAppendPatchAndInverse(
+                PrefabDom& patches,
+                PrefabDom& inversePatches,
+                const PrefabDomValue& domValueBeforeUpdate,
+                const PrefabDomValue& domValueAfterUpdate,
+                const AZStd::string& pathToValue);
+
             //! Update the entity in prefab DOM with the provided entity DOM.
             //! @param prefabDom The given prefab DOM.
             //! @param entityDom The entity DOM that will be put in the prefab DOM.
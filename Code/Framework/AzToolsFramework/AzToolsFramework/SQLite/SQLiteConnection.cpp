@@ -111,6 +111,7 @@ namespace AzToolsFramework
                 FinalizeAll();
                 sqlite3_close(m_db);
                 m_db = NULL;
+                m_transactionDepth = 0;
             }
         }
 
@@ -221,7 +222,15 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                sqlite3_exec(m_db, AZStd::string::format("SAVEPOINT NestedTransaction%d;", m_transactionDepth).c_str(), NULL, NULL, NULL);
+            }
+            ++m_transactionDepth;
         }
 
         void Connection::CommitTransaction()
@@ -231,7 +240,16 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            AZ_Assert(m_transactionDepth > 0, "CommitTransaction:  No transaction is open!");
+            m_transactionDepth = AZStd::max(m_transactionDepth - 1, 0);
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                sqlite3_exec(m_db, AZStd::string::format("RELEASE NestedTransaction%d;", m_transactionDepth).c_str(), NULL, NULL, NULL);
+            }
         }
 
         void Connection::RollbackTransaction()
@@ -241,7 +259,20 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            AZ_Assert(m_transactionDepth > 0, "RollbackTransaction:  No transaction is open!");
+            m_transactionDepth = AZStd::max(m_transactionDepth - 1, 0);
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            }
+            else
+            {
+                // Rolling back to a savepoint keeps it open, so it still needs to be released afterwards.
+                sqlite3_exec(
+                    m_db,
+                    AZStd::string::format("ROLLBACK TO NestedTransaction%d; RELEASE NestedTransaction%d;", m_transactionDepth, m_transactionDepth).c_str(),
+                    NULL, NULL, NULL);
+            }
         }
 
         void Connection::Vacuum()
@@ -54,6 +54,8 @@ namespace AzToolsFramework
             bool IsOpen() const;
 
             // ----- Transaction support -----
+            //! Transactions can be nested. Nested ones become savepoints of the outermost transaction,
+            //! so they can be rolled back on their own and only commit to disk along with the outermost one.
             void BeginTransaction();
             void CommitTransaction();
             void RollbackTransaction();
@@ -97,6 +99,8 @@ namespace AzToolsFramework
             sqlite3* m_db;
             typedef AZStd::unordered_map< AZStd::string, StatementPrototype* > StatementContainer;
             StatementContainer m_statementPrototypes;
+            //! Number of transactions that are currently open, including the outermost one
+            int m_transactionDepth = 0;
         };
 
         AZStd::string GetColumnText(sqlite3_stmt* statement, int col);
@@ -10,6 +10,7 @@
 #include <QCheckBox>
 #include <QDialog>
 #include <QLineEdit>
+#include <QScrollBar>
 #include <QSignalBlocker>
 #include <QTimer>
 #include <QVBoxLayout>
@@ -527,6 +528,7 @@ namespace AzToolsFramework
         }
         ClearAttributes();
         m_domOrderedChildren.clear();
+        m_hasDeferredChildRows = false;
         m_columnLayout->Clear();
     }
 
@@ -566,7 +568,19 @@ namespace AzToolsFramework
 
         if (childType == AZ::Dpe::GetNodeName<AZ::Dpe::Nodes::Row>())
         {
-            if (IsExpanded())
+            if (!IsExpanded())
+            {
+                // this row isn't expanded, don't create any row children, just log that there's a null widget at
+                // the given DOM index
+                AddRowChild(nullptr, domIndex);
+            }
+            else if (!GetDPE()->ConsumeRowRealizationBudget())
+            {
+                // the row may not be visible yet, leave a placeholder that is instantiated once it scrolls into view
+                AddRowChild(nullptr, domIndex);
+                m_hasDeferredChildRows = true;
+            }
+            else
             {
                 // create and add the row child to m_domOrderedChildren
                 auto newRow = DocumentPropertyEditor::GetRowPool()->GetInstance();
@@ -576,12 +590,6 @@ namespace AzToolsFramework
                 // if it's a row, recursively populate the children from the DOM array in the passed value
                 newRow->SetValueFromDom(childValue);
             }
-            else
-            {
-                // this row isn't expanded, don't create any row children, just log that there's a null widget at
-                // the given DOM index
-                AddRowChild(nullptr, domIndex);
-            }
         }
         else // not a row, so it's a column widget
         {
@@ -657,10 +665,11 @@ namespace AzToolsFramework
 
         // check if the last row widget child was removed, and hide the expander if necessary
         const bool expanded = IsExpanded();
-        auto isDPERow = [expanded](auto* widget)
+        const bool hasDeferredChildRows = m_hasDeferredChildRows;
+        auto isDPERow = [expanded, hasDeferredChildRows](auto* widget)
         {
-            // when not expanded, null children are just unseen child rows
-            return ((!widget && !expanded) || qobject_cast<DPERowWidget*>(widget) != nullptr);
+            // when not expanded, null children are just unseen child rows, the same goes for deferred child rows
+            return ((!widget && (!expanded || hasDeferredChildRows)) || qobject_cast<DPERowWidget*>(widget) != nullptr);
         };
         if (AZStd::find_if(m_domOrderedChildren.begin(), m_domOrderedChildren.end(), isDPERow) == m_domOrderedChildren.end())
         {
@@ -892,7 +901,9 @@ namespace AzToolsFramework
                     // check if the parent row exists but isn't expanded
                     if (sourceParentRow)
                     {
-                        AZ_Assert(!sourceParentRow->IsExpanded(), "row should only have null children if it's not expanded!");
+                        AZ_Assert(
+                            !sourceParentRow->IsExpanded() || sourceParentRow->m_hasDeferredChildRows,
+                            "row should only have null children if it's not expanded or its child rows are deferred!");
                         sourceParentRow->RemoveChildAt(sourceIndex);
                     }
                     // source is missing, but destination exists. Look up the value and treat it as an add at that location
@@ -980,7 +991,12 @@ namespace AzToolsFramework
                     }
                     const auto valueAtSubPath = theDPE->GetAdapter()->GetContents()[subPath];
 
-                    if (!childWidget)
+                    if (!childWidget && valueAtSubPath.IsNode() && valueAtSubPath.GetNodeName() == AZ::Dpe::GetNodeName<AZ::Dpe::Nodes::Row>())
+                    {
+                        // deferred or collapsed row, it will be instantiated from the current DOM contents when it's shown
+                        return;
+                    }
+                    else if (!childWidget)
                     {
                         // if there's a null entry in the current place for m_domOrderedChildren,
                         // that's ok if this entry isn't expanded to that depth and need not follow the change any further
@@ -1261,6 +1277,8 @@ namespace AzToolsFramework
                 }
             }
 
+            // instantiate the newly revealed rows that are visible while a recursive expansion is still flagged
+            dpe->RealizeVisibleRows();
             dpe->SetRecursiveExpansionOngoing(false);
         }
 
@@ -1277,6 +1295,55 @@ namespace AzToolsFramework
         return m_depth;
     }
 
+    bool DPERowWidget::RealizeDeferredChildRows(int visibleBottom, const AZStd::unordered_map<const QWidget*, int>& layoutBottoms)
+    {
+        if (!IsExpanded())
+        {
+            // collapsed rows instantiate their children when they're expanded
+            return false;
+        }
+
+        bool realizedRows = false;
+        if (m_hasDeferredChildRows)
+        {
+            DocumentPropertyEditor* dpe = GetDPE();
+            const auto rowValue = dpe->GetDomValueForRow(this);
+            m_hasDeferredChildRows = false;
+            for (size_t childIndex = 0; childIndex < m_domOrderedChildren.size(); ++childIndex)
+            {
+                if (m_domOrderedChildren[childIndex] || childIndex >= rowValue.ArraySize() || !rowValue[childIndex].IsNode() ||
+                    rowValue[childIndex].GetNodeName() != AZ::Dpe::GetNodeName<AZ::Dpe::Nodes::Row>())
+                {
+                    continue;
+                }
+
+                // a deferred row would be shown right after the prior row in the layout; rows created earlier in
+                // this pass aren't measured yet, which is fine since the pass budget bounds how many are created
+                auto priorRowBottom = layoutBottoms.find(GetPriorRowInLayout(childIndex));
+                const int placeholderTop = (priorRowBottom != layoutBottoms.end() ? priorRowBottom->second : 0);
+                if (placeholderTop > visibleBottom || dpe->m_rowRealizationBudget <= 0)
+                {
+                    // everything after this placeholder is further down the layout, leave it for a later pass
+                    m_hasDeferredChildRows = true;
+                    break;
+                }
+
+                m_domOrderedChildren.erase(m_domOrderedChildren.begin() + childIndex);
+                AddChildFromDomValue(rowValue[childIndex], childIndex);
+                realizedRows = true;
+            }
+        }
+
+        for (QWidget* childWidget : m_domOrderedChildren)
+        {
+            if (auto* childRow = qobject_cast<DPERowWidget*>(childWidget))
+            {
+                realizedRows = childRow->RealizeDeferredChildRows(visibleBottom, layoutBottoms) || realizedRows;
+            }
+        }
+        return realizedRows;
+    }
+
     DocumentPropertyEditor::DocumentPropertyEditor(QWidget* parentWidget)
         : QScrollArea(parentWidget)
     {
@@ -1289,6 +1356,16 @@ namespace AzToolsFramework
 
         setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
 
+        // rows are instantiated as they scroll into view
+        connect(
+            verticalScrollBar(),
+            &QScrollBar::valueChanged,
+            this,
+            [this]()
+            {
+                RealizeVisibleRows();
+            });
+
         // register as a co-owner of the recycled widgets lists if they exist; create if not
         auto poolManager = static_cast<AZ::InstancePoolManager*>(AZ::Interface<AZ::InstancePoolManagerInterface>::Get());
         if (m_rowPool = poolManager->GetPool<DPERowWidget>(); !m_rowPool)
@@ -1450,9 +1527,11 @@ namespace AzToolsFramework
     {
         for (auto child : m_rootNode->m_domOrderedChildren)
         {
-            // all direct children of the root are rows
-            auto row = static_cast<DPERowWidget*>(child);
-            row->SetExpanded(true, true);
+            // all direct children of the root are rows, null entries are rows that haven't been instantiated yet
+            if (auto row = static_cast<DPERowWidget*>(child))
+            {
+                row->SetExpanded(true, true);
+            }
         }
     }
 
@@ -1460,9 +1539,11 @@ namespace AzToolsFramework
     {
         for (auto child : m_rootNode->m_domOrderedChildren)
         {
-            // all direct children of the root are rows
-            auto row = static_cast<DPERowWidget*>(child);
-            row->SetExpanded(false, true);
+            // all direct children of the root are rows, null entries are rows that haven't been instantiated yet
+            if (auto row = static_cast<DPERowWidget*>(child))
+            {
+                row->SetExpanded(false, true);
+            }
         }
     }
 
@@ -1562,6 +1643,60 @@ namespace AzToolsFramework
         m_isRecursiveExpansionOngoing = isExpanding;
     }
 
+    bool DocumentPropertyEditor::ConsumeRowRealizationBudget()
+    {
+        if (m_rowRealizationBudget > 0)
+        {
+            --m_rowRealizationBudget;
+            return true;
+        }
+        return false;
+    }
+
+    void DocumentPropertyEditor::RealizeVisibleRows()
+    {
+        if (m_isRealizingRows || !m_rootNode || !m_adapter)
+        {
+            return;
+        }
+        m_isRealizingRows = true;
+
+        // keep one extra page instantiated below the viewport so scrolling doesn't reveal empty space
+        const int visibleBottom = verticalScrollBar()->value() + 2 * viewport()->height();
+
+        bool realizedRows = true;
+        while (realizedRows)
+        {
+            // the layout hasn't necessarily been activated for new rows yet, so compute where each row ends from the size hints
+            AZStd::unordered_map<const QWidget*, int> layoutBottoms;
+            const int spacing = m_layout->spacing();
+            int currentBottom = m_layout->contentsMargins().top();
+            for (int layoutIndex = 0, itemCount = m_layout->count(); layoutIndex < itemCount; ++layoutIndex)
+            {
+                QWidget* layoutWidget = m_layout->itemAt(layoutIndex)->widget();
+                if (layoutWidget && !layoutWidget->isHidden())
+                {
+                    currentBottom += layoutWidget->sizeHint().height();
+                    layoutBottoms[layoutWidget] = currentBottom;
+                    currentBottom += spacing;
+                }
+            }
+
+            m_rowRealizationBudget = RowRealizationBatchSize;
+            realizedRows = m_rootNode->RealizeDeferredChildRows(visibleBottom, layoutBottoms);
+        }
+
+        // outside of a realization pass, new rows are always deferred until the next pass places them
+        m_rowRealizationBudget = 0;
+        m_isRealizingRows = false;
+    }
+
+    void DocumentPropertyEditor::resizeEvent(QResizeEvent* event)
+    {
+        QScrollArea::resizeEvent(event);
+        RealizeVisibleRows();
+    }
+
     void DocumentPropertyEditor::HandleReset()
     {
         // clear any pre-existing DPERowWidgets
@@ -1588,6 +1723,7 @@ namespace AzToolsFramework
             }
         }
         m_layout->addStretch();
+        RealizeVisibleRows();
     }
 
     void DocumentPropertyEditor::HandleDomChange(const AZ::Dom::Patch& patch)
@@ -1596,6 +1732,9 @@ namespace AzToolsFramework
         {
             m_rootNode->HandleOperationAtPath(*operationIterator, 0);
         }
+
+        // rows added or replaced by the patch are deferred, only the ones in the visible window get instantiated
+        RealizeVisibleRows();
     }
 
     void DocumentPropertyEditor::HandleDomMessage(
@@ -125,6 +125,10 @@ namespace AzToolsFramework
         bool HasChildRows() const;
         int GetLevel() const;
 
+        //! instantiates deferred child rows (recursively) whose place in the layout lies above visibleBottom
+        //! returns true if any row was created
+        bool RealizeDeferredChildRows(int visibleBottom, const AZStd::unordered_map<const QWidget*, int>& layoutBottoms);
+
     protected slots:
         void onExpanderChanged(int expanderState);
 
@@ -162,6 +166,10 @@ namespace AzToolsFramework
         AZStd::unordered_map<size_t, AttributeInfo> m_childIndexToAttributeInfo;
         AttributeInfo* GetAttributes(size_t domIndex);
 
+        //! true if this row is expanded but some of its child rows are null placeholders that haven't been
+        //! instantiated yet because they weren't in the visible part of the DPE, see DocumentPropertyEditor::RealizeVisibleRows
+        bool m_hasDeferredChildRows = false;
+
         // row attributes extracted from the DOM
         AZStd::optional<bool> m_forceAutoExpand;
         AZStd::optional<bool> m_expandByDefault;
@@ -219,6 +227,11 @@ namespace AzToolsFramework
         bool IsRecursiveExpansionOngoing() const;
         void SetRecursiveExpansionOngoing(bool isExpanding);
 
+        //! returns true if a new row may be instantiated now, otherwise the row is left as a deferred placeholder
+        bool ConsumeRowRealizationBudget();
+        //! instantiates the deferred rows that are within (or just below) the visible part of the scroll area
+        void RealizeVisibleRows();
+
         // shared pools of recycled widgets
         static auto GetRowPool()
         {
@@ -251,6 +264,9 @@ namespace AzToolsFramework
         void Clear();
 
     protected:
+        // QScrollArea overrides
+        void resizeEvent(QResizeEvent* event) override;
+
         QVBoxLayout* GetVerticalLayout();
         QWidget* GetWidgetAtPath(const AZ::Dom::Path& path);
 
@@ -269,6 +285,12 @@ namespace AzToolsFramework
         bool m_isRecursiveExpansionOngoing = false;
         bool m_spawnDebugView = false;
 
+        // Rows are only instantiated when they scroll into view, so large component lists and containers don't create
+        // thousands of widgets up front. Rows are created in batches of RowRealizationBatchSize per layout pass.
+        static constexpr int RowRealizationBatchSize = 32;
+        int m_rowRealizationBudget = 0; //!< number of rows that may still be instantiated in the current pass
+        bool m_isRealizingRows = false;
+
         DPERowWidget* m_rootNode = nullptr;
 
         // keep pools of frequently used widgets that can be recycled for efficiency without
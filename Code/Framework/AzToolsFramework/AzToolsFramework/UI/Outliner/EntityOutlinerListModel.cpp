@@ -24,6 +24,13 @@
 #include <QStyleOptionButton>
 #include <QTimer>
 #include <QTextDocument>
+#include <QFutureWatcher>
+AZ_PUSH_DISABLE_WARNING(4127 4251 4800 4244, "-Wunknown-warning-option") // 4127: conditional expression is constant
+                                                                         // 4251: class needs to have dll-interface to be used by clients
+                                                                         // 4800: forcing value to bool 'true' or 'false' (performance warning)
+                                                                         // 4244: conversion from 'int' to 'qint8', possible loss of data
+#include <QtConcurrent/QtConcurrent>
+AZ_POP_DISABLE_WARNING
 
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetManagerBus.h>
@@ -35,6 +42,7 @@
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/sort.h>
 
 #include <AzFramework/StringFunc/StringFunc.h>
 
@@ -102,10 +110,12 @@ namespace AzToolsFramework
         EntityCompositionNotificationBus::Handler::BusDisconnect();
         AZ::EntitySystemBus::Handler::BusDisconnect();
         EditorEntityRuntimeActivationChangeNotificationBus::Handler::BusDisconnect();
+        Prefab::PrefabPublicNotificationBus::Handler::BusDisconnect();
     }
 
     void EntityOutlinerListModel::Initialize()
     {
+        Prefab::PrefabPublicNotificationBus::Handler::BusConnect();
         EditorEntityRuntimeActivationChangeNotificationBus::Handler::BusConnect();
         ToolsApplicationEvents::Bus::Handler::BusConnect();
         EditorEntityContextNotificationBus::Handler::BusConnect();
@@ -139,11 +149,117 @@ namespace AzToolsFramework
 
         auto parentId = GetEntityFromIndex(parent);
 
+        // Children of parents the view never expanded aren't part of the model yet, see fetchMore
+        if (!IsPopulated(parentId))
+        {
+            return 0;
+        }
+
         AZStd::size_t childCount = 0;
         EditorEntityInfoRequestBus::EventResult(childCount, parentId, &EditorEntityInfoRequestBus::Events::GetChildCount);
         return (int)childCount;
     }
 
+    bool EntityOutlinerListModel::hasChildren(const QModelIndex& parent) const
+    {
+        if (parent.isValid() && parent.column() != 0)
+        {
+            return false;
+        }
+
+        AZStd::size_t childCount = 0;
+        EditorEntityInfoRequestBus::EventResult(
+            childCount, GetEntityFromIndex(parent), &EditorEntityInfoRequestBus::Events::GetChildCount);
+        return childCount > 0;
+    }
+
+    bool EntityOutlinerListModel::canFetchMore(const QModelIndex& parent) const
+    {
+        if (parent.isValid() && parent.column() != 0)
+        {
+            return false;
+        }
+
+        return !IsPopulated(GetEntityFromIndex(parent)) && hasChildren(parent);
+    }
+
+    void EntityOutlinerListModel::fetchMore(const QModelIndex& parent)
+    {
+        AZ_PROFILE_FUNCTION(AzToolsFramework);
+
+        const AZ::EntityId parentId = GetEntityFromIndex(parent);
+        if ((parent.isValid() && parent.column() != 0) || IsPopulated(parentId) || m_propagationResetInProgress)
+        {
+            return;
+        }
+
+        EntityIdList children;
+        EditorEntityInfoRequestBus::EventResult(children, parentId, &EditorEntityInfoRequestBus::Events::GetChildren);
+        if (children.empty())
+        {
+            m_populatedEntities.insert(parentId);
+            return;
+        }
+
+        beginInsertRows(parent, 0, aznumeric_cast<int>(children.size()) - 1);
+        m_populatedEntities.insert(parentId);
+        endInsertRows();
+
+        // The view only learns about selection and expansion of the new rows through the update queue
+        for (const AZ::EntityId& childId : children)
+        {
+            if (IsSelected(childId))
+            {
+                m_entitySelectQueue.insert(childId);
+                QueueEntityUpdate(childId);
+            }
+            else if (IsExpanded(childId))
+            {
+                QueueEntityUpdate(childId);
+            }
+        }
+    }
+
+    bool EntityOutlinerListModel::IsPopulated(const AZ::EntityId& entityId) const
+    {
+        return !entityId.IsValid() || m_populatedEntities.contains(entityId);
+    }
+
+    void EntityOutlinerListModel::PopulateAncestors(const AZ::EntityId& entityId)
+    {
+        EntityIdList ancestors;
+        AZ::EntityId parentId;
+        EditorEntityInfoRequestBus::EventResult(parentId, entityId, &EditorEntityInfoRequestBus::Events::GetParent);
+        for (AZ::EntityId currentId = parentId; currentId.IsValid() && !IsPopulated(currentId); currentId = parentId)
+        {
+            ancestors.push_back(currentId);
+            parentId.SetInvalid();
+            EditorEntityInfoRequestBus::EventResult(parentId, currentId, &EditorEntityInfoRequestBus::Events::GetParent);
+        }
+
+        // populate from the top down so each ancestor already has a row when its children are added
+        for (auto ancestorIt = ancestors.rbegin(); ancestorIt != ancestors.rend(); ++ancestorIt)
+        {
+            fetchMore(GetIndexFromEntity(*ancestorIt));
+        }
+    }
+
+    void EntityOutlinerListModel::ClearPopulatedDescendants(const AZ::EntityId& entityId)
+    {
+        // an entity can only be populated if its parent is, so the walk can stop at the first unpopulated entity
+        if (m_populatedEntities.erase(entityId) == 0)
+        {
+            return;
+        }
+
+        EntityIdList children;
+        EditorEntityInfoRequestBus::EventResult(children, entityId, &EditorEntityInfoRequestBus::Events::GetChildren);
+        for (const AZ::EntityId& childId : children)
+        {
+            ClearPopulatedDescendants(childId);
+        }
+    }
+
     int EntityOutlinerListModel::columnCount(const QModelIndex& /*parent*/) const
     {
         return ColumnCount;
@@ -1160,7 +1276,13 @@ namespace AzToolsFramework
             AZ_PROFILE_SCOPE(Editor, "EntityOutlinerListModel::ProcessEntityUpdates:SelectQueue");
             for (auto entityId : m_entitySelectQueue)
             {
-                emit SelectEntity(entityId, IsSelected(entityId));
+                const bool isSelected = IsSelected(entityId);
+                if (isSelected)
+                {
+                    // the entity needs a row for the view to select it
+                    PopulateAncestors(entityId);
+                }
+                emit SelectEntity(entityId, isSelected);
             };
             m_entitySelectQueue.clear();
         }
@@ -1169,16 +1291,58 @@ namespace AzToolsFramework
         {
             AZ_PROFILE_SCOPE(Editor, "EntityOutlinerListModel::ProcessEntityUpdates:ChangeQueue");
 
+            // Group the changed entities by parent so each run of adjacent rows is notified with a single dataChanged.
+            // Entities below parents that were never populated have no rows to update.
+            AZStd::unordered_map<AZ::EntityId, AZStd::vector<AZStd::pair<int, AZ::EntityId>>> changedRowsByParent;
             for (auto entityId : m_entityChangeQueue)
             {
-                if (const QModelIndex beginIndex = GetIndexFromEntity(entityId, ColumnName); beginIndex.isValid())
+                if (!entityId.IsValid())
                 {
-                    const QModelIndex endIndex = createIndex(beginIndex.row(), VisibleColumnCount - 1, beginIndex.internalId());
-                    emit dataChanged(beginIndex, endIndex);
+                    continue;
+                }
+
+                AZ::EntityId parentId;
+                EditorEntityInfoRequestBus::EventResult(parentId, entityId, &EditorEntityInfoRequestBus::Events::GetParent);
+                if (IsPopulated(parentId))
+                {
+                    AZStd::size_t row = 0;
+                    EditorEntityInfoRequestBus::EventResult(row, parentId, &EditorEntityInfoRequestBus::Events::GetChildIndex, entityId);
+                    changedRowsByParent[parentId].emplace_back(static_cast<int>(row), entityId);
                 }
             }
-        
+
+            AZStd::vector<ModelIndexRange> changedRanges;
+            for (auto& [parentId, changedRows] : changedRowsByParent)
+            {
+                AZStd::size_t childCount = 0;
+                EditorEntityInfoRequestBus::EventResult(childCount, parentId, &EditorEntityInfoRequestBus::Events::GetChildCount);
+
+                AZStd::sort(changedRows.begin(), changedRows.end());
+                for (size_t first = 0; first < changedRows.size();)
+                {
+                    size_t last = first;
+                    while (last + 1 < changedRows.size() && changedRows[last + 1].first == changedRows[last].first + 1)
+                    {
+                        ++last;
+                    }
+
+                    if (static_cast<AZStd::size_t>(changedRows[last].first) < childCount)
+                    {
+                        changedRanges.push_back(
+                            { createIndex(changedRows[first].first, ColumnName, static_cast<AZ::u64>(changedRows[first].second)),
+                              createIndex(
+                                  changedRows[last].first, VisibleColumnCount - 1, static_cast<AZ::u64>(changedRows[last].second)) });
+                    }
+                    first = last + 1;
+                }
+            }
+
             m_entityChangeQueue.clear();
+
+            for (const ModelIndexRange& changedRange : changedRanges)
+            {
+                emit dataChanged(changedRange.m_start, changedRange.m_end);
+            }
         }
 
         {
@@ -1203,16 +1367,72 @@ namespace AzToolsFramework
     void EntityOutlinerListModel::OnEntityInfoResetBegin()
     {
         emit EnableSelectionUpdates(false);
-        beginResetModel();
+        if (!m_propagationResetInProgress)
+        {
+            beginResetModel();
+            m_populatedEntities.clear();
+        }
+        m_filterSnapshot.reset();
     }
 
     void EntityOutlinerListModel::OnEntityInfoResetEnd()
     {
         m_layoutResetQueued = true;
-        endResetModel();
+        if (!m_propagationResetInProgress)
+        {
+            endResetModel();
+        }
         QTimer::singleShot(0, this, &EntityOutlinerListModel::ProcessEntityInfoResetEnd);
     }
 
+    void EntityOutlinerListModel::OnPrefabInstancePropagationBegin()
+    {
+        m_prefabPropagationInProgress = true;
+        m_propagationStructuralChangeCount = 0;
+    }
+
+    void EntityOutlinerListModel::OnPrefabInstancePropagationEnd()
+    {
+        m_prefabPropagationInProgress = false;
+        if (!m_propagationResetInProgress)
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AzToolsFramework);
+        m_propagationResetInProgress = false;
+        endResetModel();
+
+        // the view collapsed everything, refreshing the top level rows lets it restore the expansion state from the model
+        EntityIdList children;
+        EditorEntityInfoRequestBus::EventResult(children, AZ::EntityId(), &EditorEntityInfoRequestBus::Events::GetChildren);
+        for (const AZ::EntityId& childId : children)
+        {
+            QueueEntityUpdate(childId);
+        }
+        m_isFilterDirty = true;
+    }
+
+    bool EntityOutlinerListModel::BeginStructuralChange(const AZ::EntityId& parentId)
+    {
+        if (m_propagationResetInProgress || !IsPopulated(parentId))
+        {
+            return false;
+        }
+
+        if (m_prefabPropagationInProgress && ++m_propagationStructuralChangeCount > PropagationResetThreshold &&
+            m_structuralChangesInProgress.empty())
+        {
+            AZ_PROFILE_SCOPE(AzToolsFramework, "EntityOutlinerListModel::BeginStructuralChange:Reset");
+            beginResetModel();
+            m_populatedEntities.clear();
+            m_propagationResetInProgress = true;
+            return false;
+        }
+
+        return true;
+    }
+
     void EntityOutlinerListModel::ProcessEntityInfoResetEnd()
     {
         AZ_PROFILE_FUNCTION(AzToolsFramework);
@@ -1228,16 +1448,25 @@ namespace AzToolsFramework
         //add/remove operations trigger selection change signals which assert and break undo/redo operations in progress in inspector etc.
         //so disallow selection updates until change is complete
         emit EnableSelectionUpdates(false);
-        auto parentIndex = GetIndexFromEntity(parentId);
-        auto childIndex = GetIndexFromEntity(childId);
-        beginInsertRows(parentIndex, childIndex.row(), childIndex.row());
+        m_filterSnapshot.reset();
+        if (BeginStructuralChange(parentId))
+        {
+            m_structuralChangesInProgress.insert(childId);
+            auto parentIndex = GetIndexFromEntity(parentId);
+            auto childIndex = GetIndexFromEntity(childId);
+            beginInsertRows(parentIndex, childIndex.row(), childIndex.row());
+        }
     }
 
     void EntityOutlinerListModel::OnEntityInfoUpdatedAddChildEnd(AZ::EntityId parentId, AZ::EntityId childId)
     {
         (void)parentId;
         AZ_PROFILE_FUNCTION(AzToolsFramework);
-        endInsertRows();
+        const bool rowInserted = m_structuralChangesInProgress.erase(childId) > 0;
+        if (rowInserted)
+        {
+            endInsertRows();
+        }
 
         //expand ancestors if a new descendant is already selected
         if ((IsSelected(childId) || HasSelectedDescendant(childId)) && !m_dropOperationInProgress)
@@ -1246,8 +1475,12 @@ namespace AzToolsFramework
         }
 
         //restore selection and expansion state for previously registered entity ids (for the view/model only)
-        RestoreDescendantSelection(childId);
-        RestoreDescendantExpansion(childId);
+        //children of unpopulated parents are restored once they are fetched
+        if (rowInserted)
+        {
+            RestoreDescendantSelection(childId);
+            RestoreDescendantExpansion(childId);
+        }
 
         //must refresh partial lock/visibility of parents
         m_isFilterDirty = true;
@@ -1295,18 +1528,26 @@ namespace AzToolsFramework
         //add/remove operations trigger selection change signals which assert and break undo/redo operations in progress in inspector etc.
         //so disallow selection updates until change is complete
         emit EnableSelectionUpdates(false);
+        m_filterSnapshot.reset();
 
-        auto parentIndex = GetIndexFromEntity(parentId);
-        auto childIndex = GetIndexFromEntity(childId);
-        beginRemoveRows(parentIndex, childIndex.row(), childIndex.row());
+        if (BeginStructuralChange(parentId))
+        {
+            m_structuralChangesInProgress.insert(childId);
+            auto parentIndex = GetIndexFromEntity(parentId);
+            auto childIndex = GetIndexFromEntity(childId);
+            beginRemoveRows(parentIndex, childIndex.row(), childIndex.row());
+        }
+        ClearPopulatedDescendants(childId);
     }
 
     void EntityOutlinerListModel::OnEntityInfoUpdatedRemoveChildEnd(AZ::EntityId parentId, AZ::EntityId childId)
     {
-        (void)childId;
         AZ_PROFILE_FUNCTION(AzToolsFramework);
 
-        endRemoveRows();
+        if (m_structuralChangesInProgress.erase(childId) > 0)
+        {
+            endRemoveRows();
+        }
 
         //must refresh partial lock/visibility of parents
         m_isFilterDirty = true;
@@ -1376,6 +1617,7 @@ namespace AzToolsFramework
     void EntityOutlinerListModel::OnEntityInfoUpdatedName(AZ::EntityId entityId, const AZStd::string& name)
     {
         (void)name;
+        m_filterSnapshot.reset();
         QueueEntityUpdate(entityId);
 
         bool isSelected = false;
@@ -1425,9 +1667,7 @@ namespace AzToolsFramework
         }
 
         m_filterString = filter;
-        InvalidateFilter();
-
-        RestoreSelectionIfAppropriate();
+        ApplyFilter(true);
     }
 
     void EntityOutlinerListModel::SearchFilterChanged(const AZStd::vector<ComponentTypeValue>& componentFilters)
@@ -1439,9 +1679,7 @@ namespace AzToolsFramework
         }
 
         m_componentFilters = AZStd::move(componentFilters);
-        InvalidateFilter();
-
-        RestoreSelectionIfAppropriate();
+        ApplyFilter(true);
     }
 
     bool EntityOutlinerListModel::ShouldOverrideUnfilteredSelection()
@@ -1539,7 +1777,40 @@ namespace AzToolsFramework
 
     void EntityOutlinerListModel::InvalidateFilter()
     {
-        FilterEntity(AZ::EntityId());
+        ApplyFilter(false);
+    }
+
+    void EntityOutlinerListModel::ApplyFilter(bool searchChanged)
+    {
+        AZ_PROFILE_FUNCTION(AzToolsFramework);
+
+        // results of a search that is still running are outdated now
+        m_asyncFilterTask.reset();
+
+        // searches by name only don't need to query any components, so they run on a background thread
+        if (!m_filterString.empty() && m_componentFilters.empty())
+        {
+            StartAsyncFilter(searchChanged);
+            m_isFilterDirty = false;
+            return;
+        }
+
+        if (m_filterString.empty() && m_componentFilters.empty())
+        {
+            // nothing is filtered, only entities that were filtered out need their expansion state restored
+            for (const auto& [entityId, isFiltered] : m_entityFilteredState)
+            {
+                if (isFiltered && IsExpanded(entityId))
+                {
+                    QueueEntityToExpand(entityId, true);
+                }
+            }
+            m_entityFilteredState.clear();
+        }
+        else
+        {
+            FilterEntity(AZ::EntityId());
+        }
 
         // Emit data changed directly as it is immediately valid
         auto modelIndex = GetIndexFromEntity(AZ::EntityId());
@@ -1548,6 +1819,121 @@ namespace AzToolsFramework
             emit dataChanged(modelIndex, modelIndex, { VisibilityRole });
         }
         m_isFilterDirty = false;
+
+        if (searchChanged)
+        {
+            RestoreSelectionIfAppropriate();
+            emit FilterApplied(true);
+        }
+    }
+
+    void EntityOutlinerListModel::BuildFilterSnapshot(const AZ::EntityId& entityId, int parentEntry, FilterSnapshot& snapshot) const
+    {
+        const int entry = aznumeric_cast<int>(snapshot.size());
+        FilterSnapshotEntry& snapshotEntry = snapshot.emplace_back();
+        snapshotEntry.m_entityId = entityId;
+        snapshotEntry.m_parentEntry = parentEntry;
+        EditorEntityInfoRequestBus::EventResult(snapshotEntry.m_name, entityId, &EditorEntityInfoRequestBus::Events::GetName);
+
+        EntityIdList children;
+        EditorEntityInfoRequestBus::EventResult(children, entityId, &EditorEntityInfoRequestBus::Events::GetChildren);
+        for (const AZ::EntityId& childId : children)
+        {
+            BuildFilterSnapshot(childId, entry, snapshot);
+        }
+    }
+
+    void EntityOutlinerListModel::StartAsyncFilter(bool searchChanged)
+    {
+        // the snapshot is kept between searches, so typing in the search box only pays for the string matching
+        if (!m_filterSnapshot)
+        {
+            AZ_PROFILE_SCOPE(AzToolsFramework, "EntityOutlinerListModel::StartAsyncFilter:BuildSnapshot");
+            auto snapshot = AZStd::make_shared<FilterSnapshot>();
+            BuildFilterSnapshot(AZ::EntityId(), -1, *snapshot);
+            m_filterSnapshot = snapshot;
+        }
+
+        auto task = AZStd::make_shared<AsyncFilterTask>();
+        task->m_snapshot = m_filterSnapshot;
+        task->m_filterString = m_filterString;
+        task->m_searchChanged = searchChanged;
+        m_asyncFilterTask = task;
+
+        auto watcher = new QFutureWatcher<void>(this);
+        connect(
+            watcher, &QFutureWatcher<void>::finished, this,
+            [this, watcher, task]()
+            {
+                ApplyAsyncFilterResults(task);
+                watcher->deleteLater();
+            });
+
+        // only the task is touched on the background thread, it owns a copy of everything the search needs
+        watcher->setFuture(QtConcurrent::run(
+            [task]()
+            {
+                const FilterSnapshot& snapshot = *task->m_snapshot;
+                task->m_nameMatches.resize(snapshot.size());
+                for (size_t entry = 0; entry < snapshot.size(); ++entry)
+                {
+                    const FilterSnapshotEntry& snapshotEntry = snapshot[entry];
+                    task->m_nameMatches[entry] =
+                        AzFramework::StringFunc::Find(snapshotEntry.m_name.c_str(), task->m_filterString.c_str()) != AZStd::string::npos ||
+                        AZStd::to_string(static_cast<AZ::u64>(snapshotEntry.m_entityId)) == task->m_filterString;
+                }
+            }));
+    }
+
+    void EntityOutlinerListModel::ApplyAsyncFilterResults(const AZStd::shared_ptr<AsyncFilterTask>& task)
+    {
+        if (task != m_asyncFilterTask)
+        {
+            return;
+        }
+        m_asyncFilterTask.reset();
+
+        AZ_PROFILE_FUNCTION(AzToolsFramework);
+
+        // children follow their parents in the snapshot, walking backwards propagates matches to all ancestors
+        const FilterSnapshot& snapshot = *task->m_snapshot;
+        AZStd::vector<bool> isFilterMatch = task->m_nameMatches;
+        for (size_t entry = snapshot.size(); entry-- > 0;)
+        {
+            if (isFilterMatch[entry] && snapshot[entry].m_parentEntry >= 0)
+            {
+                isFilterMatch[snapshot[entry].m_parentEntry] = true;
+            }
+        }
+
+        for (size_t entry = 0; entry < snapshot.size(); ++entry)
+        {
+            const AZ::EntityId entityId = snapshot[entry].m_entityId;
+            if (task->m_nameMatches[entry])
+            {
+                QueueEntityUpdate(entityId);
+            }
+
+            // Same as FilterEntity, reapply the expanded state of entities that are no longer filtered out
+            bool& isFiltered = m_entityFilteredState[entityId];
+            if (isFilterMatch[entry] && isFiltered && IsExpanded(entityId))
+            {
+                QueueEntityToExpand(entityId, true);
+            }
+            isFiltered = !isFilterMatch[entry];
+        }
+
+        auto modelIndex = GetIndexFromEntity(AZ::EntityId());
+        if (modelIndex.isValid())
+        {
+            emit dataChanged(modelIndex, modelIndex, { VisibilityRole });
+        }
+
+        if (task->m_searchChanged)
+        {
+            RestoreSelectionIfAppropriate();
+        }
+        emit FilterApplied(task->m_searchChanged);
     }
 
     void EntityOutlinerListModel::OnEditorEntityDuplicated(const AZ::EntityId& oldEntity, const AZ::EntityId& newEntity)
@@ -1562,6 +1948,8 @@ namespace AzToolsFramework
         //typically to reveal selected entities, expand all parent entities
         if (entityId.IsValid())
         {
+            PopulateAncestors(entityId);
+
             AZ::EntityId parentId;
             EditorEntityInfoRequestBus::EventResult(parentId, entityId, &EditorEntityInfoRequestBus::Events::GetParent);
             QueueEntityToExpand(parentId, true);
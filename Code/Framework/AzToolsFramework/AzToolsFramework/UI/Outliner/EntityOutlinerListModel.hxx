@@ -14,6 +14,7 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 #include <AzToolsFramework/API/EntityCompositionNotificationBus.h>
 #include <AzToolsFramework/API/ToolsApplicationAPI.h>
@@ -22,6 +23,7 @@
 #include <AzToolsFramework/Entity/EditorEntityInfoBus.h>
 #include <AzToolsFramework/Entity/EditorEntityRuntimeActivationBus.h>
 #include <AzToolsFramework/FocusMode/FocusModeNotificationBus.h>
+#include <AzToolsFramework/Prefab/PrefabPublicNotificationBus.h>
 #include <AzToolsFramework/ToolsComponents/EditorLockComponentBus.h>
 #include <AzToolsFramework/ToolsComponents/EditorVisibilityBus.h>
 #include <AzToolsFramework/UI/Outliner/EntityOutlinerSearchWidget.h>
@@ -59,6 +61,7 @@ namespace AzToolsFramework
         , private EditorEntityRuntimeActivationChangeNotificationBus::Handler
         , private AZ::EntitySystemBus::Handler
         , private ContainerEntityNotificationBus::Handler
+        , private Prefab::PrefabPublicNotificationBus::Handler
     {
         Q_OBJECT;
 
@@ -137,6 +140,9 @@ namespace AzToolsFramework
         bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override;
         QModelIndex index(int row, int column, const QModelIndex& parent = QModelIndex()) const override;
         QModelIndex parent(const QModelIndex& index) const override;
+        bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+        bool canFetchMore(const QModelIndex& parent) const override;
+        void fetchMore(const QModelIndex& parent) override;
         Qt::ItemFlags flags(const QModelIndex& index) const override;
         Qt::DropActions supportedDropActions() const override;
         Qt::DropActions supportedDragActions() const override;
@@ -167,6 +173,9 @@ namespace AzToolsFramework
         void EnableSelectionUpdates(bool enable);
         void ResetFilter();
         void ReapplyFilter();
+        //! Emitted once the filtered state has been updated, which may be after the filter was requested
+        //! when the search is evaluated on a background thread.
+        void FilterApplied(bool searchChanged);
 
     public Q_SLOTS:
         void SearchStringChanged(const AZStd::string& filter);
@@ -194,6 +203,28 @@ namespace AzToolsFramework
         void QueueAncestorUpdate(AZ::EntityId entityId);
         void QueueEntityToExpand(AZ::EntityId entityId, bool expand);
         void ProcessEntityInfoResetEnd();
+
+        // PrefabPublicNotificationBus overrides ...
+        void OnPrefabInstancePropagationBegin() override;
+        void OnPrefabInstancePropagationEnd() override;
+
+        //! Children are only added to the model once the view asks for them (usually when the parent is expanded),
+        //! add/remove notifications for entities below parents that were never populated don't touch the model.
+        bool IsPopulated(const AZ::EntityId& entityId) const;
+        void PopulateAncestors(const AZ::EntityId& entityId);
+        void ClearPopulatedDescendants(const AZ::EntityId& entityId);
+        AZStd::unordered_set<AZ::EntityId> m_populatedEntities;
+
+        //! Structural changes during a prefab propagation are coalesced into a single model reset once there are too many
+        //! of them to notify row by row. Propagation is synchronous so the reset never spans a frame.
+        //! Returns true when the add/remove below parentId has to be notified to the view row by row.
+        bool BeginStructuralChange(const AZ::EntityId& parentId);
+        static constexpr int PropagationResetThreshold = 256;
+        int m_propagationStructuralChangeCount = 0;
+        bool m_prefabPropagationInProgress = false;
+        bool m_propagationResetInProgress = false;
+        AZStd::unordered_set<AZ::EntityId> m_structuralChangesInProgress; //!< Children whose add/remove notified the view.
+
         AZStd::unordered_set<AZ::EntityId> m_entitySelectQueue;
         AZStd::unordered_set<AZ::EntityId> m_entityChangeQueue;
         bool m_entityChangeQueued;
@@ -208,6 +239,32 @@ namespace AzToolsFramework
         AZStd::vector<ComponentTypeValue> m_componentFilters;
         bool m_isFilterDirty = true;
 
+        void ApplyFilter(bool searchChanged);
+
+        //! Flattened copy of the hierarchy and entity names so searches by name can run on a background thread.
+        //! Entries are in depth first order, so parents always precede their children.
+        struct FilterSnapshotEntry
+        {
+            AZ::EntityId m_entityId;
+            AZStd::string m_name;
+            int m_parentEntry = -1;
+        };
+        using FilterSnapshot = AZStd::vector<FilterSnapshotEntry>;
+
+        struct AsyncFilterTask
+        {
+            AZStd::shared_ptr<const FilterSnapshot> m_snapshot;
+            AZStd::string m_filterString;
+            AZStd::vector<bool> m_nameMatches;
+            bool m_searchChanged = false;
+        };
+
+        void BuildFilterSnapshot(const AZ::EntityId& entityId, int parentEntry, FilterSnapshot& snapshot) const;
+        void StartAsyncFilter(bool searchChanged);
+        void ApplyAsyncFilterResults(const AZStd::shared_ptr<AsyncFilterTask>& task);
+        AZStd::shared_ptr<const FilterSnapshot> m_filterSnapshot; //!< Null when the hierarchy or names changed since it was built.
+        AZStd::shared_ptr<AsyncFilterTask> m_asyncFilterTask; //!< The most recent request, results of older requests are dropped.
+
         void OnEntityCompositionChanged(const EntityIdList& entityIds) override;
 
         void OnEntityInitialized(const AZ::EntityId& entityId) override;
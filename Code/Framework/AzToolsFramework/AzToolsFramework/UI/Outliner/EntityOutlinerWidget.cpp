@@ -231,6 +231,7 @@ namespace AzToolsFramework
         connect(m_listModel, &EntityOutlinerListModel::EnableSelectionUpdates, this, &EntityOutlinerWidget::OnEnableSelectionUpdates);
         connect(m_listModel, &EntityOutlinerListModel::ResetFilter, this, &EntityOutlinerWidget::ClearFilter);
         connect(m_listModel, &EntityOutlinerListModel::ReapplyFilter, this, &EntityOutlinerWidget::InvalidateFilter);
+        connect(m_listModel, &EntityOutlinerListModel::FilterApplied, this, &EntityOutlinerWidget::OnFilterApplied);
 
         QToolButton* display_options = new QToolButton(this);
         display_options->setObjectName(QStringLiteral("m_display_options"));
@@ -1165,10 +1166,8 @@ namespace AzToolsFramework
         AZ_PROFILE_FUNCTION(AzToolsFramework);
         AZStd::string filterString = activeTextFilter.toUtf8().data();
 
+        // the proxy is updated once the model has applied the filter, see OnFilterApplied
         m_listModel->SearchStringChanged(filterString);
-        m_proxyModel->UpdateFilter();
-
-        m_gui->m_objectTree->expandAll();
     }
 
     void EntityOutlinerWidget::OnFilterChanged(const AzQtComponents::SearchTypeFilterList& activeTypeFilters)
@@ -1185,7 +1184,18 @@ namespace AzToolsFramework
         }
 
         m_listModel->SearchFilterChanged(componentFilters);
+    }
+
+    void EntityOutlinerWidget::OnFilterApplied(bool searchChanged)
+    {
+        AZ_PROFILE_FUNCTION(AzToolsFramework);
         m_proxyModel->UpdateFilter();
+
+        // Only reveal the matches, expanding everything would populate the whole hierarchy
+        if (searchChanged && !m_listModel->GetFilterString().empty())
+        {
+            m_gui->m_objectTree->expandAll();
+        }
     }
 
     void EntityOutlinerWidget::InvalidateFilter()
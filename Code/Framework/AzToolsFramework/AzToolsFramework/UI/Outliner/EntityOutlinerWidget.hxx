@@ -82,6 +82,7 @@ namespace AzToolsFramework
 
         void OnSearchTextChanged(const QString& activeTextFilter);
         void OnFilterChanged(const AzQtComponents::SearchTypeFilterList& activeTypeFilters);
+        void OnFilterApplied(bool searchChanged);
 
         void OnSortModeChanged(EntityOutliner::DisplaySortMode sortMode);
         void OnDisplayOptionChanged(EntityOutliner::DisplayOption displayOption, bool enable);
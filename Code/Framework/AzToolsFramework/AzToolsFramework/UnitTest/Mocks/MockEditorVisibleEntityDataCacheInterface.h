@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzFramework/Viewport/CameraState.h>
 #include <AzToolsFramework/ViewportSelection/EditorVisibleEntityDataCache.h>
 
 #include <gmock/gmock.h>
@@ -34,5 +35,15 @@ namespace UnitTest
         MOCK_CONST_METHOD1(IsVisibleEntityIndividuallySelectableInViewport, bool(size_t));
         MOCK_CONST_METHOD1(IsVisibleEntityInFocusSubTree, bool(size_t));
         MOCK_CONST_METHOD1(GetVisibleEntityIndexFromId, AZStd::optional<size_t>(AZ::EntityId entityId));
+        MOCK_CONST_METHOD3(
+            EnumerateVisibleEntityIndicesAlongSegment,
+            void(const AZ::Vector3&, const AZ::Vector3&, const AZStd::function<void(size_t)>&));
+        MOCK_CONST_METHOD4(
+            EnumerateVisibleEntityIndicesInScreenRect,
+            void(
+                const AzFramework::ScreenPoint&,
+                const AzFramework::ScreenPoint&,
+                const AzFramework::CameraState&,
+                const AZStd::function<void(size_t)>&));
     };
 } // namespace UnitTest
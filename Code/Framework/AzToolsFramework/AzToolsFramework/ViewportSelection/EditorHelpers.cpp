@@ -9,6 +9,7 @@
 #include "EditorHelpers.h"
 
 #include <AzCore/Console/Console.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <AzFramework/Viewport/CameraState.h>
 #include <AzFramework/Viewport/ViewportScreen.h>
@@ -101,6 +102,12 @@ namespace AzToolsFramework
         return GetIconScale(distance) * IconSize;
     }
 
+    // the largest size of an icon at any distance from the camera
+    static float GetMaxIconSize()
+    {
+        return AZ::GetMax<float>(ed_iconMinScale, ed_iconMaxScale) * IconSize;
+    }
+
     static void DisplayComponents(
         const AZ::EntityId entityId, const AzFramework::ViewportInfo& viewportInfo, AzFramework::DebugDisplayRequests& debugDisplay)
     {
@@ -193,12 +200,36 @@ namespace AzToolsFramework
         const AZ::Matrix3x4 cameraView = AzFramework::CameraView(cameraState);
         const AZ::Matrix4x4 cameraProjection = AzFramework::CameraProjection(cameraState);
 
+        // only test the entities whose icon or selection bounds may be under the cursor
+        AZStd::vector<size_t> candidateEntityCacheIndices;
+        const auto addCandidate = [&candidateEntityCacheIndices](const size_t entityCacheIndex)
+        {
+            candidateEntityCacheIndices.push_back(entityCacheIndex);
+        };
+
+        if (iconsVisible)
+        {
+            const auto screenCoords = mouseInteraction.m_mouseInteraction.m_mousePick.m_screenCoordinates;
+            const auto maxIconRange = aznumeric_cast<int>(AZStd::ceil(GetMaxIconSize() * 0.5f));
+            m_entityDataCache->EnumerateVisibleEntityIndicesInScreenRect(
+                AzFramework::ScreenPoint(screenCoords.m_x - maxIconRange, screenCoords.m_y - maxIconRange),
+                AzFramework::ScreenPoint(screenCoords.m_x + maxIconRange, screenCoords.m_y + maxIconRange), cameraState, addCandidate);
+        }
+
+        const AZ::Vector3& rayOrigin = mouseInteraction.m_mouseInteraction.m_mousePick.m_rayOrigin;
+        const AZ::Vector3& rayDirection = mouseInteraction.m_mouseInteraction.m_mousePick.m_rayDirection;
+        m_entityDataCache->EnumerateVisibleEntityIndicesAlongSegment(
+            rayOrigin, rayOrigin + rayDirection * EditorPickRayLength, addCandidate);
+
+        // test candidates in cache order so ties are resolved the same way regardless of how they were found
+        AZStd::sort(candidateEntityCacheIndices.begin(), candidateEntityCacheIndices.end());
+        candidateEntityCacheIndices.erase(
+            AZStd::unique(candidateEntityCacheIndices.begin(), candidateEntityCacheIndices.end()), candidateEntityCacheIndices.end());
+
         // selecting new entities
         AZ::EntityId entityIdUnderCursor;
         float closestDistance = AZStd::numeric_limits<float>::max();
-        for (size_t entityCacheIndex = 0, visibleEntityCount = m_entityDataCache->VisibleEntityDataCount();
-             entityCacheIndex < visibleEntityCount;
-             ++entityCacheIndex)
+        for (const size_t entityCacheIndex : candidateEntityCacheIndices)
         {
             const AZ::EntityId entityId = m_entityDataCache->GetVisibleEntityId(entityCacheIndex);
 
@@ -13,6 +13,7 @@
 #include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/Viewport/CameraState.h>
 #include <AzFramework/Viewport/ViewportColors.h>
@@ -421,7 +422,34 @@ namespace AzToolsFramework
             }
 
             const AzFramework::CameraState cameraState = GetCameraState(viewportId);
-            for (size_t entityCacheIndex = 0; entityCacheIndex < entityDataCache.VisibleEntityDataCount(); ++entityCacheIndex)
+
+            // only test the entities that may be inside the box and the entities that may need to leave the selection
+            AZStd::vector<size_t> candidateEntityCacheIndices;
+            const QRect boxSelectRegion = boxSelect->normalized();
+            entityDataCache.EnumerateVisibleEntityIndicesInScreenRect(
+                ViewportInteraction::ScreenPointFromQPoint(boxSelectRegion.topLeft()),
+                ViewportInteraction::ScreenPointFromQPoint(boxSelectRegion.bottomRight()), cameraState,
+                [&candidateEntityCacheIndices](const size_t entityCacheIndex)
+                {
+                    candidateEntityCacheIndices.push_back(entityCacheIndex);
+                });
+
+            for (const EntityIdContainer* potentialEntityIds : { &potentialSelectedEntityIds, &potentialDeselectedEntityIds })
+            {
+                for (const AZ::EntityId& entityId : *potentialEntityIds)
+                {
+                    if (const AZStd::optional<size_t> entityCacheIndex = entityDataCache.GetVisibleEntityIndexFromId(entityId))
+                    {
+                        candidateEntityCacheIndices.push_back(entityCacheIndex.value());
+                    }
+                }
+            }
+
+            AZStd::sort(candidateEntityCacheIndices.begin(), candidateEntityCacheIndices.end());
+            candidateEntityCacheIndices.erase(
+                AZStd::unique(candidateEntityCacheIndices.begin(), candidateEntityCacheIndices.end()), candidateEntityCacheIndices.end());
+
+            for (const size_t entityCacheIndex : candidateEntityCacheIndices)
             {
                 if (!entityDataCache.IsVisibleEntityIndividuallySelectableInViewport(entityCacheIndex))
                 {
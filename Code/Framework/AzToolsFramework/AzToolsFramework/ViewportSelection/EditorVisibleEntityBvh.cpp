@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "EditorVisibleEntityBvh.h"
+
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzFramework/Viewport/CameraState.h>
+#include <AzFramework/Viewport/ViewportScreen.h>
+
+namespace AzToolsFramework
+{
+    // maximum depth of the traversal stack, the median split keeps the tree depth at log2 of the element count
+    static constexpr size_t MaxTraversalDepth = 64;
+
+    // slab test of a segment against an aabb, unlike AZ::Intersect::IntersectRayAABB a segment starting inside
+    // the aabb is considered overlapping (parent bounds will often contain the camera)
+    static bool SegmentOverlapsAabb(const AZ::Vector3& start, const AZ::Vector3& delta, const AZ::Aabb& aabb)
+    {
+        if (!aabb.IsValid())
+        {
+            return false;
+        }
+
+        float tMin = 0.0f;
+        float tMax = 1.0f;
+        for (int32_t axis = 0; axis < 3; ++axis)
+        {
+            const float origin = start.GetElement(axis);
+            const float direction = delta.GetElement(axis);
+            const float min = aabb.GetMin().GetElement(axis);
+            const float max = aabb.GetMax().GetElement(axis);
+
+            if (AZStd::abs(direction) < AZ::Constants::FloatEpsilon)
+            {
+                if (origin < min || origin > max)
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            float t0 = (min - origin) / direction;
+            float t1 = (max - origin) / direction;
+            if (t0 > t1)
+            {
+                AZStd::swap(t0, t1);
+            }
+
+            tMin = AZ::GetMax(tMin, t0);
+            tMax = AZ::GetMin(tMax, t1);
+            if (tMin > tMax)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void EditorVisibleEntityBvh::Build(const AZStd::vector<AZ::Vector3>& positions, const AZStd::vector<AZ::Aabb>& bounds)
+    {
+        AZ_Assert(positions.size() == bounds.size(), "Every element must have a position and bounds");
+
+        Clear();
+
+        m_positions = positions;
+        m_bounds = bounds;
+
+        const auto elementCount = aznumeric_cast<uint32_t>(m_positions.size());
+        if (elementCount == 0)
+        {
+            return;
+        }
+
+        m_elementOrder.resize(elementCount);
+        for (uint32_t elementIndex = 0; elementIndex < elementCount; ++elementIndex)
+        {
+            m_elementOrder[elementIndex] = elementIndex;
+        }
+
+        m_leafFromElement.resize(elementCount, InvalidNodeIndex);
+        m_nodes.reserve(2 * (elementCount / MaxLeafElementCount + 1));
+        m_nodes.emplace_back();
+        BuildNode(0, 0, elementCount);
+    }
+
+    void EditorVisibleEntityBvh::BuildNode(const uint32_t nodeIndex, const uint32_t firstElement, const uint32_t elementCount)
+    {
+        if (elementCount <= MaxLeafElementCount)
+        {
+            Node& leaf = m_nodes[nodeIndex];
+            leaf.m_firstElement = firstElement;
+            leaf.m_elementCount = elementCount;
+            for (uint32_t element = firstElement; element < firstElement + elementCount; ++element)
+            {
+                m_leafFromElement[m_elementOrder[element]] = nodeIndex;
+            }
+            RefitLeaf(leaf);
+            return;
+        }
+
+        // split the elements at the median position along the longest axis of their position bounds
+        AZ::Aabb positionBounds = AZ::Aabb::CreateNull();
+        for (uint32_t element = firstElement; element < firstElement + elementCount; ++element)
+        {
+            positionBounds.AddPoint(m_positions[m_elementOrder[element]]);
+        }
+
+        const AZ::Vector3 extents = positionBounds.GetExtents();
+        const int32_t axis = extents.GetX() >= extents.GetY() ? (extents.GetX() >= extents.GetZ() ? 0 : 2)
+                                                              : (extents.GetY() >= extents.GetZ() ? 1 : 2);
+
+        const uint32_t halfCount = elementCount / 2;
+        const auto first = m_elementOrder.begin() + firstElement;
+        AZStd::nth_element(
+            first, first + halfCount, first + elementCount,
+            [this, axis](const uint32_t lhs, const uint32_t rhs)
+            {
+                return m_positions[lhs].GetElement(axis) < m_positions[rhs].GetElement(axis);
+            });
+
+        const auto firstChild = aznumeric_cast<uint32_t>(m_nodes.size());
+        m_nodes.emplace_back().m_parent = nodeIndex;
+        m_nodes.emplace_back().m_parent = nodeIndex;
+        m_nodes[nodeIndex].m_firstChild = firstChild;
+
+        BuildNode(firstChild, firstElement, halfCount);
+        BuildNode(firstChild + 1, firstElement + halfCount, elementCount - halfCount);
+
+        Node& node = m_nodes[nodeIndex];
+        node.m_bounds = m_nodes[firstChild].m_bounds;
+        node.m_bounds.AddAabb(m_nodes[firstChild + 1].m_bounds);
+        node.m_positionBounds = m_nodes[firstChild].m_positionBounds;
+        node.m_positionBounds.AddAabb(m_nodes[firstChild + 1].m_positionBounds);
+    }
+
+    void EditorVisibleEntityBvh::RefitLeaf(Node& leaf)
+    {
+        leaf.m_bounds = AZ::Aabb::CreateNull();
+        leaf.m_positionBounds = AZ::Aabb::CreateNull();
+        for (uint32_t element = leaf.m_firstElement; element < leaf.m_firstElement + leaf.m_elementCount; ++element)
+        {
+            const uint32_t elementIndex = m_elementOrder[element];
+            leaf.m_bounds.AddAabb(m_bounds[elementIndex]);
+            leaf.m_positionBounds.AddPoint(m_positions[elementIndex]);
+        }
+    }
+
+    void EditorVisibleEntityBvh::Update(const size_t elementIndex, const AZ::Vector3& position, const AZ::Aabb& bounds)
+    {
+        if (elementIndex >= m_positions.size())
+        {
+            return;
+        }
+
+        m_positions[elementIndex] = position;
+        m_bounds[elementIndex] = bounds;
+
+        uint32_t nodeIndex = m_leafFromElement[elementIndex];
+        RefitLeaf(m_nodes[nodeIndex]);
+
+        // refit the ancestors, stop early once a node's bounds no longer change
+        nodeIndex = m_nodes[nodeIndex].m_parent;
+        while (nodeIndex != InvalidNodeIndex)
+        {
+            Node& node = m_nodes[nodeIndex];
+            AZ::Aabb nodeBounds = m_nodes[node.m_firstChild].m_bounds;
+            nodeBounds.AddAabb(m_nodes[node.m_firstChild + 1].m_bounds);
+            AZ::Aabb nodePositionBounds = m_nodes[node.m_firstChild].m_positionBounds;
+            nodePositionBounds.AddAabb(m_nodes[node.m_firstChild + 1].m_positionBounds);
+
+            if (nodeBounds == node.m_bounds && nodePositionBounds == node.m_positionBounds)
+            {
+                break;
+            }
+
+            node.m_bounds = nodeBounds;
+            node.m_positionBounds = nodePositionBounds;
+            nodeIndex = node.m_parent;
+        }
+    }
+
+    void EditorVisibleEntityBvh::Clear()
+    {
+        m_nodes.clear();
+        m_elementOrder.clear();
+        m_leafFromElement.clear();
+        m_positions.clear();
+        m_bounds.clear();
+    }
+
+    size_t EditorVisibleEntityBvh::ElementCount() const
+    {
+        return m_positions.size();
+    }
+
+    template<typename NodeTest, typename ElementTest>
+    void EditorVisibleEntityBvh::Enumerate(
+        const NodeTest& nodeTest, const ElementTest& elementTest, const AZStd::function<void(size_t)>& visitor) const
+    {
+        if (m_nodes.empty())
+        {
+            return;
+        }
+
+        AZStd::array<uint32_t, MaxTraversalDepth> stack;
+        size_t stackSize = 0;
+        stack[stackSize++] = 0;
+
+        while (stackSize > 0)
+        {
+            const Node& node = m_nodes[stack[--stackSize]];
+            if (!nodeTest(node))
+            {
+                continue;
+            }
+
+            if (node.m_firstChild == InvalidNodeIndex)
+            {
+                for (uint32_t element = node.m_firstElement; element < node.m_firstElement + node.m_elementCount; ++element)
+                {
+                    if (const uint32_t elementIndex = m_elementOrder[element]; elementTest(elementIndex))
+                    {
+                        visitor(elementIndex);
+                    }
+                }
+            }
+            else
+            {
+                AZ_Assert(stackSize + 2 <= stack.size(), "EditorVisibleEntityBvh is deeper than expected");
+                stack[stackSize++] = node.m_firstChild + 1;
+                stack[stackSize++] = node.m_firstChild;
+            }
+        }
+    }
+
+    void EditorVisibleEntityBvh::EnumerateSegment(
+        const AZ::Vector3& start, const AZ::Vector3& end, const AZStd::function<void(size_t)>& visitor) const
+    {
+        const AZ::Vector3 delta = end - start;
+        Enumerate(
+            [&start, &delta](const Node& node)
+            {
+                return SegmentOverlapsAabb(start, delta, node.m_bounds);
+            },
+            [this, &start, &delta](const uint32_t elementIndex)
+            {
+                return SegmentOverlapsAabb(start, delta, m_bounds[elementIndex]);
+            },
+            visitor);
+    }
+
+    void EditorVisibleEntityBvh::EnumerateScreenRect(
+        const AzFramework::ScreenPoint& min,
+        const AzFramework::ScreenPoint& max,
+        const AzFramework::CameraState& cameraState,
+        const AZStd::function<void(size_t)>& visitor) const
+    {
+        const AZ::Matrix3x4 cameraView = AzFramework::CameraView(cameraState);
+        const AZ::Matrix4x4 cameraProjection = AzFramework::CameraProjection(cameraState);
+        const float width = cameraState.m_viewportSize.Widthf();
+        const float height = cameraState.m_viewportSize.Heightf();
+
+        // screen positions are rounded to the nearest pixel, allow a pixel either side of the rectangle
+        const float minX = aznumeric_cast<float>(AZ::GetMin(min.m_x, max.m_x)) - 1.0f;
+        const float maxX = aznumeric_cast<float>(AZ::GetMax(min.m_x, max.m_x)) + 1.0f;
+        const float minY = aznumeric_cast<float>(AZ::GetMin(min.m_y, max.m_y)) - 1.0f;
+        const float maxY = aznumeric_cast<float>(AZ::GetMax(min.m_y, max.m_y)) + 1.0f;
+
+        // projects a world position to screen space (matches AzFramework::WorldToScreen before rounding)
+        // returns false if the position is behind the camera and so cannot be inside the rectangle
+        const auto project = [&cameraView, &cameraProjection, width, height](const AZ::Vector3& worldPosition, float& x, float& y)
+        {
+            const AZ::Vector4 clipSpacePosition = cameraProjection * AZ::Vector4(cameraView.TransformPoint(worldPosition), 1.0f);
+            if (clipSpacePosition.GetW() <= AZ::Constants::FloatEpsilon)
+            {
+                return false;
+            }
+
+            const float inverseW = 1.0f / clipSpacePosition.GetW();
+            x = (clipSpacePosition.GetX() * inverseW + 1.0f) * 0.5f * width;
+            y = (1.0f - (clipSpacePosition.GetY() * inverseW + 1.0f) * 0.5f) * height;
+            return true;
+        };
+
+        Enumerate(
+            [&project, minX, maxX, minY, maxY](const Node& node)
+            {
+                if (!node.m_positionBounds.IsValid())
+                {
+                    return false;
+                }
+
+                // the projection of a box in front of the camera lies within the screen bounds of its projected corners
+                const AZ::Vector3& boundsMin = node.m_positionBounds.GetMin();
+                const AZ::Vector3& boundsMax = node.m_positionBounds.GetMax();
+                float screenMinX = AZStd::numeric_limits<float>::max();
+                float screenMaxX = -AZStd::numeric_limits<float>::max();
+                float screenMinY = AZStd::numeric_limits<float>::max();
+                float screenMaxY = -AZStd::numeric_limits<float>::max();
+                uint32_t cornersBehindCamera = 0;
+                for (uint32_t corner = 0; corner < 8; ++corner)
+                {
+                    const AZ::Vector3 cornerPosition(
+                        (corner & 1) ? boundsMax.GetX() : boundsMin.GetX(), (corner & 2) ? boundsMax.GetY() : boundsMin.GetY(),
+                        (corner & 4) ? boundsMax.GetZ() : boundsMin.GetZ());
+
+                    float x;
+                    float y;
+                    if (!project(cornerPosition, x, y))
+                    {
+                        ++cornersBehindCamera;
+                        continue;
+                    }
+
+                    screenMinX = AZ::GetMin(screenMinX, x);
+                    screenMaxX = AZ::GetMax(screenMaxX, x);
+                    screenMinY = AZ::GetMin(screenMinY, y);
+                    screenMaxY = AZ::GetMax(screenMaxY, y);
+                }
+
+                if (cornersBehindCamera == 8)
+                {
+                    return false;
+                }
+
+                if (cornersBehindCamera > 0)
+                {
+                    // the box crosses the camera plane, conservatively visit its children
+                    return true;
+                }
+
+                return screenMaxX >= minX && screenMinX <= maxX && screenMaxY >= minY && screenMinY <= maxY;
+            },
+            [this, &project, minX, maxX, minY, maxY](const uint32_t elementIndex)
+            {
+                float x;
+                float y;
+                return project(m_positions[elementIndex], x, y) && x >= minX && x <= maxX && y >= minY && y <= maxY;
+            },
+            visitor);
+    }
+} // namespace AzToolsFramework
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzFramework/Viewport/ScreenGeometry.h>
+
+namespace AzFramework
+{
+    struct CameraState;
+}
+
+namespace AzToolsFramework
+{
+    //! Bounding volume hierarchy over the entities of the EditorVisibleEntityDataCache.
+    //! Each element has a world position and optional world space selection bounds. Nodes keep the bounds of both so
+    //! pick rays can be tested against selection bounds and screen rectangles (box select, icons) against positions.
+    //! Queries are conservative, candidates must still be tested exactly by the caller.
+    class EditorVisibleEntityBvh
+    {
+    public:
+        //! Rebuilds the hierarchy, element i has positions[i] and bounds[i] (bounds may be null).
+        void Build(const AZStd::vector<AZ::Vector3>& positions, const AZStd::vector<AZ::Aabb>& bounds);
+
+        //! Updates a single element and refits its ancestors.
+        void Update(size_t elementIndex, const AZ::Vector3& position, const AZ::Aabb& bounds);
+
+        //! Removes all elements.
+        void Clear();
+
+        size_t ElementCount() const;
+
+        //! Calls the visitor with the index of every element whose bounds overlap the segment.
+        void EnumerateSegment(const AZ::Vector3& start, const AZ::Vector3& end, const AZStd::function<void(size_t)>& visitor) const;
+
+        //! Calls the visitor with the index of every element whose position projects inside the screen rectangle.
+        void EnumerateScreenRect(
+            const AzFramework::ScreenPoint& min,
+            const AzFramework::ScreenPoint& max,
+            const AzFramework::CameraState& cameraState,
+            const AZStd::function<void(size_t)>& visitor) const;
+
+    private:
+        static constexpr uint32_t MaxLeafElementCount = 4;
+        static constexpr uint32_t InvalidNodeIndex = ~0u;
+
+        struct Node
+        {
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull(); //!< Union of the selection bounds of all elements below the node.
+            AZ::Aabb m_positionBounds = AZ::Aabb::CreateNull(); //!< Bounds of the positions of all elements below the node.
+            uint32_t m_parent = InvalidNodeIndex;
+            uint32_t m_firstChild = InvalidNodeIndex; //!< The second child immediately follows the first, invalid for leaves.
+            uint32_t m_firstElement = 0; //!< Offset into m_elementOrder for leaves.
+            uint32_t m_elementCount = 0;
+        };
+
+        void BuildNode(uint32_t nodeIndex, uint32_t firstElement, uint32_t elementCount);
+        void RefitLeaf(Node& node);
+
+        //! Enumerates the elements of leaves whose bounds pass the node test, elementTest is applied to each element.
+        template<typename NodeTest, typename ElementTest>
+        void Enumerate(const NodeTest& nodeTest, const ElementTest& elementTest, const AZStd::function<void(size_t)>& visitor) const;
+
+        AZStd::vector<Node> m_nodes; //!< Node 0 is the root, children are always stored after their parent.
+        AZStd::vector<uint32_t> m_elementOrder; //!< Element indices grouped by leaf.
+        AZStd::vector<uint32_t> m_leafFromElement; //!< The leaf node of each element.
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Aabb> m_bounds;
+    };
+} // namespace AzToolsFramework
@@ -13,6 +13,7 @@
 #include <AzToolsFramework/Entity/EditorEntityModel.h>
 #include <AzToolsFramework/FocusMode/FocusModeInterface.h>
 #include <AzToolsFramework/Viewport/ViewportMessages.h>
+#include <AzToolsFramework/ViewportSelection/EditorVisibleEntityBvh.h>
 #include <Entity/EditorEntityHelpers.h>
 
 namespace AzToolsFramework
@@ -34,6 +35,7 @@ namespace AzToolsFramework
             bool iconHidden);
 
         AZ::Transform m_worldFromLocal;
+        AZ::Aabb m_selectionBounds = AZ::Aabb::CreateNull(); //!< World space union of the editor selection bounds.
         AZ::EntityId m_entityId;
         ComponentEntityAccentType m_accent = ComponentEntityAccentType::None;
         bool m_locked = false;
@@ -42,6 +44,7 @@ namespace AzToolsFramework
         bool m_descendantOfClosedContainer = false;
         bool m_selected = false;
         bool m_iconHidden = false;
+        bool m_selectionBoundsDirty = true; //!< The selection bounds must be requested again.
     };
 
     using EntityDatas = AZStd::vector<EntityData>; //!< Alias for vector of EntityDatas.
@@ -61,8 +64,40 @@ namespace AzToolsFramework
         EntityIdList m_visibleEntityIds; //!< The EntityIds that are visible this frame.
         EntityIdList m_prevVisibleEntityIds; //!< The EntityIds that were visible the previous frame (unsorted).
         EntityDatas m_visibleEntityDatas; //!< Cached EntityData required by EditorTransformComponentSelection.
+        EditorVisibleEntityBvh m_bvh; //!< Hierarchy over m_visibleEntityDatas (in the same order) to accelerate picking.
+        bool m_selectionBoundsDirty = false; //!< At least one EntityData has dirty selection bounds.
+
+        //! Rebuilds the hierarchy after m_visibleEntityDatas was reordered.
+        void RebuildBvh();
+        //! Flags the selection bounds of every entity to be requested again.
+        void MarkAllSelectionBoundsDirty();
     };
 
+    void EditorVisibleEntityDataCache::EditorVisibleEntityDataCacheImpl::RebuildBvh()
+    {
+        AZStd::vector<AZ::Vector3> positions;
+        AZStd::vector<AZ::Aabb> bounds;
+        positions.reserve(m_visibleEntityDatas.size());
+        bounds.reserve(m_visibleEntityDatas.size());
+        for (const EntityData& entityData : m_visibleEntityDatas)
+        {
+            positions.push_back(entityData.m_worldFromLocal.GetTranslation());
+            bounds.push_back(entityData.m_selectionBounds);
+        }
+
+        m_bvh.Build(positions, bounds);
+    }
+
+    void EditorVisibleEntityDataCache::EditorVisibleEntityDataCacheImpl::MarkAllSelectionBoundsDirty()
+    {
+        for (EntityData& entityData : m_visibleEntityDatas)
+        {
+            entityData.m_selectionBoundsDirty = true;
+        }
+
+        m_selectionBoundsDirty = !m_visibleEntityDatas.empty();
+    }
+
     // constructor for EntityData to support emplace_back in vector
     EntityData::EntityData(
         const AZ::EntityId entityId,
@@ -204,6 +239,10 @@ namespace AzToolsFramework
         }
 
         AZStd::sort(m_impl->m_visibleEntityDatas.begin(), m_impl->m_visibleEntityDatas.end());
+
+        // selection bounds are requested with the first viewport update
+        m_impl->m_selectionBoundsDirty = !m_impl->m_visibleEntityDatas.empty();
+        m_impl->RebuildBvh();
     }
 
     void EditorVisibleEntityDataCache::CalculateVisibleEntityDatas(const AzFramework::ViewportInfo& viewportInfo)
@@ -217,6 +256,7 @@ namespace AzToolsFramework
             nextVisibleEntityIds);
 
         // only bother resorting if we know the lists have changed
+        bool rebuildBvh = false;
         if (!EntityIdListsEqual(m_impl->m_prevVisibleEntityIds, nextVisibleEntityIds))
         {
             // make a copy of the list, this will be sorted in-place
@@ -261,6 +301,35 @@ namespace AzToolsFramework
 
             // after inserting added elements, ensure we keep the visible entity data in sorted order
             AZStd::sort(m_impl->m_visibleEntityDatas.begin(), m_impl->m_visibleEntityDatas.end());
+
+            rebuildBvh = true;
+            m_impl->m_selectionBoundsDirty = m_impl->m_selectionBoundsDirty || !added.empty();
+        }
+
+        // only request the selection bounds of entities that changed since the last update
+        if (m_impl->m_selectionBoundsDirty)
+        {
+            for (size_t entityIndex = 0; entityIndex < m_impl->m_visibleEntityDatas.size(); ++entityIndex)
+            {
+                if (EntityData& entityData = m_impl->m_visibleEntityDatas[entityIndex]; entityData.m_selectionBoundsDirty)
+                {
+                    entityData.m_selectionBounds = CalculateEditorEntitySelectionBounds(entityData.m_entityId, viewportInfo);
+                    entityData.m_selectionBoundsDirty = false;
+
+                    if (!rebuildBvh)
+                    {
+                        m_impl->m_bvh.Update(
+                            entityIndex, entityData.m_worldFromLocal.GetTranslation(), entityData.m_selectionBounds);
+                    }
+                }
+            }
+
+            m_impl->m_selectionBoundsDirty = false;
+        }
+
+        if (rebuildBvh)
+        {
+            m_impl->RebuildBvh();
         }
     }
 
@@ -333,13 +402,43 @@ namespace AzToolsFramework
         return {};
     }
 
+    void EditorVisibleEntityDataCache::EnumerateVisibleEntityIndicesAlongSegment(
+        const AZ::Vector3& start, const AZ::Vector3& end, const AZStd::function<void(size_t)>& visitor) const
+    {
+        m_impl->m_bvh.EnumerateSegment(start, end, visitor);
+    }
+
+    void EditorVisibleEntityDataCache::EnumerateVisibleEntityIndicesInScreenRect(
+        const AzFramework::ScreenPoint& min,
+        const AzFramework::ScreenPoint& max,
+        const AzFramework::CameraState& cameraState,
+        const AZStd::function<void(size_t)>& visitor) const
+    {
+        m_impl->m_bvh.EnumerateScreenRect(min, max, cameraState, visitor);
+    }
+
     void EditorVisibleEntityDataCache::AfterUndoRedo()
     {
         // ensure we refresh all EntityData after an undo/redo action as
         // the notification buses will not be called
         for (EntityData& entityData : m_impl->m_visibleEntityDatas)
         {
+            // keep the previous selection bounds until they are requested again with the next viewport update
+            const AZ::Aabb selectionBounds = entityData.m_selectionBounds;
             entityData = EntityDataFromEntityId(entityData.m_entityId);
+            entityData.m_selectionBounds = selectionBounds;
+        }
+
+        m_impl->MarkAllSelectionBoundsDirty();
+        m_impl->RebuildBvh();
+    }
+
+    void EditorVisibleEntityDataCache::OnEndUndo([[maybe_unused]] const char* label, const bool changed)
+    {
+        // property changes (e.g. the size of a shape) may have changed the selection bounds
+        if (changed)
+        {
+            m_impl->MarkAllSelectionBoundsDirty();
         }
     }
 
@@ -373,7 +472,20 @@ namespace AzToolsFramework
 
         if (AZStd::optional<size_t> entityIndex = GetVisibleEntityIndexFromId(entityId))
         {
-            m_impl->m_visibleEntityDatas[entityIndex.value()].m_worldFromLocal = world;
+            EntityData& entityData = m_impl->m_visibleEntityDatas[entityIndex.value()];
+
+            // move the selection bounds with the entity so the hierarchy stays usable until the bounds
+            // are requested again with the next viewport update (rotation and scale are only reflected then)
+            if (entityData.m_selectionBounds.IsValid())
+            {
+                entityData.m_selectionBounds.Translate(world.GetTranslation() - entityData.m_worldFromLocal.GetTranslation());
+            }
+
+            entityData.m_worldFromLocal = world;
+            entityData.m_selectionBoundsDirty = true;
+            m_impl->m_selectionBoundsDirty = true;
+
+            m_impl->m_bvh.Update(entityIndex.value(), world.GetTranslation(), entityData.m_selectionBounds);
         }
     }
 
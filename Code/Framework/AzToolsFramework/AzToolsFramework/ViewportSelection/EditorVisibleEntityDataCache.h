@@ -9,7 +9,9 @@
 #pragma once
 
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/functional.h>
 #include <AzCore/std/optional.h>
+#include <AzFramework/Viewport/ScreenGeometry.h>
 #include <AzToolsFramework/API/ComponentEntitySelectionBus.h>
 #include <AzToolsFramework/ContainerEntity/ContainerEntityNotificationBus.h>
 #include <AzToolsFramework/FocusMode/FocusModeNotificationBus.h>
@@ -18,6 +20,11 @@
 #include <AzToolsFramework/ToolsComponents/EditorSelectionAccentSystemComponent.h>
 #include <AzToolsFramework/ToolsComponents/EditorVisibilityBus.h>
 
+namespace AzFramework
+{
+    struct CameraState;
+}
+
 namespace AzToolsFramework
 {
     //! Read-only interface for EditorVisibleEntityDataCache to be used by systems that want to efficiently
@@ -44,6 +51,17 @@ namespace AzToolsFramework
         virtual bool IsVisibleEntityIndividuallySelectableInViewport(size_t index) const = 0;
         virtual bool IsVisibleEntityInFocusSubTree(size_t index) const = 0;
         virtual AZStd::optional<size_t> GetVisibleEntityIndexFromId(AZ::EntityId entityId) const = 0;
+        //! Calls the visitor with the index of every visible entity whose selection bounds may overlap the segment.
+        //! @note This is a conservative query, candidates should still be tested exactly (e.g. with PickEntity).
+        virtual void EnumerateVisibleEntityIndicesAlongSegment(
+            const AZ::Vector3& start, const AZ::Vector3& end, const AZStd::function<void(size_t)>& visitor) const = 0;
+        //! Calls the visitor with the index of every visible entity whose position may project inside the screen rectangle.
+        //! @note This is a conservative query, candidates should still be tested exactly (e.g. with WorldToScreen).
+        virtual void EnumerateVisibleEntityIndicesInScreenRect(
+            const AzFramework::ScreenPoint& min,
+            const AzFramework::ScreenPoint& max,
+            const AzFramework::CameraState& cameraState,
+            const AZStd::function<void(size_t)>& visitor) const = 0;
     };
 
     //! A cache of packed EntityData that can be iterated over efficiently without
@@ -85,12 +103,20 @@ namespace AzToolsFramework
         bool IsVisibleEntityIndividuallySelectableInViewport(size_t index) const override;
         bool IsVisibleEntityInFocusSubTree(size_t index) const override;
         AZStd::optional<size_t> GetVisibleEntityIndexFromId(AZ::EntityId entityId) const override;
+        void EnumerateVisibleEntityIndicesAlongSegment(
+            const AZ::Vector3& start, const AZ::Vector3& end, const AZStd::function<void(size_t)>& visitor) const override;
+        void EnumerateVisibleEntityIndicesInScreenRect(
+            const AzFramework::ScreenPoint& min,
+            const AzFramework::ScreenPoint& max,
+            const AzFramework::CameraState& cameraState,
+            const AZStd::function<void(size_t)>& visitor) const override;
 
         void AddEntityIds(const EntityIdList& entityIds);
 
     private:
         // ToolsApplicationNotificationBus overrides ...
         void AfterUndoRedo() override;
+        void OnEndUndo(const char* label, bool changed) override;
 
         // EditorEntityVisibilityNotificationBus overrides ...
         void OnEntityVisibilityChanged(bool visibility) override;
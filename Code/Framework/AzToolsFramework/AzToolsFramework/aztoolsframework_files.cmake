@@ -691,6 +691,8 @@ set(FILES
     ViewportSelection/EditorTransformComponentSelection.cpp
     ViewportSelection/EditorTransformComponentSelectionRequestBus.h
     ViewportSelection/EditorTransformComponentSelectionRequestBus.cpp
+    ViewportSelection/EditorVisibleEntityBvh.h
+    ViewportSelection/EditorVisibleEntityBvh.cpp
     ViewportSelection/EditorVisibleEntityDataCache.h
     ViewportSelection/EditorVisibleEntityDataCache.cpp
     ViewportSelection/InvalidClicks.h
@@ -817,6 +819,9 @@ set(FILES
     Prefab/PrefabIdTypes.h
     Prefab/PrefabInstanceUtils.h
     Prefab/PrefabInstanceUtils.cpp
+    Prefab/PrefabLoadProfiler.h
+    Prefab/PrefabLoadProfiler.cpp
+    Prefab/PrefabLoadProfilerInterface.h
     Prefab/PrefabLoader.h
     Prefab/PrefabLoader.cpp
     Prefab/PrefabLoaderInterface.h
@@ -216,6 +216,45 @@ namespace UnitTest
             EXPECT_TRUE(result);
         }
 
+        TEST_F(ArchiveComponentTest, AddFilesToArchiveIncremental_FromPreviousArchive_AllFilesExtracted)
+        {
+            QString listFile = CreateArchiveListTextFile();
+            CreateArchiveFolder(GetArchiveFolderName(), CreateArchiveFileList());
+
+            AZ_TEST_START_TRACE_SUPPRESSION;
+            std::future<bool> addResult;
+            AzToolsFramework::ArchiveCommandsBus::BroadcastResult(
+                addResult, &AzToolsFramework::ArchiveCommandsBus::Events::AddFilesToArchive, GetArchivePath().toUtf8().constData(),
+                GetArchiveFolder().toUtf8().constData(), listFile.toUtf8().constData());
+            EXPECT_TRUE(addResult.get());
+
+            // Change one of the files, so the new archive has both files copied from the previous archive and a recompressed one.
+            EXPECT_TRUE(CreateDummyFile(QDir(GetArchiveFolder()).absoluteFilePath("basicfile.txt"), "changed"));
+
+            QString newArchivePath = QDir(m_tempDir.GetDirectory()).filePath("TestArchiveIncremental.pak");
+            AzToolsFramework::ArchiveCommandsBus::BroadcastResult(
+                addResult, &AzToolsFramework::ArchiveCommandsBus::Events::AddFilesToArchiveIncremental,
+                newArchivePath.toUtf8().constData(), GetArchiveFolder().toUtf8().constData(), listFile.toUtf8().constData(),
+                AZStd::vector<AZStd::string>{ GetArchivePath().toUtf8().constData() });
+            EXPECT_TRUE(addResult.get());
+
+            std::future<bool> extractResult;
+            AzToolsFramework::ArchiveCommandsBus::BroadcastResult(
+                extractResult, &AzToolsFramework::ArchiveCommandsBus::Events::ExtractArchive, newArchivePath.toUtf8().constData(),
+                GetExtractFolder().toUtf8().constData());
+            EXPECT_TRUE(extractResult.get());
+            AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+
+            for (const auto& file : CreateArchiveFileList())
+            {
+                QFile sourceFile(QDir(GetArchiveFolder()).absoluteFilePath(file));
+                QFile extractedFile(QDir(GetExtractFolder()).absoluteFilePath(file));
+                ASSERT_TRUE(sourceFile.open(QFile::ReadOnly));
+                ASSERT_TRUE(extractedFile.open(QFile::ReadOnly));
+                EXPECT_EQ(sourceFile.readAll(), extractedFile.readAll());
+            }
+        }
+
         TEST_F(ArchiveComponentTest, ExtractArchive_AllFiles_Success)
         {
             CreateArchiveFolder();
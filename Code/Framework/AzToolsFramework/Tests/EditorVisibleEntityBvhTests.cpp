@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Viewport/CameraState.h>
+#include <AzFramework/Viewport/ViewportScreen.h>
+#include <AzTest/AzTest.h>
+#include <AzToolsFramework/ViewportSelection/EditorVisibleEntityBvh.h>
+
+namespace UnitTest
+{
+    class EditorVisibleEntityBvhFixture : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            // a grid of entities in front of the camera (looking down the y axis), every other entity has bounds
+            for (int x = 0; x < 20; ++x)
+            {
+                for (int y = 0; y < 20; ++y)
+                {
+                    for (int z = 0; z < 5; ++z)
+                    {
+                        const AZ::Vector3 position(
+                            aznumeric_cast<float>(x - 10), aznumeric_cast<float>(y + 5), aznumeric_cast<float>(z - 2));
+                        m_positions.push_back(position);
+                        m_bounds.push_back(
+                            m_positions.size() % 2 == 0 ? AZ::Aabb::CreateCenterHalfExtents(position, AZ::Vector3(0.25f))
+                                                        : AZ::Aabb::CreateNull());
+                    }
+                }
+            }
+
+            m_bvh.Build(m_positions, m_bounds);
+            m_cameraState = AzFramework::CreateDefaultCamera(AZ::Transform::CreateIdentity(), AzFramework::ScreenSize(1024, 768));
+        }
+
+        void TearDown() override
+        {
+            m_bvh.Clear();
+            m_positions = {};
+            m_bounds = {};
+
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZStd::vector<size_t> SegmentCandidates(const AZ::Vector3& start, const AZ::Vector3& end) const
+        {
+            AZStd::vector<size_t> candidates;
+            m_bvh.EnumerateSegment(
+                start, end,
+                [&candidates](const size_t elementIndex)
+                {
+                    candidates.push_back(elementIndex);
+                });
+            AZStd::sort(candidates.begin(), candidates.end());
+            return candidates;
+        }
+
+        AZStd::vector<size_t> ScreenRectCandidates(const AzFramework::ScreenPoint& min, const AzFramework::ScreenPoint& max) const
+        {
+            AZStd::vector<size_t> candidates;
+            m_bvh.EnumerateScreenRect(
+                min, max, m_cameraState,
+                [&candidates](const size_t elementIndex)
+                {
+                    candidates.push_back(elementIndex);
+                });
+            AZStd::sort(candidates.begin(), candidates.end());
+            return candidates;
+        }
+
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Aabb> m_bounds;
+        AzToolsFramework::EditorVisibleEntityBvh m_bvh;
+        AzFramework::CameraState m_cameraState;
+    };
+
+    TEST_F(EditorVisibleEntityBvhFixture, SegmentQueryReturnsOnlyElementsWithBoundsAlongTheSegment)
+    {
+        // segment through the row of entities at x = 0, z = 0
+        const AZStd::vector<size_t> candidates = SegmentCandidates(AZ::Vector3(0.0f, 0.0f, 0.0f), AZ::Vector3(0.0f, 100.0f, 0.0f));
+
+        AZStd::vector<size_t> expected;
+        for (size_t elementIndex = 0; elementIndex < m_positions.size(); ++elementIndex)
+        {
+            if (m_bounds[elementIndex].IsValid() && m_positions[elementIndex].GetX() == 0.0f && m_positions[elementIndex].GetZ() == 0.0f)
+            {
+                expected.push_back(elementIndex);
+            }
+        }
+
+        EXPECT_FALSE(expected.empty());
+        EXPECT_EQ(candidates, expected);
+    }
+
+    TEST_F(EditorVisibleEntityBvhFixture, SegmentQueryFollowsUpdatedElements)
+    {
+        // move an entity with bounds away from the row and one onto it
+        const size_t movedAwayIndex = 1;
+        const size_t movedOntoIndex = 0;
+        ASSERT_FALSE(m_bounds[movedOntoIndex].IsValid());
+
+        const AZ::Vector3 rowPosition(0.0f, 50.0f, 0.0f);
+        m_bvh.Update(movedAwayIndex, AZ::Vector3(100.0f), AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(100.0f), AZ::Vector3(0.25f)));
+        m_bvh.Update(movedOntoIndex, rowPosition, AZ::Aabb::CreateCenterHalfExtents(rowPosition, AZ::Vector3(0.25f)));
+
+        const AZStd::vector<size_t> farCandidates =
+            SegmentCandidates(AZ::Vector3(100.0f, 0.0f, 100.0f), AZ::Vector3(100.0f, 200.0f, 100.0f));
+        const AZStd::vector<size_t> expectedFarCandidates = { movedAwayIndex };
+        EXPECT_EQ(farCandidates, expectedFarCandidates);
+
+        const AZStd::vector<size_t> rowCandidates = SegmentCandidates(AZ::Vector3(0.0f, 0.0f, 0.0f), AZ::Vector3(0.0f, 100.0f, 0.0f));
+        EXPECT_NE(AZStd::find(rowCandidates.begin(), rowCandidates.end(), movedOntoIndex), rowCandidates.end());
+    }
+
+    TEST_F(EditorVisibleEntityBvhFixture, ScreenRectQueryIncludesEveryPositionInsideTheRect)
+    {
+        const AzFramework::ScreenPoint min(300, 200);
+        const AzFramework::ScreenPoint max(700, 500);
+        const AZStd::vector<size_t> candidates = ScreenRectCandidates(min, max);
+
+        size_t insideCount = 0;
+        for (size_t elementIndex = 0; elementIndex < m_positions.size(); ++elementIndex)
+        {
+            const AzFramework::ScreenPoint screenPosition = AzFramework::WorldToScreen(m_positions[elementIndex], m_cameraState);
+            const bool inside = screenPosition.m_x >= min.m_x && screenPosition.m_x <= max.m_x && screenPosition.m_y >= min.m_y &&
+                screenPosition.m_y <= max.m_y;
+            if (inside)
+            {
+                ++insideCount;
+                EXPECT_NE(AZStd::find(candidates.begin(), candidates.end(), elementIndex), candidates.end());
+            }
+        }
+
+        // the query is conservative but should not return much more than the positions inside the rect
+        EXPECT_GT(insideCount, 0);
+        EXPECT_LT(candidates.size(), m_positions.size() / 2);
+    }
+
+    TEST_F(EditorVisibleEntityBvhFixture, ScreenRectQueryBehindTheCameraReturnsNothing)
+    {
+        // the whole grid is behind the camera after turning it around
+        AzFramework::SetCameraTransform(
+            m_cameraState,
+            AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateRotationZ(AZ::DegToRad(90.0f)), AZ::Vector3(-20.0f, 0.0f, 0.0f)));
+
+        EXPECT_TRUE(ScreenRectCandidates(AzFramework::ScreenPoint(0, 0), AzFramework::ScreenPoint(1024, 768)).empty());
+    }
+} // namespace UnitTest
@@ -8,9 +8,12 @@
 
 #include <Prefab/PrefabTestFixture.h>
 
+#include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzToolsFramework/Entity/EditorEntityHelpers.h>
+#include <AzToolsFramework/Prefab/PrefabDomUtils.h>
 #include <AzToolsFramework/Prefab/Undo/PrefabUndo.h>
 #include <AzToolsFramework/Prefab/Undo/PrefabUndoEntityOverrides.h>
+#include <AzToolsFramework/Prefab/Undo/PrefabUndoUtils.h>
 #include <Prefab/PrefabTestComponent.h>
 
 namespace UnitTest
@@ -208,4 +211,28 @@ namespace UnitTest
         ASSERT_FLOAT_EQ(10.0f, addedEntity->GetTransform()->GetWorldX());
         ASSERT_TRUE(addedEntity->FindComponent<PrefabTestComponent>());
     }
+
+    TEST_F(PrefabUndoEditEntityTests, GenerateAndAppendPatchAndInverse_InversePatchesRestoreBeforeState)
+    {
+        // Cover replaced values, added and removed members, and arrays that shrink and grow.
+        PrefabDom domBeforeUpdate;
+        domBeforeUpdate.Parse(R"({ "Value": 1, "Removed": { "A": 2 }, "Shrinking": [1, 2, 3, 4], "Growing": [5] })");
+        PrefabDom domAfterUpdate;
+        domAfterUpdate.Parse(R"({ "Value": 3, "Added": [6], "Shrinking": [2], "Growing": [7, 8, 9] })");
+        ASSERT_FALSE(domBeforeUpdate.HasParseError());
+        ASSERT_FALSE(domAfterUpdate.HasParseError());
+
+        PrefabDom redoPatches(rapidjson::kArrayType);
+        PrefabDom undoPatches(rapidjson::kArrayType);
+        PrefabUndoUtils::GenerateAndAppendPatchAndInverse(redoPatches, undoPatches, domBeforeUpdate, domAfterUpdate, "");
+        EXPECT_FALSE(undoPatches.Empty());
+
+        PrefabDom dom;
+        dom.CopyFrom(domBeforeUpdate, dom.GetAllocator());
+        PrefabDomUtils::ApplyPatches(dom, dom.GetAllocator(), redoPatches);
+        EXPECT_EQ(AZ::JsonSerialization::Compare(dom, domAfterUpdate), AZ::JsonSerializerCompareResult::Equal);
+
+        PrefabDomUtils::ApplyPatches(dom, dom.GetAllocator(), undoPatches);
+        EXPECT_EQ(AZ::JsonSerialization::Compare(dom, domBeforeUpdate), AZ::JsonSerializerCompareResult::Equal);
+    }
 } // namespace UnitTest
@@ -25,6 +25,25 @@ namespace UnitTest
         EXPECT_TRUE(GetRuntimeEntity("EditorAndRuntime"));
     }
 
+    TEST_F(SpawnableRemoveEditorInfoTests, SpawnableRemoveEditorInfo_ParallelExport_OnlyRuntimeEntitiesExported)
+    {
+        // Create enough entities to split the export across several jobs, with every third entity flagged as Editor-Only.
+        constexpr int EntityCount = 200;
+        for (int i = 0; i < EntityCount; ++i)
+        {
+            CreateSourceEntity(AZStd::string::format("Entity%i", i).c_str(), (i % 3) == 0);
+        }
+
+        m_editorInfoRemover.SetExportEntitiesInParallel(true);
+        ConvertRuntimePrefab();
+
+        for (int i = 0; i < EntityCount; ++i)
+        {
+            const bool isExported = GetRuntimeEntity(AZStd::string::format("Entity%i", i).c_str()) != nullptr;
+            EXPECT_EQ(isExported, (i % 3) != 0);
+        }
+    }
+
     TEST_F(SpawnableRemoveEditorInfoTests, SpawnableRemoveEditorInfo_RuntimeComponentExportedSuccessfully)
     {
         // Create a component with RuntimeExportCallback and successfully exports itself.
@@ -126,4 +126,51 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SQLiteTest, NestedTransactions_RollbackOfInnerTransaction_KeepsOuterTransaction)
+    {
+        ASSERT_TRUE(m_database->IsOpen());
+
+        m_database->AddStatement("CreateKeptTable", "CREATE TABLE KeptTable(rowID INTEGER PRIMARY KEY);");
+        m_database->AddStatement("CreateRolledBackTable", "CREATE TABLE RolledBackTable(rowID INTEGER PRIMARY KEY);");
+        m_database->AddStatement("CreateInnerTable", "CREATE TABLE InnerTable(rowID INTEGER PRIMARY KEY);");
+
+        {
+            SQLite::ScopedTransaction outerTransaction(m_database.get());
+            EXPECT_TRUE(m_database->ExecuteOneOffStatement("CreateKeptTable"));
+
+            {
+                // not committed, so it gets rolled back when it goes out of scope.
+                SQLite::ScopedTransaction innerTransaction(m_database.get());
+                EXPECT_TRUE(m_database->ExecuteOneOffStatement("CreateRolledBackTable"));
+            }
+
+            {
+                SQLite::ScopedTransaction innerTransaction(m_database.get());
+                EXPECT_TRUE(m_database->ExecuteOneOffStatement("CreateInnerTable"));
+                innerTransaction.Commit();
+            }
+
+            EXPECT_TRUE(m_database->DoesTableExist("KeptTable"));
+            EXPECT_FALSE(m_database->DoesTableExist("RolledBackTable"));
+            EXPECT_TRUE(m_database->DoesTableExist("InnerTable"));
+            outerTransaction.Commit();
+        }
+
+        EXPECT_TRUE(m_database->DoesTableExist("KeptTable"));
+        EXPECT_FALSE(m_database->DoesTableExist("RolledBackTable"));
+        EXPECT_TRUE(m_database->DoesTableExist("InnerTable"));
+
+        {
+            // Rolling back the outer transaction also discards the inner transactions that were committed in it.
+            SQLite::ScopedTransaction outerTransaction(m_database.get());
+            {
+                SQLite::ScopedTransaction innerTransaction(m_database.get());
+                EXPECT_TRUE(m_database->ExecuteOneOffStatement("CreateRolledBackTable"));
+                innerTransaction.Commit();
+            }
+        }
+
+        EXPECT_FALSE(m_database->DoesTableExist("RolledBackTable"));
+    }
+
 }
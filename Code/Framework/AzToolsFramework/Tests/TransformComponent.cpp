@@ -11,11 +11,13 @@
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformUpdateQueue.h>
 
 #include <AzToolsFramework/Application/ToolsApplication.h>
 #include <AzToolsFramework/UnitTest/AzToolsFrameworkTestHelpers.h>
@@ -855,6 +857,133 @@ namespace UnitTest
         EXPECT_FALSE(previousWorldTM.IsClose(nextWorldTM));
     }
 
+    // Fixture with a parent, child and grandchild whose transform updates are deferred to the TransformUpdateQueue.
+    class DeferredTransformUpdates
+        : public TransformComponentApplication
+        , public TransformNotificationBus::MultiHandler
+        , public TransformUpdateNotificationBus::Handler
+    {
+    protected:
+        void SetUp() override
+        {
+            TransformComponentApplication::SetUp();
+
+            auto settingsRegistry = AZ::SettingsRegistry::Get();
+            ASSERT_NE(settingsRegistry, nullptr);
+            settingsRegistry->Set(DeferredTransformUpdatesKey, true);
+            m_updateQueue.Connect();
+            ASSERT_EQ(AZ::Interface<ITransformUpdateQueue>::Get(), &m_updateQueue);
+
+            for (size_t i = 0; i < EntityCount; ++i)
+            {
+                m_entities[i] = aznew Entity();
+                m_entities[i]->Init();
+                AZ::TransformConfig config;
+                config.m_parentId = i > 0 ? m_entities[i - 1]->GetId() : EntityId();
+                m_entities[i]->CreateComponent<TransformComponent>()->SetConfiguration(config);
+                m_entities[i]->Activate();
+                TransformNotificationBus::MultiHandler::BusConnect(m_entities[i]->GetId());
+            }
+            TransformUpdateNotificationBus::Handler::BusConnect();
+        }
+
+        void TearDown() override
+        {
+            TransformUpdateNotificationBus::Handler::BusDisconnect();
+            TransformNotificationBus::MultiHandler::BusDisconnect();
+            for (size_t i = EntityCount; i > 0; --i)
+            {
+                m_entities[i - 1]->Deactivate();
+                delete m_entities[i - 1];
+            }
+            m_updateQueue.Disconnect();
+            AZ::SettingsRegistry::Get()->Remove(DeferredTransformUpdatesKey);
+
+            TransformComponentApplication::TearDown();
+        }
+
+        void OnTransformChanged(const Transform& /*local*/, const Transform& /*world*/) override
+        {
+            m_notifiedIds.push_back(*TransformNotificationBus::GetCurrentBusId());
+        }
+
+        void OnTransformsUpdated(const TransformUpdateBatch& batch) override
+        {
+            m_batchIds.assign(batch.m_entityIds.begin(), batch.m_entityIds.end());
+            ++m_batchCount;
+        }
+
+        Transform GetWorldTM(size_t index)
+        {
+            return m_entities[index]->GetTransform()->GetWorldTM();
+        }
+
+        static constexpr size_t EntityCount = 3;
+        Entity* m_entities[EntityCount] = {};
+        TransformUpdateQueue m_updateQueue;
+        AZStd::vector<EntityId> m_notifiedIds;
+        AZStd::vector<EntityId> m_batchIds;
+        int m_batchCount = 0;
+    };
+
+    TEST_F(DeferredTransformUpdates, SetWorldTM_UpdatesDescendantsWhenProcessed)
+    {
+        const Transform parentTM = Transform::CreateTranslation(Vector3(1.0f, 2.0f, 3.0f));
+        m_entities[0]->GetTransform()->SetWorldTM(parentTM);
+
+        // The moved entity is up to date right away, its descendants and listeners only once the queue is processed.
+        EXPECT_THAT(GetWorldTM(0), IsClose(parentTM));
+        EXPECT_THAT(GetWorldTM(2), IsClose(Transform::CreateIdentity()));
+        EXPECT_TRUE(m_notifiedIds.empty());
+
+        m_updateQueue.ProcessTransformUpdates();
+
+        EXPECT_THAT(GetWorldTM(1), IsClose(parentTM));
+        EXPECT_THAT(GetWorldTM(2), IsClose(parentTM));
+    }
+
+    TEST_F(DeferredTransformUpdates, RepeatedChanges_NotifyEachEntityOnceInHierarchyOrder)
+    {
+        m_entities[2]->GetTransform()->SetLocalTM(Transform::CreateTranslation(Vector3(0.0f, 0.0f, 1.0f)));
+        m_entities[0]->GetTransform()->SetWorldTM(Transform::CreateTranslation(Vector3(1.0f, 0.0f, 0.0f)));
+        m_entities[0]->GetTransform()->SetWorldTM(Transform::CreateTranslation(Vector3(2.0f, 0.0f, 0.0f)));
+        m_updateQueue.ProcessTransformUpdates();
+
+        const AZStd::vector<EntityId> expectedIds = { m_entities[0]->GetId(), m_entities[1]->GetId(), m_entities[2]->GetId() };
+        EXPECT_EQ(m_notifiedIds, expectedIds);
+        EXPECT_EQ(m_batchIds, expectedIds);
+        EXPECT_EQ(m_batchCount, 1);
+        EXPECT_THAT(GetWorldTM(2), IsClose(Transform::CreateTranslation(Vector3(2.0f, 0.0f, 1.0f))));
+
+        // Nothing is sent if nothing moved since the last update.
+        m_updateQueue.ProcessTransformUpdates();
+        EXPECT_EQ(m_batchCount, 1);
+    }
+
+    TEST_F(DeferredTransformUpdates, ChildSetInWorldSpace_KeepsWorldTMWhenParentMoves)
+    {
+        const Transform childTM = Transform::CreateTranslation(Vector3(0.0f, 5.0f, 0.0f));
+        m_entities[1]->GetTransform()->SetWorldTM(childTM);
+        m_entities[0]->GetTransform()->SetWorldTM(Transform::CreateTranslation(Vector3(3.0f, 0.0f, 0.0f)));
+        m_updateQueue.ProcessTransformUpdates();
+
+        EXPECT_THAT(GetWorldTM(1), IsClose(childTM));
+        EXPECT_THAT(m_entities[1]->GetTransform()->GetLocalTM(), IsClose(Transform::CreateTranslation(Vector3(-3.0f, 5.0f, 0.0f))));
+        EXPECT_THAT(GetWorldTM(2), IsClose(childTM));
+    }
+
+    TEST_F(DeferredTransformUpdates, DeactivatedBeforeProcessing_IsNotNotified)
+    {
+        m_entities[2]->GetTransform()->SetLocalTM(Transform::CreateTranslation(Vector3(0.0f, 0.0f, 1.0f)));
+        m_entities[2]->Deactivate();
+        m_updateQueue.ProcessTransformUpdates();
+
+        EXPECT_TRUE(m_notifiedIds.empty());
+        EXPECT_EQ(m_batchCount, 0);
+
+        m_entities[2]->Activate();
+    }
+
     // Fixture that loads a TransformComponent from a buffer.
     // Useful for testing version converters.
     class TransformComponentVersionConverter
@@ -35,6 +35,7 @@ set(FILES
     EditorVertexSelectionTests.cpp
     EditorViewportIconTests.cpp
     EditorViewportHelperTests.cpp
+    EditorVisibleEntityBvhTests.cpp
     Entity/EditorEntityContextComponentTests.cpp
     Entity/EditorEntityHelpersTests.cpp
     Entity/EditorEntitySearchComponentTests.cpp
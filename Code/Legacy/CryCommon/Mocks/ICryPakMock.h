@@ -27,6 +27,7 @@ struct CryPakMock
     MOCK_METHOD5(OpenPack, bool(AZStd::string_view, AZStd::string_view, AZStd::intrusive_ptr<AZ::IO::MemoryBlock>, AZ::IO::FixedMaxPathString*, bool));
     MOCK_METHOD2(OpenPacks, bool(AZStd::string_view pWildcard, AZStd::vector<AZ::IO::FixedMaxPathString>* pFullPaths));
     MOCK_METHOD3(OpenPacks, bool(AZStd::string_view pBindingRoot, AZStd::string_view pWildcard, AZStd::vector<AZ::IO::FixedMaxPathString>* pFullPaths));
+    MOCK_METHOD3(OpenPackBatch, bool(AZStd::string_view pBindingRoot, AZStd::span<const AZStd::string_view> packPaths, AZStd::vector<AZ::IO::FixedMaxPathString>* pFullPaths));
     MOCK_METHOD1(ClosePack, bool(AZStd::string_view pName));
     MOCK_METHOD1(ClosePacks, bool(AZStd::string_view pWildcard));
     MOCK_METHOD1(FindPacks, bool(AZStd::string_view pWildcardIn));
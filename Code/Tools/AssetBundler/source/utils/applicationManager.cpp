@@ -331,6 +331,7 @@ namespace AssetBundler
             OutputBundlePathArg,
             BundleVersionArg,
             MaxBundleSizeArg,
+            LoadOrderTraceArg,
             PlatformArg,
             PrintFlag,
             VerboseFlag,
@@ -1093,6 +1094,17 @@ namespace AssetBundler
             params.m_maxBundleSizeInMB = AZStd::stoi(parser->GetSwitchValue(MaxBundleSizeArg, 0));
         }
 
+        // Read in Load Order Trace arg
+        argOutcome = GetFilePathArg(parser, LoadOrderTraceArg, BundleSettingsCommand);
+        if (!argOutcome.IsSuccess())
+        {
+            return AZ::Failure(argOutcome.GetError());
+        }
+        if (!argOutcome.GetValue().empty())
+        {
+            params.m_loadOrderTraceFile = FilePath(argOutcome.GetValue());
+        }
+
         // Read in Print flag
         params.m_print = parser->HasSwitch(PrintFlag);
 
@@ -2089,6 +2101,22 @@ namespace AssetBundler
                 bundleSettings.m_maxBundleSizeInMB = params.m_maxBundleSizeInMB;
             }
 
+            // Load Order Trace
+            AZStd::string loadOrderTracePath = params.m_loadOrderTraceFile.AbsolutePath();
+            if (!loadOrderTracePath.empty())
+            {
+                if (!AZ::IO::FileIOBase::GetInstance()->Exists(loadOrderTracePath.c_str()))
+                {
+                    AZ_Error(AppWindowName, false, "Cannot set Load Order Trace file to ( %s ): file does not exist.", loadOrderTracePath.c_str());
+                    return false;
+                }
+
+                // Make the path relative to the engine root folder before saving
+                AZ::StringFunc::Replace(loadOrderTracePath, GetEngineRoot(), "");
+
+                bundleSettings.m_loadOrderTracePath = loadOrderTracePath;
+            }
+
             // Print
             if (params.m_print)
             {
@@ -2097,7 +2125,8 @@ namespace AssetBundler
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Asset List file: %s\n", bundleSettings.m_assetFileInfoListPath.c_str());
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Output Bundle path: %s\n", bundleSettings.m_bundleFilePath.c_str());
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Bundle Version: %i\n", bundleSettings.m_bundleVersion);
-                AZ_TracePrintf(AssetBundler::AppWindowName, "    Max Bundle Size: %u MB\n\n", bundleSettings.m_maxBundleSizeInMB);
+                AZ_TracePrintf(AssetBundler::AppWindowName, "    Max Bundle Size: %u MB\n", bundleSettings.m_maxBundleSizeInMB);
+                AZ_TracePrintf(AssetBundler::AppWindowName, "    Load Order Trace file: %s\n\n", bundleSettings.m_loadOrderTracePath.c_str());
             }
 
             // Save
@@ -2833,6 +2862,7 @@ namespace AssetBundler
         AZ_Printf(AppWindowName, "    --%-25s-Determines which version of Open 3D Engine Bundles to generate. Current version is (%i).\n", BundleVersionArg, AzFramework::AssetBundleManifest::CurrentBundleVersion);
         AZ_Printf(AppWindowName, "    --%-25s-Sets the maximum size for a single Bundle (in MB). Default size is (%i MB).\n", MaxBundleSizeArg, AssetBundleSettings::GetMaxBundleSizeInMB());
         AZ_Printf(AppWindowName, "%-31s---Bundles larger than this limit will be divided into a series of smaller Bundles and named accordingly.\n", "");
+        AZ_Printf(AppWindowName, "    --%-25s-Sets the Streamer trace used to order the files in the Bundles by the order they are loaded in.\n", LoadOrderTraceArg);
         AZ_Printf(AppWindowName, "    --%-25s-Specifies the platform(s) referenced by all Bundle Settings operations.\n", PlatformArg);
         AZ_Printf(AppWindowName, "%-31s---Defaults to all enabled platforms. Platforms can be changed by modifying AssetProcessorPlatformConfig.setreg.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Outputs the contents of the Bundle Settings file after modifying any specified values.\n", PrintFlag);
@@ -122,6 +122,8 @@ namespace AssetBundler
         FilePath m_assetListFile;
         FilePath m_outputBundlePath;
 
+        FilePath m_loadOrderTraceFile;
+
         int m_bundleVersion = -1;
         int m_maxBundleSizeInMB = -1;
 
@@ -96,6 +96,7 @@ namespace AssetBundler
     const char* OutputBundlePathArg = "outputBundlePath";
     const char* BundleVersionArg = "bundleVersion";
     const char* MaxBundleSizeArg = "maxSize";
+    const char* LoadOrderTraceArg = "loadOrderTrace";
 
     // Bundles
     const char* BundlesCommand = "bundles";
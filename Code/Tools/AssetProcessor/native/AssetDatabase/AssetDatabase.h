@@ -45,6 +45,11 @@ namespace AssetProcessor
         }
         void VacuumAndAnalyze();
 
+        //! Groups the writes made until CommitTransaction into a single transaction, so they share a single commit.
+        //! Writes that open their own transaction in between become part of this one.
+        void BeginTransaction();
+        void CommitTransaction();
+
     protected:
         void CreateStatements() override;
         bool PostOpenDatabase(bool ignoreFutureAssetDBVersionError) override;
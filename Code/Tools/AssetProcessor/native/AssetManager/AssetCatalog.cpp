@@ -125,7 +125,7 @@ namespace AssetProcessor
 
             if (m_registryBuiltOnce)
             {
-                Q_EMIT SendAssetMessage(message);
+                QueueAssetMessage(AZStd::move(message));
             }
         }
         else if (message.m_type == AssetNotificationMessage::AssetRemoved)
@@ -146,7 +146,7 @@ namespace AssetProcessor
 
                 if (m_registryBuiltOnce)
                 {
-                    Q_EMIT SendAssetMessage(message);
+                    QueueAssetMessage(AZStd::move(message));
                 }
             }
         }
@@ -290,33 +290,19 @@ namespace AssetProcessor
         if (m_catalogIsDirty)
         {
             m_catalogIsDirty = false;
-            // Reflect registry for serialization.
-            AZ::SerializeContext* serializeContext = nullptr;
-            AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
-            AZ_Assert(serializeContext, "Unable to retrieve serialize context.");
-            if (nullptr == serializeContext->FindClassData(AZ::AzTypeInfo<AzFramework::AssetRegistry>::Uuid()))
-            {
-                AzFramework::AssetRegistry::ReflectSerialize(serializeContext);
-            }
 
             // save out a catalog for each platform
             for (const QString& platform : m_platforms)
             {
                 // Serialize out the catalog to a memory buffer, and then dump that memory buffer to stream.
+                // The catalog is written in the binary catalog format, which loads much faster at runtime than an ObjectStream.
+                // We re-use the save buffer each time to reduce memory load.
                 QElapsedTimer timer;
                 timer.start();
-                m_saveBuffer.clear();
-                // allow this to grow by up to 20mb at a time so as not to fragment.
-                // we re-use the save buffer each time to further reduce memory load.
-                AZ::IO::ByteContainerStream<AZStd::vector<char>> catalogFileStream(&m_saveBuffer, 1024 * 1024 * 20);
-
-                // these 3 lines are what writes the entire registry to the memory stream
-                AZ::ObjectStream* objStream = AZ::ObjectStream::Create(&catalogFileStream, *serializeContext, AZ::ObjectStream::ST_BINARY);
                 {
                     QMutexLocker locker(&m_registriesMutex);
-                    objStream->WriteClass(&m_registries[platform]);
+                    m_registries[platform].SaveToBinaryCatalog(m_saveBuffer);
                 }
-                objStream->Finalize();
 
                 // now write the memory stream out to the temp folder
                 QString workSpace;
@@ -718,12 +704,63 @@ namespace AssetProcessor
 
         if (m_registryBuiltOnce)
         {
-            Q_EMIT SendAssetMessage(message);
+            QueueAssetMessage(AZStd::move(message));
         }
 
         m_catalogIsDirty = true;
     }
 
+    void AssetCatalog::QueueAssetMessage(AzFramework::AssetSystem::AssetNotificationMessage message)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_queuedAssetMessagesMutex);
+        m_queuedAssetMessages[QString::fromUtf8(message.m_platform.c_str())][message.m_assetId] = AZStd::move(message);
+
+        // Notifications arrive on the thread of the AssetProcessorManager, so they are collected until the catalog thread gets to send them.
+        if (!m_sendQueuedAssetMessagesPending)
+        {
+            m_sendQueuedAssetMessagesPending = true;
+            QMetaObject::invokeMethod(this, "SendQueuedAssetMessages", Qt::QueuedConnection);
+        }
+    }
+
+    void AssetCatalog::SendQueuedAssetMessages()
+    {
+        using namespace AzFramework::AssetSystem;
+
+        QHash<QString, QueuedAssetMessages> queuedAssetMessages;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_queuedAssetMessagesMutex);
+            queuedAssetMessages.swap(m_queuedAssetMessages);
+            m_sendQueuedAssetMessagesPending = false;
+        }
+
+        for (auto platformIter = queuedAssetMessages.begin(); platformIter != queuedAssetMessages.end(); ++platformIter)
+        {
+            BulkAssetNotificationMessage removedMessages;
+            removedMessages.m_type = AssetNotificationMessage::AssetRemoved;
+            removedMessages.m_isCatalogInitialize = false;
+            BulkAssetNotificationMessage changedMessages;
+            changedMessages.m_type = AssetNotificationMessage::AssetChanged;
+            changedMessages.m_isCatalogInitialize = false;
+
+            for (auto& queuedMessage : platformIter.value())
+            {
+                BulkAssetNotificationMessage& bulkMessage =
+                    queuedMessage.second.m_type == AssetNotificationMessage::AssetRemoved ? removedMessages : changedMessages;
+                bulkMessage.m_messages.push_back(AZStd::move(queuedMessage.second));
+            }
+
+            for (const BulkAssetNotificationMessage* bulkMessage : { &removedMessages, &changedMessages })
+            {
+                if (!bulkMessage->m_messages.empty())
+                {
+                    AssetProcessor::ConnectionBus::Broadcast(
+                        &AssetProcessor::ConnectionBus::Events::SendPerPlatform, 0, *bulkMessage, platformIter.key());
+                }
+            }
+        }
+    }
+
     void AssetCatalog::OnConnect(unsigned int connectionId, QStringList platforms)
     {
         // Send out a message for each asset to make sure the connected tools are aware of the existence of all previously built assets
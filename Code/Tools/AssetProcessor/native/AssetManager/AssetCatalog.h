@@ -11,6 +11,8 @@
 #if !defined(Q_MOC_RUN)
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <QObject>
 #include <QString>
 #include <QTimer>
@@ -60,8 +62,6 @@ namespace AssetProcessor
         virtual ~AssetCatalog();
 
     Q_SIGNALS:
-        // outgoing message to the network
-        void SendAssetMessage(AzFramework::AssetSystem::AssetNotificationMessage message);
         void AsyncAssetCatalogStatusResponse(AssetCatalogStatus status);
         void CatalogLoaded();
 
@@ -72,6 +72,8 @@ namespace AssetProcessor
         void OnConnect(unsigned int connectionId, QStringList platforms);
 
         void SaveRegistry_Impl();
+        //! Sends the queued asset notifications to the connected tools, as one bulk message per platform and notification type.
+        void SendQueuedAssetMessages();
         virtual AzFramework::AssetSystem::GetUnresolvedDependencyCountsResponse HandleGetUnresolvedDependencyCountsRequest(MessageData<AzFramework::AssetSystem::GetUnresolvedDependencyCountsRequest> messageData);
         virtual void HandleSaveAssetCatalogRequest(MessageData<AzFramework::AssetSystem::SaveAssetCatalogRequest> messageData);
         void BuildRegistry();
@@ -159,6 +161,9 @@ namespace AssetProcessor
 
         bool CheckValidatedAssets(AZ::Data::AssetId assetId, const QString& platform);
 
+        //! Queues a notification for the connected tools and schedules SendQueuedAssetMessages if it isn't already.
+        void QueueAssetMessage(AzFramework::AssetSystem::AssetNotificationMessage message);
+
         //! For lookups that don't provide a specific platform, provide a default platform to use.
         QString GetDefaultAssetPlatform();
 
@@ -210,5 +215,12 @@ namespace AssetProcessor
         AZStd::unordered_multimap<AZ::Data::AssetId, QString> m_cachedNoPreloadDependenyAssetList;
 
         AZStd::vector<char> m_saveBuffer; // so that we don't realloc all the time
+
+        // Asset notifications waiting to be sent to the connected tools, per platform.
+        // Only the last notification of each asset is kept, so an asset that changes several times before the queue gets sent is only sent once.
+        using QueuedAssetMessages = AZStd::unordered_map<AZ::Data::AssetId, AzFramework::AssetSystem::AssetNotificationMessage>;
+        AZStd::mutex m_queuedAssetMessagesMutex;
+        QHash<QString, QueuedAssetMessages> m_queuedAssetMessages;
+        bool m_sendQueuedAssetMessagesPending = false;
     };
 }
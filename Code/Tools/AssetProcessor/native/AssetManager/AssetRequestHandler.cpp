@@ -384,6 +384,17 @@ void AssetRequestHandler::HandleRequestEscalateAsset(MessageData<RequestEscalate
     }
 }
 
+void AssetRequestHandler::HandleRequestPrefetchAssets(MessageData<RequestPrefetchAssets> messageData)
+{
+    AZStd::unordered_set<AZ::Uuid> prefetchAssetUUIDs(messageData.m_message->m_assetUuids.begin(), messageData.m_message->m_assetUuids.end());
+    prefetchAssetUUIDs.erase(AZ::Uuid::CreateNull());
+
+    if (!prefetchAssetUUIDs.empty())
+    {
+        Q_EMIT RequestPrefetchAssetsByUuid(messageData.m_platform, AZStd::move(prefetchAssetUUIDs));
+    }
+}
+
 bool AssetRequestHandler::InvokeHandler(MessageData<AzFramework::AssetSystem::BaseAssetProcessorMessage> messageData)
 {
     // This function checks to see whether the incoming message is either one of those request, which require decoding the type of message and then invoking the appropriate EBUS handler.
@@ -523,6 +534,7 @@ AssetRequestHandler::AssetRequestHandler()
     m_requestRouter.RegisterMessageHandler(&HandleAssetChangeReportRequest);
 
     m_requestRouter.RegisterMessageHandler(ToFunction(&AssetRequestHandler::HandleRequestEscalateAsset));
+    m_requestRouter.RegisterMessageHandler(ToFunction(&AssetRequestHandler::HandleRequestPrefetchAssets));
 }
 
 QString AssetRequestHandler::CreateFenceFile(unsigned int fenceId)
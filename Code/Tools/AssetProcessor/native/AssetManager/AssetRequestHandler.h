@@ -210,6 +210,7 @@ Q_SIGNALS:
 
         void RequestEscalateAssetByUuid(QString platform, AZ::Uuid escalatedAssetUUID);
         void RequestEscalateAssetBySearchTerm(QString platform, QString escalatedSearchTerm);
+        void RequestPrefetchAssetsByUuid(QString platform, AZStd::unordered_set<AZ::Uuid> prefetchAssetUUIDs);
 
     public Q_SLOTS:
         //! ProcessGetAssetStatus - someone on the network wants to know about the status of an asset.
@@ -276,6 +277,7 @@ Q_SIGNALS:
         void SendAssetStatus(NetworkRequestID groupID, unsigned int type, AssetStatus status);
 
         void HandleRequestEscalateAsset(MessageData<AzFramework::AssetSystem::RequestEscalateAsset> messageData);
+        void HandleRequestPrefetchAssets(MessageData<AzFramework::AssetSystem::RequestPrefetchAssets> messageData);
 
         // we keep state about a request in this class:
         class AssetRequestLine
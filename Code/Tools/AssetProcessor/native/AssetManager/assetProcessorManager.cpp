@@ -46,6 +46,17 @@ namespace AssetProcessor
 
     constexpr AZStd::size_t s_lengthOfUuid = 38;
 
+    //! Name of the stat the duration of a ProcessJob gets recorded under
+    QString GetProcessJobStatKey(const JobEntry& jobEntry)
+    {
+        return QString("ProcessJob,%1,%2,%3,%4,%5")
+            .arg(jobEntry.m_sourceAssetReference.ScanFolderPath().c_str())
+            .arg(jobEntry.m_sourceAssetReference.RelativePath().c_str())
+            .arg(jobEntry.m_jobKey)
+            .arg(jobEntry.m_platformInfo.m_identifier.c_str())
+            .arg(jobEntry.m_builderGuid.ToString<AZStd::string>().c_str());
+    }
+
     using namespace AzToolsFramework::AssetSystem;
     using namespace AzFramework::AssetSystem;
 
@@ -239,12 +250,7 @@ namespace AssetProcessor
         }
         else
         {
-            QString statKey = QString("ProcessJob,%1,%2,%3,%4,%5")
-                                  .arg(jobEntry.m_sourceAssetReference.ScanFolderPath().c_str())
-                                  .arg(jobEntry.m_sourceAssetReference.RelativePath().c_str())
-                                  .arg(jobEntry.m_jobKey)
-                                  .arg(jobEntry.m_platformInfo.m_identifier.c_str())
-                                  .arg(jobEntry.m_builderGuid.ToString<AZStd::string>().c_str());
+            QString statKey = GetProcessJobStatKey(jobEntry);
 
             if (status == JobStatus::InProgress)
             {
@@ -265,6 +271,10 @@ namespace AssetProcessor
 
                 if (operationDuration)
                 {
+                    JobDiagnosticRequestBus::Broadcast(
+                        &JobDiagnosticRequestBus::Events::RecordJobDuration,
+                        statKey.toUtf8().constData(),
+                        aznumeric_cast<AZ::s64>(operationDuration.value()));
                     Q_EMIT JobProcessDurationChanged(jobEntry, aznumeric_cast<int>(operationDuration.value()));
                 }
 
@@ -1227,6 +1237,10 @@ namespace AssetProcessor
             // note that the cache stores products WITH the name of the platform in it so you don't have to do anything
             // to those strings to process them.
 
+            // The source, job, product and dependency rows of a job are written in one transaction, instead of one per row.
+            // This is committed before the job is reported as finished below, so readers on other connections see all of it.
+            m_stateData->BeginTransaction();
+
             //create/update the source record for this job
             AzToolsFramework::AssetDatabase::SourceDatabaseEntry source;
             auto sourceUuidOutcome = AssetUtilities::GetSourceUuid(processedAsset.m_entry.m_sourceAssetReference);
@@ -1669,6 +1683,8 @@ namespace AssetProcessor
                 }
             }
 
+            m_stateData->CommitTransaction();
+
             QString fullSourcePath = processedAsset.m_entry.GetAbsoluteSourcePath();
 
             // notify the system about inputs:
@@ -3913,6 +3929,7 @@ namespace AssetProcessor
         // Check to see whether we need to process this asset
         if (AnalyzeJob(job))
         {
+            job.m_lastDurationMs = GetLastJobDuration(job.m_jobEntry);
             Q_EMIT AssetToProcess(job);
         }
         else
@@ -3922,6 +3939,25 @@ namespace AssetProcessor
         }
     }
 
+    AZ::s64 AssetProcessorManager::GetLastJobDuration(const JobEntry& jobEntry)
+    {
+        const AZStd::string statKey = GetProcessJobStatKey(jobEntry).toUtf8().constData();
+
+        AZ::s64 durationMs = -1;
+        JobDiagnosticRequestBus::BroadcastResult(durationMs, &JobDiagnosticRequestBus::Events::GetJobDuration, statKey);
+        if (durationMs < 0)
+        {
+            // Durations of previous sessions are only in the database, so cache the ones found there.
+            AzToolsFramework::AssetDatabase::StatDatabaseEntryContainer stats;
+            if (m_stateData->GetStatByStatName(statKey.c_str(), stats) && !stats.empty())
+            {
+                durationMs = stats.front().m_statValue;
+                JobDiagnosticRequestBus::Broadcast(&JobDiagnosticRequestBus::Events::RecordJobDuration, statKey, durationMs);
+            }
+        }
+        return durationMs;
+    }
+
     bool AssetProcessorManager::IsInCacheFolder(AZ::IO::PathView path) const
     {
         return AssetUtilities::IsInCacheFolder(path, m_normalizedCacheRootPath.toUtf8().constData());
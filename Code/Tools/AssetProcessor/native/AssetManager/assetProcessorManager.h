@@ -488,6 +488,9 @@ namespace AssetProcessor
         //! Analyzes and forward the job to the RCController if the job requires processing
         void ProcessJob(JobDetails& jobDetails);
 
+        //! Returns how long the job took the last time it was processed, in this session or a previous one, or -1 if it never ran
+        AZ::s64 GetLastJobDuration(const JobEntry& jobEntry);
+
         // Returns true if the path is inside the Cache and *not* inside the Intermediate Assets folder
         bool IsInCacheFolder(AZ::IO::PathView path) const;
 
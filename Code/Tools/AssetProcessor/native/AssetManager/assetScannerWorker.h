@@ -43,9 +43,25 @@ Q_SIGNALS:
         void StopScan();
 
     protected:
-        // scanFolderInfo - the folder we're currently scanning (this will sometimes be a fake scanfolder created when recursing through directories)
-        // rootScanFolder - the actual scan folder we started with, which will either be the same as scanFolderInfo or a parent folder
-        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
+        //! A single directory to list, with the scan folder it was found in
+        struct DirectoryToScan
+        {
+            QString m_path;
+            const ScanFolderInfo* m_rootScanFolder = nullptr;
+        };
+
+        //! Files, folders and excluded entries found by one scanning thread
+        struct ScanResults
+        {
+            QSet<AssetFileInfo> m_fileList;
+            QSet<AssetFileInfo> m_folderList;
+            QSet<AssetFileInfo> m_excludedList;
+        };
+
+        //! Walks all scan folders, with every directory that is found being listed by the next free scanning thread
+        void ScanForSourceFiles();
+        //! Lists the entries of one directory, adding the sub directories that need to be scanned to subDirectories
+        void ScanDirectory(const DirectoryToScan& directory, ScanResults& results, AZStd::vector<DirectoryToScan>& subDirectories) const;
         void EmitFiles();
 
     private:
@@ -54,6 +70,11 @@ Q_SIGNALS:
         QSet<AssetFileInfo> m_folderList;
         QSet<AssetFileInfo> m_excludedList;
 
+        // Cache locations, computed once per scan since every directory gets checked against them
+        QString m_normalizedCachePath;
+        QString m_normalizedIntermediateAssetsFolder;
+        AZ::IO::Path m_cachePath;
+
         PlatformConfiguration* m_platformConfiguration;
     };
 } // end namespace AssetProcessor
@@ -76,6 +76,7 @@ namespace AssetProcessor
         ProcessAssetRequestSyncEscalation = 200,
         ProcessAssetRequestStatusEscalation = 150,
         AssetJobRequestEscalation = 100,
+        PrefetchAssetHintEscalation = 50,
         Default = 0
     };
     //! This enum stores all the different asset processor status values
@@ -220,6 +221,9 @@ namespace AssetProcessor
 
         bool m_critical = false;
         int m_priority = -1;
+        // how long this job took in milliseconds the last time it was processed, or -1 if it never ran.
+        // Longer jobs are started first, so a build doesn't end up waiting on a single long job.
+        AZ::s64 m_lastDurationMs = -1;
         // indicates whether we need to check the server first for the outputs of this job
         // before we start processing locally
         bool m_checkServer = false;
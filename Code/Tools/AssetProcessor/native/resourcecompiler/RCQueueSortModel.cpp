@@ -279,6 +279,16 @@ namespace AssetProcessor
             return leftJob->GetJobEntry().m_jobRunKey < rightJob->GetJobEntry().m_jobRunKey;
         }
 
+        // Start the jobs that took longest last time first. With many builders running in parallel, this keeps a long job
+        // from being picked up last and leaving the other builders idle while it finishes.
+        AZ::s64 durationLeft = leftJob->GetLastDurationMs();
+        AZ::s64 durationRight = rightJob->GetLastDurationMs();
+
+        if (durationLeft != durationRight)
+        {
+            return durationLeft > durationRight;
+        }
+
         // if we get all the way down here it means we're dealing with two assets which are not
         // in any compile groups, not a priority platform, not a priority type, priority platform, etc.
         // we can arrange these any way we want, but must pick at least a stable order.
@@ -437,6 +437,18 @@ namespace AssetProcessor
         // and its fine if none are in the build queue.
     }
 
+    void RCController::OnPrefetchJobsBySourceUUIDs(QString platform, AZStd::unordered_set<AZ::Uuid> sourceUuids)
+    {
+        AssetProcessor::JobIdEscalationList escalationList;
+        m_RCJobListModel.PerformPrefetchSearch(sourceUuids, platform, escalationList);
+
+        if (!escalationList.isEmpty())
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "OnPrefetchJobsBySourceUUIDs: %d jobs moved ahead for %s\n", escalationList.size(), platform.toUtf8().constData());
+            m_RCQueueSortModel.OnEscalateJobs(escalationList);
+        }
+    }
+
     void RCController::OnJobComplete(JobEntry completeEntry, AzToolsFramework::AssetSystem::JobStatus state)
     {
         if (m_activeCompileGroups.empty())
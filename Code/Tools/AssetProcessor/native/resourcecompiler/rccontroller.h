@@ -89,6 +89,8 @@ namespace AssetProcessor
 
         void OnEscalateJobsBySearchTerm(QString platform, QString searchTerm);
         void OnEscalateJobsBySourceUUID(QString platform, AZ::Uuid sourceUuid);
+        //! Moves the queued jobs of the given sources ahead of the regular jobs, without overtaking the explicitly escalated ones.
+        void OnPrefetchJobsBySourceUUIDs(QString platform, AZStd::unordered_set<AZ::Uuid> sourceUuids);
 
         void DispatchJobs();
         void DispatchJobsImpl();
@@ -273,6 +273,11 @@ namespace AssetProcessor
         return m_jobDetails.m_priority;
     }
 
+    AZ::s64 RCJob::GetLastDurationMs() const
+    {
+        return m_jobDetails.m_lastDurationMs;
+    }
+
     const AZStd::vector<AssetProcessor::JobDependencyInternal>& RCJob::GetJobDependencies()
     {
         return m_jobDetails.m_jobDependencyList;
@@ -531,8 +536,39 @@ namespace AssetProcessor
                                  builderParams.m_processJobRequest.m_platformInfo.m_identifier.c_str())
                             .arg(builderParams.m_rcJob->GetOriginalFingerprint());
                         bool operationResult = false;
-                        if (assetServerMode == AssetServerMode::Server)
+                        if (assetServerMode == AssetServerMode::Client || assetServerMode == AssetServerMode::ReadWrite)
+                        {
+                            // running as client, check with the server whether it has already
+                            // processed this asset, if not or if the operation fails then process locally
+                            AssetProcessor::AssetServerBus::BroadcastResult(operationResult, &AssetProcessor::AssetServerBusTraits::RetrieveJobResult, builderParams);
+
+                            if (operationResult)
+                            {
+                                operationResult = AfterRetrievingJobResult(builderParams, jobLogTraceListener, result);
+                            }
+                            else
+                            {
+                                AZ_TracePrintf(AssetProcessor::DebugChannel, "Unable to get job (%s, %s, %s) with fingerprint (%u) from the server. Processing locally.\n",
+                                    builderParams.m_rcJob->GetJobEntry().m_sourceAssetReference.AbsolutePath().c_str(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+                                    builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
+                            }
+
+                            if (operationResult)
+                            {
+                                for (auto& product : result.m_outputProducts)
+                                {
+                                    product.m_outputFlags |= AssetBuilderSDK::ProductOutputFlags::CachedAsset;
+                                }
+                            }
+
+                            runProcessJob = !operationResult;
+                        }
+
+                        // In read/write mode, jobs that weren't on the server get processed locally and then shared with everyone else.
+                        if (runProcessJob && (assetServerMode == AssetServerMode::Server || assetServerMode == AssetServerMode::ReadWrite))
                         {
+                            operationResult = false;
+                            result.m_outputProducts.clear();
                             // sending process job command to the builder
                             builderParams.m_assetBuilderDesc.m_processJobFunction(builderParams.m_processJobRequest, result);
                             runProcessJob = false;
@@ -563,33 +599,6 @@ namespace AssetProcessor
                                 }
                             }
                         }
-                        else if (assetServerMode == AssetServerMode::Client)
-                        {
-                            // running as client, check with the server whether it has already
-                            // processed this asset, if not or if the operation fails then process locally
-                            AssetProcessor::AssetServerBus::BroadcastResult(operationResult, &AssetProcessor::AssetServerBusTraits::RetrieveJobResult, builderParams);
-
-                            if (operationResult)
-                            {
-                                operationResult = AfterRetrievingJobResult(builderParams, jobLogTraceListener, result);
-                            }
-                            else
-                            {
-                                AZ_TracePrintf(AssetProcessor::DebugChannel, "Unable to get job (%s, %s, %s) with fingerprint (%u) from the server. Processing locally.\n",
-                                    builderParams.m_rcJob->GetJobEntry().m_sourceAssetReference.AbsolutePath().c_str(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
-                                    builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
-                            }
-
-                            if (operationResult)
-                            {
-                                for (auto& product : result.m_outputProducts)
-                                {
-                                    product.m_outputFlags |= AssetBuilderSDK::ProductOutputFlags::CachedAsset;
-                                }
-                            }
-
-                            runProcessJob = !operationResult;
-                        }
                     }
 
                     if(runProcessJob)
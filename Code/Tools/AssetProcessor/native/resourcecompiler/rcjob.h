@@ -250,6 +250,7 @@ namespace AssetProcessor
         bool IsCritical() const;
         bool IsAutoFail() const;
         int GetPriority() const;
+        AZ::s64 GetLastDurationMs() const;
         const AZStd::vector<JobDependencyInternal>& GetJobDependencies();
 
     protected:
@@ -588,5 +588,27 @@ namespace AssetProcessor
             }
         }
     }
+
+    void RCJobListModel::PerformPrefetchSearch(const AZStd::unordered_set<AZ::Uuid>& sourceUuids, QString platform, AssetProcessor::JobIdEscalationList& escalationList)
+    {
+        for (const RCJob* rcJob : m_jobs)
+        {
+            if ((platform != rcJob->GetPlatformInfo().m_identifier.c_str()) || (rcJob->GetState() != RCJob::pending))
+            {
+                continue;
+            }
+
+            // a hint must never lower the escalation of a job that something is already waiting on.
+            if (rcJob->JobEscalation() >= AssetProcessor::JobEscalation::PrefetchAssetHintEscalation)
+            {
+                continue;
+            }
+
+            if (sourceUuids.find(rcJob->GetJobEntry().m_sourceFileUUID) != sourceUuids.end())
+            {
+                escalationList.append(qMakePair(rcJob->GetJobEntry().m_jobRunKey, static_cast<int>(AssetProcessor::JobEscalation::PrefetchAssetHintEscalation)));
+            }
+        }
+    }
 }// namespace AssetProcessor
 
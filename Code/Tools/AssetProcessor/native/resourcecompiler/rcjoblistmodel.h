@@ -17,6 +17,8 @@
 #include <QMultiMap>
 
 #include "rcjob.h"
+
+#include <AzCore/std/containers/unordered_set.h>
 #endif
 
 namespace AssetProcessor
@@ -91,6 +93,8 @@ namespace AssetProcessor
 
         void PerformHeuristicSearch(QString searchTerm, QString platform, QSet<QueueElementID>& found, AssetProcessor::JobIdEscalationList& escalationList, bool isStatusRequest, int searchRules = 0);
         void PerformUUIDSearch(AZ::Uuid searchUuid, QString platform, QSet<QueueElementID>& found, AssetProcessor::JobIdEscalationList& escalationList, bool isStatusRequest);
+        //! Finds the pending jobs of any of the given sources which are not escalated above a prefetch hint yet.
+        void PerformPrefetchSearch(const AZStd::unordered_set<AZ::Uuid>& sourceUuids, QString platform, AssetProcessor::JobIdEscalationList& escalationList);
 
         int itemCount() const;
         RCJob* getItem(int index) const;
@@ -613,6 +613,65 @@ namespace AssetProcessor
         EXPECT_EQ(mockConnection.m_messages, 2); // No extra messages for the pc platform
     }
 
+    struct MockPerPlatformConnection : MockConnection
+    {
+        using MockConnection::MockConnection;
+
+        size_t SendPerPlatform(
+            [[maybe_unused]] unsigned int serial, const AzFramework::AssetSystem::BaseAssetProcessorMessage& message, const QString& platform) override
+        {
+            auto* bulkMessage = azrtti_cast<const BulkAssetNotificationMessage*>(&message);
+
+            EXPECT_TRUE(bulkMessage);
+            EXPECT_FALSE(bulkMessage->m_isCatalogInitialize);
+            EXPECT_EQ(platform, "pc");
+            m_bulkMessages.push_back(*bulkMessage);
+
+            return sizeof(message);
+        }
+
+        AZStd::vector<BulkAssetNotificationMessage> m_bulkMessages;
+    };
+
+    TEST_F(AssetCatalogTestWithProducts, AssetUpdatesAfterRegistryIsBuilt_AreSentCoalesced)
+    {
+        m_data->m_assetCatalog->BuildRegistry();
+
+        AssetNotificationMessage message;
+        message.m_type = AssetNotificationMessage::AssetChanged;
+        message.m_data = "filea.png";
+        message.m_assetId = AZ::Data::AssetId("{4DBBC5A7-ACEE-4084-A435-9CA8AA05B01B}");
+        message.m_assetType = AZ::Data::AssetType("{01E432B8-4252-40F5-86CC-4CB554004C49}");
+        message.m_platform = "pc";
+        message.m_sizeBytes = 10;
+
+        // The same asset changes twice, only its last state needs to be sent.
+        m_data->m_assetCatalog->OnAssetMessage(message);
+        message.m_sizeBytes = 20;
+        m_data->m_assetCatalog->OnAssetMessage(message);
+
+        message.m_data = "fileb.png";
+        message.m_assetId = AZ::Data::AssetId("{29AA7E27-4A80-4443-8DFD-6FC459833BD2}");
+        m_data->m_assetCatalog->OnAssetMessage(message);
+        message.m_type = AssetNotificationMessage::AssetRemoved;
+        m_data->m_assetCatalog->OnAssetMessage(message);
+
+        MockPerPlatformConnection mockConnection(1);
+        m_data->m_assetCatalog->SendQueuedAssetMessages();
+
+        ASSERT_EQ(mockConnection.m_bulkMessages.size(), 2);
+        EXPECT_EQ(mockConnection.m_bulkMessages[0].m_type, AssetNotificationMessage::AssetRemoved);
+        ASSERT_EQ(mockConnection.m_bulkMessages[0].m_messages.size(), 1);
+        EXPECT_EQ(mockConnection.m_bulkMessages[0].m_messages[0].m_data, "fileb.png");
+        EXPECT_EQ(mockConnection.m_bulkMessages[1].m_type, AssetNotificationMessage::AssetChanged);
+        ASSERT_EQ(mockConnection.m_bulkMessages[1].m_messages.size(), 1);
+        EXPECT_EQ(mockConnection.m_bulkMessages[1].m_messages[0].m_sizeBytes, 20);
+
+        // Nothing is left in the queue.
+        m_data->m_assetCatalog->SendQueuedAssetMessages();
+        EXPECT_EQ(mockConnection.m_bulkMessages.size(), 2);
+    }
+
     class AssetCatalogTestRelativeSourcePath : public AssetCatalogTest
     {
     public:
@@ -316,6 +316,7 @@ namespace AssetProcessorMessagesTests
         addPairFunc(new AssetInfoRequest(), new AssetInfoResponse());
         addPairFunc(new AssetDependencyInfoRequest(), new AssetDependencyInfoResponse());
         addRequestFunc(new RequestEscalateAsset());
+        addRequestFunc(new RequestPrefetchAssets());
         addPairFunc(new RequestAssetStatus(), new ResponseAssetStatus());
         addPairFunc(new AssetFingerprintClearRequest(), new AssetFingerprintClearResponse());
 
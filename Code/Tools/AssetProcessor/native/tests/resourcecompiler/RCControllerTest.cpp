@@ -154,6 +154,49 @@ TEST_F(RCcontrollerTest_Cancellation, JobSubmitted_DifferentFingerprint_CancelsT
     }
 }
 
+TEST_F(RCcontrollerTest_Cancellation, PrefetchJobs_PendingJobsOfHintedSources_AreEscalatedWithoutLoweringOthers)
+{
+    using namespace AssetProcessor;
+
+    const AZ::Uuid prefetchedSourceUuid("{A7C1D3AC-24F6-4E8F-9A2B-7C1E20F6C0F1}");
+    const AZ::Uuid escalatedSourceUuid("{5B0D4AE2-81A7-4C2C-B3E6-0F6D9D5E4A44}");
+
+    auto submitJob = [this](const char* sourceFile, const AZ::Uuid& sourceUuid, AZ::u64 jobRunKey)
+    {
+        JobDetails jobDetails;
+        jobDetails.m_jobEntry.m_computedFingerprint = 1;
+        jobDetails.m_jobEntry.m_sourceAssetReference = SourceAssetReference(sourceFile);
+        jobDetails.m_jobEntry.m_sourceFileUUID = sourceUuid;
+        jobDetails.m_jobEntry.m_platformInfo = { "pc", { "desktop", "renderer" } };
+        jobDetails.m_jobEntry.m_jobKey = "tiff";
+        jobDetails.m_jobEntry.m_jobRunKey = jobRunKey;
+        m_rcController->JobSubmitted(jobDetails);
+    };
+
+    submitJob("c:/somepath/prefetched.dds", prefetchedSourceUuid, 10);
+    submitJob("c:/somepath/escalated.dds", escalatedSourceUuid, 11);
+
+    m_rcController->OnEscalateJobsBySourceUUID("pc", escalatedSourceUuid);
+    m_rcController->OnPrefetchJobsBySourceUUIDs("pc", { prefetchedSourceUuid, escalatedSourceUuid });
+
+    for (int idx = 0; idx < m_rcJobListModel->itemCount(); idx++)
+    {
+        RCJob* rcJob = m_rcJobListModel->getItem(idx);
+        if (rcJob->GetJobEntry().m_sourceFileUUID == prefetchedSourceUuid)
+        {
+            EXPECT_EQ(rcJob->JobEscalation(), JobEscalation::PrefetchAssetHintEscalation);
+        }
+        else if (rcJob->GetJobEntry().m_sourceFileUUID == escalatedSourceUuid)
+        {
+            EXPECT_EQ(rcJob->JobEscalation(), JobEscalation::ProcessAssetRequestStatusEscalation);
+        }
+        else
+        {
+            EXPECT_EQ(rcJob->JobEscalation(), JobEscalation::Default);
+        }
+    }
+}
+
 class RCcontrollerTest_Simple
     : public RCcontrollerTest
 {
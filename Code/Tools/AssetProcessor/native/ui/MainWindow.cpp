@@ -721,6 +721,7 @@ void MainWindow::SetupAssetServerTab()
     ui->serverCacheModeOptions->addItem(QString("Inactive"), aznumeric_cast<int>(AssetProcessor::AssetServerMode::Inactive));
     ui->serverCacheModeOptions->addItem(QString("Server"), aznumeric_cast<int>(AssetProcessor::AssetServerMode::Server));
     ui->serverCacheModeOptions->addItem(QString("Client"), aznumeric_cast<int>(AssetProcessor::AssetServerMode::Client));
+    ui->serverCacheModeOptions->addItem(QString("Read/Write"), aznumeric_cast<int>(AssetProcessor::AssetServerMode::ReadWrite));
 
     // Asset Cache Server support button
     QObject::connect(ui->sharedCacheSupport, &QPushButton::clicked, this,
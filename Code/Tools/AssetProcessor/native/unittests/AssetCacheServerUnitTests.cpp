@@ -75,7 +75,12 @@ namespace UnitTest
             {
                 if (input == "/O3DE/AssetProcessor/Settings/Server/cacheServerAddress")
                 {
-                    result = this->m_tempFolder.toUtf8().toStdString().c_str();
+                    result = this->m_serverAddress.isEmpty() ? this->m_tempFolder.toUtf8().toStdString().c_str()
+                                                             : this->m_serverAddress.toUtf8().toStdString().c_str();
+                }
+                else if (input == "/O3DE/AssetProcessor/Settings/Server/assetCacheServerMode")
+                {
+                    result = this->m_cacheServerMode;
                 }
                 return true;
             };
@@ -114,6 +119,8 @@ namespace UnitTest
         MockArchiveCommandsBusHandler m_mockArchiveCommandsBusHandler;
         QString m_tempFolder;
         QString m_fakeSourceFile;
+        QString m_serverAddress;
+        AZStd::string m_cacheServerMode;
         bool m_enableServer = false;
         const char* m_fakeFullname = "/mock_cache/asset_server_key";
         const char* m_fakeFilename = "asset_server_key";
@@ -154,6 +161,35 @@ namespace UnitTest
         EXPECT_TRUE(assetServerHandler.GetRemoteCachingMode() == AssetProcessor::AssetServerMode::Client);
     }
 
+    TEST_F(AssetServerHandlerUnitTest, AssetCacheServer_ConfiguredToRunAsReadWrite_Works)
+    {
+        m_cacheServerMode = "ReadWrite";
+        MockSettingsRegistry();
+
+        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<AZStd::string&>(), ::testing::_)).Times(2);
+        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(1);
+
+        AssetProcessor::AssetServerHandler assetServerHandler;
+        EXPECT_TRUE(assetServerHandler.IsServerAddressValid());
+        EXPECT_TRUE(assetServerHandler.GetRemoteCachingMode() == AssetProcessor::AssetServerMode::ReadWrite);
+    }
+
+    TEST_F(AssetServerHandlerUnitTest, AssetCacheServer_HttpServerAddress_IsValidated)
+    {
+        m_serverAddress = "https://asset-cache.example.com/project";
+        MockSettingsRegistry();
+
+        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<AZStd::string&>(), ::testing::_)).Times(2);
+        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(1);
+
+        AssetProcessor::AssetServerHandler assetServerHandler;
+        EXPECT_TRUE(assetServerHandler.IsServerAddressValid());
+
+        // A url without a host can't be reached, so the previous address is kept.
+        EXPECT_FALSE(assetServerHandler.SetServerAddress("https://"));
+        EXPECT_TRUE(assetServerHandler.IsServerAddressValid());
+    }
+
     TEST_F(AssetServerHandlerUnitTest, AssetCacheServer_ServerStoresZipFile_Works)
     {
         m_enableServer = true;
@@ -12,6 +12,10 @@
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
 #include <AzCore/JSON/pointer.h>
 #include <QDir>
+#include <QEventLoop>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
 
 namespace AssetProcessor
 {
@@ -28,6 +32,77 @@ namespace AssetProcessor
         string.append(buffer.c_str());
     }
 
+    namespace AssetServerHandlerInternal
+    {
+        //! Requests that get no response for this long are aborted, so an unreachable server falls back to processing locally.
+        constexpr int HttpTransferTimeoutMs = 60 * 1000;
+
+        QNetworkRequest CreateRequest(const QUrl& url)
+        {
+            QNetworkRequest request(url);
+            request.setTransferTimeout(HttpTransferTimeoutMs);
+            return request;
+        }
+
+        //! Jobs run on worker threads without an event loop of their own, so the reply is waited on with a local one.
+        bool WaitForReply(QNetworkReply* reply)
+        {
+            if (!reply->isFinished())
+            {
+                QEventLoop eventLoop;
+                QObject::connect(reply, &QNetworkReply::finished, &eventLoop, &QEventLoop::quit);
+                eventLoop.exec();
+            }
+            return reply->error() == QNetworkReply::NoError;
+        }
+
+        bool HttpFileExists(const QUrl& url)
+        {
+            QNetworkAccessManager networkManager;
+            return WaitForReply(networkManager.head(CreateRequest(url)));
+        }
+
+        bool HttpDownloadFile(const QUrl& url, const QString& filePath)
+        {
+            QNetworkAccessManager networkManager;
+            QNetworkReply* reply = networkManager.get(CreateRequest(url));
+            if (!WaitForReply(reply))
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Downloading %s failed (%s).\n",
+                    url.toString().toUtf8().data(), reply->errorString().toUtf8().data());
+                return false;
+            }
+
+            QFile file(filePath);
+            if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(reply->readAll()) < 0)
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Could not write downloaded file %s", filePath.toUtf8().data());
+                return false;
+            }
+            return true;
+        }
+
+        bool HttpUploadFile(const QString& filePath, const QUrl& url)
+        {
+            QFile file(filePath);
+            if (!file.open(QIODevice::ReadOnly))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Could not open %s for uploading", filePath.toUtf8().data());
+                return false;
+            }
+
+            QNetworkAccessManager networkManager;
+            QNetworkReply* reply = networkManager.put(CreateRequest(url), &file);
+            if (!WaitForReply(reply))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Uploading %s failed (%s)",
+                    url.toString().toUtf8().data(), reply->errorString().toUtf8().data());
+                return false;
+            }
+            return true;
+        }
+    }
+
     AssetServerMode CheckServerMode()
     {
         AssetServerMode enableCacheServerMode = AssetServerMode::Inactive;
@@ -57,6 +132,10 @@ namespace AssetProcessor
                 {
                     return AssetServerMode::Client;
                 }
+                else if (assetCacheServerModeValue == "readwrite")
+                {
+                    return AssetServerMode::ReadWrite;
+                }
                 else if (assetCacheServerModeValue != "inactive")
                 {
                     AZ_Warning(AssetProcessor::DebugChannel, false, "Unknown mode for 'assetCacheServerMode' (%s)", assetCacheServerModeValue.c_str());
@@ -87,6 +166,13 @@ namespace AssetProcessor
 
     QString AssetServerHandler::ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams)
     {
+        if (IsHttpServerAddress())
+        {
+            // The job's temp folder has a unique name, so a sibling archive can't collide with other jobs.
+            QString tempJobDirectory = QDir::cleanPath(builderParams.GetTempJobDirectory().c_str());
+            return tempJobDirectory.isEmpty() ? QString() : tempJobDirectory + ".zip";
+        }
+
         QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
         QString assetServerAddress = QDir::toNativeSeparators(QString{m_serverAddress.c_str()});
         if (!assetServerAddress.isEmpty())
@@ -117,6 +203,30 @@ namespace AssetProcessor
         return QString();
     }
 
+    QUrl AssetServerHandler::ComputeArchiveUrl(const AssetProcessor::BuilderParams& builderParams) const
+    {
+        // Mirror the folder layout of network shares, with archives next to each other per source folder.
+        QString archiveFileName = builderParams.GetServerKey() + ".zip";
+        CleanupFilename(archiveFileName);
+        QString sourceFolder = QFileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str()).path();
+        QString url = QString(m_serverAddress.c_str());
+        if (!url.endsWith('/'))
+        {
+            url += '/';
+        }
+        if (!sourceFolder.isEmpty() && sourceFolder != ".")
+        {
+            url += sourceFolder + '/';
+        }
+        return QUrl(url + archiveFileName);
+    }
+
+    bool AssetServerHandler::IsHttpServerAddress() const
+    {
+        QString address{ m_serverAddress.c_str() };
+        return address.startsWith("http://", Qt::CaseInsensitive) || address.startsWith("https://", Qt::CaseInsensitive);
+    }
+
     const char* AssetServerHandler::GetAssetServerModeText(AssetServerMode mode)
     {
         switch (mode)
@@ -124,6 +234,7 @@ namespace AssetProcessor
             case AssetServerMode::Inactive: return "inactive";
             case AssetServerMode::Server: return "server";
             case AssetServerMode::Client: return "client";
+            case AssetServerMode::ReadWrite: return "readwrite";
             default:
                 break;
         }
@@ -145,6 +256,12 @@ namespace AssetProcessor
 
     bool AssetServerHandler::IsServerAddressValid()
     {
+        if (IsHttpServerAddress())
+        {
+            QUrl url{ m_serverAddress.c_str() };
+            return url.isValid() && !url.host().isEmpty();
+        }
+
         QString address{m_serverAddress.c_str()};
         bool isValid = !address.isEmpty() && QDir(address).exists();
         return isValid;
@@ -156,8 +273,20 @@ namespace AssetProcessor
         {
             return;
         }
-        AZ::IO::Path settingsFilePath{ m_serverAddress };
-        settingsFilePath /= "settings.json";
+        AZ::IO::Path settingsFilePath;
+        QUrl settingsUrl;
+        if (IsHttpServerAddress())
+        {
+            // Http servers use a local copy of the settings file, which is uploaded after saving it and downloaded before loading it.
+            settingsFilePath = QDir::temp().filePath("AssetCacheServerSettings.json").toUtf8().data();
+            QString address{ m_serverAddress.c_str() };
+            settingsUrl = QUrl(address.endsWith('/') ? address + "settings.json" : address + "/settings.json");
+        }
+        else
+        {
+            settingsFilePath = m_serverAddress;
+            settingsFilePath /= "settings.json";
+        }
 
         auto* recognizerConfiguration = AZ::Interface<AssetProcessor::RecognizerConfiguration>::Get();
         if (!recognizerConfiguration)
@@ -179,11 +308,21 @@ namespace AssetProcessor
             // save the configuration
             rapidjson::Document recognizerDoc;
             recognizerDoc.Parse(jsonBuffer.c_str());
-            AZ::JsonSerializationUtils::WriteJsonFile(recognizerDoc, settingsFilePath.LexicallyNormal().c_str());
+            auto writeResult = AZ::JsonSerializationUtils::WriteJsonFile(recognizerDoc, settingsFilePath.LexicallyNormal().c_str());
+            if (writeResult.IsSuccess() && !settingsUrl.isEmpty())
+            {
+                AssetServerHandlerInternal::HttpUploadFile(settingsFilePath.c_str(), settingsUrl);
+            }
         }
-        else if (m_assetCachingMode == AssetServerMode::Client)
+        else if (m_assetCachingMode == AssetServerMode::Client || m_assetCachingMode == AssetServerMode::ReadWrite)
         {
-            // load the configuration
+            // load the configuration, read/write mode shares products but leaves the configuration up to the server
+            if (!settingsUrl.isEmpty() && !AssetServerHandlerInternal::HttpDownloadFile(settingsUrl, settingsFilePath.c_str()))
+            {
+                // no log since it is okay to not have a settings file
+                return;
+            }
+
             if (!AZ::IO::SystemFile::Exists(settingsFilePath.c_str()))
             {
                 // no log since it is okay to not have a settings file
@@ -262,7 +401,16 @@ namespace AssetProcessor
             return false;
         }
 
-        if (!QFile::exists(archiveAbsFilePath))
+        const bool isHttpServer = IsHttpServerAddress();
+        if (isHttpServer)
+        {
+            if (!AssetServerHandlerInternal::HttpDownloadFile(ComputeArchiveUrl(builderParams), archiveAbsFilePath))
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Extracting archive operation canceled. Archive could not be downloaded from server. \n");
+                return false;
+            }
+        }
+        else if (!QFile::exists(archiveAbsFilePath))
         {
             // file does not exist on the server
             AZ_TracePrintf(AssetProcessor::DebugChannel, "Extracting archive operation canceled. Archive does not exist on server. \n");
@@ -272,6 +420,10 @@ namespace AssetProcessor
         if (listener.WasQuitRequested() || jobCancelListener.IsCancelled())
         {
             AZ_TracePrintf(AssetProcessor::DebugChannel, "Extracting archive operation canceled. \n");
+            if (isHttpServer)
+            {
+                QFile::remove(archiveAbsFilePath);
+            }
             return false;
         }
         AZ_TracePrintf(AssetProcessor::DebugChannel, "Extracting archive for job (%s, %s, %s) with fingerprint (%u).\n",
@@ -283,6 +435,10 @@ namespace AssetProcessor
             archiveAbsFilePath.toUtf8().data(), builderParams.GetTempJobDirectory());
         bool success = extractResult.valid() ? extractResult.get() : false;
         AZ_Error(AssetProcessor::DebugChannel, success, "Extracting archive operation failed.\n");
+        if (isHttpServer)
+        {
+            QFile::remove(archiveAbsFilePath);
+        }
         return success;
     }
 
@@ -299,12 +455,19 @@ namespace AssetProcessor
             return false;
         }
 
-        if (QFile::exists(archiveAbsFilePath))
+        const bool isHttpServer = IsHttpServerAddress();
+        const QUrl archiveUrl = isHttpServer ? ComputeArchiveUrl(builderParams) : QUrl();
+        if (isHttpServer ? AssetServerHandlerInternal::HttpFileExists(archiveUrl) : QFile::exists(archiveAbsFilePath))
         {
             // file already exists on the server
             AZ_TracePrintf(AssetProcessor::DebugChannel, "Creating archive operation canceled. An archive of this asset already exists on server. \n");
             return true;
         }
+        if (isHttpServer)
+        {
+            // Remove the leftover of an earlier failed upload, so the archive only contains this job's files.
+            QFile::remove(archiveAbsFilePath);
+        }
 
         if (listener.WasQuitRequested() || jobCancelListener.IsCancelled())
         {
@@ -341,6 +504,12 @@ namespace AssetProcessor
             // If so add it to the archive
             AddSourceFilesToArchive(builderParams, archiveAbsFilePath, sourceFileList);
         }
+
+        if (isHttpServer)
+        {
+            success = success && AssetServerHandlerInternal::HttpUploadFile(archiveAbsFilePath, archiveUrl);
+            QFile::remove(archiveAbsFilePath);
+        }
         return success;
     }
 
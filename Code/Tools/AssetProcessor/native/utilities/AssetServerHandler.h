@@ -10,6 +10,7 @@
 
 #include <native/utilities/AssetUtilEBusHelper.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
+#include <QUrl>
 
 namespace AssetProcessor
 {
@@ -17,6 +18,8 @@ namespace AssetProcessor
     inline constexpr const char* CacheServerAddressKey{ "cacheServerAddress" };
 
     //! AssetServerHandler is implementing asset server using network share.
+    //! When the server address is an http or https url the archives are instead downloaded and uploaded with GET and PUT requests,
+    //! which works with any plain http file server, or object storage like S3 behind an endpoint that accepts unsigned requests.
     class AssetServerHandler
         : public AssetServerBus::Handler
     {
@@ -48,7 +51,11 @@ namespace AssetProcessor
         //! Source files intended to be copied into the cache don't go through out temp folder so they need
         //! to be added to the Archive in an additional step
         bool AddSourceFilesToArchive(const AssetProcessor::BuilderParams& builderParams, const QString& archivePath, AZStd::vector<AZStd::string>& sourceFileList);
+        //! For network shares this is the archive on the share, for http servers it's a local copy next to the job's temp folder.
         QString ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams);
+        //! The url of the archive on an http server.
+        QUrl ComputeArchiveUrl(const AssetProcessor::BuilderParams& builderParams) const;
+        bool IsHttpServerAddress() const;
         
     private:
         AssetServerMode m_assetCachingMode = AssetServerMode::Inactive;
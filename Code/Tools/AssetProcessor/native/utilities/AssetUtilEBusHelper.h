@@ -225,7 +225,8 @@ namespace AssetProcessor
     {
         Inactive, //! This mode means the AP is offline; only processing the assets locally
         Server, //! This mode means the AP is writing out the asset products to a remote location
-        Client //! This mode means the AP is attempting to retrieve asset products from a remote location
+        Client, //! This mode means the AP is attempting to retrieve asset products from a remote location
+        ReadWrite //! This mode means the AP retrieves asset products from a remote location, and writes out the ones it had to process locally
     };
     // This EBUS is used to perform Asset Server related tasks.
     class AssetServerBusTraits
@@ -7,6 +7,7 @@
  */
 
 #include <utilities/BuilderManager.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzFramework/API/ApplicationAPI.h>
@@ -20,8 +21,16 @@ namespace AssetProcessor
     //! Time in milliseconds to wait after each message pump cycle
     constexpr int IdleBuilderPumpingDelayMs = 100;
 
+    //! Settings key that allows AssetBuilders started on other machines to connect and take ProcessJob work
+    constexpr const char* AllowRemoteBuildersKey = "/Amazon/AssetProcessor/Settings/BuilderManager/AllowRemoteBuilders";
+
     BuilderManager::BuilderManager(ConnectionManager* connectionManager)
     {
+        if (const auto* settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(m_allowUnmanagedBuilderConnections, AllowRemoteBuildersKey);
+        }
+
         using namespace AZStd::placeholders;
         connectionManager->RegisterService(AssetBuilder::BuilderHelloRequest::MessageType(), AZStd::bind(&BuilderManager::IncomingBuilderPing, this, _1, _2, _3, _4, _5));
 
@@ -98,8 +107,9 @@ namespace AssetProcessor
                         "BuilderManager",
                         false,
                         "Received request ping from builder but could not match uuid %s to list of builders started by this AssetProcessor instance.  "
-                        "If you intended to connect an external builder, please set BuilderManager::m_allowUnmanagedBuilderConnections to true to allow this.",
-                        requestPing.m_uuid.ToString<AZStd::string>().c_str());
+                        "If you intended to connect an external builder, please set %s to true to allow this.",
+                        requestPing.m_uuid.ToString<AZStd::string>().c_str(),
+                        AllowRemoteBuildersKey);
                 }
             }
 
@@ -63,4 +63,15 @@ namespace AssetProcessor
     {
         m_warningLevel = level;
     }
+
+    AZ::s64 JobDiagnosticTracker::GetJobDuration(const AZStd::string& jobStatKey) const
+    {
+        auto durationIter = m_jobDurations.find(jobStatKey);
+        return durationIter != m_jobDurations.end() ? durationIter->second : -1;
+    }
+
+    void JobDiagnosticTracker::RecordJobDuration(const AZStd::string& jobStatKey, AZ::s64 durationMs)
+    {
+        m_jobDurations[jobStatKey] = durationMs;
+    }
 }
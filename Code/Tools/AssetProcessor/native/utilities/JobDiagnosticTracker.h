@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/std/string/string.h>
 #include <native/resourcecompiler/RCCommon.h>
 
 namespace AssetProcessor
@@ -46,6 +47,11 @@ namespace AssetProcessor
         virtual void RecordDiagnosticInfo(AZ::u64 jobRunKey, JobDiagnosticInfo info) = 0;
         virtual WarningLevel GetWarningLevel() const = 0;
         virtual void SetWarningLevel(WarningLevel level) = 0;
+
+        //! Returns how long in milliseconds the job with the given ProcessJob stat key took the last time it ran, or -1 if unknown.
+        //! Used to schedule long jobs first, so builders aren't left waiting on a single long job at the end of a build.
+        virtual AZ::s64 GetJobDuration(const AZStd::string& jobStatKey) const = 0;
+        virtual void RecordJobDuration(const AZStd::string& jobStatKey, AZ::s64 durationMs) = 0;
     };
 
     using JobDiagnosticRequestBus = AZ::EBus<JobDiagnosticRequests>;
@@ -61,8 +67,11 @@ namespace AssetProcessor
         void RecordDiagnosticInfo(AZ::u64 jobRunKey, JobDiagnosticInfo info) override;
         WarningLevel GetWarningLevel() const override;
         void SetWarningLevel(WarningLevel level) override;
+        AZ::s64 GetJobDuration(const AZStd::string& jobStatKey) const override;
+        void RecordJobDuration(const AZStd::string& jobStatKey, AZ::s64 durationMs) override;
 
         WarningLevel m_warningLevel = WarningLevel::Default;
         AZStd::unordered_map<AZ::u64, JobDiagnosticInfo> m_jobInfo;
+        AZStd::unordered_map<AZStd::string, AZ::s64> m_jobDurations;
     };
 } // namespace AssetProcessor
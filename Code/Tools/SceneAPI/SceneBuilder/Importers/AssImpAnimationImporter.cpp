@@ -140,6 +140,7 @@ namespace AZ
             AssImpAnimationImporter::AssImpAnimationImporter()
             {
                 BindToCall(&AssImpAnimationImporter::ImportAnimation);
+                BindToCall(&AssImpAnimationImporter::ClearSceneAnimations);
             }
 
             void AssImpAnimationImporter::Reflect(ReflectContext* context)
@@ -253,25 +254,32 @@ namespace AZ
             {
                 return AZStd::make_pair(animation, anim);
             }
-            Events::ProcessingResult AssImpAnimationImporter::ImportAnimation(AssImpSceneNodeAppendedContext& context)
+
+            //! The animation channels of a scene, by the name of the node they animate.
+            struct AssImpAnimationImporter::SceneAnimations
             {
-                AZ_TraceContext("Importer", "Animation");
+                using AnimAndMorphAnim = AZStd::pair<const aiAnimation*, const aiMeshMorphAnim*>;
+                using ChannelToMorphAnim = AZStd::unordered_map<AZStd::string, AnimAndMorphAnim>;
+                using NodeToChannelToMorphAnim = AZStd::unordered_map<AZStd::string, ChannelToMorphAnim>;
 
-                const aiNode* currentNode = context.m_sourceNode.GetAssImpNode();
-                const aiScene* scene = context.m_sourceScene.GetAssImpScene();
+                AZStd::unordered_multimap<AZStd::string, AZStd::pair<const aiAnimation*, ConsolidatedNodeAnim>> m_boneAnimations;
+                NodeToChannelToMorphAnim m_meshMorphAnimations;
+                bool m_isValid = true;
+            };
 
-                // Add check for animation layers at the scene level.
-                
-                if (!scene->HasAnimations() || IsPivotNode(currentNode->mName))
+            AssImpAnimationImporter::~AssImpAnimationImporter() = default;
+
+            const AssImpAnimationImporter::SceneAnimations& AssImpAnimationImporter::GetSceneAnimations(const aiScene* scene)
+            {
+                if (m_sceneAnimations && m_sceneAnimationsSource == scene)
                 {
-                    return Events::ProcessingResult::Ignored;
+                    return *m_sceneAnimations;
                 }
 
-                AZStd::unordered_multimap<AZStd::string, AZStd::pair<const aiAnimation*, ConsolidatedNodeAnim>> boneAnimations;
-                typedef AZStd::pair<const aiAnimation*, const aiMeshMorphAnim*> AnimAndMorphAnim;
-                typedef AZStd::unordered_map<AZStd::string, AnimAndMorphAnim> ChannelToMorphAnim;
-                typedef AZStd::unordered_map<AZStd::string, ChannelToMorphAnim> NodeToChannelToMorphAnim;
-                NodeToChannelToMorphAnim meshMorphAnimations;
+                m_sceneAnimations = AZStd::make_unique<SceneAnimations>();
+                m_sceneAnimationsSource = scene;
+                auto& boneAnimations = m_sceneAnimations->m_boneAnimations;
+                auto& meshMorphAnimations = m_sceneAnimations->m_meshMorphAnimations;
 
                 // Goes through all the animation channels of a given type and adds them to a map so we can easily find
                 // all the animations for a given node
@@ -299,7 +307,8 @@ namespace AZ
                             "AnimationImporter", false,
                             "Animation name %s has a sample rate of 0 ticks per second and cannot be processed.",
                             animation->mName.C_Str());
-                        return Events::ProcessingResult::Failure;
+                        m_sceneAnimations->m_isValid = false;
+                        return *m_sceneAnimations;
                     }
                     
                     mapAnimationsFunc(animation->mNumChannels, animation->mChannels, animation, boneAnimations);
@@ -328,7 +337,7 @@ namespace AZ
 
                         AZStd::string meshNodeName(meshNodeNameAndChannel[0]);
                         AZStd::string channel(meshNodeNameAndChannel[1]);
-                        meshMorphAnimations[meshNodeName][channel] = AnimAndMorphAnim(animation, nodeAnim);
+                        meshMorphAnimations[meshNodeName][channel] = SceneAnimations::AnimAndMorphAnim(animation, nodeAnim);
                     }
                 }
 
@@ -383,70 +392,6 @@ namespace AZ
                     boneAnimations.swap(combinedAnimations);
                 }
 
-                Events::ProcessingResultCombiner combinedAnimationResult;
-                if (context.m_sourceNode.ContainsMesh())
-                {
-                    const aiMesh* firstMesh = scene->mMeshes[currentNode->mMeshes[0]];
-                    if (NodeToChannelToMorphAnim::iterator channelsForMeshName = meshMorphAnimations.find(firstMesh->mName.C_Str());
-                        channelsForMeshName != meshMorphAnimations.end())
-                    {
-                        const auto [nodeIterName, channels] = *channelsForMeshName;
-                        for (const auto& [channel, animAndMorphAnim] : channels)
-                        {
-                            const auto& [animation, morphAnimation] = animAndMorphAnim;
-                            combinedAnimationResult += ImportBlendShapeAnimation(
-                                context, animation, morphAnimation, firstMesh);
-                        }
-                    }
-                }
-
-                AZStd::string nodeName = s_animationNodeName;
-                RenamedNodesMap::SanitizeNodeName(nodeName, context.m_scene.GetGraph(), context.m_currentGraphPosition);
-                AZ_TraceContext("Animation node name", nodeName);
-
-                // If there are no bone animations, but there are mesh animations,
-                // then a stub animation needs to be created so the exporter can create the exported morph target animation.
-                if (boneAnimations.empty() && !meshMorphAnimations.empty())
-                {
-                    const aiAnimation* animation = scene->mAnimations[0];
-                    for (AZ::u32 channelIndex = 0; channelIndex < animation->mNumMorphMeshChannels; ++channelIndex)
-                    {
-                        const aiMeshMorphAnim* nodeAnim = animation->mMorphMeshChannels[channelIndex];
-                        // Morph animations need a regular animation on the node, as well.
-                        // If there is no bone animation on the current node, then generate one here.
-                        AZStd::shared_ptr<SceneData::GraphData::AnimationData> createdAnimationData =
-                            AZStd::make_shared<SceneData::GraphData::AnimationData>();
-
-                        const size_t numKeyframes = GetNumKeyFrames(
-                            nodeAnim->mNumKeys,
-                            animation->mDuration,
-                            animation->mTicksPerSecond);
-                        createdAnimationData->ReserveKeyFrames(numKeyframes);
-
-                        const double timeStepBetweenFrames = 1.0 / animation->mTicksPerSecond;
-                        createdAnimationData->SetTimeStepBetweenFrames(timeStepBetweenFrames);
-
-                        // Set every frame of the animation to the start location of the node.
-                        aiMatrix4x4 combinedTransform = GetConcatenatedLocalTransform(currentNode);
-                        DataTypes::MatrixType localTransform = AssImpSDKWrapper::AssImpTypeConverter::ToTransform(combinedTransform);
-                        context.m_sourceSceneSystem.SwapTransformForUpAxis(localTransform);
-                        context.m_sourceSceneSystem.ConvertUnit(localTransform);
-                        for (AZ::u32 time = 0; time <= numKeyframes; ++time)
-                        {
-                            createdAnimationData->AddKeyFrame(localTransform);
-                        }
-
-                        AZStd::string stubBoneAnimForMorphName(AZStd::string::format("%s%s", nodeName.c_str(), nodeAnim->mName.C_Str()));
-                        RenamedNodesMap::SanitizeNodeName(stubBoneAnimForMorphName, context.m_scene.GetGraph(), context.m_currentGraphPosition);
-
-                        Containers::SceneGraph::NodeIndex addNode = context.m_scene.GetGraph().AddChild(
-                            context.m_currentGraphPosition, stubBoneAnimForMorphName.c_str(), AZStd::move(createdAnimationData));
-                        context.m_scene.GetGraph().MakeEndPoint(addNode);
-                    }
-                    
-                    return combinedAnimationResult.GetResult();
-                }
-
                 AZStd::unordered_set<AZStd::string> nonPivotBoneList;
 
                 for (unsigned int meshIndex = 0; meshIndex < scene->mNumMeshes; ++meshIndex)
@@ -485,10 +430,12 @@ namespace AZ
 
                 decltype(boneAnimations) fillerAnimations;
 
-                // Go through all the animations and make sure we create placeholder animations for any bones missing them
-                for (auto&& anim : boneAnimations)
+                // Make sure we create placeholder animations for any bones missing them. They're associated with
+                // the first animation that was found.
+                if (!boneAnimations.empty())
                 {
-                    for (auto boneName : nonPivotBoneList)
+                    const aiAnimation* fillerSourceAnimation = boneAnimations.begin()->second.first;
+                    for (const AZStd::string& boneName : nonPivotBoneList)
                     {
                         if (!boneAnimations.contains(boneName) &&
                             !fillerAnimations.contains(boneName))
@@ -515,13 +462,110 @@ namespace AZ
                             emptyAnimation.mScalingKeys = emptyAnimation.m_ownedScalingKeys.data();
                                 
                             fillerAnimations.insert(
-                                AZStd::make_pair(boneName, AZStd::make_pair(anim.second.first, AZStd::move(emptyAnimation))));
+                                AZStd::make_pair(boneName, AZStd::make_pair(fillerSourceAnimation, AZStd::move(emptyAnimation))));
                         }
                     }
                 }
 
                 boneAnimations.insert(AZStd::make_move_iterator(fillerAnimations.begin()), AZStd::make_move_iterator(fillerAnimations.end()));
 
+                return *m_sceneAnimations;
+            }
+
+            Events::ProcessingResult AssImpAnimationImporter::ClearSceneAnimations(AssImpFinalizeSceneContext& /*context*/)
+            {
+                m_sceneAnimations.reset();
+                m_sceneAnimationsSource = nullptr;
+                return Events::ProcessingResult::Ignored;
+            }
+
+            Events::ProcessingResult AssImpAnimationImporter::ImportAnimation(AssImpSceneNodeAppendedContext& context)
+            {
+                AZ_TraceContext("Importer", "Animation");
+
+                const aiNode* currentNode = context.m_sourceNode.GetAssImpNode();
+                const aiScene* scene = context.m_sourceScene.GetAssImpScene();
+
+                // Add check for animation layers at the scene level.
+                
+                if (!scene->HasAnimations() || IsPivotNode(currentNode->mName))
+                {
+                    return Events::ProcessingResult::Ignored;
+                }
+
+                const SceneAnimations& sceneAnimations = GetSceneAnimations(scene);
+                if (!sceneAnimations.m_isValid)
+                {
+                    return Events::ProcessingResult::Failure;
+                }
+                const auto& boneAnimations = sceneAnimations.m_boneAnimations;
+                const SceneAnimations::NodeToChannelToMorphAnim& meshMorphAnimations = sceneAnimations.m_meshMorphAnimations;
+
+                Events::ProcessingResultCombiner combinedAnimationResult;
+                if (context.m_sourceNode.ContainsMesh())
+                {
+                    const aiMesh* firstMesh = scene->mMeshes[currentNode->mMeshes[0]];
+                    if (auto channelsForMeshName = meshMorphAnimations.find(firstMesh->mName.C_Str());
+                        channelsForMeshName != meshMorphAnimations.end())
+                    {
+                        const auto [nodeIterName, channels] = *channelsForMeshName;
+                        for (const auto& [channel, animAndMorphAnim] : channels)
+                        {
+                            const auto& [animation, morphAnimation] = animAndMorphAnim;
+                            combinedAnimationResult += ImportBlendShapeAnimation(
+                                context, animation, morphAnimation, firstMesh);
+                        }
+                    }
+                }
+
+                AZStd::string nodeName = s_animationNodeName;
+                RenamedNodesMap::SanitizeNodeName(nodeName, context.m_scene.GetGraph(), context.m_currentGraphPosition);
+                AZ_TraceContext("Animation node name", nodeName);
+
+                // If there are no bone animations, but there are mesh animations,
+                // then a stub animation needs to be created so the exporter can create the exported morph target animation.
+                if (boneAnimations.empty() && !meshMorphAnimations.empty())
+                {
+                    const aiAnimation* animation = scene->mAnimations[0];
+                    for (AZ::u32 channelIndex = 0; channelIndex < animation->mNumMorphMeshChannels; ++channelIndex)
+                    {
+                        const aiMeshMorphAnim* nodeAnim = animation->mMorphMeshChannels[channelIndex];
+                        // Morph animations need a regular animation on the node, as well.
+                        // If there is no bone animation on the current node, then generate one here.
+                        AZStd::shared_ptr<SceneData::GraphData::AnimationData> createdAnimationData =
+                            AZStd::make_shared<SceneData::GraphData::AnimationData>();
+
+                        const size_t numKeyframes = GetNumKeyFrames(
+                            nodeAnim->mNumKeys,
+                            animation->mDuration,
+                            animation->mTicksPerSecond);
+                        createdAnimationData->ReserveKeyFrames(numKeyframes);
+
+                        const double timeStepBetweenFrames = 1.0 / animation->mTicksPerSecond;
+                        createdAnimationData->SetTimeStepBetweenFrames(timeStepBetweenFrames);
+
+                        // Set every frame of the animation to the start location of the node.
+                        aiMatrix4x4 combinedTransform = GetConcatenatedLocalTransform(currentNode);
+                        DataTypes::MatrixType localTransform = AssImpSDKWrapper::AssImpTypeConverter::ToTransform(combinedTransform);
+                        context.m_sourceSceneSystem.SwapTransformForUpAxis(localTransform);
+                        context.m_sourceSceneSystem.ConvertUnit(localTransform);
+                        for (AZ::u32 time = 0; time <= numKeyframes; ++time)
+                        {
+                            createdAnimationData->AddKeyFrame(localTransform);
+                        }
+
+                        AZStd::string stubBoneAnimForMorphName(AZStd::string::format("%s%s", nodeName.c_str(), nodeAnim->mName.C_Str()));
+                        RenamedNodesMap::SanitizeNodeName(stubBoneAnimForMorphName, context.m_scene.GetGraph(), context.m_currentGraphPosition);
+
+                        Containers::SceneGraph::NodeIndex addNode = context.m_scene.GetGraph().AddChild(
+                            context.m_currentGraphPosition, stubBoneAnimForMorphName.c_str(), AZStd::move(createdAnimationData));
+                        context.m_scene.GetGraph().MakeEndPoint(addNode);
+                    }
+                    
+                    return combinedAnimationResult.GetResult();
+                }
+
+
                 auto animItr = boneAnimations.equal_range(currentNode->mName.C_Str());
 
                 if (animItr.first == animItr.second)
@@ -8,12 +8,14 @@
 
 #pragma once
 
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <SceneAPI/SceneCore/Components/LoadingComponent.h>
 #include <SceneAPI/SceneBuilder/ImportContexts/AssImpImportContexts.h>
 
 struct aiAnimation;
 struct aiMesh;
 struct aiMeshMorphAnim;
+struct aiScene;
 
 namespace AZ
 {
@@ -28,7 +30,7 @@ namespace AZ
                 AZ_COMPONENT(AssImpAnimationImporter, "{93b3f4e3-6fcd-42b9-a74e-5923f76d25c7}", SceneCore::LoadingComponent);
 
                 AssImpAnimationImporter();
-                ~AssImpAnimationImporter() override = default;
+                ~AssImpAnimationImporter() override;
 
                 static void Reflect(ReflectContext* context);
 
@@ -38,11 +40,22 @@ namespace AZ
                     const aiAnimation* animation,
                     const aiMeshMorphAnim* meshMorphAnim,
                     const aiMesh* mesh);
+                Events::ProcessingResult ClearSceneAnimations(AssImpFinalizeSceneContext& context);
 
                 static const double s_defaultTimeStepBetweenFrames;
 
             protected:
                 static const char* s_animationNodeName;
+
+            private:
+                struct SceneAnimations;
+
+                //! Returns the animation channels of the scene by node name. These only depend on the scene, so they're gathered
+                //! when the first node is imported and reused for the other nodes, until the scene is finalized.
+                const SceneAnimations& GetSceneAnimations(const aiScene* scene);
+
+                AZStd::unique_ptr<SceneAnimations> m_sceneAnimations;
+                const aiScene* m_sceneAnimationsSource = nullptr;
             };
         } // namespace SceneBuilder
     } // namespace SceneAPI
@@ -6,7 +6,11 @@
  *
  */
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzToolsFramework/Debug/TraceContext.h>
@@ -125,19 +129,65 @@ namespace AZ
             {
                 AZ_TraceContext("Importer", "Skin Weights");
 
-                for (auto& it : m_pendingSkinWeights)
+                // The pending skin weights of different meshes don't share any data, so they're filled in on job threads.
+                // The pending entries of a mesh stay in their original order, so the bone ids don't depend on the scheduling.
+                AZStd::vector<AZStd::vector<const Pending*>> pendingPerSkinWeightData;
+                AZStd::unordered_map<const SceneData::GraphData::SkinWeightData*, size_t> skinWeightDataIndices;
+                for (const Pending& pending : m_pendingSkinWeights)
                 {
-                    it.m_skinWeightData->ResizeContainerSpace(it.m_numVertices);
-                    int boneId = it.m_skinWeightData->GetBoneId(it.m_sanitizedName);
+                    auto [indexIt, inserted] =
+                        skinWeightDataIndices.emplace(pending.m_skinWeightData.get(), pendingPerSkinWeightData.size());
+                    if (inserted)
+                    {
+                        pendingPerSkinWeightData.emplace_back();
+                    }
+                    pendingPerSkinWeightData[indexIt->second].push_back(&pending);
+                }
 
-                    for(unsigned weight = 0; weight < it.m_bone->mNumWeights; ++weight)
+                auto setupLinks = [](const AZStd::vector<const Pending*>& pendingList)
+                {
+                    for (const Pending* it : pendingList)
                     {
-                        DataTypes::ISkinWeightData::Link link;
-                        link.boneId = boneId;
-                        link.weight = it.m_bone->mWeights[weight].mWeight;
+                        it->m_skinWeightData->ResizeContainerSpace(it->m_numVertices);
+                        int boneId = it->m_skinWeightData->GetBoneId(it->m_sanitizedName);
+
+                        for(unsigned weight = 0; weight < it->m_bone->mNumWeights; ++weight)
+                        {
+                            DataTypes::ISkinWeightData::Link link;
+                            link.boneId = boneId;
+                            link.weight = it->m_bone->mWeights[weight].mWeight;
+
+                            it->m_skinWeightData->AddAndSortLink(it->m_bone->mWeights[weight].mVertexId + it->m_vertOffset, link);
+                        }
+                    }
+                };
 
-                        it.m_skinWeightData->AddAndSortLink(it.m_bone->mWeights[weight].mVertexId + it.m_vertOffset, link);
+                AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+                if (jobContext == nullptr || pendingPerSkinWeightData.size() <= 1)
+                {
+                    for (const AZStd::vector<const Pending*>& pendingList : pendingPerSkinWeightData)
+                    {
+                        setupLinks(pendingList);
+                    }
+                }
+                else
+                {
+                    // The calling thread fills in the first mesh while the jobs fill in the others.
+                    AZ::JobCompletion completion(jobContext);
+                    for (size_t index = 1; index < pendingPerSkinWeightData.size(); ++index)
+                    {
+                        const AZStd::vector<const Pending*>& pendingList = pendingPerSkinWeightData[index];
+                        AZ::Job* setupJob = AZ::CreateJobFunction(
+                            [&setupLinks, &pendingList]()
+                            {
+                                setupLinks(pendingList);
+                            },
+                            true, jobContext);
+                        setupJob->SetDependent(&completion);
+                        setupJob->Start();
                     }
+                    setupLinks(pendingPerSkinWeightData[0]);
+                    completion.StartAndWaitForCompletion();
                 }
                 const auto result = m_pendingSkinWeights.empty() ? Events::ProcessingResult::Ignored : Events::ProcessingResult::Success;
                 m_pendingSkinWeights.clear();
@@ -8,9 +8,9 @@
 
 #include <astcenc.h>
 
-#include <AzCore/Jobs/JobCompletion.h>
-#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/PlatformIncl.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/parallel/atomic.h>
 
 #include <Atom/ImageProcessing/ImageObject.h>
 #include <Compressors/ASTCCompressor.h>
@@ -180,12 +180,10 @@ namespace ImageProcessingAtom
         // Create a context based on the configuration
         astcenc_context* context;
         AZ::u32 blockCount = AZ::DivideAndRoundUp(srcImage->GetWidth(0), dstFormatInfo->blockWidth) * AZ::DivideAndRoundUp(srcImage->GetHeight(0), dstFormatInfo->blockHeight);
-        AZ::u32 threadCount = AZStd::min(AZStd::thread::hardware_concurrency()/2, blockCount);
+        AZ::u32 threadCount = AZStd::clamp(AZStd::thread::hardware_concurrency() / 2, 1u, blockCount);
         status = astcenc_context_alloc(&config, threadCount, &context);
         AZ_Assert( status == ASTCENC_SUCCESS, "ERROR: Codec context alloc failed: %s\n", astcenc_get_error_string(status));
 
-        AZ::Job* currentJob = AZ::JobContext::GetGlobalContext()->GetJobManager().GetCurrentJob();
-
         const astcenc_type dataType =GetAstcDataType(fmtSrc);
 
         // Compress the image for each mips
@@ -209,66 +207,17 @@ namespace ImageProcessingAtom
             dstImage->GetImagePointer(mip, dstMem, dstPitch);
             AZ::u32 dataSize = dstImage->GetMipBufSize(mip);
 
-            if (threadCount == 1)
-            {
-                astcenc_error error = astcenc_compress_image(context, &image, &swizzle, dstMem, dataSize, 0);
-                if (error != ASTCENC_SUCCESS)
-                {
-                    status = error;
-                }
-            }
-            else
-            {
-                AZ::JobCompletion* completionJob = nullptr;
-                if (!currentJob)
-                {
-                    completionJob = aznew AZ::JobCompletion();
-                }
-                // Create jobs for each compression thread
-                for (AZ::u32 threadIdx = 0; threadIdx < threadCount; threadIdx++)
+            // Every thread index of the context has to be used exactly once per image.
+            AZStd::atomic<astcenc_error> jobStatus{ ASTCENC_SUCCESS };
+            RunCompressionJobs(threadCount, [&jobStatus, context, &image, &swizzle, dstMem, dataSize](AZ::u32 threadIdx)
                 {
-                    const auto jobLambda = [&status, context, &image, &swizzle, dstMem, dataSize, threadIdx]()
-                    {
-                        astcenc_error error = astcenc_compress_image(context, &image, &swizzle, dstMem, dataSize, threadIdx);
-                        if (error != ASTCENC_SUCCESS)
-                        {
-                            status = error;
-                        }
-                    };
-
-                    AZ::Job* simulationJob = AZ::CreateJobFunction(AZStd::move(jobLambda), true, nullptr);  //auto-deletes
-
-                    // adds this job as child to current job if there is a current job
-                    // otherwise adds it as a dependent for the complete job
-                    if (currentJob)
-                    {
-                        currentJob->StartAsChild(simulationJob);
-                    }
-                    else
-                    {
-                        simulationJob->SetDependent(completionJob);
-                        simulationJob->Start();
-                    }
-
                     astcenc_error error = astcenc_compress_image(context, &image, &swizzle, dstMem, dataSize, threadIdx);
                     if (error != ASTCENC_SUCCESS)
                     {
-                        status = error;
+                        jobStatus = error;
                     }
-                }
-                
-                if (currentJob)
-                {
-                    currentJob->WaitForChildren();
-                }
-
-                if (completionJob)
-                {
-                    completionJob->StartAndWaitForCompletion();
-                    delete completionJob;
-                    completionJob = nullptr;
-                }
-            }
+                });
+            status = jobStatus;
 
             if (status != ASTCENC_SUCCESS)
             {
@@ -8,6 +8,11 @@
 
 
 #include <AzCore/PlatformIncl.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/function/function_template.h>
 #include <Compressors/ASTCCompressor.h>
 #include <Compressors/CTSquisher.h>
 #include <Compressors/ISPCTextureCompressor.h>
@@ -43,6 +48,51 @@ namespace ImageProcessingAtom
         return nullptr;
     }
 
+    void ICompressor::RunCompressionJobs(AZ::u32 jobCount, const AZStd::function<void(AZ::u32 jobIndex)>& jobFunction)
+    {
+        if (jobCount <= 1)
+        {
+            if (jobCount == 1)
+            {
+                jobFunction(0);
+            }
+            return;
+        }
+
+        AZ::Job* currentJob = AZ::JobContext::GetGlobalContext()->GetJobManager().GetCurrentJob();
+        AZ::JobCompletion completionJob;
+        for (AZ::u32 jobIndex = 1; jobIndex < jobCount; ++jobIndex)
+        {
+            AZ::Job* compressionJob = AZ::CreateJobFunction([&jobFunction, jobIndex]()
+                {
+                    jobFunction(jobIndex);
+                }, true, nullptr); //auto-deletes
+
+            // adds this job as child to current job if there is a current job
+            // otherwise adds it as a dependent for the complete job
+            if (currentJob)
+            {
+                currentJob->StartAsChild(compressionJob);
+            }
+            else
+            {
+                compressionJob->SetDependent(&completionJob);
+                compressionJob->Start();
+            }
+        }
+
+        jobFunction(0);
+
+        if (currentJob)
+        {
+            currentJob->WaitForChildren();
+        }
+        else
+        {
+            completionJob.StartAndWaitForCompletion();
+        }
+    }
+
     ICompressor::~ICompressor()
     {
     }
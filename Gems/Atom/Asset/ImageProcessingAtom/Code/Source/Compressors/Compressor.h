@@ -11,6 +11,7 @@
 #include <Atom/ImageProcessing/ImageProcessingDefines.h>
 #include <Atom/ImageProcessing/PixelFormats.h>
 #include <Atom/ImageProcessing/ImageObject.h>
+#include <AzCore/std/function/function_fwd.h>
 
 namespace ImageProcessingAtom
 {
@@ -52,6 +53,10 @@ namespace ImageProcessingAtom
         //find compressor for specified compressed pixel format. isCompressing to indicate if it's for compressing or decompressing
         static ICompressorPtr FindCompressor(EPixelFormat fmt, ColorSpace colorSpace, bool isCompressing);
 
+        //calls jobFunction for every index in [0, jobCount) on the job system and waits until all of them have finished.
+        //index 0 runs on the calling thread. The jobs are children of the current job if there is one.
+        static void RunCompressionJobs(AZ::u32 jobCount, const AZStd::function<void(AZ::u32 jobIndex)>& jobFunction);
+
         virtual ~ICompressor() = 0;
     };
 }; // namespace ImageProcessingAtom
@@ -7,6 +7,7 @@
  */
 
 
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/function/function_template.h>
 
 #include <Atom/ImageProcessing/ImageObject.h>
@@ -55,6 +56,10 @@ namespace ImageProcessingAtom
         AZStd::function<void(astc_enc_settings*, int block_width, int block_height)>   m_astcAlpha;
     };
 
+    // Height in pixels of the strips that are compressed in parallel, a multiple of the block height.
+    static constexpr int32_t BlockSize = 4;
+    static constexpr int32_t StripHeight = 16 * BlockSize;
+
     bool ISPCCompressor::IsCompressedPixelFormatSupported(EPixelFormat fmt)
     {
         // Even though the ISPC compressor support ASTC formats. But it has restrictions
@@ -182,68 +187,86 @@ namespace ImageProcessingAtom
             }
         }
 
+        // Get the profile settings of the destination format
+        bc6h_enc_settings bc6Settings = {};
+        bc7_enc_settings bc7Settings = {};
+        switch (destinationFormat)
+        {
+        case ePixelFormat_BC3:
+            break;
+        case ePixelFormat_BC6UH:
+            compressionProfile->GetBC6()(&bc6Settings);
+            break;
+        case ePixelFormat_BC7:
+        case ePixelFormat_BC7t:
+            compressionProfile->GetBC7(discardAlpha)(&bc7Settings);
+            break;
+        default:
+            // No valid pixel format
+            AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
+            return nullptr;
+        }
+
         // Allocate the destination image
         IImageObjectPtr destinationImage(sourceImage->AllocateImage(destinationFormat));
 
-        // Compress the images per mip
+        // The compressors are single threaded, so every mip is split into horizontal strips of blocks which are compressed
+        // in parallel. Each strip writes to its own range of the destination, so the result doesn't depend on the scheduling.
+        struct CompressionStrip
+        {
+            rgba_surface m_sourceSurface;
+            AZ::u8* m_destination;
+        };
+        AZStd::vector<CompressionStrip> strips;
+
         const uint32 mipCount = destinationImage->GetMipCount();
         for (uint32_t mip = 0; mip < mipCount; mip++)
         {
-            // Create rgba_surface as input
             uint32 sourcePitch = 0;
             AZ::u8* sourceImageData = nullptr;
             sourceImage->GetImagePointer(mip, sourceImageData, sourcePitch);
-            rgba_surface sourceSurface = {};
-            {
-                sourceSurface.ptr = sourceImageData;
-                sourceSurface.width = sourceImage->GetWidth(mip);
-                sourceSurface.height = sourceImage->GetHeight(mip);
-                sourceSurface.stride = static_cast<int32_t>(sourcePitch);
-            }
+            const int32_t width = static_cast<int32_t>(sourceImage->GetWidth(mip));
+            const int32_t height = static_cast<int32_t>(sourceImage->GetHeight(mip));
 
-            // Get the mip image destination pointer
+            // Get the mip image destination pointer, the pitch is the size of one row of blocks
             uint32_t destinationPitch = 0;
             AZ::u8* destinationImageData = nullptr;
             destinationImage->GetImagePointer(mip, destinationImageData, destinationPitch);
 
+            for (int32_t y = 0; y < height; y += StripHeight)
+            {
+                // Create rgba_surface as input
+                CompressionStrip strip = {};
+                strip.m_sourceSurface.ptr = sourceImageData + y * sourcePitch;
+                strip.m_sourceSurface.width = width;
+                strip.m_sourceSurface.height = AZStd::min(StripHeight, height - y);
+                strip.m_sourceSurface.stride = static_cast<int32_t>(sourcePitch);
+                strip.m_destination = destinationImageData + (y / BlockSize) * destinationPitch;
+                strips.push_back(strip);
+            }
+        }
+
+        const auto compressStrip = [&strips, destinationFormat, &bc6Settings, &bc7Settings](AZ::u32 stripIndex)
+        {
+            CompressionStrip& strip = strips[stripIndex];
+
             // Compress with the correct function, depending on the destination format
             switch (destinationFormat)
             {
             case ePixelFormat_BC3:
-                CompressBlocksBC3(&sourceSurface, destinationImageData);
+                CompressBlocksBC3(&strip.m_sourceSurface, strip.m_destination);
                 break;
             case ePixelFormat_BC6UH:
-            {
-                // Get the profile setter
-                bc6h_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC6();
-                setProfile(&settings);
-
                 // Compress with BC6 half precision
-                CompressBlocksBC6H(&sourceSurface, destinationImageData, &settings);
-            }
-            break;
-            case ePixelFormat_BC7:
-            case ePixelFormat_BC7t:
-            {
-                // Get the profile setter
-                bc7_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC7(discardAlpha);
-                setProfile(&settings);
-
-                // Compress with BC7
-                CompressBlocksBC7(&sourceSurface, destinationImageData, &settings);
-            }
-            break;
+                CompressBlocksBC6H(&strip.m_sourceSurface, strip.m_destination, &bc6Settings);
+                break;
             default:
-            {
-                // No valid pixel format
-                AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
-                return nullptr;
-            }
-            break;
+                // Compress with BC7
+                CompressBlocksBC7(&strip.m_sourceSurface, strip.m_destination, &bc7Settings);
+                break;
             }
-        }
+        };
+        RunCompressionJobs(aznumeric_cast<AZ::u32>(strips.size()), compressStrip);
 
         return destinationImage;
     }
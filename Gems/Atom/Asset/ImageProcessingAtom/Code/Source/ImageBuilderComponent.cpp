@@ -401,7 +401,8 @@ namespace ImageProcessingAtom
                 descriptor.m_jobKey = "Image Compile: " + ext;
                 descriptor.SetPlatformIdentifier(platformInfo.m_identifier.c_str());
                 descriptor.m_critical = false;
-                descriptor.m_additionalFingerprintInfo = "";
+                // Textures compressed with the fast quality get rebuilt with the final quality once the setting is turned off.
+                descriptor.m_additionalFingerprintInfo = IsFastCompressionEnabled() ? "FastCompression" : "";
                 response.m_createJobOutputs.push_back(descriptor);
             }
         }
@@ -21,6 +21,7 @@
 #include <BuilderSettings/PresetSettings.h>
 
 
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/time.h>
 #include <AzCore/StringFunc/StringFunc.h>
 
@@ -594,6 +595,10 @@ namespace ImageProcessingAtom
         {
             quality = ICompressor::eQuality_Preview;
         }
+        else if (m_input->m_useFastCompression)
+        {
+            quality = ICompressor::eQuality_Fast;
+        }
         else
         {
             quality = ICompressor::eQuality_Normal;
@@ -829,6 +834,16 @@ namespace ImageProcessingAtom
         return false;
     }
 
+    bool IsFastCompressionEnabled()
+    {
+        bool fastCompression = false;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(fastCompression, FastCompressionRegistryKey);
+        }
+        return fastCompression;
+    }
+
     ImageConvertProcess* CreateImageConvertProcess(const AZStd::string& imageFilePath, const AZStd::string& exportDir
         , const PlatformName& platformName, AZStd::vector<AssetBuilderSDK::JobProduct>& jobProducts, AZ::SerializeContext* context)
     {
@@ -892,6 +907,7 @@ namespace ImageProcessingAtom
         desc->m_filePath = filePath;
         desc->m_inputImage = srcImage;
         desc->m_isPreview = false;
+        desc->m_useFastCompression = IsFastCompressionEnabled();
         desc->m_isStreaming = BuilderSettingManager::Instance()->GetBuilderSetting(platformName)->m_enableStreaming;
         desc->m_outputFolder = exportDir;
         desc->m_jobProducts = &jobProducts;
@@ -945,6 +961,7 @@ namespace ImageProcessingAtom
         desc->m_filePath = filePath;
         desc->m_inputImage = m_input->m_inputImage;
         desc->m_isPreview = false;
+        desc->m_useFastCompression = m_input->m_useFastCompression;
         desc->m_isStreaming = m_input->m_isStreaming;
         desc->m_outputFolder = m_input->m_outputFolder;
         desc->m_imageName = fileName;
@@ -28,6 +28,13 @@ namespace ImageProcessingAtom
     class IImageObject;
     class ImageToProcess;
 
+    //Settings registry key which makes the builder compress textures with the fast quality, for quick iteration on textures.
+    //The setting is part of the job fingerprint, so turning it off rebuilds the textures with the final quality again.
+    static constexpr char FastCompressionRegistryKey[] = "/O3DE/Atom/ImageBuilder/FastCompression";
+
+    //returns the value of FastCompressionRegistryKey, false if it isn't set
+    bool IsFastCompressionEnabled();
+
     //Convert image file with its image export setting and save to specified folder.
     //this function can be useful for a cancelable job
     class ImageConvertProcess* CreateImageConvertProcess(const AZStd::string& imageFilePath,
@@ -70,6 +77,8 @@ namespace ImageProcessingAtom
         PresetSettings m_presetSetting;
         // If the process is for preview convert result. Some steps will be optimized if it's true
         bool m_isPreview = false;
+        // Compress with the fast quality instead of the normal quality, see FastCompressionRegistryKey
+        bool m_useFastCompression = false;
         // The target platform for the product asset
         AZStd::string m_platform;
         // Path to the original preset file, for debug output
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ShaderCompileCache.h"
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/Utils/Utils.h>
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        static constexpr char ShaderCompileCacheName[] = "ShaderCompileCache";
+
+        namespace
+        {
+            // Identifies the files written by Store(), followed by ShaderCompileCache::Version.
+            constexpr uint32_t FileSignature = 0x43435341; // "ASCC"
+
+            // The memory cache is cleared when it holds more byte code than this, it mostly helps when the same
+            // builder process compiles many variants of one shader in a row.
+            constexpr size_t MaxMemoryCacheBytes = 256 * 1024 * 1024;
+
+            struct MemoryCache
+            {
+                AZStd::mutex m_mutex;
+                AZStd::unordered_map<ShaderCompileCache::Key, RHI::ShaderPlatformInterface::StageDescriptor> m_entries;
+                size_t m_totalBytes = 0;
+            };
+
+            MemoryCache& GetMemoryCache()
+            {
+                static MemoryCache memoryCache;
+                return memoryCache;
+            }
+
+            void HashString(Sha1& sha1, AZStd::string_view value)
+            {
+                // The size separates consecutive strings, so {"ab", "c"} and {"a", "bc"} hash differently.
+                const uint64_t size = value.size();
+                sha1.ProcessBytes(reinterpret_cast<const AZStd::byte*>(&size), sizeof(size));
+                sha1.ProcessBytes(reinterpret_cast<const AZStd::byte*>(value.data()), value.size());
+            }
+
+            void HashArguments(Sha1& sha1, const AZStd::vector<AZStd::string>& arguments)
+            {
+                HashString(sha1, AZStd::string::format("%zu", arguments.size()));
+                for (const AZStd::string& argument : arguments)
+                {
+                    HashString(sha1, argument);
+                }
+            }
+
+            // Returns the file of the entry, or an empty path if there is no cache folder.
+            IO::FixedMaxPath GetCacheFilePath(const ShaderCompileCache::Key& key)
+            {
+                AZ::IO::FixedMaxPathString cacheFolder;
+                auto settingsRegistry = AZ::SettingsRegistry::Get();
+                if (!settingsRegistry || !settingsRegistry->Get(cacheFolder, ShaderCompileCache::ShaderCompileCacheFolderRegistryKey) ||
+                    cacheFolder.empty())
+                {
+                    return {};
+                }
+
+                // Spread the entries over sub folders, shared folders can hold many thousands of them.
+                IO::FixedMaxPath path(cacheFolder);
+                path /= AZStd::string_view(key).substr(0, 2);
+                path /= AZStd::string_view(key);
+                return path;
+            }
+
+            template<class T>
+            void Write(AZStd::vector<AZStd::byte>& buffer, const T& value)
+            {
+                const auto* bytes = reinterpret_cast<const AZStd::byte*>(&value);
+                buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+            }
+
+            template<class Container>
+            void WriteArray(AZStd::vector<AZStd::byte>& buffer, const Container& values)
+            {
+                Write(buffer, static_cast<uint64_t>(values.size()));
+                const auto* bytes = reinterpret_cast<const AZStd::byte*>(values.data());
+                buffer.insert(buffer.end(), bytes, bytes + values.size());
+            }
+
+            class Reader
+            {
+            public:
+                explicit Reader(const AZStd::vector<AZStd::byte>& buffer)
+                    : m_buffer(buffer)
+                {
+                }
+
+                template<class T>
+                bool Read(T& value)
+                {
+                    if (m_offset + sizeof(T) > m_buffer.size())
+                    {
+                        return false;
+                    }
+                    memcpy(&value, m_buffer.data() + m_offset, sizeof(T));
+                    m_offset += sizeof(T);
+                    return true;
+                }
+
+                template<class Container>
+                bool ReadArray(Container& values)
+                {
+                    uint64_t size = 0;
+                    if (!Read(size) || size > m_buffer.size() - m_offset)
+                    {
+                        return false;
+                    }
+                    values.resize(size);
+                    memcpy(values.data(), m_buffer.data() + m_offset, size);
+                    m_offset += size;
+                    return true;
+                }
+
+                bool IsAtEnd() const
+                {
+                    return m_offset == m_buffer.size();
+                }
+
+            private:
+                const AZStd::vector<AZStd::byte>& m_buffer;
+                size_t m_offset = 0;
+            };
+
+            bool LoadFromFile(const IO::FixedMaxPath& path, RHI::ShaderPlatformInterface::StageDescriptor& outputDescriptor)
+            {
+                if (!IO::SystemFile::Exists(path.c_str()))
+                {
+                    return false;
+                }
+
+                auto readResult = AZ::Utils::ReadFile<AZStd::vector<AZStd::byte>>(path.Native());
+                if (!readResult.IsSuccess())
+                {
+                    AZ_Warning(ShaderCompileCacheName, false, "%s", readResult.GetError().c_str());
+                    return false;
+                }
+
+                const AZStd::vector<AZStd::byte>& buffer = readResult.GetValue();
+                Reader reader(buffer);
+                uint32_t signature = 0;
+                uint32_t version = 0;
+                uint32_t stageType = 0;
+                uint32_t dynamicBranchCount = 0;
+                RHI::ShaderPlatformInterface::StageDescriptor descriptor;
+                const bool isValid = reader.Read(signature) && signature == FileSignature && reader.Read(version) &&
+                    version == ShaderCompileCache::Version && reader.Read(stageType) && reader.Read(dynamicBranchCount) &&
+                    reader.ReadArray(descriptor.m_entryFunctionName) && reader.ReadArray(descriptor.m_byteCode) &&
+                    reader.ReadArray(descriptor.m_sourceCode) && reader.IsAtEnd();
+                if (!isValid)
+                {
+                    AZ_Warning(ShaderCompileCacheName, false, "Ignoring invalid shader compile cache entry \"%s\"", path.c_str());
+                    return false;
+                }
+
+                descriptor.m_stageType = static_cast<RHI::ShaderHardwareStage>(stageType);
+                descriptor.m_byProducts.m_dynamicBranchCount = dynamicBranchCount;
+                outputDescriptor = AZStd::move(descriptor);
+                return true;
+            }
+
+            void StoreToFile(const IO::FixedMaxPath& path, const RHI::ShaderPlatformInterface::StageDescriptor& descriptor)
+            {
+                AZStd::vector<AZStd::byte> buffer;
+                buffer.reserve(64 + descriptor.m_entryFunctionName.size() + descriptor.m_byteCode.size() + descriptor.m_sourceCode.size());
+                Write(buffer, FileSignature);
+                Write(buffer, ShaderCompileCache::Version);
+                Write(buffer, static_cast<uint32_t>(descriptor.m_stageType));
+                Write(buffer, descriptor.m_byProducts.m_dynamicBranchCount);
+                WriteArray(buffer, descriptor.m_entryFunctionName);
+                WriteArray(buffer, descriptor.m_byteCode);
+                WriteArray(buffer, descriptor.m_sourceCode);
+
+                const IO::FixedMaxPath folder = path.ParentPath();
+                if (!IO::SystemFile::IsDirectory(folder.c_str()) && !IO::SystemFile::CreateDir(folder.c_str()))
+                {
+                    AZ_Warning(ShaderCompileCacheName, false, "Failed to create shader compile cache folder \"%s\"", folder.c_str());
+                    return;
+                }
+
+                // Write to a unique file first and rename it, so other processes never read a partially written entry.
+                IO::FixedMaxPath tempPath = path;
+                tempPath.ReplaceFilename(IO::PathView(AZ::IO::FixedMaxPathString::format(
+                    "%.*s.%s.tmp", AZ_STRING_ARG(path.Filename().Native()), Uuid::CreateRandom().ToFixedString(false, false).c_str())));
+
+                auto writeResult = AZ::Utils::WriteFile(buffer, tempPath.Native());
+                if (!writeResult.IsSuccess())
+                {
+                    AZ_Warning(ShaderCompileCacheName, false, "%s", writeResult.GetError().c_str());
+                    return;
+                }
+
+                if (!IO::SystemFile::Rename(tempPath.c_str(), path.c_str(), true))
+                {
+                    // Another process may have stored the same entry at the same time, which is fine.
+                    IO::SystemFile::Delete(tempPath.c_str());
+                }
+            }
+        } // namespace
+
+        ShaderCompileCache::Key ShaderCompileCache::CalculateKey(
+            const RHI::ShaderPlatformInterface& shaderPlatformInterface,
+            AZStd::string_view hlslSourceCode,
+            AZStd::string_view functionName,
+            RHI::ShaderHardwareStage shaderStage,
+            const RHI::ShaderBuildArguments& shaderBuildArguments)
+        {
+            Sha1 sha1;
+            HashString(sha1, AZStd::string::format("%u", Version));
+            HashString(sha1, shaderPlatformInterface.GetAPIName().GetStringView());
+            HashString(sha1, hlslSourceCode);
+            HashString(sha1, functionName);
+            HashString(sha1, AZStd::string::format("%u", static_cast<uint32_t>(shaderStage)));
+            HashString(sha1, shaderBuildArguments.m_generateDebugInfo ? "debug" : "release");
+            HashArguments(sha1, shaderBuildArguments.m_preprocessorArguments);
+            HashArguments(sha1, shaderBuildArguments.m_azslcArguments);
+            HashArguments(sha1, shaderBuildArguments.m_dxcArguments);
+            HashArguments(sha1, shaderBuildArguments.m_spirvCrossArguments);
+            HashArguments(sha1, shaderBuildArguments.m_metalAirArguments);
+            HashArguments(sha1, shaderBuildArguments.m_metalLibArguments);
+
+            AZ::u32 digest[5];
+            sha1.GetDigest(digest);
+            return Key::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+        }
+
+        bool ShaderCompileCache::Load(const Key& key, RHI::ShaderPlatformInterface::StageDescriptor& outputDescriptor)
+        {
+            MemoryCache& memoryCache = GetMemoryCache();
+            {
+                AZStd::scoped_lock lock(memoryCache.m_mutex);
+                auto it = memoryCache.m_entries.find(key);
+                if (it != memoryCache.m_entries.end())
+                {
+                    outputDescriptor = it->second;
+                    return true;
+                }
+            }
+
+            const IO::FixedMaxPath path = GetCacheFilePath(key);
+            if (path.empty() || !LoadFromFile(path, outputDescriptor))
+            {
+                return false;
+            }
+
+            Store(key, outputDescriptor);
+            return true;
+        }
+
+        void ShaderCompileCache::Store(const Key& key, const RHI::ShaderPlatformInterface::StageDescriptor& descriptor)
+        {
+            RHI::ShaderPlatformInterface::StageDescriptor cachedDescriptor;
+            cachedDescriptor.m_stageType = descriptor.m_stageType;
+            cachedDescriptor.m_byteCode = descriptor.m_byteCode;
+            cachedDescriptor.m_sourceCode = descriptor.m_sourceCode;
+            cachedDescriptor.m_entryFunctionName = descriptor.m_entryFunctionName;
+            cachedDescriptor.m_byProducts.m_dynamicBranchCount = descriptor.m_byProducts.m_dynamicBranchCount;
+
+            const size_t entryBytes = cachedDescriptor.m_byteCode.size() + cachedDescriptor.m_sourceCode.size();
+            MemoryCache& memoryCache = GetMemoryCache();
+            {
+                AZStd::scoped_lock lock(memoryCache.m_mutex);
+                if (memoryCache.m_entries.contains(key))
+                {
+                    return;
+                }
+                if (memoryCache.m_totalBytes + entryBytes > MaxMemoryCacheBytes)
+                {
+                    memoryCache.m_entries.clear();
+                    memoryCache.m_totalBytes = 0;
+                }
+                memoryCache.m_entries.emplace(key, cachedDescriptor);
+                memoryCache.m_totalBytes += entryBytes;
+            }
+
+            const IO::FixedMaxPath path = GetCacheFilePath(key);
+            if (!path.empty() && !IO::SystemFile::Exists(path.c_str()))
+            {
+                StoreToFile(path, cachedDescriptor);
+            }
+        }
+    } // ShaderBuilder
+} // AZ
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/string/fixed_string.h>
+#include <AzCore/std/string/string_view.h>
+
+#include <Atom/RHI.Edit/ShaderPlatformInterface.h>
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        //! Content addressed cache for the results of RHI::ShaderPlatformInterface::CompilePlatformInternal().
+        //! Many variants of a shader, and often the same shader on several platforms, end up compiling exactly the same
+        //! HLSL with the same arguments. The cache key is a hash of everything that goes into the compiler, so those
+        //! compilations only run once.
+        //! Results are always kept in memory for the lifetime of the builder process. When the settings registry key
+        //! @ShaderCompileCacheFolderRegistryKey is set, they are also stored in that folder, which can be shared between
+        //! builder processes and between machines.
+        class ShaderCompileCache
+        {
+        public:
+            static constexpr char ShaderCompileCacheFolderRegistryKey[] = "/O3DE/Atom/Shaders/Build/CompileCacheFolder";
+
+            //! Change this value when the output of the shader compilers changes in a way that isn't covered by the key,
+            //! for example after updating DXC, so stale binaries from shared cache folders are not used anymore.
+            static constexpr uint32_t Version = 1;
+
+            //! SHA-1 digest of the compiler inputs, as a hexadecimal string.
+            using Key = AZStd::fixed_string<40>;
+
+            //! Hashes the complete source code that is passed to the compiler together with the arguments that affect its output.
+            //! The target platform isn't part of the key, so platforms that use the same RHI and arguments share the results.
+            //! RHIs that compile with state that isn't covered by the key must not use the cache,
+            //! see RHI::ShaderPlatformInterface::VariantCompilationRequiresSrgLayoutData().
+            static Key CalculateKey(
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface,
+                AZStd::string_view hlslSourceCode,
+                AZStd::string_view functionName,
+                RHI::ShaderHardwareStage shaderStage,
+                const RHI::ShaderBuildArguments& shaderBuildArguments);
+
+            //! Fills the byte code, source code and stage of @outputDescriptor from the cache.
+            //! The by-products of the original compilation, like intermediate files, are not restored.
+            //! @returns false if there is no entry for the key.
+            static bool Load(const Key& key, RHI::ShaderPlatformInterface::StageDescriptor& outputDescriptor);
+
+            //! Stores the result of a successful compilation.
+            static void Store(const Key& key, const RHI::ShaderPlatformInterface::StageDescriptor& descriptor);
+        };
+    } // ShaderBuilder
+} // AZ
@@ -53,6 +53,7 @@
 #include "HashedVariantListSourceData.h"
 #include "ShaderAssetBuilder.h"
 #include "ShaderBuilderUtility.h"
+#include "ShaderCompileCache.h"
 #include "SrgLayoutUtility.h"
 #include "AzslData.h"
 #include "AzslCompiler.h"
@@ -869,12 +870,13 @@ namespace AZ
             }
 
             AZStd::string variantShaderSourcePath;
+            AZStd::string variantShaderSourceString;
             // Check if we need to prepend any code prefix
             if (!hlslCodeToPrependForVariant.empty())
             {
                 // Prepend any shader code prefix that we should apply to this variant
                 // and save it back to a file.
-                AZStd::string variantShaderSourceString(hlslCodeToPrependForVariant);
+                variantShaderSourceString = hlslCodeToPrependForVariant;
                 variantShaderSourceString += creationContext.m_hlslSourceContent;
 
                 AZStd::string shaderAssetName = AZStd::string::format(
@@ -893,6 +895,15 @@ namespace AZ
             {
                 variantShaderSourcePath = creationContext.m_hlslSourcePath;
             }
+            const AZStd::string_view variantShaderSourceCode =
+                hlslCodeToPrependForVariant.empty() ? AZStd::string_view(creationContext.m_hlslSourceContent) : variantShaderSourceString;
+
+            // Variants often compile to exactly the same code, so compilation results are shared through the ShaderCompileCache.
+            // Debug builds and register analysis need the intermediate files of the compilers, and RHIs that compile with the
+            // SRG layouts depend on state that isn't part of the cache key.
+            const bool useCompileCache = !creationContext.m_shaderBuildArguments.m_generateDebugInfo &&
+                !shaderVariantInfo.m_enableRegisterAnalysis &&
+                !creationContext.m_shaderPlatformInterface.VariantCompilationRequiresSrgLayoutData();
 
             AZ_TracePrintf(ShaderVariantAssetBuilderName, "Variant StableId: %u", shaderVariantInfo.m_stableId);
             AZ_TracePrintf(ShaderVariantAssetBuilderName, "Variant Shader Options: %s", optionGroup.ToString().c_str());
@@ -919,15 +930,35 @@ namespace AZ
 
                 auto assetBuilderShaderType = ShaderBuilderUtility::ToAssetBuilderShaderType(shaderStageType);
 
-                // Compile HLSL to the platform specific shader.
                 RHI::ShaderPlatformInterface::StageDescriptor descriptor;
-                bool shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
-                    creationContext.m_platformInfo, variantShaderSourcePath, shaderEntryName, assetBuilderShaderType,
-                    creationContext.m_tempDirPath, descriptor, creationContext.m_shaderBuildArguments);
+                ShaderCompileCache::Key compileCacheKey;
+                if (useCompileCache)
+                {
+                    compileCacheKey = ShaderCompileCache::CalculateKey(
+                        creationContext.m_shaderPlatformInterface, variantShaderSourceCode, shaderEntryName, assetBuilderShaderType,
+                        creationContext.m_shaderBuildArguments);
+                }
 
-                if (!shaderWasCompiled)
+                if (useCompileCache && ShaderCompileCache::Load(compileCacheKey, descriptor))
+                {
+                    AZ_TracePrintf(ShaderVariantAssetBuilderName, "Reusing compiled shader function %s", compileCacheKey.c_str());
+                }
+                else
                 {
-                    return AZ::Failure(AZStd::string::format("Could not compile the shader function %s", shaderEntryName.c_str()));
+                    // Compile HLSL to the platform specific shader.
+                    bool shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
+                        creationContext.m_platformInfo, variantShaderSourcePath, shaderEntryName, assetBuilderShaderType,
+                        creationContext.m_tempDirPath, descriptor, creationContext.m_shaderBuildArguments);
+
+                    if (!shaderWasCompiled)
+                    {
+                        return AZ::Failure(AZStd::string::format("Could not compile the shader function %s", shaderEntryName.c_str()));
+                    }
+
+                    if (useCompileCache)
+                    {
+                        ShaderCompileCache::Store(compileCacheKey, descriptor);
+                    }
                 }
                 // bubble up the byproducts to the caller by moving them to the context.
                 outputByproducts.emplace(AZStd::move(descriptor.m_byProducts));
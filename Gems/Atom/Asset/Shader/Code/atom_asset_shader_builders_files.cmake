@@ -18,6 +18,8 @@ set(FILES
     Source/Editor/ShaderAssetBuilder.h
     Source/Editor/ShaderBuilderUtility.cpp
     Source/Editor/ShaderBuilderUtility.h
+    Source/Editor/ShaderCompileCache.cpp
+    Source/Editor/ShaderCompileCache.h
     Source/Editor/ShaderPlatformInterfaceRequest.h
     Source/Editor/AzslCompiler.cpp
     Source/Editor/AzslCompiler.h
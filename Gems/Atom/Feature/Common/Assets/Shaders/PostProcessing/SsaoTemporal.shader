@@ -0,0 +1,15 @@
+{
+    "Source": "SsaoTemporal.azsl",
+
+    "ProgramSettings" :
+    {
+        "EntryPoints":
+        [
+        {
+            "name" : "MainCS",
+            "type" : "Compute"
+        }
+        ]
+    }
+
+}
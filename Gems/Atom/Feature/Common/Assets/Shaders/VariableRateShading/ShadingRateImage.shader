@@ -0,0 +1,15 @@
+{
+    "Source": "ShadingRateImage.azsl",
+
+    "ProgramSettings" :
+    {
+        "EntryPoints":
+        [
+        {
+            "name" : "MainCS",
+            "type" : "Compute"
+        }
+        ]
+    }
+
+}
@@ -149,6 +149,7 @@ set(FILES
     Passes/ReflectionScreenSpaceComposite.pass
     Passes/ReflectionScreenSpaceMobile.pass
     Passes/ReflectionScreenSpaceTrace.pass
+    Passes/ShadingRateImage.pass
     Passes/ShadowParent.pass
     Passes/Skinning.pass
     Passes/SkyAtmosphere.pass
@@ -169,6 +170,7 @@ set(FILES
     Passes/SplashScreen.pass
     Passes/SsaoCompute.pass
     Passes/SsaoParent.pass
+    Passes/SsaoTemporal.pass
     Passes/SubsurfaceScattering.pass
     Passes/Taa.pass
     Passes/ToolsPipeline.pass
@@ -479,6 +481,8 @@ set(FILES
     Shaders/PostProcessing/SMAAUtils.azsli
     Shaders/PostProcessing/SsaoCompute.azsl
     Shaders/PostProcessing/SsaoCompute.shader
+    Shaders/PostProcessing/SsaoTemporal.azsl
+    Shaders/PostProcessing/SsaoTemporal.shader
     Shaders/PostProcessing/Taa.azsl
     Shaders/PostProcessing/Taa.shader
     Shaders/PostProcessing/UniformColor.azsl
@@ -534,4 +538,6 @@ set(FILES
     Shaders/SkyBox/SkyBox.shader
     Shaders/SkyBox/SkyBox_TwoOutputs.shader
     Shaders/SkyBox/MultiViewSkyBox.shader
+    Shaders/VariableRateShading/ShadingRateImage.azsl
+    Shaders/VariableRateShading/ShadingRateImage.shader
 ) 
@@ -9,12 +9,15 @@
 #pragma once
 
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AZ
 {
     namespace Render
     {
         class AuxGeomDrawQueue;
+        struct AuxGeomBufferData;
         class DynamicPrimitiveProcessor;
         class FixedShapeProcessor;
 
@@ -47,6 +50,8 @@ namespace AZ
 
             RPI::AuxGeomDrawPtr GetOrCreateDrawQueueForView(const RPI::View* view) override;
             void ReleaseDrawQueueForView(const RPI::View* view) override;
+            RetainedGeometryId AddRetainedGeometry(const AZStd::function<void(RPI::AuxGeomDraw&)>& drawFunction) override;
+            void RemoveRetainedGeometry(RetainedGeometryId geometryId) override;
 
             // RPI::SceneNotificationBus::Handler overrides...
             void OnRenderPipelineChanged(AZ::RPI::RenderPipeline* pipeline, RPI::SceneNotification::RenderPipelineChangeType changeType) override;
@@ -55,6 +60,7 @@ namespace AZ
 
             AuxGeomFeatureProcessor(const AuxGeomFeatureProcessor&) = delete;
             void OnSceneRenderPipelinesChanged();
+            void ProcessRetainedGeometry(const FeatureProcessor::RenderPacket& fpPacket);
 
         private: // data
 
@@ -71,6 +77,13 @@ namespace AZ
 
             //! The object that handles fixed shape geometry data
             AZStd::unique_ptr<FixedShapeProcessor> m_fixedShapeProcessor;
+
+            //! Geometry recorded with AddRetainedGeometry, drawn every frame until it is removed.
+            //! Buffers of removed geometry are released on the render thread, after the frames using them are done.
+            AZStd::mutex m_retainedGeometryMutex;
+            AZStd::unordered_map<RetainedGeometryId, AZStd::shared_ptr<AuxGeomBufferData>> m_retainedGeometry;
+            AZStd::vector<RetainedGeometryId> m_removedRetainedGeometry;
+            RetainedGeometryId m_nextRetainedGeometryId = InvalidRetainedGeometryId + 1;
         };
 
         inline RPI::AuxGeomDrawPtr AuxGeomFeatureProcessor::GetDrawQueue()
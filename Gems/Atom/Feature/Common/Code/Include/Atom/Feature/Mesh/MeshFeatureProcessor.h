@@ -11,6 +11,7 @@
 #include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
 #include <Atom/Feature/Mesh/ModelReloaderSystemInterface.h>
 #include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
+#include <Atom/Feature/Utils/GpuBufferHandler.h>
 #include <Atom/RHI/TagBitRegistry.h>
 #include <Atom/RPI.Public/Culling.h>
 #include <Atom/RPI.Public/MeshDrawPacket.h>
@@ -20,6 +21,7 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Console/Console.h>
 #include <AzFramework/Asset/AssetCatalogBus.h>
+#include <Mesh/BindlessMaterialTable.h>
 #include <Mesh/MeshInstanceManager.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
 
@@ -51,6 +53,14 @@ namespace AZ
             using InstanceGroupHandle = StableDynamicArrayWeakHandle<MeshInstanceGroupData>;
             using InstanceGroupHandleList = AZStd::vector<InstanceGroupHandle>;
 
+            //! The data needed to add a visible object to the instanced draw calls of a view once culling is done
+            struct PostCullingInstanceData
+            {
+                InstanceGroupHandle m_instanceGroupHandle;
+                TransformServiceFeatureProcessorInterface::ObjectId m_objectId;
+            };
+            using PostCullingInstanceDataList = AZStd::vector<PostCullingInstanceData>;
+
         private:
             class MeshLoader
                 : private Data::AssetBus::Handler
@@ -109,6 +119,7 @@ namespace AZ
             void UpdateCullBounds(const MeshFeatureProcessor* meshFeatureProcessor);
             void UpdateObjectSrg(MeshFeatureProcessor* meshFeatureProcessor);
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
+            bool MaterialSupportsInstancing(Data::Instance<RPI::Material> material) const;
             void SetVisible(bool isVisible);
             CustomMaterialInfo GetCustomMaterialWithFallback(const CustomMaterialId& id) const;
             void HandleDrawPacketUpdate();
@@ -119,6 +130,9 @@ namespace AZ
             // When instancing is enabled, draw packets are owned by the MeshInstanceManager,
             // and the ModelDataInstance refers to those draw packets via InstanceGroupHandles
             AZStd::vector<InstanceGroupHandleList> m_instanceGroupHandlesByLod;
+
+            // The user data of each cullable lod when instancing is enabled, which pairs the instance groups of the lod with the object id
+            AZStd::vector<PostCullingInstanceDataList> m_postCullingInstanceDataByLod;
             
             // AZ::Event is used to communicate back to all the objects that refer to an instance group whenever a draw packet is updated
             // This is used to trigger an update to the cullable to use the new draw packet
@@ -137,6 +151,8 @@ namespace AZ
 
             //! List of object SRGs used by meshes in this model 
             AZStd::vector<Data::Instance<RPI::ShaderResourceGroup>> m_objectSrgList;
+            //! The ids of the materials this model added to the bindless material table, which are released with the draw packets
+            AZStd::vector<uint32_t> m_bindlessMaterialIds;
             MeshFeatureProcessorInterface::ObjectSrgCreatedEvent m_objectSrgCreatedEvent;
             AZStd::unique_ptr<MeshLoader> m_meshLoader;
             RPI::Scene* m_scene = nullptr;
@@ -188,7 +204,7 @@ namespace AZ
             void Deactivate() override;
             //! Updates GPU buffers with latest data from render proxies
             void Simulate(const FeatureProcessor::SimulatePacket& packet) override;
-            //! Updates ViewSrgs with per-view instance data for visible instances
+            //! Builds the instanced draw calls for the visible instances of each view, and updates the ViewSrgs with their instance data
             void OnEndCulling(const RenderPacket& packet) override;
 
             // RPI::SceneNotificationBus overrides ...
@@ -252,6 +268,9 @@ namespace AZ
 
             MeshInstanceManager& GetMeshInstanceManager();
             bool IsMeshInstancingEnabled() const;
+
+            BindlessMaterialTable& GetBindlessMaterialTable();
+            bool IsBindlessMaterialsEnabled() const;
         private:
             MeshFeatureProcessor(const MeshFeatureProcessor&) = delete;
 
@@ -275,7 +294,7 @@ namespace AZ
             void ExecuteCombinedJobQueue(AZStd::span<Job*> initQueue, AZStd::span<Job*> updateCullingQueue, Job* parentJob);
             
             
-            void ProcessVisibleObjectListForView(const RPI::ViewPtr& view);
+            void ProcessVisibleObjectListForView(const RPI::ViewPtr& view, size_t viewIndex);
 
             AZStd::concurrency_checker m_meshDataChecker;
             StableDynamicArray<ModelDataInstance> m_modelData;
@@ -287,12 +306,21 @@ namespace AZ
             AZ::RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler m_handleGlobalShaderOptionUpdate;
             RPI::MeshDrawPacketLods m_emptyDrawPacketLods;
             RHI::Ptr<FlagRegistry> m_flagRegistry = nullptr;
+
+            // The object ids of the visible instances of each view, which the instanced draw calls index with their instance id
+            AZStd::vector<GpuBufferHandler> m_perViewInstanceDataBufferHandlers;
+            AZStd::vector<uint32_t> m_instanceData;
+
+            // The materials of the meshes, packed into a buffer of the scene SRG when r_meshBindlessMaterialsEnabled is set
+            BindlessMaterialTable m_bindlessMaterialTable;
+            RPI::Scene::PrepareSceneSrgEvent::Handler m_updateSceneSrgHandler;
             AZ::RHI::Handle<uint32_t> m_meshMovedFlag;
             RHI::DrawListTag m_meshMotionDrawListTag;
             bool m_forceRebuildDrawPackets = false;
             bool m_reportShaderOptionFlags = false;
             bool m_enablePerMeshShaderOptionFlags = false;
             bool m_enableMeshInstancing = false;
+            bool m_enableBindlessMaterials = false;
         };
     } // namespace Render
 } // namespace AZ
@@ -40,6 +40,22 @@ namespace AZ
             AZ::ConsoleFunctorFlags::Null,
             "Enable instanced draw calls in the MeshFeatureProcessor.");
 
+        AZ_CVAR(
+            bool,
+            r_meshBindlessMaterialsEnabled,
+            false,
+            nullptr,
+            AZ::ConsoleFunctorFlags::Null,
+            "Enable packing the materials of the meshes into a scene buffer that shaders can index with the bindless material id of the draw SRG.");
+
+        AZ_CVAR(
+            bool,
+            r_meshLodStreamingEnabled,
+            false,
+            nullptr,
+            AZ::ConsoleFunctorFlags::Null,
+            "Enable streaming the lods of the models of the meshes, which evicts the buffers of the lods that are not drawn.");
+
         class ModelDataInstance;
 
         //! Mesh feature processor data types for customizing model materials
@@ -35,7 +35,7 @@ namespace AZ
     namespace Render
     {
         //! The input to the morph target pass, including the delta values for a fully morphed pose
-        //! and the index of the target vertex that is going to be modified
+        //! and the index of the target vertex that is going to be modified, for all the morph targets of a mesh
         //! The morph target pass will read these values, apply a weight, and write the accumulated deltas
         //! to an intermediate buffer that will be consumed by the skinning pass
         class MorphTargetInputBuffers
@@ -63,6 +63,8 @@ namespace AZ
             // so that we can calculate the maximum range a given mesh might be morphed if all of the morph targets
             // associated with it were active at once.
             uint32_t m_meshIndex;
+            // The offset of the first delta of the morph target within the deltas of its mesh
+            uint32_t m_deltaOffset;
         };
 
         namespace MorphTargetConstants
@@ -22,6 +22,8 @@ namespace AZ
             static constexpr float DefaultBlurConstFalloff = 0.85f;
             static constexpr float DefaultBlurDepthFalloffThreshold = 0.0f;
             static constexpr float DefaultBlurDepthFalloffStrength = 200.0f;
+
+            static constexpr float DefaultTemporalHistoryWeight = 0.9f;
         }
     }
 }
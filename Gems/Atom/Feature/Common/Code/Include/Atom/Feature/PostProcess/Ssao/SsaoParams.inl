@@ -51,3 +51,14 @@ AZ_GFX_FLOAT_PARAM_FLOAT_OVERRIDE(float, BlurDepthFalloffStrength, m_blurDepthFa
 // Whether to downsample the depth buffer before SSAO and upsample the result
 AZ_GFX_BOOL_PARAM(EnableDownsample, m_enableDownsample, true)
 AZ_GFX_ANY_PARAM_BOOL_OVERRIDE(bool, EnableDownsample, m_enableDownsample)
+
+
+// --- SSAO TEMPORAL FILTER ---
+
+// Whether to blend the SSAO result with the reprojected result of previous frames
+AZ_GFX_BOOL_PARAM(EnableTemporalFilter, m_enableTemporalFilter, false)
+AZ_GFX_ANY_PARAM_BOOL_OVERRIDE(bool, EnableTemporalFilter, m_enableTemporalFilter)
+
+//! How much of the reprojected history is kept each frame. Higher values are smoother but respond slower to changes
+AZ_GFX_FLOAT_PARAM(TemporalHistoryWeight, m_temporalHistoryWeight, Ssao::DefaultTemporalHistoryWeight)
+AZ_GFX_FLOAT_PARAM_FLOAT_OVERRIDE(float, TemporalHistoryWeight, m_temporalHistoryWeight)
@@ -63,6 +63,9 @@ namespace AZ
 
             //! See Render::ComputeMorphTargetIntegerEncoding. A negative value indicates there are no morph targets that impact this mesh
             float m_morphTargetIntegerEncoding = -1.0f;
+
+            //! The deltas of all the morph targets that can be applied to this mesh, or null if there are none
+            AZStd::intrusive_ptr<MorphTargetInputBuffers> m_morphTargetInputBuffers;
         };
 
         //! Container for all the buffers and views needed for a single lod of a skinned mesh
@@ -83,7 +86,7 @@ namespace AZ
             uint32_t GetVertexCount() const;
 
             //! Add a single morph target that can be applied to an instance of this skinned mesh
-            //! Creates a view into the larger morph target buffer to be used for applying an individual morph
+            //! The first morph target added to a mesh creates a view of the deltas of all the morph targets of that mesh
             //! @param morphTarget The metadata that has info such as the min/max weight, offset, and vertex count for the morph
             //! @param morphBufferAssetView The view of all the morph target deltas that can be applied to this mesh
             //! @param bufferNamePrefix A prefix that can be used to identify this morph target when creating the view into the morph target buffer.
@@ -99,8 +102,8 @@ namespace AZ
             //! Get the MetaDatas for all the morph targets that can be applied to an instance of this skinned mesh
             const AZStd::vector<MorphTargetComputeMetaData>& GetMorphTargetComputeMetaDatas() const;
 
-            //! Get the MorphTargetInputBuffers for all the morph targets that can be applied to an instance of this skinned mesh
-            const AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>>& GetMorphTargetInputBuffers() const;
+            //! Get the MorphTargetInputBuffers with the deltas of all the morph targets that can be applied to a mesh, or null if there are none
+            const AZStd::intrusive_ptr<MorphTargetInputBuffers>& GetMorphTargetInputBuffers(uint32_t meshIndex) const;
 
             //! Check if there are any morph targets that can be applied to a particular sub-mesh
             bool HasMorphTargetsForMesh(uint32_t meshIndex) const;
@@ -140,9 +143,6 @@ namespace AZ
             //! Container with one MorphTargetMetaData per morph target that can potentially be applied to an instance of this lod
             AZStd::vector<MorphTargetComputeMetaData> m_morphTargetComputeMetaDatas;
 
-            //! Container with one MorphTargetInputBuffers per morph target that can potentially be applied to an instance of this lod
-            AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>> m_morphTargetInputBuffers;
-
             SkinnedMeshOutputVertexCounts m_outputVertexCountsByStream;
         };
 
@@ -189,15 +189,15 @@ namespace AZ
             //! Returns a vector of MorphTargetMetaData with one entry for each morph target that could be applied to this mesh
             const AZStd::vector<MorphTargetComputeMetaData>& GetMorphTargetComputeMetaDatas(uint32_t lodIndex) const;
 
-            //! Returns a vector of MorphTargetInputBuffers which serve as input to the morph target pass
-            const AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>>& GetMorphTargetInputBuffers(uint32_t lodIndex) const;
+            //! Returns the MorphTargetInputBuffers of a mesh which serve as input to the morph target pass, or null if the mesh has no morph targets
+            const AZStd::intrusive_ptr<MorphTargetInputBuffers>& GetMorphTargetInputBuffers(uint32_t lodIndex, uint32_t meshIndex) const;
 
             //! Return the integer encoding used for the morph targets for a given lod/mesh, or -1 if there are no morph targets for the mesh.
             //! If the values are not yet pre-calculated, they will be when calling this function
             float GetMorphTargetIntegerEncoding(uint32_t lodIndex, uint32_t meshIndex) const;
 
             //! Add a single morph target that can be applied to an instance of this skinned mesh
-            //! Creates a view into the larger morph target buffer to be used for applying an individual morph
+            //! The first morph target added to a mesh creates a view of the deltas of all the morph targets of that mesh
             //! Must call Finalize after all morph targets have been added
             //! @param lodIndex The index of the lod modified by the morph target
             //! @param morphTarget The metadata that has info such as the min/max weight, offset, and vertex count for the morph
@@ -25,7 +25,7 @@ namespace AZ
                 if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
                 {
                     serializeContext->Class<SSROptions>()
-                        ->Version(1)
+                        ->Version(2)
                         ->Field("Enable", &SSROptions::m_enable)
                         ->Field("ConeTracing", &SSROptions::m_coneTracing)
                         ->Field("MaxRayDistance", &SSROptions::m_maxRayDistance)
@@ -33,6 +33,7 @@ namespace AZ
                         ->Field("MaxRoughness", &SSROptions::m_maxRoughness)
                         ->Field("RoughnessBias", &SSROptions::m_roughnessBias)
                         ->Field("HalfResolution", &SSROptions::m_halfResolution)
+                        ->Field("QuarterResolution", &SSROptions::m_quarterResolution)
                         ->Field("RayTracing", &SSROptions::m_rayTracing)
                         ->Field("RayTraceFallbackData", &SSROptions::m_rayTraceFallbackData)
                         ->Field("RayTraceFallbackSpecular", &SSROptions::m_rayTraceFallbackSpecular)
@@ -49,7 +50,8 @@ namespace AZ
             bool IsRayTracingFallbackEnabled() const { return m_enable && m_rayTracing && m_rayTraceFallbackData; }
             bool IsLuminanceClampEnabled() const { return m_enable && m_luminanceClamp; }
             bool IsTemporalFilteringEnabled() const { return m_enable && m_temporalFiltering; }
-            float GetOutputScale() const { return m_halfResolution ? 0.5f : 1.0f; }
+            bool IsHalfResolutionEnabled() const { return m_enable && m_halfResolution; }
+            float GetOutputScale() const { return m_halfResolution ? (m_quarterResolution ? 0.25f : 0.5f) : 1.0f; }
 
             bool  m_enable = false;
             bool  m_coneTracing = false;
@@ -58,6 +60,7 @@ namespace AZ
             float m_maxRoughness = 0.31f;
             float m_roughnessBias = 0.0f;
             bool  m_halfResolution = true;
+            bool  m_quarterResolution = false; //!< Halves the resolution again when m_halfResolution is set
             bool  m_rayTracing = true;
             bool  m_rayTraceFallbackData = true;
             bool  m_rayTraceFallbackSpecular = false;
@@ -67,7 +67,11 @@ namespace AZ
 
             // Prepare GPU buffers for object transformation matrices
             // Create the buffers if they don't exist. Otherwise, resize them if they are not large enough for the matrices
-            void PrepareBuffers();
+            // Returns true if the buffers were created or resized, which loses their content
+            bool PrepareBuffers();
+
+            // Uploads the slots of the buffer listed in the indices, merging adjacent slots into one upload
+            static void UploadDirtySlots(RPI::Buffer& buffer, const AZStd::vector<Float4x3>& values, AZStd::vector<uint32_t>& indices);
 
             void UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg);
 
@@ -91,9 +95,14 @@ namespace AZ
             Data::Instance<RPI::Buffer> m_objectToWorldInverseTransposeBuffer;
             Data::Instance<RPI::Buffer> m_objectToWorldHistoryBuffer;
 
+            // Slots whose transforms changed since the last upload, only these are uploaded to the persistent GPU buffers.
+            // The history buffer is updated with the same slots one frame later, so unchanged objects cost no upload.
+            AZStd::vector<uint32_t> m_dirtyTransformIndices;
+            AZStd::vector<uint32_t> m_dirtyHistoryIndices;
+
             uint32_t m_firstAvailableTransformIndex = NoAvailableTransformIndices;
-            bool m_deviceBufferNeedsUpdate = false;
-            bool m_historyBufferNeedsUpdate = false;
+            bool m_deviceBufferNeedsUpdate = false;     //all the slots need to be uploaded, e.g. after the buffers are resized
+            bool m_historyBufferNeedsUpdate = false;    //all the slots of the history buffer need to be uploaded
             bool m_isWriteable = true;     //prevents write access during certain parts of the frame (for threadsafety)
         };
     }
@@ -16,6 +16,8 @@
 
 #include <Atom/RPI.Public/View.h>
 
+#include <AzCore/std/smart_ptr/make_shared.h>
+
 namespace AZ
 {
     namespace Render
@@ -42,7 +44,7 @@ namespace AZ
 
             // initialize the dynamic primitive processor
             m_dynamicPrimitiveProcessor = AZStd::make_unique<DynamicPrimitiveProcessor>();
-            if (!m_dynamicPrimitiveProcessor->Initialize(scene))
+            if (!m_dynamicPrimitiveProcessor->Initialize(*rhiSystem->GetDevice(), scene))
             {
                 AZ_Error(s_featureProcessorName, false, "Failed to init AuxGeom DynamicPrimitiveProcessor");
                 return;
@@ -65,6 +67,12 @@ namespace AZ
 
             m_viewDrawDataMap.clear();
 
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_retainedGeometryMutex);
+                m_retainedGeometry.clear();
+                m_removedRetainedGeometry.clear();
+            }
+
             m_dynamicPrimitiveProcessor->Release();
             m_dynamicPrimitiveProcessor = nullptr;
 
@@ -90,6 +98,8 @@ namespace AZ
             m_fixedShapeProcessor->PrepareFrame();
             m_fixedShapeProcessor->ProcessObjects(bufferData, fpPacket);
 
+            ProcessRetainedGeometry(fpPacket);
+
             if (m_viewDrawDataMap.size())
             {
                 FeatureProcessor::RenderPacket perViewRP;
@@ -157,6 +167,49 @@ namespace AZ
             m_viewDrawDataMap.erase(view);
         }
 
+        RPI::AuxGeomFeatureProcessorInterface::RetainedGeometryId AuxGeomFeatureProcessor::AddRetainedGeometry(
+            const AZStd::function<void(RPI::AuxGeomDraw&)>& drawFunction)
+        {
+            // Record the draws with a queue of its own, so they don't get mixed with the immediate draws of this frame
+            AuxGeomDrawQueue recordingQueue;
+            drawFunction(recordingQueue);
+            auto bufferData = AZStd::make_shared<AuxGeomBufferData>(AZStd::move(*recordingQueue.Commit()));
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_retainedGeometryMutex);
+            const RetainedGeometryId geometryId = m_nextRetainedGeometryId++;
+            m_retainedGeometry.emplace(geometryId, AZStd::move(bufferData));
+            return geometryId;
+        }
+
+        void AuxGeomFeatureProcessor::RemoveRetainedGeometry(RetainedGeometryId geometryId)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_retainedGeometryMutex);
+            if (m_retainedGeometry.erase(geometryId) > 0)
+            {
+                m_removedRetainedGeometry.push_back(geometryId);
+            }
+        }
+
+        void AuxGeomFeatureProcessor::ProcessRetainedGeometry(const FeatureProcessor::RenderPacket& fpPacket)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "AuxGeomFeatureProcessor: ProcessRetainedGeometry");
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_retainedGeometryMutex);
+
+            // The draw packets of the previous frame were released in OnRenderEnd, so the buffers can go now
+            for (RetainedGeometryId geometryId : m_removedRetainedGeometry)
+            {
+                m_dynamicPrimitiveProcessor->ReleaseRetainedPrimitives(geometryId);
+            }
+            m_removedRetainedGeometry.clear();
+
+            for (const auto& [geometryId, bufferData] : m_retainedGeometry)
+            {
+                m_dynamicPrimitiveProcessor->ProcessRetainedPrimitives(geometryId, bufferData.get(), fpPacket);
+                m_fixedShapeProcessor->ProcessObjects(bufferData.get(), fpPacket);
+            }
+        }
+
         void AuxGeomFeatureProcessor::OnSceneRenderPipelinesChanged()
         {
             m_dynamicPrimitiveProcessor->SetUpdatePipelineStates();
@@ -36,8 +36,20 @@ namespace AZ
             };
         }
 
-        bool DynamicPrimitiveProcessor::Initialize(const AZ::RPI::Scene* scene)
+        bool DynamicPrimitiveProcessor::Initialize(AZ::RHI::Device& rhiDevice, const AZ::RPI::Scene* scene)
         {
+            RHI::BufferPoolDescriptor desc;
+            desc.m_heapMemoryLevel = RHI::HeapMemoryLevel::Device;
+            desc.m_bindFlags = RHI::BufferBindFlags::InputAssembly;
+
+            m_retainedBufferPool = RHI::Factory::Get().CreateBufferPool();
+            m_retainedBufferPool->SetName(Name("AuxGeomRetainedPrimitiveBufferPool"));
+            if (m_retainedBufferPool->Init(rhiDevice, desc) != RHI::ResultCode::Success)
+            {
+                AZ_Error("DynamicPrimitiveProcessor", false, "Failed to initialize AuxGeom retained primitive buffer pool");
+                return false;
+            }
+
             for (int primitiveType = 0; primitiveType < PrimitiveType_Count; ++primitiveType)
             {
                 SetupInputStreamLayout(m_inputStreamLayout[primitiveType], PrimitiveTypeToTopology[primitiveType]);
@@ -59,6 +71,9 @@ namespace AZ
             m_processSrgs.clear();
             m_shaderData.m_defaultSRG = nullptr;
 
+            m_retainedBuffers.clear();
+            m_retainedBufferPool.reset();
+
             m_shader = nullptr;
             m_scene = nullptr;
 
@@ -92,7 +107,6 @@ namespace AZ
         void DynamicPrimitiveProcessor::ProcessDynamicPrimitives(const AuxGeomBufferData* bufferData, const RPI::FeatureProcessor::RenderPacket& fpPacket)
         {
             AZ_PROFILE_SCOPE(AzRender, "DynamicPrimitiveProcessor: ProcessDynamicPrimitives");
-            RHI::DrawPacketBuilder drawPacketBuilder;
 
             const DynamicPrimitiveData& srcPrimitives = bufferData->m_primitiveData;
             // Update the buffers for the dynamic primitives and generate draw packets for them
@@ -114,84 +128,158 @@ namespace AZ
                     ValidateStreamBufferViews(m_primitiveBuffers.m_streamBufferViews, m_streamBufferViewsValidatedForLayout, primitiveType);
                 }
 
-                // Loop over all the primitives and use one draw call for each AuxGeom API call
-                // We have to create separate draw packets for each view that the AuxGeom is in (typically only one)
-                AZStd::vector<RPI::ViewPtr> auxGeomViews;
-                for (auto& view : fpPacket.m_views)
+                BuildDrawPackets(m_primitiveBuffers, bufferData, fpPacket);
+            }
+        }
+
+        void DynamicPrimitiveProcessor::ProcessRetainedPrimitives(
+            uint32_t retainedId, const AuxGeomBufferData* bufferData, const RPI::FeatureProcessor::RenderPacket& fpPacket)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "DynamicPrimitiveProcessor: ProcessRetainedPrimitives");
+
+            const DynamicPrimitiveData& srcPrimitives = bufferData->m_primitiveData;
+            if (srcPrimitives.m_indexBuffer.empty())
+            {
+                return;
+            }
+
+            auto retainedIt = m_retainedBuffers.find(retainedId);
+            if (retainedIt == m_retainedBuffers.end())
+            {
+                RetainedBufferGroup retainedGroup;
+                if (!CreateRetainedBuffers(srcPrimitives, retainedGroup))
                 {
-                    // If this view is ignoring packets with our draw list tag then skip this view
-                    if (!view->HasDrawListTag(m_shaderData.m_drawListTag))
-                    {
-                        continue;
-                    }
-                    auxGeomViews.emplace_back(view);
+                    return;
+                }
+                retainedIt = m_retainedBuffers.emplace(retainedId, AZStd::move(retainedGroup)).first;
+            }
+
+            BuildDrawPackets(retainedIt->second.m_group, bufferData, fpPacket);
+        }
+
+        void DynamicPrimitiveProcessor::ReleaseRetainedPrimitives(uint32_t retainedId)
+        {
+            m_retainedBuffers.erase(retainedId);
+        }
+
+        void DynamicPrimitiveProcessor::BuildDrawPackets(
+            DynamicBufferGroup& group, const AuxGeomBufferData* bufferData, const RPI::FeatureProcessor::RenderPacket& fpPacket)
+        {
+            RHI::DrawPacketBuilder drawPacketBuilder;
+            const DynamicPrimitiveData& srcPrimitives = bufferData->m_primitiveData;
+
+            // Loop over all the primitives and use one draw call for each AuxGeom API call
+            // We have to create separate draw packets for each view that the AuxGeom is in (typically only one)
+            AZStd::vector<RPI::ViewPtr> auxGeomViews;
+            for (auto& view : fpPacket.m_views)
+            {
+                // If this view is ignoring packets with our draw list tag then skip this view
+                if (!view->HasDrawListTag(m_shaderData.m_drawListTag))
+                {
+                    continue;
                 }
+                auxGeomViews.emplace_back(view);
+            }
 
-                for (auto& primitive : srcPrimitives.m_primitiveBuffer)
+            for (auto& primitive : srcPrimitives.m_primitiveBuffer)
+            {
+                bool useManualViewProjectionOverride = primitive.m_viewProjOverrideIndex != -1;
+
+                PipelineStateOptions pipelineStateOptions;
+                pipelineStateOptions.m_perpectiveType = useManualViewProjectionOverride? PerspectiveType_ManualOverride : PerspectiveType_ViewProjection;
+                pipelineStateOptions.m_blendMode = primitive.m_blendMode;
+                pipelineStateOptions.m_primitiveType = primitive.m_primitiveType;
+                pipelineStateOptions.m_depthReadType = primitive.m_depthReadType;
+                pipelineStateOptions.m_depthWriteType = primitive.m_depthWriteType;
+                pipelineStateOptions.m_faceCullMode = primitive.m_faceCullMode;
+                RPI::Ptr<RPI::PipelineStateForDraw> pipelineState = GetPipelineState(pipelineStateOptions);
+
+                Data::Instance<RPI::ShaderResourceGroup> srg;
+                if (useManualViewProjectionOverride || primitive.m_primitiveType == PrimitiveType_PointList)
                 {
-                    bool useManualViewProjectionOverride = primitive.m_viewProjOverrideIndex != -1;
-
-                    PipelineStateOptions pipelineStateOptions;
-                    pipelineStateOptions.m_perpectiveType = useManualViewProjectionOverride? PerspectiveType_ManualOverride : PerspectiveType_ViewProjection;
-                    pipelineStateOptions.m_blendMode = primitive.m_blendMode;
-                    pipelineStateOptions.m_primitiveType = primitive.m_primitiveType;
-                    pipelineStateOptions.m_depthReadType = primitive.m_depthReadType;
-                    pipelineStateOptions.m_depthWriteType = primitive.m_depthWriteType;
-                    pipelineStateOptions.m_faceCullMode = primitive.m_faceCullMode;
-                    RPI::Ptr<RPI::PipelineStateForDraw> pipelineState = GetPipelineState(pipelineStateOptions);
-
-                    Data::Instance<RPI::ShaderResourceGroup> srg;
-                    if (useManualViewProjectionOverride || primitive.m_primitiveType == PrimitiveType_PointList)
+                    srg = RPI::ShaderResourceGroup::Create(m_shader->GetAsset(), m_shader->GetSupervariantIndex(), m_shaderData.m_perDrawSrgLayout->GetName());
+                    if (!srg)
                     {
-                        srg = RPI::ShaderResourceGroup::Create(m_shader->GetAsset(), m_shader->GetSupervariantIndex(), m_shaderData.m_perDrawSrgLayout->GetName());
-                        if (!srg)
-                        {
-                            AZ_Warning("AuxGeom", false, "Failed to create a shader resource group for an AuxGeom draw, Ignoring the draw");
-                            continue; // failed to create an srg for this draw, just drop the draw.
-                        }
-                        if (useManualViewProjectionOverride)
-                        {
-                            srg->SetConstant(m_shaderData.m_viewProjectionOverrideIndex, bufferData->m_viewProjOverrides[primitive.m_viewProjOverrideIndex]);
-                            m_shaderData.m_viewProjectionOverrideIndex.AssertValid();
-                        }
-                        if (primitive.m_primitiveType == PrimitiveType_PointList)
-                        {
-                            srg->SetConstant(m_shaderData.m_pointSizeIndex, aznumeric_cast<float>(primitive.m_width));
-                            m_shaderData.m_pointSizeIndex.AssertValid();
-                        }
-                        pipelineState->UpdateSrgVariantFallback(srg);
-                        srg->Compile();
+                        AZ_Warning("AuxGeom", false, "Failed to create a shader resource group for an AuxGeom draw, Ignoring the draw");
+                        continue; // failed to create an srg for this draw, just drop the draw.
                     }
-                    else
+                    if (useManualViewProjectionOverride)
                     {
-                        srg = m_shaderData.m_defaultSRG;
+                        srg->SetConstant(m_shaderData.m_viewProjectionOverrideIndex, bufferData->m_viewProjOverrides[primitive.m_viewProjOverrideIndex]);
+                        m_shaderData.m_viewProjectionOverrideIndex.AssertValid();
                     }
-
-                    for (auto& view : auxGeomViews)
+                    if (primitive.m_primitiveType == PrimitiveType_PointList)
                     {
-                        RHI::DrawItemSortKey sortKey = primitive.m_blendMode == BlendMode_Off ? 0 : view->GetSortKeyForPosition(primitive.m_center);
+                        srg->SetConstant(m_shaderData.m_pointSizeIndex, aznumeric_cast<float>(primitive.m_width));
+                        m_shaderData.m_pointSizeIndex.AssertValid();
+                    }
+                    pipelineState->UpdateSrgVariantFallback(srg);
+                    srg->Compile();
+                }
+                else
+                {
+                    srg = m_shaderData.m_defaultSRG;
+                }
 
+                for (auto& view : auxGeomViews)
+                {
+                    RHI::DrawItemSortKey sortKey = primitive.m_blendMode == BlendMode_Off ? 0 : view->GetSortKeyForPosition(primitive.m_center);
 
-                        const RHI::DrawPacket* drawPacket = BuildDrawPacketForDynamicPrimitive(
-                            m_primitiveBuffers,
-                            pipelineState,
-                            srg,
-                            primitive.m_indexCount,
-                            primitive.m_indexOffset,
-                            drawPacketBuilder,
-                            sortKey);
 
-                        if (drawPacket)
-                        {
-                            m_drawPackets.emplace_back(drawPacket);
-                            m_processSrgs.push_back(srg);
-                            view->AddDrawPacket(drawPacket);
-                        }
+                    const RHI::DrawPacket* drawPacket = BuildDrawPacketForDynamicPrimitive(
+                        group,
+                        pipelineState,
+                        srg,
+                        primitive.m_indexCount,
+                        primitive.m_indexOffset,
+                        drawPacketBuilder,
+                        sortKey);
+
+                    if (drawPacket)
+                    {
+                        m_drawPackets.emplace_back(drawPacket);
+                        m_processSrgs.push_back(srg);
+                        view->AddDrawPacket(drawPacket);
                     }
                 }
             }
         }
 
+        bool DynamicPrimitiveProcessor::CreateRetainedBuffers(const DynamicPrimitiveData& source, RetainedBufferGroup& retainedGroup)
+        {
+            RHI::BufferInitRequest request;
+
+            const auto indexDataSize = static_cast<uint32_t>(source.m_indexBuffer.size() * sizeof(AuxGeomIndex));
+            retainedGroup.m_indexBuffer = RHI::Factory::Get().CreateBuffer();
+            request.m_buffer = retainedGroup.m_indexBuffer.get();
+            request.m_descriptor = RHI::BufferDescriptor{ RHI::BufferBindFlags::InputAssembly, indexDataSize };
+            request.m_initialData = source.m_indexBuffer.data();
+            RHI::ResultCode result = m_retainedBufferPool->InitBuffer(request);
+            if (result != RHI::ResultCode::Success)
+            {
+                AZ_Error("DynamicPrimitiveProcessor", false, "Failed to initialize retained index buffer with error code: %d", result);
+                return false;
+            }
+
+            const auto vertexDataSize = static_cast<uint32_t>(source.m_vertexBuffer.size() * sizeof(AuxGeomDynamicVertex));
+            retainedGroup.m_vertexBuffer = RHI::Factory::Get().CreateBuffer();
+            request.m_buffer = retainedGroup.m_vertexBuffer.get();
+            request.m_descriptor = RHI::BufferDescriptor{ RHI::BufferBindFlags::InputAssembly, vertexDataSize };
+            request.m_initialData = source.m_vertexBuffer.data();
+            result = m_retainedBufferPool->InitBuffer(request);
+            if (result != RHI::ResultCode::Success)
+            {
+                AZ_Error("DynamicPrimitiveProcessor", false, "Failed to initialize retained vertex buffer with error code: %d", result);
+                return false;
+            }
+
+            retainedGroup.m_group.m_indexBufferView = RHI::IndexBufferView(*retainedGroup.m_indexBuffer, 0, indexDataSize, RHI::IndexFormat::Uint32);
+            retainedGroup.m_group.m_streamBufferViews.resize(1);
+            retainedGroup.m_group.m_streamBufferViews[0] =
+                RHI::StreamBufferView(*retainedGroup.m_vertexBuffer, 0, vertexDataSize, sizeof(AuxGeomDynamicVertex));
+            return true;
+        }
+
         bool DynamicPrimitiveProcessor::UpdateIndexBuffer(const IndexBuffer& source, DynamicBufferGroup& group)
         {
             const size_t sourceByteSize = source.size() * sizeof(AuxGeomIndex);
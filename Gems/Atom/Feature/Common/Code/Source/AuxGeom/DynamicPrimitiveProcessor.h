@@ -21,6 +21,7 @@
 #include <Atom/RPI.Public/FeatureProcessor.h>
 #include <Atom/RPI.Public/PipelineState.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/unordered_map.h>
 
 #include "AuxGeomBase.h"
 
@@ -58,7 +59,7 @@ namespace AZ
             ~DynamicPrimitiveProcessor() = default;
 
             //! Initialize the DynamicPrimitiveProcessor and all its buffers, shaders, stream layouts etc
-            bool Initialize(const AZ::RPI::Scene* scene);
+            bool Initialize(AZ::RHI::Device& rhiDevice, const AZ::RPI::Scene* scene);
 
             //! Releases the DynamicPrimitiveProcessor and all primitive geometry buffers
             void Release();
@@ -66,6 +67,13 @@ namespace AZ
             //! Process the list of primitives in the buffer data and add them to the views in the feature processor packet
             void ProcessDynamicPrimitives(const AuxGeomBufferData* bufferData, const RPI::FeatureProcessor::RenderPacket& fpPacket);
 
+            //! Process the primitives of retained geometry. Unlike ProcessDynamicPrimitives, the vertices and indices are only
+            //! uploaded the first time, to buffers that are kept until ReleaseRetainedPrimitives is called with the same id.
+            void ProcessRetainedPrimitives(uint32_t retainedId, const AuxGeomBufferData* bufferData, const RPI::FeatureProcessor::RenderPacket& fpPacket);
+
+            //! Release the buffers created by ProcessRetainedPrimitives for the given id
+            void ReleaseRetainedPrimitives(uint32_t retainedId);
+
             //! Prepare frame.
             void PrepareFrame();
                         
@@ -88,6 +96,14 @@ namespace AZ
                 StreamBufferViewsForAllStreams m_streamBufferViews;
             };
 
+            //! Persistent buffers for the primitives of retained geometry
+            struct RetainedBufferGroup
+            {
+                RHI::Ptr<RHI::Buffer> m_indexBuffer;
+                RHI::Ptr<RHI::Buffer> m_vertexBuffer;
+                DynamicBufferGroup m_group;
+            };
+
             using DrawPackets = AZStd::vector<AZStd::unique_ptr<const RHI::DrawPacket>>;
 
             struct ShaderData
@@ -112,6 +128,12 @@ namespace AZ
 
         private: // functions
 
+            //! Build and add draw packets for all primitives in the buffer data, using the given buffers
+            void BuildDrawPackets(DynamicBufferGroup& group, const AuxGeomBufferData* bufferData, const RPI::FeatureProcessor::RenderPacket& fpPacket);
+
+            //! Create the persistent buffers for the primitives of retained geometry
+            bool CreateRetainedBuffers(const DynamicPrimitiveData& source, RetainedBufferGroup& retainedGroup);
+
             //!Uses the given drawPacketBuilder to build a draw packet with given data and returns it
             const RHI::DrawPacket* BuildDrawPacketForDynamicPrimitive(
                 DynamicBufferGroup& group,
@@ -155,6 +177,10 @@ namespace AZ
             // Buffers for all primitives
             DynamicBufferGroup m_primitiveBuffers;
 
+            // Pool and buffers for the primitives of retained geometry, by retained geometry id
+            RHI::Ptr<RHI::BufferPool> m_retainedBufferPool;
+            AZStd::unordered_map<uint32_t, RetainedBufferGroup> m_retainedBuffers;
+
             // Flags to see if stream buffer views have been validated for a prim type's layout
             bool m_streamBufferViewsValidatedForLayout[PrimitiveType_Count];
 
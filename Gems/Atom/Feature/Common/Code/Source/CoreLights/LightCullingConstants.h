@@ -18,6 +18,22 @@ namespace AZ
             const uint32_t TileDimX = 16;
             const uint32_t TileDimY = 16;
             const uint32_t NumBinsPerTile = 32;
+
+            //! Chooses how the lights are assigned to the lists of the forward and transparent passes.
+            //! Tiled divides each tile into bins between the minimum and maximum depth of the geometry in the tile.
+            //! Clustered divides each tile into NumClusterSlices slices spaced exponentially along the view depth, independently
+            //! of the depth buffer. The shaders select the mode with LIGHT_CULLING_CLUSTERED in LightCullingShared.azsli.
+            enum class CullingMode
+            {
+                Tiled,
+                Clustered
+            };
+            const CullingMode Mode = CullingMode::Tiled;
+
+            // The clusters use the bins of the remapped light list, see NVLC_MAX_BINS
+            const uint32_t NumClusterSlices = 8;
+            const float ClusterNearDepth = 1.0f;
+            const float ClusterFarDepth = 256.0f;
         }
     }
 }
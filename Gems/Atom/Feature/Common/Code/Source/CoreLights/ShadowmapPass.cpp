@@ -140,6 +140,12 @@ namespace AZ
             m_forceRenderNextFrame = true;
         }
 
+        void ShadowmapPass::SetUpdateInterval(uint32_t updateInterval, uint32_t updatePhase)
+        {
+            m_updateInterval = AZStd::max(updateInterval, 1u);
+            m_updatePhase = updatePhase;
+        }
+
         void ShadowmapPass::SetViewportScissorFromImageSize(const RHI::Size& imageSize)
         {
             const RHI::Viewport viewport(
@@ -171,10 +177,34 @@ namespace AZ
         {
             Base::SetupFrameGraphDependencies(frameGraph);
 
-            // Override the estimated item count set by the base class. Draw item count is compared against
-            // the last frame to detect cases where a moving object leaves the shadow frustum. It wouldn't
-            // set m_casterMovedBit since its outside the view, but needs to trigger a re-render anyway.
-            if (m_isStatic && !m_forceRenderNextFrame && m_lastFrameDrawCount == m_drawItemCount)
+            if (CanSkipRender())
+            {
+                frameGraph.SetEstimatedItemCount(0);
+            }
+            else
+            {
+                // Report + 1 to make room for the clear draw packet.
+                frameGraph.SetEstimatedItemCount(static_cast<uint32_t>(m_drawListView.size() + 1));
+            }
+        }
+
+        bool ShadowmapPass::CanSkipRender() const
+        {
+            if (m_forceRenderNextFrame)
+            {
+                return false;
+            }
+
+            // A throttled shadow keeps the shadow of its last update until its next update frame, even if casters moved.
+            // Without the clear draw packet, the atlas slice is cleared when the first pass loads it, so the shadow can't be kept.
+            if (m_updateInterval > 1 && m_clearShadowDrawPacket && (m_frameCount + m_updatePhase) % m_updateInterval != 0)
+            {
+                return true;
+            }
+
+            // Draw item count is compared against the last frame to detect cases where a moving object leaves the shadow frustum.
+            // It wouldn't set m_casterMovedBit since its outside the view, but needs to trigger a re-render anyway.
+            if (m_isStatic && m_lastFrameDrawCount == m_drawItemCount)
             {
                 const auto& views = m_pipeline->GetViews(GetPipelineViewTag());
                 if (!views.empty())
@@ -183,15 +213,11 @@ namespace AZ
                     if (view && (view->GetOrFlags() & m_casterMovedBit.GetIndex()) == 0)
                     {
                         // Shadow is static and no casters moved since last frame.
-                        frameGraph.SetEstimatedItemCount(0);
+                        return true;
                     }
                 }
             }
-            else
-            {
-                // Report + 1 to make room for the clear draw packet.
-                frameGraph.SetEstimatedItemCount(static_cast<uint32_t>(m_drawListView.size() + 1));
-            }
+            return false;
         }
 
         void ShadowmapPass::SubmitDrawItems(const RHI::FrameGraphExecuteContext& context, uint32_t startIndex, uint32_t endIndex, uint32_t offset) const
@@ -226,6 +252,7 @@ namespace AZ
                 m_forceRenderNextFrame = false;
             }
             m_lastFrameDrawCount = m_drawItemCount;
+            ++m_frameCount;
             Base::FrameEndInternal();
         }
 
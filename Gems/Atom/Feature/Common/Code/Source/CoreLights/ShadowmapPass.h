@@ -56,6 +56,11 @@ namespace AZ
             //! When the shadow is static, this forces the shadow to still re-render next frame (due to the light moving for instance)
             void ForceRenderNextFrame();
 
+            //! Sets the shadow to only re-render once every updateInterval frames, keeping the shadow of the last update in between.
+            //! The phase offsets the frames of the updates, so the shadows with the same interval don't all update on the same frame.
+            //! This requires the pass to clear itself with the clear shadow draw packet, since the atlas is kept between frames.
+            void SetUpdateInterval(uint32_t updateInterval, uint32_t updatePhase);
+
             //! This update viewport and scissor for this shadowmap from the given image size.
             void SetViewportScissorFromImageSize(const RHI::Size& imageSize);
 
@@ -83,6 +88,9 @@ namespace AZ
             // Gets the number of expected draws, taking into account if this shadow is static.
             uint32_t GetNumDraws() const;
 
+            // Returns true if the shadow of a previous frame can be kept, because it is static or throttled by the update interval.
+            bool CanSkipRender() const;
+
             RHI::ConstPtr<RHI::DrawPacket> m_clearShadowDrawPacket;
             RHI::DrawItemProperties m_clearShadowDrawItemProperties;
             RHI::Handle<uint32_t> m_casterMovedBit;
@@ -90,6 +98,9 @@ namespace AZ
             bool m_clearEnabled = true;
             bool m_isStatic = false;
             uint32_t m_lastFrameDrawCount = 0;
+            uint32_t m_updateInterval = 1;
+            uint32_t m_updatePhase = 0;
+            uint32_t m_frameCount = 0;
             mutable bool m_forceRenderNextFrame = false;
         };
     } // namespace Render
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <DynamicResolution/DynamicResolutionController.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+namespace AZ::Render
+{
+    void DynamicResolutionController::SetSettings(const DynamicResolutionSettings& settings)
+    {
+        m_settings = settings;
+        m_settings.m_maxScale = AZStd::clamp(m_settings.m_maxScale, 0.01f, 1.0f);
+        m_settings.m_minScale = AZStd::clamp(m_settings.m_minScale, 0.01f, m_settings.m_maxScale);
+        m_settings.m_scaleStep = AZStd::max(m_settings.m_scaleStep, 0.01f);
+        m_settings.m_smoothing = AZStd::clamp(m_settings.m_smoothing, 0.01f, 1.0f);
+
+        m_scale = AZStd::clamp(m_scale, m_settings.m_minScale, m_settings.m_maxScale);
+    }
+
+    const DynamicResolutionSettings& DynamicResolutionController::GetSettings() const
+    {
+        return m_settings;
+    }
+
+    bool DynamicResolutionController::Update(float gpuTimeMs)
+    {
+        if (gpuTimeMs <= 0.0f || m_settings.m_targetGpuTimeMs <= 0.0f)
+        {
+            // No timing available yet, e.g. the timestamp queries of the first frames haven't been resolved.
+            return false;
+        }
+
+        if (m_hasAverage)
+        {
+            m_averageGpuTimeMs = AZ::Lerp(m_averageGpuTimeMs, gpuTimeMs, m_settings.m_smoothing);
+        }
+        else
+        {
+            m_averageGpuTimeMs = gpuTimeMs;
+            m_hasAverage = true;
+        }
+
+        ++m_framesSinceChange;
+        if (m_framesSinceChange < m_settings.m_cooldownFrames)
+        {
+            return false;
+        }
+
+        const float target = m_settings.m_targetGpuTimeMs;
+        const bool overBudget = m_averageGpuTimeMs > target;
+        const bool underBudget = m_averageGpuTimeMs < target * (1.0f - m_settings.m_upscaleHeadroom);
+        if (!overBudget && !underBudget)
+        {
+            return false;
+        }
+
+        // Both the downscale and the upscale round down, so the predicted GPU time stays under the target.
+        const float desiredScale = m_scale * AZStd::sqrt(target / m_averageGpuTimeMs);
+        const float newScale = AZStd::clamp(Quantize(desiredScale), m_settings.m_minScale, m_settings.m_maxScale);
+        if ((overBudget && newScale >= m_scale) || (underBudget && newScale <= m_scale))
+        {
+            return false;
+        }
+
+        // Predict the GPU time at the new resolution until frames rendered with it come in.
+        const float pixelRatio = (newScale * newScale) / (m_scale * m_scale);
+        m_averageGpuTimeMs *= pixelRatio;
+        m_scale = newScale;
+        m_framesSinceChange = 0;
+        return true;
+    }
+
+    float DynamicResolutionController::GetScale() const
+    {
+        return m_scale;
+    }
+
+    float DynamicResolutionController::GetAverageGpuTimeMs() const
+    {
+        return m_averageGpuTimeMs;
+    }
+
+    void DynamicResolutionController::Reset()
+    {
+        m_scale = m_settings.m_maxScale;
+        m_averageGpuTimeMs = 0.0f;
+        m_framesSinceChange = 0;
+        m_hasAverage = false;
+    }
+
+    float DynamicResolutionController::Quantize(float scale) const
+    {
+        // The small bias keeps values that are already on a step from being rounded down to the previous one.
+        return AZStd::floor(scale / m_settings.m_scaleStep + 0.001f) * m_settings.m_scaleStep;
+    }
+} // namespace AZ::Render
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Render
+{
+    struct DynamicResolutionSettings
+    {
+        //! The GPU frame time the controller tries to stay under, in milliseconds.
+        float m_targetGpuTimeMs = 16.6f;
+
+        //! Range of the resolution scale, applied to both the width and the height.
+        float m_minScale = 0.5f;
+        float m_maxScale = 1.0f;
+
+        //! The scale only changes in multiples of this step, so render targets are resized rarely.
+        float m_scaleStep = 0.05f;
+
+        //! The scale only increases when the GPU time drops below (1 - m_upscaleHeadroom) * m_targetGpuTimeMs.
+        float m_upscaleHeadroom = 0.1f;
+
+        //! Minimum number of frames between two scale changes, which gives the GPU time of the new resolution time to settle.
+        uint32_t m_cooldownFrames = 30;
+
+        //! Weight of the newest frame in the exponential moving average of the GPU time.
+        float m_smoothing = 0.1f;
+    };
+
+    //! Picks the render resolution scale from the measured GPU frame times.
+    //! The GPU cost is assumed to be proportional to the number of pixels, so the scale changes with the square root of the
+    //! ratio between the target and the measured GPU time. Changes are quantized and rate limited to avoid reallocating
+    //! render targets every frame.
+    class DynamicResolutionController
+    {
+    public:
+        void SetSettings(const DynamicResolutionSettings& settings);
+        const DynamicResolutionSettings& GetSettings() const;
+
+        //! Adds the GPU time of a frame rendered at the current scale.
+        //! @return True if the scale changed.
+        bool Update(float gpuTimeMs);
+
+        float GetScale() const;
+        float GetAverageGpuTimeMs() const;
+
+        //! Goes back to the maximum scale and forgets the measured GPU times.
+        void Reset();
+
+    private:
+        float Quantize(float scale) const;
+
+        DynamicResolutionSettings m_settings;
+        float m_scale = 1.0f;
+        float m_averageGpuTimeMs = 0.0f;
+        uint32_t m_framesSinceChange = 0;
+        bool m_hasAverage = false;
+    };
+} // namespace AZ::Render
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <DynamicResolution/DynamicResolutionFeatureProcessor.h>
+#include <Atom/RPI.Public/Image/AttachmentImage.h>
+#include <Atom/RPI.Public/Pass/ParentPass.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+namespace AZ::Render
+{
+    AZ_CVAR(bool, r_dynamicResolutionEnabled, false, nullptr, ConsoleFunctorFlags::Null,
+        "Scales the render resolution of the default render pipeline to keep its GPU frame time under r_dynamicResolutionTargetGpuTimeMs.");
+    AZ_CVAR(float, r_dynamicResolutionTargetGpuTimeMs, 16.6f, nullptr, ConsoleFunctorFlags::Null,
+        "The GPU frame time in milliseconds the dynamic resolution tries to stay under.");
+    AZ_CVAR(float, r_dynamicResolutionMinScale, 0.5f, nullptr, ConsoleFunctorFlags::Null,
+        "The lowest render resolution scale the dynamic resolution can use.");
+    AZ_CVAR(float, r_dynamicResolutionMaxScale, 1.0f, nullptr, ConsoleFunctorFlags::Null,
+        "The highest render resolution scale the dynamic resolution can use.");
+    AZ_CVAR(float, r_dynamicResolutionStep, 0.05f, nullptr, ConsoleFunctorFlags::Null,
+        "The render resolution scale only changes in multiples of this step. Each change reallocates the scaled render targets.");
+
+    void DynamicResolutionFeatureProcessor::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+        {
+            serializeContext
+                ->Class<DynamicResolutionFeatureProcessor, FeatureProcessor>()
+                ->Version(1);
+        }
+    }
+
+    void DynamicResolutionFeatureProcessor::Deactivate()
+    {
+        Release();
+    }
+
+    void DynamicResolutionFeatureProcessor::Simulate([[maybe_unused]] const SimulatePacket& packet)
+    {
+        RPI::RenderPipelinePtr renderPipeline = GetParentScene()->GetDefaultRenderPipeline();
+        if (!r_dynamicResolutionEnabled || !renderPipeline || !renderPipeline->GetRootPass())
+        {
+            Release();
+            return;
+        }
+
+        if (renderPipeline->GetId() != m_renderPipelineId)
+        {
+            Release();
+            m_renderPipelineId = renderPipeline->GetId();
+            m_originalSize = renderPipeline->GetRenderSettings().m_size;
+            m_appliedSize = m_originalSize;
+            m_controller.Reset();
+            m_timestampQueryWasEnabled = renderPipeline->GetRootPass()->IsTimestampQueryEnabled();
+            renderPipeline->GetRootPass()->SetTimestampQueryEnabled(true);
+        }
+
+        DynamicResolutionSettings settings;
+        settings.m_targetGpuTimeMs = r_dynamicResolutionTargetGpuTimeMs;
+        settings.m_minScale = r_dynamicResolutionMinScale;
+        settings.m_maxScale = r_dynamicResolutionMaxScale;
+        settings.m_scaleStep = r_dynamicResolutionStep;
+        m_controller.SetSettings(settings);
+
+        m_controller.Update(GetGpuTimeMs(*renderPipeline->GetRootPass()));
+        ApplyScale(*renderPipeline);
+    }
+
+    RHI::Size DynamicResolutionFeatureProcessor::GetOutputSize(const RPI::RenderPipeline& renderPipeline)
+    {
+        const RPI::PassAttachmentBinding* binding = renderPipeline.GetRootPass()->FindAttachmentBinding(Name("PipelineOutput"));
+        if (!binding || !binding->GetAttachment() || binding->GetAttachment()->GetAttachmentType() != RHI::AttachmentType::Image)
+        {
+            return {};
+        }
+
+        const RPI::PassAttachment* attachment = binding->GetAttachment().get();
+        if (attachment->m_importedResource)
+        {
+            return static_cast<RPI::AttachmentImage*>(attachment->m_importedResource.get())->GetDescriptor().m_size;
+        }
+        return attachment->m_descriptor.m_image.m_size;
+    }
+
+    float DynamicResolutionFeatureProcessor::GetGpuTimeMs(const RPI::Pass& pass)
+    {
+        if (!pass.IsEnabled())
+        {
+            return 0.0f;
+        }
+
+        if (const RPI::ParentPass* parentPass = pass.AsParent())
+        {
+            float gpuTimeMs = 0.0f;
+            for (const RPI::Ptr<RPI::Pass>& child : parentPass->GetChildren())
+            {
+                gpuTimeMs += GetGpuTimeMs(*child);
+            }
+            return gpuTimeMs;
+        }
+
+        return static_cast<float>(pass.GetLatestTimestampResult().GetDurationInNanoseconds()) / 1000000.0f;
+    }
+
+    void DynamicResolutionFeatureProcessor::ApplyScale(RPI::RenderPipeline& renderPipeline)
+    {
+        const RHI::Size outputSize = GetOutputSize(renderPipeline);
+        if (outputSize.m_width == 0 || outputSize.m_height == 0)
+        {
+            return;
+        }
+
+        // The scaled size is recomputed every frame so it follows the output when the window is resized, but it only
+        // changes (and causes the scaled attachments to be reallocated) when the quantized scale or the output size changes.
+        const float scale = m_controller.GetScale();
+        RHI::Size scaledSize = outputSize;
+        scaledSize.m_width = AZStd::max(1u, static_cast<uint32_t>(AZStd::ceil(outputSize.m_width * scale)));
+        scaledSize.m_height = AZStd::max(1u, static_cast<uint32_t>(AZStd::ceil(outputSize.m_height * scale)));
+
+        if (scaledSize != m_appliedSize)
+        {
+            renderPipeline.GetRenderSettings().m_size = scaledSize;
+            m_appliedSize = scaledSize;
+        }
+    }
+
+    void DynamicResolutionFeatureProcessor::Release()
+    {
+        if (m_renderPipelineId.IsEmpty())
+        {
+            return;
+        }
+
+        if (RPI::RenderPipelinePtr renderPipeline = GetParentScene()->GetRenderPipeline(m_renderPipelineId))
+        {
+            renderPipeline->GetRenderSettings().m_size = m_originalSize;
+            if (renderPipeline->GetRootPass() && !m_timestampQueryWasEnabled)
+            {
+                renderPipeline->GetRootPass()->SetTimestampQueryEnabled(false);
+            }
+        }
+
+        m_renderPipelineId = RPI::RenderPipelineId();
+        m_controller.Reset();
+    }
+} // namespace AZ::Render
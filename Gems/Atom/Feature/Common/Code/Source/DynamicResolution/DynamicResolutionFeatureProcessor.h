@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <Atom/RHI.Reflect/Size.h>
+#include <Atom/RPI.Public/FeatureProcessor.h>
+#include <DynamicResolution/DynamicResolutionController.h>
+
+namespace AZ::Render
+{
+    //! Scales the render resolution of the scene's default render pipeline to keep its GPU frame time under a target.
+    //! The scaled resolution is written to the pipeline's render settings, so it affects the attachments that take their
+    //! size from the pipeline (a "Pipeline" SizeSource). Passes after the upscale point keep the pipeline output size.
+    //! Controlled with the r_dynamicResolution* CVars.
+    class DynamicResolutionFeatureProcessor
+        : public RPI::FeatureProcessor
+    {
+    public:
+        AZ_RTTI(AZ::Render::DynamicResolutionFeatureProcessor, "{0B6A3C5E-7F2D-4E4B-9A61-2C8D5E3F1B70}", AZ::RPI::FeatureProcessor);
+        AZ_CLASS_ALLOCATOR(AZ::Render::DynamicResolutionFeatureProcessor, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        DynamicResolutionFeatureProcessor() = default;
+        virtual ~DynamicResolutionFeatureProcessor() = default;
+
+    private:
+        // FeatureProcessor overrides
+        void Deactivate() override;
+        void Simulate(const SimulatePacket& packet) override;
+
+        //! Returns the size of the pipeline output, which is the resolution at scale 1.
+        static RHI::Size GetOutputSize(const RPI::RenderPipeline& renderPipeline);
+
+        //! Returns the sum of the GPU times of the passes in the pipeline for the latest resolved frame, in milliseconds.
+        static float GetGpuTimeMs(const RPI::Pass& pass);
+
+        void ApplyScale(RPI::RenderPipeline& renderPipeline);
+
+        //! Restores the render size of the pipeline being scaled, if it still exists.
+        void Release();
+
+        DynamicResolutionController m_controller;
+
+        //! The pipeline being scaled and its render size before scaling started.
+        RPI::RenderPipelineId m_renderPipelineId;
+        RHI::Size m_originalSize;
+        RHI::Size m_appliedSize;
+        bool m_timestampQueryWasEnabled = false;
+    };
+} // namespace AZ::Render
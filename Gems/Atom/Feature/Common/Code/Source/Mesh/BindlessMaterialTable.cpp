@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/BindlessMaterialTable.h>
+
+#include <Atom/RHI/BufferView.h>
+#include <Atom/RHI/ImageView.h>
+#include <Atom/RHI/ShaderResourceGroup.h>
+#include <Atom/RPI.Public/MeshDrawPacket.h>
+#include <Atom/RPI.Public/RPISystemInterface.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace AZ::Render
+{
+    uint32_t BindlessMaterialTable::AcquireMaterial(const Data::Instance<RPI::Material>& material)
+    {
+        if (!material)
+        {
+            return RPI::MeshDrawPacket::InvalidBindlessMaterialId;
+        }
+
+        AZStd::scoped_lock lock(m_mutex);
+
+        if (auto it = m_idsByMaterial.find(material.get()); it != m_idsByMaterial.end())
+        {
+            ++m_entries[it->second].m_refCount;
+            return it->second;
+        }
+
+        uint32_t materialId = 0;
+        if (!m_freeIds.empty())
+        {
+            materialId = m_freeIds.back();
+            m_freeIds.pop_back();
+        }
+        else
+        {
+            materialId = aznumeric_cast<uint32_t>(m_entries.size());
+            m_entries.emplace_back();
+        }
+
+        Entry& entry = m_entries[materialId];
+        entry.m_material = material;
+        entry.m_changeId = RPI::Material::DEFAULT_CHANGE_ID;
+        entry.m_refCount = 1;
+        m_idsByMaterial.emplace(material.get(), materialId);
+        m_isDirty = true;
+        return materialId;
+    }
+
+    void BindlessMaterialTable::ReleaseMaterial(uint32_t materialId)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+
+        if (materialId >= m_entries.size() || m_entries[materialId].m_refCount == 0)
+        {
+            AZ_Assert(materialId == RPI::MeshDrawPacket::InvalidBindlessMaterialId, "Releasing bindless material %u, which isn't in the table.", materialId);
+            return;
+        }
+
+        Entry& entry = m_entries[materialId];
+        if (--entry.m_refCount == 0)
+        {
+            m_idsByMaterial.erase(entry.m_material.get());
+            entry = {};
+            m_freeIds.push_back(materialId);
+            m_isDirty = true;
+        }
+    }
+
+    void BindlessMaterialTable::UpdateSceneSrg(RPI::ShaderResourceGroup* sceneSrg)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+
+        if (!m_bufferHandler.IsValid())
+        {
+            // Created on first use, as only the scene SRGs of shaders that read the materials bindlessly declare the buffer
+            const RHI::ShaderResourceGroupLayout* sceneSrgLayout = RPI::RPISystemInterface::Get()->GetSceneSrgLayout().get();
+            if (!sceneSrgLayout || !sceneSrgLayout->FindShaderInputBufferIndex(Name(BufferSrgName)).IsValid())
+            {
+                return;
+            }
+
+            GpuBufferHandler::Descriptor desc;
+            desc.m_bufferName = "BindlessMaterialDataBuffer";
+            desc.m_bufferSrgName = BufferSrgName;
+            desc.m_elementSize = sizeof(uint32_t);
+            desc.m_srgLayout = sceneSrgLayout;
+            m_bufferHandler = GpuBufferHandler(desc);
+            m_isDirty = true;
+        }
+
+        // A material is repacked once its changes were compiled into its SRG
+        for (Entry& entry : m_entries)
+        {
+            if (entry.m_material && !entry.m_material->NeedsCompile() && entry.m_material->GetCurrentChangeId() != entry.m_changeId)
+            {
+                entry.m_changeId = entry.m_material->GetCurrentChangeId();
+                m_isDirty = true;
+            }
+        }
+
+        if (m_isDirty)
+        {
+            m_isDirty = false;
+            PackMaterials();
+            m_bufferHandler.UpdateBuffer(m_packedData);
+        }
+
+        m_bufferHandler.UpdateSrg(sceneSrg);
+    }
+
+    void BindlessMaterialTable::PackMaterials()
+    {
+        AZ_PROFILE_SCOPE(AzRender, "BindlessMaterialTable: PackMaterials");
+
+        // The offsets are followed by the records, and free ids keep an offset of 0
+        m_packedData.clear();
+        m_packedData.resize(m_entries.size(), 0);
+
+        for (size_t materialId = 0; materialId < m_entries.size(); ++materialId)
+        {
+            const Entry& entry = m_entries[materialId];
+            const RHI::ShaderResourceGroup* materialSrg = entry.m_material ? entry.m_material->GetRHIShaderResourceGroup() : nullptr;
+            if (!materialSrg)
+            {
+                continue;
+            }
+
+            const RHI::ShaderResourceGroupData& srgData = materialSrg->GetData();
+            AZStd::span<const uint8_t> constantData = srgData.GetConstantData();
+            AZStd::span<const RHI::ConstPtr<RHI::ImageView>> imageViews = srgData.GetImageGroup();
+            AZStd::span<const RHI::ConstPtr<RHI::BufferView>> bufferViews = srgData.GetBufferGroup();
+            const size_t constantWordCount = (constantData.size() + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+            m_packedData[materialId] = aznumeric_cast<uint32_t>(m_packedData.size());
+            m_packedData.push_back(aznumeric_cast<uint32_t>(constantWordCount));
+            m_packedData.push_back(aznumeric_cast<uint32_t>(imageViews.size()));
+            m_packedData.push_back(aznumeric_cast<uint32_t>(bufferViews.size()));
+
+            const size_t constantOffset = m_packedData.size();
+            m_packedData.resize(constantOffset + constantWordCount, 0);
+            if (!constantData.empty())
+            {
+                memcpy(m_packedData.data() + constantOffset, constantData.data(), constantData.size());
+            }
+
+            for (const RHI::ConstPtr<RHI::ImageView>& imageView : imageViews)
+            {
+                m_packedData.push_back(imageView ? imageView->GetBindlessReadIndex() : RHI::ImageView::InvalidBindlessIndex);
+            }
+            for (const RHI::ConstPtr<RHI::BufferView>& bufferView : bufferViews)
+            {
+                m_packedData.push_back(bufferView ? bufferView->GetBindlessReadIndex() : RHI::BufferView::InvalidBindlessIndex);
+            }
+        }
+    }
+
+    void BindlessMaterialTable::Release()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_entries.clear();
+        m_freeIds.clear();
+        m_idsByMaterial.clear();
+        m_packedData.clear();
+        m_bufferHandler.Release();
+        m_isDirty = false;
+    }
+
+    uint32_t BindlessMaterialTable::GetMaterialCount() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return aznumeric_cast<uint32_t>(m_idsByMaterial.size());
+    }
+} // namespace AZ::Render
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/Feature/Utils/GpuBufferHandler.h>
+#include <Atom/RPI.Public/Material/Material.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ::Render
+{
+    //! Packs the material SRGs of the meshes into one structured buffer of the scene SRG, so shaders that support it can read the
+    //! parameters of any material by the id written to their draw SRG, instead of binding a material SRG per draw.
+    //! The textures and buffers of a material are referenced by their bindless read indices.
+    //!
+    //! The buffer holds 32 bit words. The first word of each material id is the offset of its record, followed by the records:
+    //! the constant data size in words, the image count and the buffer count, then the constant data, image indices and buffer indices.
+    class BindlessMaterialTable
+    {
+    public:
+        static constexpr const char* BufferSrgName = "m_bindlessMaterialData";
+
+        //! Returns the id of the material, adding it to the table if it isn't in it yet. Each call takes a reference
+        //! that is returned by ReleaseMaterial. It's safe to call from the jobs that build the draw packets.
+        uint32_t AcquireMaterial(const Data::Instance<RPI::Material>& material);
+        void ReleaseMaterial(uint32_t materialId);
+
+        //! Repacks the table if a material was added, removed or changed since the last update, and binds it to the scene SRG.
+        //! Does nothing if the scene SRG doesn't declare the buffer.
+        void UpdateSceneSrg(RPI::ShaderResourceGroup* sceneSrg);
+
+        void Release();
+
+        uint32_t GetMaterialCount() const;
+
+    private:
+        struct Entry
+        {
+            Data::Instance<RPI::Material> m_material;
+            RPI::Material::ChangeId m_changeId = RPI::Material::DEFAULT_CHANGE_ID;
+            uint32_t m_refCount = 0;
+        };
+
+        void PackMaterials();
+
+        AZStd::vector<Entry> m_entries;
+        AZStd::vector<uint32_t> m_freeIds;
+        AZStd::unordered_map<const RPI::Material*, uint32_t> m_idsByMaterial;
+        AZStd::vector<uint32_t> m_packedData;
+        GpuBufferHandler m_bufferHandler;
+        mutable AZStd::mutex m_mutex;
+        bool m_isDirty = false;
+    };
+} // namespace AZ::Render
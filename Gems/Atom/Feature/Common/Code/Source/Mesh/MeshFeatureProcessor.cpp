@@ -6,6 +6,7 @@
  *
  */
 
+#include <Atom/RHI/DrawPacketBuilder.h>
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RHI/RHIUtils.h>
 #include <Atom/RHI.Reflect/InputStreamLayoutBuilder.h>
@@ -17,6 +18,7 @@
 #include <Atom/RPI.Public/Model/ModelTagSystemComponent.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 #include <Atom/RPI.Public/AssetQuality.h>
 
@@ -40,6 +42,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ
 {
@@ -47,6 +50,8 @@ namespace AZ
     {
         static AZ::Name s_o_meshUseForwardPassIBLSpecular_Name =
             AZ::Name::FromStringLiteral("o_meshUseForwardPassIBLSpecular", AZ::Interface<AZ::NameDictionary>::Get());
+        static AZ::Name s_o_meshInstancingIsEnabled_Name =
+            AZ::Name::FromStringLiteral("o_meshInstancingIsEnabled", AZ::Interface<AZ::NameDictionary>::Get());
         static AZ::Name s_Manual_Name = AZ::Name::FromStringLiteral("Manual", AZ::Interface<AZ::NameDictionary>::Get());
         static AZ::Name s_Multiply_Name = AZ::Name::FromStringLiteral("Multiply", AZ::Interface<AZ::NameDictionary>::Get());
         static AZ::Name s_BaseColorTint_Name = AZ::Name::FromStringLiteral("BaseColorTint", AZ::Interface<AZ::NameDictionary>::Get());
@@ -149,6 +154,18 @@ namespace AZ
                 console->PerformCommand(
                     AZStd::string::format("r_meshInstancingEnabled %s", m_enableMeshInstancing ? "true" : "false")
                         .c_str());
+
+                console->GetCvarValue("r_meshBindlessMaterialsEnabled", m_enableBindlessMaterials);
+            }
+
+            if (m_enableBindlessMaterials)
+            {
+                m_updateSceneSrgHandler = RPI::Scene::PrepareSceneSrgEvent::Handler(
+                    [this](RPI::ShaderResourceGroup* sceneSrg)
+                    {
+                        m_bindlessMaterialTable.UpdateSceneSrg(sceneSrg);
+                    });
+                GetParentScene()->ConnectEvent(m_updateSceneSrgHandler);
             }
         }
 
@@ -156,6 +173,16 @@ namespace AZ
         {
             m_flagRegistry.reset();
 
+            for (GpuBufferHandler& instanceDataBufferHandler : m_perViewInstanceDataBufferHandlers)
+            {
+                instanceDataBufferHandler.Release();
+            }
+            m_perViewInstanceDataBufferHandlers.clear();
+            m_instanceData.clear();
+
+            m_updateSceneSrgHandler.Disconnect();
+            m_bindlessMaterialTable.Release();
+
             m_handleGlobalShaderOptionUpdate.Disconnect();
 
             DisableSceneNotification();
@@ -427,31 +454,116 @@ namespace AZ
                 AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: OnEndCulling");
                 for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
                 {
-                    ProcessVisibleObjectListForView(packet.m_views[viewIndex]);
+                    ProcessVisibleObjectListForView(packet.m_views[viewIndex], viewIndex);
                 }
             }
         }
         
-        void MeshFeatureProcessor::ProcessVisibleObjectListForView(const RPI::ViewPtr& view)
+        void MeshFeatureProcessor::ProcessVisibleObjectListForView(const RPI::ViewPtr& view, size_t viewIndex)
         {
-            // As an interim step while mesh instancing is still not supported, when r_meshInstancingIsEnabled == true, we just submit the draw packet directly to the view
-            // In a follow up commit, we will process the lists properly and generate actual instanced draw calls
+            struct VisibleInstance
+            {
+                MeshInstanceGroupData* m_instanceGroup;
+                uint32_t m_objectIndex;
+                float m_depth;
+            };
+
+            AZStd::vector<VisibleInstance> visibleInstances;
+            visibleInstances.reserve(view->GetVisibleObjectList().size());
             for (const RPI::VisibleObjectProperties& visibleObject : view->GetVisibleObjectList())
             {
                 if (visibleObject.m_userData)
                 {
-                    const ModelDataInstance::InstanceGroupHandleList* instanceGroupHandles =
-                        reinterpret_cast<const ModelDataInstance::InstanceGroupHandleList*>(visibleObject.m_userData);
-                    // For the initial commit, we naively add each draw packet for each visible object to the view.
-                    // This will be replaced with generating instance buffers for each view to use with instanced draw calls.
-                    for (auto& instanceGroupHandle : *instanceGroupHandles)
+                    const ModelDataInstance::PostCullingInstanceDataList* postCullingInstanceDataList =
+                        reinterpret_cast<const ModelDataInstance::PostCullingInstanceDataList*>(visibleObject.m_userData);
+                    for (const ModelDataInstance::PostCullingInstanceData& postCullingInstanceData : *postCullingInstanceDataList)
+                    {
+                        MeshInstanceGroupData& instanceGroup = m_meshInstanceManager[postCullingInstanceData.m_instanceGroupHandle];
+                        if (!instanceGroup.m_key.m_forceInstancingOff.IsNull() ||
+                            instanceGroup.m_drawRootConstantInterval.m_max == instanceGroup.m_drawRootConstantInterval.m_min)
+                        {
+                            // The instance group only ever holds this object, or its shaders can't read the instance buffer,
+                            // so the original draw packet is submitted as is.
+                            view->AddDrawPacket(instanceGroup.m_drawPacket.GetRHIDrawPacket(), visibleObject.m_depth);
+                            continue;
+                        }
+
+                        visibleInstances.push_back(VisibleInstance{
+                            &instanceGroup, postCullingInstanceData.m_objectId.GetIndex(), visibleObject.m_depth });
+                    }
+                }
+            }
+
+            // Sort the instances so the instances of each group are contiguous in the instance buffer, and ordered front to back
+            AZStd::sort(
+                visibleInstances.begin(), visibleInstances.end(),
+                [](const VisibleInstance& lhs, const VisibleInstance& rhs)
+                {
+                    if (lhs.m_instanceGroup != rhs.m_instanceGroup)
+                    {
+                        return lhs.m_instanceGroup < rhs.m_instanceGroup;
+                    }
+                    return lhs.m_depth < rhs.m_depth;
+                });
+
+            m_instanceData.clear();
+            m_instanceData.reserve(visibleInstances.size());
+
+            // Submit one instanced draw packet for each group of instances
+            for (size_t groupBegin = 0; groupBegin < visibleInstances.size();)
+            {
+                MeshInstanceGroupData& instanceGroup = *visibleInstances[groupBegin].m_instanceGroup;
+                size_t groupEnd = groupBegin;
+                while (groupEnd < visibleInstances.size() && visibleInstances[groupEnd].m_instanceGroup == &instanceGroup)
+                {
+                    m_instanceData.push_back(visibleInstances[groupEnd].m_objectIndex);
+                    ++groupEnd;
+                }
+
+                const RHI::DrawPacket* originalDrawPacket = instanceGroup.m_drawPacket.GetRHIDrawPacket();
+                if (originalDrawPacket)
+                {
+                    if (instanceGroup.m_perViewDrawPackets.size() <= viewIndex)
+                    {
+                        instanceGroup.m_perViewDrawPackets.resize(viewIndex + 1);
+                    }
+
+                    RHI::Ptr<RHI::DrawPacket>& perViewDrawPacket = instanceGroup.m_perViewDrawPackets[viewIndex];
+                    if (!perViewDrawPacket)
                     {
-                        view->AddDrawPacket(instanceGroupHandle->m_drawPacket.GetRHIDrawPacket(), visibleObject.m_depth);
+                        RHI::DrawPacketBuilder drawPacketBuilder;
+                        perViewDrawPacket = const_cast<RHI::DrawPacket*>(drawPacketBuilder.Clone(originalDrawPacket));
                     }
+
+                    // The shaders offset their instance id by the root constant to find the object id in the instance buffer
+                    uint32_t instanceDataOffset = aznumeric_cast<uint32_t>(groupBegin);
+                    perViewDrawPacket->SetRootConstant(
+                        instanceGroup.m_drawRootConstantInterval.m_min,
+                        AZStd::span<uint8_t>(reinterpret_cast<uint8_t*>(&instanceDataOffset), sizeof(uint32_t)));
+                    perViewDrawPacket->SetInstanceCount(aznumeric_cast<uint32_t>(groupEnd - groupBegin));
+
+                    // The instances are sorted front to back, so the group is sorted by its closest instance
+                    view->AddDrawPacket(perViewDrawPacket.get(), visibleInstances[groupBegin].m_depth);
                 }
+
+                groupBegin = groupEnd;
+            }
+
+            while (m_perViewInstanceDataBufferHandlers.size() <= viewIndex)
+            {
+                GpuBufferHandler::Descriptor desc;
+                desc.m_bufferName = AZStd::string::format("MeshInstanceDataBuffer_%zu", m_perViewInstanceDataBufferHandlers.size());
+                desc.m_bufferSrgName = "m_instanceData";
+                desc.m_elementSize = sizeof(uint32_t);
+                desc.m_srgLayout = RPI::RPISystemInterface::Get()->GetViewSrgLayout().get();
+                m_perViewInstanceDataBufferHandlers.emplace_back(desc);
             }
+
+            GpuBufferHandler& instanceDataBufferHandler = m_perViewInstanceDataBufferHandlers[viewIndex];
+            instanceDataBufferHandler.UpdateBuffer(m_instanceData);
+            instanceDataBufferHandler.UpdateSrg(view->GetShaderResourceGroup().get());
         }
-        
+
         void MeshFeatureProcessor::OnBeginPrepareRender()
         {
             m_meshDataChecker.soft_lock();
@@ -1031,6 +1143,16 @@ namespace AZ
             return m_enableMeshInstancing;
         }
 
+        BindlessMaterialTable& MeshFeatureProcessor::GetBindlessMaterialTable()
+        {
+            return m_bindlessMaterialTable;
+        }
+
+        bool MeshFeatureProcessor::IsBindlessMaterialsEnabled() const
+        {
+            return m_enableBindlessMaterials;
+        }
+
         void MeshFeatureProcessor::PrintShaderOptionFlags()
         {
             AZStd::map<FlagRegistry::TagType, AZ::Name> tags;
@@ -1301,8 +1423,16 @@ namespace AZ
                 }
                 m_instanceGroupHandlesByLod.clear();
                 m_updateDrawPacketEventHandlersByLod.clear();
+                m_postCullingInstanceDataByLod.clear();
             }
 
+            BindlessMaterialTable& bindlessMaterialTable = meshFeatureProcessor->GetBindlessMaterialTable();
+            for (uint32_t bindlessMaterialId : m_bindlessMaterialIds)
+            {
+                bindlessMaterialTable.ReleaseMaterial(bindlessMaterialId);
+            }
+            m_bindlessMaterialIds.clear();
+
             m_customMaterials.clear();
             m_objectSrgList = {};
             m_model = {};
@@ -1337,6 +1467,7 @@ namespace AZ
             {
                 m_instanceGroupHandlesByLod.resize(modelLodCount);
                 m_updateDrawPacketEventHandlersByLod.resize(modelLodCount);
+                m_postCullingInstanceDataByLod.resize(modelLodCount);
             }
             
             for (size_t modelLodIndex = 0; modelLodIndex < modelLodCount; ++modelLodIndex)
@@ -1427,6 +1558,14 @@ namespace AZ
                 }
 
                 
+                uint32_t bindlessMaterialId = RPI::MeshDrawPacket::InvalidBindlessMaterialId;
+                if (meshFeatureProcessor->IsBindlessMaterialsEnabled())
+                {
+                    // Instances that share a draw packet share its material, so they all get the same id
+                    bindlessMaterialId = meshFeatureProcessor->GetBindlessMaterialTable().AcquireMaterial(material);
+                    m_bindlessMaterialIds.push_back(bindlessMaterialId);
+                }
+
                 bool materialRequiresForwardPassIblSpecular = MaterialRequiresForwardPassIblSpecular(material);
 
                 // Track whether any materials in this mesh require ForwardPassIblSpecular, we need this information when the ObjectSrg is
@@ -1434,6 +1573,8 @@ namespace AZ
                 m_flags.m_hasForwardPassIblSpecularMaterial |= materialRequiresForwardPassIblSpecular;
 
                 MeshInstanceManager::InsertResult instanceGroupInsertResult{ MeshInstanceManager::Handle{}, 0 };
+                const bool supportsInstancing = r_meshInstancingEnabled && !m_descriptor.m_useForwardPassIblSpecular &&
+                    !materialRequiresForwardPassIblSpecular && MaterialSupportsInstancing(material);
 
                 if (r_meshInstancingEnabled)
                 {
@@ -1449,9 +1590,13 @@ namespace AZ
                     // Two meshes that could otherwise be instanced but have manually specified sort keys will not be instanced together
                     key.m_sortKey = m_sortKey;
 
-                    // Using a random uuid will force this mesh into it's own unique instance group, which is always done for now since
-                    // no actual instancing is supported yet.
-                    key.m_forceInstancingOff = Uuid::CreateRandom();
+                    // Using a random uuid will force this mesh into it's own unique instance group. This is needed when one of the
+                    // shaders reads the transform from the ObjectSrg instead of the instance buffer, and when the mesh uses forward pass
+                    // IBL specular, which reads the reflection probe data that's specific to each object from the ObjectSrg.
+                    if (!supportsInstancing)
+                    {
+                        key.m_forceInstancingOff = Uuid::CreateRandom();
+                    }
 
                     instanceGroupInsertResult = meshInstanceManager.AddInstance(key);
                     m_instanceGroupHandlesByLod[modelLodIndex].push_back(instanceGroupInsertResult.m_handle);
@@ -1488,6 +1633,12 @@ namespace AZ
                         AZ_Warning("MeshDrawPacket", false, "Failed to set o_meshUseForwardPassIBLSpecular on mesh draw packet");
                     }
 
+                    // read the transforms from the instance buffer of the view if this draw packet can be shared by multiple objects
+                    if (supportsInstancing)
+                    {
+                        drawPacket.SetShaderOption(s_o_meshInstancingIsEnabled_Name, AZ::RPI::ShaderOptionValue{ true });
+                    }
+
                     // stencil bits
                     uint8_t stencilRef = m_descriptor.m_useForwardPassIblSpecular || materialRequiresForwardPassIblSpecular
                         ? Render::StencilRefs::None
@@ -1496,6 +1647,7 @@ namespace AZ
 
                     drawPacket.SetStencilRef(stencilRef);
                     drawPacket.SetSortKey(m_sortKey);
+                    drawPacket.SetBindlessMaterialId(bindlessMaterialId);
                     drawPacket.SetEnableDraw(meshMotionDrawListTag, m_flags.m_isDrawMotion);
                     drawPacket.Update(*m_scene, false);
 
@@ -2152,6 +2304,8 @@ namespace AZ
                 else
                 {
                     const InstanceGroupHandleList& instanceGroupHandleList = m_instanceGroupHandlesByLod[lodIndex + m_lodBias];
+                    PostCullingInstanceDataList& postCullingInstanceDataList = m_postCullingInstanceDataByLod[lodIndex + m_lodBias];
+                    postCullingInstanceDataList.clear();
                     for (const ModelDataInstance::InstanceGroupHandle& handle : instanceGroupHandleList)
                     {
                         // If mesh instancing is enabled, get the draw packet from the MeshInstanceManager
@@ -2163,12 +2317,25 @@ namespace AZ
                             cullData.m_drawListMask |= rhiDrawPacket->GetDrawListMask();
                         }
 
-                        // Set the user data for the cullable lod to reference the intance group handles for the lod
-                        lod.m_visibleObjectUserData = static_cast<void*>(&m_instanceGroupHandlesByLod[lodIndex + m_lodBias]);
+                        postCullingInstanceDataList.push_back(PostCullingInstanceData{ handle, m_objectId });
+
+                        // Set the user data for the cullable lod to reference the intance groups and object id for the lod
+                        lod.m_visibleObjectUserData = static_cast<void*>(&postCullingInstanceDataList);
                     }
                 }
             }
 
+            // Lod streaming requires the lods of the cullable to match the lods of the model
+            if (m_lodBias != 0)
+            {
+                m_model->DisableLodStreaming();
+            }
+            else if (r_meshLodStreamingEnabled)
+            {
+                m_model->EnableLodStreaming();
+            }
+            lodData.m_lodResidency = m_model->GetLodResidency();
+
             cullData.m_hideFlags = RPI::View::UsageNone;
             if (m_descriptor.m_excludeFromReflectionCubeMaps)
             {
@@ -2320,6 +2487,27 @@ namespace AZ
             return requiresForwardPassIbl;
         }
 
+        bool ModelDataInstance::MaterialSupportsInstancing(Data::Instance<RPI::Material> material) const
+        {
+            // Every shader that draws the mesh has to read the transform from the instance buffer for the draw packet to be shared,
+            // which the shaders indicate by having the o_meshInstancingIsEnabled option from InstancedTransforms.azsli
+            bool supportsInstancing = true;
+            material->ForAllShaderItems(
+                [&](const Name&, const RPI::ShaderCollection::Item& shaderItem)
+                {
+                    if (shaderItem.IsEnabled() &&
+                        !shaderItem.GetShaderOptionGroup().GetShaderOptionLayout()->FindShaderOptionIndex(s_o_meshInstancingIsEnabled_Name).IsValid())
+                    {
+                        supportsInstancing = false;
+                        return false; // break
+                    }
+
+                    return true; // continue
+                });
+
+            return supportsInstancing;
+        }
+
         void ModelDataInstance::SetVisible(bool isVisible)
         {
             m_flags.m_visible = isVisible;
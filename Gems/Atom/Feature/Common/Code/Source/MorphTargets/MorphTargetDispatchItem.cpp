@@ -13,28 +13,57 @@
 #include <Atom/RPI.Public/Shader/Shader.h>
 #include <Atom/RPI.Public/Model/ModelLod.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 
 #include <Atom/RHI/Factory.h>
 #include <Atom/RHI/BufferView.h>
 
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
 #include <limits>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(float, r_morphTargetWeightThreshold, 0.0001f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Morph targets with an absolute weight below this threshold are skipped by the morph target compute shader.");
+
         MorphTargetDispatchItem::MorphTargetDispatchItem(
             const AZStd::intrusive_ptr<MorphTargetInputBuffers> inputBuffers,
-            const MorphTargetComputeMetaData& morphTargetComputeMetaData,
+            const AZStd::vector<MorphTargetComputeMetaData>& lodMorphTargetMetaDatas,
+            uint32_t meshIndex,
             SkinnedMeshFeatureProcessor* skinnedMeshFeatureProcessor,
             MorphTargetInstanceMetaData morphInstanceMetaData,
             float morphDeltaIntegerEncoding)
             : m_inputBuffers(inputBuffers)
-            , m_morphTargetComputeMetaData(morphTargetComputeMetaData)
             , m_morphInstanceMetaData(morphInstanceMetaData)
             , m_accumulatedDeltaIntegerEncoding(morphDeltaIntegerEncoding)
         {
+            // Give each morph target of the mesh a contiguous range of threads, in the order they were added to the lod
+            for (uint32_t lodMorphTargetIndex = 0; lodMorphTargetIndex < lodMorphTargetMetaDatas.size(); ++lodMorphTargetIndex)
+            {
+                const MorphTargetComputeMetaData& metaData = lodMorphTargetMetaDatas[lodMorphTargetIndex];
+                if (metaData.m_meshIndex != meshIndex || metaData.m_vertexCount == 0)
+                {
+                    continue;
+                }
+
+                MorphTarget morphTarget;
+                morphTarget.m_firstThread = m_totalDeltaCount;
+                morphTarget.m_deltaOffset = metaData.m_deltaOffset;
+                morphTarget.m_minDelta = metaData.m_minDelta;
+                morphTarget.m_maxDelta = metaData.m_maxDelta;
+                m_morphTargets.push_back(morphTarget);
+                m_lodMorphTargetIndices.push_back(lodMorphTargetIndex);
+
+                m_totalDeltaCount += metaData.m_vertexCount;
+            }
+
             m_morphTargetShader = skinnedMeshFeatureProcessor->GetMorphTargetShader();
             RPI::ShaderReloadNotificationBus::Handler::BusConnect(m_morphTargetShader->GetAssetId());
         }
@@ -86,7 +115,7 @@ namespace AZ
                 AZ_Error("MorphTargetDispatchItem", false, outcome.GetError().c_str());
             }
 
-            arguments.m_totalNumberOfThreadsX = m_morphTargetComputeMetaData.m_vertexCount;
+            arguments.m_totalNumberOfThreadsX = m_totalDeltaCount;
             arguments.m_totalNumberOfThreadsY = 1;
             arguments.m_totalNumberOfThreadsZ = 1;
 
@@ -111,6 +140,27 @@ namespace AZ
             
             m_inputBuffers->SetBufferViewsOnShaderResourceGroup(m_instanceSrg);
 
+            if (!m_morphTargetBuffer)
+            {
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                desc.m_bufferName = "MorphTargetWeights";
+                desc.m_byteCount = AZStd::max<uint32_t>(1u, GetMorphTargetCount()) * sizeof(MorphTarget);
+                desc.m_elementSize = sizeof(MorphTarget);
+                desc.m_bufferData = m_morphTargets.empty() ? nullptr : m_morphTargets.data();
+                m_morphTargetBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                if (!m_morphTargetBuffer)
+                {
+                    AZ_Error("MorphTargetDispatchItem", false, "Failed to create the morph target buffer");
+                    return false;
+                }
+                m_morphTargetBufferDirty = false;
+            }
+
+            RHI::ShaderInputBufferIndex morphTargetsIndex = m_instanceSrg->FindShaderInputBufferIndex(Name{ "m_morphTargets" });
+            AZ_Error("MorphTargetDispatchItem", morphTargetsIndex.IsValid(), "Failed to find shader input index for 'm_morphTargets' in the morph target compute shader per-instance SRG.");
+            m_instanceSrg->SetBuffer(morphTargetsIndex, m_morphTargetBuffer);
+
             m_instanceSrg->Compile();
 
             m_dispatchItem.m_uniqueShaderResourceGroup = m_instanceSrg->GetRHIShaderResourceGroup();
@@ -119,8 +169,10 @@ namespace AZ
 
         void MorphTargetDispatchItem::InitRootConstants(const RHI::ConstantsLayout* rootConstantsLayout)
         {
-            auto vertexCountIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_vertexCount" });
-            AZ_Error("MorphTargetDispatchItem", vertexCountIndex.IsValid(), "Could not find root constant 's_vertexCount' in the shader");
+            auto totalDeltaCountIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_totalDeltaCount" });
+            AZ_Error("MorphTargetDispatchItem", totalDeltaCountIndex.IsValid(), "Could not find root constant 's_totalDeltaCount' in the shader");
+            auto morphTargetCountIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_morphTargetCount" });
+            AZ_Error("MorphTargetDispatchItem", morphTargetCountIndex.IsValid(), "Could not find root constant 's_morphTargetCount' in the shader");
             auto positionOffsetIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_targetPositionOffset" });
             AZ_Error("MorphTargetDispatchItem", positionOffsetIndex.IsValid(), "Could not find root constant 's_targetPositionOffset' in the shader");
             auto normalOffsetIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_targetNormalOffset" });
@@ -130,21 +182,16 @@ namespace AZ
             auto bitangentOffsetIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_targetBitangentOffset" });
             AZ_Error("MorphTargetDispatchItem", bitangentOffsetIndex.IsValid(), "Could not find root constant 's_targetBitangentOffset' in the shader");
 
-            auto minIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_min" });
-            AZ_Error("MorphTargetDispatchItem", minIndex.IsValid(), "Could not find root constant 's_min' in the shader");
-            auto maxIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_max" });
-            AZ_Error("MorphTargetDispatchItem", maxIndex.IsValid(), "Could not find root constant 's_max' in the shader");
             auto morphDeltaIntegerEncodingIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_accumulatedDeltaIntegerEncoding" });
             AZ_Error("MorphTargetDispatchItem", morphDeltaIntegerEncodingIndex.IsValid(), "Could not find root constant 's_accumulatedDeltaIntegerEncoding' in the shader");
-            m_weightIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_weight" });
-            AZ_Error("MorphTargetDispatchItem", m_weightIndex.IsValid(), "Could not find root constant 's_weight' in the shader");
+            m_weightThresholdIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_weightThreshold" });
+            AZ_Error("MorphTargetDispatchItem", m_weightThresholdIndex.IsValid(), "Could not find root constant 's_weightThreshold' in the shader");
 
             m_rootConstantData = AZ::RHI::ConstantsData(rootConstantsLayout);
-            m_rootConstantData.SetConstant(minIndex, m_morphTargetComputeMetaData.m_minDelta);
-            m_rootConstantData.SetConstant(maxIndex, m_morphTargetComputeMetaData.m_maxDelta);
             m_rootConstantData.SetConstant(morphDeltaIntegerEncodingIndex, m_accumulatedDeltaIntegerEncoding);
-            m_rootConstantData.SetConstant(m_weightIndex, 0.0f);
-            m_rootConstantData.SetConstant(vertexCountIndex, m_morphTargetComputeMetaData.m_vertexCount);
+            m_rootConstantData.SetConstant(m_weightThresholdIndex, static_cast<float>(r_morphTargetWeightThreshold));
+            m_rootConstantData.SetConstant(totalDeltaCountIndex, m_totalDeltaCount);
+            m_rootConstantData.SetConstant(morphTargetCountIndex, GetMorphTargetCount());
             // The buffer is using 32-bit integers, so divide the offset by 4 here so it doesn't have to be done in the shader
             m_rootConstantData.SetConstant(positionOffsetIndex, m_morphInstanceMetaData.m_accumulatedPositionDeltaOffsetInBytes / 4);
             m_rootConstantData.SetConstant(normalOffsetIndex, m_morphInstanceMetaData.m_accumulatedNormalDeltaOffsetInBytes / 4);
@@ -155,15 +202,54 @@ namespace AZ
             m_dispatchItem.m_rootConstants = m_rootConstantData.GetConstantData().data();
         }
 
-        void MorphTargetDispatchItem::SetWeight(float weight)
+        bool MorphTargetDispatchItem::SetWeights(AZStd::span<const float> lodWeights)
         {
-            m_rootConstantData.SetConstant(m_weightIndex, weight);
-            m_dispatchItem.m_rootConstants = m_rootConstantData.GetConstantData().data();
+            bool weightsChanged = false;
+            for (size_t morphTargetIndex = 0; morphTargetIndex < m_morphTargets.size(); ++morphTargetIndex)
+            {
+                const uint32_t lodMorphTargetIndex = m_lodMorphTargetIndices[morphTargetIndex];
+                AZ_Assert(lodMorphTargetIndex < lodWeights.size(), "MorphTargetDispatchItem - Not enough morph target weights for the lod.");
+                if (m_morphTargets[morphTargetIndex].m_weight != lodWeights[lodMorphTargetIndex])
+                {
+                    m_morphTargets[morphTargetIndex].m_weight = lodWeights[lodMorphTargetIndex];
+                    weightsChanged = true;
+                }
+            }
+
+            m_morphTargetBufferDirty |= weightsChanged;
+            return weightsChanged;
+        }
+
+        bool MorphTargetDispatchItem::Update()
+        {
+            const float weightThreshold = r_morphTargetWeightThreshold;
+            const bool hasActiveMorphTarget = AZStd::any_of(m_morphTargets.begin(), m_morphTargets.end(),
+                [weightThreshold](const MorphTarget& morphTarget)
+                {
+                    return AZStd::abs(morphTarget.m_weight) >= weightThreshold && morphTarget.m_weight != 0.0f;
+                });
+            if (!hasActiveMorphTarget || !m_morphTargetBuffer)
+            {
+                return false;
+            }
+
+            if (m_morphTargetBufferDirty)
+            {
+                m_morphTargetBuffer->UpdateData(m_morphTargets.data(), m_morphTargets.size() * sizeof(MorphTarget), 0);
+                m_morphTargetBufferDirty = false;
+            }
+
+            if (m_rootConstantData.GetConstant<float>(m_weightThresholdIndex) != weightThreshold)
+            {
+                m_rootConstantData.SetConstant(m_weightThresholdIndex, weightThreshold);
+                m_dispatchItem.m_rootConstants = m_rootConstantData.GetConstantData().data();
+            }
+            return true;
         }
 
-        float MorphTargetDispatchItem::GetWeight() const
+        uint32_t MorphTargetDispatchItem::GetMorphTargetCount() const
         {
-            return m_rootConstantData.GetConstant<float>(m_weightIndex);
+            return aznumeric_cast<uint32_t>(m_morphTargets.size());
         }
 
         const RHI::DispatchItem& MorphTargetDispatchItem::GetRHIDispatchItem() const
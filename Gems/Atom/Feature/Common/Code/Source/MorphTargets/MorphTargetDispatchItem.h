@@ -15,6 +15,9 @@
 #include <Atom/RHI/ConstantsData.h>
 #include <AtomCore/Instance/Instance.h>
 
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
 namespace AZ
 {
     namespace RHI
@@ -35,7 +38,9 @@ namespace AZ
     {
         class SkinnedMeshFeatureProcessor;
 
-        //! Holds and manages an RHI DispatchItem for a specific morph target, and the resources that are needed to build and maintain it.
+        //! Holds and manages an RHI DispatchItem that applies all the morph targets of a mesh, and the resources that are needed to build and maintain it.
+        //! The dispatch has one thread per delta of all the morph targets of the mesh. Each thread finds its morph target in a table
+        //! with the offset, the compression range and the weight of each morph target, and skips the morph targets with a negligible weight.
         class MorphTargetDispatchItem
             : private RPI::ShaderReloadNotificationBus::Handler
         {
@@ -43,10 +48,13 @@ namespace AZ
             AZ_CLASS_ALLOCATOR(MorphTargetDispatchItem, AZ::SystemAllocator);
 
             MorphTargetDispatchItem() = delete;
-            //! Create one dispatch item per morph target
+            //! Create one dispatch item per mesh with morph targets
+            //! @param inputBuffers The deltas of all the morph targets of the mesh
+            //! @param lodMorphTargetMetaDatas The metadata of all the morph targets of the lod. Only the ones that modify the mesh are applied.
             explicit MorphTargetDispatchItem(
                 const AZStd::intrusive_ptr<MorphTargetInputBuffers> inputBuffers,
-                const MorphTargetComputeMetaData& morphTargetMetaData,
+                const AZStd::vector<MorphTargetComputeMetaData>& lodMorphTargetMetaDatas,
+                uint32_t meshIndex,
                 SkinnedMeshFeatureProcessor* skinnedMeshFeatureProcessor,
                 MorphTargetInstanceMetaData morphInstanceMetaData,
                 float accumulatedDeltaRange
@@ -60,8 +68,17 @@ namespace AZ
 
             const RHI::DispatchItem& GetRHIDispatchItem() const;
 
-            void SetWeight(float weight);
-            float GetWeight() const;
+            //! Set the weights of the morph targets of the mesh.
+            //! @param lodWeights The weights of all the morph targets of the lod, in the order of the metadata the dispatch item was created with
+            //! @return True if the weight of any morph target of the mesh changed
+            bool SetWeights(AZStd::span<const float> lodWeights);
+
+            //! Uploads the weights if they changed since the last call.
+            //! @return False if all the weights are below the r_morphTargetWeightThreshold, and the dispatch item doesn't need to be submitted
+            bool Update();
+
+            //! Returns the number of morph targets of the mesh
+            uint32_t GetMorphTargetCount() const;
         private:
             bool InitPerInstanceSRG();
             void InitRootConstants(const RHI::ConstantsLayout* rootConstantsLayout);
@@ -76,14 +93,35 @@ namespace AZ
             // The morph target shader used for this instance
             Data::Instance<RPI::Shader> m_morphTargetShader;
 
-            // The vertex deltas
+            // The vertex deltas of all the morph targets of the mesh
             AZStd::intrusive_ptr<MorphTargetInputBuffers> m_inputBuffers;
 
             // The per-object shader resource group
             Data::Instance<RPI::ShaderResourceGroup> m_instanceSrg;
 
-            // Metadata used to set the root constants for the shader
-            MorphTargetComputeMetaData m_morphTargetComputeMetaData;
+            // Matches MorphTarget in MorphTargetSRG.azsli
+            struct MorphTarget
+            {
+                // The first thread of the dispatch that applies this morph target
+                uint32_t m_firstThread = 0;
+                // The offset of the first delta of this morph target within the deltas of the mesh
+                uint32_t m_deltaOffset = 0;
+                float m_minDelta = 0.0f;
+                float m_maxDelta = 0.0f;
+                float m_weight = 0.0f;
+                uint32_t m_pad[3] = { 0, 0, 0 };
+            };
+
+            // One entry per morph target of the mesh, and the buffer they are uploaded to when the weights change
+            AZStd::vector<MorphTarget> m_morphTargets;
+            Data::Instance<RPI::Buffer> m_morphTargetBuffer;
+            bool m_morphTargetBufferDirty = true;
+
+            // The index of each morph target of the mesh among the morph targets of the lod, used to pick their weights
+            AZStd::vector<uint32_t> m_lodMorphTargetIndices;
+
+            // The number of deltas of all the morph targets of the mesh, which is the number of threads of the dispatch
+            uint32_t m_totalDeltaCount = 0;
 
             AZ::RHI::ConstantsData m_rootConstantData;
 
@@ -92,8 +130,8 @@ namespace AZ
             // A conservative value for encoding/decoding the accumulated deltas
             float m_accumulatedDeltaIntegerEncoding;
 
-            // Keep track of the constant index of m_weight since it is updated frequently
-            RHI::ShaderInputConstantIndex m_weightIndex;
+            // Keep track of the constant index of s_weightThreshold since it follows the CVar
+            RHI::ShaderInputConstantIndex m_weightThresholdIndex;
         };
     } // namespace Render
 } // namespace AZ
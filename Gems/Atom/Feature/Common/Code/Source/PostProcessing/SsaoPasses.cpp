@@ -12,6 +12,8 @@
 #include <PostProcessing/SsaoPasses.h>
 #include <AzCore/Math/MathUtils.h>
 #include <Atom/Feature/PostProcess/Ssao/SsaoConstants.h>
+#include <Atom/RPI.Public/Image/AttachmentImagePool.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/View.h>
@@ -73,11 +75,15 @@ namespace AZ
             m_blurVerticalPass = azrtti_cast<FastDepthAwareBlurVerPass*>(m_blurParentPass->FindChildPass(Name("VerticalBlur")).get());
             m_downsamplePass = FindChildPass(Name("DepthDownsample")).get();
             m_upsamplePass = FindChildPass(Name("Upsample")).get();
+            m_temporalPass = azrtti_cast<SsaoTemporalPass*>(FindChildPass(Name("SsaoTemporal")).get());
+            m_temporalCopyHistoryPass = FindChildPass(Name("SsaoTemporalCopyHistory")).get();
 
             AZ_Assert(m_blurHorizontalPass, "[SsaoParentPass] Could not retrieve horizontal blur pass.");
             AZ_Assert(m_blurVerticalPass, "[SsaoParentPass] Could not retrieve vertical blur pass.");
             AZ_Assert(m_downsamplePass, "[SsaoParentPass] Could not retrieve downsample pass.");
             AZ_Assert(m_upsamplePass, "[SsaoParentPass] Could not retrieve upsample pass.");
+            AZ_Assert(m_temporalPass, "[SsaoParentPass] Could not retrieve temporal pass.");
+            AZ_Assert(m_temporalCopyHistoryPass, "[SsaoParentPass] Could not retrieve temporal copy history pass.");
         }
 
         void SsaoParentPass::FrameBeginInternal(FramePrepareParams params)
@@ -96,6 +102,7 @@ namespace AZ
                         bool ssaoEnabled = ssaoSettings->GetEnabled();
                         bool blurEnabled = ssaoEnabled && ssaoSettings->GetEnableBlur();
                         bool downsampleEnabled = ssaoEnabled && ssaoSettings->GetEnableDownsample();
+                        bool temporalEnabled = ssaoEnabled && ssaoSettings->GetEnableTemporalFilter();
 
                         m_blurParentPass->SetEnabled(blurEnabled);
                         if (blurEnabled)
@@ -110,6 +117,14 @@ namespace AZ
 
                         m_downsamplePass->SetEnabled(downsampleEnabled);
                         m_upsamplePass->SetEnabled(downsampleEnabled);
+
+                        // The history is stale once the filter was off for a frame
+                        if (temporalEnabled && !m_temporalPass->IsEnabled())
+                        {
+                            m_temporalPass->ResetHistory();
+                        }
+                        m_temporalPass->SetEnabled(temporalEnabled);
+                        m_temporalCopyHistoryPass->SetEnabled(temporalEnabled);
                     }
                 }
             }
@@ -196,5 +211,134 @@ namespace AZ
             RPI::ComputePass::FrameBeginInternal(params);
         }
 
+        // --- SSAO Temporal Pass ---
+
+        RPI::Ptr<SsaoTemporalPass> SsaoTemporalPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<SsaoTemporalPass> pass = aznew SsaoTemporalPass(descriptor);
+            return AZStd::move(pass);
+        }
+
+        SsaoTemporalPass::SsaoTemporalPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+        { }
+
+        void SsaoTemporalPass::ResetHistory()
+        {
+            m_historyValid = false;
+        }
+
+        void SsaoTemporalPass::CreateHistoryAttachmentImage(RPI::Ptr<RPI::PassAttachment>& historyAttachment)
+        {
+            Data::Instance<RPI::AttachmentImagePool> pool = RPI::ImageSystemInterface::Get()->GetSystemAttachmentPool();
+
+            m_currentHistoryAttachmentImage = (m_currentHistoryAttachmentImage + 1) % ImageFrameCount;
+
+            RHI::ImageViewDescriptor viewDesc = RHI::ImageViewDescriptor::Create(RHI::Format::R8_UNORM, 0, 0);
+            RHI::ClearValue clearValue = RHI::ClearValue::CreateVector4Float(1.0f, 1.0f, 1.0f, 1.0f);
+            m_historyAttachmentImage[m_currentHistoryAttachmentImage] = RPI::AttachmentImage::Create(
+                *pool.get(), historyAttachment->m_descriptor.m_image, Name(historyAttachment->m_path.GetCStr()), &clearValue, &viewDesc);
+
+            historyAttachment->m_importedResource = m_historyAttachmentImage[m_currentHistoryAttachmentImage];
+            m_historyValid = false;
+        }
+
+        void SsaoTemporalPass::BuildInternal()
+        {
+            // the history matches the size of the SSAO output
+            RHI::ImageDescriptor outputImageDesc = m_ownedAttachments[0]->m_descriptor.m_image;
+
+            RHI::ImageBindFlags imageBindFlags = RHI::ImageBindFlags::Color | RHI::ImageBindFlags::ShaderRead;
+            RHI::ImageDescriptor historyImageDesc = RHI::ImageDescriptor::Create2D(
+                imageBindFlags, outputImageDesc.m_size.m_width, outputImageDesc.m_size.m_height, RHI::Format::R8_UNORM);
+
+            RPI::Ptr<RPI::PassAttachment> historyAttachment = aznew RPI::PassAttachment();
+            AZStd::string historyAttachmentName = AZStd::string::format("%s.Ssao_HistoryImage", GetPathName().GetCStr());
+            historyAttachment->m_name = historyAttachmentName;
+            historyAttachment->m_path = historyAttachmentName;
+            historyAttachment->m_lifetime = RHI::AttachmentLifetimeType::Imported;
+            historyAttachment->m_descriptor = historyImageDesc;
+            m_ownedAttachments.push_back(historyAttachment);
+
+            CreateHistoryAttachmentImage(historyAttachment);
+
+            m_historyAttachmentBinding = FindAttachmentBinding(AZ::Name("History"));
+            AZ_Assert(m_historyAttachmentBinding, "SsaoTemporalPass: Missing History slot!");
+            m_historyAttachmentBinding->SetAttachment(historyAttachment);
+
+            RPI::ComputePass::BuildInternal();
+        }
+
+        void SsaoTemporalPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            // Must match the struct in SsaoTemporal.azsl
+            struct SsaoTemporalConstants
+            {
+                // The texture dimensions of SSAO output
+                AZStd::array<u32, 2> m_outputSize;
+
+                // The size of a pixel relative to screenspace UV
+                AZStd::array<float, 2> m_pixelSize;
+
+                // How much of the reprojected history is kept, 0 when there is no valid history
+                float m_historyWeight = 0.0f;
+
+            } temporalConstants{};
+
+            RPI::Scene* scene = GetScene();
+            PostProcessFeatureProcessor* fp = scene->GetFeatureProcessor<PostProcessFeatureProcessor>();
+            AZ::RPI::ViewPtr view = scene->GetDefaultRenderPipeline()->GetDefaultView();
+            if (fp && m_historyValid)
+            {
+                PostProcessSettings* postProcessSettings = fp->GetLevelSettingsFromView(view);
+                if (postProcessSettings)
+                {
+                    SsaoSettings* ssaoSettings = postProcessSettings->GetSsaoSettings();
+                    if (ssaoSettings)
+                    {
+                        temporalConstants.m_historyWeight = AZ::GetClamp(ssaoSettings->GetTemporalHistoryWeight(), 0.0f, 1.0f);
+                    }
+                }
+            }
+
+            AZ_Assert(GetOutputCount() > 0, "SsaoTemporalPass: No output bindings!");
+            RPI::PassAttachment* outputAttachment = GetOutputBinding(0).GetAttachment().get();
+
+            AZ_Assert(outputAttachment != nullptr, "SsaoTemporalPass: Output binding has no attachment!");
+            RHI::Size size = outputAttachment->m_descriptor.m_image.m_size;
+
+            temporalConstants.m_outputSize[0] = size.m_width;
+            temporalConstants.m_outputSize[1] = size.m_height;
+
+            temporalConstants.m_pixelSize[0] = 1.0f / float(size.m_width);
+            temporalConstants.m_pixelSize[1] = 1.0f / float(size.m_height);
+
+            m_shaderResourceGroup->SetConstant(m_constantsIndex, temporalConstants);
+
+            // From here on the copy pass keeps the history up to date
+            m_historyValid = true;
+
+            RPI::ComputePass::FrameBeginInternal(params);
+        }
+
+        void SsaoTemporalPass::FrameEndInternal()
+        {
+            RPI::Ptr<RPI::PassAttachment> historyAttachment = m_historyAttachmentBinding->GetAttachment();
+            historyAttachment->Update();
+
+            RHI::Size& historyImageSize = historyAttachment->m_descriptor.m_image.m_size;
+            RHI::Size& outputImageSize = m_ownedAttachments[0]->m_descriptor.m_image.m_size;
+
+            if (historyImageSize != outputImageSize)
+            {
+                historyImageSize = outputImageSize;
+
+                CreateHistoryAttachmentImage(historyAttachment);
+                m_historyAttachmentBinding->SetAttachment(historyAttachment);
+            }
+
+            RPI::ComputePass::FrameEndInternal();
+        }
+
     }   // namespace Render
 }   // namespace AZ
@@ -9,11 +9,14 @@
 
 #include <Atom/RPI.Public/Pass/ComputePass.h>
 #include <Atom/RPI.Public/Pass/ParentPass.h>
+#include <Atom/RPI.Public/Image/AttachmentImage.h>
 
 namespace AZ
 {
     namespace Render
     {
+        class SsaoTemporalPass;
+
         // Parent pass for SSAO that contains the SSAO compute pass 
         class SsaoParentPass final
             : public RPI::ParentPass
@@ -44,6 +47,8 @@ namespace AZ
             FastDepthAwareBlurVerPass* m_blurVerticalPass = nullptr;
             Pass* m_downsamplePass = nullptr;
             Pass* m_upsamplePass = nullptr;
+            SsaoTemporalPass* m_temporalPass = nullptr;
+            Pass* m_temporalCopyHistoryPass = nullptr;
         };
 
         // Computer shader pass that calculates SSAO from a linear depth buffer
@@ -70,5 +75,47 @@ namespace AZ
             // SRG binding indices...
             AZ::RHI::ShaderInputNameIndex m_constantsIndex = "m_constants";
         };
+
+        // Compute shader pass that blends the SSAO result with the previous frames' result, reprojected using the camera motion
+        // reconstructed from the linear depth. This lets the SSAO run at a lower sample count or resolution while staying stable.
+        // The output is copied into the history image by a copy pass that runs after this one.
+        class SsaoTemporalPass final
+            : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(SsaoTemporalPass);
+
+        public:
+            AZ_RTTI(AZ::Render::SsaoTemporalPass, "{6C1E0B5D-2F37-4A8E-9D41-7B3A5C8E2F16}", AZ::RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(SsaoTemporalPass, SystemAllocator);
+            virtual ~SsaoTemporalPass() = default;
+
+            //! Creates an SsaoTemporalPass
+            static RPI::Ptr<SsaoTemporalPass> Create(const RPI::PassDescriptor& descriptor);
+
+            //! Discards the accumulated history, e.g. after the pass was disabled for a while
+            void ResetHistory();
+
+        protected:
+            // Behavior functions override...
+            void BuildInternal() override;
+            void FrameBeginInternal(FramePrepareParams params) override;
+            void FrameEndInternal() override;
+
+        private:
+            SsaoTemporalPass(const RPI::PassDescriptor& descriptor);
+
+            void CreateHistoryAttachmentImage(RPI::Ptr<RPI::PassAttachment>& historyAttachment);
+
+            static const uint32_t ImageFrameCount = 3;
+            Data::Instance<RPI::AttachmentImage> m_historyAttachmentImage[ImageFrameCount];
+            uint32_t m_currentHistoryAttachmentImage = 0;
+            RPI::PassAttachmentBinding* m_historyAttachmentBinding = nullptr;
+
+            // The history has no valid content until the pass ran once with the current history image
+            bool m_historyValid = false;
+
+            // SRG binding indices...
+            AZ::RHI::ShaderInputNameIndex m_constantsIndex = "m_constants";
+        };
     }   // namespace Render
 }   // namespace AZ
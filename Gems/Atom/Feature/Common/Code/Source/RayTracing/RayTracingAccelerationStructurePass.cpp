@@ -16,11 +16,18 @@
 #include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
 #include <RayTracing/RayTracingAccelerationStructurePass.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_rayTracingTlasMaxRefitCount, 16, nullptr, ConsoleFunctorFlags::Null,
+            "Maximum number of consecutive frames the TLAS is refitted instead of rebuilt when only the mesh transforms change, 0 always rebuilds the TLAS.");
+        AZ_CVAR(uint32_t, r_rayTracingMaxBlasBuildsPerFrame, 0, nullptr, ConsoleFunctorFlags::Null,
+            "Maximum number of meshes whose BLAS objects are built per frame, the meshes left over are added to the TLAS in the next frames. 0 builds all of them at once.");
+
         RPI::Ptr<RayTracingAccelerationStructurePass> RayTracingAccelerationStructurePass::Create(const RPI::PassDescriptor& descriptor)
         {
             RPI::Ptr<RayTracingAccelerationStructurePass> rayTracingAccelerationStructurePass = aznew RayTracingAccelerationStructurePass(descriptor);
@@ -57,19 +64,57 @@ namespace AZ
 
             if (rayTracingFeatureProcessor)
             {
-                if (rayTracingFeatureProcessor->GetRevision() != m_rayTracingRevision)
+                if (rayTracingFeatureProcessor->GetRevision() != m_rayTracingRevision || m_hasPendingBlasBuilds)
                 {
                     RHI::RayTracingBufferPools& rayTracingBufferPools = rayTracingFeatureProcessor->GetBufferPools();
                     RayTracingFeatureProcessor::SubMeshVector& subMeshes = rayTracingFeatureProcessor->GetSubMeshes();
                     uint32_t rayTracingSubMeshCount = rayTracingFeatureProcessor->GetSubMeshCount();
 
+                    // refit the TLAS if only the transforms of the meshes changed since the last build
+                    const bool meshSetChanged = rayTracingFeatureProcessor->GetMeshSetRevision() != m_meshSetRevision;
+                    m_rayTracingRevision = rayTracingFeatureProcessor->GetRevision();
+                    m_meshSetRevision = rayTracingFeatureProcessor->GetMeshSetRevision();
+
+                    // select the BLAS objects to build this frame
+                    const uint32_t maxBlasBuilds = r_rayTracingMaxBlasBuildsPerFrame;
+                    m_blasBuildList.clear();
+                    m_hasPendingBlasBuilds = false;
+                    RayTracingFeatureProcessor::BlasInstanceMap& blasInstances = rayTracingFeatureProcessor->GetBlasInstances();
+                    for (auto& blasInstance : blasInstances)
+                    {
+                        if (blasInstance.second.m_blasBuilt == false)
+                        {
+                            if (maxBlasBuilds > 0 && m_blasBuildList.size() >= maxBlasBuilds)
+                            {
+                                m_hasPendingBlasBuilds = true;
+                                break;
+                            }
+
+                            m_blasBuildList.push_back(blasInstance.first);
+                        }
+                    }
+
+                    const bool refit = !meshSetChanged && m_blasBuildList.empty() && !m_hasPendingBlasBuilds &&
+                        m_refitCount < r_rayTracingTlasMaxRefitCount;
+                    m_refitCount = refit ? m_refitCount + 1 : 0;
+
                     // create the TLAS descriptor
                     RHI::RayTracingTlasDescriptor tlasDescriptor;
-                    RHI::RayTracingTlasDescriptor* tlasDescriptorBuild = tlasDescriptor.Build();
+                    RHI::RayTracingTlasDescriptor* tlasDescriptorBuild = tlasDescriptor.Build()->Refit(refit);
 
                     uint32_t instanceIndex = 0;
                     for (auto& subMesh : subMeshes)
                     {
+                        // skip the meshes whose BLAS objects are not built yet, the instance index still advances since it
+                        // indexes the mesh data in the RayTracingSceneSrg
+                        auto itBlasInstance = blasInstances.find(subMesh.m_mesh->m_assetId);
+                        if (itBlasInstance != blasInstances.end() && itBlasInstance->second.m_blasBuilt == false &&
+                            AZStd::find(m_blasBuildList.begin(), m_blasBuildList.end(), subMesh.m_mesh->m_assetId) == m_blasBuildList.end())
+                        {
+                            instanceIndex++;
+                            continue;
+                        }
+
                         tlasDescriptorBuild->Instance()
                             ->InstanceID(instanceIndex)
                             ->HitGroupIndex(0)
@@ -85,6 +130,7 @@ namespace AZ
                     // create the TLAS buffers based on the descriptor
                     RHI::Ptr<RHI::RayTracingTlas>& rayTracingTlas = rayTracingFeatureProcessor->GetTlas();
                     rayTracingTlas->CreateBuffers(*device, &tlasDescriptor, rayTracingBufferPools);
+                    m_tlasBuildQueued = true;
 
                     // import and attach the TLAS buffer
                     const RHI::Ptr<RHI::Buffer>& rayTracingTlasBuffer = rayTracingTlas->GetTlasBuffer();
@@ -127,40 +173,44 @@ namespace AZ
                 return;
             }
 
-            if (!rayTracingFeatureProcessor->GetTlas()->GetTlasBuffer())
+            if (!m_tlasBuildQueued)
             {
+                // TLAS is up to date
                 return;
             }
 
-            if (rayTracingFeatureProcessor->GetRevision() == m_rayTracingRevision)
+            // clear the queued build, even if we don't have any meshes to process
+            m_tlasBuildQueued = false;
+
+            if (!rayTracingFeatureProcessor->GetTlas()->GetTlasBuffer())
             {
-                // TLAS is up to date
                 return;
             }
 
-            // update the stored revision, even if we don't have any meshes to process
-            m_rayTracingRevision = rayTracingFeatureProcessor->GetRevision();
-
             if (!rayTracingFeatureProcessor->GetSubMeshCount())
             {
                 // no ray tracing meshes in the scene
                 return;
             }
 
-            // build newly added BLAS objects
+            // build the BLAS objects selected for this frame
             RayTracingFeatureProcessor::BlasInstanceMap& blasInstances = rayTracingFeatureProcessor->GetBlasInstances();
-            for (auto& blasInstance : blasInstances)
+            for (const Data::AssetId& assetId : m_blasBuildList)
             {
-                if (blasInstance.second.m_blasBuilt == false)
+                auto itBlasInstance = blasInstances.find(assetId);
+                if (itBlasInstance == blasInstances.end() || itBlasInstance->second.m_blasBuilt)
                 {
-                    for (auto& blasInstanceSubMesh : blasInstance.second.m_subMeshes)
-                    {
-                        context.GetCommandList()->BuildBottomLevelAccelerationStructure(*blasInstanceSubMesh.m_blas);
-                    }
+                    continue;
+                }
 
-                    blasInstance.second.m_blasBuilt = true;
+                for (auto& blasInstanceSubMesh : itBlasInstance->second.m_subMeshes)
+                {
+                    context.GetCommandList()->BuildBottomLevelAccelerationStructure(*blasInstanceSubMesh.m_blas);
                 }
+
+                itBlasInstance->second.m_blasBuilt = true;
             }
+            m_blasBuildList.clear();
 
             // build the TLAS object
             context.GetCommandList()->BuildTopLevelAccelerationStructure(*rayTracingFeatureProcessor->GetTlas());
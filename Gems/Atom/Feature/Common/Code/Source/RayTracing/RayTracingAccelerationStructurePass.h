@@ -11,6 +11,8 @@
 #include <Atom/RPI.Public/Pass/Pass.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
 #include <Atom/RHI/RayTracingBufferPools.h>
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ
 {
@@ -48,6 +50,21 @@ namespace AZ
 
             // revision number of the ray tracing data when the TLAS was built
             uint32_t m_rayTracingRevision = 0;
+
+            // revision number of the ray tracing mesh set when the TLAS was built
+            uint32_t m_meshSetRevision = 0;
+
+            // number of consecutive TLAS refits since the last full build, refits degrade the quality of the TLAS
+            uint32_t m_refitCount = 0;
+
+            // true if there are BLAS objects left to build because of the per-frame build budget
+            bool m_hasPendingBlasBuilds = false;
+
+            // true if the TLAS was set up in SetupFrameGraphDependencies and needs to be built in BuildCommandList
+            bool m_tlasBuildQueued = false;
+
+            // the meshes whose BLAS objects are built this frame
+            AZStd::vector<Data::AssetId> m_blasBuildList;
         };
     }   // namespace RPI
 }   // namespace AZ
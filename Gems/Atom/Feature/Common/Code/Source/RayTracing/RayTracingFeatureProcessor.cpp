@@ -279,6 +279,7 @@ namespace AZ
             }
 
             m_revision++;
+            m_meshSetRevision++;
             m_subMeshCount += aznumeric_cast<uint32_t>(subMeshes.size());
 
             m_meshInfoBufferNeedsUpdate = true;
@@ -364,6 +365,7 @@ namespace AZ
                 m_subMeshCount -= aznumeric_cast<uint32_t>(mesh.m_subMeshIndices.size());
                 m_meshes.erase(itMesh);
                 m_revision++;
+                m_meshSetRevision++;
 
                 // reset all data structures if all meshes were removed (i.e., empty scene)
                 if (m_subMeshCount == 0)
@@ -213,6 +213,10 @@ namespace AZ
             //! This is used to determine if the RayTracingShaderTable needs to be rebuilt.
             uint32_t GetRevision() const { return m_revision; }
 
+            //! Retrieves the revision number of the set of ray tracing meshes, which only changes when meshes are added or removed.
+            //! Changes to the ray tracing data that keep the same revision of the mesh set only move the TLAS instances.
+            uint32_t GetMeshSetRevision() const { return m_meshSetRevision; }
+
             //! Retrieves the buffer pools used for ray tracing operations.
             RHI::RayTracingBufferPools& GetBufferPools() { return *m_bufferPools; }
 
@@ -281,6 +285,9 @@ namespace AZ
             // current revision number of ray tracing data
             uint32_t m_revision = 0;
 
+            // current revision number of the set of ray tracing meshes
+            uint32_t m_meshSetRevision = 0;
+
             // total number of ray tracing sub-meshes
             uint32_t m_subMeshCount = 0;
 
@@ -8,6 +8,7 @@
 
 #include <Shadows/ProjectedShadowFeatureProcessor.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <Math/GaussianMathFilter.h>
@@ -28,6 +29,11 @@
 
 namespace AZ::Render
 {
+    AZ_CVAR(float, r_projectedShadowThrottleDistance, 0.0f, nullptr, ConsoleFunctorFlags::Null,
+        "Distance from the camera beyond which the projected shadows only update every r_projectedShadowThrottleInterval frames. 0 disables the throttling.");
+    AZ_CVAR(uint32_t, r_projectedShadowThrottleInterval, 4, nullptr, ConsoleFunctorFlags::Null,
+        "Number of frames between the updates of the projected shadows beyond r_projectedShadowThrottleDistance.");
+
     void ProjectedShadowFeatureProcessor::Reflect(ReflectContext* context)
     {
         if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -290,7 +296,7 @@ namespace AZ::Render
         shadowData.m_unprojectConstants[0] = view->GetViewToClipMatrix().GetRow(2).GetElement(2);
         shadowData.m_unprojectConstants[1] = view->GetViewToClipMatrix().GetRow(2).GetElement(3);
 
-        if (shadowProperty.m_useCachedShadows && m_primaryProjectedShadowmapsPass)
+        if ((shadowProperty.m_useCachedShadows || m_shadowThrottlingEnabled) && m_primaryProjectedShadowmapsPass)
         {
             shadowProperty.m_shadowmapPass->ForceRenderNextFrame();
         }
@@ -669,6 +675,8 @@ namespace AZ::Render
 
         if (m_primaryProjectedShadowmapsPass != nullptr)
         {
+            UpdateShadowThrottling(packet);
+
             for (const RPI::ViewPtr& view : packet.m_views)
             {
                 if (view->GetUsageFlags() & RPI::View::UsageFlags::UsageCamera)
@@ -688,6 +696,48 @@ namespace AZ::Render
         }
     }
 
+    void ProjectedShadowFeatureProcessor::UpdateShadowThrottling(const FeatureProcessor::RenderPacket& packet)
+    {
+        const float throttleDistance = r_projectedShadowThrottleDistance;
+        const bool throttlingEnabled = throttleDistance > 0.0f && r_projectedShadowThrottleInterval > 1;
+        if (throttlingEnabled != m_shadowThrottlingEnabled)
+        {
+            // The passes of throttled shadows need to clear themselves with a draw, which UpdateShadowPasses() sets up next frame.
+            m_shadowThrottlingEnabled = throttlingEnabled;
+            m_shadowmapPassNeedsUpdate = true;
+            for (ShadowProperty& shadowProperty : m_shadowProperties.GetDataVector())
+            {
+                shadowProperty.m_shadowmapPass->SetUpdateInterval(1, 0);
+            }
+            return;
+        }
+
+        if (!m_shadowThrottlingEnabled || m_shadowmapPassNeedsUpdate)
+        {
+            return;
+        }
+
+        const float throttleDistanceSq = throttleDistance * throttleDistance;
+        for (ShadowProperty& shadowProperty : m_shadowProperties.GetDataVector())
+        {
+            // Shadows are throttled when they are far from every camera
+            const Vector3 shadowPosition = shadowProperty.m_desc.m_transform.GetTranslation();
+            bool isDistant = true;
+            for (const RPI::ViewPtr& view : packet.m_views)
+            {
+                if ((view->GetUsageFlags() & RPI::View::UsageFlags::UsageCamera) &&
+                    view->GetCameraTransform().GetTranslation().GetDistanceSq(shadowPosition) < throttleDistanceSq)
+                {
+                    isDistant = false;
+                    break;
+                }
+            }
+
+            const uint32_t updateInterval = isDistant ? r_projectedShadowThrottleInterval : 1;
+            shadowProperty.m_shadowmapPass->SetUpdateInterval(updateInterval, shadowProperty.m_shadowId.GetIndex());
+        }
+    }
+
     bool ProjectedShadowFeatureProcessor::FilterMethodIsEsm(const ShadowData& shadowData) const
     {
         return
@@ -856,7 +906,8 @@ namespace AZ::Render
 
                 SliceInfo& sliceInfoItem = sliceInfo.at(origin.m_arraySlice);
                 sliceInfoItem.m_shadowPasses.push_back(pass);
-                sliceInfoItem.m_hasStaticShadows = sliceInfoItem.m_hasStaticShadows || it.m_useCachedShadows;
+                // Throttled shadows are kept between frames like static shadows.
+                sliceInfoItem.m_hasStaticShadows = sliceInfoItem.m_hasStaticShadows || it.m_useCachedShadows || m_shadowThrottlingEnabled;
             }
         }
 
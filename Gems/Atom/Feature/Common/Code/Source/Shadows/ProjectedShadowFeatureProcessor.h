@@ -118,6 +118,9 @@ namespace AZ::Render
         void UpdateAtlas();
         void UpdateShadowPasses();
 
+        // Sets the update interval of the shadows far from the cameras, see r_projectedShadowThrottleDistance.
+        void UpdateShadowThrottling(const RenderPacket& packet);
+
         GpuBufferHandler m_shadowBufferHandler; // For ViewSRG m_projectedShadows
         GpuBufferHandler m_filterParamBufferHandler; // For ViewSRG m_projectedFilterParams
 
@@ -156,5 +159,6 @@ namespace AZ::Render
         bool m_deviceBufferNeedsUpdate = false;
         bool m_shadowmapPassNeedsUpdate = true;
         bool m_filterParameterNeedsUpdate = false;
+        bool m_shadowThrottlingEnabled = false;
     };
 }
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <SkinnedMesh/SkinnedMeshBatchDispatchItem.h>
+#include <SkinnedMesh/SkinnedMeshDispatchItem.h>
+#include <SkinnedMesh/SkinnedMeshFeatureProcessor.h>
+
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Public/RPIUtils.h>
+
+#include <Atom/RHI.Reflect/Bits.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        namespace
+        {
+            // The number of floats per bone of each skinning method, see LinearSkinningPassSRG.azsli
+            constexpr uint32_t LinearSkinningFloatsPerBone = 12;
+            constexpr uint32_t DualQuaternionSkinningFloatsPerBone = 8;
+
+            // Buffers start with 64 elements and grow in powers of two
+            constexpr uint32_t BatchBufferMinElementCount = 64;
+        }
+
+        SkinnedMeshBatchDispatchItem::SkinnedMeshBatchDispatchItem(
+            AZStd::intrusive_ptr<SkinnedMeshInputBuffers> inputBuffers,
+            uint32_t lodIndex,
+            uint32_t meshIndex,
+            const SkinnedMeshShaderOptions& shaderOptions,
+            SkinnedMeshFeatureProcessor* skinnedMeshFeatureProcessor)
+            : m_inputBuffers(AZStd::move(inputBuffers))
+            , m_lodIndex(lodIndex)
+            , m_meshIndex(meshIndex)
+            , m_shaderOptions(shaderOptions)
+        {
+            m_skinningShader = skinnedMeshFeatureProcessor->GetSkinningShader();
+
+            // CreateShaderOptionGroup will also connect to the SkinnedMeshShaderOptionNotificationBus
+            m_shaderOptionGroup = skinnedMeshFeatureProcessor->CreateSkinningShaderOptionGroup(m_shaderOptions, *this);
+        }
+
+        SkinnedMeshBatchDispatchItem::~SkinnedMeshBatchDispatchItem()
+        {
+            SkinnedMeshShaderOptionNotificationBus::Handler::BusDisconnect();
+        }
+
+        bool SkinnedMeshBatchDispatchItem::Init()
+        {
+            if (!m_skinningShader)
+            {
+                AZ_Error("SkinnedMeshBatchDispatchItem", false, "Cannot initialize a SkinnedMeshBatchDispatchItem with a null shader");
+                return false;
+            }
+
+            // Get the shader variant and instance SRG
+            m_shaderOptionGroup.SetUnspecifiedToDefaultValues();
+            const RPI::ShaderVariant& shaderVariant = m_skinningShader->GetVariant(m_shaderOptionGroup.GetShaderVariantId());
+
+            RHI::PipelineStateDescriptorForDispatch pipelineStateDescriptor;
+            shaderVariant.ConfigurePipelineState(pipelineStateDescriptor);
+
+            auto perInstanceSrgLayout = m_skinningShader->FindShaderResourceGroupLayout(AZ::Name{ "InstanceSrg" });
+            if (!perInstanceSrgLayout)
+            {
+                AZ_Error("SkinnedMeshBatchDispatchItem", false, "Failed to get shader resource group layout");
+                return false;
+            }
+
+            m_instanceSrg = RPI::ShaderResourceGroup::Create(m_skinningShader->GetAsset(), m_skinningShader->GetSupervariantIndex(), perInstanceSrgLayout->GetName());
+            if (!m_instanceSrg)
+            {
+                AZ_Error("SkinnedMeshBatchDispatchItem", false, "Failed to create shader resource group for skinned mesh batch");
+                return false;
+            }
+
+            // If the shader variation is not fully baked, set the fallback key to use a runtime branch for the shader options
+            if (!shaderVariant.IsFullyBaked() && m_instanceSrg->HasShaderVariantKeyFallbackEntry())
+            {
+                m_instanceSrg->SetShaderVariantKeyFallbackValue(m_shaderOptionGroup.GetShaderVariantKeyFallbackValue());
+            }
+
+            m_inputBuffers->SetBufferViewsOnShaderResourceGroup(m_lodIndex, m_meshIndex, m_instanceSrg);
+
+            const Name boneTransformsName = m_shaderOptions.m_skinningMethod == SkinningMethod::DualQuaternion
+                ? Name{ "m_boneTransformsDualQuaternion" }
+                : Name{ "m_boneTransformsLinear" };
+            m_boneTransformsIndex = m_instanceSrg->FindShaderInputBufferIndex(boneTransformsName);
+            m_batchInstancesIndex = m_instanceSrg->FindShaderInputBufferIndex(Name{ "m_batchInstances" });
+            m_batchInstanceCountIndex = m_instanceSrg->FindShaderInputConstantIndex(Name{ "m_batchInstanceCount" });
+            if (!m_boneTransformsIndex.IsValid() || !m_batchInstancesIndex.IsValid() || !m_batchInstanceCountIndex.IsValid())
+            {
+                AZ_Error("SkinnedMeshBatchDispatchItem", false, "Failed to find the batch shader inputs in the skinning compute shader per-instance SRG.");
+                return false;
+            }
+
+            const uint32_t vertexCount = m_inputBuffers->GetVertexCount(m_lodIndex, m_meshIndex);
+            uint32_t xThreads = 0;
+            uint32_t yThreads = 0;
+            CalculateSkinnedMeshTotalThreadsPerDimension(vertexCount, xThreads, yThreads);
+
+            // Set the total number of threads in the x dimension, so the shader can calculate the vertex index from the thread ids
+            RHI::ShaderInputConstantIndex totalNumberOfThreadsXIndex = m_instanceSrg->FindShaderInputConstantIndex(Name{ "m_totalNumberOfThreadsX" });
+            AZ_Error("SkinnedMeshBatchDispatchItem", totalNumberOfThreadsXIndex.IsValid(), "Failed to find shader input index for m_totalNumberOfThreadsX in the skinning compute shader per-instance SRG.");
+            m_instanceSrg->SetConstant(totalNumberOfThreadsXIndex, xThreads);
+
+            m_dispatchItem.m_pipelineState = m_skinningShader->AcquirePipelineState(pipelineStateDescriptor);
+
+            auto& arguments = m_dispatchItem.m_arguments.m_direct;
+            const auto outcome = RPI::GetComputeShaderNumThreads(m_skinningShader->GetAsset(), arguments);
+            if (!outcome.IsSuccess())
+            {
+                AZ_Error("SkinnedMeshBatchDispatchItem", false, outcome.GetError().c_str());
+            }
+
+            arguments.m_totalNumberOfThreadsX = xThreads;
+            arguments.m_totalNumberOfThreadsY = yThreads;
+            arguments.m_totalNumberOfThreadsZ = 0;
+
+            // The shader resource group is set when the instances are uploaded
+            m_dispatchItem.m_uniqueShaderResourceGroup = nullptr;
+            if (!m_instances.empty())
+            {
+                UpdateInstances();
+            }
+
+            return true;
+        }
+
+        void SkinnedMeshBatchDispatchItem::ClearInstances()
+        {
+            m_instances.clear();
+            m_boneTransforms.clear();
+        }
+
+        void SkinnedMeshBatchDispatchItem::AddInstance(const SkinnedMeshDispatchItem& dispatchItem, AZStd::span<const float> boneTransforms)
+        {
+            AZ_Assert(
+                dispatchItem.GetInputBuffers() == m_inputBuffers && dispatchItem.GetLodIndex() == m_lodIndex && dispatchItem.GetMeshIndex() == m_meshIndex,
+                "The dispatch item skins a different mesh than the SkinnedMeshBatchDispatchItem.");
+
+            const SkinnedMeshOutputVertexOffsets& outputOffsets = dispatchItem.GetOutputBufferOffsetsInBytes();
+
+            // The shader has a view with 4 bytes per element
+            // Divide the byte offsets here so it doesn't need to be done in the shader
+            BatchInstance instance;
+            instance.m_boneTransformsOffset = aznumeric_cast<uint32_t>(m_boneTransforms.size() / GetFloatsPerBone());
+            instance.m_targetPositions = outputOffsets[static_cast<uint8_t>(SkinnedMeshOutputVertexStreams::Position)] / 4;
+            instance.m_targetNormals = outputOffsets[static_cast<uint8_t>(SkinnedMeshOutputVertexStreams::Normal)] / 4;
+            instance.m_targetTangents = outputOffsets[static_cast<uint8_t>(SkinnedMeshOutputVertexStreams::Tangent)] / 4;
+            instance.m_targetBiTangents = outputOffsets[static_cast<uint8_t>(SkinnedMeshOutputVertexStreams::BiTangent)] / 4;
+            instance.m_targetPositionHistory = dispatchItem.GetPositionHistoryBufferOffsetInBytes() / 4;
+            m_instances.push_back(instance);
+
+            m_boneTransforms.insert(m_boneTransforms.end(), boneTransforms.begin(), boneTransforms.end());
+        }
+
+        bool SkinnedMeshBatchDispatchItem::UpdateInstances()
+        {
+            if (!m_instanceSrg || m_instances.empty())
+            {
+                return false;
+            }
+
+            const uint32_t instanceCount = aznumeric_cast<uint32_t>(m_instances.size());
+            const uint32_t floatsPerBone = GetFloatsPerBone();
+            if (!UpdateBuffer(m_instanceBuffer, "SkinnedMeshBatchInstances", sizeof(BatchInstance), m_instances.data(), instanceCount * sizeof(BatchInstance)) ||
+                !UpdateBuffer(m_boneTransformsBuffer, "SkinnedMeshBatchBoneTransforms", floatsPerBone * sizeof(float), m_boneTransforms.data(),
+                    aznumeric_cast<uint32_t>(m_boneTransforms.size() * sizeof(float))))
+            {
+                return false;
+            }
+
+            // The buffers may have been re-created by a resize, so they are bound every frame
+            m_instanceSrg->SetBuffer(m_batchInstancesIndex, m_instanceBuffer);
+            m_instanceSrg->SetBuffer(m_boneTransformsIndex, m_boneTransformsBuffer);
+            m_instanceSrg->SetConstant(m_batchInstanceCountIndex, instanceCount);
+            m_instanceSrg->Compile();
+
+            m_dispatchItem.m_uniqueShaderResourceGroup = m_instanceSrg->GetRHIShaderResourceGroup();
+            m_dispatchItem.m_arguments.m_direct.m_totalNumberOfThreadsZ = instanceCount;
+            return true;
+        }
+
+        bool SkinnedMeshBatchDispatchItem::UpdateBuffer(
+            Data::Instance<RPI::Buffer>& buffer, const char* bufferName, uint32_t elementSize, const void* data, uint32_t byteCount)
+        {
+            // Keep the size a multiple of the element size, so the buffer view covers the whole buffer
+            const uint32_t elementCount = RHI::NextPowerOfTwo(AZStd::max(BatchBufferMinElementCount, (byteCount + elementSize - 1) / elementSize));
+            const uint32_t bufferSize = elementCount * elementSize;
+            if (!buffer)
+            {
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                desc.m_bufferName = bufferName;
+                desc.m_byteCount = bufferSize;
+                desc.m_elementSize = elementSize;
+                buffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                if (!buffer)
+                {
+                    AZ_Error("SkinnedMeshBatchDispatchItem", false, "Failed to create the %s buffer", bufferName);
+                    return false;
+                }
+            }
+            else if (buffer->GetBufferSize() < byteCount)
+            {
+                buffer->Resize(bufferSize);
+            }
+
+            return buffer->UpdateData(data, byteCount, 0);
+        }
+
+        uint32_t SkinnedMeshBatchDispatchItem::GetFloatsPerBone() const
+        {
+            return m_shaderOptions.m_skinningMethod == SkinningMethod::DualQuaternion ? DualQuaternionSkinningFloatsPerBone : LinearSkinningFloatsPerBone;
+        }
+
+        const RHI::DispatchItem& SkinnedMeshBatchDispatchItem::GetRHIDispatchItem() const
+        {
+            return m_dispatchItem;
+        }
+
+        uint32_t SkinnedMeshBatchDispatchItem::GetInstanceCount() const
+        {
+            return aznumeric_cast<uint32_t>(m_instances.size());
+        }
+
+        void SkinnedMeshBatchDispatchItem::OnShaderReinitialized(const CachedSkinnedMeshShaderOptions* cachedShaderOptions)
+        {
+            m_shaderOptionGroup = cachedShaderOptions->CreateShaderOptionGroup(m_shaderOptions);
+
+            if (!Init())
+            {
+                AZ_Error("SkinnedMeshBatchDispatchItem", false, "Failed to re-initialize after the shader was re-loaded.");
+            }
+        }
+    } // namespace Render
+} // namespace AZ
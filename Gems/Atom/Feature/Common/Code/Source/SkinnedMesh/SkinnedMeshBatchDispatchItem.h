@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/Feature/SkinnedMesh/SkinnedMeshInputBuffers.h>
+#include <Atom/Feature/SkinnedMesh/SkinnedMeshShaderOptions.h>
+#include <SkinnedMesh/SkinnedMeshShaderOptionsCache.h>
+
+#include <Atom/RHI/DispatchItem.h>
+#include <AtomCore/Instance/Instance.h>
+#include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Buffer;
+        class Shader;
+        class ShaderResourceGroup;
+    }
+
+    namespace Render
+    {
+        class SkinnedMeshDispatchItem;
+        class SkinnedMeshFeatureProcessor;
+
+        //! Holds and manages an RHI DispatchItem that skins the same mesh for several instances at once.
+        //! The bone transforms of all the instances are gathered in one buffer, and the shader finds the bone transforms
+        //! and the output location of each instance from a per-instance table, with one instance per thread along z.
+        class SkinnedMeshBatchDispatchItem
+            : private SkinnedMeshShaderOptionNotificationBus::Handler
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(SkinnedMeshBatchDispatchItem, AZ::SystemAllocator);
+
+            SkinnedMeshBatchDispatchItem() = delete;
+            //! Create one batch per mesh of the input buffers that is skinned for several instances with the same shader options
+            explicit SkinnedMeshBatchDispatchItem(
+                AZStd::intrusive_ptr<SkinnedMeshInputBuffers> inputBuffers,
+                uint32_t lodIndex,
+                uint32_t meshIndex,
+                const SkinnedMeshShaderOptions& shaderOptions,
+                SkinnedMeshFeatureProcessor* skinnedMeshFeatureProcessor);
+            ~SkinnedMeshBatchDispatchItem();
+
+            // The event handler cannot be copied
+            AZ_DISABLE_COPY_MOVE(SkinnedMeshBatchDispatchItem);
+
+            bool Init();
+
+            //! Removes the instances of the previous frame from the batch.
+            void ClearInstances();
+
+            //! Adds an instance to the batch. The dispatch item must skin the same mesh with the same shader options as the batch.
+            //! @param boneTransforms The bone transforms of the instance, in the layout of the skinning method
+            void AddInstance(const SkinnedMeshDispatchItem& dispatchItem, AZStd::span<const float> boneTransforms);
+
+            //! Uploads the instances added since ClearInstances, and updates the dispatch item to skin them.
+            //! Returns false if the batch can't be dispatched this frame.
+            bool UpdateInstances();
+
+            const RHI::DispatchItem& GetRHIDispatchItem() const;
+            uint32_t GetInstanceCount() const;
+
+        private:
+            // SkinnedMeshShaderOptionNotificationBus::Handler
+            void OnShaderReinitialized(const CachedSkinnedMeshShaderOptions* cachedShaderOptions) override;
+
+            // Matches InstanceSrg::BatchInstance in LinearSkinningPassSRG.azsli
+            struct BatchInstance
+            {
+                uint32_t m_boneTransformsOffset = 0;
+                uint32_t m_targetPositions = 0;
+                uint32_t m_targetNormals = 0;
+                uint32_t m_targetTangents = 0;
+                uint32_t m_targetBiTangents = 0;
+                uint32_t m_targetPositionHistory = 0;
+            };
+
+            // Grows the buffer to hold the byte count, and uploads the data
+            bool UpdateBuffer(Data::Instance<RPI::Buffer>& buffer, const char* bufferName, uint32_t elementSize, const void* data, uint32_t byteCount);
+
+            uint32_t GetFloatsPerBone() const;
+
+            RHI::DispatchItem m_dispatchItem;
+
+            // The skinning shader used for this batch
+            Data::Instance<RPI::Shader> m_skinningShader;
+
+            // The unskinned vertices used as the source of the skinning, which are the same for all the instances
+            AZStd::intrusive_ptr<SkinnedMeshInputBuffers> m_inputBuffers;
+
+            // The index of the lod within m_inputBuffers that is represented by the DispatchItem
+            uint32_t m_lodIndex;
+
+            // The index of the mesh within the lod that is represented by the DispatchItem
+            uint32_t m_meshIndex;
+
+            // The shader resource group shared by the instances of the batch
+            Data::Instance<RPI::ShaderResourceGroup> m_instanceSrg;
+            RHI::ShaderInputBufferIndex m_boneTransformsIndex;
+            RHI::ShaderInputBufferIndex m_batchInstancesIndex;
+            RHI::ShaderInputConstantIndex m_batchInstanceCountIndex;
+
+            // The instances and their bone transforms gathered this frame, and the buffers they are uploaded to
+            AZStd::vector<BatchInstance> m_instances;
+            AZStd::vector<float> m_boneTransforms;
+            Data::Instance<RPI::Buffer> m_instanceBuffer;
+            Data::Instance<RPI::Buffer> m_boneTransformsBuffer;
+
+            // Options for the skinning shader
+            SkinnedMeshShaderOptions m_shaderOptions;
+            RPI::ShaderOptionGroup m_shaderOptionGroup;
+        };
+    } // namespace Render
+} // namespace AZ
@@ -242,6 +242,65 @@ namespace AZ
             return m_isEnabled;
         }
 
+        const AZStd::intrusive_ptr<SkinnedMeshInputBuffers>& SkinnedMeshDispatchItem::GetInputBuffers() const
+        {
+            return m_inputBuffers;
+        }
+
+        uint32_t SkinnedMeshDispatchItem::GetLodIndex() const
+        {
+            return m_lodIndex;
+        }
+
+        uint32_t SkinnedMeshDispatchItem::GetMeshIndex() const
+        {
+            return m_meshIndex;
+        }
+
+        const SkinnedMeshShaderOptions& SkinnedMeshDispatchItem::GetShaderOptions() const
+        {
+            return m_shaderOptions;
+        }
+
+        const SkinnedMeshOutputVertexOffsets& SkinnedMeshDispatchItem::GetOutputBufferOffsetsInBytes() const
+        {
+            return m_outputBufferOffsetsInBytes;
+        }
+
+        uint32_t SkinnedMeshDispatchItem::GetPositionHistoryBufferOffsetInBytes() const
+        {
+            return m_positionHistoryBufferOffsetInBytes;
+        }
+
+        void SkinnedMeshDispatchItem::SetSkinnedPose(uint32_t poseVersion, uint32_t frameIndex)
+        {
+            if (HasBeenSkinned() && poseVersion == m_skinnedPoseVersion)
+            {
+                m_skinnedPoseCount = AZStd::min(m_skinnedPoseCount + 1, 2u);
+            }
+            else
+            {
+                m_skinnedPoseVersion = poseVersion;
+                m_skinnedPoseCount = 1;
+            }
+            m_lastSkinnedFrame = frameIndex;
+        }
+
+        bool SkinnedMeshDispatchItem::HasBeenSkinned() const
+        {
+            return m_skinnedPoseCount > 0;
+        }
+
+        bool SkinnedMeshDispatchItem::IsSkinnedPoseUpToDate(uint32_t poseVersion) const
+        {
+            return m_skinnedPoseCount >= 2 && poseVersion == m_skinnedPoseVersion;
+        }
+
+        uint32_t SkinnedMeshDispatchItem::GetLastSkinnedFrame() const
+        {
+            return m_lastSkinnedFrame;
+        }
+
         void SkinnedMeshDispatchItem::OnShaderReinitialized(const CachedSkinnedMeshShaderOptions* cachedShaderOptions)
         {
             m_shaderOptionGroup = cachedShaderOptions->CreateShaderOptionGroup(m_shaderOptions);
@@ -71,6 +71,25 @@ namespace AZ
             void Enable();
             void Disable();
             bool IsEnabled() const;
+
+            const AZStd::intrusive_ptr<SkinnedMeshInputBuffers>& GetInputBuffers() const;
+            uint32_t GetLodIndex() const;
+            uint32_t GetMeshIndex() const;
+            const SkinnedMeshShaderOptions& GetShaderOptions() const;
+            const SkinnedMeshOutputVertexOffsets& GetOutputBufferOffsetsInBytes() const;
+            uint32_t GetPositionHistoryBufferOffsetInBytes() const;
+
+            //! Records that the dispatch item is queued for skinning the pose with the version during the frame.
+            void SetSkinnedPose(uint32_t poseVersion, uint32_t frameIndex);
+
+            //! Whether the output of the dispatch item was skinned at least once, and so holds a valid pose.
+            bool HasBeenSkinned() const;
+
+            //! Whether both the output and the position history hold the pose with the version, so skinning it again gives the same result.
+            bool IsSkinnedPoseUpToDate(uint32_t poseVersion) const;
+
+            //! The frame the dispatch item was last queued for skinning.
+            uint32_t GetLastSkinnedFrame() const;
         private:
             // SkinnedMeshShaderOptionNotificationBus::Handler
             void OnShaderReinitialized(const CachedSkinnedMeshShaderOptions* cachedShaderOptions) override;
@@ -112,6 +131,11 @@ namespace AZ
 
             // Skip the skinning dispatch if this is false
             bool m_isEnabled = true;
+
+            // The pose in the output, and how many times in a row it was skinned up to 2, since the position history holds the previous result
+            uint32_t m_skinnedPoseVersion = 0;
+            uint32_t m_skinnedPoseCount = 0;
+            uint32_t m_lastSkinnedFrame = 0;
         };
 
         //! The skinned mesh compute shader has Nx1x1 threads per group and dispatches a total number of threads greater than or equal to the number of vertices in the mesh, with one vertex skinned per thread.
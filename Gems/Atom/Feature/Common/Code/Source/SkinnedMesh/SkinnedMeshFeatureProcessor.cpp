@@ -25,15 +25,36 @@
 
 #include <Atom/RHI/CommandList.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(bool, r_skinnedMeshBatching, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Skin the meshes shared by several skinned mesh instances in one dispatch.");
+
+        AZ_CVAR(uint32_t, r_skinnedMeshBatchMinInstanceCount, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The minimum number of instances skinning the same mesh for them to be skinned in one dispatch.");
+
+        AZ_CVAR(float, r_skinnedMeshMinScreenCoverage, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Skinned mesh instances with a lower approximate screen coverage in all the views are not skinned, and keep the pose "
+            "of the last frame they were skinned. 0 skins all the instances.");
+
+        AZ_CVAR(AZ::CVarFixedString, r_skinnedMeshLodSkinningIntervals, "1", nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of frames between the skinning of each lod of the skinned meshes, separated by commas. "
+            "The last value applies to the remaining lods, for example \"1,1,2,4\". Unchanged poses are never skinned again.");
+
+        // The number of frames a skinning batch is kept after it was last dispatched
+        static constexpr uint32_t SkinningBatchEvictionFrameCount = 60;
+
         const char* SkinnedMeshFeatureProcessor::s_featureProcessorName = "SkinnedMeshFeatureProcessor";
 
         void SkinnedMeshFeatureProcessor::Reflect(ReflectContext* context)
@@ -58,6 +79,7 @@ namespace AZ
             DisableSceneNotification();
 
             m_statsCollector = nullptr;
+            m_skinningBatches.clear();
 
             AZ_Warning("SkinnedMeshFeatureProcessor", m_renderProxies.size() == 0,
                 "Deactivaing the SkinnedMeshFeatureProcessor, but there are still outstanding render proxy handles. Components\n"
@@ -158,10 +180,10 @@ namespace AZ
                                                 }
                                             }
                                             
-                                            for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy->m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
+                                            // Add one morph target dispatch item for each mesh in the lod with an active morph target
+                                            for (const AZStd::unique_ptr<MorphTargetDispatchItem>& dispatchItem : renderProxy->m_morphTargetDispatchItemsByLod[lodIndex])
                                             {
-                                                const MorphTargetDispatchItem* dispatchItem = renderProxy->m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                                if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
+                                                if (dispatchItem->Update())
                                                 {
                                                     m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
                                                 }
@@ -180,6 +202,9 @@ namespace AZ
                 }
             }
 #else  //[GFX_TODO][ATOM-13564] This is a temporary implementation that submits all of the skinning compute shaders without any culling:
+            ++m_frameIndex;
+            UpdateLodSkinningIntervals();
+
             for (SkinnedMeshRenderProxy& renderProxy : m_renderProxies)
             {
                 if (renderProxy.m_inputBuffers->GetModel()->IsUploadPending())
@@ -210,45 +235,25 @@ namespace AZ
                     //  do the enumeration for each view, keep track of the lowest lod for each entry,
                     //  and submit the appropriate dispatch item
 
+                    //the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
+                    //which is used to determine the (vertical) projected size in screen space
+                    const float yScale = viewToClip.GetElement(1, 1);
+                    const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
+                    const Vector3 cameraPos = view->GetViewToWorldMatrix().GetTranslation();
+
+                    const Vector3 pos = cullable.m_cullData.m_boundingSphere.GetCenter();
+
+                    const float approxScreenPercentage = RPI::ModelLodUtils::ApproxScreenPercentage(
+                        pos, cullable.m_lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
+                    const bool isBelowSkinningScreenCoverage = approxScreenPercentage < r_skinnedMeshMinScreenCoverage;
+
                     switch (cullable.m_lodData.m_lodConfiguration.m_lodType)
                     {
                     case RPI::Cullable::LodType::SpecificLod:
-                    {
-                        AZStd::lock_guard lock(m_dispatchItemMutex);
-                        auto lodIndex = cullable.m_lodData.m_lodConfiguration.m_lodOverride;
-                        
-                        for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
-                        {
-                            // Add one skinning dispatch item for each mesh in the lod
-                            if (skinnedMeshDispatchItem->IsEnabled())
-                            {
-                                m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
-                            }
-                        }
-                        
-                        for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                        {
-                            const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                            if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                            {
-                                m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                            }
-                        }
-                    }
-                    break;
+                        AddLodDispatchItems(renderProxy, cullable.m_lodData.m_lodConfiguration.m_lodOverride, isBelowSkinningScreenCoverage);
+                        break;
                     case RPI::Cullable::LodType::ScreenCoverage:
                     default:
-                        //the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
-                        //which is used to determine the (vertical) projected size in screen space
-                        const float yScale = viewToClip.GetElement(1, 1);
-                        const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
-                        const Vector3 cameraPos = view->GetViewToWorldMatrix().GetTranslation();
-
-                        const Vector3 pos = cullable.m_cullData.m_boundingSphere.GetCenter();
-
-                        const float approxScreenPercentage = RPI::ModelLodUtils::ApproxScreenPercentage(
-                            pos, cullable.m_lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
-
                         for (size_t lodIndex = 0; lodIndex < cullable.m_lodData.m_lods.size(); ++lodIndex)
                         {
                             const RPI::Cullable::LodData::Lod& lod = cullable.m_lodData.m_lods[lodIndex];
@@ -256,33 +261,184 @@ namespace AZ
                             //Note that this supports overlapping lod ranges (to support cross-fading lods, for example)
                             if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
                             {
-                                AZStd::lock_guard lock(m_dispatchItemMutex);
-                                for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
-                                {
-                                    // Add one skinning dispatch item for each mesh in the lod
-                                    if (skinnedMeshDispatchItem->IsEnabled())
-                                    {
-                                        m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
-                                    }
-                                }
-
-                                for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                                {
-                                    const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                    if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                                    {
-                                        m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                                    }
-                                }
+                                AddLodDispatchItems(renderProxy, lodIndex, isBelowSkinningScreenCoverage);
                             }
                         }
                         break;
                     }
                 }
             }
+
+            AddBatchedSkinningDispatchItems();
 #endif
         }
 
+        void SkinnedMeshFeatureProcessor::UpdateLodSkinningIntervals()
+        {
+            const AZ::CVarFixedString intervals = r_skinnedMeshLodSkinningIntervals;
+            if (intervals == m_lodSkinningIntervalsString)
+            {
+                return;
+            }
+            m_lodSkinningIntervalsString = intervals;
+
+            m_lodSkinningIntervals.clear();
+            AZ::StringFunc::TokenizeVisitor(
+                intervals,
+                [this](AZStd::string_view token)
+                {
+                    const AZStd::string value(token);
+                    int interval = 1;
+                    if (!m_lodSkinningIntervals.full() && AZ::StringFunc::LooksLikeInt(value.c_str(), &interval))
+                    {
+                        m_lodSkinningIntervals.push_back(aznumeric_cast<uint32_t>(AZStd::max(interval, 1)));
+                    }
+                },
+                ", ");
+        }
+
+        void SkinnedMeshFeatureProcessor::AddLodDispatchItems(
+            SkinnedMeshRenderProxy& renderProxy, size_t lodIndex, bool isBelowSkinningScreenCoverage)
+        {
+            AZStd::lock_guard lock(m_dispatchItemMutex);
+
+            const AZStd::vector<AZStd::unique_ptr<SkinnedMeshDispatchItem>>& skinnedMeshDispatchItems = renderProxy.m_dispatchItemsByLod[lodIndex];
+
+            // The output of the last skinning is reused when the pose is unchanged, when the instance is too small on screen,
+            // or until the skinning interval of the lod has elapsed. The morph targets are skipped as well, since the skinning
+            // consumes the deltas they accumulate.
+            const uint32_t skinningInterval = m_lodSkinningIntervals.empty()
+                ? 1
+                : m_lodSkinningIntervals[AZStd::min(lodIndex, m_lodSkinningIntervals.size() - 1)];
+            if (AZStd::all_of(
+                    skinnedMeshDispatchItems.begin(),
+                    skinnedMeshDispatchItems.end(),
+                    [&](const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem)
+                    {
+                        return !skinnedMeshDispatchItem->IsEnabled() ||
+                            (skinnedMeshDispatchItem->HasBeenSkinned() &&
+                             (isBelowSkinningScreenCoverage || skinnedMeshDispatchItem->IsSkinnedPoseUpToDate(renderProxy.m_poseVersion) ||
+                              m_frameIndex - skinnedMeshDispatchItem->GetLastSkinnedFrame() < skinningInterval));
+                    }))
+            {
+                return;
+            }
+
+            for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : skinnedMeshDispatchItems)
+            {
+                // Add one skinning dispatch item for each mesh in the lod, once for all the views
+                if (!skinnedMeshDispatchItem->IsEnabled() || !m_queuedSkinningDispatchItems.insert(skinnedMeshDispatchItem.get()).second)
+                {
+                    continue;
+                }
+                skinnedMeshDispatchItem->SetSkinnedPose(renderProxy.m_poseVersion, m_frameIndex);
+
+                // Meshes with morph targets read per-instance deltas, so they are not batched
+                if (r_skinnedMeshBatching && !skinnedMeshDispatchItem->GetShaderOptions().m_applyMorphTargets &&
+                    !renderProxy.m_boneTransformData.empty())
+                {
+                    SkinningBatchKey key;
+                    key.m_inputBuffers = skinnedMeshDispatchItem->GetInputBuffers().get();
+                    key.m_lodIndex = skinnedMeshDispatchItem->GetLodIndex();
+                    key.m_meshIndex = skinnedMeshDispatchItem->GetMeshIndex();
+                    key.m_skinningMethod = skinnedMeshDispatchItem->GetShaderOptions().m_skinningMethod;
+                    m_skinningBatchCandidates[key].push_back({ skinnedMeshDispatchItem.get(), &renderProxy });
+                }
+                else
+                {
+                    m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
+                }
+            }
+
+            // Add one morph target dispatch item for each mesh in the lod with an active morph target
+            for (const AZStd::unique_ptr<MorphTargetDispatchItem>& dispatchItem : renderProxy.m_morphTargetDispatchItemsByLod[lodIndex])
+            {
+                if (dispatchItem->Update())
+                {
+                    m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
+                }
+            }
+        }
+
+        void SkinnedMeshFeatureProcessor::AddBatchedSkinningDispatchItems()
+        {
+            AZ_PROFILE_SCOPE(AzRender, "SkinnedMeshFeatureProcessor: AddBatchedSkinningDispatchItems");
+
+            AZStd::lock_guard lock(m_dispatchItemMutex);
+
+            for (auto& batchIt : m_skinningBatches)
+            {
+                ++batchIt.second.m_unusedFrameCount;
+            }
+
+            for (const auto& candidatesIt : m_skinningBatchCandidates)
+            {
+                const SkinningBatchKey& key = candidatesIt.first;
+                const AZStd::vector<SkinningBatchCandidate>& candidates = candidatesIt.second;
+
+                if (candidates.size() >= r_skinnedMeshBatchMinInstanceCount)
+                {
+                    SkinningBatch& batch = m_skinningBatches[key];
+                    if (!batch.m_dispatchItem)
+                    {
+                        const SkinnedMeshDispatchItem& dispatchItem = *candidates.front().m_dispatchItem;
+                        batch.m_dispatchItem = AZStd::make_unique<SkinnedMeshBatchDispatchItem>(
+                            dispatchItem.GetInputBuffers(), key.m_lodIndex, key.m_meshIndex, dispatchItem.GetShaderOptions(), this);
+                        if (!batch.m_dispatchItem->Init())
+                        {
+                            batch.m_dispatchItem.reset();
+                        }
+                    }
+
+                    if (batch.m_dispatchItem)
+                    {
+                        batch.m_dispatchItem->ClearInstances();
+                        for (const SkinningBatchCandidate& candidate : candidates)
+                        {
+                            batch.m_dispatchItem->AddInstance(*candidate.m_dispatchItem, candidate.m_renderProxy->m_boneTransformData);
+                        }
+
+                        if (batch.m_dispatchItem->UpdateInstances())
+                        {
+                            batch.m_unusedFrameCount = 0;
+                            m_skinningDispatches.insert(&batch.m_dispatchItem->GetRHIDispatchItem());
+                            continue;
+                        }
+                    }
+                }
+
+                // Too few instances to be worth a batch, or the batch failed, so dispatch them one by one
+                for (const SkinningBatchCandidate& candidate : candidates)
+                {
+                    m_skinningDispatches.insert(&candidate.m_dispatchItem->GetRHIDispatchItem());
+                }
+            }
+
+            // Keep the batches for a while, to avoid re-creating them when the instances flicker in and out of view
+            AZStd::erase_if(
+                m_skinningBatches,
+                [](const auto& batchIt)
+                {
+                    return !batchIt.second.m_dispatchItem || batchIt.second.m_unusedFrameCount > SkinningBatchEvictionFrameCount;
+                });
+
+            m_skinningBatchCandidates.clear();
+            m_queuedSkinningDispatchItems.clear();
+        }
+
+        bool SkinnedMeshFeatureProcessor::SkinningBatchKey::operator==(const SkinningBatchKey& rhs) const
+        {
+            return m_inputBuffers == rhs.m_inputBuffers && m_lodIndex == rhs.m_lodIndex && m_meshIndex == rhs.m_meshIndex &&
+                m_skinningMethod == rhs.m_skinningMethod;
+        }
+
+        size_t SkinnedMeshFeatureProcessor::SkinningBatchKeyHash::operator()(const SkinningBatchKey& key) const
+        {
+            size_t seed = 0;
+            AZStd::hash_combine(seed, key.m_inputBuffers, key.m_lodIndex, key.m_meshIndex, static_cast<uint8_t>(key.m_skinningMethod));
+            return seed;
+        }
+
         void SkinnedMeshFeatureProcessor::OnRenderPipelineChanged(RPI::RenderPipeline* renderPipeline,
             RPI::SceneNotification::RenderPipelineChangeType changeType)
         {
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <SkinnedMesh/SkinnedMeshBatchDispatchItem.h>
 #include <SkinnedMesh/SkinnedMeshRenderProxy.h>
 #include <SkinnedMesh/SkinnedMeshStatsCollector.h>
 #include <Atom/Feature/SkinnedMesh/SkinnedMeshFeatureProcessorInterface.h>
@@ -19,6 +20,7 @@
 #include <Atom/Utils/StableDynamicArray.h>
 
 #include <AzCore/base.h>
+#include <AzCore/Console/IConsoleTypes.h>
 
 #include <AtomCore/std/parallel/concurrency_checker.h>
 
@@ -78,6 +80,44 @@ namespace AZ
 
             void InitSkinningAndMorphPass(RPI::RenderPipeline* renderPipeline);
 
+            // Identifies the skinning dispatch items which can be skinned by the same batch
+            struct SkinningBatchKey
+            {
+                const SkinnedMeshInputBuffers* m_inputBuffers = nullptr;
+                uint32_t m_lodIndex = 0;
+                uint32_t m_meshIndex = 0;
+                SkinningMethod m_skinningMethod = SkinningMethod::LinearSkinning;
+
+                bool operator==(const SkinningBatchKey& rhs) const;
+            };
+
+            struct SkinningBatchKeyHash
+            {
+                size_t operator()(const SkinningBatchKey& key) const;
+            };
+
+            struct SkinningBatchCandidate
+            {
+                const SkinnedMeshDispatchItem* m_dispatchItem = nullptr;
+                const SkinnedMeshRenderProxy* m_renderProxy = nullptr;
+            };
+
+            struct SkinningBatch
+            {
+                AZStd::unique_ptr<SkinnedMeshBatchDispatchItem> m_dispatchItem;
+                // The number of frames since the batch was last dispatched
+                uint32_t m_unusedFrameCount = 0;
+            };
+
+            // Parses r_skinnedMeshLodSkinningIntervals when it changed
+            void UpdateLodSkinningIntervals();
+
+            // Queues the skinning and morph target dispatch items of a lod of the render proxy
+            void AddLodDispatchItems(SkinnedMeshRenderProxy& renderProxy, size_t lodIndex, bool isBelowSkinningScreenCoverage);
+
+            // Queues the batch candidates of the frame, in one dispatch per mesh that is skinned for enough instances
+            void AddBatchedSkinningDispatchItems();
+
             static const char* s_featureProcessorName;
 
             Data::Instance<RPI::Shader> m_skinningShader;
@@ -92,6 +132,16 @@ namespace AZ
             AZStd::unordered_set<const RHI::DispatchItem*> m_skinningDispatches;
             bool m_alreadyCreatedSkinningScopeThisFrame = false;
 
+            // The skinning dispatch items queued this frame, which may be visible in several views
+            AZStd::unordered_set<const SkinnedMeshDispatchItem*> m_queuedSkinningDispatchItems;
+            AZStd::unordered_map<SkinningBatchKey, AZStd::vector<SkinningBatchCandidate>, SkinningBatchKeyHash> m_skinningBatchCandidates;
+            AZStd::unordered_map<SkinningBatchKey, SkinningBatch, SkinningBatchKeyHash> m_skinningBatches;
+
+            // The number of frames between the skinning of each lod, and the frame counter they are measured with
+            AZStd::fixed_vector<uint32_t, RPI::ModelLodAsset::LodCountMax> m_lodSkinningIntervals;
+            AZ::CVarFixedString m_lodSkinningIntervalsString;
+            uint32_t m_frameIndex = 0;
+
             AZStd::unordered_set<const RHI::DispatchItem*> m_morphTargetDispatches;
             bool m_alreadyCreatedMorphTargetScopeThisFrame = false;
 
@@ -207,6 +207,9 @@ namespace AZ
         void SkinnedMeshInputLod::CreateFromModelLod(
             const Data::Asset<RPI::ModelAsset>& modelAsset, const Data::Instance<RPI::Model>& model, uint32_t lodIndex)
         {
+            // Skinning reads the buffers of the lod directly, so they have to stay resident
+            model->DisableLodStreaming();
+
             m_modelLodAsset = modelAsset->GetLodAssets()[lodIndex];
             const Data::Instance<RPI::ModelLod>& modelLod = model->GetLods()[lodIndex];
 
@@ -261,18 +264,19 @@ namespace AZ
             float minWeight = 0.0f,
             float maxWeight = 1.0f)
         {
+            AZ_Assert(morphTarget.m_meshIndex < m_meshes.size(), "Morph target mesh index %" PRIu32 " is out of range.", morphTarget.m_meshIndex);
+
             m_morphTargetComputeMetaDatas.push_back(MorphTargetComputeMetaData{
-                minWeight, maxWeight, morphTarget.m_minPositionDelta, morphTarget.m_maxPositionDelta, morphTarget.m_numVertices, morphTarget.m_meshIndex });
-            
-            // Create a view into the larger per-lod morph buffer for this particular morph
-            // The morphTarget itself refers to an offset from within the mesh, so combine that
-            // with the mesh offset to get the view within the lod buffer
-            RHI::BufferViewDescriptor morphView = morphBufferAssetView->GetBufferViewDescriptor();
-            morphView.m_elementOffset += morphTarget.m_startIndex;
-            morphView.m_elementCount = morphTarget.m_numVertices;
-            RPI::BufferAssetView morphTargetDeltaView{ morphBufferAssetView->GetBufferAsset(), morphView };
+                minWeight, maxWeight, morphTarget.m_minPositionDelta, morphTarget.m_maxPositionDelta, morphTarget.m_numVertices, morphTarget.m_meshIndex,
+                morphTarget.m_startIndex });
 
-            m_morphTargetInputBuffers.push_back(aznew MorphTargetInputBuffers{ morphTargetDeltaView, bufferNamePrefix });
+            // All the morph targets of a mesh are applied by a single dispatch that reads the deltas of the whole mesh,
+            // and finds the deltas of each morph target from its offset within the mesh
+            SkinnedSubMeshProperties& mesh = m_meshes[morphTarget.m_meshIndex];
+            if (!mesh.m_morphTargetInputBuffers)
+            {
+                mesh.m_morphTargetInputBuffers = aznew MorphTargetInputBuffers{ *morphBufferAssetView, bufferNamePrefix };
+            }
         }
 
         const AZStd::vector<MorphTargetComputeMetaData>& SkinnedMeshInputLod::GetMorphTargetComputeMetaDatas() const
@@ -280,9 +284,9 @@ namespace AZ
             return m_morphTargetComputeMetaDatas;
         }
 
-        const AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>>& SkinnedMeshInputLod::GetMorphTargetInputBuffers() const
+        const AZStd::intrusive_ptr<MorphTargetInputBuffers>& SkinnedMeshInputLod::GetMorphTargetInputBuffers(uint32_t meshIndex) const
         {
-            return m_morphTargetInputBuffers;
+            return m_meshes[meshIndex].m_morphTargetInputBuffers;
         }
 
         void SkinnedMeshInputLod::CalculateMorphTargetIntegerEncodings()
@@ -393,9 +397,9 @@ namespace AZ
             return m_lods[lodIndex].m_morphTargetComputeMetaDatas;
         }
 
-        const AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>>& SkinnedMeshInputBuffers::GetMorphTargetInputBuffers(uint32_t lodIndex) const
+        const AZStd::intrusive_ptr<MorphTargetInputBuffers>& SkinnedMeshInputBuffers::GetMorphTargetInputBuffers(uint32_t lodIndex, uint32_t meshIndex) const
         {
-            return m_lods[lodIndex].m_morphTargetInputBuffers;
+            return m_lods[lodIndex].GetMorphTargetInputBuffers(meshIndex);
         }
         
         float SkinnedMeshInputBuffers::GetMorphTargetIntegerEncoding(uint32_t lodIndex, uint32_t meshIndex) const
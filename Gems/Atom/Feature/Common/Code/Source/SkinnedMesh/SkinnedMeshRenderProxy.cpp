@@ -101,34 +101,36 @@ namespace AZ
                 }
             }
 
-            size_t morphTargetCount = m_inputBuffers->GetMorphTargetInputBuffers(modelLodIndex).size();
-            AZ_Assert(
-                m_inputBuffers->GetMorphTargetComputeMetaDatas(modelLodIndex).size() == morphTargetCount,
-                "SkinnedMeshRenderProxy: Invalid SkinnedMeshInputBuffers have mis-matched morph target input buffers and compute metadata");
-            m_morphTargetDispatchItemsByLod[modelLodIndex].reserve(morphTargetCount);
-
-            // Create one dispatch item per morph target, in the order that they were originally added
-            // to the skinned mesh to stay in sync with the animation system
-            for (size_t morphTargetIndex = 0; morphTargetIndex < morphTargetCount; ++morphTargetIndex)
+            // Create one dispatch item per mesh that applies all of its morph targets. The weights of the lod are
+            // in the order the morph targets were originally added to the skinned mesh to stay in sync with the animation system
+            const AZStd::vector<MorphTargetComputeMetaData>& morphTargetMetaDatas = m_inputBuffers->GetMorphTargetComputeMetaDatas(modelLodIndex);
+            for (uint32_t meshIndex = 0; meshIndex < meshCount; ++meshIndex)
             {
-                const MorphTargetComputeMetaData& metaData =
-                    m_inputBuffers->GetMorphTargetComputeMetaDatas(modelLodIndex)[morphTargetIndex];
-
-                m_morphTargetDispatchItemsByLod[modelLodIndex].emplace_back(
-                    aznew MorphTargetDispatchItem
-                    {
-                        m_inputBuffers->GetMorphTargetInputBuffers(modelLodIndex)[morphTargetIndex],
-                        metaData,
-                        m_featureProcessor,
-                        m_instance->m_morphTargetInstanceMetaData[modelLodIndex][metaData.m_meshIndex],
-                        m_inputBuffers->GetMorphTargetIntegerEncoding(modelLodIndex, metaData.m_meshIndex)
-                    });
+                const AZStd::intrusive_ptr<MorphTargetInputBuffers>& morphTargetInputBuffers =
+                    m_inputBuffers->GetMorphTargetInputBuffers(modelLodIndex, meshIndex);
+                if (!morphTargetInputBuffers)
+                {
+                    continue;
+                }
+
+                auto dispatchItem = AZStd::make_unique<MorphTargetDispatchItem>(
+                    morphTargetInputBuffers,
+                    morphTargetMetaDatas,
+                    meshIndex,
+                    m_featureProcessor,
+                    m_instance->m_morphTargetInstanceMetaData[modelLodIndex][meshIndex],
+                    m_inputBuffers->GetMorphTargetIntegerEncoding(modelLodIndex, meshIndex));
+                if (dispatchItem->GetMorphTargetCount() == 0)
+                {
+                    continue;
+                }
 
                 // Initialize the MorphTargetDispatchItem we just created
-                if (!m_morphTargetDispatchItemsByLod[modelLodIndex].back()->Init())
+                if (!dispatchItem->Init())
                 {
                     return false;
                 }
+                m_morphTargetDispatchItemsByLod[modelLodIndex].emplace_back(AZStd::move(dispatchItem));
             }
             
             return true;
@@ -136,20 +138,31 @@ namespace AZ
 
         void SkinnedMeshRenderProxy::SetSkinningMatrices(const AZStd::vector<float>& data)
         {
+            // Idle characters, or characters which aren't animated every frame, keep the same pose
+            if (data == m_boneTransformData)
+            {
+                return;
+            }
+
             if (m_boneTransforms)
             {
                 m_boneTransforms->UpdateData(data.data(), data.size() * sizeof(float));
             }
+            m_boneTransformData.assign(data.begin(), data.end());
+            ++m_poseVersion;
         }
 
         void SkinnedMeshRenderProxy::SetMorphTargetWeights(uint32_t lodIndex, const AZStd::vector<float>& weights)
         {
-            auto& morphTargetDispatchItems = m_morphTargetDispatchItemsByLod[lodIndex];
-
-            AZ_Assert(morphTargetDispatchItems.size() == weights.size(), "Skinned Mesh Feature Processor - Morph target weights passed into SetMorphTargetWeight don't align with morph target dispatch items.");
-            for (size_t morphIndex = 0; morphIndex < weights.size(); ++morphIndex)
+            AZ_Assert(
+                m_inputBuffers->GetMorphTargetComputeMetaDatas(lodIndex).size() == weights.size(),
+                "Skinned Mesh Feature Processor - Morph target weights passed into SetMorphTargetWeight don't align with the morph targets of the lod.");
+            for (const AZStd::unique_ptr<MorphTargetDispatchItem>& morphTargetDispatchItem : m_morphTargetDispatchItemsByLod[lodIndex])
             {
-                morphTargetDispatchItems[morphIndex]->SetWeight(weights[morphIndex]);
+                if (morphTargetDispatchItem->SetWeights(weights))
+                {
+                    ++m_poseVersion;
+                }
             }
         }
 
@@ -62,6 +62,12 @@ namespace AZ
 
             Data::Instance<RPI::Buffer> m_boneTransforms;
 
+            // A copy of the bone transforms of the current frame, gathered in one buffer by the batched skinning dispatches
+            AZStd::vector<float> m_boneTransformData;
+
+            // Incremented when the bone transforms or the morph target weights change, so unchanged poses aren't skinned again
+            uint32_t m_poseVersion = 0;
+
             SkinnedMeshFeatureProcessor* m_featureProcessor = nullptr;
         };
     } // namespace Render
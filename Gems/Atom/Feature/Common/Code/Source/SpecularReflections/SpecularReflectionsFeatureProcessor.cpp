@@ -63,7 +63,7 @@ namespace AZ
             m_ssrOptions.m_rayTracing &= device->GetFeatures().m_rayTracing;
 
             // determine size multiplier to pass to the shaders
-            float sizeMultiplier = m_ssrOptions.m_halfResolution ? 0.5f : 1.0f;
+            float sizeMultiplier = m_ssrOptions.GetOutputScale();
 
             // parent SSR pass
             {
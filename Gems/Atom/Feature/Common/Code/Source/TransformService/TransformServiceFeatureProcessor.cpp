@@ -14,6 +14,8 @@
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/Utils/Utils.h>
 
+#include <AzCore/std/algorithm.h>
+
 #include <cinttypes>
 
 namespace AZ
@@ -22,6 +24,9 @@ namespace AZ
     {
         constexpr size_t BufferReserveCount = 1024;
 
+        // Above this number of separate dirty ranges, the span covering all of them is uploaded at once
+        constexpr size_t MaxDirtyRangeUploads = 64;
+
         void TransformServiceFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -39,7 +44,8 @@ namespace AZ
 
             m_deviceBufferNeedsUpdate = true;
             m_objectToWorldTransforms.reserve(BufferReserveCount);
-            m_objectToWorldInverseTransposeTransforms.reserve(BufferReserveCount);            
+            m_objectToWorldInverseTransposeTransforms.reserve(BufferReserveCount);
+            m_objectToWorldHistoryTransforms.reserve(BufferReserveCount);
 
             m_isWriteable = true;
 
@@ -50,6 +56,9 @@ namespace AZ
         {
             m_objectToWorldTransforms = {};
             m_objectToWorldInverseTransposeTransforms = {};
+            m_objectToWorldHistoryTransforms = {};
+            m_dirtyTransformIndices = {};
+            m_dirtyHistoryIndices = {};
 
             m_objectToWorldBuffer = nullptr;
             m_objectToWorldInverseTransposeBuffer = nullptr;
@@ -67,10 +76,12 @@ namespace AZ
             m_updateSceneSrgHandler.Disconnect();
         }
         
-        void TransformServiceFeatureProcessor::PrepareBuffers()
+        bool TransformServiceFeatureProcessor::PrepareBuffers()
         {
             AZ_Assert(!m_isWriteable, "Must be called between OnBeginPrepareRender() and OnEndPrepareRender()");
 
+            bool buffersRecreated = false;
+
             RHI::BufferDescriptor desc;
             desc.m_bindFlags = RHI::BufferBindFlags::ShaderRead;
 
@@ -93,6 +104,7 @@ namespace AZ
 
                     desc2.m_bufferName = "m_objectToWorldHistoryBuffer";
                     m_objectToWorldHistoryBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersRecreated = true;
                 }
                 else
                 {
@@ -100,6 +112,7 @@ namespace AZ
                     {
                         m_objectToWorldBuffer->Resize(byteCount);
                         m_objectToWorldHistoryBuffer->Resize(byteCount);
+                        buffersRecreated = true;
                     }
                 }
             }
@@ -120,15 +133,54 @@ namespace AZ
                     desc2.m_elementSize = elementSize;
 
                     m_objectToWorldInverseTransposeBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersRecreated = true;
                 }
                 else
                 {
                     if (byteCount > m_objectToWorldInverseTransposeBuffer->GetBufferSize())
                     {
                         m_objectToWorldInverseTransposeBuffer->Resize(byteCount);
+                        buffersRecreated = true;
                     }
                 }
             }
+
+            return buffersRecreated;
+        }
+
+        void TransformServiceFeatureProcessor::UploadDirtySlots(RPI::Buffer& buffer, const AZStd::vector<Float4x3>& values, AZStd::vector<uint32_t>& indices)
+        {
+            if (indices.empty())
+            {
+                return;
+            }
+
+            AZStd::sort(indices.begin(), indices.end());
+            indices.erase(AZStd::unique(indices.begin(), indices.end()), indices.end());
+
+            // Merge the adjacent slots into ranges
+            AZStd::vector<AZStd::pair<uint32_t, uint32_t>> ranges;
+            for (uint32_t index : indices)
+            {
+                if (!ranges.empty() && ranges.back().second == index)
+                {
+                    ranges.back().second = index + 1;
+                }
+                else
+                {
+                    ranges.emplace_back(index, index + 1);
+                }
+            }
+
+            if (ranges.size() > MaxDirtyRangeUploads)
+            {
+                ranges = { AZStd::make_pair(ranges.front().first, ranges.back().second) };
+            }
+
+            for (const auto& [begin, end] : ranges)
+            {
+                buffer.UpdateData(&values[begin], (end - begin) * sizeof(Float4x3), begin * sizeof(Float4x3));
+            }
         }
 
         void TransformServiceFeatureProcessor::UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg)
@@ -142,26 +194,56 @@ namespace AZ
         {
             m_isWriteable = false;
 
-            if (m_historyBufferNeedsUpdate || m_deviceBufferNeedsUpdate)
+            if (!m_historyBufferNeedsUpdate && !m_deviceBufferNeedsUpdate && m_dirtyHistoryIndices.empty() && m_dirtyTransformIndices.empty())
             {
-                PrepareBuffers();
-                if (m_historyBufferNeedsUpdate)
-                {
-                    m_objectToWorldHistoryBuffer->UpdateData(m_objectToWorldHistoryTransforms.data(), m_objectToWorldHistoryTransforms.size() * TransformValueSize);
-                    m_historyBufferNeedsUpdate = false;
-                }
+                // nothing changed since the last frame, the persistent buffers are up to date
+                return;
+            }
 
-                if (m_deviceBufferNeedsUpdate)
-                {
-                    // copy data to the buffers
-                    m_objectToWorldBuffer->UpdateData(m_objectToWorldTransforms.data(), m_objectToWorldTransforms.size() * TransformValueSize);
-                    m_objectToWorldInverseTransposeBuffer->UpdateData(m_objectToWorldInverseTransposeTransforms.data(), m_objectToWorldInverseTransposeTransforms.size() * NormalValueSize);
+            if (PrepareBuffers())
+            {
+                // the content of the buffers was lost
+                m_deviceBufferNeedsUpdate = true;
+                m_historyBufferNeedsUpdate = true;
+            }
+
+            // The history holds the transforms as of the previous upload, the slots changed by the previous upload are updated now
+            if (m_historyBufferNeedsUpdate)
+            {
+                m_objectToWorldHistoryBuffer->UpdateData(m_objectToWorldHistoryTransforms.data(), m_objectToWorldHistoryTransforms.size() * TransformValueSize);
+                m_historyBufferNeedsUpdate = false;
+            }
+            else
+            {
+                UploadDirtySlots(*m_objectToWorldHistoryBuffer, m_objectToWorldHistoryTransforms, m_dirtyHistoryIndices);
+            }
+            m_dirtyHistoryIndices.clear();
 
-                    m_objectToWorldHistoryTransforms = m_objectToWorldTransforms;
+            if (m_deviceBufferNeedsUpdate)
+            {
+                // copy data to the buffers
+                m_objectToWorldBuffer->UpdateData(m_objectToWorldTransforms.data(), m_objectToWorldTransforms.size() * TransformValueSize);
+                m_objectToWorldInverseTransposeBuffer->UpdateData(m_objectToWorldInverseTransposeTransforms.data(), m_objectToWorldInverseTransposeTransforms.size() * NormalValueSize);
+
+                m_objectToWorldHistoryTransforms = m_objectToWorldTransforms;
+                m_dirtyTransformIndices.clear();
 
-                    m_deviceBufferNeedsUpdate = false;
-                    m_historyBufferNeedsUpdate = true;
+                m_deviceBufferNeedsUpdate = false;
+                m_historyBufferNeedsUpdate = true;
+            }
+            else if (!m_dirtyTransformIndices.empty())
+            {
+                // only upload the slots that changed
+                UploadDirtySlots(*m_objectToWorldBuffer, m_objectToWorldTransforms, m_dirtyTransformIndices);
+                UploadDirtySlots(*m_objectToWorldInverseTransposeBuffer, m_objectToWorldInverseTransposeTransforms, m_dirtyTransformIndices);
+
+                for (uint32_t index : m_dirtyTransformIndices)
+                {
+                    m_objectToWorldHistoryTransforms[index] = m_objectToWorldTransforms[index];
                 }
+
+                // the history buffer catches up with these slots next frame
+                AZStd::swap(m_dirtyHistoryIndices, m_dirtyTransformIndices);
             }
         }
 
@@ -213,7 +295,7 @@ namespace AZ
 
                 // Inverse transpose to take the non-uniform scale out of the transform for usage with normals.
                 matrix3x4.GetInverseFull().GetTranspose3x3().StoreToRowMajorFloat12(m_objectToWorldInverseTransposeTransforms.at(id.GetIndex()).m_transform);
-                m_deviceBufferNeedsUpdate = true;
+                m_dirtyTransformIndices.push_back(id.GetIndex());
             }
         }
 
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <VariableRateShading/ShadingRateImagePass.h>
+
+#include <Atom/RHI/Device.h>
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RPI.Public/Image/AttachmentImagePool.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
+#include <Atom/RPI.Reflect/Pass/PassName.h>
+
+namespace AZ::Render
+{
+    namespace
+    {
+        // Fragment width and height of each RHI::ShadingRate
+        constexpr AZStd::array<AZStd::array<uint32_t, 2>, static_cast<size_t>(RHI::ShadingRate::Count)> ShadingRateSizes = { {
+            { 1, 1 },
+            { 1, 2 },
+            { 2, 1 },
+            { 2, 2 },
+            { 2, 4 },
+            { 4, 2 },
+            { 4, 4 },
+        } };
+
+        // The shader processes a tile per thread group
+        constexpr uint32_t ThreadGroupSize = 8;
+    }
+
+    RPI::Ptr<ShadingRateImagePass> ShadingRateImagePass::Create(const RPI::PassDescriptor& descriptor)
+    {
+        RPI::Ptr<ShadingRateImagePass> pass = aznew ShadingRateImagePass(descriptor);
+        return pass;
+    }
+
+    ShadingRateImagePass::ShadingRateImagePass(const RPI::PassDescriptor& descriptor)
+        : Base(descriptor)
+    {
+        RHI::Device* device = RHI::RHISystemInterface::Get()->GetDevice();
+        const RHI::DeviceFeatures& features = device->GetFeatures();
+        m_tileSize = device->GetLimits().m_shadingRateTileSize;
+
+        // The image is written by a compute shader every frame, so the device must read it at execution time
+        m_isSupported = RHI::CheckBitsAll(features.m_shadingRateTypeMask, RHI::ShadingRateTypeFlags::PerRegion) &&
+            features.m_dynamicShadingRateImage &&
+            RHI::CheckBitsAll(device->GetFormatCapabilities(ShadingRateImageFormat), RHI::FormatCapabilities::ShadingRate) &&
+            m_tileSize.m_width > 0 && m_tileSize.m_height > 0;
+
+        if (m_isSupported)
+        {
+            InitShadingRateValues();
+        }
+    }
+
+    bool ShadingRateImagePass::IsEnabled() const
+    {
+        return m_isSupported && Base::IsEnabled();
+    }
+
+    void ShadingRateImagePass::InitShadingRateValues()
+    {
+        RHI::Device* device = RHI::RHISystemInterface::Get()->GetDevice();
+        const RHI::ShadingRateFlags supportedRates = device->GetFeatures().m_shadingRateMask;
+
+        for (uint32_t rate = 0; rate < static_cast<uint32_t>(RHI::ShadingRate::Count); ++rate)
+        {
+            uint32_t bestRate = static_cast<uint32_t>(RHI::ShadingRate::Rate1x1);
+            uint32_t bestArea = 1;
+            for (uint32_t candidate = 0; candidate < static_cast<uint32_t>(RHI::ShadingRate::Count); ++candidate)
+            {
+                const auto& candidateSize = ShadingRateSizes[candidate];
+                const uint32_t candidateArea = candidateSize[0] * candidateSize[1];
+                if (RHI::CheckBitsAll(supportedRates, static_cast<RHI::ShadingRateFlags>(AZ_BIT(candidate))) &&
+                    candidateSize[0] <= ShadingRateSizes[rate][0] && candidateSize[1] <= ShadingRateSizes[rate][1] &&
+                    candidateArea > bestArea)
+                {
+                    bestRate = candidate;
+                    bestArea = candidateArea;
+                }
+            }
+
+            m_shadingRateValues[rate] = device->ConvertShadingRate(static_cast<RHI::ShadingRate>(bestRate)).m_x;
+        }
+    }
+
+    void ShadingRateImagePass::ResetInternal()
+    {
+        m_shadingRateAttachment.reset();
+        m_colorInputBinding = nullptr;
+
+        Base::ResetInternal();
+    }
+
+    void ShadingRateImagePass::BuildInternal()
+    {
+        m_colorInputBinding = FindAttachmentBinding(Name("ColorInput"));
+        AZ_Error("ShadingRateImagePass", m_colorInputBinding, "ShadingRateImagePass requires a slot for ColorInput.");
+
+        m_shadingRateAttachment = FindAttachment(Name("ShadingRateImage"));
+        AZ_Error("ShadingRateImagePass", m_shadingRateAttachment, "ShadingRateImagePass requires the ShadingRateImage attachment.");
+
+        if (m_isSupported && m_colorInputBinding && m_shadingRateAttachment)
+        {
+            // One texel per shading rate tile of the input
+            m_shadingRateAttachment->m_sizeMultipliers.m_widthMultiplier = 1.0f / m_tileSize.m_width;
+            m_shadingRateAttachment->m_sizeMultipliers.m_heightMultiplier = 1.0f / m_tileSize.m_height;
+            m_shadingRateAttachment->m_descriptor.m_image.m_format = ShadingRateImageFormat;
+
+            if (!UpdateShadingRateImage())
+            {
+                AZ_Error("ShadingRateImagePass", false, "ShadingRateImagePass disabled because the shading rate image couldn't be created.");
+                m_isSupported = false;
+            }
+        }
+
+        Base::BuildInternal();
+    }
+
+    bool ShadingRateImagePass::UpdateShadingRateImage()
+    {
+        // update the image attachment descriptor to sync up the size with the input
+        m_shadingRateAttachment->Update(true);
+        RHI::ImageDescriptor& imageDesc = m_shadingRateAttachment->m_descriptor.m_image;
+
+        if (m_shadingRateImage && imageDesc.m_size == m_shadingRateImage->GetDescriptor().m_size)
+        {
+            return true;
+        }
+
+        Data::Instance<RPI::AttachmentImagePool> pool = RPI::ImageSystemInterface::Get()->GetSystemAttachmentPool();
+
+        imageDesc.m_bindFlags |= RHI::ImageBindFlags::ShaderReadWrite | RHI::ImageBindFlags::ShadingRate;
+
+        // The ImageViewDescriptor must be specified to make sure the frame graph compiler doesn't treat this as a transient image.
+        RHI::ImageViewDescriptor viewDesc = RHI::ImageViewDescriptor::Create(imageDesc.m_format, 0, 0);
+        viewDesc.m_aspectFlags = RHI::ImageAspectFlags::Color;
+
+        // The full path name is needed for the attachment image so it's not deduplicated from images in different pipelines.
+        AZStd::string imageName = RPI::ConcatPassString(GetPathName(), m_shadingRateAttachment->m_path);
+        m_shadingRateImage = RPI::AttachmentImage::Create(*pool.get(), imageDesc, Name(imageName), nullptr, &viewDesc);
+        if (!m_shadingRateImage)
+        {
+            return false;
+        }
+
+        m_shadingRateAttachment->m_path = m_shadingRateImage->GetAttachmentId();
+        m_shadingRateAttachment->m_importedResource = m_shadingRateImage;
+        return true;
+    }
+
+    void ShadingRateImagePass::FrameBeginInternal(FramePrepareParams params)
+    {
+        // Must match the struct in ShadingRateImage.azsl
+        struct ShadingRateImageConstants
+        {
+            AZStd::array<uint32_t, 2> m_inputSize;
+            AZStd::array<uint32_t, 2> m_tileSize;
+            AZStd::array<uint32_t, 8> m_shadingRates;
+        } constants{};
+
+        UpdateShadingRateImage();
+
+        const RHI::Size inputSize = m_colorInputBinding->GetAttachment()->m_descriptor.m_image.m_size;
+        constants.m_inputSize = { inputSize.m_width, inputSize.m_height };
+        constants.m_tileSize = { m_tileSize.m_width, m_tileSize.m_height };
+        constants.m_shadingRates = m_shadingRateValues;
+        m_shaderResourceGroup->SetConstant(m_constantsIndex, constants);
+
+        const RHI::Size& imageSize = m_shadingRateAttachment->m_descriptor.m_image.m_size;
+        SetTargetThreadCounts(imageSize.m_width * ThreadGroupSize, imageSize.m_height * ThreadGroupSize, 1);
+
+        Base::FrameBeginInternal(params);
+    }
+} // namespace AZ::Render
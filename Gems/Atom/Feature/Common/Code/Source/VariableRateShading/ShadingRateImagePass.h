@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/Size.h>
+#include <Atom/RPI.Public/Image/AttachmentImage.h>
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+
+namespace AZ::Render
+{
+    //! Generates a shading rate image (see RHI::ScopeAttachmentUsage::ShadingRate) from the luminance contrast and the
+    //! motion of each shading rate tile. Tiles with low contrast, or that move fast enough to be blurred by motion anyway,
+    //! get a coarser rate. The output can be connected to a ShadingRate slot of any raster pass.
+    //! The pass disables itself if the device can't use a GPU written R8_UINT image as a shading rate attachment.
+    class ShadingRateImagePass final
+        : public RPI::ComputePass
+    {
+        using Base = RPI::ComputePass;
+        AZ_RPI_PASS(ShadingRateImagePass);
+
+    public:
+        AZ_RTTI(AZ::Render::ShadingRateImagePass, "{9B7E2C41-5D3A-4F68-8E1B-6A4C0D2F7E95}", Base);
+        AZ_CLASS_ALLOCATOR(ShadingRateImagePass, SystemAllocator);
+        virtual ~ShadingRateImagePass() = default;
+
+        //! Creates a ShadingRateImagePass
+        static RPI::Ptr<ShadingRateImagePass> Create(const RPI::PassDescriptor& descriptor);
+
+        bool IsEnabled() const override;
+
+    private:
+        ShadingRateImagePass(const RPI::PassDescriptor& descriptor);
+
+        // Pass behavior overrides...
+        void BuildInternal() override;
+        void ResetInternal() override;
+        void FrameBeginInternal(FramePrepareParams params) override;
+
+        //! Recreates the shading rate image if the size of the input changed.
+        bool UpdateShadingRateImage();
+
+        //! Fills m_shadingRateValues with the image value of each RHI::ShadingRate, replacing the rates the device doesn't
+        //! support with the coarsest supported rate that is finer on both axes.
+        void InitShadingRateValues();
+
+        static constexpr RHI::Format ShadingRateImageFormat = RHI::Format::R8_UINT;
+
+        bool m_isSupported = false;
+        RHI::Size m_tileSize;
+        AZStd::array<uint32_t, 8> m_shadingRateValues = {};
+
+        RPI::Ptr<RPI::PassAttachment> m_shadingRateAttachment;
+        Data::Instance<RPI::AttachmentImage> m_shadingRateImage;
+        RPI::PassAttachmentBinding* m_colorInputBinding = nullptr;
+
+        RHI::ShaderInputNameIndex m_constantsIndex = "m_constants";
+    };
+} // namespace AZ::Render
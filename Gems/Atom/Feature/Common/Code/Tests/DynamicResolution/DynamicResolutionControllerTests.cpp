@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <DynamicResolution/DynamicResolutionController.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    class DynamicResolutionControllerTests
+        : public UnitTest::LeakDetectionFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            UnitTest::LeakDetectionFixture::SetUp();
+
+            DynamicResolutionSettings settings;
+            settings.m_targetGpuTimeMs = 10.0f;
+            settings.m_minScale = 0.5f;
+            settings.m_maxScale = 1.0f;
+            settings.m_scaleStep = 0.05f;
+            settings.m_upscaleHeadroom = 0.1f;
+            settings.m_cooldownFrames = CooldownFrames;
+            m_controller.SetSettings(settings);
+            m_controller.Reset();
+        }
+
+        //! Feeds the same GPU time until the scale changes, and returns the number of frames it took.
+        uint32_t UpdateUntilChanged(float gpuTimeMs, uint32_t maxFrames = 1000)
+        {
+            for (uint32_t frame = 1; frame <= maxFrames; ++frame)
+            {
+                if (m_controller.Update(gpuTimeMs))
+                {
+                    return frame;
+                }
+            }
+            return 0;
+        }
+
+        static constexpr uint32_t CooldownFrames = 30;
+        DynamicResolutionController m_controller;
+    };
+
+    TEST_F(DynamicResolutionControllerTests, Update_NoGpuTime_ScaleUnchanged)
+    {
+        EXPECT_EQ(UpdateUntilChanged(0.0f), 0u);
+        EXPECT_FLOAT_EQ(m_controller.GetScale(), 1.0f);
+    }
+
+    TEST_F(DynamicResolutionControllerTests, Update_OverBudget_ScaleDecreasesAfterCooldown)
+    {
+        // Twice the target GPU time needs half the pixels, so a scale of sqrt(0.5) rounded down to the step.
+        EXPECT_EQ(UpdateUntilChanged(20.0f), CooldownFrames);
+        EXPECT_NEAR(m_controller.GetScale(), 0.7f, 0.001f);
+    }
+
+    TEST_F(DynamicResolutionControllerTests, Update_WithinHeadroom_ScaleUnchanged)
+    {
+        EXPECT_EQ(UpdateUntilChanged(9.5f), 0u);
+        EXPECT_FLOAT_EQ(m_controller.GetScale(), 1.0f);
+    }
+
+    TEST_F(DynamicResolutionControllerTests, Update_FarOverBudget_ScaleClampedToMin)
+    {
+        EXPECT_EQ(UpdateUntilChanged(1000.0f), CooldownFrames);
+        EXPECT_FLOAT_EQ(m_controller.GetScale(), 0.5f);
+
+        // Already at the minimum, so it can't go any lower.
+        EXPECT_EQ(UpdateUntilChanged(1000.0f), 0u);
+        EXPECT_FLOAT_EQ(m_controller.GetScale(), 0.5f);
+    }
+
+    TEST_F(DynamicResolutionControllerTests, Update_UnderBudget_ScaleIncreasesUpToMax)
+    {
+        EXPECT_NE(UpdateUntilChanged(40.0f), 0u);
+        EXPECT_FLOAT_EQ(m_controller.GetScale(), 0.5f);
+
+        // 4ms at half resolution predicts 10ms at a scale of 0.79, which is rounded down to the step.
+        EXPECT_EQ(UpdateUntilChanged(4.0f), CooldownFrames);
+        EXPECT_NEAR(m_controller.GetScale(), 0.75f, 0.001f);
+
+        EXPECT_NE(UpdateUntilChanged(0.1f), 0u);
+        EXPECT_FLOAT_EQ(m_controller.GetScale(), 1.0f);
+    }
+
+    TEST_F(DynamicResolutionControllerTests, Reset_ReturnsToMaxScale)
+    {
+        EXPECT_NE(UpdateUntilChanged(20.0f), 0u);
+        EXPECT_LT(m_controller.GetScale(), 1.0f);
+
+        m_controller.Reset();
+        EXPECT_FLOAT_EQ(m_controller.GetScale(), 1.0f);
+        EXPECT_FLOAT_EQ(m_controller.GetAverageGpuTimeMs(), 0.0f);
+    }
+} // namespace UnitTest
@@ -125,6 +125,10 @@ set(FILES
     Source/Debug/RenderDebugFeatureProcessor.cpp
     Source/Debug/RenderDebugSettings.h
     Source/Debug/RenderDebugSettings.cpp
+    Source/DynamicResolution/DynamicResolutionController.cpp
+    Source/DynamicResolution/DynamicResolutionController.h
+    Source/DynamicResolution/DynamicResolutionFeatureProcessor.cpp
+    Source/DynamicResolution/DynamicResolutionFeatureProcessor.h
     Source/Decals/DecalTextureArray.h
     Source/Decals/DecalTextureArray.cpp
     Source/Decals/AsyncLoadTracker.h
@@ -157,6 +161,8 @@ set(FILES
     Source/Math/MathFilter.h
     Source/Math/MathFilter.cpp
     Source/Math/MathFilterDescriptor.h
+    Source/Mesh/BindlessMaterialTable.cpp
+    Source/Mesh/BindlessMaterialTable.h
     Source/Mesh/MeshInstanceGroupKey.cpp
     Source/Mesh/MeshInstanceGroupKey.h
     Source/Mesh/MeshInstanceGroupList.cpp
@@ -298,6 +304,8 @@ set(FILES
     Source/Shadows/FullscreenShadowPass.cpp
     Source/Shadows/ProjectedShadowFeatureProcessor.h
     Source/Shadows/ProjectedShadowFeatureProcessor.cpp
+    Source/SkinnedMesh/SkinnedMeshBatchDispatchItem.cpp
+    Source/SkinnedMesh/SkinnedMeshBatchDispatchItem.h
     Source/SkinnedMesh/SkinnedMeshComputePass.cpp
     Source/SkinnedMesh/SkinnedMeshComputePass.h
     Source/SkinnedMesh/SkinnedMeshDispatchItem.cpp
@@ -332,6 +340,8 @@ set(FILES
     Source/SplashScreen/SplashScreenPass.h
     Source/TransformService/TransformServiceFeatureProcessor.cpp
     Source/Utils/GpuBufferHandler.cpp
+    Source/VariableRateShading/ShadingRateImagePass.cpp
+    Source/VariableRateShading/ShadingRateImagePass.h
 )
 
 set(SKIP_UNITY_BUILD_INCLUSION_FILES
@@ -17,4 +17,5 @@ set(FILES
     Tests/SparseVectorTests.cpp
     Tests/SkinnedMesh/SkinnedMeshDispatchItemTests.cpp
     Tests/Decals/DecalTextureArrayTests.cpp
+    Tests/DynamicResolution/DynamicResolutionControllerTests.cpp
 )
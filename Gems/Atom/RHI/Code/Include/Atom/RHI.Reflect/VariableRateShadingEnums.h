@@ -86,4 +86,6 @@ namespace AZ
             uint8_t m_y; // Second component value (may be 0 if not used).
         };
     }
+
+    AZ_TYPE_INFO_SPECIALIZE(RHI::ShadingRate, "{4E3B8F3A-1C6D-4D2B-9E7A-5F0C2A6B8D14}");
 }
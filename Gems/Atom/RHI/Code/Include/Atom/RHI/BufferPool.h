@@ -9,6 +9,9 @@
 
 #include <Atom/RHI.Reflect/BufferPoolDescriptor.h>
 #include <Atom/RHI/BufferPoolBase.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
 
 namespace AZ
 {
@@ -88,6 +91,41 @@ namespace AZ
             const void* m_sourceData = nullptr;
         };
 
+        /**
+         * A structure used as an argument to BufferPool::StreamBufferFromFile.
+         */
+        struct BufferFileStreamRequest
+        {
+            /// A fence to signal on completion of the upload operation. The fence is signaled
+            /// when the file read fails as well, in which case the buffer contents are undefined.
+            Fence* m_fenceToSignal = nullptr;
+
+            /// The buffer instance to stream up to.
+            Buffer* m_buffer = nullptr;
+
+            /// The number of bytes offset from the base of the buffer to start the upload.
+            size_t m_byteOffset = 0;
+
+            /// The number of bytes to read from the file and upload beginning from m_byteOffset.
+            size_t m_byteCount = 0;
+
+            /// The path of the file to read the data from. This can include aliases such as @products@.
+            AZStd::string m_filePath;
+
+            /// The offset into the file where the data to upload begins.
+            size_t m_fileOffset = 0;
+
+            /// The amount of time from the call to StreamBufferFromFile that the file read should complete in.
+            AZ::IO::IStreamerTypes::Deadline m_deadline = AZ::IO::IStreamerTypes::s_noDeadline;
+
+            /// The priority of the file read if multiple reads are at risk of missing their deadline.
+            AZ::IO::IStreamerTypes::Priority m_priority = AZ::IO::IStreamerTypes::s_priorityMedium;
+
+            /// [Optional] Called from a streamer thread once the file read has finished, with false if the
+            /// read failed. The upload may still be in flight, wait for m_fenceToSignal before using the buffer.
+            AZStd::function<void(bool success)> m_readCompleteCallback;
+        };
+
         /**
          * Buffer pool provides backing storage and context for buffer instances. The BufferPoolDescriptor
          * contains properties defining memory characteristics of buffer pools. All buffers created on a pool
@@ -177,6 +215,16 @@ namespace AZ
              */
             ResultCode StreamBuffer(const BufferStreamRequest& request);
 
+            /**
+             * Asynchronously streams buffer data from a file up to the GPU. The file is read through AZ::IO::IStreamer
+             * directly into the upload memory, which avoids reading into an intermediate CPU buffer first and
+             * copying it into staging memory afterwards. Host pools are read directly into the mapped buffer. Like
+             * StreamBuffer, it's not valid to use the buffer while the upload is running. The provided fence is signaled
+             * when the upload completes. Returns ResultCode::Unimplemented if the platform doesn't support the operation,
+             * in which case the caller needs to read the file and use StreamBuffer instead.
+             */
+            ResultCode StreamBufferFromFile(const BufferFileStreamRequest& request);
+
             /**
              * Returns the buffer descriptor used to initialize the buffer pool. Descriptor contents
              * are undefined for uninitialized pools.
@@ -193,6 +241,9 @@ namespace AZ
 
             bool ValidateNotProcessingFrame() const;
 
+            /// Reads the file of the request straight into the mapped memory of a buffer on a host pool.
+            ResultCode StreamBufferFromFileToHostMemory(const BufferFileStreamRequest& request);
+
         private:
             using ResourcePool::Init;
             using BufferPoolBase::InitBuffer;
@@ -201,6 +252,7 @@ namespace AZ
             bool ValidateInitRequest(const BufferInitRequest& initRequest) const;
             bool ValidateIsHostHeap() const;
             bool ValidateMapRequest(const BufferMapRequest& request) const;
+            bool ValidateFileStreamRequest(const BufferFileStreamRequest& request) const;
 
             //////////////////////////////////////////////////////////////////////////
             // Platform API
@@ -223,6 +275,10 @@ namespace AZ
             /// Called when a buffer is being streamed asynchronously.
             virtual ResultCode StreamBufferInternal(const BufferStreamRequest& request);
 
+            /// Called when a buffer is being streamed asynchronously from a file. By default host pools
+            /// are read into the mapped buffer and other pools are unimplemented.
+            virtual ResultCode StreamBufferFromFileInternal(const BufferFileStreamRequest& request);
+
             //Called in order to do a simple mem copy allowing Null rhi to opt out
             virtual void BufferCopy(void* destination, const void* source, size_t num);
 
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/ImageView.h>
@@ -106,6 +107,12 @@ namespace AZ
 
             /// Flags controlling statistics of the pools.
             FrameSchedulerStatisticsFlags m_statisticsFlags = FrameSchedulerStatisticsFlags::None;
+
+            /// Controls whether the platform-specific scope compilation is allowed to use jobs.
+            JobPolicy m_jobPolicy = JobPolicy::Serial;
+
+            /// Controls the number of scopes compiled per job.
+            uint32_t m_scopeCompilesPerJob = 32;
         };
 
         /**
@@ -115,7 +122,8 @@ namespace AZ
          * platform-specific scope construction.
          *
          * The compiler is designed to be invoked every frame; the graph is simply rebuilt each time. The compile
-         * operation is also done on a single thread; so overhead should be kept to a minimum.
+         * operation is mostly done on a single thread; so overhead should be kept to a minimum. Only the platform-specific
+         * compilation of each scope can be split across jobs, when the platform supports it.
          *
          * The RHI base class performs platform-independent compilation before passing control down to the derived
          * platform implementation. The provided FrameGraph instance is compiled in-place according to the
@@ -158,6 +166,11 @@ namespace AZ
          * which is allowed to alias during that region by inspecting which one will see the biggest potential
          * gain. This way, some aliasing is still allowed when async compute / copy is in use.
          *
+         * When the pool sizes its heaps from a memory hint, a first pass over the attachments measures the memory
+         * they need before the second pass allocates them. The measured usage is cached along with a hash of the
+         * transient attachment declarations and their lifetimes, and the first pass is skipped on frames whose
+         * declarations match the previous ones.
+         *
          * Finally, because the resources themselves are effectively re-created each frame, a cache of views is
          * kept inside the compiler. The cache is big enough to avoid having to re-create views every frame, but
          * bounded in order to release entries old views.
@@ -188,6 +201,12 @@ namespace AZ
              */
             MessageOutcome Compile(const FrameGraphCompileRequest& request);
 
+            //! Returns the number of compiles that reused the memory usage of the previous transient attachment layout.
+            uint64_t GetTransientTopologyCacheHitCount() const;
+
+            //! Returns the number of compiles that had to measure the memory usage of the transient attachments.
+            uint64_t GetTransientTopologyCacheMissCount() const;
+
         protected:
             FrameGraphCompiler() = default;
 
@@ -205,6 +224,10 @@ namespace AZ
             /// compilation should be done here.
             virtual MessageOutcome CompileInternal(const FrameGraphCompileRequest& request) = 0;
 
+            /// Returns true if the platform Scope::CompileInternal only modifies the scope it's called on,
+            /// which allows scopes to be compiled by multiple jobs at the same time.
+            virtual bool IsParallelScopeCompileSupported() const { return false; }
+
             //////////////////////////////////////////////////////////////////////////
 
             MessageOutcome ValidateCompileRequest(const FrameGraphCompileRequest& request) const;
@@ -225,6 +248,8 @@ namespace AZ
 
             void CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase);
 
+            void CompileScopes(FrameGraph& frameGraph, JobPolicy jobPolicy, uint32_t scopeCompilesPerJob);
+
             //! Remove the entry related to the provided ReverseLookupObjectType from the appropriate cache as it is probably stale now
             template<typename ReverseLookupObjectType, typename ObjectCacheType>
             void RemoveFromCache(ReverseLookupObjectType objectToRemove,
@@ -244,6 +269,14 @@ namespace AZ
             // once they have been replaced with a new view instance. 
             AZStd::unordered_map<ImageResourceViewData, HashValue64> m_imageReverseLookupHash;
             AZStd::unordered_map<BufferResourceViewData, HashValue64> m_bufferReverseLookupHash;
+
+            // The memory usage measured for the last transient attachment layout, which is used as the hint of the
+            // pool while the layout doesn't change.
+            HashValue64 m_transientTopologyHash = HashValue64{ 0 };
+            TransientAttachmentStatistics::MemoryUsage m_transientTopologyMemoryUsage;
+            bool m_transientTopologyMemoryUsageValid = false;
+            uint64_t m_transientTopologyCacheHits = 0;
+            uint64_t m_transientTopologyCacheMisses = 0;
         };
     }
 }
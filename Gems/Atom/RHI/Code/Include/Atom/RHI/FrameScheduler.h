@@ -16,6 +16,7 @@
 #include <Atom/RHI/RayTracingShaderTable.h>
 #include <Atom/RHI/ScopeProducer.h>
 #include <Atom/RHI/ScopeProducerEmpty.h>
+#include <Atom/RHI/ShaderResourceGroupPool.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -56,6 +57,9 @@ namespace AZ
 
             /// Controls the number of ShaderResourceGroups compiled per job.
             uint32_t m_shaderResourceGroupCompilesPerJob = 256;
+
+            /// Controls the number of scopes compiled per job by the platform-specific scope compilation.
+            uint32_t m_scopeCompilesPerJob = 32;
         };
 
         //! == Overview ==
@@ -167,6 +171,13 @@ namespace AZ
             //! Returns the timing statistics for the previous frame.
             const TransientAttachmentStatistics* GetTransientAttachmentStatistics() const;
 
+            //! Returns the number of frames that reused, or had to measure, the memory usage of the transient attachments.
+            uint64_t GetTransientTopologyCacheHitCount() const;
+            uint64_t GetTransientTopologyCacheMissCount() const;
+
+            //! Returns the number of shader resource groups compiled, and the constant data uploaded by them, in the last frame.
+            const ShaderResourceGroupCompileStatistics& GetShaderResourceGroupCompileStatistics() const;
+
             //! Returns current CPU frame to frame time in milliseconds.
             double GetCpuFrameTime() const;
 
@@ -221,6 +232,7 @@ namespace AZ
 
             AZStd::sys_time_t m_lastFrameEndTime{};
             MemoryStatistics m_memoryStatistics;
+            ShaderResourceGroupCompileStatistics m_shaderResourceGroupCompileStatistics;
 
             FrameSchedulerCompileRequest m_compileRequest;
 
@@ -11,6 +11,7 @@
 #include <Atom/RHI/PipelineLibrary.h>
 #include <Atom/RHI/ThreadLocalContext.h>
 #include <AzCore/std/containers/bitset.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/Utils/TypeHash.h>
 
 namespace UnitTest
@@ -92,6 +93,9 @@ namespace AZ
         //!      // In jobs. Lots and lots of requests.
         //!      const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor);
         //!
+        //!      // Compile pipeline states that are known to be needed soon on background jobs, in priority order.
+        //!      pipelineStateCache->PrecompilePipelineStates(libraryHandle, descriptors);
+        //!
         //!      // Reset contents of library. Releases all pipeline state references. Library remains valid.
         //!      pipelineStateCache->ResetLibrary(libraryHandle);
         //!
@@ -110,8 +114,24 @@ namespace AZ
             //! avoid a pointer indirection on access.
             static const size_t LibraryCountMax = 256;
 
+            //! Counters of the pipeline state compilations done by the cache since it was created.
+            struct CompileStatistics
+            {
+                //! Compilations done by the thread that acquired the pipeline state, which stalled it.
+                uint32_t m_compiledOnAcquireCount = 0;
+
+                //! Acquires that returned a pipeline state another thread started compiling in the current cycle,
+                //! which may still be compiling.
+                uint32_t m_acquiredWhileCompilingCount = 0;
+
+                //! Compilations done by the background jobs of PrecompilePipelineStates.
+                uint32_t m_precompiledCount = 0;
+            };
+
             static Ptr<PipelineStateCache> Create(Device& device);
 
+            ~PipelineStateCache();
+
             //! Resets the caches of all pipeline libraries back to empty. All internal references to pipeline states are released.
             void Reset();
 
@@ -138,9 +158,21 @@ namespace AZ
             //! is held externally, the instance will remain valid even after the cache is reset / destroyed.
             const PipelineState* AcquirePipelineState(PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor);
 
+            //! Compiles the pipeline states on background jobs, which are started in the order of the descriptors so
+            //! the ones needed first should come first. The descriptors are copied. The compiled pipeline states are
+            //! merged into the library blob like the acquired ones, so they're also warm on the next run.
+            //! Jobs that haven't started when the library is reset or released are skipped.
+            void PrecompilePipelineStates(PipelineLibraryHandle library, AZStd::span<const PipelineStateDescriptor* const> descriptors);
+
+            //! Returns the number of pipeline states queued by PrecompilePipelineStates that haven't been compiled yet.
+            uint32_t GetPendingPrecompileCount() const;
+
+            CompileStatistics GetCompileStatistics() const;
+
             //! This method merges the global pending cache into the global read-only cache and clears all thread-local caches.
             //! This reduces the total memory footprint of the caches and optimizes subsequent fetches. This method should be called
-            //! once per frame.
+            //! once per frame. While background compilations are pending, the merge is skipped on frames where it would have to
+            //! wait for one of them to finish.
             void Compact();
 
         private:
@@ -192,6 +224,9 @@ namespace AZ
                 // Tracks the number of pipeline states actively being compiled across all threads.
                 AZStd::atomic_uint32_t m_pendingCompileCount = {0};
 
+                // Incremented when the library is reset, so precompile jobs queued before it are skipped.
+                AZStd::atomic_uint32_t m_generation = {0};
+
                 // Contains the initial serialized data (Used to prime the thread libraries)
                 // or the file name that contains the serialized data
                 PipelineLibraryDescriptor m_pipelineLibraryDescriptor;
@@ -222,12 +257,21 @@ namespace AZ
             //! Helper function which inserts an entry into the set. Returns true if the entry was inserted, or false is a duplicate entry existed.
             static bool InsertPipelineState(PipelineStateSet& pipelineStateSet, PipelineStateEntry pipelineStateEntry);
 
+            //! Finds the pipeline state in the thread-local and the pending caches, or compiles it on the calling thread.
+            const PipelineState* AcquirePipelineStateLocked(
+                PipelineLibraryHandle handle,
+                const PipelineStateDescriptor& descriptor,
+                PipelineStateHash pipelineStateHash,
+                bool isPrecompile);
+
             //! Performs a pipeline state compilation on the global cache using the thread-local pipeline library.
+            //! @param isCompiling set to true if the pipeline state was compiled by this call
             ConstPtr<PipelineState> CompilePipelineState(
                 GlobalLibraryEntry& globalLibraryEntry,
                 ThreadLibraryEntry& threadLibraryEntry,
                 const PipelineStateDescriptor& pipelineStateDescriptor,
-                PipelineStateHash pipelineStateHash);
+                PipelineStateHash pipelineStateHash,
+                bool& isCompiling);
 
             //! Resets the library without validating the handle or taking a lock.
             void ResetLibraryImpl(PipelineLibraryHandle handle);
@@ -251,6 +295,13 @@ namespace AZ
             /// to recycle slots in m_globalLibrarySet.
             AZStd::fixed_vector<PipelineLibraryHandle, LibraryCountMax> m_libraryFreeList;
 
+            /// The number of precompile jobs that haven't finished, which the destructor waits for.
+            AZStd::atomic_uint32_t m_pendingPrecompileCount = {0};
+
+            AZStd::atomic_uint32_t m_compiledOnAcquireCount = {0};
+            AZStd::atomic_uint32_t m_acquiredWhileCompilingCount = {0};
+            AZStd::atomic_uint32_t m_precompiledCount = {0};
+
             // Friends
             friend class UnitTest::PipelineStateTests;
         };
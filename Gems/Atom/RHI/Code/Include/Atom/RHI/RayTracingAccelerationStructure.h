@@ -146,6 +146,8 @@ namespace AZ
 
             uint32_t GetNumInstancesInBuffer() const { return m_numInstancesInBuffer; }
 
+            bool IsRefit() const { return m_refit; }
+
             // build operations
             RayTracingTlasDescriptor* Build();
             RayTracingTlasDescriptor* Instance();
@@ -158,6 +160,11 @@ namespace AZ
             RayTracingTlasDescriptor* InstancesBuffer(const RHI::Ptr<RHI::Buffer>& tlasInstances);
             RayTracingTlasDescriptor* NumInstances(uint32_t numInstancesInBuffer);
 
+            //! Indicates that the instances only differ from the previous TLAS by their transforms, so the platform can update
+            //! the previous TLAS instead of building a new one. A refit is faster than a build, but the TLAS quality decreases
+            //! with each refit, so a full build should be done periodically.
+            RayTracingTlasDescriptor* Refit(bool refit);
+
         private:
             RayTracingTlasInstanceVector m_instances;
             RayTracingTlasInstance* m_buildContext = nullptr;
@@ -165,6 +172,8 @@ namespace AZ
             // externally created Instances buffer, cannot be combined with other Instances
             RHI::Ptr<RHI::Buffer> m_instancesBuffer;
             uint32_t m_numInstancesInBuffer;
+
+            bool m_refit = false;
         };
 
         //! RayTracingTlas
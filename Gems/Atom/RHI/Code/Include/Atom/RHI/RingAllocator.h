@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI/Allocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        /**
+         * A ring allocator for transient data that is written once and consumed by the GPU within a few frames,
+         * like the vertices of dynamic draws or per frame constants. Allocations are reclaimed in the order they
+         * were made: each garbage collection marks the end of a frame, and the memory allocated before it is reused
+         * once m_garbageCollectLatency more garbage collections have occurred. DeAllocate does nothing.
+         *
+         * Allocate is lock free and may be called from any number of threads, while GarbageCollect, Init and Shutdown
+         * must not overlap with allocations.
+         */
+        class RingAllocator final
+            : public Allocator
+        {
+        public:
+            struct Descriptor : Allocator::Descriptor
+            {
+                /// No additional members.
+            };
+
+            AZ_CLASS_ALLOCATOR(RingAllocator, AZ::SystemAllocator);
+
+            RingAllocator() = default;
+
+            void Init(const Descriptor& descriptor);
+
+            //////////////////////////////////////////////////////////////////////////
+            // Allocator
+            void Shutdown() override;
+            VirtualAddress Allocate(size_t byteCount, size_t byteAlignment) override;
+            void DeAllocate(VirtualAddress allocation) override;
+            void GarbageCollect() override;
+            void GarbageCollectForce() override;
+            size_t GetAllocatedByteCount() const override;
+            const Descriptor& GetDescriptor() const override;
+            //////////////////////////////////////////////////////////////////////////
+
+        private:
+            Descriptor m_descriptor;
+
+            // The cursors only grow; the byte offset of a cursor in the ring is the cursor modulo the capacity.
+            AZStd::atomic<uint64_t> m_cursor{ 0 };
+            // Allocations may not reach this cursor, which is one capacity past the oldest allocation in use.
+            AZStd::atomic<uint64_t> m_cursorLimit{ 0 };
+
+            // The cursor at each of the last m_garbageCollectLatency + 1 garbage collections.
+            AZStd::vector<uint64_t> m_garbageCollectCursors;
+            size_t m_garbageCollectIndex = 0;
+        };
+    }
+}
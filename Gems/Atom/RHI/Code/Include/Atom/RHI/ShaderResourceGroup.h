@@ -74,6 +74,11 @@ namespace AZ
 
             //! Update the view hash within m_viewHash
             void UpdateViewHash(const AZ::Name& viewName, const HashValue64 viewHash);
+
+            //! Returns the byte interval [min, max) of the constant data that changed during the last FrameCountMax compiles.
+            //! Platforms that cycle through FrameCountMax copies of the constant data, one per compile, only need to write this
+            //! interval to the copy they compile, as the rest of it is unchanged since that copy was last written.
+            Interval GetConstantsCompileInterval() const;
             
         protected:
             ShaderResourceGroup() = default;
@@ -81,6 +86,12 @@ namespace AZ
         private:
             void SetData(const ShaderResourceGroupData& data);
 
+            //! Called by the pool before each compile, to move the pending constant changes into the compile interval.
+            void UpdateConstantsCompileInterval(bool compileAllConstants);
+
+            //! Adds an interval to another, empty intervals are ignored.
+            static void MergeInterval(Interval& interval, Interval other);
+
             ShaderResourceGroupData m_data;
 
             // The binding slot cached from the layout.
@@ -98,6 +109,13 @@ namespace AZ
 
             // Track hash related to views. This will help ensure we compile views in case they get invalidated and partial srg compilation is enabled
             AZStd::unordered_map<AZ::Name, HashValue64> m_viewHash;
+
+            // The constants changed by the data set since the last compile, and by each of the last FrameCountMax compiles.
+            // The compile intervals start out covering all the constants, so each copy of the constant data is written in full once.
+            Interval m_constantsPendingInterval;
+            Interval m_constantsIntervalPerCompile[RHI::Limits::Device::FrameCountMax];
+            Interval m_constantsCompileInterval;
+            uint32_t m_constantsCompileIndex = 0;
         };
     }
 }
@@ -239,6 +239,10 @@ namespace AZ
 
             //! Returns the mask that is suppose to indicate which resource type was updated
             uint32_t GetUpdateMask() const;
+
+            //! Returns the byte interval [min, max) of the constant data that was updated since the update mask was reset.
+            //! The interval is empty (min == max) when no constant was updated.
+            Interval GetConstantsUpdateInterval() const;
             
             //! Update the indirect buffer view with the indices of all the image views which reside in the global gpu heap.
             void SetBindlessViews(
@@ -269,6 +273,10 @@ namespace AZ
             static const ConstPtr<BufferView> s_nullBufferView;
             static const SamplerState s_nullSamplerState;
 
+            //! Enables the compilation of the constant data and adds the bytes to the updated interval.
+            void EnableConstantsCompilation(ShaderInputConstantIndex inputIndex);
+            void EnableConstantsCompilation(Interval interval);
+
             bool ValidateSetImageView(ShaderInputImageIndex inputIndex, const ImageView* imageView, uint32_t arrayIndex) const;
             bool ValidateSetBufferView(ShaderInputBufferIndex inputIndex, const BufferView* bufferView, uint32_t arrayIndex) const;
 
@@ -296,37 +304,56 @@ namespace AZ
 
             //! Mask used to check whether to compile a specific resource type. This mask is managed by RPI and copied over to the RHI every frame. 
             uint32_t m_updateMask = 0;
+
+            //! The bytes of the constant data that were updated since the update mask was reset.
+            Interval m_constantsUpdateInterval;
         };
 
         template <typename T>
         bool ShaderResourceGroupData::SetConstant(ShaderInputConstantIndex inputIndex, const T& value)
         {
-            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
-            return m_constantsData.SetConstant(inputIndex, value);
+            if (m_constantsData.SetConstant(inputIndex, value))
+            {
+                EnableConstantsCompilation(inputIndex);
+                return true;
+            }
+            return false;
         }
 
         template <typename T>
         bool ShaderResourceGroupData::SetConstant(ShaderInputConstantIndex inputIndex, const T& value, uint32_t arrayIndex)
         {
-            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
-            return m_constantsData.SetConstant(inputIndex, value, arrayIndex);
+            if (m_constantsData.SetConstant(inputIndex, value, arrayIndex))
+            {
+                EnableConstantsCompilation(inputIndex);
+                return true;
+            }
+            return false;
         }
 
         template<typename T>
         bool ShaderResourceGroupData::SetConstantMatrixRows(ShaderInputConstantIndex inputIndex, const T& value, uint32_t rowCount)
         {
-            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
-            return m_constantsData.SetConstantMatrixRows(inputIndex, value, rowCount);
+            if (m_constantsData.SetConstantMatrixRows(inputIndex, value, rowCount))
+            {
+                EnableConstantsCompilation(inputIndex);
+                return true;
+            }
+            return false;
         }
 
         template <typename T>
         bool ShaderResourceGroupData::SetConstantArray(ShaderInputConstantIndex inputIndex, AZStd::span<const T> values)
         {
-            if (!values.empty())
+            if (m_constantsData.SetConstantArray(inputIndex, values))
             {
-                EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+                if (!values.empty())
+                {
+                    EnableConstantsCompilation(inputIndex);
+                }
+                return true;
             }
-            return m_constantsData.SetConstantArray(inputIndex, values);
+            return false;
         }
 
         template <typename T>
@@ -14,12 +14,23 @@
 #include <Atom/RHI/ShaderResourceGroupInvalidateRegistry.h>
 #include <Atom/RHI/ResourcePool.h>
 
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        //! The work done by the compiles of shader resource groups.
+        struct ShaderResourceGroupCompileStatistics
+        {
+            //! The number of groups that were compiled on the platform, groups with no updates are skipped.
+            uint32_t m_compiledGroupCount = 0;
+
+            //! The number of bytes of constant data that were written to the platform constant buffers.
+            uint64_t m_constantBytesUploaded = 0;
+        };
+
          //! The platform-independent base class for ShaderResourceGroupPools. Platforms
          //! should inherit from this class to implement platform-dependent pooling of
          //! shader resource groups.
@@ -78,6 +89,9 @@ namespace AZ
             //! Returns whether groups in this pool have a sampler table.
             bool HasSamplerGroup() const;
 
+            //! Returns the work done by the compiles since the last call, and resets it.
+            ShaderResourceGroupCompileStatistics ResetCompileStatistics();
+
         protected:
             ShaderResourceGroupPool();
 
@@ -91,6 +105,9 @@ namespace AZ
             }
             //////////////////////////////////////////////////////////////////////////
 
+            //! Called by the platforms for the constant data they write in CompileGroupInternal.
+            void AddConstantBytesUploaded(size_t byteCount);
+
         private:
             // Queues the shader resource group for compile and provides a new data packet (takes a lock).
             void QueueForCompile(ShaderResourceGroup& group, const ShaderResourceGroupData& groupData);
@@ -156,6 +173,10 @@ namespace AZ
 
             AZStd::mutex m_invalidateRegistryMutex;
             ShaderResourceGroupInvalidateRegistry m_invalidateRegistry;
+
+            // Groups are compiled from multiple jobs.
+            AZStd::atomic<uint32_t> m_compiledGroupCount{ 0 };
+            AZStd::atomic<uint64_t> m_constantBytesUploaded{ 0 };
         };
     }
 }
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <Atom/RHI.Reflect/Origin.h>
 #include <Atom/RHI.Reflect/StreamingImagePoolDescriptor.h>
 #include <Atom/RHI/Image.h>
 #include <Atom/RHI/ImagePoolBase.h>
@@ -92,6 +93,48 @@ namespace AZ
             CompleteCallback m_completeCallback;
         };
 
+        /**
+         * A box of tiles in one subresource of a tiled streaming image. The texel size of a tile is
+         * returned by StreamingImagePool::GetImageTileSize.
+         */
+        struct StreamingImageTileRegion
+        {
+            uint16_t m_mipLevel = 0;
+            uint16_t m_arraySlice = 0;
+
+            /// The first tile of the region, in tiles.
+            Origin m_tileOrigin;
+
+            /// The number of tiles of the region along each axis.
+            Size m_tileCount = Size(1, 1, 1);
+        };
+
+        /**
+         * A structure used as an argument to StreamingImagePool::ExpandImageTiles.
+         */
+        struct StreamingImageTileExpandRequest
+        {
+            /// The image with which to make tiles resident.
+            Image* m_image = nullptr;
+
+            /// The tiles to make resident.
+            StreamingImageTileRegion m_region;
+
+            /**
+             * The texel data of the region. The size of the layout is the size of the region in texels,
+             * clamped to the size of the mip level. The data *must* remain valid for the duration of the
+             * upload (until m_completeCallback is triggered).
+             */
+            StreamingImageSubresourceData m_data;
+            ImageSubresourceLayout m_subresourceLayout;
+
+            /// Whether the function need to wait until the upload is finished.
+            bool m_waitForUpload = false;
+
+            /// A function to call when the upload is complete. It will be called instantly if m_waitForUpload was set to true.
+            CompleteCallback m_completeCallback;
+        };
+
         class StreamingImagePool
             : public ImagePoolBase
         {
@@ -134,6 +177,21 @@ namespace AZ
             //! Return if it supports tiled image feature
             bool SupportTiledImage() const;
 
+            //! Returns the size in texels of one tile of a tiled image, or a zero size if the image doesn't support
+            //! tile residency. Tiles are 64KB, so the size depends on the format, e.g. 128x128 for 32 bits per texel.
+            Size GetImageTileSize(const Image& image) const;
+
+            //! Makes a region of tiles resident in a mip level more detailed than the resident mip level, and uploads
+            //! their content. Lets large mips be resident only where they are needed, instead of all-or-nothing.
+            //! Expanding the mip level with ExpandImage replaces its resident tiles. Otherwise they stay resident until
+            //! they are released with TrimImageTiles, or the image is shut down.
+            //! The image views still clamp to the resident mip level.
+            ResultCode ExpandImageTiles(const StreamingImageTileExpandRequest& request);
+
+            //! Releases the resident tiles of a region of a mip level more detailed than the resident mip level.
+            //! The released tiles are no longer backed by memory and their contents are considered undefined.
+            ResultCode TrimImageTiles(Image& image, const StreamingImageTileRegion& region);
+
         protected:
             StreamingImagePool() = default;
 
@@ -145,6 +203,7 @@ namespace AZ
 
             bool ValidateInitRequest(const StreamingImageInitRequest& initRequest) const;
             bool ValidateExpandRequest(const StreamingImageExpandRequest& expandRequest) const;
+            bool ValidateTileRegion(const Image* image, const StreamingImageTileRegion& region) const;
 
             //////////////////////////////////////////////////////////////////////////
             // Platform API
@@ -167,6 +226,15 @@ namespace AZ
             // Return if it supports tiled image feature
             virtual bool SupportTiledImageInternal() const;
 
+            // Called to get the texel size of the tiles of an image.
+            virtual Size GetImageTileSizeInternal(const Image& image) const;
+
+            // Called when tiles of an image mip are being made resident.
+            virtual ResultCode ExpandImageTilesInternal(const StreamingImageTileExpandRequest& request);
+
+            // Called when tiles of an image mip are being released.
+            virtual ResultCode TrimImageTilesInternal(Image& image, const StreamingImageTileRegion& region);
+
             //////////////////////////////////////////////////////////////////////////
 
             StreamingImagePoolDescriptor m_descriptor;
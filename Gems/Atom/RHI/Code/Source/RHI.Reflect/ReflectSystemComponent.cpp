@@ -35,6 +35,7 @@
 #include <Atom/RHI.Reflect/StreamingImagePoolDescriptor.h>
 #include <Atom/RHI.Reflect/InputStreamLayout.h>
 #include <Atom/RHI.Reflect/Viewport.h>
+#include <Atom/RHI.Reflect/VariableRateShadingEnums.h>
 #include <Atom/RHI.Reflect/PlatformLimitsDescriptor.h>
 #include <Atom/RHI.Reflect/PhysicalDeviceDescriptor.h>
 
@@ -192,6 +193,16 @@ namespace AZ
                 ->Value("ReverseDepthThenKey", DrawListSortType::ReverseDepthThenKey)
                 ;
 
+            serializeContext->Enum<ShadingRate>()
+                ->Value("Rate1x1", ShadingRate::Rate1x1)
+                ->Value("Rate1x2", ShadingRate::Rate1x2)
+                ->Value("Rate2x1", ShadingRate::Rate2x1)
+                ->Value("Rate2x2", ShadingRate::Rate2x2)
+                ->Value("Rate2x4", ShadingRate::Rate2x4)
+                ->Value("Rate4x2", ShadingRate::Rate4x2)
+                ->Value("Rate4x4", ShadingRate::Rate4x4)
+                ;
+
             serializeContext->Enum<ScopeAttachmentAccess>()
                 ->Value("Read", ScopeAttachmentAccess::Read)
                 ->Value("Write", ScopeAttachmentAccess::Write)
@@ -7,7 +7,10 @@
  */
 
 #include <Atom/RHI/BufferPool.h>
+#include <Atom/RHI/Fence.h>
 #include <Atom/RHI/MemoryStatisticsBuilder.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/IStreamer.h>
 namespace AZ
 {
     namespace RHI
@@ -107,6 +110,47 @@ namespace AZ
             return true;
         }
 
+        bool BufferPool::ValidateFileStreamRequest(const BufferFileStreamRequest& request) const
+        {
+            // The fence and streamer are always required since they're used to complete the request.
+            if (!request.m_fenceToSignal)
+            {
+                AZ_Error("BufferPool", false, "Streaming a buffer from a file requires a fence to signal.");
+                return false;
+            }
+
+            if (!AZ::Interface<AZ::IO::IStreamer>::Get())
+            {
+                AZ_Error("BufferPool", false, "Unable to stream a buffer from file '%s' because there's no file streamer.",
+                    request.m_filePath.c_str());
+                return false;
+            }
+
+            if (Validation::IsEnabled())
+            {
+                if (request.m_byteCount == 0)
+                {
+                    AZ_Warning("BufferPool", false, "Trying to stream zero bytes to buffer '%s'.", request.m_buffer->GetName().GetCStr());
+                    return false;
+                }
+
+                if (request.m_byteOffset + request.m_byteCount > request.m_buffer->GetDescriptor().m_byteCount)
+                {
+                    AZ_Error(
+                        "BufferPool", false, "Unable to stream to buffer '%s', overrunning the size of the buffer.",
+                        request.m_buffer->GetName().GetCStr());
+                    return false;
+                }
+
+                if (GetDescriptor().m_hostMemoryAccess == HostMemoryAccess::Read)
+                {
+                    AZ_Error("BufferPool", false, "Streaming from a file is not allowed with read-only pools.");
+                    return false;
+                }
+            }
+            return true;
+        }
+
         ResultCode BufferPool::Init(Device& device, const BufferPoolDescriptor& descriptor)
         {
             return ResourcePool::Init(
@@ -225,6 +269,64 @@ namespace AZ
             return StreamBufferInternal(request);
         }
 
+        ResultCode BufferPool::StreamBufferFromFile(const BufferFileStreamRequest& request)
+        {
+            if (!ValidateIsInitialized())
+            {
+                return ResultCode::InvalidOperation;
+            }
+
+            if (!ValidateIsRegistered(request.m_buffer) || !ValidateFileStreamRequest(request))
+            {
+                return ResultCode::InvalidArgument;
+            }
+
+            return StreamBufferFromFileInternal(request);
+        }
+
+        ResultCode BufferPool::StreamBufferFromFileToHostMemory(const BufferFileStreamRequest& request)
+        {
+            AZ_PROFILE_FUNCTION(RHI);
+
+            BufferMapRequest mapRequest(*request.m_buffer, request.m_byteOffset, request.m_byteCount);
+            BufferMapResponse mapResponse;
+            ResultCode resultCode = MapBuffer(mapRequest, mapResponse);
+            if (resultCode != ResultCode::Success)
+            {
+                return resultCode;
+            }
+
+            // The read completes on a streamer thread, so keep the buffer and fence alive until then.
+            Ptr<Buffer> buffer = request.m_buffer;
+            Ptr<Fence> fenceToSignal = request.m_fenceToSignal;
+            const size_t byteCount = request.m_byteCount;
+
+            auto* streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+            AZ::IO::FileRequestPtr fileRequest = streamer->Read(
+                request.m_filePath, mapResponse.m_data, byteCount, byteCount, request.m_deadline, request.m_priority,
+                request.m_fileOffset);
+            streamer->SetRequestCompleteCallback(
+                fileRequest,
+                [this, buffer, fenceToSignal, byteCount, callback = request.m_readCompleteCallback](AZ::IO::FileRequestHandle fileHandle)
+                {
+                    auto* streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+                    void* data = nullptr;
+                    u64 bytesRead = 0;
+                    const bool success = streamer->GetRequestStatus(fileHandle) == AZ::IO::IStreamerTypes::RequestStatus::Completed &&
+                        streamer->GetReadRequestResult(fileHandle, data, bytesRead) && bytesRead == byteCount;
+                    AZ_Error("BufferPool", success, "Failed to stream buffer '%s' from file.", buffer->GetName().GetCStr());
+
+                    UnmapBuffer(*buffer);
+                    if (callback)
+                    {
+                        callback(success);
+                    }
+                    fenceToSignal->SignalOnCpu();
+                });
+            streamer->QueueRequest(fileRequest);
+            return ResultCode::Success;
+        }
+
         const BufferPoolDescriptor& BufferPool::GetDescriptor() const
         {
             return m_descriptor;
@@ -240,6 +342,15 @@ namespace AZ
             return ResultCode::Unimplemented;
         }
 
+        ResultCode BufferPool::StreamBufferFromFileInternal(const BufferFileStreamRequest& request)
+        {
+            if (GetDescriptor().m_heapMemoryLevel == HeapMemoryLevel::Host)
+            {
+                return StreamBufferFromFileToHostMemory(request);
+            }
+            return ResultCode::Unimplemented;
+        }
+
         bool BufferPool::ValidateNotProcessingFrame() const
         {
             return GetDescriptor().m_heapMemoryLevel != HeapMemoryLevel::Device || BufferPoolBase::ValidateNotProcessingFrame();
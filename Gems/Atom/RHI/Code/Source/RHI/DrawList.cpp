@@ -13,6 +13,112 @@ namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            // Below this size the comparison sort is faster than the radix passes over the whole list.
+            constexpr size_t RadixSortItemCountMin = 512;
+
+            // Maps the depth to an unsigned key with the same order, negative depths included.
+            uint32_t GetDepthRadixKey(float depth)
+            {
+                uint32_t bits = 0;
+                memcpy(&bits, &depth, sizeof(bits));
+                return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+            }
+
+            uint64_t GetSortKeyRadixKey(DrawItemSortKey sortKey)
+            {
+                return static_cast<uint64_t>(sortKey) ^ 0x8000000000000000ull;
+            }
+
+            // Sorts the items by the key with one pass per byte, least significant first. Equal keys keep their order,
+            // so sorting by a secondary key first and by the primary key second sorts by both.
+            // Bytes that are the same for all the items, such as the high bytes of small sort keys, are skipped.
+            template<typename KeyType, typename GetKeyFunction>
+            void RadixSortByKey(DrawList& drawList, DrawList& scratch, GetKeyFunction getKey)
+            {
+                constexpr size_t ByteCount = sizeof(KeyType);
+                uint32_t histograms[ByteCount][256] = {};
+                for (const DrawItemProperties& item : drawList)
+                {
+                    KeyType key = getKey(item);
+                    for (size_t byteIndex = 0; byteIndex < ByteCount; ++byteIndex)
+                    {
+                        ++histograms[byteIndex][(key >> (byteIndex * 8)) & 0xFF];
+                    }
+                }
+
+                const uint32_t itemCount = static_cast<uint32_t>(drawList.size());
+                for (size_t byteIndex = 0; byteIndex < ByteCount; ++byteIndex)
+                {
+                    uint32_t* histogram = histograms[byteIndex];
+                    const uint32_t firstByte = (getKey(drawList.front()) >> (byteIndex * 8)) & 0xFF;
+                    if (histogram[firstByte] == itemCount)
+                    {
+                        continue;
+                    }
+
+                    uint32_t offset = 0;
+                    for (uint32_t& count : AZStd::span<uint32_t>(histogram, 256))
+                    {
+                        const uint32_t bucketCount = count;
+                        count = offset;
+                        offset += bucketCount;
+                    }
+
+                    for (const DrawItemProperties& item : drawList)
+                    {
+                        scratch[histogram[(getKey(item) >> (byteIndex * 8)) & 0xFF]++] = item;
+                    }
+                    drawList.swap(scratch);
+                }
+            }
+
+            void RadixSortDrawList(DrawList& drawList, DrawListSortType sortType)
+            {
+                DrawList scratch(drawList.size());
+                auto sortKey = [](const DrawItemProperties& item)
+                {
+                    return GetSortKeyRadixKey(item.m_sortKey);
+                };
+                auto depth = [](const DrawItemProperties& item)
+                {
+                    return GetDepthRadixKey(item.m_depth);
+                };
+                auto reverseDepth = [](const DrawItemProperties& item)
+                {
+                    return ~GetDepthRadixKey(item.m_depth);
+                };
+
+                switch (sortType)
+                {
+                case DrawListSortType::KeyThenDepth:
+                    RadixSortByKey<uint32_t>(drawList, scratch, depth);
+                    RadixSortByKey<uint64_t>(drawList, scratch, sortKey);
+                    break;
+                case DrawListSortType::KeyThenReverseDepth:
+                    RadixSortByKey<uint32_t>(drawList, scratch, reverseDepth);
+                    RadixSortByKey<uint64_t>(drawList, scratch, sortKey);
+                    break;
+                case DrawListSortType::DepthThenKey:
+                    RadixSortByKey<uint64_t>(drawList, scratch, sortKey);
+                    RadixSortByKey<uint32_t>(drawList, scratch, depth);
+                    break;
+                case DrawListSortType::ReverseDepthThenKey:
+                    RadixSortByKey<uint64_t>(drawList, scratch, sortKey);
+                    RadixSortByKey<uint32_t>(drawList, scratch, reverseDepth);
+                    break;
+                }
+
+                // Keeps the larger allocation in the draw list, which is refilled every frame.
+                if (scratch.capacity() > drawList.capacity())
+                {
+                    scratch.assign(drawList.begin(), drawList.end());
+                    drawList.swap(scratch);
+                }
+            }
+        } // namespace
+
         DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount)
         {
             if (drawList.empty())
@@ -28,6 +134,12 @@ namespace AZ
 
         void SortDrawList(DrawList& drawList, DrawListSortType sortType)
         {
+            if (drawList.size() >= RadixSortItemCountMin)
+            {
+                RadixSortDrawList(drawList, sortType);
+                return;
+            }
+
             switch (sortType)
             {
             case DrawListSortType::KeyThenDepth:
@@ -89,11 +89,22 @@ namespace AZ
         void DrawListContext::FinalizeLists()
         {
             AZ_PROFILE_SCOPE(RHI, "DrawListContext: FinalizeLists");
+            // Sizes the merged lists first, so appending each thread list doesn't grow them again.
+            AZStd::array<size_t, Limits::Pipeline::DrawListTagCountMax> itemCounts = {};
+            m_threadListsByTag.ForEach([this, &itemCounts](DrawListsByTag& drawListsByTag)
+            {
+                for (size_t i = 0; i < drawListsByTag.size(); ++i)
+                {
+                    itemCounts[i] += m_drawListMask[i] ? drawListsByTag[i].size() : 0;
+                }
+            });
+
             for (size_t i = 0; i < m_mergedListsByTag.size(); ++i)
             {
                 if (m_drawListMask[i])
                 {
                     m_mergedListsByTag[i].clear();
+                    m_mergedListsByTag[i].reserve(itemCounts[i]);
                 }
             }
 
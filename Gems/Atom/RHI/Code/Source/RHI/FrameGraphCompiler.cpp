@@ -18,6 +18,9 @@
 #include <Atom/RHI/SwapChainFrameAttachment.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/optional.h>
 
@@ -62,6 +65,7 @@ namespace AZ
                 m_bufferViewCache.Clear();
                 m_imageReverseLookupHash.clear();
                 m_bufferReverseLookupHash.clear();
+                m_transientTopologyMemoryUsageValid = false;
                
                 ShutdownInternal();
                 DeviceObject::Shutdown();
@@ -145,19 +149,22 @@ namespace AZ
             CompileResourceViews(frameGraph.GetAttachmentDatabase());
 
             /// [Phase 4] Compile platform-specific scope data after all attachments and views have been compiled.
-            {
-                AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: Scope Compile");
-
-                for (Scope* scope : frameGraph.GetScopes())
-                {
-                    scope->Compile(GetDevice());
-                }
-            }
+            CompileScopes(frameGraph, request.m_jobPolicy, request.m_scopeCompilesPerJob);
 
             /// Perform platform-specific compilation.
             return CompileInternal(request);
         }
 
+        uint64_t FrameGraphCompiler::GetTransientTopologyCacheHitCount() const
+        {
+            return m_transientTopologyCacheHits;
+        }
+
+        uint64_t FrameGraphCompiler::GetTransientTopologyCacheMissCount() const
+        {
+            return m_transientTopologyCacheMisses;
+        }
+
         void FrameGraphCompiler::CompileQueueCentricScopeGraph(
             FrameGraph& frameGraph,
             FrameSchedulerCompileFlags compileFlags)
@@ -228,7 +235,10 @@ namespace AZ
                             {
                                 if (sameQueueConsumerScope->GetIndex() < currentScope->GetIndex())
                                 {
+                                    // One earlier consumer is enough to discard the edge, so the rest of the queue isn't walked.
+                                    // Walking it for every scope made this phase quadratic in the number of scopes.
                                     foundEarlierConsumerOnSameQueue = true;
+                                    break;
                                 }
                             }
 
@@ -701,9 +711,40 @@ namespace AZ
             // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources)
             if (transientAttachmentPool.GetDescriptor().m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint)
             {
-                // First pass to calculate size needed.
-                processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
-                memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+                // The size only depends on the order of the commands and on the descriptors of the attachments, so the
+                // size calculated for the previous frame is reused when none of them changed.
+                HashValue64 topologyHash = TypeHash64(&transientAttachmentPool, HashValue64{ scopes.size() });
+                for (Command command : commands)
+                {
+                    topologyHash = TypeHash64(command.m_command, topologyHash);
+                }
+                for (const BufferFrameAttachment* bufferFrameAttachment : transientBufferGraphAttachments)
+                {
+                    topologyHash = TypeHash64(bufferFrameAttachment->GetId().GetHash(), topologyHash);
+                    topologyHash = bufferFrameAttachment->GetBufferDescriptor().GetHash(topologyHash);
+                }
+                for (const ImageFrameAttachment* imageFrameAttachment : transientImageGraphAttachments)
+                {
+                    topologyHash = TypeHash64(imageFrameAttachment->GetId().GetHash(), topologyHash);
+                    topologyHash = imageFrameAttachment->GetImageDescriptor().GetHash(topologyHash);
+                    topologyHash = TypeHash64(imageFrameAttachment->GetSupportedQueueMask(), topologyHash);
+                    topologyHash = imageFrameAttachment->GetOptimizedClearValue().GetHash(topologyHash);
+                }
+
+                if (m_transientTopologyMemoryUsageValid && m_transientTopologyHash == topologyHash)
+                {
+                    ++m_transientTopologyCacheHits;
+                }
+                else
+                {
+                    // First pass to calculate size needed.
+                    processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
+                    m_transientTopologyMemoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+                    m_transientTopologyHash = topologyHash;
+                    m_transientTopologyMemoryUsageValid = true;
+                    ++m_transientTopologyCacheMisses;
+                }
+                memoryUsage = m_transientTopologyMemoryUsage;
             }
 
             // Second pass uses the information about memory usage
@@ -854,6 +895,49 @@ namespace AZ
             }
         }
     
+        void FrameGraphCompiler::CompileScopes(FrameGraph& frameGraph, JobPolicy jobPolicy, uint32_t scopeCompilesPerJob)
+        {
+            AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: Scope Compile");
+
+            const AZStd::vector<Scope*>& scopes = frameGraph.GetScopes();
+            const uint32_t scopeCount = aznumeric_cast<uint32_t>(scopes.size());
+            scopeCompilesPerJob = AZStd::max(scopeCompilesPerJob, 1u);
+
+            if (jobPolicy == JobPolicy::Serial || scopeCount <= scopeCompilesPerJob || !IsParallelScopeCompileSupported())
+            {
+                for (Scope* scope : scopes)
+                {
+                    scope->Compile(GetDevice());
+                }
+                return;
+            }
+
+            // Each scope only compiles its own data from the attachments and views that were compiled by the previous phases,
+            // so scopes are split into ranges that are compiled in parallel.
+            Device& device = GetDevice();
+            AZ::JobCompletion jobCompletion;
+            const uint32_t jobCount = AZ::DivideAndRoundUp(scopeCount, scopeCompilesPerJob);
+            for (uint32_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+            {
+                const uint32_t scopeBegin = jobIndex * scopeCompilesPerJob;
+                const uint32_t scopeEnd = AZStd::min(scopeBegin + scopeCompilesPerJob, scopeCount);
+
+                const auto compileScopesForIntervalLambda = [&scopes, &device, scopeBegin, scopeEnd]()
+                {
+                    AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: compileScopesForIntervalLambda");
+                    for (uint32_t scopeIndex = scopeBegin; scopeIndex < scopeEnd; ++scopeIndex)
+                    {
+                        scopes[scopeIndex]->Compile(device);
+                    }
+                };
+
+                AZ::Job* compileScopesJob = AZ::CreateJobFunction(AZStd::move(compileScopesForIntervalLambda), true, nullptr);
+                compileScopesJob->SetDependent(&jobCompletion);
+                compileScopesJob->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
         template<typename ReverseLookupObjectType, typename ObjectCacheType>
         void FrameGraphCompiler::RemoveFromCache(ReverseLookupObjectType objectToRemove,
                                                   AZStd::unordered_map<ReverseLookupObjectType, HashValue64>& reverseHashLookupMap,
@@ -201,6 +201,8 @@ namespace AZ
             frameGraphCompileRequest.m_logVerbosity = compileRequest.m_logVerbosity;
             frameGraphCompileRequest.m_compileFlags = compileRequest.m_compileFlags;
             frameGraphCompileRequest.m_statisticsFlags = compileRequest.m_statisticsFlags;
+            frameGraphCompileRequest.m_jobPolicy = compileRequest.m_jobPolicy;
+            frameGraphCompileRequest.m_scopeCompilesPerJob = compileRequest.m_scopeCompilesPerJob;
 
             const MessageOutcome outcome = m_frameGraphCompiler->Compile(frameGraphCompileRequest);
             if (outcome.IsSuccess())
@@ -381,6 +383,15 @@ namespace AZ
             //we try to compact and re-compile SRGs.
             [[maybe_unused]] RHI::ResultCode resultCode = m_device->CompactSRGMemory();
             AZ_Assert(resultCode == RHI::ResultCode::Success, "SRG compaction failed and this can lead to a gpu crash.");
+
+            m_shaderResourceGroupCompileStatistics = {};
+            const auto gatherStatisticsFunction = [this](ShaderResourceGroupPool* srgPool)
+            {
+                const ShaderResourceGroupCompileStatistics poolStatistics = srgPool->ResetCompileStatistics();
+                m_shaderResourceGroupCompileStatistics.m_compiledGroupCount += poolStatistics.m_compiledGroupCount;
+                m_shaderResourceGroupCompileStatistics.m_constantBytesUploaded += poolStatistics.m_constantBytesUploaded;
+            };
+            resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(gatherStatisticsFunction)>(gatherStatisticsFunction);
         }
 
         void FrameScheduler::BuildRayTracingShaderTables()
@@ -622,6 +633,21 @@ namespace AZ
                 : nullptr;
         }
 
+        uint64_t FrameScheduler::GetTransientTopologyCacheHitCount() const
+        {
+            return m_frameGraphCompiler->GetTransientTopologyCacheHitCount();
+        }
+
+        uint64_t FrameScheduler::GetTransientTopologyCacheMissCount() const
+        {
+            return m_frameGraphCompiler->GetTransientTopologyCacheMissCount();
+        }
+
+        const ShaderResourceGroupCompileStatistics& FrameScheduler::GetShaderResourceGroupCompileStatistics() const
+        {
+            return m_shaderResourceGroupCompileStatistics;
+        }
+
         double FrameScheduler::GetCpuFrameTime() const
         {
             if (auto statsProfiler = AZ::Interface<AZ::Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
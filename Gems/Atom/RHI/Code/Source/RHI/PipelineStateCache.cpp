@@ -10,6 +10,7 @@
 #include <Atom/RHI/Factory.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
 
@@ -26,6 +27,16 @@ namespace AZ
             : m_device{&device}
         {}
 
+        PipelineStateCache::~PipelineStateCache()
+        {
+            // The precompile jobs reference the cache.
+            AZStd::exponential_backoff backoff;
+            while (m_pendingPrecompileCount > 0)
+            {
+                backoff.wait();
+            }
+        }
+
         void PipelineStateCache::ValidateCacheIntegrity() const
         {
 #if defined(AZ_ENABLE_TRACING)
@@ -155,6 +166,7 @@ namespace AZ
             });
 
             GlobalLibraryEntry& libraryEntry = m_globalLibrarySet[handle.GetIndex()];
+            ++libraryEntry.m_generation;
 
             AZ_Assert(libraryEntry.m_pendingCompileCount == 0, "Reseting library while compiles are still pending!");
             libraryEntry.m_readOnlyCache.clear();
@@ -218,7 +230,21 @@ namespace AZ
         void PipelineStateCache::Compact()
         {
             AZ_PROFILE_SCOPE(RHI, "PipelineStateCache: Compact");
-            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex, AZStd::defer_lock);
+
+            // Background compilations hold a shared lock for as long as they compile. Waiting for them would stall the
+            // frame, and the pending cache keeps serving their pipeline states until a later frame merges it.
+            if (m_pendingPrecompileCount > 0)
+            {
+                if (!lock.try_lock())
+                {
+                    return;
+                }
+            }
+            else
+            {
+                lock.lock();
+            }
 
             // Merge the pending cache into the read-only cache.
             bool hasCompiledPipelineStates = false;
@@ -299,6 +325,74 @@ namespace AZ
                 return pipelineState;
             }
 
+            return AcquirePipelineStateLocked(handle, descriptor, pipelineStateHash, false);
+        }
+
+        void PipelineStateCache::PrecompilePipelineStates(PipelineLibraryHandle handle, AZStd::span<const PipelineStateDescriptor* const> descriptors)
+        {
+            if (handle.IsNull() || descriptors.empty())
+            {
+                return;
+            }
+
+            uint32_t generation = 0;
+            {
+                AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+                generation = m_globalLibrarySet[handle.GetIndex()].m_generation;
+            }
+
+            for (const PipelineStateDescriptor* descriptor : descriptors)
+            {
+                // The descriptor is copied into an entry, as the one of the caller may not outlive the job.
+                PipelineStateEntry pipelineStateEntry(descriptor->GetHash(), nullptr, *descriptor);
+
+                ++m_pendingPrecompileCount;
+                const auto precompileFunction = [this, handle, generation, pipelineStateEntry]()
+                {
+                    {
+                        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+                        const GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+                        if (m_globalLibraryActiveBits[handle.GetIndex()] && globalLibraryEntry.m_generation == generation)
+                        {
+                            AZStd::visit([&](const auto& pipelineStateDescriptor)
+                            {
+                                if (!FindPipelineState(globalLibraryEntry.m_readOnlyCache, pipelineStateDescriptor))
+                                {
+                                    AcquirePipelineStateLocked(handle, pipelineStateDescriptor, pipelineStateEntry.m_hash, true);
+                                }
+                            }, pipelineStateEntry.m_pipelineStateDescriptorVariant);
+                        }
+                    }
+                    --m_pendingPrecompileCount;
+                };
+
+                AZ::Job* job = AZ::CreateJobFunction(AZStd::move(precompileFunction), true);
+                job->Start();
+            }
+        }
+
+        uint32_t PipelineStateCache::GetPendingPrecompileCount() const
+        {
+            return m_pendingPrecompileCount;
+        }
+
+        PipelineStateCache::CompileStatistics PipelineStateCache::GetCompileStatistics() const
+        {
+            CompileStatistics statistics;
+            statistics.m_compiledOnAcquireCount = m_compiledOnAcquireCount;
+            statistics.m_acquiredWhileCompilingCount = m_acquiredWhileCompilingCount;
+            statistics.m_precompiledCount = m_precompiledCount;
+            return statistics;
+        }
+
+        const PipelineState* PipelineStateCache::AcquirePipelineStateLocked(
+            PipelineLibraryHandle handle,
+            const PipelineStateDescriptor& descriptor,
+            PipelineStateHash pipelineStateHash,
+            bool isPrecompile)
+        {
+            GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+
             // Search the thread-local cache next.
             {
                 ThreadLibrarySet& threadLibrarySet = m_threadLibrarySet.GetStorage();
@@ -328,7 +422,23 @@ namespace AZ
                         threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
                     }
 
-                    ConstPtr<PipelineState> pipelineState = CompilePipelineState(globalLibraryEntry, threadLibraryEntry, descriptor, pipelineStateHash);
+                    bool isCompiling = false;
+                    ConstPtr<PipelineState> pipelineState = CompilePipelineState(globalLibraryEntry, threadLibraryEntry, descriptor, pipelineStateHash, isCompiling);
+                    if (isPrecompile)
+                    {
+                        if (isCompiling)
+                        {
+                            ++m_precompiledCount;
+                        }
+                    }
+                    else if (isCompiling)
+                    {
+                        ++m_compiledOnAcquireCount;
+                    }
+                    else
+                    {
+                        ++m_acquiredWhileCompilingCount;
+                    }
 
                     [[maybe_unused]] bool success = InsertPipelineState(threadLocalCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor));
                     AZ_Assert(success, "PipelineStateEntry already exists in the thread cache.");
@@ -342,7 +452,8 @@ namespace AZ
             GlobalLibraryEntry& globalLibraryEntry,
             ThreadLibraryEntry& threadLibraryEntry,
             const PipelineStateDescriptor& descriptor,
-            PipelineStateHash pipelineStateHash)
+            PipelineStateHash pipelineStateHash,
+            bool& isCompiling)
         {
             Ptr<PipelineState> pipelineState;
 
@@ -364,6 +475,7 @@ namespace AZ
                 [[maybe_unused]] bool success = InsertPipelineState(pendingCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor));
                 AZ_Assert(success, "PipelineStateEntry already exists in the pending cache.");
             }
+            isCompiling = true;
 
             [[maybe_unused]] ResultCode resultCode = ResultCode::InvalidArgument;
 
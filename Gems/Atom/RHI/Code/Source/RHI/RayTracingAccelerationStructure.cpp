@@ -117,6 +117,12 @@ namespace AZ
             return this;
         }
 
+        RayTracingTlasDescriptor* RayTracingTlasDescriptor::Refit(bool refit)
+        {
+            m_refit = refit;
+            return this;
+        }
+
         RHI::Ptr<RHI::RayTracingBlas> RayTracingBlas::CreateRHIRayTracingBlas()
         {
             RHI::Ptr<RHI::RayTracingBlas> rayTracingBlas = RHI::Factory::Get().CreateRayTracingBlas();
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <Atom/RHI.Reflect/Bits.h>
+#include <Atom/RHI/RingAllocator.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        void RingAllocator::Init(const Descriptor& descriptor)
+        {
+            m_descriptor = descriptor;
+            m_garbageCollectCursors.assign(m_descriptor.m_garbageCollectLatency + 1, 0);
+            m_garbageCollectIndex = 0;
+            m_cursor = 0;
+            m_cursorLimit = m_descriptor.m_capacityInBytes;
+        }
+
+        void RingAllocator::Shutdown()
+        {
+            GarbageCollectForce();
+        }
+
+        void RingAllocator::GarbageCollectForce()
+        {
+            const uint64_t cursor = m_cursor.load();
+            AZStd::fill(m_garbageCollectCursors.begin(), m_garbageCollectCursors.end(), cursor);
+            m_garbageCollectIndex = 0;
+            m_cursorLimit = cursor + m_descriptor.m_capacityInBytes;
+        }
+
+        void RingAllocator::GarbageCollect()
+        {
+            if (m_garbageCollectCursors.empty())
+            {
+                return;
+            }
+
+            // The oldest recorded cursor is replaced by the current one, and everything allocated before it is reclaimed.
+            m_garbageCollectCursors[m_garbageCollectIndex] = m_cursor.load();
+            m_garbageCollectIndex = (m_garbageCollectIndex + 1) % m_garbageCollectCursors.size();
+            m_cursorLimit = m_garbageCollectCursors[m_garbageCollectIndex] + m_descriptor.m_capacityInBytes;
+        }
+
+        const RingAllocator::Descriptor& RingAllocator::GetDescriptor() const
+        {
+            return m_descriptor;
+        }
+
+        size_t RingAllocator::GetAllocatedByteCount() const
+        {
+            const uint64_t cursorInUse = m_cursorLimit.load(AZStd::memory_order_relaxed) - m_descriptor.m_capacityInBytes;
+            return aznumeric_cast<size_t>(m_cursor.load(AZStd::memory_order_relaxed) - cursorInUse);
+        }
+
+        VirtualAddress RingAllocator::Allocate(size_t byteCount, size_t byteAlignment)
+        {
+            const size_t capacity = m_descriptor.m_capacityInBytes;
+            if (byteCount == 0 || byteCount > capacity)
+            {
+                return VirtualAddress::CreateNull();
+            }
+
+            const uintptr_t addressBase = m_descriptor.m_addressBase.m_ptr;
+            byteAlignment = AZStd::max<size_t>(byteAlignment, 1);
+
+            uint64_t cursor = m_cursor.load(AZStd::memory_order_relaxed);
+            for (;;)
+            {
+                const size_t offset = aznumeric_cast<size_t>(cursor % capacity);
+                size_t alignedOffset = RHI::AlignUp(addressBase + offset, byteAlignment) - addressBase;
+                uint64_t allocationStart = cursor - offset + alignedOffset;
+                if (alignedOffset + byteCount > capacity)
+                {
+                    // The end of the ring is skipped, as an allocation has to be contiguous.
+                    alignedOffset = RHI::AlignUp(addressBase, byteAlignment) - addressBase;
+                    allocationStart = cursor - offset + capacity + alignedOffset;
+                    if (alignedOffset + byteCount > capacity)
+                    {
+                        return VirtualAddress::CreateNull();
+                    }
+                }
+
+                const uint64_t allocationEnd = allocationStart + byteCount;
+                if (allocationEnd > m_cursorLimit.load(AZStd::memory_order_relaxed))
+                {
+                    return VirtualAddress::CreateNull();
+                }
+
+                if (m_cursor.compare_exchange_weak(cursor, allocationEnd, AZStd::memory_order_relaxed))
+                {
+                    return VirtualAddress{ addressBase + alignedOffset };
+                }
+            }
+        }
+
+        void RingAllocator::DeAllocate(VirtualAddress offset)
+        {
+            (void)offset;
+        }
+    }
+}
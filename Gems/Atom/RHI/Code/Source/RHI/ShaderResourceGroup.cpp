@@ -62,6 +62,10 @@ namespace AZ
             
             //RHI has it's own copy of update mask that is reset after Compile is called m_updateMaskResetLatency times.
             m_rhiUpdateMask |= sourceUpdateMask;
+            if (RHI::CheckBitsAny(sourceUpdateMask, static_cast<uint32_t>(ShaderResourceGroupData::ResourceTypeMask::ConstantDataMask)))
+            {
+                MergeInterval(m_constantsPendingInterval, data.GetConstantsUpdateInterval());
+            }
             for (uint32_t i = 0; i < static_cast<uint32_t>(ShaderResourceGroupData::ResourceType::Count); i++)
             {
                 if (RHI::CheckBit(sourceUpdateMask, static_cast<AZ::u8>(i)))
@@ -118,6 +122,47 @@ namespace AZ
             m_viewHash[viewName] = viewHash;
         }
     
+        Interval ShaderResourceGroup::GetConstantsCompileInterval() const
+        {
+            return m_constantsCompileInterval;
+        }
+
+        void ShaderResourceGroup::UpdateConstantsCompileInterval(bool compileAllConstants)
+        {
+            if (compileAllConstants)
+            {
+                m_constantsPendingInterval = Interval(0, aznumeric_cast<uint32_t>(m_data.GetConstantData().size()));
+            }
+
+            m_constantsIntervalPerCompile[m_constantsCompileIndex] = m_constantsPendingInterval;
+            m_constantsCompileIndex = (m_constantsCompileIndex + 1) % RHI::Limits::Device::FrameCountMax;
+            m_constantsPendingInterval = {};
+
+            m_constantsCompileInterval = {};
+            for (const Interval& interval : m_constantsIntervalPerCompile)
+            {
+                MergeInterval(m_constantsCompileInterval, interval);
+            }
+        }
+
+        void ShaderResourceGroup::MergeInterval(Interval& interval, Interval other)
+        {
+            if (other.m_min >= other.m_max)
+            {
+                return;
+            }
+
+            if (interval.m_min >= interval.m_max)
+            {
+                interval = other;
+            }
+            else
+            {
+                interval.m_min = AZStd::min(interval.m_min, other.m_min);
+                interval.m_max = AZStd::max(interval.m_max, other.m_max);
+            }
+        }
+
         void ShaderResourceGroup::ReportMemoryUsage(MemoryStatisticsBuilder& builder) const
         {
             AZ_UNUSED(builder);
@@ -251,20 +251,28 @@ namespace AZ
 
         bool ShaderResourceGroupData::SetConstantRaw(ShaderInputConstantIndex inputIndex, const void* bytes, uint32_t byteOffset, uint32_t byteCount)
         {
-            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
-            return m_constantsData.SetConstantRaw(inputIndex, bytes, byteOffset, byteCount);
+            if (m_constantsData.SetConstantRaw(inputIndex, bytes, byteOffset, byteCount))
+            {
+                const uint32_t constantOffset = m_constantsData.GetLayout()->GetInterval(inputIndex).m_min + byteOffset;
+                EnableConstantsCompilation(Interval(constantOffset, constantOffset + byteCount));
+                return true;
+            }
+            return false;
         }
 
         bool ShaderResourceGroupData::SetConstantData(const void* bytes, uint32_t byteCount)
         {
-            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
-            return m_constantsData.SetConstantData(bytes, byteCount);
+            return SetConstantData(bytes, 0, byteCount);
         }
 
         bool ShaderResourceGroupData::SetConstantData(const void* bytes, uint32_t byteOffset, uint32_t byteCount)
         {
-            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
-            return m_constantsData.SetConstantData(bytes, byteOffset, byteCount);
+            if (m_constantsData.SetConstantData(bytes, byteOffset, byteCount))
+            {
+                EnableConstantsCompilation(Interval(byteOffset, byteOffset + byteCount));
+                return true;
+            }
+            return false;
         }
 
         const RHI::ConstPtr<RHI::ImageView>& ShaderResourceGroupData::GetImageView(RHI::ShaderInputImageIndex inputIndex, uint32_t arrayIndex) const
@@ -383,15 +391,50 @@ namespace AZ
         {
             return m_updateMask;
         }
+
+        Interval ShaderResourceGroupData::GetConstantsUpdateInterval() const
+        {
+            return m_constantsUpdateInterval;
+        }
     
         void ShaderResourceGroupData::EnableResourceTypeCompilation(ResourceTypeMask resourceTypeMask)
         {
+            if (RHI::CheckBitsAny(static_cast<uint32_t>(resourceTypeMask), static_cast<uint32_t>(ResourceTypeMask::ConstantDataMask)))
+            {
+                // The caller didn't say which constants changed
+                EnableConstantsCompilation(Interval(0, aznumeric_cast<uint32_t>(m_constantsData.GetConstantData().size())));
+            }
             m_updateMask = RHI::SetBits(m_updateMask, static_cast<uint32_t>(resourceTypeMask));
         }
 
+        void ShaderResourceGroupData::EnableConstantsCompilation(ShaderInputConstantIndex inputIndex)
+        {
+            EnableConstantsCompilation(m_constantsData.GetLayout()->GetInterval(inputIndex));
+        }
+
+        void ShaderResourceGroupData::EnableConstantsCompilation(Interval interval)
+        {
+            m_updateMask = RHI::SetBits(m_updateMask, static_cast<uint32_t>(ResourceTypeMask::ConstantDataMask));
+            if (interval.m_min >= interval.m_max)
+            {
+                return;
+            }
+
+            if (m_constantsUpdateInterval.m_min >= m_constantsUpdateInterval.m_max)
+            {
+                m_constantsUpdateInterval = interval;
+            }
+            else
+            {
+                m_constantsUpdateInterval.m_min = AZStd::min(m_constantsUpdateInterval.m_min, interval.m_min);
+                m_constantsUpdateInterval.m_max = AZStd::max(m_constantsUpdateInterval.m_max, interval.m_max);
+            }
+        }
+
         void ShaderResourceGroupData::ResetUpdateMask()
         {
             m_updateMask = 0;
+            m_constantsUpdateInterval = {};
         }
     
         void ShaderResourceGroupData::SetBindlessViews(
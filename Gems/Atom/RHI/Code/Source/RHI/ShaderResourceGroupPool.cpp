@@ -73,6 +73,12 @@ namespace AZ
                 // Pre-initialize the data so that we can build view diffs later.
                 group.m_data = ShaderResourceGroupData(layout);
 
+                // Nothing was written to the platform copies of the constant data yet.
+                for (Interval& interval : group.m_constantsIntervalPerCompile)
+                {
+                    interval = Interval(0, layout->GetConstantDataSize());
+                }
+
                 // Cache off the binding slot for one less indirection.
                 group.m_bindingSlot = layout->GetBindingSlot();
             }
@@ -350,7 +356,9 @@ namespace AZ
             // Check if any part of the Srg was updated before trying to compile it
             if (shaderResourceGroup.IsAnyResourceTypeUpdated())
             {
+                shaderResourceGroup.UpdateConstantsCompileInterval(r_DisablePartialSrgCompilation);
                 ResultCode resultCode = CompileGroupInternal(shaderResourceGroup, shaderResourceGroupData);
+                m_compiledGroupCount.fetch_add(1, AZStd::memory_order_relaxed);
                 
                 //Reset update mask if the latency check has been fulfilled
                 shaderResourceGroup.DisableCompilationForAllResourceTypes();
@@ -377,6 +385,19 @@ namespace AZ
             }
         }
 
+        ShaderResourceGroupCompileStatistics ShaderResourceGroupPool::ResetCompileStatistics()
+        {
+            ShaderResourceGroupCompileStatistics statistics;
+            statistics.m_compiledGroupCount = m_compiledGroupCount.exchange(0);
+            statistics.m_constantBytesUploaded = m_constantBytesUploaded.exchange(0);
+            return statistics;
+        }
+
+        void ShaderResourceGroupPool::AddConstantBytesUploaded(size_t byteCount)
+        {
+            m_constantBytesUploaded.fetch_add(byteCount, AZStd::memory_order_relaxed);
+        }
+
         ResultCode ShaderResourceGroupPool::InitInternal(Device&, const ShaderResourceGroupPoolDescriptor&)
         {
             return ResultCode::Success;
@@ -71,6 +71,50 @@ namespace AZ
             return true;
         }
 
+        bool StreamingImagePool::ValidateTileRegion(const Image* image, const StreamingImageTileRegion& region) const
+        {
+            if (Validation::IsEnabled())
+            {
+                if (!ValidateIsRegistered(image))
+                {
+                    return false;
+                }
+
+                if (region.m_mipLevel >= image->GetResidentMipLevel())
+                {
+                    AZ_Error("StreamingImagePool", false, "Tiles can only be managed for mip levels more detailed than the resident mip level.");
+                    return false;
+                }
+
+                if (region.m_arraySlice >= image->GetDescriptor().m_arraySize)
+                {
+                    AZ_Error("StreamingImagePool", false, "Tile region array slice exceeds the array size of the image.");
+                    return false;
+                }
+
+                const Size tileSize = GetImageTileSize(*image);
+                if (tileSize.m_width == 0 || tileSize.m_height == 0 || tileSize.m_depth == 0)
+                {
+                    AZ_Error("StreamingImagePool", false, "Image '%s' doesn't support tile residency.", image->GetName().GetCStr());
+                    return false;
+                }
+
+                const Size mipSize = image->GetDescriptor().m_size.GetReducedMip(region.m_mipLevel);
+                if (region.m_tileCount.m_width == 0 || region.m_tileCount.m_height == 0 || region.m_tileCount.m_depth == 0 ||
+                    (region.m_tileOrigin.m_left + region.m_tileCount.m_width) * tileSize.m_width >= mipSize.m_width + tileSize.m_width ||
+                    (region.m_tileOrigin.m_top + region.m_tileCount.m_height) * tileSize.m_height >= mipSize.m_height + tileSize.m_height ||
+                    (region.m_tileOrigin.m_front + region.m_tileCount.m_depth) * tileSize.m_depth >= mipSize.m_depth + tileSize.m_depth)
+                {
+                    AZ_Error("StreamingImagePool", false, "Tile region is empty or exceeds the tiles of the mip level.");
+                    return false;
+                }
+            }
+
+            AZ_UNUSED(image);
+            AZ_UNUSED(region);
+            return true;
+        }
+
         ResultCode StreamingImagePool::Init(Device& device, const StreamingImagePoolDescriptor& descriptor)
         {
             AZ_PROFILE_FUNCTION(RHI);
@@ -195,6 +239,41 @@ namespace AZ
             return SupportTiledImageInternal();
         }
 
+        Size StreamingImagePool::GetImageTileSize(const Image& image) const
+        {
+            return GetImageTileSizeInternal(image);
+        }
+
+        ResultCode StreamingImagePool::ExpandImageTiles(const StreamingImageTileExpandRequest& request)
+        {
+            if (!ValidateIsInitialized())
+            {
+                return ResultCode::InvalidOperation;
+            }
+
+            if (!ValidateTileRegion(request.m_image, request.m_region))
+            {
+                return ResultCode::InvalidArgument;
+            }
+
+            return ExpandImageTilesInternal(request);
+        }
+
+        ResultCode StreamingImagePool::TrimImageTiles(Image& image, const StreamingImageTileRegion& region)
+        {
+            if (!ValidateIsInitialized())
+            {
+                return ResultCode::InvalidOperation;
+            }
+
+            if (!ValidateTileRegion(&image, region))
+            {
+                return ResultCode::InvalidArgument;
+            }
+
+            return TrimImageTilesInternal(image, region);
+        }
+
         ResultCode StreamingImagePool::InitInternal(Device&, const StreamingImagePoolDescriptor&)
         {
             return ResultCode::Success;
@@ -224,5 +303,20 @@ namespace AZ
         {
             return false;
         }
+
+        Size StreamingImagePool::GetImageTileSizeInternal(const Image&) const
+        {
+            return Size(0, 0, 0);
+        }
+
+        ResultCode StreamingImagePool::ExpandImageTilesInternal(const StreamingImageTileExpandRequest&)
+        {
+            return ResultCode::Unimplemented;
+        }
+
+        ResultCode StreamingImagePool::TrimImageTilesInternal(Image&, const StreamingImageTileRegion&)
+        {
+            return ResultCode::Unimplemented;
+        }
     }
 }
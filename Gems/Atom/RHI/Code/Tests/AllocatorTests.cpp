@@ -7,8 +7,11 @@
  */
 
 #include "RHITestFixture.h"
+#include "ThreadTester.h"
 #include <Atom/RHI/PoolAllocator.h>
 #include <Atom/RHI/FreeListAllocator.h>
+#include <Atom/RHI/RingAllocator.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/time.h>
 #include <AzCore/UnitTest/UnitTest.h>
@@ -314,4 +317,92 @@ namespace UnitTest
         // We've now occupied the last two blocks, so we once again expect 0 fragmentation
         ASSERT_EQ(allocator.ComputeFragmentation(), 0.f);
     }
+
+    TEST_F(AllocatorTest, RingAllocator_ReclaimsAfterLatency)
+    {
+        RHI::RingAllocator::Descriptor descriptor;
+        descriptor.m_capacityInBytes = 1024;
+        descriptor.m_garbageCollectLatency = 1;
+        descriptor.m_addressBase = RHI::VirtualAddress::CreateFromOffset(1024);
+
+        RHI::RingAllocator allocator;
+        allocator.Init(descriptor);
+
+        EXPECT_EQ(allocator.Allocate(512, 256).m_ptr, 1024u);
+        EXPECT_EQ(allocator.Allocate(512, 256).m_ptr, 1536u);
+        EXPECT_TRUE(allocator.Allocate(1, 1).IsNull());
+        EXPECT_EQ(allocator.GetAllocatedByteCount(), 1024u);
+
+        // The allocations are still in use until the latency has passed
+        allocator.GarbageCollect();
+        EXPECT_TRUE(allocator.Allocate(1, 1).IsNull());
+
+        allocator.GarbageCollect();
+        EXPECT_EQ(allocator.GetAllocatedByteCount(), 0u);
+        EXPECT_EQ(allocator.Allocate(256, 256).m_ptr, 1024u);
+        EXPECT_EQ(allocator.GetAllocatedByteCount(), 256u);
+
+        allocator.GarbageCollectForce();
+        EXPECT_EQ(allocator.GetAllocatedByteCount(), 0u);
+        EXPECT_TRUE(allocator.Allocate(2048, 1).IsNull());
+        EXPECT_TRUE(allocator.Allocate(0, 1).IsNull());
+    }
+
+    TEST_F(AllocatorTest, RingAllocator_WrapsAround)
+    {
+        RHI::RingAllocator::Descriptor descriptor;
+        descriptor.m_capacityInBytes = 1024;
+        descriptor.m_garbageCollectLatency = 0;
+
+        RHI::RingAllocator allocator;
+        allocator.Init(descriptor);
+
+        EXPECT_EQ(allocator.Allocate(768, 256).m_ptr, 0u);
+        allocator.GarbageCollect();
+
+        // An allocation that doesn't fit before the end of the ring starts at the beginning
+        EXPECT_EQ(allocator.Allocate(512, 256).m_ptr, 0u);
+        EXPECT_EQ(allocator.Allocate(256, 256).m_ptr, 512u);
+        EXPECT_TRUE(allocator.Allocate(1, 1).IsNull());
+
+        allocator.GarbageCollect();
+        EXPECT_EQ(allocator.Allocate(100, 256).m_ptr, 768u);
+        EXPECT_EQ(allocator.Allocate(100, 256).m_ptr, 0u);
+    }
+
+    TEST_F(AllocatorTest, RingAllocator_ThreadedAllocations)
+    {
+        constexpr size_t AllocationSize = 64;
+        constexpr size_t AllocationCount = 4096;
+
+        RHI::RingAllocator::Descriptor descriptor;
+        descriptor.m_capacityInBytes = AllocationSize * AllocationCount;
+        descriptor.m_garbageCollectLatency = 2;
+
+        RHI::RingAllocator allocator;
+        allocator.Init(descriptor);
+
+        AZStd::mutex mutex;
+        AZStd::vector<uintptr_t> addresses;
+        ThreadTester::Dispatch(8, [&](size_t)
+        {
+            AZStd::vector<uintptr_t> threadAddresses;
+            for (RHI::VirtualAddress address = allocator.Allocate(AllocationSize, AllocationSize); address.IsValid();
+                 address = allocator.Allocate(AllocationSize, AllocationSize))
+            {
+                threadAddresses.push_back(address.m_ptr);
+            }
+
+            AZStd::scoped_lock lock(mutex);
+            addresses.insert(addresses.end(), threadAddresses.begin(), threadAddresses.end());
+        });
+
+        // Every slot of the ring was handed out exactly once
+        ASSERT_EQ(addresses.size(), AllocationCount);
+        AZStd::sort(addresses.begin(), addresses.end());
+        for (size_t index = 0; index < AllocationCount; ++index)
+        {
+            EXPECT_EQ(addresses[index], index * AllocationSize);
+        }
+    }
 }
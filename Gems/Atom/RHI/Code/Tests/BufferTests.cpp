@@ -212,6 +212,32 @@ namespace UnitTest
         }
     }
 
+    TEST_F(BufferTests, StreamBufferFromFile_NoFenceToSignal_Fails)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+
+        RHI::Ptr<RHI::BufferPool> bufferPool = RHI::Factory::Get().CreateBufferPool();
+        RHI::BufferPoolDescriptor bufferPoolDesc;
+        bufferPoolDesc.m_bindFlags = RHI::BufferBindFlags::Constant;
+        bufferPool->Init(*device, bufferPoolDesc);
+
+        RHI::Ptr<RHI::Buffer> buffer = RHI::Factory::Get().CreateBuffer();
+        RHI::BufferInitRequest initRequest;
+        initRequest.m_buffer = buffer.get();
+        initRequest.m_descriptor = RHI::BufferDescriptor(RHI::BufferBindFlags::Constant, 32);
+        bufferPool->InitBuffer(initRequest);
+
+        // The fence is the only way for the caller to know the upload completed, so it's required.
+        RHI::BufferFileStreamRequest request;
+        request.m_buffer = buffer.get();
+        request.m_byteCount = 32;
+        request.m_filePath = "buffer.bin";
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_EQ(RHI::ResultCode::InvalidArgument, bufferPool->StreamBufferFromFile(request));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
     struct BufferAndViewBindFlags
     {
         RHI::BufferBindFlags bufferBindFlags;
@@ -393,6 +393,54 @@ namespace UnitTest
             delete drawPacket;
         }
 
+        void SortDrawListLarge()
+        {
+            AZ::SimpleLcgRandom random(s_randomSeed);
+
+            // Enough items to take the radix sort path, with repeated keys and depths so the secondary order is tested.
+            RHI::DrawList unsortedList(4096);
+            for (RHI::DrawItemProperties& item : unsortedList)
+            {
+                item.m_sortKey = static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 64) - 32;
+                item.m_depth = static_cast<float>(static_cast<int32_t>(random.GetRandom() % 256) - 128) * 0.5f;
+            }
+
+            auto isKeyThenDepthSorted = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b, bool reverseDepth)
+            {
+                if (a.m_sortKey != b.m_sortKey)
+                {
+                    return a.m_sortKey < b.m_sortKey;
+                }
+                return reverseDepth ? a.m_depth >= b.m_depth : a.m_depth <= b.m_depth;
+            };
+
+            auto isDepthThenKeySorted = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b, bool reverseDepth)
+            {
+                if (a.m_depth != b.m_depth)
+                {
+                    return reverseDepth ? a.m_depth > b.m_depth : a.m_depth < b.m_depth;
+                }
+                return a.m_sortKey <= b.m_sortKey;
+            };
+
+            for (RHI::DrawListSortType sortType : { RHI::DrawListSortType::KeyThenDepth, RHI::DrawListSortType::KeyThenReverseDepth,
+                                                    RHI::DrawListSortType::DepthThenKey, RHI::DrawListSortType::ReverseDepthThenKey })
+            {
+                RHI::DrawList drawList = unsortedList;
+                SortDrawList(drawList, sortType);
+                ASSERT_EQ(drawList.size(), unsortedList.size());
+
+                const bool reverseDepth =
+                    sortType == RHI::DrawListSortType::KeyThenReverseDepth || sortType == RHI::DrawListSortType::ReverseDepthThenKey;
+                const bool keyFirst = sortType == RHI::DrawListSortType::KeyThenDepth || sortType == RHI::DrawListSortType::KeyThenReverseDepth;
+                for (size_t i = 1; i < drawList.size(); ++i)
+                {
+                    EXPECT_TRUE(keyFirst ? isKeyThenDepthSorted(drawList[i - 1], drawList[i], reverseDepth)
+                                         : isDepthThenKeySorted(drawList[i - 1], drawList[i], reverseDepth));
+                }
+            }
+        }
+
         void DrawListContextNullFilter()
         {
             AZ::SimpleLcgRandom random(s_randomSeed);
@@ -690,6 +738,11 @@ namespace UnitTest
         DrawListContextNullFilter();
     }
 
+    TEST_F(DrawPacketTest, SortDrawListLarge)
+    {
+        SortDrawListLarge();
+    }
+
     TEST_F(DrawPacketTest, DrawPacketClone)
     {
         DrawPacketClone();
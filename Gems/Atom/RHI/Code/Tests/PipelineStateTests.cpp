@@ -257,6 +257,32 @@ namespace UnitTest
         ValidateCacheIntegrity(pipelineStateCache);
     }
 
+    TEST_F(PipelineStateTests, PipelineStateCache_CompileStatistics_Test)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+        RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+
+        const RHI::PipelineStateDescriptorForDraw descriptorA = CreatePipelineStateDescriptor(0);
+        const RHI::PipelineStateDescriptorForDraw descriptorB = CreatePipelineStateDescriptor(1);
+
+        // Only the first acquire of each descriptor compiles it.
+        pipelineStateCache->AcquirePipelineState(libraryHandle, descriptorA);
+        pipelineStateCache->AcquirePipelineState(libraryHandle, descriptorA);
+        pipelineStateCache->AcquirePipelineState(libraryHandle, descriptorB);
+        pipelineStateCache->Compact();
+        pipelineStateCache->AcquirePipelineState(libraryHandle, descriptorB);
+
+        const RHI::PipelineStateCache::CompileStatistics statistics = pipelineStateCache->GetCompileStatistics();
+        EXPECT_EQ(statistics.m_compiledOnAcquireCount, 2u);
+        EXPECT_EQ(statistics.m_acquiredWhileCompilingCount, 0u);
+        EXPECT_EQ(statistics.m_precompiledCount, 0u);
+        EXPECT_EQ(pipelineStateCache->GetPendingPrecompileCount(), 0u);
+
+        pipelineStateCache->ReleaseLibrary(libraryHandle);
+        ValidateCacheIntegrity(pipelineStateCache);
+    }
+
     TEST_F(PipelineStateTests, PipelineStateCache_PipelineStateThreading_Same_Test)
     {
         RHI::Ptr<RHI::Device> device = MakeTestDevice();
@@ -621,6 +621,58 @@ namespace UnitTest
         AZ_TEST_STOP_ASSERTTEST(1);
     }
     
+    void TestConstantsCompileInterval(const RHI::ConstPtr<RHI::ShaderResourceGroupLayout>& srgLayout)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        RHI::Ptr<RHI::ShaderResourceGroup> srg = RHI::Factory::Get().CreateShaderResourceGroup();
+        srgPool->InitGroup(*srg);
+
+        const RHI::ShaderInputConstantIndex vector2index = srgLayout->FindShaderInputConstantIndex(Name("m_vector2"));
+        const RHI::ShaderInputConstantIndex vector4index = srgLayout->FindShaderInputConstantIndex(Name("m_vector4"));
+        const RHI::Interval vector2Interval = srgLayout->GetConstantsLayout()->GetInterval(vector2index);
+        const RHI::Interval vector4Interval = srgLayout->GetConstantsLayout()->GetInterval(vector4index);
+        const RHI::Interval allConstants(0, srgLayout->GetConstantDataSize());
+
+        RHI::ShaderResourceGroupData srgData(*srg);
+        EXPECT_EQ(srgData.GetConstantsUpdateInterval(), RHI::Interval());
+
+        // The update interval covers every constant that was set, and is cleared with the update mask
+        EXPECT_TRUE(srgData.SetConstant(vector4index, Vector4::CreateOne()));
+        EXPECT_EQ(srgData.GetConstantsUpdateInterval(), vector4Interval);
+        EXPECT_TRUE(srgData.SetConstant(vector2index, Vector2::CreateOne()));
+        EXPECT_EQ(srgData.GetConstantsUpdateInterval(), RHI::Interval(vector2Interval.m_min, vector4Interval.m_max));
+
+        // Every copy of the constant data is written in full the first time it is compiled
+        srg->Compile(srgData, RHI::ShaderResourceGroup::CompileMode::Sync);
+        EXPECT_EQ(srg->GetConstantsCompileInterval(), allConstants);
+
+        srgData.ResetUpdateMask();
+        EXPECT_EQ(srgData.GetConstantsUpdateInterval(), RHI::Interval());
+
+        for (uint32_t compileIndex = 1; compileIndex < RHI::Limits::Device::FrameCountMax; ++compileIndex)
+        {
+            EXPECT_TRUE(srgData.SetConstant(vector2index, Vector2::CreateZero()));
+            srg->Compile(srgData, RHI::ShaderResourceGroup::CompileMode::Sync);
+            srgData.ResetUpdateMask();
+        }
+
+        // The oldest copy still misses the first update of the vector4
+        EXPECT_EQ(srg->GetConstantsCompileInterval(), RHI::Interval(vector2Interval.m_min, vector4Interval.m_max));
+
+        EXPECT_TRUE(srgData.SetConstant(vector2index, Vector2::CreateOne()));
+        srg->Compile(srgData, RHI::ShaderResourceGroup::CompileMode::Sync);
+        EXPECT_EQ(srg->GetConstantsCompileInterval(), vector2Interval);
+
+        EXPECT_EQ(srgPool->ResetCompileStatistics().m_compiledGroupCount, RHI::Limits::Device::FrameCountMax + 1);
+        EXPECT_EQ(srgPool->ResetCompileStatistics().m_compiledGroupCount, 0);
+    }
+
     TEST_F(ShaderResourceGroupTests, TestShaderResourceGroupLayout)
     {
         TestShaderResourceGroupLayout();
@@ -697,6 +749,13 @@ namespace UnitTest
         TestGetConstantVectorsInvalidCase(srgLayout);
     }
 
+    TEST_F(ShaderResourceGroupTests, SRGConstantsCompileInterval_OnlyChangedConstants)
+    {
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+
+        TestConstantsCompileInterval(srgLayout);
+    }
+
     TEST_F(ShaderResourceGroupTests, TestShaderResourceGroupLayoutHash)
     {
         const Name imageName("m_image");
@@ -11,10 +11,12 @@ set(FILES
     Include/Atom/RHI/FreeListAllocator.h
     Include/Atom/RHI/LinearAllocator.h
     Include/Atom/RHI/PoolAllocator.h
+    Include/Atom/RHI/RingAllocator.h
     Source/RHI/Allocator.cpp
     Source/RHI/FreeListAllocator.cpp
     Source/RHI/LinearAllocator.cpp
     Source/RHI/PoolAllocator.cpp
+    Source/RHI/RingAllocator.cpp
     Include/Atom/RHI/Buffer.h
     Include/Atom/RHI/BufferView.h
     Include/Atom/RHI/IndexBufferView.h
@@ -14,6 +14,9 @@
 #include <RHI/Image.h>
 #include <RHI/Conversions.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace AZ
 {
@@ -92,6 +95,12 @@ namespace AZ
 
         void AsyncUploadQueue::Shutdown()
         {
+            // File reads queue their copy commands from the streamer thread when they complete.
+            while (m_pendingFileReads > 0)
+            {
+                AZStd::this_thread::yield();
+            }
+
             if (m_copyQueue)
             {
                 m_copyQueue->Shutdown();
@@ -103,6 +112,7 @@ namespace AZ
                 framePacket.m_fence.Shutdown();
                 framePacket.m_commandList = nullptr;
                 framePacket.m_commandAllocator = nullptr;
+                framePacket.m_fileStagingMemory.clear();
             }
             m_framePackets.clear();
             m_uploadFence.Shutdown();
@@ -202,6 +212,80 @@ namespace AZ
             return queueValue;
         }
 
+        RHI::ResultCode AsyncUploadQueue::QueueUpload(const RHI::BufferFileStreamRequest& uploadRequest)
+        {
+            AZ_PROFILE_SCOPE(RHI, "AsyncUploadQueue: QueueUpload");
+            auto& device = static_cast<Device&>(GetDevice());
+
+            Buffer& buffer = static_cast<Buffer&>(*uploadRequest.m_buffer);
+            const MemoryView& memoryView = buffer.GetMemoryView();
+            RHI::Ptr<ID3D12Resource> dx12Buffer = memoryView.GetMemory();
+            const size_t byteCount = uploadRequest.m_byteCount;
+            const size_t byteOffset = memoryView.GetOffset() + uploadRequest.m_byteOffset;
+
+            Fence& fence = static_cast<FenceImpl&>(*uploadRequest.m_fenceToSignal).Get();
+            RHI::Ptr<ID3D12Fence> dx12FenceToSignal = fence.Get();
+            const uint64_t dx12FenceToSignalValue = fence.GetPendingValue();
+
+            // The file is read into its own upload resource instead of the staging memory of the frame packets. The read
+            // can take any amount of time and this way it doesn't hold up other uploads or get split in staging sized chunks.
+            RHI::BufferDescriptor stagingDescriptor;
+            stagingDescriptor.m_byteCount = byteCount;
+            MemoryView stagingMemory = device.CreateBufferCommitted(stagingDescriptor, D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_HEAP_TYPE_UPLOAD);
+            if (!stagingMemory.IsValid())
+            {
+                AZ_Error("AsyncUploadQueue", false, "Failed to allocate %zu bytes of upload memory for buffer '%s'.",
+                    byteCount, buffer.GetName().GetCStr());
+                return RHI::ResultCode::OutOfMemory;
+            }
+            stagingMemory.GetMemory()->SetName(L"File Upload Buffer");
+            void* stagingData = stagingMemory.Map(RHI::HostMemoryAccess::Write);
+
+            auto* streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+            AZ::IO::FileRequestPtr fileRequest = streamer->Read(
+                uploadRequest.m_filePath, stagingData, byteCount, byteCount, uploadRequest.m_deadline, uploadRequest.m_priority,
+                uploadRequest.m_fileOffset);
+
+            ++m_pendingFileReads;
+            streamer->SetRequestCompleteCallback(
+                fileRequest,
+                [=, callback = uploadRequest.m_readCompleteCallback](AZ::IO::FileRequestHandle fileHandle)
+                {
+                    auto* streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+                    void* data = nullptr;
+                    u64 bytesRead = 0;
+                    const bool success = streamer->GetRequestStatus(fileHandle) == AZ::IO::IStreamerTypes::RequestStatus::Completed &&
+                        streamer->GetReadRequestResult(fileHandle, data, bytesRead) && bytesRead == byteCount;
+                    AZ_Error("AsyncUploadQueue", success, "Failed to read file '%s' for buffer upload.", uploadRequest.m_filePath.c_str());
+
+                    stagingMemory.Unmap(RHI::HostMemoryAccess::Write);
+                    if (callback)
+                    {
+                        callback(success);
+                    }
+
+                    m_copyQueue->QueueCommand([=](void* commandQueue)
+                    {
+                        AZ_PROFILE_SCOPE(RHI, "Upload Buffer From File");
+                        ID3D12CommandQueue* dx12CommandQueue = static_cast<ID3D12CommandQueue*>(commandQueue);
+
+                        // The fence is signaled on failure as well so the caller isn't left waiting.
+                        if (success)
+                        {
+                            FramePacket* framePacket = BeginFramePacket();
+                            framePacket->m_commandList->CopyBufferRegion(
+                                dx12Buffer.get(), byteOffset, stagingMemory.GetMemory(), stagingMemory.GetOffset(), byteCount);
+                            framePacket->m_fileStagingMemory.push_back(stagingMemory);
+                            EndFramePacket(dx12CommandQueue);
+                        }
+                        dx12CommandQueue->Signal(dx12FenceToSignal.get(), dx12FenceToSignalValue);
+                    });
+                    --m_pendingFileReads;
+                });
+            streamer->QueueRequest(fileRequest);
+            return RHI::ResultCode::Success;
+        }
+
         AsyncUploadQueue::FramePacket* AsyncUploadQueue::BeginFramePacket()
         {
             AZ_PROFILE_SCOPE(RHI, "AsyncUploadQueue: BeginFramePacket");
@@ -211,6 +295,7 @@ namespace AZ
             framePacket->m_fence.Wait(m_fenceEvent);
             framePacket->m_fence.Increment();
             framePacket->m_dataOffset = 0;
+            framePacket->m_fileStagingMemory.clear();
 
             AssertSuccess(framePacket->m_commandAllocator->Reset());
             AssertSuccess(framePacket->m_commandList->Reset(framePacket->m_commandAllocator.get(), nullptr));
@@ -484,6 +569,115 @@ namespace AZ
             return fenceValue;
         }
 
+        uint64_t AsyncUploadQueue::QueueUpload(const RHI::StreamingImageTileExpandRequest& request, const RHI::Origin& destinationOrigin)
+        {
+            AZ_PROFILE_SCOPE(RHI, "AsyncUploadQueue: QueueUpload");
+
+            const uint64_t fenceValue = m_uploadFence.Increment();
+
+            Image* image = static_cast<Image*>(request.m_image);
+            image->SetUploadFenceValue(fenceValue);
+
+            Memory* imageMemory = image->GetMemoryView().GetMemory();
+
+            RHI::StreamingImageTileExpandRequest cachedRequest = request;
+
+            m_copyQueue->QueueCommand([=](void* commandQueue)
+            {
+                AZ_PROFILE_SCOPE(RHI, "Upload Image Tiles");
+                ID3D12CommandQueue* dx12CommandQueue = static_cast<ID3D12CommandQueue*>(commandQueue);
+                FramePacket* framePacket = BeginFramePacket();
+
+                const RHI::ImageDescriptor& imageDescriptor = cachedRequest.m_image->GetDescriptor();
+                const RHI::ImageSubresourceLayout& subresourceLayout = cachedRequest.m_subresourceLayout;
+                const uint32_t stagingRowPitch = RHI::AlignUp(subresourceLayout.m_bytesPerRow, DX12_TEXTURE_DATA_PITCH_ALIGNMENT);
+                const uint32_t stagingSlicePitch = RHI::AlignUp(subresourceLayout.m_rowCount * stagingRowPitch, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+
+                // Tile regions are meant to be small, so their slices are not split like the ones of whole subresources.
+                if (stagingSlicePitch > m_descriptor.m_stagingSizeInBytes)
+                {
+                    AZ_Warning("RHI::DX12", false, "AsyncUploadQueue staging buffer (%zuK) is not big enough "
+                        "for the size of one slice of image's tile region (%uK). Please upload smaller regions.",
+                        m_descriptor.m_stagingSizeInBytes / 1024, stagingSlicePitch / 1024);
+                }
+                else
+                {
+                    D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint;
+                    footprint.Footprint.Width = subresourceLayout.m_size.m_width;
+                    footprint.Footprint.Height = subresourceLayout.m_size.m_height;
+                    footprint.Footprint.Depth = 1;
+                    footprint.Footprint.Format = GetBaseFormat(ConvertFormat(imageDescriptor.m_format));
+                    footprint.Footprint.RowPitch = stagingRowPitch;
+
+                    const uint32_t subresourceIdx = D3D12CalcSubresource(
+                        cachedRequest.m_region.m_mipLevel, cachedRequest.m_region.m_arraySlice, 0, imageDescriptor.m_mipLevels, imageDescriptor.m_arraySize);
+                    CD3DX12_TEXTURE_COPY_LOCATION destLocation(imageMemory, subresourceIdx);
+
+                    for (uint32_t depth = 0; depth < subresourceLayout.m_size.m_depth; depth++)
+                    {
+                        // If the current framePacket is not big enough, switch to next one.
+                        if (stagingSlicePitch > m_descriptor.m_stagingSizeInBytes - framePacket->m_dataOffset)
+                        {
+                            EndFramePacket(dx12CommandQueue);
+                            framePacket = BeginFramePacket();
+                        }
+
+                        // Copy region data to staging memory.
+                        {
+                            AZ_PROFILE_SCOPE(RHI, "Copy CPU image");
+
+                            uint8_t* stagingDataStart = framePacket->m_stagingResourceData + framePacket->m_dataOffset;
+                            const uint8_t* sliceDataStart = static_cast<const uint8_t*>(cachedRequest.m_data.m_data) + (depth * subresourceLayout.m_bytesPerImage);
+
+                            for (uint32_t row = 0; row < subresourceLayout.m_rowCount; row++)
+                            {
+                                memcpy(stagingDataStart + row * stagingRowPitch,
+                                    sliceDataStart + row * subresourceLayout.m_bytesPerRow,
+                                    subresourceLayout.m_bytesPerRow);
+                            }
+                        }
+
+                        footprint.Offset = framePacket->m_dataOffset;
+                        CD3DX12_TEXTURE_COPY_LOCATION sourceLocation(framePacket->m_stagingResource.get(), footprint);
+
+                        framePacket->m_commandList->CopyTextureRegion(
+                            &destLocation,
+                            destinationOrigin.m_left, destinationOrigin.m_top, destinationOrigin.m_front + depth,
+                            &sourceLocation,
+                            nullptr);
+
+                        framePacket->m_dataOffset += stagingSlicePitch;
+                    }
+                }
+
+                EndFramePacket(dx12CommandQueue);
+
+                dx12CommandQueue->Signal(m_uploadFence.Get(), fenceValue);
+
+                if (cachedRequest.m_completeCallback && !cachedRequest.m_waitForUpload)
+                {
+                    {
+                        AZStd::lock_guard<AZStd::mutex> lock(m_callbackMutex);
+                        AZ_Assert(m_callbacks.empty() || m_callbacks.back().second < fenceValue, "Callbacks should be added with increasing order of fenceValue");
+                        m_callbacks.push({ cachedRequest.m_completeCallback, fenceValue });
+                    }
+                    AZ::SystemTickBus::QueueFunction([this] { ProcessCallbacks(uint64_t(-1)); });
+                }
+
+                return 0;
+            });
+
+            if (request.m_waitForUpload)
+            {
+                m_uploadFence.Wait(m_uploadFenceEvent, fenceValue);
+                if (request.m_completeCallback)
+                {
+                    request.m_completeCallback();
+                }
+            }
+            return fenceValue;
+        }
+
         bool AsyncUploadQueue::IsUploadFinished(uint64_t fenceValue)
         {
             return m_uploadFence.GetCompletedValue() >= fenceValue;
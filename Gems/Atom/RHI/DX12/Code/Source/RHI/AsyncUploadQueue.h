@@ -8,10 +8,12 @@
 #pragma once
 
 #include <RHI/CommandQueue.h>
+#include <RHI/MemoryView.h>
 
 #include <Atom/RHI/BufferPool.h>
 #include <Atom/RHI/StreamingImagePool.h>
 #include <AzCore/std/containers/span.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
@@ -48,10 +50,19 @@ namespace AZ
             // @return queue id which can be use to check whether upload finished or wait for upload finish
             uint64_t QueueUpload(const RHI::BufferStreamRequest& request);
 
+            // Queue a file read straight into a dedicated upload resource, followed by the copy commands to upload it to the
+            // buffer resource once the read completes. The fence of the request is signaled after the copy.
+            RHI::ResultCode QueueUpload(const RHI::BufferFileStreamRequest& request);
+
             // Queue copy commands to upload image subresources.
             // @param residentMip is the resident mip level the expand request starts from. 
             // @return queue id which can be use to check whether upload finished or wait for upload finish
             uint64_t QueueUpload(const RHI::StreamingImageExpandRequest& request, uint32_t residentMip);
+
+            // Queue copy commands to upload a region of tiles of an image subresource. The tiles need to be mapped first.
+            // @param destinationOrigin is the texel origin of the region in the subresource.
+            // @return queue id which can be use to check whether upload finished or wait for upload finish
+            uint64_t QueueUpload(const RHI::StreamingImageTileExpandRequest& request, const RHI::Origin& destinationOrigin);
             
             // Queue tile mapping to map tiles from allocate heap for reserved resource. This is usually required before upload data to 
             // reserved resource in this copy queue
@@ -81,6 +92,9 @@ namespace AZ
                 // (Advanced Usage Mode in ID3D12Resource::Map api document)
                 uint8_t* m_stagingResourceData = nullptr; 
                 uint32_t m_dataOffset = 0;
+
+                // Upload resources that files were read into, released once the packet's copy commands completed.
+                AZStd::vector<MemoryView> m_fileStagingMemory;
             };
             
             // Begin the frame packet which m_frameIndex point to and get ready to start recording copy command by using this frame packet 
@@ -101,6 +115,9 @@ namespace AZ
             // pending upload callbacks and their corresponding fence values
             AZStd::queue<AZStd::pair<AZStd::function<void()>, uint64_t>> m_callbacks;
             AZStd::mutex m_callbackMutex;
+
+            // Number of file reads that haven't queued their copy commands yet.
+            AZStd::atomic<uint32_t> m_pendingFileReads{ 0 };
         };
     }
 }
@@ -357,6 +357,15 @@ namespace AZ
             return RHI::ResultCode::Success;
         }
 
+        RHI::ResultCode BufferPool::StreamBufferFromFileInternal(const RHI::BufferFileStreamRequest& request)
+        {
+            if (GetDescriptor().m_heapMemoryLevel == RHI::HeapMemoryLevel::Host)
+            {
+                return StreamBufferFromFileToHostMemory(request);
+            }
+            return GetDevice().GetAsyncUploadQueue().QueueUpload(request);
+        }
+
         void BufferPool::ComputeFragmentation() const
         {
             float fragmentation = m_allocator.ComputeFragmentation();
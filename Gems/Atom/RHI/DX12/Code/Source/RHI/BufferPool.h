@@ -52,6 +52,7 @@ namespace AZ
             RHI::ResultCode MapBufferInternal(const RHI::BufferMapRequest& mapRequest, RHI::BufferMapResponse& response) override;
             void UnmapBufferInternal(RHI::Buffer& buffer) override;
             RHI::ResultCode StreamBufferInternal(const RHI::BufferStreamRequest& request) override;
+            RHI::ResultCode StreamBufferFromFileInternal(const RHI::BufferFileStreamRequest& request) override;
             void ComputeFragmentation() const override;
             //////////////////////////////////////////////////////////////////////////
 
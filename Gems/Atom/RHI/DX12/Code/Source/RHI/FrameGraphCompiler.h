@@ -43,6 +43,7 @@ namespace AZ
             RHI::ResultCode InitInternal(RHI::Device& device) override;
             void ShutdownInternal() override;
             RHI::MessageOutcome CompileInternal(const RHI::FrameGraphCompileRequest& request) override;
+            bool IsParallelScopeCompileSupported() const override { return true; }
             //////////////////////////////////////////////////////////////////////////
 
             static D3D12_RESOURCE_STATES GetResourceState(const RHI::ScopeAttachment& scopeAttachment);
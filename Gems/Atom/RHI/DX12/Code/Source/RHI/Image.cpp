@@ -62,6 +62,7 @@ namespace AZ
                         tileCount += heapTiles.m_totalTileCount;
                     }
                 }
+                tileCount += static_cast<uint32_t>(m_regionTiles.size());
 
                 m_residentSizeInBytes = tileCount * sizePerTile;
             }
@@ -170,6 +170,10 @@ namespace AZ
             // Note: the tiles allocated for each subresource may come from multiple heap pages 
             AZStd::unordered_map<uint32_t, AZStd::vector<HeapTiles>> m_heapTiles;
 
+            // The heap tile of each tile made resident by StreamingImagePool::ExpandImageTiles, in mips which are not resident.
+            // The key packs the subresource index and the coordinate of the tile in the subresource.
+            AZStd::unordered_map<uint64_t, HeapTiles> m_regionTiles;
+
             // Tracking the actual mip level data uploaded. It's also used for invalidate image view. 
             uint32_t m_streamedMipLevel = 0;
 
@@ -30,9 +30,11 @@ namespace AZ
             Device& device = static_cast<Device&>(deviceBase);
             ID3D12DeviceX* dx12Device = device.GetDevice();
 
-            // advance to the next buffer
+            // advance to the next buffer, the previous one is the source of a refit
+            const TlasBuffers& previousBuffers = m_buffers[m_currentBufferIndex];
             m_currentBufferIndex = (m_currentBufferIndex + 1) % BufferCount;
             TlasBuffers& buffers = m_buffers[m_currentBufferIndex];
+            m_sourceTlasGpuAddress = 0;
 
             const RHI::RayTracingTlasInstanceVector& instances = descriptor->GetInstances();
             if (instances.empty())
@@ -41,6 +43,7 @@ namespace AZ
                 buffers.m_tlasBuffer = nullptr;
                 buffers.m_tlasInstancesBuffer = nullptr;
                 buffers.m_scratchBuffer = nullptr;
+                buffers.m_instanceCount = 0;
                 return RHI::ResultCode::Success;
             }
             
@@ -109,10 +112,19 @@ namespace AZ
             m_inputs.InstanceDescs = tlasInstancesGpuAddress;
             m_inputs.DescsLayout = D3D12_ELEMENTS_LAYOUT_ARRAY;
             m_inputs.NumDescs = static_cast<UINT>(numInstances);
-            m_inputs.Flags = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE;
+            m_inputs.Flags = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE |
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE;
             
             D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO prebuildInfo = {};
             dx12Device->GetRaytracingAccelerationStructurePrebuildInfo(&m_inputs, &prebuildInfo);
+
+            // update the previous TLAS into the new buffer if only the instance transforms changed
+            if (descriptor->IsRefit() && previousBuffers.m_tlasBuffer && previousBuffers.m_instanceCount == numInstances)
+            {
+                m_inputs.Flags |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PERFORM_UPDATE;
+                m_sourceTlasGpuAddress = static_cast<Buffer*>(previousBuffers.m_tlasBuffer.get())->GetMemoryView().GetGpuAddress();
+            }
+            buffers.m_instanceCount = numInstances;
             
             prebuildInfo.ScratchDataSizeInBytes = RHI::AlignUp(prebuildInfo.ScratchDataSizeInBytes, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT);
             prebuildInfo.ResultDataMaxSizeInBytes = RHI::AlignUp(prebuildInfo.ResultDataMaxSizeInBytes, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT);
@@ -32,10 +32,14 @@ namespace AZ
                 RHI::Ptr<RHI::Buffer> m_tlasBuffer;
                 RHI::Ptr<RHI::Buffer> m_scratchBuffer;
                 RHI::Ptr<RHI::Buffer> m_tlasInstancesBuffer;
+                uint32_t m_instanceCount = 0;
             };
 
 #ifdef AZ_DX12_DXR_SUPPORT
             const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& GetInputs() const { return m_inputs; }
+
+            //! Returns the address of the TLAS to update when the inputs perform an update, or 0 for a full build
+            D3D12_GPU_VIRTUAL_ADDRESS GetSourceTlasGpuAddress() const { return m_sourceTlasGpuAddress; }
 #endif
             const TlasBuffers& GetBuffers() const { return m_buffers[m_currentBufferIndex]; }
 
@@ -51,6 +55,7 @@ namespace AZ
 
 #ifdef AZ_DX12_DXR_SUPPORT
             D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS m_inputs;
+            D3D12_GPU_VIRTUAL_ADDRESS m_sourceTlasGpuAddress = 0;
 #endif
 
             // buffer list to keep buffers alive for several frames
@@ -207,7 +207,18 @@ namespace AZ
             
             if (m_constantBufferSize && groupBase.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceMask::ConstantDataMask)))
             {
-                memcpy(group.GetCompiledData().m_cpuConstantAddress, groupData.GetConstantData().data(), groupData.GetConstantData().size());
+                // Only the constants that changed since this copy of the constant buffer was last compiled are written to it
+                const AZStd::span<const uint8_t> constantData = groupData.GetConstantData();
+                const RHI::Interval interval = groupBase.GetConstantsCompileInterval();
+                const size_t byteMax = AZStd::min<size_t>(interval.m_max, constantData.size());
+                if (interval.m_min < byteMax)
+                {
+                    memcpy(
+                        group.GetCompiledData().m_cpuConstantAddress + interval.m_min,
+                        constantData.data() + interval.m_min,
+                        byteMax - interval.m_min);
+                    AddConstantBytesUploaded(byteMax - interval.m_min);
+                }
             }
 
             if (m_viewsDescriptorTableSize)
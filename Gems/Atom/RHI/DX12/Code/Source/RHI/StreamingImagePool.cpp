@@ -29,6 +29,27 @@ namespace AZ
         {
             const static uint32_t TileSizeInBytes = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
             const static uint32_t TileCountPerPage = 256;
+
+            // Region tiles are keyed by the subresource index and the tile coordinate in the subresource.
+            uint64_t GetRegionTileKey(uint32_t subresourceIndex, uint32_t x, uint32_t y, uint32_t z)
+            {
+                return (static_cast<uint64_t>(subresourceIndex) << 48) | (static_cast<uint64_t>(z) << 32) |
+                    (static_cast<uint64_t>(y) << 16) | static_cast<uint64_t>(x);
+            }
+
+            uint32_t GetRegionTileSubresourceIndex(uint64_t tileKey)
+            {
+                return static_cast<uint32_t>(tileKey >> 48);
+            }
+
+            D3D12_TILED_RESOURCE_COORDINATE GetRegionTileCoordinate(uint64_t tileKey)
+            {
+                return CD3DX12_TILED_RESOURCE_COORDINATE(
+                    static_cast<uint32_t>(tileKey & 0xFFFF),
+                    static_cast<uint32_t>((tileKey >> 16) & 0xFFFF),
+                    static_cast<uint32_t>((tileKey >> 32) & 0xFFFF),
+                    GetRegionTileSubresourceIndex(tileKey));
+            }
         }
 
         // The StreamingImagePoolResolver adds streaming image transition barriers when scope starts
@@ -211,35 +232,10 @@ namespace AZ
             uint32_t totalTiles = request.m_sourceRegionSize.NumTiles;
 
             // Check if heap memory is enough for the tiles. 
-            RHI::HeapMemoryUsage& memoryAllocatorUsage = GetDeviceHeapMemoryUsage();
-            size_t pageAllocationInBytes = m_tileAllocator.EvaluateMemoryAllocation(totalTiles);
-
-            // Try to release some memory if there isn't enough memory available in the pool
-            bool canAllocate = memoryAllocatorUsage.CanAllocate(pageAllocationInBytes);
-            if (!canAllocate && m_memoryReleaseCallback)
+            if (!ReleaseMemoryForTiles(totalTiles) && m_memoryReleaseCallback)
             {
-                bool releaseSuccess = false;
-                while (!canAllocate)
-                {
-                    // Request to release some memory
-                    releaseSuccess = m_memoryReleaseCallback();
-
-                    // break out of the loop if memory release did not happen
-                    if (!releaseSuccess)
-                    {
-                        break;
-                    }
-
-                    // re-evaluation page memory allocation since there are tiles were released.
-                    pageAllocationInBytes = m_tileAllocator.EvaluateMemoryAllocation(totalTiles);
-                    canAllocate = memoryAllocatorUsage.CanAllocate(pageAllocationInBytes);
-                }
-
-                if (!releaseSuccess)
-                {
-                    AZ_Warning("DX12::StreamingImagePool", false, "There isn't enough memory to allocate the image subresource. "
-                        "Using the default tile for the subresource. Try increase the StreamingImagePool memory budget");
-                }
+                AZ_Warning("DX12::StreamingImagePool", false, "There isn't enough memory to allocate the image subresource. "
+                    "Using the default tile for the subresource. Try increase the StreamingImagePool memory budget");
             }
 
             image.m_heapTiles[subresourceIndex] = m_tileAllocator.Allocate(totalTiles);
@@ -336,6 +332,37 @@ namespace AZ
             }
         }
 
+        bool StreamingImagePool::ReleaseMemoryForTiles(uint32_t tileCount)
+        {
+            RHI::HeapMemoryUsage& memoryAllocatorUsage = GetDeviceHeapMemoryUsage();
+            size_t pageAllocationInBytes = m_tileAllocator.EvaluateMemoryAllocation(tileCount);
+
+            // Try to release some memory if there isn't enough memory available in the pool
+            bool canAllocate = memoryAllocatorUsage.CanAllocate(pageAllocationInBytes);
+            while (!canAllocate && m_memoryReleaseCallback)
+            {
+                // break out of the loop if memory release did not happen
+                if (!m_memoryReleaseCallback())
+                {
+                    break;
+                }
+
+                // re-evaluation page memory allocation since there are tiles were released.
+                pageAllocationInBytes = m_tileAllocator.EvaluateMemoryAllocation(tileCount);
+                canAllocate = memoryAllocatorUsage.CanAllocate(pageAllocationInBytes);
+            }
+            return canAllocate;
+        }
+
+        void StreamingImagePool::QueueWaitForLastFrame()
+        {
+            // add wait frame fence to async upload queue before queue tile mapping
+            CommandQueueContext& context = GetDevice().GetCommandQueueContext();
+            const FenceSet& compiledFences = context.GetFrameFences(context.GetLastFrameIndex());
+            const Fence& fence = compiledFences.GetFence(RHI::HardwareQueueClass::Graphics);
+            GetDevice().GetAsyncUploadQueue().QueueWaitFence(fence, fence.GetPendingValue());
+        }
+
         void StreamingImagePool::DeAllocateImageTilesInternal(Image& image, uint32_t subresourceIndex)
         {
             const AZStd::vector<HeapTiles>& heapTilesList = image.m_heapTiles[subresourceIndex];
@@ -417,12 +444,7 @@ namespace AZ
             // Only proceed if the interval is still valid.
             if (mipInterval.m_min < mipInterval.m_max)
             {
-                // add wait frame fence to async upload queue before queue tile mapping
-                auto& device = static_cast<Device&>(GetDevice());
-                CommandQueueContext& context = device.GetCommandQueueContext();
-                const FenceSet &compiledFences = context.GetFrameFences(context.GetLastFrameIndex());
-                const Fence& fence = compiledFences.GetFence(RHI::HardwareQueueClass::Graphics);
-                GetDevice().GetAsyncUploadQueue().QueueWaitFence(fence, fence.GetPendingValue());
+                QueueWaitForLastFrame();
 
                 AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
                 for (uint32_t arrayIndex = 0; arrayIndex < descriptor.m_arraySize; ++arrayIndex)
@@ -436,6 +458,108 @@ namespace AZ
             }
         }
 
+        bool StreamingImagePool::AllocateRegionTilesInternal(Image& image, const RHI::StreamingImageTileRegion& region)
+        {
+            const uint32_t subresourceIndex = RHI::GetImageSubresourceIndex(region.m_mipLevel, region.m_arraySlice, image.GetDescriptor().m_mipLevels);
+
+            CommandList::TileMapRequest request;
+            request.m_sourceMemory = image.GetMemoryView().GetMemory();
+            request.m_sourceRegionSize = CD3DX12_TILE_REGION_SIZE(1, FALSE, 0, 0, 0);
+            request.m_rangeFlags.resize(1, D3D12_TILE_RANGE_FLAG_NONE);
+            request.m_rangeStartOffsets.resize(1);
+            request.m_rangeTileCounts.resize(1, 1);
+
+            for (uint32_t z = region.m_tileOrigin.m_front; z < region.m_tileOrigin.m_front + region.m_tileCount.m_depth; ++z)
+            {
+                for (uint32_t y = region.m_tileOrigin.m_top; y < region.m_tileOrigin.m_top + region.m_tileCount.m_height; ++y)
+                {
+                    for (uint32_t x = region.m_tileOrigin.m_left; x < region.m_tileOrigin.m_left + region.m_tileCount.m_width; ++x)
+                    {
+                        const uint64_t tileKey = GetRegionTileKey(subresourceIndex, x, y, z);
+                        if (image.m_regionTiles.contains(tileKey))
+                        {
+                            continue;
+                        }
+
+                        // Unlike whole subresources, region tiles don't fall back to the default tile, the caller keeps using the
+                        // resident mip instead.
+                        if (!ReleaseMemoryForTiles(1))
+                        {
+                            return false;
+                        }
+
+                        AZStd::vector<HeapTiles> heapTiles = m_tileAllocator.Allocate(1);
+                        if (heapTiles.empty())
+                        {
+                            return false;
+                        }
+
+                        request.m_sourceCoordinate = CD3DX12_TILED_RESOURCE_COORDINATE(x, y, z, subresourceIndex);
+                        request.m_destinationHeap = heapTiles[0].m_heap.get();
+                        request.m_rangeStartOffsets[0] = heapTiles[0].m_tileSpanList[0].m_offset;
+                        GetDevice().GetAsyncUploadQueue().QueueTileMapping(request);
+
+                        image.m_regionTiles.emplace(tileKey, heapTiles[0]);
+                    }
+                }
+            }
+            return true;
+        }
+
+        void StreamingImagePool::DeAllocateRegionTilesInternal(Image& image, const AZStd::vector<uint64_t>& tileKeys)
+        {
+            // map the tiles to NULL
+            CommandList::TileMapRequest request;
+            request.m_sourceMemory = image.GetMemoryView().GetMemory();
+            request.m_sourceRegionSize = CD3DX12_TILE_REGION_SIZE(1, FALSE, 0, 0, 0);
+
+            AZStd::vector<HeapTiles> heapTilesList;
+            heapTilesList.reserve(tileKeys.size());
+            for (uint64_t tileKey : tileKeys)
+            {
+                auto tileIt = image.m_regionTiles.find(tileKey);
+                if (tileIt == image.m_regionTiles.end())
+                {
+                    continue;
+                }
+
+                request.m_sourceCoordinate = GetRegionTileCoordinate(tileKey);
+                GetDevice().GetAsyncUploadQueue().QueueTileMapping(request);
+
+                heapTilesList.push_back(tileIt->second);
+                image.m_regionTiles.erase(tileIt);
+            }
+
+            if (!heapTilesList.empty())
+            {
+                m_tileAllocator.DeAllocate(heapTilesList);
+                m_tileAllocator.GarbageCollect();
+            }
+        }
+
+        void StreamingImagePool::DeAllocateRegionTiles(Image& image, RHI::Interval mipInterval)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+            if (image.m_regionTiles.empty())
+            {
+                return;
+            }
+
+            const uint32_t mipLevels = image.GetDescriptor().m_mipLevels;
+            AZStd::vector<uint64_t> tileKeys;
+            for (const auto& regionTile : image.m_regionTiles)
+            {
+                const uint32_t mipIndex = GetRegionTileSubresourceIndex(regionTile.first) % mipLevels;
+                if (mipIndex >= mipInterval.m_min && mipIndex < mipInterval.m_max)
+                {
+                    tileKeys.push_back(regionTile.first);
+                }
+            }
+
+            // The mips are mapped again right after, and they aren't sampled before their upload completes.
+            DeAllocateRegionTilesInternal(image, tileKeys);
+        }
+
         bool StreamingImagePool::ShouldUseTileHeap(const RHI::ImageDescriptor& imageDescriptor) const
         {
             if (m_enableTileResource)
@@ -593,9 +717,14 @@ namespace AZ
                 {
                     m_tileAllocator.DeAllocate(heapTiles.second);
                 }
+                for (const auto& regionTile : image.m_regionTiles)
+                {
+                    m_tileAllocator.DeAllocate(AZStd::vector<HeapTiles>{ regionTile.second });
+                }
                 m_tileAllocator.GarbageCollect();
                 m_tileMutex.unlock();
                 image.m_heapTiles.clear();
+                image.m_regionTiles.clear();
                 image.m_tileLayout = ImageTileLayout();
             }
             else
@@ -620,6 +749,7 @@ namespace AZ
 
             if (image.IsTiled())
             {
+                DeAllocateRegionTiles(image, RHI::Interval{ residentMipLevelAfter, residentMipLevelBefore });
                 AllocateStandardImageTiles(image, RHI::Interval{ residentMipLevelAfter, residentMipLevelBefore });
             }
 
@@ -712,6 +842,80 @@ namespace AZ
         {
             return m_enableTileResource;
         }
+
+        RHI::Size StreamingImagePool::GetImageTileSizeInternal(const RHI::Image& imageBase) const
+        {
+            const Image& image = static_cast<const Image&>(imageBase);
+            return image.IsTiled() ? image.m_tileLayout.m_tileSize : RHI::Size(0, 0, 0);
+        }
+
+        RHI::ResultCode StreamingImagePool::ExpandImageTilesInternal(const RHI::StreamingImageTileExpandRequest& request)
+        {
+            Image& image = static_cast<Image&>(*request.m_image);
+            const RHI::StreamingImageTileRegion& region = request.m_region;
+
+            // Packed mips don't have individual tiles, they are always resident.
+            if (!image.IsTiled() || region.m_mipLevel >= image.m_tileLayout.m_mipCountStandard)
+            {
+                AZ_Error("DX12::StreamingImagePool", false, "Tiles can only be made resident for the standard mips of a tiled image");
+                return RHI::ResultCode::InvalidArgument;
+            }
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+                const bool allocated = AllocateRegionTilesInternal(image, region);
+                image.UpdateResidentTilesSizeInBytes(TileSizeInBytes);
+                if (!allocated)
+                {
+                    // The tiles allocated so far stay resident, they are released with the region.
+                    AZ_Warning("DX12::StreamingImagePool", false, "There isn't enough memory to make the tiles of image '%s' resident. "
+                        "Try increase the StreamingImagePool memory budget", image.GetName().GetCStr());
+                    return RHI::ResultCode::OutOfMemory;
+                }
+            }
+
+            const RHI::Size& tileSize = image.m_tileLayout.m_tileSize;
+            const RHI::Origin destinationOrigin(
+                region.m_tileOrigin.m_left * tileSize.m_width,
+                region.m_tileOrigin.m_top * tileSize.m_height,
+                region.m_tileOrigin.m_front * tileSize.m_depth);
+            GetDevice().GetAsyncUploadQueue().QueueUpload(request, destinationOrigin);
+
+            return RHI::ResultCode::Success;
+        }
+
+        RHI::ResultCode StreamingImagePool::TrimImageTilesInternal(RHI::Image& imageBase, const RHI::StreamingImageTileRegion& region)
+        {
+            Image& image = static_cast<Image&>(imageBase);
+            if (!image.IsTiled())
+            {
+                return RHI::ResultCode::InvalidArgument;
+            }
+
+            // Wait for any upload of this image done. 
+            GetDevice().GetAsyncUploadQueue().WaitForUpload(image.GetUploadFenceValue());
+            QueueWaitForLastFrame();
+
+            const uint32_t subresourceIndex = RHI::GetImageSubresourceIndex(region.m_mipLevel, region.m_arraySlice, image.GetDescriptor().m_mipLevels);
+            AZStd::vector<uint64_t> tileKeys;
+            tileKeys.reserve(region.m_tileCount.m_width * region.m_tileCount.m_height * region.m_tileCount.m_depth);
+            for (uint32_t z = region.m_tileOrigin.m_front; z < region.m_tileOrigin.m_front + region.m_tileCount.m_depth; ++z)
+            {
+                for (uint32_t y = region.m_tileOrigin.m_top; y < region.m_tileOrigin.m_top + region.m_tileCount.m_height; ++y)
+                {
+                    for (uint32_t x = region.m_tileOrigin.m_left; x < region.m_tileOrigin.m_left + region.m_tileCount.m_width; ++x)
+                    {
+                        tileKeys.push_back(GetRegionTileKey(subresourceIndex, x, y, z));
+                    }
+                }
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+            DeAllocateRegionTilesInternal(image, tileKeys);
+            image.UpdateResidentTilesSizeInBytes(TileSizeInBytes);
+
+            return RHI::ResultCode::Success;
+        }
     }
 }
 
@@ -46,6 +46,9 @@ namespace AZ
             RHI::ResultCode TrimImageInternal(RHI::Image& image, uint32_t targetMipLevel) override;
             RHI::ResultCode SetMemoryBudgetInternal(size_t newBudget) override;
             bool SupportTiledImageInternal() const override;
+            RHI::Size GetImageTileSizeInternal(const RHI::Image& image) const override;
+            RHI::ResultCode ExpandImageTilesInternal(const RHI::StreamingImageTileExpandRequest& request) override;
+            RHI::ResultCode TrimImageTilesInternal(RHI::Image& image, const RHI::StreamingImageTileRegion& region) override;
             //////////////////////////////////////////////////////////////////////////
 
             //////////////////////////////////////////////////////////////////////////
@@ -74,6 +77,21 @@ namespace AZ
             // Packed mips occupy a dedicated set of tiles.
             void AllocatePackedImageTiles(Image& image);
 
+            // Allocate and map one heap tile for each tile of the region which isn't resident yet.
+            // Returns false if there wasn't enough memory for all the tiles.
+            bool AllocateRegionTilesInternal(Image& image, const RHI::StreamingImageTileRegion& region);
+            // Deallocate and unmap the heap tiles of the region tiles with the keys.
+            void DeAllocateRegionTilesInternal(Image& image, const AZStd::vector<uint64_t>& tileKeys);
+            // Deallocate the region tiles of the mips, before the mips become fully resident.
+            void DeAllocateRegionTiles(Image& image, RHI::Interval mipInterval);
+
+            // Release memory with the memory release callback until the tiles fit in the budget.
+            // Returns whether the tiles fit.
+            bool ReleaseMemoryForTiles(uint32_t tileCount);
+
+            // Make the async upload queue wait for the last frame, so the tiles it used can be unmapped.
+            void QueueWaitForLastFrame();
+
             // Get the data reference of device heap memory usage 
             RHI::HeapMemoryUsage& GetDeviceHeapMemoryUsage();
 
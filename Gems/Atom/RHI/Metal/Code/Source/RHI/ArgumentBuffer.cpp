@@ -345,12 +345,12 @@ namespace AZ
             }
         }
 
-        void ArgumentBuffer::UpdateConstantBufferViews(AZStd::span<const uint8_t> rawData)
+        void ArgumentBuffer::UpdateConstantBufferViews(AZStd::span<const uint8_t> rawData, uint32_t byteOffset)
         {
-            AZ_Assert(rawData.size() <= m_constantBufferSize, "rawData size can not be bigger than constant Buffer Size");
-            if ( (m_constantBufferSize > 0) && (rawData.size() <= m_constantBufferSize))
+            AZ_Assert(byteOffset + rawData.size() <= m_constantBufferSize, "rawData size can not be bigger than constant Buffer Size");
+            if ( (m_constantBufferSize > 0) && (byteOffset + rawData.size() <= m_constantBufferSize))
             {
-                memcpy(m_constantBuffer.GetCpuAddress(), rawData.data(), rawData.size());
+                memcpy(static_cast<uint8_t*>(m_constantBuffer.GetCpuAddress()) + byteOffset, rawData.data(), rawData.size());
             }
         }
 
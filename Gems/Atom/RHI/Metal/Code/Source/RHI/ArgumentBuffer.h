@@ -104,7 +104,8 @@ namespace AZ
             void UpdateBufferViews(const RHI::ShaderInputBufferDescriptor& shaderInputBuffer,
                                    const AZStd::span<const RHI::ConstPtr<RHI::BufferView>>& bufferViews);
 
-            void UpdateConstantBufferViews(AZStd::span<const uint8_t> rawData);
+            //! Writes the bytes to the constant buffer, starting at the byte offset.
+            void UpdateConstantBufferViews(AZStd::span<const uint8_t> rawData, uint32_t byteOffset = 0);
 
             //! Return the native MTLBuffer that holds SRG data
             id<MTLBuffer> GetArgEncoderBuffer() const;
@@ -42,6 +42,7 @@ namespace AZ
             RHI::ResultCode MapBufferInternal([[maybe_unused]] const RHI::BufferMapRequest& mapRequest, [[maybe_unused]] RHI::BufferMapResponse& response) override { return RHI::ResultCode::Success;}
             void UnmapBufferInternal([[maybe_unused]] RHI::Buffer& buffer) override {}
             RHI::ResultCode StreamBufferInternal([[maybe_unused]] const RHI::BufferStreamRequest& request) override { return RHI::ResultCode::Success;}
+            RHI::ResultCode StreamBufferFromFileInternal([[maybe_unused]] const RHI::BufferFileStreamRequest& request) override { return RHI::ResultCode::Success;}
             void BufferCopy([[maybe_unused]] void* destination, [[maybe_unused]] const void* source, [[maybe_unused]] size_t num) override {}
             void ComputeFragmentation() const override {}
             //////////////////////////////////////////////////////////////////////////
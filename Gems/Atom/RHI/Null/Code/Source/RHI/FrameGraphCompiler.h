@@ -31,6 +31,7 @@ namespace AZ
             RHI::ResultCode InitInternal([[maybe_unused]] RHI::Device& device) override { return RHI::ResultCode::Success;}
             void ShutdownInternal() override {}
             RHI::MessageOutcome CompileInternal([[maybe_unused]] const RHI::FrameGraphCompileRequest& request) override { return AZ::Success();}
+            bool IsParallelScopeCompileSupported() const override { return true; }
             //////////////////////////////////////////////////////////////////////////
         };
     }
@@ -11,6 +11,9 @@
 #include <Atom/RHI/StreamingImagePool.h>
 #include <Atom/RHI.Reflect/ImageSubresource.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/containers/vector.h>
 #include <RHI/AsyncUploadQueue.h>
 #include <RHI/Buffer.h>
@@ -53,6 +56,12 @@ namespace AZ
 
         void AsyncUploadQueue::Shutdown()
         {
+            // File reads queue their upload commands from the streamer thread when they complete.
+            while (m_pendingFileReads > 0)
+            {
+                AZStd::this_thread::yield();
+            }
+
             m_asyncWaitQueue.ShutDown();
             m_callbackList.clear();
         }
@@ -166,6 +175,109 @@ namespace AZ
             return handle;
         }
 
+        RHI::AsyncWorkHandle AsyncUploadQueue::QueueUpload(const RHI::BufferFileStreamRequest& request)
+        {
+            AZ_PROFILE_SCOPE(RHI, "AsyncUploadQueue: QueueUpload");
+            auto& device = static_cast<Device&>(GetDevice());
+
+            const size_t byteCount = request.m_byteCount;
+            const size_t byteOffset = request.m_byteOffset;
+            RHI::Ptr<Buffer> buffer = static_cast<Buffer*>(request.m_buffer);
+            RHI::Ptr<Fence> fenceToSignal = static_cast<Fence*>(request.m_fenceToSignal);
+
+            // The file is read into its own staging buffer instead of the staging buffers of the frame packets. The read
+            // can take any amount of time and this way it doesn't hold up other uploads or get split in staging sized chunks.
+            RHI::Ptr<Buffer> stagingBuffer = device.AcquireStagingBuffer(byteCount);
+            if (!stagingBuffer)
+            {
+                return RHI::AsyncWorkHandle::Null;
+            }
+            void* stagingData = stagingBuffer->GetBufferMemoryView()->Map(RHI::HostMemoryAccess::Write);
+
+            RHI::Ptr<Fence> uploadFence = Fence::Create();
+            uploadFence->Init(device, RHI::FenceState::Reset);
+
+            auto* streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+            AZ::IO::FileRequestPtr fileRequest = streamer->Read(
+                request.m_filePath, stagingData, byteCount, byteCount, request.m_deadline, request.m_priority, request.m_fileOffset);
+
+            ++m_pendingFileReads;
+            streamer->SetRequestCompleteCallback(
+                fileRequest,
+                [=, &device, filePath = request.m_filePath, callback = request.m_readCompleteCallback](AZ::IO::FileRequestHandle fileHandle)
+                {
+                    auto* streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+                    void* data = nullptr;
+                    u64 bytesRead = 0;
+                    const bool success = streamer->GetRequestStatus(fileHandle) == AZ::IO::IStreamerTypes::RequestStatus::Completed &&
+                        streamer->GetReadRequestResult(fileHandle, data, bytesRead) && bytesRead == byteCount;
+                    AZ_Error("AsyncUploadQueue", success, "Failed to read file '%s' for buffer upload.", filePath.c_str());
+
+                    stagingBuffer->GetBufferMemoryView()->Unmap(RHI::HostMemoryAccess::Write);
+                    if (callback)
+                    {
+                        callback(success);
+                    }
+
+                    CommandQueue::Command command = [=, &device](void* queue)
+                    {
+                        AZ_PROFILE_SCOPE(RHI, "Upload Buffer From File");
+                        Queue* vulkanQueue = static_cast<Queue*>(queue);
+                        const AZStd::vector<Fence*> fencesToSignal = { fenceToSignal.get(), uploadFence.get() };
+
+                        // The fences are signaled on failure as well so the caller isn't left waiting.
+                        if (!success)
+                        {
+                            for (Fence* fence : fencesToSignal)
+                            {
+                                vulkanQueue->GetDescriptor().m_commandQueue->Signal(*fence);
+                            }
+                            return;
+                        }
+
+                        FramePacket* framePacket = BeginFramePacket(vulkanQueue);
+                        EmmitPrologueMemoryBarrier(*buffer, byteOffset, byteCount);
+
+                        RHI::CopyBufferDescriptor copyDescriptor;
+                        copyDescriptor.m_sourceBuffer = stagingBuffer.get();
+                        copyDescriptor.m_sourceOffset = 0;
+                        copyDescriptor.m_destinationBuffer = buffer.get();
+                        copyDescriptor.m_destinationOffset = static_cast<uint32_t>(byteOffset);
+                        copyDescriptor.m_size = static_cast<uint32_t>(byteCount);
+                        m_commandList->Submit(RHI::CopyItem(copyDescriptor));
+
+                        framePacket->m_fileStagingBuffers.push_back(stagingBuffer);
+                        EndFramePacket(vulkanQueue);
+
+                        VkPipelineStageFlags waitStage = GetResourcePipelineStateFlags(buffer->GetDescriptor().m_bindFlags) & device.GetSupportedPipelineStageFlags();
+                        ProcessEndOfUpload(
+                            vulkanQueue,
+                            waitStage,
+                            fencesToSignal,
+                            *buffer,
+                            byteOffset,
+                            byteCount);
+                    };
+                    m_queue->QueueCommand(AZStd::move(command));
+                    --m_pendingFileReads;
+                });
+
+            buffer->SetOwnerQueue(m_queue->GetId());
+            Buffer* bufferToReset = buffer.get();
+            auto waitEvent = [bufferToReset]()
+            {
+                bufferToReset->SetUploadHandle(RHI::AsyncWorkHandle::Null);
+            };
+
+            // Add the wait event so we can wait for upload if necessary.
+            RHI::AsyncWorkHandle handle = CreateAsyncWork(uploadFence, waitEvent);
+            buffer->SetUploadHandle(handle);
+            m_asyncWaitQueue.UnlockAsyncWorkQueue();
+
+            streamer->QueueRequest(fileRequest);
+            return handle;
+        }
+
         // [GFX TODO][ATOM-4205] Stage/Upload 3D streaming images more efficiently.
         RHI::AsyncWorkHandle AsyncUploadQueue::QueueUpload(const RHI::StreamingImageExpandRequest& request, uint32_t residentMip)
         {
@@ -429,6 +541,137 @@ namespace AZ
             return RHI::AsyncWorkHandle::Null;
         }
 
+        RHI::AsyncWorkHandle AsyncUploadQueue::QueueUpload(
+            const RHI::StreamingImageTileExpandRequest& request, const RHI::Origin& destinationOrigin, bool preserveContent)
+        {
+            auto* image = static_cast<Image*>(request.m_image);
+            auto& device = static_cast<Device&>(GetDevice());
+
+            RHI::Ptr<Fence> uploadFence = Fence::Create();
+            uploadFence->Init(device, RHI::FenceState::Reset);
+
+            CommandQueue::Command command = [=, &device](void* queue)
+            {
+                AZ_PROFILE_SCOPE(RHI, "Upload Image Tiles");
+
+                Queue* vulkanQueue = static_cast<Queue*>(queue);
+                FramePacket* framePacket = BeginFramePacket(vulkanQueue);
+
+                // Set pipeline barriers before copy.
+                EmmitPrologueMemoryBarrier(request, preserveContent);
+
+                const static uint32_t bufferOffsetAlign = 4; // refer VkBufferImageCopy in the spec.
+
+                const RHI::ImageSubresourceLayout& subresourceLayout = request.m_subresourceLayout;
+                const uint32_t stagingRowPitch = RHI::AlignUp(subresourceLayout.m_bytesPerRow, bufferOffsetAlign);
+                const uint32_t stagingSlicePitch = subresourceLayout.m_rowCount * stagingRowPitch;
+
+                // Tile regions are meant to be small, so their slices are not split like the ones of whole subresources.
+                AZ_Warning("Vulkan", stagingSlicePitch <= m_descriptor.m_stagingSizeInBytes, "AsyncUploadQueue staging buffer (%zuK) is not big enough "
+                    "for the size of one slice of image's tile region (%uK). Please upload smaller regions.",
+                    m_descriptor.m_stagingSizeInBytes / 1024, stagingSlicePitch / 1024);
+
+                for (uint32_t depth = 0; depth < subresourceLayout.m_size.m_depth && stagingSlicePitch <= m_descriptor.m_stagingSizeInBytes; depth++)
+                {
+                    const uint8_t* sliceDataStart = reinterpret_cast<const uint8_t*>(request.m_data.m_data) + (depth * subresourceLayout.m_bytesPerImage);
+
+                    // If the current framePacket is not big enough, switch to next one.
+                    if (stagingSlicePitch > m_descriptor.m_stagingSizeInBytes - framePacket->m_dataOffset)
+                    {
+                        EndFramePacket(vulkanQueue);
+                        framePacket = BeginFramePacket(vulkanQueue);
+                    }
+
+                    // Copy region data to staging memory.
+                    {
+                        AZ_PROFILE_SCOPE(RHI, "Copy CPU image");
+                        uint8_t* stagingDataStart = reinterpret_cast<uint8_t*>(framePacket->m_stagingBuffer->GetBufferMemoryView()->Map(RHI::HostMemoryAccess::Write)) + framePacket->m_dataOffset;
+                        for (uint32_t row = 0; row < subresourceLayout.m_rowCount; ++row)
+                        {
+                            memcpy(stagingDataStart + row * stagingRowPitch, sliceDataStart + row * subresourceLayout.m_bytesPerRow, subresourceLayout.m_bytesPerRow);
+                        }
+
+                        framePacket->m_stagingBuffer->GetBufferMemoryView()->Unmap(RHI::HostMemoryAccess::Write);
+                    }
+
+                    // Add copy command to copy the region from staging memory to image GPU resource.
+                    RHI::CopyBufferToImageDescriptor copyDescriptor;
+                    copyDescriptor.m_sourceBuffer = framePacket->m_stagingBuffer.get();
+                    copyDescriptor.m_sourceOffset = framePacket->m_dataOffset;
+                    copyDescriptor.m_sourceBytesPerRow = stagingRowPitch;
+                    copyDescriptor.m_sourceBytesPerImage = stagingSlicePitch;
+                    copyDescriptor.m_sourceSize = subresourceLayout.m_size;
+                    copyDescriptor.m_sourceSize.m_depth = 1;
+                    copyDescriptor.m_destinationImage = image;
+                    copyDescriptor.m_destinationSubresource.m_mipSlice = request.m_region.m_mipLevel;
+                    copyDescriptor.m_destinationSubresource.m_arraySlice = request.m_region.m_arraySlice;
+                    copyDescriptor.m_destinationOrigin = destinationOrigin;
+                    copyDescriptor.m_destinationOrigin.m_front += depth;
+
+                    m_commandList->Submit(RHI::CopyItem(copyDescriptor));
+
+                    framePacket->m_dataOffset += stagingSlicePitch;
+                }
+
+                // Set pipeline barriers after the copy.
+                VkPipelineStageFlags waitStage = GetResourcePipelineStateFlags(image->GetDescriptor().m_bindFlags) & device.GetSupportedPipelineStageFlags();
+                EndFramePacket(vulkanQueue);
+                ProcessEndOfUpload(
+                    vulkanQueue,
+                    waitStage,
+                    AZStd::vector<Fence*>{uploadFence.get()},
+                    request);
+            };
+
+            RHI::ImageSubresourceRange range;
+            range.m_mipSliceMin = request.m_region.m_mipLevel;
+            range.m_mipSliceMax = request.m_region.m_mipLevel;
+            range.m_arraySliceMin = request.m_region.m_arraySlice;
+            range.m_arraySliceMax = request.m_region.m_arraySlice;
+
+            image->SetOwnerQueue(m_queue->GetId(), &range);
+            image->SetLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &range);
+            m_queue->QueueCommand(AZStd::move(command));
+
+            auto waitEvent = [this, request, image, range]()
+            {
+                RHI::AsyncWorkHandle uploadHandle = image->GetUploadHandle();
+                image->SetLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, &range);
+                if (request.m_completeCallback)
+                {
+                    if (request.m_waitForUpload)
+                    {
+                        request.m_completeCallback();
+                    }
+                    else
+                    {
+                        // Add the callback so it can be processed from the main thread, see QueueUpload of the expand requests.
+                        {
+                            AZStd::unique_lock<AZStd::mutex> lock(m_callbackListMutex);
+                            m_callbackList.insert(AZStd::make_pair(uploadHandle, [request, image]() { image->SetUploadHandle(RHI::AsyncWorkHandle::Null); request.m_completeCallback(); }));
+                        }
+                        AZ::TickBus::QueueFunction([this, uploadHandle]() { ProcessCallback(uploadHandle); });
+                    }
+                }
+            };
+
+            if (request.m_waitForUpload)
+            {
+                // No need to add wait event.
+                uploadFence->WaitOnCpu();
+                waitEvent();
+            }
+            else
+            {
+                auto uploadHandle = CreateAsyncWork(uploadFence, waitEvent);
+                image->SetUploadHandle(uploadHandle);
+                m_asyncWaitQueue.UnlockAsyncWorkQueue();
+                return uploadHandle;
+            }
+
+            return RHI::AsyncWorkHandle::Null;
+        }
+
         void AsyncUploadQueue::WaitForUpload(const RHI::AsyncWorkHandle& workHandle)
         {
             m_asyncWaitQueue.WaitToFinish(workHandle);
@@ -450,6 +693,29 @@ namespace AZ
             m_queue->QueueCommand(AZStd::move(command));
         }
 
+        void AsyncUploadQueue::QueueBindSparse(VkImage image, AZStd::vector<VkSparseImageMemoryBind>&& imageBinds)
+        {
+            auto& device = static_cast<Device&>(GetDevice());
+
+            CommandQueue::Command command = [=, &device, imageBinds = AZStd::move(imageBinds)](void* queue)
+            {
+                VkSparseImageMemoryBindInfo imageBindInfo;
+                imageBindInfo.image = image;
+                imageBindInfo.bindCount = aznumeric_cast<uint32_t>(imageBinds.size());
+                imageBindInfo.pBinds = imageBinds.data();
+
+                VkBindSparseInfo bindInfo{};
+                bindInfo.sType = VkStructureType::VK_STRUCTURE_TYPE_BIND_SPARSE_INFO;
+                bindInfo.imageBindCount = 1;
+                bindInfo.pImageBinds = &imageBindInfo;
+
+                Queue* vulkanQueue = static_cast<Queue*>(queue);
+                device.GetContext().QueueBindSparse(vulkanQueue->GetNativeQueue(), 1, &bindInfo, VK_NULL_HANDLE);
+            };
+
+            m_queue->QueueCommand(AZStd::move(command));
+        }
+
         RHI::ResultCode AsyncUploadQueue::BuildFramePackets()
         {
             auto& device = static_cast<Device&>(GetDevice());
@@ -479,6 +745,7 @@ namespace AZ
             framePacket.m_fence->WaitOnCpu();
             framePacket.m_fence->Reset();
             framePacket.m_dataOffset = 0;
+            framePacket.m_fileStagingBuffers.clear();
 
             queue->BeginDebugLabel(AZStd::string::format("AsyncUploadQueue Packet %d", static_cast<int>(m_frameIndex)).c_str());
             m_commandList = device.AcquireCommandList(RHI::HardwareQueueClass::Copy);
@@ -578,6 +845,41 @@ namespace AZ
                 &barrier);
         }
 
+        void AsyncUploadQueue::EmmitPrologueMemoryBarrier(const RHI::StreamingImageTileExpandRequest& request, bool preserveContent)
+        {
+            const auto& image = static_cast<const Image&>(*request.m_image);
+
+            VkImageMemoryBarrier barrier{};
+            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.pNext = nullptr;
+            barrier.srcAccessMask = 0;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.oldLayout = preserveContent ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_UNDEFINED;
+            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = image.GetNativeImage();
+            barrier.subresourceRange.aspectMask = image.GetImageAspectFlags();
+            barrier.subresourceRange.baseMipLevel = request.m_region.m_mipLevel;
+            barrier.subresourceRange.levelCount = 1;
+            barrier.subresourceRange.baseArrayLayer = request.m_region.m_arraySlice;
+            barrier.subresourceRange.layerCount = 1;
+
+            auto& device = static_cast<Device&>(GetDevice());
+
+            device.GetContext().CmdPipelineBarrier(
+                m_commandList->GetNativeCommandBuffer(),
+                VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                VK_PIPELINE_STAGE_TRANSFER_BIT,
+                VK_DEPENDENCY_BY_REGION_BIT,
+                0,
+                nullptr,
+                0,
+                nullptr,
+                1,
+                &barrier);
+        }
+
         void AsyncUploadQueue::EmmitEpilogueMemoryBarrier(
             [[maybe_unused]] CommandList& commandList,
             const Buffer& buffer,
@@ -653,6 +955,43 @@ namespace AZ
                 &barrier);
         }
 
+        void AsyncUploadQueue::EmmitEpilogueMemoryBarrier(
+            CommandList& commandList,
+            const RHI::StreamingImageTileExpandRequest& request)
+        {
+            const auto& image = static_cast<const Image&>(*request.m_image);
+
+            VkImageMemoryBarrier barrier{};
+            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.pNext = nullptr;
+            barrier.srcAccessMask = 0;
+            barrier.dstAccessMask = 0;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = image.GetNativeImage();
+            barrier.subresourceRange.aspectMask = image.GetImageAspectFlags();
+            barrier.subresourceRange.baseMipLevel = request.m_region.m_mipLevel;
+            barrier.subresourceRange.levelCount = 1;
+            barrier.subresourceRange.baseArrayLayer = request.m_region.m_arraySlice;
+            barrier.subresourceRange.layerCount = 1;
+
+            auto& device = static_cast<Device&>(GetDevice());
+
+            device.GetContext().CmdPipelineBarrier(
+                commandList.GetNativeCommandBuffer(),
+                VK_PIPELINE_STAGE_TRANSFER_BIT,
+                VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                VK_DEPENDENCY_BY_REGION_BIT,
+                0,
+                nullptr,
+                0,
+                nullptr,
+                1,
+                &barrier);
+        }
+
         RHI::AsyncWorkHandle AsyncUploadQueue::CreateAsyncWork(RHI::Ptr<Fence> fence, RHI::Fence::SignalCallback callback /* = nullptr */)
         {
             return m_asyncWaitQueue.CreateAsyncWork([fence, callback]()
@@ -10,6 +10,7 @@
 #include <Atom/RHI/DeviceObject.h>
 #include <Atom/RHI/Fence.h>
 #include <Atom/RHI/StreamingImagePool.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <Atom/RHI/AsyncWorkQueue.h>
@@ -23,7 +24,10 @@ namespace AZ
     namespace RHI
     {
         struct BufferStreamRequest;
+        struct BufferFileStreamRequest;
         struct StreamingImageExpandRequest;
+        struct StreamingImageTileExpandRequest;
+        struct Origin;
     }
 
     namespace Vulkan
@@ -64,12 +68,21 @@ namespace AZ
             void Shutdown();
 
             RHI::AsyncWorkHandle QueueUpload(const RHI::BufferStreamRequest& request);
+            //! Reads the file of the request straight into a dedicated staging buffer and queues the copy to the
+            //! destination buffer once the read completes.
+            RHI::AsyncWorkHandle QueueUpload(const RHI::BufferFileStreamRequest& request);
             RHI::AsyncWorkHandle QueueUpload(const RHI::StreamingImageExpandRequest& request, uint32_t residentMip);
+            //! Uploads a region of tiles of an image subresource, the tiles need to be bound first.
+            //! destinationOrigin is the texel origin of the region. The content of the other tiles of the subresource
+            //! is kept if preserveContent is true, otherwise the subresource starts from an undefined layout.
+            RHI::AsyncWorkHandle QueueUpload(const RHI::StreamingImageTileExpandRequest& request, const RHI::Origin& destinationOrigin, bool preserveContent);
 
             void WaitForUpload(const RHI::AsyncWorkHandle& workHandle);
 
             // queue sparse bindings
             void QueueBindSparse(const VkBindSparseInfo& bindSparseInfo);
+            // queue sparse bindings of an image, which are kept until the bind is done
+            void QueueBindSparse(VkImage image, AZStd::vector<VkSparseImageMemoryBind>&& imageBinds);
 
         private:
             RHI::Ptr<CommandQueue> m_queue;
@@ -81,6 +94,9 @@ namespace AZ
                 RHI::Ptr<Fence> m_fence;
 
                 uint32_t m_dataOffset = 0;
+
+                // Staging buffers that files were read into, released once the packet's commands completed.
+                AZStd::vector<RHI::Ptr<Buffer>> m_fileStagingBuffers;
             };
 
             RHI::ResultCode BuildFramePackets();
@@ -91,6 +107,7 @@ namespace AZ
 
             void EmmitPrologueMemoryBarrier(const Buffer& buffer, size_t offset, size_t size);
             void EmmitPrologueMemoryBarrier(const RHI::StreamingImageExpandRequest& request, uint32_t residentMip);
+            void EmmitPrologueMemoryBarrier(const RHI::StreamingImageTileExpandRequest& request, bool preserveContent);
 
             void EmmitEpilogueMemoryBarrier(
                 CommandList& commandList,
@@ -103,6 +120,10 @@ namespace AZ
                 const RHI::StreamingImageExpandRequest& request,
                 uint32_t residentMip);
 
+            void EmmitEpilogueMemoryBarrier(
+                CommandList& commandList,
+                const RHI::StreamingImageTileExpandRequest& request);
+
             // Handles the end of the upload. This includes emitting the epilogue barriers and doing any
             // necessary cross queue synchronization and ownership transfer (if needed).
             template<typename ...Args>
@@ -124,6 +145,9 @@ namespace AZ
 
             AZStd::mutex m_callbackListMutex;
             AZStd::unordered_map<RHI::AsyncWorkHandle, RHI::CompleteCallback> m_callbackList;
+
+            // Number of file reads that haven't queued their copy commands yet.
+            AZStd::atomic<uint32_t> m_pendingFileReads{ 0 };
         };
 
         template<typename ...Args>
@@ -234,6 +234,18 @@ namespace AZ
             return RHI::ResultCode::Success;
         }
 
+        RHI::ResultCode BufferPool::StreamBufferFromFileInternal(const RHI::BufferFileStreamRequest& request)
+        {
+            if (GetDescriptor().m_heapMemoryLevel == RHI::HeapMemoryLevel::Host)
+            {
+                return StreamBufferFromFileToHostMemory(request);
+            }
+
+            auto& device = static_cast<Device&>(GetDevice());
+            const RHI::AsyncWorkHandle handle = device.GetAsyncUploadQueue().QueueUpload(request);
+            return handle.IsNull() ? RHI::ResultCode::OutOfMemory : RHI::ResultCode::Success;
+        }
+
         void BufferPool::ComputeFragmentation() const
         {
             float fragmentation = m_memoryAllocator.ComputeFragmentation();
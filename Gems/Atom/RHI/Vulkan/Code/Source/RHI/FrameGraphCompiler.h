@@ -47,6 +47,7 @@ namespace AZ
             RHI::ResultCode InitInternal(RHI::Device& device) override;
             void ShutdownInternal() override;
             RHI::MessageOutcome CompileInternal(const RHI::FrameGraphCompileRequest& request) override;
+            bool IsParallelScopeCompileSupported() const override { return true; }
             //////////////////////////////////////////////////////////////////////////
 
             void CompileResourceBarriers(const RHI::FrameGraphAttachmentDatabase& attachmentDatabase);
@@ -26,6 +26,54 @@ namespace AZ
 {
     namespace Vulkan
     {
+        namespace
+        {
+            // Region tiles are keyed by the array layer and the tile coordinate in the mip level.
+            uint64_t GetRegionTileKey(uint32_t arrayLayer, uint32_t x, uint32_t y, uint32_t z)
+            {
+                return (static_cast<uint64_t>(arrayLayer) << 48) | (static_cast<uint64_t>(z) << 32) |
+                    (static_cast<uint64_t>(y) << 16) | static_cast<uint64_t>(x);
+            }
+
+            uint32_t GetRegionTileArrayLayer(uint64_t tileKey)
+            {
+                return static_cast<uint32_t>(tileKey >> 48);
+            }
+
+            // Returns the sparse memory bind of a region tile. The tile is unbound if heapTiles is null.
+            VkSparseImageMemoryBind GetRegionTileMemoryBind(const SparseImageInfo& sparseImageInfo, uint16_t mipLevel, uint64_t tileKey, const HeapTiles* heapTiles)
+            {
+                const VkExtent3D& imageGranularity = sparseImageInfo.m_sparseImageMemoryRequirements.formatProperties.imageGranularity;
+                const RHI::Size& mipSize = sparseImageInfo.m_nonTailMipInfos[mipLevel].m_size;
+
+                VkSparseImageMemoryBind memoryBind{};
+                memoryBind.subresource.aspectMask = VkImageAspectFlagBits::VK_IMAGE_ASPECT_COLOR_BIT;
+                memoryBind.subresource.mipLevel = mipLevel;
+                memoryBind.subresource.arrayLayer = GetRegionTileArrayLayer(tileKey);
+                memoryBind.offset.x = static_cast<int32_t>((tileKey & 0xFFFF) * imageGranularity.width);
+                memoryBind.offset.y = static_cast<int32_t>(((tileKey >> 16) & 0xFFFF) * imageGranularity.height);
+                memoryBind.offset.z = static_cast<int32_t>(((tileKey >> 32) & 0xFFFF) * imageGranularity.depth);
+
+                // handle the edges
+                memoryBind.extent.width = AZStd::min(imageGranularity.width, mipSize.m_width - memoryBind.offset.x);
+                memoryBind.extent.height = AZStd::min(imageGranularity.height, mipSize.m_height - memoryBind.offset.y);
+                memoryBind.extent.depth = AZStd::min(imageGranularity.depth, mipSize.m_depth - memoryBind.offset.z);
+
+                if (heapTiles)
+                {
+                    memoryBind.memory = heapTiles->m_heap->GetNativeDeviceMemory();
+                    memoryBind.memoryOffset = heapTiles->m_tileSpanList[0].m_offset * SparseImageInfo::StandardBlockSize;
+                }
+                else
+                {
+                    memoryBind.memory = VK_NULL_HANDLE;
+                    memoryBind.memoryOffset = 0;
+                }
+                memoryBind.flags = 0;
+                return memoryBind;
+            }
+        }
+
         // SparseImageInfo functions
         void SparseImageInfo::Init(const Device& device, VkImage vkImage, const RHI::ImageDescriptor& imageDescriptor)
         {
@@ -144,6 +192,16 @@ namespace AZ
             return memorySize; 
         }
 
+        uint64_t SparseImageInfo::GetRegionTilesMemorySize() const
+        {
+            uint64_t memorySize = 0;
+            for (const NonTailMipInfo& mipInfo : m_nonTailMipInfos)
+            {
+                memorySize += mipInfo.m_regionTiles.size() * m_blockSizeInBytes;
+            }
+            return memorySize;
+        }
+
         void SparseImageInfo::UpdateMipMemoryBindInfo(uint16_t mipLevel)
         {
             AZ_Assert(mipLevel < m_tailStartMip, "Invalid mip level. Mip level should be smaller than m_tailStartMip");
@@ -600,7 +658,7 @@ namespace AZ
                         // unbound sparse memories for these mips
                         VkBindSparseInfo bindSparseInfo = m_sparseImageInfo->GetBindSparseInfo(adjustedTargetMipLevel-1, m_highestMipLevel);
                         m_highestMipLevel = adjustedTargetMipLevel;
-                        m_residentSizeInBytes = m_sparseImageInfo->GetRequiredMemorySize(m_highestMipLevel);
+                        UpdateSparseResidentSizeInBytes();
                         auto& device = static_cast<Device&>(GetDevice());
                         device.GetAsyncUploadQueue().QueueBindSparse(bindSparseInfo);
                     }
@@ -610,6 +668,140 @@ namespace AZ
             return RHI::ResultCode::Success;
         }
 
+        RHI::ResultCode Image::AllocateAndBindTiles(StreamingImagePool& imagePool, const RHI::StreamingImageTileRegion& region, bool& hadBoundTiles)
+        {
+            AZ_Assert(m_isSparse && region.m_mipLevel < m_sparseImageInfo->m_tailStartMip && region.m_mipLevel < m_highestMipLevel,
+                "Tiles can only be bound for the non-tail mips of a sparse image which aren't bound");
+
+            SparseImageInfo::NonTailMipInfo& mipInfo = m_sparseImageInfo->m_nonTailMipInfos[region.m_mipLevel];
+            const VkExtent3D& imageGranularity = m_sparseImageInfo->m_sparseImageMemoryRequirements.formatProperties.imageGranularity;
+            hadBoundTiles = AZStd::any_of(mipInfo.m_regionTiles.begin(), mipInfo.m_regionTiles.end(),
+                [&region](const auto& regionTile)
+                {
+                    return GetRegionTileArrayLayer(regionTile.first) == region.m_arraySlice;
+                });
+
+            RHI::ResultCode result = RHI::ResultCode::Success;
+            AZStd::vector<VkSparseImageMemoryBind> memoryBinds;
+            for (uint32_t z = region.m_tileOrigin.m_front; z < region.m_tileOrigin.m_front + region.m_tileCount.m_depth && result == RHI::ResultCode::Success; ++z)
+            {
+                for (uint32_t y = region.m_tileOrigin.m_top; y < region.m_tileOrigin.m_top + region.m_tileCount.m_height && result == RHI::ResultCode::Success; ++y)
+                {
+                    for (uint32_t x = region.m_tileOrigin.m_left; x < region.m_tileOrigin.m_left + region.m_tileCount.m_width; ++x)
+                    {
+                        const uint64_t tileKey = GetRegionTileKey(region.m_arraySlice, x, y, z);
+                        if (mipInfo.m_regionTiles.contains(tileKey))
+                        {
+                            continue;
+                        }
+
+                        AZStd::vector<HeapTiles> heapTiles;
+                        result = imagePool.AllocateMemoryBlocks(heapTiles, 1);
+                        if (result != RHI::ResultCode::Success)
+                        {
+                            break;
+                        }
+
+                        memoryBinds.push_back(GetRegionTileMemoryBind(*m_sparseImageInfo, region.m_mipLevel, tileKey, &heapTiles[0]));
+                        mipInfo.m_regionTiles.emplace(tileKey, heapTiles[0]);
+                    }
+                }
+            }
+
+            // Release the tiles which were allocated if the allocation failed. So the subresource never has bound tiles
+            // which weren't uploaded.
+            if (result != RHI::ResultCode::Success)
+            {
+                SparseImageInfo::MultiHeapTiles heapTilesList;
+                for (const VkSparseImageMemoryBind& memoryBind : memoryBinds)
+                {
+                    const uint64_t tileKey = GetRegionTileKey(
+                        region.m_arraySlice,
+                        memoryBind.offset.x / imageGranularity.width,
+                        memoryBind.offset.y / imageGranularity.height,
+                        memoryBind.offset.z / imageGranularity.depth);
+                    heapTilesList.push_back(mipInfo.m_regionTiles[tileKey]);
+                    mipInfo.m_regionTiles.erase(tileKey);
+                }
+                if (!heapTilesList.empty())
+                {
+                    imagePool.DeAllocateMemoryBlocks(heapTilesList);
+                }
+                return result;
+            }
+
+            if (!memoryBinds.empty())
+            {
+                auto& device = static_cast<Device&>(GetDevice());
+                device.GetAsyncUploadQueue().QueueBindSparse(m_vkImage, AZStd::move(memoryBinds));
+                UpdateSparseResidentSizeInBytes();
+            }
+            return result;
+        }
+
+        void Image::ReleaseTiles(StreamingImagePool& imagePool, const RHI::StreamingImageTileRegion& region)
+        {
+            if (!m_isSparse || region.m_mipLevel >= m_sparseImageInfo->m_tailStartMip)
+            {
+                return;
+            }
+
+            SparseImageInfo::NonTailMipInfo& mipInfo = m_sparseImageInfo->m_nonTailMipInfos[region.m_mipLevel];
+            AZStd::vector<VkSparseImageMemoryBind> emptyMemoryBinds;
+            SparseImageInfo::MultiHeapTiles heapTilesList;
+            for (uint32_t z = region.m_tileOrigin.m_front; z < region.m_tileOrigin.m_front + region.m_tileCount.m_depth; ++z)
+            {
+                for (uint32_t y = region.m_tileOrigin.m_top; y < region.m_tileOrigin.m_top + region.m_tileCount.m_height; ++y)
+                {
+                    for (uint32_t x = region.m_tileOrigin.m_left; x < region.m_tileOrigin.m_left + region.m_tileCount.m_width; ++x)
+                    {
+                        const uint64_t tileKey = GetRegionTileKey(region.m_arraySlice, x, y, z);
+                        auto tileIt = mipInfo.m_regionTiles.find(tileKey);
+                        if (tileIt == mipInfo.m_regionTiles.end())
+                        {
+                            continue;
+                        }
+
+                        emptyMemoryBinds.push_back(GetRegionTileMemoryBind(*m_sparseImageInfo, region.m_mipLevel, tileKey, nullptr));
+                        heapTilesList.push_back(tileIt->second);
+                        mipInfo.m_regionTiles.erase(tileIt);
+                    }
+                }
+            }
+
+            if (!emptyMemoryBinds.empty())
+            {
+                // The memory blocks are only reused by binds queued after the unbind
+                auto& device = static_cast<Device&>(GetDevice());
+                device.GetAsyncUploadQueue().QueueBindSparse(m_vkImage, AZStd::move(emptyMemoryBinds));
+                imagePool.DeAllocateMemoryBlocks(heapTilesList);
+                UpdateSparseResidentSizeInBytes();
+            }
+        }
+
+        void Image::ReleaseMipTiles(StreamingImagePool& imagePool, uint16_t mipLevel)
+        {
+            SparseImageInfo::NonTailMipInfo& mipInfo = m_sparseImageInfo->m_nonTailMipInfos[mipLevel];
+            if (mipInfo.m_regionTiles.empty())
+            {
+                return;
+            }
+
+            SparseImageInfo::MultiHeapTiles heapTilesList;
+            heapTilesList.reserve(mipInfo.m_regionTiles.size());
+            for (const auto& regionTile : mipInfo.m_regionTiles)
+            {
+                heapTilesList.push_back(regionTile.second);
+            }
+            imagePool.DeAllocateMemoryBlocks(heapTilesList);
+            mipInfo.m_regionTiles.clear();
+        }
+
+        void Image::UpdateSparseResidentSizeInBytes()
+        {
+            m_residentSizeInBytes = m_sparseImageInfo->GetRequiredMemorySize(m_highestMipLevel) + m_sparseImageInfo->GetRegionTilesMemorySize();
+        }
+
         RHI::ResultCode Image::BindMemoryView(const MemoryView& memoryView)
         {
             AZ_Assert(m_vkImage != VK_NULL_HANDLE, "Vulkan's native image is not initialized.");
@@ -695,13 +887,22 @@ namespace AZ
                     return result;
                 }
 
+                // The non-tail mips are bound as a whole, which replaces the binds of their tiles
+                if (m_sparseImageInfo->m_tailStartMip > 0 && endMip < m_sparseImageInfo->m_tailStartMip)
+                {
+                    for (uint16_t mipLevel = endMip; mipLevel <= nonTailStart; mipLevel++)
+                    {
+                        ReleaseMipTiles(imagePool, mipLevel);
+                    }
+                }
+
                 // update the memory bind info for the mips which were just allocated
                 m_sparseImageInfo->UpdateMemoryBindInfo(startMip, endMip);
 
                 // Queue the image's sparse binding
                 VkBindSparseInfo bindSparseInfo = m_sparseImageInfo->GetBindSparseInfo(startMip, endMip);
                 m_highestMipLevel = endMip;
-                m_residentSizeInBytes = m_sparseImageInfo->GetRequiredMemorySize(m_highestMipLevel);
+                UpdateSparseResidentSizeInBytes();
                 device.GetAsyncUploadQueue().QueueBindSparse(bindSparseInfo);
             }
             else 
@@ -882,9 +1083,10 @@ namespace AZ
             {
                 imagePool.DeAllocateMemoryBlocks(m_sparseImageInfo->m_mipTailHeapTiles);
 
-                for (auto& mipInfo : m_sparseImageInfo->m_nonTailMipInfos)
+                for (uint16_t mipLevel = 0; mipLevel < m_sparseImageInfo->m_nonTailMipInfos.size(); mipLevel++)
                 {
-                    imagePool.DeAllocateMemoryBlocks(mipInfo.m_heapTiles);
+                    imagePool.DeAllocateMemoryBlocks(m_sparseImageInfo->m_nonTailMipInfos[mipLevel].m_heapTiles);
+                    ReleaseMipTiles(imagePool, mipLevel);
                 }
             }
             else
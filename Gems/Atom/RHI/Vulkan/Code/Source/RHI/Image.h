@@ -14,6 +14,7 @@
 #include <Atom/RHI.Reflect/ImageSubresource.h>
 #include <Atom/RHI.Reflect/Size.h>
 #include <Atom/RHI.Reflect/Vulkan/ImagePoolDescriptor.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/sort.h>
 #include <RHI/MemoryView.h>
@@ -26,6 +27,7 @@ namespace AZ
     namespace RHI
     {
         class ImageView;
+        struct StreamingImageTileRegion;
     };
     namespace Vulkan
     {
@@ -78,6 +80,10 @@ namespace AZ
 
                 // Cached structures for unbound memory. Used for unbound certain non-tail mip levels
                 MipMemoryBinds m_emptyMemoryBinds;                      // Empty binds
+
+                // Memory blocks bound to single tiles while the mip level isn't bound, see StreamingImagePool::ExpandImageTiles.
+                // The key packs the array layer and the coordinate of the tile in the mip level.
+                AZStd::unordered_map<uint64_t, HeapTiles> m_regionTiles;
             };
 
             // Memory binding info for each non-tail mip levels
@@ -100,6 +106,9 @@ namespace AZ
 
             uint64_t GetRequiredMemorySize(uint16_t residentMipLevel) const;
 
+            // Get the memory size of the tiles bound individually in the non-tail mips
+            uint64_t GetRegionTilesMemorySize() const;
+
             // Get the VkBindSparseInfo data for bind memory for specified mip range ( startMipLevel >= endMipLevel)
             VkBindSparseInfo GetBindSparseInfo(uint16_t startMipLevel, uint16_t endMipLevel);
 
@@ -192,6 +201,19 @@ namespace AZ
             // Trim image to specified mip level. Release unused bound memory if updateMemoryBind is true
             RHI::ResultCode TrimImage(StreamingImagePool& imagePool, uint16_t targetMipLevel, bool updateMemoryBind);
 
+            // Allocate and bind one memory block for each tile of the region which isn't bound yet. The region must be in
+            // a non-tail mip level which isn't bound. hadBoundTiles returns whether the subresource of the region had bound tiles before.
+            RHI::ResultCode AllocateAndBindTiles(StreamingImagePool& imagePool, const RHI::StreamingImageTileRegion& region, bool& hadBoundTiles);
+
+            // Unbind and release the memory blocks of the tiles of the region.
+            void ReleaseTiles(StreamingImagePool& imagePool, const RHI::StreamingImageTileRegion& region);
+
+            // Release the memory blocks of the tiles of a non-tail mip level, without unbinding them.
+            void ReleaseMipTiles(StreamingImagePool& imagePool, uint16_t mipLevel);
+
+            // Update the resident size of a sparse image from its bound mips and tiles
+            void UpdateSparseResidentSizeInBytes();
+
             VkImageCreateFlags CalculateImageCreateFlags() const;
             VkImageUsageFlags CalculateImageUsageFlags() const;
 
@@ -32,7 +32,8 @@ namespace AZ
             auto& physicalDevice = static_cast<const PhysicalDevice&>(device.GetPhysicalDevice());
             const VkPhysicalDeviceAccelerationStructurePropertiesKHR& accelerationStructureProperties = physicalDevice.GetPhysicalDeviceAccelerationStructureProperties();
                         
-            // advance to the next buffer
+            // advance to the next buffer, the previous one is the source of a refit
+            const TlasBuffers& previousBuffers = m_buffers[m_currentBufferIndex];
             m_currentBufferIndex = (m_currentBufferIndex + 1) % BufferCount;
             TlasBuffers& buffers = m_buffers[m_currentBufferIndex];
 
@@ -50,6 +51,7 @@ namespace AZ
                 buffers.m_tlasBuffer = nullptr;
                 buffers.m_tlasInstancesBuffer = nullptr;
                 buffers.m_scratchBuffer = nullptr;
+                buffers.m_instanceCount = 0;
                 return RHI::ResultCode::Success;
             }
             
@@ -135,7 +137,8 @@ namespace AZ
             
             buffers.m_buildInfo = {};
             buffers.m_buildInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
-            buffers.m_buildInfo.flags = VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR;
+            buffers.m_buildInfo.flags =
+                VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR;
             buffers.m_buildInfo.geometryCount = 1;
             buffers.m_buildInfo.pGeometries = &buffers.m_geometry;
             buffers.m_buildInfo.mode = VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
@@ -153,7 +156,9 @@ namespace AZ
                 &buildSizesInfo);
 
             buildSizesInfo.accelerationStructureSize = RHI::AlignUp(buildSizesInfo.accelerationStructureSize, 256);
-            buildSizesInfo.buildScratchSize = RHI::AlignUp(buildSizesInfo.buildScratchSize, accelerationStructureProperties.minAccelerationStructureScratchOffsetAlignment);
+            buildSizesInfo.buildScratchSize = RHI::AlignUp(
+                AZStd::max(buildSizesInfo.buildScratchSize, buildSizesInfo.updateScratchSize),
+                accelerationStructureProperties.minAccelerationStructureScratchOffsetAlignment);
 
             // create scratch buffer
             buffers.m_scratchBuffer = RHI::Factory::Get().CreateBuffer();
@@ -199,6 +204,14 @@ namespace AZ
             AssertSuccess(vkResult);
             
             buffers.m_buildInfo.dstAccelerationStructure = buffers.m_accelerationStructure;
+
+            // update the previous TLAS into the new one if only the instance transforms changed
+            if (descriptor->IsRefit() && previousBuffers.m_accelerationStructure != VK_NULL_HANDLE &&
+                previousBuffers.m_instanceCount == buffers.m_instanceCount)
+            {
+                buffers.m_buildInfo.mode = VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+                buffers.m_buildInfo.srcAccelerationStructure = previousBuffers.m_accelerationStructure;
+            }
             
             VkBufferDeviceAddressInfo addressInfo = {};
             addressInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
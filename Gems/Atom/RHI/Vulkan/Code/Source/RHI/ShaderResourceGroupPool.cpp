@@ -170,7 +170,9 @@ namespace AZ
             auto constantData = groupData.GetConstantData();
             if (!constantData.empty())
             {
+                // The descriptor sets cycle per frame rather than per compile, so the constant data is always written in full
                 descriptorSet.UpdateConstantData(constantData);
+                AddConstantBytesUploaded(constantData.size());
             }
             descriptorSet.CommitUpdates();
 
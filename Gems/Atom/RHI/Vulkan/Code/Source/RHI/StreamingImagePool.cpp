@@ -221,6 +221,64 @@ namespace AZ
             return result;
         }
 
+        RHI::Size StreamingImagePool::GetImageTileSizeInternal(const RHI::Image& imageBase) const
+        {
+            const auto& image = static_cast<const Image&>(imageBase);
+            if (!image.IsSparse())
+            {
+                return RHI::Size(0, 0, 0);
+            }
+
+            const VkExtent3D& imageGranularity = image.m_sparseImageInfo->m_sparseImageMemoryRequirements.formatProperties.imageGranularity;
+            return RHI::Size(imageGranularity.width, imageGranularity.height, imageGranularity.depth);
+        }
+
+        RHI::ResultCode StreamingImagePool::ExpandImageTilesInternal(const RHI::StreamingImageTileExpandRequest& request)
+        {
+            auto& image = static_cast<Image&>(*request.m_image);
+            auto& device = static_cast<Device&>(GetDevice());
+            const RHI::StreamingImageTileRegion& region = request.m_region;
+
+            // The mip tail doesn't have individual tiles, and mips which are bound as a whole don't need tiles.
+            if (!image.IsSparse() || region.m_mipLevel >= image.m_sparseImageInfo->m_tailStartMip || region.m_mipLevel >= image.m_highestMipLevel)
+            {
+                AZ_Error("Vulkan:StreamingImagePool", false, "Tiles can only be made resident for the non-tail mips of a sparse image which aren't bound");
+                return RHI::ResultCode::InvalidArgument;
+            }
+
+            WaitFinishUploading(image);
+
+            bool hadBoundTiles = false;
+            RHI::ResultCode result = image.AllocateAndBindTiles(*this, region, hadBoundTiles);
+            if (result != RHI::ResultCode::Success)
+            {
+                AZ_Warning("Vulkan:StreamingImagePool", false, "Failed to allocate or bind memory for the tiles of image");
+                return result;
+            }
+
+            const RHI::Size tileSize = GetImageTileSizeInternal(image);
+            const RHI::Origin destinationOrigin(
+                region.m_tileOrigin.m_left * tileSize.m_width,
+                region.m_tileOrigin.m_top * tileSize.m_height,
+                region.m_tileOrigin.m_front * tileSize.m_depth);
+            device.GetAsyncUploadQueue().QueueUpload(request, destinationOrigin, hadBoundTiles);
+            return RHI::ResultCode::Success;
+        }
+
+        RHI::ResultCode StreamingImagePool::TrimImageTilesInternal(RHI::Image& imageBase, const RHI::StreamingImageTileRegion& region)
+        {
+            auto& image = static_cast<Image&>(imageBase);
+            if (!image.IsSparse())
+            {
+                return RHI::ResultCode::InvalidArgument;
+            }
+
+            WaitFinishUploading(image);
+
+            image.ReleaseTiles(*this, region);
+            return RHI::ResultCode::Success;
+        }
+
         void StreamingImagePool::ShutdownInternal()
         {
             m_memoryAllocator.Shutdown();
@@ -61,6 +61,9 @@ namespace AZ
             RHI::ResultCode TrimImageInternal(RHI::Image& image, uint32_t targetMipLevel) override;
             RHI::ResultCode SetMemoryBudgetInternal(size_t newBudget) override;
             bool SupportTiledImageInternal() const override;
+            RHI::Size GetImageTileSizeInternal(const RHI::Image& image) const override;
+            RHI::ResultCode ExpandImageTilesInternal(const RHI::StreamingImageTileExpandRequest& request) override;
+            RHI::ResultCode TrimImageTilesInternal(RHI::Image& image, const RHI::StreamingImageTileRegion& region) override;
             //////////////////////////////////////////////////////////////////////////
 
             //////////////////////////////////////////////////////////////////////////
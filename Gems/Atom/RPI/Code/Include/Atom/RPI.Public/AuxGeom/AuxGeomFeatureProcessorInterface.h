@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/functional.h>
 
 #include <Atom/RPI.Public/Base.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
@@ -28,6 +29,10 @@ namespace AZ
         public:
             AZ_RTTI(AZ::RPI::AuxGeomFeatureProcessorInterface, "{2750EE44-5AE6-4379-BA3B-EDCD1507C997}", AZ::RPI::FeatureProcessor);
 
+            //! Identifies geometry added with AddRetainedGeometry.
+            using RetainedGeometryId = uint32_t;
+            static constexpr RetainedGeometryId InvalidRetainedGeometryId = 0;
+
             AuxGeomFeatureProcessorInterface() = default;
             virtual ~AuxGeomFeatureProcessorInterface() = default;
 
@@ -61,6 +66,15 @@ namespace AZ
 
             //! Feature processor releases the AuxGeomDrawQueue for the supplied view. DrawQueue is deleted when references fall to zero.
             virtual void ReleaseDrawQueueForView(const View* view) = 0;
+
+            //! Records the geometry drawn by drawFunction and keeps drawing it every frame until RemoveRetainedGeometry is called.
+            //! Use this for static debug geometry, like a navigation mesh, so its vertices are uploaded to the GPU once
+            //! instead of being queued and uploaded again every frame.
+            //! The AuxGeomDraw passed to drawFunction is only valid during the call. Can be called from any thread.
+            virtual RetainedGeometryId AddRetainedGeometry(const AZStd::function<void(AuxGeomDraw&)>& drawFunction) = 0;
+
+            //! Stops drawing geometry added with AddRetainedGeometry and releases its buffers. Can be called from any thread.
+            virtual void RemoveRetainedGeometry(RetainedGeometryId geometryId) = 0;
         };
     } // namespace RPI
 } // namespace AZ
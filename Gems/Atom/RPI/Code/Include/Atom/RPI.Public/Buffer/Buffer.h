@@ -48,6 +48,20 @@ namespace AZ
             //! Blocks until a streaming upload has completed (if one is currently in flight).
             void WaitForUpload();
 
+            //! Returns true if no streaming upload is in flight.
+            bool IsUploadComplete() const;
+
+            //! Releases the GPU memory of the buffer but keeps the RHI buffer, so views and draw items that refer to it
+            //! remain valid and are rebuilt once it is resident again. The buffer must not be used by the GPU until then.
+            void Evict();
+
+            //! Recreates the GPU memory of an evicted buffer and streams the content of the asset to it.
+            //! The upload is complete once IsUploadComplete() returns true.
+            RHI::ResultCode MakeResident(BufferAsset& bufferAsset);
+
+            //! Returns false if the buffer was evicted.
+            bool IsResident() const;
+
             RHI::Buffer* GetRHIBuffer();
 
             const RHI::Buffer* GetRHIBuffer() const;
@@ -49,6 +49,7 @@ namespace AZ
     namespace RPI
     {
         class Scene;
+        class ModelLodResidency;
 
         struct Cullable
         {
@@ -109,6 +110,10 @@ namespace AZ
                 float m_lodSelectionRadius = 1.0f;
 
                 LodConfiguration m_lodConfiguration;
+
+                //! Set for the lods of a streamed model: the selected lods are requested, and evicted lods are replaced
+                //! by the most detailed resident lod. See ModelLodStreamingController.
+                ModelLodResidency* m_lodResidency = nullptr;
             };
             LodData m_lodData;
 
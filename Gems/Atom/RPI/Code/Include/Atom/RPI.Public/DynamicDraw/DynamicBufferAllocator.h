@@ -11,6 +11,7 @@
 #include <AtomCore/Instance/Instance.h>
 
 #include <Atom/RHI/IndexBufferView.h>
+#include <Atom/RHI/RingAllocator.h>
 #include <Atom/RHI/StreamBufferView.h>
 
 #include <Atom/RPI.Public/Base.h>
@@ -26,6 +27,7 @@ namespace AZ
         //! DynamicBufferAllocator allocates DynamicBuffers within a big pre-allocated buffer by using ring buffer allocation
         //! The addresses of allocated DynamicBuffers would be available after AZ::RHI::Limits::Device::FrameCountMax frames.
         //! Since the allocations are sub-allocations they almost have zero cost with both cpu and gpu.
+        //! Allocate is lock free and may be called from several threads, but not while FrameEnd runs.
         //! Limitation: the allocation may fail if the request buffer size is larger than the ring buffer size or
         //!     there isn't enough unused memory available within the ring buffer. User may increase the input of Init(ringBufferSize)
         //!     to increase the ring buffer's size. 
@@ -63,20 +65,12 @@ namespace AZ
             // Get buffer's offset;
             uint32_t GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer);
 
-            // The position where the buffer is available.
-            uint32_t m_currentPosition = 0;
-            // The upper bound limit of the allocation of current frame 
-            uint32_t m_endPositionLimit = 0;
-            // The allocated buffer size of current frame
-            uint32_t m_currentAllocatedSize = 0;
-
             uint32_t m_ringBufferSize = 0;
             void* m_ringBufferStartAddress = 0;
             Data::Instance<Buffer> m_ringBuffer;
 
-            // Allocation history which are in use by GPU. 
-            uint32_t m_frameStartPositions[AZ::RHI::Limits::Device::FrameCountMax];
-            uint32_t m_currentFrame = 0;
+            // Sub-allocates the ring buffer, reclaiming the allocations of a frame after FrameCountMax frames
+            RHI::RingAllocator m_ringAllocator;
 
             bool m_enableAllocationWarning = false;
         };
@@ -12,6 +12,8 @@
 #include <Atom/RPI.Public/DynamicDraw/DynamicBufferAllocator.h>
 #include <Atom/RPI.Reflect/RPISystemDescriptor.h>
 
+#include <AzCore/std/parallel/shared_mutex.h>
+
 
 namespace AZ
 {
@@ -46,7 +48,7 @@ namespace AZ
             void FrameEnd();
 
         private:
-            AZStd::mutex m_mutexBufferAlloc;
+            AZStd::shared_mutex m_mutexBufferAlloc;
             AZStd::unique_ptr<DynamicBufferAllocator> m_bufferAlloc;
 
             AZStd::mutex m_mutexDrawContext;
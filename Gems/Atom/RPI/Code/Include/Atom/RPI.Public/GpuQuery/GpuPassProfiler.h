@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/Name/Name.h>
 
 #include <Atom/RPI.Public/GpuQuery/GpuQueryTypes.h>
@@ -84,6 +85,16 @@ namespace AZ
                 bool m_isParent = false;
             };
 
+            //! Timestamp of a pass that was collected by CollectPassTimestamps().
+            struct PassTimestamp
+            {
+                Name m_name;
+                //! Index of the parent pass in the collected timestamps, or -1 for the root pass.
+                int32_t m_parentIndex = -1;
+                uint16_t m_depth = 0;
+                RPI::TimestampResult m_timestampResult;
+            };
+
             GpuPassProfiler() = default;
             ~GpuPassProfiler() = default;
 
@@ -94,6 +105,23 @@ namespace AZ
             void SetGpuTimeMeasurementEnabled(bool enabled) { m_measureGpuTime = enabled; }
             bool IsGpuTimeMeasurementEnabled() { return m_measureGpuTime; }
 
+            //! Enables the low overhead mode that collects the timestamps of every pass each frame and records them to the
+            //! AZ::Debug::Profiler, so they are part of the same captures as the CPU regions.
+            void SetPassTimestampsEnabled(bool enabled) { m_collectPassTimestamps = enabled; }
+            bool IsPassTimestampsEnabled() const { return m_collectPassTimestamps; }
+
+            //! Collects the latest timestamps of all enabled passes under @rootPass, and enables the timestamp queries of passes
+            //! that don't have them enabled yet. The results are read without waiting for the GPU, so they are from a frame that
+            //! completed a few frames ago. The range of a parent pass is the union of the ranges of its children.
+            //! The returned timestamps are in depth first order and are valid until the next call.
+            const AZStd::vector<PassTimestamp>& CollectPassTimestamps(RPI::ParentPass* rootPass);
+
+            //! Records the timestamps of the last call to CollectPassTimestamps() as regions of a "GPU" track of the AZ::Debug::Profiler.
+            //! The GPU timestamps are mapped to CPU ticks with an estimated offset, because the RHI doesn't provide a calibration
+            //! between the two clocks. The offset follows the smallest observed delay between the end of the GPU work and the
+            //! readback, so it's accurate to about a frame.
+            void RecordPassTimestampsToProfiler();
+
             //! Measures the total time spent inside the GPU when rendering one frame.
             //! if @m_measureGpuTime is false this function returns 0.
             //! Remark: If running at 300fps, calling this function per frame can cause
@@ -125,7 +153,20 @@ namespace AZ
             //! Interpolates the values of the PassEntries from the previous frame.
             void InterpolatePassEntries(AZStd::unordered_map<Name, PassEntry>& passEntryDatabase, float weight) const;
 
+            //! Adds the timestamp of @pass and its children, and returns the range of the pass.
+            RPI::TimestampResult CollectPassTimestampsRecursive(RPI::Pass* pass, int32_t parentIndex, uint16_t depth);
+
             bool m_measureGpuTime = false;
+
+            bool m_collectPassTimestamps = false;
+            AZStd::vector<PassTimestamp> m_passTimestamps;
+            //! End of the last frame that was recorded in GPU ticks, to skip frames whose results weren't updated yet.
+            uint64_t m_lastRecordedGpuEndTick = 0;
+            //! GPU ticks are mapped to CPU ticks relative to m_gpuBaseTick, which is the first recorded GPU tick,
+            //! and m_gpuBaseCpuTick, which is the estimated CPU tick at that time.
+            uint64_t m_gpuBaseTick = 0;
+            double m_gpuBaseCpuTick = 0.0;
+            double m_cpuTicksPerGpuTick = 0.0;
  
         };
 
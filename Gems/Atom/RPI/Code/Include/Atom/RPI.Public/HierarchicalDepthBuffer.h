@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! A pyramid of the depth a view rendered in a previous frame, which is used to cull objects that were hidden behind it.
+        //! Each texel of a mip holds the farthest depth of the four texels it covers in the mip above, so a bounding box is tested
+        //! conservatively against a handful of texels from the mip that matches its size on screen.
+        //! The results have the latency of the depth it's built from, objects that become visible are drawn a frame late.
+        class HierarchicalDepthBuffer
+        {
+        public:
+            //! Builds the pyramid from the linear depth of a view.
+            //! @param linearDepth the view space distance of each texel, in rows from the top of the view
+            //! @param worldToClip the world to clip matrix of the view when the depth was rendered
+            void Update(AZStd::span<const float> linearDepth, uint32_t width, uint32_t height, const Matrix4x4& worldToClip);
+
+            //! Releases the pyramid, after which nothing is reported as occluded.
+            void Reset();
+
+            bool IsValid() const;
+
+            //! Returns true if the bounding box was completely hidden behind the depth.
+            bool IsOccluded(const Aabb& aabb) const;
+
+            //! Returns true if the NDC rect, whose closest point is at the view space distance, was completely hidden behind the depth.
+            bool IsOccluded(float ndcMinX, float ndcMinY, float ndcMaxX, float ndcMaxY, float minDepth) const;
+
+        private:
+            struct Mip
+            {
+                uint32_t m_width = 0;
+                uint32_t m_height = 0;
+                AZStd::vector<float> m_depth;
+            };
+
+            AZStd::vector<Mip> m_mips;
+            Matrix4x4 m_worldToClip = Matrix4x4::CreateIdentity();
+        };
+    } // namespace RPI
+} // namespace AZ
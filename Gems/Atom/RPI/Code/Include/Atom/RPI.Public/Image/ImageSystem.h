@@ -22,6 +22,7 @@
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
 #include <Atom/RPI.Public/Image/AttachmentImagePool.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Image/StreamingImageFeedback.h>
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
 
 #include <AtomCore/Instance/Instance.h>
@@ -34,6 +35,11 @@ namespace AZ
         class AssetHandler;
     }
 
+    namespace RHI
+    {
+        class FrameGraphBuilder;
+    }
+
     namespace RPI
     {
         class ImageSystem final
@@ -51,6 +57,10 @@ namespace AZ
             //! performed during this call.
             void Update() override;
 
+            //! Applies the latest GPU feedback of the sampled mip levels to the streaming image pools, and adds the scope
+            //! reading back the feedback of the frame. Called once per frame, before the passes are added to the frame graph.
+            void FrameUpdate(RHI::FrameGraphBuilder& frameGraphBuilder);
+
             //////////////////////////////////////////////////////////////////////////
             // ImageSystemInterface
             const Data::Instance<Image>& GetSystemImage(SystemImage systemImage) const override;
@@ -61,6 +71,7 @@ namespace AZ
             bool RegisterAttachmentImage(AttachmentImage* attachmentImage) override;
             void UnregisterAttachmentImage(AttachmentImage* attachmentImage) override;
             Data::Instance<AttachmentImage> FindRegisteredAttachmentImage(const Name& uniqueName) const override;
+            const StreamingImageFeedback* GetStreamingImageFeedback() const override;
             //////////////////////////////////////////////////////////////////////////
 
         private:
@@ -81,6 +92,10 @@ namespace AZ
             AZStd::shared_mutex m_systemAttachmentImagesUpdateMutex;
             AZStd::unordered_map<RHI::Format, Data::Instance<AttachmentImage>> m_systemAttachmentImages;
 
+            // The GPU feedback of the sampled mip levels, created while r_streamingImageFeedback is enabled
+            AZStd::unique_ptr<StreamingImageFeedback> m_streamingImageFeedback;
+            AZStd::vector<uint16_t> m_requestedMips;
+
             bool m_initialized = false;
 
             // a collections of registered attachment images
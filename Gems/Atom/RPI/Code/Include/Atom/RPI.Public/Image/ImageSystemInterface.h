@@ -22,6 +22,7 @@ namespace AZ
         class AttachmentImage;
         class AttachmentImagePool;
         class StreamingImagePool;
+        class StreamingImageFeedback;
 
         enum class SystemImage : uint32_t
         {
@@ -85,6 +86,9 @@ namespace AZ
             virtual Data::Instance<AttachmentImage> FindRegisteredAttachmentImage(const Name& uniqueName) const = 0;
 
             virtual void Update() = 0;
+
+            //! Returns the GPU feedback of the sampled mip levels of the streaming images, or null if r_streamingImageFeedback is disabled.
+            virtual const StreamingImageFeedback* GetStreamingImageFeedback() const = 0;
         };
     }
 }
@@ -12,6 +12,7 @@
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/intrusive_list.h>
+#include <AzCore/std/limits.h>
 
 #include <Atom/RHI.Reflect/Limits.h>
 
@@ -67,6 +68,11 @@ namespace AZ
 
             // Tracks the last timestamp the image was requested.
             AZStd::atomic_size_t m_lastAccessTimestamp = {0};
+
+            // Tracks the last timestamp the GPU feedback reported the image as sampled, or NoFeedbackTimestamp if it never did.
+            // Only accessed by the controller while it holds its context mutex.
+            static constexpr size_t NoFeedbackTimestamp = AZStd::numeric_limits<size_t>::max();
+            size_t m_lastFeedbackTimestamp = NoFeedbackTimestamp;
         };
 
         using StreamingImageContextPtr = AZStd::intrusive_ptr<StreamingImageContext>;
@@ -13,6 +13,7 @@
 #include <AzCore/std/containers/set.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/parallel/mutex.h>
 
 #include <Atom/RPI.Public/Image/StreamingImage.h>
@@ -60,6 +61,12 @@ namespace AZ
             void OnSetTargetMip(StreamingImage* image, uint16_t targetMipLevel);
             void OnMipChainAssetReady(StreamingImage* image);
 
+            //! Sets the target mip of the images from the mip levels the GPU sampled, indexed by the bindless read index of
+            //! their image view. See StreamingImageFeedback.
+            //! The images which stop being sampled drop to their least detailed mip chain after r_streamingImageFeedbackTimeout updates.
+            //! The images never reported by the feedback keep the target mip set with StreamingImage::SetTargetMip().
+            void ApplyMipFeedback(AZStd::span<const uint16_t> requestedMips);
+
             //! Returns the number of images which are expanding their mipmaps
             uint32_t GetExpandingImageCount() const;
 
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI/CopyItem.h>
+#include <Atom/RHI/Fence.h>
+#include <Atom/RHI/ScopeProducer.h>
+#include <Atom/RHI.Reflect/Limits.h>
+
+#include <AtomCore/Instance/Instance.h>
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        class FrameGraphBuilder;
+    }
+
+    namespace RPI
+    {
+        class Buffer;
+
+        //! Collects the mip levels at which shaders sample the streaming images, so the streaming controllers can keep only the
+        //! mips that are actually drawn.
+        //!
+        //! Shaders write to a buffer of the scene SRG with one entry per bindless texture index, see TextureStreamingFeedback.azsli:
+        //!     RWStructuredBuffer<uint> m_textureStreamingFeedback;
+        //!     uint m_textureStreamingFeedbackFrame;
+        //! An entry holds the frame number in the high 28 bits and 15 - mip in the low 4 bits, and shaders write it with
+        //! InterlockedMax. So the entry holds the most detailed mip of the most recent frame, and the buffer never needs clearing.
+        //! At the start of each frame the buffer is copied to a readback buffer, which the CPU reads once the copy is complete.
+        //! The feedback is keyed by the bindless read index of the image views, see RHI::ImageView::GetBindlessReadIndex().
+        class StreamingImageFeedback final
+            : public RHI::ScopeProducer
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(StreamingImageFeedback, AZ::SystemAllocator);
+
+            //! The requested mip of the textures which weren't sampled during the frame.
+            static constexpr uint16_t NoRequest = 0xFFFF;
+
+            StreamingImageFeedback();
+            ~StreamingImageFeedback() override;
+
+            //! Creates the feedback buffer with one entry per bindless texture index in [0, entryCount).
+            bool Init(uint32_t entryCount);
+            void Shutdown();
+
+            //! Starts a new feedback frame, and adds the scope copying the feedback of the previous frame to the frame graph.
+            //! Must be called before the scopes that write feedback are added.
+            void FrameUpdate(RHI::FrameGraphBuilder& frameGraphBuilder);
+
+            //! Reads the feedback of the most recent frame that reached the CPU, as the requested mip level per bindless texture index.
+            //! Returns false if no new feedback arrived since the last call.
+            bool ReadFeedback(AZStd::vector<uint16_t>& requestedMipsOut);
+
+            //! The buffer shaders write the feedback to, and the frame number they write with.
+            const Data::Instance<Buffer>& GetFeedbackBuffer() const;
+            uint32_t GetFeedbackFrame() const;
+
+        private:
+            ///////////////////////////////////////////////////////////////////
+            // RHI::ScopeProducer overrides
+            void SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph) override;
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
+            void BuildCommandList(const RHI::FrameGraphExecuteContext& context) override;
+            ///////////////////////////////////////////////////////////////////
+
+            struct Readback
+            {
+                Data::Instance<Buffer> m_buffer;
+                RHI::Ptr<RHI::Fence> m_fence;
+                // The feedback frame the copy holds
+                uint32_t m_frame = 0;
+                bool m_isPending = false;
+            };
+
+            Data::Instance<Buffer> m_feedbackBuffer;
+            AZStd::array<Readback, RHI::Limits::Device::FrameCountMax> m_readbacks;
+            uint32_t m_readbackIndex = 0;
+            uint32_t m_entryCount = 0;
+
+            // Starts at 1, as the buffer is created with zeros
+            uint32_t m_frame = 1;
+
+            RHI::CopyItem m_copyItem;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -87,6 +87,9 @@ namespace AZ
             // Updates the streaming controller (ticked by the system component).
             void Update();
 
+            // Forwards the mip levels sampled by the GPU to the streaming controller.
+            void ApplyMipFeedback(AZStd::span<const uint16_t> requestedMips);
+
             ///////////////////////////////////////////////////////////////////
             // Private API for StreamingImage
             void AttachImage(StreamingImage* image);
@@ -95,6 +95,11 @@ namespace AZ
             //! Does nothing if NeedsCompile() is false or CanCompile() is false.
             //! @return whether compilation occurred
             bool Compile();
+
+            //! Alternative to Compile() for materials that change often, like the ones with animated properties.
+            //! The material is compiled with the other queued materials, in parallel, before the scenes are simulated.
+            //! Materials that can't be compiled yet stay queued until they can.
+            void QueueCompile();
             
             //! Returns an ID that can be used to track whether the material has changed since the last time client code read it.
             //! This gets incremented every time a change is made, like by calling SetPropertyValue().
@@ -181,6 +186,10 @@ namespace AZ
                 const MaterialPropertyValue & value,
                 const MaterialPropertyOutputId & connection);
 
+            //! Queues the loading of the shader variants the material selects, so they are more likely to be ready by the
+            //! time a draw packet is built with them instead of falling back to the root variant.
+            void PrefetchShaderVariants();
+
             void ProcessDirectConnections();
             void ProcessMaterialFunctors();
             void ProcessInternalDirectConnections();
@@ -216,8 +225,16 @@ namespace AZ
             //! Records the m_currentChangeId when the material was last compiled.
             ChangeId m_compiledChangeId = DEFAULT_CHANGE_ID;
 
+            //! The property values when the material was last compiled. Properties that are set back to these values, for example
+            //! by an animation, don't need to run the functors and compile the shader resource group again.
+            AZStd::vector<MaterialPropertyValue> m_compiledPropertyValues;
+
             bool m_isInitializing = false;
 
+            //! Set while a reinitialization for arrived shader variants is queued, so the variants that arrive in the same
+            //! frame reinitialize the material, and rebuild its draw packets, only once.
+            bool m_isShaderVariantReinitQueued = false;
+
             MaterialPropertyPsoHandling m_psoHandling = MaterialPropertyPsoHandling::Warning;
         };
 
@@ -9,21 +9,42 @@
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 
+#include <AtomCore/Instance/Instance.h>
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
 namespace AZ
 {
     class ReflectContext;
 
     namespace RPI
     {
+        class Material;
+
         //! Manages system-wide initialization and support for material classes
         class MaterialSystem
         {
         public:
+            static MaterialSystem* Get();
+
             static void Reflect(AZ::ReflectContext* context);
             static void GetAssetHandlers(AssetHandlerPtrList& assetHandlers);
 
             void Init();
             void Shutdown();
+
+            //! Queues a material to be compiled with the other materials queued this frame. See Material::QueueCompile().
+            void QueueCompile(const Data::Instance<Material>& material);
+
+            //! Compiles the queued materials. When there are enough of them, they are compiled in parallel across the task executor,
+            //! with one task per material type since the materials of a type share their functors. Materials that can't be
+            //! compiled yet stay queued for the next frame. Called once per frame before the scenes are simulated.
+            void CompileQueuedMaterials();
+
+        private:
+            AZStd::mutex m_compileQueueMutex;
+            AZStd::vector<Data::Instance<Material>> m_compileQueue;
         };
 
     } // namespace RPI
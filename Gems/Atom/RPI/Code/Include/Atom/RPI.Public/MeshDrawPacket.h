@@ -45,6 +45,12 @@ namespace AZ
 
             using ShaderList = AZStd::vector<ShaderData>;
 
+            //! The value of the bindless material id of draw packets that aren't in a bindless material table
+            static constexpr uint32_t InvalidBindlessMaterialId = 0xFFFFFFFF;
+
+            //! The name of the draw SRG constant that receives the bindless material id, shaders that don't declare it ignore the id
+            static constexpr const char* BindlessMaterialIdSrgName = "m_bindlessMaterialId";
+
             MeshDrawPacket() = default;
             MeshDrawPacket(
                 ModelLod& modelLod,
@@ -63,6 +69,8 @@ namespace AZ
 
             void SetStencilRef(uint8_t stencilRef);
             void SetSortKey(RHI::DrawItemSortKey sortKey);
+            //! Sets the index of the material in a table of material parameters, see BindlessMaterialIdSrgName
+            void SetBindlessMaterialId(uint32_t bindlessMaterialId);
             bool SetShaderOption(const Name& shaderOptionName, RPI::ShaderOptionValue value);
             bool UnsetShaderOption(const Name& shaderOptionName);
             void ClearShaderOptions();
@@ -119,6 +127,9 @@ namespace AZ
             // Set the stencil value for this draw packet
             uint8_t m_stencilRef = 0;
 
+            // The index of the material in a bindless material table, which is passed to the shaders through the draw SRG
+            uint32_t m_bindlessMaterialId = InvalidBindlessMaterialId;
+
             //! A map matches the index of UV names of this material to the custom names from the model.
             MaterialModelUvOverrideMap m_materialModelUvMap;
 
@@ -14,6 +14,7 @@
 #include <Atom/RPI.Reflect/Model/ModelLodIndex.h>
 
 #include <Atom/RPI.Public/Model/ModelLod.h>
+#include <Atom/RPI.Public/Model/ModelLodResidency.h>
 
 #include <AtomCore/Instance/InstanceData.h>
 
@@ -30,6 +31,7 @@ namespace AZ
             : public Data::InstanceData
         {
             friend class ModelSystem;
+            friend class ModelLodStreamingController;
 
         public:
             AZ_INSTANCE_DATA(Model, "{C30F5522-B381-4B38-BBAF-6E0B1885C8B9}");
@@ -41,7 +43,7 @@ namespace AZ
             //! This is a temporary function, that will be removed once the Model/ModelAsset classes no longer need it
             static void TEMPOrphanFromDatabase(const Data::Asset<ModelAsset>& modelAsset);
 
-            ~Model() = default;
+            ~Model();
 
             //! Blocks the CPU until the streaming upload is complete. Returns immediately if no
             //! streaming upload is currently pending.
@@ -56,6 +58,17 @@ namespace AZ
             //! Returns whether a buffer upload is pending.
             bool IsUploadPending() const;
 
+            //! Lets the ModelLodStreamingController evict the buffers of the lods which are not drawn. While streaming is enabled,
+            //! the lods must only be drawn through a Cullable that uses GetLodResidency(). Has no effect after DisableLodStreaming().
+            void EnableLodStreaming();
+
+            //! Stops streaming the lods, and blocks until all of them are resident. Used by systems that access the buffers of
+            //! any lod directly, like skinning. Streaming stays disabled for the lifetime of the model.
+            void DisableLodStreaming();
+
+            //! Returns the lod residency the culling uses to draw resident lods, or nullptr if lod streaming is not enabled.
+            ModelLodResidency* GetLodResidency();
+
             const Data::Asset<ModelAsset>& GetModelAsset() const;
 
             //! Checks a ray for intersection against this model. The ray must be in the same coordinate space as the model.
@@ -106,6 +119,15 @@ namespace AZ
 
             // Tracks whether buffers have all been streamed up to the GPU.
             bool m_isUploadPending = false;
+
+            enum class LodStreamingState : uint8_t
+            {
+                Allowed,
+                Enabled,
+                Disabled
+            };
+            AZStd::atomic<LodStreamingState> m_lodStreamingState{ LodStreamingState::Allowed };
+            ModelLodResidency m_lodResidency;
         };
     } // namespace RPI
 } // namespace AZ
@@ -93,6 +93,19 @@ namespace AZ
             //! Blocks the CPU until pending buffer uploads have completed.
             void WaitForUpload();
 
+            //! Releases the GPU memory of the buffers of the lod, see Buffer::Evict(). The draw items of the lod must not be
+            //! submitted until the buffers are resident again.
+            void EvictBuffers();
+
+            //! Starts streaming the buffers of an evicted lod back to the GPU.
+            bool MakeBuffersResident();
+
+            //! Returns true if all the buffers are on the GPU and their uploads have completed.
+            bool AreBuffersResident() const;
+
+            //! Returns the size of the buffers of the lod.
+            uint64_t GetBufferByteCount() const;
+
             AZStd::span<const Mesh> GetMeshes() const;
 
             //! Compares a ShaderInputContract to the mesh's available streams, and if any of them are optional, sets the corresponding "*_isBound" shader option.
@@ -158,7 +171,7 @@ namespace AZ
             // so we need to check if the buffer is already tracked before we add it
             // to the list.
             // @return the index of the buffer in m_buffers
-            uint32_t TrackBuffer(const Data::Instance<Buffer>& buffer);
+            uint32_t TrackBuffer(const Data::Instance<Buffer>& buffer, const Data::Asset<BufferAsset>& bufferAsset);
 
             // Collection of buffers grouped by payload
             // Provides buffer views backed by data in m_buffers;
@@ -167,6 +180,9 @@ namespace AZ
             // The buffer instances loaded by this ModelLod
             AZStd::vector<Data::Instance<Buffer>> m_buffers;
 
+            // The asset of each buffer in m_buffers, used to make evicted buffers resident again.
+            AZStd::vector<Data::Asset<BufferAsset>> m_bufferAssets;
+
             // Tracks whether buffers have all been streamed up to the GPU.
             bool m_isUploadPending = false;
 
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+
+#include <stdint.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Tracks which lods of a streamed model have their buffers on the GPU. It is shared between the culling, which
+        //! requests a lod for each view and only draws resident lods, and the ModelLodStreamingController, which evicts
+        //! and uploads the lods. The resident lods always range from the most detailed resident lod to the least detailed
+        //! lod of the model, so the least detailed lod is always resident.
+        class ModelLodResidency
+        {
+        public:
+            void Init(uint32_t lodCount)
+            {
+                m_lodCount = lodCount;
+                m_mostDetailedResidentLod = 0;
+                m_mostDetailedRequestedLod = lodCount;
+            }
+
+            uint32_t GetLodCount() const
+            {
+                return m_lodCount;
+            }
+
+            //! Records that a view selected the lod, and returns the lod to draw instead: the lod itself if it is resident,
+            //! otherwise the most detailed resident lod. May be called from any thread.
+            uint32_t RequestLod(uint32_t lodIndex)
+            {
+                uint32_t requestedLod = m_mostDetailedRequestedLod.load(AZStd::memory_order_relaxed);
+                while (lodIndex < requestedLod &&
+                       !m_mostDetailedRequestedLod.compare_exchange_weak(requestedLod, lodIndex, AZStd::memory_order_relaxed))
+                {
+                }
+                return AZStd::max(lodIndex, m_mostDetailedResidentLod.load(AZStd::memory_order_acquire));
+            }
+
+            //! Returns the most detailed lod requested since the last call, or the lod count if no lod was requested.
+            uint32_t TakeMostDetailedRequestedLod()
+            {
+                return m_mostDetailedRequestedLod.exchange(m_lodCount, AZStd::memory_order_relaxed);
+            }
+
+            uint32_t GetMostDetailedResidentLod() const
+            {
+                return m_mostDetailedResidentLod.load(AZStd::memory_order_acquire);
+            }
+
+            void SetMostDetailedResidentLod(uint32_t lodIndex)
+            {
+                m_mostDetailedResidentLod.store(lodIndex, AZStd::memory_order_release);
+            }
+
+        private:
+            uint32_t m_lodCount = 0;
+            AZStd::atomic<uint32_t> m_mostDetailedResidentLod{ 0 };
+            AZStd::atomic<uint32_t> m_mostDetailedRequestedLod{ 0 };
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Reflect/Model/ModelLodAsset.h>
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Model;
+
+        //! Streams the lods of the models that enabled lod streaming, see Model::EnableLodStreaming().
+        //! Lods are requested by the culling each frame based on their screen coverage. Each update evicts the buffers of
+        //! the lods which were not requested for a while, and uploads the next more detailed lod of the models which
+        //! request more detail than what is resident, prioritizing the models missing the most lods. The uploads stop
+        //! once the resident buffers reach the memory budget.
+        //! The buffers are evicted and re-initialized in place, so the draw packets built for the lods stay valid.
+        class ModelLodStreamingController
+        {
+        public:
+            AZ_RTTI(ModelLodStreamingController, "{CF1787ED-F369-4AD9-90A3-7E0C38FEA762}");
+            AZ_CLASS_ALLOCATOR(ModelLodStreamingController, AZ::SystemAllocator);
+
+            static ModelLodStreamingController* Get();
+
+            ModelLodStreamingController() = default;
+            virtual ~ModelLodStreamingController() = default;
+
+            void Init();
+            void Shutdown();
+
+            //! Starts streaming the lods of the model. All the lods of the model are expected to be resident.
+            void AttachModel(Model& model);
+
+            //! Stops streaming the lods of the model. Evicted lods stay evicted.
+            void DetachModel(Model& model);
+
+            //! Updates the residency of the lods with the requests of the last frame. Must be called between frames,
+            //! when no culling is in progress.
+            void Update();
+
+            //! Returns the size of the resident buffers of the streamed models.
+            uint64_t GetResidentByteCount() const;
+
+        private:
+            struct StreamingModel
+            {
+                Model* m_model = nullptr;
+
+                // The last frame at which each lod was the most detailed lod requested for the model
+                AZStd::fixed_vector<uint64_t, ModelLodAsset::LodCountMax> m_lodRequestFrames;
+
+                // The lod whose buffers are being uploaded, or the lod count if none
+                uint32_t m_expandingLod = 0;
+            };
+
+            // Returns the most detailed lod requested within the eviction delay
+            uint32_t GetTargetLod(const StreamingModel& streamingModel) const;
+
+            AZStd::mutex m_mutex;
+            AZStd::vector<StreamingModel> m_models;
+            uint64_t m_frame = 0;
+            uint64_t m_residentByteCount = 0;
+        };
+    } // namespace RPI
+} // namespace AZ
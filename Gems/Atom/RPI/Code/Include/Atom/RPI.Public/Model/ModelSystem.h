@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
+#include <Atom/RPI.Public/Model/ModelLodStreamingController.h>
 
 namespace AZ
 {
@@ -24,6 +25,12 @@ namespace AZ
 
             void Init();
             void Shutdown();
+
+            //! Updates the residency of the streamed model lods. Called between frames.
+            void Update();
+
+        private:
+            ModelLodStreamingController m_lodStreamingController;
         };
     } // namespace RPI
 } // namespace AZ
@@ -9,6 +9,7 @@
 
 #include <Atom/RHI.Reflect/Handle.h>
 #include <Atom/RHI.Reflect/Scissor.h>
+#include <Atom/RHI.Reflect/VariableRateShadingEnums.h>
 #include <Atom/RHI.Reflect/Viewport.h>
 
 #include <Atom/RPI.Public/Pass/PassUtils.h>
@@ -45,6 +46,11 @@ namespace AZ
 
             uint32_t GetDrawItemCount();
 
+            //! Sets the shading rate used for all the draws of this pass. Falls back to Rate1x1 if the device
+            //! doesn't support the rate as a per-draw shading rate.
+            void SetShadingRate(RHI::ShadingRate shadingRate);
+            RHI::ShadingRate GetShadingRate() const;
+
         protected:
             explicit RasterPass(const PassDescriptor& descriptor);
 
@@ -82,6 +88,7 @@ namespace AZ
             bool m_overrideScissorSate = false;
             bool m_overrideViewportState = false;
             uint32_t m_drawItemCount = 0;
+            RHI::ShadingRate m_shadingRate = RHI::ShadingRate::Rate1x1;
         };
     }   // namespace RPI
 }   // namespace AZ
@@ -305,6 +305,10 @@ namespace AZ
             RHI::ShaderInputNameIndex m_prevTimeInputIndex = "m_prevTime";
             float m_prevSimulationTime = 0.0;
             uint16_t m_numActiveRenderPipelines = 0;
+
+            // The texture streaming feedback is only bound when the scene srg declares it, see StreamingImageFeedback
+            RHI::ShaderInputBufferIndex m_textureStreamingFeedbackIndex;
+            RHI::ShaderInputConstantIndex m_textureStreamingFeedbackFrameIndex;
         };
 
         // --- Template functions ---
@@ -12,6 +12,7 @@
 #include <Atom/RHI/DrawListContext.h>
 
 #include <Atom/RPI.Public/Base.h>
+#include <Atom/RPI.Public/HierarchicalDepthBuffer.h>
 #include <Atom/RPI.Public/Pass/Pass.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/VisibleObjectContext.h>
@@ -57,6 +58,15 @@ namespace AZ
                 UsageReflectiveCubeMap = (1u << 2),
                 UsageXR = (1u << 3)
             };
+
+            //! Selects how the view culls objects that are hidden behind others
+            enum class OcclusionCullingMode : uint8_t
+            {
+                //! Rasterizes the occlusion planes of the culling scene on the CPU, every frame
+                MaskedSoftware,
+                //! Tests against the depth pyramid of a previous frame, see GetHierarchicalDepthBuffer()
+                HierarchicalDepth,
+            };
             //! Only use this function to create a new view object. And force using smart pointer to manage view's life time
             static ViewPtr CreateView(const AZ::Name& name, UsageFlags usage);
 
@@ -172,6 +182,14 @@ namespace AZ
             //! Returns the masked occlusion culling interface
             MaskedOcclusionCulling* GetMaskedOcclusionCulling();
 
+            void SetOcclusionCullingMode(OcclusionCullingMode mode) { m_occlusionCullingMode = mode; }
+            OcclusionCullingMode GetOcclusionCullingMode() const { return m_occlusionCullingMode; }
+
+            //! Returns the depth pyramid used by the HierarchicalDepth occlusion culling mode.
+            //! Whatever reads back the depth of the view updates it, before the culling of the next frame begins.
+            HierarchicalDepthBuffer& GetHierarchicalDepthBuffer() { return m_hierarchicalDepthBuffer; }
+            const HierarchicalDepthBuffer& GetHierarchicalDepthBuffer() const { return m_hierarchicalDepthBuffer; }
+
             //! This is called by RenderPipeline when this view is added to the pipeline.
             void OnAddToRenderPipeline();
 
@@ -246,6 +264,9 @@ namespace AZ
             // Masked Occlusion Culling interface
             MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
 
+            OcclusionCullingMode m_occlusionCullingMode = OcclusionCullingMode::MaskedSoftware;
+            HierarchicalDepthBuffer m_hierarchicalDepthBuffer;
+
             AZStd::atomic_uint32_t m_andFlags{ 0xFFFFFFFF };
             AZStd::atomic_uint32_t m_orFlags { 0x00000000 };
         };
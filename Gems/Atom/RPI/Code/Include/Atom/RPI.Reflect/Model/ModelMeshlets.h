@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <stdint.h>
+
+namespace AZ
+{
+    class Vector3;
+
+    namespace RPI
+    {
+        //! The shader semantics of the optional meshlet streams of a mesh.
+        static constexpr const char ShaderSemanticName_Meshlets[] = "MESHLETS";
+        static constexpr const char ShaderSemanticName_MeshletVertices[] = "MESHLET_VERTICES";
+        static constexpr const char ShaderSemanticName_MeshletTriangles[] = "MESHLET_TRIANGLES";
+
+        //! A cluster of neighboring triangles of a mesh, with the bounds used to cull it as a whole.
+        //! The layout matches the structured buffer of the MESHLETS stream.
+        struct Meshlet
+        {
+            //! The first index of the meshlet in the MESHLET_VERTICES stream, which holds the mesh vertex index of each meshlet vertex.
+            uint32_t m_vertexOffset = 0;
+            //! The first triangle of the meshlet in the MESHLET_TRIANGLES stream. Each triangle packs its three meshlet vertex indices
+            //! in the low three bytes of a 32 bit word.
+            uint32_t m_triangleOffset = 0;
+            uint32_t m_vertexCount = 0;
+            uint32_t m_triangleCount = 0;
+
+            //! The bounding sphere of the meshlet vertices.
+            float m_center[3] = { 0.0f, 0.0f, 0.0f };
+            float m_radius = 0.0f;
+
+            //! The normal cone of the triangles. The meshlet faces away from a camera at position p
+            //! when dot(m_center - p, m_coneAxis) >= m_coneCutoff * length(m_center - p) + m_radius.
+            //! A cutoff of 1 or more means the triangles face too many directions to be culled by the cone.
+            float m_coneAxis[3] = { 0.0f, 0.0f, 0.0f };
+            float m_coneCutoff = 1.0f;
+        };
+        static_assert(sizeof(Meshlet) == 48, "The meshlet must match the layout of the MESHLETS stream");
+
+        //! The meshlets of one mesh.
+        struct ModelMeshlets
+        {
+            AZStd::vector<Meshlet> m_meshlets;
+            AZStd::vector<uint32_t> m_vertexIndices;
+            AZStd::vector<uint32_t> m_triangles;
+        };
+
+        //! The limits of a meshlet, which match what mesh shader hardware processes efficiently per thread group.
+        static constexpr uint32_t MeshletMaxVertexCount = 64;
+        static constexpr uint32_t MeshletMaxTriangleCount = 124;
+
+        //! Splits a triangle list into meshlets, keeping the triangles in their order and starting a new meshlet once the current
+        //! one runs out of vertices or triangles. Meshes are expected to be optimized for vertex cache locality, so consecutive
+        //! triangles share vertices.
+        //! @param indices the triangle list, 3 indices per triangle
+        //! @param positions 3 floats per vertex
+        ModelMeshlets BuildModelMeshlets(
+            AZStd::span<const uint32_t> indices,
+            AZStd::span<const float> positions,
+            uint32_t maxVertexCount = MeshletMaxVertexCount,
+            uint32_t maxTriangleCount = MeshletMaxTriangleCount);
+
+        //! Returns true if all the triangles of the meshlet face away from the camera position.
+        bool IsMeshletBackFacing(const Meshlet& meshlet, const Vector3& cameraPosition);
+    } // namespace RPI
+} // namespace AZ
@@ -9,6 +9,7 @@
 
 #include <Atom/RHI.Reflect/Base.h>
 #include <Atom/RHI.Reflect/Scissor.h>
+#include <Atom/RHI.Reflect/VariableRateShadingEnums.h>
 #include <Atom/RHI.Reflect/Viewport.h>
 
 #include <Atom/RPI.Reflect/Asset/AssetReference.h>
@@ -39,6 +40,10 @@ namespace AZ
             RHI::Scissor m_overrideScissor = RHI::Scissor::CreateNull();
 
             RHI::DrawListSortType m_drawListSortType = RHI::DrawListSortType::KeyThenDepth;
+
+            //! Shading rate applied to all the draws of the pass. When the pass also has a ShadingRate attachment, the coarser
+            //! of the two rates is used. Ignored if the device doesn't support per-draw shading rates.
+            RHI::ShadingRate m_shadingRate = RHI::ShadingRate::Rate1x1;
         };
     } // namespace RPI
 } // namespace AZ
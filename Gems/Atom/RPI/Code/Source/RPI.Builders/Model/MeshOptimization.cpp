@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Model/MeshOptimization.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/limits.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace MeshOptimization
+        {
+            namespace
+            {
+                // Size of the simulated post-transform cache. Scores are tuned for an LRU cache of this size, which
+                // also works well for the FIFO caches and batch based reuse of current GPUs.
+                constexpr uint32_t CacheSize = 32;
+                constexpr float CacheDecayPower = 1.5f;
+                constexpr float LastTriangleScore = 0.75f;
+                constexpr float ValenceBoostScale = 2.0f;
+                constexpr float ValenceBoostPower = 0.5f;
+
+                constexpr uint32_t InvalidIndex = AZStd::numeric_limits<uint32_t>::max();
+
+                float CalculateVertexScore(int32_t cachePosition, uint32_t remainingTriangleCount)
+                {
+                    if (remainingTriangleCount == 0)
+                    {
+                        // No triangle needs this vertex anymore.
+                        return -1.0f;
+                    }
+
+                    float score = 0.0f;
+                    if (cachePosition >= 0)
+                    {
+                        if (cachePosition < 3)
+                        {
+                            // The vertices of the last triangle get a fixed score, so the next triangle doesn't just reuse
+                            // the edge that was emitted last.
+                            score = LastTriangleScore;
+                        }
+                        else
+                        {
+                            const float scaler = 1.0f / (CacheSize - 3);
+                            score = powf(1.0f - (cachePosition - 3) * scaler, CacheDecayPower);
+                        }
+                    }
+
+                    // Boost vertices with few remaining triangles, so they get finished instead of leaving lone triangles behind.
+                    score += ValenceBoostScale * powf(static_cast<float>(remainingTriangleCount), -ValenceBoostPower);
+                    return score;
+                }
+            } // namespace
+
+            void OptimizeVertexCache(AZStd::vector<uint32_t>& indices, size_t vertexCount)
+            {
+                const size_t triangleCount = indices.size() / 3;
+                if (triangleCount < 2 || (indices.size() % 3) != 0)
+                {
+                    return;
+                }
+
+                AZStd::vector<uint32_t> remainingTriangleCounts(vertexCount, 0);
+                for (uint32_t index : indices)
+                {
+                    if (index >= vertexCount)
+                    {
+                        AZ_Warning("MeshOptimization", false, "Index %u is out of range for %zu vertices, skipping vertex cache optimization.",
+                            index, vertexCount);
+                        return;
+                    }
+                    ++remainingTriangleCounts[index];
+                }
+
+                // Build the list of triangles that use each vertex.
+                AZStd::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+                for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+                {
+                    adjacencyOffsets[vertex + 1] = adjacencyOffsets[vertex] + remainingTriangleCounts[vertex];
+                }
+                AZStd::vector<uint32_t> adjacentTriangles(indices.size());
+                {
+                    AZStd::vector<uint32_t> fillOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+                    for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+                    {
+                        for (size_t corner = 0; corner < 3; ++corner)
+                        {
+                            adjacentTriangles[fillOffsets[indices[triangle * 3 + corner]]++] = static_cast<uint32_t>(triangle);
+                        }
+                    }
+                }
+
+                AZStd::vector<int32_t> cachePositions(vertexCount, -1);
+                AZStd::vector<float> vertexScores(vertexCount);
+                for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+                {
+                    vertexScores[vertex] = CalculateVertexScore(-1, remainingTriangleCounts[vertex]);
+                }
+
+                AZStd::vector<float> triangleScores(triangleCount);
+                AZStd::vector<bool> isTriangleEmitted(triangleCount, false);
+                uint32_t bestTriangle = InvalidIndex;
+                float bestScore = -1.0f;
+                for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+                {
+                    triangleScores[triangle] = vertexScores[indices[triangle * 3]] + vertexScores[indices[triangle * 3 + 1]] +
+                        vertexScores[indices[triangle * 3 + 2]];
+                    if (triangleScores[triangle] > bestScore)
+                    {
+                        bestScore = triangleScores[triangle];
+                        bestTriangle = static_cast<uint32_t>(triangle);
+                    }
+                }
+
+                AZStd::vector<uint32_t> optimizedIndices;
+                optimizedIndices.reserve(indices.size());
+
+                AZStd::array<uint32_t, CacheSize + 3> cache;
+                size_t cacheCount = 0;
+                size_t nextUnemittedTriangle = 0;
+
+                while (bestTriangle != InvalidIndex)
+                {
+                    isTriangleEmitted[bestTriangle] = true;
+                    const uint32_t* triangleIndices = &indices[bestTriangle * 3];
+                    optimizedIndices.insert(optimizedIndices.end(), triangleIndices, triangleIndices + 3);
+
+                    // Remove the emitted triangle from the adjacency of its vertices.
+                    for (size_t corner = 0; corner < 3; ++corner)
+                    {
+                        const uint32_t vertex = triangleIndices[corner];
+                        uint32_t* vertexTriangles = &adjacentTriangles[adjacencyOffsets[vertex]];
+                        const uint32_t count = remainingTriangleCounts[vertex];
+                        for (uint32_t i = 0; i < count; ++i)
+                        {
+                            if (vertexTriangles[i] == bestTriangle)
+                            {
+                                vertexTriangles[i] = vertexTriangles[count - 1];
+                                break;
+                            }
+                        }
+                        --remainingTriangleCounts[vertex];
+                    }
+
+                    // Move the vertices of the triangle to the front of the cache. The vertices pushed past the end
+                    // of the cache are kept in the list for this iteration, so their scores get updated too.
+                    AZStd::array<uint32_t, CacheSize + 3> newCache;
+                    size_t newCacheCount = 0;
+                    for (size_t corner = 0; corner < 3; ++corner)
+                    {
+                        const uint32_t vertex = triangleIndices[corner];
+                        if (AZStd::find(newCache.begin(), newCache.begin() + newCacheCount, vertex) == newCache.begin() + newCacheCount)
+                        {
+                            newCache[newCacheCount++] = vertex;
+                        }
+                    }
+                    const auto triangleVerticesEnd = newCache.begin() + newCacheCount;
+                    for (size_t i = 0; i < cacheCount; ++i)
+                    {
+                        const uint32_t vertex = cache[i];
+                        if (AZStd::find(newCache.begin(), triangleVerticesEnd, vertex) == triangleVerticesEnd)
+                        {
+                            newCache[newCacheCount++] = vertex;
+                        }
+                    }
+
+                    for (size_t i = 0; i < newCacheCount; ++i)
+                    {
+                        const uint32_t vertex = newCache[i];
+                        cachePositions[vertex] = (i < CacheSize) ? static_cast<int32_t>(i) : -1;
+
+                        const float newScore = CalculateVertexScore(cachePositions[vertex], remainingTriangleCounts[vertex]);
+                        const float scoreDelta = newScore - vertexScores[vertex];
+                        vertexScores[vertex] = newScore;
+
+                        const uint32_t* vertexTriangles = &adjacentTriangles[adjacencyOffsets[vertex]];
+                        for (uint32_t j = 0; j < remainingTriangleCounts[vertex]; ++j)
+                        {
+                            triangleScores[vertexTriangles[j]] += scoreDelta;
+                        }
+                    }
+
+                    cacheCount = AZStd::min<size_t>(newCacheCount, CacheSize);
+                    AZStd::copy(newCache.begin(), newCache.begin() + cacheCount, cache.begin());
+
+                    // Only triangles that use a cached vertex changed their score, so the best one is searched among those.
+                    bestTriangle = InvalidIndex;
+                    bestScore = -1.0f;
+                    for (size_t i = 0; i < cacheCount; ++i)
+                    {
+                        const uint32_t vertex = cache[i];
+                        const uint32_t* vertexTriangles = &adjacentTriangles[adjacencyOffsets[vertex]];
+                        for (uint32_t j = 0; j < remainingTriangleCounts[vertex]; ++j)
+                        {
+                            if (triangleScores[vertexTriangles[j]] > bestScore)
+                            {
+                                bestScore = triangleScores[vertexTriangles[j]];
+                                bestTriangle = vertexTriangles[j];
+                            }
+                        }
+                    }
+
+                    // None of the cached vertices have triangles left, continue with the next triangle in the original order.
+                    if (bestTriangle == InvalidIndex)
+                    {
+                        while (nextUnemittedTriangle < triangleCount && isTriangleEmitted[nextUnemittedTriangle])
+                        {
+                            ++nextUnemittedTriangle;
+                        }
+                        if (nextUnemittedTriangle < triangleCount)
+                        {
+                            bestTriangle = static_cast<uint32_t>(nextUnemittedTriangle);
+                        }
+                    }
+                }
+
+                AZ_Assert(optimizedIndices.size() == indices.size(), "Vertex cache optimization lost triangles.");
+                indices.swap(optimizedIndices);
+            }
+
+            AZStd::vector<uint32_t> OptimizeVertexFetch(AZStd::vector<uint32_t>& indices, size_t vertexCount)
+            {
+                AZStd::vector<uint32_t> vertexRemap(vertexCount, InvalidIndex);
+                uint32_t nextVertex = 0;
+                for (uint32_t& index : indices)
+                {
+                    AZ_Assert(index < vertexCount, "Index %u is out of range for %zu vertices.", index, vertexCount);
+                    if (vertexRemap[index] == InvalidIndex)
+                    {
+                        vertexRemap[index] = nextVertex++;
+                    }
+                    index = vertexRemap[index];
+                }
+
+                for (uint32_t& newPosition : vertexRemap)
+                {
+                    if (newPosition == InvalidIndex)
+                    {
+                        newPosition = nextVertex++;
+                    }
+                }
+                return vertexRemap;
+            }
+        } // namespace MeshOptimization
+    } // namespace RPI
+} // namespace AZ
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Reorders the triangles and vertices of indexed triangle lists, so the GPU can reuse more transformed vertices
+        //! and fetches the vertex streams more linearly. The rendered result is the same, apart from the order in which
+        //! overlapping triangles of a single draw are rasterized.
+        namespace MeshOptimization
+        {
+            //! Reorders the triangles of an indexed triangle list to reuse vertices while they're still in the post-transform
+            //! cache. This uses Tom Forsyth's linear-speed vertex cache optimization. Index lists that aren't made of whole
+            //! triangles, or that reference vertices beyond vertexCount, are left unchanged.
+            void OptimizeVertexCache(AZStd::vector<uint32_t>& indices, size_t vertexCount);
+
+            //! Orders the vertices by the first time the indices reference them and rewrites the indices to that order.
+            //! Vertices that aren't referenced are moved behind the referenced ones, keeping their relative order.
+            //! @return The new position of every vertex, indexed by its old position. Use it with RemapVertexStream.
+            AZStd::vector<uint32_t> OptimizeVertexFetch(AZStd::vector<uint32_t>& indices, size_t vertexCount);
+
+            //! Moves the elements of every vertex of a stream to the new vertex position from vertexRemap.
+            template<typename T>
+            void RemapVertexStream(AZStd::vector<T>& stream, const AZStd::vector<uint32_t>& vertexRemap, size_t elementsPerVertex)
+            {
+                if (stream.empty())
+                {
+                    return;
+                }
+
+                AZ_Assert(stream.size() == vertexRemap.size() * elementsPerVertex,
+                    "Vertex stream has %zu elements, but %zu vertices with %zu elements each were expected.",
+                    stream.size(), vertexRemap.size(), elementsPerVertex);
+
+                AZStd::vector<T> remappedStream(stream.size());
+                for (size_t vertex = 0; vertex < vertexRemap.size(); ++vertex)
+                {
+                    AZStd::copy(
+                        stream.begin() + vertex * elementsPerVertex,
+                        stream.begin() + (vertex + 1) * elementsPerVertex,
+                        remappedStream.begin() + vertexRemap[vertex] * elementsPerVertex);
+                }
+                stream.swap(remappedStream);
+            }
+        } // namespace MeshOptimization
+    } // namespace RPI
+} // namespace AZ
@@ -8,6 +8,7 @@
 
 #include <Model/ModelAssetBuilderComponent.h>
 #include <Model/MaterialAssetBuilderComponent.h>
+#include <Model/MeshOptimization.h>
 #include <Model/MorphTargetExporter.h>
 #include <Atom/RPI.Edit/Common/AssetUtils.h>
 
@@ -22,6 +23,7 @@
 #include <Atom/RPI.Reflect/Material/MaterialAsset.h>
 #include <Atom/RPI.Reflect/Model/ModelAssetCreator.h>
 #include <Atom/RPI.Reflect/Model/ModelLodAssetCreator.h>
+#include <Atom/RPI.Reflect/Model/ModelMeshlets.h>
 #include <Atom/RPI.Reflect/Model/MorphTargetDelta.h>
 #include <Atom/RPI.Reflect/Model/SkinJointIdPadding.h>
 #include <Atom/RPI.Reflect/Model/SkinMetaAssetCreator.h>
@@ -47,6 +49,8 @@
 #include <SceneAPI/SceneCore/Containers/Utilities/Filters.h>
 
 static constexpr AZStd::string_view MismatchedVertexLayoutsAreErrorsKey{ "/O3DE/SceneAPI/ModelBuilder/MismatchedVertexLayoutsAreErrors" };
+static constexpr AZStd::string_view GenerateMeshletsKey{ "/O3DE/SceneAPI/ModelBuilder/GenerateMeshlets" };
+static constexpr AZStd::string_view OptimizeVertexCacheKey{ "/O3DE/SceneAPI/ModelBuilder/OptimizeVertexCache" };
  /**
   * DEBUG DEFINES!
   * These are useful for debugging bad behavior from the builder.
@@ -110,6 +114,28 @@ namespace AZ
             return mismatchedVertexStreamsAreErrors;
         }
 
+        static bool GenerateMeshlets()
+        {
+            bool generateMeshlets = false;
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+            {
+                settingsRegistry->Get(generateMeshlets, GenerateMeshletsKey);
+            }
+            return generateMeshlets;
+        }
+
+        static bool OptimizeVertexCache()
+        {
+            // Disabled by default, since reordering triangles changes the order in which overlapping triangles of
+            // transparent meshes are blended.
+            bool optimizeVertexCache = false;
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+            {
+                settingsRegistry->Get(optimizeVertexCache, OptimizeVertexCacheKey);
+            }
+            return optimizeVertexCache;
+        }
+
         void ModelAssetBuilderComponent::Reflect(ReflectContext* context)
         {
             if (auto* serialize = azrtti_cast<SerializeContext*>(context))
@@ -452,6 +478,11 @@ namespace AZ
                         lodMeshes = productMeshListOutcome.GetValue();
                     }
 
+                    if (OptimizeVertexCache())
+                    {
+                        OptimizeMeshesForVertexCache(lodMeshes);
+                    }
+
 #if defined(AZ_RPI_MESHES_SHARE_COMMON_BUFFERS)
                     // We shouldn't need a mesh name for the buffer names since meshed are sharing common buffers
                     m_meshName = "";
@@ -1339,6 +1370,40 @@ namespace AZ
             return success;
         }
 
+        void ModelAssetBuilderComponent::OptimizeMeshesForVertexCache(ProductMeshContentList& productMeshList)
+        {
+            for (ProductMeshContent& productMesh : productMeshList)
+            {
+                const size_t vertexCount = productMesh.m_positions.size() / PositionFloatsPerVert;
+                MeshOptimization::OptimizeVertexCache(productMesh.m_indices, vertexCount);
+
+                // Morph target deltas and cloth simulation refer to vertices by their index, so their order has to be kept.
+                if (!productMesh.m_morphTargetVertexData.empty() || !productMesh.m_clothData.empty())
+                {
+                    continue;
+                }
+
+                const AZStd::vector<uint32_t> vertexRemap = MeshOptimization::OptimizeVertexFetch(productMesh.m_indices, vertexCount);
+                MeshOptimization::RemapVertexStream(productMesh.m_positions, vertexRemap, PositionFloatsPerVert);
+                MeshOptimization::RemapVertexStream(productMesh.m_normals, vertexRemap, NormalFloatsPerVert);
+                MeshOptimization::RemapVertexStream(productMesh.m_tangents, vertexRemap, TangentFloatsPerVert);
+                MeshOptimization::RemapVertexStream(productMesh.m_bitangents, vertexRemap, BitangentFloatsPerVert);
+                for (AZStd::vector<float>& uvSet : productMesh.m_uvSets)
+                {
+                    MeshOptimization::RemapVertexStream(uvSet, vertexRemap, UVFloatsPerVert);
+                }
+                for (AZStd::vector<float>& colorSet : productMesh.m_colorSets)
+                {
+                    MeshOptimization::RemapVertexStream(colorSet, vertexRemap, ColorFloatsPerVert);
+                }
+                if (productMesh.m_influencesPerVertex > 0)
+                {
+                    MeshOptimization::RemapVertexStream(productMesh.m_skinJointIndices, vertexRemap, productMesh.m_influencesPerVertex);
+                    MeshOptimization::RemapVertexStream(productMesh.m_skinWeights, vertexRemap, productMesh.m_influencesPerVertex);
+                }
+            }
+        }
+
         ModelAssetBuilderComponent::ProductMeshView ModelAssetBuilderComponent::CreateViewToEntireMesh(const ProductMeshContent& mesh)
         {
             ProductMeshView meshView;
@@ -2164,11 +2229,81 @@ namespace AZ
                 }
             }
 
+            // Set meshlet buffers
+            if (GenerateMeshlets())
+            {
+                if (!CreateMeshletStreams(meshView, lodIndexBuffer, lodStreamBuffers, lodAssetCreator))
+                {
+                    return false;
+                }
+            }
+
             lodAssetCreator.EndMesh();
 
             return true;
         }
 
+        bool ModelAssetBuilderComponent::CreateMeshletStreams(
+            const ProductMeshView& meshView,
+            const BufferAssetView& lodIndexBuffer,
+            const AZStd::vector<ModelLodAsset::Mesh::StreamBufferInfo>& lodStreamBuffers,
+            ModelLodAssetCreator& lodAssetCreator)
+        {
+            ModelLodAsset::Mesh::StreamBufferInfo positionStreamBufferInfo;
+            if (!FindStreamBufferById(lodStreamBuffers, RHI::ShaderSemantic{ "POSITION" }, positionStreamBufferInfo))
+            {
+                return false;
+            }
+
+            const RHI::BufferViewDescriptor& indexView = meshView.m_indexView;
+            const RHI::BufferViewDescriptor& positionView = meshView.m_positionView;
+            if (indexView.m_elementSize != sizeof(uint32_t) || positionView.m_elementSize != sizeof(float) * 3)
+            {
+                AZ_Warning(s_builderName, false, "Meshlets are only generated for 32 bit indices and 32 bit float positions, skipping mesh '%s'.",
+                    meshView.m_name.GetCStr());
+                return true;
+            }
+
+            // The views point into the lod wide buffers, the indices of each mesh are relative to its first vertex
+            AZStd::span<const uint8_t> indexData = lodIndexBuffer.GetBufferAsset()->GetBuffer();
+            AZStd::span<const uint8_t> positionData = positionStreamBufferInfo.m_bufferAssetView.GetBufferAsset()->GetBuffer();
+            const ModelMeshlets meshlets = BuildModelMeshlets(
+                AZStd::span<const uint32_t>(reinterpret_cast<const uint32_t*>(indexData.data()) + indexView.m_elementOffset, indexView.m_elementCount),
+                AZStd::span<const float>(reinterpret_cast<const float*>(positionData.data()) + positionView.m_elementOffset * 3, positionView.m_elementCount * 3));
+            if (meshlets.m_meshlets.empty())
+            {
+                return true;
+            }
+
+            // Meshes may share the lod wide buffers, so the buffer names are made unique by the first index of the mesh
+            auto addStream = [&](const char* semanticName, Outcome<Data::Asset<BufferAsset>> bufferOutcome)
+            {
+                if (!bufferOutcome.IsSuccess())
+                {
+                    AZ_Error(s_builderName, false, "Failed to build %s stream", semanticName);
+                    return false;
+                }
+
+                const Data::Asset<BufferAsset>& bufferAsset = bufferOutcome.GetValue();
+                return lodAssetCreator.AddMeshStreamBuffer(
+                    RHI::ShaderSemantic{ semanticName }, AZ::Name(), BufferAssetView(bufferAsset, bufferAsset->GetBufferViewDescriptor()));
+            };
+            auto getBufferName = [&](const char* semanticName)
+            {
+                return AZStd::string::format("%s_%u", semanticName, indexView.m_elementOffset);
+            };
+
+            return addStream(ShaderSemanticName_Meshlets,
+                       CreateStructuredBufferAsset(meshlets.m_meshlets.data(), meshlets.m_meshlets.size(), sizeof(Meshlet),
+                           getBufferName(ShaderSemanticName_Meshlets))) &&
+                addStream(ShaderSemanticName_MeshletVertices,
+                    CreateTypedBufferAsset(meshlets.m_vertexIndices.data(), meshlets.m_vertexIndices.size(), RHI::Format::R32_UINT,
+                        getBufferName(ShaderSemanticName_MeshletVertices))) &&
+                addStream(ShaderSemanticName_MeshletTriangles,
+                    CreateTypedBufferAsset(meshlets.m_triangles.data(), meshlets.m_triangles.size(), RHI::Format::R32_UINT,
+                        getBufferName(ShaderSemanticName_MeshletTriangles)));
+        }
+
         Outcome<Data::Asset<BufferAsset>> ModelAssetBuilderComponent::CreateTypedBufferAsset(
             const void* data, const size_t elementCount, RHI::Format format, const AZStd::string& bufferName)
         {
@@ -212,6 +212,11 @@ namespace AZ
             AZ::Outcome<ModelAssetBuilderComponent::ProductMeshContentList> MergeMeshesByMaterialUid(
                 const ProductMeshContentList& productMeshList);
 
+            //! Reorders the triangles of every mesh for the post-transform vertex cache, then reorders the vertices in the order
+            //! the triangles use them. Vertices of meshes with morph targets or cloth data keep their order, because those refer
+            //! to vertices by their index.
+            void OptimizeMeshesForVertexCache(ProductMeshContentList& productMeshList);
+
             //! Simple helper to create a MeshView that views an entire given ProductMeshContent object as one mesh.
             ProductMeshView CreateViewToEntireMesh(const ProductMeshContent& mesh);
 
@@ -309,6 +314,17 @@ namespace AZ
                 ModelLodAssetCreator& lodAssetCreator,
                 const MaterialAssetsByUid& materialAssetsByUid);
 
+            //! Helper method for CreateMesh.
+            //! Splits the mesh into meshlets and adds them to the current mesh as the MESHLETS, MESHLET_VERTICES
+            //! and MESHLET_TRIANGLES streams. Only called when meshlet generation is enabled in the settings registry.
+            //! 
+            //! Returns false if an error occurs
+            bool CreateMeshletStreams(
+                const ProductMeshView& meshView,
+                const BufferAssetView& lodIndexBuffer,
+                const AZStd::vector<ModelLodAsset::Mesh::StreamBufferInfo>& lodStreamBuffers,
+                ModelLodAssetCreator& lodAssetCreator);
+
             //! Takes in a pointer to data with a given element count and format and creates a BufferAsset.
             Outcome<Data::Asset<BufferAsset>> CreateTypedBufferAsset(
                 const void* data, const size_t elementCount, RHI::Format format, const AZStd::string& bufferName);
@@ -103,8 +103,36 @@ namespace AZ
                 performanceCollector->UpdateNumberOfCaptureBatches(newValue);
             }
 
+            static void OnGpuPassTimestampsChanged(const bool& newValue)
+            {
+                auto performanceCollectorOwner = PerformanceCollectorOwner::Get();
+                if (!performanceCollectorOwner)
+                {
+                    return;
+                }
+                auto gpuPassProfiler = performanceCollectorOwner->GetGpuPassProfiler();
+                if (!gpuPassProfiler)
+                {
+                    return;
+                }
+
+                gpuPassProfiler->SetPassTimestampsEnabled(newValue);
+                if (!newValue && !gpuPassProfiler->IsGpuTimeMeasurementEnabled())
+                {
+                    if (auto passSystem = PassSystemInterface::Get())
+                    {
+                        passSystem->GetRootPass()->SetTimestampQueryEnabled(false);
+                    }
+                }
+            }
         };
 
+        AZ_CVAR(bool, r_gpuPassTimestamps,
+            false,
+            &PerformanceCvarManager::OnGpuPassTimestampsChanged,
+            ConsoleFunctorFlags::DontReplicate,
+            "If true, the GPU timestamps of every pass are recorded to the profiler each frame, in the same captures as the CPU regions.");
+
         AZ_CVAR(AZ::u32, r_metricsNumberOfCaptureBatches,
             0, // Starts at 0, which means "do not capture performance data". When this variable changes to >0 we'll start performance capture.
             &PerformanceCvarManager::OnNumberOfCaptureBatchesChanged,
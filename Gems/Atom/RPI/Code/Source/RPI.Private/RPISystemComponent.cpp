@@ -161,6 +161,12 @@ namespace AZ
                 m_performanceCollector->FrameTick();
             }
 
+            if (m_gpuPassProfiler && m_gpuPassProfiler->IsPassTimestampsEnabled())
+            {
+                m_gpuPassProfiler->CollectPassTimestamps(AZ::RPI::PassSystemInterface::Get()->GetRootPass().get());
+                m_gpuPassProfiler->RecordPassTimestampsToProfiler();
+            }
+
             {
                 AZ::Debug::ScopeDuration performanceScopeDuration(m_performanceCollector.get(), PerformanceSpecGraphicsSimulationTime);
                 m_rpiSystem.SimulationTick();
@@ -208,6 +214,7 @@ namespace AZ
         AZ_CVAR_EXTERNED(AZ::u32, r_metricsFrameCountPerCaptureBatch);
         AZ_CVAR_EXTERNED(bool, r_metricsMeasureGpuTime);
         AZ_CVAR_EXTERNED(bool, r_metricsQuitUponCompletion);
+        AZ_CVAR_EXTERNED(bool, r_gpuPassTimestamps);
 
         AZStd::string RPISystemComponent::GetLogCategory()
         {
@@ -248,6 +255,7 @@ namespace AZ
 
             //Feed the CVAR values.
             m_gpuPassProfiler->SetGpuTimeMeasurementEnabled(r_metricsMeasureGpuTime);
+            m_gpuPassProfiler->SetPassTimestampsEnabled(r_gpuPassTimestamps);
             m_performanceCollector->UpdateDataLogType(GetDataLogTypeFromCVar(r_metricsDataLogType));
             m_performanceCollector->UpdateFrameCountPerCaptureBatch(r_metricsFrameCountPerCaptureBatch);
             m_performanceCollector->UpdateWaitTimeBeforeEachBatch(AZStd::chrono::seconds(r_metricsWaitTimePerCaptureBatch));
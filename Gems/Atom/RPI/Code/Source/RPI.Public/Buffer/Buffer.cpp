@@ -268,6 +268,36 @@ namespace AZ
             }
         }
 
+        bool Buffer::IsUploadComplete() const
+        {
+            return !m_streamFence || m_streamFence->GetFenceState() == RHI::FenceState::Signaled;
+        }
+
+        void Buffer::Evict()
+        {
+            WaitForUpload();
+            m_streamFence = nullptr;
+
+            // The RHI defers the release of the memory until the GPU is done with the frames in flight.
+            m_rhiBuffer->Shutdown();
+        }
+
+        RHI::ResultCode Buffer::MakeResident(BufferAsset& bufferAsset)
+        {
+            if (IsResident())
+            {
+                return RHI::ResultCode::Success;
+            }
+
+            // Initializing the same RHI buffer again invalidates its views, which rebuilds them and the shader resource groups using them.
+            return Init(bufferAsset);
+        }
+
+        bool Buffer::IsResident() const
+        {
+            return m_rhiBuffer->IsInitialized();
+        }
+
         bool Buffer::Orphan()
         {
             if (m_rhiBufferPool->GetDescriptor().m_heapMemoryLevel != RHI::HeapMemoryLevel::Host)
@@ -9,6 +9,7 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Model/ModelLodResidency.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
@@ -158,6 +159,7 @@ namespace AZ
             Frustum m_frustum;
             AZ::Job* m_parentJob = nullptr;
             AZ::TaskGraphEvent* m_taskGraphEvent = nullptr;
+            const HierarchicalDepthBuffer* m_hierarchicalDepthBuffer = nullptr;
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
 #endif
@@ -189,6 +191,11 @@ namespace AZ
             worklistData->m_frustum = frustum;
             worklistData->m_parentJob = parentJob;
             worklistData->m_taskGraphEvent = taskGraphEvent;
+            if (view.GetOcclusionCullingMode() == View::OcclusionCullingMode::HierarchicalDepth &&
+                view.GetHierarchicalDepthBuffer().IsValid())
+            {
+                worklistData->m_hierarchicalDepthBuffer = &view.GetHierarchicalDepthBuffer();
+            }
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             worklistData->m_maskedOcclusionCulling = static_cast<MaskedOcclusionCulling*>(maskedOcclusionCulling);
 #endif
@@ -256,6 +263,13 @@ namespace AZ
                         }
                     }
 
+                    if (worklistData->m_hierarchicalDepthBuffer &&
+                        !visibleEntry->m_boundingVolume.Contains(worklistData->m_view->GetCameraTransform().GetTranslation()) &&
+                        worklistData->m_hierarchicalDepthBuffer->IsOccluded(visibleEntry->m_boundingVolume))
+                    {
+                        continue;
+                    }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                     if (TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
@@ -506,7 +520,9 @@ namespace AZ
 #endif //AZ_CULL_DEBUG_ENABLED
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             // setup occlusion culling, if necessary
-            maskedOcclusionCulling = m_occlusionPlanes.empty() ? nullptr : view.GetMaskedOcclusionCulling();
+            const bool useMaskedOcclusionCulling =
+                !m_occlusionPlanes.empty() && view.GetOcclusionCullingMode() == View::OcclusionCullingMode::MaskedSoftware;
+            maskedOcclusionCulling = useMaskedOcclusionCulling ? view.GetMaskedOcclusionCulling() : nullptr;
             if (maskedOcclusionCulling)
             {
                 // frustum cull occlusion planes
@@ -770,13 +786,28 @@ namespace AZ
                 }
             };
 
+            // With a streamed model the selected lods are replaced by resident ones, so consecutive lods may map to the same lod
+            uint32_t lastResidentLodIndex = static_cast<uint32_t>(lodData.m_lods.size());
+            auto addSelectedLod = [&](uint32_t lodIndex)
+            {
+                if (lodData.m_lodResidency)
+                {
+                    lodIndex = AZStd::min(lodData.m_lodResidency->RequestLod(lodIndex), static_cast<uint32_t>(lodData.m_lods.size() - 1));
+                    if (lodIndex == lastResidentLodIndex)
+                    {
+                        return;
+                    }
+                    lastResidentLodIndex = lodIndex;
+                }
+                addLodToDrawPacket(lodData.m_lods[lodIndex]);
+            };
+
             switch (lodData.m_lodConfiguration.m_lodType)
             {
                 case Cullable::LodType::SpecificLod:
                     if (lodData.m_lodConfiguration.m_lodOverride < lodData.m_lods.size())
                     {
-                    addLodToDrawPacket(
-                        lodData.m_lods.at(lodData.m_lodConfiguration.m_lodOverride));
+                        addSelectedLod(lodData.m_lodConfiguration.m_lodOverride);
                     }
                     break;
                 case Cullable::LodType::ScreenCoverage:
@@ -798,7 +829,7 @@ namespace AZ
                         // Note that this supports overlapping lod ranges (to suport cross-fading lods, for example)
                         if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
                         {
-                            addLodToDrawPacket(lod);
+                            addSelectedLod(lodIndex);
                         }
                     }
                     break;
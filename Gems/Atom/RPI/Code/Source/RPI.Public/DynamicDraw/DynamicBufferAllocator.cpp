@@ -39,28 +39,26 @@ namespace AZ
             
             m_ringBufferSize = ringBufferSize;
             m_ringBufferStartAddress = m_ringBuffer->Map(m_ringBufferSize, 0);
-            
-            m_currentPosition = 0;
-            m_endPositionLimit = 0;
-            m_currentFrame = 0;
-            for (uint32_t frame = 0; frame < AZ::RHI::Limits::Device::FrameCountMax; frame++)
-            {
-                m_frameStartPositions[frame] = 0;
-            }
+
+            RHI::RingAllocator::Descriptor allocatorDesc;
+            allocatorDesc.m_addressBase = RHI::VirtualAddress::CreateFromPointer(m_ringBufferStartAddress);
+            allocatorDesc.m_capacityInBytes = m_ringBufferSize;
+            allocatorDesc.m_garbageCollectLatency = AZ::RHI::Limits::Device::FrameCountMax - 1;
+            m_ringAllocator.Init(allocatorDesc);
         }
 
         void DynamicBufferAllocator::Shutdown()
         {
+            m_ringAllocator.Shutdown();
             m_ringBuffer->Unmap();
             m_ringBuffer = nullptr;
             m_ringBufferStartAddress = nullptr;
         }
 
         // [GFX TODO][ATOM-13182] Add unit tests for DynamicBufferAllocator's Allocate function 
-        RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::Allocate(uint32_t size, [[maybe_unused]]uint32_t alignment)
+        RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::Allocate(uint32_t size, uint32_t alignment)
         {
             size = RHI::AlignUp(size, alignment);
-            uint32_t allocatePosition = 0;
 
             //m_ringBufferStartAddress can be null for Null back end
             if (!m_ringBufferStartAddress)
@@ -74,56 +72,16 @@ namespace AZ
                 return nullptr;
             }
 
-            // Return if the allocation of current frame has reached limit
-            if (m_endPositionLimit == m_currentPosition && m_currentAllocatedSize > 0)
+            RHI::VirtualAddress address = m_ringAllocator.Allocate(size, alignment);
+            if (address.IsNull())
             {
-                AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: no more buffer is available");
+                AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%zu bytes)",
+                    size, m_ringBufferSize - m_ringAllocator.GetAllocatedByteCount());
                 return nullptr;
             }
 
-            if (m_endPositionLimit > m_currentPosition)
-            {
-                if (m_endPositionLimit - m_currentPosition >= size)
-                {
-                    allocatePosition = m_currentPosition;
-                    m_currentPosition += size;
-                }
-                else
-                {
-                    AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit - m_currentPosition);
-                    return nullptr;
-                }
-            }
-            else
-            {
-                if (m_ringBufferSize - m_currentPosition >= size)
-                {
-                    allocatePosition = m_currentPosition;
-                    m_currentPosition += size;
-                    if (m_ringBufferSize == m_currentPosition)
-                    {
-                        m_currentPosition = 0;
-                    }
-                }
-                else
-                {
-                    if (m_endPositionLimit >= size)
-                    {
-                        allocatePosition = 0;
-                        m_currentPosition = size;
-                    }
-                    else
-                    {
-                        AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit);
-                        return nullptr;
-                    }
-                }
-            }
-
-            m_currentAllocatedSize += size;
-
             RHI::Ptr<DynamicBuffer> allocatedBuffer = aznew DynamicBuffer();
-            allocatedBuffer->m_address = (uint8_t*)m_ringBufferStartAddress + allocatePosition;
+            allocatedBuffer->m_address = reinterpret_cast<void*>(address.m_ptr);
             allocatedBuffer->m_size = size;
             allocatedBuffer->m_allocator = this;
             return allocatedBuffer;
@@ -161,18 +119,7 @@ namespace AZ
 
         void DynamicBufferAllocator::FrameEnd()
         {
-            uint32_t nextFrame = (m_currentFrame + 1) % AZ::RHI::Limits::Device::FrameCountMax;
-
-            // The saved frame start position will become available since it's old than FrameCountMax. The saved start position of next frame is the new limit
-            m_endPositionLimit = m_frameStartPositions[nextFrame];
-
-            // Save start position for current frame
-            m_frameStartPositions[m_currentFrame] = m_currentPosition;
-
-            m_currentFrame = nextFrame;
-
-            m_currentAllocatedSize = 0;
-
+            m_ringAllocator.GarbageCollect();
         }
     }
 }
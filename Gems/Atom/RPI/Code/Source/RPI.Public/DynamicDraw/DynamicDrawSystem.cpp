@@ -49,7 +49,8 @@ namespace AZ
 
         RHI::Ptr<DynamicBuffer> DynamicDrawSystem::GetDynamicBuffer(uint32_t size, uint32_t alignment)
         {
-            AZStd::lock_guard<AZStd::mutex> lock(m_mutexBufferAlloc);
+            // The allocator is lock free, the shared lock only keeps FrameEnd from running during the allocation
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutexBufferAlloc);
             return m_bufferAlloc->Allocate(size, alignment);
         }
 
@@ -133,7 +134,7 @@ namespace AZ
             // for m_bufferAlloc to be non-nullptr
             if (m_bufferAlloc != nullptr)
             {
-                AZStd::lock_guard<AZStd::mutex> lock(m_mutexBufferAlloc);
+                AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutexBufferAlloc);
                 m_bufferAlloc->FrameEnd();
             }
 
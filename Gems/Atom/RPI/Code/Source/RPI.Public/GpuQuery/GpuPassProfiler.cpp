@@ -6,9 +6,13 @@
  *
  */
 
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/time.h>
 
+#include <Atom/RHI/RHIUtils.h>
+#include <Atom/RPI.Public/Base.h>
 #include <Atom/RPI.Public/Pass/ParentPass.h>
 #include <Atom/RPI.Public/GpuQuery/GpuPassProfiler.h>
 
@@ -268,5 +272,129 @@ namespace AZ
             return resultBegin.GetDurationInNanoseconds();
         }
 
+        const AZStd::vector<GpuPassProfiler::PassTimestamp>& GpuPassProfiler::CollectPassTimestamps(RPI::ParentPass* rootPass)
+        {
+            // The vector keeps its capacity, so there are no allocations once the pass tree doesn't grow anymore.
+            m_passTimestamps.clear();
+            if (rootPass)
+            {
+                CollectPassTimestampsRecursive(rootPass, -1, 0);
+            }
+            return m_passTimestamps;
+        }
+
+        RPI::TimestampResult GpuPassProfiler::CollectPassTimestampsRecursive(RPI::Pass* pass, int32_t parentIndex, uint16_t depth)
+        {
+            if (!pass->IsTimestampQueryEnabled())
+            {
+                // Only enable the query of this pass, its children are enabled when they are visited.
+                // The first results are available when the frame that issued the query was read back.
+                pass->Pass::SetTimestampQueryEnabled(true);
+            }
+
+            const int32_t index = aznumeric_cast<int32_t>(m_passTimestamps.size());
+            m_passTimestamps.push_back({ pass->GetName(), parentIndex, depth, {} });
+
+            RPI::TimestampResult passRange;
+            if (RPI::ParentPass* passAsParent = pass->AsParent())
+            {
+                bool hasRange = false;
+                for (const Ptr<Pass>& childPass : passAsParent->GetChildren())
+                {
+                    if (!childPass->IsEnabled())
+                    {
+                        continue;
+                    }
+
+                    const RPI::TimestampResult childRange = CollectPassTimestampsRecursive(childPass.get(), index, depth + 1);
+                    if (childRange.GetDurationInTicks() > 0)
+                    {
+                        if (hasRange)
+                        {
+                            passRange.Add(childRange);
+                        }
+                        else
+                        {
+                            passRange = childRange;
+                            hasRange = true;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                passRange = pass->GetLatestTimestampResult();
+            }
+
+            m_passTimestamps[index].m_timestampResult = passRange;
+            return passRange;
+        }
+
+        void GpuPassProfiler::RecordPassTimestampsToProfiler()
+        {
+            AZ::Debug::Profiler* profiler = AZ::Interface<AZ::Debug::Profiler>::Get();
+            AZ::Debug::Budget* budget = AZ_BUDGET_GETTER(RPI)();
+            if (!profiler || !budget || m_passTimestamps.empty())
+            {
+                return;
+            }
+
+            const RPI::TimestampResult& frameRange = m_passTimestamps.front().m_timestampResult;
+            const uint64_t frameBeginTick = frameRange.GetTimestampBeginInTicks();
+            const uint64_t frameEndTick = frameBeginTick + frameRange.GetDurationInTicks();
+            if (frameRange.GetDurationInTicks() == 0 || frameBeginTick < m_lastRecordedGpuEndTick)
+            {
+                // There are no results yet, or the results haven't changed since the last recorded frame.
+                return;
+            }
+            m_lastRecordedGpuEndTick = frameEndTick;
+
+            const double cpuNow = static_cast<double>(AZStd::GetTimeNowTicks());
+            if (m_cpuTicksPerGpuTick == 0.0)
+            {
+                // Convert a large number of ticks, so the microseconds that are returned don't lose precision.
+                constexpr uint64_t SampleGpuTicks = 1'000'000'000;
+                const AZStd::chrono::microseconds sampleDuration =
+                    RHI::GetRHIDevice()->GpuTimestampToMicroseconds(SampleGpuTicks, RHI::HardwareQueueClass::Graphics);
+                m_cpuTicksPerGpuTick = static_cast<double>(sampleDuration.count()) * static_cast<double>(AZStd::GetTimeTicksPerSecond()) /
+                    (1'000'000.0 * static_cast<double>(SampleGpuTicks));
+                m_gpuBaseTick = frameBeginTick;
+                m_gpuBaseCpuTick = AZStd::numeric_limits<double>::max();
+            }
+
+            const auto gpuToCpuOffset = [this](uint64_t gpuTick)
+            {
+                return static_cast<double>(static_cast<int64_t>(gpuTick - m_gpuBaseTick)) * m_cpuTicksPerGpuTick;
+            };
+
+            // The GPU finished the frame before it was read back, so the CPU tick of the frame end is at most the current tick.
+            // The smallest of these bounds is the closest to the real offset, and the estimate is allowed to slowly move up
+            // to follow a drift between the clocks.
+            const double maxDriftPerFrame = static_cast<double>(AZStd::GetTimeTicksPerSecond()) / 10'000.0;
+            const double gpuBaseCpuTickBound = cpuNow - gpuToCpuOffset(frameEndTick);
+            if (m_gpuBaseCpuTick == AZStd::numeric_limits<double>::max())
+            {
+                m_gpuBaseCpuTick = gpuBaseCpuTickBound;
+            }
+            else
+            {
+                m_gpuBaseCpuTick = AZStd::min(gpuBaseCpuTickBound, m_gpuBaseCpuTick + maxDriftPerFrame);
+            }
+
+            for (const PassTimestamp& passTimestamp : m_passTimestamps)
+            {
+                const RPI::TimestampResult& passRange = passTimestamp.m_timestampResult;
+                if (passRange.GetDurationInTicks() == 0)
+                {
+                    continue;
+                }
+
+                const uint64_t passBeginTick = passRange.GetTimestampBeginInTicks();
+                const AZ::s64 startTick = static_cast<AZ::s64>(m_gpuBaseCpuTick + gpuToCpuOffset(passBeginTick));
+                const AZ::s64 endTick = static_cast<AZ::s64>(m_gpuBaseCpuTick + gpuToCpuOffset(passBeginTick + passRange.GetDurationInTicks()));
+                profiler->RecordTrackRegion(budget, "GPU", passTimestamp.m_name.GetCStr(), startTick, endTick, passTimestamp.m_depth);
+            }
+        }
+
     }   // namespace RPI
 }   // namespace AZ
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/HierarchicalDepthBuffer.h>
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/std/algorithm.h>
+
+#include <float.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        void HierarchicalDepthBuffer::Update(AZStd::span<const float> linearDepth, uint32_t width, uint32_t height, const Matrix4x4& worldToClip)
+        {
+            if (width == 0 || height == 0 || linearDepth.size() < size_t(width) * height)
+            {
+                AZ_Error("HierarchicalDepthBuffer", false, "The depth doesn't hold %u x %u texels.", width, height);
+                Reset();
+                return;
+            }
+
+            m_worldToClip = worldToClip;
+
+            // The mips are resized rather than rebuilt, so a view that keeps its size doesn't allocate every frame
+            size_t mipCount = 1;
+            for (uint32_t size = AZStd::max(width, height); size > 1; size = (size + 1) / 2)
+            {
+                ++mipCount;
+            }
+            m_mips.resize(mipCount);
+
+            Mip& topMip = m_mips[0];
+            topMip.m_width = width;
+            topMip.m_height = height;
+            topMip.m_depth.assign(linearDepth.begin(), linearDepth.begin() + size_t(width) * height);
+
+            for (size_t mipIndex = 1; mipIndex < mipCount; ++mipIndex)
+            {
+                const Mip& source = m_mips[mipIndex - 1];
+                Mip& mip = m_mips[mipIndex];
+                mip.m_width = (source.m_width + 1) / 2;
+                mip.m_height = (source.m_height + 1) / 2;
+                mip.m_depth.resize(size_t(mip.m_width) * mip.m_height);
+
+                for (uint32_t y = 0; y < mip.m_height; ++y)
+                {
+                    // Odd sizes repeat the last row and column of the source, so every source texel is covered
+                    const size_t row0 = size_t(y * 2) * source.m_width;
+                    const size_t row1 = size_t(AZStd::min(y * 2 + 1, source.m_height - 1)) * source.m_width;
+                    for (uint32_t x = 0; x < mip.m_width; ++x)
+                    {
+                        const uint32_t x0 = x * 2;
+                        const uint32_t x1 = AZStd::min(x * 2 + 1, source.m_width - 1);
+                        mip.m_depth[size_t(y) * mip.m_width + x] = AZStd::max(
+                            AZStd::max(source.m_depth[row0 + x0], source.m_depth[row0 + x1]),
+                            AZStd::max(source.m_depth[row1 + x0], source.m_depth[row1 + x1]));
+                    }
+                }
+            }
+        }
+
+        void HierarchicalDepthBuffer::Reset()
+        {
+            m_mips.clear();
+        }
+
+        bool HierarchicalDepthBuffer::IsValid() const
+        {
+            return !m_mips.empty();
+        }
+
+        bool HierarchicalDepthBuffer::IsOccluded(const Aabb& aabb) const
+        {
+            if (!IsValid())
+            {
+                return false;
+            }
+
+            const Vector3& minBound = aabb.GetMin();
+            const Vector3& maxBound = aabb.GetMax();
+
+            float minDepth = FLT_MAX;
+            float ndcMinX = FLT_MAX;
+            float ndcMinY = FLT_MAX;
+            float ndcMaxX = -FLT_MAX;
+            float ndcMaxY = -FLT_MAX;
+            for (uint32_t index = 0; index < 8; ++index)
+            {
+                const Vector4 corner = m_worldToClip * Vector4(
+                    (index & 1) ? maxBound.GetX() : minBound.GetX(),
+                    (index & 2) ? maxBound.GetY() : minBound.GetY(),
+                    (index & 4) ? maxBound.GetZ() : minBound.GetZ(),
+                    1.0f);
+
+                // A box that crosses the near plane can't be projected to a rect, and is too close to be hidden anyway
+                minDepth = AZStd::min(minDepth, corner.GetW());
+                if (minDepth < 0.00000001f)
+                {
+                    return false;
+                }
+
+                const float ndcX = corner.GetX() / corner.GetW();
+                const float ndcY = corner.GetY() / corner.GetW();
+                ndcMinX = AZStd::min(ndcMinX, ndcX);
+                ndcMinY = AZStd::min(ndcMinY, ndcY);
+                ndcMaxX = AZStd::max(ndcMaxX, ndcX);
+                ndcMaxY = AZStd::max(ndcMaxY, ndcY);
+            }
+
+            return IsOccluded(ndcMinX, ndcMinY, ndcMaxX, ndcMaxY, minDepth);
+        }
+
+        bool HierarchicalDepthBuffer::IsOccluded(float ndcMinX, float ndcMinY, float ndcMaxX, float ndcMaxY, float minDepth) const
+        {
+            if (!IsValid())
+            {
+                return false;
+            }
+
+            ndcMinX = AZStd::max(ndcMinX, -1.0f);
+            ndcMinY = AZStd::max(ndcMinY, -1.0f);
+            ndcMaxX = AZStd::min(ndcMaxX, 1.0f);
+            ndcMaxY = AZStd::min(ndcMaxY, 1.0f);
+            if (ndcMinX > ndcMaxX || ndcMinY > ndcMaxY)
+            {
+                // Outside of the view, which the frustum culling is responsible for
+                return false;
+            }
+
+            const Mip& topMip = m_mips[0];
+            auto toTexel = [](float uv, uint32_t size)
+            {
+                return AZStd::min(static_cast<uint32_t>(AZStd::max(uv, 0.0f) * size), size - 1);
+            };
+
+            // The rows start at the top of the view, while NDC y points up
+            const uint32_t minX = toTexel(ndcMinX * 0.5f + 0.5f, topMip.m_width);
+            const uint32_t maxX = toTexel(ndcMaxX * 0.5f + 0.5f, topMip.m_width);
+            const uint32_t minY = toTexel(0.5f - ndcMaxY * 0.5f, topMip.m_height);
+            const uint32_t maxY = toTexel(0.5f - ndcMinY * 0.5f, topMip.m_height);
+
+            // Finds the first mip where the rect covers at most 2x2 texels
+            size_t mipIndex = 0;
+            while (mipIndex + 1 < m_mips.size() && ((maxX >> mipIndex) - (minX >> mipIndex) > 1 || (maxY >> mipIndex) - (minY >> mipIndex) > 1))
+            {
+                ++mipIndex;
+            }
+
+            const Mip& mip = m_mips[mipIndex];
+            float maxDepth = 0.0f;
+            for (uint32_t y = minY >> mipIndex; y <= (maxY >> mipIndex); ++y)
+            {
+                for (uint32_t x = minX >> mipIndex; x <= (maxX >> mipIndex); ++x)
+                {
+                    maxDepth = AZStd::max(maxDepth, mip.m_depth[size_t(y) * mip.m_width + x]);
+                }
+            }
+
+            return minDepth > maxDepth;
+        }
+    } // namespace RPI
+} // namespace AZ
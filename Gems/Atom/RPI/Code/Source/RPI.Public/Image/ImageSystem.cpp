@@ -104,6 +104,10 @@ namespace AZ
     AZ_CVAR(size_t, r_streamingImagePoolBudgetMb, cvar_r_streamingImagePoolBudgetMb_Init(), cvar_r_streamingImagePoolBudgetMb_Changed, ConsoleFunctorFlags::Null, "Change gpu memory budget for the RPI system streaming image pool");
     AZ_CVAR(int16_t, r_streamingImageMipBias, cvar_r_streamingImageMipBias_Init(), cvar_r_streamingImageMipBias_Changed, ConsoleFunctorFlags::Null, "Set a mipmap bias for all streamable images created from the system streaming image pool");
 
+    // cvars for driving the target mips of the streaming images with the mip levels sampled by the GPU
+    AZ_CVAR(bool, r_streamingImageFeedback, false, nullptr, ConsoleFunctorFlags::Null, "Set the target mips of the streaming images from the mip levels written by the shaders to the texture streaming feedback buffer");
+    AZ_CVAR(uint32_t, r_streamingImageFeedbackEntryCount, 65536, nullptr, ConsoleFunctorFlags::Null, "The number of bindless texture indices covered by the texture streaming feedback buffer. Takes effect when r_streamingImageFeedback is enabled");
+
     namespace RPI
     {
         ImageSystemInterface* ImageSystemInterface::Get()
@@ -207,6 +211,8 @@ namespace AZ
             }
             Interface<ImageSystemInterface>::Unregister(this);
 
+            m_streamingImageFeedback = nullptr;
+            m_requestedMips = {};
             m_systemImages.clear();
             m_systemAttachmentImages.clear();
             m_systemStreamingPool = nullptr;
@@ -232,6 +238,46 @@ namespace AZ
             }
         }
 
+        void ImageSystem::FrameUpdate(RHI::FrameGraphBuilder& frameGraphBuilder)
+        {
+            AZ_PROFILE_SCOPE(RPI, "ImageSystem: FrameUpdate");
+
+            if (r_streamingImageFeedback != (m_streamingImageFeedback != nullptr))
+            {
+                m_streamingImageFeedback = nullptr;
+                if (r_streamingImageFeedback)
+                {
+                    m_streamingImageFeedback = AZStd::make_unique<StreamingImageFeedback>();
+                    if (!m_streamingImageFeedback->Init(r_streamingImageFeedbackEntryCount))
+                    {
+                        m_streamingImageFeedback = nullptr;
+                        r_streamingImageFeedback = false;
+                    }
+                }
+            }
+
+            if (!m_streamingImageFeedback)
+            {
+                return;
+            }
+
+            if (m_streamingImageFeedback->ReadFeedback(m_requestedMips))
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_activeStreamingPoolMutex);
+                for (StreamingImagePool* imagePool : m_activeStreamingPools)
+                {
+                    imagePool->ApplyMipFeedback(m_requestedMips);
+                }
+            }
+
+            m_streamingImageFeedback->FrameUpdate(frameGraphBuilder);
+        }
+
+        const StreamingImageFeedback* ImageSystem::GetStreamingImageFeedback() const
+        {
+            return m_streamingImageFeedback.get();
+        }
+
         const Data::Instance<StreamingImagePool>& ImageSystem::GetSystemStreamingPool() const
         {
             return m_systemStreamingPool;
@@ -9,7 +9,9 @@
 #include <Atom/RPI.Public/Image/StreamingImageController.h>
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Image/StreamingImageFeedback.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Time/ITime.h>
 
@@ -27,6 +29,9 @@ namespace AZ
         #define StreamingDebugOutput(window, ...)
 #endif
 
+        AZ_CVAR(uint32_t, r_streamingImageFeedbackTimeout, 300, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of streaming updates after which an image reported by the GPU feedback but no longer sampled drops to its least detailed mip chain.");
+
         AZStd::unique_ptr<StreamingImageController> StreamingImageController::Create(RHI::StreamingImagePool& pool)
         {
             AZStd::unique_ptr<StreamingImageController> controller = AZStd::make_unique<StreamingImageController>();
@@ -183,6 +188,50 @@ namespace AZ
             }
         }
 
+        void StreamingImageController::ApplyMipFeedback(AZStd::span<const uint16_t> requestedMips)
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_contextAccessMutex);
+            for (StreamingImageContext& context : m_contexts)
+            {
+                StreamingImage* image = context.TryGetImage();
+                const RHI::ImageView* imageView = image ? image->GetImageView() : nullptr;
+                if (!imageView)
+                {
+                    continue;
+                }
+
+                const uint32_t bindlessIndex = imageView->GetBindlessReadIndex();
+                const uint16_t requestedMip = bindlessIndex < requestedMips.size()
+                    ? requestedMips[bindlessIndex]
+                    : StreamingImageFeedback::NoRequest;
+
+                size_t mipChainIndex = 0;
+                if (requestedMip != StreamingImageFeedback::NoRequest)
+                {
+                    context.m_lastFeedbackTimestamp = m_timestamp;
+                    const uint16_t mipLevelCount = image->m_imageAsset->GetImageDescriptor().m_mipLevels;
+                    mipChainIndex = image->m_imageAsset->GetMipChainIndex(AZStd::min<uint16_t>(requestedMip, mipLevelCount - 1));
+                }
+                else if (context.m_lastFeedbackTimestamp != StreamingImageContext::NoFeedbackTimestamp &&
+                    m_timestamp - context.m_lastFeedbackTimestamp > r_streamingImageFeedbackTimeout)
+                {
+                    mipChainIndex = image->m_imageAsset->GetMipChainCount() - 1;
+                }
+                else
+                {
+                    continue;
+                }
+
+                const uint16_t mipLevelTarget = aznumeric_cast<uint16_t>(image->m_imageAsset->GetMipLevel(mipChainIndex));
+                if (context.m_mipLevelTarget != mipLevelTarget)
+                {
+                    OnSetTargetMip(image, mipLevelTarget);
+                }
+            }
+        }
+
         void StreamingImageController::UpdateImagePriority(StreamingImage* image)
         {
             StreamingImage::Priority newPriority = CalculateImagePriority(image);
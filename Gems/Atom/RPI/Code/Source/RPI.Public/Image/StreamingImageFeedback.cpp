@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Image/StreamingImageFeedback.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+
+#include <Atom/RHI/Factory.h>
+#include <Atom/RHI/FrameGraphBuilder.h>
+#include <Atom/RHI/FrameGraphCompileContext.h>
+#include <Atom/RHI/FrameGraphExecuteContext.h>
+#include <Atom/RHI/FrameGraphInterface.h>
+#include <Atom/RHI/RHISystemInterface.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace
+        {
+            // Layout of the feedback entries, see TextureStreamingFeedback.azsli
+            constexpr uint32_t FeedbackMipBitCount = 4;
+            constexpr uint32_t FeedbackMipMask = (1u << FeedbackMipBitCount) - 1;
+            constexpr uint32_t FeedbackFrameMask = 0xFFFFFFFFu >> FeedbackMipBitCount;
+        }
+
+        StreamingImageFeedback::StreamingImageFeedback()
+            : RHI::ScopeProducer(RHI::ScopeId{ "StreamingImageFeedback" })
+        {
+        }
+
+        StreamingImageFeedback::~StreamingImageFeedback()
+        {
+            Shutdown();
+        }
+
+        bool StreamingImageFeedback::Init(uint32_t entryCount)
+        {
+            AZ_Assert(entryCount > 0, "StreamingImageFeedback needs at least one entry");
+
+            const AZStd::vector<uint32_t> initialData(entryCount, 0);
+
+            CommonBufferDescriptor desc;
+            desc.m_bufferName = "StreamingImageFeedback";
+            desc.m_poolType = CommonBufferPoolType::ReadWrite;
+            desc.m_elementSize = sizeof(uint32_t);
+            desc.m_byteCount = initialData.size() * sizeof(uint32_t);
+            desc.m_bufferData = initialData.data();
+            m_feedbackBuffer = BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            if (!m_feedbackBuffer)
+            {
+                AZ_Error("StreamingImageFeedback", false, "Failed to create the feedback buffer");
+                return false;
+            }
+
+            RHI::Ptr<RHI::Device> device = RHI::RHISystemInterface::Get()->GetDevice();
+            desc.m_bufferName = "StreamingImageFeedbackReadback";
+            desc.m_poolType = CommonBufferPoolType::ReadBack;
+            desc.m_bufferData = nullptr;
+            for (Readback& readback : m_readbacks)
+            {
+                readback.m_buffer = BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                readback.m_fence = RHI::Factory::Get().CreateFence();
+                if (!readback.m_buffer || readback.m_fence->Init(*device, RHI::FenceState::Reset) != RHI::ResultCode::Success)
+                {
+                    AZ_Error("StreamingImageFeedback", false, "Failed to create the feedback readback buffers");
+                    Shutdown();
+                    return false;
+                }
+            }
+
+            m_entryCount = entryCount;
+            m_readbackIndex = 0;
+            m_frame = 1;
+            return true;
+        }
+
+        void StreamingImageFeedback::Shutdown()
+        {
+            for (Readback& readback : m_readbacks)
+            {
+                readback = {};
+            }
+            m_feedbackBuffer = nullptr;
+            m_entryCount = 0;
+            m_copyItem = {};
+        }
+
+        const Data::Instance<Buffer>& StreamingImageFeedback::GetFeedbackBuffer() const
+        {
+            return m_feedbackBuffer;
+        }
+
+        uint32_t StreamingImageFeedback::GetFeedbackFrame() const
+        {
+            return m_frame & FeedbackFrameMask;
+        }
+
+        void StreamingImageFeedback::FrameUpdate(RHI::FrameGraphBuilder& frameGraphBuilder)
+        {
+            if (!m_feedbackBuffer)
+            {
+                return;
+            }
+
+            // The frame 0 never matches, as it is the initial content of the buffer
+            ++m_frame;
+            if (GetFeedbackFrame() == 0)
+            {
+                ++m_frame;
+            }
+
+            // Skip the copy if the CPU didn't consume the readback yet, the feedback of the frame is lost
+            Readback& readback = m_readbacks[m_readbackIndex];
+            if (readback.m_isPending)
+            {
+                return;
+            }
+
+            readback.m_frame = (m_frame - 1) & FeedbackFrameMask;
+            readback.m_isPending = true;
+            readback.m_fence->Reset();
+
+            const RHI::AttachmentId& attachmentId = m_feedbackBuffer->GetAttachmentId();
+            if (!frameGraphBuilder.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
+            {
+                frameGraphBuilder.GetAttachmentDatabase().ImportBuffer(attachmentId, m_feedbackBuffer->GetRHIBuffer());
+            }
+            frameGraphBuilder.ImportScopeProducer(*this);
+        }
+
+        void StreamingImageFeedback::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
+        {
+            RHI::BufferScopeAttachmentDescriptor descriptor;
+            descriptor.m_attachmentId = m_feedbackBuffer->GetAttachmentId();
+            descriptor.m_bufferViewDescriptor = RHI::BufferViewDescriptor::CreateRaw(0, aznumeric_cast<uint32_t>(m_feedbackBuffer->GetBufferSize()));
+            frameGraph.UseCopyAttachment(descriptor, RHI::ScopeAttachmentAccess::Read);
+
+            frameGraph.SignalFence(*m_readbacks[m_readbackIndex].m_fence);
+        }
+
+        void StreamingImageFeedback::CompileResources([[maybe_unused]] const RHI::FrameGraphCompileContext& context)
+        {
+            RHI::CopyBufferDescriptor copyBuffer;
+            copyBuffer.m_sourceBuffer = m_feedbackBuffer->GetRHIBuffer();
+            copyBuffer.m_destinationBuffer = m_readbacks[m_readbackIndex].m_buffer->GetRHIBuffer();
+            copyBuffer.m_size = aznumeric_cast<uint32_t>(m_feedbackBuffer->GetBufferSize());
+            m_copyItem = copyBuffer;
+
+            m_readbackIndex = (m_readbackIndex + 1) % aznumeric_cast<uint32_t>(m_readbacks.size());
+        }
+
+        void StreamingImageFeedback::BuildCommandList(const RHI::FrameGraphExecuteContext& context)
+        {
+            context.GetCommandList()->Submit(m_copyItem);
+        }
+
+        bool StreamingImageFeedback::ReadFeedback(AZStd::vector<uint16_t>& requestedMipsOut)
+        {
+            // Only the most recent feedback is used, older completed readbacks are dropped
+            Readback* latest = nullptr;
+            for (Readback& readback : m_readbacks)
+            {
+                if (readback.m_isPending && readback.m_fence->GetFenceState() == RHI::FenceState::Signaled)
+                {
+                    readback.m_isPending = false;
+                    if (!latest || readback.m_frame > latest->m_frame)
+                    {
+                        latest = &readback;
+                    }
+                }
+            }
+
+            if (!latest)
+            {
+                return false;
+            }
+
+            const uint32_t* entries = static_cast<const uint32_t*>(latest->m_buffer->Map(m_entryCount * sizeof(uint32_t), 0));
+            if (!entries)
+            {
+                return false;
+            }
+
+            requestedMipsOut.resize_no_construct(m_entryCount);
+            for (uint32_t index = 0; index < m_entryCount; ++index)
+            {
+                const uint32_t entry = entries[index];
+                requestedMipsOut[index] = (entry >> FeedbackMipBitCount) == latest->m_frame
+                    ? aznumeric_cast<uint16_t>(FeedbackMipMask - (entry & FeedbackMipMask))
+                    : NoRequest;
+            }
+
+            latest->m_buffer->Unmap();
+            return true;
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -93,6 +93,11 @@ namespace AZ
             m_controller->Update();
         }
 
+        void StreamingImagePool::ApplyMipFeedback(AZStd::span<const uint16_t> requestedMips)
+        {
+            m_controller->ApplyMipFeedback(requestedMips);
+        }
+
         RHI::StreamingImagePool* StreamingImagePool::GetRHIPool()
         {
             return m_pool.get();
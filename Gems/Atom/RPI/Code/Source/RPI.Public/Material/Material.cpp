@@ -8,6 +8,7 @@
 
 #include <Atom/RPI.Public/ColorManagement/TransformColor.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Material/MaterialSystem.h>
 #include <Atom/RPI.Reflect/Image/AttachmentImageAsset.h>
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
@@ -21,9 +22,13 @@
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 #include <Atom/RPI.Reflect/Material/MaterialFunctor.h>
 
+#include <Atom/RPI.Reflect/Shader/IShaderVariantFinder.h>
+
 #include <AtomCore/Instance/InstanceDatabase.h>
 #include <AtomCore/Utils/ScopedValue.h>
 
+#include <AzCore/Component/TickBus.h>
+
 namespace AZ
 {
     namespace RPI
@@ -135,12 +140,34 @@ namespace AZ
             // the material, but some materials might not have any properties, and we need
             // the material to be invalidated particularly when hot-reloading.
             ++m_currentChangeId;
+            m_compiledPropertyValues.clear();
 
             Compile();
 
+            PrefetchShaderVariants();
+
             return RHI::ResultCode::Success;
         }
 
+        void Material::PrefetchShaderVariants()
+        {
+            if (!AZ::Interface<IShaderVariantFinder>::Get())
+            {
+                return;
+            }
+
+            // The shader options owned by the material are set by Compile, the options set later by the systems that
+            // render the material are left at their defaults, which is the likeliest variant until they are set.
+            ForAllShaderItems([](const Name&, const ShaderCollection::Item& shaderItem)
+                {
+                    if (shaderItem.IsEnabled() && shaderItem.GetShaderAsset().IsReady())
+                    {
+                        shaderItem.GetShaderAsset()->GetVariantAsset(shaderItem.GetShaderVariantId());
+                    }
+                    return true;
+                });
+        }
+
         Material::~Material()
         {
             Data::AssetBus::Handler::BusDisconnect();
@@ -332,7 +359,19 @@ namespace AZ
             // and mask out the parts of the ShaderVariantId that aren't owned by the material, but that would be premature optimization at this point, adding
             // potentially unnecessary complexity. There may also be more edge cases I haven't thought of. In short, it's much safer to just reinitialize every time
             // this callback happens.
-            Init(*m_materialAsset);
+            //
+            // Many variants of the same shaders usually arrive in the same frame, so the reinitialization is queued once for all of them.
+            if (m_isShaderVariantReinitQueued)
+            {
+                return;
+            }
+
+            m_isShaderVariantReinitQueued = true;
+            AZ::TickBus::QueueFunction([material = Data::Instance<Material>(this)]()
+                {
+                    material->m_isShaderVariantReinitQueued = false;
+                    material->Init(*material->m_materialAsset);
+                });
         }
         ///////////////////////////////////////////////////////////////////
 
@@ -610,6 +649,13 @@ namespace AZ
 
             if (CanCompile())
             {
+                if (!m_compiledPropertyValues.empty() && m_materialProperties.GetPropertyValues() == m_compiledPropertyValues)
+                {
+                    m_materialProperties.ClearAllPropertyDirtyFlags();
+                    m_compiledChangeId = m_currentChangeId;
+                    return true;
+                }
+
                 ProcessDirectConnections();
                 ProcessMaterialFunctors();
 
@@ -629,6 +675,7 @@ namespace AZ
                 }
 
                 m_compiledChangeId = m_currentChangeId;
+                m_compiledPropertyValues = m_materialProperties.GetPropertyValues();
 
                 return true;
             }
@@ -636,6 +683,23 @@ namespace AZ
             return false;
         }
 
+        void Material::QueueCompile()
+        {
+            if (!NeedsCompile())
+            {
+                return;
+            }
+
+            if (MaterialSystem* materialSystem = MaterialSystem::Get())
+            {
+                materialSystem->QueueCompile(this);
+            }
+            else
+            {
+                Compile();
+            }
+        }
+
         Material::ChangeId Material::GetCurrentChangeId() const
         {
             return m_currentChangeId;
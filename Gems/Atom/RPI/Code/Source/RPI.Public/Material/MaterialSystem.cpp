@@ -16,10 +16,55 @@
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/sort.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(uint32_t, r_materialCompileParallelMinCount, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The minimum number of materials queued for compile in a frame for them to be compiled in parallel.");
+
+        namespace
+        {
+            // The number of materials compiled by each task, for the material types that can be compiled in parallel
+            constexpr size_t MaterialsPerCompileTask = 16;
+
+            // Lua functors run in a script context owned by the functor, which is shared by all the materials of the material type
+            bool CanCompileMaterialTypeInParallel(const MaterialAsset& materialAsset)
+            {
+                const auto isLuaFunctor = [](const Ptr<MaterialFunctor>& functor)
+                {
+                    return azrtti_istypeof<LuaMaterialFunctor>(functor.get());
+                };
+
+                if (AZStd::any_of(materialAsset.GetMaterialFunctors().begin(), materialAsset.GetMaterialFunctors().end(), isLuaFunctor))
+                {
+                    return false;
+                }
+
+                for (const auto& materialPipelinePair : materialAsset.GetMaterialPipelinePayloads())
+                {
+                    const MaterialFunctorList& functors = materialPipelinePair.second.m_materialFunctors;
+                    if (AZStd::any_of(functors.begin(), functors.end(), isLuaFunctor))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+
+        MaterialSystem* MaterialSystem::Get()
+        {
+            return Interface<MaterialSystem>::Get();
+        }
+
         void MaterialSystem::Reflect(AZ::ReflectContext* context)
         {
             MaterialPropertyValue::Reflect(context);
@@ -46,12 +91,104 @@ namespace AZ
                 return Material::CreateInternal(*(azrtti_cast<MaterialAsset*>(materialAsset)));
             };
             Data::InstanceDatabase<Material>::Create(azrtti_typeid<MaterialAsset>(), handler);
+
+            Interface<MaterialSystem>::Register(this);
         }
 
         void MaterialSystem::Shutdown()
         {
+            Interface<MaterialSystem>::Unregister(this);
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_compileQueueMutex);
+                m_compileQueue.clear();
+            }
+
             Data::InstanceDatabase<Material>::Destroy();
         }
 
+        void MaterialSystem::QueueCompile(const Data::Instance<Material>& material)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_compileQueueMutex);
+            m_compileQueue.push_back(material);
+        }
+
+        void MaterialSystem::CompileQueuedMaterials()
+        {
+            AZStd::vector<Data::Instance<Material>> materials;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_compileQueueMutex);
+                AZStd::swap(materials, m_compileQueue);
+            }
+
+            if (materials.empty())
+            {
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "MaterialSystem: CompileQueuedMaterials");
+
+            // Group the materials by material type, and remove the materials that were queued more than once
+            const auto getMaterialType = [](const Data::Instance<Material>& material)
+            {
+                return material->GetAsset()->GetMaterialTypeAsset().Get();
+            };
+            AZStd::sort(materials.begin(), materials.end(),
+                [&getMaterialType](const Data::Instance<Material>& lhs, const Data::Instance<Material>& rhs)
+                {
+                    const MaterialTypeAsset* lhsType = getMaterialType(lhs);
+                    const MaterialTypeAsset* rhsType = getMaterialType(rhs);
+                    return lhsType != rhsType ? lhsType < rhsType : lhs.get() < rhs.get();
+                });
+            materials.erase(AZStd::unique(materials.begin(), materials.end()), materials.end());
+
+            const auto compileMaterials = [this](AZStd::span<const Data::Instance<Material>> materialsToCompile)
+            {
+                for (const Data::Instance<Material>& material : materialsToCompile)
+                {
+                    if (material->NeedsCompile() && !material->Compile())
+                    {
+                        QueueCompile(material);
+                    }
+                }
+            };
+
+            AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            if (materials.size() < r_materialCompileParallelMinCount || !taskGraphActive || !taskGraphActive->IsTaskGraphActive())
+            {
+                compileMaterials(materials);
+                return;
+            }
+
+            // The materials of a material type with functors that aren't thread safe are compiled by the same task,
+            // the other ones are split across several tasks
+            static const AZ::TaskDescriptor compileDescriptor{ "RPI_MaterialSystem_CompileMaterials", "Graphics" };
+            AZ::TaskGraph taskGraph{ "RPI::MaterialSystem::CompileQueuedMaterials" };
+            for (size_t first = 0; first < materials.size();)
+            {
+                size_t last = first + 1;
+                while (last < materials.size() && getMaterialType(materials[last]) == getMaterialType(materials[first]))
+                {
+                    ++last;
+                }
+
+                const size_t materialsPerTask = CanCompileMaterialTypeInParallel(*materials[first]->GetAsset()) ? MaterialsPerCompileTask : last - first;
+                for (size_t taskFirst = first; taskFirst < last; taskFirst += materialsPerTask)
+                {
+                    AZStd::span<const Data::Instance<Material>> taskMaterials(
+                        materials.data() + taskFirst, AZStd::min(materialsPerTask, last - taskFirst));
+                    taskGraph.AddTask(compileDescriptor, [&compileMaterials, taskMaterials]()
+                        {
+                            compileMaterials(taskMaterials);
+                        });
+                }
+                first = last;
+            }
+
+            AZ::TaskGraphEvent waitForCompletion{ "RPI::MaterialSystem::CompileQueuedMaterials Wait" };
+            taskGraph.Submit(&waitForCompletion);
+            waitForCompletion.Wait();
+        }
+
     } // namespace RPI
 } // namespace AZ
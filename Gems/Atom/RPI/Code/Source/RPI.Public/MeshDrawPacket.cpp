@@ -99,6 +99,15 @@ namespace AZ
             }
         }
 
+        void MeshDrawPacket::SetBindlessMaterialId(uint32_t bindlessMaterialId)
+        {
+            if (m_bindlessMaterialId != bindlessMaterialId)
+            {
+                m_needUpdate = true;
+                m_bindlessMaterialId = bindlessMaterialId;
+            }
+        }
+
         bool MeshDrawPacket::SetShaderOption(const Name& shaderOptionName, ShaderOptionValue value)
         {
             // check if the material owns this option in any of its shaders, if so it can't be set externally
@@ -368,6 +377,16 @@ namespace AZ
                         drawSrg->SetConstant(index, uvStreamTangentBitmask.GetFullTangentBitmask());
                     }
 
+                    // Pass the bindless material id to the shader if the draw SRG has it.
+                    if (m_bindlessMaterialId != InvalidBindlessMaterialId)
+                    {
+                        auto materialIdIndex = drawSrg->FindShaderInputConstantIndex(AZ::Name(BindlessMaterialIdSrgName));
+                        if (materialIdIndex.IsValid())
+                        {
+                            drawSrg->SetConstant(materialIdIndex, m_bindlessMaterialId);
+                        }
+                    }
+
                     drawSrg->Compile();
                 }
 
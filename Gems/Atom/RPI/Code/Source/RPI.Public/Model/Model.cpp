@@ -7,11 +7,13 @@
  */
 
 #include <Atom/RPI.Public/Model/Model.h>
+#include <Atom/RPI.Public/Model/ModelLodStreamingController.h>
 #include <Atom/RPI.Reflect/Model/ModelAsset.h>
 
 #include <Atom/RHI/Factory.h>
 
 #include <AtomCore/Instance/InstanceDatabase.h>
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Timer.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/IntersectSegment.h>
@@ -52,6 +54,17 @@ namespace AZ
                 Data::InstanceId::CreateFromAssetId(modelAsset.GetId()));
         }
 
+        Model::~Model()
+        {
+            if (m_lodStreamingState == LodStreamingState::Enabled)
+            {
+                if (ModelLodStreamingController* controller = ModelLodStreamingController::Get())
+                {
+                    controller->DetachModel(*this);
+                }
+            }
+        }
+
         size_t Model::GetLodCount() const
         {
             return m_lods.size();
@@ -122,6 +135,7 @@ namespace AZ
 
             m_modelAsset = modelAsset;
             m_isUploadPending = true;
+            m_lodResidency.Init(aznumeric_cast<uint32_t>(m_lods.size()));
             return RHI::ResultCode::Success;
         }
 
@@ -143,6 +157,49 @@ namespace AZ
             return m_isUploadPending;
         }
 
+        void Model::EnableLodStreaming()
+        {
+            ModelLodStreamingController* controller = ModelLodStreamingController::Get();
+            if (!controller || m_lods.size() < 2)
+            {
+                return;
+            }
+
+            LodStreamingState expectedState = LodStreamingState::Allowed;
+            if (m_lodStreamingState.compare_exchange_strong(expectedState, LodStreamingState::Enabled))
+            {
+                controller->AttachModel(*this);
+            }
+        }
+
+        void Model::DisableLodStreaming()
+        {
+            if (m_lodStreamingState.exchange(LodStreamingState::Disabled) != LodStreamingState::Enabled)
+            {
+                return;
+            }
+
+            if (ModelLodStreamingController* controller = ModelLodStreamingController::Get())
+            {
+                controller->DetachModel(*this);
+            }
+
+            for (const Data::Instance<ModelLod>& lod : m_lods)
+            {
+                if (!lod->AreBuffersResident())
+                {
+                    lod->MakeBuffersResident();
+                    lod->WaitForUpload();
+                }
+            }
+            m_lodResidency.SetMostDetailedResidentLod(0);
+        }
+
+        ModelLodResidency* Model::GetLodResidency()
+        {
+            return m_lodStreamingState == LodStreamingState::Enabled ? &m_lodResidency : nullptr;
+        }
+
         const Data::Asset<ModelAsset>& Model::GetModelAsset() const
         {
             return m_modelAsset;
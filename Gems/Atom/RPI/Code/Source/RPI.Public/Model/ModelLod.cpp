@@ -13,6 +13,7 @@
 #include <Atom/RHI.Reflect/InputStreamLayoutBuilder.h>
 
 #include <AtomCore/Instance/InstanceDatabase.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ
 {
@@ -93,7 +94,7 @@ namespace AZ
                     drawIndexed.m_instanceCount = 1;
                     meshInstance.m_drawArguments = drawIndexed;
 
-                    TrackBuffer(indexBuffer);
+                    TrackBuffer(indexBuffer, indexBufferAsset);
                 }
 
                 // [GFX TODO][ATOM-838]: We need to figure out how to load only the required streams from disk rather than all available streams.
@@ -395,7 +396,7 @@ namespace AZ
             info.m_byteOffset = bufferViewDescriptor.m_elementOffset * bufferViewDescriptor.m_elementSize;
             info.m_byteCount = bufferViewDescriptor.m_elementCount * bufferViewDescriptor.m_elementSize;
             info.m_stride = bufferViewDescriptor.m_elementSize;
-            info.m_bufferIndex = TrackBuffer(streamBuffer);
+            info.m_bufferIndex = TrackBuffer(streamBuffer, streamBufferAsset);
 
             meshInstance.m_streamInfo.push_back(info);
 
@@ -414,7 +415,54 @@ namespace AZ
             }
         }
 
-        uint32_t ModelLod::TrackBuffer(const Data::Instance<Buffer>& buffer)
+        void ModelLod::EvictBuffers()
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+            for (const Data::Instance<Buffer>& buffer : m_buffers)
+            {
+                buffer->Evict();
+            }
+            m_isUploadPending = false;
+        }
+
+        bool ModelLod::MakeBuffersResident()
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+            bool result = true;
+            for (size_t i = 0; i < m_buffers.size(); ++i)
+            {
+                if (m_buffers[i]->MakeResident(*m_bufferAssets[i]) != RHI::ResultCode::Success)
+                {
+                    AZ_Error("ModelLod", false, "Failed to make buffer '%s' resident.", m_bufferAssets[i].GetHint().c_str());
+                    result = false;
+                }
+            }
+            m_isUploadPending = true;
+            return result;
+        }
+
+        bool ModelLod::AreBuffersResident() const
+        {
+            return AZStd::all_of(
+                m_buffers.begin(),
+                m_buffers.end(),
+                [](const Data::Instance<Buffer>& buffer)
+                {
+                    return buffer->IsResident() && buffer->IsUploadComplete();
+                });
+        }
+
+        uint64_t ModelLod::GetBufferByteCount() const
+        {
+            uint64_t byteCount = 0;
+            for (const Data::Instance<Buffer>& buffer : m_buffers)
+            {
+                byteCount += buffer->GetBufferSize();
+            }
+            return byteCount;
+        }
+
+        uint32_t ModelLod::TrackBuffer(const Data::Instance<Buffer>& buffer, const Data::Asset<BufferAsset>& bufferAsset)
         {
             for (uint32_t i = 0; i < m_buffers.size(); ++i)
             {
@@ -426,6 +474,7 @@ namespace AZ
             }
 
             m_buffers.emplace_back(buffer);
+            m_bufferAssets.emplace_back(bufferAsset);
             return static_cast<uint32_t>(m_buffers.size() - 1);
         }
     } // namespace RPI
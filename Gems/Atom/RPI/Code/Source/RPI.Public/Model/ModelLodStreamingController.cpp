@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Model/ModelLodStreamingController.h>
+#include <Atom/RPI.Public/Model/Model.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+AZ_DECLARE_BUDGET(RPI);
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR(uint32_t, r_modelLodStreamingBudgetMB, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The GPU memory budget in MB of the lods of the streamed models. 0 means no budget.");
+
+        AZ_CVAR(uint32_t, r_modelLodStreamingEvictionDelay, 120, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of frames a lod of a streamed model stays resident after it was last requested.");
+
+        AZ_CVAR(uint32_t, r_modelLodStreamingMaxUploadsPerFrame, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The maximum number of lods of streamed models which start uploading each frame.");
+
+        ModelLodStreamingController* ModelLodStreamingController::Get()
+        {
+            return Interface<ModelLodStreamingController>::Get();
+        }
+
+        void ModelLodStreamingController::Init()
+        {
+            Interface<ModelLodStreamingController>::Register(this);
+        }
+
+        void ModelLodStreamingController::Shutdown()
+        {
+            Interface<ModelLodStreamingController>::Unregister(this);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_models.clear();
+            m_residentByteCount = 0;
+        }
+
+        void ModelLodStreamingController::AttachModel(Model& model)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            StreamingModel streamingModel;
+            streamingModel.m_model = &model;
+            streamingModel.m_lodRequestFrames.resize(model.GetLodCount(), m_frame);
+            streamingModel.m_expandingLod = aznumeric_cast<uint32_t>(model.GetLodCount());
+            m_models.emplace_back(AZStd::move(streamingModel));
+
+            for (const Data::Instance<ModelLod>& lod : model.GetLods())
+            {
+                m_residentByteCount += lod->GetBufferByteCount();
+            }
+        }
+
+        void ModelLodStreamingController::DetachModel(Model& model)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            auto it = AZStd::find_if(
+                m_models.begin(),
+                m_models.end(),
+                [&model](const StreamingModel& streamingModel)
+                {
+                    return streamingModel.m_model == &model;
+                });
+            if (it == m_models.end())
+            {
+                return;
+            }
+
+            const uint32_t residentLod = AZStd::min(it->m_expandingLod, model.m_lodResidency.GetMostDetailedResidentLod());
+            const auto lods = model.GetLods();
+            for (size_t lodIndex = residentLod; lodIndex < lods.size(); ++lodIndex)
+            {
+                m_residentByteCount -= lods[lodIndex]->GetBufferByteCount();
+            }
+
+            *it = AZStd::move(m_models.back());
+            m_models.pop_back();
+        }
+
+        uint64_t ModelLodStreamingController::GetResidentByteCount() const
+        {
+            return m_residentByteCount;
+        }
+
+        uint32_t ModelLodStreamingController::GetTargetLod(const StreamingModel& streamingModel) const
+        {
+            const uint32_t lodCount = aznumeric_cast<uint32_t>(streamingModel.m_lodRequestFrames.size());
+            for (uint32_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
+            {
+                if (m_frame - streamingModel.m_lodRequestFrames[lodIndex] <= r_modelLodStreamingEvictionDelay)
+                {
+                    return lodIndex;
+                }
+            }
+            return lodCount - 1;
+        }
+
+        void ModelLodStreamingController::Update()
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            ++m_frame;
+
+            struct ExpansionCandidate
+            {
+                StreamingModel* m_streamingModel = nullptr;
+                uint32_t m_missingLodCount = 0;
+            };
+            AZStd::vector<ExpansionCandidate> candidates;
+
+            for (StreamingModel& streamingModel : m_models)
+            {
+                ModelLodResidency& residency = streamingModel.m_model->m_lodResidency;
+                const auto lods = streamingModel.m_model->GetLods();
+                const uint32_t lodCount = residency.GetLodCount();
+
+                const uint32_t requestedLod = residency.TakeMostDetailedRequestedLod();
+                if (requestedLod < lodCount)
+                {
+                    streamingModel.m_lodRequestFrames[requestedLod] = m_frame;
+                }
+
+                uint32_t residentLod = residency.GetMostDetailedResidentLod();
+                if (streamingModel.m_expandingLod < lodCount)
+                {
+                    if (!lods[streamingModel.m_expandingLod]->AreBuffersResident())
+                    {
+                        continue;
+                    }
+
+                    // The upload is complete, so the lod can be drawn from the next frame on
+                    residentLod = streamingModel.m_expandingLod;
+                    residency.SetMostDetailedResidentLod(residentLod);
+                    streamingModel.m_expandingLod = lodCount;
+                }
+
+                const uint32_t targetLod = GetTargetLod(streamingModel);
+                while (residentLod < targetLod)
+                {
+                    // The culling stops selecting the lod before its buffers are released
+                    residency.SetMostDetailedResidentLod(residentLod + 1);
+                    m_residentByteCount -= lods[residentLod]->GetBufferByteCount();
+                    lods[residentLod]->EvictBuffers();
+                    ++residentLod;
+                }
+
+                if (residentLod > targetLod)
+                {
+                    candidates.push_back({ &streamingModel, residentLod - targetLod });
+                }
+            }
+
+            // The models missing the most lods are expanded first
+            AZStd::stable_sort(
+                candidates.begin(),
+                candidates.end(),
+                [](const ExpansionCandidate& lhs, const ExpansionCandidate& rhs)
+                {
+                    return lhs.m_missingLodCount > rhs.m_missingLodCount;
+                });
+
+            const uint64_t budgetInBytes = aznumeric_cast<uint64_t>(r_modelLodStreamingBudgetMB) * 1024 * 1024;
+            uint32_t uploadCount = 0;
+            for (const ExpansionCandidate& candidate : candidates)
+            {
+                if (uploadCount >= r_modelLodStreamingMaxUploadsPerFrame)
+                {
+                    break;
+                }
+
+                StreamingModel& streamingModel = *candidate.m_streamingModel;
+                const uint32_t lodIndex = streamingModel.m_model->m_lodResidency.GetMostDetailedResidentLod() - 1;
+                ModelLod& lod = *streamingModel.m_model->GetLods()[lodIndex];
+
+                // A smaller lod of another model may still fit in the budget
+                const uint64_t byteCount = lod.GetBufferByteCount();
+                if (budgetInBytes > 0 && m_residentByteCount + byteCount > budgetInBytes)
+                {
+                    continue;
+                }
+
+                if (!lod.MakeBuffersResident())
+                {
+                    lod.EvictBuffers();
+                    continue;
+                }
+                m_residentByteCount += byteCount;
+                streamingModel.m_expandingLod = lodIndex;
+                ++uploadCount;
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -7,6 +7,7 @@
  */
 
 #include <Atom/RHI/CommandList.h>
+#include <Atom/RHI/Device.h>
 #include <Atom/RHI/DrawListTagRegistry.h>
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RHI/ShaderResourceGroup.h>
@@ -21,6 +22,8 @@
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 #include <Atom/RPI.Reflect/Pass/RasterPassData.h>
 
+#include <AzCore/std/algorithm.h>
+
 namespace AZ
 {
     namespace RPI
@@ -46,6 +49,7 @@ namespace AZ
 
             SetDrawListTag(rasterData->m_drawListTag);
             m_drawListSortType = rasterData->m_drawListSortType;
+            SetShadingRate(rasterData->m_shadingRate);
 
             // Get the shader asset that contains the SRG Layout.
             Data::Asset<ShaderAsset> shaderAsset;
@@ -119,6 +123,32 @@ namespace AZ
             return m_drawItemCount;
         }
 
+        void RasterPass::SetShadingRate(RHI::ShadingRate shadingRate)
+        {
+            m_shadingRate = RHI::ShadingRate::Rate1x1;
+            if (shadingRate == RHI::ShadingRate::Rate1x1)
+            {
+                return;
+            }
+
+            const RHI::DeviceFeatures& features = RHI::RHISystemInterface::Get()->GetDevice()->GetFeatures();
+            const RHI::ShadingRateFlags rateFlag = static_cast<RHI::ShadingRateFlags>(AZ_BIT(static_cast<uint32_t>(shadingRate)));
+            if (!RHI::CheckBitsAll(features.m_shadingRateTypeMask, RHI::ShadingRateTypeFlags::PerDraw) ||
+                !RHI::CheckBitsAll(features.m_shadingRateMask, rateFlag))
+            {
+                AZ_Warning("RasterPass", false, "[RasterPass '%s']: Shading rate %u is not supported per draw by the device, using Rate1x1.",
+                    GetPathName().GetCStr(), static_cast<uint32_t>(shadingRate));
+                return;
+            }
+
+            m_shadingRate = shadingRate;
+        }
+
+        RHI::ShadingRate RasterPass::GetShadingRate() const
+        {
+            return m_shadingRate;
+        }
+
         // --- Pass behaviour overrides ---
 
         void RasterPass::Validate(PassValidationResults& validationResults)
@@ -139,6 +169,28 @@ namespace AZ
                 m_viewportState = params.m_viewportState;
             }
 
+            // Render targets sized from the pipeline's render settings (e.g. when the render resolution is scaled dynamically)
+            // can be smaller than the pipeline output, so fit the viewport and scissor to them.
+            for (const PassAttachmentBinding& binding : m_attachmentBindings)
+            {
+                const PassAttachment* attachment = binding.GetAttachment().get();
+                if (attachment && attachment->m_getSizeFromPipeline &&
+                    (binding.m_scopeAttachmentUsage == RHI::ScopeAttachmentUsage::RenderTarget ||
+                     binding.m_scopeAttachmentUsage == RHI::ScopeAttachmentUsage::DepthStencil))
+                {
+                    const RHI::Size& targetSize = attachment->m_descriptor.m_image.m_size;
+                    if (!m_overrideViewportState)
+                    {
+                        m_viewportState = RHI::Viewport(0, static_cast<float>(targetSize.m_width), 0, static_cast<float>(targetSize.m_height));
+                    }
+                    if (!m_overrideScissorSate)
+                    {
+                        m_scissorState = RHI::Scissor(0, 0, static_cast<int32_t>(targetSize.m_width), static_cast<int32_t>(targetSize.m_height));
+                    }
+                    break;
+                }
+            }
+
             UpdateDrawList();
 
             RenderPass::FrameBeginInternal(params);
@@ -250,7 +302,33 @@ namespace AZ
                 commandList->SetViewport(m_viewportState);
                 commandList->SetScissor(m_scissorState);
                 SetSrgsForDraw(commandList);
+
+                if (m_shadingRate != RHI::ShadingRate::Rate1x1)
+                {
+                    // Use the coarser of the pass rate and the rate from the shading rate attachment, if there's one
+                    commandList->SetFragmentShadingRate(
+                        m_shadingRate,
+                        RHI::ShadingRateCombinators{ RHI::ShadingRateCombinerOp::Passthrough, RHI::ShadingRateCombinerOp::Max });
+                }
+
                 SubmitDrawItems(context, context.GetSubmitRange().m_startIndex, context.GetSubmitRange().m_endIndex, 0);
+
+                if (m_shadingRate != RHI::ShadingRate::Rate1x1)
+                {
+                    // Restore the state the backends set up when beginning the scope, since the command list may be reused by other passes
+                    const bool hasShadingRateAttachment = AZStd::any_of(
+                        m_attachmentBindings.begin(),
+                        m_attachmentBindings.end(),
+                        [](const PassAttachmentBinding& binding)
+                        {
+                            return binding.m_scopeAttachmentUsage == RHI::ScopeAttachmentUsage::ShadingRate;
+                        });
+                    commandList->SetFragmentShadingRate(
+                        RHI::ShadingRate::Rate1x1,
+                        hasShadingRateAttachment
+                            ? RHI::ShadingRateCombinators{ RHI::ShadingRateCombinerOp::Passthrough, RHI::ShadingRateCombinerOp::Override }
+                            : RHI::CommandList::DefaultShadingRateCombinators);
+                }
             }
         }
 
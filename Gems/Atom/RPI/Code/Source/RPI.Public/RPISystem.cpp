@@ -285,6 +285,9 @@ namespace AZ
 
             m_currentSimulationTime = GetCurrentTime();
 
+            // The materials changed since the last frame are compiled before the feature processors rebuild their draw packets
+            m_materialSystem.CompileQueuedMaterials();
+
             for (auto& scene : m_scenes)
             {
                 scene->Simulate(m_simulationJobPolicy, m_currentSimulationTime);
@@ -310,6 +313,9 @@ namespace AZ
             // Query system update is to increment the frame count
             m_querySystem.Update();
 
+            // Model lods are evicted or made resident before the culling of this frame selects them
+            m_modelSystem.Update();
+
             // Collect draw packets for each scene and prepare RPI system SRGs
             // [GFX TODO] We may parallel scenes' prepare render.
             for (auto& scenePtr : m_scenes)
@@ -330,6 +336,8 @@ namespace AZ
                 {
                     // Pass system's frame update, which includes the logic of adding scope producers, has to be added here since the
                     // scope producers only can be added to the frame when frame started which cleans up previous scope producers.
+                    // The streaming image feedback is read back before the passes write the feedback of the new frame.
+                    m_imageSystem.FrameUpdate(frameGraphBuilder);
                     m_passSystem.FrameUpdate(frameGraphBuilder);
 
                     // Update Scene and View Srgs
@@ -10,6 +10,9 @@
 #include <Atom/RPI.Public/DynamicDraw/DynamicDrawSystem.h>
 #include <Atom/RPI.Public/FeatureProcessorFactory.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
+#include <Atom/RPI.Public/Image/StreamingImageFeedback.h>
 #include <Atom/RPI.Public/Pass/FullscreenTrianglePass.h>
 #include <Atom/RPI.Public/Pass/RasterPass.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
@@ -50,6 +53,9 @@ namespace AZ
             {
                 auto shaderAsset = RPISystemInterface::Get()->GetCommonShaderAssetForSrgs();
                 scene->m_srg = ShaderResourceGroup::Create(shaderAsset, sceneSrgLayout->GetName());
+
+                scene->m_textureStreamingFeedbackIndex = sceneSrgLayout->FindShaderInputBufferIndex(Name("m_textureStreamingFeedback"));
+                scene->m_textureStreamingFeedbackFrameIndex = sceneSrgLayout->FindShaderInputConstantIndex(Name("m_textureStreamingFeedbackFrame"));
             }
 
             return ScenePtr(scene);
@@ -560,6 +566,17 @@ namespace AZ
                 m_srg->SetConstant(m_timeInputIndex, m_simulationTime);
                 m_srg->SetConstant(m_prevTimeInputIndex, m_prevSimulationTime);
 
+                // The shaders skip writing the feedback when its frame is 0
+                if (m_textureStreamingFeedbackIndex.IsValid() && m_textureStreamingFeedbackFrameIndex.IsValid())
+                {
+                    const StreamingImageFeedback* feedback = ImageSystemInterface::Get()->GetStreamingImageFeedback();
+                    if (feedback)
+                    {
+                        m_srg->SetBufferView(m_textureStreamingFeedbackIndex, feedback->GetFeedbackBuffer()->GetBufferView());
+                    }
+                    m_srg->SetConstant(m_textureStreamingFeedbackFrameIndex, feedback ? feedback->GetFeedbackFrame() : 0u);
+                }
+
                 // signal any handlers to update values for their partial scene srg
                 m_prepareSrgEvent.Signal(m_srg.get());
 
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Model/ModelMeshlets.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace
+        {
+            static constexpr uint32_t InvalidLocalIndex = 0xFFFFFFFF;
+
+            Vector3 GetPosition(AZStd::span<const float> positions, uint32_t vertexIndex)
+            {
+                return Vector3(positions[vertexIndex * 3], positions[vertexIndex * 3 + 1], positions[vertexIndex * 3 + 2]);
+            }
+
+            void ComputeMeshletBounds(Meshlet& meshlet, const ModelMeshlets& meshlets, AZStd::span<const float> positions)
+            {
+                const uint32_t* vertexIndices = meshlets.m_vertexIndices.data() + meshlet.m_vertexOffset;
+
+                Aabb aabb = Aabb::CreateNull();
+                for (uint32_t i = 0; i < meshlet.m_vertexCount; ++i)
+                {
+                    aabb.AddPoint(GetPosition(positions, vertexIndices[i]));
+                }
+
+                const Vector3 center = aabb.GetCenter();
+                float radiusSq = 0.0f;
+                for (uint32_t i = 0; i < meshlet.m_vertexCount; ++i)
+                {
+                    radiusSq = AZStd::max(radiusSq, GetPosition(positions, vertexIndices[i]).GetDistanceSq(center));
+                }
+                center.StoreToFloat3(meshlet.m_center);
+                meshlet.m_radius = AZStd::sqrt(radiusSq);
+
+                // The cone axis is the average direction of the triangles, and its angle covers the normal farthest from it
+                AZStd::vector<Vector3> normals;
+                normals.reserve(meshlet.m_triangleCount);
+                Vector3 normalSum = Vector3::CreateZero();
+                for (uint32_t i = 0; i < meshlet.m_triangleCount; ++i)
+                {
+                    const uint32_t triangle = meshlets.m_triangles[meshlet.m_triangleOffset + i];
+                    const Vector3 p0 = GetPosition(positions, vertexIndices[triangle & 0xFF]);
+                    const Vector3 p1 = GetPosition(positions, vertexIndices[(triangle >> 8) & 0xFF]);
+                    const Vector3 p2 = GetPosition(positions, vertexIndices[(triangle >> 16) & 0xFF]);
+                    const Vector3 normal = (p1 - p0).Cross(p2 - p0);
+                    if (normal.GetLengthSq() > 0.0f)
+                    {
+                        normals.push_back(normal.GetNormalized());
+                        normalSum += normals.back();
+                    }
+                }
+
+                meshlet.m_coneCutoff = 1.0f;
+                if (normals.empty() || normalSum.GetLengthSq() <= 0.0f)
+                {
+                    return;
+                }
+
+                const Vector3 axis = normalSum.GetNormalized();
+                float minDot = 1.0f;
+                for (const Vector3& normal : normals)
+                {
+                    minDot = AZStd::min(minDot, axis.Dot(normal));
+                }
+                axis.StoreToFloat3(meshlet.m_coneAxis);
+                if (minDot > 0.0f)
+                {
+                    meshlet.m_coneCutoff = AZStd::sqrt(1.0f - minDot * minDot);
+                }
+            }
+        } // namespace
+
+        ModelMeshlets BuildModelMeshlets(
+            AZStd::span<const uint32_t> indices, AZStd::span<const float> positions, uint32_t maxVertexCount, uint32_t maxTriangleCount)
+        {
+            ModelMeshlets result;
+
+            // Meshlet triangles index the meshlet vertices with a byte
+            maxVertexCount = AZStd::clamp(maxVertexCount, 3u, 256u);
+            maxTriangleCount = AZStd::max(maxTriangleCount, 1u);
+
+            const uint32_t vertexCount = aznumeric_cast<uint32_t>(positions.size() / 3);
+            for (uint32_t index : indices)
+            {
+                if (index >= vertexCount)
+                {
+                    AZ_Error("ModelMeshlets", false, "Index %u is out of range of the %u vertices of the mesh.", index, vertexCount);
+                    return result;
+                }
+            }
+
+            AZStd::vector<uint32_t> localIndices(vertexCount, InvalidLocalIndex);
+            Meshlet meshlet;
+
+            auto finishMeshlet = [&]()
+            {
+                if (meshlet.m_triangleCount == 0)
+                {
+                    return;
+                }
+
+                ComputeMeshletBounds(meshlet, result, positions);
+                for (uint32_t i = 0; i < meshlet.m_vertexCount; ++i)
+                {
+                    localIndices[result.m_vertexIndices[meshlet.m_vertexOffset + i]] = InvalidLocalIndex;
+                }
+                result.m_meshlets.push_back(meshlet);
+
+                meshlet = {};
+                meshlet.m_vertexOffset = aznumeric_cast<uint32_t>(result.m_vertexIndices.size());
+                meshlet.m_triangleOffset = aznumeric_cast<uint32_t>(result.m_triangles.size());
+            };
+
+            for (size_t triangleIndex = 0; triangleIndex + 2 < indices.size(); triangleIndex += 3)
+            {
+                const uint32_t a = indices[triangleIndex];
+                const uint32_t b = indices[triangleIndex + 1];
+                const uint32_t c = indices[triangleIndex + 2];
+
+                uint32_t newVertexCount = (localIndices[a] == InvalidLocalIndex) ? 1 : 0;
+                newVertexCount += (localIndices[b] == InvalidLocalIndex && b != a) ? 1 : 0;
+                newVertexCount += (localIndices[c] == InvalidLocalIndex && c != a && c != b) ? 1 : 0;
+
+                if (meshlet.m_vertexCount + newVertexCount > maxVertexCount || meshlet.m_triangleCount + 1 > maxTriangleCount)
+                {
+                    finishMeshlet();
+                }
+
+                uint32_t triangle = 0;
+                for (uint32_t corner = 0; corner < 3; ++corner)
+                {
+                    const uint32_t vertexIndex = indices[triangleIndex + corner];
+                    if (localIndices[vertexIndex] == InvalidLocalIndex)
+                    {
+                        localIndices[vertexIndex] = meshlet.m_vertexCount++;
+                        result.m_vertexIndices.push_back(vertexIndex);
+                    }
+                    triangle |= localIndices[vertexIndex] << (corner * 8);
+                }
+                result.m_triangles.push_back(triangle);
+                ++meshlet.m_triangleCount;
+            }
+            finishMeshlet();
+
+            return result;
+        }
+
+        bool IsMeshletBackFacing(const Meshlet& meshlet, const Vector3& cameraPosition)
+        {
+            if (meshlet.m_coneCutoff >= 1.0f)
+            {
+                return false;
+            }
+
+            const Vector3 toCenter = Vector3::CreateFromFloat3(meshlet.m_center) - cameraPosition;
+            return toCenter.Dot(Vector3::CreateFromFloat3(meshlet.m_coneAxis)) >= meshlet.m_coneCutoff * toCenter.GetLength() + meshlet.m_radius;
+        }
+    } // namespace RPI
+} // namespace AZ
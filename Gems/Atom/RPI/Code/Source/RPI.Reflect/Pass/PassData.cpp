@@ -62,12 +62,13 @@ namespace AZ
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
             {
                 serializeContext->Class<RasterPassData, RenderPassData>()
-                    ->Version(3) // ATOM-15472
+                    ->Version(4)
                     ->Field("DrawListTag", &RasterPassData::m_drawListTag)
                     ->Field("PassSrgShaderAsset", &RasterPassData::m_passSrgShaderReference)
                     ->Field("Viewport", &RasterPassData::m_overrideViewport)
                     ->Field("Scissor", &RasterPassData::m_overrideScissor)
                     ->Field("DrawListSortType", &RasterPassData::m_drawListSortType)
+                    ->Field("ShadingRate", &RasterPassData::m_shadingRate)
                     ;
             }
         }
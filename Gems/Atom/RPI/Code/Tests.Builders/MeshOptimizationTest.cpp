@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/sort.h>
+
+#include <Model/MeshOptimization.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    class MeshOptimizationTests
+        : public LeakDetectionFixture
+    {
+    protected:
+        //! Creates a grid of quads whose triangles are ordered column by column, which reuses few vertices in a small cache.
+        static AZStd::vector<uint32_t> CreateGridIndices(uint32_t quadsPerSide)
+        {
+            const uint32_t verticesPerSide = quadsPerSide + 1;
+            AZStd::vector<uint32_t> indices;
+            for (uint32_t x = 0; x < quadsPerSide; ++x)
+            {
+                for (uint32_t y = 0; y < quadsPerSide; ++y)
+                {
+                    const uint32_t corner = y * verticesPerSide + x;
+                    indices.insert(indices.end(), { corner, corner + 1, corner + verticesPerSide });
+                    indices.insert(indices.end(), { corner + 1, corner + verticesPerSide + 1, corner + verticesPerSide });
+                }
+            }
+            return indices;
+        }
+
+        //! Counts the vertices a FIFO post-transform cache needs to transform for the given indices.
+        static size_t CountCacheMisses(const AZStd::vector<uint32_t>& indices, size_t cacheSize)
+        {
+            AZStd::vector<uint32_t> cache;
+            size_t misses = 0;
+            for (uint32_t index : indices)
+            {
+                if (AZStd::find(cache.begin(), cache.end(), index) == cache.end())
+                {
+                    ++misses;
+                    cache.push_back(index);
+                    if (cache.size() > cacheSize)
+                    {
+                        cache.erase(cache.begin());
+                    }
+                }
+            }
+            return misses;
+        }
+
+        static AZStd::vector<AZStd::array<uint32_t, 3>> GetSortedTriangles(const AZStd::vector<uint32_t>& indices)
+        {
+            AZStd::vector<AZStd::array<uint32_t, 3>> triangles;
+            for (size_t i = 0; i < indices.size(); i += 3)
+            {
+                triangles.push_back({ indices[i], indices[i + 1], indices[i + 2] });
+            }
+            AZStd::sort(triangles.begin(), triangles.end(),
+                [](const AZStd::array<uint32_t, 3>& lhs, const AZStd::array<uint32_t, 3>& rhs)
+                {
+                    return AZStd::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+                });
+            return triangles;
+        }
+    };
+
+    TEST_F(MeshOptimizationTests, OptimizeVertexCache_GridMesh_KeepsTrianglesAndReducesCacheMisses)
+    {
+        constexpr uint32_t QuadsPerSide = 32;
+        const AZStd::vector<uint32_t> originalIndices = CreateGridIndices(QuadsPerSide);
+        const size_t vertexCount = (QuadsPerSide + 1) * (QuadsPerSide + 1);
+
+        AZStd::vector<uint32_t> optimizedIndices = originalIndices;
+        RPI::MeshOptimization::OptimizeVertexCache(optimizedIndices, vertexCount);
+
+        ASSERT_EQ(optimizedIndices.size(), originalIndices.size());
+        EXPECT_EQ(GetSortedTriangles(optimizedIndices), GetSortedTriangles(originalIndices));
+
+        constexpr size_t CacheSize = 16;
+        EXPECT_LT(CountCacheMisses(optimizedIndices, CacheSize), CountCacheMisses(originalIndices, CacheSize));
+    }
+
+    TEST_F(MeshOptimizationTests, OptimizeVertexCache_OutOfRangeIndex_LeavesIndicesUnchanged)
+    {
+        const AZStd::vector<uint32_t> originalIndices = { 0, 1, 2, 2, 1, 5 };
+        AZStd::vector<uint32_t> indices = originalIndices;
+
+        RPI::MeshOptimization::OptimizeVertexCache(indices, 4);
+
+        EXPECT_EQ(indices, originalIndices);
+    }
+
+    TEST_F(MeshOptimizationTests, OptimizeVertexFetch_OrdersVerticesByFirstUse)
+    {
+        AZStd::vector<uint32_t> indices = { 2, 0, 3, 3, 0, 2 };
+        const AZStd::vector<uint32_t> vertexRemap = RPI::MeshOptimization::OptimizeVertexFetch(indices, 5);
+
+        // Vertex 1 and 4 aren't referenced and move to the end.
+        const AZStd::vector<uint32_t> expectedRemap = { 1, 3, 0, 2, 4 };
+        const AZStd::vector<uint32_t> expectedIndices = { 0, 1, 2, 2, 1, 0 };
+        EXPECT_EQ(vertexRemap, expectedRemap);
+        EXPECT_EQ(indices, expectedIndices);
+
+        AZStd::vector<float> positions = { 0.0f, 0.5f, 1.0f, 1.5f, 2.0f, 2.5f, 3.0f, 3.5f, 4.0f, 4.5f };
+        RPI::MeshOptimization::RemapVertexStream(positions, vertexRemap, 2);
+        const AZStd::vector<float> expectedPositions = { 2.0f, 2.5f, 0.0f, 0.5f, 3.0f, 3.5f, 1.0f, 1.5f, 4.0f, 4.5f };
+        EXPECT_EQ(positions, expectedPositions);
+    }
+} // namespace UnitTest
@@ -442,6 +442,39 @@ namespace UnitTest
         EXPECT_EQ(srgData.GetConstant<float>(srgData.FindShaderInputConstantIndex(Name{ "m_float" })), 0.0f);
     }
 
+    TEST_F(MaterialTests, TestSetPropertyValueBackToCompiledValue)
+    {
+        Data::Instance<Material> material = Material::FindOrCreate(m_testMaterialAsset);
+
+        EXPECT_TRUE(material->SetPropertyValue<float>(material->FindPropertyIndex(Name{ "MyFloat" }), 2.5f));
+
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+        EXPECT_TRUE(material->Compile());
+
+        // Taint the SRG so we can check whether it was set by the Compile() below.
+        const RHI::ShaderResourceGroup* srg = material->GetRHIShaderResourceGroup();
+        const RHI::ShaderResourceGroupData& srgData = srg->GetData();
+        const_cast<RHI::ShaderResourceGroupData*>(&srgData)->SetConstant(m_testMaterialSrgLayout->FindShaderInputConstantIndex(Name{"m_float"}), 0.0f);
+
+        // Change the value, and set it back to the compiled value before compiling
+        EXPECT_TRUE(material->SetPropertyValue<float>(material->FindPropertyIndex(Name{ "MyFloat" }), 1.0f));
+        EXPECT_TRUE(material->SetPropertyValue<float>(material->FindPropertyIndex(Name{ "MyFloat" }), 2.5f));
+        EXPECT_TRUE(material->NeedsCompile());
+
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+        EXPECT_TRUE(material->Compile());
+        EXPECT_FALSE(material->NeedsCompile());
+
+        // Make sure the SRG is still tainted, because the property values are the same as in the last compile
+        EXPECT_EQ(srgData.GetConstant<float>(srgData.FindShaderInputConstantIndex(Name{ "m_float" })), 0.0f);
+
+        // A different value is compiled as usual
+        EXPECT_TRUE(material->SetPropertyValue<float>(material->FindPropertyIndex(Name{ "MyFloat" }), 1.0f));
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+        EXPECT_TRUE(material->Compile());
+        EXPECT_EQ(srgData.GetConstant<float>(srgData.FindShaderInputConstantIndex(Name{ "m_float" })), 1.0f);
+    }
+
     TEST_F(MaterialTests, TestImageNotProvided)
     {
         Data::Asset<MaterialAsset> materialAssetWithEmptyImage;
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Atom/RPI.Public/Model/ModelLodResidency.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    TEST(ModelLodResidencyTest, RequestLod_ReturnsMostDetailedResidentLod)
+    {
+        RPI::ModelLodResidency residency;
+        residency.Init(4);
+        EXPECT_EQ(residency.RequestLod(0), 0u);
+
+        residency.SetMostDetailedResidentLod(2);
+        EXPECT_EQ(residency.RequestLod(0), 2u);
+        EXPECT_EQ(residency.RequestLod(1), 2u);
+        EXPECT_EQ(residency.RequestLod(3), 3u);
+    }
+
+    TEST(ModelLodResidencyTest, TakeMostDetailedRequestedLod_ResetsRequests)
+    {
+        RPI::ModelLodResidency residency;
+        residency.Init(4);
+        EXPECT_EQ(residency.TakeMostDetailedRequestedLod(), 4u);
+
+        residency.SetMostDetailedResidentLod(3);
+        residency.RequestLod(2);
+        residency.RequestLod(1);
+        residency.RequestLod(3);
+        EXPECT_EQ(residency.TakeMostDetailedRequestedLod(), 1u);
+        EXPECT_EQ(residency.TakeMostDetailedRequestedLod(), 4u);
+    }
+} // namespace UnitTest
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Atom/RPI.Reflect/Model/ModelMeshlets.h>
+#include <AzCore/Math/Vector3.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    namespace
+    {
+        //! A flat grid of quads on the XY plane, facing +Z.
+        void CreateGrid(uint32_t quadsPerSide, AZStd::vector<uint32_t>& indices, AZStd::vector<float>& positions)
+        {
+            const uint32_t verticesPerSide = quadsPerSide + 1;
+            for (uint32_t y = 0; y < verticesPerSide; ++y)
+            {
+                for (uint32_t x = 0; x < verticesPerSide; ++x)
+                {
+                    positions.push_back(x * 0.1f);
+                    positions.push_back(y * 0.1f);
+                    positions.push_back(0.0f);
+                }
+            }
+
+            for (uint32_t y = 0; y < quadsPerSide; ++y)
+            {
+                for (uint32_t x = 0; x < quadsPerSide; ++x)
+                {
+                    const uint32_t i00 = y * verticesPerSide + x;
+                    const uint32_t i10 = i00 + 1;
+                    const uint32_t i01 = i00 + verticesPerSide;
+                    const uint32_t i11 = i01 + 1;
+                    indices.insert(indices.end(), { i00, i10, i11, i00, i11, i01 });
+                }
+            }
+        }
+    } // namespace
+
+    TEST(ModelMeshletsTest, BuildModelMeshlets_CoversEveryTriangleInOrder)
+    {
+        AZStd::vector<uint32_t> indices;
+        AZStd::vector<float> positions;
+        CreateGrid(16, indices, positions);
+
+        const RPI::ModelMeshlets meshlets = RPI::BuildModelMeshlets(indices, positions);
+        EXPECT_GT(meshlets.m_meshlets.size(), 1u);
+
+        size_t triangleIndex = 0;
+        for (const RPI::Meshlet& meshlet : meshlets.m_meshlets)
+        {
+            EXPECT_LE(meshlet.m_vertexCount, RPI::MeshletMaxVertexCount);
+            EXPECT_LE(meshlet.m_triangleCount, RPI::MeshletMaxTriangleCount);
+            EXPECT_EQ(meshlet.m_triangleOffset, triangleIndex);
+
+            for (uint32_t i = 0; i < meshlet.m_triangleCount; ++i, ++triangleIndex)
+            {
+                const uint32_t triangle = meshlets.m_triangles[meshlet.m_triangleOffset + i];
+                for (uint32_t corner = 0; corner < 3; ++corner)
+                {
+                    const uint32_t localIndex = (triangle >> (corner * 8)) & 0xFF;
+                    ASSERT_LT(localIndex, meshlet.m_vertexCount);
+                    EXPECT_EQ(meshlets.m_vertexIndices[meshlet.m_vertexOffset + localIndex], indices[triangleIndex * 3 + corner]);
+                }
+            }
+        }
+        EXPECT_EQ(triangleIndex * 3, indices.size());
+    }
+
+    TEST(ModelMeshletsTest, BuildModelMeshlets_RespectsLimits)
+    {
+        AZStd::vector<uint32_t> indices;
+        AZStd::vector<float> positions;
+        CreateGrid(8, indices, positions);
+
+        const RPI::ModelMeshlets meshlets = RPI::BuildModelMeshlets(indices, positions, 16, 8);
+        for (const RPI::Meshlet& meshlet : meshlets.m_meshlets)
+        {
+            EXPECT_LE(meshlet.m_vertexCount, 16u);
+            EXPECT_LE(meshlet.m_triangleCount, 8u);
+        }
+    }
+
+    TEST(ModelMeshletsTest, IsMeshletBackFacing_FlatMeshletIsCulledFromBehind)
+    {
+        AZStd::vector<uint32_t> indices;
+        AZStd::vector<float> positions;
+        CreateGrid(2, indices, positions);
+
+        const RPI::ModelMeshlets meshlets = RPI::BuildModelMeshlets(indices, positions);
+        ASSERT_EQ(meshlets.m_meshlets.size(), 1u);
+
+        const RPI::Meshlet& meshlet = meshlets.m_meshlets[0];
+        EXPECT_NEAR(meshlet.m_coneAxis[2], 1.0f, 0.0001f);
+        EXPECT_NEAR(meshlet.m_coneCutoff, 0.0f, 0.0001f);
+
+        EXPECT_FALSE(RPI::IsMeshletBackFacing(meshlet, Vector3(0.1f, 0.1f, 10.0f)));
+        EXPECT_TRUE(RPI::IsMeshletBackFacing(meshlet, Vector3(0.1f, 0.1f, -10.0f)));
+
+        // Too close to the plane for the whole meshlet to face away
+        EXPECT_FALSE(RPI::IsMeshletBackFacing(meshlet, Vector3(0.1f, 0.1f, -0.01f)));
+    }
+
+    TEST(ModelMeshletsTest, IsMeshletBackFacing_OpposingTrianglesAreNeverCulled)
+    {
+        const AZStd::vector<float> positions = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+        const AZStd::vector<uint32_t> indices = { 0, 1, 2, 0, 2, 1 };
+
+        const RPI::ModelMeshlets meshlets = RPI::BuildModelMeshlets(indices, positions);
+        ASSERT_EQ(meshlets.m_meshlets.size(), 1u);
+        EXPECT_GE(meshlets.m_meshlets[0].m_coneCutoff, 1.0f);
+        EXPECT_FALSE(RPI::IsMeshletBackFacing(meshlets.m_meshlets[0], Vector3(0.0f, 0.0f, -10.0f)));
+        EXPECT_FALSE(RPI::IsMeshletBackFacing(meshlets.m_meshlets[0], Vector3(0.0f, 0.0f, 10.0f)));
+    }
+} // namespace UnitTest
@@ -251,4 +251,37 @@ namespace UnitTest
             m_cullingScene->UnregisterCullable(object);
         }
     }
+
+    TEST_F(CullingTests, HierarchicalDepthOcclusionTest)
+    {
+        for (Cullable& object : m_testObjects)
+        {
+            m_cullingScene->RegisterOrUpdateCullable(object);
+        }
+
+        // The objects in front of the first camera are 9 to 11 meters away, so a wall of depth at 5 meters hides all of them
+        constexpr uint32_t depthSize = 16;
+        AZStd::vector<float> linearDepth(depthSize * depthSize, 5.0f);
+        ViewPtr& view = m_views[YPositive];
+        view->SetOcclusionCullingMode(View::OcclusionCullingMode::HierarchicalDepth);
+        view->GetHierarchicalDepthBuffer().Update(linearDepth, depthSize, depthSize, view->GetWorldToClipMatrix());
+
+        Cull(m_views);
+
+        EXPECT_EQ(m_views[YPositive]->GetVisibleObjectList().size(), 0);
+        EXPECT_EQ(m_views[XNegative]->GetVisibleObjectList().size(), 3);
+
+        // A single texel behind the objects is enough for them to be visible again
+        linearDepth[(depthSize / 2) * depthSize + depthSize / 2] = 50.0f;
+        view->GetHierarchicalDepthBuffer().Update(linearDepth, depthSize, depthSize, view->GetWorldToClipMatrix());
+
+        Cull(m_views);
+
+        EXPECT_EQ(m_views[YPositive]->GetVisibleObjectList().size(), 4);
+
+        for (Cullable& object : m_testObjects)
+        {
+            m_cullingScene->UnregisterCullable(object);
+        }
+    }
 }
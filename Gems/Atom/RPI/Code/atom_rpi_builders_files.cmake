@@ -21,6 +21,8 @@ set(FILES
     Source/RPI.Builders/Material/MaterialTypeBuilder.h
     Source/RPI.Builders/Model/MaterialAssetBuilderComponent.cpp
     Source/RPI.Builders/Model/MaterialAssetBuilderComponent.h
+    Source/RPI.Builders/Model/MeshOptimization.cpp
+    Source/RPI.Builders/Model/MeshOptimization.h
     Source/RPI.Builders/Model/ModelAssetBuilderComponent.cpp
     Source/RPI.Builders/Model/ModelAssetBuilderComponent.h
     Source/RPI.Builders/Model/ModelExporterComponent.cpp
@@ -11,6 +11,7 @@ set(FILES
     Tests.Builders/AtomRPIBuildersTests.cpp
     Tests.Builders/BuilderTestFixture.cpp
     Tests.Builders/BuilderTestFixture.h
+    Tests.Builders/MeshOptimizationTest.cpp
     Tests.Builders/PassBuilderTest.cpp
     Tests.Builders/ResourcePoolBuilderTest.cpp
 )
@@ -15,6 +15,7 @@ set(FILES
     Include/Atom/RPI.Public/Culling.h
     Include/Atom/RPI.Public/FeatureProcessor.h
     Include/Atom/RPI.Public/FeatureProcessorFactory.h
+    Include/Atom/RPI.Public/HierarchicalDepthBuffer.h
     Include/Atom/RPI.Public/MeshDrawPacket.h
     Include/Atom/RPI.Public/PipelinePassChanges.h
     Include/Atom/RPI.Public/PipelineState.h
@@ -53,11 +54,14 @@ set(FILES
     Include/Atom/RPI.Public/Image/StreamingImage.h
     Include/Atom/RPI.Public/Image/StreamingImageContext.h
     Include/Atom/RPI.Public/Image/StreamingImageController.h
+    Include/Atom/RPI.Public/Image/StreamingImageFeedback.h
     Include/Atom/RPI.Public/Image/StreamingImagePool.h
     Include/Atom/RPI.Public/Material/Material.h
     Include/Atom/RPI.Public/Material/MaterialSystem.h
     Include/Atom/RPI.Public/Model/Model.h
     Include/Atom/RPI.Public/Model/ModelLod.h
+    Include/Atom/RPI.Public/Model/ModelLodResidency.h
+    Include/Atom/RPI.Public/Model/ModelLodStreamingController.h
     Include/Atom/RPI.Public/Model/ModelLodUtils.h
     Include/Atom/RPI.Public/Model/ModelSystem.h
     Include/Atom/RPI.Public/Model/ModelTagSystemComponent.h
@@ -109,6 +113,7 @@ set(FILES
     Source/RPI.Public/Culling.cpp
     Source/RPI.Public/FeatureProcessor.cpp
     Source/RPI.Public/FeatureProcessorFactory.cpp
+    Source/RPI.Public/HierarchicalDepthBuffer.cpp
     Source/RPI.Public/MeshDrawPacket.cpp
     Source/RPI.Public/PipelinePassChanges.cpp
     Source/RPI.Public/PipelineState.cpp
@@ -137,11 +142,13 @@ set(FILES
     Source/RPI.Public/Image/StreamingImage.cpp
     Source/RPI.Public/Image/StreamingImageContext.cpp
     Source/RPI.Public/Image/StreamingImageController.cpp
+    Source/RPI.Public/Image/StreamingImageFeedback.cpp
     Source/RPI.Public/Image/StreamingImagePool.cpp
     Source/RPI.Public/Material/Material.cpp
     Source/RPI.Public/Material/MaterialSystem.cpp
     Source/RPI.Public/Model/Model.cpp
     Source/RPI.Public/Model/ModelLod.cpp
+    Source/RPI.Public/Model/ModelLodStreamingController.cpp
     Source/RPI.Public/Model/ModelLodUtils.cpp
     Source/RPI.Public/Model/ModelSystem.cpp
     Source/RPI.Public/Model/ModelTagSystemComponent.cpp
@@ -37,6 +37,8 @@ set(FILES
     Tests/Material/MaterialPropertyIdTests.cpp
     Tests/Material/MaterialPropertyValueSourceDataTests.cpp
     Tests/Material/MaterialTests.cpp
+    Tests/Model/ModelLodResidencyTests.cpp
+    Tests/Model/ModelMeshletsTests.cpp
     Tests/Model/ModelTests.cpp
     Tests/Model/SkinJointIdPaddingTests.cpp
     Tests/Pass/PassTests.cpp
@@ -100,6 +100,13 @@ namespace AZ
 
         FONT_TEXTURE_TYPE* GetBuffer() { return m_buffer; }
 
+        //! Returns false if no glyph was written to the buffer since the last ClearDirtyRows, otherwise returns the
+        //! range of rows that changed, so only those need to be uploaded.
+        //! \param rowBegin The first changed row.
+        //! \param rowEnd One past the last changed row.
+        bool GetDirtyRows(int& rowBegin, int& rowEnd) const;
+        void ClearDirtyRows();
+
         uint32_t GetSlotChar(int slotIndex) const;
         TextureSlot* GetCharSlot(uint32_t character, const AtomFont::GlyphSize& glyphSize = AtomFont::defaultGlyphSize);
         TextureSlot* GetGradientSlot();
@@ -186,6 +193,7 @@ namespace AZ
         //! \param glyphSize The size of the glyph to be rendered at within the font texture.
         //! \param glyphFlags Specifies hinting behavior that should be applied to the glyph when rendered to the font texture.
         int UpdateSlot(int slotIndex, uint16_t slotUsage, uint32_t character, float sizeRatio, const AtomFont::GlyphSize& glyphSize = AtomFont::defaultGlyphSize, const FFont::FontHintParams& glyphFlags = FFont::FontHintParams());
+        void MarkRowsDirty(int rowBegin, int rowEnd);
 
         TextureSlotKey GetTextureSlotKey(uint32_t character, const AtomFont::GlyphSize& glyphSize = AtomFont::defaultGlyphSize) const;
 
@@ -241,6 +249,9 @@ namespace AZ
 
         FONT_TEXTURE_TYPE*          m_buffer;                           // [y*width * x] x=0..width-1, y=0..height-1
 
+        int                         m_dirtyRowBegin = 0;                // first row of m_buffer that changed since the last upload
+        int                         m_dirtyRowEnd = 0;                  // one past the last changed row, the range is empty when equal to m_dirtyRowBegin
+
         uint16_t                    m_slotUsage;
     };
 }
@@ -1454,6 +1454,7 @@ bool AZ::FFont::InitTexture()
     m_fontImage->SetName(Name(m_name.c_str()));
 
     m_fontImageVersion = 0;
+    m_fontTexture->ClearDirtyRows();
     return true;
 }
 
@@ -1472,6 +1473,14 @@ bool AZ::FFont::UpdateTexture()
         return false;
     }
 
+    // Only upload the rows that got new glyphs, instead of the whole texture
+    int dirtyRowBegin = 0;
+    int dirtyRowEnd = 0;
+    if (!m_fontTexture->GetDirtyRows(dirtyRowBegin, dirtyRowEnd))
+    {
+        return true;
+    }
+
     RHI::ImageSubresourceRange range;
     range.m_mipSliceMin = 0;
     range.m_mipSliceMax = 0;
@@ -1480,13 +1489,20 @@ bool AZ::FFont::UpdateTexture()
     RHI::ImageSubresourceLayout layout;
     m_fontImage->GetSubresourceLayouts(range, &layout, nullptr);
 
+    const uint32_t dirtyRowCount = static_cast<uint32_t>(dirtyRowEnd - dirtyRowBegin);
+    layout.m_size.m_height = dirtyRowCount;
+    layout.m_rowCount = dirtyRowCount;
+    layout.m_bytesPerImage = dirtyRowCount * layout.m_bytesPerRow;
+
     RHI::ImageUpdateRequest imageUpdateReq;
     imageUpdateReq.m_image = m_fontImage.get();
     imageUpdateReq.m_imageSubresource = RHI::ImageSubresource{ 0, 0 };
-    imageUpdateReq.m_sourceData = m_fontTexture->GetBuffer();
+    imageUpdateReq.m_imageSubresourcePixelOffset = RHI::Origin(0, static_cast<uint32_t>(dirtyRowBegin), 0);
+    imageUpdateReq.m_sourceData = m_fontTexture->GetBuffer() + dirtyRowBegin * layout.m_bytesPerRow;
     imageUpdateReq.m_sourceSubresourceLayout = layout;
 
     m_fontStreamingImage->UpdateImageContents(imageUpdateReq);
+    m_fontTexture->ClearDirtyRows();
 
     return true;
 }
@@ -89,6 +89,8 @@ int AZ::FontTexture::Create(int width, int height, AZ::FontSmoothMethod smoothMe
     }
 
     memset(m_buffer, 0, width * height * sizeof(FONT_TEXTURE_TYPE));
+    m_dirtyRowBegin = 0;
+    m_dirtyRowEnd = height;
 
     if (!(widthCellCount * heightCellCount))
     {
@@ -508,10 +510,41 @@ int AZ::FontTexture::UpdateSlot(int slotIndex, uint16_t slotUsage, uint32_t char
 
     glyphBitmap->BlitTo8(m_buffer, 0, 0,
         blitWidth, blitHeight, x * m_cellWidth, y * m_cellHeight, m_width);
+    MarkRowsDirty(y * m_cellHeight, y * m_cellHeight + blitHeight);
 
     return 1;
 }
 
+//-------------------------------------------------------------------------------------------------
+void AZ::FontTexture::MarkRowsDirty(int rowBegin, int rowEnd)
+{
+    if (m_dirtyRowBegin == m_dirtyRowEnd)
+    {
+        m_dirtyRowBegin = rowBegin;
+        m_dirtyRowEnd = rowEnd;
+    }
+    else
+    {
+        m_dirtyRowBegin = AZ::GetMin(m_dirtyRowBegin, rowBegin);
+        m_dirtyRowEnd = AZ::GetMax(m_dirtyRowEnd, rowEnd);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+bool AZ::FontTexture::GetDirtyRows(int& rowBegin, int& rowEnd) const
+{
+    rowBegin = m_dirtyRowBegin;
+    rowEnd = m_dirtyRowEnd;
+    return m_dirtyRowBegin != m_dirtyRowEnd;
+}
+
+//-------------------------------------------------------------------------------------------------
+void AZ::FontTexture::ClearDirtyRows()
+{
+    m_dirtyRowBegin = 0;
+    m_dirtyRowEnd = 0;
+}
+
 //-------------------------------------------------------------------------------------------------
 void AZ::FontTexture::CreateGradientSlot()
 {
@@ -536,6 +569,7 @@ void AZ::FontTexture::CreateGradientSlot()
             buffer[dwX + dwY * m_width] = static_cast<uint8_t>(dwY * 255 / (slot->m_characterHeight - 1));
         }
     }
+    MarkRowsDirty(y * m_cellHeight, y * m_cellHeight + slot->m_characterHeight);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -187,8 +187,9 @@ namespace AZ
                 }
             }
 
-            // Return true if there is nothing to compile, meaning no properties changed, or the compile succeeded
-            return !m_materialInstance->NeedsCompile() || m_materialInstance->Compile();
+            // The material is compiled with the other materials changed this frame, and stays queued until it can be compiled
+            m_materialInstance->QueueCompile();
+            return true;
         }
 
         AZStd::string MaterialAssignment::ToString() const
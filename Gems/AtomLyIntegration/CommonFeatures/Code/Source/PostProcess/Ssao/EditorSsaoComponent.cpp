@@ -91,6 +91,17 @@ namespace AZ
                             "Enable Downsample",
                             "Enables depth downsampling before SSAO. Slightly lower quality but 2x as fast as regular SSAO.")
 
+                        ->DataElement(Edit::UIHandlers::CheckBox,
+                            &SsaoComponentConfig::m_enableTemporalFilter,
+                            "Enable Temporal Filter",
+                            "Blends SSAO with the reprojected result of previous frames. Reduces noise and flickering, especially with downsampling.")
+
+                        ->DataElement(Edit::UIHandlers::Slider, &SsaoComponentConfig::m_temporalHistoryWeight,
+                            "Temporal History Weight",
+                            "How much of the previous frames is kept each frame. Higher values are smoother but respond slower. Recommended value is 0.9")
+                        ->Attribute(Edit::Attributes::Min, 0.0f)
+                        ->Attribute(Edit::Attributes::Max, 0.98f)
+
 
                         // Overrides
                         ->ClassElement(AZ::Edit::ClassElements::Group, "Overrides")
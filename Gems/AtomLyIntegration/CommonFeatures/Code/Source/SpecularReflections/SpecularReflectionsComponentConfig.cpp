@@ -52,7 +52,10 @@ namespace AZ
                             ->Attribute(AZ::Edit::Attributes::Max, 1.0f)
                             ->Attribute(AZ::Edit::Attributes::Step, 0.1f)
                         ->DataElement(Edit::UIHandlers::CheckBox, &SSROptions::m_halfResolution, "Half Resolution", "Use half resolution in the reflected image, improves performance but may increase artifacts during camera motion")
+                            ->Attribute(AZ::Edit::Attributes::ChangeNotify, Edit::PropertyRefreshLevels::EntireTree)
                             ->Attribute(AZ::Edit::Attributes::Visibility, &SSROptions::IsEnabled)
+                        ->DataElement(Edit::UIHandlers::CheckBox, &SSROptions::m_quarterResolution, "Quarter Resolution", "Use quarter resolution in the reflected image, for low-end hardware. Best combined with temporal filtering to hide the additional artifacts")
+                            ->Attribute(AZ::Edit::Attributes::Visibility, &SSROptions::IsHalfResolutionEnabled)
                         ->ClassElement(AZ::Edit::ClassElements::Group, "Ray Tracing")
                             ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                             ->DataElement(Edit::UIHandlers::CheckBox, &SSROptions::m_rayTracing, "Hardware Ray Tracing", "Enable Hardware Ray Tracing for Hybrid SSR-RT, which improves hit detection quality and provides fallback data for occluded or off-screen surfaces")
@@ -222,6 +222,7 @@ namespace Audio
         : m_filePath(filePath)
         , m_fileSize(0)
         , m_useCount(0)
+        , m_lastUseStamp(0)
         , m_memoryBlockAlignment(AUDIO_MEMORY_ALIGNMENT)
         , m_flags(0)
         , m_dataScope(eADS_ALL)
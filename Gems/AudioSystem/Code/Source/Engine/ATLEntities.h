@@ -366,6 +366,7 @@ namespace Audio
         size_t m_fileSize;
         size_t m_memoryBlockAlignment;
         AZ::u32 m_useCount;
+        AZ::u64 m_lastUseStamp; // Orders the entries by their last use, the least recently used removable entries are uncached first.
         Flags<TATLEnumFlagsType> m_flags;
         EATLDataScope m_dataScope;
 
@@ -104,7 +104,7 @@ namespace Audio
     void CAudioSystem::PushRequest(AudioRequestVariant&& request)
     {
         AZStd::scoped_lock lock(m_pendingRequestsMutex);
-        m_pendingRequestsQueue.push_back(AZStd::move(request));
+        PushPendingRequest(AZStd::move(request));
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -113,10 +113,46 @@ namespace Audio
         AZStd::scoped_lock lock(m_pendingRequestsMutex);
         for (auto& request : requests)
         {
-            m_pendingRequestsQueue.push_back(AZStd::move(request));
+            PushPendingRequest(AZStd::move(request));
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioSystem::PushPendingRequest(AudioRequestVariant&& request)
+    {
+        // Must be called with m_pendingRequestsMutex locked.
+        const TAudioObjectID audioObjectId = AZStd::visit(
+            [](const auto& objectRequest)
+            {
+                return objectRequest.m_audioObjectId;
+            },
+            request);
+
+        if (audioObjectId != INVALID_AUDIO_OBJECT_ID)
+        {
+            // Only the latest position of an object matters, so a new position replaces the one that is still pending
+            // for the object. Any other request for the object is processed in between and ends the coalescing.
+            auto* setPosition = AZStd::get_if<Audio::ObjectRequest::SetPosition>(&request);
+            if (setPosition && !setPosition->m_callback)
+            {
+                if (auto it = m_pendingPositionRequests.find(audioObjectId); it != m_pendingPositionRequests.end())
+                {
+                    AZStd::get<Audio::ObjectRequest::SetPosition>(m_pendingRequestsQueue[it->second]).m_position =
+                        setPosition->m_position;
+                    return;
+                }
+
+                m_pendingPositionRequests[audioObjectId] = m_pendingRequestsQueue.size();
+            }
+            else
+            {
+                m_pendingPositionRequests.erase(audioObjectId);
+            }
+        }
+
+        m_pendingRequestsQueue.push_back(AZStd::move(request));
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioSystem::PushRequestBlocking(AudioRequestVariant&& request)
     {
@@ -224,6 +260,8 @@ namespace Audio
             {
                 AZStd::scoped_lock lock(m_pendingRequestsMutex);
                 requestsToProcess = AZStd::move(m_pendingRequestsQueue);
+                m_pendingRequestsQueue.clear();
+                m_pendingPositionRequests.clear();
             }
 
             while (!requestsToProcess.empty())
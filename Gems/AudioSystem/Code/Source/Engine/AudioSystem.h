@@ -14,6 +14,7 @@
 
 #include <AzCore/Debug/Budget.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -104,6 +105,7 @@ namespace Audio
         using TAudioProxies = AZStd::vector<CAudioProxy*, Audio::AudioSystemStdAllocator>;
 
         void InternalUpdate();
+        void PushPendingRequest(AudioRequestVariant&& request);
 
         bool m_bSystemInitialized;
 
@@ -120,6 +122,9 @@ namespace Audio
         AZStd::mutex m_pendingRequestsMutex;
         AZStd::mutex m_pendingCallbacksMutex;
 
+        // Index into m_pendingRequestsQueue of the pending SetPosition request of each audio object.
+        AZStd::unordered_map<TAudioObjectID, size_t> m_pendingPositionRequests;
+
         // Synchronization objects
         AZStd::binary_semaphore m_mainEvent;
         AZStd::binary_semaphore m_processingEvent;
@@ -15,6 +15,7 @@
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/StringFunc/StringFunc.h>
@@ -49,6 +50,7 @@ namespace Audio
         : m_preloadRequests(preloadRequests)
         , m_currentByteTotal(0)
         , m_maxByteTotal(0)
+        , m_lastUseStamp(0)
     {
     }
 
@@ -334,6 +336,7 @@ namespace Audio
                 if (audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_USE_COUNTED))
                 {
                     audioFileEntry->m_flags.AddFlags(eAFF_REMOVABLE);
+                    audioFileEntry->m_lastUseStamp = ++m_lastUseStamp;
                 }
 
                 if (now || ignoreUsedCount)
@@ -505,7 +508,7 @@ namespace Audio
             if (requestSize <= maxAvailableSize)
             {
                 // Here we need to cleanup first before allowing the new request to be allocated.
-                TryToUncacheFiles();
+                TryToUncacheFiles(requestSize);
 
                 // We should only indicate success if there's actually really enough room for the new entry!
                 success = (m_maxByteTotal - m_currentByteTotal) >= requestSize;
@@ -741,17 +744,35 @@ namespace Audio
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
-    void CFileCacheManager::TryToUncacheFiles()
+    void CFileCacheManager::TryToUncacheFiles(const size_t requiredBytes)
     {
+        AZStd::vector<CATLAudioFileEntry*, Audio::AudioSystemStdAllocator> removableEntries;
         for (auto& audioFileEntryPair : m_audioFileEntries)
         {
             CATLAudioFileEntry* const audioFileEntry = audioFileEntryPair.second;
 
             if (audioFileEntry && audioFileEntry->m_flags.AreAllFlagsActive(eAFF_CACHED | eAFF_REMOVABLE))
             {
-                UncacheFileCacheEntryInternal(audioFileEntry, true);
+                removableEntries.push_back(audioFileEntry);
             }
         }
+
+        // Throw out the least recently used files first, and only as many as needed to free up the required bytes.
+        AZStd::sort(removableEntries.begin(), removableEntries.end(),
+            [](const CATLAudioFileEntry* lhs, const CATLAudioFileEntry* rhs)
+            {
+                return lhs->m_lastUseStamp < rhs->m_lastUseStamp;
+            });
+
+        for (CATLAudioFileEntry* const audioFileEntry : removableEntries)
+        {
+            if ((m_maxByteTotal - m_currentByteTotal) >= requiredBytes)
+            {
+                break;
+            }
+
+            UncacheFileCacheEntryInternal(audioFileEntry, true);
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -900,6 +921,8 @@ namespace Audio
         // Increment the used count on manually-loaded files.
         if (audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_USE_COUNTED) && audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_CACHED | eAFF_LOADING))
         {
+            audioFileEntry->m_lastUseStamp = ++m_lastUseStamp;
+
             if (overrideUseCount)
             {
                 audioFileEntry->m_useCount = useCount;
@@ -14,6 +14,7 @@
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/XML/rapidxml.h>
+#include <AzCore/std/limits.h>
 
 #include <IAudioInterfacesCommonData.h>
 #include <ATLEntities.h>
@@ -92,7 +93,7 @@ namespace Audio
 
         bool AllocateMemoryBlockInternal(CATLAudioFileEntry* const audioFileEntry);
         void UncacheFile(CATLAudioFileEntry* const audioFileEntry);
-        void TryToUncacheFiles();
+        void TryToUncacheFiles(const size_t requiredBytes = AZStd::numeric_limits<size_t>::max());
         void UpdateLocalizedFileEntryData(CATLAudioFileEntry* const audioFileEntry);
         bool TryCacheFileCacheEntryInternal(
             CATLAudioFileEntry* const audioFileEntry,
@@ -107,5 +108,6 @@ namespace Audio
 
         size_t m_currentByteTotal;
         size_t m_maxByteTotal;
+        AZ::u64 m_lastUseStamp;
     };
 } // namespace Audio
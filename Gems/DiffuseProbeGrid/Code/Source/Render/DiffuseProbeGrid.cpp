@@ -111,7 +111,19 @@ namespace AZ
             }
 
             m_probeRayRotation = AZ::Quaternion::CreateIdentity();
-            m_frameUpdateIndex = (m_frameUpdateIndex + 1) % m_frameUpdateCount;
+
+            // only move on to the next slice of probes if the grid was updated last frame,
+            // so grids that were skipped by the scheduler resume where they left off
+            if (m_updateScheduled)
+            {
+                m_frameUpdateIndex = (m_frameUpdateIndex + 1) % m_frameUpdateCount;
+                m_updateCountSinceChange = AZStd::min(m_updateCountSinceChange + 1, NumConvergenceUpdates * m_frameUpdateCount);
+                m_framesSinceUpdate = 0;
+            }
+            else
+            {
+                ++m_framesSinceUpdate;
+            }
         }
 
         bool DiffuseProbeGrid::ValidateProbeSpacing(const AZ::Vector3& newSpacing)
@@ -136,6 +148,7 @@ namespace AZ
             UpdateProbeCount();
 
             m_updateTextures = true;
+            ResetConvergence();
         }
 
         void DiffuseProbeGrid::SetViewBias(float viewBias)
@@ -154,6 +167,7 @@ namespace AZ
         {
             m_numRaysPerProbe = numRaysPerProbe;
             m_updateTextures = true;
+            ResetConvergence();
         }
 
         void DiffuseProbeGrid::SetTransform(const AZ::Transform& transform)
@@ -164,6 +178,7 @@ namespace AZ
 
             // probes need to be relocated since the grid position changed
             m_remainingRelocationIterations = DefaultNumRelocationIterations;
+            ResetConvergence();
 
             m_updateRenderObjectSrg = true;
         }
@@ -186,6 +201,7 @@ namespace AZ
             m_obbWs = Obb::CreateFromPositionRotationAndHalfLengths(m_transform.GetTranslation(), m_transform.GetRotation(), m_renderExtents / 2.0f);
 
             m_updateTextures = true;
+            ResetConvergence();
         }
 
         void DiffuseProbeGrid::SetAmbientMultiplier(float ambientMultiplier)
@@ -214,6 +230,7 @@ namespace AZ
             }
 
             m_updateTextures = true;
+            ResetConvergence();
         }
 
         void DiffuseProbeGrid::SetScrolling(bool scrolling)
@@ -227,6 +244,7 @@ namespace AZ
 
             // probes need to be relocated since the scrolling mode changed
             m_remainingRelocationIterations = DefaultNumRelocationIterations;
+            ResetConvergence();
 
             m_gridDataInitialized = false;
         }
@@ -317,6 +335,18 @@ namespace AZ
             return m_probeCountX * m_probeCountY * m_probeCountZ;
         }
 
+        uint32_t DiffuseProbeGrid::GetProbeUpdateCountPerFrame() const
+        {
+            return (GetTotalProbeCount() + m_frameUpdateCount - 1) / m_frameUpdateCount;
+        }
+
+        bool DiffuseProbeGrid::IsConverged() const
+        {
+            return m_updateCountSinceChange >= NumConvergenceUpdates * m_frameUpdateCount &&
+                m_remainingRelocationIterations == 0 &&
+                !m_textureClearRequired;
+        }
+
         // compute probe counts for a 2D texture layout
         void DiffuseProbeGrid::GetTexture2DProbeCount(uint32_t& probeCountX, uint32_t& probeCountY) const
         {
@@ -412,6 +442,7 @@ namespace AZ
 
             // we need to clear the Irradiance, Distance, and ProbeData textures
             m_textureClearRequired = true;
+            ResetConvergence();
         }
 
         void DiffuseProbeGrid::ComputeProbeCount(const AZ::Vector3& extents, const AZ::Vector3& probeSpacing, uint32_t& probeCountX, uint32_t& probeCountY, uint32_t& probeCountZ)
@@ -205,10 +205,10 @@ namespace AZ
             void Enable(bool enabled);
 
             bool GetGIShadows() const { return m_giShadows; }
-            void SetGIShadows(bool giShadows) { m_giShadows = giShadows; }
+            void SetGIShadows(bool giShadows) { m_giShadows = giShadows; ResetConvergence(); }
 
             bool GetUseDiffuseIbl() const { return m_useDiffuseIbl; }
-            void SetUseDiffuseIbl(bool useDiffuseIbl) { m_useDiffuseIbl = useDiffuseIbl; }
+            void SetUseDiffuseIbl(bool useDiffuseIbl) { m_useDiffuseIbl = useDiffuseIbl; ResetConvergence(); }
 
             DiffuseProbeGridMode GetMode() const { return m_mode; }
             void SetMode(DiffuseProbeGridMode mode);
@@ -220,15 +220,27 @@ namespace AZ
             void SetEdgeBlendIbl(bool edgeBlendIbl);
 
             uint32_t GetFrameUpdateCount() const { return m_frameUpdateCount; }
-            void SetFrameUpdateCount(uint32_t frameUpdateCount) { m_frameUpdateCount = frameUpdateCount; }
+            void SetFrameUpdateCount(uint32_t frameUpdateCount) { m_frameUpdateCount = frameUpdateCount; ResetConvergence(); }
 
             uint32_t GetFrameUpdateIndex() const { return m_frameUpdateIndex; }
 
+            // number of probes that are ray traced in each frame the grid is updated, i.e., one slice of the frame update count
+            uint32_t GetProbeUpdateCountPerFrame() const;
+
+            // update scheduling, the feature processor decides each frame which visible real-time grids fit in the probe update budget
+            bool GetUpdateScheduled() const { return m_updateScheduled; }
+            void SetUpdateScheduled(bool updateScheduled) { m_updateScheduled = updateScheduled; }
+            uint32_t GetFramesSinceUpdate() const { return m_framesSinceUpdate; }
+
+            // returns true if every probe was blended enough times since the last change to the grid for its irradiance to settle
+            bool IsConverged() const;
+            void ResetConvergence() { m_updateCountSinceChange = 0; }
+
             DiffuseProbeGridTransparencyMode GetTransparencyMode() const { return m_transparencyMode; }
-            void SetTransparencyMode(DiffuseProbeGridTransparencyMode transparencyMode) { m_transparencyMode = transparencyMode; }
+            void SetTransparencyMode(DiffuseProbeGridTransparencyMode transparencyMode) { m_transparencyMode = transparencyMode; ResetConvergence(); }
 
             float GetEmissiveMultiplier() const { return m_emissiveMultiplier; }
-            void SetEmissiveMultiplier(float emissiveMultiplier) { m_emissiveMultiplier = emissiveMultiplier; }
+            void SetEmissiveMultiplier(float emissiveMultiplier) { m_emissiveMultiplier = emissiveMultiplier; ResetConvergence(); }
 
             bool GetVisualizationEnabled() const { return m_visualizationEnabled; }
             void SetVisualizationEnabled(bool visualizationEnabled);
@@ -318,6 +330,10 @@ namespace AZ
             static constexpr uint32_t DefaultNumDistanceTexels = 14;
             static constexpr int32_t DefaultNumRelocationIterations = 100;
 
+            // number of times each probe is blended after a change before the grid is considered converged,
+            // with the default hysteresis of 0.95 the remaining difference is below 1%
+            static constexpr uint32_t NumConvergenceUpdates = 100;
+
             // visualization TLAS
             const RHI::Ptr<RHI::RayTracingTlas>& GetVisualizationTlas() const { return m_visualizationTlas; }
             RHI::Ptr<RHI::RayTracingTlas>& GetVisualizationTlas() { return m_visualizationTlas; }
@@ -387,6 +403,11 @@ namespace AZ
             uint32_t m_frameUpdateCount = 1;
             uint32_t m_frameUpdateIndex = 0;
 
+            // update scheduling state
+            bool m_updateScheduled = true;
+            uint32_t m_framesSinceUpdate = 0;
+            uint32_t m_updateCountSinceChange = 0;
+
             // rotation transform applied to probe rays
             AZ::Quaternion m_probeRayRotation;
             AZ::SimpleLcgRandom m_random;
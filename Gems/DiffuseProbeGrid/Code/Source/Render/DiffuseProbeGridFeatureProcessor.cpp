@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <Atom/RPI.Edit/Common/AssetUtils.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
@@ -22,10 +23,19 @@
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RHI/PipelineState.h>
 #include <Atom/RHI.Reflect/InputStreamLayoutBuilder.h>
+#include <RayTracing/RayTracingFeatureProcessor.h>
 
 // This component invokes shaders based on Nvidia's RTX-GI SDK.
 // Please refer to "Shaders/DiffuseGlobalIllumination/Nvidia RTX-GI License.txt" for license information.
 
+AZ_CVAR(uint32_t, r_diffuseProbeGridUpdateBudget, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of diffuse probes ray traced per frame across all real-time DiffuseProbeGrids, 0 for no limit. "
+    "Grids that don't fit are updated in later frames, nearest to the camera first.");
+
+AZ_CVAR(bool, r_diffuseProbeGridSkipConvergedGrids, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Stops updating real-time DiffuseProbeGrids once their irradiance converged, until the grid or the ray traced geometry changes. "
+    "Changes to lights are not detected, so only enable this for scenes with static lighting.");
+
 namespace AZ
 {
     namespace Render
@@ -308,6 +318,119 @@ namespace AZ
                     m_visibleDiffuseProbeGrids.push_back(diffuseProbeGrid);
                 }
             }
+
+            ScheduleProbeGridUpdates();
+        }
+
+        void DiffuseProbeGridFeatureProcessor::ScheduleProbeGridUpdates()
+        {
+            AZ_PROFILE_SCOPE(AzRender, "DiffuseProbeGridFeatureProcessor: ScheduleProbeGridUpdates");
+
+            // the irradiance of every real-time grid needs to converge again when the ray traced geometry changes
+            RayTracingFeatureProcessor* rayTracingFeatureProcessor = GetParentScene()->GetFeatureProcessor<RayTracingFeatureProcessor>();
+            const uint32_t rayTracingRevision = rayTracingFeatureProcessor ? rayTracingFeatureProcessor->GetRevision() : 0;
+            const bool rayTracingRevisionChanged = (rayTracingRevision != m_rayTracingRevision);
+            m_rayTracingRevision = rayTracingRevision;
+
+            for (auto& diffuseProbeGrid : m_realTimeDiffuseProbeGrids)
+            {
+                if (rayTracingRevisionChanged)
+                {
+                    diffuseProbeGrid->ResetConvergence();
+
+                    // grids that are skipped this frame miss the relocation reset done by the DiffuseProbeGridRelocationPass
+                    diffuseProbeGrid->ResetRemainingRelocationIterations();
+                }
+
+                diffuseProbeGrid->SetUpdateScheduled(false);
+            }
+
+            const uint32_t updateBudget = r_diffuseProbeGridUpdateBudget;
+            const bool skipConvergedGrids = r_diffuseProbeGridSkipConvergedGrids;
+            if (updateBudget == 0 && !skipConvergedGrids)
+            {
+                for (auto& diffuseProbeGrid : m_visibleRealTimeDiffuseProbeGrids)
+                {
+                    diffuseProbeGrid->SetUpdateScheduled(true);
+                }
+                return;
+            }
+
+            // the camera positions of all pipelines, the grids nearest to any of them are updated first
+            AZStd::vector<AZ::Vector3> cameraPositions;
+            for (const RPI::RenderPipelinePtr& renderPipeline : GetParentScene()->GetRenderPipelines())
+            {
+                if (const RPI::ViewPtr& view = renderPipeline->GetDefaultView())
+                {
+                    cameraPositions.push_back(view->GetViewToWorldMatrix().GetTranslation());
+                }
+            }
+
+            struct ScheduleCandidate
+            {
+                DiffuseProbeGrid* m_diffuseProbeGrid = nullptr;
+                float m_priority = 0.0f;
+            };
+            AZStd::vector<ScheduleCandidate> candidates;
+            candidates.reserve(m_visibleRealTimeDiffuseProbeGrids.size());
+
+            uint32_t scheduledProbeCount = 0;
+            for (auto& diffuseProbeGrid : m_visibleRealTimeDiffuseProbeGrids)
+            {
+                // grids that were just (re)created or are being baked are always updated
+                if (diffuseProbeGrid->GetTextureClearRequired() || !diffuseProbeGrid->GetTextureReadback().IsIdle())
+                {
+                    diffuseProbeGrid->SetUpdateScheduled(true);
+                    scheduledProbeCount += diffuseProbeGrid->GetProbeUpdateCountPerFrame();
+                    continue;
+                }
+
+                if (skipConvergedGrids && diffuseProbeGrid->IsConverged())
+                {
+                    continue;
+                }
+
+                float cameraDistance = cameraPositions.empty() ? 0.0f : AZStd::numeric_limits<float>::max();
+                for (const AZ::Vector3& cameraPosition : cameraPositions)
+                {
+                    cameraDistance = AZStd::min(cameraDistance, diffuseProbeGrid->GetObbWs().GetDistance(cameraPosition));
+                }
+
+                // the priority of a grid grows with the number of frames it has been waiting, so distant grids are still
+                // updated in a round-robin fashion when the nearer grids exceed the budget
+                const float waitingFrames = aznumeric_cast<float>(diffuseProbeGrid->GetFramesSinceUpdate() + 1);
+                candidates.push_back({ diffuseProbeGrid.get(), waitingFrames / (1.0f + cameraDistance) });
+            }
+
+            AZStd::sort(
+                candidates.begin(),
+                candidates.end(),
+                [](const ScheduleCandidate& lhs, const ScheduleCandidate& rhs)
+                {
+                    return lhs.m_priority > rhs.m_priority;
+                });
+
+            for (const ScheduleCandidate& candidate : candidates)
+            {
+                const uint32_t probeUpdateCount = candidate.m_diffuseProbeGrid->GetProbeUpdateCountPerFrame();
+
+                // the highest priority grid is always updated, even if it exceeds the budget on its own
+                if (updateBudget > 0 && scheduledProbeCount > 0 && scheduledProbeCount + probeUpdateCount > updateBudget)
+                {
+                    continue;
+                }
+
+                candidate.m_diffuseProbeGrid->SetUpdateScheduled(true);
+                scheduledProbeCount += probeUpdateCount;
+            }
+
+            // the update passes only process the grids in the visible real-time list
+            AZStd::erase_if(
+                m_visibleRealTimeDiffuseProbeGrids,
+                [](const AZStd::shared_ptr<DiffuseProbeGrid>& diffuseProbeGrid)
+                {
+                    return !diffuseProbeGrid->GetUpdateScheduled();
+                });
         }
 
         DiffuseProbeGridHandle DiffuseProbeGridFeatureProcessor::AddProbeGrid(const AZ::Transform& transform, const AZ::Vector3& extents, const AZ::Vector3& probeSpacing)
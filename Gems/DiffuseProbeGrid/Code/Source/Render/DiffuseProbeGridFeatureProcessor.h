@@ -93,7 +93,7 @@ namespace AZ
             // retrieve the side list of probe grids that are visible (on screen), both real-time (raytraced) and baked
             DiffuseProbeGridVector& GetVisibleProbeGrids() { return m_visibleDiffuseProbeGrids; }
 
-            // retrieve the side list of probe grids that are real-time (raytraced) and visible (on screen)
+            // retrieve the side list of probe grids that are real-time (raytraced), visible (on screen), and scheduled for an update this frame
             DiffuseProbeGridVector& GetVisibleRealTimeProbeGrids() { return m_visibleRealTimeDiffuseProbeGrids; }
 
             // returns the RayTracingBufferPool used for the DiffuseProbeGrid visualization
@@ -146,6 +146,9 @@ namespace AZ
             void UpdatePipelineStates();
             void UpdatePasses();
 
+            // removes the visible real-time grids that don't fit in the probe update budget this frame, or that don't need an update
+            void ScheduleProbeGridUpdates();
+
             // loads the probe visualization model and creates the BLAS
             void OnVisualizationModelAssetReady(Data::Asset<Data::AssetData> asset);
 
@@ -159,9 +162,12 @@ namespace AZ
             // side list of diffuse probe grids that are visible, both real-time and baked modes (subset of m_diffuseProbeGrids)
             DiffuseProbeGridVector m_visibleDiffuseProbeGrids;
 
-            // side list of diffuse probe grids that are in real-time mode and visible (subset of m_realTimeDiffuseProbeGrids)
+            // side list of diffuse probe grids that are in real-time mode, visible, and scheduled for an update (subset of m_realTimeDiffuseProbeGrids)
             DiffuseProbeGridVector m_visibleRealTimeDiffuseProbeGrids;
 
+            // revision of the ray tracing scene the real-time grids converged with
+            uint32_t m_rayTracingRevision = 0;
+
             // position structure for the box vertices
             struct Position
             {
@@ -128,9 +128,10 @@ namespace AZ
                 // probe irradiance image
                 {
                     RHI::AttachmentId attachmentId = diffuseProbeGrid->GetIrradianceImageAttachmentId();
-                    if (diffuseProbeGrid->GetMode() == DiffuseProbeGridMode::Baked && !frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
+                    if (!frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
                     {
-                        // import the irradiance image now, since it is baked and therefore was not imported during the raytracing pass
+                        // import the irradiance image now, since it is baked or wasn't scheduled for an update this frame,
+                        // and therefore was not imported during the raytracing pass
                         [[maybe_unused]] RHI::ResultCode result = frameGraph.GetAttachmentDatabase().ImportImage(attachmentId, diffuseProbeGrid->GetIrradianceImage());
                         AZ_Assert(result == RHI::ResultCode::Success, "Failed to import probeIrradianceImage");
                     }
@@ -146,9 +147,10 @@ namespace AZ
                 // probe distance image
                 {
                     RHI::AttachmentId attachmentId = diffuseProbeGrid->GetDistanceImageAttachmentId();
-                    if (diffuseProbeGrid->GetMode() == DiffuseProbeGridMode::Baked && !frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
+                    if (!frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
                     {
-                        // import the distance image now, since it is baked and therefore was not imported during the raytracing pass
+                        // import the distance image now, since it is baked or wasn't scheduled for an update this frame,
+                        // and therefore was not imported during the raytracing pass
                         [[maybe_unused]] RHI::ResultCode result = frameGraph.GetAttachmentDatabase().ImportImage(attachmentId, diffuseProbeGrid->GetDistanceImage());
                         AZ_Assert(result == RHI::ResultCode::Success, "Failed to import probeDistanceImage");
                     }
@@ -164,9 +166,10 @@ namespace AZ
                 // probe data image
                 {
                     RHI::AttachmentId attachmentId = diffuseProbeGrid->GetProbeDataImageAttachmentId();
-                    if (diffuseProbeGrid->GetMode() == DiffuseProbeGridMode::Baked && !frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
+                    if (!frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
                     {
-                        // import the probe data image now, since it is baked and therefore was not imported during the raytracing pass
+                        // import the probe data image now, since it is baked or wasn't scheduled for an update this frame,
+                        // and therefore was not imported during the raytracing pass
                         [[maybe_unused]] RHI::ResultCode result = frameGraph.GetAttachmentDatabase().ImportImage(attachmentId, diffuseProbeGrid->GetProbeDataImage());
                         AZ_Assert(result == RHI::ResultCode::Success, "Failed to import ProbeDataImage");
                     }
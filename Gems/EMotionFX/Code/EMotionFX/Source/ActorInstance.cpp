@@ -63,6 +63,7 @@ namespace EMotionFX
         m_visualizeScale         = 1.0f;
         m_motionSamplingRate     = 0.0f;
         m_motionSamplingTimer    = 0.0f;
+        m_animGraphUpdateFrame   = m_id;
 
         m_trajectoryDelta.IdentityWithZeroScale();
         m_staticAabb = AZ::Aabb::CreateNull();
@@ -278,9 +279,16 @@ namespace EMotionFX
         // if we are not an attachment, or if we are but not one influenced by multiple joints
         if (!attachment || !attachment->GetIsInfluencedByMultipleJoints())
         {
+            const uint32 animGraphUpdateRate = GetEffectiveAnimGraphUpdateRate();
+
             // update the motion system, which performs all blending, and updates all local transforms (excluding the local matrices)
-            if (m_animGraphInstance)
+            if (m_animGraphInstance && animGraphUpdateRate > 1 && updateJointTransforms && sampleMotions)
+            {
+                UpdateAnimGraphAtReducedRate(timePassedInSeconds, animGraphUpdateRate);
+            }
+            else if (m_animGraphInstance)
             {
+                m_hasAnimGraphSamples = false;
                 m_animGraphInstance->Update(timePassedInSeconds);
                 UpdateWorldTransform();
                 if (updateJointTransforms && sampleMotions)
@@ -371,6 +379,60 @@ namespace EMotionFX
     }
 
     // update the world transformation
+    void ActorInstance::UpdateAnimGraphAtReducedRate(float timePassedInSeconds, uint32 updateRate)
+    {
+        m_animGraphSkippedTime += timePassedInSeconds;
+
+        Pose* currentPose = m_transformData->GetCurrentPose();
+        if (!m_animGraphSamplePose)
+        {
+            m_animGraphSamplePose = AZStd::make_unique<Pose>();
+            m_animGraphSamplePose->LinkToActorInstance(this);
+            m_animGraphPrevSamplePose = AZStd::make_unique<Pose>();
+            m_animGraphPrevSamplePose->LinkToActorInstance(this);
+        }
+
+        // the frame counter starts at the id, so the actor instances using the same rate are evaluated on different frames
+        const bool evaluate = !m_hasAnimGraphSamples || (m_animGraphUpdateFrame % updateRate) == 0;
+        ++m_animGraphUpdateFrame;
+
+        if (evaluate)
+        {
+            const float evaluatedTime = m_animGraphSkippedTime;
+            m_animGraphSkippedTime = 0.0f;
+
+            m_animGraphInstance->Update(evaluatedTime);
+            UpdateWorldTransform();
+
+            AZStd::swap(m_animGraphPrevSamplePose, m_animGraphSamplePose);
+            m_animGraphInstance->Output(m_animGraphSamplePose.get());
+            if (!m_hasAnimGraphSamples)
+            {
+                // nothing to interpolate from yet
+                *m_animGraphPrevSamplePose = *m_animGraphSamplePose;
+                m_hasAnimGraphSamples = true;
+            }
+            m_animGraphFramesSinceSample = 0;
+
+            if (m_ragdollInstance)
+            {
+                *currentPose = *m_animGraphSamplePose;
+                m_ragdollInstance->PostAnimGraphUpdate(evaluatedTime);
+                *m_animGraphSamplePose = *currentPose;
+            }
+        }
+        else
+        {
+            UpdateWorldTransform();
+        }
+
+        // interpolate towards the last evaluated pose, reaching it right before the next evaluation
+        ++m_animGraphFramesSinceSample;
+        const float weight = AZStd::min(aznumeric_cast<float>(m_animGraphFramesSinceSample) / aznumeric_cast<float>(updateRate), 1.0f);
+        *currentPose = *m_animGraphPrevSamplePose;
+        currentPose->Blend(m_animGraphSamplePose.get(), weight);
+    }
+
     void ActorInstance::UpdateWorldTransform()
     {
         m_worldTransform = m_localTransform;
@@ -1196,6 +1258,9 @@ namespace EMotionFX
 
             // Make sure the LOD level is valid and update it.
             m_lodLevel = MCore::Clamp<size_t>(m_requestedLODLevel, 0, m_actor->GetNumLODLevels() - 1);
+
+            // The sample poses don't hold valid transforms for the newly enabled joints.
+            m_hasAnimGraphSamples = false;
         }
     }
 
@@ -1705,6 +1770,28 @@ namespace EMotionFX
         return m_motionSamplingRate;
     }
 
+    void ActorInstance::SetAnimGraphUpdateRate(uint32 updateRate)
+    {
+        m_animGraphUpdateRate = AZStd::clamp(updateRate, 1u, s_maxAnimGraphUpdateRate);
+    }
+
+    uint32 ActorInstance::GetAnimGraphUpdateRate() const
+    {
+        return m_animGraphUpdateRate;
+    }
+
+    uint32 ActorInstance::GetEffectiveAnimGraphUpdateRate() const
+    {
+        if (m_animGraphUpdateRate <= 1)
+        {
+            return 1;
+        }
+
+        const ActorUpdateScheduler* scheduler = GetActorManager().GetScheduler();
+        const uint32 budgetScale = scheduler ? scheduler->GetAnimGraphUpdateRateScale() : 1;
+        return AZStd::min(m_animGraphUpdateRate * budgetScale, s_maxAnimGraphUpdateRate);
+    }
+
     void ActorInstance::IncreaseNumAttachmentRefs(uint8 numToIncreaseWith)
     {
         m_numAttachmentRefs += numToIncreaseWith;
@@ -37,6 +37,7 @@ namespace EMotionFX
     class Attachment;
     class AnimGraphInstance;
     class MorphSetupInstance;
+    class Pose;
     class RagdollInstance;
 
 
@@ -864,6 +865,25 @@ namespace EMotionFX
         float GetMotionSamplingTimer() const;
         float GetMotionSamplingRate() const;
 
+        /**
+         * Set the rate at which the anim graph gets evaluated, which is the update-rate LOD of the actor instance.
+         * With a rate of N the anim graph is only updated and output every Nth frame, using the time passed since the last evaluation.
+         * In between, the pose is interpolated between the last two evaluated poses, which delays the pose by one evaluation interval.
+         * The evaluations are staggered based on the actor instance id, so actor instances using the same rate spread the work over the frames.
+         * The scheduler may reduce the rate further to stay within its animation budget, see ActorUpdateScheduler::SetAnimationBudget.
+         * @param updateRate The rate, where 1 evaluates the anim graph every frame. Values are clamped to the range [1..s_maxAnimGraphUpdateRate].
+         */
+        void SetAnimGraphUpdateRate(uint32 updateRate);
+        uint32 GetAnimGraphUpdateRate() const;
+
+        /**
+         * Get the rate at which the anim graph currently gets evaluated, including the reduction of the animation budget of the scheduler.
+         * @result The rate, where 1 means every frame.
+         */
+        uint32 GetEffectiveAnimGraphUpdateRate() const;
+
+        static constexpr uint32 s_maxAnimGraphUpdateRate = 8;
+
         MCORE_INLINE size_t GetNumNodes() const         { return m_actor->GetSkeleton()->GetNumNodes(); }
 
         void UpdateVisualizeScale();                    // not automatically called on creation for performance reasons (this method relatively is slow as it updates all meshes)
@@ -899,6 +919,13 @@ namespace EMotionFX
         float                   m_boundsUpdatePassedTime;/**< The time passed since the last bounds update. */
         float                   m_motionSamplingRate;    /**< The motion sampling rate in seconds, where 0.1 would mean to update 10 times per second. A value of 0 or lower means to update every frame. */
         float                   m_motionSamplingTimer;   /**< The time passed since the last time we sampled motions/anim graphs. */
+        AZStd::unique_ptr<Pose> m_animGraphSamplePose;   /**< The last pose evaluated at a reduced anim graph update rate. */
+        AZStd::unique_ptr<Pose> m_animGraphPrevSamplePose;/**< The pose evaluated before the last one, which gets interpolated towards the last one. */
+        float                   m_animGraphSkippedTime = 0.0f; /**< The time passed since the last anim graph evaluation at a reduced update rate. */
+        uint32                  m_animGraphUpdateRate = 1; /**< Evaluate the anim graph every this number of frames. */
+        uint32                  m_animGraphUpdateFrame = 0; /**< The frame counter for the reduced anim graph update rate, starting at the actor instance id to stagger the evaluations. */
+        uint32                  m_animGraphFramesSinceSample = 0; /**< The number of frames since the last anim graph evaluation. */
+        bool                    m_hasAnimGraphSamples = false; /**< True when both sample poses are valid and may be interpolated. */
         float                   m_visualizeScale;        /**< Some visualization scale factor when rendering for example normals, to be at a nice size, relative to the character. */
         size_t                  m_lodLevel;              /**< The current LOD level, where 0 is the highest detail. */
         size_t                  m_requestedLODLevel;    /**< Requested LOD level. The actual LOD level will be updated as soon as all transforms for the requested LOD level are ready. */
@@ -1019,5 +1046,12 @@ namespace EMotionFX
          * newly enabled joints (the ones that were not present and thus also not updated in the lower LOD level)will contain incorrect data.
          */
         void UpdateLODLevel();
+
+        /*
+         * Evaluate the anim graph every updateRate frames and interpolate the current pose between the evaluated poses.
+         * @param timePassedInSeconds The time passed since the last update, in seconds.
+         * @param updateRate The effective anim graph update rate, which is bigger than 1.
+         */
+        void UpdateAnimGraphAtReducedRate(float timePassedInSeconds, uint32 updateRate);
     };
 }   // namespace EMotionFX
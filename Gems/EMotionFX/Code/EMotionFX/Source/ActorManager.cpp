@@ -16,6 +16,7 @@
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/Actor.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
+#include <AzCore/std/chrono/chrono.h>
 
 namespace EMotionFX
 {
@@ -318,7 +319,10 @@ namespace EMotionFX
 
         // execute the schedule
         // this makes all the callback OnUpdate calls etc
+        const AZStd::chrono::steady_clock::time_point executeStart = AZStd::chrono::steady_clock::now();
         m_scheduler->Execute(timePassedInSeconds);
+        const AZStd::chrono::duration<float, AZStd::milli> executeTime = AZStd::chrono::steady_clock::now() - executeStart;
+        m_scheduler->OnExecuted(executeTime.count());
 
         UnlockActorInstances();
         UnlockActors();
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "ActorUpdateScheduler.h"
+#include "ActorInstance.h"
+
+
+namespace EMotionFX
+{
+    void ActorUpdateScheduler::SetAnimationBudget(float budgetInMilliseconds)
+    {
+        m_animationBudget = budgetInMilliseconds;
+        if (m_animationBudget <= 0.0f)
+        {
+            m_animGraphUpdateRateScale = 1;
+        }
+    }
+
+
+    void ActorUpdateScheduler::OnExecuted(float executionTimeInMilliseconds)
+    {
+        m_lastExecutionTime = executionTimeInMilliseconds;
+        if (m_animationBudget <= 0.0f)
+        {
+            return;
+        }
+
+        // halve or double the rates one step at a time, with some slack in between so the scale doesn't flip every frame
+        if (executionTimeInMilliseconds > m_animationBudget)
+        {
+            m_animGraphUpdateRateScale = AZStd::min(m_animGraphUpdateRateScale * 2, ActorInstance::s_maxAnimGraphUpdateRate);
+        }
+        else if (executionTimeInMilliseconds < m_animationBudget * 0.5f && m_animGraphUpdateRateScale > 1)
+        {
+            m_animGraphUpdateRateScale /= 2;
+        }
+    }
+}   // namespace EMotionFX
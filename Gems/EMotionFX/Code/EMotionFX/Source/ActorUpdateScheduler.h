@@ -84,10 +84,42 @@ namespace EMotionFX
         size_t GetNumVisibleActorInstances() const                  { return m_numVisible.GetValue(); }
         size_t GetNumSampledActorInstances() const                  { return m_numSampled.GetValue(); }
 
+        /**
+         * Set the time budget for updating all actor instances, in milliseconds.
+         * When an execution of the schedule takes longer than the budget, the actor instances which already evaluate their anim graph
+         * at a reduced rate (see ActorInstance::SetAnimGraphUpdateRate) get slowed down further, up to ActorInstance::s_maxAnimGraphUpdateRate.
+         * They speed up again once the executions take less than half of the budget. Actor instances updating every frame are never slowed down.
+         * @param budgetInMilliseconds The budget in milliseconds, where 0 disables it.
+         */
+        void SetAnimationBudget(float budgetInMilliseconds);
+        float GetAnimationBudget() const                            { return m_animationBudget; }
+
+        /**
+         * Get the factor which the animation budget currently applies on the reduced anim graph update rates.
+         * @result The factor, which is 1 when within the budget.
+         */
+        uint32 GetAnimGraphUpdateRateScale() const                  { return m_animGraphUpdateRateScale; }
+
+        /**
+         * Get the time the last execution of the schedule took, as reported by OnExecuted.
+         * @result The time in milliseconds.
+         */
+        float GetLastExecutionTime() const                          { return m_lastExecutionTime; }
+
+        /**
+         * Report the time an execution of the schedule took, which adjusts the anim graph update rate scale to the animation budget.
+         * This is called by the actor manager after each execution.
+         * @param executionTimeInMilliseconds The time the execution took, in milliseconds.
+         */
+        void OnExecuted(float executionTimeInMilliseconds);
+
     protected:
         MCore::AtomicSizeT m_numUpdated;
         MCore::AtomicSizeT m_numVisible;
         MCore::AtomicSizeT m_numSampled;
+        float m_animationBudget = 0.0f;
+        float m_lastExecutionTime = 0.0f;
+        uint32 m_animGraphUpdateRateScale = 1;
 
         /**
          * The constructor.
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
+#include <EMotionFX/Source/MotionData/CompressedJointSamples.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+
+namespace EMotionFX
+{
+    namespace CompressedJointSamplesInternal
+    {
+        using AZ::Simd::Vec4;
+
+        static constexpr float MaxQuantizedValue = 65535.0f;
+        static constexpr size_t ValuesPerTrack = 4;
+
+        // The largest distance between any of the values and the given value, over all four components.
+        float CalcMaxComponentError(const AZStd::vector<AZ::Vector4>& values, const AZ::Vector4& value)
+        {
+            float maxError = 0.0f;
+            for (const AZ::Vector4& sample : values)
+            {
+                const AZ::Vector4 error = (sample - value).GetAbs();
+                maxError = AZ::GetMax(maxError, AZ::GetMax(AZ::GetMax(error.GetX(), error.GetY()), AZ::GetMax(error.GetZ(), error.GetW())));
+            }
+            return maxError;
+        }
+
+        // The largest angle in degrees between any of the rotations and the given rotation.
+        float CalcMaxAngleError(const AZStd::vector<AZ::Vector4>& values, const AZ::Vector4& value)
+        {
+            float maxError = 0.0f;
+            for (const AZ::Vector4& sample : values)
+            {
+                const float dot = AZ::GetMin(AZ::GetAbs(sample.Dot(value)), 1.0f);
+                maxError = AZ::GetMax(maxError, AZ::RadToDeg(2.0f * acosf(dot)));
+            }
+            return maxError;
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Dequantize(const AZ::u16* values, Vec4::FloatArgType min, Vec4::FloatArgType extent)
+        {
+            const Vec4::Int32Type quantized = Vec4::LoadImmediate(
+                static_cast<int32_t>(values[0]), static_cast<int32_t>(values[1]), static_cast<int32_t>(values[2]), static_cast<int32_t>(values[3]));
+            return Vec4::Madd(Vec4::ConvertToFloat(quantized), extent, min);
+        }
+    } // namespace CompressedJointSamplesInternal
+
+    void CompressedJointSamples::Clear()
+    {
+        m_jointTracks.clear();
+        m_jointTracks.shrink_to_fit();
+        m_samples.clear();
+        m_samples.shrink_to_fit();
+        m_rowSize = 0;
+        m_numSamples = 0;
+        m_numQuantizedTracks = 0;
+    }
+
+    void CompressedJointSamples::Init(const UniformMotionData& motionData, const Settings& settings)
+    {
+        using namespace CompressedJointSamplesInternal;
+
+        Clear();
+        const size_t numSamples = motionData.GetNumSamples();
+        if (numSamples == 0)
+        {
+            return;
+        }
+
+        // Gather the samples of all animated tracks and find their ranges.
+        // Tracks that stay within the error budget of their center value are stored as that constant.
+        struct PendingTrack
+        {
+            AZStd::vector<AZ::Vector4> m_values;
+            TrackRange* m_range = nullptr;
+        };
+        AZStd::vector<PendingTrack> pendingTracks;
+
+        const auto addTrack = [&pendingTracks, this](AZStd::vector<AZ::Vector4>&& values, bool isRotation, float maxError, TrackRange& outRange)
+        {
+            AZ::Vector4 minValue = values[0];
+            AZ::Vector4 maxValue = values[0];
+            for (const AZ::Vector4& value : values)
+            {
+                minValue = minValue.GetMin(value);
+                maxValue = maxValue.GetMax(value);
+            }
+
+            AZ::Vector4 center = (minValue + maxValue) * 0.5f;
+            if (isRotation)
+            {
+                center.NormalizeSafe();
+            }
+            const float error = isRotation ? CalcMaxAngleError(values, center) : CalcMaxComponentError(values, center);
+            if (error <= maxError)
+            {
+                outRange.m_min = center;
+                outRange.m_extent = AZ::Vector4::CreateZero();
+                outRange.m_offset = InvalidIndex32;
+                return;
+            }
+
+            outRange.m_min = minValue;
+            outRange.m_extent = (maxValue - minValue) / MaxQuantizedValue;
+            outRange.m_offset = aznumeric_caster(m_numQuantizedTracks * ValuesPerTrack);
+            m_numQuantizedTracks++;
+            pendingTracks.push_back({ AZStd::move(values), &outRange });
+        };
+
+        const size_t numJoints = motionData.GetNumJoints();
+        m_jointTracks.resize(numJoints);
+        for (size_t jointDataIndex = 0; jointDataIndex < numJoints; ++jointDataIndex)
+        {
+            JointTracks& tracks = m_jointTracks[jointDataIndex];
+            tracks.m_isPositionAnimated = motionData.IsJointPositionAnimated(jointDataIndex);
+            tracks.m_isRotationAnimated = motionData.IsJointRotationAnimated(jointDataIndex);
+            tracks.m_isAnimated = tracks.m_isPositionAnimated || tracks.m_isRotationAnimated;
+
+            if (tracks.m_isPositionAnimated)
+            {
+                AZStd::vector<AZ::Vector4> values(numSamples);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    values[s] = AZ::Vector4::CreateFromVector3(motionData.GetJointPositionSample(jointDataIndex, s).m_value);
+                }
+                addTrack(AZStd::move(values), false, settings.m_maxPosError, tracks.m_position);
+            }
+
+            if (tracks.m_isRotationAnimated)
+            {
+                // Keep neighboring samples in the same hemisphere, so the ranges stay tight and the interpolation takes the shortest arc.
+                AZStd::vector<AZ::Vector4> values(numSamples);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    const AZ::Quaternion rotation = motionData.GetJointRotationSample(jointDataIndex, s).m_value.GetNormalized();
+                    values[s] = AZ::Vector4(rotation.GetX(), rotation.GetY(), rotation.GetZ(), rotation.GetW());
+                    if (s > 0 && values[s].Dot(values[s - 1]) < 0.0f)
+                    {
+                        values[s] = -values[s];
+                    }
+                }
+                addTrack(AZStd::move(values), true, settings.m_maxRotError, tracks.m_rotation);
+            }
+
+#ifndef EMFX_SCALE_DISABLED
+            tracks.m_isScaleAnimated = motionData.IsJointScaleAnimated(jointDataIndex);
+            tracks.m_isAnimated |= tracks.m_isScaleAnimated;
+            if (tracks.m_isScaleAnimated)
+            {
+                AZStd::vector<AZ::Vector4> values(numSamples);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    values[s] = AZ::Vector4::CreateFromVector3(motionData.GetJointScaleSample(jointDataIndex, s).m_value);
+                }
+                addTrack(AZStd::move(values), false, settings.m_maxScaleError, tracks.m_scale);
+            }
+#endif
+        }
+
+        // Interleave the quantized values of all tracks per sample.
+        m_numSamples = numSamples;
+        m_rowSize = m_numQuantizedTracks * ValuesPerTrack;
+        m_samples.resize(m_rowSize * m_numSamples);
+        for (const PendingTrack& track : pendingTracks)
+        {
+            QuantizeTrack(track.m_values, *track.m_range);
+        }
+    }
+
+    void CompressedJointSamples::QuantizeTrack(const AZStd::vector<AZ::Vector4>& values, const TrackRange& range)
+    {
+        using namespace CompressedJointSamplesInternal;
+
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            AZ::u16* quantized = &m_samples[s * m_rowSize + range.m_offset];
+            for (int i = 0; i < static_cast<int>(ValuesPerTrack); ++i)
+            {
+                const float extent = range.m_extent.GetElement(i);
+                const float normalized = (extent > 0.0f) ? (values[s].GetElement(i) - range.m_min.GetElement(i)) / extent : 0.0f;
+                quantized[i] = static_cast<AZ::u16>(AZ::GetClamp(normalized + 0.5f, 0.0f, MaxQuantizedValue));
+            }
+        }
+    }
+
+    size_t CompressedJointSamples::CalcMemoryUsageInBytes() const
+    {
+        return m_samples.size() * sizeof(AZ::u16) + m_jointTracks.size() * sizeof(JointTracks);
+    }
+
+    void CompressedJointSamples::SampleJointTransform(size_t jointDataIndex, size_t indexA, size_t indexB, float t, Transform& outTransform) const
+    {
+        using namespace CompressedJointSamplesInternal;
+
+        const JointTracks& tracks = m_jointTracks[jointDataIndex];
+        const AZ::u16* rowA = m_samples.data() + indexA * m_rowSize;
+        const AZ::u16* rowB = m_samples.data() + indexB * m_rowSize;
+        const Vec4::FloatType weight = Vec4::Splat(t);
+
+        const auto sampleTrack = [rowA, rowB, &weight](const TrackRange& range) -> Vec4::FloatType
+        {
+            const Vec4::FloatType min = range.m_min.GetSimdValue();
+            if (range.m_offset == InvalidIndex32)
+            {
+                return min;
+            }
+
+            const Vec4::FloatType extent = range.m_extent.GetSimdValue();
+            const Vec4::FloatType valueA = Dequantize(rowA + range.m_offset, min, extent);
+            const Vec4::FloatType valueB = Dequantize(rowB + range.m_offset, min, extent);
+            return Vec4::Madd(Vec4::Sub(valueB, valueA), weight, valueA);
+        };
+
+        if (tracks.m_isPositionAnimated)
+        {
+            outTransform.m_position = AZ::Vector3(Vec4::ToVec3(sampleTrack(tracks.m_position)));
+        }
+
+        if (tracks.m_isRotationAnimated)
+        {
+            outTransform.m_rotation = AZ::Quaternion(Vec4::Normalize(sampleTrack(tracks.m_rotation)));
+        }
+
+#ifndef EMFX_SCALE_DISABLED
+        if (tracks.m_isScaleAnimated)
+        {
+            outTransform.m_scale = AZ::Vector3(Vec4::ToVec3(sampleTrack(tracks.m_scale)));
+        }
+#endif
+    }
+} // namespace EMotionFX
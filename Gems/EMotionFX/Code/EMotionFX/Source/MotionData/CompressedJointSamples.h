@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/Transform.h>
+
+namespace EMotionFX
+{
+    class UniformMotionData;
+
+    /**
+     * Quantized joint samples of a uniform motion, stored interleaved per sample.
+     * Every animated position, rotation and scale track gets its own value range, and its samples are stored as four 16 bit
+     * integers inside that range. All tracks of one sample are stored next to each other, so sampling a pose only reads two
+     * contiguous rows of memory. Tracks for which all samples stay within the error budget of a single value are not stored
+     * in the rows at all, they use that constant value instead.
+     */
+    class EMFX_API CompressedJointSamples
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedJointSamples, MotionAllocator)
+
+        struct EMFX_API Settings
+        {
+            float m_maxPosError = 0.001f;   // In units.
+            float m_maxRotError = 0.01f;    // In degrees.
+            float m_maxScaleError = 0.001f; // In scale factor.
+        };
+
+        void Init(const UniformMotionData& motionData, const Settings& settings);
+        void Clear();
+
+        bool IsEmpty() const { return m_numSamples == 0; }
+        bool IsJointCompressed(size_t jointDataIndex) const { return jointDataIndex < m_jointTracks.size() && m_jointTracks[jointDataIndex].m_isAnimated; }
+        size_t GetNumSamples() const { return m_numSamples; }
+        size_t GetNumQuantizedTracks() const { return m_numQuantizedTracks; }
+        size_t CalcMemoryUsageInBytes() const;
+
+        /**
+         * Decompress and interpolate the transform of a single joint.
+         * Only the animated parts of the transform are written, the other parts of the output transform are left untouched.
+         * @param jointDataIndex The joint data index inside the motion data, which has to be compressed.
+         * @param indexA The first sample to interpolate between.
+         * @param indexB The second sample to interpolate between.
+         * @param t The interpolation fraction between the two samples.
+         * @param[in,out] outTransform The transform to write the animated parts in.
+         */
+        void SampleJointTransform(size_t jointDataIndex, size_t indexA, size_t indexB, float t, Transform& outTransform) const;
+
+    private:
+        // The dequantized value of a track is m_min + quantized * m_extent.
+        struct TrackRange
+        {
+            AZ::Vector4 m_min = AZ::Vector4::CreateZero();
+            AZ::Vector4 m_extent = AZ::Vector4::CreateZero();
+            AZ::u32 m_offset = InvalidIndex32; // The offset inside a sample row, or InvalidIndex32 when the track is constant.
+        };
+
+        struct JointTracks
+        {
+            TrackRange m_position;
+            TrackRange m_rotation;
+#ifndef EMFX_SCALE_DISABLED
+            TrackRange m_scale;
+#endif
+            bool m_isPositionAnimated = false;
+            bool m_isRotationAnimated = false;
+#ifndef EMFX_SCALE_DISABLED
+            bool m_isScaleAnimated = false;
+#endif
+            bool m_isAnimated = false;
+        };
+
+        void QuantizeTrack(const AZStd::vector<AZ::Vector4>& values, const TrackRange& range);
+
+        AZStd::vector<JointTracks> m_jointTracks; // Indexed by joint data index.
+        AZStd::vector<AZ::u16> m_samples;         // The quantized rows, m_rowSize values for every sample.
+        size_t m_rowSize = 0;
+        size_t m_numSamples = 0;
+        size_t m_numQuantizedTracks = 0;
+    };
+} // namespace EMotionFX
@@ -154,12 +154,20 @@ namespace EMotionFX
         if (transformDataIndex != InvalidIndex && !inPlace)
         {
             const StaticJointData& staticJointData = m_staticJointData[transformDataIndex];
-            const JointData& jointData = m_jointData[transformDataIndex];
-            result.m_position = !jointData.m_positions.empty() ? jointData.m_positions[indexA].Lerp(jointData.m_positions[indexB], t) : staticJointData.m_staticTransform.m_position;
-            result.m_rotation = !jointData.m_rotations.empty() ? jointData.m_rotations[indexA].ToQuaternion().NLerp(jointData.m_rotations[indexB].ToQuaternion(), t) : staticJointData.m_staticTransform.m_rotation;
+            if (m_compressedJointSamples.IsJointCompressed(transformDataIndex))
+            {
+                result = staticJointData.m_staticTransform;
+                m_compressedJointSamples.SampleJointTransform(transformDataIndex, indexA, indexB, t, result);
+            }
+            else
+            {
+                const JointData& jointData = m_jointData[transformDataIndex];
+                result.m_position = !jointData.m_positions.empty() ? jointData.m_positions[indexA].Lerp(jointData.m_positions[indexB], t) : staticJointData.m_staticTransform.m_position;
+                result.m_rotation = !jointData.m_rotations.empty() ? jointData.m_rotations[indexA].ToQuaternion().NLerp(jointData.m_rotations[indexB].ToQuaternion(), t) : staticJointData.m_staticTransform.m_rotation;
 #ifndef EMFX_SCALE_DISABLED
-            result.m_scale = !jointData.m_scales.empty() ? jointData.m_scales[indexA].Lerp(jointData.m_scales[indexB], t) : staticJointData.m_staticTransform.m_scale;
+                result.m_scale = !jointData.m_scales.empty() ? jointData.m_scales[indexA].Lerp(jointData.m_scales[indexB], t) : staticJointData.m_staticTransform.m_scale;
 #endif
+            }
         }
         else
         {
@@ -222,13 +230,21 @@ namespace EMotionFX
             if (jointDataIndex != InvalidIndex && !inPlace)
             {
                 const StaticJointData& staticJointData = m_staticJointData[jointDataIndex];
-                const JointData& jointData = m_jointData[jointDataIndex];
-                result.m_position = !jointData.m_positions.empty() ? jointData.m_positions[indexA].Lerp(jointData.m_positions[indexB], t) : staticJointData.m_staticTransform.m_position;
-                result.m_rotation = !jointData.m_rotations.empty() ? jointData.m_rotations[indexA].ToQuaternion().NLerp(jointData.m_rotations[indexB].ToQuaternion(), t) : staticJointData.m_staticTransform.m_rotation;
+                if (m_compressedJointSamples.IsJointCompressed(jointDataIndex))
+                {
+                    result = staticJointData.m_staticTransform;
+                    m_compressedJointSamples.SampleJointTransform(jointDataIndex, indexA, indexB, t, result);
+                }
+                else
+                {
+                    const JointData& jointData = m_jointData[jointDataIndex];
+                    result.m_position = !jointData.m_positions.empty() ? jointData.m_positions[indexA].Lerp(jointData.m_positions[indexB], t) : staticJointData.m_staticTransform.m_position;
+                    result.m_rotation = !jointData.m_rotations.empty() ? jointData.m_rotations[indexA].ToQuaternion().NLerp(jointData.m_rotations[indexB].ToQuaternion(), t) : staticJointData.m_staticTransform.m_rotation;
 
 #ifndef EMFX_SCALE_DISABLED
-                result.m_scale = !jointData.m_scales.empty() ? jointData.m_scales[indexA].Lerp(jointData.m_scales[indexB], t) : staticJointData.m_staticTransform.m_scale;
+                    result.m_scale = !jointData.m_scales.empty() ? jointData.m_scales[indexA].Lerp(jointData.m_scales[indexB], t) : staticJointData.m_staticTransform.m_scale;
 #endif
+                }
             }
             else
             {
@@ -344,6 +360,7 @@ namespace EMotionFX
 
     void UniformMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
     {
+        m_compressedJointSamples.Clear();
         m_jointData.resize(numJoints);
         m_morphData.resize(numMorphs);
         m_floatData.resize(numFloats);
@@ -351,6 +368,7 @@ namespace EMotionFX
 
     void UniformMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
     {
+        m_compressedJointSamples.Clear();
         AZ_Assert(jointDataIndex == m_jointData.size(), "Expected the size of the jointData vector to be a different size. Is it in sync with the m_staticJointData vector?");
         m_jointData.emplace_back();
     }
@@ -374,17 +392,20 @@ namespace EMotionFX
 
     void UniformMotionData::AllocateJointPositionSamples(size_t jointDataIndex)
     {
+        m_compressedJointSamples.Clear();
         m_jointData[jointDataIndex].m_positions.resize(GetNumSamples());
     }
 
     void UniformMotionData::AllocateJointRotationSamples(size_t jointDataIndex)
     {
+        m_compressedJointSamples.Clear();
         m_jointData[jointDataIndex].m_rotations.resize(GetNumSamples());
     }
 
 #ifndef EMFX_SCALE_DISABLED
     void UniformMotionData::AllocateJointScaleSamples(size_t jointDataIndex)
     {
+        m_compressedJointSamples.Clear();
         m_jointData[jointDataIndex].m_scales.resize(GetNumSamples());
     }
 #endif
@@ -474,6 +495,26 @@ namespace EMotionFX
         return m_sampleSpacing;
     }
 
+    void UniformMotionData::CompressJointSamples(const CompressedJointSamples::Settings& settings)
+    {
+        m_compressedJointSamples.Init(*this, settings);
+    }
+
+    void UniformMotionData::ClearCompressedJointSamples()
+    {
+        m_compressedJointSamples.Clear();
+    }
+
+    bool UniformMotionData::HasCompressedJointSamples() const
+    {
+        return !m_compressedJointSamples.IsEmpty();
+    }
+
+    const CompressedJointSamples& UniformMotionData::GetCompressedJointSamples() const
+    {
+        return m_compressedJointSamples;
+    }
+
     void UniformMotionData::UpdateSampleSpacing()
     {
         if (m_sampleRate > AZ::Constants::FloatEpsilon)
@@ -494,6 +535,7 @@ namespace EMotionFX
 
     void UniformMotionData::ClearAllJointTransformSamples()
     {
+        m_compressedJointSamples.Clear();
         for (JointData& data : m_jointData)
         {
             data.m_positions.clear();
@@ -522,17 +564,20 @@ namespace EMotionFX
 
     void UniformMotionData::ClearJointPositionSamples(size_t jointDataIndex)
     {
+        m_compressedJointSamples.Clear();
         m_jointData[jointDataIndex].m_positions.clear();
     }
 
     void UniformMotionData::ClearJointRotationSamples(size_t jointDataIndex)
     {
+        m_compressedJointSamples.Clear();
         m_jointData[jointDataIndex].m_rotations.clear();
     }
 
 #ifndef EMFX_SCALE_DISABLED
     void UniformMotionData::ClearJointScaleSamples(size_t jointDataIndex)
     {
+        m_compressedJointSamples.Clear();
         m_jointData[jointDataIndex].m_scales.clear();
     }
 #endif
@@ -558,17 +603,20 @@ namespace EMotionFX
 
     void UniformMotionData::SetJointPositionSample(size_t jointDataIndex, size_t sampleIndex, const AZ::Vector3& position)
     {
+        m_compressedJointSamples.Clear();
         m_jointData[jointDataIndex].m_positions[sampleIndex] = position;
     }
 
     void UniformMotionData::SetJointRotationSample(size_t jointDataIndex, size_t sampleIndex, const AZ::Quaternion& rotation)
     {
+        m_compressedJointSamples.Clear();
         m_jointData[jointDataIndex].m_rotations[sampleIndex] = rotation;
     }
 
 #ifndef EMFX_SCALE_DISABLED
     void UniformMotionData::SetJointScaleSample(size_t jointDataIndex, size_t sampleIndex, const AZ::Vector3& scale)
     {
+        m_compressedJointSamples.Clear();
         m_jointData[jointDataIndex].m_scales[sampleIndex] = scale;
     }
 #endif
@@ -585,6 +633,7 @@ namespace EMotionFX
 
     void UniformMotionData::SetJointPositionSamples(size_t jointDataIndex, const AZStd::vector<AZ::Vector3>& positions)
     {
+        m_compressedJointSamples.Clear();
         AZ_Error("EMotionFX", positions.size() == m_numSamples, "Expecting positions vector to be of size %d instead of %d.", m_numSamples, positions.size());
         if (positions.size() == m_numSamples)
         {
@@ -594,6 +643,7 @@ namespace EMotionFX
 
     void UniformMotionData::SetJointRotationSamples(size_t jointDataIndex, const AZStd::vector<AZ::Quaternion>& rotations)
     {
+        m_compressedJointSamples.Clear();
         AZ_Error("EMotionFX", rotations.size() == m_numSamples, "Expecting rotations vector to be of size %d instead of %d.", m_numSamples, rotations.size());
         if (rotations.size() == m_numSamples)
         {
@@ -607,6 +657,7 @@ namespace EMotionFX
 #ifndef EMFX_SCALE_DISABLED
     void UniformMotionData::SetJointScaleSamples(size_t jointDataIndex, const AZStd::vector<AZ::Vector3>& scales)
     {
+        m_compressedJointSamples.Clear();
         AZ_Error("EMotionFX", scales.size() == m_numSamples, "Expecting scales vector to be of size %d instead of %d.", m_numSamples, scales.size());
         if (scales.size() == m_numSamples)
         {
@@ -617,6 +668,7 @@ namespace EMotionFX
 
     void UniformMotionData::ClearAllData()
     {
+        m_compressedJointSamples.Clear();
         m_jointData.clear();
         m_jointData.shrink_to_fit();
         m_morphData.clear();
@@ -629,6 +681,7 @@ namespace EMotionFX
 
     void UniformMotionData::RemoveJointSampleData(size_t jointDataIndex)
     {
+        m_compressedJointSamples.Clear();
         m_jointData.erase(m_jointData.begin() + jointDataIndex);
     }
 
@@ -644,6 +697,7 @@ namespace EMotionFX
 
     void UniformMotionData::ScaleData(float scaleFactor)
     {
+        m_compressedJointSamples.Clear();
         for (JointData& jointData : m_jointData)
         {
             for (AZ::Vector3& pos : jointData.m_positions)
@@ -695,6 +749,13 @@ namespace EMotionFX
         size_t indexB;
         CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
 
+        if (m_compressedJointSamples.IsJointCompressed(jointDataIndex))
+        {
+            Transform result = m_staticJointData[jointDataIndex].m_staticTransform;
+            m_compressedJointSamples.SampleJointTransform(jointDataIndex, indexA, indexB, t, result);
+            return result;
+        }
+
         const AZStd::vector<AZ::Vector3>& posValues = m_jointData[jointDataIndex].m_positions;
         const AZStd::vector<MCore::Compressed16BitQuaternion>& rotValues = m_jointData[jointDataIndex].m_rotations;
         const AZStd::vector<AZ::Vector3>& scaleValues = m_jointData[jointDataIndex].m_scales;
@@ -10,6 +10,7 @@
 
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/CompressedJointSamples.h>
 #include <EMotionFX/Source/MotionData/MotionData.h>
 #include <EMotionFX/Source/Transform.h>
 
@@ -106,6 +107,14 @@ namespace EMotionFX
         AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
 #endif
 
+        // Compressed joint samples.
+        // Once compressed, pose and joint transform sampling reads the quantized, interleaved samples instead of the full precision ones.
+        // The full precision samples are kept for saving and editing, modifying joint samples drops the compressed samples again.
+        void CompressJointSamples(const CompressedJointSamples::Settings& settings);
+        void ClearCompressedJointSamples();
+        bool HasCompressedJointSamples() const;
+        const CompressedJointSamples& GetCompressedJointSamples() const;
+
         size_t GetNumSamples() const;
         float GetSampleSpacing() const;
         void SetSampleRate(float sampleRate) override;
@@ -143,6 +152,7 @@ namespace EMotionFX
         AZStd::vector<JointData> m_jointData;
         AZStd::vector<FloatData> m_morphData;
         AZStd::vector<FloatData> m_floatData;
+        CompressedJointSamples m_compressedJointSamples;
         size_t m_numSamples = 0;
         float m_sampleSpacing = 1.0f / 30.0f;
     };
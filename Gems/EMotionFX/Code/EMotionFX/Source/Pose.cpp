@@ -13,6 +13,7 @@
 #include <EMotionFX/Source/MorphSetup.h>
 #include <EMotionFX/Source/Node.h>
 #include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/PoseBlendKernels.h>
 #include <EMotionFX/Source/PoseDataFactory.h>
 #include <EMotionFX/Source/TransformData.h>
 
@@ -833,13 +834,13 @@ namespace EMotionFX
     {
         if (m_actorInstance)
         {
-            const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
+            const AZStd::vector<uint16>& enabledNodes = m_actorInstance->GetEnabledNodes();
+            for (const uint16 nodeNr : enabledNodes)
             {
-                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
+                UpdateLocalSpaceTransform(nodeNr);
+                destPose->UpdateLocalSpaceTransform(nodeNr);
             }
+            PoseBlendKernels::Blend(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), enabledNodes, weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -861,9 +862,10 @@ namespace EMotionFX
             const size_t numNodes = m_actor->GetSkeleton()->GetNumNodes();
             for (size_t i = 0; i < numNodes; ++i)
             {
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(i), weight);
+                UpdateLocalSpaceTransform(i);
+                destPose->UpdateLocalSpaceTransform(i);
             }
+            PoseBlendKernels::Blend(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), numNodes, weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -885,6 +887,23 @@ namespace EMotionFX
     }
 
 
+    void Pose::BlendNodes(const Pose* destPose, float weight, AZStd::span<const size_t> nodeIndices)
+    {
+        for (const size_t nodeIndex : nodeIndices)
+        {
+            UpdateLocalSpaceTransform(nodeIndex);
+            destPose->UpdateLocalSpaceTransform(nodeIndex);
+        }
+        PoseBlendKernels::Blend(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), nodeIndices, weight);
+
+        // mark all child node model space transforms as dirty (recursively)
+        for (const size_t nodeIndex : nodeIndices)
+        {
+            RecursiveInvalidateModelSpaceTransforms(m_actor, nodeIndex);
+        }
+    }
+
+
     Pose& Pose::MakeRelativeTo(const Pose& other)
     {
         AZ_Assert(m_localSpaceTransforms.size() == other.m_localSpaceTransforms.size(), "Poses must be of the same size");
@@ -943,36 +962,23 @@ namespace EMotionFX
             AZ_Assert(m_localSpaceTransforms.size() == additivePose.m_localSpaceTransforms.size(), "Poses must be of the same size");
             if (m_actorInstance)
             {
-                const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-                for (size_t i = 0; i < numNodes; ++i)
+                const AZStd::vector<uint16>& enabledNodes = m_actorInstance->GetEnabledNodes();
+                for (const uint16 nodeNr : enabledNodes)
                 {
-                    uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                    Transform& transform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                    const Transform& additiveTransform = additivePose.GetLocalSpaceTransform(nodeNr);
-                    transform.m_position += additiveTransform.m_position * weight;
-                    transform.m_rotation = transform.m_rotation.NLerp(additiveTransform.m_rotation * transform.m_rotation, weight);
-                    EMFX_SCALECODE
-                    (
-                        transform.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.m_scale, weight);
-                    )
-                    transform.m_rotation.Normalize();
+                    UpdateLocalSpaceTransform(nodeNr);
+                    additivePose.UpdateLocalSpaceTransform(nodeNr);
                 }
+                PoseBlendKernels::ApplyAdditive(m_localSpaceTransforms.data(), additivePose.m_localSpaceTransforms.data(), enabledNodes, weight);
             }
             else
             {
                 const size_t numNodes = m_localSpaceTransforms.size();
                 for (size_t i = 0; i < numNodes; ++i)
                 {
-                    Transform& transform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                    const Transform& additiveTransform = additivePose.GetLocalSpaceTransform(i);
-                    transform.m_position += additiveTransform.m_position * weight;
-                    transform.m_rotation = transform.m_rotation.NLerp(additiveTransform.m_rotation * transform.m_rotation, weight);
-                    EMFX_SCALECODE
-                    (
-                        transform.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.m_scale, weight);
-                    )
-                    transform.m_rotation.Normalize();
+                    UpdateLocalSpaceTransform(i);
+                    additivePose.UpdateLocalSpaceTransform(i);
                 }
+                PoseBlendKernels::ApplyAdditive(m_localSpaceTransforms.data(), additivePose.m_localSpaceTransforms.data(), numNodes, weight);
             }
 
             const size_t numMorphs = m_morphWeights.size();
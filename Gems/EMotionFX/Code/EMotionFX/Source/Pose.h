@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
@@ -130,6 +131,14 @@ namespace EMotionFX
          */
         void Blend(const Pose* destPose, float weight);
 
+        /**
+         * Blend the transforms for the given nodes only, such as the nodes of a blend mask.
+         * @param destPose The destination pose to blend into.
+         * @param weight The weight value to use, which must be in range of [0..1], where 1.0 is the dest pose.
+         * @param nodeIndices The indices of the nodes to blend.
+         */
+        void BlendNodes(const Pose* destPose, float weight, AZStd::span<const size_t> nodeIndices);
+
         /**
          * Additively blend the transforms for all enabled nodes in the actor instance.
          * You can see this as: thisPose += destPose * weight.
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdMath.h>
+#include <EMotionFX/Source/PoseBlendKernels.h>
+#include <EMotionFX/Source/Transform.h>
+
+
+namespace EMotionFX
+{
+    namespace PoseBlendKernels
+    {
+        namespace Internal
+        {
+            using AZ::Simd::Vec3;
+            using AZ::Simd::Vec4;
+
+            // The blend weight splatted in each register type, set up once per blend.
+            struct BlendWeight
+            {
+                explicit BlendWeight(float weight)
+                    : m_weight3(Vec3::Splat(weight))
+                    , m_weight4(Vec4::Splat(weight))
+                {
+                }
+
+                Vec3::FloatType m_weight3;
+                Vec4::FloatType m_weight4;
+            };
+
+            // Normalized lerp between two rotations along the shortest arc.
+            // Instead of branching on the sign of the dot product, its sign bit is xor-ed on the destination rotation.
+            AZ_FORCE_INLINE Vec4::FloatType NLerp(Vec4::FloatArgType source, Vec4::FloatArgType dest, Vec4::FloatArgType weight)
+            {
+                const Vec4::FloatType signMask = Vec4::Splat(-0.0f);
+                const Vec4::FloatType dot = Vec4::FromVec1(Vec4::Dot(source, dest));
+                const Vec4::FloatType shortestDest = Vec4::Xor(dest, Vec4::And(dot, signMask));
+                return Vec4::Normalize(Vec4::Madd(Vec4::Sub(shortestDest, source), weight, source));
+            }
+
+            AZ_FORCE_INLINE void BlendTransform(Transform& transform, const Transform& destTransform, const BlendWeight& weight)
+            {
+                const Vec3::FloatType position = transform.m_position.GetSimdValue();
+                transform.m_position = AZ::Vector3(Vec3::Madd(Vec3::Sub(destTransform.m_position.GetSimdValue(), position), weight.m_weight3, position));
+
+                transform.m_rotation = AZ::Quaternion(NLerp(transform.m_rotation.GetSimdValue(), destTransform.m_rotation.GetSimdValue(), weight.m_weight4));
+
+                EMFX_SCALECODE
+                (
+                    const Vec3::FloatType scale = transform.m_scale.GetSimdValue();
+                    transform.m_scale = AZ::Vector3(Vec3::Madd(Vec3::Sub(destTransform.m_scale.GetSimdValue(), scale), weight.m_weight3, scale));
+                )
+            }
+
+            AZ_FORCE_INLINE void ApplyAdditiveTransform(Transform& transform, const Transform& additiveTransform, const BlendWeight& weight)
+            {
+                transform.m_position = AZ::Vector3(Vec3::Madd(additiveTransform.m_position.GetSimdValue(), weight.m_weight3, transform.m_position.GetSimdValue()));
+
+                const Vec4::FloatType rotation = transform.m_rotation.GetSimdValue();
+                const Vec4::FloatType additiveRotation = Vec4::QuaternionMultiply(additiveTransform.m_rotation.GetSimdValue(), rotation);
+                transform.m_rotation = AZ::Quaternion(NLerp(rotation, additiveRotation, weight.m_weight4));
+
+                EMFX_SCALECODE
+                (
+                    const Vec3::FloatType one = Vec3::Splat(1.0f);
+                    const Vec3::FloatType scaleFactor = Vec3::Madd(Vec3::Sub(additiveTransform.m_scale.GetSimdValue(), one), weight.m_weight3, one);
+                    transform.m_scale = AZ::Vector3(Vec3::Mul(transform.m_scale.GetSimdValue(), scaleFactor));
+                )
+            }
+        } // namespace Internal
+
+
+        void Blend(Transform* transforms, const Transform* destTransforms, AZStd::span<const uint16> nodeIndices, float weight)
+        {
+            const Internal::BlendWeight blendWeight(weight);
+            for (const uint16 nodeIndex : nodeIndices)
+            {
+                Internal::BlendTransform(transforms[nodeIndex], destTransforms[nodeIndex], blendWeight);
+            }
+        }
+
+
+        void Blend(Transform* transforms, const Transform* destTransforms, AZStd::span<const size_t> nodeIndices, float weight)
+        {
+            const Internal::BlendWeight blendWeight(weight);
+            for (const size_t nodeIndex : nodeIndices)
+            {
+                Internal::BlendTransform(transforms[nodeIndex], destTransforms[nodeIndex], blendWeight);
+            }
+        }
+
+
+        void Blend(Transform* transforms, const Transform* destTransforms, size_t numTransforms, float weight)
+        {
+            const Internal::BlendWeight blendWeight(weight);
+            for (size_t i = 0; i < numTransforms; ++i)
+            {
+                Internal::BlendTransform(transforms[i], destTransforms[i], blendWeight);
+            }
+        }
+
+
+        void ApplyAdditive(Transform* transforms, const Transform* additiveTransforms, AZStd::span<const uint16> nodeIndices, float weight)
+        {
+            const Internal::BlendWeight blendWeight(weight);
+            for (const uint16 nodeIndex : nodeIndices)
+            {
+                Internal::ApplyAdditiveTransform(transforms[nodeIndex], additiveTransforms[nodeIndex], blendWeight);
+            }
+        }
+
+
+        void ApplyAdditive(Transform* transforms, const Transform* additiveTransforms, size_t numTransforms, float weight)
+        {
+            const Internal::BlendWeight blendWeight(weight);
+            for (size_t i = 0; i < numTransforms; ++i)
+            {
+                Internal::ApplyAdditiveTransform(transforms[i], additiveTransforms[i], blendWeight);
+            }
+        }
+    } // namespace PoseBlendKernels
+} // namespace EMotionFX
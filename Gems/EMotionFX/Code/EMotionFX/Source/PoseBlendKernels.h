@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include "EMotionFXConfig.h"
+#include <AzCore/std/containers/span.h>
+
+
+namespace EMotionFX
+{
+    class Transform;
+
+    /**
+     * Blend kernels working on arrays of local space transforms, used by the pose blending of the anim graph.
+     * The rotations are blended without branching on the sign of the quaternion dot product, so the same instructions run for
+     * every joint and the loops stay friendly to the pipeline. The results match Transform::Blend and Pose::ApplyAdditive.
+     * The kernels don't touch the pose flags, the transforms they read are expected to be up to date.
+     */
+    namespace PoseBlendKernels
+    {
+        /**
+         * Blend the transforms towards the destination transforms, the same way Transform::Blend does.
+         * @param transforms The transforms to blend, which get overwritten with the result.
+         * @param destTransforms The transforms to blend towards.
+         * @param nodeIndices The indices of the transforms to blend.
+         * @param weight The blend weight, where 0 keeps the transforms and 1 results in the destination transforms.
+         */
+        void Blend(Transform* transforms, const Transform* destTransforms, AZStd::span<const uint16> nodeIndices, float weight);
+        void Blend(Transform* transforms, const Transform* destTransforms, AZStd::span<const size_t> nodeIndices, float weight);
+
+        /**
+         * Blend the first numTransforms transforms towards the destination transforms, the same way Transform::Blend does.
+         */
+        void Blend(Transform* transforms, const Transform* destTransforms, size_t numTransforms, float weight);
+
+        /**
+         * Apply the additive transforms on top of the transforms, the same way Pose::ApplyAdditive does with a weight.
+         * @param transforms The transforms to apply the additive transforms on, which get overwritten with the result.
+         * @param additiveTransforms The additive transforms, relative to the bind pose.
+         * @param nodeIndices The indices of the transforms to apply the additive transforms on.
+         * @param weight The weight of the additive transforms.
+         */
+        void ApplyAdditive(Transform* transforms, const Transform* additiveTransforms, AZStd::span<const uint16> nodeIndices, float weight);
+
+        /**
+         * Apply the first numTransforms additive transforms on top of the transforms, the same way Pose::ApplyAdditive does with a weight.
+         */
+        void ApplyAdditive(Transform* transforms, const Transform* additiveTransforms, size_t numTransforms, float weight);
+    } // namespace PoseBlendKernels
+} // namespace EMotionFX
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "TaskGraphScheduler.h"
+#include "ActorManager.h"
+#include "ActorInstance.h"
+#include "Attachment.h"
+#include "EMotionFXManager.h"
+#include <EMotionFX/Source/Allocators.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(TaskGraphScheduler, ActorUpdateAllocator)
+
+    static const AZ::TaskDescriptor s_actorInstanceUpdateTaskDescriptor{ "TaskGraphScheduler::ActorInstanceUpdateTask", "Animation" };
+
+    // constructor
+    TaskGraphScheduler::TaskGraphScheduler()
+        : ActorUpdateScheduler()
+    {
+        m_actorInstances.reserve(1024);
+    }
+
+
+    // destructor
+    TaskGraphScheduler::~TaskGraphScheduler()
+    {
+    }
+
+
+    // create
+    TaskGraphScheduler* TaskGraphScheduler::Create()
+    {
+        return aznew TaskGraphScheduler();
+    }
+
+
+    // clear the schedule
+    void TaskGraphScheduler::Clear()
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_actorInstances.clear();
+        m_isTaskGraphDirty = true;
+    }
+
+
+    // log it, for debugging purposes
+    void TaskGraphScheduler::Print()
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        const size_t numActorInstances = m_actorInstances.size();
+        for (size_t i = 0; i < numActorInstances; ++i)
+        {
+            AZ_Printf("EMotionFX", "TASK %.3zu - %zu attachments", i, m_actorInstances[i]->GetNumAttachments());
+        }
+
+        AZ_Printf("EMotionFX", "---------");
+    }
+
+
+    size_t TaskGraphScheduler::GetNumDependencies()
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        UpdateTaskGraph();
+        return m_numDependencies;
+    }
+
+
+    void TaskGraphScheduler::UpdateTaskGraph()
+    {
+        if (!m_isTaskGraphDirty)
+        {
+            return;
+        }
+
+        m_isTaskGraphDirty = false;
+        m_taskGraph.Reset();
+        m_numDependencies = 0;
+
+        AZStd::vector<AZ::TaskToken> tokens;
+        tokens.reserve(m_actorInstances.size());
+        AZStd::unordered_map<const ActorInstance*, size_t> tokenIndices;
+        tokenIndices.reserve(m_actorInstances.size());
+        for (ActorInstance* actorInstance : m_actorInstances)
+        {
+            tokenIndices.emplace(actorInstance, tokens.size());
+            tokens.emplace_back(m_taskGraph.AddTask(s_actorInstanceUpdateTaskDescriptor, [this, actorInstance]()
+            {
+                UpdateActorInstance(actorInstance);
+            }));
+        }
+
+        // the attachments read the transforms of the actor instance they are attached to, so they have to wait for it
+        for (ActorInstance* actorInstance : m_actorInstances)
+        {
+            AZ::TaskToken& token = tokens[tokenIndices[actorInstance]];
+
+            const size_t numAttachments = actorInstance->GetNumAttachments();
+            for (size_t i = 0; i < numAttachments; ++i)
+            {
+                const ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+                if (const auto it = tokenIndices.find(attachment); it != tokenIndices.end())
+                {
+                    token.Precedes(tokens[it->second]);
+                    m_numDependencies++;
+                }
+            }
+        }
+    }
+
+
+    // execute the schedule
+    void TaskGraphScheduler::Execute(float timePassedInSeconds)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        if (m_actorInstances.empty())
+        {
+            return;
+        }
+
+        // propagate root actor instance visibility to their attachments
+        const ActorManager& actorManager = GetActorManager();
+        const size_t numRootActorInstances = actorManager.GetNumRootActorInstances();
+        for (size_t i = 0; i < numRootActorInstances; ++i)
+        {
+            ActorInstance* rootInstance = actorManager.GetRootActorInstance(i);
+            if (rootInstance->GetIsEnabled() == false)
+            {
+                continue;
+            }
+
+            rootInstance->RecursiveSetIsVisible(rootInstance->GetIsVisible());
+        }
+
+        // reset stats
+        m_numUpdated.SetValue(0);
+        m_numVisible.SetValue(0);
+        m_numSampled.SetValue(0);
+
+        m_timePassedInSeconds = timePassedInSeconds;
+
+        // one thread data slot per thread, the tasks take them out of the pool while updating
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_threadIndexMutex);
+            const uint32 numThreads = aznumeric_cast<uint32>(GetEMotionFX().GetNumThreads());
+            m_freeThreadIndices.resize(numThreads);
+            for (uint32 i = 0; i < numThreads; ++i)
+            {
+                m_freeThreadIndices[i] = numThreads - i - 1;
+            }
+        }
+
+        AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (taskGraphActive && taskGraphActive->IsTaskGraphActive())
+        {
+            UpdateTaskGraph();
+
+            AZ::TaskGraphEvent finishedEvent{ "TaskGraphScheduler Wait" };
+            m_taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else
+        {
+            // the actor instances are inserted before their attachments, so this order respects the dependencies
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                UpdateActorInstance(actorInstance);
+            }
+        }
+    }
+
+
+    void TaskGraphScheduler::UpdateActorInstance(ActorInstance* actorInstance)
+    {
+        if (actorInstance->GetIsEnabled() == false)
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Animation, "TaskGraphScheduler::ActorInstanceUpdateTask");
+
+        const float timePassedInSeconds = m_timePassedInSeconds;
+        const uint32 threadIndex = AcquireThreadIndex();
+        actorInstance->SetThreadIndex(threadIndex);
+
+        m_numUpdated.Increment();
+
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            m_numVisible.Increment();
+        }
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                m_numSampled.Increment();
+            }
+        }
+
+        // update the actor instance
+        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+
+        ReleaseThreadIndex(threadIndex);
+    }
+
+
+    uint32 TaskGraphScheduler::AcquireThreadIndex()
+    {
+        // the task executor may run more tasks at once than there are thread data slots, in which case the task waits for
+        // another one to finish
+        AZStd::unique_lock<AZStd::mutex> lock(m_threadIndexMutex);
+        m_threadIndexAvailable.wait(lock, [this]() { return !m_freeThreadIndices.empty(); });
+
+        const uint32 threadIndex = m_freeThreadIndices.back();
+        m_freeThreadIndices.pop_back();
+        return threadIndex;
+    }
+
+
+    void TaskGraphScheduler::ReleaseThreadIndex(uint32 threadIndex)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_threadIndexMutex);
+            m_freeThreadIndices.push_back(threadIndex);
+        }
+        m_threadIndexAvailable.notify_one();
+    }
+
+
+    void TaskGraphScheduler::RecursiveInsertActorInstance(ActorInstance* actorInstance, [[maybe_unused]] size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        AZ_Assert(AZStd::find(m_actorInstances.begin(), m_actorInstances.end(), actorInstance) == m_actorInstances.end(),
+            "Expected the actor instance not being part of the schedule already.");
+
+        m_actorInstances.emplace_back(actorInstance);
+        m_isTaskGraphDirty = true;
+
+        // recursively add all attachments too, after the actor instance they are attached to
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment)
+            {
+                RecursiveInsertActorInstance(attachment);
+            }
+        }
+    }
+
+
+    // remove the actor instance from the schedule (excluding attachments)
+    size_t TaskGraphScheduler::RemoveActorInstance(ActorInstance* actorInstance, [[maybe_unused]] size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        const auto it = AZStd::find(m_actorInstances.begin(), m_actorInstances.end(), actorInstance);
+        if (it != m_actorInstances.end())
+        {
+            m_actorInstances.erase(it);
+            m_isTaskGraphDirty = true;
+        }
+
+        return 0;
+    }
+
+
+    // remove the actor instance (including all of its attachments)
+    void TaskGraphScheduler::RecursiveRemoveActorInstance(ActorInstance* actorInstance, [[maybe_unused]] size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        RemoveActorInstance(actorInstance);
+
+        // recursively remove all attachments as well
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment)
+            {
+                RecursiveRemoveActorInstance(attachment);
+            }
+        }
+    }
+}   // namespace EMotionFX
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// include the required headers
+#include "EMotionFXConfig.h"
+#include "ActorUpdateScheduler.h"
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <MCore/Source/MultiThreadManager.h>
+
+namespace EMotionFX
+{
+    // forward declarations
+    class ActorInstance;
+
+
+    /**
+     * The task graph scheduler.
+     * This scheduler updates the actor instances on the task executor, using a task graph with one task per actor instance.
+     * Instead of grouping the actor instances into steps with a barrier in between, like the MultiThreadScheduler does, the
+     * attachment relationships are encoded as edges of the graph. An attachment starts updating as soon as the actor instance
+     * it is attached to is done, and actor instances without any relationship never wait on each other.
+     * The graph is retained and only rebuilt when actor instances are inserted into or removed from the schedule.
+     * When the task graph isn't active, for instance in tools and tests, the actor instances are updated one after another.
+     */
+    class EMFX_API TaskGraphScheduler
+        : public ActorUpdateScheduler
+    {
+        AZ_CLASS_ALLOCATOR_DECL
+    public:
+        /**
+         * The unique type ID of this scheduler, as returned by the GetType() method.
+         */
+        enum
+        {
+            TYPE_ID = 0x00000003
+        };
+
+        /**
+         * The constructor.
+         */
+        static TaskGraphScheduler* Create();
+
+        /**
+         * Get the name of this class, or a description.
+         * @result The string containing the name of the scheduler.
+         */
+        const char* GetName() const override        { return "TaskGraphScheduler"; }
+
+        /**
+         * Get the unique type ID of the scheduler type.
+         * All schedulers will have another ID, so that you can use this to identify what scheduler you are dealing with.
+         * @result The unique ID of the scheduler type.
+         */
+        uint32 GetType() const override             { return TYPE_ID; }
+
+        /**
+         * The main method which will update all actor instances in the schedule.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void Execute(float timePassedInSeconds) override;
+
+        /**
+         * LOG the schedule using the LOG method.
+         * This shows the actor instances in the order they get inserted into the graph, along with their number of attachments.
+         */
+        void Print() override;
+
+        /**
+         * Clear the schedule.
+         */
+        void Clear() override;
+
+        /**
+         * Recursively insert an actor instance into the schedule, including all its attachments.
+         * @param actorInstance The actor instance to insert.
+         * @param startStep Unused, as the schedule has no steps.
+         */
+        void RecursiveInsertActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Recursively remove an actor instance and its attachments from the schedule.
+         * @param actorInstance The actor instance to remove.
+         * @param startStep Unused, as the schedule has no steps.
+         */
+        void RecursiveRemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Remove a single actor instance from the schedule. This will not remove its attachments.
+         * @param actorInstance The actor instance to remove.
+         * @param startStep Unused, as the schedule has no steps.
+         * @result Always returns 0, as the schedule has no steps.
+         */
+        size_t RemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Get the actor instances in the schedule.
+         * An actor instance is always in the array after the actor instance it is attached to.
+         * @result The actor instances in the schedule.
+         */
+        const AZStd::vector<ActorInstance*>& GetActorInstances() const { return m_actorInstances; }
+
+        /**
+         * Get the number of edges between the tasks of the graph, which is the number of attachment relationships in the schedule.
+         * The graph is rebuilt first in case the schedule changed since the last execution.
+         * @result The number of edges between the tasks of the graph.
+         */
+        size_t GetNumDependencies();
+
+    protected:
+        AZStd::vector<ActorInstance*>   m_actorInstances;            /**< The actor instances in the schedule, in the order they got inserted. */
+        AZ::TaskGraph                   m_taskGraph{ "EMotionFX::TaskGraphScheduler" };
+        size_t                          m_numDependencies = 0;       /**< The number of edges in the task graph. */
+        float                           m_timePassedInSeconds = 0.0f; /**< The time passed of the current execution, read by the tasks. */
+        bool                            m_isTaskGraphDirty = true;   /**< True when the schedule changed since the task graph got built. */
+        MCore::MutexRecursive           m_mutex;
+
+        AZStd::mutex                    m_threadIndexMutex;
+        AZStd::condition_variable       m_threadIndexAvailable;
+        AZStd::vector<uint32>           m_freeThreadIndices;         /**< The thread data slots not used by a running task. */
+
+        /**
+         * The constructor.
+         */
+        TaskGraphScheduler();
+
+        /**
+         * The destructor.
+         */
+        ~TaskGraphScheduler() override;
+
+        /**
+         * Rebuild the task graph when the schedule changed, adding a task per actor instance and an edge per attachment.
+         */
+        void UpdateTaskGraph();
+
+        /**
+         * Update the transformations of a single actor instance, from within one of the tasks of the graph.
+         * The actor instance is assigned a free thread data slot for the duration of the update, as the thread data pools
+         * handed out to the actor instance are not thread safe.
+         * @param actorInstance The actor instance to update.
+         */
+        void UpdateActorInstance(ActorInstance* actorInstance);
+
+        uint32 AcquireThreadIndex();
+        void ReleaseThreadIndex(uint32 threadIndex);
+    };
+}   // namespace EMotionFX
@@ -15,6 +15,7 @@ set(FILES
     Source/ActorInstanceBus.h
     Source/ActorManager.cpp
     Source/ActorManager.h
+    Source/ActorUpdateScheduler.cpp
     Source/ActorUpdateScheduler.h
     Source/Algorithms.h
     Source/Allocators.cpp
@@ -97,6 +98,8 @@ set(FILES
     Source/PhysicsSetup.h
     Source/Pose.cpp
     Source/Pose.h
+    Source/PoseBlendKernels.cpp
+    Source/PoseBlendKernels.h
     Source/PoseData.cpp
     Source/PoseData.h
     Source/PoseDataFactory.cpp
@@ -131,6 +134,8 @@ set(FILES
     Source/SpringSolver.h
     Source/SubMesh.cpp
     Source/SubMesh.h
+    Source/TaskGraphScheduler.cpp
+    Source/TaskGraphScheduler.h
     Source/ThreadData.cpp
     Source/ThreadData.h
     Source/Transform.cpp
@@ -345,6 +350,8 @@ set(FILES
     Source/EventInfo.h
     Source/EventManager.cpp
     Source/EventManager.h
+    Source/MotionData/CompressedJointSamples.cpp
+    Source/MotionData/CompressedJointSamples.h
     Source/MotionData/MotionData.cpp
     Source/MotionData/MotionData.h
     Source/MotionData/MotionDataFactory.cpp
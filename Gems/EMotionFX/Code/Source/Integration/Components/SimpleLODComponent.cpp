@@ -34,10 +34,12 @@ namespace EMotionFX
             if (serializeContext)
             {
                 serializeContext->Class<Configuration>()
-                    ->Version(2)
+                    ->Version(3)
                     ->Field("LODDistances", &Configuration::m_lodDistances)
                     ->Field("EnableLODSampling", &Configuration::m_enableLodSampling)
                     ->Field("LODSampleRates", &Configuration::m_lodSampleRates)
+                    ->Field("EnableLODUpdateRate", &Configuration::m_enableLodUpdateRate)
+                    ->Field("LODUpdateRates", &Configuration::m_lodUpdateRates)
                     ;
 
                 AZ::EditContext* editContext = serializeContext->GetEditContext();
@@ -63,7 +65,17 @@ namespace EMotionFX
                             ->Attribute(AZ::Edit::Attributes::ContainerCanBeModified, false)
                             ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                             ->ElementAttribute(AZ::Edit::Attributes::Step, 1.0f)
-                            ->ElementAttribute(AZ::Edit::Attributes::Min, 0.0f);
+                            ->ElementAttribute(AZ::Edit::Attributes::Min, 0.0f)
+                        ->DataElement(0, &SimpleLODComponent::Configuration::m_enableLodUpdateRate,
+                            "Enable LOD anim graph update rate", "The anim graph is evaluated every few frames based on the LOD level, and the pose is interpolated in between.")
+                            ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                        ->DataElement(0, &SimpleLODComponent::Configuration::m_lodUpdateRates,
+                            "Anim graph update rates", "Evaluate the anim graph every this number of frames based on LOD. Setting it to 1 means every frame.")
+                            ->Attribute(AZ::Edit::Attributes::Visibility, &SimpleLODComponent::Configuration::GetEnableLodUpdateRate)
+                            ->Attribute(AZ::Edit::Attributes::ContainerCanBeModified, false)
+                            ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                            ->ElementAttribute(AZ::Edit::Attributes::Min, 1)
+                            ->ElementAttribute(AZ::Edit::Attributes::Max, EMotionFX::ActorInstance::s_maxAnimGraphUpdateRate);
                 }
             }
         }
@@ -95,6 +107,16 @@ namespace EMotionFX
                 size_t copyCount = std::min(defaultSampleRate.size(), numLODs);
                 AZStd::copy(begin(defaultSampleRate), begin(defaultSampleRate) + copyCount, begin(m_lodSampleRates));
             }
+
+            if (numLODs != m_lodUpdateRates.size())
+            {
+                // Generate the default LOD update rate to 1, 1, 2, 4, 8, 8, 8, ...
+                constexpr AZStd::array<AZ::u32, 4> defaultUpdateRate {1, 1, 2, 4};
+                m_lodUpdateRates.resize(numLODs, EMotionFX::ActorInstance::s_maxAnimGraphUpdateRate);
+
+                const size_t copyCount = std::min(defaultUpdateRate.size(), numLODs);
+                AZStd::copy(begin(defaultUpdateRate), begin(defaultUpdateRate) + copyCount, begin(m_lodUpdateRates));
+            }
         }
 
         bool SimpleLODComponent::Configuration::GetEnableLodSampling()
@@ -102,6 +124,11 @@ namespace EMotionFX
             return m_enableLodSampling;
         }
 
+        bool SimpleLODComponent::Configuration::GetEnableLodUpdateRate()
+        {
+            return m_enableLodUpdateRate;
+        }
+
         void SimpleLODComponent::Reflect(AZ::ReflectContext* context)
         {
             Configuration::Reflect(context);
@@ -239,6 +266,15 @@ namespace EMotionFX
                     actorInstance->SetMotionSamplingRate(0);
                 }
 
+                if (configuration.m_enableLodUpdateRate)
+                {
+                    actorInstance->SetAnimGraphUpdateRate(configuration.m_lodUpdateRates[requestedLod]);
+                }
+                else if (actorInstance->GetAnimGraphUpdateRate() != 1)
+                {
+                    actorInstance->SetAnimGraphUpdateRate(1);
+                }
+
                 // Disable the automatic mesh LOD level adjustment based on screen space in case a simple LOD component is present.
                 // The simple LOD component overrides the mesh LOD level and syncs the skeleton with the mesh LOD level.
                 AZ::Render::MeshComponentRequestBus::Event(entityId,
@@ -46,12 +46,15 @@ namespace EMotionFX
                 // Generate the default value based on LOD level.
                 void GenerateDefaultValue(size_t numLODs);
                 bool GetEnableLodSampling();
+                bool GetEnableLodUpdateRate();
 
                 static void Reflect(AZ::ReflectContext* context);
 
                 AZStd::vector<float> m_lodDistances;         // LOD distances that decide which lod the actor should choose.
                 AZStd::vector<float> m_lodSampleRates;       // Per LOD sample rate.
                 bool m_enableLodSampling = false;            // Enable per LOD sampling rate. This will allow animation to sample at a lower rate for performance improvement.
+                AZStd::vector<AZ::u32> m_lodUpdateRates;     // Per LOD anim graph update rate, in frames.
+                bool m_enableLodUpdateRate = false;          // Enable per LOD update rate. This evaluates the anim graph every few frames only and interpolates the pose in between.
             };
 
             SimpleLODComponent(const Configuration* config = nullptr);
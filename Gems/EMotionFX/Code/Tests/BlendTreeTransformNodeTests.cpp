@@ -100,4 +100,31 @@ namespace EMotionFX
         ASSERT_EQ(expected, outputRoot);
     }
 
+    // Evaluate the anim graph every second frame only, the pose in between is interpolated
+    TEST_F(BlendTreeTransformNodeTests, ReducedAnimGraphUpdateRateInterpolatesPose)
+    {
+        MCore::AttributeFloat* translate_amount = m_animGraphInstance->GetParameterValueChecked<MCore::AttributeFloat>(0);
+        m_actorInstance->SetAnimGraphUpdateRate(2);
+        EXPECT_EQ(m_actorInstance->GetEffectiveAnimGraphUpdateRate(), 2);
+
+        translate_amount->SetValue(0.0f);
+        Evaluate();
+        EXPECT_EQ(Transform::CreateIdentity(), GetOutputTransform());
+
+        // Depending on how the actor instance is staggered, the new value gets evaluated on the first or the second frame,
+        // and the pose reaches it over the following two frames.
+        translate_amount->SetValue(1.0f);
+        AZStd::vector<float> positions;
+        for (int frame = 0; frame < 3; ++frame)
+        {
+            Evaluate();
+            positions.emplace_back(GetOutputTransform().m_position.GetX());
+        }
+
+        const auto firstMoved = AZStd::find_if(positions.begin(), positions.end(), [](float position) { return position > 0.0f; });
+        ASSERT_NE(firstMoved, positions.end());
+        EXPECT_FLOAT_EQ(*firstMoved, 5.0f);
+        EXPECT_FLOAT_EQ(positions.back(), 10.0f);
+    }
+
 } // end namespace EMotionFX
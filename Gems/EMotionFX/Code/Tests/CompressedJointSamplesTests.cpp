@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <Tests/SystemComponentFixture.h>
+
+namespace EMotionFX
+{
+    class CompressedJointSamplesFixture
+        : public SystemComponentFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            UniformMotionData::InitSettings settings;
+            settings.m_numJoints = 2;
+            settings.m_numSamples = 31;
+            settings.m_sampleRate = 30.0f;
+            m_motionData.Init(settings);
+
+            // The first joint moves and rotates, the second joint only moves within the error budget.
+            m_motionData.AllocateJointPositionSamples(0);
+            m_motionData.AllocateJointRotationSamples(0);
+            m_motionData.AllocateJointPositionSamples(1);
+            for (size_t s = 0; s < settings.m_numSamples; ++s)
+            {
+                const float angle = static_cast<float>(s) / static_cast<float>(settings.m_numSamples - 1) * AZ::Constants::TwoPi;
+                m_motionData.SetJointPositionSample(0, s, AZ::Vector3(sinf(angle) * 2.0f, cosf(angle), static_cast<float>(s)));
+                m_motionData.SetJointRotationSample(0, s, AZ::Quaternion::CreateRotationZ(angle));
+                m_motionData.SetJointPositionSample(1, s, AZ::Vector3(1.0f, sinf(angle) * 0.0001f, 0.0f));
+            }
+        }
+
+        void TearDown() override
+        {
+            m_motionData.Clear();
+            SystemComponentFixture::TearDown();
+        }
+
+    protected:
+        UniformMotionData m_motionData;
+    };
+
+    TEST_F(CompressedJointSamplesFixture, CompressedSamplesMatchFullPrecisionSamples)
+    {
+        AZStd::vector<Transform> expectedTransforms;
+        for (float time = 0.0f; time <= m_motionData.GetDuration(); time += 0.01f)
+        {
+            expectedTransforms.emplace_back(m_motionData.SampleJointTransform(time, 0));
+            expectedTransforms.emplace_back(m_motionData.SampleJointTransform(time, 1));
+        }
+
+        m_motionData.CompressJointSamples({});
+        ASSERT_TRUE(m_motionData.HasCompressedJointSamples());
+        const CompressedJointSamples& compressedSamples = m_motionData.GetCompressedJointSamples();
+        EXPECT_EQ(compressedSamples.GetNumSamples(), m_motionData.GetNumSamples());
+        EXPECT_EQ(compressedSamples.GetNumQuantizedTracks(), 2) << "The position of the second joint should be stored as a constant.";
+
+        size_t index = 0;
+        for (float time = 0.0f; time <= m_motionData.GetDuration(); time += 0.01f)
+        {
+            for (size_t jointDataIndex = 0; jointDataIndex < 2; ++jointDataIndex)
+            {
+                const Transform& expected = expectedTransforms[index++];
+                const Transform sampled = m_motionData.SampleJointTransform(time, jointDataIndex);
+                EXPECT_TRUE(sampled.m_position.IsClose(expected.m_position, 0.001f));
+                EXPECT_GT(AZ::GetAbs(sampled.m_rotation.Dot(expected.m_rotation)), 0.99999f);
+            }
+        }
+    }
+
+    TEST_F(CompressedJointSamplesFixture, ModifyingSamplesDropsCompressedSamples)
+    {
+        m_motionData.CompressJointSamples({});
+        ASSERT_TRUE(m_motionData.HasCompressedJointSamples());
+
+        m_motionData.SetJointPositionSample(0, 0, AZ::Vector3::CreateZero());
+        EXPECT_FALSE(m_motionData.HasCompressedJointSamples());
+        EXPECT_TRUE(m_motionData.SampleJointTransform(0.0f, 0).m_position.IsClose(AZ::Vector3::CreateZero()));
+    }
+} // namespace EMotionFX
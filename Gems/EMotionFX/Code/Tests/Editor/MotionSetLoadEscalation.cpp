@@ -81,6 +81,7 @@ namespace EMotionFX
         MOCK_METHOD1(EscalateAssetBySearchTerm, bool(AZStd::string_view searchTerm));
 
         MOCK_METHOD1(EscalateAssetByUuid, bool (const AZ::Uuid&));
+        MOCK_METHOD1(PrefetchAssetsByUuid, bool (const AZStd::vector<AZ::Uuid>&));
         MOCK_METHOD1(CompileAssetSync_FlushIO, AzFramework::AssetSystem::AssetStatus (const AZStd::string&));
         MOCK_METHOD1(CompileAssetSyncById, AzFramework::AssetSystem::AssetStatus (const AZ::Data::AssetId&));
         MOCK_METHOD1(CompileAssetSyncById_FlushIO, AzFramework::AssetSystem::AssetStatus (const AZ::Data::AssetId&));
@@ -44,4 +44,37 @@ namespace EMotionFX
 
         actorInstance->Destroy();
     }
+
+    TEST_F(SystemComponentFixture, AnimationBudget_ScalesReducedAnimGraphUpdateRates)
+    {
+        ActorUpdateScheduler* scheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        ActorInstance* reducedActorInstance = ActorInstance::Create(actor.get());
+        reducedActorInstance->SetAnimGraphUpdateRate(2);
+        ActorInstance* fullActorInstance = ActorInstance::Create(actor.get());
+
+        scheduler->SetAnimationBudget(1.0f);
+        scheduler->OnExecuted(2.0f);
+        EXPECT_EQ(scheduler->GetAnimGraphUpdateRateScale(), 2);
+        EXPECT_EQ(reducedActorInstance->GetEffectiveAnimGraphUpdateRate(), 4);
+        EXPECT_EQ(fullActorInstance->GetEffectiveAnimGraphUpdateRate(), 1) << "Actor instances updating every frame should never be slowed down.";
+
+        scheduler->OnExecuted(2.0f);
+        scheduler->OnExecuted(2.0f);
+        EXPECT_EQ(reducedActorInstance->GetEffectiveAnimGraphUpdateRate(), ActorInstance::s_maxAnimGraphUpdateRate);
+
+        // Within the budget, but not below half of it, the scale is kept.
+        const uint32 scale = scheduler->GetAnimGraphUpdateRateScale();
+        scheduler->OnExecuted(0.75f);
+        EXPECT_EQ(scheduler->GetAnimGraphUpdateRateScale(), scale);
+        scheduler->OnExecuted(0.1f);
+        EXPECT_EQ(scheduler->GetAnimGraphUpdateRateScale(), scale / 2);
+
+        scheduler->SetAnimationBudget(0.0f);
+        EXPECT_EQ(scheduler->GetAnimGraphUpdateRateScale(), 1);
+        EXPECT_EQ(reducedActorInstance->GetEffectiveAnimGraphUpdateRate(), 2);
+
+        reducedActorInstance->Destroy();
+        fullActorInstance->Destroy();
+    }
 } // namespace EMotionFX
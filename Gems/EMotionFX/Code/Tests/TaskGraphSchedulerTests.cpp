@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/AttachmentNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/TaskGraphScheduler.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/JackActor.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+
+namespace EMotionFX
+{
+    TEST_F(SystemComponentFixture, TaskGraphScheduler_AttachmentsUpdateAfterTheirTarget)
+    {
+        TaskGraphScheduler* scheduler = TaskGraphScheduler::Create();
+        GetEMotionFX().GetActorManager()->SetScheduler(scheduler);
+
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        ActorInstance* actorInstanceA = ActorInstance::Create(actor.get());
+        ActorInstance* actorInstanceB = ActorInstance::Create(actor.get());
+        ActorInstance* actorInstanceC = ActorInstance::Create(actor.get());
+        ASSERT_EQ(scheduler->GetActorInstances().size(), 3);
+        EXPECT_EQ(scheduler->GetNumDependencies(), 0) << "Actor instances without attachments shouldn't wait on each other.";
+
+        // Attach A to C, so A has to be updated after C.
+        actorInstanceC->AddAttachment(AttachmentNode::Create(actorInstanceC, 0, actorInstanceA));
+        const AZStd::vector<ActorInstance*>& actorInstances = scheduler->GetActorInstances();
+        ASSERT_EQ(actorInstances.size(), 3);
+        const auto attachmentIt = AZStd::find(actorInstances.begin(), actorInstances.end(), actorInstanceA);
+        const auto targetIt = AZStd::find(actorInstances.begin(), actorInstances.end(), actorInstanceC);
+        EXPECT_LT(targetIt, attachmentIt) << "The attachment should come after the actor instance it is attached to.";
+        EXPECT_EQ(scheduler->GetNumDependencies(), 1);
+
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetNumUpdatedActorInstances(), 3);
+
+        // Destroying the attachment removes it from the schedule, along with the dependency.
+        actorInstanceA->Destroy();
+        EXPECT_EQ(scheduler->GetActorInstances().size(), 2);
+        EXPECT_EQ(scheduler->GetNumDependencies(), 0);
+
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetNumUpdatedActorInstances(), 2);
+
+        actorInstanceB->Destroy();
+        actorInstanceC->Destroy();
+        EXPECT_TRUE(scheduler->GetActorInstances().empty());
+    }
+} // namespace EMotionFX
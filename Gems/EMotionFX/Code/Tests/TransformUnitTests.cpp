@@ -20,6 +20,7 @@
 #include <MCore/Source/AzCoreConversions.h>
 #include <EMotionFX/Source/PlayBackInfo.h>
 
+#include <EMotionFX/Source/PoseBlendKernels.h>
 #include <EMotionFX/Source/Transform.h>
 
 #if defined(EMFX_SCALE_DISABLED)
@@ -861,6 +862,43 @@ namespace EMotionFX
         );
     }
 
+    TEST_F(TwoTransformsFixture, PoseBlendKernelsBlend)
+    {
+        // The second pair of rotations lies in opposite hemispheres, so the blend has to go along the shortest arc
+        const Transform transforms[] = { Transform(m_translationA, m_rotationA, m_scaleA), Transform(m_translationA, -m_rotationA, m_scaleA) };
+        const Transform destTransforms[] = { Transform(m_translationB, m_rotationB, m_scaleB), Transform(m_translationB, m_rotationB, m_scaleB) };
+        const AZStd::vector<uint16> nodeIndices = { 1 };
+
+        for (const float weight : { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f })
+        {
+            Transform blendedTransforms[] = { transforms[0], transforms[1] };
+            PoseBlendKernels::Blend(blendedTransforms, destTransforms, 2, weight);
+            EXPECT_THAT(blendedTransforms[0], IsClose(Transform(transforms[0]).Blend(destTransforms[0], weight)));
+            EXPECT_THAT(blendedTransforms[1], IsClose(Transform(transforms[1]).Blend(destTransforms[1], weight)));
+
+            Transform maskedTransforms[] = { transforms[0], transforms[1] };
+            PoseBlendKernels::Blend(maskedTransforms, destTransforms, nodeIndices, weight);
+            EXPECT_THAT(maskedTransforms[0], IsClose(transforms[0]));
+            EXPECT_THAT(maskedTransforms[1], IsClose(blendedTransforms[1]));
+        }
+    }
+
+    TEST_F(TwoTransformsFixture, PoseBlendKernelsApplyAdditive)
+    {
+        // Pose::ApplyAdditive pre-multiplies the additive rotation, unlike Transform::ApplyAdditive
+        const AZ::Quaternion additiveRotation = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3::CreateAxisY(), AZ::Constants::HalfPi);
+        const Transform additiveTransform(m_translationB, additiveRotation, m_scaleB);
+        for (const float weight : { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f })
+        {
+            Transform transform(m_translationA, m_rotationA, m_scaleA);
+            PoseBlendKernels::ApplyAdditive(&transform, &additiveTransform, 1, weight);
+            EXPECT_THAT(transform, IsClose(Transform(
+                m_translationA + m_translationB * weight,
+                m_rotationA.NLerp(additiveRotation * m_rotationA, weight),
+                m_scaleA * AZ::Vector3::CreateOne().Lerp(m_scaleB, weight))));
+        }
+    }
+
     TEST_F(TwoTransformsFixture, AddTransform)
     {
         EXPECT_THAT(
@@ -78,6 +78,7 @@ set(FILES
     Tests/BlendTreeTwoLinkIKNodeTests.cpp
     Tests/BoolLogicNodeTests.cpp
     Tests/ColliderCommandTests.cpp
+    Tests/CompressedJointSamplesTests.cpp
     Tests/EMotionFXTest.cpp
     Tests/EmotionFXMathLibTests.cpp
     Tests/EventManagerTests.cpp
@@ -112,6 +113,7 @@ set(FILES
     Tests/SyncingSystemTests.cpp
     Tests/SystemComponentFixture.h
     Tests/SystemComponentTests.cpp
+    Tests/TaskGraphSchedulerTests.cpp
     Tests/TransformUnitTests.cpp
     Tests/Vector2ToVector3CompatibilityTests.cpp
     Tests/Vector3ParameterTests.cpp
@@ -21,6 +21,7 @@
 #include <pybind11/eval.h>
 
 #include <AzCore/PlatformDef.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/JSON/rapidjson.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/RTTI/AttributeReader.h>
@@ -30,6 +31,9 @@
 
 namespace EditorPythonBindings
 {
+    AZ_CVAR(bool, py_lazyClassBindings, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Bind the static methods, constants and constructors of Behavior Context classes when their azlmbr module is first used instead of when azlmbr is imported");
+
     namespace Operator
     {
         constexpr const char s_isEqual[] = "__eq__";
@@ -766,126 +770,239 @@ namespace EditorPythonBindings
             return pybind11::cast(instance);
         }
 
-        void ExportStaticBehaviorClassElements(pybind11::module parentModule, pybind11::module defaultModule)
+        //! Adds the static methods, the constants and the constructor functions of a Behavior Class to its module.
+        //! @param subModule the module to bind the elements to, nullptr to only log the symbols
+        //! @param logSymbols broadcast the bound elements to PythonSymbolEventBus
+        static void ExportStaticBehaviorClass(
+            AZ::BehaviorClass* behaviorClass, pybind11::module* subModule, const AZStd::string& subModuleName, bool logSymbols)
         {
-            AZ::BehaviorContext* behaviorContext = nullptr;
-            AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationRequests::GetBehaviorContext);
-            AZ_Error("python", behaviorContext, "Behavior context not available");
-            if (!behaviorContext)
-            {
-                return;
-            }
-
-            // this will make the base package modules for namespace "azlmbr.*" and "azlmbr.default" for behavior that does not specify a module name
-            Module::PackageMapType modulePackageMap;
+            // early detection of instance based elements like constructors or properties
+            bool hasMemberMethods = behaviorClass->m_constructors.empty() == false;
+            bool hasMemberProperties = behaviorClass->m_properties.empty() == false;
 
-            for (const auto& classEntry : behaviorContext->m_classes)
+            // does this class define methods that may be reflected in a Python module?
+            if (!behaviorClass->m_methods.empty())
             {
-                AZ::BehaviorClass* behaviorClass = classEntry.second;
-
-                // is this Behavior Class flagged to usage for Editor.exe bindings?
-                if (!Scope::IsBehaviorFlaggedForEditor(behaviorClass->m_attributes))
+                // add the non-member methods as Python 'free' function
+                for (const auto& methodEntry : behaviorClass->m_methods)
                 {
-                    continue; // skip this class
-                }
-
-                // find the target module of the behavior's static methods
-                auto moduleName = Module::GetName(behaviorClass->m_attributes);
-                pybind11::module subModule = Module::DeterminePackageModule(modulePackageMap, moduleName ? *moduleName : "", parentModule, defaultModule, false);
-
-                // early detection of instance based elements like constructors or properties
-                bool hasMemberMethods = behaviorClass->m_constructors.empty() == false;
-                bool hasMemberProperties = behaviorClass->m_properties.empty() == false;
-
-                // does this class define methods that may be reflected in a Python module?
-                if (!behaviorClass->m_methods.empty())
-                {
-                    // add the non-member methods as Python 'free' function
-                    for (const auto& methodEntry : behaviorClass->m_methods)
+                    const AZStd::string& methodName = methodEntry.first;
+                    AZ::BehaviorMethod* behaviorMethod = methodEntry.second;
+                    if (!PythonProxyObjectManagement::IsMemberLike(*behaviorMethod, behaviorClass->m_typeId))
                     {
-                        const AZStd::string& methodName = methodEntry.first;
-                        AZ::BehaviorMethod* behaviorMethod = methodEntry.second;
-                        if (!PythonProxyObjectManagement::IsMemberLike(*behaviorMethod, behaviorClass->m_typeId))
-                        {
-                            // the name of the static method will be "azlmbr.<sub_module>.<Behavior Class>_<Behavior Method>"
-                            AZStd::string globalMethodName = AZStd::string::format("%s_%s", behaviorClass->m_name.c_str(), methodName.c_str());
+                        // the name of the static method will be "azlmbr.<sub_module>.<Behavior Class>_<Behavior Method>"
+                        AZStd::string globalMethodName = AZStd::string::format("%s_%s", behaviorClass->m_name.c_str(), methodName.c_str());
 
-                            if (behaviorMethod->HasResult())
+                        if (subModule && behaviorMethod->HasResult())
+                        {
+                            subModule->def(globalMethodName.c_str(), [behaviorMethod](pybind11::args args)
                             {
-                                subModule.def(globalMethodName.c_str(), [behaviorMethod](pybind11::args args)
-                                {
-                                    return Call::StaticMethod(behaviorMethod, args);
-                                });
-                            }
-                            else
+                                return Call::StaticMethod(behaviorMethod, args);
+                            });
+                        }
+                        else if (subModule)
+                        {
+                            subModule->def(globalMethodName.c_str(), [behaviorMethod](pybind11::args args)
                             {
-                                subModule.def(globalMethodName.c_str(), [behaviorMethod](pybind11::args args)
-                                {
-                                    Call::StaticMethod(behaviorMethod, args);
-                                });
-                            }
-
-                            AZStd::string subModuleName = pybind11::cast<AZStd::string>(subModule.attr("__name__"));
-                            PythonSymbolEventBus::QueueBroadcast(&PythonSymbolEventBus::Events::LogClassMethod, subModuleName, globalMethodName, behaviorClass, behaviorMethod);
+                                Call::StaticMethod(behaviorMethod, args);
+                            });
                         }
-                        else
+
+                        if (logSymbols)
                         {
-                            // any member method means the class should be exported to Python
-                            hasMemberMethods = true;
+                            PythonSymbolEventBus::QueueBroadcast(&PythonSymbolEventBus::Events::LogClassMethod, subModuleName, globalMethodName, behaviorClass, behaviorMethod);
                         }
                     }
+                    else
+                    {
+                        // any member method means the class should be exported to Python
+                        hasMemberMethods = true;
+                    }
                 }
+            }
+
+            // expose all the constant class properties for Python to use
+            for (const auto& propertyEntry : behaviorClass->m_properties)
+            {
+                const AZStd::string& propertyEntryName = propertyEntry.first;
+                AZ::BehaviorProperty* behaviorProperty = propertyEntry.second;
 
-                // expose all the constant class properties for Python to use
-                for (const auto& propertyEntry : behaviorClass->m_properties)
+                if (IsClassConstant(behaviorProperty))
                 {
-                    const AZStd::string& propertyEntryName = propertyEntry.first;
-                    AZ::BehaviorProperty* behaviorProperty = propertyEntry.second;
+                    // the name of the property will be "azlmbr.<Module>.<Behavior Class>_<Behavior Property>"
+                    AZStd::string constantPropertyName =
+                        AZStd::string::format("%s_%s", behaviorClass->m_name.c_str(), propertyEntryName.c_str());
 
-                    if (IsClassConstant(behaviorProperty))
+                    if (subModule)
                     {
-                        // the name of the property will be "azlmbr.<Module>.<Behavior Class>_<Behavior Property>"
-                        AZStd::string constantPropertyName =
-                            AZStd::string::format("%s_%s", behaviorClass->m_name.c_str(), propertyEntryName.c_str());
-
                         pybind11::object constantValue = Call::StaticMethod(behaviorProperty->m_getter, {});
-                        pybind11::setattr(subModule, constantPropertyName.c_str(), constantValue);
+                        pybind11::setattr(*subModule, constantPropertyName.c_str(), constantValue);
+                    }
 
-                        AZStd::string subModuleName = pybind11::cast<AZStd::string>(subModule.attr("__name__"));
+                    if (logSymbols)
+                    {
                         PythonSymbolEventBus::QueueBroadcast(&PythonSymbolEventBus::Events::LogGlobalProperty, subModuleName, constantPropertyName, behaviorProperty);
                     }
                 }
+            }
 
-                // if the Behavior Class has any properties, methods, or constructors then export it
-                const bool exportBehaviorClass = (hasMemberMethods || hasMemberProperties);
+            // if the Behavior Class has any properties, methods, or constructors then export it
+            const bool exportBehaviorClass = (hasMemberMethods || hasMemberProperties);
 
-                // register all Behavior Class types with a Python function to construct an instance
-                if (exportBehaviorClass)
+            // register all Behavior Class types with a Python function to construct an instance
+            if (exportBehaviorClass)
+            {
+                const char* behaviorClassName = behaviorClass->m_name.c_str();
+                if (subModule)
                 {
-                    const char* behaviorClassName = behaviorClass->m_name.c_str();
-                    subModule.attr(behaviorClassName) = pybind11::cpp_function([behaviorClassName](pybind11::args pythonArgs)
+                    subModule->attr(behaviorClassName) = pybind11::cpp_function([behaviorClassName](pybind11::args pythonArgs)
                     {
                         return ConstructPythonProxyObjectByTypename(behaviorClassName, pythonArgs);
                     });
+                }
 
-                    AZStd::string subModuleName = pybind11::cast<AZStd::string>(subModule.attr("__name__"));
-
-                    // register an alternative class name that passes the Python syntax
-                    auto syntaxName = Naming::GetPythonSyntax(*behaviorClass);
-                    if (syntaxName)
+                // register an alternative class name that passes the Python syntax
+                auto syntaxName = Naming::GetPythonSyntax(*behaviorClass);
+                if (syntaxName)
+                {
+                    if (subModule)
                     {
                         const char* properSyntax = syntaxName.value().c_str();
-                        subModule.attr(properSyntax) = pybind11::cpp_function([behaviorClassName](pybind11::args pythonArgs)
+                        subModule->attr(properSyntax) = pybind11::cpp_function([behaviorClassName](pybind11::args pythonArgs)
                         {
                             return ConstructPythonProxyObjectByTypename(behaviorClassName, pythonArgs);
                         });
-                        PythonSymbolEventBus::QueueBroadcast(&PythonSymbolEventBus::Events::LogClassWithName, subModuleName, behaviorClass, syntaxName.value());
                     }
-                    else
+
+                    if (logSymbols)
                     {
-                        PythonSymbolEventBus::QueueBroadcast(&PythonSymbolEventBus::Events::LogClass, subModuleName, behaviorClass);
+                        PythonSymbolEventBus::QueueBroadcast(&PythonSymbolEventBus::Events::LogClassWithName, subModuleName, behaviorClass, syntaxName.value());
                     }
                 }
+                else if (logSymbols)
+                {
+                    PythonSymbolEventBus::QueueBroadcast(&PythonSymbolEventBus::Events::LogClass, subModuleName, behaviorClass);
+                }
+            }
+        }
+
+        //! The Behavior Classes of a module that are bound the first time the module is accessed.
+        struct LazyModuleClasses final
+        {
+            AZ_CLASS_ALLOCATOR(LazyModuleClasses, AZ::SystemAllocator);
+
+            void Bind()
+            {
+                if (m_behaviorClasses.empty())
+                {
+                    return;
+                }
+
+                // swap first so an attribute access while binding doesn't bind the classes twice
+                AZStd::vector<AZ::BehaviorClass*> behaviorClasses;
+                behaviorClasses.swap(m_behaviorClasses);
+                for (AZ::BehaviorClass* behaviorClass : behaviorClasses)
+                {
+                    ExportStaticBehaviorClass(behaviorClass, &m_module, m_moduleName, false);
+                }
+            }
+
+            pybind11::module m_module;
+            AZStd::string m_moduleName;
+            AZStd::vector<AZ::BehaviorClass*> m_behaviorClasses;
+            //! A module level __getattr__ that was installed before this one, e.g. for global properties
+            pybind11::object m_previousGetAttr;
+        };
+
+        // hooks the module level __getattr__ and __dir__ (PEP 562) so the classes are bound on first use
+        static void InstallLazyModule(AZStd::shared_ptr<LazyModuleClasses> lazyModule)
+        {
+            pybind11::module& subModule = lazyModule->m_module;
+            lazyModule->m_previousGetAttr = pybind11::getattr(subModule, "__getattr__", pybind11::none());
+
+            pybind11::setattr(subModule, "__getattr__", pybind11::cpp_function([lazyModule](const char* attribute) -> pybind11::object
+            {
+                lazyModule->Bind();
+
+                pybind11::dict moduleDict = lazyModule->m_module.attr("__dict__");
+                if (moduleDict.contains(attribute))
+                {
+                    return moduleDict[attribute];
+                }
+
+                if (!lazyModule->m_previousGetAttr.is_none())
+                {
+                    return lazyModule->m_previousGetAttr(attribute);
+                }
+
+                throw pybind11::attribute_error(AZStd::string::format(
+                    "module '%s' has no attribute '%s'", lazyModule->m_moduleName.c_str(), attribute).c_str());
+            }));
+
+            pybind11::setattr(subModule, "__dir__", pybind11::cpp_function([lazyModule]()
+            {
+                lazyModule->Bind();
+
+                pybind11::list attributes;
+                for (auto&& item : pybind11::dict(lazyModule->m_module.attr("__dict__")))
+                {
+                    attributes.append(item.first);
+                }
+                return attributes;
+            }));
+        }
+
+        void ExportStaticBehaviorClassElements(pybind11::module parentModule, pybind11::module defaultModule)
+        {
+            AZ::BehaviorContext* behaviorContext = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationRequests::GetBehaviorContext);
+            AZ_Error("python", behaviorContext, "Behavior context not available");
+            if (!behaviorContext)
+            {
+                return;
+            }
+
+            // this will make the base package modules for namespace "azlmbr.*" and "azlmbr.default" for behavior that does not specify a module name
+            Module::PackageMapType modulePackageMap;
+            AZStd::unordered_map<AZStd::string, AZStd::shared_ptr<LazyModuleClasses>> lazyModules;
+
+            for (const auto& classEntry : behaviorContext->m_classes)
+            {
+                AZ::BehaviorClass* behaviorClass = classEntry.second;
+
+                // is this Behavior Class flagged to usage for Editor.exe bindings?
+                if (!Scope::IsBehaviorFlaggedForEditor(behaviorClass->m_attributes))
+                {
+                    continue; // skip this class
+                }
+
+                // find the target module of the behavior's static methods
+                auto moduleName = Module::GetName(behaviorClass->m_attributes);
+                pybind11::module subModule = Module::DeterminePackageModule(modulePackageMap, moduleName ? *moduleName : "", parentModule, defaultModule, false);
+                AZStd::string subModuleName = pybind11::cast<AZStd::string>(subModule.attr("__name__"));
+
+                if (!py_lazyClassBindings)
+                {
+                    ExportStaticBehaviorClass(behaviorClass, &subModule, subModuleName, true);
+                    continue;
+                }
+
+                // the symbols are still logged for every class so the generated stubs stay complete
+                ExportStaticBehaviorClass(behaviorClass, nullptr, subModuleName, true);
+
+                auto& lazyModule = lazyModules[subModuleName];
+                if (!lazyModule)
+                {
+                    lazyModule = AZStd::make_shared<LazyModuleClasses>();
+                    lazyModule->m_module = subModule;
+                    lazyModule->m_moduleName = subModuleName;
+                }
+                lazyModule->m_behaviorClasses.push_back(behaviorClass);
+            }
+
+            for (auto& lazyModule : lazyModules)
+            {
+                InstallLazyModule(lazyModule.second);
             }
         }
 
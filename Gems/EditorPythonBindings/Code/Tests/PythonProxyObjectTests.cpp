@@ -1341,6 +1341,63 @@ namespace UnitTest
         EXPECT_EQ(7, m_testSink.m_evaluationMap[aznumeric_cast<int>(LogTypes::Found)]);
     }
 
+    TEST_F(PythonObjectProxyTests, ModuleClassesBoundOnFirstUse)
+    {
+        enum class LogTypes
+        {
+            Skip = 0,
+            Found
+        };
+
+        m_testSink.m_evaluateMessage = [](const char* window, const char* message) -> int
+        {
+            if (AzFramework::StringFunc::Equal(window, "python"))
+            {
+                if (AzFramework::StringFunc::StartsWith(message, "Found"))
+                {
+                    return aznumeric_cast<int>(LogTypes::Found);
+                }
+            }
+            return aznumeric_cast<int>(LogTypes::Skip);
+        };
+
+        PythonReflectionObjectProxyTester pythonReflectionObjectProxyTester;
+        pythonReflectionObjectProxyTester.Reflect(m_app.GetBehaviorContext());
+
+        AZ::Entity e;
+        Activate(e);
+
+        SimulateEditorBecomingInitialized();
+
+        try
+        {
+            pybind11::exec(R"(
+                import azlmbr.test.proxy
+
+                if 'TestObject' in dir(azlmbr.test.proxy):
+                    print ('Found_TestObject_in_dir')
+
+                from azlmbr.test.proxy import TestObject
+                if TestObject() is not None:
+                    print ('Found_TestObject_by_import')
+
+                try:
+                    azlmbr.test.proxy.NotABehaviorClass
+                except AttributeError:
+                    print ('Found_AttributeError')
+            )");
+        }
+        catch ([[maybe_unused]] const std::exception& e)
+        {
+            AZ_Warning("UnitTest", false, "Failed on with Python exception: %s", e.what());
+            FAIL();
+        }
+
+        e.Deactivate();
+
+        EXPECT_EQ(3, m_testSink.m_evaluationMap[aznumeric_cast<int>(LogTypes::Found)]);
+    }
+
     TEST_F(PythonObjectProxyTests, EnumsAreFound)
     {
         enum class LogTypes
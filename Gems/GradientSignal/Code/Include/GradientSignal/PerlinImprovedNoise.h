@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/std/containers/span.h>
+#include <AzCore/Math/Vector3.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h>
 
@@ -37,6 +38,14 @@ namespace GradientSignal
         */
         float GenerateOctaveNoise(float x, float y, float z, int octaves, float persistence, float initialFrequency = 1.0f);
 
+        /**
+        * Creates Perlin 'natural' noise factor values for a list of positions with the same smoothing parameters.
+        * The results match GenerateOctaveNoise() for each position, but four positions get evaluated at a time with SIMD math.
+        */
+        void GenerateOctaveNoise(
+            AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, int octaves, float persistence,
+            float initialFrequency = 1.0f);
+
         /**
         * Creates a Perlin noise factor value based on a position
         */
@@ -15,6 +15,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/vector.h>
 #include <LmbrCentral/Dependency/DependencyNotificationBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 
@@ -215,22 +216,19 @@ namespace GradientSignal
             return;
         }
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
-
         AZStd::shared_lock lock(m_queryMutex);
 
+        // Transform all positions first, so that the noise can be evaluated for the whole list at once.
+        AZStd::vector<AZ::Vector3> uvws(positions.size());
+        AZStd::vector<bool> wasPointRejected(positions.size());
+        m_gradientTransform.TransformPositionsToUVW(positions, uvws, wasPointRejected);
+
+        m_perlinImprovedNoise->GenerateOctaveNoise(
+            uvws, outValues, m_configuration.m_octave, m_configuration.m_amplitude, m_configuration.m_frequency);
+
         for (size_t index = 0; index < positions.size(); index++)
         {
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
-
-            if (!wasPointRejected)
-            {
-                outValues[index] = m_perlinImprovedNoise->GenerateOctaveNoise(
-                    uvw.GetX(), uvw.GetY(), uvw.GetZ(), m_configuration.m_octave, m_configuration.m_amplitude,
-                    m_configuration.m_frequency);
-            }
-            else
+            if (wasPointRejected[index])
             {
                 outValues[index] = 0.0f;
             }
@@ -8,6 +8,7 @@
 
 
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
 #include <GradientSignal/GradientTransform.h>
 
 
@@ -112,6 +113,90 @@ namespace GradientSignal
         TransformLocalPositionToUVWNormalized(inLocalPosition, outUVW, wasPointRejected);
     }
 
+    void GradientTransform::TransformPositionsToLocalUVW(
+        AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const
+    {
+        // This is the list version of TransformPositionToUVW(). Each step runs as a separate pass over the whole list so that the
+        // wrapping type only gets checked once, and the loops only contain straight-line vector math.
+        for (size_t index = 0; index < inPositions.size(); index++)
+        {
+            outUVWs[index] = m_inverseTransform * inPositions[index];
+        }
+
+        if (m_alwaysAcceptPoint)
+        {
+            AZStd::fill(wasPointRejected.begin(), wasPointRejected.end(), false);
+        }
+        else
+        {
+            // Same [min, max) range check as in TransformLocalPositionToUVW().
+            const AZ::Vector3 boundsMin = m_shapeBounds.GetMin();
+            const AZ::Vector3 boundsMax = m_shapeBounds.GetMax();
+            for (size_t index = 0; index < outUVWs.size(); index++)
+            {
+                wasPointRejected[index] = !(outUVWs[index].IsGreaterEqualThan(boundsMin) && outUVWs[index].IsLessThan(boundsMax));
+            }
+        }
+
+        auto applyWrapping = [this, outUVWs](auto wrapFunction)
+        {
+            for (AZ::Vector3& uvw : outUVWs)
+            {
+                uvw = wrapFunction(uvw, m_shapeBounds) * m_frequencyZoom;
+            }
+        };
+
+        switch (m_wrappingType)
+        {
+        default:
+        case WrappingType::None:
+            applyWrapping(GetUnboundedPointInAabb);
+            break;
+        case WrappingType::ClampToEdge:
+        case WrappingType::ClampToZero:
+            applyWrapping(GetClampedPointInAabb);
+            break;
+        case WrappingType::Mirror:
+            applyWrapping(GetMirroredPointInAabb);
+            break;
+        case WrappingType::Repeat:
+            applyWrapping(GetWrappedPointInAabb);
+            break;
+        }
+    }
+
+    void GradientTransform::TransformPositionsToUVW(
+        AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const
+    {
+        if ((inPositions.size() != outUVWs.size()) || (inPositions.size() != wasPointRejected.size()))
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu vs %zu).",
+                inPositions.size(), outUVWs.size(), wasPointRejected.size());
+            return;
+        }
+
+        TransformPositionsToLocalUVW(inPositions, outUVWs, wasPointRejected);
+    }
+
+    void GradientTransform::TransformPositionsToUVWNormalized(
+        AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const
+    {
+        if ((inPositions.size() != outUVWs.size()) || (inPositions.size() != wasPointRejected.size()))
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu vs %zu).",
+                inPositions.size(), outUVWs.size(), wasPointRejected.size());
+            return;
+        }
+
+        TransformPositionsToLocalUVW(inPositions, outUVWs, wasPointRejected);
+
+        const AZ::Vector3 boundsMin = m_shapeBounds.GetMin();
+        for (AZ::Vector3& uvw : outUVWs)
+        {
+            uvw = m_normalizeExtentsReciprocal * (uvw - boundsMin);
+        }
+    }
+
     WrappingType GradientTransform::GetWrappingType() const
     {
         return m_wrappingType;
@@ -9,6 +9,8 @@
 
 #include <GradientSignal/PerlinImprovedNoise.h>
 
+#include <AzCore/Math/SimdMath.h>
+
 #include <numeric>
 #include <random> // std::mt19937 std::random_device
 
@@ -60,6 +62,93 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+        // The SIMD versions below evaluate four positions at once. They intentionally avoid fused multiply-adds, so they produce
+        // exactly the same values as the scalar functions above.
+        using AZ::Simd::Vec4;
+
+        AZ_FORCE_INLINE Vec4::FloatType Gradient(Vec4::Int32ArgType hash, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            // Branchless form of the switch in the scalar Gradient() function:
+            // u = (h < 8) ? x : y
+            // v = (h < 4) ? y : ((h == 12 || h == 14) ? x : z)
+            // result = ((h & 1) ? -u : u) + ((h & 2) ? -v : v)
+            const Vec4::Int32Type h = Vec4::And(hash, Vec4::Splat(0xF));
+            const Vec4::FloatType u = Vec4::Select(x, y, Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(8))));
+            const Vec4::Int32Type useX = Vec4::Or(Vec4::CmpEq(h, Vec4::Splat(12)), Vec4::CmpEq(h, Vec4::Splat(14)));
+            const Vec4::FloatType v = Vec4::Select(y, Vec4::Select(x, z, Vec4::CastToFloat(useX)), Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(4))));
+
+            const Vec4::FloatType signBit = Vec4::Splat(-0.0f);
+            const Vec4::FloatType negateU = Vec4::And(Vec4::CastToFloat(Vec4::CmpEq(Vec4::And(h, Vec4::Splat(1)), Vec4::Splat(1))), signBit);
+            const Vec4::FloatType negateV = Vec4::And(Vec4::CastToFloat(Vec4::CmpEq(Vec4::And(h, Vec4::Splat(2)), Vec4::Splat(2))), signBit);
+            return Vec4::Add(Vec4::Xor(u, negateU), Vec4::Xor(v, negateV));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Fade(Vec4::FloatArgType t)
+        {
+            const Vec4::FloatType inner = Vec4::Add(Vec4::Mul(t, Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f))), Vec4::Splat(10.0f));
+            return Vec4::Mul(Vec4::Mul(Vec4::Mul(t, t), t), inner);
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Lerp(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType x)
+        {
+            return Vec4::Add(a, Vec4::Mul(x, Vec4::Sub(b, a)));
+        }
+
+        Vec4::FloatType GenerateNoise(const AZStd::array<int, 512>& p, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            const Vec4::FloatType floorX = Vec4::Floor(x);
+            const Vec4::FloatType floorY = Vec4::Floor(y);
+            const Vec4::FloatType floorZ = Vec4::Floor(z);
+            const Vec4::FloatType xf = Vec4::Sub(x, floorX);
+            const Vec4::FloatType yf = Vec4::Sub(y, floorY);
+            const Vec4::FloatType zf = Vec4::Sub(z, floorZ);
+            const Vec4::FloatType u = Fade(xf);
+            const Vec4::FloatType v = Fade(yf);
+            const Vec4::FloatType w = Fade(zf);
+
+            alignas(16) int32_t xi0[4];
+            alignas(16) int32_t yi0[4];
+            alignas(16) int32_t zi0[4];
+            const Vec4::Int32Type mask = Vec4::Splat(255);
+            Vec4::StoreAligned(xi0, Vec4::And(Vec4::ConvertToInt(floorX), mask));
+            Vec4::StoreAligned(yi0, Vec4::And(Vec4::ConvertToInt(floorY), mask));
+            Vec4::StoreAligned(zi0, Vec4::And(Vec4::ConvertToInt(floorZ), mask));
+
+            // There is no gather instruction on all supported platforms, so the permutation table lookups are done per lane.
+            alignas(16) int32_t aaa[4], aba[4], aab[4], abb[4], baa[4], bba[4], bab[4], bbb[4];
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                const int a = p[xi0[lane]];
+                const int b = p[xi0[lane] + 1];
+                const int aa = p[a + yi0[lane]];
+                const int ab = p[a + yi0[lane] + 1];
+                const int ba = p[b + yi0[lane]];
+                const int bb = p[b + yi0[lane] + 1];
+                aaa[lane] = p[aa + zi0[lane]];
+                aba[lane] = p[ab + zi0[lane]];
+                aab[lane] = p[aa + zi0[lane] + 1];
+                abb[lane] = p[ab + zi0[lane] + 1];
+                baa[lane] = p[ba + zi0[lane]];
+                bba[lane] = p[bb + zi0[lane]];
+                bab[lane] = p[ba + zi0[lane] + 1];
+                bbb[lane] = p[bb + zi0[lane] + 1];
+            }
+
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType xf1 = Vec4::Sub(xf, one);
+            const Vec4::FloatType yf1 = Vec4::Sub(yf, one);
+            const Vec4::FloatType zf1 = Vec4::Sub(zf, one);
+
+            Vec4::FloatType x1 = Lerp(Gradient(Vec4::LoadAligned(aaa), xf, yf, zf), Gradient(Vec4::LoadAligned(baa), xf1, yf, zf), u);
+            Vec4::FloatType x2 = Lerp(Gradient(Vec4::LoadAligned(aba), xf, yf1, zf), Gradient(Vec4::LoadAligned(bba), xf1, yf1, zf), u);
+            const Vec4::FloatType y1 = Lerp(x1, x2, v);
+            x1 = Lerp(Gradient(Vec4::LoadAligned(aab), xf, yf, zf1), Gradient(Vec4::LoadAligned(bab), xf1, yf, zf1), u);
+            x2 = Lerp(Gradient(Vec4::LoadAligned(abb), xf, yf1, zf1), Gradient(Vec4::LoadAligned(bbb), xf1, yf1, zf1), u);
+            const Vec4::FloatType y2 = Lerp(x1, x2, v);
+
+            return Vec4::Div(Vec4::Add(Lerp(y1, y2, w), one), Vec4::Splat(2.0f));
+        }
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -92,6 +181,64 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoise(
+        AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, int octaves, float persistence, float initialFrequency)
+    {
+        using AZ::Simd::Vec4;
+
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        float maxValue = 0.0f;
+        float amplitude = 1.0f;
+        for (int i = 0; i < octaves; ++i)
+        {
+            maxValue += amplitude;
+            amplitude *= persistence;
+        }
+        if (maxValue <= 0.0f)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        const Vec4::FloatType maxValueSplat = Vec4::Splat(maxValue);
+        size_t index = 0;
+        for (; index + 4 <= positions.size(); index += 4)
+        {
+            const Vec4::FloatType x = Vec4::LoadImmediate(
+                positions[index].GetX(), positions[index + 1].GetX(), positions[index + 2].GetX(), positions[index + 3].GetX());
+            const Vec4::FloatType y = Vec4::LoadImmediate(
+                positions[index].GetY(), positions[index + 1].GetY(), positions[index + 2].GetY(), positions[index + 3].GetY());
+            const Vec4::FloatType z = Vec4::LoadImmediate(
+                positions[index].GetZ(), positions[index + 1].GetZ(), positions[index + 2].GetZ(), positions[index + 3].GetZ());
+
+            Vec4::FloatType total = Vec4::ZeroFloat();
+            float frequency = initialFrequency;
+            amplitude = 1.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                const Vec4::FloatType frequencySplat = Vec4::Splat(frequency);
+                const Vec4::FloatType noise = PerlinImprovedNoiseDetails::GenerateNoise(
+                    m_permutationTable, Vec4::Mul(x, frequencySplat), Vec4::Mul(y, frequencySplat), Vec4::Mul(z, frequencySplat));
+                total = Vec4::Add(total, Vec4::Mul(noise, Vec4::Splat(amplitude)));
+                amplitude *= persistence;
+                frequency *= 2.0f;
+            }
+
+            Vec4::StoreUnaligned(&outValues[index], Vec4::Div(total, maxValueSplat));
+        }
+
+        for (; index < positions.size(); ++index)
+        {
+            outValues[index] = GenerateOctaveNoise(
+                positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), octaves, persistence, initialFrequency);
+        }
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
@@ -219,6 +219,38 @@ namespace UnitTest
         TestFixedDataSampler(expectedOutput, dataSize, entity->GetId());
     }
 
+    TEST_F(GradientSignalTestGeneratorFixture, PerlinImprovedNoise_BulkNoiseMatchesSingleNoise)
+    {
+        // Make sure the SIMD list version of GenerateOctaveNoise produces the same values as the per-position version,
+        // including negative positions and a list size that isn't a multiple of the SIMD width.
+
+        GradientSignal::PerlinImprovedNoise perlinNoise(1234);
+        constexpr int octaves = 4;
+        constexpr float persistence = 0.6f;
+        constexpr float frequency = 1.13f;
+
+        AZStd::vector<AZ::Vector3> positions;
+        for (float y = -3.75f; y < 3.0f; y += 0.625f)
+        {
+            for (float x = -5.5f; x < 4.0f; x += 0.375f)
+            {
+                positions.emplace_back(x, y, x * 0.25f - y);
+            }
+        }
+        positions.emplace_back(0.0f);
+        EXPECT_NE(positions.size() % 4, 0);
+
+        AZStd::vector<float> bulkValues(positions.size());
+        perlinNoise.GenerateOctaveNoise(positions, bulkValues, octaves, persistence, frequency);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const float expectedValue = perlinNoise.GenerateOctaveNoise(
+                positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), octaves, persistence, frequency);
+            EXPECT_NEAR(bulkValues[index], expectedValue, 1.0e-6f);
+        }
+    }
+
     TEST_F(GradientSignalTestGeneratorFixture, RandomGradientComponent_GoldenTest)
     {
         // Make sure RandomGradientComponent returns back a "golden" set
@@ -55,6 +55,19 @@ namespace UnitTest
             EXPECT_THAT(outUVW, IsClose(test.m_expectedOutputUVW));
             EXPECT_EQ(wasPointRejected, test.m_expectedOutputRejectionResult);
 
+            // The list versions of the queries should produce the same results as the single position versions.
+            AZStd::vector<AZ::Vector3> inPositions = { test.m_positionToTest };
+            AZStd::vector<AZ::Vector3> outUVWs(inPositions.size());
+            AZStd::vector<bool> outWasPointRejected(inPositions.size());
+            gradientTransform3d.TransformPositionsToUVW(inPositions, outUVWs, outWasPointRejected);
+            EXPECT_THAT(outUVWs[0], IsClose(test.m_expectedOutputUVW));
+            EXPECT_EQ(outWasPointRejected[0], test.m_expectedOutputRejectionResult);
+
+            gradientTransform3d.TransformPositionToUVWNormalized(test.m_positionToTest, outUVW, wasPointRejected);
+            gradientTransform3d.TransformPositionsToUVWNormalized(inPositions, outUVWs, outWasPointRejected);
+            EXPECT_THAT(outUVWs[0], IsClose(outUVW));
+            EXPECT_EQ(outWasPointRejected[0], wasPointRejected);
+
             // Perform the query with a 2D gradient and verify that the results match, but always returns a W value of 0.
             GradientSignal::GradientTransform gradientTransform2d(shapeBounds, transform, false, frequencyZoom, wrappingType);
             gradientTransform2d.TransformPositionToUVW(test.m_positionToTest, outUVW, wasPointRejected);
@@ -226,6 +226,19 @@ namespace GraphCanvas
         setPen(currentPen);
     }
 
+    bool ConnectionGraphicsItem::PathInputs::operator==(const PathInputs& other) const
+    {
+        return m_start == other.m_start
+            && m_end == other.m_end
+            && m_startJutDirection == other.m_startJutDirection
+            && m_endJutDirection == other.m_endJutDirection
+            && m_loopbackNodePosition == other.m_loopbackNodePosition
+            && m_loopbackNodeHeight == other.m_loopbackNodeHeight
+            && m_connectionJut == other.m_connectionJut
+            && m_curveType == other.m_curveType
+            && m_loopback == other.m_loopback;
+    }
+
     QRectF ConnectionGraphicsItem::GetBoundingRect() const
     {
         return boundingRect();
@@ -295,6 +308,16 @@ namespace GraphCanvas
 
     void ConnectionGraphicsItem::OnSystemTick()
     {
+        // Offscreen or simplified connections aren't drawn with their dash pattern, so moving it would only queue
+        // repaints for nothing. The animation picks up again once the connection is painted.
+        if (!m_animationPainted)
+        {
+            auto currentDuration = AZStd::chrono::steady_clock::now().time_since_epoch();
+            m_lastUpdate = AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(currentDuration);
+            return;
+        }
+
+        m_animationPainted = false;
         UpdateOffset();
     }
 
@@ -372,8 +395,28 @@ namespace GraphCanvas
             }
         }
 
-        ConnectionType connectionType = ConnectionType::CT_Invalid;
-        SlotRequestBus::EventResult(connectionType, sourceId, &SlotRequests::GetConnectionType);
+        float connectionJut = m_style.GetAttribute(Styling::Attribute::ConnectionJut, 0.0f);
+
+        PathInputs pathInputs;
+        pathInputs.m_start = start;
+        pathInputs.m_end = end;
+        pathInputs.m_startJutDirection = startJutDirection;
+        pathInputs.m_endJutDirection = endJutDirection;
+        pathInputs.m_loopbackNodePosition = nodePos;
+        pathInputs.m_loopbackNodeHeight = nodeHeight;
+        pathInputs.m_connectionJut = connectionJut;
+        pathInputs.m_curveType = m_curveType;
+        pathInputs.m_loopback = loopback;
+
+        // A moving node notifies every connection once per slot, rebuilding an unchanged path would still
+        // reindex the item in the scene and repaint it.
+        if (m_hasPath && pathInputs == m_pathInputs)
+        {
+            return;
+        }
+
+        m_pathInputs = pathInputs;
+        m_hasPath = true;
 
         QPainterPath path = QPainterPath(start);
 
@@ -417,8 +460,6 @@ namespace GraphCanvas
         }
         else
         {
-            float connectionJut = m_style.GetAttribute(Styling::Attribute::ConnectionJut, 0.0f);
-
             QPointF startOffset = start + startJutDirection * connectionJut;
             QPointF endOffset = end + endJutDirection * connectionJut;
             path.lineTo(startOffset);
@@ -475,11 +516,14 @@ namespace GraphCanvas
         AssetEditorSettingsNotificationBus::Handler::BusDisconnect();
         AssetEditorSettingsNotificationBus::Handler::BusConnect(m_editorId);
 
-        UpdateCurveStyle();
+        OnSettingsChanged();
     }
 
     void ConnectionGraphicsItem::OnSettingsChanged()
     {
+        m_simplifiedRenderingZoom = 0.0f;
+        AssetEditorSettingsRequestBus::EventResult(m_simplifiedRenderingZoom, GetEditorId(), &AssetEditorSettingsRequests::GetSimplifiedRenderingZoom);
+
         UpdateCurveStyle();
     }
 
@@ -669,6 +713,23 @@ namespace GraphCanvas
     void ConnectionGraphicsItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget /*= nullptr*/)
     {
         GRAPH_CANVAS_DETAILED_PROFILE_FUNCTION();
+
+        // Zoomed out, a solid aliased line is much cheaper to rasterize than an antialiased dashed curve
+        // and looks the same at that size.
+        if (option->levelOfDetailFromTransform(painter->worldTransform()) < m_simplifiedRenderingZoom)
+        {
+            QPen simplifiedPen = pen();
+            simplifiedPen.setStyle(Qt::SolidLine);
+
+            painter->setRenderHint(QPainter::Antialiasing, false);
+            painter->setPen(simplifiedPen);
+            painter->setBrush(Qt::NoBrush);
+            painter->drawPath(path());
+            return;
+        }
+
+        m_animationPainted = true;
+
         bool showDefaultSelector = m_style.GetAttribute(Styling::Attribute::ConnectionDefaultMarquee, false);
         if (!showDefaultSelector)
         {
@@ -224,6 +224,31 @@ namespace GraphCanvas
         AZStd::chrono::milliseconds m_lastUpdate;
         double m_offset;
 
+        // Set when the connection was drawn with its dash pattern since the last tick, the animation is paused otherwise.
+        bool m_animationPainted = false;
+
+        // Below this level of detail the connection is drawn as a plain aliased line.
+        float m_simplifiedRenderingZoom = 0.0f;
+
+        // Inputs of the last path, so slot move notifications that don't change the endpoints don't rebuild it.
+        struct PathInputs
+        {
+            bool operator==(const PathInputs& other) const;
+
+            QPointF m_start;
+            QPointF m_end;
+            QPointF m_startJutDirection;
+            QPointF m_endJutDirection;
+            AZ::Vector2 m_loopbackNodePosition = AZ::Vector2::CreateZero();
+            float m_loopbackNodeHeight = 0.0f;
+            float m_connectionJut = 0.0f;
+            Styling::ConnectionCurveType m_curveType = Styling::ConnectionCurveType::Straight;
+            bool m_loopback = false;
+        };
+
+        PathInputs m_pathInputs;
+        bool m_hasPath = false;
+
         AZ::EntityId m_connectionEntityId;
         EditorId     m_editorId;
     };
@@ -123,6 +123,44 @@ namespace GraphCanvas
         return path;
     }
 
+    void GeneralNodeFrameGraphicsWidget::SetSimplifiedRendering(bool simplified)
+    {
+        // Wrapped nodes are children of their wrapper, which fades them out along with the rest of its content.
+        if (m_isWrapped || m_isSimplified == simplified)
+        {
+            return;
+        }
+
+        m_isSimplified = simplified;
+
+        // Fully transparent items are skipped by the scene when drawing, so only the frame itself is painted. Hiding the
+        // children instead would collapse them in the layout and resize the node.
+        if (simplified)
+        {
+            for (QGraphicsItem* childItem : childItems())
+            {
+                m_simplifiedChildOpacity[childItem] = childItem->opacity();
+                childItem->setOpacity(0.0);
+            }
+        }
+        else
+        {
+            // Only restore the items that are still children, the others may have been deleted in the meantime.
+            for (QGraphicsItem* childItem : childItems())
+            {
+                auto opacityIter = m_simplifiedChildOpacity.find(childItem);
+                if (opacityIter != m_simplifiedChildOpacity.end())
+                {
+                    childItem->setOpacity(opacityIter->second);
+                }
+            }
+
+            m_simplifiedChildOpacity.clear();
+        }
+
+        update();
+    }
+
     void GeneralNodeFrameGraphicsWidget::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
     {
         GRAPH_CANVAS_DETAILED_PROFILE_FUNCTION();
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/PlatformDef.h>
+#include <AzCore/std/containers/unordered_map.h>
 
 AZ_PUSH_DISABLE_WARNING(4251 4800 4244, "-Wunknown-warning-option")
 #include <QGraphicsWidget>
@@ -100,8 +101,18 @@ namespace GraphCanvas
         QPainterPath GetOutline() const override;
         ////
 
+        // NodeUIRequestBus
+        void SetSimplifiedRendering(bool simplified) override;
+        ////
+
         // QGraphicsWidget
         void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget = nullptr) override;
         ////
+
+    private:
+        bool m_isSimplified = false;
+
+        // Opacity of the child items that were faded out while the node is simplified.
+        AZStd::unordered_map<QGraphicsItem*, qreal> m_simplifiedChildOpacity;
     };
 }
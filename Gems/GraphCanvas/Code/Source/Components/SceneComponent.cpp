@@ -1633,6 +1633,12 @@ namespace GraphCanvas
             m_graphData.m_nodes.emplace(nodeEntity);
 
             AddSceneMember(nodeId, true, position);
+
+            if (m_simplifiedRendering)
+            {
+                NodeUIRequestBus::Event(nodeId, &NodeUIRequests::SetSimplifiedRendering, true);
+            }
+
             SceneNotificationBus::Event(GetEntityId(), &SceneNotifications::OnNodeAdded, nodeId, isPaste);
 
             m_mimeDelegateSceneHelper.SignalNodeCreated(nodeId);
@@ -3101,6 +3107,10 @@ namespace GraphCanvas
             
             ViewNotificationBus::Handler::BusConnect(m_viewId);
             ViewRequestBus::Event(m_viewId, &ViewRequests::SetViewParams, m_viewParams);
+
+            qreal zoomLevel = 1.0;
+            ViewRequestBus::EventResult(zoomLevel, m_viewId, &ViewRequests::GetZoomLevel);
+            OnZoomChanged(zoomLevel);
         }
         else
         {
@@ -3805,7 +3815,27 @@ namespace GraphCanvas
         m_viewParams = viewParams;
     }
 
-    void SceneComponent::AddDelegate(const AZ::EntityId& delegateId)
+    void SceneComponent::OnZoomChanged(qreal zoomLevel)
+    {
+        float simplifiedRenderingZoom = 0.0f;
+        AssetEditorSettingsRequestBus::EventResult(simplifiedRenderingZoom, GetEditorId(), &AssetEditorSettingsRequests::GetSimplifiedRenderingZoom);
+
+        // Only the crossing of the threshold is forwarded, so zooming doesn't touch every node in the graph.
+        bool simplifiedRendering = zoomLevel < simplifiedRenderingZoom;
+
+        if (simplifiedRendering != m_simplifiedRendering)
+        {
+            GRAPH_CANVAS_DETAILED_PROFILE_FUNCTION();
+            m_simplifiedRendering = simplifiedRendering;
+
+            for (AZ::Entity* nodeEntity : m_graphData.m_nodes)
+            {
+                NodeUIRequestBus::Event(nodeEntity->GetId(), &NodeUIRequests::SetSimplifiedRendering, m_simplifiedRendering);
+            }
+        }
+    }
+
+        void SceneComponent::AddDelegate(const AZ::EntityId& delegateId)
     {
         m_delegates.insert(delegateId);
     }
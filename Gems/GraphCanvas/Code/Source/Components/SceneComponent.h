@@ -517,6 +517,7 @@ namespace GraphCanvas
         // ViewNotificationBus
         void OnEscape() override;
         void OnViewParamsChanged(const ViewParams& viewParams) override;
+        void OnZoomChanged(qreal zoomLevel) override;
         ////
 
         // MimeDelegateRequestBus
@@ -600,6 +601,9 @@ namespace GraphCanvas
         ViewId m_viewId;
         ViewParams m_viewParams;
 
+        // Whether the view is zoomed out far enough for the nodes to be drawn simplified.
+        bool m_simplifiedRendering = false;
+
         MimeDelegateSceneHelper m_mimeDelegateSceneHelper;
         GestureSceneHelper m_gestureSceneHelper;        
 
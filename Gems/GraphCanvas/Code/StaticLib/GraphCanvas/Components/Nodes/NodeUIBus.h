@@ -35,6 +35,10 @@ namespace GraphCanvas
 
         virtual qreal GetCornerRadius() const = 0;
         virtual qreal GetBorderWidth() const = 0;
+
+        //! Switches the node between its full visual and a cheap block drawn in its place, used when the view is zoomed
+        //! out too far for titles and slots to be readable.
+        virtual void SetSimplifiedRendering(bool /*simplified*/) {}
     };
 
     using NodeUIRequestBus = AZ::EBus<NodeUIRequests>;
@@ -88,6 +88,10 @@ namespace GraphCanvas
         // While MaxZoom represents the largest element size, so the maximum amount you can zoom in to.
         virtual float GetMaxZoom() const { return 2.0f; }
 
+        // Below this zoom nodes are drawn as plain blocks without their titles and slots, and connections are drawn
+        // without antialiasing or dash patterns. 0 always draws the full detail.
+        virtual float GetSimplifiedRenderingZoom() const { return 0.35f; }
+
         // Edge of Screen Pan Configurations
         virtual float GetEdgePanningPercentage() const { return 0.1f; }
         virtual float GetEdgePanningScrollSpeed() const { return 100.0f; }        
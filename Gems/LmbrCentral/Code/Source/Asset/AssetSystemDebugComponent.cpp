@@ -11,10 +11,16 @@
 #include "IRenderAuxGeom.h"
 
 #include "AzCore/Asset/AssetManager.h"
+#include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace LmbrCentral
 {
@@ -27,6 +33,15 @@ namespace LmbrCentral
     AZ_CVAR(std::uint8_t, cl_assetStatusDebugDisplayCount, 20, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Sets the max number of assets to record and display in debug stats.  This will only update after more assets have loaded.");
 
+    AZ_CVAR(bool, cl_assetLoadTimelineRecord, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Record when and on which thread every asset"
+        " load reaches each of its stages, so it can be saved with AssetSystemDebugComponent.SaveAssetLoadTimeline."
+        " Data is not collected while disabled so it is recommended to enable this via command line or config");
+
+    //! Names of the regions that end at each load stage, the Queued stage only starts regions.
+    static constexpr const char* LoadStageRegionNames[] = {
+        "", "Stream", "WaitForLoadJob", "Deserialize", "WaitForPreloads", "Init", "NotifyReady"
+    };
+
     void AssetSystemDebugComponent::Activate()
     {
         BusConnect();
@@ -150,6 +165,36 @@ namespace LmbrCentral
     {
         using namespace AZ::Data;
 
+        if (cl_assetLoadTimelineRecord)
+        {
+            switch (status)
+            {
+            case AssetData::AssetStatus::Queued:
+                RecordLoadStage(id, LoadStage::Queued);
+                break;
+            case AssetData::AssetStatus::StreamReady:
+                RecordLoadStage(id, LoadStage::StreamReady);
+                break;
+            case AssetData::AssetStatus::Loading:
+                RecordLoadStage(id, LoadStage::Loading);
+                break;
+            case AssetData::AssetStatus::LoadedPreReady:
+                RecordLoadStage(id, LoadStage::LoadedPreReady);
+                break;
+            case AssetData::AssetStatus::ReadyPreNotify:
+                RecordLoadStage(id, LoadStage::ReadyPreNotify);
+                break;
+            case AssetData::AssetStatus::Ready:
+                RecordLoadStage(id, LoadStage::Ready);
+                break;
+            case AssetData::AssetStatus::Error:
+                RecordLoadStage(id, LoadStage::Ready, true);
+                break;
+            default:
+                break;
+            }
+        }
+
         if (!cl_assetStatusDebugActiveAssets && !cl_assetStatusDebugLoadedAssets)
         {
             return;
@@ -220,6 +265,220 @@ namespace LmbrCentral
         }
     }
 
+    void AssetSystemDebugComponent::AssetDataLoaded(AZ::Data::AssetId id, bool loadSucceeded)
+    {
+        if (cl_assetLoadTimelineRecord)
+        {
+            RecordLoadStage(id, LoadStage::DataLoaded, !loadSucceeded);
+        }
+    }
+
+    void AssetSystemDebugComponent::RecordLoadStage(AZ::Data::AssetId id, LoadStage stage, bool failed)
+    {
+        const AZStd::sys_time_t now = AZStd::GetTimeNowTicks();
+        const size_t threadId = AZStd::hash<AZStd::thread_id>{}(AZStd::this_thread::get_id());
+
+        AZStd::scoped_lock lock(m_timelineMutex);
+
+        LoadTimeline& timeline = m_timelines[id];
+        if (stage == LoadStage::Queued)
+        {
+            // Reloads queue the asset again, only the most recent load is kept.
+            timeline = LoadTimeline{};
+            timeline.m_id = id;
+        }
+        timeline.m_stageTicks[stage] = now;
+        timeline.m_stageThreadIds[stage] = threadId;
+        timeline.m_failed = timeline.m_failed || failed;
+    }
+
+    AZStd::vector<AZ::Data::AssetId> AssetSystemDebugComponent::FindCriticalPath(
+        const AZ::Data::AssetId& id, const AZStd::unordered_map<AZ::Data::AssetId, LoadTimeline>& timelines)
+    {
+        using namespace AZ::Data;
+
+        AZStd::vector<AssetId> path;
+        AZStd::unordered_set<AssetId> visited;
+        AssetId current = id;
+        while (current.IsValid() && visited.insert(current).second)
+        {
+            path.push_back(current);
+
+            AZ::Outcome<AZStd::vector<ProductDependency>, AZStd::string> dependencies = AZ::Failure(AZStd::string());
+            AssetCatalogRequestBus::BroadcastResult(dependencies, &AssetCatalogRequestBus::Events::GetDirectProductDependencies, current);
+            if (!dependencies.IsSuccess())
+            {
+                break;
+            }
+
+            // Only preload dependencies hold back an asset from becoming ready, so the latest one of those is the next link.
+            AssetId latestDependency;
+            AZStd::sys_time_t latestReadyTick = 0;
+            for (const ProductDependency& dependency : dependencies.GetValue())
+            {
+                if (ProductDependencyInfo::LoadBehaviorFromFlags(dependency.m_flags) != AssetLoadBehavior::PreLoad)
+                {
+                    continue;
+                }
+
+                auto timeline = timelines.find(dependency.m_assetId);
+                if (timeline == timelines.end())
+                {
+                    continue;
+                }
+
+                const AZStd::sys_time_t readyTick = timeline->second.m_stageTicks[LoadStage::ReadyPreNotify] != 0
+                    ? timeline->second.m_stageTicks[LoadStage::ReadyPreNotify]
+                    : timeline->second.m_stageTicks[LoadStage::Ready];
+                if (readyTick > latestReadyTick)
+                {
+                    latestReadyTick = readyTick;
+                    latestDependency = dependency.m_assetId;
+                }
+            }
+            current = latestDependency;
+        }
+        return path;
+    }
+
+    void AssetSystemDebugComponent::SaveAssetLoadTimeline(const AZ::ConsoleCommandContainer& arguments)
+    {
+        using namespace AZ::Data;
+
+        AZStd::unordered_map<AssetId, LoadTimeline> timelines;
+        {
+            AZStd::scoped_lock lock(m_timelineMutex);
+            timelines = m_timelines;
+        }
+
+        if (timelines.empty())
+        {
+            AZ_Warning("AssetSystemDebug", false, "No asset load timelines were recorded, enable cl_assetLoadTimelineRecord to record them.");
+            return;
+        }
+
+        AZStd::string filePath = arguments.size() > 0
+            ? AZStd::string(arguments[0])
+            : AZStd::string::format("@user@/Profiler/AssetLoadTimeline_%lld.json", static_cast<long long>(AZStd::GetTimeNowTicks()));
+        if (AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance())
+        {
+            if (auto resolvedPath = fileIO->ResolvePath(AZ::IO::PathView(filePath)); resolvedPath.has_value())
+            {
+                filePath = resolvedPath->c_str();
+            }
+        }
+
+        // Without an explicit asset, the critical path leads to the asset that became ready last.
+        AssetId criticalAssetId = arguments.size() > 1 ? AssetId::CreateString(arguments[1]) : AssetId();
+        if (!criticalAssetId.IsValid())
+        {
+            AZStd::sys_time_t latestReadyTick = 0;
+            for (const auto& [id, timeline] : timelines)
+            {
+                if (timeline.m_stageTicks[LoadStage::Ready] > latestReadyTick)
+                {
+                    latestReadyTick = timeline.m_stageTicks[LoadStage::Ready];
+                    criticalAssetId = id;
+                }
+            }
+        }
+
+        auto getAssetName = [](const AssetId& id)
+        {
+            AZStd::string assetPath;
+            AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, id);
+            return assetPath.empty() ? id.ToString<AZStd::string>() : assetPath;
+        };
+
+        // Write the layout of a serialized CpuProfilingStatisticsSerializer, so the capture can be opened by the Profiler gem.
+        rapidjson::Document document;
+        document.SetObject();
+        rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
+        rapidjson::Value entries(rapidjson::kArrayType);
+
+        auto addEntry = [&entries, &allocator](const char* groupName, const AZStd::string& regionName, uint16_t stackDepth,
+            AZStd::sys_time_t startTick, AZStd::sys_time_t endTick, size_t threadId)
+        {
+            rapidjson::Value entry(rapidjson::kObjectType);
+            entry.AddMember("groupName", rapidjson::StringRef(groupName), allocator);
+            entry.AddMember("regionName", rapidjson::Value(regionName.c_str(), static_cast<rapidjson::SizeType>(regionName.size()), allocator), allocator);
+            entry.AddMember("stackDepth", static_cast<int>(stackDepth), allocator);
+            entry.AddMember("startTick", static_cast<int64_t>(startTick), allocator);
+            entry.AddMember("endTick", static_cast<int64_t>(endTick), allocator);
+            entry.AddMember("threadId", static_cast<uint64_t>(threadId), allocator);
+            entries.PushBack(AZStd::move(entry), allocator);
+        };
+
+        for (const auto& [id, timeline] : timelines)
+        {
+            if (timeline.m_stageTicks[LoadStage::Queued] == 0)
+            {
+                continue;
+            }
+
+            // Every region spans from the previously recorded stage to the next recorded one, and is placed on the thread that
+            // finished it. Stages can be missing, like streaming for assets without any data to read.
+            const AZStd::string assetName = getAssetName(id);
+            uint32_t previousStage = LoadStage::Queued;
+            for (uint32_t stage = LoadStage::StreamReady; stage < LoadStageCount; ++stage)
+            {
+                if (timeline.m_stageTicks[stage] == 0)
+                {
+                    continue;
+                }
+
+                const char* regionName = (stage == LoadStage::Ready && timeline.m_failed) ? "Error" : LoadStageRegionNames[stage];
+                addEntry("AssetLoad", AZStd::string::format("%s %s", regionName, assetName.c_str()), 0,
+                    timeline.m_stageTicks[previousStage], timeline.m_stageTicks[stage], timeline.m_stageThreadIds[stage]);
+                previousStage = stage;
+            }
+        }
+
+        const AZStd::vector<AssetId> criticalPath = FindCriticalPath(criticalAssetId, timelines);
+        AZ_Printf("AssetSystemDebug", "Asset load critical path, from the last asset to become ready to the first one it waited on:\n");
+        for (size_t index = 0; index < criticalPath.size(); ++index)
+        {
+            const LoadTimeline& timeline = timelines[criticalPath[index]];
+            const AZStd::sys_time_t startTick = timeline.m_stageTicks[LoadStage::Queued];
+            AZStd::sys_time_t endTick = startTick;
+            for (const AZStd::sys_time_t stageTick : timeline.m_stageTicks)
+            {
+                endTick = AZStd::max(endTick, stageTick);
+            }
+
+            const AZStd::string assetName = getAssetName(criticalPath[index]);
+            const double durationMs = 1000.0 * static_cast<double>(endTick - startTick) / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+            AZ_Printf("AssetSystemDebug", "  %zu: %s - %.3fms\n", index, assetName.c_str(), durationMs);
+            addEntry("AssetLoadCriticalPath", assetName, 0, startTick, endTick, timeline.m_stageThreadIds[LoadStage::Queued]);
+        }
+
+        rapidjson::Value classData(rapidjson::kObjectType);
+        classData.AddMember("cpuProfilingStatisticsSerializerEntries", AZStd::move(entries), allocator);
+        classData.AddMember("timeTicksPerSecond", static_cast<int64_t>(AZStd::GetTimeTicksPerSecond()), allocator);
+
+        document.AddMember("Type", "JsonSerialization", allocator);
+        document.AddMember("Version", 1, allocator);
+        document.AddMember("ClassName", "CpuProfilingStatisticsSerializer", allocator);
+        document.AddMember("ClassData", AZStd::move(classData), allocator);
+
+        const auto saveResult = AZ::JsonSerializationUtils::WriteJsonFile(document, filePath);
+        if (saveResult.IsSuccess())
+        {
+            AZ_Printf("AssetSystemDebug", "Asset load timelines of %zu assets were saved to file [%s]\n", timelines.size(), filePath.c_str());
+        }
+        else
+        {
+            AZ_Warning("AssetSystemDebug", false, "Failed to save asset load timelines to file '%s'. Error: %s",
+                filePath.c_str(), saveResult.GetError().c_str());
+        }
+    }
+
+    void AssetSystemDebugComponent::ClearAssetLoadTimeline([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZStd::scoped_lock lock(m_timelineMutex);
+        m_timelines.clear();
+    }
+
     void AssetSystemDebugComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
     {
         provided.push_back(AZ_CRC_CE("AssetSystemDebug"));
@@ -11,6 +11,8 @@
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/time.h>
 
 namespace LmbrCentral
 {
@@ -40,6 +42,7 @@ namespace LmbrCentral
         // IDebugAssetEvent
         void AssetStatusUpdate(AZ::Data::AssetId id, AZ::Data::AssetData::AssetStatus status) override;
         void ReleaseAsset(AZ::Data::AssetId id) override;
+        void AssetDataLoaded(AZ::Data::AssetId id, bool loadSucceeded) override;
         //////////////////////////////////////////////////////////////////////////
 
         /// \ref ComponentDescriptor::GetProvidedServices
@@ -73,10 +76,49 @@ namespace LmbrCentral
             }
         };
 
+        //! Points in the life of an asset load that get timestamped while cl_assetLoadTimelineRecord is enabled.
+        enum LoadStage : uint32_t
+        {
+            Queued,
+            StreamReady,
+            Loading,
+            DataLoaded,
+            LoadedPreReady,
+            ReadyPreNotify,
+            Ready,
+            LoadStageCount
+        };
+
+        struct LoadTimeline
+        {
+            AZ::Data::AssetId m_id;
+            AZStd::sys_time_t m_stageTicks[LoadStageCount] = {};
+            size_t m_stageThreadIds[LoadStageCount] = {};
+            bool m_failed = false;
+        };
+
+        void RecordLoadStage(AZ::Data::AssetId id, LoadStage stage, bool failed = false);
+
+        //! Follows the latest finishing preload dependency from the given asset until reaching an asset without any,
+        //! which is the chain of loads that determined when the given asset became ready.
+        static AZStd::vector<AZ::Data::AssetId> FindCriticalPath(
+            const AZ::Data::AssetId& id, const AZStd::unordered_map<AZ::Data::AssetId, LoadTimeline>& timelines);
+
+        void SaveAssetLoadTimeline(const AZ::ConsoleCommandContainer& arguments);
+        void ClearAssetLoadTimeline(const AZ::ConsoleCommandContainer& arguments);
+
+        AZ_CONSOLEFUNC(AssetSystemDebugComponent, SaveAssetLoadTimeline, AZ::ConsoleFunctorFlags::Null,
+            "Saves the recorded asset load timelines and their critical path as a Profiler capture. Usage: [filePath] [assetId]");
+        AZ_CONSOLEFUNC(AssetSystemDebugComponent, ClearAssetLoadTimeline, AZ::ConsoleFunctorFlags::Null,
+            "Discards all recorded asset load timelines.");
+
         AZStd::recursive_mutex m_eventMutex;
 
         AZStd::unordered_map<AZ::Data::AssetId, EventInfo> m_events;
         AZStd::set<EventInfo*, EventSortOldest> m_oldestActive;
         AZStd::set<EventInfo*, EventSortMostRecentCompleted> m_recentlyCompleted;
+
+        AZStd::mutex m_timelineMutex;
+        AZStd::unordered_map<AZ::Data::AssetId, LoadTimeline> m_timelines;
     };
 }
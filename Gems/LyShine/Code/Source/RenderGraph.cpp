@@ -149,15 +149,22 @@ namespace LyShine
 
         drawSrg->Compile();
 
-        // Add the indexed primitives to the dynamic draw context for drawing
-        //
-        // [LYSHINE_ATOM_TODO][ATOM-15073] Combine into a single DrawIndexed call to take advantage of the draw call
-        // optimization done by this RenderGraph. This option will be added to DynamicDrawContext. For
-        // now we could combine the vertices ourselves
-        for (const LyShine::UiPrimitive& primitive : m_primitives)
+        // Add the indexed primitives to the dynamic draw context for drawing. A list with several primitives gets
+        // combined into a single DrawIndexed call to take advantage of the draw call optimization done by this RenderGraph.
+        if (!m_primitives.empty() && AZStd::next(m_primitives.begin()) == m_primitives.end())
         {
+            const LyShine::UiPrimitive& primitive = m_primitives.front();
             dynamicDraw->DrawIndexed(primitive.m_vertices, primitive.m_numVertices, primitive.m_indices, primitive.m_numIndices, AZ::RHI::IndexFormat::Uint16, drawSrg);
         }
+        else if (!m_primitives.empty())
+        {
+            if (m_mergedVertices.empty())
+            {
+                MergePrimitives();
+            }
+            dynamicDraw->DrawIndexed(m_mergedVertices.data(), aznumeric_cast<uint32_t>(m_mergedVertices.size()),
+                m_mergedIndices.data(), aznumeric_cast<uint32_t>(m_mergedIndices.size()), AZ::RHI::IndexFormat::Uint16, drawSrg);
+        }
 
         uiRenderer->SetBaseState(prevBaseState);
     }
@@ -173,6 +180,23 @@ namespace LyShine
         m_totalNumIndices += primitive->m_numIndices;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void PrimitiveListRenderNode::MergePrimitives()
+    {
+        m_mergedVertices.reserve(m_totalNumVertices);
+        m_mergedIndices.reserve(m_totalNumIndices);
+        for (const LyShine::UiPrimitive& primitive : m_primitives)
+        {
+            // HasSpaceToAddPrimitive keeps the total number of vertices within the range of 16 bit indices
+            const LyShine::UiIndice baseVertex = aznumeric_cast<LyShine::UiIndice>(m_mergedVertices.size());
+            m_mergedVertices.insert(m_mergedVertices.end(), primitive.m_vertices, primitive.m_vertices + primitive.m_numVertices);
+            for (int i = 0; i < primitive.m_numIndices; ++i)
+            {
+                m_mergedIndices.push_back(static_cast<LyShine::UiIndice>(baseVertex + primitive.m_indices[i]));
+            }
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     LyShine::UiPrimitiveList& PrimitiveListRenderNode::GetPrimitives() const
     {
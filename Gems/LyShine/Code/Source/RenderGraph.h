@@ -13,6 +13,7 @@
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/Math/Color.h>
 
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
@@ -105,6 +106,10 @@ namespace LyShine
     public: // data
         static const int MaxTextures = 16;
 
+    private: // functions
+        //! Fills the merged vertex and index buffers with the primitives, rebasing the indices of each primitive
+        void MergePrimitives();
+
     private: // types
         struct TextureUsage
         {
@@ -123,6 +128,12 @@ namespace LyShine
         int             m_totalNumIndices;
 
         LyShine::UiPrimitiveList   m_primitives;
+
+        // The primitives combined into one vertex and index buffer, so the whole list is a single draw call.
+        // Built on the first render. The primitives only change when the render graph is rebuilt, which also
+        // recreates this node, so the buffers are reused for every frame the graph stays the same.
+        AZStd::vector<LyShine::UiPrimitiveVertex> m_mergedVertices;
+        AZStd::vector<LyShine::UiIndice> m_mergedIndices;
     };
 
     // A mask render node handles using one set of render nodes to mask another set of render nodes
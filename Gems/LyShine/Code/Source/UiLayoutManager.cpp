@@ -11,6 +11,10 @@
 #include <LyShine/Bus/UiElementBus.h>
 #include <LyShine/Bus/UiLayoutControllerBus.h>
 
+#include <AzCore/Debug/Profiler.h>
+
+AZ_DEFINE_BUDGET(LyShine);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // PUBLIC MEMBER FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -75,11 +79,14 @@ void UiLayoutManager::MarkToRecomputeLayoutsAffectedByLayoutCellChange(AZ::Entit
 void UiLayoutManager::UnmarkAllLayouts()
 {
     m_elementsToRecomputeLayout.clear();
+    m_markedElements.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiLayoutManager::RecomputeMarkedLayouts()
 {
+    AZ_PROFILE_SCOPE(LyShine, "UiLayoutManager::RecomputeMarkedLayouts");
+
     for (auto element : m_elementsToRecomputeLayout)
     {
         ComputeLayoutForElementAndDescendants(element);
@@ -120,48 +127,29 @@ void UiLayoutManager::ComputeLayoutForElementAndDescendants(AZ::EntityId entityI
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiLayoutManager::AddToRecomputeLayoutList(AZ::EntityId entityId)
 {
-    // Check if element is already in the list
-    auto iter = AZStd::find(m_elementsToRecomputeLayout.begin(), m_elementsToRecomputeLayout.end(), entityId);
-    if (iter == m_elementsToRecomputeLayout.end())
+    // Don't need to add this element if it or one of its parents is already in the list
+    if (IsElementOrAncestorMarked(entityId))
     {
-        // Check if element's parent is already in the list
-        for (iter = m_elementsToRecomputeLayout.begin(); iter != m_elementsToRecomputeLayout.end(); ++iter)
-        {
-            if (IsParentOfElement(*iter, entityId))
-            {
-                // Don't need to add this element
-                return;
-            }
-        }
+        return;
+    }
 
-        // Remove element's children from the list
-        LyShine::EntityArray descendants;
-        UiElementBus::Event(
-            entityId,
-            &UiElementBus::Events::FindDescendantElements,
-            []([[maybe_unused]] const AZ::Entity* entity)
+    // Remove element's children from the list. Walking up from the few marked elements is much cheaper
+    // than gathering all descendants of the element, which can be thousands of entities for a big layout
+    m_elementsToRecomputeLayout.remove_if(
+        [this, entityId](const AZ::EntityId& e)
+        {
+            if (IsParentOfElement(entityId, e))
             {
+                m_markedElements.erase(e);
                 return true;
-            },
-            descendants);
-
-        m_elementsToRecomputeLayout.remove_if(
-            [descendants](const AZ::EntityId& e)
-            {
-                for (auto descendant : descendants)
-                {
-                    if (descendant->GetId() == e)
-                    {
-                        return true;
-                    }
-                }
-                return false;
             }
-            );
+            return false;
+        }
+        );
 
-        // Add element to list
-        m_elementsToRecomputeLayout.push_back(entityId);
-    }
+    // Add element to list
+    m_elementsToRecomputeLayout.push_back(entityId);
+    m_markedElements.insert(entityId);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -184,3 +172,26 @@ bool UiLayoutManager::IsParentOfElement(AZ::EntityId checkParentEntity, AZ::Enti
     return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UiLayoutManager::IsElementOrAncestorMarked(AZ::EntityId entityId) const
+{
+    if (m_markedElements.empty())
+    {
+        return false;
+    }
+
+    AZ::EntityId element = entityId;
+    while (element.IsValid())
+    {
+        if (m_markedElements.find(element) != m_markedElements.end())
+        {
+            return true;
+        }
+
+        AZ::EntityId parent;
+        UiElementBus::EventResult(parent, element, &UiElementBus::Events::GetParentEntityId);
+        element = parent;
+    }
+
+    return false;
+}
@@ -9,6 +9,8 @@
 
 #include <LyShine/Bus/UiLayoutManagerBus.h>
 
+#include <AzCore/std/containers/unordered_set.h>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class UiLayoutManager
     : public UiLayoutManagerBus::Handler
@@ -35,8 +37,14 @@ private: // member functions
     void AddToRecomputeLayoutList(AZ::EntityId entityId);
     bool IsParentOfElement(AZ::EntityId checkParentEntity, AZ::EntityId checkChildEntity);
 
+    //! Returns true if the element or one of its ancestors is already in the list of elements to recompute
+    bool IsElementOrAncestorMarked(AZ::EntityId entityId) const;
+
 private: // data
 
     //! Elements that need to recompute their layouts. Parents should be ahead of their children
     AZStd::list<AZ::EntityId> m_elementsToRecomputeLayout;
+
+    //! The same elements as m_elementsToRecomputeLayout, for fast lookups when marking many elements
+    AZStd::unordered_set<AZ::EntityId> m_markedElements;
 };
@@ -16,6 +16,7 @@
 namespace EMotionFX::MotionMatching
 {
     class FeatureSchema;
+    class SearchScheduler;
 
     class DebugDrawRequests
         : public AZ::EBusTraits
@@ -32,6 +33,9 @@ namespace EMotionFX::MotionMatching
     public:
         AZ_RTTI(MotionMatchingRequests, "{b08f73cc-a922-49ef-8c0e-07166b43ea65}");
         virtual ~MotionMatchingRequests() = default;
+
+        //! Get the search scheduler shared by all motion matching instances.
+        virtual SearchScheduler* GetSearchScheduler() = 0;
     };
 
     class MotionMatchingEditorRequests
@@ -278,6 +278,23 @@ namespace EMotionFX::MotionMatching
             }
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // 5. Quantize the feature matrix used by the brute-force broad-phase search
+        {
+            m_quantizedFeatureMatrix.Init(m_featureMatrix, CalcColumnWeights());
+
+            // Exclude the frames that the narrow-phase search discards as well.
+            const size_t numFrames = m_frameDatabase.GetNumFrames();
+            for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+            {
+                const Frame& frame = m_frameDatabase.GetFrame(frameIndex);
+                if (frame.GetSampleTime() >= frame.GetSourceMotion()->GetDuration() - 1.0f)
+                {
+                    m_quantizedFeatureMatrix.SetFrameExcluded(frameIndex, true);
+                }
+            }
+        }
+
         const float initTime = initTimer.GetDeltaTimeInSeconds();
         AZ_Printf("Motion Matching", "Feature matrix (%zu, %zu) uses %.2f MB and took %.2f ms to initialize (including initialization of acceleration structures).",
             m_featureMatrix.rows(),
@@ -294,5 +311,41 @@ namespace EMotionFX::MotionMatching
         m_featureMatrix.Clear();
         m_kdTree->Clear();
         m_featuresInKdTree.clear();
+        m_quantizedFeatureMatrix.Clear();
+    }
+
+    AZStd::vector<float> MotionMatchingData::CalcColumnWeights() const
+    {
+        AZStd::vector<float> columnWeights(m_featureMatrix.cols(), 0.0f);
+        for (const Feature* feature : m_featureSchema.GetFeatures())
+        {
+            const size_t columnOffset = feature->GetColumnOffset();
+            const size_t numDimensions = feature->GetNumDimensions();
+            if (const FeatureTrajectory* trajectory = azdynamic_cast<const FeatureTrajectory*>(feature))
+            {
+                // The past samples come first, followed by the sample of the current frame, which isn't part of the cost, and the future samples.
+                const size_t numPastSamples = trajectory->GetNumPastSamples();
+                for (size_t i = 0; i < numDimensions; ++i)
+                {
+                    const size_t sampleIndex = i / FeatureTrajectory::Sample::s_componentsPerSample;
+                    if (sampleIndex < numPastSamples)
+                    {
+                        columnWeights[columnOffset + i] = trajectory->GetPastCostFactor();
+                    }
+                    else if (sampleIndex > numPastSamples)
+                    {
+                        columnWeights[columnOffset + i] = trajectory->GetFutureCostFactor();
+                    }
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < numDimensions; ++i)
+                {
+                    columnWeights[columnOffset + i] = feature->GetCostFactor();
+                }
+            }
+        }
+        return columnWeights;
     }
 } // namespace EMotionFX::MotionMatching
@@ -39,6 +39,9 @@ namespace EMotionFX::MotionMatching
     AZ_CVAR_EXTERNED(bool, mm_debugDrawQueryPose);
     AZ_CVAR_EXTERNED(bool, mm_debugDrawQueryVelocities);
     AZ_CVAR_EXTERNED(bool, mm_useKdTree);
+    AZ_CVAR_EXTERNED(bool, mm_useQuantizedFeatureMatrix);
+    AZ_CVAR_EXTERNED(AZ::u32, mm_numBroadPhaseCandidates);
+    AZ_CVAR_EXTERNED(bool, mm_batchSearches);
 
     AZ_CLASS_ALLOCATOR_IMPL(MotionMatchingInstance, MotionMatchAllocator)
 
@@ -46,6 +49,11 @@ namespace EMotionFX::MotionMatching
     {
         DebugDrawRequestBus::Handler::BusDisconnect();
 
+        if (m_searchScheduler && m_searchRequest.m_state == SearchScheduler::SearchRequest::State::Queued)
+        {
+            m_searchScheduler->CancelSearch(&m_searchRequest);
+        }
+
         if (m_motionInstance)
         {
             GetMotionInstancePool().Free(m_motionInstance);
@@ -112,6 +120,16 @@ namespace EMotionFX::MotionMatching
         m_kdTreeQueryVector.Resize(numValuesInKdTree);
         m_queryVector.Resize(m_data->GetFeatureMatrix().cols());
 
+        // Offset the first search by the search phase, so that instances created at the same time search on different frames.
+        if (MotionMatchingRequests* motionMatching = MotionMatchingInterface::Get())
+        {
+            m_searchScheduler = motionMatching->GetSearchScheduler();
+        }
+        if (m_searchScheduler)
+        {
+            m_timeSinceLastFrameSwitch = m_searchScheduler->CalcSearchPhase() / m_lowestCostSearchFrequency;
+        }
+
         // Initialize the trajectory history.
         if (m_cachedTrajectoryFeature)
         {
@@ -389,7 +407,9 @@ namespace EMotionFX::MotionMatching
             }
         }
 
-        const bool searchLowestCostFrame = m_timeSinceLastFrameSwitch >= lowestCostSearchTimeInterval;
+        // A finished queued search was already paid for from the budget of the frame it got queued in.
+        const bool searchLowestCostFrame = m_timeSinceLastFrameSwitch >= lowestCostSearchTimeInterval &&
+            (!m_searchScheduler || m_searchRequest.m_state == SearchScheduler::SearchRequest::State::Finished || m_searchScheduler->TryAcquireSearch());
         if (searchLowestCostFrame)
         {
             // Calculate the input query pose for the motion matching search algorithm.
@@ -425,39 +445,43 @@ namespace EMotionFX::MotionMatching
             Feature::FrameCostContext frameCostContext(m_queryVector, featureMatrix);
             const size_t lowestCostFrameIndex = FindLowestCostFrameIndex(queryVectorContext, frameCostContext);
 
-            const Frame& currentFrame = frameDatabase.GetFrame(currentFrameIndex);
-            const Frame& lowestCostFrame = frameDatabase.GetFrame(lowestCostFrameIndex);
-            const bool sameMotion = (currentFrame.GetSourceMotion() == lowestCostFrame.GetSourceMotion());
-            const float timeBetweenFrames = newMotionTime - lowestCostFrame.GetSampleTime();
-            const bool sameLocation = sameMotion && (AZ::GetAbs(timeBetweenFrames) < 0.1f);
-
-            if (lowestCostFrameIndex != currentFrameIndex && !sameLocation)
+            // The broad-phase could have been queued, in which case the frame switch happens with the update that receives the results.
+            if (lowestCostFrameIndex != InvalidIndex)
             {
-                // Start a blend.
-                m_blending = true;
-                m_blendWeight = 0.0f;
-                m_blendProgressTime = 0.0f;
-
-                // Store the current motion instance state, so we can sample this as source pose.
-                m_prevMotionInstance->SetMotion(m_motionInstance->GetMotion());
-                m_prevMotionInstance->SetMirrorMotion(m_motionInstance->GetMirrorMotion());
-                m_prevMotionInstance->SetCurrentTime(newMotionTime);
-                m_prevMotionInstance->SetLastCurrentTime(m_prevMotionInstance->GetCurrentTime() - timePassedInSeconds);
-
-                m_lowestCostFrameIndex = lowestCostFrameIndex;
-
-                m_motionInstance->SetMotion(lowestCostFrame.GetSourceMotion());
-                m_motionInstance->SetMirrorMotion(lowestCostFrame.GetMirrored());
-
-                // The new motion time will become the current time after this frame while the current time
-                // becomes the last current time. As we just start playing at the search frame, calculate
-                // the last time based on the time delta.
-                m_newMotionTime = lowestCostFrame.GetSampleTime();
-                m_motionInstance->SetCurrentTime(m_newMotionTime - timePassedInSeconds);
-            }
+                const Frame& currentFrame = frameDatabase.GetFrame(currentFrameIndex);
+                const Frame& lowestCostFrame = frameDatabase.GetFrame(lowestCostFrameIndex);
+                const bool sameMotion = (currentFrame.GetSourceMotion() == lowestCostFrame.GetSourceMotion());
+                const float timeBetweenFrames = newMotionTime - lowestCostFrame.GetSampleTime();
+                const bool sameLocation = sameMotion && (AZ::GetAbs(timeBetweenFrames) < 0.1f);
+
+                if (lowestCostFrameIndex != currentFrameIndex && !sameLocation)
+                {
+                    // Start a blend.
+                    m_blending = true;
+                    m_blendWeight = 0.0f;
+                    m_blendProgressTime = 0.0f;
+
+                    // Store the current motion instance state, so we can sample this as source pose.
+                    m_prevMotionInstance->SetMotion(m_motionInstance->GetMotion());
+                    m_prevMotionInstance->SetMirrorMotion(m_motionInstance->GetMirrorMotion());
+                    m_prevMotionInstance->SetCurrentTime(newMotionTime);
+                    m_prevMotionInstance->SetLastCurrentTime(m_prevMotionInstance->GetCurrentTime() - timePassedInSeconds);
+
+                    m_lowestCostFrameIndex = lowestCostFrameIndex;
+
+                    m_motionInstance->SetMotion(lowestCostFrame.GetSourceMotion());
+                    m_motionInstance->SetMirrorMotion(lowestCostFrame.GetMirrored());
+
+                    // The new motion time will become the current time after this frame while the current time
+                    // becomes the last current time. As we just start playing at the search frame, calculate
+                    // the last time based on the time delta.
+                    m_newMotionTime = lowestCostFrame.GetSampleTime();
+                    m_motionInstance->SetCurrentTime(m_newMotionTime - timePassedInSeconds);
+                }
 
-            // Do this always, else wise we search for the lowest cost frame index too many times.
-            m_timeSinceLastFrameSwitch = 0.0f;
+                // Do this always, else wise we search for the lowest cost frame index too many times.
+                m_timeSinceLastFrameSwitch = 0.0f;
+            }
         }
 
         // ImGui monitor
@@ -507,8 +531,37 @@ namespace EMotionFX::MotionMatching
             }
         }
 
-        // 2. Broad-phase search using KD-tree
-        if (mm_useKdTree)
+        // 2. Broad-phase search using the quantized feature matrix or the KD-tree
+        const bool useBroadPhase = mm_useQuantizedFeatureMatrix || mm_useKdTree;
+        const bool useBatchedSearch = mm_useQuantizedFeatureMatrix && mm_batchSearches && m_searchScheduler;
+        if (useBatchedSearch)
+        {
+            using SearchRequest = SearchScheduler::SearchRequest;
+            if (m_searchRequest.m_state == SearchRequest::State::Queued)
+            {
+                return InvalidIndex;
+            }
+
+            if (m_searchRequest.m_state == SearchRequest::State::Idle)
+            {
+                AZ_PROFILE_SCOPE(Animation, "MM::QueueBroadPhaseSearch");
+                m_searchRequest.m_featureMatrix = &m_data->GetQuantizedFeatureMatrix();
+                m_searchRequest.m_queryVector = m_queryVector.GetData();
+                m_searchRequest.m_maxNumFrames = mm_numBroadPhaseCandidates;
+                m_searchScheduler->QueueSearch(&m_searchRequest);
+                return InvalidIndex;
+            }
+
+            // The broad-phase candidates are from the query of the previous update, the narrow-phase uses the fresh query vector.
+            m_nearestFrames.swap(m_searchRequest.m_resultFrameIndices);
+            m_searchRequest.m_state = SearchRequest::State::Idle;
+        }
+        else if (mm_useQuantizedFeatureMatrix)
+        {
+            AZ_PROFILE_SCOPE(Animation, "MM::BroadPhaseQuantizedFeatureMatrix");
+            m_data->GetQuantizedFeatureMatrix().FindLowestCostFrames(m_queryVector.GetData(), mm_numBroadPhaseCandidates, m_nearestFrames);
+        }
+        else if (mm_useKdTree)
         {
             AZ_PROFILE_SCOPE(Animation, "MM::BroadPhaseKDTree");
 
@@ -537,10 +590,10 @@ namespace EMotionFX::MotionMatching
         float minTrajectoryFutureCost = 0.0f;
 
         // Iterate through the frames filtered by the broad-phase search.
-        const size_t numFrames = mm_useKdTree ? m_nearestFrames.size() : frameDatabase.GetNumFrames();
+        const size_t numFrames = useBroadPhase ? m_nearestFrames.size() : frameDatabase.GetNumFrames();
         for (size_t i = 0; i < numFrames; ++i)
         {
-            const size_t frameIndex = mm_useKdTree ? m_nearestFrames[i] : i;
+            const size_t frameIndex = useBroadPhase ? m_nearestFrames[i] : i;
             const Frame& frame = frameDatabase.GetFrame(frameIndex);
 
             // TODO: This shouldn't be there, we should be discarding the frames when extracting the features and not at runtime when checking the cost.
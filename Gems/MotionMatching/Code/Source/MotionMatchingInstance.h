@@ -14,6 +14,7 @@
 
 #include <EMotionFX/Source/EMotionFXConfig.h>
 #include <Feature.h>
+#include <SearchScheduler.h>
 #include <TrajectoryHistory.h>
 #include <TrajectoryQuery.h>
 
@@ -106,6 +107,10 @@ namespace EMotionFX::MotionMatching
         QueryVector m_kdTreeQueryVector; //!< The input query for only the features that are present in the KD-tree.
         AZStd::vector<size_t> m_nearestFrames; //!< Stores the nearest matching frames / search result from the KD-tree.
 
+        /// Broad-phase search queued on the shared search scheduler, in case searches are batched.
+        SearchScheduler* m_searchScheduler = nullptr;
+        SearchScheduler::SearchRequest m_searchRequest;
+
         FeatureTrajectory* m_cachedTrajectoryFeature = nullptr; //< Cached pointer to the trajectory feature in the feature schema.
         TrajectoryQuery m_trajectoryQuery;
         TrajectoryHistory m_trajectoryHistory;
@@ -45,6 +45,21 @@ namespace EMotionFX::MotionMatching
         "Use Kd-Tree to accelerate the motion matching search for the best next matching frame. "
         "Disabling it will heavily slow down performance and should only be done for debugging purposes");
 
+    AZ_CVAR(bool, mm_useQuantizedFeatureMatrix, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Use a SIMD brute-force search over the quantized feature matrix as broad-phase instead of the Kd-Tree. "
+        "All features are taken into account, the number of candidates passed to the narrow-phase is set by mm_numBroadPhaseCandidates.");
+
+    AZ_CVAR(AZ::u32, mm_numBroadPhaseCandidates, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The number of lowest cost frames the quantized feature matrix broad-phase passes on to the exact narrow-phase cost calculation.");
+
+    AZ_CVAR(bool, mm_batchSearches, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Queue the quantized feature matrix broad-phase searches of all instances and evaluate them batched and multi-threaded at the end of the frame. "
+        "The narrow-phase runs on the next search with the fresh query vector. Only used together with mm_useQuantizedFeatureMatrix.");
+
+    AZ_CVAR(AZ::u32, mm_maxSearchesPerFrame, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of motion matching searches started per frame across all instances, 0 for unlimited. "
+        "Searches over the budget are postponed to the next frame.");
+
     AZ_CVAR(bool, mm_multiThreadedInitialization, true, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Use multi-threading to initialize motion matching.");
 
@@ -168,6 +183,11 @@ namespace EMotionFX::MotionMatching
 
     void MotionMatchingSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        // The animation update queued the searches of this frame, run them so the results are ready for the next update.
+        m_searchScheduler.ExecuteQueuedSearches();
+        m_searchScheduler.SetMaxSearchesPerFrame(mm_maxSearchesPerFrame);
+        m_searchScheduler.BeginFrame();
+
         MotionMatchingSystemComponent::DebugDraw(AzFramework::g_defaultSceneEntityDebugDisplayId);
     }
 } // namespace EMotionFX::MotionMatching
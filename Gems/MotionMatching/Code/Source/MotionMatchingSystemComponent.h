@@ -11,6 +11,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
 #include <MotionMatching/MotionMatchingBus.h>
+#include <SearchScheduler.h>
 
 
 namespace EMotionFX::MotionMatching
@@ -36,6 +37,11 @@ namespace EMotionFX::MotionMatching
     protected:
         virtual void DebugDraw(AZ::s32 debugDisplayId);
 
+        ////////////////////////////////////////////////////////////////////////
+        // MotionMatchingRequestBus interface implementation
+        SearchScheduler* GetSearchScheduler() override { return &m_searchScheduler; }
+        ////////////////////////////////////////////////////////////////////////
+
         ////////////////////////////////////////////////////////////////////////
         // AZ::Component interface implementation
         void Init() override;
@@ -52,5 +58,6 @@ namespace EMotionFX::MotionMatching
         virtual void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
         ////////////////////////////////////////////////////////////////////////
 
+        SearchScheduler m_searchScheduler;
     };
 } // namespace EMotionFX::MotionMatching
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+
+#include <Allocators.h>
+#include <QuantizedFeatureMatrix.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(QuantizedFeatureMatrix, MotionMatchAllocator)
+
+    namespace QuantizedFeatureMatrixInternal
+    {
+        using AZ::Simd::Vec4;
+
+        static constexpr float s_maxQuantizedValue = 65535.0f;
+        static constexpr float s_excludedPenalty = FLT_MAX;
+    } // namespace QuantizedFeatureMatrixInternal
+
+    void QuantizedFeatureMatrix::Clear()
+    {
+        m_values.clear();
+        m_values.shrink_to_fit();
+        m_framePenalties.clear();
+        m_framePenalties.shrink_to_fit();
+        m_columnMin.clear();
+        m_columnStep.clear();
+        m_columnWeights.clear();
+        m_numFrames = 0;
+        m_numColumns = 0;
+        m_numBlocks = 0;
+    }
+
+    void QuantizedFeatureMatrix::Init(const FeatureMatrix& featureMatrix, const AZStd::vector<float>& columnWeights)
+    {
+        using namespace QuantizedFeatureMatrixInternal;
+
+        Clear();
+        m_numFrames = static_cast<size_t>(featureMatrix.rows());
+        m_numColumns = static_cast<size_t>(featureMatrix.cols());
+        AZ_Assert(columnWeights.size() == m_numColumns, "Expected a weight for every column of the feature matrix.");
+        if (m_numFrames == 0 || m_numColumns == 0)
+        {
+            Clear();
+            return;
+        }
+
+        // Find the value range per column.
+        m_columnMin.resize(m_numColumns, FLT_MAX);
+        AZStd::vector<float> columnMax(m_numColumns, -FLT_MAX);
+        for (size_t frame = 0; frame < m_numFrames; ++frame)
+        {
+            for (size_t column = 0; column < m_numColumns; ++column)
+            {
+                const float value = featureMatrix.coeff(frame, column);
+                m_columnMin[column] = AZ::GetMin(m_columnMin[column], value);
+                columnMax[column] = AZ::GetMax(columnMax[column], value);
+            }
+        }
+
+        m_columnStep.resize(m_numColumns);
+        m_columnWeights.resize(m_numColumns);
+        for (size_t column = 0; column < m_numColumns; ++column)
+        {
+            const float range = columnMax[column] - m_columnMin[column];
+            m_columnStep[column] = (range > 0.0f) ? range / s_maxQuantizedValue : 1.0f;
+            m_columnWeights[column] = columnWeights[column] * m_columnStep[column] * m_columnStep[column];
+        }
+
+        // Quantize the frames into blocks. The padding frames of the last block get excluded.
+        m_numBlocks = (m_numFrames + s_framesPerBlock - 1) / s_framesPerBlock;
+        m_values.resize(m_numBlocks * m_numColumns * s_framesPerBlock, 0);
+        m_framePenalties.resize(m_numBlocks * s_framesPerBlock, s_excludedPenalty);
+        for (size_t frame = 0; frame < m_numFrames; ++frame)
+        {
+            const size_t block = frame / s_framesPerBlock;
+            const size_t lane = frame % s_framesPerBlock;
+            AZ::u16* blockValues = &m_values[block * m_numColumns * s_framesPerBlock];
+            for (size_t column = 0; column < m_numColumns; ++column)
+            {
+                const float normalized = (featureMatrix.coeff(frame, column) - m_columnMin[column]) / m_columnStep[column];
+                blockValues[column * s_framesPerBlock + lane] = static_cast<AZ::u16>(AZ::GetClamp(normalized + 0.5f, 0.0f, s_maxQuantizedValue));
+            }
+            m_framePenalties[frame] = 0.0f;
+        }
+    }
+
+    void QuantizedFeatureMatrix::SetFrameExcluded(size_t frameIndex, bool excluded)
+    {
+        AZ_Assert(frameIndex < m_numFrames, "Frame index out of range.");
+        m_framePenalties[frameIndex] = excluded ? QuantizedFeatureMatrixInternal::s_excludedPenalty : 0.0f;
+    }
+
+    void QuantizedFeatureMatrix::QuantizeQuery(const AZStd::vector<float>& queryVector, AZStd::vector<float>& outQuantizedQuery) const
+    {
+        AZ_Assert(queryVector.size() == m_numColumns, "The query vector should have the same number of elements as the feature matrix has columns.");
+        outQuantizedQuery.resize(m_numColumns);
+        for (size_t column = 0; column < m_numColumns; ++column)
+        {
+            outQuantizedQuery[column] = (queryVector[column] - m_columnMin[column]) / m_columnStep[column];
+        }
+    }
+
+    void QuantizedFeatureMatrix::SearchBlocks(const AZStd::vector<float>& quantizedQuery,
+        size_t firstBlock,
+        size_t endBlock,
+        size_t maxNumFrames,
+        AZStd::vector<Candidate>& inOutCandidates) const
+    {
+        using namespace QuantizedFeatureMatrixInternal;
+
+        // The candidates are a max-heap, so the worst of the best candidates is always on top.
+        alignas(16) float blockCosts[s_framesPerBlock];
+        for (size_t block = firstBlock; block < endBlock; ++block)
+        {
+            const AZ::u16* blockValues = &m_values[block * m_numColumns * s_framesPerBlock];
+            Vec4::FloatType costs = Vec4::LoadUnaligned(&m_framePenalties[block * s_framesPerBlock]);
+            for (size_t column = 0; column < m_numColumns; ++column)
+            {
+                const AZ::u16* values = blockValues + column * s_framesPerBlock;
+                const Vec4::FloatType frameValues = Vec4::ConvertToFloat(Vec4::LoadImmediate(
+                    static_cast<int32_t>(values[0]), static_cast<int32_t>(values[1]), static_cast<int32_t>(values[2]), static_cast<int32_t>(values[3])));
+                const Vec4::FloatType delta = Vec4::Sub(frameValues, Vec4::Splat(quantizedQuery[column]));
+                costs = Vec4::Madd(Vec4::Mul(delta, delta), Vec4::Splat(m_columnWeights[column]), costs);
+            }
+            Vec4::StoreAligned(blockCosts, costs);
+
+            for (size_t lane = 0; lane < s_framesPerBlock; ++lane)
+            {
+                const float cost = blockCosts[lane];
+                if (cost >= s_excludedPenalty)
+                {
+                    continue;
+                }
+
+                if (inOutCandidates.size() < maxNumFrames)
+                {
+                    inOutCandidates.push_back({ cost, block * s_framesPerBlock + lane });
+                    AZStd::push_heap(inOutCandidates.begin(), inOutCandidates.end());
+                }
+                else if (cost < inOutCandidates.front().m_cost)
+                {
+                    AZStd::pop_heap(inOutCandidates.begin(), inOutCandidates.end());
+                    inOutCandidates.back() = { cost, block * s_framesPerBlock + lane };
+                    AZStd::push_heap(inOutCandidates.begin(), inOutCandidates.end());
+                }
+            }
+        }
+    }
+
+    void QuantizedFeatureMatrix::SortCandidates(AZStd::vector<Candidate>& candidates, AZStd::vector<size_t>& outFrameIndices)
+    {
+        AZStd::sort_heap(candidates.begin(), candidates.end());
+        outFrameIndices.clear();
+        outFrameIndices.reserve(candidates.size());
+        for (const Candidate& candidate : candidates)
+        {
+            outFrameIndices.push_back(candidate.m_frameIndex);
+        }
+    }
+
+    void QuantizedFeatureMatrix::FindLowestCostFrames(const AZStd::vector<float>& queryVector, size_t maxNumFrames, AZStd::vector<size_t>& outFrameIndices) const
+    {
+        outFrameIndices.clear();
+        if (m_numFrames == 0 || maxNumFrames == 0)
+        {
+            return;
+        }
+
+        AZStd::vector<float> quantizedQuery;
+        QuantizeQuery(queryVector, quantizedQuery);
+
+        AZStd::vector<Candidate> candidates;
+        candidates.reserve(maxNumFrames);
+        SearchBlocks(quantizedQuery, 0, m_numBlocks, maxNumFrames, candidates);
+        SortCandidates(candidates, outFrameIndices);
+    }
+
+    void QuantizedFeatureMatrix::FindLowestCostFramesBatched(const AZStd::vector<const AZStd::vector<float>*>& queryVectors,
+        size_t maxNumFrames,
+        const AZStd::vector<AZStd::vector<size_t>*>& outFrameIndices) const
+    {
+        AZ_Assert(queryVectors.size() == outFrameIndices.size(), "Expected a result for every query vector.");
+        const size_t numQueries = queryVectors.size();
+        if (m_numFrames == 0 || maxNumFrames == 0)
+        {
+            for (AZStd::vector<size_t>* frameIndices : outFrameIndices)
+            {
+                frameIndices->clear();
+            }
+            return;
+        }
+
+        AZStd::vector<AZStd::vector<float>> quantizedQueries(numQueries);
+        AZStd::vector<AZStd::vector<Candidate>> candidates(numQueries);
+        for (size_t i = 0; i < numQueries; ++i)
+        {
+            QuantizeQuery(*queryVectors[i], quantizedQueries[i]);
+            candidates[i].reserve(maxNumFrames);
+        }
+
+        // Run all queries on a tile of blocks while it is in the cache.
+        const size_t bytesPerBlock = m_numColumns * s_framesPerBlock * sizeof(AZ::u16);
+        const size_t blocksPerTile = AZStd::max<size_t>(1, s_tileSizeInBytes / bytesPerBlock);
+        for (size_t firstBlock = 0; firstBlock < m_numBlocks; firstBlock += blocksPerTile)
+        {
+            const size_t endBlock = AZStd::min(firstBlock + blocksPerTile, m_numBlocks);
+            for (size_t i = 0; i < numQueries; ++i)
+            {
+                SearchBlocks(quantizedQueries[i], firstBlock, endBlock, maxNumFrames, candidates[i]);
+            }
+        }
+
+        for (size_t i = 0; i < numQueries; ++i)
+        {
+            SortCandidates(candidates[i], *outFrameIndices[i]);
+        }
+    }
+
+    float QuantizedFeatureMatrix::CalculateFrameCost(const AZStd::vector<float>& queryVector, size_t frameIndex) const
+    {
+        AZ_Assert(frameIndex < m_numFrames, "Frame index out of range.");
+        AZStd::vector<float> quantizedQuery;
+        QuantizeQuery(queryVector, quantizedQuery);
+
+        const size_t block = frameIndex / s_framesPerBlock;
+        const size_t lane = frameIndex % s_framesPerBlock;
+        const AZ::u16* blockValues = &m_values[block * m_numColumns * s_framesPerBlock];
+        float cost = m_framePenalties[frameIndex];
+        for (size_t column = 0; column < m_numColumns; ++column)
+        {
+            const float delta = static_cast<float>(blockValues[column * s_framesPerBlock + lane]) - quantizedQuery[column];
+            cost += delta * delta * m_columnWeights[column];
+        }
+        return cost;
+    }
+
+    size_t QuantizedFeatureMatrix::CalcMemoryUsageInBytes() const
+    {
+        return m_values.size() * sizeof(AZ::u16) +
+            (m_framePenalties.size() + m_columnMin.size() + m_columnStep.size() + m_columnWeights.size()) * sizeof(float);
+    }
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+#include <FeatureMatrix.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Quantized copy of the feature matrix, laid out for a SIMD brute-force search over all frames.
+    //! Every column is quantized to 16 bit within the value range of that column. The frames are grouped in blocks of four,
+    //! where the values of the four frames are stored next to each other for every column. The cost of four frames is accumulated at once
+    //! and a search streams linearly through memory. The cost is the weighted squared distance between the query vector and the frame
+    //! features, which approximates the feature costs and is used as broad-phase before calculating the exact costs on the best candidates.
+    class EMFX_API QuantizedFeatureMatrix
+    {
+    public:
+        AZ_RTTI(QuantizedFeatureMatrix, "{2E4C6A19-5B1D-4F7E-9C36-8D0A7B4E1F52}");
+        AZ_CLASS_ALLOCATOR_DECL
+
+        static constexpr size_t s_framesPerBlock = 4;
+
+        virtual ~QuantizedFeatureMatrix() = default;
+
+        //! Quantize the feature matrix.
+        //! @param[in] featureMatrix The feature matrix to quantize.
+        //! @param[in] columnWeights The weight of every column in the cost, usually the cost factor of the feature the column belongs to.
+        void Init(const FeatureMatrix& featureMatrix, const AZStd::vector<float>& columnWeights);
+        void Clear();
+
+        //! Exclude a frame from the search results, e.g. frames too close to the end of their motion.
+        void SetFrameExcluded(size_t frameIndex, bool excluded);
+
+        //! Find the frames with the lowest cost for the given query vector.
+        //! @param[in] queryVector The query vector, with a value for every column of the feature matrix.
+        //! @param[in] maxNumFrames The maximum number of frames to return.
+        //! @param[out] outFrameIndices The frame indices with the lowest costs, sorted from lowest to highest cost.
+        void FindLowestCostFrames(const AZStd::vector<float>& queryVector, size_t maxNumFrames, AZStd::vector<size_t>& outFrameIndices) const;
+
+        //! Find the frames with the lowest cost for multiple query vectors at once.
+        //! The blocks are processed in tiles that fit in the cache, and every query is evaluated on a tile before moving on to the next tile.
+        //! @param[in] queryVectors The query vectors, with a value for every column of the feature matrix each.
+        //! @param[in] maxNumFrames The maximum number of frames to return per query.
+        //! @param[out] outFrameIndices The frame indices with the lowest costs for every query, sorted from lowest to highest cost.
+        void FindLowestCostFramesBatched(const AZStd::vector<const AZStd::vector<float>*>& queryVectors,
+            size_t maxNumFrames,
+            const AZStd::vector<AZStd::vector<size_t>*>& outFrameIndices) const;
+
+        //! Calculate the cost of a single frame, mainly for testing and debugging.
+        float CalculateFrameCost(const AZStd::vector<float>& queryVector, size_t frameIndex) const;
+
+        size_t GetNumFrames() const { return m_numFrames; }
+        size_t GetNumColumns() const { return m_numColumns; }
+        size_t CalcMemoryUsageInBytes() const;
+
+    private:
+        struct Candidate
+        {
+            float m_cost;
+            size_t m_frameIndex;
+
+            bool operator<(const Candidate& other) const { return m_cost < other.m_cost; }
+        };
+
+        void QuantizeQuery(const AZStd::vector<float>& queryVector, AZStd::vector<float>& outQuantizedQuery) const;
+        void SearchBlocks(const AZStd::vector<float>& quantizedQuery, size_t firstBlock, size_t endBlock, size_t maxNumFrames, AZStd::vector<Candidate>& inOutCandidates) const;
+        static void SortCandidates(AZStd::vector<Candidate>& candidates, AZStd::vector<size_t>& outFrameIndices);
+
+        static constexpr size_t s_tileSizeInBytes = 32 * 1024; //!< The amount of quantized values processed per tile in a batched search.
+
+        AZStd::vector<AZ::u16> m_values; //!< The quantized blocks, m_numColumns * s_framesPerBlock values per block.
+        AZStd::vector<float> m_framePenalties; //!< Added to the cost of every frame, used to exclude frames and the padding of the last block.
+        AZStd::vector<float> m_columnMin;
+        AZStd::vector<float> m_columnStep; //!< The value difference between two quantized steps.
+        AZStd::vector<float> m_columnWeights; //!< The column weights, scaled by the squared step so the costs can be calculated in quantized space.
+        size_t m_numFrames = 0;
+        size_t m_numColumns = 0;
+        size_t m_numBlocks = 0;
+    };
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+
+#include <Allocators.h>
+#include <QuantizedFeatureMatrix.h>
+#include <SearchScheduler.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(SearchScheduler, MotionMatchAllocator)
+
+    void SearchScheduler::BeginFrame()
+    {
+        m_numSearchesThisFrame.store(0);
+    }
+
+    bool SearchScheduler::TryAcquireSearch()
+    {
+        if (m_maxSearchesPerFrame == 0)
+        {
+            return true;
+        }
+
+        // Don't let the counter run away when many instances ask for a search in the same frame.
+        AZ::u32 numSearches = m_numSearchesThisFrame.load();
+        while (numSearches < m_maxSearchesPerFrame)
+        {
+            if (m_numSearchesThisFrame.compare_exchange_weak(numSearches, numSearches + 1))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    float SearchScheduler::CalcSearchPhase()
+    {
+        // Stepping by the fractional part of the golden ratio keeps any number of consecutive phases spread evenly over the interval.
+        AZStd::scoped_lock lock(m_mutex);
+        const float phase = m_nextSearchPhase;
+        m_nextSearchPhase += 0.618034f;
+        m_nextSearchPhase -= floorf(m_nextSearchPhase);
+        return phase;
+    }
+
+    void SearchScheduler::QueueSearch(SearchRequest* request)
+    {
+        AZ_Assert(request && request->m_featureMatrix, "Expected a search request with a feature matrix.");
+        AZ_Assert(request->m_state != SearchRequest::State::Queued, "The search request is already queued.");
+
+        AZStd::scoped_lock lock(m_mutex);
+        request->m_state = SearchRequest::State::Queued;
+        m_queuedRequests.push_back(request);
+    }
+
+    void SearchScheduler::CancelSearch(SearchRequest* request)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        const auto iterator = AZStd::find(m_queuedRequests.begin(), m_queuedRequests.end(), request);
+        if (iterator != m_queuedRequests.end())
+        {
+            m_queuedRequests.erase(iterator);
+        }
+        request->m_state = SearchRequest::State::Idle;
+    }
+
+    size_t SearchScheduler::GetNumQueuedSearches() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return m_queuedRequests.size();
+    }
+
+    void SearchScheduler::ExecuteBatch(SearchRequest* const* requests, size_t numRequests)
+    {
+        AZ_PROFILE_SCOPE(Animation, "SearchScheduler::ExecuteBatch");
+
+        AZStd::vector<const AZStd::vector<float>*> queryVectors(numRequests);
+        AZStd::vector<AZStd::vector<size_t>*> results(numRequests);
+        for (size_t i = 0; i < numRequests; ++i)
+        {
+            queryVectors[i] = &requests[i]->m_queryVector;
+            results[i] = &requests[i]->m_resultFrameIndices;
+        }
+
+        requests[0]->m_featureMatrix->FindLowestCostFramesBatched(queryVectors, requests[0]->m_maxNumFrames, results);
+
+        for (size_t i = 0; i < numRequests; ++i)
+        {
+            requests[i]->m_state = SearchRequest::State::Finished;
+        }
+    }
+
+    void SearchScheduler::ExecuteQueuedSearches()
+    {
+        AZ_PROFILE_SCOPE(Animation, "SearchScheduler::ExecuteQueuedSearches");
+
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            m_executingRequests.swap(m_queuedRequests);
+        }
+
+        if (m_executingRequests.empty())
+        {
+            return;
+        }
+
+        // Group the requests that can share a batch next to each other.
+        AZStd::sort(m_executingRequests.begin(), m_executingRequests.end(),
+            [](const SearchRequest* a, const SearchRequest* b)
+            {
+                if (a->m_featureMatrix != b->m_featureMatrix)
+                {
+                    return a->m_featureMatrix < b->m_featureMatrix;
+                }
+                return a->m_maxNumFrames < b->m_maxNumFrames;
+            });
+
+        struct Batch
+        {
+            size_t m_startIndex;
+            size_t m_numRequests;
+        };
+        AZStd::vector<Batch> batches;
+        for (size_t startIndex = 0; startIndex < m_executingRequests.size();)
+        {
+            const SearchRequest* first = m_executingRequests[startIndex];
+            size_t endIndex = startIndex + 1;
+            while (endIndex < m_executingRequests.size() && endIndex - startIndex < s_maxQueriesPerBatch &&
+                m_executingRequests[endIndex]->m_featureMatrix == first->m_featureMatrix &&
+                m_executingRequests[endIndex]->m_maxNumFrames == first->m_maxNumFrames)
+            {
+                ++endIndex;
+            }
+            batches.push_back({ startIndex, endIndex - startIndex });
+            startIndex = endIndex;
+        }
+
+        SearchRequest* const* requests = m_executingRequests.data();
+        if (batches.size() == 1)
+        {
+            ExecuteBatch(requests, batches[0].m_numRequests);
+        }
+        else
+        {
+            AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            const bool useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+            if (useTaskGraph)
+            {
+                AZ::TaskGraph taskGraph{ "MotionMatching Search" };
+                for (const Batch& batch : batches)
+                {
+                    AZ::TaskDescriptor taskDescriptor{ "SearchBatch", "MotionMatching" };
+                    taskGraph.AddTask(
+                        taskDescriptor,
+                        [requests, batch]()
+                        {
+                            ExecuteBatch(requests + batch.m_startIndex, batch.m_numRequests);
+                        });
+                }
+
+                AZ::TaskGraphEvent finishedEvent{ "MotionMatching Search Wait" };
+                taskGraph.Submit(&finishedEvent);
+                finishedEvent.Wait();
+            }
+            else // job system
+            {
+                AZ::JobCompletion jobCompletion;
+                for (const Batch& batch : batches)
+                {
+                    AZ::JobContext* jobContext = nullptr;
+                    AZ::Job* job = AZ::CreateJobFunction([requests, batch]()
+                        {
+                            ExecuteBatch(requests + batch.m_startIndex, batch.m_numRequests);
+                        }, /*isAutoDelete=*/true, jobContext);
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+
+                jobCompletion.StartAndWaitForCompletion();
+            }
+        }
+
+        m_executingRequests.clear();
+    }
+} // namespace EMotionFX::MotionMatching
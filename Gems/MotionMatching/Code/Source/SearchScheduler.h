@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class QuantizedFeatureMatrix;
+
+    //! Shared search service for all motion matching instances.
+    //! Instances queue their broad-phase searches during the animation update, and the scheduler evaluates all queued query vectors at once
+    //! when the frame is done. Queries against the same feature matrix are batched, so every tile of the matrix is streamed through the cache
+    //! once per batch rather than once per query, and the batches are distributed across worker threads.
+    //! The scheduler also limits the number of searches started per frame and hands out search phases, so instances that got created at the same
+    //! time don't all search on the same frame.
+    class EMFX_API SearchScheduler
+    {
+    public:
+        AZ_RTTI(SearchScheduler, "{6F1B3E2A-94D7-4C5B-A8E1-3D2F7C0B9A46}");
+        AZ_CLASS_ALLOCATOR_DECL
+
+        //! A broad-phase search request, owned by the instance that queues it.
+        struct EMFX_API SearchRequest
+        {
+            enum class State
+            {
+                Idle,
+                Queued,
+                Finished
+            };
+
+            const QuantizedFeatureMatrix* m_featureMatrix = nullptr;
+            AZStd::vector<float> m_queryVector;
+            size_t m_maxNumFrames = 0;
+            AZStd::vector<size_t> m_resultFrameIndices; //!< The lowest cost frames, sorted from lowest to highest cost, valid once finished.
+            State m_state = State::Idle;
+        };
+
+        virtual ~SearchScheduler() = default;
+
+        //! Start a new frame, which resets the search budget.
+        void BeginFrame();
+
+        //! Try to take a search from the budget of the current frame.
+        //! @result True in case the search can run this frame, false in case the budget is used up and the search should be postponed.
+        bool TryAcquireSearch();
+
+        //! Get the search phase for a new instance in range [0, 1), as fraction of the search interval.
+        //! The phases are spread evenly, so instances created together search on different frames.
+        float CalcSearchPhase();
+
+        //! Queue a request for the next call to ExecuteQueuedSearches(). The request has to stay alive until it is finished or cancelled.
+        void QueueSearch(SearchRequest* request);
+        void CancelSearch(SearchRequest* request);
+
+        //! Run all queued searches, batched per feature matrix and multi-threaded. Blocks until all requests are finished.
+        void ExecuteQueuedSearches();
+
+        size_t GetNumQueuedSearches() const;
+
+        //! Set the maximum number of searches per frame, 0 for unlimited.
+        void SetMaxSearchesPerFrame(AZ::u32 maxSearchesPerFrame) { m_maxSearchesPerFrame = maxSearchesPerFrame; }
+        AZ::u32 GetMaxSearchesPerFrame() const { return m_maxSearchesPerFrame; }
+
+        static constexpr size_t s_maxQueriesPerBatch = 8;
+
+    private:
+        static void ExecuteBatch(SearchRequest* const* requests, size_t numRequests);
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<SearchRequest*> m_queuedRequests;
+        AZStd::vector<SearchRequest*> m_executingRequests;
+        AZStd::atomic<AZ::u32> m_numSearchesThisFrame{ 0 };
+        AZ::u32 m_maxSearchesPerFrame = 0;
+        float m_nextSearchPhase = 0.0f;
+    };
+} // namespace EMotionFX::MotionMatching
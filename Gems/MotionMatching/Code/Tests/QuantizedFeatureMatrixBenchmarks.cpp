@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <FeatureMatrix.h>
+#include <QuantizedFeatureMatrix.h>
+#include <benchmark/benchmark.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Measures the time a single motion matching instance spends in the brute-force search, for a growing number of frames in the database.
+    class QuantizedFeatureMatrixBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InitMatrices(aznumeric_cast<size_t>(state.range(0)));
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InitMatrices(aznumeric_cast<size_t>(state.range(0)));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            DestroyMatrices();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            DestroyMatrices();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void InitMatrices(size_t numFrames)
+        {
+            AZ::SimpleLcgRandom random;
+            m_featureMatrix = AZStd::make_unique<FeatureMatrix>();
+            m_featureMatrix->resize(numFrames, s_numColumns);
+            for (size_t row = 0; row < numFrames; ++row)
+            {
+                for (size_t column = 0; column < s_numColumns; ++column)
+                {
+                    (*m_featureMatrix)(row, column) = random.GetRandomFloat() * 2.0f - 1.0f;
+                }
+            }
+
+            m_queryVector.resize(s_numColumns);
+            for (float& value : m_queryVector)
+            {
+                value = random.GetRandomFloat() * 2.0f - 1.0f;
+            }
+
+            m_columnWeights.resize(s_numColumns, 1.0f);
+            m_quantizedMatrix = AZStd::make_unique<QuantizedFeatureMatrix>();
+            m_quantizedMatrix->Init(*m_featureMatrix, m_columnWeights);
+        }
+
+        void DestroyMatrices()
+        {
+            m_quantizedMatrix.reset();
+            m_featureMatrix.reset();
+            m_queryVector.set_capacity(0);
+            m_columnWeights.set_capacity(0);
+        }
+
+        static constexpr size_t s_numColumns = 60; // Roughly the size of the default feature schema.
+
+        AZStd::unique_ptr<FeatureMatrix> m_featureMatrix;
+        AZStd::unique_ptr<QuantizedFeatureMatrix> m_quantizedMatrix;
+        AZStd::vector<float> m_queryVector;
+        AZStd::vector<float> m_columnWeights;
+    };
+
+    BENCHMARK_DEFINE_F(QuantizedFeatureMatrixBenchmarkFixture, BM_ScalarFullPrecisionSearch)(benchmark::State& state)
+    {
+        const size_t numFrames = aznumeric_cast<size_t>(state.range(0));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            float minCost = FLT_MAX;
+            size_t minCostFrameIndex = 0;
+            for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+            {
+                float cost = 0.0f;
+                for (size_t column = 0; column < s_numColumns; ++column)
+                {
+                    const float delta = m_featureMatrix->coeff(frameIndex, column) - m_queryVector[column];
+                    cost += delta * delta * m_columnWeights[column];
+                }
+
+                if (cost < minCost)
+                {
+                    minCost = cost;
+                    minCostFrameIndex = frameIndex;
+                }
+            }
+            benchmark::DoNotOptimize(minCostFrameIndex);
+        }
+    }
+
+    BENCHMARK_REGISTER_F(QuantizedFeatureMatrixBenchmarkFixture, BM_ScalarFullPrecisionSearch)
+        ->RangeMultiplier(4)
+        ->Range(8 * 1024, 512 * 1024)
+        ->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(QuantizedFeatureMatrixBenchmarkFixture, BM_QuantizedSearch)(benchmark::State& state)
+    {
+        AZStd::vector<size_t> frameIndices;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_quantizedMatrix->FindLowestCostFrames(m_queryVector, 64, frameIndices);
+            benchmark::DoNotOptimize(frameIndices.data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(QuantizedFeatureMatrixBenchmarkFixture, BM_QuantizedSearch)
+        ->RangeMultiplier(4)
+        ->Range(8 * 1024, 512 * 1024)
+        ->Unit(::benchmark::kMicrosecond);
+} // namespace EMotionFX::MotionMatching
+
+#endif
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <Fixture.h>
+#include <FeatureMatrix.h>
+#include <QuantizedFeatureMatrix.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class QuantizedFeatureMatrixFixture
+        : public Fixture
+    {
+    public:
+        void SetUp() override
+        {
+            Fixture::SetUp();
+
+            AZ::SimpleLcgRandom random;
+            m_featureMatrix.resize(s_numFrames, s_numColumns);
+            for (size_t row = 0; row < s_numFrames; ++row)
+            {
+                for (size_t column = 0; column < s_numColumns; ++column)
+                {
+                    m_featureMatrix(row, column) = random.GetRandomFloat() * 4.0f - 2.0f;
+                }
+            }
+
+            m_columnWeights.resize(s_numColumns, 1.0f);
+            m_columnWeights[0] = 2.0f;
+            m_quantizedMatrix.Init(m_featureMatrix, m_columnWeights);
+        }
+
+        float CalculateExactCost(const AZStd::vector<float>& queryVector, size_t frameIndex) const
+        {
+            float cost = 0.0f;
+            for (size_t column = 0; column < s_numColumns; ++column)
+            {
+                const float delta = m_featureMatrix(frameIndex, column) - queryVector[column];
+                cost += delta * delta * m_columnWeights[column];
+            }
+            return cost;
+        }
+
+        static constexpr size_t s_numFrames = 1001; // Not a multiple of the block size, so the last block is padded.
+        static constexpr size_t s_numColumns = 7;
+
+        FeatureMatrix m_featureMatrix;
+        AZStd::vector<float> m_columnWeights;
+        QuantizedFeatureMatrix m_quantizedMatrix;
+    };
+
+    TEST_F(QuantizedFeatureMatrixFixture, FrameCostMatchesExactCost)
+    {
+        const AZStd::vector<float> queryVector{ 0.5f, -0.25f, 1.0f, 0.0f, -1.5f, 0.75f, 0.1f };
+        for (size_t frameIndex = 0; frameIndex < s_numFrames; frameIndex += 50)
+        {
+            EXPECT_NEAR(m_quantizedMatrix.CalculateFrameCost(queryVector, frameIndex), CalculateExactCost(queryVector, frameIndex), 0.01f);
+        }
+    }
+
+    TEST_F(QuantizedFeatureMatrixFixture, FindLowestCostFrames)
+    {
+        // Use a frame from the matrix as query, so it has to be the best match.
+        const size_t queryFrameIndex = 1000;
+        AZStd::vector<float> queryVector(s_numColumns);
+        for (size_t column = 0; column < s_numColumns; ++column)
+        {
+            queryVector[column] = m_featureMatrix(queryFrameIndex, column);
+        }
+
+        AZStd::vector<size_t> frameIndices;
+        m_quantizedMatrix.FindLowestCostFrames(queryVector, 10, frameIndices);
+        ASSERT_EQ(frameIndices.size(), 10);
+        EXPECT_EQ(frameIndices[0], queryFrameIndex);
+
+        // The results are sorted and no frame outside of the results has a lower cost.
+        const float worstCost = CalculateExactCost(queryVector, frameIndices.back());
+        for (size_t i = 1; i < frameIndices.size(); ++i)
+        {
+            EXPECT_LE(m_quantizedMatrix.CalculateFrameCost(queryVector, frameIndices[i - 1]), m_quantizedMatrix.CalculateFrameCost(queryVector, frameIndices[i]));
+        }
+        for (size_t frameIndex = 0; frameIndex < s_numFrames; ++frameIndex)
+        {
+            if (AZStd::find(frameIndices.begin(), frameIndices.end(), frameIndex) == frameIndices.end())
+            {
+                EXPECT_GE(CalculateExactCost(queryVector, frameIndex), worstCost - 0.01f);
+            }
+        }
+
+        // Excluded frames are never returned.
+        m_quantizedMatrix.SetFrameExcluded(queryFrameIndex, true);
+        m_quantizedMatrix.FindLowestCostFrames(queryVector, 10, frameIndices);
+        EXPECT_EQ(AZStd::find(frameIndices.begin(), frameIndices.end(), queryFrameIndex), frameIndices.end());
+    }
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/algorithm.h>
+#include <Fixture.h>
+#include <FeatureMatrix.h>
+#include <QuantizedFeatureMatrix.h>
+#include <SearchScheduler.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class SearchSchedulerFixture
+        : public Fixture
+    {
+    public:
+        void SetUp() override
+        {
+            Fixture::SetUp();
+
+            AZ::SimpleLcgRandom random;
+            FeatureMatrix featureMatrix;
+            featureMatrix.resize(s_numFrames, s_numColumns);
+            for (size_t row = 0; row < s_numFrames; ++row)
+            {
+                for (size_t column = 0; column < s_numColumns; ++column)
+                {
+                    featureMatrix(row, column) = random.GetRandomFloat() * 4.0f - 2.0f;
+                }
+            }
+            m_quantizedMatrix.Init(featureMatrix, AZStd::vector<float>(s_numColumns, 1.0f));
+
+            m_requests.resize(SearchScheduler::s_maxQueriesPerBatch);
+            for (SearchScheduler::SearchRequest& request : m_requests)
+            {
+                request.m_featureMatrix = &m_quantizedMatrix;
+                request.m_maxNumFrames = 16;
+                request.m_queryVector.resize(s_numColumns);
+                for (float& value : request.m_queryVector)
+                {
+                    value = random.GetRandomFloat() * 4.0f - 2.0f;
+                }
+            }
+        }
+
+        void TearDown() override
+        {
+            m_requests.set_capacity(0);
+            m_quantizedMatrix.Clear();
+            Fixture::TearDown();
+        }
+
+        // Enough frames to span multiple tiles of the batched search.
+        static constexpr size_t s_numFrames = 5003;
+        static constexpr size_t s_numColumns = 12;
+
+        QuantizedFeatureMatrix m_quantizedMatrix;
+        AZStd::vector<SearchScheduler::SearchRequest> m_requests;
+    };
+
+    TEST_F(SearchSchedulerFixture, BatchedSearchMatchesSingleSearch)
+    {
+        SearchScheduler scheduler;
+        for (SearchScheduler::SearchRequest& request : m_requests)
+        {
+            scheduler.QueueSearch(&request);
+            EXPECT_EQ(request.m_state, SearchScheduler::SearchRequest::State::Queued);
+        }
+        EXPECT_EQ(scheduler.GetNumQueuedSearches(), m_requests.size());
+
+        scheduler.ExecuteQueuedSearches();
+        EXPECT_EQ(scheduler.GetNumQueuedSearches(), 0);
+
+        AZStd::vector<size_t> expectedFrameIndices;
+        for (const SearchScheduler::SearchRequest& request : m_requests)
+        {
+            EXPECT_EQ(request.m_state, SearchScheduler::SearchRequest::State::Finished);
+            m_quantizedMatrix.FindLowestCostFrames(request.m_queryVector, request.m_maxNumFrames, expectedFrameIndices);
+            EXPECT_EQ(request.m_resultFrameIndices, expectedFrameIndices);
+        }
+    }
+
+    TEST_F(SearchSchedulerFixture, CancelSearch)
+    {
+        SearchScheduler scheduler;
+        scheduler.QueueSearch(&m_requests[0]);
+        scheduler.QueueSearch(&m_requests[1]);
+        scheduler.CancelSearch(&m_requests[0]);
+        EXPECT_EQ(m_requests[0].m_state, SearchScheduler::SearchRequest::State::Idle);
+        EXPECT_EQ(scheduler.GetNumQueuedSearches(), 1);
+
+        scheduler.ExecuteQueuedSearches();
+        EXPECT_EQ(m_requests[0].m_state, SearchScheduler::SearchRequest::State::Idle);
+        EXPECT_TRUE(m_requests[0].m_resultFrameIndices.empty());
+        EXPECT_EQ(m_requests[1].m_state, SearchScheduler::SearchRequest::State::Finished);
+    }
+
+    TEST_F(SearchSchedulerFixture, SearchBudget)
+    {
+        SearchScheduler scheduler;
+        scheduler.SetMaxSearchesPerFrame(3);
+        scheduler.BeginFrame();
+        EXPECT_TRUE(scheduler.TryAcquireSearch());
+        EXPECT_TRUE(scheduler.TryAcquireSearch());
+        EXPECT_TRUE(scheduler.TryAcquireSearch());
+        EXPECT_FALSE(scheduler.TryAcquireSearch());
+
+        scheduler.BeginFrame();
+        EXPECT_TRUE(scheduler.TryAcquireSearch());
+
+        scheduler.SetMaxSearchesPerFrame(0);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            EXPECT_TRUE(scheduler.TryAcquireSearch());
+        }
+    }
+
+    TEST_F(SearchSchedulerFixture, SearchPhasesAreSpread)
+    {
+        SearchScheduler scheduler;
+        AZStd::vector<float> phases;
+        for (size_t i = 0; i < 8; ++i)
+        {
+            const float phase = scheduler.CalcSearchPhase();
+            EXPECT_GE(phase, 0.0f);
+            EXPECT_LT(phase, 1.0f);
+            phases.push_back(phase);
+        }
+
+        // The minimum distance between any two phases stays well above zero.
+        AZStd::sort(phases.begin(), phases.end());
+        for (size_t i = 1; i < phases.size(); ++i)
+        {
+            EXPECT_GT(phases[i] - phases[i - 1], 0.05f);
+        }
+    }
+} // namespace EMotionFX::MotionMatching
@@ -43,8 +43,12 @@ set(FILES
     Source/FeatureVelocity.h
     Source/PoseDataJointVelocities.cpp
     Source/PoseDataJointVelocities.h
+    Source/QuantizedFeatureMatrix.cpp
+    Source/QuantizedFeatureMatrix.h
     Source/QueryVector.cpp
     Source/QueryVector.h
+    Source/SearchScheduler.cpp
+    Source/SearchScheduler.h
     Source/TrajectoryHistory.cpp
     Source/TrajectoryHistory.h
     Source/TrajectoryQuery.cpp
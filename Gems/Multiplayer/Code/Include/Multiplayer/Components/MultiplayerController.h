@@ -87,6 +87,11 @@ namespace Multiplayer
         //! Returns the input priority ordering for determining the order of ProcessInput or CreateInput functions.
         virtual InputPriorityOrder GetInputOrder() const = 0;
 
+        //! Returns true if ProcessInput has to run again when inputs are replayed after a correction.
+        //! Controllers that neither read nor write the corrected predictive state, for example ones that only trigger
+        //! cosmetic effects from their inputs, can return false to be skipped while replaying.
+        virtual bool IsInputReplayRequired() const { return true; }
+
         //! Base execution for ProcessInput packet, do not call directly.
         //! @param networkInput input structure to process
         //! @param deltaTime    amount of time to integrate the provided inputs over
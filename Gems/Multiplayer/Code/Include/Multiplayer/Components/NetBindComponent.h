@@ -165,6 +165,8 @@ namespace Multiplayer
 
         void CreateInput(NetworkInput& networkInput, float deltaTime);
         void ProcessInput(NetworkInput& networkInput, float deltaTime);
+
+        //! Replays an input after a correction, only the controllers that require input replay process it.
         void ReprocessInput(NetworkInput& networkInput, float deltaTime);
 
         bool HandleRpcMessage(AzNetworking::IConnection* invokingConnection, NetEntityRole remoteRole, NetworkEntityRpcMessage& message);
@@ -233,6 +235,7 @@ namespace Multiplayer
         AZStd::map<NetComponentId, MultiplayerComponent*> m_multiplayerComponentMap;
         AZStd::vector<MultiplayerComponent*> m_multiplayerSerializationComponentVector;
         AZStd::vector<MultiplayerComponent*> m_multiplayerInputComponentVector;
+        AZStd::vector<MultiplayerComponent*> m_multiplayerReplayInputComponentVector; // Subset of the input components that replay corrected inputs
 
         RpcSendEvent m_sendAuthorityToClientRpcEvent;
         RpcSendEvent m_sendAuthorityToAutonomousRpcEvent;
@@ -10,6 +10,7 @@
 
 #include <Source/AutoGen/NetworkHitVolumesComponent.AutoComponent.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkTime/ILagCompensationHistory.h>
 #include <Integration/ActorComponentBus.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
@@ -53,6 +54,8 @@ namespace Multiplayer
             const Physics::ColliderConfiguration* m_colliderConfig = nullptr;
             const Physics::ShapeConfiguration* m_shapeConfig = nullptr;
             AZ::Transform m_colliderOffSetTransform;
+            //! The bounds of the shape in the space of the hit volume, recorded in the lag compensation history
+            AZ::Aabb m_localBounds = AZ::Aabb::CreateNull();
             const AZ::u32 m_jointIndex = 0;
         };
 
@@ -70,6 +73,7 @@ namespace Multiplayer
         void OnPreRender(float deltaTime);
         void OnTransformUpdate(const AZ::Transform& transform);
         void OnSyncRewind();
+        void OnRecordHitVolumes(ILagCompensationHistory& lagCompensationHistory);
 
         void CreateHitVolumes();
         void DestroyHitVolumes();
@@ -96,6 +100,7 @@ namespace Multiplayer
 
         Multiplayer::EntitySyncRewindEvent::Handler m_syncRewindHandler;
         Multiplayer::EntityPreRenderEvent::Handler m_preRenderHandler;
+        RecordHitVolumesEvent::Handler m_recordHitVolumesHandler;
         AZ::TransformChangedEvent::Handler m_transformChangedHandler;
 
         AzFramework::DebugDisplayRequests* m_debugDisplay = nullptr;
@@ -42,6 +42,12 @@ namespace Multiplayer
         //! Creates and manages sending updates to the remote endpoint.
         virtual void Update() = 0;
 
+        //! Runs the main thread part of Update, up to the serialization of the entity updates.
+        //! When this returns true, the caller must serialize the prepared updates with EntityReplicationManager::SerializePreparedUpdates
+        //! and then send them with EntityReplicationManager::SendPreparedUpdates, which together complete the Update.
+        //! @return true if entity updates were prepared for sending
+        virtual bool PrepareUpdate() = 0;
+
         //! Returns whether update messages can be sent to the connection.
         //! @return true if update messages can be sent
         virtual bool CanSendUpdates() const = 0;
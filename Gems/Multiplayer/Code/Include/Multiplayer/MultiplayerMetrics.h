@@ -13,7 +13,8 @@ namespace Multiplayer
     //! Declares multiplayer metric group ids.
     enum MultiplayerGroupIds
     {
-        MultiplayerGroup_Networking = 101           // A group of multiplayer metrics
+        MultiplayerGroup_Networking = 101,          // A group of multiplayer metrics
+        MultiplayerGroup_BotSwarm = 102             // Metrics of the bots simulated by the bot swarm
     };
 
     //! Declares multiplayer metric stat ids.
@@ -40,5 +41,22 @@ namespace Multiplayer
 
         // Other systems
         MultiplayerStat_PhysicsFrameTimeUs,
+
+        // Replication scheduling
+        MultiplayerStat_DeferredEntityUpdates,      // Number of entity updates deferred to a later tick by the replication limits
+        MultiplayerStat_EntityStarvationTimeMs,     // Longest time an entity update waited to be sent, over the last metrics tick
+
+        // Client prediction
+        MultiplayerStat_CorrectionReplayTimeUs,     // Time spent replaying inputs after a correction
+        MultiplayerStat_CorrectionReplayedInputs,   // Number of inputs replayed after a correction
+
+        // Bot swarm, the per bot values are averages over the connected bots
+        MultiplayerStat_BotConnectionCount,         // Number of bots that completed the handshake
+        MultiplayerStat_BotReceivedBytesPerSecond,  // Received datarate per bot
+        MultiplayerStat_BotSentBytesPerSecond,      // Sent datarate per bot
+        MultiplayerStat_BotRoundTripTimeMs,         // Round trip time per bot
+        MultiplayerStat_BotReplicationLagMs,        // Average replication lag over the last report period
+        MultiplayerStat_BotMaxReplicationLagMs,     // Largest replication lag of any bot over the last report period
+        MultiplayerStat_BotReplicatedEntities,      // Number of entities replicated to each bot
     };
 }
@@ -26,6 +26,11 @@ namespace Multiplayer
         AZ::u64 m_clientConnectionCount = 0;
         AZ::u64 m_serverConnectionCount = 0;
 
+        // Entity updates deferred to later ticks by the replication limits of a connection, and how long they waited to be sent
+        AZ::u64 m_deferredEntityUpdateCount = 0;
+        AZ::TimeMs m_maxEntityStarvationTimeMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeMs m_tickMaxEntityStarvationTimeMs = AZ::Time::ZeroTimeMs;
+
         uint64_t m_recordMetricIndex = 0;
         AZ::TimeMs m_totalHistoryTimeMs = AZ::Time::ZeroTimeMs;
 
@@ -58,6 +63,41 @@ namespace Multiplayer
         void RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordFrameTime(AZ::TimeUs networkFrameTime);
+        void RecordEntityUpdateDeferred();
+        void RecordEntityUpdateStarvation(AZ::TimeMs starvationTimeMs);
+
+        //! The serialization stats recorded by a job thread, replayed on the main thread in the order they were recorded.
+        struct DeferredRecord
+        {
+            enum class Type : uint8_t
+            {
+                EntitySerializeStart,
+                ComponentSerializeEnd,
+                EntitySerializeStop,
+                PropertySent
+            };
+            Type m_type = Type::PropertySent;
+            AzNetworking::SerializerMode m_mode = AzNetworking::SerializerMode::ReadFromObject;
+            AZ::EntityId m_entityId;
+            const char* m_entityName = nullptr;
+            NetComponentId m_netComponentId = InvalidNetComponentId;
+            PropertyIndex m_propertyId = PropertyIndex{ 0 };
+            uint32_t m_totalBytes = 0;
+        };
+        using DeferredRecords = AZStd::vector<DeferredRecord>;
+
+        //! Logs the serialization stats recorded on the calling thread into deferredRecords instead of recording them, while set.
+        //! This lets job threads serialize entity updates without touching the shared stats and their events.
+        //! @param deferredRecords the log to record into, nullptr to record the stats again
+        static void SetThreadDeferredRecords(DeferredRecords* deferredRecords);
+
+        //! Returns the log the serialization stats recorded on the calling thread go into.
+        //! @return the log of the calling thread, nullptr if its stats are recorded
+        static DeferredRecords* GetThreadDeferredRecords();
+
+        //! Records the logged stats, into the log of the calling thread if it has one.
+        //! @param deferredRecords the log to replay
+        void ReplayDeferredRecords(const DeferredRecords& deferredRecords);
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
         Metric CalculateComponentPropertyUpdateSentMetrics(NetComponentId netComponentId) const;
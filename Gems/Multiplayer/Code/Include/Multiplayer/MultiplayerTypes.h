@@ -37,6 +37,9 @@ namespace Multiplayer
     //! The maximum number of entity updates we can stuff into a single update packet
     static constexpr uint32_t MaxAggregateEntityMessages = 2048;
 
+    //! The maximum number of acknowledged entity states kept to delta encode entity updates against
+    static constexpr uint32_t MaxEntityBaselines = 8;
+
     //! The maximum number of RPC's we can aggregate into a single packet
     static constexpr uint32_t MaxAggregateRpcMessages = 1024;
 
@@ -20,6 +20,7 @@
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/limits.h>
@@ -61,6 +62,15 @@ namespace Multiplayer
 
         void ActivatePendingEntities();
         void SendUpdates();
+
+        //! SendUpdates split in phases, so the entity updates of several connections can be serialized in parallel.
+        //! PrepareUpdates and SendPreparedUpdates must be called from the main thread, while SerializePreparedUpdates can run on
+        //! a job thread, alongside the SerializePreparedUpdates of other connections.
+        //! @{
+        void PrepareUpdates();
+        void SerializePreparedUpdates();
+        void SendPreparedUpdates();
+        //! @}
         void Clear(bool forMigration);
 
         bool SetEntityRebasing(NetworkEntityHandle& entityHandle);
@@ -115,13 +125,19 @@ namespace Multiplayer
 
         UpdateValidationResult ValidateUpdate(const NetworkEntityUpdateMessage& updateMessage, AzNetworking::PacketId packetId, EntityReplicator* entityReplicator);
 
+        //! Decodes the full entity state of an update message into m_baselineDecodeBuffer, against the baseline it references.
+        //! Returns false if the baseline isn't known.
+        bool DecodeBaselineDelta(EntityReplicator* entityReplicator, const NetworkEntityUpdateMessage& updateMessage);
+        //! Keeps the state decoded in m_baselineDecodeBuffer as the baseline of the packet, for the following updates of the entity.
+        void StoreBaseline(EntityReplicator* entityReplicator, AzNetworking::PacketId packetId);
+
         using RpcMessages = AZStd::list<NetworkEntityRpcMessage>;
         bool DispatchOrphanedRpc(NetworkEntityRpcMessage& message, EntityReplicator* entityReplicator);
 
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
 
-        void SendEntityUpdateMessages(EntityReplicatorList& replicatorList);
+        void SendEntityUpdateMessages(AZStd::size_t& nextUpdateIndex);
         void SendEntityRpcs(RpcMessages& rpcMessages, bool reliable);
         void SendEntityResets();
 
@@ -189,6 +205,29 @@ namespace Multiplayer
         NetEntityIdSet m_replicatorsPendingSend;
         NetEntityIdSet m_replicatorsPendingReset;
 
+        //! The send scheduling state of a replicator, proxy updates are sent by the priority they accumulated while waiting to be sent
+        struct ReplicatorSendState
+        {
+            float m_accumulatedPriority = 0.0f;
+            uint32_t m_lastSendSize = 0;
+            AZ::TimeMs m_pendingSinceMs = AZ::Time::ZeroTimeMs;
+        };
+        AZStd::unordered_map<NetEntityId, ReplicatorSendState> m_replicatorSendStates;
+
+        struct ProxySendCandidate
+        {
+            EntityReplicator* m_replicator = nullptr;
+            ReplicatorSendState* m_sendState = nullptr;
+        };
+        AZStd::vector<ProxySendCandidate> m_proxySendCandidates;
+
+        //! The replicators selected by PrepareUpdates, and the update message of each, serialized once by SerializePreparedUpdates
+        EntityReplicatorList m_preparedReplicators;
+        AZStd::vector<NetworkEntityUpdateMessage> m_preparedUpdates;
+
+        //! The full entity state of the update message being handled, decoded from its baseline
+        AzNetworking::PacketEncodingBuffer m_baselineDecodeBuffer;
+
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
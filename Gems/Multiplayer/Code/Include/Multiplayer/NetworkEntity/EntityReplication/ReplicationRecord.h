@@ -55,6 +55,10 @@ namespace Multiplayer
         void Subtract(const ReplicationRecord &rhs);
         bool HasChanges() const;
 
+        //! Returns true if both records flag the same properties for the same remote role, ignoring the consumed bits and the sent packet id.
+        //! Records with the same changes serialize the same properties of an entity.
+        bool HasSameChanges(const ReplicationRecord& rhs) const;
+
         bool Serialize(AzNetworking::ISerializer& serializer);
 
         void ConsumeAuthorityToClientBits(uint32_t consumedBits);
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/std/limits.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
 namespace Multiplayer
@@ -17,9 +18,20 @@ namespace Multiplayer
     class NetworkEntityTracker;
     class NetBindComponent;
 
+    //! Identifies the slot of an entity in the NetworkEntityTracker.
+    //! The generation is the one of the slot when the handle was bound, the slot's generation changes when its entity is removed.
+    struct NetworkEntitySlot
+    {
+        static constexpr uint32_t InvalidIndex = AZStd::numeric_limits<uint32_t>::max();
+
+        uint32_t m_index = InvalidIndex;
+        uint32_t m_generation = 0;
+    };
+
     //! @class ConstNetworkEntityHandle
     //! @brief This class provides a wrapping around handle ids.
-    //! It is optimized to avoid using the hashmap lookup unless the hashmap has had an item removed.
+    //! Handles to tracked entities are bound to the entity's slot in the NetworkEntityTracker, so checking that the entity
+    //! still exists doesn't need a hashmap lookup. Only handles to removed or untracked entities fall back to the lookup.
     class ConstNetworkEntityHandle
     {
     public:
@@ -87,6 +99,12 @@ namespace Multiplayer
 
     protected:
 
+        friend class NetworkEntityTracker;
+
+        //! Constructs a handle bound to the slot of a tracked entity.
+        ConstNetworkEntityHandle(AZ::Entity* entity, NetEntityId netEntityId, NetworkEntitySlot slot, const NetworkEntityTracker* entityTracker);
+
+        mutable NetworkEntitySlot m_slot;
         mutable uint32_t m_changeDirty = 0; // Optimization so we don't need to recheck the hashmap
         mutable AZ::Entity* m_entity = nullptr;
         mutable NetBindComponent* m_netBindComponent = nullptr;
@@ -121,6 +139,12 @@ namespace Multiplayer
 
         template <typename ComponentType>
         ComponentType* FindComponent();
+
+    private:
+
+        friend class NetworkEntityTracker;
+
+        NetworkEntityHandle(AZ::Entity* entity, NetEntityId netEntityId, NetworkEntitySlot slot, const NetworkEntityTracker* entityTracker);
     };
 }
 
@@ -68,6 +68,12 @@ namespace Multiplayer
         return lhs.m_netEntityId < rhs.m_netEntityId;
     }
 
+    inline NetworkEntityHandle::NetworkEntityHandle(
+        AZ::Entity* entity, NetEntityId netEntityId, NetworkEntitySlot slot, const NetworkEntityTracker* entityTracker)
+        : ConstNetworkEntityHandle(entity, netEntityId, slot, entityTracker)
+    {
+    }
+
     inline void NetworkEntityHandle::Init()
     {
         if (AZ::Entity* entity{ GetEntity() })
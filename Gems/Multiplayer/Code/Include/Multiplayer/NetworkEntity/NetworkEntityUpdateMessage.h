@@ -79,6 +79,18 @@ namespace Multiplayer
         //! @return the current value of PrefabEntityId
         const PrefabEntityId& GetPrefabEntityId() const;
 
+        //! Marks the data as the full entity state, delta encoded against a state the remote endpoint has already received.
+        //! @param baselinePacketId the packet id the baseline state was received with, InvalidPacketId if the data isn't delta encoded
+        void SetBaselinePacketId(AzNetworking::PacketId baselinePacketId);
+
+        //! Returns whether the data holds the full entity state, that the receiver keeps as a baseline for the following updates.
+        //! @return whether the data holds the full entity state
+        bool GetHasBaseline() const;
+
+        //! Gets the packet id of the state the data is delta encoded against.
+        //! @return the packet id of the baseline, InvalidPacketId if the data isn't delta encoded
+        AzNetworking::PacketId GetBaselinePacketId() const;
+
         //! Sets the current value for Data
         //! @param value the value to set Data to
         void SetData(const AzNetworking::PacketEncodingBuffer& value);
@@ -104,6 +116,8 @@ namespace Multiplayer
         bool           m_wasMigrated = false;
         bool           m_hasValidPrefabId = false;
         PrefabEntityId m_prefabEntityId;
+        bool           m_hasBaseline = false;
+        AzNetworking::PacketId m_baselinePacketId = AzNetworking::InvalidPacketId;
 
         // Only allocated if we actually have data
         // This is to prevent blowing out stack memory if we declare an array of these EntityUpdateMessages
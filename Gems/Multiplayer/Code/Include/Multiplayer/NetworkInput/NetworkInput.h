@@ -51,6 +51,10 @@ namespace Multiplayer
 
         void AttachNetBindComponent(NetBindComponent* netBindComponent);
 
+        //! Attaches component inputs that were allocated without a NetBindComponent.
+        //! Used by connections that send inputs for an entity that doesn't exist locally, like the bots of the MultiplayerBotSwarm.
+        void AttachComponentInputs(MultiplayerComponentInputVector&& componentInputs);
+
         bool Serialize(AzNetworking::ISerializer& serializer);
 
         //! Fetches a vector of datums detailing which values per component input were
@@ -29,6 +29,12 @@ namespace Multiplayer
         NetworkInput& operator[](uint32_t index);
         const NetworkInput& operator[](uint32_t index) const;
 
+        //! Sets the number of elements that are serialized, starting from the newest input at index 0.
+        //! The sender can leave out the inputs the receiver already processed, the receiver fills the elements that
+        //! weren't sent with copies of the oldest one that was.
+        void SetHistorySize(uint32_t historySize);
+        uint32_t GetHistorySize() const;
+
         bool Serialize(AzNetworking::ISerializer& serializer);
 
     private:
@@ -43,5 +49,6 @@ namespace Multiplayer
 
         ConstNetworkEntityHandle m_owner;
         AZStd::array<Wrapper, MaxElements> m_inputs;
+        uint8_t m_historySize = MaxElements;
     };
 }
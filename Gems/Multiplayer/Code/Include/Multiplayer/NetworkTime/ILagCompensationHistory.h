@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/EBus/Event.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    class ILagCompensationHistory;
+
+    using RecordHitVolumesEvent = AZ::Event<ILagCompensationHistory&>;
+
+    //! @class ILagCompensationHistory
+    //! @brief This is an AZ::Interface<> for validating hits against the hit volumes of past host frames.
+    //!
+    //! When hosting, the world bounds of the hit volumes are recorded once per host frame, in a ring buffer of RewindHistorySize
+    //! frames. Casts at a rewound frame test the recorded bounds directly, four volumes at a time, so validating a shot doesn't
+    //! need to rewind the physics scene. The bounds are conservative, a precise test against the hit entity can follow a hit.
+    class ILagCompensationHistory
+    {
+    public:
+        AZ_RTTI(ILagCompensationHistory, "{6B4C8F0E-2D1A-4E77-9C35-81F0A7D3B962}");
+
+        //! A hit volume intersected by a cast.
+        struct HitVolumeHit
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            //! The distance along the cast to the first intersection with the bounds of the volume
+            float m_distance = 0.0f;
+        };
+
+        ILagCompensationHistory() = default;
+        virtual ~ILagCompensationHistory() = default;
+
+        //! Adds a handler signaled when a host frame is recorded, which records the hit volumes of an entity with RecordHitVolume.
+        //! @param handler the handler to add
+        virtual void AddRecordHitVolumesHandler(RecordHitVolumesEvent::Handler& handler) = 0;
+
+        //! Records the world bounds of a hit volume into the frame being recorded, must only be called by the record handlers.
+        //! @param netEntityId the entity the hit volume belongs to
+        //! @param worldBounds the world bounds of the hit volume
+        virtual void RecordHitVolume(NetEntityId netEntityId, const AZ::Aabb& worldBounds) = 0;
+
+        //! Casts a ray against the hit volumes of a recorded frame.
+        //! @param frameId     the host frame to test against
+        //! @param blendFactor the factor used to blend the bounds of the previous frame into the frame, as for INetworkTime::AlterTime
+        //! @param origin      the origin of the ray
+        //! @param direction   the normalized direction of the ray
+        //! @param distance    the length of the ray
+        //! @param outHits     the hit volumes, sorted by distance, the vector is cleared first
+        //! @return false if the frame is no longer in the history
+        virtual bool RayCast(HostFrameId frameId, float blendFactor, const AZ::Vector3& origin, const AZ::Vector3& direction,
+            float distance, AZStd::vector<HitVolumeHit>& outHits) const = 0;
+
+        //! Sweeps a sphere against the hit volumes of a recorded frame.
+        //! @param frameId     the host frame to test against
+        //! @param blendFactor the factor used to blend the bounds of the previous frame into the frame, as for INetworkTime::AlterTime
+        //! @param origin      the start position of the sphere
+        //! @param direction   the normalized direction of the sweep
+        //! @param distance    the length of the sweep
+        //! @param radius      the radius of the sphere
+        //! @param outHits     the hit volumes, sorted by distance, the vector is cleared first
+        //! @return false if the frame is no longer in the history
+        virtual bool SphereCast(HostFrameId frameId, float blendFactor, const AZ::Vector3& origin, const AZ::Vector3& direction,
+            float distance, float radius, AZStd::vector<HitVolumeHit>& outHits) const = 0;
+
+        AZ_DISABLE_COPY_MOVE(ILagCompensationHistory);
+    };
+
+    // Convenience helpers
+    inline ILagCompensationHistory* GetLagCompensationHistory()
+    {
+        return AZ::Interface<ILagCompensationHistory>::Get();
+    }
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+
+namespace Multiplayer
+{
+    //! @class IReplicationPriorityScorer
+    //! @brief IReplicationPriorityScorer provides an interface for scoring the relevancy of entities replicated down to clients.
+    //!
+    //! By default, the entities around a player are prioritized by the inverse of their squared distance to the player.
+    //! Each tick an entity waits to be replicated, its priority is accumulated, and the entities with the highest accumulated
+    //! priority are sent first, within the entity count and byte limits of the connection. Raising the priority of an entity
+    //! makes it update more often when the connection can't send everything, it never stops an entity from being replicated.
+    //!
+    //! Use cases include prioritizing the entities in front of the player's camera, the entities the player is targeting,
+    //! or entities moving fast. To use it, register an implementation with AZ::Interface<IReplicationPriorityScorer>::Register().
+    class IReplicationPriorityScorer
+    {
+    public:
+        AZ_RTTI(IReplicationPriorityScorer, "{DBA3EE3F-3685-4AD2-9538-563294A8625D}");
+
+        virtual ~IReplicationPriorityScorer() = default;
+
+        //! Returns the replication priority of an entity for a connection.
+        //! Important: this method is a hot code path, it will be called over all entities around each player frequently.
+        //!
+        //! @param entity the entity to be scored
+        //! @param controllerEntity player's entity for the associated connection
+        //! @param connectionId the connection the entity is replicated to
+        //! @param distancePriority the default priority of the entity, the inverse of its squared distance to the player
+        //! @return the priority of the entity, higher values replicate more often
+        virtual float ScoreEntity(AZ::Entity* entity, ConstNetworkEntityHandle controllerEntity, AzNetworking::ConnectionId connectionId, float distancePriority) = 0;
+    };
+}
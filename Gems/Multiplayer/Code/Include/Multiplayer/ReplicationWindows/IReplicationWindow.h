@@ -45,6 +45,11 @@ namespace Multiplayer
         //! @return the max number of entities we can send updates for in one frame
         virtual uint32_t GetMaxProxyEntityReplicatorSendCount() const = 0;
 
+        //! Max number of bytes of proxy entity updates we can send in one frame, updates past the limit are deferred to later frames.
+        //! Autonomous entity updates are always sent, but count against the limit.
+        //! @return the max number of bytes of entity updates we can send in one frame, 0 for no limit
+        virtual uint32_t GetMaxProxyEntityReplicatorSendBytes() const = 0;
+
         //! Returns true if the provided network entity is within this replication window.
         //! @param entityPtr the handle of the entity to test for inclusion
         //! @param outNetworkRole output containing the network role of the requested entity if found
@@ -0,0 +1,581 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <BotSwarm/MultiplayerBotSwarm.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/MultiplayerComponentRegistry.h>
+#include <Multiplayer/MultiplayerMetrics.h>
+#include <Multiplayer/MultiplayerPerformanceStats.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Time/ITime.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Framework/INetworking.h>
+
+namespace Multiplayer
+{
+    using namespace AzNetworking;
+
+    AZ_CVAR_EXTERNED(AZ::CVarFixedString, cl_serveraddr);
+    AZ_CVAR_EXTERNED(uint16_t, cl_serverport);
+    AZ_CVAR_EXTERNED(ProtocolType, sv_protocol);
+    AZ_CVAR_EXTERNED(AZ::TimeMs, cl_InputRateMs);
+
+    AZ_CVAR(int32_t, bot_lossPercent, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Percentage of packets the bots of the bot swarm drop when sending, applied to bots connected afterwards. Not available in release builds.");
+    AZ_CVAR(AZ::TimeMs, bot_latencyMs, AZ::Time::ZeroTimeMs, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Latency the bots of the bot swarm add to the packets they send, applied to bots connected afterwards. Not available in release builds.");
+    AZ_CVAR(AZ::TimeMs, bot_varianceMs, AZ::Time::ZeroTimeMs, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Random variance of the latency the bots of the bot swarm add to the packets they send. Not available in release builds.");
+    AZ_CVAR(AZ::TimeMs, bot_reportPeriodMs, AZ::TimeMs{ 1000 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "How often in milliseconds the bot swarm stats are recorded.");
+
+    namespace
+    {
+        // Upper bound of the rpc indices searched for the input rpc.
+        constexpr uint16_t MaxRpcIndex = 256;
+
+        // Parameters of LocalPredictionPlayerInputComponent::SendClientInput, serialized the same way as the generated rpc struct.
+        struct SendClientInputRpcStruct
+            : public IRpcParamStruct
+        {
+            SendClientInputRpcStruct(const NetworkInputArray& inputArray, AZ::HashValue32 stateHash)
+                : m_inputArray(inputArray)
+                , m_stateHash(stateHash)
+            {
+                ;
+            }
+
+            bool Serialize(AzNetworking::ISerializer& serializer) override
+            {
+                return serializer.Serialize(m_inputArray, "InputArray")
+                    && serializer.Serialize(m_stateHash, "StateHash");
+            }
+
+            NetworkInputArray m_inputArray;
+            AZ::HashValue32 m_stateHash;
+        };
+
+        // Components are registered with consecutive ids, so the registry can be iterated until the first unknown id.
+        template <typename Visitor>
+        void VisitMultiplayerComponents(MultiplayerComponentRegistry& registry, const Visitor& visitor)
+        {
+            for (NetComponentId netComponentId = NetComponentId{ 0 }; netComponentId != InvalidNetComponentId; ++netComponentId)
+            {
+                const MultiplayerComponentRegistry::ComponentData& componentData = registry.GetMultiplayerComponentData(netComponentId);
+                if (componentData.m_componentName.IsEmpty())
+                {
+                    break;
+                }
+                visitor(netComponentId, componentData);
+            }
+        }
+    }
+
+    MultiplayerBotSwarm::MultiplayerBotSwarm()
+    {
+        m_connectConsoleCommand = AZStd::make_unique<AZ::ConsoleFunctor<MultiplayerBotSwarm, false>>(
+            "bot_connect",
+            "Connects bots that simulate clients to a remote host, usage: bot_connect <count> [address[:port]]",
+            AZ::ConsoleFunctorFlags::DontReplicate | AZ::ConsoleFunctorFlags::DontDuplicate,
+            AZ::TypeId{},
+            *this,
+            &MultiplayerBotSwarm::ConnectConsoleCommand);
+
+        m_disconnectConsoleCommand = AZStd::make_unique<AZ::ConsoleFunctor<MultiplayerBotSwarm, false>>(
+            "bot_disconnect",
+            "Disconnects all bots connected with bot_connect",
+            AZ::ConsoleFunctorFlags::DontReplicate | AZ::ConsoleFunctorFlags::DontDuplicate,
+            AZ::TypeId{},
+            *this,
+            &MultiplayerBotSwarm::DisconnectConsoleCommand);
+    }
+
+    MultiplayerBotSwarm::~MultiplayerBotSwarm()
+    {
+        Disconnect();
+    }
+
+    void MultiplayerBotSwarm::Connect(const IpAddress& remoteAddress, uint32_t botCount)
+    {
+        MultiplayerComponentRegistry* registry = GetMultiplayerComponentRegistry();
+        if (registry == nullptr)
+        {
+            AZLOG_WARN("Bot swarm requires an active multiplayer system, no bots were connected");
+            return;
+        }
+
+        if (!ResolveInputRpc())
+        {
+            AZLOG_WARN("LocalPredictionPlayerInputComponent is not registered, bots will not send inputs");
+        }
+
+        INetworking* networking = AZ::Interface<INetworking>::Get();
+        for (uint32_t i = 0; i < botCount; ++i)
+        {
+            AZStd::unique_ptr<Bot> bot = AZStd::make_unique<Bot>();
+            bot->m_botIndex = m_nextBotIndex++;
+
+            // Connections are identified by their remote address, so every bot needs an interface with its own socket
+            bot->m_interfaceName = AZ::Name(AZStd::string::format("MultiplayerBotSwarm%u", bot->m_botIndex));
+            bot->m_networkInterface = networking->CreateNetworkInterface(bot->m_interfaceName, sv_protocol, TrustZone::ExternalClientToServer, *this);
+            if (bot->m_networkInterface == nullptr)
+            {
+                AZLOG_WARN("Failed to create the network interface of bot %u", bot->m_botIndex);
+                break;
+            }
+
+            // Bots don't have local entities, so they send the inputs of all components that provide one
+            MultiplayerComponentInputVector componentInputs;
+            VisitMultiplayerComponents(*registry, [registry, &componentInputs](NetComponentId netComponentId, const MultiplayerComponentRegistry::ComponentData&)
+            {
+                if (AZStd::unique_ptr<IMultiplayerComponentInput> componentInput = registry->AllocateComponentInput(netComponentId))
+                {
+                    componentInputs.push_back(AZStd::move(componentInput));
+                }
+            });
+            bot->m_inputArray[0].AttachComponentInputs(AZStd::move(componentInputs));
+            for (uint32_t inputIndex = 1; inputIndex < NetworkInputArray::MaxElements; ++inputIndex)
+            {
+                bot->m_inputArray[inputIndex] = bot->m_inputArray[0];
+            }
+
+            // OnConnect is signaled from within Connect()
+            m_connectingBot = bot.get();
+            const ConnectionId connectionId = bot->m_networkInterface->Connect(remoteAddress);
+            m_connectingBot = nullptr;
+            if (connectionId == InvalidConnectionId)
+            {
+                AZLOG_WARN("Bot %u failed to connect to %s", bot->m_botIndex, remoteAddress.GetString().c_str());
+                networking->DestroyNetworkInterface(bot->m_interfaceName);
+                continue;
+            }
+
+            m_bots.push_back(AZStd::move(bot));
+        }
+
+        if (!m_bots.empty())
+        {
+            if (!m_sendInputsEvent.IsScheduled())
+            {
+                m_sendInputsEvent.Enqueue(cl_InputRateMs, true);
+            }
+            if (!m_reportStatsEvent.IsScheduled())
+            {
+                m_reportStatsEvent.Enqueue(bot_reportPeriodMs, true);
+            }
+        }
+    }
+
+    void MultiplayerBotSwarm::Disconnect()
+    {
+        m_sendInputsEvent.RemoveFromQueue();
+        m_reportStatsEvent.RemoveFromQueue();
+
+        INetworking* networking = AZ::Interface<INetworking>::Get();
+        for (AZStd::unique_ptr<Bot>& bot : m_bots)
+        {
+            if (bot->m_connection != nullptr)
+            {
+                bot->m_networkInterface->Disconnect(bot->m_connection->GetConnectionId(), DisconnectReason::TerminatedByUser);
+            }
+            if (networking != nullptr)
+            {
+                networking->DestroyNetworkInterface(bot->m_interfaceName);
+            }
+        }
+        m_bots.clear();
+    }
+
+    uint32_t MultiplayerBotSwarm::GetBotCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_bots.size());
+    }
+
+    void MultiplayerBotSwarm::AddBotInputHandler(BotInputEvent::Handler& handler)
+    {
+        handler.Connect(m_botInputEvent);
+    }
+
+    bool MultiplayerBotSwarm::IsHandshakeComplete(IConnection* connection) const
+    {
+        const Bot* bot = GetBot(connection);
+        return (bot != nullptr) && bot->m_handshakeComplete;
+    }
+
+    bool MultiplayerBotSwarm::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Connect& packet
+    )
+    {
+        // Bots never accept connections
+        return false;
+    }
+
+    bool MultiplayerBotSwarm::HandleRequest
+    (
+        IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Accept& packet
+    )
+    {
+        Bot* bot = GetBot(connection);
+        if (bot == nullptr)
+        {
+            return false;
+        }
+
+        // Bots don't load the map, they are ready for entity updates right away
+        bot->m_handshakeComplete = true;
+        connection->SendReliablePacket(MultiplayerPackets::ReadyForEntityUpdates(true));
+        return true;
+    }
+
+    bool MultiplayerBotSwarm::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ReadyForEntityUpdates& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerBotSwarm::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::SyncConsole& packet
+    )
+    {
+        // Replicated cvars like net_useInputDeltaSerialization change how inputs are serialized, so apply them like a client would
+        AZ::IConsole* console = AZ::Interface<AZ::IConsole>::Get();
+        for (auto& command : packet.GetCommandSet())
+        {
+            console->PerformCommand(command.c_str(), AZ::ConsoleSilentMode::Silent, AZ::ConsoleInvokedFrom::AzNetworking, AZ::ConsoleFunctorFlags::Null);
+        }
+        return true;
+    }
+
+    bool MultiplayerBotSwarm::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ConsoleCommand& packet
+    )
+    {
+        return true;
+    }
+
+    bool MultiplayerBotSwarm::HandleRequest
+    (
+        IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::EntityUpdates& packet
+    )
+    {
+        Bot* bot = GetBot(connection);
+        if (bot == nullptr)
+        {
+            return false;
+        }
+
+        for (const NetworkEntityUpdateMessage& updateMessage : packet.GetEntityMessages())
+        {
+            const NetEntityId netEntityId = updateMessage.GetEntityId();
+            if (updateMessage.GetIsDelete())
+            {
+                bot->m_replicatedEntities.erase(netEntityId);
+                if (bot->m_autonomousEntityId == netEntityId)
+                {
+                    bot->m_autonomousEntityId = InvalidNetEntityId;
+                }
+                continue;
+            }
+
+            bot->m_replicatedEntities.insert(netEntityId);
+            if ((bot->m_autonomousEntityId == InvalidNetEntityId) && (updateMessage.GetNetworkRole() == NetEntityRole::Autonomous))
+            {
+                // The first autonomous entity is the hierarchy root of the player, which handles the inputs
+                bot->m_autonomousEntityId = netEntityId;
+            }
+        }
+
+        if ((bot->m_hostFrameId == InvalidHostFrameId) || (packet.GetHostFrameId() > bot->m_hostFrameId))
+        {
+            bot->m_hostFrameId = packet.GetHostFrameId();
+            bot->m_hostTimeMs = packet.GetHostTimeMs();
+        }
+
+        const AZ::TimeMs hostTimeOffsetMs = AZ::GetRealElapsedTimeMs() - packet.GetHostTimeMs();
+        if (!bot->m_hasHostTimeOffset || (hostTimeOffsetMs < bot->m_minHostTimeOffsetMs))
+        {
+            bot->m_minHostTimeOffsetMs = hostTimeOffsetMs;
+            bot->m_hasHostTimeOffset = true;
+        }
+
+        const AZ::TimeMs halfRttMs = AZ::SecondsToTimeMs(connection->GetMetrics().m_connectionRtt.GetRoundTripTimeSeconds() * 0.5);
+        const AZ::TimeMs replicationLagMs = hostTimeOffsetMs - bot->m_minHostTimeOffsetMs + halfRttMs;
+        bot->m_replicationLagTotalMs += replicationLagMs;
+        bot->m_replicationLagMaxMs = AZStd::max(bot->m_replicationLagMaxMs, replicationLagMs);
+        ++bot->m_replicationLagSamples;
+        return true;
+    }
+
+    bool MultiplayerBotSwarm::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::EntityRpcs& packet
+    )
+    {
+        // Rpcs, including the input corrections of the autonomous entity, have no local entity to be handled on
+        return true;
+    }
+
+    bool MultiplayerBotSwarm::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::RequestReplicatorReset& packet
+    )
+    {
+        return true;
+    }
+
+    bool MultiplayerBotSwarm::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ClientMigration& packet
+    )
+    {
+        // Bots stay connected to the host they were connected to
+        return true;
+    }
+
+    bool MultiplayerBotSwarm::HandleRequest
+    (
+        IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::VersionMismatch& packet
+    )
+    {
+        AZLOG_ERROR("Bot swarm multiplayer components do not match the components of the host %s", connection->GetRemoteAddress().GetString().c_str());
+        connection->Disconnect(DisconnectReason::VersionMismatch, TerminationEndpoint::Local);
+        return true;
+    }
+
+    ConnectResult MultiplayerBotSwarm::ValidateConnect
+    (
+        [[maybe_unused]] const IpAddress& remoteAddress,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] ISerializer& serializer
+    )
+    {
+        return ConnectResult::Rejected;
+    }
+
+    void MultiplayerBotSwarm::OnConnect(IConnection* connection)
+    {
+        Bot* bot = m_connectingBot;
+        if (bot == nullptr)
+        {
+            return;
+        }
+
+        bot->m_connection = connection;
+        connection->SetUserData(bot);
+
+        // Only applied by the UDP transport in builds with ENABLE_LATENCY_DEBUG
+        connection->GetConnectionQuality() = ConnectionQuality(bot_lossPercent, bot_latencyMs, bot_varianceMs);
+
+        // A temporary user id of 0 makes the host spawn a new player for each bot
+        connection->SendReliablePacket(MultiplayerPackets::Connect(0, 0, "", GetMultiplayerComponentRegistry()->GetSystemVersionHash()));
+    }
+
+    PacketDispatchResult MultiplayerBotSwarm::OnPacketReceived(IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer)
+    {
+        return MultiplayerPackets::DispatchPacket(connection, packetHeader, serializer, *this);
+    }
+
+    void MultiplayerBotSwarm::OnDisconnect(IConnection* connection, [[maybe_unused]] DisconnectReason reason, TerminationEndpoint endpoint)
+    {
+        Bot* bot = GetBot(connection);
+        if (bot == nullptr)
+        {
+            return;
+        }
+
+        if (endpoint == TerminationEndpoint::Remote)
+        {
+            AZLOG_INFO("Bot %u was disconnected by the host, reason %s", bot->m_botIndex, ToString(reason).data());
+        }
+
+        // The network interface of the bot is destroyed on Disconnect(), it can't be destroyed from within its own update
+        bot->m_connection = nullptr;
+        bot->m_handshakeComplete = false;
+        bot->m_autonomousEntityId = InvalidNetEntityId;
+        bot->m_replicatedEntities.clear();
+        connection->SetUserData(nullptr);
+    }
+
+    void MultiplayerBotSwarm::ConnectConsoleCommand(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.empty())
+        {
+            AZLOG_WARN("Usage: bot_connect <count> [address[:port]]");
+            return;
+        }
+
+        const uint32_t botCount = aznumeric_cast<uint32_t>(atol(AZ::CVarFixedString(arguments[0]).c_str()));
+
+        AZ::CVarFixedString remoteAddress = cl_serveraddr;
+        uint16_t port = cl_serverport;
+        if (arguments.size() > 1)
+        {
+            remoteAddress = arguments[1];
+            const AZStd::size_t portSeparator = remoteAddress.find_first_of(':');
+            if (portSeparator != AZStd::string::npos)
+            {
+                port = aznumeric_cast<uint16_t>(atol(remoteAddress.c_str() + portSeparator + 1));
+                remoteAddress.resize(portSeparator);
+            }
+        }
+
+        Connect(IpAddress(remoteAddress.c_str(), port, sv_protocol), botCount);
+    }
+
+    void MultiplayerBotSwarm::DisconnectConsoleCommand([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        Disconnect();
+    }
+
+    MultiplayerBotSwarm::Bot* MultiplayerBotSwarm::GetBot(IConnection* connection) const
+    {
+        return (connection != nullptr) ? reinterpret_cast<Bot*>(connection->GetUserData()) : nullptr;
+    }
+
+    bool MultiplayerBotSwarm::ResolveInputRpc()
+    {
+        if (m_inputRpcResolved)
+        {
+            return true;
+        }
+
+        // The generated component ids and rpc indices are private to the component, so find them by name
+        const AZ::Name inputComponentName("LocalPredictionPlayerInputComponent");
+
+        MultiplayerComponentRegistry* registry = GetMultiplayerComponentRegistry();
+        VisitMultiplayerComponents(*registry, [this, registry, &inputComponentName](NetComponentId netComponentId, const MultiplayerComponentRegistry::ComponentData& componentData)
+        {
+            if (m_inputRpcResolved || (componentData.m_componentName != inputComponentName))
+            {
+                return;
+            }
+            for (uint16_t rpcIndex = 0; rpcIndex < MaxRpcIndex; ++rpcIndex)
+            {
+                if (strcmp(registry->GetComponentRpcName(netComponentId, RpcIndex{ rpcIndex }), "SendClientInput") == 0)
+                {
+                    m_inputComponentId = netComponentId;
+                    m_sendClientInputRpcIndex = RpcIndex{ rpcIndex };
+                    m_inputRpcResolved = true;
+                    return;
+                }
+            }
+        });
+        return m_inputRpcResolved;
+    }
+
+    void MultiplayerBotSwarm::SendInputs()
+    {
+        if (!m_inputRpcResolved)
+        {
+            return;
+        }
+
+        for (AZStd::unique_ptr<Bot>& bot : m_bots)
+        {
+            if (!bot->m_handshakeComplete || (bot->m_autonomousEntityId == InvalidNetEntityId))
+            {
+                continue;
+            }
+
+            // Like a client, every input also carries the previous inputs to hide packet loss
+            NetworkInputArray& inputArray = bot->m_inputArray;
+            for (uint32_t inputIndex = NetworkInputArray::MaxElements - 1; inputIndex > 0; --inputIndex)
+            {
+                inputArray[inputIndex] = inputArray[inputIndex - 1];
+            }
+
+            NetworkInput& input = inputArray[0];
+            input.SetClientInputId(++bot->m_clientInputId);
+            input.SetHostFrameId(bot->m_hostFrameId);
+            input.SetHostTimeMs(bot->m_hostTimeMs);
+            input.SetHostBlendFactor(1.0f);
+            m_botInputEvent.Signal(bot->m_botIndex, input);
+
+            // Bots don't simulate their entity, so the state hash never matches and the host sends corrections,
+            // the same as for a client with a client side prediction error every input
+            SendClientInputRpcStruct rpcStruct(inputArray, AZ::HashValue32{ 0 });
+            NetworkEntityRpcMessage rpcMessage(RpcDeliveryType::AutonomousToAuthority, bot->m_autonomousEntityId, m_inputComponentId, m_sendClientInputRpcIndex, ReliabilityType::Unreliable);
+            rpcMessage.SetRpcParams(rpcStruct);
+
+            NetworkEntityRpcVector entityRpcVector;
+            entityRpcVector.push_back(AZStd::move(rpcMessage));
+            MultiplayerPackets::EntityRpcs entityRpcsPacket;
+            entityRpcsPacket.SetEntityRpcs(entityRpcVector);
+            bot->m_connection->SendUnreliablePacket(entityRpcsPacket);
+        }
+    }
+
+    void MultiplayerBotSwarm::ReportStats()
+    {
+        uint32_t connectedBots = 0;
+        double receivedBytesPerSecond = 0.0;
+        double sentBytesPerSecond = 0.0;
+        double roundTripTimeSeconds = 0.0;
+        AZ::TimeMs replicationLagTotalMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeMs replicationLagMaxMs = AZ::Time::ZeroTimeMs;
+        uint32_t replicationLagSamples = 0;
+        AZStd::size_t replicatedEntities = 0;
+
+        for (AZStd::unique_ptr<Bot>& bot : m_bots)
+        {
+            if (bot->m_handshakeComplete)
+            {
+                const ConnectionMetrics& metrics = bot->m_connection->GetMetrics();
+                ++connectedBots;
+                receivedBytesPerSecond += metrics.m_recvDatarate.GetBytesPerSecond();
+                sentBytesPerSecond += metrics.m_sendDatarate.GetBytesPerSecond();
+                roundTripTimeSeconds += metrics.m_connectionRtt.GetRoundTripTimeSeconds();
+                replicationLagTotalMs += bot->m_replicationLagTotalMs;
+                replicationLagMaxMs = AZStd::max(replicationLagMaxMs, bot->m_replicationLagMaxMs);
+                replicationLagSamples += bot->m_replicationLagSamples;
+                replicatedEntities += bot->m_replicatedEntities.size();
+            }
+
+            bot->m_replicationLagTotalMs = AZ::Time::ZeroTimeMs;
+            bot->m_replicationLagMaxMs = AZ::Time::ZeroTimeMs;
+            bot->m_replicationLagSamples = 0;
+        }
+
+        const double botCount = static_cast<double>(AZStd::max(connectedBots, 1u));
+        const double lagSampleCount = static_cast<double>(AZStd::max(replicationLagSamples, 1u));
+        SET_PERFORMANCE_STAT(MultiplayerStat_BotConnectionCount, connectedBots);
+        SET_PERFORMANCE_STAT(MultiplayerStat_BotReceivedBytesPerSecond, receivedBytesPerSecond / botCount);
+        SET_PERFORMANCE_STAT(MultiplayerStat_BotSentBytesPerSecond, sentBytesPerSecond / botCount);
+        SET_PERFORMANCE_STAT(MultiplayerStat_BotRoundTripTimeMs, roundTripTimeSeconds * 1000.0 / botCount);
+        SET_PERFORMANCE_STAT(MultiplayerStat_BotReplicationLagMs, static_cast<double>(replicationLagTotalMs) / lagSampleCount);
+        SET_PERFORMANCE_STAT(MultiplayerStat_BotMaxReplicationLagMs, replicationLagMaxMs);
+        SET_PERFORMANCE_STAT(MultiplayerStat_BotReplicatedEntities, static_cast<double>(replicatedEntities) / botCount);
+    }
+}
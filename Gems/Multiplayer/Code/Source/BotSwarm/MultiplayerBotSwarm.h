@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
+#include <Multiplayer/NetworkInput/NetworkInputArray.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/EBus/Event.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+
+namespace AzNetworking
+{
+    class INetworkInterface;
+}
+
+namespace Multiplayer
+{
+    //! MultiplayerBotSwarm simulates many client connections to a server from a single headless process, so servers can be
+    //! load tested without running a client application per player.
+    //! Each bot opens its own network interface, performs the regular client handshake and then sends a NetworkInput to
+    //! the autonomous entity the server spawned for it at the client input rate. Bots don't spawn entities, they only keep
+    //! track of which entities are replicated to them and when the entity updates were sent by the host.
+    //! The per bot bandwidth, round trip time and replication lag are reported through the stats of the BotSwarm group.
+    class MultiplayerBotSwarm final
+        : public AzNetworking::IConnectionListener
+    {
+    public:
+        //! Signaled before a bot sends an input, so game code can script the component inputs of each bot.
+        using BotInputEvent = AZ::Event<uint32_t, NetworkInput&>;
+
+        MultiplayerBotSwarm();
+        ~MultiplayerBotSwarm();
+
+        //! Connects botCount additional bots to the host at remoteAddress.
+        void Connect(const AzNetworking::IpAddress& remoteAddress, uint32_t botCount);
+
+        //! Disconnects all bots and destroys their network interfaces.
+        void Disconnect();
+
+        uint32_t GetBotCount() const;
+
+        void AddBotInputHandler(BotInputEvent::Handler& handler);
+
+        bool IsHandshakeComplete(AzNetworking::IConnection* connection) const;
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Connect& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Accept& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ReadyForEntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::SyncConsole& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ConsoleCommand& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityRpcs& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::RequestReplicatorReset& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ClientMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::VersionMismatch& packet);
+
+        //! IConnectionListener interface
+        //! @{
+        AzNetworking::ConnectResult ValidateConnect(const AzNetworking::IpAddress& remoteAddress, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnConnect(AzNetworking::IConnection* connection) override;
+        AzNetworking::PacketDispatchResult OnPacketReceived(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnPacketLost([[maybe_unused]] AzNetworking::IConnection* connection, [[maybe_unused]] AzNetworking::PacketId packetId) override {}
+        void OnDisconnect(AzNetworking::IConnection* connection, AzNetworking::DisconnectReason reason, AzNetworking::TerminationEndpoint endpoint) override;
+        //! @}
+
+    private:
+        struct Bot
+        {
+            uint32_t m_botIndex = 0;
+            AZ::Name m_interfaceName;
+            AzNetworking::INetworkInterface* m_networkInterface = nullptr;
+            AzNetworking::IConnection* m_connection = nullptr;
+            bool m_handshakeComplete = false;
+
+            NetEntityId m_autonomousEntityId = InvalidNetEntityId;
+            AZStd::unordered_set<NetEntityId> m_replicatedEntities;
+            HostFrameId m_hostFrameId = InvalidHostFrameId;
+            AZ::TimeMs m_hostTimeMs = AZ::Time::ZeroTimeMs;
+
+            // The smallest difference between the local time and the host time of an update, which is the one way
+            // latency plus the clock offset. Update delays beyond it are reported as replication lag.
+            AZ::TimeMs m_minHostTimeOffsetMs = AZ::Time::ZeroTimeMs;
+            bool m_hasHostTimeOffset = false;
+            AZ::TimeMs m_replicationLagTotalMs = AZ::Time::ZeroTimeMs;
+            AZ::TimeMs m_replicationLagMaxMs = AZ::Time::ZeroTimeMs;
+            uint32_t m_replicationLagSamples = 0;
+
+            ClientInputId m_clientInputId = ClientInputId{ 0 };
+            NetworkInputArray m_inputArray;
+        };
+
+        void ConnectConsoleCommand(const AZ::ConsoleCommandContainer& arguments);
+        void DisconnectConsoleCommand(const AZ::ConsoleCommandContainer& arguments);
+
+        Bot* GetBot(AzNetworking::IConnection* connection) const;
+        bool ResolveInputRpc();
+        void SendInputs();
+        void ReportStats();
+
+        AZStd::vector<AZStd::unique_ptr<Bot>> m_bots;
+        Bot* m_connectingBot = nullptr;
+        uint32_t m_nextBotIndex = 0;
+
+        NetComponentId m_inputComponentId = InvalidNetComponentId;
+        RpcIndex m_sendClientInputRpcIndex = RpcIndex{ 0 };
+        bool m_inputRpcResolved = false;
+
+        BotInputEvent m_botInputEvent;
+
+        AZStd::unique_ptr<AZ::ConsoleFunctor<MultiplayerBotSwarm, false>> m_connectConsoleCommand;
+        AZStd::unique_ptr<AZ::ConsoleFunctor<MultiplayerBotSwarm, false>> m_disconnectConsoleCommand;
+
+        AZ::ScheduledEvent m_sendInputsEvent{ [this]()
+        {
+            SendInputs();
+        }, AZ::Name("MultiplayerBotSwarm SendInputs") };
+        AZ::ScheduledEvent m_reportStatsEvent{ [this]()
+        {
+            ReportStats();
+        }, AZ::Name("MultiplayerBotSwarm ReportStats") };
+    };
+}
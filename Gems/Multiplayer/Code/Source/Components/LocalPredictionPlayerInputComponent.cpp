@@ -9,12 +9,15 @@
 #include <Multiplayer/Components/LocalPredictionPlayerInputComponent.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzNetworking/ConnectionLayer/SequenceGenerator.h>
 #include <AzNetworking/Serialization/HashSerializer.h>
 #include <AzNetworking/Serialization/StringifySerializer.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
 #include <Multiplayer/MultiplayerDebug.h>
+#include <Multiplayer/MultiplayerMetrics.h>
+#include <Multiplayer/MultiplayerPerformanceStats.h>
 
 namespace Multiplayer
 {
@@ -27,6 +30,10 @@ namespace Multiplayer
     AZ_CVAR(uint32_t, cl_PredictiveStateHistorySize, 120, nullptr, AZ::ConsoleFunctorFlags::Null, "Controls how many inputs of predictive state should be retained for debugging desyncs");
 #endif
 
+#if AZ_TRAIT_CLIENT
+    AZ_CVAR(bool, cl_OmitProcessedInputs, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If enabled, inputs the server has already processed are left out of the input history sent with every input");
+#endif
+
 #if AZ_TRAIT_SERVER
     AZ_CVAR(bool, sv_ForceCorrections, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If enabled, the server will force a correction for every input received for debugging");
     AZ_CVAR(bool, sv_EnableCorrections, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Enables server corrections on autonomous proxy desyncs");
@@ -274,6 +281,9 @@ namespace Multiplayer
             }
         }
 
+        // Lets the client leave the inputs we already have out of its input history
+        SetLastProcessedInputId(m_lastClientInputId);
+
         if (sv_ForceCorrections || (sv_EnableCorrections && (currentTimeMs - m_lastCorrectionSentTimeMs > sv_MinCorrectionTimeMs)))
         {
             m_lastCorrectionSentTimeMs = currentTimeMs;
@@ -387,6 +397,8 @@ namespace Multiplayer
             // Also don't bother with any cheat detection here, because the input array is limited in size and at most and can only be sent once
             // So this highly constrains anything a malicious client can do
         }
+
+        SetLastProcessedInputId(GetLastInputId());
     }
 
     void LocalPredictionPlayerInputComponentController::UpdateBankedTime(AZ::TimeMs deltaTimeMs)
@@ -529,6 +541,7 @@ namespace Multiplayer
 #endif
 
         const double clientInputRateSec = AZ::TimeMsToSecondsDouble(cl_InputRateMs);
+        const AZStd::chrono::steady_clock::time_point replayStartTime = AZStd::chrono::steady_clock::now();
         for (uint32_t replayIndex = startReplayIndex; replayIndex < inputHistorySize; ++replayIndex)
         {
             // Reprocess the input for this frame
@@ -538,6 +551,10 @@ namespace Multiplayer
 
             AZLOG(NET_Prediction, "Replayed InputId=%d", aznumeric_cast<int32_t>(input.GetClientInputId()));
         }
+
+        const auto replayDuration = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - replayStartTime);
+        SET_PERFORMANCE_STAT(MultiplayerStat_CorrectionReplayTimeUs, AZ::TimeUs{ replayDuration.count() });
+        SET_PERFORMANCE_STAT(MultiplayerStat_CorrectionReplayedInputs, inputHistorySize - startReplayIndex);
     }
 
     void LocalPredictionPlayerInputComponentController::ForceEnableAutonomousUpdate()
@@ -650,6 +667,17 @@ namespace Multiplayer
                 inputArray[static_cast<uint32_t>(i)] = m_inputHistory[historyIndex];
             }
 
+            if (cl_OmitProcessedInputs)
+            {
+                // The server replicates the id of the last input it processed, it only needs the inputs after that one
+                const ClientInputId lastProcessedInputId = GetLastProcessedInputId();
+                if (AzNetworking::SequenceMoreRecent(m_clientInputId, lastProcessedInputId))
+                {
+                    // The subtraction intentionally wraps around
+                    inputArray.SetHistorySize(aznumeric_cast<uint32_t>(m_clientInputId - lastProcessedInputId));
+                }
+            }
+
 #ifndef AZ_RELEASE_BUILD
             if (cl_EnableDesyncDebugging)
             {
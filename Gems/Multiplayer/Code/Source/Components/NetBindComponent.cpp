@@ -449,7 +449,14 @@ namespace Multiplayer
     void NetBindComponent::ReprocessInput(NetworkInput& networkInput, float deltaTime)
     {
         m_isReprocessingInput = true;
-        ProcessInput(networkInput, deltaTime);
+        m_isProcessingInput = true;
+        AZ_Assert((HasController()), "Incorrect network role for input processing");
+        for (MultiplayerComponent* multiplayerComponent : m_multiplayerReplayInputComponentVector)
+        {
+            multiplayerComponent->GetController()->ProcessInputFromScript(networkInput, deltaTime);
+            multiplayerComponent->GetController()->ProcessInput(networkInput, deltaTime);
+        }
+        m_isProcessingInput = false;
         m_isReprocessingInput = false;
     }
 
@@ -856,6 +863,15 @@ namespace Multiplayer
                     return left->GetController()->GetInputOrder() < right->GetController()->GetInputOrder();
                 }
         );
+
+        m_multiplayerReplayInputComponentVector.clear();
+        for (MultiplayerComponent* multiplayerComponent : m_multiplayerInputComponentVector)
+        {
+            if (multiplayerComponent->GetController()->IsInputReplayRequired())
+            {
+                m_multiplayerReplayInputComponentVector.push_back(multiplayerComponent);
+            }
+        }
     }
 
     void NetBindComponent::StopEntity()
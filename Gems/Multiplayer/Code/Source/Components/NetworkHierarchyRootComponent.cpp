@@ -493,7 +493,15 @@ namespace Multiplayer
                     if (netComp->HasController())
                     {
                         subInput.GetNetworkInput().SetClientInputId(input.GetClientInputId());
-                        netComp->ProcessInput(subInput.GetNetworkInput(), deltaTime);
+                        if (GetNetBindComponent()->IsReprocessingInput())
+                        {
+                            // Children replay corrected inputs the same way as the root
+                            netComp->ReprocessInput(subInput.GetNetworkInput(), deltaTime);
+                        }
+                        else
+                        {
+                            netComp->ProcessInput(subInput.GetNetworkInput(), deltaTime);
+                        }
                     }
                 }
             }
@@ -40,6 +40,20 @@ namespace Multiplayer
 
         m_colliderOffSetTransform = AZ::Transform::CreateFromQuaternionAndTranslation(m_colliderConfig->m_rotation, m_colliderConfig->m_position);
 
+        if (const Physics::SphereShapeConfiguration* sphereShape = azrtti_cast<const Physics::SphereShapeConfiguration*>(m_shapeConfig))
+        {
+            m_localBounds = AZ::Aabb::CreateCenterRadius(AZ::Vector3::CreateZero(), sphereShape->m_radius);
+        }
+        else if (const Physics::CapsuleShapeConfiguration* capsuleShape = azrtti_cast<const Physics::CapsuleShapeConfiguration*>(m_shapeConfig))
+        {
+            const AZ::Vector3 halfExtents(capsuleShape->m_radius, capsuleShape->m_radius, capsuleShape->m_height * 0.5f);
+            m_localBounds = AZ::Aabb::CreateFromMinMax(-halfExtents, halfExtents);
+        }
+        else if (const Physics::BoxShapeConfiguration* boxShape = azrtti_cast<const Physics::BoxShapeConfiguration*>(m_shapeConfig))
+        {
+            m_localBounds = AZ::Aabb::CreateFromMinMax(boxShape->m_dimensions * -0.5f, boxShape->m_dimensions * 0.5f);
+        }
+
         if (m_colliderConfig->m_isExclusive)
         {
             Physics::SystemRequestBus::BroadcastResult(m_physicsShape, &Physics::SystemRequests::CreateShape, *m_colliderConfig, *m_shapeConfig);
@@ -110,6 +124,7 @@ namespace Multiplayer
     NetworkHitVolumesComponent::NetworkHitVolumesComponent()
         : m_syncRewindHandler([this]() { OnSyncRewind(); })
         , m_preRenderHandler([this](float deltaTime) { OnPreRender(deltaTime); })
+        , m_recordHitVolumesHandler([this](ILagCompensationHistory& lagCompensationHistory) { OnRecordHitVolumes(lagCompensationHistory); })
         , m_transformChangedHandler([this](const AZ::Transform&, const AZ::Transform& worldTm) { OnTransformUpdate(worldTm); })
     {
         ;
@@ -125,6 +140,10 @@ namespace Multiplayer
         EMotionFX::Integration::ActorComponentNotificationBus::Handler::BusConnect(GetEntityId());
         GetNetBindComponent()->AddEntitySyncRewindEventHandler(m_syncRewindHandler);
         GetNetBindComponent()->AddEntityPreRenderEventHandler(m_preRenderHandler);
+        if (ILagCompensationHistory* lagCompensationHistory = GetLagCompensationHistory())
+        {
+            lagCompensationHistory->AddRecordHitVolumesHandler(m_recordHitVolumesHandler);
+        }
         GetTransformComponent()->BindTransformChangedEventHandler(m_transformChangedHandler);
         OnTransformUpdate(GetTransformComponent()->GetWorldTM());
 
@@ -149,6 +168,7 @@ namespace Multiplayer
         m_debugDisplay = nullptr;
         m_syncRewindHandler.Disconnect();
         m_preRenderHandler.Disconnect();
+        m_recordHitVolumesHandler.Disconnect();
         m_transformChangedHandler.Disconnect();
         DestroyHitVolumes();
         Physics::CharacterNotificationBus::Handler::BusDisconnect();
@@ -195,6 +215,19 @@ namespace Multiplayer
         }
     }
 
+    void NetworkHitVolumesComponent::OnRecordHitVolumes(ILagCompensationHistory& lagCompensationHistory)
+    {
+        const NetEntityId netEntityId = GetNetEntityId();
+        const AZ::Transform& worldTransform = GetTransformComponent()->GetWorldTM();
+        for (const AnimatedHitVolume& hitVolume : m_animatedHitVolumes)
+        {
+            if (hitVolume.m_localBounds.IsValid())
+            {
+                lagCompensationHistory.RecordHitVolume(netEntityId, hitVolume.m_localBounds.GetTransformedAabb(worldTransform * hitVolume.m_transform.Get()));
+            }
+        }
+    }
+
     void NetworkHitVolumesComponent::CreateHitVolumes()
     {
         if (m_physicsCharacter == nullptr || m_actorComponent == nullptr)
@@ -51,8 +51,16 @@ namespace Multiplayer
     }
 
     void ClientToServerConnectionData::Update()
+    {
+        PrepareUpdate();
+        m_entityReplicationManager.SerializePreparedUpdates();
+        m_entityReplicationManager.SendPreparedUpdates();
+    }
+
+    bool ClientToServerConnectionData::PrepareUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
-        m_entityReplicationManager.SendUpdates();
+        m_entityReplicationManager.PrepareUpdates();
+        return true;
     }
 }
@@ -72,6 +72,15 @@ namespace Multiplayer
     }
 
     void ServerToClientConnectionData::Update()
+    {
+        if (PrepareUpdate())
+        {
+            m_entityReplicationManager.SerializePreparedUpdates();
+            m_entityReplicationManager.SendPreparedUpdates();
+        }
+    }
+
+    bool ServerToClientConnectionData::PrepareUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
 
@@ -81,9 +90,11 @@ namespace Multiplayer
             // potentially false if we just migrated the player, if that is the case, don't send any more updates
             if (netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
             {
-                m_entityReplicationManager.SendUpdates();
+                m_entityReplicationManager.PrepareUpdates();
+                return true;
             }
         }
+        return false;
     }
 
     void ServerToClientConnectionData::OnControlledEntityRemove()
@@ -179,6 +179,8 @@ namespace Multiplayer
         ImGui::Text("Total networked entities: %llu", aznumeric_cast<AZ::u64>(stats.m_entityCount));
         ImGui::Text("Total client connections: %llu", aznumeric_cast<AZ::u64>(stats.m_clientConnectionCount));
         ImGui::Text("Total server connections: %llu", aznumeric_cast<AZ::u64>(stats.m_serverConnectionCount));
+        ImGui::Text("Total deferred entity updates: %llu", aznumeric_cast<AZ::u64>(stats.m_deferredEntityUpdateCount));
+        ImGui::Text("Max entity update starvation time: %lld ms", aznumeric_cast<AZ::s64>(stats.m_maxEntityStarvationTimeMs));
         ImGui::NewLine();
 
         static ImGuiTableFlags flags = ImGuiTableFlags_BordersV
@@ -15,6 +15,7 @@
 #include <AzFramework/Spawnable/InMemorySpawnableAssetContainer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/Framework/INetworking.h>
+#include <AzNetworking/Utilities/SharedMemoryPayload.h>
 
 #include <Editor/MultiplayerEditorConnection.h>
 #include <Multiplayer/IMultiplayer.h>
@@ -106,8 +107,38 @@ namespace Multiplayer
             return true;
         }
         
-        // This is the last expected packet
-        // Read all assets out of the buffer
+        // This is the last expected packet, read all assets out of the buffer
+        m_byteStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+        const bool result = LoadLevelData(connection, m_byteStream);
+
+        // Now that we've deserialized, clear the byte stream
+        m_byteStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+        m_byteStream.Truncate();
+
+        return result;
+    }
+
+    bool MultiplayerEditorConnection::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerEditorPackets::EditorServerLevelDataSharedMemory& packet
+    )
+    {
+        // The level is read in place from the editor's shared memory, the editor keeps it alive until we respond with EditorServerReady
+        AzNetworking::SharedMemoryPayload payload;
+        if (!payload.Open(packet.GetPayloadName().c_str(), packet.GetPayloadSize()))
+        {
+            AZLOG_ERROR("EditorServerLevelDataSharedMemory packet references shared memory %s that could not be opened.", packet.GetPayloadName().c_str())
+            return false;
+        }
+
+        AZ::IO::MemoryStream stream(payload.GetData(), payload.GetSize());
+        return LoadLevelData(connection, stream);
+    }
+
+    bool MultiplayerEditorConnection::LoadLevelData(AzNetworking::IConnection* connection, AZ::IO::GenericStream& stream)
+    {
         // Create in-memory spawnables for the level, root.spawnable and root.network.spawnable (if level contains network entities)
         if (m_inMemorySpawnableAssetContainer != nullptr)
         {
@@ -116,22 +147,21 @@ namespace Multiplayer
         m_inMemorySpawnableAssetContainer = AZStd::make_unique<AzFramework::InMemorySpawnableAssetContainer>();
         AzFramework::InMemorySpawnableAssetContainer::AssetDataInfoContainer rootSpawnableAssetDataInfoContainer;
 
-        m_byteStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
         AZStd::vector<AZ::Data::Asset<AZ::Data::AssetData>> assetData;
-        while (m_byteStream.GetCurPos() < m_byteStream.GetLength())
+        while (stream.GetCurPos() < stream.GetLength())
         {
             AZ::Data::AssetId assetId;
             uint32_t hintSize;
             AZStd::string assetHint;
-            m_byteStream.Read(sizeof(AZ::Data::AssetId), &assetId);
-            m_byteStream.Read(sizeof(uint32_t), &hintSize);
+            stream.Read(sizeof(AZ::Data::AssetId), &assetId);
+            stream.Read(sizeof(uint32_t), &hintSize);
             assetHint.resize(hintSize);
-            m_byteStream.Read(hintSize, assetHint.data());
-            size_t assetSize = m_byteStream.GetCurPos();
+            stream.Read(hintSize, assetHint.data());
+            size_t assetSize = stream.GetCurPos();
 
             // Load spawnable from stream without loading any asset references
             AzFramework::Spawnable* spawnable = AZ::Utils::LoadObjectFromStream<AzFramework::Spawnable>(
-                m_byteStream, nullptr, AZ::ObjectStream::FilterDescriptor(AZ::Data::AssetFilterNoAssetLoading));
+                stream, nullptr, AZ::ObjectStream::FilterDescriptor(AZ::Data::AssetFilterNoAssetLoading));
             if (!spawnable)
             {
                 AZLOG_ERROR("EditorServerLevelData packet contains no asset data. Asset: %s", assetHint.c_str())
@@ -142,7 +172,7 @@ namespace Multiplayer
             AZ_Assert(assetHint.starts_with(AzFramework::Spawnable::DefaultMainSpawnableName), "Editor sent the server more than just the root (level) spawnable. Ensure the editor code only sends Root.");
 
             AZ::Data::AssetInfo spawnableAssetInfo;
-            spawnableAssetInfo.m_sizeBytes = m_byteStream.GetCurPos() - assetSize;
+            spawnableAssetInfo.m_sizeBytes = stream.GetCurPos() - assetSize;
             spawnableAssetInfo.m_assetId = assetId;
             spawnableAssetInfo.m_assetType = spawnable->GetType();
             spawnableAssetInfo.m_relativePath = assetHint;
@@ -150,10 +180,6 @@ namespace Multiplayer
             rootSpawnableAssetDataInfoContainer.emplace_back(spawnable, spawnableAssetInfo);
         }
 
-        // Now that we've deserialized, clear the byte stream
-        m_byteStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
-        m_byteStream.Truncate();
-
         if (rootSpawnableAssetDataInfoContainer.empty())
         {
             AZ_Assert(false, "MultiplayerEditorConnection failed to create level spawnable. Editor never sent the Root.spawnable; ensure the Editor sends the current Root.spawnable (the level).");
@@ -31,6 +31,7 @@ namespace Multiplayer
 
         bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerEditorPackets::EditorServerReadyForLevelData& packet);
         bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerEditorPackets::EditorServerLevelData& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerEditorPackets::EditorServerLevelDataSharedMemory& packet);
         bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerEditorPackets::EditorServerReady& packet);
         
         //! IConnectionListener interface
@@ -45,6 +46,9 @@ namespace Multiplayer
     private:
         void ActivateDedicatedEditorServer() const;
 
+        //! Creates the level spawnables from the serialized level data the editor sent and loads the level.
+        bool LoadLevelData(AzNetworking::IConnection* connection, AZ::IO::GenericStream& stream);
+
         AzNetworking::INetworkInterface* m_networkEditorInterface = nullptr;
         AZStd::vector<uint8_t> m_buffer;
         AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>> m_byteStream;
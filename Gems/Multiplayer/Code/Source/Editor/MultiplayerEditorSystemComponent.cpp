@@ -392,6 +392,7 @@ namespace Multiplayer
         
         AZ_TracePrintf("MultiplayerEditor", "Editor is sending the editor-server the level data packet.")
 
+        ResetLevelSendData();
         m_levelSendData.m_sendConnection = connection;
         m_levelSendData.m_byteStream =
             AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>>>(&m_levelSendData.m_sendBuffer);
@@ -415,6 +416,40 @@ namespace Multiplayer
         // Spawnable library needs to be rebuilt since now we have newly registered in-memory spawnable assets
         AZ::Interface<INetworkSpawnableLibrary>::Get()->BuildSpawnablesList();
 
+        // A server on the same machine reads the level straight out of shared memory, which skips splitting it into packets
+        // over multiple frames. The shared memory is kept until play mode ends, since the server opens it asynchronously.
+        const size_t levelDataSize = m_levelSendData.m_sendBuffer.size();
+        if (AzNetworking::ShouldUseSharedMemoryPayload(connection->GetRemoteAddress(), levelDataSize))
+        {
+            auto sharedPayload = AZStd::make_unique<AzNetworking::SharedMemoryPayload>();
+            if (sharedPayload->Create(m_levelSendData.m_sendBuffer.data(), levelDataSize))
+            {
+                MultiplayerEditorPackets::EditorServerLevelDataSharedMemory sharedMemoryPacket;
+                sharedMemoryPacket.SetPayloadName(sharedPayload->GetName().c_str());
+                sharedMemoryPacket.SetPayloadSize(aznumeric_cast<uint32_t>(levelDataSize));
+
+                ResetLevelSendData();
+                if (connection->SendReliablePacket(sharedMemoryPacket))
+                {
+                    m_levelSendData.m_sharedPayload = AZStd::move(sharedPayload);
+                    MultiplayerEditorServerNotificationBus::Broadcast(
+                        &MultiplayerEditorServerNotificationBus::Events::OnEditorSendingLevelData,
+                        aznumeric_cast<uint32_t>(levelDataSize),
+                        aznumeric_cast<uint32_t>(levelDataSize));
+                    MultiplayerEditorServerNotificationBus::Broadcast(
+                        &MultiplayerEditorServerNotificationBus::Events::OnEditorSendingLevelDataSuccess);
+                }
+                else
+                {
+                    MultiplayerEditorServerNotificationBus::Broadcast(
+                        &MultiplayerEditorServerNotificationBus::Events::OnEditorSendingLevelDataFailed);
+                }
+                return;
+            }
+
+            AZ_TracePrintf("MultiplayerEditor", "Shared memory is unavailable, sending the level data to the editor-server over TCP.")
+        }
+
         // Read the buffer into EditorServerLevelData packets until we've flushed the whole thing
         m_levelSendData.m_byteStream->Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
 
@@ -20,6 +20,7 @@
 #include <AzFramework/Process/ProcessWatcher.h>
 #include <AzFramework/Process/ProcessCommunicatorTracePrinter.h>
 #include <AzFramework/Viewport/ScreenGeometry.h>
+#include <AzNetworking/Utilities/SharedMemoryPayload.h>
 #include <AzToolsFramework/ActionManager/ActionManagerRegistrationNotificationBus.h>
 #include <AzToolsFramework/Entity/EditorEntityContextBus.h>
 #include <AzToolsFramework/Prefab/Spawnable/PrefabToInMemorySpawnableNotificationBus.h>
@@ -161,6 +162,9 @@ namespace Multiplayer
             AZStd::vector<uint8_t> m_sendBuffer;
             AZStd::unique_ptr<AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>>> m_byteStream;
             AzNetworking::IConnection* m_sendConnection = nullptr;
+
+            // Level data handed to an editor-server on the same machine, kept alive until the end of play mode.
+            AZStd::unique_ptr<AzNetworking::SharedMemoryPayload> m_sharedPayload;
         };
 
         LevelSendData m_levelSendData;
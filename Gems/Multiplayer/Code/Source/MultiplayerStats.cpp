@@ -12,6 +12,8 @@
 
 namespace Multiplayer
 {
+    static thread_local MultiplayerStats::DeferredRecords* t_deferredRecords = nullptr;
+
     MultiplayerStats::Metric::Metric()
     {
         AZStd::uninitialized_fill_n(m_callHistory.data(), RingbufferSamples, 0);
@@ -33,21 +35,43 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName)
     {
+        if (t_deferredRecords)
+        {
+            t_deferredRecords->push_back({ DeferredRecord::Type::EntitySerializeStart, mode, entityId, entityName });
+            return;
+        }
         m_events.m_entitySerializeStart.Signal(mode, entityId, entityName);
     }
 
     void MultiplayerStats::RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId)
     {
+        if (t_deferredRecords)
+        {
+            t_deferredRecords->push_back({ DeferredRecord::Type::ComponentSerializeEnd, mode, AZ::EntityId(), nullptr, netComponentId });
+            return;
+        }
         m_events.m_componentSerializeEnd.Signal(mode, netComponentId);
     }
 
     void MultiplayerStats::RecordEntitySerializeStop(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName)
     {
+        if (t_deferredRecords)
+        {
+            t_deferredRecords->push_back({ DeferredRecord::Type::EntitySerializeStop, mode, entityId, entityName });
+            return;
+        }
         m_events.m_entitySerializeStop.Signal(mode, entityId, entityName);
     }
 
     void MultiplayerStats::RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
+        if (t_deferredRecords)
+        {
+            t_deferredRecords->push_back(
+                { DeferredRecord::Type::PropertySent, AzNetworking::SerializerMode::ReadFromObject, AZ::EntityId(), nullptr, netComponentId, propertyId, totalBytes });
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         if (m_componentStats[netComponentIndex].m_propertyUpdatesSent.size() > propertyIndex)
@@ -131,6 +155,9 @@ namespace Multiplayer
     {
         SET_PERFORMANCE_STAT(MultiplayerStat_EntityCount, m_entityCount);
         SET_PERFORMANCE_STAT(MultiplayerStat_ClientConnectionCount, m_clientConnectionCount);
+        SET_PERFORMANCE_STAT(MultiplayerStat_DeferredEntityUpdates, m_deferredEntityUpdateCount);
+        SET_PERFORMANCE_STAT(MultiplayerStat_EntityStarvationTimeMs, m_tickMaxEntityStarvationTimeMs);
+        m_tickMaxEntityStarvationTimeMs = AZ::Time::ZeroTimeMs;
 
         m_totalHistoryTimeMs = metricFrameTimeMs * static_cast<AZ::TimeMs>(RingbufferSamples);
         m_recordMetricIndex = ++m_recordMetricIndex % RingbufferSamples;
@@ -263,4 +290,47 @@ namespace Multiplayer
     {
         SET_PERFORMANCE_STAT(MultiplayerStat_FrameTimeUs, networkFrameTime);
     }
+
+    void MultiplayerStats::RecordEntityUpdateDeferred()
+    {
+        ++m_deferredEntityUpdateCount;
+    }
+
+    void MultiplayerStats::RecordEntityUpdateStarvation(AZ::TimeMs starvationTimeMs)
+    {
+        m_maxEntityStarvationTimeMs = AZStd::max(m_maxEntityStarvationTimeMs, starvationTimeMs);
+        m_tickMaxEntityStarvationTimeMs = AZStd::max(m_tickMaxEntityStarvationTimeMs, starvationTimeMs);
+    }
+
+    void MultiplayerStats::SetThreadDeferredRecords(DeferredRecords* deferredRecords)
+    {
+        t_deferredRecords = deferredRecords;
+    }
+
+    MultiplayerStats::DeferredRecords* MultiplayerStats::GetThreadDeferredRecords()
+    {
+        return t_deferredRecords;
+    }
+
+    void MultiplayerStats::ReplayDeferredRecords(const DeferredRecords& deferredRecords)
+    {
+        for (const DeferredRecord& record : deferredRecords)
+        {
+            switch (record.m_type)
+            {
+            case DeferredRecord::Type::EntitySerializeStart:
+                RecordEntitySerializeStart(record.m_mode, record.m_entityId, record.m_entityName);
+                break;
+            case DeferredRecord::Type::ComponentSerializeEnd:
+                RecordComponentSerializeEnd(record.m_mode, record.m_netComponentId);
+                break;
+            case DeferredRecord::Type::EntitySerializeStop:
+                RecordEntitySerializeStop(record.m_mode, record.m_entityId, record.m_entityName);
+                break;
+            case DeferredRecord::Type::PropertySent:
+                RecordPropertySent(record.m_netComponentId, record.m_propertyId, record.m_totalBytes);
+                break;
+            }
+        }
+    }
 } // namespace Multiplayer
@@ -121,6 +121,8 @@ namespace Multiplayer
 
     AZ_CVAR(bool, bg_parallelNotifyPreRender, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, OnPreRender events will be sent in parallel from job threads. Please make sure the handlers of the event are thread safe.");
+    AZ_CVAR(bool, sv_parallelReplicationUpdate, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, the entity updates of each connection are serialized in parallel from job threads, the packets are still sent from the main thread.");
     
 
     void MultiplayerSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -253,6 +255,10 @@ namespace Multiplayer
         //! Register our gems multiplayer components to assign NetComponentIds
         RegisterMultiplayerComponents();
 
+        m_interestGrid.Activate();
+
+        m_botSwarm = AZStd::make_unique<MultiplayerBotSwarm>();
+
         if (auto console = AZ::Interface<AZ::IConsole>::Get())
         {
             m_consoleCommandHandler.Connect(console->GetConsoleCommandInvokedEvent());
@@ -347,6 +353,21 @@ namespace Multiplayer
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_TotalPacketsDiscardedDueToLoad, "TotalPacketsDiscardedDueToLoad");
 
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PhysicsFrameTimeUs, "PhysicsFrameTimeUs");        
+
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_DeferredEntityUpdates, "DeferredEntityUpdates");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_EntityStarvationTimeMs, "EntityStarvationTimeMs");
+
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_CorrectionReplayTimeUs, "CorrectionReplayTimeUs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_CorrectionReplayedInputs, "CorrectionReplayedInputs");
+
+        DECLARE_PERFORMANCE_STAT_GROUP(MultiplayerGroup_BotSwarm, "BotSwarm");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_BotSwarm, MultiplayerStat_BotConnectionCount, "BotConnections");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_BotSwarm, MultiplayerStat_BotReceivedBytesPerSecond, "BotReceivedBytesPerSecond");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_BotSwarm, MultiplayerStat_BotSentBytesPerSecond, "BotSentBytesPerSecond");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_BotSwarm, MultiplayerStat_BotRoundTripTimeMs, "BotRoundTripTimeMs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_BotSwarm, MultiplayerStat_BotReplicationLagMs, "BotReplicationLagMs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_BotSwarm, MultiplayerStat_BotMaxReplicationLagMs, "BotMaxReplicationLagMs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_BotSwarm, MultiplayerStat_BotReplicatedEntities, "BotReplicatedEntities");
     }
 
     void MultiplayerSystemComponent::Deactivate()
@@ -365,7 +386,9 @@ namespace Multiplayer
         AZ::TickBus::Handler::BusDisconnect();
         AzFramework::RootSpawnableNotificationBus::Handler::BusDisconnect();
 
+        m_botSwarm.reset();
         m_networkEntityManager.Reset();
+        m_interestGrid.Deactivate();
 
 #if (O3DE_EDITOR_CONNECTION_LISTENER_ENABLE)
         m_editorConnectionListener.reset();
@@ -563,6 +586,8 @@ namespace Multiplayer
                 return;
             }
             m_serverSendAccumulator -= serverRateSeconds;
+            // Record the hit volumes at the end of the frame, before moving on to the next one
+            m_lagCompensationHistory.RecordFrame(m_networkTime.GetHostFrameId());
             m_networkTime.IncrementHostFrameId();
         }
 
@@ -583,16 +608,23 @@ namespace Multiplayer
         stats.m_serverConnectionCount = 0;
         stats.m_clientConnectionCount = 0;
 
+        // Gather the entities around every client at once, for the replication windows updating this tick
+        m_interestGrid.UpdateSubscriptions();
+
         // Send out the game state update to all connections
         {            
             AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: OnTick - SendOutGameStateUpdate");
 
-            auto sendNetworkUpdates = [&stats](IConnection& connection)
+            AZStd::vector<IConnectionData*> preparedConnections;
+            auto prepareNetworkUpdates = [&stats, &preparedConnections](IConnection& connection)
             {
                 if (connection.GetUserData() != nullptr)
                 {
                     IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
-                    connectionData->Update();
+                    if (connectionData->PrepareUpdate())
+                    {
+                        preparedConnections.push_back(connectionData);
+                    }
                     if (connectionData->GetConnectionDataType() == ConnectionDataType::ServerToClient)
                     {
                         stats.m_clientConnectionCount++;
@@ -604,7 +636,48 @@ namespace Multiplayer
                 }
             };
 
-            m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+            m_networkInterface->GetConnectionSet().VisitConnections(prepareNetworkUpdates);
+
+            // The entity states don't change until the updates are sent, so connections sending the same changes share their serialization
+            m_entityUpdateSerializationCache.BeginTick();
+
+            if (sv_parallelReplicationUpdate && preparedConnections.size() > 1)
+            {
+                // Serialize the entity updates of each connection on a job, the stats they record are replayed in order afterwards
+                AZStd::vector<MultiplayerStats::DeferredRecords> deferredRecords(preparedConnections.size());
+                AZ::JobCompletion jobCompletion;
+                for (size_t index = 0; index < preparedConnections.size(); ++index)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction([connectionData = preparedConnections[index], records = &deferredRecords[index]]()
+                        {
+                            AZ_PROFILE_SCOPE(MULTIPLAYER, "SerializePreparedUpdatesJob");
+                            MultiplayerStats::SetThreadDeferredRecords(records);
+                            connectionData->GetReplicationManager().SerializePreparedUpdates();
+                            MultiplayerStats::SetThreadDeferredRecords(nullptr);
+                        }, true, nullptr);
+
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+
+                jobCompletion.StartAndWaitForCompletion();
+
+                for (size_t index = 0; index < preparedConnections.size(); ++index)
+                {
+                    stats.ReplayDeferredRecords(deferredRecords[index]);
+                    preparedConnections[index]->GetReplicationManager().SendPreparedUpdates();
+                }
+            }
+            else
+            {
+                for (IConnectionData* connectionData : preparedConnections)
+                {
+                    connectionData->GetReplicationManager().SerializePreparedUpdates();
+                    connectionData->GetReplicationManager().SendPreparedUpdates();
+                }
+            }
+
+            m_entityUpdateSerializationCache.EndTick();
         }
 
         MultiplayerPackets::SyncConsole packet;
@@ -1458,6 +1531,8 @@ namespace Multiplayer
         AZLOG_INFO("Total networked entities: %llu", aznumeric_cast<AZ::u64>(stats.m_entityCount));
         AZLOG_INFO("Total client connections: %llu", aznumeric_cast<AZ::u64>(stats.m_clientConnectionCount));
         AZLOG_INFO("Total server connections: %llu", aznumeric_cast<AZ::u64>(stats.m_serverConnectionCount));
+        AZLOG_INFO("Total deferred entity updates: %llu", aznumeric_cast<AZ::u64>(stats.m_deferredEntityUpdateCount));
+        AZLOG_INFO("Max entity update starvation time: %lld ms", aznumeric_cast<AZ::s64>(stats.m_maxEntityStarvationTimeMs));
 
         const MultiplayerStats::Metric propertyUpdatesSent = stats.CalculateTotalPropertyUpdateSentMetrics();
         const MultiplayerStats::Metric propertyUpdatesRecv = stats.CalculateTotalPropertyUpdateRecvMetrics();
@@ -1749,7 +1824,7 @@ namespace Multiplayer
     {
         if (auto connectionData = reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData()))
         {
-            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
+            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection, &m_interestGrid);
             connectionData->GetReplicationManager().SetReplicationWindow(AZStd::move(window));
             connectionData->SetControlledEntity(controlledEntity);
 
@@ -11,9 +11,13 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/Session/ISessionHandlingRequests.h>
 #include <Multiplayer/Session/SessionNotifications.h>
+#include <BotSwarm/MultiplayerBotSwarm.h>
 #include <Editor/MultiplayerEditorConnection.h>
+#include <NetworkTime/LagCompensationHistory.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
+#include <NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h>
+#include <ReplicationWindows/ReplicationInterestGrid.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
 
 #include <AzCore/Component/Component.h>
@@ -197,6 +201,9 @@ namespace Multiplayer
 
         NetworkEntityManager m_networkEntityManager;
         NetworkTime m_networkTime;
+        LagCompensationHistory m_lagCompensationHistory;
+        ReplicationInterestGrid m_interestGrid;
+        EntityUpdateSerializationCache m_entityUpdateSerializationCache;
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
         IFilterEntityManager* m_filterEntityManager = nullptr; // non-owning pointer
@@ -265,6 +272,9 @@ namespace Multiplayer
             OnPhysicsPostSimulate(dt);
         } };
 
+        // Created on Activate() for the same reason as the editor connection listener below.
+        AZStd::unique_ptr<MultiplayerBotSwarm> m_botSwarm;
+
         // By default, this is only enabled in non-monolithic builds, since the Editor doesn't support monolithic builds.
 #if (O3DE_EDITOR_CONNECTION_LISTENER_ENABLE)
         // This is a unique_ptr instead of a raw instance so that we can defer the construction
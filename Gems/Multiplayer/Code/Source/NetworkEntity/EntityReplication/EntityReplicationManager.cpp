@@ -20,11 +20,13 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
+#include <AzNetworking/Serialization/BaselineDelta.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/sort.h>
 
 AZ_DECLARE_BUDGET(MULTIPLAYER);
 
@@ -34,9 +36,13 @@ namespace Multiplayer
     constexpr uint32_t UdpPacketHeaderSerializeSize = 12;
     // Take out a few extra bytes for special headers, we currently only use 1 byte for the count of entity updates
     constexpr uint32_t ReplicationManagerPacketOverhead = 16;
+    // Estimated size of an entity update counted against the send limits, until an update of the entity has been sent
+    constexpr uint32_t DefaultEntityUpdateSizeEstimate = 64;
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
     AZ_CVAR(AZ::TimeMs, sv_ReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
+    AZ_CVAR(float, sv_MinReplicationPriority, 0.001f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The minimum priority an entity accumulates each tick it waits to be sent, bounds how long low priority entities can be deferred by the send limits.");
     
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -119,38 +125,61 @@ namespace Multiplayer
     }
 
     void EntityReplicationManager::SendUpdates()
+    {
+        PrepareUpdates();
+        SerializePreparedUpdates();
+        SendPreparedUpdates();
+    }
+
+    void EntityReplicationManager::PrepareUpdates()
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
 
+        m_preparedReplicators = GenerateEntityUpdateList();
+
+        AZLOG
+        (
+            NET_ReplicationInfo,
+            "Sending %zd updates from %s to %s",
+            m_preparedReplicators.size(),
+            GetNetworkEntityManager()->GetHostId().GetString().c_str(),
+            GetRemoteHostId().GetString().c_str()
+        );
+
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - PrepareSerialization");
+        // Prep a replication record for send, at this point, everything needs to be sent
+        for (EntityReplicator* replicator : m_preparedReplicators)
         {
-            EntityReplicatorList toSendList = GenerateEntityUpdateList();
+            replicator->GetPropertyPublisher()->PrepareSerialization();
+        }
+    }
 
-            AZLOG
-            (
-                NET_ReplicationInfo,
-                "Sending %zd updates from %s to %s",
-                toSendList.size(),
-                GetNetworkEntityManager()->GetHostId().GetString().c_str(),
-                GetRemoteHostId().GetString().c_str()
-            );
+    void EntityReplicationManager::SerializePreparedUpdates()
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SerializePreparedUpdates");
+        // Each replicator is serialized exactly once, the messages that don't fit in a packet go into the next one
+        m_preparedUpdates.clear();
+        m_preparedUpdates.reserve(m_preparedReplicators.size());
+        for (EntityReplicator* replicator : m_preparedReplicators)
+        {
+            m_preparedUpdates.emplace_back(replicator->GenerateUpdatePacket());
+        }
+    }
 
-            {
-                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - PrepareSerialization");
-                // Prep a replication record for send, at this point, everything needs to be sent
-                for (EntityReplicator* replicator : toSendList)
-                {
-                    replicator->GetPropertyPublisher()->PrepareSerialization();
-                }
-            }
+    void EntityReplicationManager::SendPreparedUpdates()
+    {
+        AZ_Assert(m_preparedUpdates.size() == m_preparedReplicators.size(), "SerializePreparedUpdates must run before SendPreparedUpdates");
 
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
+            // While our to send list is not empty, build up another packet to send
+            AZStd::size_t nextUpdateIndex = 0;
+            do
             {
-                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
-                // While our to send list is not empty, build up another packet to send
-                do
-                {
-                    SendEntityUpdateMessages(toSendList);
-                } while (!toSendList.empty());
-            }
+                SendEntityUpdateMessages(nextUpdateIndex);
+            } while (nextUpdateIndex < m_preparedUpdates.size());
+            m_preparedReplicators.clear();
+            m_preparedUpdates.clear();
         }
 
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
@@ -184,8 +213,11 @@ namespace Multiplayer
 
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
+        uint32_t toSendBytes = 0;
+
+        const ReplicationSet& replicationSet = m_replicationWindow->GetReplicationSet();
+        m_proxySendCandidates.clear();
 
-        uint32_t proxySendCount = 0;
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
             bool clearPendingSend = true;
@@ -218,15 +250,24 @@ namespace Multiplayer
                             m_remoteEntitiesPendingCreation.insert(entityId);
                         }
 
+                        ReplicatorSendState& sendState = m_replicatorSendStates[entityId];
                         if (replicator->GetRemoteNetworkRole() == NetEntityRole::Autonomous ||
                             replicator->GetBoundLocalNetworkRole() == NetEntityRole::Autonomous)
                         {
                             toSendList.push_back(replicator);
+                            toSendBytes += (sendState.m_lastSendSize > 0) ? sendState.m_lastSendSize : DefaultEntityUpdateSizeEstimate;
                         }
-                        else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
+                        else
                         {
-                            toSendList.push_back(replicator);
-                            ++proxySendCount;
+                            // Entities outside the replication set, like the ones being removed, keep the default priority
+                            const auto replicationIter = replicationSet.find(replicator->GetEntityHandle());
+                            const float priority = (replicationIter != replicationSet.end()) ? replicationIter->second.m_priority : 1.0f;
+                            sendState.m_accumulatedPriority += AZStd::max(priority, static_cast<float>(sv_MinReplicationPriority));
+                            if (sendState.m_pendingSinceMs == AZ::Time::ZeroTimeMs)
+                            {
+                                sendState.m_pendingSinceMs = m_frameTimeMs;
+                            }
+                            m_proxySendCandidates.push_back({ replicator, &sendState });
                         }
                     }
                 }
@@ -243,19 +284,55 @@ namespace Multiplayer
             }
         }
 
+        // Send the proxies with the highest accumulated priority first, the others keep accumulating priority until they are sent
+        AZStd::sort(m_proxySendCandidates.begin(), m_proxySendCandidates.end(),
+            [](const ProxySendCandidate& lhs, const ProxySendCandidate& rhs)
+            {
+                return lhs.m_sendState->m_accumulatedPriority > rhs.m_sendState->m_accumulatedPriority;
+            });
+
+        const uint32_t maxProxySendCount = m_replicationWindow->GetMaxProxyEntityReplicatorSendCount();
+        const uint32_t maxSendBytes = m_replicationWindow->GetMaxProxyEntityReplicatorSendBytes();
+        MultiplayerStats& stats = GetMultiplayer()->GetStats();
+
+        uint32_t proxySendCount = 0;
+        for (const ProxySendCandidate& candidate : m_proxySendCandidates)
+        {
+            ReplicatorSendState& sendState = *candidate.m_sendState;
+            const uint32_t estimatedSize = (sendState.m_lastSendSize > 0) ? sendState.m_lastSendSize : DefaultEntityUpdateSizeEstimate;
+
+            // The highest priority proxy is always within the byte limit, so that an entity larger than the limit can't stall replication
+            const bool withinCount = (proxySendCount < maxProxySendCount);
+            const bool withinBytes = (maxSendBytes == 0) || (proxySendCount == 0) || (toSendBytes + estimatedSize <= maxSendBytes);
+            if (withinCount && withinBytes)
+            {
+                toSendList.push_back(candidate.m_replicator);
+                toSendBytes += estimatedSize;
+                ++proxySendCount;
+
+                stats.RecordEntityUpdateStarvation(m_frameTimeMs - sendState.m_pendingSinceMs);
+                sendState.m_accumulatedPriority = 0.0f;
+                sendState.m_pendingSinceMs = AZ::Time::ZeroTimeMs;
+            }
+            else if (maxProxySendCount > 0)
+            {
+                stats.RecordEntityUpdateDeferred();
+            }
+        }
+
         return toSendList;
     }
 
-    void EntityReplicationManager::SendEntityUpdateMessages(EntityReplicatorList& replicatorList)
+    void EntityReplicationManager::SendEntityUpdateMessages(AZStd::size_t& nextUpdateIndex)
     {
         uint32_t pendingPacketSize = 0;
         EntityReplicatorList replicatorUpdatedList;
         NetworkEntityUpdateVector entityUpdates;
-        // Serialize everything
-        while (!replicatorList.empty())
+        // Pack the serialized updates, until the packet is full
+        while (nextUpdateIndex < m_preparedUpdates.size())
         {
-            EntityReplicator* replicator = replicatorList.front();
-            NetworkEntityUpdateMessage updateMessage(replicator->GenerateUpdatePacket());
+            EntityReplicator* replicator = m_preparedReplicators[nextUpdateIndex];
+            NetworkEntityUpdateMessage& updateMessage = m_preparedUpdates[nextUpdateIndex];
 
             const uint32_t nextMessageSize = updateMessage.GetEstimatedSerializeSize();
 
@@ -269,9 +346,10 @@ namespace Multiplayer
             }
 
             pendingPacketSize += nextMessageSize;
-            entityUpdates.push_back(updateMessage);
+            entityUpdates.push_back(AZStd::move(updateMessage));
             replicatorUpdatedList.push_back(replicator);
-            replicatorList.pop_front();
+            m_replicatorSendStates[replicator->GetEntityHandle().GetNetEntityId()].m_lastSendSize = nextMessageSize;
+            ++nextUpdateIndex;
 
             if (largeEntityDetected)
             {
@@ -378,6 +456,7 @@ namespace Multiplayer
         }
 
         m_entityReplicatorMap.clear();
+        m_replicatorSendStates.clear();
     }
 
     bool EntityReplicationManager::SetEntityRebasing(NetworkEntityHandle& entityHandle)
@@ -853,6 +932,11 @@ namespace Multiplayer
         case UpdateValidationResult::HandleMessage:
             break;
         case UpdateValidationResult::DropMessage:
+            // An old update can still become the baseline of the remote endpoint once acked, so keep its state
+            if (updateMessage.GetHasBaseline() && !updateMessage.GetIsDelete() && DecodeBaselineDelta(entityReplicator, updateMessage))
+            {
+                StoreBaseline(entityReplicator, packetHeader.GetPacketId());
+            }
             return true;
         case UpdateValidationResult::DropMessageAndDisconnect:
             return false;
@@ -865,7 +949,21 @@ namespace Multiplayer
             return HandleEntityDeleteMessage(entityReplicator, packetHeader, updateMessage);
         }
 
-        OutputSerializer outputSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()));
+        const AzNetworking::PacketEncodingBuffer* updateData = updateMessage.GetData();
+        if (updateMessage.GetHasBaseline())
+        {
+            if (!DecodeBaselineDelta(entityReplicator, updateMessage))
+            {
+                // We don't have the state the update is delta encoded against, ask the remote endpoint to send the full state again
+                AZLOG_WARN("Unable to process NetworkEntityUpdateMessage for entity id %llu, baseline packet %u is unknown",
+                    aznumeric_cast<AZ::u64>(updateMessage.GetEntityId()), aznumeric_cast<uint32_t>(updateMessage.GetBaselinePacketId()));
+                m_replicatorsPendingReset.emplace(updateMessage.GetEntityId());
+                return true;
+            }
+            updateData = &m_baselineDecodeBuffer;
+        }
+
+        OutputSerializer outputSerializer(updateData->GetBuffer(), static_cast<uint32_t>(updateData->GetSize()));
 
         PrefabEntityId prefabEntityId;
         if (updateMessage.GetHasValidPrefabId())
@@ -894,9 +992,58 @@ namespace Multiplayer
         bool handled = HandlePropertyChangeMessage(invokingConnection, entityReplicator, packetHeader.GetPacketId(), updateMessage.GetEntityId(), updateMessage.GetNetworkRole(), outputSerializer, prefabEntityId);
         AZ_Assert(handled, "Failed to handle NetworkEntityUpdateMessage message");
 
+        if (handled && updateMessage.GetHasBaseline())
+        {
+            // Handling the message may have created the replicator
+            StoreBaseline(GetEntityReplicator(updateMessage.GetEntityId()), packetHeader.GetPacketId());
+        }
+
         return handled;
     }
 
+    bool EntityReplicationManager::DecodeBaselineDelta(EntityReplicator* entityReplicator, const NetworkEntityUpdateMessage& updateMessage)
+    {
+        const AzNetworking::PacketEncodingBuffer* updateData = updateMessage.GetData();
+        if (updateData == nullptr)
+        {
+            return false;
+        }
+
+        const AZStd::vector<uint8_t>* baseline = nullptr;
+        if (updateMessage.GetBaselinePacketId() != AzNetworking::InvalidPacketId)
+        {
+            PropertySubscriber* propertySubscriber = (entityReplicator != nullptr) ? entityReplicator->GetPropertySubscriber() : nullptr;
+            baseline = (propertySubscriber != nullptr) ? propertySubscriber->FindBaseline(updateMessage.GetBaselinePacketId()) : nullptr;
+            if (baseline == nullptr)
+            {
+                return false;
+            }
+        }
+
+        uint32_t decodedSize = 0;
+        const bool decoded = AzNetworking::DecodeBaselineDelta
+        (
+            (baseline != nullptr) ? baseline->data() : nullptr,
+            (baseline != nullptr) ? aznumeric_cast<uint32_t>(baseline->size()) : 0,
+            updateData->GetBuffer(),
+            aznumeric_cast<uint32_t>(updateData->GetSize()),
+            m_baselineDecodeBuffer.GetBuffer(),
+            aznumeric_cast<uint32_t>(m_baselineDecodeBuffer.GetCapacity()),
+            decodedSize
+        );
+        m_baselineDecodeBuffer.Resize(decoded ? decodedSize : 0);
+        return decoded;
+    }
+
+    void EntityReplicationManager::StoreBaseline(EntityReplicator* entityReplicator, AzNetworking::PacketId packetId)
+    {
+        PropertySubscriber* propertySubscriber = (entityReplicator != nullptr) ? entityReplicator->GetPropertySubscriber() : nullptr;
+        if (propertySubscriber != nullptr)
+        {
+            propertySubscriber->StoreBaseline(packetId, m_baselineDecodeBuffer.GetBuffer(), aznumeric_cast<uint32_t>(m_baselineDecodeBuffer.GetSize()));
+        }
+    }
+
     bool EntityReplicationManager::HandleEntityRpcMessages(AzNetworking::IConnection* invokingConnection, NetworkEntityRpcVector& rpcVector)
     {
         for (NetworkEntityRpcMessage& rpcMessage : rpcVector)
@@ -1384,6 +1531,7 @@ namespace Multiplayer
                 {
                     m_remoteEntitiesPendingCreation.erase(replicator->GetEntityHandle().GetNetEntityId());
                     m_entityReplicatorMap.erase(*iter);
+                    m_replicatorSendStates.erase(*iter);
                     iter = m_replicatorsPendingRemoval.erase(iter);
                 }
                 else
@@ -488,9 +488,8 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
-        InputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
-        m_propertyPublisher->UpdateSerialization(inputSerializer);
-        updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        m_propertyPublisher->UpdateSerialization(updateMessage.ModifyData());
+        m_propertyPublisher->EncodeBaselineDelta(updateMessage);
 
         return updateMessage;
     }
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(bool, sv_EntityUpdateSerializationCache, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, connections sending the same changes of an entity in a tick share a single serialization of the entity");
+
+    EntityUpdateSerializationCache::EntityUpdateSerializationCache()
+    {
+        AZ::Interface<EntityUpdateSerializationCache>::Register(this);
+    }
+
+    EntityUpdateSerializationCache::~EntityUpdateSerializationCache()
+    {
+        AZ::Interface<EntityUpdateSerializationCache>::Unregister(this);
+    }
+
+    void EntityUpdateSerializationCache::BeginTick()
+    {
+        m_entries.clear();
+        m_hitCount = 0;
+        m_missCount = 0;
+        m_isCaching = sv_EntityUpdateSerializationCache;
+    }
+
+    void EntityUpdateSerializationCache::EndTick()
+    {
+        m_isCaching = false;
+        m_entries.clear();
+    }
+
+    bool EntityUpdateSerializationCache::IsCaching() const
+    {
+        return m_isCaching;
+    }
+
+    bool EntityUpdateSerializationCache::Find(NetEntityId netEntityId, const ReplicationRecord& record, AzNetworking::PacketEncodingBuffer& outBuffer)
+    {
+        const Entry* entry = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto entriesIter = m_entries.find(netEntityId);
+            if (entriesIter != m_entries.end())
+            {
+                entry = FindEntry(entriesIter->second, record);
+            }
+            if (entry == nullptr)
+            {
+                ++m_missCount;
+                return false;
+            }
+            ++m_hitCount;
+        }
+
+        if (!outBuffer.CopyValues(entry->m_data.data(), entry->m_data.size()))
+        {
+            return false;
+        }
+        GetMultiplayer()->GetStats().ReplayDeferredRecords(entry->m_statsRecords);
+        return true;
+    }
+
+    void EntityUpdateSerializationCache::Store(NetEntityId netEntityId, const ReplicationRecord& record, const AzNetworking::PacketEncodingBuffer& buffer,
+        MultiplayerStats::DeferredRecords&& statsRecords)
+    {
+        AZStd::unique_ptr<Entry> entry = AZStd::make_unique<Entry>();
+        entry->m_record = record;
+        entry->m_data.assign(buffer.GetBuffer(), buffer.GetBuffer() + buffer.GetSize());
+        entry->m_statsRecords = AZStd::move(statsRecords);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        Entries& entries = m_entries[netEntityId];
+        // Another connection may have stored the same update while this one was serializing
+        if (FindEntry(entries, record) == nullptr)
+        {
+            entries.emplace_back(AZStd::move(entry));
+        }
+    }
+
+    uint32_t EntityUpdateSerializationCache::GetHitCount() const
+    {
+        return m_hitCount;
+    }
+
+    uint32_t EntityUpdateSerializationCache::GetMissCount() const
+    {
+        return m_missCount;
+    }
+
+    const EntityUpdateSerializationCache::Entry* EntityUpdateSerializationCache::FindEntry(const Entries& entries, const ReplicationRecord& record) const
+    {
+        for (const AZStd::unique_ptr<Entry>& entry : entries)
+        {
+            if (entry->m_record.HasSameChanges(record))
+            {
+                return entry.get();
+            }
+        }
+        return nullptr;
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerStats.h>
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace Multiplayer
+{
+    //! @class EntityUpdateSerializationCache
+    //! @brief Shares the serialized entity updates between the connections sending the same changes of an entity in a tick.
+    //!
+    //! An entity update serializes the properties flagged by the pending replication record of a connection, so connections
+    //! with identical records for an entity get identical bytes. The first connection serializes the entity and the following
+    //! ones copy its bytes and replay its serialization stats, which turns the broadcast case into one serialization per entity.
+    //! Baseline delta encoding is per connection, and runs on the copied bytes. The cache only serves between BeginTick and
+    //! EndTick, while the entity states don't change, and it is safe to use from the jobs serializing connections in parallel.
+    class EntityUpdateSerializationCache
+    {
+    public:
+        AZ_RTTI(EntityUpdateSerializationCache, "{002FF161-5905-4F15-AB36-61BC82B42AE6}");
+
+        EntityUpdateSerializationCache();
+        virtual ~EntityUpdateSerializationCache();
+
+        //! Starts caching the entity updates serialized this tick.
+        void BeginTick();
+
+        //! Stops caching and clears the entity updates serialized this tick.
+        void EndTick();
+
+        //! Returns whether entity updates can currently be looked up and stored.
+        //! @return true between BeginTick and EndTick, if the cache is enabled
+        bool IsCaching() const;
+
+        //! Copies the serialized update of an entity for a record into a buffer, and records its serialization stats.
+        //! @param netEntityId the entity being serialized
+        //! @param record      the pending replication record being serialized
+        //! @param outBuffer   the buffer to copy the serialized update into
+        //! @return true if the update was found, false if the entity must be serialized
+        bool Find(NetEntityId netEntityId, const ReplicationRecord& record, AzNetworking::PacketEncodingBuffer& outBuffer);
+
+        //! Stores the serialized update of an entity for a record.
+        //! @param netEntityId  the entity serialized
+        //! @param record       the pending replication record serialized
+        //! @param buffer       the serialized update
+        //! @param statsRecords the serialization stats recorded while serializing the update
+        void Store(NetEntityId netEntityId, const ReplicationRecord& record, const AzNetworking::PacketEncodingBuffer& buffer,
+            MultiplayerStats::DeferredRecords&& statsRecords);
+
+        //! Returns the number of updates copied from the cache, and serialized into it, since the last BeginTick.
+        //! @{
+        uint32_t GetHitCount() const;
+        uint32_t GetMissCount() const;
+        //! @}
+
+    private:
+        struct Entry
+        {
+            ReplicationRecord m_record;
+            AZStd::vector<uint8_t> m_data;
+            MultiplayerStats::DeferredRecords m_statsRecords;
+        };
+        // Entries are immutable once stored, so they can be read outside the lock until EndTick
+        using Entries = AZStd::vector<AZStd::unique_ptr<Entry>>;
+
+        const Entry* FindEntry(const Entries& entries, const ReplicationRecord& record) const;
+
+        AZStd::unordered_map<NetEntityId, Entries> m_entries;
+        mutable AZStd::mutex m_mutex;
+        uint32_t m_hitCount = 0;
+        uint32_t m_missCount = 0;
+        bool m_isCaching = false;
+    };
+}
@@ -7,13 +7,19 @@
  */
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h>
+#include <Multiplayer/IMultiplayer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Serialization/BaselineDelta.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Interface/Interface.h>
 
 namespace Multiplayer
 {
     AZ_CVAR(uint32_t, net_EntityReplicatorRecordsMax, 45, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of allowed outstanding entity records");
+    AZ_CVAR(bool, net_EntityReplicatorBaselines, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, entity updates send the full replicated state delta encoded against the last state acknowledged by the remote endpoint, instead of the changed properties");
 
     PropertyPublisher::PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, NetBindComponent* netBindComponent, AzNetworking::IConnection& connection)
         : m_ownsLifetime(ownsLifetime)
@@ -21,6 +27,8 @@ namespace Multiplayer
         , m_connection(connection)
         , m_pendingRecord(remoteNetworkRole)
         , m_sentRecords(net_EntityReplicatorRecordsMax)
+        , m_sentStates(MaxEntityBaselines)
+        , m_useBaselines(net_EntityReplicatorBaselines)
     {
         if ( ownsLifetime == OwnsLifetime::False )
         {
@@ -109,6 +117,7 @@ namespace Multiplayer
     bool PropertyPublisher::PrepareAddEntityRecord()
     {
         m_sentRecords.clear();
+        m_sentStates.clear();
         m_netBindComponent->FillTotalReplicationRecord(m_pendingRecord);
         m_sentRecords.push_front(m_pendingRecord);
         return true;
@@ -120,6 +129,7 @@ namespace Multiplayer
 
         // This is basically an Add record, but we don't want to send back predictable values
         m_sentRecords.clear();
+        m_sentStates.clear();
         m_netBindComponent->FillTotalReplicationRecord(m_pendingRecord);
         // Don't send predictable properties back to the Autonomous unless we correct them
         if (m_pendingRecord.GetRemoteNetworkRole() == NetEntityRole::Autonomous)
@@ -149,6 +159,12 @@ namespace Multiplayer
                 // Sequence wasn't acked, so we need to send these bits again
                 m_pendingRecord.Append(*iter);
             }
+
+            if (m_useBaselines)
+            {
+                // The update is delta encoded against a previous full state, so it needs to hold every property to line up with it
+                m_netBindComponent->FillTotalReplicationRecord(m_pendingRecord);
+            }
         }
 
         // Don't send predictable properties back to the Autonomous unless we correct them
@@ -181,8 +197,63 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
+    bool PropertyPublisher::EncodeBaselineDelta(NetworkEntityUpdateMessage& updateMessage)
+    {
+        if (!m_useBaselines || m_replicatorState == EntityReplicatorState::Deleting)
+        {
+            return true;
+        }
+
+        // Use the newest state the remote endpoint acknowledged, the older states won't be used anymore
+        auto baselineIter = m_sentStates.begin();
+        for (; baselineIter != m_sentStates.end(); ++baselineIter)
+        {
+            if (baselineIter->m_packetId != AzNetworking::InvalidPacketId && m_connection.WasPacketAcked(baselineIter->m_packetId))
+            {
+                break;
+            }
+        }
+
+        AzNetworking::PacketEncodingBuffer& data = updateMessage.ModifyData();
+        SentState sentState;
+        sentState.m_data.assign(data.GetBuffer(), data.GetBuffer() + data.GetSize());
+
+        const bool hasBaseline = baselineIter != m_sentStates.end();
+        const uint8_t* baselineData = hasBaseline ? baselineIter->m_data.data() : nullptr;
+        const uint32_t baselineSize = hasBaseline ? aznumeric_cast<uint32_t>(baselineIter->m_data.size()) : 0;
+        uint32_t encodedSize = 0;
+        if (!AzNetworking::EncodeBaselineDelta(baselineData, baselineSize, sentState.m_data.data(), aznumeric_cast<uint32_t>(sentState.m_data.size()),
+            data.GetBuffer(), aznumeric_cast<uint32_t>(data.GetCapacity()), encodedSize))
+        {
+            AZLOG_ERROR("EntityReplicator: The delta encoded entity state doesn't fit in the update message");
+            return false;
+        }
+        data.Resize(encodedSize);
+        updateMessage.SetBaselinePacketId(hasBaseline ? baselineIter->m_packetId : AzNetworking::InvalidPacketId);
+
+        if (hasBaseline)
+        {
+            m_sentStates.erase(baselineIter + 1, m_sentStates.end());
+        }
+        m_sentStates.push_front(AZStd::move(sentState));
+        return true;
+    }
+
     void PropertyPublisher::FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId)
     {
+        if (m_useBaselines && !m_sentStates.empty() && m_sentStates.front().m_packetId == AzNetworking::InvalidPacketId)
+        {
+            // The state of a packet that failed to be generated can't be used as a baseline
+            if (packetId == AzNetworking::InvalidPacketId)
+            {
+                m_sentStates.pop_front();
+            }
+            else
+            {
+                m_sentStates.front().m_packetId = packetId;
+            }
+        }
+
         // Fill in the packet id for the last sent update
         ReplicationRecord& lastSentRecord = m_sentRecords.front();
         AZ_Assert(lastSentRecord.m_sentPacketId == AzNetworking::InvalidPacketId, "Assumed we pushed on a packet in UpdateSerialization");
@@ -318,6 +389,42 @@ namespace Multiplayer
         return success;
     }
 
+    bool PropertyPublisher::UpdateSerialization(AzNetworking::PacketEncodingBuffer& buffer)
+    {
+        EntityUpdateSerializationCache* serializationCache = AZ::Interface<EntityUpdateSerializationCache>::Get();
+        const bool useCache = (serializationCache != nullptr) && serializationCache->IsCaching()
+            && (m_replicatorState == EntityReplicatorState::Creating || m_replicatorState == EntityReplicatorState::Updating);
+
+        const NetEntityId netEntityId = m_netBindComponent->GetNetEntityId();
+        if (useCache && serializationCache->Find(netEntityId, m_pendingRecord, buffer))
+        {
+            return true;
+        }
+
+        // Capture the stats recorded while serializing, so they are recorded again by the connections sharing the serialization
+        MultiplayerStats::DeferredRecords* threadStatsRecords = MultiplayerStats::GetThreadDeferredRecords();
+        MultiplayerStats::DeferredRecords statsRecords;
+        if (useCache)
+        {
+            MultiplayerStats::SetThreadDeferredRecords(&statsRecords);
+        }
+
+        InputSerializer inputSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+        const bool success = UpdateSerialization(inputSerializer);
+        buffer.Resize(inputSerializer.GetSize());
+
+        if (useCache)
+        {
+            MultiplayerStats::SetThreadDeferredRecords(threadStatsRecords);
+            GetMultiplayer()->GetStats().ReplayDeferredRecords(statsRecords);
+            if (success)
+            {
+                serializationCache->Store(netEntityId, m_pendingRecord, buffer, AZStd::move(statsRecords));
+            }
+        }
+        return success;
+    }
+
     void PropertyPublisher::FinalizeSerialization(AzNetworking::PacketId sentId)
     {
         switch (m_replicatorState)
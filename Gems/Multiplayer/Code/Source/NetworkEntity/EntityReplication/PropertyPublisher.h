@@ -9,7 +9,9 @@
 #pragma once
 
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 #include <AzCore/std/containers/ring_buffer.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AzNetworking
 {
@@ -47,6 +49,18 @@ namespace Multiplayer
         void FinalizeSerialization(AzNetworking::PacketId sentId);
         //! @}
 
+        //! Serializes the update into a buffer, sharing the serialization with the other connections through the
+        //! EntityUpdateSerializationCache while it is caching.
+        //! @param buffer the buffer to serialize into, resized to the serialized size
+        //! @return boolean true on success
+        bool UpdateSerialization(AzNetworking::PacketEncodingBuffer& buffer);
+
+        //! When baselines are enabled, delta encodes the entity state serialized in the update message against the newest state
+        //! acknowledged by the remote endpoint, and keeps the state as a baseline for the following updates.
+        //! @param updateMessage the update message holding the data written by UpdateSerialization
+        //! @return boolean true on success, false if the encoded state doesn't fit in the message
+        bool EncodeBaselineDelta(NetworkEntityUpdateMessage& updateMessage);
+
     private:
         enum class EntityReplicatorState
         {
@@ -96,5 +110,14 @@ namespace Multiplayer
         AZStd::ring_buffer<ReplicationRecord> m_sentRecords;
         AZStd::vector<AzNetworking::PacketId> m_deletePacketIds;
         bool m_remoteReplicatorEstablished = false;
+
+        //! The full entity states sent while baselines are enabled, newest first, that the next updates are delta encoded against once acked
+        struct SentState
+        {
+            AzNetworking::PacketId m_packetId = AzNetworking::InvalidPacketId;
+            AZStd::vector<uint8_t> m_data;
+        };
+        AZStd::ring_buffer<SentState> m_sentStates;
+        bool m_useBaselines = false;
     };
 }
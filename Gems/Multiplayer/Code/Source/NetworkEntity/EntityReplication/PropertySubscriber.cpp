@@ -50,4 +50,48 @@ namespace Multiplayer
         m_lastReceivedPacketId = packetId;
         return m_netBindComponent->HandlePropertyChangeMessage(*serializer, notifyChanges);
     }
+
+    const AZStd::vector<uint8_t>* PropertySubscriber::FindBaseline(AzNetworking::PacketId packetId) const
+    {
+        for (const ReceivedState& receivedState : m_receivedStates)
+        {
+            if (receivedState.m_packetId == packetId)
+            {
+                return &receivedState.m_data;
+            }
+        }
+        return nullptr;
+    }
+
+    void PropertySubscriber::StoreBaseline(AzNetworking::PacketId packetId, const uint8_t* data, uint32_t dataSize)
+    {
+        if (FindBaseline(packetId) != nullptr)
+        {
+            return;
+        }
+
+        ReceivedState* receivedState = nullptr;
+        if (m_receivedStates.size() < m_receivedStates.capacity())
+        {
+            receivedState = &m_receivedStates.emplace_back();
+        }
+        else
+        {
+            receivedState = &m_receivedStates.front();
+            for (ReceivedState& oldState : m_receivedStates)
+            {
+                if (oldState.m_packetId < receivedState->m_packetId)
+                {
+                    receivedState = &oldState;
+                }
+            }
+            if (receivedState->m_packetId > packetId)
+            {
+                // Older than every state we keep
+                return;
+            }
+        }
+        receivedState->m_packetId = packetId;
+        receivedState->m_data.assign(data, data + dataSize);
+    }
 }
@@ -9,6 +9,9 @@
 #pragma once
 
 #include <AzNetworking/Utilities/NetworkCommon.h>
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AzNetworking
 {
@@ -34,6 +37,17 @@ namespace Multiplayer
 
         bool HandlePropertyChangeMessage(AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges = true);
 
+        //! Finds the full entity state received with a packet, that the remote endpoint delta encoded an update against.
+        //! @param packetId the packet id the state was received with
+        //! @return the state, nullptr if it isn't kept anymore
+        const AZStd::vector<uint8_t>* FindBaseline(AzNetworking::PacketId packetId) const;
+
+        //! Keeps a full entity state received with a packet, replacing the oldest state kept if there are too many.
+        //! @param packetId the packet id the state was received with
+        //! @param data     the state
+        //! @param dataSize the size of the state in bytes
+        void StoreBaseline(AzNetworking::PacketId packetId, const uint8_t* data, uint32_t dataSize);
+
     private:
         EntityReplicationManager& m_replicationManager;
         NetBindComponent* m_netBindComponent;
@@ -41,5 +55,14 @@ namespace Multiplayer
         // The last packet to have been received about this entity
         AzNetworking::PacketId m_lastReceivedPacketId = AzNetworking::InvalidPacketId;
         AZ::TimeMs m_markForRemovalTimeMs = AZ::Time::ZeroTimeMs;
+
+        // The full entity states received most recently, that the remote endpoint delta encodes its updates against.
+        // More are kept than the remote endpoint uses, to cover the updates received out of order.
+        struct ReceivedState
+        {
+            AzNetworking::PacketId m_packetId = AzNetworking::InvalidPacketId;
+            AZStd::vector<uint8_t> m_data;
+        };
+        AZStd::fixed_vector<ReceivedState, MaxEntityBaselines * 2> m_receivedStates;
     };
 }
@@ -29,6 +29,13 @@ namespace Multiplayer
             if (m_netBindComponent != nullptr)
             {
                 m_netEntityId = m_netBindComponent->GetNetEntityId();
+
+                // Only bind to the slot if it holds this entity, the entity may not have been added to the tracker yet
+                const NetworkEntitySlot slot = m_networkEntityTracker->FindSlot(m_netEntityId);
+                if (m_networkEntityTracker->GetRaw(slot) == entity)
+                {
+                    m_slot = slot;
+                }
             }
             else
             {
@@ -37,6 +44,16 @@ namespace Multiplayer
         }
     }
 
+    ConstNetworkEntityHandle::ConstNetworkEntityHandle(
+        AZ::Entity* entity, NetEntityId netEntityId, NetworkEntitySlot slot, const NetworkEntityTracker* networkEntityTracker)
+        : m_slot(slot)
+        , m_entity(entity)
+        , m_networkEntityTracker(networkEntityTracker)
+        , m_netEntityId(netEntityId)
+    {
+        m_changeDirty = m_networkEntityTracker->GetChangeDirty(m_entity);
+    }
+
     bool ConstNetworkEntityHandle::Exists() const
     {
         if (!m_networkEntityTracker)
@@ -44,12 +61,20 @@ namespace Multiplayer
             return false;
         }
 
+        // Fast path, the slot still holds the entity the handle was bound to
+        if (m_networkEntityTracker->GetRaw(m_slot) != nullptr)
+        {
+            return true;
+        }
+
+        // The entity was removed, or the handle was created for an entity that isn't tracked
         const uint32_t changeDirty = m_networkEntityTracker->GetChangeDirty(m_entity);
         if (m_changeDirty != changeDirty)
         {
             // Make sure to get change dirty with updated m_entity
             m_changeDirty = changeDirty;
-            AZ::Entity* newEntity = m_networkEntityTracker->GetRaw(m_netEntityId);
+            m_slot = m_networkEntityTracker->FindSlot(m_netEntityId);
+            AZ::Entity* newEntity = m_networkEntityTracker->GetRaw(m_slot);
             if (newEntity != m_entity)
             {
                 // If the entity pointer has changed, update our entity pointer and reset our netBindComponent pointer
@@ -100,6 +125,7 @@ namespace Multiplayer
 
     void ConstNetworkEntityHandle::Reset()
     {
+        m_slot = NetworkEntitySlot();
         m_entity = nullptr;
         m_netBindComponent = nullptr;
         m_netEntityId = InvalidNetEntityId;
@@ -107,6 +133,7 @@ namespace Multiplayer
 
     void ConstNetworkEntityHandle::Reset(const ConstNetworkEntityHandle& handle)
     {
+        m_slot = handle.m_slot;
         m_changeDirty = handle.m_changeDirty;
         m_entity = handle.m_entity;
         m_netBindComponent = handle.m_netBindComponent;
@@ -164,7 +164,6 @@ namespace Multiplayer
 
     void NetworkEntityManager::ClearAllEntities()
     {
-        // Note is looping through a hash map not a vector.  Could cause performance issues even on shutdown.
         for (NetworkEntityTracker::iterator it = m_networkEntityTracker.begin(); it != m_networkEntityTracker.end(); ++it)
         {
             m_removeList.push_back(it->first);
@@ -17,8 +17,26 @@ namespace Multiplayer
     void NetworkEntityTracker::Add(NetEntityId netEntityId, AZ::Entity* entity)
     {
         ++m_addChangeDirty;
-        AZ_Assert(m_entityMap.end() == m_entityMap.find(netEntityId), "Attempting to add the same entity to the entity map multiple times");
-        m_entityMap[netEntityId] = entity;
+        AZ_Assert(m_slotMap.end() == m_slotMap.find(netEntityId), "Attempting to add the same entity to the entity map multiple times");
+
+        uint32_t slotIndex;
+        if (!m_freeSlots.empty())
+        {
+            slotIndex = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            slotIndex = static_cast<uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        }
+
+        EntitySlot& slot = m_slots[slotIndex];
+        slot.m_entity = entity;
+        slot.m_entityIndex = static_cast<uint32_t>(m_entities.size());
+        m_entities.emplace_back(netEntityId, entity);
+        m_entitySlots.push_back(slotIndex);
+        m_slotMap[netEntityId] = slotIndex;
         m_netEntityIdMap[entity->GetId()] = netEntityId;
     }
 
@@ -34,14 +52,22 @@ namespace Multiplayer
 
     NetworkEntityHandle NetworkEntityTracker::Get(NetEntityId netEntityId)
     {
-        AZ::Entity* entity = GetRaw(netEntityId);
-        return NetworkEntityHandle(entity, this);
+        const NetworkEntitySlot slot = FindSlot(netEntityId);
+        if (AZ::Entity* entity = GetRaw(slot))
+        {
+            return NetworkEntityHandle(entity, netEntityId, slot, this);
+        }
+        return NetworkEntityHandle(nullptr, this);
     }
 
     ConstNetworkEntityHandle NetworkEntityTracker::Get(NetEntityId netEntityId) const
     {
-        AZ::Entity* entity = GetRaw(netEntityId);
-        return ConstNetworkEntityHandle(entity, this);
+        const NetworkEntitySlot slot = FindSlot(netEntityId);
+        if (AZ::Entity* entity = GetRaw(slot))
+        {
+            return ConstNetworkEntityHandle(entity, netEntityId, slot, this);
+        }
+        return ConstNetworkEntityHandle(nullptr, this);
     }
 
     NetEntityId NetworkEntityTracker::Get(const AZ::EntityId& entityId) const
@@ -56,45 +82,99 @@ namespace Multiplayer
 
     bool NetworkEntityTracker::Exists(NetEntityId netEntityId) const
     {
-        return (m_entityMap.find(netEntityId) != m_entityMap.end());
+        return (m_slotMap.find(netEntityId) != m_slotMap.end());
     }
 
     AZ::Entity* NetworkEntityTracker::GetRaw(NetEntityId netEntityId) const
     {
-        auto found = m_entityMap.find(netEntityId);
-        if (found != m_entityMap.end())
+        auto found = m_slotMap.find(netEntityId);
+        if (found != m_slotMap.end())
         {
-            return found->second;
+            return m_slots[found->second].m_entity;
         }
         return nullptr;
     }
 
+    NetworkEntitySlot NetworkEntityTracker::FindSlot(NetEntityId netEntityId) const
+    {
+        NetworkEntitySlot slot;
+        auto found = m_slotMap.find(netEntityId);
+        if (found != m_slotMap.end())
+        {
+            slot.m_index = found->second;
+            slot.m_generation = m_slots[found->second].m_generation;
+        }
+        return slot;
+    }
+
     void NetworkEntityTracker::erase(NetEntityId netEntityId)
     {
         ++m_deleteChangeDirty;
 
-        auto found = m_entityMap.find(netEntityId);
-        if (found != m_entityMap.end())
+        auto found = m_slotMap.find(netEntityId);
+        if (found != m_slotMap.end())
         {
-            m_netEntityIdMap.erase(found->second->GetId());            
-            m_entityMap.erase(found);
+            EraseAt(m_slots[found->second].m_entityIndex);
         }
     }
 
-    NetworkEntityTracker::EntityMap::iterator NetworkEntityTracker::erase(EntityMap::iterator iter)
+    NetworkEntityTracker::iterator NetworkEntityTracker::erase(iterator iter)
     {
         ++m_deleteChangeDirty;
-        if (iter != m_entityMap.end())
+        if (iter == m_entities.end())
         {
-            m_netEntityIdMap.erase(iter->second->GetId());
+            return iter;
         }
-        return m_entityMap.erase(iter);
+
+        // The last entity is moved into the erased position, so the same position is the next one to visit.
+        const AZStd::size_t entityIndex = AZStd::distance(m_entities.begin(), iter);
+        EraseAt(entityIndex);
+        return m_entities.begin() + entityIndex;
     }
 
-    AZ::Entity *NetworkEntityTracker::Move(EntityMap::iterator iter)
+    void NetworkEntityTracker::EraseAt(AZStd::size_t entityIndex)
+    {
+        const uint32_t slotIndex = m_entitySlots[entityIndex];
+        EntitySlot& slot = m_slots[slotIndex];
+        m_netEntityIdMap.erase(slot.m_entity->GetId());
+        m_slotMap.erase(m_entities[entityIndex].first);
+
+        // Bumping the generation invalidates every handle bound to the slot.
+        slot.m_entity = nullptr;
+        ++slot.m_generation;
+        m_freeSlots.push_back(slotIndex);
+
+        const AZStd::size_t lastIndex = m_entities.size() - 1;
+        if (entityIndex != lastIndex)
+        {
+            m_entities[entityIndex] = m_entities[lastIndex];
+            m_entitySlots[entityIndex] = m_entitySlots[lastIndex];
+            m_slots[m_entitySlots[entityIndex]].m_entityIndex = static_cast<uint32_t>(entityIndex);
+        }
+        m_entities.pop_back();
+        m_entitySlots.pop_back();
+    }
+
+    AZ::Entity* NetworkEntityTracker::Move(iterator iter)
     {
         AZ::Entity *ptr = iter->second;
         erase(iter);
         return ptr;
     }
+
+    void NetworkEntityTracker::clear()
+    {
+        ++m_deleteChangeDirty;
+        for (uint32_t slotIndex : m_entitySlots)
+        {
+            EntitySlot& slot = m_slots[slotIndex];
+            slot.m_entity = nullptr;
+            ++slot.m_generation;
+            m_freeSlots.push_back(slotIndex);
+        }
+        m_entities.clear();
+        m_entitySlots.clear();
+        m_slotMap.clear();
+        m_netEntityIdMap.clear();
+    }
 }
@@ -11,6 +11,7 @@
 #include <Multiplayer/MultiplayerTypes.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/Component/Entity.h>
 
 namespace Multiplayer
@@ -19,15 +20,18 @@ namespace Multiplayer
 
     //! @class NetworkEntityTracker
     //! @brief This class allows entity netEntityIds to be looked up.
+    //! Entities are stored in a generational slot map. Handles remember the slot and its generation, so dereferencing a handle
+    //! is an array access and a compare, and iterating over the tracked entities walks contiguous memory.
     class NetworkEntityTracker
     {
     public:
 
-        using EntityMap = AZStd::unordered_map<NetEntityId, AZ::Entity*>;
+        using EntityList = AZStd::vector<AZStd::pair<NetEntityId, AZ::Entity*>>;
+        using SlotMap = AZStd::unordered_map<NetEntityId, uint32_t>;
         using NetEntityIdMap = AZStd::unordered_map<AZ::EntityId, NetEntityId>;
         using NetBindingMap = AZStd::unordered_map<AZ::Entity*, NetBindComponent*>;
-        using iterator = EntityMap::iterator;
-        using const_iterator = EntityMap::const_iterator;
+        using iterator = EntityList::iterator;
+        using const_iterator = EntityList::const_iterator;
 
         NetworkEntityTracker() = default;
 
@@ -58,8 +62,14 @@ namespace Multiplayer
         //! Get a raw pointer of an entity.
         AZ::Entity *GetRaw(NetEntityId netEntityId) const;
 
+        //! Get a raw pointer of the entity in a slot, nullptr if the slot was released since the handle was bound to it.
+        AZ::Entity* GetRaw(NetworkEntitySlot slot) const;
+
+        //! Returns the slot of a tracked entity, or an invalid slot if the netEntityId isn't tracked.
+        NetworkEntitySlot FindSlot(NetEntityId netEntityId) const;
+
         //! Moves the given iterator out of the entity holder and returns the ptr.
-        AZ::Entity *Move(EntityMap::iterator iter);
+        AZ::Entity *Move(iterator iter);
 
         //! Retrieves the NetBindComponent for the provided AZ::Entity, nullptr if the entity does not have netbinding.
         //! @param entity pointer to the entity to retrieve the NetBindComponent for
@@ -67,6 +77,7 @@ namespace Multiplayer
         NetBindComponent* GetNetBindComponent(AZ::Entity* rawEntity) const;
 
         //! Container overloads
+        //! Erasing moves the last entity into the erased position, so iteration order isn't stable across erases.
         //!@{
         iterator begin();
         const_iterator begin() const;
@@ -75,12 +86,12 @@ namespace Multiplayer
         iterator find(NetEntityId netEntityId);
         const_iterator find(NetEntityId netEntityId) const;
         void erase(NetEntityId netEntityId);
-        iterator erase(EntityMap::iterator iter);
+        iterator erase(iterator iter);
         AZStd::size_t size() const;
         void clear();
         //! @}
 
-        //! Dirty tracking optimizations to avoid unnecessary hash lookups.
+        //! Dirty tracking for handles that aren't bound to a live slot, e.g. handles to entities that were removed or weren't added yet.
         //! There are two counts, one for adds and one for deletes
         //! If an entity is nullptr, check adds to check to see if our entity was added again
         //! If an entity is not nullptr, check removes which reminds us to see if the entity no longer exists
@@ -94,7 +105,21 @@ namespace Multiplayer
 
     private:
 
-        EntityMap m_entityMap;
+        struct EntitySlot
+        {
+            AZ::Entity* m_entity = nullptr;
+            uint32_t m_generation = 0;
+            uint32_t m_entityIndex = 0; //!< Index into m_entities while the slot is live
+        };
+
+        //! Removes the entity at the given index of m_entities and releases its slot.
+        void EraseAt(AZStd::size_t entityIndex);
+
+        EntityList m_entities; //!< Densely packed tracked entities
+        AZStd::vector<uint32_t> m_entitySlots; //!< Slot index of each entry in m_entities
+        AZStd::vector<EntitySlot> m_slots;
+        AZStd::vector<uint32_t> m_freeSlots;
+        SlotMap m_slotMap;
         NetEntityIdMap m_netEntityIdMap;
         NetBindingMap m_netBindingMap;
         uint32_t m_deleteChangeDirty = 0;
@@ -20,45 +20,59 @@ namespace Multiplayer
         return nullptr;
     }
 
+    inline AZ::Entity* NetworkEntityTracker::GetRaw(NetworkEntitySlot slot) const
+    {
+        if (slot.m_index < m_slots.size())
+        {
+            const EntitySlot& entitySlot = m_slots[slot.m_index];
+            return (entitySlot.m_generation == slot.m_generation) ? entitySlot.m_entity : nullptr;
+        }
+        return nullptr;
+    }
+
     inline NetworkEntityTracker::iterator NetworkEntityTracker::begin()
     {
-        return m_entityMap.begin();
+        return m_entities.begin();
     }
 
     inline NetworkEntityTracker::const_iterator NetworkEntityTracker::begin() const
     {
-        return m_entityMap.begin();
+        return m_entities.begin();
     }
 
     inline NetworkEntityTracker::iterator NetworkEntityTracker::end()
     {
-        return m_entityMap.end();
+        return m_entities.end();
     }
 
     inline NetworkEntityTracker::const_iterator NetworkEntityTracker::end() const
     {
-        return m_entityMap.end();
+        return m_entities.end();
     }
 
     inline NetworkEntityTracker::iterator NetworkEntityTracker::find(NetEntityId netEntityId)
     {
-        return m_entityMap.find(netEntityId);
+        auto found = m_slotMap.find(netEntityId);
+        if (found != m_slotMap.end())
+        {
+            return m_entities.begin() + m_slots[found->second].m_entityIndex;
+        }
+        return m_entities.end();
     }
 
     inline NetworkEntityTracker::const_iterator NetworkEntityTracker::find(NetEntityId netEntityId) const
     {
-        return m_entityMap.find(netEntityId);
+        auto found = m_slotMap.find(netEntityId);
+        if (found != m_slotMap.end())
+        {
+            return m_entities.begin() + m_slots[found->second].m_entityIndex;
+        }
+        return m_entities.end();
     }
 
     inline AZStd::size_t NetworkEntityTracker::size() const
     {
-        return m_entityMap.size();
-    }
-
-    inline void NetworkEntityTracker::clear()
-    {
-        m_entityMap.clear();
-        m_netEntityIdMap.clear();
+        return m_entities.size();
     }
 
     inline uint32_t NetworkEntityTracker::GetChangeDirty(const AZ::Entity* entity) const
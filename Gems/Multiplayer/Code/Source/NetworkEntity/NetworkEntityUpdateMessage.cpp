@@ -18,6 +18,8 @@ namespace Multiplayer
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
         , m_prefabEntityId(rhs.m_prefabEntityId)
+        , m_hasBaseline(rhs.m_hasBaseline)
+        , m_baselinePacketId(rhs.m_baselinePacketId)
         , m_data(AZStd::move(rhs.m_data))
     {
         ;
@@ -30,6 +32,8 @@ namespace Multiplayer
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
         , m_prefabEntityId(rhs.m_prefabEntityId)
+        , m_hasBaseline(rhs.m_hasBaseline)
+        , m_baselinePacketId(rhs.m_baselinePacketId)
     {
         if (rhs.m_data != nullptr)
         {
@@ -70,6 +74,8 @@ namespace Multiplayer
         m_wasMigrated = rhs.m_wasMigrated;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
         m_prefabEntityId = rhs.m_prefabEntityId;
+        m_hasBaseline = rhs.m_hasBaseline;
+        m_baselinePacketId = rhs.m_baselinePacketId;
         m_data = AZStd::move(rhs.m_data);
         return *this;
     }
@@ -82,6 +88,8 @@ namespace Multiplayer
         m_wasMigrated = rhs.m_wasMigrated;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
         m_prefabEntityId = rhs.m_prefabEntityId;
+        m_hasBaseline = rhs.m_hasBaseline;
+        m_baselinePacketId = rhs.m_baselinePacketId;
         if (rhs.m_data != nullptr)
         {
             m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
@@ -98,7 +106,9 @@ namespace Multiplayer
              && (m_isDelete == rhs.m_isDelete)
              && (m_wasMigrated == rhs.m_wasMigrated)
              && (m_hasValidPrefabId == rhs.m_hasValidPrefabId)
-             && (m_prefabEntityId == rhs.m_prefabEntityId));
+             && (m_prefabEntityId == rhs.m_prefabEntityId)
+             && (m_hasBaseline == rhs.m_hasBaseline)
+             && (m_baselinePacketId == rhs.m_baselinePacketId));
     }
 
     bool NetworkEntityUpdateMessage::operator !=(const NetworkEntityUpdateMessage& rhs) const
@@ -113,6 +123,7 @@ namespace Multiplayer
         static const uint32_t sizeOfFlags = 1;
         static const uint32_t sizeOfEntityId = sizeof(NetEntityId);
         static const uint32_t sizeOfSliceId = 6;
+        static const uint32_t sizeOfBaselinePacketId = sizeof(AzNetworking::PacketId);
 
         if (m_isDelete)
         {
@@ -120,7 +131,8 @@ namespace Multiplayer
         }
 
         // 2-byte size header + the actual blob payload itself
-        const uint32_t sizeOfBlob = static_cast<uint32_t>((m_data != nullptr) ? sizeof(PropertyIndex) + m_data->GetSize() : 0);
+        const uint32_t sizeOfBlob = static_cast<uint32_t>((m_data != nullptr) ? sizeof(PropertyIndex) + m_data->GetSize() : 0)
+                                  + (m_hasBaseline ? sizeOfBaselinePacketId : 0);
 
         if (m_hasValidPrefabId)
         {
@@ -168,6 +180,22 @@ namespace Multiplayer
         return m_prefabEntityId;
     }
 
+    void NetworkEntityUpdateMessage::SetBaselinePacketId(AzNetworking::PacketId baselinePacketId)
+    {
+        m_hasBaseline = true;
+        m_baselinePacketId = baselinePacketId;
+    }
+
+    bool NetworkEntityUpdateMessage::GetHasBaseline() const
+    {
+        return m_hasBaseline;
+    }
+
+    AzNetworking::PacketId NetworkEntityUpdateMessage::GetBaselinePacketId() const
+    {
+        return m_baselinePacketId;
+    }
+
     void NetworkEntityUpdateMessage::SetData(const AzNetworking::PacketEncodingBuffer& value)
     {
         if (m_data == nullptr)
@@ -197,13 +225,15 @@ namespace Multiplayer
         serializer.Serialize(m_entityId, "EntityId");
 
         // Use the upper 4 bits for boolean flags, and the lower 4 bits for the network role
-        uint8_t networkTypeAndFlags = (m_isDelete ? 0x40 : 0x00)
+        uint8_t networkTypeAndFlags = (m_hasBaseline ? 0x80 : 0x00)
+                                    | (m_isDelete ? 0x40 : 0x00)
                                     | (m_wasMigrated ? 0x20 : 0x00)
                                     | (m_hasValidPrefabId ? 0x10 : 0x00)
                                     | static_cast<uint8_t>(m_networkRole);
 
         if (serializer.Serialize(networkTypeAndFlags, "TypeAndFlags"))
         {
+            m_hasBaseline = (networkTypeAndFlags & 0x80) == 0x80;
             m_isDelete = (networkTypeAndFlags & 0x40) == 0x40;
             m_wasMigrated = (networkTypeAndFlags & 0x20) == 0x20;
             m_hasValidPrefabId = (networkTypeAndFlags & 0x10) == 0x10;
@@ -220,6 +250,10 @@ namespace Multiplayer
                 serializer.Serialize(m_prefabEntityId, "PrefabEntityId");
             }
 
+            if (m_hasBaseline)
+            {
+                serializer.Serialize(m_baselinePacketId, "BaselinePacketId");
+            }
             // m_data should never be nullptr unless this is a delete packet
             if (m_data == nullptr)
             {
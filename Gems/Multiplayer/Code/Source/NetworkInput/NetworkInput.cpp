@@ -122,6 +122,12 @@ namespace Multiplayer
         }
     }
 
+    void NetworkInput::AttachComponentInputs(MultiplayerComponentInputVector&& componentInputs)
+    {
+        m_wasAttached = true;
+        m_componentInputs = AZStd::move(componentInputs);
+    }
+
     bool NetworkInput::Serialize(AzNetworking::ISerializer& serializer)
     {
         if (!serializer.Serialize(m_inputId, "InputId")
@@ -46,8 +46,23 @@ namespace Multiplayer
         return m_inputs[index].m_networkInput;
     }
 
+    void NetworkInputArray::SetHistorySize(uint32_t historySize)
+    {
+        m_historySize = aznumeric_cast<uint8_t>(AZStd::clamp<uint32_t>(historySize, 1, MaxElements));
+    }
+
+    uint32_t NetworkInputArray::GetHistorySize() const
+    {
+        return m_historySize;
+    }
+
     bool NetworkInputArray::Serialize(AzNetworking::ISerializer& serializer)
     {
+        if (!serializer.Serialize(m_historySize, "HistorySize") || (m_historySize == 0) || (m_historySize > MaxElements))
+        {
+            return false;
+        }
+
         if (net_useInputDeltaSerialization)
         {
             // Use delta-serialization to compress input RPC bandwidth usage
@@ -58,7 +73,7 @@ namespace Multiplayer
             }
 
             // For each subsequent element
-            for (uint32_t i = 1; i < m_inputs.size(); ++i)
+            for (uint32_t i = 1; i < m_historySize; ++i)
             {
                 if (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject)
                 {
@@ -96,7 +111,22 @@ namespace Multiplayer
         }
         else
         {
-            return serializer.Serialize(m_inputs, "InputArray");
+            for (uint32_t i = 0; i < m_historySize; ++i)
+            {
+                if (!serializer.Serialize(m_inputs[i], "Input"))
+                {
+                    return false;
+                }
+            }
+        }
+
+        if (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject)
+        {
+            // The elements that were left out are older than any input the sender expects to be needed
+            for (uint32_t i = m_historySize; i < m_inputs.size(); ++i)
+            {
+                m_inputs[i].m_networkInput = m_inputs[m_historySize - 1].m_networkInput;
+            }
         }
         return true;
     }
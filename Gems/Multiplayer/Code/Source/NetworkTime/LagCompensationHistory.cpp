@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkTime/LagCompensationHistory.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+
+AZ_DECLARE_BUDGET(MULTIPLAYER);
+
+namespace Multiplayer
+{
+    // The casts test four volumes at a time, frames are padded with empty bounds to a multiple of this
+    static constexpr uint32_t VolumesPerBatch = 4;
+
+    // The bounds of the padding volumes, no cast of a finite length reaches them
+    static constexpr float PaddingBounds = AZStd::numeric_limits<float>::max();
+
+    // Direction components smaller than this are clamped, so the inverse direction of a cast stays finite
+    static constexpr float MinDirectionComponent = 1e-8f;
+
+    static float SafeInverse(float value)
+    {
+        if (AZ::GetAbs(value) < MinDirectionComponent)
+        {
+            return (value < 0.0f) ? (-1.0f / MinDirectionComponent) : (1.0f / MinDirectionComponent);
+        }
+        return 1.0f / value;
+    }
+
+    LagCompensationHistory::LagCompensationHistory()
+        : m_frames(RewindHistorySize)
+    {
+        AZ::Interface<ILagCompensationHistory>::Register(this);
+    }
+
+    LagCompensationHistory::~LagCompensationHistory()
+    {
+        AZ::Interface<ILagCompensationHistory>::Unregister(this);
+    }
+
+    void LagCompensationHistory::RecordFrame(HostFrameId frameId)
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "LagCompensationHistory: RecordFrame");
+
+        Frame& frame = m_frames[static_cast<uint32_t>(frameId) % RewindHistorySize];
+        frame.Clear();
+        frame.m_frameId = frameId;
+
+        m_recordingFrame = &frame;
+        m_recordHitVolumesEvent.Signal(*this);
+        m_recordingFrame = nullptr;
+
+        frame.m_volumeCount = aznumeric_cast<uint32_t>(frame.m_netEntityIds.size());
+        while (frame.m_minX.size() % VolumesPerBatch != 0)
+        {
+            frame.PushBounds(AZ::Vector3(PaddingBounds), AZ::Vector3(PaddingBounds));
+        }
+
+        const Frame* previousFrame = FindFrame(frameId - HostFrameId(1));
+        frame.m_matchesPreviousFrame = (previousFrame != nullptr) && (previousFrame->m_netEntityIds == frame.m_netEntityIds);
+    }
+
+    void LagCompensationHistory::Clear()
+    {
+        for (Frame& frame : m_frames)
+        {
+            frame.Clear();
+        }
+    }
+
+    void LagCompensationHistory::AddRecordHitVolumesHandler(RecordHitVolumesEvent::Handler& handler)
+    {
+        handler.Connect(m_recordHitVolumesEvent);
+    }
+
+    void LagCompensationHistory::RecordHitVolume(NetEntityId netEntityId, const AZ::Aabb& worldBounds)
+    {
+        AZ_Assert(m_recordingFrame != nullptr, "Hit volumes can only be recorded by the record hit volumes handlers");
+        if (m_recordingFrame != nullptr)
+        {
+            m_recordingFrame->m_netEntityIds.push_back(netEntityId);
+            m_recordingFrame->PushBounds(worldBounds.GetMin(), worldBounds.GetMax());
+        }
+    }
+
+    bool LagCompensationHistory::RayCast(HostFrameId frameId, float blendFactor, const AZ::Vector3& origin, const AZ::Vector3& direction,
+        float distance, AZStd::vector<HitVolumeHit>& outHits) const
+    {
+        return Cast(frameId, blendFactor, origin, direction, distance, 0.0f, outHits);
+    }
+
+    bool LagCompensationHistory::SphereCast(HostFrameId frameId, float blendFactor, const AZ::Vector3& origin, const AZ::Vector3& direction,
+        float distance, float radius, AZStd::vector<HitVolumeHit>& outHits) const
+    {
+        // The bounds are expanded by the radius, which is conservative around the corners of the bounds
+        return Cast(frameId, blendFactor, origin, direction, distance, radius, outHits);
+    }
+
+    void LagCompensationHistory::Frame::Clear()
+    {
+        m_frameId = InvalidHostFrameId;
+        m_volumeCount = 0;
+        m_matchesPreviousFrame = false;
+        m_netEntityIds.clear();
+        m_minX.clear();
+        m_minY.clear();
+        m_minZ.clear();
+        m_maxX.clear();
+        m_maxY.clear();
+        m_maxZ.clear();
+    }
+
+    void LagCompensationHistory::Frame::PushBounds(const AZ::Vector3& min, const AZ::Vector3& max)
+    {
+        m_minX.push_back(min.GetX());
+        m_minY.push_back(min.GetY());
+        m_minZ.push_back(min.GetZ());
+        m_maxX.push_back(max.GetX());
+        m_maxY.push_back(max.GetY());
+        m_maxZ.push_back(max.GetZ());
+    }
+
+    const LagCompensationHistory::Frame* LagCompensationHistory::FindFrame(HostFrameId frameId) const
+    {
+        if (frameId == InvalidHostFrameId)
+        {
+            return nullptr;
+        }
+        const Frame& frame = m_frames[static_cast<uint32_t>(frameId) % RewindHistorySize];
+        return (frame.m_frameId == frameId) ? &frame : nullptr;
+    }
+
+    bool LagCompensationHistory::Cast(HostFrameId frameId, float blendFactor, const AZ::Vector3& origin, const AZ::Vector3& direction,
+        float distance, float radius, AZStd::vector<HitVolumeHit>& outHits) const
+    {
+        using AZ::Simd::Vec4;
+
+        outHits.clear();
+        const Frame* frame = FindFrame(frameId);
+        if (frame == nullptr)
+        {
+            return false;
+        }
+
+        // Blend from the previous frame like the rewound transforms do, when both frames hold the same volumes
+        const Frame* previousFrame = (blendFactor < 1.0f && frame->m_matchesPreviousFrame) ? FindFrame(frameId - HostFrameId(1)) : nullptr;
+
+        const Vec4::FloatType originX = Vec4::Splat(origin.GetX());
+        const Vec4::FloatType originY = Vec4::Splat(origin.GetY());
+        const Vec4::FloatType originZ = Vec4::Splat(origin.GetZ());
+        const Vec4::FloatType inverseDirectionX = Vec4::Splat(SafeInverse(direction.GetX()));
+        const Vec4::FloatType inverseDirectionY = Vec4::Splat(SafeInverse(direction.GetY()));
+        const Vec4::FloatType inverseDirectionZ = Vec4::Splat(SafeInverse(direction.GetZ()));
+        const Vec4::FloatType castRadius = Vec4::Splat(radius);
+        const Vec4::FloatType castDistance = Vec4::Splat(distance);
+        const Vec4::FloatType blend = Vec4::Splat(blendFactor);
+        const Vec4::FloatType zero = Vec4::Splat(0.0f);
+        const Vec4::FloatType noHit = Vec4::Splat(PaddingBounds);
+
+        auto loadBounds = [previousFrame, &blend](const AZStd::vector<float> Frame::* bounds, const Frame* boundsFrame, uint32_t index)
+        {
+            const Vec4::FloatType current = Vec4::LoadUnaligned(&(boundsFrame->*bounds)[index]);
+            if (previousFrame == nullptr)
+            {
+                return current;
+            }
+            const Vec4::FloatType previous = Vec4::LoadUnaligned(&(previousFrame->*bounds)[index]);
+            return Vec4::Madd(Vec4::Sub(current, previous), blend, previous);
+        };
+
+        const uint32_t paddedVolumeCount = aznumeric_cast<uint32_t>(frame->m_minX.size());
+        for (uint32_t index = 0; index < paddedVolumeCount; index += VolumesPerBatch)
+        {
+            const Vec4::FloatType minX = Vec4::Sub(loadBounds(&Frame::m_minX, frame, index), castRadius);
+            const Vec4::FloatType minY = Vec4::Sub(loadBounds(&Frame::m_minY, frame, index), castRadius);
+            const Vec4::FloatType minZ = Vec4::Sub(loadBounds(&Frame::m_minZ, frame, index), castRadius);
+            const Vec4::FloatType maxX = Vec4::Add(loadBounds(&Frame::m_maxX, frame, index), castRadius);
+            const Vec4::FloatType maxY = Vec4::Add(loadBounds(&Frame::m_maxY, frame, index), castRadius);
+            const Vec4::FloatType maxZ = Vec4::Add(loadBounds(&Frame::m_maxZ, frame, index), castRadius);
+
+            // Slab test, the cast enters the bounds at the latest of the entry distances and leaves at the earliest exit distance
+            const Vec4::FloatType minDistanceX = Vec4::Mul(Vec4::Sub(minX, originX), inverseDirectionX);
+            const Vec4::FloatType minDistanceY = Vec4::Mul(Vec4::Sub(minY, originY), inverseDirectionY);
+            const Vec4::FloatType minDistanceZ = Vec4::Mul(Vec4::Sub(minZ, originZ), inverseDirectionZ);
+            const Vec4::FloatType maxDistanceX = Vec4::Mul(Vec4::Sub(maxX, originX), inverseDirectionX);
+            const Vec4::FloatType maxDistanceY = Vec4::Mul(Vec4::Sub(maxY, originY), inverseDirectionY);
+            const Vec4::FloatType maxDistanceZ = Vec4::Mul(Vec4::Sub(maxZ, originZ), inverseDirectionZ);
+
+            Vec4::FloatType entryDistance = Vec4::Max(Vec4::Min(minDistanceX, maxDistanceX), Vec4::Min(minDistanceY, maxDistanceY));
+            entryDistance = Vec4::Max(Vec4::Max(entryDistance, Vec4::Min(minDistanceZ, maxDistanceZ)), zero);
+            Vec4::FloatType exitDistance = Vec4::Min(Vec4::Max(minDistanceX, maxDistanceX), Vec4::Max(minDistanceY, maxDistanceY));
+            exitDistance = Vec4::Min(exitDistance, Vec4::Max(minDistanceZ, maxDistanceZ));
+
+            const Vec4::FloatType hitMask = Vec4::And(Vec4::CmpLtEq(entryDistance, exitDistance), Vec4::CmpLtEq(entryDistance, castDistance));
+            const Vec4::FloatType hitDistance = Vec4::Select(entryDistance, noHit, hitMask);
+            if (Vec4::CmpAllEq(hitDistance, noHit))
+            {
+                continue;
+            }
+
+            float hitDistances[VolumesPerBatch];
+            Vec4::StoreUnaligned(hitDistances, hitDistance);
+            for (uint32_t batchIndex = 0; batchIndex < VolumesPerBatch; ++batchIndex)
+            {
+                const uint32_t volumeIndex = index + batchIndex;
+                if (volumeIndex < frame->m_volumeCount && hitDistances[batchIndex] < PaddingBounds)
+                {
+                    outHits.push_back({ frame->m_netEntityIds[volumeIndex], hitDistances[batchIndex] });
+                }
+            }
+        }
+
+        AZStd::sort(outHits.begin(), outHits.end(), [](const HitVolumeHit& lhs, const HitVolumeHit& rhs)
+        {
+            return lhs.m_distance < rhs.m_distance;
+        });
+        return true;
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/NetworkTime/ILagCompensationHistory.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! Implementation of the ILagCompensationHistory interface.
+    //! The bounds of each frame are stored as structures of arrays, padded to a multiple of four volumes for the SIMD casts.
+    class LagCompensationHistory final
+        : public ILagCompensationHistory
+    {
+    public:
+        LagCompensationHistory();
+        ~LagCompensationHistory() override;
+
+        //! Records the hit volumes of a host frame, by signaling the record handlers.
+        //! @param frameId the host frame to record
+        void RecordFrame(HostFrameId frameId);
+
+        //! Clears the recorded frames.
+        void Clear();
+
+        //! ILagCompensationHistory interface
+        //! @{
+        void AddRecordHitVolumesHandler(RecordHitVolumesEvent::Handler& handler) override;
+        void RecordHitVolume(NetEntityId netEntityId, const AZ::Aabb& worldBounds) override;
+        bool RayCast(HostFrameId frameId, float blendFactor, const AZ::Vector3& origin, const AZ::Vector3& direction,
+            float distance, AZStd::vector<HitVolumeHit>& outHits) const override;
+        bool SphereCast(HostFrameId frameId, float blendFactor, const AZ::Vector3& origin, const AZ::Vector3& direction,
+            float distance, float radius, AZStd::vector<HitVolumeHit>& outHits) const override;
+        //! @}
+
+    private:
+        struct Frame
+        {
+            HostFrameId m_frameId = InvalidHostFrameId;
+            uint32_t m_volumeCount = 0;
+            //! True if the frame holds the same volumes in the same order as the previous frame, so their bounds can be blended
+            bool m_matchesPreviousFrame = false;
+            AZStd::vector<NetEntityId> m_netEntityIds;
+            AZStd::vector<float> m_minX;
+            AZStd::vector<float> m_minY;
+            AZStd::vector<float> m_minZ;
+            AZStd::vector<float> m_maxX;
+            AZStd::vector<float> m_maxY;
+            AZStd::vector<float> m_maxZ;
+
+            void Clear();
+            void PushBounds(const AZ::Vector3& min, const AZ::Vector3& max);
+        };
+
+        const Frame* FindFrame(HostFrameId frameId) const;
+        bool Cast(HostFrameId frameId, float blendFactor, const AZ::Vector3& origin, const AZ::Vector3& direction,
+            float distance, float radius, AZStd::vector<HitVolumeHit>& outHits) const;
+
+        AZStd::vector<Frame> m_frames;
+        Frame* m_recordingFrame = nullptr;
+        RecordHitVolumesEvent m_recordHitVolumesEvent;
+    };
+}
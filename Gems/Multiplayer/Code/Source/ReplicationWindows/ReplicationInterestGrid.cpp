@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+AZ_DECLARE_BUDGET(MULTIPLAYER);
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_InterestGridCellSize, 100.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The size of the cells of the replication interest grid, changing it rebuilds the grid on the next tick");
+    AZ_CVAR(bool, sv_InterestGridParallelUpdate, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, the subscriptions of the replication interest grid are gathered in parallel from job threads");
+
+    // Keeps the cell coordinates far from the int32_t limits, so the cell ranges of queries can't overflow
+    static constexpr float MaxCellCoordinate = 1.0e9f;
+    static constexpr float MinCellSize = 1.0f;
+
+    ReplicationInterestGrid::ReplicationInterestGrid()
+        : m_cellSize(AZStd::max(static_cast<float>(sv_InterestGridCellSize), MinCellSize))
+        , m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
+        , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
+    {
+        ;
+    }
+
+    ReplicationInterestGrid::~ReplicationInterestGrid()
+    {
+        Deactivate();
+    }
+
+    void ReplicationInterestGrid::Activate()
+    {
+        if (AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get())
+        {
+            componentApplication->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
+            componentApplication->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
+        }
+    }
+
+    void ReplicationInterestGrid::Deactivate()
+    {
+        m_entityActivatedEventHandler.Disconnect();
+        m_entityDeactivatedEventHandler.Disconnect();
+        m_cells.clear();
+        m_trackedEntities.clear();
+    }
+
+    void ReplicationInterestGrid::AddEntity(AZ::EntityId entityId, NetEntityId netEntityId, const AZ::Vector3& position)
+    {
+        auto iter = m_trackedEntities.find(entityId);
+        if (iter != m_trackedEntities.end())
+        {
+            iter->second.m_netEntityId = netEntityId;
+            MoveEntity(entityId, position);
+            return;
+        }
+
+        TrackedEntity& trackedEntity = m_trackedEntities[entityId];
+        trackedEntity.m_netEntityId = netEntityId;
+        trackedEntity.m_position = position;
+        trackedEntity.m_cellKey = GetCellKey(position);
+        InsertIntoCell(trackedEntity);
+    }
+
+    void ReplicationInterestGrid::MoveEntity(AZ::EntityId entityId, const AZ::Vector3& position)
+    {
+        auto iter = m_trackedEntities.find(entityId);
+        if (iter == m_trackedEntities.end())
+        {
+            return;
+        }
+
+        TrackedEntity& trackedEntity = iter->second;
+        trackedEntity.m_position = position;
+        const CellKey cellKey = GetCellKey(position);
+        if (cellKey != trackedEntity.m_cellKey)
+        {
+            RemoveFromCell(trackedEntity);
+            trackedEntity.m_cellKey = cellKey;
+            InsertIntoCell(trackedEntity);
+        }
+    }
+
+    void ReplicationInterestGrid::RemoveEntity(AZ::EntityId entityId)
+    {
+        auto iter = m_trackedEntities.find(entityId);
+        if (iter != m_trackedEntities.end())
+        {
+            RemoveFromCell(iter->second);
+            m_trackedEntities.erase(iter);
+        }
+    }
+
+    void ReplicationInterestGrid::GatherEntities(const AZ::Vector3& center, float radius, AZStd::vector<InterestEntry>& outEntries) const
+    {
+        outEntries.clear();
+        if (radius <= 0.0f || m_cells.empty())
+        {
+            return;
+        }
+
+        const float radiusSquared = radius * radius;
+        const int32_t minX = GetCellCoordinate(center.GetX() - radius);
+        const int32_t maxX = GetCellCoordinate(center.GetX() + radius);
+        const int32_t minY = GetCellCoordinate(center.GetY() - radius);
+        const int32_t maxY = GetCellCoordinate(center.GetY() + radius);
+
+        auto gatherCell = [&center, radiusSquared, &outEntries](const Cell& cell)
+        {
+            for (const TrackedEntity* trackedEntity : cell)
+            {
+                const float distanceSquared = center.GetDistanceSq(trackedEntity->m_position);
+                if (distanceSquared <= radiusSquared)
+                {
+                    outEntries.push_back({ trackedEntity->m_netEntityId, distanceSquared });
+                }
+            }
+        };
+
+        // Sparse worlds have fewer occupied cells than cells in range, walk whichever is smaller
+        const AZ::u64 cellsInRange = static_cast<AZ::u64>(maxX - minX + 1) * static_cast<AZ::u64>(maxY - minY + 1);
+        if (cellsInRange > m_cells.size())
+        {
+            for (const auto& [cellKey, cell] : m_cells)
+            {
+                const int32_t x = static_cast<int32_t>(static_cast<uint32_t>(cellKey >> 32));
+                const int32_t y = static_cast<int32_t>(static_cast<uint32_t>(cellKey));
+                if (x >= minX && x <= maxX && y >= minY && y <= maxY)
+                {
+                    gatherCell(cell);
+                }
+            }
+        }
+        else
+        {
+            for (int32_t x = minX; x <= maxX; ++x)
+            {
+                for (int32_t y = minY; y <= maxY; ++y)
+                {
+                    auto cellIter = m_cells.find(GetCellKey(x, y));
+                    if (cellIter != m_cells.end())
+                    {
+                        gatherCell(cellIter->second);
+                    }
+                }
+            }
+        }
+    }
+
+    void ReplicationInterestGrid::AddSubscription(Subscription* subscription)
+    {
+        if (AZStd::find(m_subscriptions.begin(), m_subscriptions.end(), subscription) == m_subscriptions.end())
+        {
+            m_subscriptions.push_back(subscription);
+        }
+    }
+
+    void ReplicationInterestGrid::RemoveSubscription(Subscription* subscription)
+    {
+        auto iter = AZStd::find(m_subscriptions.begin(), m_subscriptions.end(), subscription);
+        if (iter != m_subscriptions.end())
+        {
+            *iter = m_subscriptions.back();
+            m_subscriptions.pop_back();
+        }
+    }
+
+    void ReplicationInterestGrid::UpdateSubscriptions()
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "ReplicationInterestGrid: UpdateSubscriptions");
+
+        const float cellSize = AZStd::max(static_cast<float>(sv_InterestGridCellSize), MinCellSize);
+        if (cellSize != m_cellSize)
+        {
+            Rebuild(cellSize);
+        }
+
+        // Transforms are read here on the main thread, the jobs only read the grid and write their own subscription
+        AZStd::vector<Subscription*> activeSubscriptions;
+        activeSubscriptions.reserve(m_subscriptions.size());
+        for (Subscription* subscription : m_subscriptions)
+        {
+            const AZ::Entity* centerEntity = subscription->m_centerEntity.GetEntity();
+            if (centerEntity == nullptr || centerEntity->GetTransform() == nullptr)
+            {
+                subscription->m_entities.clear();
+                continue;
+            }
+            subscription->m_center = centerEntity->GetTransform()->GetWorldTranslation();
+            activeSubscriptions.push_back(subscription);
+        }
+
+        if (sv_InterestGridParallelUpdate && activeSubscriptions.size() > 1)
+        {
+            AZ::JobCompletion jobCompletion;
+            for (Subscription* subscription : activeSubscriptions)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([this, subscription]()
+                    {
+                        AZ_PROFILE_SCOPE(MULTIPLAYER, "ReplicationInterestGrid: GatherSubscriptionJob");
+                        GatherEntities(subscription->m_center, subscription->m_radius, subscription->m_entities);
+                    }, true, nullptr);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (Subscription* subscription : activeSubscriptions)
+            {
+                GatherEntities(subscription->m_center, subscription->m_radius, subscription->m_entities);
+            }
+        }
+    }
+
+    uint32_t ReplicationInterestGrid::GetEntityCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_trackedEntities.size());
+    }
+
+    uint32_t ReplicationInterestGrid::GetOccupiedCellCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_cells.size());
+    }
+
+    int32_t ReplicationInterestGrid::GetCellCoordinate(float value) const
+    {
+        const float coordinate = AZStd::floor(value / m_cellSize);
+        return static_cast<int32_t>(AZ::GetClamp(coordinate, -MaxCellCoordinate, MaxCellCoordinate));
+    }
+
+    ReplicationInterestGrid::CellKey ReplicationInterestGrid::GetCellKey(const AZ::Vector3& position) const
+    {
+        return GetCellKey(GetCellCoordinate(position.GetX()), GetCellCoordinate(position.GetY()));
+    }
+
+    ReplicationInterestGrid::CellKey ReplicationInterestGrid::GetCellKey(int32_t x, int32_t y)
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(x)) << 32) | static_cast<CellKey>(static_cast<uint32_t>(y));
+    }
+
+    void ReplicationInterestGrid::InsertIntoCell(TrackedEntity& trackedEntity)
+    {
+        Cell& cell = m_cells[trackedEntity.m_cellKey];
+        trackedEntity.m_cellIndex = aznumeric_cast<uint32_t>(cell.size());
+        cell.push_back(&trackedEntity);
+    }
+
+    void ReplicationInterestGrid::RemoveFromCell(TrackedEntity& trackedEntity)
+    {
+        auto cellIter = m_cells.find(trackedEntity.m_cellKey);
+        AZ_Assert(cellIter != m_cells.end(), "Tracked entity is missing from its cell");
+        if (cellIter == m_cells.end())
+        {
+            return;
+        }
+
+        Cell& cell = cellIter->second;
+        AZ_Assert(cell[trackedEntity.m_cellIndex] == &trackedEntity, "Tracked entity cell index is out of date");
+        TrackedEntity* lastEntity = cell.back();
+        cell[trackedEntity.m_cellIndex] = lastEntity;
+        lastEntity->m_cellIndex = trackedEntity.m_cellIndex;
+        cell.pop_back();
+
+        if (cell.empty())
+        {
+            m_cells.erase(cellIter);
+        }
+    }
+
+    void ReplicationInterestGrid::Rebuild(float cellSize)
+    {
+        m_cellSize = cellSize;
+        m_cells.clear();
+        for (auto& [entityId, trackedEntity] : m_trackedEntities)
+        {
+            trackedEntity.m_cellKey = GetCellKey(trackedEntity.m_position);
+            InsertIntoCell(trackedEntity);
+        }
+    }
+
+    void ReplicationInterestGrid::OnEntityActivated(AZ::Entity* entity)
+    {
+        NetBindComponent* netBindComponent = entity->FindComponent<NetBindComponent>();
+        AZ::TransformInterface* transformInterface = entity->GetTransform();
+        if (netBindComponent == nullptr || transformInterface == nullptr)
+        {
+            return;
+        }
+
+        const AZ::EntityId entityId = entity->GetId();
+        AddEntity(entityId, netBindComponent->GetNetEntityId(), transformInterface->GetWorldTranslation());
+
+        TrackedEntity& trackedEntity = m_trackedEntities[entityId];
+        trackedEntity.m_transformChangedHandler = AZ::TransformChangedEvent::Handler(
+            [this, entityId]([[maybe_unused]] const AZ::Transform& localTm, const AZ::Transform& worldTm)
+            {
+                MoveEntity(entityId, worldTm.GetTranslation());
+            });
+        transformInterface->BindTransformChangedEventHandler(trackedEntity.m_transformChangedHandler);
+    }
+
+    void ReplicationInterestGrid::OnEntityDeactivated(AZ::Entity* entity)
+    {
+        RemoveEntity(entity->GetId());
+    }
+}
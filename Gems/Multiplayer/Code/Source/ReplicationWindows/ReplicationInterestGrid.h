@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! @class ReplicationInterestGrid
+    //! @brief A spatial hash of the networked entities, used by the replication windows to find the entities around their players.
+    //!
+    //! The grid is made of square columns on the horizontal plane, an entity is binned by its position when it activates and
+    //! moved between cells as its transform changes, so keeping the grid up to date costs nothing for entities at rest.
+    //! Replication windows subscribe to the cells within their awareness radius, and once per tick the entities of all the
+    //! subscriptions are gathered in parallel, instead of every window querying the visibility octree on its own.
+    class ReplicationInterestGrid
+    {
+    public:
+        //! An entity within the radius of a subscription.
+        struct InterestEntry
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            float m_distanceSquared = 0.0f;
+        };
+
+        //! The area of interest of a replication window, gathered by UpdateSubscriptions.
+        struct Subscription
+        {
+            //! The entity at the center of the subscription, the subscription is empty while it doesn't exist
+            ConstNetworkEntityHandle m_centerEntity;
+            float m_radius = 0.0f;
+
+            //! The entities within the radius, as of the last call to UpdateSubscriptions
+            AZStd::vector<InterestEntry> m_entities;
+
+            AZ::Vector3 m_center = AZ::Vector3::CreateZero();
+        };
+
+        ReplicationInterestGrid();
+        ~ReplicationInterestGrid();
+
+        //! Starts tracking the networked entities as they activate.
+        void Activate();
+
+        //! Stops tracking the networked entities and clears the grid.
+        void Deactivate();
+
+        //! Adds an entity to the grid, or moves it if it is already tracked.
+        //! @param entityId    the id of the entity
+        //! @param netEntityId the network id of the entity
+        //! @param position    the world position of the entity
+        void AddEntity(AZ::EntityId entityId, NetEntityId netEntityId, const AZ::Vector3& position);
+
+        //! Moves an entity tracked by the grid.
+        //! @param entityId the id of the entity
+        //! @param position the new world position of the entity
+        void MoveEntity(AZ::EntityId entityId, const AZ::Vector3& position);
+
+        //! Removes an entity from the grid, if present.
+        //! @param entityId the id of the entity
+        void RemoveEntity(AZ::EntityId entityId);
+
+        //! Gathers the entities within a radius of a position.
+        //! This is safe to call from multiple threads at once, as long as the grid isn't modified at the same time.
+        //! @param center     the center of the area
+        //! @param radius     the radius of the area
+        //! @param outEntries the entities within the radius, the vector is cleared first
+        void GatherEntities(const AZ::Vector3& center, float radius, AZStd::vector<InterestEntry>& outEntries) const;
+
+        //! Adds a subscription, gathered by every following UpdateSubscriptions call until it is removed.
+        //! @param subscription the subscription, owned by the caller
+        void AddSubscription(Subscription* subscription);
+
+        //! Removes a subscription.
+        //! @param subscription the subscription to remove
+        void RemoveSubscription(Subscription* subscription);
+
+        //! Gathers the entities of all the subscriptions, on job threads if there are several.
+        void UpdateSubscriptions();
+
+        //! Returns the number of entities in the grid.
+        //! @return the number of entities in the grid
+        uint32_t GetEntityCount() const;
+
+        //! Returns the number of cells holding at least one entity.
+        //! @return the number of cells holding at least one entity
+        uint32_t GetOccupiedCellCount() const;
+
+    private:
+        AZ_DISABLE_COPY_MOVE(ReplicationInterestGrid);
+
+        using CellKey = AZ::u64;
+
+        struct TrackedEntity
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            CellKey m_cellKey = 0;
+            uint32_t m_cellIndex = 0;
+            AZ::TransformChangedEvent::Handler m_transformChangedHandler;
+        };
+        using Cell = AZStd::vector<TrackedEntity*>;
+
+        int32_t GetCellCoordinate(float value) const;
+        CellKey GetCellKey(const AZ::Vector3& position) const;
+        static CellKey GetCellKey(int32_t x, int32_t y);
+        void InsertIntoCell(TrackedEntity& trackedEntity);
+        void RemoveFromCell(TrackedEntity& trackedEntity);
+        void Rebuild(float cellSize);
+
+        void OnEntityActivated(AZ::Entity* entity);
+        void OnEntityDeactivated(AZ::Entity* entity);
+
+        AZStd::unordered_map<AZ::EntityId, TrackedEntity> m_trackedEntities;
+        AZStd::unordered_map<CellKey, Cell> m_cells;
+        AZStd::vector<Subscription*> m_subscriptions;
+        float m_cellSize = 0.0f;
+
+        AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
+        AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
+    };
+}
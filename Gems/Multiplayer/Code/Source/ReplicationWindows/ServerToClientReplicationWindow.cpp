@@ -10,6 +10,7 @@
 #include <Source/AutoGen/Multiplayer.AutoPackets.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
+#include <Multiplayer/ReplicationWindows/IReplicationPriorityScorer.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/ILogger.h>
@@ -21,8 +22,12 @@ namespace Multiplayer
     AZ_CVAR(uint32_t, sv_MaxEntitiesToTrackReplication, 512, nullptr, AZ::ConsoleFunctorFlags::Null, "The default max number of entities to track for replication");
     AZ_CVAR(uint32_t, sv_MinEntitiesToReplicate, 128, nullptr, AZ::ConsoleFunctorFlags::Null, "The default min number of entities to replicate to a client connection");
     AZ_CVAR(uint32_t, sv_MaxEntitiesToReplicate, 256, nullptr, AZ::ConsoleFunctorFlags::Null, "The default max number of entities to replicate to a client connection");
+    AZ_CVAR(uint32_t, sv_MinBytesToReplicate, 4096, nullptr, AZ::ConsoleFunctorFlags::Null, "The default max number of bytes of entity updates to send to a poor client connection per tick, 0 for no limit");
+    AZ_CVAR(uint32_t, sv_MaxBytesToReplicate, 16384, nullptr, AZ::ConsoleFunctorFlags::Null, "The default max number of bytes of entity updates to send to a client connection per tick, 0 for no limit");
     AZ_CVAR(uint32_t, sv_PacketsToIntegrateQos, 1000, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of packets to accumulate before updating connection quality of service metrics");
     AZ_CVAR(float, sv_BadConnectionThreshold, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The loss percentage beyond which we consider our network bad");
+    AZ_CVAR(bool, sv_UseReplicationInterestGrid, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, the entities around clients are gathered from the replication interest grid, instead of querying the visibility system for each client");
     AZ_CVAR(float, sv_ClientAwarenessRadius, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum distance entities can be from the client and still be relevant");
 
     const char* GetConnectionStateString(bool isPoor)
@@ -51,9 +56,15 @@ namespace Multiplayer
         return m_priority < rhs.m_priority;
     }
 
-    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection)
+    ServerToClientReplicationWindow::ServerToClientReplicationWindow
+    (
+        NetworkEntityHandle controlledEntity,
+        AzNetworking::IConnection* connection,
+        ReplicationInterestGrid* interestGrid
+    )
         : m_controlledEntity(controlledEntity)
         , m_connection(connection)
+        , m_interestGrid(interestGrid)
         , m_lastCheckedSentPackets(connection->GetMetrics().m_packetsSent)
         , m_lastCheckedLostPackets(connection->GetMetrics().m_packetsLost)
     {
@@ -61,6 +72,21 @@ namespace Multiplayer
         AZ_Assert(entity, "Invalid controlled entity provided to replication window");
         m_controlledEntityTransform = entity ? entity->GetTransform() : nullptr;
         AZ_Assert(m_controlledEntityTransform, "Controlled player entity must have a transform");
+
+        if (m_interestGrid != nullptr)
+        {
+            m_interestSubscription.m_centerEntity = m_controlledEntity;
+            m_interestSubscription.m_radius = sv_ClientAwarenessRadius;
+            m_interestGrid->AddSubscription(&m_interestSubscription);
+        }
+    }
+
+    ServerToClientReplicationWindow::~ServerToClientReplicationWindow()
+    {
+        if (m_interestGrid != nullptr)
+        {
+            m_interestGrid->RemoveSubscription(&m_interestSubscription);
+        }
     }
 
     bool ServerToClientReplicationWindow::ReplicationSetUpdateReady()
@@ -83,6 +109,11 @@ namespace Multiplayer
         return m_isPoorConnection ? sv_MinEntitiesToReplicate : sv_MaxEntitiesToReplicate;
     }
 
+    uint32_t ServerToClientReplicationWindow::GetMaxProxyEntityReplicatorSendBytes() const
+    {
+        return m_isPoorConnection ? sv_MinBytesToReplicate : sv_MaxBytesToReplicate;
+    }
+
     bool ServerToClientReplicationWindow::IsInWindow([[maybe_unused]] const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const
     {
         AZ_Assert(false, "IsInWindow should not be called on the ServerToClientReplicationWindow");
@@ -112,52 +143,28 @@ namespace Multiplayer
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
         const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
 
-        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
-        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
-        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
-        if (visibilitySystem)
-        {
-            visibilitySystem->GetDefaultVisibilityScene()->Enumerate(
-                awarenessSphere,
-                [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
-                {
-                    gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
-                    for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
-                    {
-                        if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
-                        {
-                            gatheredEntries.push_back(visEntry);
-                        }
-                    }
-                });
-        }
+        GatherNeighbours(controlledEntityPosition);
 
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
         IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+        IReplicationPriorityScorer* priorityScorer = AZ::Interface<IReplicationPriorityScorer>::Get();
 
         // Add all the neighbours
-        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
+        for (const Neighbour& neighbour : m_gatheredNeighbours)
         {
-            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
-            NetworkEntityHandle entityHandle(entity, networkEntityTracker);
-            if (entityHandle.GetNetBindComponent() == nullptr)
+            if (filterEntityManager && filterEntityManager->IsEntityFiltered(neighbour.m_entity, m_controlledEntity, m_connection->GetConnectionId()))
             {
-                // Entity does not have netbinding, skip this entity
                 continue;
             }
 
-            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
+            float priority = (neighbour.m_distanceSquared > 0.0f) ? 1.0f / neighbour.m_distanceSquared : 0.0f;
+            if (priorityScorer)
             {
-                continue;
+                priority = priorityScorer->ScoreEntity(neighbour.m_entity, m_controlledEntity, m_connection->GetConnectionId(), priority);
             }
 
-            // We want to find the closest extent to the player and prioritize using that distance
-            const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
-            const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
-            const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
-            const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
-                
-            AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
+            NetworkEntityHandle entityHandle(neighbour.m_entity, networkEntityTracker);
+            AddEntityToReplicationSet(entityHandle, priority, neighbour.m_distanceSquared);
         }
 
         // Add in all entities that have forced relevancy
@@ -314,6 +321,58 @@ namespace Multiplayer
         }
     }
 
+    void ServerToClientReplicationWindow::GatherNeighbours(const AZ::Vector3& controlledEntityPosition)
+    {
+        m_gatheredNeighbours.clear();
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+
+        if (m_interestGrid != nullptr && sv_UseReplicationInterestGrid)
+        {
+            // The grid gathered the subscription for this tick, the radius applies from the next one
+            m_interestSubscription.m_radius = sv_ClientAwarenessRadius;
+            for (const ReplicationInterestGrid::InterestEntry& interestEntry : m_interestSubscription.m_entities)
+            {
+                NetworkEntityHandle entityHandle = networkEntityTracker->Get(interestEntry.m_netEntityId);
+                if (AZ::Entity* entity = entityHandle.GetEntity())
+                {
+                    m_gatheredNeighbours.push_back({ entity, interestEntry.m_distanceSquared });
+                }
+            }
+            return;
+        }
+
+        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
+        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
+        if (visibilitySystem)
+        {
+            visibilitySystem->GetDefaultVisibilityScene()->Enumerate(
+                awarenessSphere,
+                [this, networkEntityTracker, &controlledEntityPosition](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    m_gatheredNeighbours.reserve(m_gatheredNeighbours.size() + nodeData.m_entries.size());
+                    for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                    {
+                        if ((visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity) == 0)
+                        {
+                            continue;
+                        }
+
+                        AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
+                        if (networkEntityTracker->GetNetBindComponent(entity) == nullptr)
+                        {
+                            // Entity does not have netbinding, skip this entity
+                            continue;
+                        }
+
+                        // We want to find the closest extent to the player and prioritize using that distance
+                        const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
+                        const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
+                        m_gatheredNeighbours.push_back({ entity, controlledEntityPosition.GetDistanceSq(closestPosition) });
+                    }
+                });
+        }
+    }
+
     void ServerToClientReplicationWindow::AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, [[maybe_unused]] float distanceSquared)
     {
         // Assumption: the entity has been checked for filtering prior to this call.
@@ -11,6 +11,7 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
@@ -39,13 +40,18 @@ namespace Multiplayer
         // we sort lowest priority first, so that we can easily keep the biggest N priorities
         using ReplicationCandidateQueue = AZStd::priority_queue<PrioritizedReplicationCandidate>;
 
-        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection);
+        //! @param controlledEntity the entity controlled by the client
+        //! @param connection       the connection to the client
+        //! @param interestGrid     the grid to gather the entities around the client from, or nullptr to query the visibility system
+        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection, ReplicationInterestGrid* interestGrid = nullptr);
+        ~ServerToClientReplicationWindow() override;
 
         //! IReplicationWindow interface
         //! @{
         bool ReplicationSetUpdateReady() override;
         const ReplicationSet& GetReplicationSet() const override;
         uint32_t GetMaxProxyEntityReplicatorSendCount() const override;
+        uint32_t GetMaxProxyEntityReplicatorSendBytes() const override;
         bool IsInWindow(const ConstNetworkEntityHandle& entityPtr, NetEntityRole& outNetworkRole) const override;
         bool AddEntity(AZ::Entity* entity) override;
         void RemoveEntity(AZ::Entity* entity) override;
@@ -61,6 +67,7 @@ namespace Multiplayer
         void UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent);
 
         void EvaluateConnection();
+        void GatherNeighbours(const AZ::Vector3& controlledEntityPosition);
         void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
 
         ServerToClientReplicationWindow& operator=(const ServerToClientReplicationWindow&) = delete;
@@ -77,6 +84,16 @@ namespace Multiplayer
 
         AzNetworking::IConnection* m_connection = nullptr;
 
+        struct Neighbour
+        {
+            AZ::Entity* m_entity = nullptr;
+            float m_distanceSquared = 0.0f;
+        };
+        AZStd::vector<Neighbour> m_gatheredNeighbours;
+
+        ReplicationInterestGrid* m_interestGrid = nullptr;
+        ReplicationInterestGrid::Subscription m_interestSubscription;
+
         // Cached values to detect a poor network connection
         uint32_t m_lastCheckedSentPackets = 0;
         uint32_t m_lastCheckedLostPackets = 0;
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonNetworkEntitySetup.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h>
+
+namespace Multiplayer
+{
+    using EntityUpdateSerializationCacheTests = NetworkEntityTests;
+
+    TEST_F(EntityUpdateSerializationCacheTests, ConnectionsWithTheSameChangesShareTheSerialization)
+    {
+        const NetEntityId netEntityId{ 7 };
+        const NetComponentId componentId = aznumeric_cast<NetComponentId>(0);
+        MultiplayerStats& stats = m_mockMultiplayer->GetStats();
+        stats.ReserveComponentStats(componentId, 1, 0);
+
+        EntityUpdateSerializationCache cache;
+        EXPECT_FALSE(cache.IsCaching());
+        cache.BeginTick();
+        EXPECT_TRUE(cache.IsCaching());
+
+        ReplicationRecord record(NetEntityRole::Client);
+        record.m_authorityToClient.AddBits(4);
+        record.m_authorityToClient.SetBit(2, true);
+
+        AzNetworking::PacketEncodingBuffer buffer;
+        EXPECT_FALSE(cache.Find(netEntityId, record, buffer));
+
+        const AZStd::vector<uint8_t> serialized = { 1, 2, 3, 4, 5 };
+        AzNetworking::PacketEncodingBuffer serializedBuffer;
+        serializedBuffer.CopyValues(serialized.data(), serialized.size());
+        MultiplayerStats::DeferredRecords statsRecords;
+        statsRecords.push_back({ MultiplayerStats::DeferredRecord::Type::PropertySent, AzNetworking::SerializerMode::ReadFromObject,
+            AZ::EntityId(), nullptr, componentId, PropertyIndex{ 0 }, 5 });
+        cache.Store(netEntityId, record, serializedBuffer, AZStd::move(statsRecords));
+
+        // Another connection with the same changes copies the bytes and records the same stats
+        ReplicationRecord sameRecord(NetEntityRole::Client);
+        sameRecord.m_authorityToClient.AddBits(4);
+        sameRecord.m_authorityToClient.SetBit(2, true);
+        EXPECT_TRUE(cache.Find(netEntityId, sameRecord, buffer));
+        EXPECT_TRUE(buffer.IsSame(serialized.data(), serialized.size()));
+        EXPECT_EQ(stats.m_componentStats[0].m_propertyUpdatesSent[0].m_totalCalls, 1u);
+        EXPECT_EQ(stats.m_componentStats[0].m_propertyUpdatesSent[0].m_totalBytes, 5u);
+
+        // Different changes, or another entity, need their own serialization
+        ReplicationRecord otherRecord(NetEntityRole::Client);
+        otherRecord.m_authorityToClient.AddBits(4);
+        otherRecord.m_authorityToClient.SetBit(1, true);
+        EXPECT_FALSE(cache.Find(netEntityId, otherRecord, buffer));
+        EXPECT_FALSE(cache.Find(NetEntityId{ 8 }, record, buffer));
+        EXPECT_EQ(cache.GetHitCount(), 1u);
+        EXPECT_EQ(cache.GetMissCount(), 3u);
+
+        cache.EndTick();
+        EXPECT_FALSE(cache.IsCaching());
+        EXPECT_FALSE(cache.Find(netEntityId, record, buffer));
+    }
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkTime/LagCompensationHistory.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class LagCompensationHistoryTests
+        : public LeakDetectionFixture
+    {
+    public:
+        using HitVolumeHit = ILagCompensationHistory::HitVolumeHit;
+
+        struct TestVolume
+        {
+            NetEntityId m_netEntityId;
+            AZ::Aabb m_bounds;
+        };
+
+        void RecordFrame(LagCompensationHistory& history, HostFrameId frameId, const AZStd::vector<TestVolume>& volumes)
+        {
+            RecordHitVolumesEvent::Handler handler([&volumes](ILagCompensationHistory& lagCompensationHistory)
+            {
+                for (const TestVolume& volume : volumes)
+                {
+                    lagCompensationHistory.RecordHitVolume(volume.m_netEntityId, volume.m_bounds);
+                }
+            });
+            history.AddRecordHitVolumesHandler(handler);
+            history.RecordFrame(frameId);
+        }
+
+        static TestVolume CreateVolume(NetEntityId netEntityId, const AZ::Vector3& center)
+        {
+            return { netEntityId, AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(0.5f)) };
+        }
+    };
+
+    TEST_F(LagCompensationHistoryTests, RayCastHitsVolumesSortedByDistance)
+    {
+        LagCompensationHistory history;
+        EXPECT_EQ(GetLagCompensationHistory(), &history);
+
+        const AZStd::vector<TestVolume> volumes = {
+            CreateVolume(NetEntityId{ 1 }, AZ::Vector3(20.0f, 0.0f, 0.0f)),
+            CreateVolume(NetEntityId{ 2 }, AZ::Vector3(10.0f, 0.0f, 0.0f)),
+            CreateVolume(NetEntityId{ 3 }, AZ::Vector3(10.0f, 5.0f, 0.0f)),
+            CreateVolume(NetEntityId{ 4 }, AZ::Vector3(30.0f, 0.0f, 0.0f)),
+            CreateVolume(NetEntityId{ 5 }, AZ::Vector3(-10.0f, 0.0f, 0.0f))
+        };
+        RecordFrame(history, HostFrameId(10), volumes);
+
+        AZStd::vector<HitVolumeHit> hits;
+        EXPECT_TRUE(history.RayCast(HostFrameId(10), 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 25.0f, hits));
+        ASSERT_EQ(hits.size(), 2);
+        EXPECT_EQ(hits[0].m_netEntityId, NetEntityId{ 2 });
+        EXPECT_NEAR(hits[0].m_distance, 9.5f, 0.001f);
+        EXPECT_EQ(hits[1].m_netEntityId, NetEntityId{ 1 });
+        EXPECT_NEAR(hits[1].m_distance, 19.5f, 0.001f);
+
+        EXPECT_TRUE(history.RayCast(HostFrameId(10), 1.0f, AZ::Vector3(0.0f, 0.0f, 5.0f), AZ::Vector3::CreateAxisX(), 100.0f, hits));
+        EXPECT_TRUE(hits.empty());
+    }
+
+    TEST_F(LagCompensationHistoryTests, CastsFailForFramesNotInTheHistory)
+    {
+        LagCompensationHistory history;
+        RecordFrame(history, HostFrameId(10), { CreateVolume(NetEntityId{ 1 }, AZ::Vector3(10.0f, 0.0f, 0.0f)) });
+
+        AZStd::vector<HitVolumeHit> hits;
+        EXPECT_FALSE(history.RayCast(HostFrameId(11), 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f, hits));
+
+        // Recording a frame a full history later overwrites the old frame
+        RecordFrame(history, HostFrameId(10 + RewindHistorySize), {});
+        EXPECT_FALSE(history.RayCast(HostFrameId(10), 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f, hits));
+
+        history.Clear();
+        EXPECT_FALSE(history.RayCast(HostFrameId(10 + RewindHistorySize), 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f, hits));
+    }
+
+    TEST_F(LagCompensationHistoryTests, CastsBlendFromThePreviousFrame)
+    {
+        LagCompensationHistory history;
+        RecordFrame(history, HostFrameId(10), { CreateVolume(NetEntityId{ 1 }, AZ::Vector3(10.0f, 0.0f, 0.0f)) });
+        RecordFrame(history, HostFrameId(11), { CreateVolume(NetEntityId{ 1 }, AZ::Vector3(10.0f, 4.0f, 0.0f)) });
+
+        AZStd::vector<HitVolumeHit> hits;
+        EXPECT_TRUE(history.RayCast(HostFrameId(11), 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f, hits));
+        EXPECT_TRUE(hits.empty());
+
+        // Halfway between the frames the volume is centered on y = 2
+        EXPECT_TRUE(history.RayCast(HostFrameId(11), 0.5f, AZ::Vector3(0.0f, 2.0f, 0.0f), AZ::Vector3::CreateAxisX(), 100.0f, hits));
+        EXPECT_EQ(hits.size(), 1);
+        EXPECT_TRUE(history.RayCast(HostFrameId(11), 0.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f, hits));
+        EXPECT_EQ(hits.size(), 1);
+
+        // Frames holding different volumes are not blended
+        RecordFrame(history, HostFrameId(12), { CreateVolume(NetEntityId{ 2 }, AZ::Vector3(10.0f, 8.0f, 0.0f)) });
+        EXPECT_TRUE(history.RayCast(HostFrameId(12), 0.0f, AZ::Vector3(0.0f, 4.0f, 0.0f), AZ::Vector3::CreateAxisX(), 100.0f, hits));
+        EXPECT_TRUE(hits.empty());
+    }
+
+    TEST_F(LagCompensationHistoryTests, SphereCastExpandsTheVolumesByTheRadius)
+    {
+        LagCompensationHistory history;
+        RecordFrame(history, HostFrameId(10), { CreateVolume(NetEntityId{ 1 }, AZ::Vector3(10.0f, 0.0f, 0.0f)) });
+
+        AZStd::vector<HitVolumeHit> hits;
+        EXPECT_TRUE(history.RayCast(HostFrameId(10), 1.0f, AZ::Vector3(0.0f, 1.0f, 0.0f), AZ::Vector3::CreateAxisX(), 100.0f, hits));
+        EXPECT_TRUE(hits.empty());
+        EXPECT_TRUE(history.SphereCast(HostFrameId(10), 1.0f, AZ::Vector3(0.0f, 1.0f, 0.0f), AZ::Vector3::CreateAxisX(), 100.0f, 1.0f, hits));
+        ASSERT_EQ(hits.size(), 1);
+        EXPECT_NEAR(hits[0].m_distance, 8.5f, 0.001f);
+
+        // The sweep stops short of the volume
+        EXPECT_TRUE(history.SphereCast(HostFrameId(10), 1.0f, AZ::Vector3(0.0f, 1.0f, 0.0f), AZ::Vector3::CreateAxisX(), 8.0f, 1.0f, hits));
+        EXPECT_TRUE(hits.empty());
+    }
+}
@@ -71,4 +71,34 @@ namespace Multiplayer
         EXPECT_EQ(valueMap.size(), NumTestEntriesPlusSize);
     }
 
+    TEST_F(MultiplayerComponentTests, DeferredStatsRecordsAreReplayed)
+    {
+        const NetComponentId componentId = aznumeric_cast<NetComponentId>(0);
+        const PropertyIndex propertyIndex = aznumeric_cast<PropertyIndex>(1);
+        MultiplayerStats stats;
+        stats.ReserveComponentStats(componentId, 2, 0);
+
+        uint32_t serializeStartCount = 0;
+        AZ::Event<AzNetworking::SerializerMode, AZ::EntityId, const char*>::Handler serializeStartHandler(
+            [&serializeStartCount](AzNetworking::SerializerMode, AZ::EntityId, const char*) { ++serializeStartCount; });
+        serializeStartHandler.Connect(stats.m_events.m_entitySerializeStart);
+
+        // While a thread defers its records, the stats are left untouched
+        MultiplayerStats::DeferredRecords deferredRecords;
+        MultiplayerStats::SetThreadDeferredRecords(&deferredRecords);
+        stats.RecordEntitySerializeStart(AzNetworking::SerializerMode::ReadFromObject, AZ::EntityId(1), "Entity");
+        stats.RecordPropertySent(componentId, propertyIndex, 12);
+        stats.RecordPropertySent(componentId, propertyIndex, 4);
+        MultiplayerStats::SetThreadDeferredRecords(nullptr);
+
+        const MultiplayerStats::Metric& metric = stats.m_componentStats[0].m_propertyUpdatesSent[1];
+        EXPECT_EQ(deferredRecords.size(), 3u);
+        EXPECT_EQ(serializeStartCount, 0u);
+        EXPECT_EQ(metric.m_totalCalls, 0u);
+
+        stats.ReplayDeferredRecords(deferredRecords);
+        EXPECT_EQ(serializeStartCount, 1u);
+        EXPECT_EQ(metric.m_totalCalls, 2u);
+        EXPECT_EQ(metric.m_totalBytes, 16u);
+    }
 } // namespace Multiplayer
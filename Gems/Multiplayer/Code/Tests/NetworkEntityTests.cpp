@@ -187,13 +187,74 @@ namespace Multiplayer
         EXPECT_TRUE(netEntityTracker->Exists(netId));
 
         NetworkEntityTracker::iterator it = netEntityTracker->begin();
+        const NetEntityId movedNetId = it->first;
         AZ::Entity* entity = netEntityTracker->Move(it);
         EXPECT_NE(entity, nullptr);
-        netEntityTracker->Add(it->first, entity);
-        netEntityTracker->erase(it->first);
+        netEntityTracker->Add(movedNetId, entity);
+        netEntityTracker->erase(movedNetId);
         EXPECT_FALSE(netEntityTracker->Exists(netId));
     }
 
+    TEST_F(MultiplayerNetworkEntityTests, NetworkEntityTracker_ReusedSlot_StaleHandleDoesNotExist)
+    {
+        NetworkEntityTracker* netEntityTracker = m_networkEntityManager->GetNetworkEntityTracker();
+        AZ::Entity first("first");
+        AZ::Entity second("second");
+        const NetEntityId firstNetId{ 100 };
+        const NetEntityId secondNetId{ 101 };
+
+        netEntityTracker->Add(firstNetId, &first);
+        NetworkEntityHandle firstHandle = netEntityTracker->Get(firstNetId);
+        EXPECT_EQ(firstHandle.GetEntity(), &first);
+
+        netEntityTracker->erase(firstNetId);
+        EXPECT_FALSE(firstHandle.Exists());
+
+        // The released slot is reused by the next entity, the old handle must not see it
+        netEntityTracker->Add(secondNetId, &second);
+        EXPECT_FALSE(firstHandle.Exists());
+        EXPECT_EQ(netEntityTracker->Get(secondNetId).GetEntity(), &second);
+
+        // Adding the entity again under the same id rebinds the old handle
+        netEntityTracker->Add(firstNetId, &first);
+        EXPECT_EQ(firstHandle.GetEntity(), &first);
+
+        netEntityTracker->erase(firstNetId);
+        netEntityTracker->erase(secondNetId);
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, NetworkEntityTracker_EraseWhileIterating_VisitsEveryEntity)
+    {
+        NetworkEntityTracker* netEntityTracker = m_networkEntityManager->GetNetworkEntityTracker();
+        const AZStd::size_t initialSize = netEntityTracker->size();
+        AZ::Entity entities[3];
+        for (uint32_t index = 0; index < 3; ++index)
+        {
+            netEntityTracker->Add(NetEntityId{ 200 + index }, &entities[index]);
+        }
+        const NetworkEntityHandle lastHandle = netEntityTracker->Get(NetEntityId{ 202 });
+
+        uint32_t visited = 0;
+        for (NetworkEntityTracker::iterator it = netEntityTracker->begin(); it != netEntityTracker->end();)
+        {
+            ++visited;
+            if (it->first == NetEntityId{ 200 } || it->first == NetEntityId{ 201 })
+            {
+                it = netEntityTracker->erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        EXPECT_EQ(visited, initialSize + 3);
+        EXPECT_EQ(netEntityTracker->size(), initialSize + 1);
+
+        // Entities moved to fill the erased positions keep their handles valid
+        EXPECT_EQ(lastHandle.GetEntity(), &entities[2]);
+        netEntityTracker->erase(NetEntityId{ 202 });
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, TestReplicatorPendingDeletion)
     {
         m_root->m_replicator->SetPendingRemoval(AZ::TimeMs(100));
@@ -364,6 +425,29 @@ namespace Multiplayer
         EXPECT_TRUE(m_entityReplicationManager->HandleEntityUpdateMessage(m_mockConnection.get(), header, constMessage));
     }
 
+    TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityUpdateMessageBaseline)
+    {
+        NetworkEntityUpdateMessage message(NetEntityRole::Authority, m_root->m_netId);
+        EXPECT_FALSE(message.GetHasBaseline());
+        EXPECT_EQ(message.GetBaselinePacketId(), AzNetworking::InvalidPacketId);
+
+        message.SetBaselinePacketId(AzNetworking::PacketId{ 42 });
+        message.ModifyData().Resize(4);
+        EXPECT_TRUE(message.GetHasBaseline());
+
+        AzNetworking::PacketEncodingBuffer buffer;
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+        EXPECT_TRUE(message.Serialize(inputSerializer));
+
+        NetworkEntityUpdateMessage received;
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.GetBuffer(), inputSerializer.GetSize());
+        EXPECT_TRUE(received.Serialize(outputSerializer));
+        EXPECT_EQ(received, message);
+        EXPECT_TRUE(received.GetHasBaseline());
+        EXPECT_EQ(received.GetBaselinePacketId(), AzNetworking::PacketId{ 42 });
+        EXPECT_LE(inputSerializer.GetSize(), message.GetEstimatedSerializeSize());
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityManagerRelevancy)
     {
         ConstNetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
@@ -135,6 +135,46 @@ namespace Multiplayer
         }
     }
 
+    TEST_F(NetworkInputTests, NetworkInputArrayHistorySizeSerialization)
+    {
+        const NetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityTracker.get());
+        NetworkInputArray inArray = NetworkInputArray(handle);
+
+        for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+        {
+            inArray[i].SetClientInputId(ClientInputId(NetworkInputArray::MaxElements - i));
+            inArray[i].SetHostFrameId(HostFrameId(i));
+        }
+
+        // Only send the three newest inputs
+        constexpr uint32_t HistorySize = 3;
+        inArray.SetHistorySize(HistorySize);
+        EXPECT_EQ(inArray.GetHistorySize(), HistorySize);
+
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(inArray.Serialize(inSerializer));
+
+        NetworkInputArray outArray;
+        AzNetworking::NetworkOutputSerializer outSerializer(buffer.data(), static_cast<uint32_t>(inSerializer.GetSize()));
+        EXPECT_TRUE(outArray.Serialize(outSerializer));
+        EXPECT_EQ(outArray.GetHistorySize(), HistorySize);
+
+        for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+        {
+            // Elements that weren't sent are copies of the oldest one that was
+            const uint32_t sentIndex = AZStd::min(i, HistorySize - 1);
+            EXPECT_EQ(outArray[i].GetClientInputId(), inArray[sentIndex].GetClientInputId());
+            EXPECT_EQ(outArray[i].GetHostFrameId(), inArray[sentIndex].GetHostFrameId());
+        }
+
+        // Out of range sizes are clamped
+        inArray.SetHistorySize(0);
+        EXPECT_EQ(inArray.GetHistorySize(), 1);
+        inArray.SetHistorySize(NetworkInputArray::MaxElements + 1);
+        EXPECT_EQ(inArray.GetHistorySize(), NetworkInputArray::MaxElements);
+    }
+
     TEST_F(NetworkInputTests, NetworkInputHistory)
     {
         const NetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityTracker.get());
@@ -72,6 +72,8 @@ namespace Multiplayer
                 const AzPhysics::SceneQueryRequests&,
                 AzPhysics::SceneQuery::AsyncBatchCallback));
         MOCK_METHOD2(QuerySceneBatch, AzPhysics::SceneQueryHitsList(AzPhysics::SceneHandle, const AzPhysics::SceneQueryRequests&));
+        MOCK_METHOD3(QuerySceneRayCastBatch, void(AzPhysics::SceneHandle, AZStd::span<const AzPhysics::RayCastRequest>, AzPhysics::SceneQueryBatchHits&));
+        MOCK_METHOD3(QuerySceneShapeCastBatch, void(AzPhysics::SceneHandle, AZStd::span<const AzPhysics::ShapeCastRequest>, AzPhysics::SceneQueryBatchHits&));
         MOCK_METHOD2(
             RegisterSceneActiveSimulatedBodiesHandler,
             void(
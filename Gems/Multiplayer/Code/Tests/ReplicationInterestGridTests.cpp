@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class ReplicationInterestGridTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static AZStd::vector<NetEntityId> Gather(const ReplicationInterestGrid& grid, const AZ::Vector3& center, float radius)
+        {
+            AZStd::vector<ReplicationInterestGrid::InterestEntry> entries;
+            grid.GatherEntities(center, radius, entries);
+
+            AZStd::vector<NetEntityId> netEntityIds;
+            for (const ReplicationInterestGrid::InterestEntry& entry : entries)
+            {
+                netEntityIds.push_back(entry.m_netEntityId);
+            }
+            AZStd::sort(netEntityIds.begin(), netEntityIds.end());
+            return netEntityIds;
+        }
+    };
+
+    TEST_F(ReplicationInterestGridTests, GatherEntitiesWithinRadius)
+    {
+        ReplicationInterestGrid grid;
+        grid.AddEntity(AZ::EntityId(1), NetEntityId{ 1 }, AZ::Vector3(0.0f, 0.0f, 0.0f));
+        grid.AddEntity(AZ::EntityId(2), NetEntityId{ 2 }, AZ::Vector3(50.0f, 0.0f, 0.0f));
+        grid.AddEntity(AZ::EntityId(3), NetEntityId{ 3 }, AZ::Vector3(-150.0f, 20.0f, 0.0f));
+        grid.AddEntity(AZ::EntityId(4), NetEntityId{ 4 }, AZ::Vector3(1000.0f, 1000.0f, 0.0f));
+        // Within the column on the horizontal plane, but too high
+        grid.AddEntity(AZ::EntityId(5), NetEntityId{ 5 }, AZ::Vector3(0.0f, 0.0f, 500.0f));
+        EXPECT_EQ(grid.GetEntityCount(), 5);
+
+        const AZStd::vector<NetEntityId> expected = { NetEntityId{ 1 }, NetEntityId{ 2 }, NetEntityId{ 3 } };
+        EXPECT_EQ(Gather(grid, AZ::Vector3::CreateZero(), 200.0f), expected);
+
+        AZStd::vector<ReplicationInterestGrid::InterestEntry> entries;
+        grid.GatherEntities(AZ::Vector3(50.0f, 0.0f, 0.0f), 1.0f, entries);
+        ASSERT_EQ(entries.size(), 1);
+        EXPECT_EQ(entries[0].m_netEntityId, NetEntityId{ 2 });
+        EXPECT_FLOAT_EQ(entries[0].m_distanceSquared, 0.0f);
+    }
+
+    TEST_F(ReplicationInterestGridTests, MoveAndRemoveEntities)
+    {
+        ReplicationInterestGrid grid;
+        grid.AddEntity(AZ::EntityId(1), NetEntityId{ 1 }, AZ::Vector3(0.0f, 0.0f, 0.0f));
+        grid.AddEntity(AZ::EntityId(2), NetEntityId{ 2 }, AZ::Vector3(10.0f, 0.0f, 0.0f));
+        grid.AddEntity(AZ::EntityId(3), NetEntityId{ 3 }, AZ::Vector3(20.0f, 0.0f, 0.0f));
+        EXPECT_EQ(grid.GetOccupiedCellCount(), 1);
+
+        // Moving the first entity of the cell out of it keeps the other entities of the cell
+        grid.MoveEntity(AZ::EntityId(1), AZ::Vector3(5000.0f, 0.0f, 0.0f));
+        EXPECT_EQ(grid.GetOccupiedCellCount(), 2);
+        EXPECT_EQ(Gather(grid, AZ::Vector3::CreateZero(), 50.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 2 }, NetEntityId{ 3 } }));
+        EXPECT_EQ(Gather(grid, AZ::Vector3(5000.0f, 0.0f, 0.0f), 50.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 1 } }));
+
+        grid.RemoveEntity(AZ::EntityId(2));
+        grid.RemoveEntity(AZ::EntityId(1));
+        EXPECT_EQ(grid.GetEntityCount(), 1);
+        EXPECT_EQ(grid.GetOccupiedCellCount(), 1);
+        EXPECT_EQ(Gather(grid, AZ::Vector3::CreateZero(), 10000.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 3 } }));
+
+        // Unknown entities are ignored
+        grid.MoveEntity(AZ::EntityId(2), AZ::Vector3::CreateZero());
+        grid.RemoveEntity(AZ::EntityId(2));
+        EXPECT_EQ(grid.GetEntityCount(), 1);
+    }
+
+    TEST_F(ReplicationInterestGridTests, NegativeCoordinates)
+    {
+        ReplicationInterestGrid grid;
+        grid.AddEntity(AZ::EntityId(1), NetEntityId{ 1 }, AZ::Vector3(-1.0f, -1.0f, 0.0f));
+        grid.AddEntity(AZ::EntityId(2), NetEntityId{ 2 }, AZ::Vector3(1.0f, 1.0f, 0.0f));
+        EXPECT_EQ(grid.GetOccupiedCellCount(), 2);
+        EXPECT_EQ(Gather(grid, AZ::Vector3(-1.0f, -1.0f, 0.0f), 1.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 1 } }));
+        EXPECT_EQ(Gather(grid, AZ::Vector3::CreateZero(), 2.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 1 }, NetEntityId{ 2 } }));
+    }
+}
@@ -49,12 +49,14 @@ set(FILES
     Include/Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h
     Include/Multiplayer/NetworkInput/IMultiplayerComponentInput.h
     Include/Multiplayer/NetworkTime/INetworkTime.h
+    Include/Multiplayer/NetworkTime/ILagCompensationHistory.h
     Include/Multiplayer/NetworkTime/RewindableArray.h
     Include/Multiplayer/NetworkTime/RewindableArray.inl
     Include/Multiplayer/NetworkTime/RewindableFixedVector.h
     Include/Multiplayer/NetworkTime/RewindableFixedVector.inl
     Include/Multiplayer/NetworkTime/RewindableObject.h
     Include/Multiplayer/NetworkTime/RewindableObject.inl
+    Include/Multiplayer/ReplicationWindows/IReplicationPriorityScorer.h
     Include/Multiplayer/ReplicationWindows/IReplicationWindow.h
     Include/Multiplayer/Session/IMatchmakingRequests.h
     Include/Multiplayer/Session/ISessionHandlingRequests.h
@@ -18,10 +18,12 @@ set(FILES
     Tests/CommonHierarchySetup.h
     Tests/CommonNetworkEntitySetup.h
     Tests/CommonBenchmarkSetup.h
+    Tests/EntityUpdateSerializationCacheTests.cpp
     Tests/IMultiplayerConnectionMock.h
     Tests/IMultiplayerSpawnerMock.h
     Tests/Main.cpp
     Tests/MockInterfaces.h
+    Tests/LagCompensationHistoryTests.cpp
     Tests/LocalPredictionPlayerInputTests.cpp
     Tests/MultiplayerComponentTests.cpp
     Tests/MultiplayerSystemTests.cpp
@@ -30,6 +32,7 @@ set(FILES
     Tests/NetworkInputTests.cpp
     Tests/NetworkRigidBodyTests.cpp
     Tests/NetworkTransformTests.cpp
+    Tests/ReplicationInterestGridTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
     Tests/ServerHierarchyTests.cpp
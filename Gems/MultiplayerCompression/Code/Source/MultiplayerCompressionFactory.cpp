@@ -8,11 +8,18 @@
 
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
+#include "ZstdCompressor.h"
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(AZ::CVarFixedString, mp_zstdDictionaryPath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Path of the zstd dictionary used by MultiplayerZstdCompressor, trained with mp_zstdTrainDictionary, empty for plain zstd");
+    AZ_CVAR(int32_t, mp_zstdCompressionLevel, 3, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The zstd compression level used by MultiplayerZstdCompressor");
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
         return AZStd::make_unique<LZ4Compressor>();
@@ -22,4 +29,22 @@ namespace MultiplayerCompression
     {
         return s_compressorName;
     }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerZstdCompressionFactory::Create()
+    {
+        const AZ::CVarFixedString dictionaryPath = mp_zstdDictionaryPath;
+        const int compressionLevel = mp_zstdCompressionLevel;
+        if (m_dictionaryPath != dictionaryPath.c_str() || m_dictionaryLevel != compressionLevel)
+        {
+            m_dictionaryPath = dictionaryPath.c_str();
+            m_dictionaryLevel = compressionLevel;
+            m_dictionary = m_dictionaryPath.empty() ? nullptr : ZstdDictionary::Load(m_dictionaryPath, compressionLevel);
+        }
+        return AZStd::make_unique<ZstdCompressor>(m_dictionary, compressionLevel);
+    }
+
+    const AZStd::string_view MultiplayerZstdCompressionFactory::GetFactoryName() const
+    {
+        return s_compressorName;
+    }
 }
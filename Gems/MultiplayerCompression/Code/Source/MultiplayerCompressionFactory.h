@@ -9,7 +9,9 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
 #include <AzNetworking/Framework/ICompressor.h>
 
 namespace MultiplayerCompression
@@ -29,4 +31,29 @@ namespace MultiplayerCompression
     private:
         static constexpr AZStd::string_view s_compressorName = "MultiplayerCompressor";
     };
+
+    class ZstdDictionary;
+
+    //! Creates zstd compressors using the dictionary set by mp_zstdDictionaryPath, or plain zstd without a dictionary.
+    //! Select it with net_UdpCompressor MultiplayerZstdCompressor, all the peers need the same dictionary.
+    class MultiplayerZstdCompressionFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the string name of this compressor factory
+        //! @return the string name of this compressor factory
+        const AZStd::string_view GetFactoryName() const override;
+
+    private:
+        static constexpr AZStd::string_view s_compressorName = "MultiplayerZstdCompressor";
+
+        // The dictionary is loaded once and shared by all the compressors, until the path or the level changes
+        AZStd::shared_ptr<const ZstdDictionary> m_dictionary;
+        AZStd::string m_dictionaryPath;
+        int m_dictionaryLevel = 0;
+    };
 }
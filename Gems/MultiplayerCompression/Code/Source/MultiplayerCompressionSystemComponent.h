@@ -41,5 +41,6 @@ namespace MultiplayerCompression
         ////////////////////////////////////////////////////////////////////////
     private:
         MultiplayerCompressionFactory* m_multiplayerCompressionFactory;
+        MultiplayerZstdCompressionFactory* m_multiplayerZstdCompressionFactory;
     };
 }
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdCompressor.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <zstd.h>
+#include <zdict.h>
+
+namespace MultiplayerCompression
+{
+    AZ_CVAR(bool, mp_zstdCaptureSamples, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, the zstd compressors record the packets they compress, to train a dictionary with mp_zstdTrainDictionary");
+
+    // Captures beyond this size are dropped, zstd recommends around 100 times the dictionary size of samples
+    static constexpr size_t MaxCapturedSampleBytes = 16 * 1024 * 1024;
+    static constexpr size_t DefaultDictionarySize = 64 * 1024;
+
+    namespace
+    {
+        struct CapturedSamples
+        {
+            AZStd::mutex m_mutex;
+            AZStd::vector<uint8_t> m_samples;
+            AZStd::vector<size_t> m_sampleSizes;
+        };
+
+        CapturedSamples& GetCapturedSamples()
+        {
+            static CapturedSamples capturedSamples;
+            return capturedSamples;
+        }
+    }
+
+    ZstdDictionary::~ZstdDictionary()
+    {
+        ZSTD_freeCDict(m_compressionDictionary);
+        ZSTD_freeDDict(m_decompressionDictionary);
+    }
+
+    AZStd::shared_ptr<ZstdDictionary> ZstdDictionary::Create(AZStd::span<const uint8_t> dictionaryData, int compressionLevel)
+    {
+        const uint32_t id = ZDICT_getDictID(dictionaryData.data(), dictionaryData.size());
+        if (id == 0)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "The zstd dictionary is invalid, it has no dictionary id");
+            return nullptr;
+        }
+
+        AZStd::shared_ptr<ZstdDictionary> dictionary(aznew ZstdDictionary());
+        dictionary->m_compressionDictionary = ZSTD_createCDict(dictionaryData.data(), dictionaryData.size(), compressionLevel);
+        dictionary->m_decompressionDictionary = ZSTD_createDDict(dictionaryData.data(), dictionaryData.size());
+        dictionary->m_id = id;
+        if (dictionary->m_compressionDictionary == nullptr || dictionary->m_decompressionDictionary == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to create the zstd dictionary %u", id);
+            return nullptr;
+        }
+        return dictionary;
+    }
+
+    AZStd::shared_ptr<ZstdDictionary> ZstdDictionary::Load(AZStd::string_view dictionaryPath, int compressionLevel)
+    {
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(dictionaryPath);
+        if (!readResult.IsSuccess())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to read the zstd dictionary %.*s: %s",
+                AZ_STRING_ARG(dictionaryPath), readResult.GetError().c_str());
+            return nullptr;
+        }
+        return Create(readResult.GetValue(), compressionLevel);
+    }
+
+    bool ZstdDictionary::Train(AZStd::span<const uint8_t> samples, AZStd::span<const size_t> sampleSizes, size_t dictionarySize, AZStd::vector<uint8_t>& outDictionary)
+    {
+        outDictionary.resize_no_construct(dictionarySize);
+        const size_t trainedSize = ZDICT_trainFromBuffer(
+            outDictionary.data(), outDictionary.size(), samples.data(), sampleSizes.data(), aznumeric_cast<unsigned>(sampleSizes.size()));
+        if (ZDICT_isError(trainedSize))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to train the zstd dictionary from %zu samples: %s",
+                sampleSizes.size(), ZDICT_getErrorName(trainedSize));
+            outDictionary.clear();
+            return false;
+        }
+        outDictionary.resize(trainedSize);
+        return true;
+    }
+
+    ZstdCompressor::ZstdCompressor(AZStd::shared_ptr<const ZstdDictionary> dictionary, int compressionLevel)
+        : m_dictionary(AZStd::move(dictionary))
+        , m_compressionLevel(compressionLevel)
+    {
+    }
+
+    ZstdCompressor::~ZstdCompressor()
+    {
+        ZSTD_freeCCtx(m_compressionContext);
+        ZSTD_freeDCtx(m_decompressionContext);
+    }
+
+    bool ZstdCompressor::Init()
+    {
+        if (m_compressionContext == nullptr)
+        {
+            m_compressionContext = ZSTD_createCCtx();
+        }
+        if (m_decompressionContext == nullptr)
+        {
+            m_decompressionContext = ZSTD_createDCtx();
+        }
+        return m_compressionContext != nullptr && m_decompressionContext != nullptr;
+    }
+
+    size_t ZstdCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t ZstdCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return ZSTD_compressBound(uncompSize);
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (!Init())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to create the zstd contexts");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        ZstdSampleCapture::CaptureSample(uncompData, uncompSize);
+
+        const size_t result = m_dictionary
+            ? ZSTD_compress_usingCDict(m_compressionContext, compData, compDataSize, uncompData, uncompSize, m_dictionary->GetCompressionDictionary())
+            : ZSTD_compressCCtx(m_compressionContext, compData, compDataSize, uncompData, uncompSize, m_compressionLevel);
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%zu B) compDataSize:(%zu B): %s", uncompSize, compDataSize, ZSTD_getErrorName(result));
+            return (ZSTD_getErrorCode(result) == ZSTD_error_dstSize_tooSmall)
+                ? AzNetworking::CompressorError::InsufficientBuffer
+                : AzNetworking::CompressorError::CorruptData;
+        }
+
+        compSize = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (!Init())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to create the zstd contexts");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        // The frame records the id of the dictionary it was compressed with, reject the frames of other dictionary versions
+        const uint32_t frameDictionaryId = ZSTD_getDictID_fromFrame(compData, compDataSize);
+        const uint32_t dictionaryId = m_dictionary ? m_dictionary->GetId() : 0;
+        if (frameDictionaryId != 0 && frameDictionaryId != dictionaryId)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Received a packet compressed with zstd dictionary %u, the loaded dictionary is %u", frameDictionaryId, dictionaryId);
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        const size_t result = (frameDictionaryId != 0)
+            ? ZSTD_decompress_usingDDict(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize, m_dictionary->GetDecompressionDictionary())
+            : ZSTD_decompressDCtx(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize);
+        consumedSizeOut = compDataSize;
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B): %s", compDataSize, uncompDataSize, ZSTD_getErrorName(result));
+            return (ZSTD_getErrorCode(result) == ZSTD_error_dstSize_tooSmall)
+                ? AzNetworking::CompressorError::InsufficientBuffer
+                : AzNetworking::CompressorError::CorruptData;
+        }
+
+        uncompSizeOut = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    void ZstdSampleCapture::CaptureSample(const void* data, size_t size)
+    {
+        if (!mp_zstdCaptureSamples || size == 0)
+        {
+            return;
+        }
+
+        CapturedSamples& capturedSamples = GetCapturedSamples();
+        AZStd::scoped_lock lock(capturedSamples.m_mutex);
+        if (capturedSamples.m_samples.size() + size > MaxCapturedSampleBytes)
+        {
+            return;
+        }
+
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        capturedSamples.m_samples.insert(capturedSamples.m_samples.end(), bytes, bytes + size);
+        capturedSamples.m_sampleSizes.push_back(size);
+    }
+
+    bool ZstdSampleCapture::TrainAndSave(AZStd::string_view dictionaryPath, size_t dictionarySize)
+    {
+        AZStd::vector<uint8_t> dictionary;
+        {
+            CapturedSamples& capturedSamples = GetCapturedSamples();
+            AZStd::scoped_lock lock(capturedSamples.m_mutex);
+            if (!ZstdDictionary::Train(capturedSamples.m_samples, capturedSamples.m_sampleSizes, dictionarySize, dictionary))
+            {
+                return false;
+            }
+        }
+
+        auto writeResult = AZ::Utils::WriteFile(AZStd::as_bytes(AZStd::span<const uint8_t>(dictionary)), dictionaryPath);
+        if (!writeResult.IsSuccess())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to write the zstd dictionary %.*s: %s", AZ_STRING_ARG(dictionaryPath), writeResult.GetError().c_str());
+            return false;
+        }
+
+        AZ_TracePrintf("Multiplayer Compressor", "Trained zstd dictionary %u (%zu B) written to %.*s\n",
+            ZDICT_getDictID(dictionary.data(), dictionary.size()), dictionary.size(), AZ_STRING_ARG(dictionaryPath));
+        return true;
+    }
+
+    static void mp_zstdTrainDictionary(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.empty())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "mp_zstdTrainDictionary requires the path of the dictionary file to write");
+            return;
+        }
+
+        const AZStd::string dictionaryPath(arguments[0]);
+        size_t dictionarySize = DefaultDictionarySize;
+        if (arguments.size() > 1)
+        {
+            dictionarySize = AZStd::stoul(AZStd::string(arguments[1]));
+        }
+        ZstdSampleCapture::TrainAndSave(dictionaryPath, dictionarySize);
+    }
+    AZ_CONSOLEFREEFUNC(mp_zstdTrainDictionary, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Trains a zstd dictionary from the packets captured with mp_zstdCaptureSamples and writes it to a file: <path> [dictionary size in bytes]");
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace MultiplayerCompression
+{
+    static const char* ZstdCompressorName = "Zstd";
+    static const AzNetworking::CompressorType ZstdCompressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(ZstdCompressorName)));
+
+    /**
+    * A zstd dictionary trained offline from captured packets, shared by all the compressors using it.
+    * The dictionary id is written in every compressed frame, so peers using a different version of the dictionary
+    * fail to decompress instead of reading garbage.
+    */
+    class ZstdDictionary
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdDictionary, AZ::SystemAllocator);
+
+        ~ZstdDictionary();
+
+        //! Creates a dictionary from the content of a dictionary file.
+        //! @param dictionaryData   the trained dictionary
+        //! @param compressionLevel the zstd compression level the dictionary is prepared for
+        //! @return the dictionary, nullptr if the data isn't a valid dictionary
+        static AZStd::shared_ptr<ZstdDictionary> Create(AZStd::span<const uint8_t> dictionaryData, int compressionLevel);
+
+        //! Loads a dictionary file.
+        //! @param dictionaryPath   path of the dictionary file
+        //! @param compressionLevel the zstd compression level the dictionary is prepared for
+        //! @return the dictionary, nullptr if the file can't be read or isn't a valid dictionary
+        static AZStd::shared_ptr<ZstdDictionary> Load(AZStd::string_view dictionaryPath, int compressionLevel);
+
+        //! Trains a dictionary from sample payloads.
+        //! @param samples        the sample payloads, concatenated
+        //! @param sampleSizes    the size of each sample payload
+        //! @param dictionarySize the maximum size of the dictionary in bytes
+        //! @param outDictionary  on success, the dictionary data
+        //! @return boolean true on success, false on failure
+        static bool Train(AZStd::span<const uint8_t> samples, AZStd::span<const size_t> sampleSizes, size_t dictionarySize, AZStd::vector<uint8_t>& outDictionary);
+
+        //! The id zstd writes in the frames compressed with this dictionary.
+        uint32_t GetId() const { return m_id; }
+
+        const ZSTD_CDict_s* GetCompressionDictionary() const { return m_compressionDictionary; }
+        const ZSTD_DDict_s* GetDecompressionDictionary() const { return m_decompressionDictionary; }
+
+    private:
+        ZstdDictionary() = default;
+        AZ_DISABLE_COPY_MOVE(ZstdDictionary);
+
+        ZSTD_CDict_s* m_compressionDictionary = nullptr;
+        ZSTD_DDict_s* m_decompressionDictionary = nullptr;
+        uint32_t m_id = 0;
+    };
+
+    /**
+    * Implements a zstd Compressor against Multiplayer's Compressor interface for use with AzNetworking.
+    * With a dictionary trained on the game's own packets, small repetitive packets such as entity updates compress far
+    * better than with a generic per-packet compressor. Without a dictionary it behaves as plain zstd.
+    */
+    class ZstdCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdCompressor, AZ::SystemAllocator);
+
+        //! @param dictionary       the dictionary to compress with, or nullptr for plain zstd
+        //! @param compressionLevel the zstd compression level used without a dictionary
+        ZstdCompressor(AZStd::shared_ptr<const ZstdDictionary> dictionary, int compressionLevel);
+        ~ZstdCompressor() override;
+
+        const char* GetName() const { return ZstdCompressorName; }
+        AzNetworking::CompressorType GetType() const override { return ZstdCompressorType; };
+
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+        AZ_DISABLE_COPY_MOVE(ZstdCompressor);
+
+        AZStd::shared_ptr<const ZstdDictionary> m_dictionary;
+        ZSTD_CCtx_s* m_compressionContext = nullptr;
+        ZSTD_DCtx_s* m_decompressionContext = nullptr;
+        int m_compressionLevel = 0;
+    };
+
+    //! Records the uncompressed payloads passing through the zstd compressors while mp_zstdCaptureSamples is enabled,
+    //! the samples train a dictionary with the mp_zstdTrainDictionary console command.
+    class ZstdSampleCapture
+    {
+    public:
+        //! Records a payload if the capture is enabled.
+        static void CaptureSample(const void* data, size_t size);
+
+        //! Trains a dictionary from the captured samples and writes it to a file.
+        //! @param dictionaryPath path of the dictionary file to write
+        //! @param dictionarySize the maximum size of the dictionary in bytes
+        //! @return boolean true on success, false on failure
+        static bool TrainAndSave(AZStd::string_view dictionaryPath, size_t dictionarySize);
+    };
+}
@@ -10,6 +10,7 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <LZ4Compressor.h>
+#include <ZstdCompressor.h>
 
 #include <AzCore/Compression/Compression.h>
 #include <AzCore/std/chrono/chrono.h>
@@ -115,4 +116,89 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+namespace
+{
+    // Builds a packet looking like an entity update, mostly the same bytes with a few changing fields
+    void FillSamplePacket(AZStd::vector<uint8_t>& packet, uint32_t seed)
+    {
+        packet.resize(256);
+        for (size_t index = 0; index < packet.size(); ++index)
+        {
+            packet[index] = static_cast<uint8_t>((index % 16 == 0) ? (seed * 31 + index) : (index * 7));
+        }
+    }
+
+    void ExpectZstdRoundTrip(MultiplayerCompression::ZstdCompressor& compressor, const AZStd::vector<uint8_t>& packet, size_t& compressedSize)
+    {
+        AZStd::vector<uint8_t> compressed(compressor.GetMaxCompressedBufferSize(packet.size()));
+        AZStd::vector<uint8_t> decompressed(packet.size());
+        size_t consumedSize = 0;
+        size_t uncompressedSize = 0;
+
+        ASSERT_EQ(compressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+        ASSERT_EQ(compressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+        EXPECT_EQ(consumedSize, compressedSize);
+        EXPECT_EQ(uncompressedSize, packet.size());
+        EXPECT_TRUE(memcmp(decompressed.data(), packet.data(), packet.size()) == 0);
+    }
+
+    AZStd::shared_ptr<MultiplayerCompression::ZstdDictionary> TrainSampleDictionary()
+    {
+        AZStd::vector<uint8_t> samples;
+        AZStd::vector<size_t> sampleSizes;
+        AZStd::vector<uint8_t> packet;
+        for (uint32_t seed = 0; seed < 1000; ++seed)
+        {
+            FillSamplePacket(packet, seed);
+            samples.insert(samples.end(), packet.begin(), packet.end());
+            sampleSizes.push_back(packet.size());
+        }
+
+        AZStd::vector<uint8_t> dictionaryData;
+        if (!MultiplayerCompression::ZstdDictionary::Train(samples, sampleSizes, 4 * 1024, dictionaryData))
+        {
+            return nullptr;
+        }
+        return MultiplayerCompression::ZstdDictionary::Create(dictionaryData, 3);
+    }
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompression_ZstdRoundTripTest)
+{
+    MultiplayerCompression::ZstdCompressor zstdCompressor(nullptr, 3);
+    ASSERT_TRUE(zstdCompressor.Init());
+
+    AZStd::vector<uint8_t> packet;
+    FillSamplePacket(packet, 1);
+    size_t compressedSize = 0;
+    ExpectZstdRoundTrip(zstdCompressor, packet, compressedSize);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompression_ZstdDictionaryTest)
+{
+    AZStd::shared_ptr<MultiplayerCompression::ZstdDictionary> dictionary = TrainSampleDictionary();
+    ASSERT_NE(dictionary, nullptr);
+    EXPECT_NE(dictionary->GetId(), 0u);
+
+    MultiplayerCompression::ZstdCompressor plainCompressor(nullptr, 3);
+    MultiplayerCompression::ZstdCompressor dictionaryCompressor(dictionary, 3);
+
+    AZStd::vector<uint8_t> packet;
+    FillSamplePacket(packet, 5000);
+    size_t plainSize = 0;
+    size_t dictionarySize = 0;
+    ExpectZstdRoundTrip(plainCompressor, packet, plainSize);
+    ExpectZstdRoundTrip(dictionaryCompressor, packet, dictionarySize);
+    EXPECT_LT(dictionarySize, plainSize);
+
+    // A peer without the dictionary rejects the packets compressed with it
+    AZStd::vector<uint8_t> compressed(dictionaryCompressor.GetMaxCompressedBufferSize(packet.size()));
+    AZStd::vector<uint8_t> decompressed(packet.size());
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+    ASSERT_EQ(dictionaryCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(plainCompressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::CorruptData);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
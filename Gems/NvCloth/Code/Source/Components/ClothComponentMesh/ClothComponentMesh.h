@@ -117,6 +117,9 @@ namespace NvCloth
         AZ::u32 m_renderDataBufferIndex = 0;
         AZStd::array<RenderData, RenderDataBufferSize> m_renderDataBuffer;
 
+        // Normals of the cloth particles (simplified mesh), kept to avoid allocating them every simulation update.
+        AZStd::vector<AZ::Vector3> m_particleNormals;
+
         // Vertex mapping between full mesh and simplified mesh used in cloth simulation.
         // Negative elements means the vertex has been removed.
         AZStd::vector<int> m_meshRemappedVertices;
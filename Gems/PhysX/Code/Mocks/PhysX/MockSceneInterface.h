@@ -43,6 +43,8 @@ namespace UnitTest
         MOCK_METHOD4(QuerySceneAsyncBatch, bool(AzPhysics::SceneHandle, AzPhysics::SceneQuery::AsyncRequestId, const AzPhysics::
             SceneQueryRequests&, AzPhysics::SceneQuery::AsyncBatchCallback));
         MOCK_METHOD2(QuerySceneBatch, AzPhysics::SceneQueryHitsList(AzPhysics::SceneHandle, const AzPhysics::SceneQueryRequests&));
+        MOCK_METHOD3(QuerySceneRayCastBatch, void(AzPhysics::SceneHandle, AZStd::span<const AzPhysics::RayCastRequest>, AzPhysics::SceneQueryBatchHits&));
+        MOCK_METHOD3(QuerySceneShapeCastBatch, void(AzPhysics::SceneHandle, AZStd::span<const AzPhysics::ShapeCastRequest>, AzPhysics::SceneQueryBatchHits&));
         MOCK_METHOD2(RegisterSceneActiveSimulatedBodiesHandler, void(AzPhysics::SceneHandle, AZ::Event<AZStd::tuple<AZ::Crc32, signed char>, const AZStd::vector<
             AZStd::tuple<AZ::Crc32, int>>&, float>::Handler&));
         MOCK_METHOD2(RegisterSceneCollisionEventHandler, void(AzPhysics::SceneHandle, AZ::Event<AZStd::tuple<AZ::Crc32, signed char>, const AZStd::vector<
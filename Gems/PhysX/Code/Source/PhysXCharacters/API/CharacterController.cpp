@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Physics/CollisionBus.h>
@@ -20,11 +21,15 @@
 #include <PhysX/Debug/PhysXDebugConfiguration.h>
 #include <PhysX/MathConversion.h>
 #include <PhysXCharacters/API/CharacterController.h>
+#include <Scene/PhysXScene.h>
 #include <Source/Collision.h>
 #include <Source/Shape.h>
 
 namespace PhysX
 {
+    AZ_CVAR(bool, physx_batchCharacterMoves, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Resolve the character controller moves requested during a physics step together, when the scene starts simulating the step.");
+
     void CharacterControllerConfiguration::Reflect(AZ::ReflectContext* context)
     {
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -341,6 +346,7 @@ namespace PhysX
             return;
         }
 
+        CancelQueuedMove();
         DestroyShadowBody();
         RemoveControllerFromScene();
 
@@ -389,6 +395,7 @@ namespace PhysX
 
     CharacterController::~CharacterController()
     {
+        CancelQueuedMove();
         DestroyShadowBody();
         m_shape = nullptr; //shape has to go before m_pxController
 
@@ -635,20 +642,24 @@ namespace PhysX
     {
         if (m_pxController)
         {
-            const AZ::Vector3 oldPosition = GetBasePosition();
-            {
-                PHYSX_SCENE_WRITE_LOCK(m_pxController->getScene());
-                m_pxController->move(PxMathConvert(requestedMovement), m_minimumMovementDistance, deltaTime, m_pxControllerFilters);
-                if (m_shadowBody)
-                {
-                    m_shadowBody->SetKinematicTarget(GetTransform());
-                }
-            }
-            const AZ::Vector3 newPosition = GetBasePosition();
-            m_observedVelocity = deltaTime > 0.0f ? (newPosition - oldPosition) / deltaTime : AZ::Vector3::CreateZero();
+            PHYSX_SCENE_WRITE_LOCK(m_pxController->getScene());
+            MoveController(requestedMovement, deltaTime, nullptr);
         }
     }
 
+    void CharacterController::MoveController(
+        const AZ::Vector3& requestedMovement, float deltaTime, const physx::PxObstacleContext* obstacleContext)
+    {
+        const AZ::Vector3 oldPosition = GetBasePosition();
+        m_pxController->move(PxMathConvert(requestedMovement), m_minimumMovementDistance, deltaTime, m_pxControllerFilters, obstacleContext);
+        if (m_shadowBody)
+        {
+            m_shadowBody->SetKinematicTarget(GetTransform());
+        }
+        const AZ::Vector3 newPosition = GetBasePosition();
+        m_observedVelocity = deltaTime > 0.0f ? (newPosition - oldPosition) / deltaTime : AZ::Vector3::CreateZero();
+    }
+
     void CharacterController::ApplyRequestedVelocity(float deltaTime)
     {
         const AZ::Vector3 totalRequestedVelocity = m_requestedVelocityForTick + m_requestedVelocityForPhysicsTimestep;
@@ -657,9 +668,51 @@ namespace PhysX
             : totalRequestedVelocity;
         const AZ::Vector3 deltaPosition = clampedVelocity * deltaTime;
 
+        if (physx_batchCharacterMoves && m_pxController)
+        {
+            if (!m_isMoveQueued)
+            {
+                if (auto* scene = azrtti_cast<PhysXScene*>(GetScene()))
+                {
+                    scene->QueueCharacterMove(this);
+                    m_isMoveQueued = true;
+                    m_queuedMovement = deltaPosition;
+                    return;
+                }
+            }
+            else
+            {
+                m_queuedMovement += deltaPosition;
+                return;
+            }
+        }
+
         Move(deltaPosition, deltaTime);
     }
 
+    void CharacterController::ResolveQueuedMove(float deltaTime, const physx::PxObstacleContext* obstacleContext)
+    {
+        m_isMoveQueued = false;
+        if (m_pxController)
+        {
+            MoveController(m_queuedMovement, deltaTime, obstacleContext);
+        }
+        m_queuedMovement = AZ::Vector3::CreateZero();
+    }
+
+    void CharacterController::CancelQueuedMove()
+    {
+        if (m_isMoveQueued)
+        {
+            if (auto* scene = azrtti_cast<PhysXScene*>(GetScene()))
+            {
+                scene->CancelCharacterMove(this);
+            }
+            m_isMoveQueued = false;
+            m_queuedMovement = AZ::Vector3::CreateZero();
+        }
+    }
+
     void CharacterController::SetRotation(const AZ::Quaternion& rotation)
     {
         if (m_shadowBody)
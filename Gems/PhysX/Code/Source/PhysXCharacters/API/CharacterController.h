@@ -232,6 +232,10 @@ namespace PhysX
         float GetHalfForwardExtent() const;
         void SetHalfForwardExtent(float halfForwardExtent);
 
+        //! Moves the controller by the movement queued by ApplyRequestedVelocity when physx_batchCharacterMoves is enabled.
+        //! Called by the scene for all the queued moves at once, with the scene write lock held.
+        void ResolveQueuedMove(float deltaTime, const physx::PxObstacleContext* obstacleContext);
+
     private:
         void SetFilterDataAndShape(const Physics::CharacterConfiguration& characterConfig);
         void SetUserData(const Physics::CharacterConfiguration& characterConfig);
@@ -242,6 +246,8 @@ namespace PhysX
         void DestroyShadowBody();
         void RemoveControllerFromScene();
         void UpdateFilterLayerAndGroup(AzPhysics::CollisionLayer collisionLayer, AzPhysics::CollisionGroup collisionGroup);
+        void MoveController(const AZ::Vector3& requestedMovement, float deltaTime, const physx::PxObstacleContext* obstacleContext);
+        void CancelQueuedMove();
 
         physx::PxController* m_pxController = nullptr; ///< The underlying PhysX controller.
         float m_minimumMovementDistance = 0.0f; ///< To avoid jittering, the controller will not attempt to move distances below this.
@@ -249,6 +255,8 @@ namespace PhysX
         AZ::Vector3 m_requestedVelocityForPhysicsTimestep =
             AZ::Vector3::CreateZero(); ///< Used to accumulate velocity requests which last for a physics timestep.
         AZ::Vector3 m_observedVelocity = AZ::Vector3::CreateZero(); ///< Velocity observed in the simulation, may not match desired.
+        AZ::Vector3 m_queuedMovement = AZ::Vector3::CreateZero(); ///< Movement waiting for the scene to resolve the batched moves.
+        bool m_isMoveQueued = false; ///< True while the controller is in the moves queued in the scene.
         PhysX::ActorData m_actorUserData; ///< Used to populate the user data on the PxActor associated with the controller.
         physx::PxFilterData m_filterData; ///< Controls filtering for collisions with other objects and scene queries.
         physx::PxControllerFilters m_pxControllerFilters; ///< Controls which objects the controller interacts with when moving.
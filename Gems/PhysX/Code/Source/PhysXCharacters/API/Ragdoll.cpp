@@ -6,9 +6,12 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/SystemBus.h>
@@ -21,6 +24,19 @@
 
 namespace PhysX
 {
+    AZ_CVAR(bool, physx_ragdollLod, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Lower the level of detail of the simulated ragdolls based on their screen size seen from the active camera.");
+    AZ_CVAR(float, physx_ragdollLodReducedScreenSize, 0.1f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Fraction of the screen height below which a simulated ragdoll uses the reduced level of detail.");
+    AZ_CVAR(float, physx_ragdollLodFrozenScreenSize, 0.02f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Fraction of the screen height below which a simulated ragdoll is frozen.");
+    AZ_CVAR(AZ::u32, physx_ragdollLodReducedPositionIterations, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Max solver position iterations of the ragdoll nodes at the reduced level of detail.");
+    AZ_CVAR(AZ::u32, physx_ragdollLodReducedVelocityIterations, 1, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Max solver velocity iterations of the ragdoll nodes at the reduced level of detail.");
+    AZ_CVAR(float, physx_ragdollLodReducedSleepThresholdScale, 10.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Scale applied to the sleep threshold of the ragdoll nodes at the reduced level of detail, so settled ragdolls sleep sooner.");
+
     namespace Internal
     {
         physx::PxScene* GetPxScene(AzPhysics::SceneHandle sceneHandle)
@@ -103,6 +119,8 @@ namespace PhysX
                 this->ApplyQueuedEnableSimulation();
                 this->ApplyQueuedSetState();
                 this->ApplyQueuedDisableSimulation();
+                this->UpdateLodFromActiveCamera();
+                this->UpdateDistalNodeTargets();
             })
     {
         m_sceneOwner = sceneHandle;
@@ -150,6 +168,167 @@ namespace PhysX
         m_queuedDisableSimulation = false;
     }
 
+    void Ragdoll::SetLod(RagdollLod lod)
+    {
+        if (lod == m_lod || !m_simulating)
+        {
+            return;
+        }
+
+        physx::PxScene* pxScene = Internal::GetPxScene(m_sceneOwner);
+        if (pxScene == nullptr)
+        {
+            return;
+        }
+
+        InitNodeLodStates();
+
+        PHYSX_SCENE_WRITE_LOCK(pxScene);
+
+        const size_t numNodes = m_nodes.size();
+        for (size_t nodeIndex = 0; nodeIndex < numNodes; nodeIndex++)
+        {
+            physx::PxRigidDynamic* pxActor = GetPxRigidDynamic(nodeIndex);
+            if (!pxActor)
+            {
+                continue;
+            }
+
+            NodeLodState& nodeLodState = m_nodeLodStates[nodeIndex];
+            const bool holdKinematic = (lod == RagdollLod::Frozen) || (lod == RagdollLod::Reduced && nodeLodState.m_isDistal);
+            if (holdKinematic != nodeLodState.m_isHeldKinematic)
+            {
+                if (holdKinematic)
+                {
+                    nodeLodState.m_wasKinematic = pxActor->getRigidBodyFlags().isSet(physx::PxRigidBodyFlag::eKINEMATIC);
+                    if (physx::PxRigidDynamic* parentActor = nodeLodState.m_isDistal ? GetPxRigidDynamic(m_parentIndices[nodeIndex]) : nullptr)
+                    {
+                        nodeLodState.m_parentToNode = parentActor->getGlobalPose().getInverse() * pxActor->getGlobalPose();
+                    }
+                    pxActor->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, true);
+                }
+                else
+                {
+                    pxActor->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, nodeLodState.m_wasKinematic);
+                }
+                nodeLodState.m_isHeldKinematic = holdKinematic;
+            }
+
+            if (lod == RagdollLod::Full)
+            {
+                pxActor->setSolverIterationCounts(nodeLodState.m_positionIterations, nodeLodState.m_velocityIterations);
+                pxActor->setSleepThreshold(nodeLodState.m_sleepThreshold);
+            }
+            else
+            {
+                pxActor->setSolverIterationCounts(
+                    AZStd::clamp<physx::PxU32>(physx_ragdollLodReducedPositionIterations, 1, nodeLodState.m_positionIterations),
+                    AZStd::min<physx::PxU32>(physx_ragdollLodReducedVelocityIterations, nodeLodState.m_velocityIterations));
+                pxActor->setSleepThreshold(nodeLodState.m_sleepThreshold * physx_ragdollLodReducedSleepThresholdScale);
+            }
+        }
+
+        m_lod = lod;
+    }
+
+    RagdollLod Ragdoll::GetLod() const
+    {
+        return m_lod;
+    }
+
+    void Ragdoll::InitNodeLodStates()
+    {
+        if (!m_nodeLodStates.empty())
+        {
+            return;
+        }
+
+        const size_t numNodes = m_nodes.size();
+        m_nodeLodStates.resize(numNodes);
+        for (size_t nodeIndex = 0; nodeIndex < numNodes; nodeIndex++)
+        {
+            NodeLodState& nodeLodState = m_nodeLodStates[nodeIndex];
+            if (const physx::PxRigidDynamic* pxActor = GetPxRigidDynamic(nodeIndex))
+            {
+                PHYSX_SCENE_READ_LOCK(pxActor->getScene());
+                pxActor->getSolverIterationCounts(nodeLodState.m_positionIterations, nodeLodState.m_velocityIterations);
+                nodeLodState.m_sleepThreshold = pxActor->getSleepThreshold();
+            }
+
+            // The root, and the nodes other nodes hang from, are never distal
+            const bool hasParent = nodeIndex < m_parentIndices.size() && m_parentIndices[nodeIndex] < numNodes;
+            nodeLodState.m_isDistal = hasParent
+                && AZStd::find(m_parentIndices.begin(), m_parentIndices.end(), nodeIndex) == m_parentIndices.end();
+        }
+    }
+
+    void Ragdoll::UpdateLodFromActiveCamera()
+    {
+        if (!physx_ragdollLod || !m_simulating || !Camera::ActiveCameraRequestBus::HasHandlers())
+        {
+            return;
+        }
+
+        AZ::Transform cameraTransform = AZ::Transform::CreateIdentity();
+        Camera::ActiveCameraRequestBus::BroadcastResult(cameraTransform, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraTransform);
+        Camera::Configuration cameraConfiguration;
+        Camera::ActiveCameraRequestBus::BroadcastResult(
+            cameraConfiguration, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraConfiguration);
+
+        const AZ::Aabb aabb = GetAabb();
+        if (!aabb.IsValid())
+        {
+            return;
+        }
+
+        // Fraction of the screen height covered by the bounding sphere of the ragdoll
+        const float radius = 0.5f * aabb.GetExtents().GetLength();
+        const float distance = aabb.GetCenter().GetDistance(cameraTransform.GetTranslation());
+        const float halfFovTan = AZStd::tan(0.5f * AZ::GetMax(cameraConfiguration.m_fovRadians, AZ::Constants::FloatEpsilon));
+        const float screenSize = (distance > radius) ? radius / (distance * halfFovTan) : 1.0f;
+
+        if (screenSize < physx_ragdollLodFrozenScreenSize)
+        {
+            SetLod(RagdollLod::Frozen);
+        }
+        else if (screenSize < physx_ragdollLodReducedScreenSize)
+        {
+            SetLod(RagdollLod::Reduced);
+        }
+        else
+        {
+            SetLod(RagdollLod::Full);
+        }
+    }
+
+    void Ragdoll::UpdateDistalNodeTargets()
+    {
+        if (m_lod != RagdollLod::Reduced || !m_simulating)
+        {
+            return;
+        }
+
+        physx::PxScene* pxScene = Internal::GetPxScene(m_sceneOwner);
+        PHYSX_SCENE_WRITE_LOCK(pxScene);
+
+        const size_t numNodes = m_nodes.size();
+        for (size_t nodeIndex = 0; nodeIndex < numNodes; nodeIndex++)
+        {
+            const NodeLodState& nodeLodState = m_nodeLodStates[nodeIndex];
+            if (!nodeLodState.m_isDistal || !nodeLodState.m_isHeldKinematic)
+            {
+                continue;
+            }
+
+            physx::PxRigidDynamic* pxActor = GetPxRigidDynamic(nodeIndex);
+            physx::PxRigidDynamic* parentActor = GetPxRigidDynamic(m_parentIndices[nodeIndex]);
+            if (pxActor && parentActor)
+            {
+                pxActor->setKinematicTarget(parentActor->getGlobalPose() * nodeLodState.m_parentToNode);
+            }
+        }
+    }
+
     // Physics::Ragdoll
     void Ragdoll::EnableSimulation(const Physics::RagdollState& initialState)
     {
@@ -238,6 +417,9 @@ namespace PhysX
             return;
         }
 
+        // The nodes are restored to full detail, so they are simulated as configured when enabled again
+        SetLod(RagdollLod::Full);
+
         physx::PxScene* pxScene = Internal::GetPxScene(m_sceneOwner);
         const size_t numNodes = m_nodes.size();
 
@@ -334,6 +516,12 @@ namespace PhysX
             return;
         }
 
+        // The nodes held kinematic by the level of detail ignore the requested state until they are released
+        if (nodeIndex < m_nodeLodStates.size() && m_nodeLodStates[nodeIndex].m_isHeldKinematic)
+        {
+            return;
+        }
+
         physx::PxRigidDynamic* actor = GetPxRigidDynamic(nodeIndex);
         if (!actor)
         {
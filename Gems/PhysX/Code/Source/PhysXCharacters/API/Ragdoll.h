@@ -16,6 +16,14 @@
 
 namespace PhysX
 {
+    /// Level of detail of a simulated ragdoll, trading simulation quality for cost.
+    enum class RagdollLod : AZ::u8
+    {
+        Full, ///< All the nodes are simulated with their configured solver iterations.
+        Reduced, ///< Fewer solver iterations and earlier sleep, the distal nodes follow their parent kinematically.
+        Frozen ///< All the nodes are kinematic and keep their current pose.
+    };
+
     /// PhysX specific implementation of generic physics API Ragdoll class.
     class Ragdoll
         : public Physics::Ragdoll
@@ -38,6 +46,11 @@ namespace PhysX
         physx::PxRigidDynamic* GetPxRigidDynamic(size_t nodeIndex) const;
         physx::PxTransform GetRootPxTransform() const;
 
+        /// Sets the level of detail of the ragdoll while it is simulated, the ragdoll is back to full detail once disabled.
+        /// The level of detail is also updated from the active camera at every physics step when physx_ragdollLod is enabled.
+        void SetLod(RagdollLod lod);
+        RagdollLod GetLod() const;
+
         // Physics::Ragdoll
         void EnableSimulation(const Physics::RagdollState& initialState) override;
         void EnableSimulationQueued(const Physics::RagdollState& initialState) override;
@@ -69,6 +82,12 @@ namespace PhysX
         void ApplyQueuedSetState();
         void ApplyQueuedDisableSimulation();
 
+        /// Selects the level of detail from the screen size of the ragdoll seen from the active camera.
+        void UpdateLodFromActiveCamera();
+        /// Moves the distal nodes held kinematic by the reduced level of detail along with their parent.
+        void UpdateDistalNodeTargets();
+        void InitNodeLodStates();
+
         AZStd::vector<AZStd::unique_ptr<RagdollNode>> m_nodes;
         Physics::ParentIndices m_parentIndices;
         AZ::Outcome<size_t> m_rootIndex = AZ::Failure();
@@ -80,6 +99,20 @@ namespace PhysX
         /// Used to track whether a call to DisableSimulation has been queued.
         bool m_queuedDisableSimulation = false;
 
+        /// The state a node is restored to when the level of detail goes back to full.
+        struct NodeLodState
+        {
+            physx::PxTransform m_parentToNode = physx::PxTransform(physx::PxIdentity); ///< Pose relative to the parent while held.
+            physx::PxU32 m_positionIterations = 0;
+            physx::PxU32 m_velocityIterations = 0;
+            float m_sleepThreshold = 0.0f;
+            bool m_isDistal = false; ///< True if no other node has this node as its parent.
+            bool m_isHeldKinematic = false; ///< True while the level of detail makes the node kinematic.
+            bool m_wasKinematic = false; ///< Whether the node was kinematic before the level of detail held it.
+        };
+        AZStd::vector<NodeLodState> m_nodeLodStates;
+        RagdollLod m_lod = RagdollLod::Full;
+
         AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_sceneStartSimHandler;
     };
 } // namespace PhysX
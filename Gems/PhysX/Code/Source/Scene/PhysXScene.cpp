@@ -18,6 +18,7 @@
 #include <PhysXCharacters/API/CharacterController.h>
 #include <PhysXCharacters/API/CharacterUtils.h>
 #include <System/PhysXSystem.h>
+#include <System/PhysXTaskDispatcher.h>
 #include <PhysX/Joint/Configuration/PhysXJointConfiguration.h>
 #include <PhysX/Debug/PhysXDebugConfiguration.h>
 #include <PhysX/MathConversion.h>
@@ -42,12 +43,16 @@
 namespace PhysX
 {
     AZ_CVAR_EXTERNED(bool, physx_batchTransformSync);
+    AZ_CVAR_EXTERNED(bool, physx_pipelinedSimulation);
 
     AZ_CVAR(bool, physx_parallelTransformSync, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Multithreaded transform update for rigid bodies. "
         "Only relevant if batched transform update is enabled.");
     AZ_CVAR(size_t, physx_parallelTransformSyncBatchSize, 250, nullptr, AZ::ConsoleFunctorFlags::Null,
         "How many rigid bodies should be processed per task");
 
+    AZ_CVAR(size_t, physx_sceneQueryBatchSize, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How many requests of a batched scene query are processed per task. Smaller batches run on the calling thread.");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXScene, AZ::SystemAllocator);
 
     AZ_CVAR(bool, physx_profileSimulationDatapoints, true, nullptr, AZ::ConsoleFunctorFlags::Null,
@@ -474,6 +479,64 @@ namespace PhysX
 
             return status;
         }
+
+        // Runs queryFunction(index, hits) for every request of a batched query, in parallel when there is more than one
+        // batch of requests. Every task locks the scene for read once for all the requests it processes.
+        template<typename QueryFunction>
+        void QueryBatch(physx::PxScene* physxScene, size_t requestCount, const QueryFunction& queryFunction)
+        {
+            auto queryRange = [physxScene, &queryFunction](size_t start, size_t end)
+            {
+                PHYSX_SCENE_READ_LOCK(physxScene);
+                AzPhysics::SceneQueryHits hits;
+                for (size_t index = start; index < end; ++index)
+                {
+                    hits.m_hits.clear();
+                    queryFunction(index, hits);
+                }
+            };
+
+            const size_t batchSize = AZStd::max<size_t>(physx_sceneQueryBatchSize, 1);
+            if (requestCount <= batchSize)
+            {
+                queryRange(0, requestCount);
+                return;
+            }
+
+            AZ::TaskGraph taskGraph("Scene Query Batch");
+            AZ::TaskGraphEvent finishEvent("Scene query batch event");
+            const AZ::TaskDescriptor taskDescriptor{ "SceneQueryBatchTask", "Physics" };
+            for (size_t start = 0; start < requestCount; start += batchSize)
+            {
+                taskGraph.AddTask(
+                    taskDescriptor,
+                    [start, end = AZStd::min(start + batchSize, requestCount), &queryRange]()
+                    {
+                        AZ_PROFILE_SCOPE(Physics, "Scene Query Batch Task");
+                        queryRange(start, end);
+                    });
+            }
+            taskGraph.Submit(&finishEvent);
+            finishEvent.Wait();
+        }
+
+        // Stores the closest of the hits of a request in the results of a batched query
+        void SetClosestHit(const AzPhysics::SceneQueryHits& hits, size_t index, AzPhysics::SceneQueryBatchHits& results)
+        {
+            const AzPhysics::SceneQueryHit* closestHit = nullptr;
+            for (const AzPhysics::SceneQueryHit& hit : hits.m_hits)
+            {
+                if (closestHit == nullptr || hit.m_distance < closestHit->m_distance)
+                {
+                    closestHit = &hit;
+                }
+            }
+
+            if (closestHit != nullptr)
+            {
+                results.SetHit(index, *closestHit);
+            }
+        }
     }
 
     PhysXScene::PhysXScene(const AzPhysics::SceneConfiguration& config, const AzPhysics::SceneHandle& sceneHandle)
@@ -516,6 +579,15 @@ namespace PhysX
     {
         m_physicsSystemConfigChanged.Disconnect();
 
+        if (m_isSimulating)
+        {
+            // A pipelined step may still be running, the scene can only be modified once it completes
+            m_pxScene->checkResults(true);
+            PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+            m_pxScene->fetchResults(true);
+            m_isSimulating = false;
+        }
+
         s_overlapBuffer = {};
         s_rayCastBuffer = {};
         s_sweepBuffer = {};
@@ -537,6 +609,13 @@ namespace PhysX
 
         ClearDeferedDeletions();
 
+        m_queuedCharacterMoves.clear();
+        if (m_controllerObstacleContext)
+        {
+            m_controllerObstacleContext->release();
+            m_controllerObstacleContext = nullptr;
+        }
+
         if (m_controllerManager)
         {
             m_controllerManager->release();
@@ -564,20 +643,25 @@ namespace PhysX
             m_sceneSimulationStartEvent.Signal(m_sceneHandle, deltatime);
         }
 
+        ResolveCharacterMoves(deltatime);
+
         m_currentDeltaTime = deltatime;
 
         PHYSX_SCENE_WRITE_LOCK(m_pxScene);
         m_pxScene->simulate(deltatime);
+        m_isSimulating = true;
     }
 
     void PhysXScene::FinishSimulation()
     {
         AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
 
-        if (!IsEnabled())
+        // A scene disabled while it simulates still finishes the step it started
+        if (!m_isSimulating)
         {
             return;
         }
+        m_isSimulating = false;
 
         {
             AZ_PROFILE_SCOPE(Physics, "PhysXScene::CheckResults");
@@ -624,7 +708,8 @@ namespace PhysX
             // Keep the event signal outside of the scene lock since there may be handlers that want to lock the scene for write
             m_sceneActiveSimulatedBodies.Signal(m_sceneHandle, activeBodyHandles, m_currentDeltaTime);
 
-            if (physx_batchTransformSync)
+            // Pipelined steps finish at different points of the tick, their transform syncs are batched into a single sync point
+            if (physx_batchTransformSync || physx_pipelinedSimulation)
             {
                 m_queuedActiveBodyIndices.IncreaseCapacity(activeBodyHandles.size());
 
@@ -1023,6 +1108,40 @@ namespace PhysX
         return results;
     }
 
+    void PhysXScene::QuerySceneRayCastBatch(AZStd::span<const AzPhysics::RayCastRequest> requests, AzPhysics::SceneQueryBatchHits& results)
+    {
+        AZ_PROFILE_FUNCTION(Physics);
+
+        results.Resize(requests.size());
+        Internal::QueryBatch(m_pxScene, requests.size(),
+            [this, requests, &results](size_t index, AzPhysics::SceneQueryHits& hits)
+            {
+                const AzPhysics::RayCastRequest& request = requests[index];
+                const physx::PxQueryFilterData queryData(SceneQueryHelpers::GetPxQueryFlags(request.m_queryType));
+                if (Internal::RayCast(&request, s_rayCastBuffer, m_pxScene, queryData, m_raycastBufferSize, hits))
+                {
+                    Internal::SetClosestHit(hits, index, results);
+                }
+            });
+    }
+
+    void PhysXScene::QuerySceneShapeCastBatch(AZStd::span<const AzPhysics::ShapeCastRequest> requests, AzPhysics::SceneQueryBatchHits& results)
+    {
+        AZ_PROFILE_FUNCTION(Physics);
+
+        results.Resize(requests.size());
+        Internal::QueryBatch(m_pxScene, requests.size(),
+            [this, requests, &results](size_t index, AzPhysics::SceneQueryHits& hits)
+            {
+                const AzPhysics::ShapeCastRequest& request = requests[index];
+                const physx::PxQueryFilterData queryData(SceneQueryHelpers::GetPxQueryFlags(request.m_queryType));
+                if (Internal::ShapeCast(&request, s_sweepBuffer, m_pxScene, queryData, m_shapecastBufferSize, hits))
+                {
+                    Internal::SetClosestHit(hits, index, results);
+                }
+            });
+    }
+
     [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
         [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
     {
@@ -1149,6 +1268,54 @@ namespace PhysX
         return m_controllerManager;
     }
 
+    physx::PxObstacleContext* PhysXScene::GetControllerObstacleContext()
+    {
+        if (!m_controllerObstacleContext)
+        {
+            if (physx::PxControllerManager* controllerManager = GetOrCreateControllerManager())
+            {
+                m_controllerObstacleContext = controllerManager->createObstacleContext();
+            }
+        }
+        return m_controllerObstacleContext;
+    }
+
+    void PhysXScene::QueueCharacterMove(CharacterController* characterController)
+    {
+        m_queuedCharacterMoves.push_back(characterController);
+    }
+
+    void PhysXScene::CancelCharacterMove(CharacterController* characterController)
+    {
+        m_queuedCharacterMoves.erase(
+            AZStd::remove(m_queuedCharacterMoves.begin(), m_queuedCharacterMoves.end(), characterController),
+            m_queuedCharacterMoves.end());
+    }
+
+    void PhysXScene::ResolveCharacterMoves(float deltaTime)
+    {
+        if (m_queuedCharacterMoves.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::ResolveCharacterMoves");
+
+        physx::PxObstacleContext* obstacleContext = GetControllerObstacleContext();
+        {
+            PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+
+            // Finds the controllers which can interact with each other once, instead of testing every controller in every move
+            m_controllerManager->computeInteractions(deltaTime);
+
+            for (CharacterController* characterController : m_queuedCharacterMoves)
+            {
+                characterController->ResolveQueuedMove(deltaTime, obstacleContext);
+            }
+        }
+        m_queuedCharacterMoves.clear();
+    }
+
     void* PhysXScene::GetNativePointer() const
     {
         return m_pxScene;
@@ -1313,6 +1480,13 @@ namespace PhysX
         AZ_PROFILE_DATAPOINT(Physics, ccdPairs, L"PhysX/Collisions/CCDPairs");
         AZ_PROFILE_DATAPOINT(Physics, modifiedPairs, L"PhysX/Collisions/ModifiedPairs");
         AZ_PROFILE_DATAPOINT(Physics, triggerPairs, L"PhysX/Collisions/TriggerPairs");
+
+        // Tasks
+        if (auto* physXSystem = GetPhysXSystem(); physXSystem && physXSystem->GetTaskDispatcher())
+        {
+            AZ_PROFILE_DATAPOINT(Physics, physXSystem->GetTaskDispatcher()->TakeSubmittedTaskCount(), L"PhysX/Tasks/Submitted");
+            AZ_PROFILE_DATAPOINT(Physics, physXSystem->GetPxCpuDispathcher()->getWorkerCount(), L"PhysX/Tasks/Workers");
+        }
 #endif // !defined(AZ_RELEASE_BUILD)
     }
 
@@ -1330,6 +1504,11 @@ namespace PhysX
         }
     }
 
+    bool PhysXScene::IsSimulating() const
+    {
+        return m_isSimulating;
+    }
+
     void PhysXScene::FlushTransformSync()
     {
         AZ_PROFILE_SCOPE(Physics, "PhysX::FlushTransformSync");
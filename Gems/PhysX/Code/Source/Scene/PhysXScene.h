@@ -19,6 +19,7 @@
 namespace physx
 {
     class PxControllerManager;
+    class PxObstacleContext;
     struct PxOverlapHit;
     struct PxRaycastHit;
     class PxScene;
@@ -27,6 +28,8 @@ namespace physx
 
 namespace PhysX
 {
+    class CharacterController;
+
     //! PhysX implementation of the AzPhysics::Scene.
     class PhysXScene final
         : public AzPhysics::Scene
@@ -61,6 +64,8 @@ namespace PhysX
         bool QueryScene(const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQueryHits& result) override;
 
         AzPhysics::SceneQueryHitsList QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests) override;
+        void QuerySceneRayCastBatch(AZStd::span<const AzPhysics::RayCastRequest> requests, AzPhysics::SceneQueryBatchHits& results) override;
+        void QuerySceneShapeCastBatch(AZStd::span<const AzPhysics::ShapeCastRequest> requests, AzPhysics::SceneQueryBatchHits& results) override;
         [[nodiscard]] bool QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
             const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback) override;
         [[nodiscard]] bool QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
@@ -81,9 +86,22 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! Returns the obstacle context shared by the character controllers moved in a batch, created with the controller manager.
+        //! Obstacles added to it are kept across simulation steps.
+        physx::PxObstacleContext* GetControllerObstacleContext();
+
+        //! Queues the move of a character controller, resolved with the other queued moves when the scene starts its next
+        //! simulation step, after the simulation start handlers have requested their moves.
+        void QueueCharacterMove(CharacterController* characterController);
+        //! Removes a character controller from the queued moves, when it is disabled or destroyed before they are resolved.
+        void CancelCharacterMove(CharacterController* characterController);
+
         //! Apply batched transform sync events for the current simulation pass. 
         //! This will clear the batched data for the next simulation pass.
         void FlushTransformSync();
+
+        //! Returns true between StartSimulation and FinishSimulation, while PhysX simulates the scene.
+        bool IsSimulating() const;
         
     private:
 
@@ -115,6 +133,9 @@ namespace PhysX
 
         void SyncActiveBodyTransform(const AzPhysics::SimulatedBodyHandleList& activeBodyHandles);
 
+        //! Resolves the queued character moves under a single scene lock, computing the controller interactions once for all of them.
+        void ResolveCharacterMoves(float deltaTime);
+
         bool m_isEnabled = true;
 
         // Batch transform sync data. Here we store the indices of actors that have moved since the last simulation pass.
@@ -132,9 +153,12 @@ namespace PhysX
 
         // Delta time for the current simulation sub-step
         float m_currentDeltaTime = 0.0f;
+        // True while the step started by StartSimulation hasn't been finished
+        bool m_isSimulating = false;
 
         AZStd::vector<AZStd::pair<AZ::Crc32, AzPhysics::SimulatedBody*>> m_simulatedBodies;
         AZStd::vector<AzPhysics::SimulatedBody*> m_deferredDeletions;
+        AZStd::vector<CharacterController*> m_queuedCharacterMoves;
         AZStd::queue<AzPhysics::SimulatedBodyIndex> m_freeSceneSlots;
 
         AZStd::vector<AZStd::pair<AZ::Crc32, AzPhysics::Joint*>> m_joints;
@@ -154,6 +178,7 @@ namespace PhysX
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
         physx::PxControllerManager* m_controllerManager = nullptr; //!< The physx controller manager
+        physx::PxObstacleContext* m_controllerObstacleContext = nullptr; //!< The obstacles shared by the batched character moves
 
         AZ::Vector3 m_gravity; // cache the gravity of the scene to avoid a lock in GetGravity().
     };
@@ -206,6 +206,28 @@ namespace PhysX
         return {}; //return an empty list
     }
 
+    void PhysXSceneInterface::QuerySceneRayCastBatch(AzPhysics::SceneHandle sceneHandle,
+        AZStd::span<const AzPhysics::RayCastRequest> requests, AzPhysics::SceneQueryBatchHits& results)
+    {
+        if (AzPhysics::Scene* scene = m_physxSystem->GetScene(sceneHandle))
+        {
+            scene->QuerySceneRayCastBatch(requests, results);
+            return;
+        }
+        results.Resize(requests.size()); // report no hits
+    }
+
+    void PhysXSceneInterface::QuerySceneShapeCastBatch(AzPhysics::SceneHandle sceneHandle,
+        AZStd::span<const AzPhysics::ShapeCastRequest> requests, AzPhysics::SceneQueryBatchHits& results)
+    {
+        if (AzPhysics::Scene* scene = m_physxSystem->GetScene(sceneHandle))
+        {
+            scene->QuerySceneShapeCastBatch(requests, results);
+            return;
+        }
+        results.Resize(requests.size()); // report no hits
+    }
+
     bool PhysXSceneInterface::QuerySceneAsync(
         AzPhysics::SceneHandle sceneHandle, AzPhysics::SceneQuery::AsyncRequestId requestId,
         const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
@@ -48,6 +48,10 @@ namespace PhysX
         AzPhysics::SceneQueryHits QueryScene(AzPhysics::SceneHandle sceneHandle, const AzPhysics::SceneQueryRequest* request) override;
         bool QueryScene(AzPhysics::SceneHandle sceneHandle, const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQueryHits& result) override;
         AzPhysics::SceneQueryHitsList QuerySceneBatch(AzPhysics::SceneHandle sceneHandle, const AzPhysics::SceneQueryRequests& requests) override;
+        void QuerySceneRayCastBatch(AzPhysics::SceneHandle sceneHandle, AZStd::span<const AzPhysics::RayCastRequest> requests,
+            AzPhysics::SceneQueryBatchHits& results) override;
+        void QuerySceneShapeCastBatch(AzPhysics::SceneHandle sceneHandle, AZStd::span<const AzPhysics::ShapeCastRequest> requests,
+            AzPhysics::SceneQueryBatchHits& results) override;
         [[nodiscard]] bool QuerySceneAsync(AzPhysics::SceneHandle sceneHandle, AzPhysics::SceneQuery::AsyncRequestId requestId,
             const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback) override;
         [[nodiscard]] bool QuerySceneAsyncBatch(AzPhysics::SceneHandle sceneHandle, AzPhysics::SceneQuery::AsyncRequestId requestId,
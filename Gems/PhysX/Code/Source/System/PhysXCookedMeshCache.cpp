@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <System/PhysXCookedMeshCache.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/Utils/Utils.h>
+
+namespace PhysX
+{
+    AZ_CVAR(bool, physx_cookedMeshCache, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Reuse the data of meshes cooked at runtime when the same mesh is cooked again.");
+    AZ_CVAR(bool, physx_cookedMeshCacheOnDisk, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Persist the data of meshes cooked at runtime in the user folder, so it is reused across runs.");
+    AZ_CVAR(size_t, physx_cookedMeshCacheMaxSize, 64 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Max size in bytes of the cooked mesh data held in memory, the cache is cleared when it grows past this size.");
+
+    namespace Internal
+    {
+        static constexpr const char* CookedMeshCacheFolder = "@user@/PhysX/CookedMeshCache";
+
+        template<typename T>
+        void HashValue(AZ::Sha1& sha, const T& value)
+        {
+            sha.ProcessBytes(reinterpret_cast<const AZStd::byte*>(&value), sizeof(T));
+        }
+
+        AZ::IO::FixedMaxPath GetCookedMeshCacheFilePath(const AZStd::string& key)
+        {
+            return AZ::IO::FixedMaxPath(CookedMeshCacheFolder) / AZ::IO::FixedMaxPathString::format("%s.pxcooked", key.c_str());
+        }
+    } // namespace Internal
+
+    AZStd::string PhysXCookedMeshCache::ComputeKey(const physx::PxCookingParams& cookingParams, MeshType meshType,
+        AZStd::span<const AZ::Vector3> vertices, AZStd::span<const AZ::u32> indices)
+    {
+        AZ::Sha1 sha;
+
+        // The cooking parameters affecting the cooked data, hashed one by one as the structure has padding
+        Internal::HashValue(sha, static_cast<AZ::u32>(PX_PHYSICS_VERSION));
+        Internal::HashValue(sha, cookingParams.areaTestEpsilon);
+        Internal::HashValue(sha, cookingParams.planeTolerance);
+        Internal::HashValue(sha, static_cast<AZ::u32>(cookingParams.convexMeshCookingType));
+        Internal::HashValue(sha, static_cast<AZ::u32>(cookingParams.meshPreprocessParams));
+        Internal::HashValue(sha, cookingParams.meshWeldTolerance);
+        Internal::HashValue(sha, static_cast<AZ::u32>(cookingParams.midphaseDesc.getType()));
+        Internal::HashValue(sha, cookingParams.gaussMapLimit);
+        Internal::HashValue(sha, cookingParams.scale.length);
+
+        Internal::HashValue(sha, static_cast<AZ::u32>(meshType));
+        Internal::HashValue(sha, aznumeric_cast<AZ::u32>(vertices.size()));
+        for (const AZ::Vector3& vertex : vertices)
+        {
+            Internal::HashValue(sha, vertex.GetX());
+            Internal::HashValue(sha, vertex.GetY());
+            Internal::HashValue(sha, vertex.GetZ());
+        }
+        Internal::HashValue(sha, aznumeric_cast<AZ::u32>(indices.size()));
+        sha.ProcessBytes(reinterpret_cast<const AZStd::byte*>(indices.data()), indices.size() * sizeof(AZ::u32));
+
+        AZ::u32 digest[5];
+        sha.GetDigest(digest);
+        return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+    }
+
+    bool PhysXCookedMeshCache::FindOrCook(const AZStd::string& key, const CookFunction& cookFunction, AZStd::vector<AZ::u8>& cookedData)
+    {
+        if (!physx_cookedMeshCache)
+        {
+            return cookFunction(cookedData);
+        }
+
+        if (FindInMemory(key, cookedData))
+        {
+            return true;
+        }
+
+        const AZ::IO::FixedMaxPath filePath = Internal::GetCookedMeshCacheFilePath(key);
+        if (physx_cookedMeshCacheOnDisk)
+        {
+            AZ_PROFILE_SCOPE(Physics, "PhysXCookedMeshCache::ReadFile");
+            auto readResult = AZ::Utils::ReadFile<AZStd::vector<AZ::u8>>(filePath.Native());
+            if (readResult.IsSuccess() && !readResult.GetValue().empty())
+            {
+                const AZStd::vector<AZ::u8>& fileData = readResult.GetValue();
+                AddToMemory(key, fileData);
+                cookedData.insert(cookedData.end(), fileData.begin(), fileData.end());
+                return true;
+            }
+        }
+
+        // Cooked into a separate buffer, so only the cooked data of this mesh is cached
+        AZStd::vector<AZ::u8> meshData;
+        if (!cookFunction(meshData))
+        {
+            return false;
+        }
+
+        AddToMemory(key, meshData);
+        if (physx_cookedMeshCacheOnDisk)
+        {
+            AZ_PROFILE_SCOPE(Physics, "PhysXCookedMeshCache::WriteFile");
+            auto writeResult = AZ::Utils::WriteFile(AZStd::as_bytes(AZStd::span<const AZ::u8>(meshData)), filePath.Native());
+            AZ_Warning("PhysX", writeResult.IsSuccess(), "Failed to write the cooked mesh cache file '%s'. %s",
+                filePath.c_str(), writeResult.IsSuccess() ? "" : writeResult.GetError().c_str());
+        }
+        cookedData.insert(cookedData.end(), meshData.begin(), meshData.end());
+        return true;
+    }
+
+    void PhysXCookedMeshCache::Clear()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_cookedMeshes.clear();
+        m_cookedMeshesSize = 0;
+    }
+
+    size_t PhysXCookedMeshCache::GetSize() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_cookedMeshes.size();
+    }
+
+    bool PhysXCookedMeshCache::FindInMemory(const AZStd::string& key, AZStd::vector<AZ::u8>& cookedData) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (auto it = m_cookedMeshes.find(key); it != m_cookedMeshes.end())
+        {
+            cookedData.insert(cookedData.end(), it->second.begin(), it->second.end());
+            return true;
+        }
+        return false;
+    }
+
+    void PhysXCookedMeshCache::AddToMemory(const AZStd::string& key, AZStd::span<const AZ::u8> cookedData)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_cookedMeshesSize + cookedData.size() > physx_cookedMeshCacheMaxSize)
+        {
+            m_cookedMeshes.clear();
+            m_cookedMeshesSize = 0;
+        }
+
+        // Another thread may have cooked the same mesh meanwhile
+        auto [it, inserted] = m_cookedMeshes.try_emplace(key, cookedData.begin(), cookedData.end());
+        if (inserted)
+        {
+            m_cookedMeshesSize += cookedData.size();
+        }
+    }
+} // namespace PhysX
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
+
+namespace PhysX
+{
+    //! Cache of meshes cooked at runtime, keyed by a hash of the mesh content and of the cooking parameters.
+    //! Cooking the same mesh again, as the editor does every time a collider is modified or activated, returns the cached data
+    //! instead. The cached data can also be persisted in the user folder with physx_cookedMeshCacheOnDisk, so it is reused
+    //! across runs. The cache can be used from several threads, cooking happens outside of the lock.
+    class PhysXCookedMeshCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PhysXCookedMeshCache, AZ::SystemAllocator);
+
+        using MeshType = Physics::CookedMeshShapeConfiguration::MeshType;
+        using CookFunction = AZStd::function<bool(AZStd::vector<AZ::u8>& cookedData)>;
+
+        //! Computes the content hash identifying a mesh cooked with the given parameters.
+        //! @param indices The triangle indices, empty for convex meshes.
+        static AZStd::string ComputeKey(const physx::PxCookingParams& cookingParams, MeshType meshType,
+            AZStd::span<const AZ::Vector3> vertices, AZStd::span<const AZ::u32> indices);
+
+        //! Appends the cooked data of a mesh to cookedData, cooking it with cookFunction if it isn't in the cache yet.
+        //! @return False if the mesh isn't in the cache and cooking failed.
+        bool FindOrCook(const AZStd::string& key, const CookFunction& cookFunction, AZStd::vector<AZ::u8>& cookedData);
+
+        //! Clears the cached data held in memory, the data persisted on disk is kept.
+        void Clear();
+
+        //! Returns the number of meshes held in memory.
+        size_t GetSize() const;
+
+    private:
+        bool FindInMemory(const AZStd::string& key, AZStd::vector<AZ::u8>& cookedData) const;
+        void AddToMemory(const AZStd::string& key, AZStd::span<const AZ::u8> cookedData);
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZStd::string, AZStd::vector<AZ::u8>> m_cookedMeshes;
+        size_t m_cookedMeshesSize = 0; //!< Total size in bytes of the cooked data held in memory.
+    };
+} // namespace PhysX
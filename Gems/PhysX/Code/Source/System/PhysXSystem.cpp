@@ -12,6 +12,7 @@
 #include <Scene/PhysXScene.h>
 #include <System/PhysXAllocator.h>
 #include <System/PhysXCpuDispatcher.h>
+#include <System/PhysXTaskDispatcher.h>
 
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
@@ -36,6 +37,17 @@ namespace PhysX
         "True: Sync entity transform once per Simulate call. "
         "False: Sync entity transform for every simulation sub-step.");
 
+    AZ_CVAR(bool, physx_taskExecutorDispatcher, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Run the tasks submitted by PhysX on the task executor instead of the job manager, read when PhysX is initialized. "
+        "True: PhysX tasks run on the task executor, see physx_taskDispatcherReservedWorkers. "
+        "False: PhysX tasks run on the job manager.");
+
+    AZ_CVAR(bool, physx_pipelinedSimulation, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Overlap the last simulation step of each Simulate call with the game update that follows it. "
+        "True: The last step keeps simulating after Simulate returns, and is finished by the next Simulate call. "
+        "Until then the scenes report the results of the previous step, and all transform syncs of a call happen at once. "
+        "False: Every step is finished before Simulate returns.");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXSystem, AZ::SystemAllocator);
 
 #ifdef ENABLE_PHYSX_TIMESTEP_WARNING
@@ -185,7 +197,11 @@ namespace PhysX
             return;
         }
 
-        auto simulateScenes = [this](float timeStep)
+        // Finish the step left running by the previous call, also when the pipelined mode was turned off since
+        FinishPipelinedSimulation();
+
+        const bool pipelined = physx_pipelinedSimulation;
+        auto simulateScenes = [this](float timeStep, bool finishStep)
         {
             for (auto& scenePtr : m_sceneList)
             {
@@ -193,7 +209,10 @@ namespace PhysX
                 {
                     AZ::Debug::ScopeDuration performanceScopeDuration(m_performanceCollector.get(), PerformanceSpecPhysXSimulationTime);
                     scenePtr->StartSimulation(timeStep);
-                    scenePtr->FinishSimulation();
+                    if (finishStep)
+                    {
+                        scenePtr->FinishSimulation();
+                    }
                 }
             }
         };
@@ -231,7 +250,9 @@ namespace PhysX
 
             while (m_accumulatedTime >= m_systemConfig.m_fixedTimestep)
             {
-                simulateScenes(m_systemConfig.m_fixedTimestep);
+                // When pipelined, the last step of the call is left running
+                const bool lastStep = (m_accumulatedTime - m_systemConfig.m_fixedTimestep) < m_systemConfig.m_fixedTimestep;
+                simulateScenes(m_systemConfig.m_fixedTimestep, !(pipelined && lastStep));
                 m_accumulatedTime -= m_systemConfig.m_fixedTimestep;
             }
         }
@@ -239,13 +260,13 @@ namespace PhysX
         {
             m_preSimulateEvent.Signal(tickTime);
 
-            simulateScenes(tickTime);
+            simulateScenes(tickTime, !pipelined);
         }
         
         // Flush performance data for this tick
         m_performanceCollector->FrameTick();
         
-        if (physx_batchTransformSync)
+        if (physx_batchTransformSync || pipelined)
         {
             for (auto& scenePtr : m_sceneList)
             {
@@ -260,6 +281,22 @@ namespace PhysX
         m_postSimulateEvent.Signal(tickTime);
     }
 
+    void PhysXSystem::FinishPipelinedSimulation()
+    {
+        for (auto& scenePtr : m_sceneList)
+        {
+            if (scenePtr != nullptr)
+            {
+                PhysXScene* physxScene = static_cast<PhysXScene*>(scenePtr.get());
+                if (physxScene->IsSimulating())
+                {
+                    AZ_PROFILE_SCOPE(Physics, "PhysXSystem::FinishPipelinedSimulation");
+                    physxScene->FinishSimulation();
+                }
+            }
+        }
+    }
+
     AzPhysics::SceneHandle PhysXSystem::AddScene(const AzPhysics::SceneConfiguration& config)
     {
         if (config.m_sceneName.empty())
@@ -456,7 +493,15 @@ namespace PhysX
         m_physXSdk.m_cooking = PxCreateCooking(PX_PHYSICS_VERSION, *m_physXSdk.m_foundation, cookingParams);
 
         // Set up CPU dispatcher
-        m_cpuDispatcher = PhysXCpuDispatcherCreate();
+        if (physx_taskExecutorDispatcher)
+        {
+            m_taskDispatcher = PhysXTaskDispatcherCreate();
+            m_cpuDispatcher = m_taskDispatcher;
+        }
+        else
+        {
+            m_cpuDispatcher = PhysXCpuDispatcherCreate();
+        }
 
         PxSetProfilerCallback(&m_pxAzProfilerCallback);
     }
@@ -465,6 +510,7 @@ namespace PhysX
     {
         delete m_cpuDispatcher;
         m_cpuDispatcher = nullptr;
+        m_taskDispatcher = nullptr;
 
         m_physXSdk.m_cooking->release();
         m_physXSdk.m_cooking = nullptr;
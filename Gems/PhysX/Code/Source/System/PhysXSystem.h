@@ -37,6 +37,8 @@ namespace physx
 
 namespace PhysX
 {
+    class PhysXTaskDispatcher;
+
     class PhysXSystem
         : public AZ::Interface<AzPhysics::SystemInterface>::Registrar
     {
@@ -81,12 +83,18 @@ namespace PhysX
             AZ_Assert(m_cpuDispatcher, "PhysX CPU dispatcher was not created");
             return m_cpuDispatcher;
         }
+        //! Returns the task executor CPU dispatcher, or nullptr when PhysX tasks run on the job manager.
+        PhysXTaskDispatcher* GetTaskDispatcher() { return m_taskDispatcher; }
         void SetCollisionLayerName(int index, const AZStd::string& layerName);
         void CreateCollisionGroup(const AZStd::string& groupName, const AzPhysics::CollisionGroup& group);
         //TEMP -- until these are fully moved over here
 
         AZ::Debug::PerformanceCollector* GetPerformanceCollector();
 
+        //! Finishes the simulation steps left running by Simulate when physx_pipelinedSimulation is enabled.
+        //! Call before code that needs the results of the latest step, Simulate calls it before starting new steps.
+        void FinishPipelinedSimulation();
+
     private:
         //! Initializes the PhysX SDK.
         //! This sets up the PhysX Foundation, Cooking, and other PhysX sub-systems.
@@ -115,6 +123,7 @@ namespace PhysX
         PxAzProfilerCallback m_pxAzProfilerCallback;
 
         physx::PxCpuDispatcher* m_cpuDispatcher = nullptr;
+        PhysXTaskDispatcher* m_taskDispatcher = nullptr; //!< Non-owning, set when m_cpuDispatcher is a task executor dispatcher.
 
         enum class State : AZ::u8
         {
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <System/PhysXTaskDispatcher.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Task/TaskExecutor.h>
+
+namespace PhysX
+{
+    AZ_CVAR(AZ::u32, physx_taskDispatcherReservedWorkers, 1, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of task workers left to other systems while PhysX simulates, when running PhysX tasks on the task executor. "
+        "At least one worker always runs PhysX tasks.");
+
+    static const AZ::TaskDescriptor PhysXTaskDescriptor{ "PhysX Tasks", "Physics" };
+
+    PhysXTaskDispatcher* PhysXTaskDispatcherCreate()
+    {
+        return aznew PhysXTaskDispatcher(AZ::TaskExecutor::Instance());
+    }
+
+    PhysXTaskDispatcher::PhysXTaskDispatcher(AZ::TaskExecutor& taskExecutor)
+        : m_taskExecutor(taskExecutor)
+    {
+        const uint32_t workerCount = AZStd::max(m_taskExecutor.GetWorkerCount(), 1u);
+        m_runners.reserve(workerCount);
+        m_idleRunners.reserve(workerCount);
+        for (uint32_t runnerIndex = 0; runnerIndex < workerCount; ++runnerIndex)
+        {
+            m_runners.emplace_back(PhysXTaskDescriptor, [this, runnerIndex]() { RunTasks(runnerIndex); });
+            m_idleRunners.push_back(workerCount - runnerIndex - 1);
+        }
+    }
+
+    PhysXTaskDispatcher::~PhysXTaskDispatcher()
+    {
+        AZ_Assert(m_idleRunners.size() == m_runners.size(), "PhysX task dispatcher destroyed while PhysX tasks are running");
+    }
+
+    uint32_t PhysXTaskDispatcher::TakeSubmittedTaskCount()
+    {
+        return m_submittedTaskCount.exchange(0, AZStd::memory_order_relaxed);
+    }
+
+    void PhysXTaskDispatcher::submitTask(physx::PxBaseTask& task)
+    {
+        m_submittedTaskCount.fetch_add(1, AZStd::memory_order_relaxed);
+
+        AZ::Internal::Task* runner = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_pendingTasks.push_back(&task);
+
+            const size_t activeRunnerCount = m_runners.size() - m_idleRunners.size();
+            if (!m_idleRunners.empty() && activeRunnerCount < getWorkerCount())
+            {
+                runner = &m_runners[m_idleRunners.back()];
+                m_idleRunners.pop_back();
+            }
+        }
+
+        // Otherwise the active runners pick the task up before going idle
+        if (runner != nullptr)
+        {
+            m_taskExecutor.Submit(*runner);
+        }
+    }
+
+    physx::PxU32 PhysXTaskDispatcher::getWorkerCount() const
+    {
+        const uint32_t workerCount = aznumeric_cast<uint32_t>(m_runners.size());
+        const uint32_t reservedWorkerCount = physx_taskDispatcherReservedWorkers;
+        return (reservedWorkerCount < workerCount) ? workerCount - reservedWorkerCount : 1;
+    }
+
+    void PhysXTaskDispatcher::RunTasks(uint32_t runnerIndex)
+    {
+        while (true)
+        {
+            physx::PxBaseTask* task = nullptr;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                if (m_nextPendingTask == m_pendingTasks.size())
+                {
+                    m_pendingTasks.clear();
+                    m_nextPendingTask = 0;
+                    // The runner may be submitted again as soon as it is idle, so it must not be touched past this point
+                    m_idleRunners.push_back(runnerIndex);
+                    return;
+                }
+                task = m_pendingTasks[m_nextPendingTask++];
+            }
+
+            {
+                AZ_PROFILE_SCOPE(Physics, task->getName());
+                task->run();
+            }
+            task->release();
+        }
+    }
+} // namespace PhysX
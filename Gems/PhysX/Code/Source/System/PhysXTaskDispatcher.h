@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include <System/PhysXAllocator.h>
+#include <AzCore/Task/Internal/Task.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+}
+
+namespace PhysX
+{
+    //! CPU dispatcher which runs the tasks submitted by PhysX on the AZ::TaskExecutor.
+    //! Submitted tasks are queued and drained by a fixed pool of runner tasks, one per task worker PhysX may use, so
+    //! submitting a task doesn't allocate. Some of the task workers can be left to other systems with
+    //! physx_taskDispatcherReservedWorkers, in which case no more than the remaining workers run PhysX tasks at once.
+    class PhysXTaskDispatcher
+        : public physx::PxCpuDispatcher
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PhysXTaskDispatcher, PhysXAllocator);
+
+        explicit PhysXTaskDispatcher(AZ::TaskExecutor& taskExecutor);
+        ~PhysXTaskDispatcher();
+
+        //! Returns the number of tasks submitted since the previous call, and resets the count.
+        uint32_t TakeSubmittedTaskCount();
+
+    private:
+        // PxCpuDispatcher implementation
+        void submitTask(physx::PxBaseTask& task) override;
+        physx::PxU32 getWorkerCount() const override;
+
+        //! Runs queued PhysX tasks until the queue is empty, then returns the runner to the pool.
+        void RunTasks(uint32_t runnerIndex);
+
+        AZ::TaskExecutor& m_taskExecutor;
+
+        AZStd::mutex m_mutex;
+        //! The queued PhysX tasks, the capacity is kept once the queue is drained.
+        AZStd::vector<physx::PxBaseTask*> m_pendingTasks;
+        size_t m_nextPendingTask = 0;
+        AZStd::vector<AZ::Internal::Task> m_runners;
+        AZStd::vector<uint32_t> m_idleRunners;
+
+        AZStd::atomic<uint32_t> m_submittedTaskCount{ 0 };
+    };
+
+    //! Creates a CPU dispatcher which runs the tasks submitted by PhysX on the global AZ::TaskExecutor.
+    PhysXTaskDispatcher* PhysXTaskDispatcherCreate();
+} // namespace PhysX
@@ -25,6 +25,7 @@
 #include <PhysX/MeshAsset.h>
 #include <PhysX/HeightFieldAsset.h>
 #include <PhysX/Debug/PhysXDebugInterface.h>
+#include <System/PhysXCookedMeshCache.h>
 #include <System/PhysXSystem.h>
 
 namespace PhysX
@@ -218,6 +219,7 @@ namespace PhysX
 
         m_materialManager.reset();
         m_windProvider.reset();
+        m_cookedMeshCache.reset();
 
         m_onSystemInitializedHandler.Disconnect();
         m_onSystemConfigChangedHandler.Disconnect();
@@ -294,30 +296,55 @@ namespace PhysX
 
     bool SystemComponent::CookConvexMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
-        
-        bool cookingResult = Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream);
-        
-        if(cookingResult)
+        auto cookConvexMesh = [vertices, vertexCount](AZStd::vector<AZ::u8>& cookedData)
         {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+            physx::PxDefaultMemoryOutputStream memoryStream;
+
+            bool cookingResult = Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream);
+
+            if (cookingResult)
+            {
+                cookedData.insert(cookedData.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+            }
+
+            return cookingResult;
+        };
+
+        if (!m_cookedMeshCache)
+        {
+            return cookConvexMesh(result);
         }
-        
-        return cookingResult;
+
+        const AZStd::string key = PhysXCookedMeshCache::ComputeKey(GetCooking()->getParams(),
+            Physics::CookedMeshShapeConfiguration::MeshType::Convex, AZStd::span(vertices, vertexCount), {});
+        return m_cookedMeshCache->FindOrCook(key, cookConvexMesh, result);
     }
 
     bool SystemComponent::CookTriangleMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount,
         const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
-        bool cookingResult = Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream);
+        auto cookTriangleMesh = [vertices, vertexCount, indices, indexCount](AZStd::vector<AZ::u8>& cookedData)
+        {
+            physx::PxDefaultMemoryOutputStream memoryStream;
+            bool cookingResult = Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream);
+
+            if (cookingResult)
+            {
+                cookedData.insert(cookedData.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+            }
+
+            return cookingResult;
+        };
 
-        if (cookingResult)
+        if (!m_cookedMeshCache)
         {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+            return cookTriangleMesh(result);
         }
 
-        return cookingResult;
+        const AZStd::string key = PhysXCookedMeshCache::ComputeKey(GetCooking()->getParams(),
+            Physics::CookedMeshShapeConfiguration::MeshType::TriangleMesh, AZStd::span(vertices, vertexCount),
+            AZStd::span(indices, indexCount));
+        return m_cookedMeshCache->FindOrCook(key, cookTriangleMesh, result);
     }
 
     physx::PxConvexMesh* SystemComponent::CreateConvexMeshFromCooked(const void* cookedMeshData, AZ::u32 bufferSize)
@@ -534,6 +561,7 @@ namespace PhysX
         }
 
         m_windProvider = AZStd::make_unique<WindProvider>();
+        m_cookedMeshCache = AZStd::make_unique<PhysXCookedMeshCache>();
         m_materialManager = AZStd::make_unique<MaterialManager>();
         m_materialManager->Init();
     }
@@ -41,6 +41,7 @@ namespace PhysX
 {
     class MaterialManager;
     class WindProvider;
+    class PhysXCookedMeshCache;
     class PhysXSystem;
 
     /// System component for PhysX.
@@ -127,6 +128,7 @@ namespace PhysX
 
         AZStd::unique_ptr<MaterialManager> m_materialManager;
         AZStd::unique_ptr<WindProvider> m_windProvider;
+        AZStd::unique_ptr<PhysXCookedMeshCache> m_cookedMeshCache;
         DefaultWorldComponent m_defaultWorldComponent;
         AZ::Interface<Physics::CollisionRequests> m_collisionRequests;
         AZ::Interface<Physics::System> m_physicsSystem;
@@ -14,6 +14,7 @@
 
 #include <AZTestShared/Math/MathTestHelpers.h>
 #include <AZTestShared/Utils/Utils.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <PhysX/ComponentTypeIds.h>
 #include <PhysX/SystemComponentBus.h>
@@ -26,6 +27,8 @@
 
 namespace PhysX
 {
+    AZ_CVAR_EXTERNED(bool, physx_batchCharacterMoves);
+
     namespace Internal
     {
         void AddColliderComponentToEntity(AZ::Entity* entity, const Physics::ColliderConfiguration& colliderConfiguration, const Physics::ShapeConfiguration& shapeConfiguration)
@@ -202,6 +205,25 @@ namespace PhysX
         }
     }
 
+    TEST_F(PhysXDefaultWorldTest, CharacterController_BatchedMoves_MatchUnbatchedMoves)
+    {
+        ControllerTestBasis unbatchedBasis(m_testSceneHandle);
+        PhysX::TestUtils::AddStaticUnitBoxToScene(m_testSceneHandle, AZ::Vector3(1.5f, 0.0f, 0.5f));
+        unbatchedBasis.Update(AZ::Vector3::CreateAxisX(), 50);
+        const AZ::Vector3 unbatchedPosition = unbatchedBasis.m_controller->GetBasePosition();
+        unbatchedBasis.m_controllerEntity.reset();
+
+        physx_batchCharacterMoves = true;
+
+        ControllerTestBasis batchedBasis(m_testSceneHandle);
+        batchedBasis.Update(AZ::Vector3::CreateAxisX(), 50);
+        // The batched controller is stopped by the box like the unbatched one
+        EXPECT_TRUE(batchedBasis.m_controller->GetBasePosition().IsClose(unbatchedPosition));
+        EXPECT_TRUE(batchedBasis.m_controller->GetVelocity().IsClose(AZ::Vector3::CreateZero()));
+
+        physx_batchCharacterMoves = false;
+    }
+
     TEST_F(PhysXDefaultWorldTest, CharacterController_MovingDiagonallyTowardsStaticBox_SlidesAlongBox)
     {
         ControllerTestBasis basis(m_testSceneHandle);
@@ -1007,4 +1007,52 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneRayCastBatch_ReturnsClosestHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup bodies, with a second body behind the first one along the x Axis
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+        }
+        TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(20.0f, 0.0f, 0.0f), 1.0f);
+
+        //create enough raycast requests to be split across several tasks, every fourth request misses
+        constexpr size_t requestCount = 500;
+        AZStd::vector<AzPhysics::RayCastRequest> requests(requestCount);
+        for (size_t i = 0; i < requestCount; i++)
+        {
+            requests[i].m_start = AZ::Vector3::CreateZero();
+            requests[i].m_direction = (i % 4 == 3) ? AZ::Vector3(1.0f, 1.0f, 1.0f).GetNormalized() : positions[i % 4].GetNormalized();
+            requests[i].m_distance = 200.0f;
+            requests[i].m_reportMultipleHits = (i % 2 == 0);
+        }
+
+        //run query
+        AzPhysics::SceneQueryBatchHits results;
+        sceneInterface->QuerySceneRayCastBatch(m_testSceneHandle, requests, results);
+
+        //verify each request has the closest body along the ray
+        ASSERT_EQ(results.GetSize(), requestCount);
+        for (size_t i = 0; i < requestCount; i++)
+        {
+            if (i % 4 == 3)
+            {
+                EXPECT_FALSE(results.HasHit(i));
+                continue;
+            }
+            EXPECT_TRUE(results.HasHit(i));
+            EXPECT_TRUE(results.m_bodyHandles[i] == simBodies[i % 4]);
+            EXPECT_NEAR(results.m_distances[i], 9.0f, 0.01f);
+        }
+    }
 }
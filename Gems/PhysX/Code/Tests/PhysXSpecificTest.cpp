@@ -35,6 +35,7 @@
 #include <PhysX/SystemComponentBus.h>
 #include <PhysX/Material/PhysXMaterialConfiguration.h>
 #include <Scene/PhysXScene.h>
+#include <System/PhysXCookedMeshCache.h>
 #include <Tests/PhysXTestCommon.h>
 
 namespace PhysX
@@ -767,6 +768,45 @@ namespace PhysX
         ASSERT_TRUE(true);
     }
 
+    TEST_F(PhysXSpecificTest, CookedMeshCache_SameMeshCookedAgain_CachedDataReturned)
+    {
+        PhysXCookedMeshCache cache;
+        const physx::PxCookingParams cookingParams{ physx::PxTolerancesScale() };
+        const PointList testPoints = TestUtils::GeneratePyramidPoints(1.0f);
+
+        int cookCount = 0;
+        auto cookFunction = [&cookCount, &testPoints](AZStd::vector<AZ::u8>& cookedData)
+        {
+            cookCount++;
+            cookedData.push_back(aznumeric_cast<AZ::u8>(testPoints.size()));
+            return true;
+        };
+
+        const AZStd::string key = PhysXCookedMeshCache::ComputeKey(
+            cookingParams, Physics::CookedMeshShapeConfiguration::MeshType::Convex, testPoints, {});
+        AZStd::vector<AZ::u8> firstCookedData;
+        EXPECT_TRUE(cache.FindOrCook(key, cookFunction, firstCookedData));
+        AZStd::vector<AZ::u8> secondCookedData;
+        EXPECT_TRUE(cache.FindOrCook(key, cookFunction, secondCookedData));
+        EXPECT_EQ(cookCount, 1);
+        EXPECT_EQ(firstCookedData, secondCookedData);
+        EXPECT_EQ(cache.GetSize(), 1);
+
+        // Different content or parameters give a different key
+        const PointList otherPoints = TestUtils::GeneratePyramidPoints(2.0f);
+        EXPECT_NE(key, PhysXCookedMeshCache::ComputeKey(
+            cookingParams, Physics::CookedMeshShapeConfiguration::MeshType::Convex, otherPoints, {}));
+        physx::PxCookingParams otherCookingParams = cookingParams;
+        otherCookingParams.meshWeldTolerance = 0.1f;
+        EXPECT_NE(key, PhysXCookedMeshCache::ComputeKey(
+            otherCookingParams, Physics::CookedMeshShapeConfiguration::MeshType::Convex, testPoints, {}));
+
+        cache.Clear();
+        AZStd::vector<AZ::u8> thirdCookedData;
+        EXPECT_TRUE(cache.FindOrCook(key, cookFunction, thirdCookedData));
+        EXPECT_EQ(cookCount, 2);
+    }
+
     TEST_F(PhysXSpecificTest, RigidBody_ConvexRigidBodyCreatedFromCookedMesh_CachedMeshObjectCreated)
     {
         // Create rigid body
@@ -13,9 +13,14 @@
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
+#include <Scene/PhysXScene.h>
+
+#include <AzCore/Console/IConsole.h>
 
 namespace PhysX
 {
+    AZ_CVAR_EXTERNED(bool, physx_pipelinedSimulation);
+
     namespace Internal
     {
         static constexpr const char* DefaultSceneNameFormat = "scene-%u";
@@ -328,4 +333,35 @@ namespace PhysX
         physicsSystem->RemoveScenes(sceneHandles);
         EXPECT_EQ(removedCount, m_sceneConfigs.size());
     }
+
+    TEST_F(PhysXSystemFixture, PipelinedSimulation_LastStepFinishesOnNextSimulate)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        AzPhysics::SceneHandle sceneHandle = physicsSystem->AddScene(m_sceneConfigs[0]);
+        auto* scene = static_cast<PhysXScene*>(physicsSystem->GetScene(sceneHandle));
+        ASSERT_NE(scene, nullptr);
+
+        int finishedCount = 0;
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler finishHandler(
+            [&finishedCount]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltatime)
+            {
+                finishedCount++;
+            });
+        scene->RegisterSceneSimulationFinishHandler(finishHandler);
+
+        physx_pipelinedSimulation = true;
+
+        // two steps, the first one finishes and the second one is left running
+        const float fixedTimeStep = physicsSystem->GetConfiguration()->m_fixedTimestep;
+        physicsSystem->Simulate(fixedTimeStep * 2.5f);
+        EXPECT_TRUE(scene->IsSimulating());
+        EXPECT_EQ(finishedCount, 1);
+
+        // not enough time for a new step, the running step finishes
+        physicsSystem->Simulate(0.0f);
+        EXPECT_FALSE(scene->IsSimulating());
+        EXPECT_EQ(finishedCount, 2);
+
+        physx_pipelinedSimulation = false;
+    }
 }
@@ -318,6 +318,57 @@ namespace PhysX
         EXPECT_NEAR(minZ, 0.0f, 0.05f);
     }
 
+    TEST_F(PhysXDefaultWorldTest, Ragdoll_FrozenLod_DoesNotFallUntilFullLod)
+    {
+        auto ragdoll = CreateRagdoll(m_testSceneHandle);
+
+        // The level of detail only applies while simulated
+        ragdoll->SetLod(RagdollLod::Frozen);
+        EXPECT_EQ(ragdoll->GetLod(), RagdollLod::Full);
+
+        ragdoll->EnableSimulation(GetTPose());
+        ragdoll->SetLod(RagdollLod::Frozen);
+        EXPECT_EQ(ragdoll->GetLod(), RagdollLod::Frozen);
+
+        const float expectedInitialZ = RagdollTestData::NodePositions[0].GetZ();
+        TestUtils::UpdateScene(m_defaultScene, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 30);
+        EXPECT_NEAR(ragdoll->GetPosition().GetZ(), expectedInitialZ, 0.01f);
+
+        ragdoll->SetLod(RagdollLod::Full);
+        TestUtils::UpdateScene(m_defaultScene, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 30);
+        EXPECT_LT(ragdoll->GetPosition().GetZ(), expectedInitialZ - 0.5f);
+
+        ragdoll->SetLod(RagdollLod::Reduced);
+        ragdoll->DisableSimulation();
+        EXPECT_EQ(ragdoll->GetLod(), RagdollLod::Full);
+    }
+
+    TEST_F(PhysXDefaultWorldTest, Ragdoll_ReducedLod_DistalNodesHeldKinematic)
+    {
+        auto ragdoll = CreateRagdoll(m_testSceneHandle);
+        ragdoll->EnableSimulation(GetTPose());
+        ragdoll->SetLod(RagdollLod::Reduced);
+
+        TestUtils::UpdateScene(m_defaultScene, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 30);
+
+        // The ragdoll still falls, with the distal nodes held kinematic
+        const float expectedInitialZ = RagdollTestData::NodePositions[0].GetZ();
+        EXPECT_LT(ragdoll->GetPosition().GetZ(), expectedInitialZ - 0.5f);
+        for (size_t nodeIndex = 0; nodeIndex < RagdollTestData::NumNodes; nodeIndex++)
+        {
+            const size_t parentIndex = RagdollTestData::ParentIndices[nodeIndex];
+            const bool isDistal = parentIndex < RagdollTestData::NumNodes &&
+                AZStd::find(AZStd::begin(RagdollTestData::ParentIndices), AZStd::end(RagdollTestData::ParentIndices), nodeIndex) ==
+                    AZStd::end(RagdollTestData::ParentIndices);
+            if (isDistal)
+            {
+                physx::PxRigidDynamic* pxActor = ragdoll->GetPxRigidDynamic(nodeIndex);
+                PHYSX_SCENE_READ_LOCK(pxActor->getScene());
+                EXPECT_TRUE(pxActor->getRigidBodyFlags().isSet(physx::PxRigidBodyFlag::eKINEMATIC));
+            }
+        }
+    }
+
     TEST(ComputeHierarchyDepthsTest, DepthValuesCorrect)
     {
         AZStd::vector<size_t> parentIndices =
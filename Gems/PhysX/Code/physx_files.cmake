@@ -144,6 +144,8 @@ set(FILES
     Source/Scene/PhysXSceneSimulationFilterCallback.cpp
     Source/System/PhysXAllocator.h
     Source/System/PhysXAllocator.cpp
+    Source/System/PhysXCookedMeshCache.h
+    Source/System/PhysXCookedMeshCache.cpp
     Source/System/PhysXCookingParams.h
     Source/System/PhysXCookingParams.cpp
     Source/System/PhysXCpuDispatcher.cpp
@@ -156,4 +158,6 @@ set(FILES
     Source/System/PhysXSdkCallbacks.cpp
     Source/System/PhysXSystem.h
     Source/System/PhysXSystem.cpp
+    Source/System/PhysXTaskDispatcher.h
+    Source/System/PhysXTaskDispatcher.cpp
 )
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <BudgetSpikeMonitor.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Budget.h>
+#include <AzCore/Debug/BudgetTracker.h>
+#include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/time.h>
+
+namespace Profiler
+{
+    AZ_CVAR(AZ::u32, profiler_budgetMetricsFrameCountPerCaptureBatch, 600,
+        [](const AZ::u32& newValue)
+        {
+            if (auto monitor = AZ::Interface<BudgetSpikeMonitor>::Get(); monitor && monitor->GetPerformanceCollector())
+            {
+                monitor->GetPerformanceCollector()->UpdateFrameCountPerCaptureBatch(newValue);
+            }
+        },
+        AZ::ConsoleFunctorFlags::DontReplicate, "Number of frames in which the frame and budget times are measured per batch.");
+
+    AZ_CVAR(AZ::u32, profiler_budgetMetricsNumberOfCaptureBatches, 0,
+        [](const AZ::u32& newValue)
+        {
+            if (auto monitor = AZ::Interface<BudgetSpikeMonitor>::Get(); monitor && monitor->GetPerformanceCollector())
+            {
+                monitor->GetPerformanceCollector()->UpdateNumberOfCaptureBatches(newValue);
+            }
+        },
+        AZ::ConsoleFunctorFlags::DontReplicate,
+            "Reports the statistics and percentiles of the frame and budget times in this number of batches. "
+            "Starts at 0, which means do not capture performance data. "
+            "When this variable changes to > 0 we'll start performance capture.");
+
+    AZ_CVAR(bool, profiler_budgetMetricsHardwareCounters, false,
+        [](const bool& newValue)
+        {
+            if (auto monitor = AZ::Interface<BudgetSpikeMonitor>::Get(); monitor && monitor->GetPerformanceCollector())
+            {
+                AZ::Debug::Budget::SetHardwareCountersEnabled(newValue);
+                monitor->GetPerformanceCollector()->UpdateHardwareCountersEnabled(newValue);
+            }
+        },
+        AZ::ConsoleFunctorFlags::DontReplicate,
+            "Also reports the IPC, cache misses and branch misses of the frame and of the budgets with a threshold. "
+            "Reading the counters costs a system call per budget region, and requires access to the CPU performance counters.");
+
+    namespace
+    {
+        AZStd::chrono::microseconds MillisecondsToMicroseconds(double milliseconds)
+        {
+            return AZStd::chrono::microseconds(aznumeric_cast<AZStd::chrono::microseconds::rep>(milliseconds * 1000.0));
+        }
+
+        AZStd::chrono::microseconds TicksToMicroseconds(AZStd::sys_time_t ticks)
+        {
+            return AZStd::chrono::microseconds(ticks * 1000000 / AZStd::GetTimeTicksPerSecond());
+        }
+    } // namespace
+
+    void BudgetSpikeMonitor::Init(CaptureFunction captureFunction)
+    {
+        AZ_Assert(!m_initialized, "The BudgetSpikeMonitor is already initialized.");
+
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+        if (settingsRegistry == nullptr)
+        {
+            return;
+        }
+
+        double frameTimeThreshold = 0.0;
+        settingsRegistry->Get(frameTimeThreshold, SpikeCaptureFrameTimeThresholdKey);
+        m_frameTimeThreshold = MillisecondsToMicroseconds(frameTimeThreshold);
+
+        m_budgets.clear();
+        auto VisitBudgetThreshold = [this, settingsRegistry](const AZ::SettingsRegistryInterface::VisitArgs& visitArgs)
+        {
+            if (double threshold = 0.0; settingsRegistry->Get(threshold, visitArgs.m_jsonKeyPath) && threshold > 0.0)
+            {
+                m_budgets.push_back({ AZStd::string(visitArgs.m_fieldName), MillisecondsToMicroseconds(threshold) });
+            }
+            return AZ::SettingsRegistryInterface::VisitResponse::Skip;
+        };
+        AZ::SettingsRegistryVisitorUtils::VisitObject(*settingsRegistry, VisitBudgetThreshold, SpikeCaptureBudgetThresholdsKey);
+
+        if (m_frameTimeThreshold.count() <= 0 && m_budgets.empty())
+        {
+            return;
+        }
+
+        AZ::u64 frameCount = 60;
+        settingsRegistry->Get(frameCount, SpikeCaptureFrameCountKey);
+        m_frameStartTicks.set_capacity(aznumeric_cast<size_t>(AZStd::max<AZ::u64>(frameCount, 1)));
+        m_frameStartTicks.clear();
+
+        double cooldownSeconds = 30.0;
+        settingsRegistry->Get(cooldownSeconds, SpikeCaptureCooldownKey);
+        m_cooldownTicks = aznumeric_cast<AZStd::sys_time_t>(cooldownSeconds * aznumeric_cast<double>(AZStd::GetTimeTicksPerSecond()));
+        m_lastCaptureTick = 0;
+
+        AZStd::vector<AZStd::string_view> metricNames;
+        metricNames.push_back(FrameMetricName);
+        for (const TrackedBudget& budget : m_budgets)
+        {
+            metricNames.push_back(budget.m_name);
+        }
+        m_performanceCollector = AZStd::make_unique<AZ::Debug::PerformanceCollector>(
+            "ProfilerBudgets",
+            AZStd::span<const AZStd::string_view>(metricNames),
+            [](AZ::u32)
+            {
+            });
+        m_performanceCollector->UpdateFrameCountPerCaptureBatch(profiler_budgetMetricsFrameCountPerCaptureBatch);
+        m_performanceCollector->UpdateWaitTimeBeforeEachBatch(AZStd::chrono::seconds(0));
+        m_performanceCollector->UpdateHardwareCountersEnabled(profiler_budgetMetricsHardwareCounters);
+        m_performanceCollector->UpdateNumberOfCaptureBatches(profiler_budgetMetricsNumberOfCaptureBatches);
+        AZ::Debug::Budget::SetHardwareCountersEnabled(profiler_budgetMetricsHardwareCounters);
+        m_hasFrameCounters = false;
+
+        m_captureFunction = AZStd::move(captureFunction);
+        AZ::Interface<BudgetSpikeMonitor>::Register(this);
+        AZ::SystemTickBus::Handler::BusConnect();
+        m_initialized = true;
+    }
+
+    void BudgetSpikeMonitor::Shutdown()
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        AZ::SystemTickBus::Handler::BusDisconnect();
+        AZ::Interface<BudgetSpikeMonitor>::Unregister(this);
+
+        // Stop tracking the budgets.
+        if (auto budgetTracker = AZ::Interface<AZ::Debug::BudgetTracker>::Get(); budgetTracker)
+        {
+            budgetTracker->VisitBudgets(
+                [this](AZ::Debug::Budget& budget)
+                {
+                    for (const TrackedBudget& trackedBudget : m_budgets)
+                    {
+                        if (trackedBudget.m_name == budget.Name())
+                        {
+                            budget.SetFrameTimeThreshold(AZStd::chrono::microseconds(0));
+                        }
+                    }
+                });
+        }
+
+        AZ::Debug::Budget::SetHardwareCountersEnabled(false);
+        m_performanceCollector.reset();
+        m_captureFunction = {};
+        m_budgets.clear();
+        m_initialized = false;
+    }
+
+    AZ::Debug::PerformanceCollector* BudgetSpikeMonitor::GetPerformanceCollector()
+    {
+        return m_performanceCollector.get();
+    }
+
+    void BudgetSpikeMonitor::UpdateBudgets()
+    {
+        for (TrackedBudget& trackedBudget : m_budgets)
+        {
+            trackedBudget.m_lastFrameTime = AZStd::chrono::microseconds(0);
+            trackedBudget.m_lastFrameCounters = {};
+        }
+
+        auto budgetTracker = AZ::Interface<AZ::Debug::BudgetTracker>::Get();
+        if (budgetTracker == nullptr)
+        {
+            return;
+        }
+
+        // Budgets are created by their first profile region, so the thresholds are applied once the budgets exist.
+        budgetTracker->VisitBudgets(
+            [this](AZ::Debug::Budget& budget)
+            {
+                for (TrackedBudget& trackedBudget : m_budgets)
+                {
+                    if (trackedBudget.m_name != budget.Name())
+                    {
+                        continue;
+                    }
+
+                    if (budget.GetFrameTimeThreshold() != trackedBudget.m_threshold)
+                    {
+                        budget.SetFrameTimeThreshold(trackedBudget.m_threshold);
+                    }
+                    budget.PerFrameReset();
+                    trackedBudget.m_lastFrameTime = budget.GetLastFrameTime();
+                    trackedBudget.m_lastFrameCounters = budget.GetLastFrameHardwareCounters();
+                    break;
+                }
+            });
+    }
+
+    void BudgetSpikeMonitor::OnSystemTick()
+    {
+        const AZStd::sys_time_t now = AZStd::GetTimeNowTicks();
+        const AZStd::chrono::microseconds frameTime =
+            m_frameStartTicks.empty() ? AZStd::chrono::microseconds(0) : TicksToMicroseconds(now - m_frameStartTicks.back());
+
+        UpdateBudgets();
+
+        // The counters of the frame are the ones of the thread that ticks the system.
+        AZ::Debug::HardwareCounterValues frameCounters;
+        AZ::Debug::HardwareCounterValues frameEndCounters;
+        const bool hadFrameCounters = m_hasFrameCounters;
+        m_hasFrameCounters = m_performanceCollector->AreHardwareCountersEnabled() &&
+            AZ::Debug::Platform::ReadThreadHardwareCounters(frameEndCounters);
+        if (hadFrameCounters && m_hasFrameCounters)
+        {
+            frameCounters = frameEndCounters - m_frameStartCounters;
+        }
+        m_frameStartCounters = frameEndCounters;
+
+        m_performanceCollector->FrameTick();
+        if (!m_frameStartTicks.empty())
+        {
+            if (!m_performanceCollector->IsWaitingBeforeCapture())
+            {
+                m_performanceCollector->RecordSample(
+                    FrameMetricName, frameTime, hadFrameCounters && m_hasFrameCounters ? &frameCounters : nullptr);
+                for (const TrackedBudget& trackedBudget : m_budgets)
+                {
+                    // Budgets have no counters if they're unavailable or the budget had no regions during the frame.
+                    const bool hasCounters = trackedBudget.m_lastFrameCounters.m_cycles != 0;
+                    m_performanceCollector->RecordSample(
+                        trackedBudget.m_name, trackedBudget.m_lastFrameTime, hasCounters ? &trackedBudget.m_lastFrameCounters : nullptr);
+                }
+            }
+
+            if (m_frameTimeThreshold.count() > 0 && frameTime > m_frameTimeThreshold)
+            {
+                ReportSpike(FrameMetricName.data(), frameTime, m_frameTimeThreshold);
+            }
+            else
+            {
+                for (const TrackedBudget& trackedBudget : m_budgets)
+                {
+                    if (trackedBudget.m_lastFrameTime > trackedBudget.m_threshold)
+                    {
+                        ReportSpike(trackedBudget.m_name.c_str(), trackedBudget.m_lastFrameTime, trackedBudget.m_threshold);
+                        break;
+                    }
+                }
+            }
+        }
+
+        m_frameStartTicks.push_back(now);
+    }
+
+    void BudgetSpikeMonitor::ReportSpike(const char* reason, AZStd::chrono::microseconds time, AZStd::chrono::microseconds threshold)
+    {
+        const AZStd::sys_time_t now = AZStd::GetTimeNowTicks();
+        if (m_lastCaptureTick != 0 && now - m_lastCaptureTick < m_cooldownTicks)
+        {
+            return;
+        }
+        m_lastCaptureTick = now;
+
+        if (!m_captureFunction)
+        {
+            AZ_Warning(
+                "BudgetSpikeMonitor", false, "%s took %lld us, more than its threshold of %lld us", reason,
+                aznumeric_cast<long long>(time.count()), aznumeric_cast<long long>(threshold.count()));
+            return;
+        }
+
+        AZ::IO::FixedMaxPathString captureOutput = AZ::Debug::GetProfilerCaptureLocation();
+        const AZStd::string captureFile =
+            AZStd::string::format("%s/capture_spike_%s_%lld.json", captureOutput.c_str(), reason, AZStd::GetTimeNowSecond());
+        if (m_captureFunction(captureFile, m_frameStartTicks.front()))
+        {
+            AZ_Warning(
+                "BudgetSpikeMonitor", false, "%s took %lld us, more than its threshold of %lld us. Writing the last %zu frames to %s",
+                reason, aznumeric_cast<long long>(time.count()), aznumeric_cast<long long>(threshold.count()),
+                m_frameStartTicks.size(), captureFile.c_str());
+        }
+    }
+} // namespace Profiler
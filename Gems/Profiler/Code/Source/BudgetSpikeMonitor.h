@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Debug/PerformanceCollector.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/ring_buffer.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace Profiler
+{
+    //! Setting for the frame time, in milliseconds, above which a spike capture is written.
+    inline constexpr const char* SpikeCaptureFrameTimeThresholdKey = "/O3DE/Profiler/SpikeCapture/FrameTimeThresholdMs";
+    //! Setting object that maps budget names to the time, in milliseconds, the budget can use per frame before a spike
+    //! capture is written.
+    inline constexpr const char* SpikeCaptureBudgetThresholdsKey = "/O3DE/Profiler/SpikeCapture/BudgetThresholdsMs";
+    //! Setting for the number of frames before and including the spike that are written to the capture.
+    inline constexpr const char* SpikeCaptureFrameCountKey = "/O3DE/Profiler/SpikeCapture/FrameCount";
+    //! Setting for the minimum number of seconds between two spike captures.
+    inline constexpr const char* SpikeCaptureCooldownKey = "/O3DE/Profiler/SpikeCapture/CooldownSeconds";
+
+    //! Tracks the frame time and the time of the budgets that have a threshold every frame.
+    //! When the frame or a budget exceeds its threshold, the profiler data of the last frames is written through the capture
+    //! function. The frame and budget times are also recorded into a PerformanceCollector, which reports their statistics
+    //! and percentiles per batch of frames when enabled through the profiler_budgetMetrics* console variables, optionally
+    //! with the CPU hardware counters of the frame and of the budget regions.
+    //! The monitor is only enabled if the settings define a frame or budget threshold.
+    class BudgetSpikeMonitor
+        : public AZ::SystemTickBus::Handler
+    {
+    public:
+        AZ_RTTI(BudgetSpikeMonitor, "{4BF0FF6D-3C82-4707-AF3C-D5084B4D2FB1}");
+        AZ_CLASS_ALLOCATOR(BudgetSpikeMonitor, AZ::SystemAllocator);
+
+        //! Writes the regions recorded since the tick to the file. Returns false if the capture couldn't be started.
+        using CaptureFunction = AZStd::function<bool(const AZStd::string& outputFilePath, AZStd::sys_time_t sinceTick)>;
+
+        static constexpr AZStd::string_view FrameMetricName = "Frame";
+
+        BudgetSpikeMonitor() = default;
+        virtual ~BudgetSpikeMonitor() = default;
+
+        //! Reads the thresholds from the settings registry and starts monitoring if any are set. Without a capture function,
+        //! spikes are only reported to the log.
+        void Init(CaptureFunction captureFunction);
+        void Shutdown();
+
+        AZ::Debug::PerformanceCollector* GetPerformanceCollector();
+
+    private:
+        struct TrackedBudget
+        {
+            AZStd::string m_name;
+            AZStd::chrono::microseconds m_threshold;
+            AZStd::chrono::microseconds m_lastFrameTime{ 0 };
+            AZ::Debug::HardwareCounterValues m_lastFrameCounters;
+        };
+
+        // AZ::SystemTickBus::Handler overrides...
+        void OnSystemTick() override;
+
+        // Updates the frame times of the tracked budgets and resets the budgets for the next frame.
+        void UpdateBudgets();
+        void ReportSpike(const char* reason, AZStd::chrono::microseconds time, AZStd::chrono::microseconds threshold);
+
+        CaptureFunction m_captureFunction;
+        AZStd::vector<TrackedBudget> m_budgets;
+        AZStd::chrono::microseconds m_frameTimeThreshold{ 0 };
+        AZStd::unique_ptr<AZ::Debug::PerformanceCollector> m_performanceCollector;
+
+        // Start ticks of the most recent frames, oldest first.
+        AZStd::ring_buffer<AZStd::sys_time_t> m_frameStartTicks;
+        AZStd::sys_time_t m_cooldownTicks = 0;
+        AZStd::sys_time_t m_lastCaptureTick = 0;
+        AZ::Debug::HardwareCounterValues m_frameStartCounters;
+        bool m_hasFrameCounters = false;
+        bool m_initialized = false;
+    };
+} // namespace Profiler
@@ -7,6 +7,7 @@
  */
 
 #include <CpuProfiler.h>
+#include <CpuProfilerCaptureStream.h>
 
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -57,6 +58,10 @@ namespace Profiler
 
     // --- CpuProfiler ---
 
+    CpuProfiler::CpuProfiler() = default;
+
+    CpuProfiler::~CpuProfiler() = default;
+
     void CpuProfiler::Init()
     {
         AZ::Interface<AZ::Debug::Profiler>::Register(this);
@@ -80,9 +85,15 @@ namespace Profiler
 
         m_enabled = false;
 
+        if (m_captureStreamWriter)
+        {
+            m_captureStreamWriter->Stop();
+        }
+
         // Cleanup all TLS
         m_registeredThreads.clear();
         m_timeRegionMap.clear();
+        m_trackRegionMap.clear();
         m_initialized = false;
         m_continuousCaptureInProgress.store(false);
         m_continuousCaptureData.clear();
@@ -124,6 +135,33 @@ namespace Profiler
         }
     }
 
+    void CpuProfiler::RecordTrackRegion(
+        const AZ::Debug::Budget* budget,
+        const char* trackName,
+        const char* eventName,
+        AZ::s64 startTick,
+        AZ::s64 endTick,
+        AZ::u16 stackDepth)
+    {
+        if (m_shutdownMutex.try_lock_shared())
+        {
+            if (m_enabled)
+            {
+                // Tracks are stored like threads, with an id that can't collide with the ids of the registered threads in practice.
+                AZStd::thread_id trackId;
+                const AZ::u64 trackHash = AZStd::hash<AZStd::string_view>{}(trackName) | (1ull << 63);
+                memcpy(&trackId.m_id, &trackHash, AZStd::min(sizeof(trackId.m_id), sizeof(trackHash)));
+
+                CachedTimeRegion timeRegion({ budget->Name(), eventName }, stackDepth, startTick, endTick);
+
+                AZStd::scoped_lock lock(m_trackRegionMutex);
+                m_trackRegionMap[trackId][eventName].push_back(AZStd::move(timeRegion));
+            }
+
+            m_shutdownMutex.unlock_shared();
+        }
+    }
+
     const TimeRegionMap& CpuProfiler::GetTimeRegionMap() const
     {
         return m_timeRegionMap;
@@ -166,11 +204,58 @@ namespace Profiler
         return false;
     }
 
+    bool CpuProfiler::BeginStreamingCapture(const AZStd::string& outputFilePath)
+    {
+        bool expected = false;
+        if (!m_continuousCaptureInProgress.compare_exchange_strong(expected, true))
+        {
+            AZ_TracePrintf("Profiler", "Attempting to start a continuous capture while one already in progress");
+            return false;
+        }
+
+        AZStd::scoped_lock lock(m_continuousCaptureEndingMutex);
+        if (!m_captureStreamWriter)
+        {
+            m_captureStreamWriter = AZStd::make_unique<CpuProfilerCaptureStreamWriter>();
+        }
+
+        if (!m_captureStreamWriter->Start(outputFilePath))
+        {
+            m_continuousCaptureInProgress.store(false);
+            return false;
+        }
+
+        m_enabled = true;
+        AZ_TracePrintf("Profiler", "Streaming capture to '%s' started\n", outputFilePath.c_str());
+        return true;
+    }
+
+    bool CpuProfiler::EndStreamingCapture()
+    {
+        if (!IsStreamingCaptureInProgress())
+        {
+            AZ_TracePrintf("Profiler", "Attempting to end a streaming capture while one not in progress");
+            return false;
+        }
+
+        AZStd::scoped_lock lock(m_continuousCaptureEndingMutex);
+        m_enabled = false;
+        const bool wroteAllFrames = m_captureStreamWriter->Stop();
+        AZ_TracePrintf("Profiler", "Streaming capture ended\n");
+        m_continuousCaptureInProgress.store(false);
+        return wroteAllFrames;
+    }
+
     bool CpuProfiler::IsContinuousCaptureInProgress() const
     {
         return m_continuousCaptureInProgress.load();
     }
 
+    bool CpuProfiler::IsStreamingCaptureInProgress() const
+    {
+        return m_continuousCaptureInProgress.load() && m_captureStreamWriter && m_captureStreamWriter->IsStarted();
+    }
+
     void CpuProfiler::SetProfilerEnabled(bool enabled)
     {
         AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
@@ -212,13 +297,20 @@ namespace Profiler
 
         if (m_continuousCaptureInProgress.load() && m_continuousCaptureEndingMutex.try_lock())
         {
-            if (m_continuousCaptureData.full() && m_continuousCaptureData.size() != MaxFramesToSave)
+            if (m_captureStreamWriter && m_captureStreamWriter->IsStarted())
             {
-                const AZStd::size_t size = m_continuousCaptureData.size();
-                m_continuousCaptureData.set_capacity(AZStd::min(MaxFramesToSave, size + size / 2));
+                m_captureStreamWriter->AddFrame(AZStd::move(m_timeRegionMap));
             }
+            else
+            {
+                if (m_continuousCaptureData.full() && m_continuousCaptureData.size() != MaxFramesToSave)
+                {
+                    const AZStd::size_t size = m_continuousCaptureData.size();
+                    m_continuousCaptureData.set_capacity(AZStd::min(MaxFramesToSave, size + size / 2));
+                }
 
-            m_continuousCaptureData.push_back(AZStd::move(m_timeRegionMap));
+                m_continuousCaptureData.push_back(AZStd::move(m_timeRegionMap));
+            }
             m_timeRegionMap.clear();
             m_continuousCaptureEndingMutex.unlock();
         }
@@ -233,6 +325,15 @@ namespace Profiler
             threadLocal->TryFlushCachedMap(threadMapEntry);
         }
 
+        {
+            AZStd::scoped_lock trackLock(m_trackRegionMutex);
+            for (auto& [trackId, trackRegions] : m_trackRegionMap)
+            {
+                newMap[trackId] = AZStd::move(trackRegions);
+            }
+            m_trackRegionMap.clear();
+        }
+
         // Clear all TLS that flagged themselves to be deleted, meaning that the thread is already terminated
         AZStd::remove_if(m_registeredThreads.begin(), m_registeredThreads.end(), [](const AZStd::intrusive_ptr<CpuTimingLocalStorage>& thread)
         {
@@ -19,10 +19,13 @@
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_refcount.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 
 namespace Profiler
 {
+    class CpuProfilerCaptureStreamWriter;
+
     //! Structure that is used to cache a timed region into the thread's local storage.
     struct CachedTimeRegion
     {
@@ -133,8 +136,8 @@ namespace Profiler
         AZ_RTTI(CpuProfiler, "{10E9D394-FC83-4B45-B2B8-807C6BF07BF0}", AZ::Debug::Profiler);
         AZ_CLASS_ALLOCATOR(CpuProfiler, AZ::SystemAllocator);
 
-        CpuProfiler() = default;
-        ~CpuProfiler() = default;
+        CpuProfiler();
+        ~CpuProfiler();
 
         //! Registers/un-registers the AZ::Debug::Profiler instance to the interface
         void Init();
@@ -143,6 +146,13 @@ namespace Profiler
         //! AZ::Debug::Profiler overrides...
         void BeginRegion(const AZ::Debug::Budget* budget, const char* eventName, size_t eventNameArgCount, ...) final override;
         void EndRegion(const AZ::Debug::Budget* budget) final override;
+        void RecordTrackRegion(
+            const AZ::Debug::Budget* budget,
+            const char* trackName,
+            const char* eventName,
+            AZ::s64 startTick,
+            AZ::s64 endTick,
+            AZ::u16 stackDepth) final override;
 
         //! Get the last frame's TimeRegionMap
         const TimeRegionMap& GetTimeRegionMap() const;
@@ -151,6 +161,15 @@ namespace Profiler
         bool BeginContinuousCapture();
         bool EndContinuousCapture(AZStd::ring_buffer<TimeRegionMap>& flushTarget);
 
+        //! Starting/ending a multi-frame capture that streams the profiling data to a file while it's recorded, instead
+        //! of keeping it in memory. See CpuProfilerCaptureStreamWriter for the file format.
+        //! EndStreamingCapture blocks until the remaining frames are written, and returns false if not all frames could be written.
+        bool BeginStreamingCapture(const AZStd::string& outputFilePath);
+        bool EndStreamingCapture();
+
+        //! Check to see if the capture that is currently in progress was started by BeginStreamingCapture.
+        bool IsStreamingCaptureInProgress() const;
+
         //! Check to see if a programmatic capture is currently in progress, implies
         //! that the profiler is active if returns True.
         bool IsContinuousCaptureInProgress() const;
@@ -175,6 +194,11 @@ namespace Profiler
         // On the start of each frame, this map will be updated with the last frame's profiling data.
         TimeRegionMap m_timeRegionMap;
 
+        // Regions recorded with RecordTrackRegion() since the last tick, keyed by an id that is derived from the track name.
+        // They are added to m_timeRegionMap together with the regions of the threads.
+        TimeRegionMap m_trackRegionMap;
+        AZStd::mutex m_trackRegionMutex;
+
         // Set of registered threads when created
         AZStd::vector<AZStd::intrusive_ptr<CpuTimingLocalStorage>, AZ::OSStdAllocator> m_registeredThreads;
         AZStd::mutex m_threadRegisterMutex;
@@ -197,6 +221,9 @@ namespace Profiler
         // Stores multiple frames of profiling data, size is controlled by MaxFramesToSave. Flushed when EndContinuousCapture is called.
         // Ring buffer so that we can have fast append of new data + removal of old profiling data with good cache locality.
         AZStd::ring_buffer<TimeRegionMap> m_continuousCaptureData;
+
+        // Receives the frames instead of m_continuousCaptureData while a streaming capture is in progress.
+        AZStd::unique_ptr<CpuProfilerCaptureStreamWriter> m_captureStreamWriter;
     };
 
     // Intermediate class to serialize Cpu TimedRegion data.
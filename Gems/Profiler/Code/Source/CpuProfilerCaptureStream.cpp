@@ -0,0 +1,561 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CpuProfilerCaptureStream.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Compression/Compression.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/std/time.h>
+
+namespace Profiler
+{
+    namespace
+    {
+        constexpr AZ::u32 FileSignature = 0x53555043; // "CPUS"
+        constexpr AZ::u32 ChunkSignature = 0x4B4E4843; // "CHNK"
+        constexpr AZ::u32 FileVersion = 1;
+
+        // Favor speed, the chunks are compressed while the capture is running.
+        constexpr unsigned int CompressionLevel = 1;
+
+        struct FileHeader
+        {
+            AZ::u32 m_signature = FileSignature;
+            AZ::u32 m_version = FileVersion;
+            AZ::s64 m_ticksPerSecond = 0;
+        };
+        static_assert(sizeof(FileHeader) == 16, "The file header is written as is and must not contain padding");
+
+        struct ChunkHeader
+        {
+            AZ::u32 m_signature = ChunkSignature;
+            AZ::u32 m_regionCount = 0;
+            AZ::u32 m_compressedSize = 0;
+            AZ::u32 m_uncompressedSize = 0;
+            AZ::s64 m_startTick = 0;
+            AZ::s64 m_endTick = 0;
+        };
+        static_assert(sizeof(ChunkHeader) == 32, "The chunk header is written as is and must not contain padding");
+
+        void WriteVarUInt(AZStd::vector<AZ::u8>& buffer, AZ::u64 value)
+        {
+            while (value >= 0x80)
+            {
+                buffer.push_back(static_cast<AZ::u8>(value | 0x80));
+                value >>= 7;
+            }
+            buffer.push_back(static_cast<AZ::u8>(value));
+        }
+
+        // Zigzag encoding keeps small negative deltas small, regions of a thread can start before the previous one
+        // when they were recorded in different frames.
+        void WriteVarInt(AZStd::vector<AZ::u8>& buffer, AZ::s64 value)
+        {
+            WriteVarUInt(buffer, (static_cast<AZ::u64>(value) << 1) ^ static_cast<AZ::u64>(value >> 63));
+        }
+
+        class ChunkDecoder
+        {
+        public:
+            explicit ChunkDecoder(const AZStd::vector<AZ::u8>& buffer)
+                : m_buffer(buffer)
+            {
+            }
+
+            bool ReadVarUInt(AZ::u64& value)
+            {
+                value = 0;
+                for (AZ::u32 shift = 0; shift < 64; shift += 7)
+                {
+                    if (m_offset >= m_buffer.size())
+                    {
+                        return false;
+                    }
+                    const AZ::u8 byte = m_buffer[m_offset++];
+                    value |= static_cast<AZ::u64>(byte & 0x7F) << shift;
+                    if ((byte & 0x80) == 0)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            bool ReadVarInt(AZ::s64& value)
+            {
+                AZ::u64 encoded = 0;
+                if (!ReadVarUInt(encoded))
+                {
+                    return false;
+                }
+                value = static_cast<AZ::s64>(encoded >> 1) ^ -static_cast<AZ::s64>(encoded & 1);
+                return true;
+            }
+
+            bool ReadString(AZStd::string_view& value)
+            {
+                AZ::u64 size = 0;
+                if (!ReadVarUInt(size) || size > m_buffer.size() - m_offset)
+                {
+                    return false;
+                }
+                value = AZStd::string_view(reinterpret_cast<const char*>(m_buffer.data() + m_offset), size);
+                m_offset += size;
+                return true;
+            }
+
+            bool IsAtEnd() const
+            {
+                return m_offset == m_buffer.size();
+            }
+
+        private:
+            const AZStd::vector<AZ::u8>& m_buffer;
+            AZStd::size_t m_offset = 0;
+        };
+    } // namespace
+
+    // --- CpuProfilerCaptureStreamWriter ---
+
+    CpuProfilerCaptureStreamWriter::~CpuProfilerCaptureStreamWriter()
+    {
+        Stop();
+    }
+
+    bool CpuProfilerCaptureStreamWriter::Start(const AZStd::string& outputFilePath)
+    {
+        if (m_started)
+        {
+            return false;
+        }
+
+        if (!m_file.Open(
+                outputFilePath.c_str(),
+                AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("CpuProfilerCaptureStream", false, "Failed to create the capture file '%s'", outputFilePath.c_str());
+            return false;
+        }
+
+        FileHeader header;
+        header.m_ticksPerSecond = AZStd::GetTimeTicksPerSecond();
+        if (m_file.Write(&header, sizeof(header)) != sizeof(header))
+        {
+            AZ_Warning("CpuProfilerCaptureStream", false, "Failed to write to the capture file '%s'", outputFilePath.c_str());
+            m_file.Close();
+            return false;
+        }
+
+        m_pendingFrames.clear();
+        m_stopRequested = false;
+        m_writeFailed = false;
+        m_droppedFrameCount = 0;
+        m_started = true;
+
+        AZStd::thread_desc threadDesc{ "CpuProfilerCaptureStream" };
+        m_writerThread = AZStd::thread(threadDesc,
+            [this]()
+            {
+                WriterThreadMain();
+            });
+        return true;
+    }
+
+    bool CpuProfilerCaptureStreamWriter::Stop()
+    {
+        if (!m_started)
+        {
+            return false;
+        }
+
+        {
+            AZStd::scoped_lock lock(m_pendingFramesMutex);
+            m_stopRequested = true;
+        }
+        m_pendingFramesCondition.notify_one();
+        m_writerThread.join();
+        m_file.Close();
+        m_started = false;
+
+        AZ_Warning("CpuProfilerCaptureStream", m_droppedFrameCount == 0,
+            "Dropped %zu frames of profiling data because they couldn't be written fast enough", m_droppedFrameCount);
+        return !m_writeFailed && m_droppedFrameCount == 0;
+    }
+
+    bool CpuProfilerCaptureStreamWriter::IsStarted() const
+    {
+        return m_started;
+    }
+
+    void CpuProfilerCaptureStreamWriter::AddFrame(TimeRegionMap&& frame)
+    {
+        if (frame.empty())
+        {
+            return;
+        }
+
+        bool isChunkReady = false;
+        {
+            AZStd::scoped_lock lock(m_pendingFramesMutex);
+            if (m_pendingFrames.size() >= MaxPendingFrames)
+            {
+                ++m_droppedFrameCount;
+                return;
+            }
+            m_pendingFrames.push_back(AZStd::move(frame));
+            isChunkReady = m_pendingFrames.size() >= FramesPerChunk;
+        }
+
+        if (isChunkReady)
+        {
+            m_pendingFramesCondition.notify_one();
+        }
+    }
+
+    void CpuProfilerCaptureStreamWriter::WriterThreadMain()
+    {
+        AZStd::vector<TimeRegionMap> chunkFrames;
+        bool isDone = false;
+        while (!isDone)
+        {
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_pendingFramesMutex);
+                m_pendingFramesCondition.wait(lock,
+                    [this]()
+                    {
+                        return m_stopRequested || m_pendingFrames.size() >= FramesPerChunk;
+                    });
+
+                const AZStd::size_t frameCount = AZStd::min(FramesPerChunk, m_pendingFrames.size());
+                chunkFrames.assign(
+                    AZStd::make_move_iterator(m_pendingFrames.begin()), AZStd::make_move_iterator(m_pendingFrames.begin() + frameCount));
+                m_pendingFrames.erase(m_pendingFrames.begin(), m_pendingFrames.begin() + frameCount);
+                isDone = m_stopRequested && m_pendingFrames.empty();
+            }
+
+            // Keep going after a failed write, so the frames are still consumed and the profiler doesn't fall behind.
+            if (!chunkFrames.empty() && !m_writeFailed && !WriteChunk(chunkFrames))
+            {
+                AZ_Warning("CpuProfilerCaptureStream", false, "Failed to write to the capture file, the capture is incomplete");
+                m_writeFailed = true;
+            }
+            chunkFrames.clear();
+        }
+    }
+
+    bool CpuProfilerCaptureStreamWriter::WriteChunk(const AZStd::vector<TimeRegionMap>& frames)
+    {
+        // Group the regions by thread, the regions of a frame are grouped by their name.
+        AZStd::unordered_map<size_t, AZStd::vector<const CachedTimeRegion*>> threadRegions;
+        for (const TimeRegionMap& frame : frames)
+        {
+            for (const auto& [threadId, regionMap] : frame)
+            {
+                AZStd::vector<const CachedTimeRegion*>& regions = threadRegions[AZStd::hash<AZStd::thread_id>{}(threadId)];
+                for (const auto& [regionName, regionVec] : regionMap)
+                {
+                    for (const CachedTimeRegion& region : regionVec)
+                    {
+                        regions.push_back(&region);
+                    }
+                }
+            }
+        }
+
+        ChunkHeader header;
+        header.m_startTick = AZStd::numeric_limits<AZ::s64>::max();
+        header.m_endTick = AZStd::numeric_limits<AZ::s64>::lowest();
+
+        // Names are stored once per chunk, so chunks can be decoded independently of each other.
+        AZStd::unordered_map<AZStd::string_view, AZ::u32> stringIndices;
+        AZStd::vector<AZStd::string_view> strings;
+        auto getStringIndex = [&stringIndices, &strings](AZStd::string_view value)
+        {
+            auto [it, inserted] = stringIndices.emplace(value, aznumeric_cast<AZ::u32>(strings.size()));
+            if (inserted)
+            {
+                strings.push_back(value);
+            }
+            return it->second;
+        };
+
+        AZ::u32 regionCount = 0;
+        for (auto& [threadId, regions] : threadRegions)
+        {
+            AZStd::sort(regions.begin(), regions.end(),
+                [](const CachedTimeRegion* lhs, const CachedTimeRegion* rhs)
+                {
+                    return lhs->m_startTick < rhs->m_startTick;
+                });
+            for (const CachedTimeRegion* region : regions)
+            {
+                getStringIndex(region->m_groupRegionName.m_groupName ? region->m_groupRegionName.m_groupName : "");
+                getStringIndex(region->m_groupRegionName.m_regionName.GetStringView());
+                header.m_startTick = AZStd::min(header.m_startTick, region->m_startTick);
+                header.m_endTick = AZStd::max(header.m_endTick, region->m_endTick);
+            }
+            regionCount += aznumeric_cast<AZ::u32>(regions.size());
+        }
+
+        if (regionCount == 0)
+        {
+            return true;
+        }
+
+        m_encodeBuffer.clear();
+        WriteVarUInt(m_encodeBuffer, strings.size());
+        for (AZStd::string_view value : strings)
+        {
+            WriteVarUInt(m_encodeBuffer, value.size());
+            m_encodeBuffer.insert(m_encodeBuffer.end(), value.begin(), value.end());
+        }
+
+        WriteVarUInt(m_encodeBuffer, threadRegions.size());
+        for (const auto& [threadId, regions] : threadRegions)
+        {
+            WriteVarUInt(m_encodeBuffer, threadId);
+            WriteVarUInt(m_encodeBuffer, regions.size());
+
+            AZStd::sys_time_t previousStartTick = header.m_startTick;
+            for (const CachedTimeRegion* region : regions)
+            {
+                WriteVarUInt(m_encodeBuffer, stringIndices[region->m_groupRegionName.m_groupName ? region->m_groupRegionName.m_groupName : ""]);
+                WriteVarUInt(m_encodeBuffer, stringIndices[region->m_groupRegionName.m_regionName.GetStringView()]);
+                WriteVarUInt(m_encodeBuffer, region->m_stackDepth);
+                WriteVarInt(m_encodeBuffer, region->m_startTick - previousStartTick);
+                WriteVarInt(m_encodeBuffer, region->m_endTick - region->m_startTick);
+                previousStartTick = region->m_startTick;
+            }
+        }
+
+        AZ::ZLib zlib;
+        zlib.StartCompressor(CompressionLevel);
+        unsigned int remainingSize = aznumeric_cast<unsigned int>(m_encodeBuffer.size());
+        m_compressBuffer.resize_no_construct(zlib.GetMinCompressedBufferSize(remainingSize));
+        const unsigned int compressedSize = zlib.Compress(m_encodeBuffer.data(), remainingSize, m_compressBuffer.data(),
+            aznumeric_cast<unsigned int>(m_compressBuffer.size()), AZ::ZLib::FT_FINISH);
+        zlib.StopCompressor();
+        if (remainingSize != 0)
+        {
+            return false;
+        }
+
+        header.m_regionCount = regionCount;
+        header.m_compressedSize = compressedSize;
+        header.m_uncompressedSize = aznumeric_cast<AZ::u32>(m_encodeBuffer.size());
+
+        return m_file.Write(&header, sizeof(header)) == sizeof(header) &&
+            m_file.Write(m_compressBuffer.data(), compressedSize) == compressedSize;
+    }
+
+    // --- CpuProfilerCaptureStreamReader ---
+
+    AZ::Outcome<void, AZStd::string> CpuProfilerCaptureStreamReader::Open(const char* capturePath)
+    {
+        m_capturePath = capturePath;
+        m_chunks.clear();
+        m_ticksPerSecond = 0;
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(capturePath, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+        {
+            return AZ::Failure(AZStd::string::format("Could not open file %s, is the path correct?", capturePath));
+        }
+
+        FileHeader fileHeader;
+        if (file.Read(sizeof(fileHeader), &fileHeader) != sizeof(fileHeader) || fileHeader.m_signature != FileSignature)
+        {
+            return AZ::Failure(AZStd::string::format("File %s is not a streamed CPU profiler capture", capturePath));
+        }
+        if (fileHeader.m_version != FileVersion)
+        {
+            return AZ::Failure(AZStd::string::format(
+                "Capture %s has version %u, only version %u is supported", capturePath, fileHeader.m_version, FileVersion));
+        }
+        m_ticksPerSecond = fileHeader.m_ticksPerSecond;
+
+        const AZ::u64 fileSize = file.Length();
+        AZ::u64 offset = sizeof(fileHeader);
+        ChunkHeader chunkHeader;
+        while (offset + sizeof(chunkHeader) <= fileSize)
+        {
+            file.Seek(offset, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+            if (file.Read(sizeof(chunkHeader), &chunkHeader) != sizeof(chunkHeader) || chunkHeader.m_signature != ChunkSignature)
+            {
+                AZ_Warning("CpuProfilerCaptureStream", false, "Capture %s is corrupted after %zu chunks", capturePath, m_chunks.size());
+                break;
+            }
+
+            const AZ::u64 chunkOffset = offset + sizeof(chunkHeader);
+            if (chunkOffset + chunkHeader.m_compressedSize > fileSize)
+            {
+                // The last chunk is still being written.
+                break;
+            }
+
+            ChunkInfo& chunk = m_chunks.emplace_back();
+            chunk.m_fileOffset = chunkOffset;
+            chunk.m_compressedSize = chunkHeader.m_compressedSize;
+            chunk.m_uncompressedSize = chunkHeader.m_uncompressedSize;
+            chunk.m_regionCount = chunkHeader.m_regionCount;
+            chunk.m_startTick = chunkHeader.m_startTick;
+            chunk.m_endTick = chunkHeader.m_endTick;
+            offset = chunkOffset + chunkHeader.m_compressedSize;
+        }
+
+        if (m_chunks.empty())
+        {
+            return AZ::Failure(AZStd::string::format("Capture %s doesn't contain any profiling data", capturePath));
+        }
+
+        return AZ::Success();
+    }
+
+    const AZStd::vector<CpuProfilerCaptureStreamReader::ChunkInfo>& CpuProfilerCaptureStreamReader::GetChunks() const
+    {
+        return m_chunks;
+    }
+
+    AZStd::sys_time_t CpuProfilerCaptureStreamReader::GetTicksPerSecond() const
+    {
+        return m_ticksPerSecond;
+    }
+
+    AZStd::sys_time_t CpuProfilerCaptureStreamReader::GetStartTick() const
+    {
+        return m_chunks.empty() ? 0 : m_chunks.front().m_startTick;
+    }
+
+    AZStd::sys_time_t CpuProfilerCaptureStreamReader::GetEndTick() const
+    {
+        return m_chunks.empty() ? 0 : m_chunks.back().m_endTick;
+    }
+
+    AZStd::vector<AZStd::size_t> CpuProfilerCaptureStreamReader::GetChunksInRange(
+        AZStd::sys_time_t startTick, AZStd::sys_time_t endTick) const
+    {
+        // Chunks are written in order, but long regions can make the ranges of neighboring chunks overlap.
+        AZStd::vector<AZStd::size_t> chunkIndices;
+        for (AZStd::size_t chunkIndex = 0; chunkIndex < m_chunks.size(); ++chunkIndex)
+        {
+            if (m_chunks[chunkIndex].m_startTick <= endTick && m_chunks[chunkIndex].m_endTick >= startTick)
+            {
+                chunkIndices.push_back(chunkIndex);
+            }
+        }
+        return chunkIndices;
+    }
+
+    AZ::Outcome<AZStd::vector<CpuProfilerCaptureStreamReader::Entry>, AZStd::string> CpuProfilerCaptureStreamReader::ReadChunk(
+        AZStd::size_t chunkIndex) const
+    {
+        if (chunkIndex >= m_chunks.size())
+        {
+            return AZ::Failure(AZStd::string::format("Chunk %zu is out of range", chunkIndex));
+        }
+
+        const ChunkInfo& chunk = m_chunks[chunkIndex];
+        AZStd::vector<AZ::u8> compressedData;
+        compressedData.resize_no_construct(chunk.m_compressedSize);
+        if (AZ::IO::SystemFile::Read(m_capturePath.c_str(), compressedData.data(), chunk.m_compressedSize, chunk.m_fileOffset) !=
+            chunk.m_compressedSize)
+        {
+            return AZ::Failure(AZStd::string::format("Failed to read chunk %zu of capture %s", chunkIndex, m_capturePath.c_str()));
+        }
+
+        AZStd::vector<AZ::u8> data;
+        data.resize_no_construct(chunk.m_uncompressedSize);
+        AZ::ZLib zlib;
+        zlib.StartDecompressor();
+        unsigned int remainingSize = chunk.m_uncompressedSize;
+        zlib.Decompress(compressedData.data(), chunk.m_compressedSize, data.data(), remainingSize, AZ::ZLib::FT_FINISH);
+        zlib.StopDecompressor();
+        if (remainingSize != 0)
+        {
+            return AZ::Failure(AZStd::string::format("Failed to decompress chunk %zu of capture %s", chunkIndex, m_capturePath.c_str()));
+        }
+
+        auto corruptedChunk = [&]()
+        {
+            return AZ::Failure(AZStd::string::format("Chunk %zu of capture %s is corrupted", chunkIndex, m_capturePath.c_str()));
+        };
+
+        ChunkDecoder decoder(data);
+        AZ::u64 stringCount = 0;
+        if (!decoder.ReadVarUInt(stringCount) || stringCount > data.size())
+        {
+            return corruptedChunk();
+        }
+        AZStd::vector<AZ::Name> names;
+        names.reserve(stringCount);
+        for (AZ::u64 i = 0; i < stringCount; ++i)
+        {
+            AZStd::string_view value;
+            if (!decoder.ReadString(value))
+            {
+                return corruptedChunk();
+            }
+            names.emplace_back(value);
+        }
+
+        AZStd::vector<Entry> entries;
+        entries.reserve(chunk.m_regionCount);
+
+        AZ::u64 threadCount = 0;
+        if (!decoder.ReadVarUInt(threadCount))
+        {
+            return corruptedChunk();
+        }
+        for (AZ::u64 threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            AZ::u64 threadId = 0;
+            AZ::u64 regionCount = 0;
+            if (!decoder.ReadVarUInt(threadId) || !decoder.ReadVarUInt(regionCount))
+            {
+                return corruptedChunk();
+            }
+
+            AZStd::sys_time_t previousStartTick = chunk.m_startTick;
+            for (AZ::u64 regionIndex = 0; regionIndex < regionCount; ++regionIndex)
+            {
+                AZ::u64 groupIndex = 0;
+                AZ::u64 nameIndex = 0;
+                AZ::u64 stackDepth = 0;
+                AZ::s64 startDelta = 0;
+                AZ::s64 duration = 0;
+                if (!decoder.ReadVarUInt(groupIndex) || !decoder.ReadVarUInt(nameIndex) || !decoder.ReadVarUInt(stackDepth) ||
+                    !decoder.ReadVarInt(startDelta) || !decoder.ReadVarInt(duration) || groupIndex >= names.size() ||
+                    nameIndex >= names.size())
+                {
+                    return corruptedChunk();
+                }
+
+                Entry& entry = entries.emplace_back();
+                entry.m_groupName = names[groupIndex];
+                entry.m_regionName = names[nameIndex];
+                entry.m_stackDepth = aznumeric_cast<uint16_t>(stackDepth);
+                entry.m_startTick = previousStartTick + startDelta;
+                entry.m_endTick = entry.m_startTick + duration;
+                entry.m_threadId = aznumeric_cast<size_t>(threadId);
+                previousStartTick = entry.m_startTick;
+            }
+        }
+
+        if (!decoder.IsAtEnd())
+        {
+            return corruptedChunk();
+        }
+
+        return AZ::Success(AZStd::move(entries));
+    }
+} // namespace Profiler
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <CpuProfiler.h>
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/conditional_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
+
+namespace Profiler
+{
+    //! Setting that makes continuous captures of the CpuProfiler stream their frames to disk instead of keeping them in memory.
+    inline constexpr const char* StreamingCaptureEnabledKey = "/O3DE/Profiler/StreamingCapture/Enabled";
+    //! Extension of the files written by streaming captures, which replaces the extension of the requested capture file.
+    inline constexpr const char* StreamingCaptureExtension = ".cpustream";
+
+    //! Writes the frames of a continuous capture to a file from a background thread.
+    //! The file is a sequence of self contained chunks of about a second of frames each, so memory use doesn't grow with
+    //! the length of the capture and a viewer only needs to load the chunks of the time range it shows.
+    //! Within a chunk the regions are stored per thread in start tick order with delta encoded ticks, and the chunk is
+    //! compressed with zlib.
+    class CpuProfilerCaptureStreamWriter
+    {
+    public:
+        //! Frames that are combined into a single chunk.
+        static constexpr AZStd::size_t FramesPerChunk = 60;
+        //! Frames are dropped when the writer thread falls behind by more than this, to keep the memory use bounded.
+        static constexpr AZStd::size_t MaxPendingFrames = FramesPerChunk * 8;
+
+        CpuProfilerCaptureStreamWriter() = default;
+        ~CpuProfilerCaptureStreamWriter();
+
+        //! Creates the file and starts the writer thread.
+        bool Start(const AZStd::string& outputFilePath);
+
+        //! Writes the remaining frames, stops the writer thread and closes the file.
+        //! @returns false if not all frames could be written.
+        bool Stop();
+
+        bool IsStarted() const;
+
+        //! Queues the regions of a frame to be written.
+        void AddFrame(TimeRegionMap&& frame);
+
+    private:
+        void WriterThreadMain();
+        bool WriteChunk(const AZStd::vector<TimeRegionMap>& frames);
+
+        AZ::IO::SystemFile m_file;
+        AZStd::thread m_writerThread;
+
+        AZStd::mutex m_pendingFramesMutex;
+        AZStd::condition_variable m_pendingFramesCondition;
+        AZStd::vector<TimeRegionMap> m_pendingFrames;
+        bool m_stopRequested = false;
+
+        AZStd::atomic_bool m_started = false;
+        AZStd::atomic_bool m_writeFailed = false;
+        AZStd::size_t m_droppedFrameCount = 0;
+
+        // Reused between chunks by the writer thread.
+        AZStd::vector<AZ::u8> m_encodeBuffer;
+        AZStd::vector<AZ::u8> m_compressBuffer;
+    };
+
+    //! Reads the files written by the CpuProfilerCaptureStreamWriter.
+    //! Opening only reads the chunk headers, the regions of a chunk are read when they are requested.
+    class CpuProfilerCaptureStreamReader
+    {
+    public:
+        using Entry = CpuProfilingStatisticsSerializer::CpuProfilingStatisticsSerializerEntry;
+
+        struct ChunkInfo
+        {
+            AZ::u64 m_fileOffset = 0;
+            AZ::u32 m_compressedSize = 0;
+            AZ::u32 m_uncompressedSize = 0;
+            AZ::u32 m_regionCount = 0;
+            AZStd::sys_time_t m_startTick = 0;
+            AZStd::sys_time_t m_endTick = 0;
+        };
+
+        //! Reads the index of the chunks. Chunks that were not completely written, for example while the capture is
+        //! still in progress, are ignored.
+        AZ::Outcome<void, AZStd::string> Open(const char* capturePath);
+
+        const AZStd::vector<ChunkInfo>& GetChunks() const;
+        AZStd::sys_time_t GetTicksPerSecond() const;
+        AZStd::sys_time_t GetStartTick() const;
+        AZStd::sys_time_t GetEndTick() const;
+
+        //! Returns the indices of the chunks with regions that overlap [startTick, endTick].
+        AZStd::vector<AZStd::size_t> GetChunksInRange(AZStd::sys_time_t startTick, AZStd::sys_time_t endTick) const;
+
+        //! Reads and decodes the regions of a chunk.
+        AZ::Outcome<AZStd::vector<Entry>, AZStd::string> ReadChunk(AZStd::size_t chunkIndex) const;
+
+    private:
+        AZStd::string m_capturePath;
+        AZStd::vector<ChunkInfo> m_chunks;
+        AZStd::sys_time_t m_ticksPerSecond = 0;
+    };
+} // namespace Profiler
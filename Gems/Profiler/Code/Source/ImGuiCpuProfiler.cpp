@@ -20,6 +20,7 @@
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/JsonSerializationResult.h>
 #include <AzCore/Statistics/StatisticalProfilerProxy.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/string/conversions.h>
@@ -195,6 +196,9 @@ namespace Profiler
         if (ImGui::Button(m_paused ? "Resume" : "Pause"))
         {
             m_ticksPerSecondFromFile = 0;
+            m_captureStream.reset();
+            m_loadedChunks.clear();
+            m_loadedChunkIndices.clear();
             m_paused = !m_paused;
             AZ::Debug::ProfilerSystemInterface::Get()->SetActive(!m_paused);
         }
@@ -232,13 +236,14 @@ namespace Profiler
             AZ::IO::FixedMaxPathString captureOutput = AZ::Debug::GetProfilerCaptureLocation();
 
             auto* base = AZ::IO::FileIOBase::GetInstance();
-            base->FindFiles(captureOutput.c_str(), "*.json",
-                [&paths = m_cachedCapturePaths](const char* path) -> bool
-                {
-                    auto foundPath = AZ::IO::Path(path);
-                    paths.push_back(foundPath);
-                    return true;
-                });
+            auto addPath = [&paths = m_cachedCapturePaths](const char* path) -> bool
+            {
+                auto foundPath = AZ::IO::Path(path);
+                paths.push_back(foundPath);
+                return true;
+            };
+            base->FindFiles(captureOutput.c_str(), "*.json", addPath);
+            base->FindFiles(captureOutput.c_str(), AZStd::string::format("*%s", StreamingCaptureExtension).c_str(), addPath);
 
             // Sort by decreasing modification time (most recent at the top)
             AZStd::sort(m_cachedCapturePaths.begin(), m_cachedCapturePaths.end(),
@@ -457,6 +462,12 @@ namespace Profiler
     void ImGuiCpuProfiler::LoadFile()
     {
         const AZ::IO::Path& pathToLoad = m_cachedCapturePaths[m_currentFileIndex];
+        if (pathToLoad.Extension() == StreamingCaptureExtension)
+        {
+            LoadStreamedFile(pathToLoad);
+            return;
+        }
+
         auto loadResult = CpuProfilerImGuiHelper::LoadSavedCpuProfilingStatistics(pathToLoad.c_str());
         if (!loadResult.IsSuccess())
         {
@@ -465,11 +476,129 @@ namespace Profiler
         }
 
         CpuProfilingStatisticsSerializer serializer = loadResult.TakeValue();
-        AZStd::vector<CpuProfilingStatisticsSerializer::CpuProfilingStatisticsSerializerEntry>& deserializedData =
-            serializer.m_cpuProfilingStatisticsSerializerEntries;
 
+        m_captureStream.reset();
+        m_loadedChunks.clear();
+        m_loadedChunkIndices.clear();
+        ClearLoadedData();
+        m_ticksPerSecondFromFile = serializer.m_timeTicksPerSecond;
+
+        const AZStd::sys_time_t frameTime = AddLoadedEntries(serializer.m_cpuProfilingStatisticsSerializerEntries);
+
+        // Update viewport bounds to the estimated final frame time with some padding
+        m_viewportStartTick = m_frameEndTicks.back() - frameTime - ProfilerViewEdgePadding;
+        m_viewportEndTick = m_frameEndTicks.back() + ProfilerViewEdgePadding;
+
+        SortLoadedData();
+    }
+
+    void ImGuiCpuProfiler::LoadStreamedFile(const AZ::IO::Path& pathToLoad)
+    {
+        char resolvedPath[AZ::IO::MaxPathLength];
+        if (!AZ::IO::FileIOBase::GetInstance()->ResolvePath(pathToLoad.c_str(), resolvedPath, AZ::IO::MaxPathLength))
+        {
+            AZ_TracePrintf("ImGuiCpuProfiler", "Could not resolve the path to file %s, is the path correct?", pathToLoad.c_str());
+            return;
+        }
+
+        auto captureStream = AZStd::make_unique<CpuProfilerCaptureStreamReader>();
+        auto openResult = captureStream->Open(resolvedPath);
+        if (!openResult.IsSuccess())
+        {
+            AZ_TracePrintf("ImGuiCpuProfiler", "%s", openResult.GetError().c_str());
+            return;
+        }
+
+        m_captureStream = AZStd::move(captureStream);
+        m_loadedChunks.clear();
+        m_loadedChunkIndices.clear();
+        ClearLoadedData();
+        m_ticksPerSecondFromFile = m_captureStream->GetTicksPerSecond();
+
+        // Start at the end of the capture like for regular captures, the chunks are loaded once the viewport is known.
+        const CpuProfilerCaptureStreamReader::ChunkInfo& lastChunk = m_captureStream->GetChunks().back();
+        m_viewportEndTick = lastChunk.m_endTick + ProfilerViewEdgePadding;
+        m_viewportStartTick = AZStd::max(lastChunk.m_startTick, lastChunk.m_endTick - m_ticksPerSecondFromFile / 30) - ProfilerViewEdgePadding;
+
+        UpdateStreamedCapture();
+
+        AZ_TracePrintf("ImGuiCpuProfiler", "Opened streamed capture %s with %zu chunks.\n", resolvedPath, m_captureStream->GetChunks().size());
+    }
+
+    void ImGuiCpuProfiler::UpdateStreamedCapture()
+    {
+        // Load a viewport width on both sides, so moving around doesn't need to load new chunks right away. When zoomed out a lot,
+        // only the chunks closest to the center of the viewport are kept.
+        constexpr size_t MaxLoadedChunks = 16;
+        const AZStd::sys_time_t viewportWidth = GetViewportTickWidth();
+        AZStd::vector<size_t> chunkIndices =
+            m_captureStream->GetChunksInRange(m_viewportStartTick - viewportWidth, m_viewportEndTick + viewportWidth);
+        if (chunkIndices.size() > MaxLoadedChunks)
+        {
+            const AZStd::sys_time_t viewportCenter = m_viewportStartTick + viewportWidth / 2;
+            const auto& chunks = m_captureStream->GetChunks();
+            auto centerItr = AZStd::lower_bound(chunkIndices.begin(), chunkIndices.end(), viewportCenter,
+                [&chunks](size_t chunkIndex, AZStd::sys_time_t tick)
+                {
+                    return chunks[chunkIndex].m_endTick < tick;
+                });
+            const size_t first = AZStd::min(
+                aznumeric_cast<size_t>(AZStd::max<ptrdiff_t>(centerItr - chunkIndices.begin() - static_cast<ptrdiff_t>(MaxLoadedChunks / 2), 0)),
+                chunkIndices.size() - MaxLoadedChunks);
+            chunkIndices.erase(chunkIndices.begin() + first + MaxLoadedChunks, chunkIndices.end());
+            chunkIndices.erase(chunkIndices.begin(), chunkIndices.begin() + first);
+        }
+
+        if (chunkIndices == m_loadedChunkIndices)
+        {
+            return;
+        }
+
+        AZStd::erase_if(m_loadedChunks,
+            [&chunkIndices](const auto& loadedChunk)
+            {
+                return AZStd::find(chunkIndices.begin(), chunkIndices.end(), loadedChunk.first) == chunkIndices.end();
+            });
+
+        for (size_t chunkIndex : chunkIndices)
+        {
+            if (!m_loadedChunks.contains(chunkIndex))
+            {
+                auto readResult = m_captureStream->ReadChunk(chunkIndex);
+                if (!readResult.IsSuccess())
+                {
+                    AZ_TracePrintf("ImGuiCpuProfiler", "%s\n", readResult.GetError().c_str());
+                    continue;
+                }
+                m_loadedChunks.emplace(chunkIndex, readResult.TakeValue());
+            }
+        }
+
+        // The visualizer expects the data of all threads in a single sorted list, so it's rebuilt from the loaded chunks.
+        // This only happens when the viewport moves to other chunks.
+        ClearLoadedData();
+        for (size_t chunkIndex : chunkIndices)
+        {
+            if (auto loadedChunk = m_loadedChunks.find(chunkIndex); loadedChunk != m_loadedChunks.end())
+            {
+                AddLoadedEntries(loadedChunk->second);
+            }
+        }
+
+        // The timeline needs a frame boundary to draw to.
+        if (m_frameEndTicks.empty())
+        {
+            m_frameEndTicks.push_back(m_captureStream->GetChunks()[chunkIndices.empty() ? 0 : chunkIndices.back()].m_endTick);
+        }
+
+        SortLoadedData();
+        m_loadedChunkIndices = AZStd::move(chunkIndices);
+    }
+
+    void ImGuiCpuProfiler::ClearLoadedData()
+    {
         // Clear visualizer and statistics view state
-        m_savedRegionCount = deserializedData.size();
+        m_savedRegionCount = 0;
         m_savedData.clear();
         m_paused = true;
 
@@ -478,15 +607,19 @@ namespace Profiler
 
         m_tableData.clear();
         m_groupRegionMap.clear();
+    }
 
-        m_ticksPerSecondFromFile = serializer.m_timeTicksPerSecond;
+    AZStd::sys_time_t ImGuiCpuProfiler::AddLoadedEntries(
+        const AZStd::vector<CpuProfilingStatisticsSerializer::CpuProfilingStatisticsSerializerEntry>& entries)
+    {
+        m_savedRegionCount += entries.size();
 
         // Since we don't serialize the frame boundaries, we will use "Component application tick" from
         // ComponentApplication::TickSystem as a heuristic.
         static const AZ::Name::Hash frameBoundaryHash = AZ::Name("Component application tick").GetHash();
         
         AZStd::sys_time_t frameTime = 0;
-        for (const auto& entry : deserializedData)
+        for (const auto& entry : entries)
         {
             const auto [groupNameItr, wasGroupNameInserted] = m_deserializedStringPool.emplace(entry.m_groupName.GetStringView());
             const auto [regionNameItr, wasRegionNameInserted] = m_deserializedStringPool.emplace(entry.m_regionName.GetStringView());
@@ -519,10 +652,11 @@ namespace Profiler
             m_groupRegionMap[*groupNameItr][*regionNameItr].RecordRegion(newRegion, entry.m_threadId);
         }
 
-        // Update viewport bounds to the estimated final frame time with some padding
-        m_viewportStartTick = m_frameEndTicks.back() - frameTime - ProfilerViewEdgePadding;
-        m_viewportEndTick = m_frameEndTicks.back() + ProfilerViewEdgePadding;
+        return frameTime;
+    }
 
+    void ImGuiCpuProfiler::SortLoadedData()
+    {
         // Invariant: each vector in m_savedData must be sorted so that we can efficiently cull region data.
         for (auto& [threadId, singleThreadData] : m_savedData)
         {
@@ -532,6 +666,7 @@ namespace Profiler
                 return lhs.m_startTick < rhs.m_startTick;
             });
         }
+        AZStd::sort(m_frameEndTicks.begin(), m_frameEndTicks.end());
     }
 
     // -- CPU Visualizer --
@@ -540,6 +675,11 @@ namespace Profiler
     {
         DrawCommonHeader();
 
+        if (m_captureStream)
+        {
+            UpdateStreamedCapture();
+        }
+
         // Options & Statistics
         if (ImGui::BeginChild("Options and Statistics", { 0, 0 }, true))
         {
@@ -549,6 +689,21 @@ namespace Profiler
             ImGui::SliderInt("Saved Frames", &m_framesToCollect, MinSavableFrameCount, MaxSavableFrameCount, "%d", ImGuiSliderFlags_AlwaysClamp | ImGuiSliderFlags_Logarithmic);
             m_visualizerHighlightFilter.Draw("Find Region");
 
+            // Dragging through an hour long capture takes too long, so streamed captures can be navigated by time.
+            if (m_captureStream)
+            {
+                const AZStd::sys_time_t captureStartTick = m_captureStream->GetStartTick();
+                const AZStd::sys_time_t viewportWidth = GetViewportTickWidth();
+                const double ticksPerSecond = static_cast<double>(m_captureStream->GetTicksPerSecond());
+                float captureTimeSeconds = static_cast<float>((m_viewportStartTick + viewportWidth / 2 - captureStartTick) / ticksPerSecond);
+                const float captureDurationSeconds = static_cast<float>((m_captureStream->GetEndTick() - captureStartTick) / ticksPerSecond);
+                if (ImGui::SliderFloat("Capture Time (s)", &captureTimeSeconds, 0.0f, captureDurationSeconds, "%.2f", ImGuiSliderFlags_AlwaysClamp))
+                {
+                    m_viewportStartTick = captureStartTick + aznumeric_cast<AZStd::sys_time_t>(captureTimeSeconds * ticksPerSecond) - viewportWidth / 2;
+                    m_viewportEndTick = m_viewportStartTick + viewportWidth;
+                }
+            }
+
             // estimate the number of frames required to fulfill the update frequency
             const AZ::TimeMs deltaMs = AZ::TimeUsToMs(AZ::GetRealTickDeltaTimeUs());
             const int estimatedFrameCountPadding = 5; // padding is necessary to prevent flashes of blank frames
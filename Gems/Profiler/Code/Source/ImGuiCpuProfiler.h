@@ -11,6 +11,7 @@
 #if defined(IMGUI_ENABLED)
 
 #include <CpuProfiler.h>
+#include <CpuProfilerCaptureStream.h>
 
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/IO/Path/Path.h>
@@ -18,6 +19,7 @@
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/set.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Time/ITime.h>
 
 #include <imgui/imgui.h>
@@ -116,6 +118,22 @@ namespace Profiler
         //! Callback invoked when the "Load File" button is pressed in the file picker.
         void LoadFile();
 
+        //! Opens a capture written by a streaming capture, its chunks are loaded by UpdateStreamedCapture.
+        void LoadStreamedFile(const AZ::IO::Path& pathToLoad);
+
+        //! Loads the chunks of the streamed capture around the viewport and unloads the others.
+        void UpdateStreamedCapture();
+
+        //! Clears the visualizer and statistics view state before showing loaded data.
+        void ClearLoadedData();
+
+        //! Adds loaded regions to the visualizer and statistics view state.
+        //! @returns the duration of the last frame in the entries, or 0 if they don't contain a frame boundary.
+        AZStd::sys_time_t AddLoadedEntries(const AZStd::vector<CpuProfilingStatisticsSerializer::CpuProfilingStatisticsSerializerEntry>& entries);
+
+        //! Restores the sorted order of the visualizer data after entries were added.
+        void SortLoadedData();
+
         //! Draws the file picker window.
         void DrawFilePicker();
 
@@ -246,6 +264,12 @@ namespace Profiler
         AZStd::sys_time_t m_ticksPerSecondFromFile = 0;
 
         // --- Loading capture state ---
+
+        // Streamed capture that is being viewed, its chunks are only kept in memory while they are near the viewport.
+        AZStd::unique_ptr<CpuProfilerCaptureStreamReader> m_captureStream;
+        AZStd::unordered_map<size_t, AZStd::vector<CpuProfilingStatisticsSerializer::CpuProfilingStatisticsSerializerEntry>> m_loadedChunks;
+        AZStd::vector<size_t> m_loadedChunkIndices;
+
         AZStd::unordered_set<AZStd::string> m_deserializedStringPool;
         AZStd::unordered_set<CachedTimeRegion::GroupRegionName, CachedTimeRegion::GroupRegionName::Hash> m_deserializedGroupRegionNamePool;
     };
@@ -8,12 +8,17 @@
 
 #include <ProfilerSystemComponent.h>
 
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/Json/JsonSerializationSettings.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/time.h>
 
 namespace Profiler
 {
@@ -143,12 +148,39 @@ namespace Profiler
 
     void ProfilerSystemComponent::Activate()
     {
-        m_cpuProfiler.Init();
+        m_useRingBufferProfiler = false;
+        m_useStreamingCapture = false;
+        AZ::u64 eventsPerThread = RingBufferProfiler::DefaultEventsPerThread;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            settingsRegistry->Get(m_useRingBufferProfiler, RingBufferProfilerEnabledKey);
+            settingsRegistry->Get(eventsPerThread, RingBufferProfilerEventsPerThreadKey);
+            settingsRegistry->Get(m_useStreamingCapture, StreamingCaptureEnabledKey);
+        }
+
+        if (m_useRingBufferProfiler)
+        {
+            m_ringBufferProfiler.Init(aznumeric_cast<AZ::u32>(AZStd::clamp<AZ::u64>(eventsPerThread, 1, 1u << 24)));
+            m_budgetSpikeMonitor.Init(
+                [this](const AZStd::string& outputFilePath, AZStd::sys_time_t sinceTick)
+                {
+                    return SerializeRingBufferCapture(outputFilePath, sinceTick);
+                });
+        }
+        else
+        {
+            m_cpuProfiler.Init();
+            // The CpuProfiler only keeps data while a capture is in progress, so spikes are only reported.
+            m_budgetSpikeMonitor.Init({});
+        }
     }
 
     void ProfilerSystemComponent::Deactivate()
     {
+        m_budgetSpikeMonitor.Shutdown();
         m_cpuProfiler.Shutdown();
+        m_ringBufferProfiler.Shutdown();
+        m_ringBufferCaptureStartTick.store(0);
 
         // Block deactivation until the IO thread has finished serializing the CPU data
         if (m_cpuDataSerializationThread.joinable())
@@ -159,16 +191,31 @@ namespace Profiler
 
     bool ProfilerSystemComponent::IsActive() const
     {
+        if (m_useRingBufferProfiler)
+        {
+            return m_ringBufferProfiler.IsProfilerEnabled();
+        }
         return m_cpuProfiler.IsProfilerEnabled();
     }
 
     void ProfilerSystemComponent::SetActive(bool enabled)
     {
+        if (m_useRingBufferProfiler)
+        {
+            m_ringBufferProfiler.SetProfilerEnabled(enabled);
+            return;
+        }
         m_cpuProfiler.SetProfilerEnabled(enabled);
     }
 
     bool ProfilerSystemComponent::CaptureFrame(const AZStd::string& outputFilePath)
     {
+        // The ring buffer profiler has no frames, so everything that is still in its buffers is written.
+        if (m_useRingBufferProfiler)
+        {
+            return SerializeRingBufferCapture(outputFilePath, 0);
+        }
+
         bool expected = false;
         if (!m_cpuCaptureInProgress.compare_exchange_strong(expected, true))
         {
@@ -200,12 +247,55 @@ namespace Profiler
 
     bool ProfilerSystemComponent::StartCapture(AZStd::string outputFilePath)
     {
+        if (m_useRingBufferProfiler)
+        {
+            // The regions are already being recorded, so the capture only remembers where it started. Regions that are
+            // overwritten before the capture ends are missing from it.
+            AZStd::sys_time_t expected = 0;
+            if (!m_ringBufferCaptureStartTick.compare_exchange_strong(expected, AZStd::GetTimeNowTicks()))
+            {
+                AZ_TracePrintf("ProfilerSystemComponent", "Attempting to start a continuous capture while one already in progress\n");
+                return false;
+            }
+            m_captureFile = AZStd::move(outputFilePath);
+            m_ringBufferProfiler.SetProfilerEnabled(true);
+            return true;
+        }
+
         m_captureFile = AZStd::move(outputFilePath);
+        if (m_useStreamingCapture)
+        {
+            AZ::IO::Path streamFilePath(m_captureFile);
+            streamFilePath.ReplaceExtension(StreamingCaptureExtension);
+            m_captureFile = streamFilePath.Native();
+            return m_cpuProfiler.BeginStreamingCapture(m_captureFile);
+        }
         return m_cpuProfiler.BeginContinuousCapture();
     }
 
     bool ProfilerSystemComponent::EndCapture()
     {
+        if (m_useRingBufferProfiler)
+        {
+            const AZStd::sys_time_t startTick = m_ringBufferCaptureStartTick.load();
+            if (startTick == 0)
+            {
+                AZ_TracePrintf("ProfilerSystemComponent", "Could not end the continuous capture, is one in progress?\n");
+                return false;
+            }
+            if (!SerializeRingBufferCapture(m_captureFile, startTick))
+            {
+                return false;
+            }
+            m_ringBufferCaptureStartTick.store(0);
+            return true;
+        }
+
+        if (m_cpuProfiler.IsStreamingCaptureInProgress())
+        {
+            return EndStreamingCapture();
+        }
+
         bool expected = false;
         if (!m_cpuDataSerializationInProgress.compare_exchange_strong(expected, true))
         {
@@ -247,6 +337,66 @@ namespace Profiler
 
     bool ProfilerSystemComponent::IsCaptureInProgress() const
     {
+        if (m_useRingBufferProfiler)
+        {
+            return m_ringBufferCaptureStartTick.load() != 0;
+        }
         return m_cpuProfiler.IsContinuousCaptureInProgress();
     }
+
+    bool ProfilerSystemComponent::EndStreamingCapture()
+    {
+        // Only the frames that are still queued are written here, the rest of the capture is already on disk.
+        const bool wroteAllFrames = m_cpuProfiler.EndStreamingCapture();
+
+        AZStd::string captureInfo = m_captureFile;
+        if (!wroteAllFrames)
+        {
+            captureInfo = AZStd::string::format("Cpu profiling capture '%s' is incomplete, not all frames could be written",
+                m_captureFile.c_str());
+            AZ_Warning("ProfilerSystemComponent", false, captureInfo.c_str());
+        }
+        else
+        {
+            AZ_Printf("ProfilerSystemComponent", "Cpu profiling capture was streamed to file [%s]\n", m_captureFile.c_str());
+        }
+
+        AZ::Debug::ProfilerNotificationBus::Broadcast(&AZ::Debug::ProfilerNotificationBus::Events::OnCaptureFinished,
+            wroteAllFrames,
+            captureInfo);
+        return true;
+    }
+
+    bool ProfilerSystemComponent::SerializeRingBufferCapture(const AZStd::string& outputFilePath, AZStd::sys_time_t sinceTick)
+    {
+        bool expected = false;
+        if (!m_cpuDataSerializationInProgress.compare_exchange_strong(expected, true))
+        {
+            AZ_TracePrintf(
+                "ProfilerSystemComponent",
+                "Cannot write the ring buffer capture - another serialization is currently in progress\n");
+            return false;
+        }
+
+        // Collecting only copies the buffers, so it's done right away to keep the regions from being overwritten.
+        AZStd::ring_buffer<TimeRegionMap> captureResult(1);
+        TimeRegionMap timeRegionMap;
+        m_ringBufferProfiler.CollectTimeRegions(timeRegionMap, sinceTick);
+        captureResult.push_back(AZStd::move(timeRegionMap));
+
+        auto threadIoFunction =
+            [data = AZStd::move(captureResult), filePath = outputFilePath, &flag = m_cpuDataSerializationInProgress]()
+            {
+                SerializeCpuProfilingData(data, filePath, true);
+                flag.store(false);
+            };
+
+        if (m_cpuDataSerializationThread.joinable())
+        {
+            m_cpuDataSerializationThread.join();
+        }
+        m_cpuDataSerializationThread = AZStd::thread(threadIoFunction);
+
+        return true;
+    }
 } // namespace Profiler
@@ -8,7 +8,10 @@
 
 #pragma once
 
+#include <BudgetSpikeMonitor.h>
 #include <CpuProfiler.h>
+#include <CpuProfilerCaptureStream.h>
+#include <RingBufferProfiler.h>
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Debug/ProfilerBus.h>
@@ -46,6 +49,11 @@ namespace Profiler
         bool EndCapture() override;
         bool IsCaptureInProgress() const override;
 
+        // Ends the streaming capture of the CpuProfiler and notifies the listeners.
+        bool EndStreamingCapture();
+
+        // Collects the regions recorded by the ring buffer profiler since the tick and writes them on the IO thread.
+        bool SerializeRingBufferCapture(const AZStd::string& outputFilePath, AZStd::sys_time_t sinceTick);
 
         AZStd::thread m_cpuDataSerializationThread;
         AZStd::atomic_bool m_cpuDataSerializationInProgress{ false };
@@ -54,6 +62,19 @@ namespace Profiler
 
         CpuProfiler m_cpuProfiler;
         AZStd::string m_captureFile;
+
+        // Continuous captures of the CpuProfiler are streamed to disk when enabled through the StreamingCaptureEnabledKey setting.
+        bool m_useStreamingCapture = false;
+
+        // Used instead of the CpuProfiler when enabled through the RingBufferProfilerEnabledKey setting. The choice is made
+        // on activation, as the profiler is looked up once by the first profiled region.
+        RingBufferProfiler m_ringBufferProfiler;
+        bool m_useRingBufferProfiler = false;
+        // Start of the continuous capture of the ring buffer profiler, 0 while no capture is in progress.
+        AZStd::atomic<AZStd::sys_time_t> m_ringBufferCaptureStartTick{ 0 };
+
+        // Writes the last frames of the ring buffer profiler when a frame or budget exceeds its threshold.
+        BudgetSpikeMonitor m_budgetSpikeMonitor;
     };
 
 } // namespace Profiler
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <RingBufferProfiler.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/time.h>
+
+namespace Profiler
+{
+    thread_local RingBufferProfiler::ThreadBuffer* RingBufferProfiler::ms_threadBuffer = nullptr;
+    thread_local AZ::u32 RingBufferProfiler::ms_threadBufferGeneration = 0;
+    AZStd::atomic<AZ::u32> RingBufferProfiler::s_nextGeneration{ 1 };
+
+    void RingBufferProfiler::Init(AZ::u32 eventsPerThread)
+    {
+        AZ_Assert(!m_initialized, "The RingBufferProfiler is already initialized.");
+
+        AZ::u32 capacity = 1;
+        while (capacity < eventsPerThread && capacity < (1u << 31))
+        {
+            capacity <<= 1;
+        }
+
+        // Threads that are still recording from a previous initialization keep using the existing buffers, so they're only
+        // reallocated when their size changes.
+        if (!m_events || capacity != m_eventsPerThread)
+        {
+            m_eventsPerThread = capacity;
+            m_events = AZStd::make_unique<Event[]>(static_cast<size_t>(MaxThreads) * capacity);
+            m_threadBuffers = AZStd::make_unique<ThreadBuffer[]>(MaxThreads);
+        }
+        for (AZ::u32 i = 0; i < MaxThreads; ++i)
+        {
+            m_threadBuffers[i].m_events = m_events.get() + static_cast<size_t>(i) * capacity;
+            m_threadBuffers[i].m_writeIndex.store(0);
+        }
+        m_claimedThreadBuffers.store(0);
+        m_generation = s_nextGeneration.fetch_add(1);
+
+        AZ::Interface<AZ::Debug::Profiler>::Register(this);
+        m_initialized = true;
+        m_enabled = true;
+    }
+
+    void RingBufferProfiler::Shutdown()
+    {
+        if (!m_initialized)
+        {
+            return;
+        }
+
+        AZ::Interface<AZ::Debug::Profiler>::Unregister(this);
+        m_enabled = false;
+        m_initialized = false;
+    }
+
+    void RingBufferProfiler::BeginRegion(
+        const AZ::Debug::Budget* budget, const char* eventName, [[maybe_unused]] size_t eventNameArgCount, ...)
+    {
+        if (m_enabled.load(AZStd::memory_order_relaxed))
+        {
+            RecordEvent(budget, eventName);
+        }
+    }
+
+    void RingBufferProfiler::EndRegion(const AZ::Debug::Budget* budget)
+    {
+        // Regions that are open while the profiler is enabled or disabled are dropped or paired with the wrong begin when
+        // the events are collected.
+        if (m_enabled.load(AZStd::memory_order_relaxed))
+        {
+            RecordEvent(budget, nullptr);
+        }
+    }
+
+    void RingBufferProfiler::SetProfilerEnabled(bool enabled)
+    {
+        m_enabled = enabled;
+    }
+
+    bool RingBufferProfiler::IsProfilerEnabled() const
+    {
+        return m_enabled;
+    }
+
+    RingBufferProfiler::ThreadBuffer* RingBufferProfiler::GetThreadBuffer()
+    {
+        if (ms_threadBufferGeneration == m_generation)
+        {
+            return ms_threadBuffer;
+        }
+
+        // The generation is updated even if no buffer is left, so the thread doesn't try again on every event.
+        ms_threadBufferGeneration = m_generation;
+        ms_threadBuffer = nullptr;
+        const AZ::u32 index = m_claimedThreadBuffers.fetch_add(1, AZStd::memory_order_relaxed);
+        if (index < MaxThreads)
+        {
+            ms_threadBuffer = &m_threadBuffers[index];
+            ms_threadBuffer->m_threadId = AZStd::this_thread::get_id();
+        }
+        return ms_threadBuffer;
+    }
+
+    void RingBufferProfiler::RecordEvent(const AZ::Debug::Budget* budget, const char* eventName)
+    {
+        ThreadBuffer* threadBuffer = GetThreadBuffer();
+        if (threadBuffer == nullptr)
+        {
+            return;
+        }
+
+        const AZ::u64 writeIndex = threadBuffer->m_writeIndex.load(AZStd::memory_order_relaxed);
+        Event& event = threadBuffer->m_events[writeIndex & (m_eventsPerThread - 1)];
+        event.m_tick = AZStd::GetTimeNowTicks();
+        event.m_budget = budget;
+        event.m_eventName = eventName;
+        threadBuffer->m_writeIndex.store(writeIndex + 1, AZStd::memory_order_release);
+    }
+
+    void RingBufferProfiler::CollectTimeRegions(TimeRegionMap& timeRegionMap, AZStd::sys_time_t sinceTick) const
+    {
+        if (!m_threadBuffers)
+        {
+            return;
+        }
+
+        AZStd::vector<Event> events;
+        AZStd::vector<const Event*> regionStack;
+        const AZ::u32 threadCount = AZStd::min(m_claimedThreadBuffers.load(AZStd::memory_order_acquire), MaxThreads);
+        for (AZ::u32 threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            const ThreadBuffer& threadBuffer = m_threadBuffers[threadIndex];
+
+            // Copy the events first, as the thread keeps overwriting its oldest events while they're read.
+            const AZ::u64 endIndex = threadBuffer.m_writeIndex.load(AZStd::memory_order_acquire);
+            const AZ::u64 beginIndex = endIndex > m_eventsPerThread ? endIndex - m_eventsPerThread : 0;
+            events.resize_no_construct(aznumeric_cast<size_t>(endIndex - beginIndex));
+            for (AZ::u64 index = beginIndex; index < endIndex; ++index)
+            {
+                events[aznumeric_cast<size_t>(index - beginIndex)] = threadBuffer.m_events[index & (m_eventsPerThread - 1)];
+            }
+
+            // Drop the events that were overwritten during the copy, including the slot of the event that is being written.
+            const AZ::u64 writeIndexAfterCopy = threadBuffer.m_writeIndex.load(AZStd::memory_order_acquire);
+            AZ::u64 firstValidIndex = beginIndex;
+            if (writeIndexAfterCopy + 1 > m_eventsPerThread)
+            {
+                firstValidIndex = AZStd::max(firstValidIndex, writeIndexAfterCopy + 1 - m_eventsPerThread);
+            }
+            if (firstValidIndex >= endIndex)
+            {
+                continue;
+            }
+
+            // Pair the begins and ends of the regions. Ends without a begin belong to regions that started before the oldest
+            // event, so the depths are relative to the oldest region that is still open.
+            ThreadTimeRegionMap& threadRegionMap = timeRegionMap[threadBuffer.m_threadId];
+            regionStack.clear();
+            for (size_t i = aznumeric_cast<size_t>(firstValidIndex - beginIndex); i < events.size(); ++i)
+            {
+                const Event& event = events[i];
+                if (event.m_eventName != nullptr)
+                {
+                    regionStack.push_back(&event);
+                    continue;
+                }
+                if (regionStack.empty())
+                {
+                    continue;
+                }
+
+                const Event& begin = *regionStack.back();
+                regionStack.pop_back();
+                if (begin.m_tick < sinceTick)
+                {
+                    continue;
+                }
+
+                CachedTimeRegion timeRegion(
+                    CachedTimeRegion::GroupRegionName(begin.m_budget->Name(), begin.m_eventName),
+                    aznumeric_cast<uint16_t>(regionStack.size()), begin.m_tick, event.m_tick);
+                threadRegionMap[begin.m_eventName].push_back(AZStd::move(timeRegion));
+            }
+        }
+    }
+} // namespace Profiler
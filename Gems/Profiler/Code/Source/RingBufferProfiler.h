@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <CpuProfiler.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace Profiler
+{
+    //! Setting that makes the ProfilerSystemComponent use the RingBufferProfiler instead of the CpuProfiler.
+    inline constexpr const char* RingBufferProfilerEnabledKey = "/O3DE/Profiler/RingBuffer/Enabled";
+    //! Setting for the number of events every thread keeps, rounded up to a power of two.
+    inline constexpr const char* RingBufferProfilerEventsPerThreadKey = "/O3DE/Profiler/RingBuffer/EventsPerThread";
+
+    //! Lightweight profiler that is cheap enough to stay enabled on live servers.
+    //! Every thread records the begins and ends of its regions into its own fixed size ring buffer, which only keeps the most
+    //! recent events. Recording doesn't lock or allocate, all buffers are allocated by Init and an event only stores a
+    //! timestamp and the budget and event name pointers. The format arguments of event names are ignored.
+    //! NOTE: The event names need to stay valid until the events are collected, which is the case for string literals.
+    class RingBufferProfiler final
+        : public AZ::Debug::Profiler
+    {
+    public:
+        AZ_RTTI(RingBufferProfiler, "{965CE745-A7A2-4E11-9011-D01CC7CB5242}", AZ::Debug::Profiler);
+        AZ_CLASS_ALLOCATOR(RingBufferProfiler, AZ::SystemAllocator);
+
+        //! Threads that record their first event after all buffers are in use aren't profiled.
+        static constexpr AZ::u32 MaxThreads = 64;
+        static constexpr AZ::u32 DefaultEventsPerThread = 8192;
+
+        RingBufferProfiler() = default;
+        ~RingBufferProfiler() = default;
+
+        //! Allocates the ring buffers and registers/un-registers the AZ::Debug::Profiler instance to the interface.
+        //! The buffers are kept until the profiler is destroyed, as threads can still be recording while it shuts down.
+        //! The profiler starts recording once it's initialized.
+        void Init(AZ::u32 eventsPerThread = DefaultEventsPerThread);
+        void Shutdown();
+
+        //! AZ::Debug::Profiler overrides...
+        void BeginRegion(const AZ::Debug::Budget* budget, const char* eventName, size_t eventNameArgCount, ...) final override;
+        void EndRegion(const AZ::Debug::Budget* budget) final override;
+
+        //! Getter/setter for the profiler active state
+        void SetProfilerEnabled(bool enabled);
+        bool IsProfilerEnabled() const;
+
+        //! Converts the events that are still in the ring buffers into time regions, keeping the regions that started at or
+        //! after sinceTick. Regions that started before the oldest event of their thread are dropped.
+        //! Can be called from any thread while the other threads keep recording.
+        void CollectTimeRegions(TimeRegionMap& timeRegionMap, AZStd::sys_time_t sinceTick = 0) const;
+
+    private:
+        struct Event
+        {
+            AZStd::sys_time_t m_tick;
+            const AZ::Debug::Budget* m_budget;
+            //! Null for the end of a region.
+            const char* m_eventName;
+        };
+
+        // Aligned to a cache line, so threads don't share the cache line of their write index.
+        struct alignas(64) ThreadBuffer
+        {
+            Event* m_events = nullptr;
+            //! Total number of events the thread recorded. Only written by the owning thread, and released after the event is
+            //! written.
+            AZStd::atomic<AZ::u64> m_writeIndex{ 0 };
+            AZStd::thread_id m_threadId;
+        };
+
+        // Returns the buffer of the calling thread, claiming one on its first event. Returns null if all buffers are in use.
+        ThreadBuffer* GetThreadBuffer();
+        void RecordEvent(const AZ::Debug::Budget* budget, const char* eventName);
+
+        AZStd::unique_ptr<Event[]> m_events;
+        AZStd::unique_ptr<ThreadBuffer[]> m_threadBuffers;
+        AZStd::atomic<AZ::u32> m_claimedThreadBuffers{ 0 };
+        AZ::u32 m_eventsPerThread = 0;
+
+        // Incremented by every Init, so threads claim new buffers after the profiler was re-initialized.
+        AZ::u32 m_generation = 0;
+        static thread_local ThreadBuffer* ms_threadBuffer;
+        static thread_local AZ::u32 ms_threadBufferGeneration;
+        static AZStd::atomic<AZ::u32> s_nextGeneration;
+
+        AZStd::atomic_bool m_enabled = false;
+        bool m_initialized = false;
+    };
+} // namespace Profiler
@@ -8,8 +8,14 @@
 
 set(FILES
     Include/Profiler/ProfilerImGuiBus.h
+    Source/BudgetSpikeMonitor.cpp
+    Source/BudgetSpikeMonitor.h
     Source/CpuProfiler.h
     Source/CpuProfiler.cpp
+    Source/CpuProfilerCaptureStream.cpp
+    Source/CpuProfilerCaptureStream.h
     Source/ProfilerSystemComponent.cpp
     Source/ProfilerSystemComponent.h
+    Source/RingBufferProfiler.cpp
+    Source/RingBufferProfiler.h
 )
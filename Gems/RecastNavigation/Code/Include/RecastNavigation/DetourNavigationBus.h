@@ -38,8 +38,58 @@ namespace RecastNavigation
         //! @param toWorldPosition The end point of the path to find.
         //! @return If a path is found, returns a vector of waypoints. An empty vector is returned if a path was not found.
         virtual AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) = 0;
+
+        //! Queues a request to find a walkable path between two entities. Many queued requests are spread over several ticks,
+        //! so they don't stall a frame. The positions of the entities are taken when the request is queued.
+        //! The result is sent with @DetourNavigationNotifications::OnPathFound.
+        //! @param fromEntity The starting point of the path from the position of this entity.
+        //! @param toEntity The end point of the path is at the position of this entity.
+        //! @return an id that identifies the request in @DetourNavigationNotifications::OnPathFound, 0 if the request wasn't queued.
+        virtual AZ::u64 FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity) = 0;
+
+        //! Queues a request to find a walkable path between two world positions. Many queued requests are spread over several ticks,
+        //! so they don't stall a frame. The result is sent with @DetourNavigationNotifications::OnPathFound.
+        //! @param fromWorldPosition The starting point of the path.
+        //! @param toWorldPosition The end point of the path to find.
+        //! @return an id that identifies the request in @DetourNavigationNotifications::OnPathFound, 0 if the request wasn't queued.
+        virtual AZ::u64 FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) = 0;
     };
 
     //! Request EBus for a path finding component.
     using DetourNavigationRequestBus = AZ::EBus<DetourNavigationRequests>;
+
+    //! The interface for notification API of @DetourNavigationNotificationBus.
+    class DetourNavigationNotifications
+        : public AZ::ComponentBus
+    {
+    public:
+        //! Notifies when a queued path request has been processed.
+        //! @param pathfinderEntity the entity with the path finding component. This is helpful for Script Canvas use.
+        //! @param requestId the id returned when the request was queued
+        //! @param path waypoints of the path, empty if a path was not found
+        virtual void OnPathFound(AZ::EntityId pathfinderEntity, AZ::u64 requestId, const AZStd::vector<AZ::Vector3>& path) = 0;
+    };
+
+    //! Notification EBus for a path finding component.
+    using DetourNavigationNotificationBus = AZ::EBus<DetourNavigationNotifications>;
+
+    //! Scripting reflection helper for @DetourNavigationNotificationBus.
+    class DetourNavigationNotificationHandler
+        : public DetourNavigationNotificationBus::Handler
+        , public AZ::BehaviorEBusHandler
+    {
+    public:
+        AZ_EBUS_BEHAVIOR_BINDER(DetourNavigationNotificationHandler,
+            "{5A3B7E61-8C2D-4F1A-9D6E-2B4C8A7F3E19}",
+            AZ::SystemAllocator, OnPathFound);
+
+        //! Notifies when a queued path request has been processed.
+        //! @param pathfinderEntity the entity with the path finding component.
+        //! @param requestId the id returned when the request was queued
+        //! @param path waypoints of the path, empty if a path was not found
+        void OnPathFound(AZ::EntityId pathfinderEntity, AZ::u64 requestId, const AZStd::vector<AZ::Vector3>& path) override
+        {
+            Call(FN_OnPathFound, pathfinderEntity, requestId, path);
+        }
+    };
 } // namespace RecastNavigation
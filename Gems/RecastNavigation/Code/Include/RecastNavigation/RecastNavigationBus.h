@@ -8,8 +8,10 @@
 
 #pragma once
 
+#include <AzCore/Component/EntityId.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Vector3.h>
 
 namespace RecastNavigation
 {
@@ -18,6 +20,15 @@ namespace RecastNavigation
     public:
         AZ_RTTI(RecastNavigationRequests, "{d1c2f552-287d-4aa1-a5b8-5b234c9106f3}");
         virtual ~RecastNavigationRequests() = default;
+
+        //! Queues a path request. Queued requests are processed on the main thread over the following ticks,
+        //! limited by a time budget per tick, and the result is sent with @DetourNavigationNotificationBus.
+        //! @param pathfinderEntity the entity with @DetourNavigationComponent that finds the path and receives the result
+        //! @param requestId identifies the request in @DetourNavigationNotifications::OnPathFound
+        //! @param fromWorldPosition The starting point of the path.
+        //! @param toWorldPosition The end point of the path to find.
+        virtual void QueuePathRequest(AZ::EntityId pathfinderEntity, AZ::u64 requestId,
+            const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) = 0;
     };
 
     class RecastNavigationBusTraits
@@ -10,6 +10,7 @@
 
 #include <DetourNavMesh.h>
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Aabb.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <RecastNavigation/NavMeshQuery.h>
 #include <RecastNavigation/RecastSmartPointer.h>
@@ -29,6 +30,17 @@ namespace RecastNavigation
         //! @returns false if another update operation is already in progress
         virtual bool UpdateNavigationMeshAsync() = 0;
 
+        //! Re-calculates only the navigation mesh tiles affected by changes within @region, the rest of the navigation mesh is kept.
+        //! Use it to update the navigation mesh around geometry that was added, removed or moved at runtime. Blocking call.
+        //! @param region the world volume that has changed, for example the old and the new bounds of a moved collider
+        //! @returns false if another update operation is already in progress
+        virtual bool UpdateNavigationMeshInRegionBlockUntilCompleted(const AZ::Aabb& region) = 0;
+
+        //! Async variant of @UpdateNavigationMeshInRegionBlockUntilCompleted. Notifies when completed using @RecastNavigationMeshNotificationBus.
+        //! @param region the world volume that has changed
+        //! @returns false if another update operation is already in progress
+        virtual bool UpdateNavigationMeshInRegionAsync(const AZ::Aabb& region) = 0;
+
         //! @returns the underlying navigation objects with the associated synchronization object.
         virtual AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() = 0;
     };
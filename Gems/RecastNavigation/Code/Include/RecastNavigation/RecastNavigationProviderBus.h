@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Aabb.h>
 #include <RecastNavigation/RecastHelpers.h>
 
 namespace RecastNavigation
@@ -34,6 +35,24 @@ namespace RecastNavigation
         virtual bool CollectGeometryAsync(float tileSize, float borderSize,
             AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
 
+        //! Collects the geometry (triangles) of the tiles that are affected by changes within @region.
+        //! A tile is affected if its volume, extended by @borderSize, overlaps the region. Tile coordinates match @CollectGeometry.
+        //! @param tileSize A navigation mesh is made up of tiles. Each tile is a square of the same size.
+        //! @param borderSize An additional extent in each dimension around each tile.
+        //! @param region the world volume that has changed, for example the old and the new bounds of a moved collider
+        //! @returns a container with triangle data for each affected tile.
+        virtual AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometryWithinRegion(
+            float tileSize, float borderSize, const AZ::Aabb& region) = 0;
+
+        //! Async variant of @CollectGeometryWithinRegion. Tiles are returned the same way as with @CollectGeometryAsync.
+        //! @param tileSize A navigation mesh is made up of tiles. Each tile is a square of the same size.
+        //! @param borderSize An additional extent in each dimension around each tile.
+        //! @param region the world volume that has changed
+        //! @param tileCallback will be called once for each affected tile and one last time with an empty shared_ptr
+        //! @returns true if an async operation was scheduled, false otherwise
+        virtual bool CollectGeometryWithinRegionAsync(float tileSize, float borderSize, const AZ::Aabb& region,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
+
         //! A navigation mesh is made up of tiles. Each tile is a square of the same size.
         //! @param tileSize size of square tiles that make up a navigation mesh.
         //! @returns number of tiles that would be necessary to the cover the required area provided by @GetWorldBounds.
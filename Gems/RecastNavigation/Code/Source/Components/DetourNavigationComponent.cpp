@@ -11,6 +11,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <Components/DetourNavigationComponent.h>
 #include <RecastNavigation/RecastHelpers.h>
+#include <RecastNavigation/RecastNavigationBus.h>
 #include <RecastNavigation/RecastNavigationMeshBus.h>
 
 AZ_DECLARE_BUDGET(Navigation);
@@ -42,8 +43,13 @@ namespace RecastNavigation
                 ->Event("FindPathBetweenPositions", &DetourNavigationRequests::FindPathBetweenPositions)
                 ->Event("SetNavigationMeshEntity", &DetourNavigationRequests::SetNavigationMeshEntity)
                 ->Event("GetNavigationMeshEntity", &DetourNavigationRequests::GetNavigationMeshEntity)
+                ->Event("FindPathBetweenEntitiesAsync", &DetourNavigationRequests::FindPathBetweenEntitiesAsync)
+                ->Event("FindPathBetweenPositionsAsync", &DetourNavigationRequests::FindPathBetweenPositionsAsync)
                 ;
 
+            behaviorContext->EBus<DetourNavigationNotificationBus>("DetourNavigationNotificationBus")
+                ->Handler<DetourNavigationNotificationHandler>();
+
             behaviorContext->Class<DetourNavigationComponent>()->RequestBus("DetourNavigationRequestBus");
         }
     }
@@ -142,6 +148,33 @@ namespace RecastNavigation
         return pathPoints;
     }
 
+    AZ::u64 DetourNavigationComponent::FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity)
+    {
+        if (fromEntity.IsValid() && toEntity.IsValid())
+        {
+            AZ::Vector3 start = AZ::Vector3::CreateZero(), end = AZ::Vector3::CreateZero();
+            AZ::TransformBus::EventResult(start, fromEntity, &AZ::TransformBus::Events::GetWorldTranslation);
+            AZ::TransformBus::EventResult(end, toEntity, &AZ::TransformBus::Events::GetWorldTranslation);
+
+            return FindPathBetweenPositionsAsync(start, end);
+        }
+
+        return 0;
+    }
+
+    AZ::u64 DetourNavigationComponent::FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition)
+    {
+        RecastNavigationRequests* recastNavigation = RecastNavigationInterface::Get();
+        if (!recastNavigation)
+        {
+            return 0;
+        }
+
+        const AZ::u64 requestId = ++m_lastPathRequestId;
+        recastNavigation->QueuePathRequest(GetEntityId(), requestId, fromWorldPosition, toWorldPosition);
+        return requestId;
+    }
+
     void DetourNavigationComponent::SetNavigationMeshEntity(AZ::EntityId navMeshEntity)
     {
         m_navQueryEntityId = navMeshEntity;
@@ -34,6 +34,8 @@ namespace RecastNavigation
         //! @{
         AZStd::vector<AZ::Vector3> FindPathBetweenEntities(AZ::EntityId fromEntity, AZ::EntityId toEntity) override;
         AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) override;
+        AZ::u64 FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity) override;
+        AZ::u64 FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) override;
         void SetNavigationMeshEntity(AZ::EntityId navMeshEntity) override;
         AZ::EntityId GetNavigationMeshEntity() const override;
         //! @}
@@ -49,5 +51,7 @@ namespace RecastNavigation
         AZ::EntityId m_navQueryEntityId;
         //! Distance to use when finding nearest point on the navigation mesh when points provided to FindPath are outside of the navigation mesh.
         float m_nearestDistance = 3.f;
+        //! The id of the last queued path request.
+        AZ::u64 m_lastPathRequestId = 0;
     };
 } // namespace RecastNavigation
@@ -38,7 +38,9 @@ namespace RecastNavigation
                 ->Attribute(AZ::Script::Attributes::Module, "navigation")
                 ->Attribute(AZ::Script::Attributes::Category, "Recast Navigation")
                 ->Event("UpdateNavigationMesh", &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted)
-                ->Event("UpdateNavigationMeshAsync", &RecastNavigationMeshRequests::UpdateNavigationMeshAsync);
+                ->Event("UpdateNavigationMeshAsync", &RecastNavigationMeshRequests::UpdateNavigationMeshAsync)
+                ->Event("UpdateNavigationMeshInRegion", &RecastNavigationMeshRequests::UpdateNavigationMeshInRegionBlockUntilCompleted)
+                ->Event("UpdateNavigationMeshInRegionAsync", &RecastNavigationMeshRequests::UpdateNavigationMeshInRegionAsync);
 
             behaviorContext->Class<RecastNavigationMeshComponentController>()->RequestBus("RecastNavigationMeshRequestBus");
 
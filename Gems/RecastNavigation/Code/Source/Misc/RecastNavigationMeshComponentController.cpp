@@ -62,6 +62,24 @@ namespace RecastNavigation
     }
 
     bool RecastNavigationMeshComponentController::UpdateNavigationMeshBlockUntilCompleted()
+    {
+        AZ::Aabb worldVolume = AZ::Aabb::CreateNull();
+        RecastNavigationProviderRequestBus::EventResult(worldVolume, m_entityComponentIdPair.GetEntityId(),
+            &RecastNavigationProviderRequests::GetWorldBounds);
+
+        return UpdateNavigationMeshInRegionBlockUntilCompleted(worldVolume);
+    }
+
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshAsync()
+    {
+        AZ::Aabb worldVolume = AZ::Aabb::CreateNull();
+        RecastNavigationProviderRequestBus::EventResult(worldVolume, m_entityComponentIdPair.GetEntityId(),
+            &RecastNavigationProviderRequests::GetWorldBounds);
+
+        return UpdateNavigationMeshInRegionAsync(worldVolume);
+    }
+
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshInRegionBlockUntilCompleted(const AZ::Aabb& region)
     {
         bool notInProgress = false;
         if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
@@ -73,39 +91,30 @@ namespace RecastNavigation
 
         // Blocking call.
         RecastNavigationProviderRequestBus::EventResult(tiles, m_entityComponentIdPair.GetEntityId(),
-            &RecastNavigationProviderRequests::CollectGeometry,
-            m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize);
+            &RecastNavigationProviderRequests::CollectGeometryWithinRegion,
+            m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize, region);
 
         RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
             &RecastNavigationMeshNotificationBus::Events::OnNavigationMeshBeganRecalculating, m_entityComponentIdPair.GetEntityId());
 
+        if (!tiles.empty())
         {
+            AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshBlockUntilCompleted");
+
+            // Tiles are independent of each other, build them on the task executor and wait for all of them here.
+            m_taskGraph.Reset();
             for (AZStd::shared_ptr<TileGeometry>& tile : tiles)
             {
-                {
-                    NavMeshQuery::LockGuard lock(*m_navObject);
-                    // If a tile at the location already exists, remove it before updating the data.
-                    if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tile->m_tileX, tile->m_tileY, 0))
+                m_taskGraph.AddTask(
+                    m_taskDescriptor, [this, tile]()
                     {
-                        lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
-                    }
-                }
-
-                if (tile->IsEmpty())
-                {
-                    continue;
-                }
-
-                // Given geometry create Recast tile structure.
-                NavigationTileData navigationTileData = CreateNavigationTile(tile.get(),
-                    m_configuration, m_context.get());
-
-                // A tile might have no geometry at all if no objects were found there.
-                if (navigationTileData.IsValid())
-                {
-                    AttachNavigationTileToMesh(navigationTileData);
-                }
+                        UpdateNavigationTile(*tile, m_configuration);
+                    });
             }
+
+            AZ::TaskGraphEvent tilesProcessedEvent{ "RecastNavigation Blocking Tile Processing Wait" };
+            m_taskGraph.SubmitOnExecutor(m_taskExecutor, &tilesProcessedEvent);
+            tilesProcessedEvent.Wait();
         }
 
         RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
@@ -114,7 +123,7 @@ namespace RecastNavigation
         return true;
     }
 
-    bool RecastNavigationMeshComponentController::UpdateNavigationMeshAsync()
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshInRegionAsync(const AZ::Aabb& region)
     {
         bool notInProgress = false;
         if (m_updateInProgress.compare_exchange_strong(notInProgress, true))
@@ -123,8 +132,8 @@ namespace RecastNavigation
 
             bool operationScheduled = false;
             RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
-                &RecastNavigationProviderRequests::CollectGeometryAsync,
-                m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize,
+                &RecastNavigationProviderRequests::CollectGeometryWithinRegionAsync,
+                m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize, region,
                 [this](AZStd::shared_ptr<TileGeometry> tile)
                 {
                     OnTileProcessedEvent(tile);
@@ -149,7 +158,6 @@ namespace RecastNavigation
     void RecastNavigationMeshComponentController::Activate(const AZ::EntityComponentIdPair& entityComponentIdPair)
     {
         m_entityComponentIdPair = entityComponentIdPair;
-        m_context = AZStd::make_unique<rcContext>();
 
         // It is safe to create the navigation mesh object now.
         // The actual navigation data will be passed at a later time.
@@ -178,7 +186,6 @@ namespace RecastNavigation
             }
         }
 
-        m_context.reset();
         m_navObject.reset();
         m_taskGraphEvent.reset();
         m_updateInProgress = false;
@@ -303,6 +310,33 @@ namespace RecastNavigation
         return recast.CreateDetourData(geom, meshConfig);
     }
 
+    void RecastNavigationMeshComponentController::UpdateNavigationTile(TileGeometry& tile, const RecastNavigationMeshConfig& meshConfig)
+    {
+        // Recast contexts aren't thread-safe, so each tile gets its own.
+        rcContext context;
+
+        // A tile might have no geometry at all if no objects were found there, then only the old tile is removed.
+        NavigationTileData navigationTileData;
+        if (!tile.IsEmpty())
+        {
+            navigationTileData = CreateNavigationTile(&tile, meshConfig, &context);
+        }
+
+        {
+            NavMeshQuery::LockGuard lock(*m_navObject);
+            // If a tile at the location already exists, remove it before updating the data.
+            if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tile.m_tileX, tile.m_tileY, 0))
+            {
+                lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
+            }
+        }
+
+        if (navigationTileData.IsValid())
+        {
+            AttachNavigationTileToMesh(navigationTileData);
+        }
+    }
+
     RecastNavigationMeshComponentController::RecastNavigationMeshComponentController()
         : m_taskExecutor(bg_navmesh_threads)
     {
@@ -420,27 +454,7 @@ namespace RecastNavigation
                         }
 
                         AZ_PROFILE_SCOPE(Navigation, "Navigation: task - computing tile");
-
-                        NavigationTileData navigationTileData = CreateNavigationTile(tile.get(),
-                            config, m_context.get());
-
-                        {
-                            NavMeshQuery::LockGuard lock(*m_navObject);
-                            if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tile->m_tileX, tile->m_tileY, 0))
-                            {
-                                lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
-                            }
-                        }
-
-                        if (navigationTileData.IsValid())
-                        {
-                            AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshAsync - tile callback");
-
-                            if (navigationTileData.IsValid())
-                            {
-                                AttachNavigationTileToMesh(navigationTileData);
-                            }
-                        }
+                        UpdateNavigationTile(*tile, config);
                     });
 
                 tileTaskTokens.push_back(AZStd::move(token));
@@ -63,6 +63,12 @@ namespace RecastNavigation
         //! @returns the tile data that can be attached to the navigation mesh using @AttachNavigationTileToMesh
         NavigationTileData CreateNavigationTile(TileGeometry* geom, const RecastNavigationMeshConfig& meshConfig, rcContext* context);
 
+        //! Builds the Recast tile for the tile geometry and replaces the tile at the same location of the navigation mesh.
+        //! Safe to call from multiple tasks at the same time.
+        //! @param tile tile geometry, an empty tile only removes the existing navigation tile
+        //! @param meshConfig Recast navigation mesh configuration
+        void UpdateNavigationTile(TileGeometry& tile, const RecastNavigationMeshConfig& meshConfig);
+
         //! Creates a task graph with tasks to process received tile data.
         //! @param config navigation mesh configuration to apply to the tile data
         //! @param sendNotificationEvent once all the tiles are processed and added to the navigation update notify on the main thread
@@ -72,6 +78,8 @@ namespace RecastNavigation
         //! @{
         bool UpdateNavigationMeshBlockUntilCompleted() override;
         bool UpdateNavigationMeshAsync() override;
+        bool UpdateNavigationMeshInRegionBlockUntilCompleted(const AZ::Aabb& region) override;
+        bool UpdateNavigationMeshInRegionAsync(const AZ::Aabb& region) override;
         AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() override;
         //! @}
 
@@ -106,9 +114,6 @@ namespace RecastNavigation
         //! Debug draw object for Recast navigation mesh.
         RecastNavigationDebugDraw m_customDebugDraw;
 
-        //! Recast logging functionality and other optional tools.
-        AZStd::unique_ptr<rcContext> m_context;
-
         //! Recast navigation objects.
         AZStd::shared_ptr<NavMeshQuery> m_navObject;
 
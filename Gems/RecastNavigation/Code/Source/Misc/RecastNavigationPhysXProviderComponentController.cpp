@@ -113,7 +113,8 @@ namespace RecastNavigation
         float tileSize, float borderSize)
     {
         // Blocking call.
-        return CollectGeometryImpl(tileSize, borderSize, GetWorldBounds());
+        const AZ::Aabb worldVolume = GetWorldBounds();
+        return CollectGeometryImpl(tileSize, borderSize, worldVolume, worldVolume);
     }
 
     bool RecastNavigationPhysXProviderComponentController::CollectGeometryAsync(
@@ -121,7 +122,24 @@ namespace RecastNavigation
         float borderSize,
         AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
     {
-        return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback));
+        const AZ::Aabb worldVolume = GetWorldBounds();
+        return CollectGeometryAsyncImpl(tileSize, borderSize, worldVolume, worldVolume, AZStd::move(tileCallback));
+    }
+
+    AZStd::vector<AZStd::shared_ptr<TileGeometry>> RecastNavigationPhysXProviderComponentController::CollectGeometryWithinRegion(
+        float tileSize, float borderSize, const AZ::Aabb& region)
+    {
+        // Blocking call.
+        return CollectGeometryImpl(tileSize, borderSize, GetWorldBounds(), region);
+    }
+
+    bool RecastNavigationPhysXProviderComponentController::CollectGeometryWithinRegionAsync(
+        float tileSize,
+        float borderSize,
+        const AZ::Aabb& region,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+    {
+        return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), region, AZStd::move(tileCallback));
     }
 
     AZ::Aabb RecastNavigationPhysXProviderComponentController::GetWorldBounds() const
@@ -266,7 +284,7 @@ namespace RecastNavigation
     }
 
     AZStd::vector<AZStd::shared_ptr<TileGeometry>> RecastNavigationPhysXProviderComponentController::CollectGeometryImpl(
-        float tileSize, float borderSize, const AZ::Aabb& worldVolume)
+        float tileSize, float borderSize, const AZ::Aabb& worldVolume, const AZ::Aabb& region)
     {
         AZ_PROFILE_SCOPE(Navigation, "Navigation: CollectGeometry");
 
@@ -313,6 +331,12 @@ namespace RecastNavigation
                 AZ::Aabb tileVolume = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
                 AZ::Aabb scanVolume = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
 
+                // Changes outside of the scanned volume don't affect this tile.
+                if (!scanVolume.Overlaps(region))
+                {
+                    continue;
+                }
+
                 QueryHits results;
                 CollectCollidersWithinVolume(scanVolume, results);
 
@@ -358,6 +382,7 @@ namespace RecastNavigation
         float tileSize,
         float borderSize,
         const AZ::Aabb& worldVolume,
+        const AZ::Aabb& region,
         AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
     {
         bool notInProgress = false;
@@ -408,6 +433,12 @@ namespace RecastNavigation
 
                     AZ::Aabb tileVolume = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
                     AZ::Aabb scanVolume = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
+                    if (!scanVolume.Overlaps(region))
+                    {
+                        // Changes outside of the scanned volume don't affect this tile.
+                        continue;
+                    }
+
                     AZStd::shared_ptr<TileGeometry> geometryData = AZStd::make_unique<TileGeometry>();
                     geometryData->m_tileCallback = tileCallback;
                     geometryData->m_worldBounds = tileVolume;
@@ -7,8 +7,18 @@
  */
 
 #include <RecastNavigationSystemComponent.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <RecastNavigation/DetourNavigationBus.h>
+
+AZ_DECLARE_BUDGET(Navigation);
+
+AZ_CVAR(
+    float, cl_navmesh_pathRequestBudget, 1.f, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Time in milliseconds to spend on queued asynchronous path requests each tick. At least one request is processed each tick.");
 
 namespace RecastNavigation
 {
@@ -78,10 +88,50 @@ namespace RecastNavigation
     {
         AZ::TickBus::Handler::BusDisconnect();
         RecastNavigationRequestBus::Handler::BusDisconnect();
+
+        AZStd::lock_guard lock(m_pathRequestsMutex);
+        m_pathRequests.clear();
+    }
+
+    void RecastNavigationSystemComponent::QueuePathRequest(AZ::EntityId pathfinderEntity, AZ::u64 requestId,
+        const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition)
+    {
+        AZStd::lock_guard lock(m_pathRequestsMutex);
+        m_pathRequests.push_back({ pathfinderEntity, requestId, fromWorldPosition, toWorldPosition });
     }
 
     void RecastNavigationSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        ProcessPathRequests();
+    }
+
+    void RecastNavigationSystemComponent::ProcessPathRequests()
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: ProcessPathRequests");
+
+        const auto deadline = AZStd::chrono::steady_clock::now() +
+            AZStd::chrono::microseconds(aznumeric_cast<AZ::s64>(static_cast<float>(cl_navmesh_pathRequestBudget) * 1000.f));
+
+        do
+        {
+            PathRequest request;
+            {
+                AZStd::lock_guard lock(m_pathRequestsMutex);
+                if (m_pathRequests.empty())
+                {
+                    return;
+                }
+                request = m_pathRequests.front();
+                m_pathRequests.pop_front();
+            }
+
+            AZStd::vector<AZ::Vector3> path;
+            DetourNavigationRequestBus::EventResult(path, request.m_pathfinderEntity, &DetourNavigationRequests::FindPathBetweenPositions,
+                request.m_fromWorldPosition, request.m_toWorldPosition);
+
+            DetourNavigationNotificationBus::Event(request.m_pathfinderEntity, &DetourNavigationNotifications::OnPathFound,
+                request.m_pathfinderEntity, request.m_requestId, path);
+        } while (AZStd::chrono::steady_clock::now() < deadline);
     }
 
 } // namespace RecastNavigation
@@ -10,6 +10,8 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <RecastNavigation/RecastNavigationBus.h>
 
 namespace RecastNavigation
@@ -38,8 +40,28 @@ namespace RecastNavigation
         void Activate() override;
         void Deactivate() override;
 
+        //! RecastNavigationRequestBus overrides ...
+        void QueuePathRequest(AZ::EntityId pathfinderEntity, AZ::u64 requestId,
+            const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) override;
+
         //! AZTickBus overrides ...
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+    private:
+        //! Processes queued path requests until the path request time budget of a tick is used up.
+        void ProcessPathRequests();
+
+        struct PathRequest
+        {
+            AZ::EntityId m_pathfinderEntity;
+            AZ::u64 m_requestId = 0;
+            AZ::Vector3 m_fromWorldPosition;
+            AZ::Vector3 m_toWorldPosition;
+        };
+
+        //! Path requests are queued from any entity that needs a path, and processed in order on the main thread.
+        AZStd::deque<PathRequest> m_pathRequests;
+        AZStd::mutex m_pathRequestsMutex;
     };
 
 } // namespace RecastNavigation
@@ -16,6 +16,7 @@
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/Mocks/MockITime.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <Components/DetourNavigationComponent.h>
@@ -505,6 +506,65 @@ namespace RecastNavigationTests
         EXPECT_GT(waypoints.size(), 0);
     }
 
+    //! Collects the results of queued path requests.
+    struct PathResults : public RecastNavigation::DetourNavigationNotificationBus::Handler
+    {
+        explicit PathResults(AZ::EntityId id)
+        {
+            RecastNavigation::DetourNavigationNotificationBus::Handler::BusConnect(id);
+        }
+
+        ~PathResults() override
+        {
+            RecastNavigation::DetourNavigationNotificationBus::Handler::BusDisconnect();
+        }
+
+        void OnPathFound(AZ::EntityId, AZ::u64 requestId, const AZStd::vector<AZ::Vector3>& path) override
+        {
+            m_paths[requestId] = path;
+        }
+
+        AZStd::unordered_map<AZ::u64, AZStd::vector<AZ::Vector3>> m_paths;
+    };
+
+    TEST_F(NavigationTest, FindPathAsyncNotifiesOnTick)
+    {
+        Entity e;
+        PopulateEntity(e);
+        e.CreateComponent<DetourNavigationComponent>(e.GetId(), 3.f);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        const PathResults results(e.GetId());
+        AZ::u64 foundRequestId = 0;
+        DetourNavigationRequestBus::EventResult(foundRequestId, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositionsAsync,
+            AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f));
+        AZ::u64 notFoundRequestId = 0;
+        DetourNavigationRequestBus::EventResult(notFoundRequestId, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositionsAsync,
+            AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2000.f, 2000.f, 0.f));
+        EXPECT_NE(foundRequestId, 0);
+        EXPECT_NE(notFoundRequestId, foundRequestId);
+
+        // Requests are processed on the main thread when it ticks.
+        EXPECT_TRUE(results.m_paths.empty());
+        for (int i = 0; i < 2 && results.m_paths.size() < 2; ++i)
+        {
+            AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.1f, AZ::ScriptTimePoint{});
+        }
+
+        ASSERT_EQ(results.m_paths.size(), 2);
+        EXPECT_GT(results.m_paths.at(foundRequestId).size(), 1);
+        EXPECT_EQ(results.m_paths.at(notFoundRequestId).size(), 0);
+    }
+
     /*
      * Basic find path test.
      */
@@ -936,4 +996,51 @@ namespace RecastNavigationTests
             AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f));
         EXPECT_EQ(waypoints.size(), 0);
     }
+
+    TEST_F(NavigationTest, UpdateInRegionOnlyRebuildsOverlappingTiles)
+    {
+        Entity e;
+        PopulateEntity(e);
+        e.CreateComponent<DetourNavigationComponent>(e.GetId(), 3.f);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([]
+        (
+            [[maybe_unused]] AZStd::vector<AZ::Vector3>& vertices,
+            [[maybe_unused]] AZStd::vector<AZ::u32>& indices,
+            [[maybe_unused]] const AZ::Aabb*)
+            {
+                // Act as if there colliders are gone.
+            }));
+
+        // A change far away from the navigation mesh doesn't affect any tile, the path is still there.
+        bool result = false;
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshInRegionBlockUntilCompleted,
+            AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(100.f, 100.f, 0.f), AZ::Vector3::CreateOne()));
+        EXPECT_TRUE(result);
+
+        AZStd::vector<AZ::Vector3> waypoints;
+        DetourNavigationRequestBus::EventResult(waypoints, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositions,
+            AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f));
+        EXPECT_GT(waypoints.size(), 1);
+
+        // A change over the colliders rebuilds their tile.
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshInRegionBlockUntilCompleted,
+            AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne()));
+        EXPECT_TRUE(result);
+
+        waypoints.clear();
+        DetourNavigationRequestBus::EventResult(waypoints, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositions,
+            AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f));
+        EXPECT_EQ(waypoints.size(), 0);
+    }
 }
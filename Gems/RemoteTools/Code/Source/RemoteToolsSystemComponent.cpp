@@ -110,6 +110,9 @@ namespace RemoteTools
             }
         }
         m_entryRegistry.clear();
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingSharedPayloadsMutex);
+        m_pendingSharedPayloads.clear();
     }
 
     void RemoteToolsSystemComponent::OnSystemTick()
@@ -365,6 +368,41 @@ namespace RemoteTools
         auto connectionId = static_cast<AzNetworking::ConnectionId>(target.GetNetworkId());
         const uint8_t* outBuffer = reinterpret_cast<const uint8_t*>(msgBuffer.data());
         const size_t totalSize = msgBuffer.size();
+
+        // Large messages to a target on the same machine are handed over in shared memory instead of being fragmented
+        if (networkInterface != nullptr)
+        {
+            AzNetworking::IConnection* connection = networkInterface->GetConnectionSet().GetConnection(connectionId);
+            if (connection != nullptr && AzNetworking::ShouldUseSharedMemoryPayload(connection->GetRemoteAddress(), totalSize))
+            {
+                auto payload = AZStd::make_unique<AzNetworking::SharedMemoryPayload>();
+                if (payload->Create(outBuffer, totalSize))
+                {
+                    RemoteToolsPackets::RemoteToolsSharedMessage sharedPacket;
+                    sharedPacket.SetPayloadName(payload->GetName().c_str());
+                    sharedPacket.SetSize(aznumeric_cast<uint32_t>(totalSize));
+                    sharedPacket.SetPersistentId(target.GetPersistentId());
+
+                    // Registered before sending, the acknowledgement may arrive on another thread before SendReliablePacket returns
+                    AZStd::string payloadName(payload->GetName().c_str());
+                    {
+                        AZStd::lock_guard<AZStd::mutex> lock(m_pendingSharedPayloadsMutex);
+                        m_pendingSharedPayloads[payloadName] = { connectionId, AZStd::move(payload) };
+                    }
+
+                    if (networkInterface->SendReliablePacket(connectionId, sharedPacket))
+                    {
+                        return;
+                    }
+
+                    AZ_Error("RemoteToolsSystemComponent", false, "SendReliablePacket failed for a shared memory message of %zu bytes.\n", totalSize);
+                    AZStd::lock_guard<AZStd::mutex> lock(m_pendingSharedPayloadsMutex);
+                    m_pendingSharedPayloads.erase(payloadName);
+                    return;
+                }
+            }
+        }
+
         size_t outSize = totalSize;
         while (outSize > 0 && networkInterface != nullptr)
         {
@@ -421,14 +459,83 @@ namespace RemoteTools
         [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
         [[maybe_unused]] const RemoteToolsPackets::RemoteToolsMessage& packet)
     {
+        if (!AcceptInboundMessage(connection, packet.GetPersistentId()))
+        {
+            return true;
+        }
+
         AZ::Crc32 key = packet.GetPersistentId();
+        const uint32_t totalBufferSize = packet.GetSize();
+
+        // Messages can be larger than the size of a packet so reserve a buffer for the total message size
+        if (m_entryRegistry[key].m_tmpInboundBufferPos == 0)
+        {
+            m_entryRegistry[key].m_tmpInboundBuffer.reserve(totalBufferSize);
+        }
+
+        // Read as much data as the packet can include and append it to the buffer
+        const uint32_t readSize = AZStd::min(totalBufferSize - m_entryRegistry[key].m_tmpInboundBufferPos, RemoteToolsBufferSize);
+        memcpy(
+            m_entryRegistry[key].m_tmpInboundBuffer.begin() + m_entryRegistry[key].m_tmpInboundBufferPos,
+            packet.GetMessageBuffer().GetBuffer(), readSize);
+        m_entryRegistry[key].m_tmpInboundBufferPos += readSize;
+        if (m_entryRegistry[key].m_tmpInboundBufferPos == totalBufferSize)
+        {
+            if (AddInboundMessage(m_entryRegistry[key].m_tmpInboundBuffer.data(), totalBufferSize, packet.GetPersistentId()))
+            {
+                m_entryRegistry[key].m_tmpInboundBuffer.clear();
+                m_entryRegistry[key].m_tmpInboundBufferPos = 0;
+            }
+        }
+
+        return true;
+    }
+
+    bool RemoteToolsSystemComponent::HandleRequest(
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        const RemoteToolsPackets::RemoteToolsSharedMessage& packet)
+    {
+        if (AcceptInboundMessage(connection, packet.GetPersistentId()))
+        {
+            // Deserialized in place, the sender keeps the shared memory alive until it gets the acknowledgement below
+            AzNetworking::SharedMemoryPayload payload;
+            if (payload.Open(packet.GetPayloadName().c_str(), packet.GetSize()))
+            {
+                AddInboundMessage(payload.GetData(), packet.GetSize(), packet.GetPersistentId());
+            }
+            else
+            {
+                AZ_Error("RemoteToolsSystemComponent", false, "Failed to open shared memory message %s.\n", packet.GetPayloadName().c_str());
+            }
+        }
+
+        RemoteToolsPackets::RemoteToolsSharedMessageAck ackPacket;
+        ackPacket.SetPayloadName(packet.GetPayloadName());
+        connection->SendReliablePacket(ackPacket);
+        return true;
+    }
+
+    bool RemoteToolsSystemComponent::HandleRequest(
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        const RemoteToolsPackets::RemoteToolsSharedMessageAck& packet)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingSharedPayloadsMutex);
+        m_pendingSharedPayloads.erase(packet.GetPayloadName());
+        return true;
+    }
+
+    bool RemoteToolsSystemComponent::AcceptInboundMessage(AzNetworking::IConnection* connection, uint32_t persistentId)
+    {
+        AZ::Crc32 key = persistentId;
 
         // Receive
         if (connection->GetConnectionRole() == AzNetworking::ConnectionRole::Acceptor
             && static_cast<uint32_t>(connection->GetConnectionId()) != m_entryRegistry[key].m_lastTarget.GetNetworkId())
         {
             // Listener should route traffic based on selected target
-            return true;
+            return false;
         }
       
         if (!m_entryRegistry.contains(key))
@@ -439,70 +546,57 @@ namespace RemoteTools
         // If we're a client, set the host to our desired target
         if (connection->GetConnectionRole() == AzNetworking::ConnectionRole::Connector)
         {
-            if (GetEndpointInfo(key, packet.GetPersistentId()).GetPersistentId() == 0)
+            if (GetEndpointInfo(key, persistentId).GetPersistentId() == 0)
             {
                 AzFramework::RemoteToolsEndpointContainer::pair_iter_bool ret =
-                    m_entryRegistry[key].m_availableTargets.insert_key(packet.GetPersistentId());
+                    m_entryRegistry[key].m_availableTargets.insert_key(persistentId);
 
                 AzFramework::RemoteToolsEndpointInfo& ti = ret.first->second;
-                ti.SetInfo("Host", packet.GetPersistentId(), static_cast<uint32_t>(connection->GetConnectionId()));
+                ti.SetInfo("Host", persistentId, static_cast<uint32_t>(connection->GetConnectionId()));
                 m_entryRegistry[key].m_endpointJoinedEvent.Signal(ti);
             }
 
-            if (GetDesiredEndpoint(key).GetPersistentId() != packet.GetPersistentId())
+            if (GetDesiredEndpoint(key).GetPersistentId() != persistentId)
             {
-                SetDesiredEndpoint(key, packet.GetPersistentId());
+                SetDesiredEndpoint(key, persistentId);
             }
         }
 
-        const uint32_t totalBufferSize = packet.GetSize();
+        return true;
+    }
 
-        // Messages can be larger than the size of a packet so reserve a buffer for the total message size
-        if (m_entryRegistry[key].m_tmpInboundBufferPos == 0)
+    bool RemoteToolsSystemComponent::AddInboundMessage(const void* buffer, uint32_t size, uint32_t persistentId)
+    {
+        AZ::SerializeContext* serializeContext;
+        AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+
+        // Deserialize the complete buffer
+        AZ::IO::MemoryStream msgBuffer(buffer, size);
+        AzFramework::RemoteToolsMessage* msg = nullptr;
+        AZ::ObjectStream::ClassReadyCB readyCB(AZStd::bind(
+            &RemoteToolsSystemComponent::OnMessageParsed, this, &msg, AZStd::placeholders::_1, AZStd::placeholders::_2,
+            AZStd::placeholders::_3));
+        AZ::ObjectStream::LoadBlocking(
+            &msgBuffer, *serializeContext, readyCB,
+            AZ::ObjectStream::FilterDescriptor(nullptr, AZ::ObjectStream::FILTERFLAG_IGNORE_UNKNOWN_CLASSES));
+
+        // Append to the inbox for handling
+        if (!msg)
         {
-            m_entryRegistry[key].m_tmpInboundBuffer.reserve(totalBufferSize);
+            return false;
         }
 
-        // Read as much data as the packet can include and append it to the buffer
-        const uint32_t readSize = AZStd::min(totalBufferSize - m_entryRegistry[key].m_tmpInboundBufferPos, RemoteToolsBufferSize);
-        memcpy(
-            m_entryRegistry[key].m_tmpInboundBuffer.begin() + m_entryRegistry[key].m_tmpInboundBufferPos,
-            packet.GetMessageBuffer().GetBuffer(), readSize);
-        m_entryRegistry[key].m_tmpInboundBufferPos += readSize;
-        if (m_entryRegistry[key].m_tmpInboundBufferPos == totalBufferSize)
+        if (msg->GetCustomBlobSize() > 0)
         {
-            AZ::SerializeContext* serializeContext;
-            AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
-
-            // Deserialize the complete buffer
-            AZ::IO::MemoryStream msgBuffer(m_entryRegistry[key].m_tmpInboundBuffer.data(), totalBufferSize, totalBufferSize);
-            AzFramework::RemoteToolsMessage* msg = nullptr;
-            AZ::ObjectStream::ClassReadyCB readyCB(AZStd::bind(
-                &RemoteToolsSystemComponent::OnMessageParsed, this, &msg, AZStd::placeholders::_1, AZStd::placeholders::_2,
-                AZStd::placeholders::_3));
-            AZ::ObjectStream::LoadBlocking(
-                &msgBuffer, *serializeContext, readyCB,
-                AZ::ObjectStream::FilterDescriptor(nullptr, AZ::ObjectStream::FILTERFLAG_IGNORE_UNKNOWN_CLASSES));
-
-            // Append to the inbox for handling
-            if (msg)
-            {
-                if (msg->GetCustomBlobSize() > 0)
-                {
-                    void* blob = azmalloc(msg->GetCustomBlobSize(), 1, AZ::OSAllocator);
-                    msgBuffer.Read(msg->GetCustomBlobSize(), blob);
-                    msg->AddCustomBlob(blob, msg->GetCustomBlobSize(), true);
-                }
-                msg->SetSenderTargetId(packet.GetPersistentId());
-
-                m_inboxMutex.lock();
-                m_inbox[msg->GetSenderTargetId()].push_back(msg);
-                m_inboxMutex.unlock();
-                m_entryRegistry[key].m_tmpInboundBuffer.clear();
-                m_entryRegistry[key].m_tmpInboundBufferPos = 0;
-            }
+            void* blob = azmalloc(msg->GetCustomBlobSize(), 1, AZ::OSAllocator);
+            msgBuffer.Read(msg->GetCustomBlobSize(), blob);
+            msg->AddCustomBlob(blob, msg->GetCustomBlobSize(), true);
         }
+        msg->SetSenderTargetId(persistentId);
 
+        m_inboxMutex.lock();
+        m_inbox[msg->GetSenderTargetId()].push_back(msg);
+        m_inboxMutex.unlock();
         return true;
     }
 
@@ -539,6 +633,15 @@ namespace RemoteTools
         [[maybe_unused]] AzNetworking::DisconnectReason reason,
         [[maybe_unused]] AzNetworking::TerminationEndpoint endpoint)
     {
+        // Shared memory messages the target never acknowledged won't be read anymore
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingSharedPayloadsMutex);
+            AZStd::erase_if(m_pendingSharedPayloads, [connection](const auto& pendingPayload)
+            {
+                return pendingPayload.second.m_connectionId == connection->GetConnectionId();
+            });
+        }
+
         // If our desired target has left the network, flag it and notify listeners
         if (reason != AzNetworking::DisconnectReason::ConnectionRejected)
         {
@@ -13,6 +13,7 @@
 #include <AzFramework/Network/IRemoteTools.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Utilities/SharedMemoryPayload.h>
 #include <AzNetworking/Utilities/TimedThread.h>
 
 #include "Utilities/RemoteToolsJoinThread.h"
@@ -21,6 +22,8 @@ namespace RemoteToolsPackets
 {
     class RemoteToolsConnect;
     class RemoteToolsMessage;
+    class RemoteToolsSharedMessage;
+    class RemoteToolsSharedMessageAck;
 } // namespace RemoteToolsPackets
 
 namespace RemoteTools
@@ -75,6 +78,14 @@ namespace RemoteTools
             AzNetworking::IConnection* connection,
             const AzNetworking::IPacketHeader& packetHeader,
             const RemoteToolsPackets::RemoteToolsMessage& packet);
+        bool HandleRequest(
+            AzNetworking::IConnection* connection,
+            const AzNetworking::IPacketHeader& packetHeader,
+            const RemoteToolsPackets::RemoteToolsSharedMessage& packet);
+        bool HandleRequest(
+            AzNetworking::IConnection* connection,
+            const AzNetworking::IPacketHeader& packetHeader,
+            const RemoteToolsPackets::RemoteToolsSharedMessageAck& packet);
 
     protected:
         ////////////////////////////////////////////////////////////////////////
@@ -145,11 +156,26 @@ namespace RemoteTools
         void SendRemoteToolsMessage(const AzFramework::RemoteToolsEndpointInfo& target, const AzFramework::RemoteToolsMessage& msg) override;
         ////////////////////////////////////////////////////////////////////////
 
+        //! Routes an inbound message, returns false if the message isn't meant for the selected target and should be dropped.
+        bool AcceptInboundMessage(AzNetworking::IConnection* connection, uint32_t persistentId);
+
+        //! Deserializes a complete message and appends it to the inbox, returns false if the buffer didn't hold a message.
+        bool AddInboundMessage(const void* buffer, uint32_t size, uint32_t persistentId);
+
         AZStd::unique_ptr<RemoteToolsJoinThread> m_joinThread;
 
         AZStd::unordered_map<AZ::Crc32, RemoteToolsRegistryEntry> m_entryRegistry;
 
         AZStd::unordered_map<AZ::Crc32, AzFramework::ReceivedRemoteToolsMessages> m_inbox;
         AZStd::mutex m_inboxMutex;
+
+        // Messages sent through shared memory, kept alive until the receiver acknowledges them or disconnects.
+        struct PendingSharedPayload
+        {
+            AzNetworking::ConnectionId m_connectionId = AzNetworking::InvalidConnectionId;
+            AZStd::unique_ptr<AzNetworking::SharedMemoryPayload> m_payload;
+        };
+        AZStd::unordered_map<AZStd::string, PendingSharedPayload> m_pendingSharedPayloads;
+        AZStd::mutex m_pendingSharedPayloadsMutex;
     };
 } // namespace RemoteTools
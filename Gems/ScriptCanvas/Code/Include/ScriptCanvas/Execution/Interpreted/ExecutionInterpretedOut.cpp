@@ -39,6 +39,7 @@ namespace ScriptCanvas
         OutInterpreted::OutInterpreted(lua_State* lua)
             : m_lambdaRegistryIndex(ExecutionStateInterpretedCpp::luaL_ref_Checked(lua))
             , m_lua(lua)
+            , m_behaviorContext(AZ::ScriptContext::FromNativeContext(lua)->GetBoundContext())
         {
         }
 
@@ -64,19 +65,19 @@ namespace ScriptCanvas
             source.m_lambdaRegistryIndex = LUA_NOREF;
             m_lua = source.m_lua;
             source.m_lua = nullptr;
+            m_behaviorContext = source.m_behaviorContext;
             return *this;
         }
 
         void OutInterpreted::operator()(AZ::BehaviorArgument* /*resultBVP*/, AZ::BehaviorArgument* argsBVPs, int numArguments)
         {
-            auto behaviorContext = AZ::ScriptContext::FromNativeContext(m_lua)->GetBoundContext();
             // Lua:
             lua_rawgeti(m_lua, LUA_REGISTRYINDEX, m_lambdaRegistryIndex);
             // Lua: lambda
 
             for (int i = 0; i < numArguments; ++i)
             {
-                Execution::StackPush(m_lua, behaviorContext, argsBVPs[i]);
+                Execution::StackPush(m_lua, m_behaviorContext, argsBVPs[i]);
             }
             // Lua: lambda, args...
             const int result = InterpretedSafeCall(m_lua, numArguments, 0);
@@ -92,6 +93,7 @@ namespace ScriptCanvas
         OutInterpretedResult::OutInterpretedResult(lua_State* lua)
             : m_lambdaRegistryIndex(ExecutionStateInterpretedCpp::luaL_ref_Checked(lua))
             , m_lua(lua)
+            , m_behaviorContext(AZ::ScriptContext::FromNativeContext(lua)->GetBoundContext())
         {
         }
 
@@ -117,6 +119,7 @@ namespace ScriptCanvas
             source.m_lambdaRegistryIndex = LUA_NOREF;
             m_lua = source.m_lua;
             source.m_lua = nullptr;
+            m_behaviorContext = source.m_behaviorContext;
             return *this;
         }
 
@@ -124,14 +127,13 @@ namespace ScriptCanvas
         {
             SC_RUNTIME_CHECK(resultBVP && resultBVP->m_value, "This function is only expected for BehaviorConext bound event handling, and must always have a location for a return value");
 
-            auto behaviorContext = AZ::ScriptContext::FromNativeContext(m_lua)->GetBoundContext();
             // Lua:
             lua_rawgeti(m_lua, LUA_REGISTRYINDEX, m_lambdaRegistryIndex);
             // Lua: lambda
 
             for (int i = 0; i < numArguments; ++i)
             {
-                Execution::StackPush(m_lua, behaviorContext, argsBVPs[i]);
+                Execution::StackPush(m_lua, m_behaviorContext, argsBVPs[i]);
             }
             // Lua: lambda, args...
             const int result = InterpretedSafeCall(m_lua, numArguments, 1);
@@ -144,7 +146,7 @@ namespace ScriptCanvas
             else
             {
                 // Lua: result
-                Execution::StackRead(m_lua, behaviorContext, -1, *resultBVP, nullptr);
+                Execution::StackRead(m_lua, m_behaviorContext, -1, *resultBVP, nullptr);
                 lua_pop(m_lua, 1);
             }
             // Lua:
@@ -15,6 +15,7 @@ struct lua_State;
 
 namespace AZ
 {
+    class BehaviorContext;
     struct BehaviorArgument;
 }
 
@@ -29,6 +30,8 @@ namespace ScriptCanvas
 
             int m_lambdaRegistryIndex;
             lua_State* m_lua;
+            // cached on construction, so handling an event doesn't look up the script context in the Lua registry
+            AZ::BehaviorContext* m_behaviorContext = nullptr;
 
             // assumes a lambda is at the top of the stack and will pop it
             OutInterpreted(lua_State* lua);
@@ -53,6 +56,8 @@ namespace ScriptCanvas
 
             int m_lambdaRegistryIndex;
             lua_State* m_lua;
+            // cached on construction, so handling an event doesn't look up the script context in the Lua registry
+            AZ::BehaviorContext* m_behaviorContext = nullptr;
             
             // assumes a lambda is at the top of the stack and will pop it
             OutInterpretedResult(lua_State* lua);
@@ -52,6 +52,8 @@ namespace ScriptCanvas
     namespace Translation
     {
         const static size_t k_DefaultLoopLimit = 1000;
+        // Lua allows 200 locals per function, including the main chunk, so leave room for the dependencies and the graph table.
+        const static size_t k_MaxCachedEBusFunctions = 128;
 
         Configuration CreateLuaConfig([[maybe_unused]] const Grammar::AbstractCodeModel& source)
         {
@@ -133,14 +135,76 @@ namespace ScriptCanvas
 
             WriteHeader();
             TranslateDependencies();
+
+            // The body is translated first, so the EBus event functions that it calls can be declared ahead of it.
+            Writer header = AZStd::move(m_dotLua);
+            m_dotLua = Writer();
             TranslateClassOpen();   
             TranslateBody(BuildConfiguration::Release);
             TranslateBody(BuildConfiguration::Performance);
             TranslateBody(BuildConfiguration::Debug);
             TranslateClassClose();
+            WriteCachedEBusFunctions(header);
+            header.Write(m_dotLua.GetOutput());
+            m_dotLua = AZStd::move(header);
             MarkTranslationStop();
         }
 
+        AZStd::string GraphToLua::FindOrAddCachedEBusFunction(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view name)
+        {
+            AZStd::string_view eventTable;
+            switch (execution->GetEventType())
+            {
+            case ScriptCanvas::EventType::Broadcast:
+                eventTable = "Broadcast";
+                break;
+            case ScriptCanvas::EventType::BroadcastQueue:
+                eventTable = "QueueBroadcast";
+                break;
+            case ScriptCanvas::EventType::Event:
+                eventTable = "Event";
+                break;
+            case ScriptCanvas::EventType::EventQueue:
+                eventTable = "QueueEvent";
+                break;
+            default:
+                return "";
+            }
+
+            // Only EBus tables that BehaviorContext binds as globals are cached, everything else keeps its full lookup.
+            const Grammar::LexicalScope lexicalScope = execution->GetNameLexicalScope();
+            if ((lexicalScope.m_type != Grammar::LexicalScopeType::Class && lexicalScope.m_type != Grammar::LexicalScopeType::Namespace)
+                || lexicalScope.m_namespaces.size() != 1
+                || IsUserFunctionCall(execution))
+            {
+                return "";
+            }
+
+            AZStd::string busName = ResolveScope(lexicalScope.m_namespaces);
+            if (busName.empty() || !FindAbbreviation(busName).empty())
+            {
+                return "";
+            }
+
+            AZStd::string functionName = Grammar::ToIdentifier(name);
+            AZStd::string localName = AZStd::string::format("%s_%.*s_%s%s", busName.c_str(), aznumeric_cast<int>(eventTable.size()), eventTable.data()
+                , functionName.c_str(), Grammar::k_internalRuntimeSuffix);
+
+            if (m_cachedEBusFunctionNames.find(localName) != m_cachedEBusFunctionNames.end())
+            {
+                return localName;
+            }
+
+            if (m_cachedEBusFunctions.size() >= k_MaxCachedEBusFunctions)
+            {
+                return "";
+            }
+
+            m_cachedEBusFunctionNames.insert(localName);
+            m_cachedEBusFunctions.push_back({ localName, AZStd::move(busName), eventTable, AZStd::move(functionName) });
+            return localName;
+        }
+
         const AZStd::string& GraphToLua::FindAbbreviation(AZStd::string_view dependency) const
         {
             return m_context.FindAbbreviation(dependency);
@@ -1310,6 +1374,27 @@ namespace ScriptCanvas
             TranslateNodeableParse();
         }
 
+        void GraphToLua::WriteCachedEBusFunctions(Writer& writer)
+        {
+            if (m_cachedEBusFunctions.empty())
+            {
+                return;
+            }
+
+            // A missing EBus or event leaves the local nil, which reports the error when the event is called, as the full lookup would.
+            for (const CachedEBusFunction& function : m_cachedEBusFunctions)
+            {
+                const int eventTableLength = aznumeric_cast<int>(function.m_eventTable.size());
+                writer.WriteLine("local %s = %s and %s.%.*s and %s.%.*s.%s"
+                    , function.m_localName.c_str()
+                    , function.m_busName.c_str()
+                    , function.m_busName.c_str(), eventTableLength, function.m_eventTable.data()
+                    , function.m_busName.c_str(), eventTableLength, function.m_eventTable.data(), function.m_functionName.c_str());
+            }
+
+            writer.WriteNewLine();
+        }
+
         void GraphToLua::WriteClassPropertyRead(Grammar::ExecutionTreeConstPtr execution)
         {
             if (execution->GetInputCount() > 0)
@@ -1697,28 +1782,35 @@ namespace ScriptCanvas
                 m_dotLua.Write("%s(", Grammar::k_TypeSafeEBusMultipleResultsName);
             }
 
-            WriteFunctionCallNamespace(execution);
-
-            switch (execution->GetEventType())
+            if (const AZStd::string cachedFunction = FindOrAddCachedEBusFunction(execution, name); !cachedFunction.empty())
             {
-            case ScriptCanvas::EventType::Broadcast:
-                m_dotLua.Write("Broadcast.%s(", Grammar::ToIdentifier(name).data());
-                break;
-            case ScriptCanvas::EventType::BroadcastQueue:
-                m_dotLua.Write("QueueBroadcast.%s(", Grammar::ToIdentifier(name).data());
-                break;
-            case ScriptCanvas::EventType::Event:
-                m_dotLua.Write("Event.%s(", Grammar::ToIdentifier(name).data());
-                break;
-            case ScriptCanvas::EventType::EventQueue:
-                m_dotLua.Write("QueueEvent.%s(", Grammar::ToIdentifier(name).data());
-                break;
-            case ScriptCanvas::EventType::Count:
-                m_dotLua.Write("%s(", Grammar::ToIdentifier(name).data());
-                break;
-            default:
-                AddError(execution, aznew InvalidFunctionCallNameValidation(execution->GetId().m_node->GetEntityId(), execution->GetId().m_slot->GetId()));
-                break;
+                m_dotLua.Write("%s(", cachedFunction.c_str());
+            }
+            else
+            {
+                WriteFunctionCallNamespace(execution);
+
+                switch (execution->GetEventType())
+                {
+                case ScriptCanvas::EventType::Broadcast:
+                    m_dotLua.Write("Broadcast.%s(", Grammar::ToIdentifier(name).data());
+                    break;
+                case ScriptCanvas::EventType::BroadcastQueue:
+                    m_dotLua.Write("QueueBroadcast.%s(", Grammar::ToIdentifier(name).data());
+                    break;
+                case ScriptCanvas::EventType::Event:
+                    m_dotLua.Write("Event.%s(", Grammar::ToIdentifier(name).data());
+                    break;
+                case ScriptCanvas::EventType::EventQueue:
+                    m_dotLua.Write("QueueEvent.%s(", Grammar::ToIdentifier(name).data());
+                    break;
+                case ScriptCanvas::EventType::Count:
+                    m_dotLua.Write("%s(", Grammar::ToIdentifier(name).data());
+                    break;
+                default:
+                    AddError(execution, aznew InvalidFunctionCallNameValidation(execution->GetId().m_node->GetEntityId(), execution->GetId().m_slot->GetId()));
+                    break;
+                }
             }
 
             // #functions2 pure on graph start nodes with dependencies can only be added to the graph as variables, which is a work-flow we may never want to support
@@ -10,6 +10,7 @@
 
 #include <AzCore/std/limits.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/Outcome/Outcome.h>
 
 #include <ScriptCanvas/Asset/RuntimeInputs.h>
@@ -66,9 +67,21 @@ namespace ScriptCanvas
             AZStd::string m_tableName;
             Writer m_dotLua;
             SystemComponentConfiguration m_systemConfiguration;
+
+            //! An EBus event function that is looked up once when the script is loaded, instead of through the global EBus table on every call.
+            struct CachedEBusFunction
+            {
+                AZStd::string m_localName;
+                AZStd::string m_busName;
+                AZStd::string_view m_eventTable;
+                AZStd::string m_functionName;
+            };
+            AZStd::vector<CachedEBusFunction> m_cachedEBusFunctions;
+            AZStd::unordered_set<AZStd::string> m_cachedEBusFunctionNames;
                         
             GraphToLua(const Grammar::AbstractCodeModel& source);
 
+            AZStd::string FindOrAddCachedEBusFunction(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view name);
             const AZStd::string& FindAbbreviation(AZStd::string_view dependency) const;
             const AZStd::string& FindLibrary(AZStd::string_view dependency) const;
             AZStd::string_view GetOperatorString(Grammar::ExecutionTreeConstPtr execution);
@@ -120,6 +133,7 @@ namespace ScriptCanvas
             void TranslateNodeableParse();
             void TranslateStaticInitialization();
             void TranslateVariableInitialization(AZStd::string_view leftValue);
+            void WriteCachedEBusFunctions(Writer& writer);
             void WriteClassPropertyRead(Grammar::ExecutionTreeConstPtr);
             void WriteClassPropertyWrite(Grammar::ExecutionTreeConstPtr);
             void WriteConditionalCaseSwitch(Grammar::ExecutionTreeConstPtr execution, Grammar::Symbol symbol, const Grammar::ExecutionChild& child, size_t index);
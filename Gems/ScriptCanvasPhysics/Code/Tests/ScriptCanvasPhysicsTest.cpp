@@ -142,6 +142,8 @@ namespace ScriptCanvasPhysicsTests
         MOCK_METHOD2(QueryScene, AzPhysics::SceneQueryHits(AzPhysics::SceneHandle sceneHandle, const AzPhysics::SceneQueryRequest* request));
         MOCK_METHOD3(QueryScene, bool(AzPhysics::SceneHandle sceneHandle, const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQueryHits&));
         MOCK_METHOD2(QuerySceneBatch, AzPhysics::SceneQueryHitsList(AzPhysics::SceneHandle sceneHandle, const AzPhysics::SceneQueryRequests& requests));
+        MOCK_METHOD3(QuerySceneRayCastBatch, void(AzPhysics::SceneHandle sceneHandle, AZStd::span<const AzPhysics::RayCastRequest> requests, AzPhysics::SceneQueryBatchHits& results));
+        MOCK_METHOD3(QuerySceneShapeCastBatch, void(AzPhysics::SceneHandle sceneHandle, AZStd::span<const AzPhysics::ShapeCastRequest> requests, AzPhysics::SceneQueryBatchHits& results));
         MOCK_METHOD4(QuerySceneAsync, bool(AzPhysics::SceneHandle sceneHandle, AzPhysics::SceneQuery::AsyncRequestId requestId,
             const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback));
         MOCK_METHOD4(QuerySceneAsyncBatch, bool(AzPhysics::SceneHandle sceneHandle, AzPhysics::SceneQuery::AsyncRequestId requestId,
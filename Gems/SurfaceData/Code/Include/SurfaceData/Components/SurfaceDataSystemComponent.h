@@ -13,6 +13,7 @@
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/SurfaceDataTypes.h>
+#include <SurfaceData/SurfacePointCache.h>
 
 namespace SurfaceData
 {
@@ -72,6 +73,26 @@ namespace SurfaceData
 
         using SurfaceDataRegistryMap = AZStd::unordered_map<SurfaceDataRegistryHandle, SurfaceDataRegistryEntry>;
 
+        // Generate the surface points for the input positions with all the applicable surface providers and modifiers.
+        // The registration mutex needs to be locked by the caller.
+        void GenerateSurfacePoints(
+            AZStd::span<const AZ::Vector3> inPositions,
+            const AZ::Aabb& inBounds,
+            const SurfaceTagVector& desiredTags,
+            SurfacePointList& surfacePointLists) const;
+
+        // Get the surface points for the input positions from the point cache, and generate only the ones that are missing.
+        // The registration mutex needs to be locked by the caller.
+        void GetCachedSurfacePoints(
+            AZStd::span<const AZ::Vector3> inPositions,
+            const AZ::Aabb& inBounds,
+            const SurfaceTagVector& desiredTags,
+            SurfacePointList& surfacePointLists) const;
+
+        // Invalidate the cached surface points in the changed regions and broadcast OnSurfaceChanged.
+        void NotifySurfaceChanged(
+            const AZ::EntityId& entityId, const AZ::Aabb& oldBounds, const AZ::Aabb& newBounds, const SurfaceTagSet& changedSurfaceTags);
+
         // Get all the surface tags that can exist within the given bounds.
         SurfaceTagSet GetTagsFromBounds(const AZ::Aabb& bounds, const SurfaceDataRegistryMap& registeredEntries) const;
         // Get all the surface provider tags that can exist within the given bounds.
@@ -102,5 +123,10 @@ namespace SurfaceData
 
         //point vector reserved for reuse
         mutable SurfacePointList m_targetPointList;
+
+        // Cache of the surface points generated for previously queried input positions.
+        static constexpr float PointCacheCellSize = 16.0f;
+        static constexpr size_t MaxPointCacheCells = 1024;
+        mutable SurfacePointCache m_pointCache;
     };
 }
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <SurfaceData/SurfaceDataTypes.h>
+
+namespace SurfaceData
+{
+    //! A cache of the surface points generated for input positions of previous surface point queries.
+    //! The input positions are hashed into square cells by their quantized XY coordinates, and the least recently used cell gets evicted
+    //! once the maximum number of cells is reached. Each cell only holds the points of one query signature, which identifies the set of
+    //! surface providers and filter tags that generated them, so the same input position can be cached for several kinds of queries.
+    //! Points are only valid until a region containing them gets invalidated, which the surface data system does with the same regions
+    //! that it sends out through OnSurfaceChanged.
+    //! All methods are thread-safe so that the cache can be used from concurrent surface point queries.
+    class SurfacePointCache
+    {
+    public:
+        struct CachedPoint
+        {
+            AZ::Vector3 m_position;
+            AZ::Vector3 m_normal;
+            SurfaceTagWeights m_weights;
+        };
+
+        //! Remove all cached points and set up the cells.
+        //! @param cellSize The size of a cell in meters.
+        //! @param maxCells The maximum number of cells kept in the cache.
+        void Reset(float cellSize, size_t maxCells);
+
+        //! Remove all cached points.
+        void Clear();
+
+        //! Remove the cached points of all cells that overlap the 2D bounds of the given region.
+        //! An invalid region is treated as infinite and removes everything.
+        void Invalidate(const AZ::Aabb& dirtyRegion);
+
+        //! Look up the cached points for an input position. Only input positions with exactly the same XY coordinates match.
+        //! @param outPoints The cached points get appended to this list, sorted in decreasing Z order.
+        //! @return True if the input position was found in the cache, which can also be the case if it didn't generate any points.
+        bool Find(const AZ::Vector3& inPosition, uint64_t querySignature, AZStd::vector<CachedPoint>& outPoints);
+
+        //! Get the current generation, which changes every time points get invalidated.
+        //! Points that got generated outside of the cache should only be stored with the generation from before their generation,
+        //! so that points generated during an invalidation never end up in the cache.
+        uint64_t GetGeneration() const;
+
+        //! Store the points for an input position, unless the cache got invalidated since the given generation.
+        void Store(const AZ::Vector3& inPosition, uint64_t querySignature, AZStd::span<const CachedPoint> points, uint64_t generation);
+
+        size_t GetNumCells() const;
+
+    private:
+        struct CellKey
+        {
+            int32_t m_cellX = 0;
+            int32_t m_cellY = 0;
+            uint64_t m_querySignature = 0;
+
+            bool operator==(const CellKey& rhs) const
+            {
+                return (m_cellX == rhs.m_cellX) && (m_cellY == rhs.m_cellY) && (m_querySignature == rhs.m_querySignature);
+            }
+        };
+
+        struct CellKeyHasher
+        {
+            size_t operator()(const CellKey& key) const;
+        };
+
+        struct PointRange
+        {
+            uint32_t m_startIndex = 0;
+            uint32_t m_numPoints = 0;
+        };
+
+        struct Cell
+        {
+            CellKey m_key;
+            AZStd::unordered_map<uint64_t, PointRange> m_inPositions; //!< Keyed by the exact XY coordinates of the input position.
+            AZStd::vector<CachedPoint> m_points;
+        };
+        using CellList = AZStd::list<Cell>;
+
+        static uint64_t GetPositionKey(const AZ::Vector3& inPosition);
+        CellKey GetCellKey(const AZ::Vector3& inPosition, uint64_t querySignature) const;
+
+        mutable AZStd::mutex m_mutex;
+        CellList m_cells; //!< Sorted from most to least recently used.
+        AZStd::unordered_map<CellKey, CellList::iterator, CellKeyHasher> m_cellLookup;
+        float m_cellSize = 16.0f;
+        size_t m_maxCells = 0;
+        uint64_t m_generation = 0;
+    };
+} // namespace SurfaceData
@@ -6,10 +6,12 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/hash.h>
 #include <AzCore/std/sort.h>
 
 #include <SurfaceData/Components/SurfaceDataSystemComponent.h>
@@ -22,6 +24,14 @@
 
 AZ_DEFINE_BUDGET(SurfaceData);
 
+AZ_CVAR(bool,
+    surfacedata_pointCacheEnabled,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Cache the surface points generated for each queried input position, so repeated queries of a region only generate the missing points."
+);
+
 namespace SurfaceData
 {
     void SurfaceDataSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -100,6 +110,7 @@ namespace SurfaceData
 
     void SurfaceDataSystemComponent::Activate()
     {
+        m_pointCache.Reset(PointCacheCellSize, MaxPointCacheCells);
         AZ::Interface<SurfaceDataSystem>::Register(this);
         SurfaceDataSystemRequestBus::Handler::BusConnect();
     }
@@ -108,6 +119,7 @@ namespace SurfaceData
     {
         SurfaceDataSystemRequestBus::Handler::BusDisconnect();
         AZ::Interface<SurfaceDataSystem>::Unregister(this);
+        m_pointCache.Clear();
     }
 
     SurfaceDataRegistryHandle SurfaceDataSystemComponent::RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry)
@@ -122,9 +134,7 @@ namespace SurfaceData
 
             // Send in the entry's bounds as both the old and new bounds, since a null Aabb for old bounds
             // would cause a full refresh for any system listening, instead of just a refresh within the bounds.
-            SurfaceDataSystemNotificationBus::Broadcast(
-                &SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, entry.m_bounds, entry.m_bounds,
-                affectedSurfaceTags);
+            NotifySurfaceChanged(entry.m_entityId, entry.m_bounds, entry.m_bounds, affectedSurfaceTags);
         }
         return handle;
     }
@@ -141,9 +151,7 @@ namespace SurfaceData
 
             // Send in the entry's bounds as both the old and new bounds, since a null Aabb for old bounds
             // would cause a full refresh for any system listening, instead of just a refresh within the bounds.
-            SurfaceDataSystemNotificationBus::Broadcast(
-                &SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, entry.m_bounds, entry.m_bounds,
-                affectedSurfaceTags);
+            NotifySurfaceChanged(entry.m_entityId, entry.m_bounds, entry.m_bounds, affectedSurfaceTags);
         }
     }
 
@@ -162,9 +170,7 @@ namespace SurfaceData
             surfaceTagBounds.AddAabb(entry.m_bounds);
             SurfaceTagSet affectedSurfaceTags = GetAffectedSurfaceTags(surfaceTagBounds, entry.m_tags);
 
-            SurfaceDataSystemNotificationBus::Broadcast(
-                &SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, oldBounds, entry.m_bounds,
-                affectedSurfaceTags);
+            NotifySurfaceChanged(entry.m_entityId, oldBounds, entry.m_bounds, affectedSurfaceTags);
         }
     }
 
@@ -179,9 +185,7 @@ namespace SurfaceData
 
             // Send in the entry's bounds as both the old and new bounds, since a null Aabb for old bounds
             // would cause a full refresh for any system listening, instead of just a refresh within the bounds.
-            SurfaceDataSystemNotificationBus::Broadcast(
-                &SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId,
-                entry.m_bounds, entry.m_bounds, affectedSurfaceTags);
+            NotifySurfaceChanged(entry.m_entityId, entry.m_bounds, entry.m_bounds, affectedSurfaceTags);
         }
         return handle;
     }
@@ -197,9 +201,7 @@ namespace SurfaceData
 
             // Send in the entry's bounds as both the old and new bounds, since a null Aabb for old bounds
             // would cause a full refresh for any system listening, instead of just a refresh within the bounds.
-            SurfaceDataSystemNotificationBus::Broadcast(
-                &SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, entry.m_bounds, entry.m_bounds,
-                affectedSurfaceTags);
+            NotifySurfaceChanged(entry.m_entityId, entry.m_bounds, entry.m_bounds, affectedSurfaceTags);
         }
     }
 
@@ -227,9 +229,7 @@ namespace SurfaceData
 
         if (UpdateSurfaceDataModifierInternal(handle, entry, oldBounds))
         {
-            SurfaceDataSystemNotificationBus::Broadcast(
-                &SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, oldBounds, entry.m_bounds,
-                affectedSurfaceTags);
+            NotifySurfaceChanged(entry.m_entityId, oldBounds, entry.m_bounds, affectedSurfaceTags);
         }
     }
 
@@ -243,8 +243,7 @@ namespace SurfaceData
             // because the affected surface points have the potential of getting the modifier tags applied as well.
             SurfaceTagSet affectedSurfaceTags = GetAffectedSurfaceTags(dirtyBounds, entryItr->second.m_tags);
 
-            SurfaceDataSystemNotificationBus::Broadcast(
-                &SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, AZ::EntityId(), dirtyBounds, dirtyBounds, affectedSurfaceTags);
+            NotifySurfaceChanged(AZ::EntityId(), dirtyBounds, dirtyBounds, affectedSurfaceTags);
         }
 
     }
@@ -327,6 +326,141 @@ namespace SurfaceData
 
         AZStd::shared_lock<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
 
+        if (surfacedata_pointCacheEnabled)
+        {
+            GetCachedSurfacePoints(inPositions, inPositionBounds, desiredTags, surfacePointLists);
+        }
+        else
+        {
+            GenerateSurfacePoints(inPositions, inPositionBounds, desiredTags, surfacePointLists);
+        }
+    }
+
+    void SurfaceDataSystemComponent::GetCachedSurfacePoints(
+        AZStd::span<const AZ::Vector3> inPositions, const AZ::Aabb& inPositionBounds,
+        const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointLists) const
+    {
+        SURFACE_DATA_PROFILE_FUNCTION_VERBOSE
+
+        const bool useTagFilters = HasValidTags(desiredTags);
+        const bool hasModifierTags = useTagFilters && HasAnyMatchingTags(desiredTags, m_registeredModifierTags);
+
+        // Clear our output structure.
+        surfacePointLists.Clear();
+
+        // The query signature identifies the filter tags and the set of surface providers that can generate the points, using the same
+        // tag rules as GenerateSurfacePoints(). The provider bounds aren't part of the signature, since providers never generate points
+        // outside of their bounds, so queries with different bounds can share the cached points.
+        size_t querySignature = 0;
+        size_t maxPointsCreatedPerInput = 0;
+        for (const auto& [providerHandle, provider] : m_registeredSurfaceDataProviders)
+        {
+            if (!useTagFilters || hasModifierTags || HasAnyMatchingTags(desiredTags, provider.m_tags))
+            {
+                AZStd::hash_combine(querySignature, providerHandle);
+                if (!provider.m_bounds.IsValid() || AabbOverlaps2D(provider.m_bounds, inPositionBounds))
+                {
+                    maxPointsCreatedPerInput += provider.m_maxPointsCreatedPerInput;
+                }
+            }
+        }
+
+        // If we don't have any surface providers that will create any new surface points, then there's nothing more to do.
+        if (maxPointsCreatedPerInput == 0)
+        {
+            return;
+        }
+
+        if (useTagFilters)
+        {
+            for (const SurfaceTag& tag : desiredTags)
+            {
+                AZStd::hash_combine(querySignature, static_cast<AZ::u32>(tag));
+            }
+        }
+
+        // Only the points generated with the generation from before the query get stored, see SurfacePointCache::GetGeneration().
+        const uint64_t generation = m_pointCache.GetGeneration();
+
+        // The points of every input position, as a range of cachedPoints.
+        AZStd::vector<SurfacePointCache::CachedPoint> cachedPoints;
+        AZStd::vector<AZStd::pair<size_t, size_t>> pointRanges(inPositions.size());
+        AZStd::vector<AZ::Vector3> missingPositions;
+        AZStd::vector<size_t> missingIndices;
+        {
+            SURFACE_DATA_PROFILE_SCOPE_VERBOSE("GetCachedSurfacePoints: Find");
+            for (size_t index = 0; index < inPositions.size(); index++)
+            {
+                const size_t startIndex = cachedPoints.size();
+                if (m_pointCache.Find(inPositions[index], querySignature, cachedPoints))
+                {
+                    pointRanges[index] = { startIndex, cachedPoints.size() - startIndex };
+                }
+                else
+                {
+                    missingPositions.emplace_back(inPositions[index]);
+                    missingIndices.emplace_back(index);
+                }
+            }
+        }
+
+        if (!missingPositions.empty())
+        {
+            AZ::Aabb missingBounds = AZ::Aabb::CreateNull();
+            for (const AZ::Vector3& position : missingPositions)
+            {
+                missingBounds.AddPoint(position);
+            }
+
+            SurfacePointList generatedPoints;
+            GenerateSurfacePoints(missingPositions, missingBounds, desiredTags, generatedPoints);
+
+            // The generated list stays empty without any input positions if no provider overlaps the missing positions.
+            const bool hasGeneratedPoints = (generatedPoints.GetInputPositionSize() == missingPositions.size());
+            for (size_t missingIndex = 0; missingIndex < missingPositions.size(); missingIndex++)
+            {
+                const size_t startIndex = cachedPoints.size();
+                if (hasGeneratedPoints)
+                {
+                    generatedPoints.EnumeratePoints(
+                        missingIndex,
+                        [&cachedPoints](const AZ::Vector3& position, const AZ::Vector3& normal, const SurfaceTagWeights& surfaceWeights)
+                        {
+                            cachedPoints.push_back({ position, normal, surfaceWeights });
+                            return true;
+                        });
+                }
+
+                const size_t numPoints = cachedPoints.size() - startIndex;
+                pointRanges[missingIndices[missingIndex]] = { startIndex, numPoints };
+                m_pointCache.Store(
+                    missingPositions[missingIndex], querySignature,
+                    AZStd::span<const SurfacePointCache::CachedPoint>(cachedPoints.data() + startIndex, numPoints), generation);
+            }
+        }
+
+        // The cached points have already been modified and filtered, so they only need to be added to the output list.
+        // The creator entity of a point is only needed while the surface modifiers run, so it isn't cached.
+        SURFACE_DATA_PROFILE_SCOPE_VERBOSE("GetCachedSurfacePoints: AddSurfacePoints");
+        surfacePointLists.StartListConstruction(inPositions, maxPointsCreatedPerInput, {});
+        for (size_t index = 0; index < inPositions.size(); index++)
+        {
+            const auto& [startIndex, numPoints] = pointRanges[index];
+            for (size_t pointIndex = startIndex; pointIndex < (startIndex + numPoints); pointIndex++)
+            {
+                const SurfacePointCache::CachedPoint& point = cachedPoints[pointIndex];
+                surfacePointLists.AddSurfacePoint(AZ::EntityId(), inPositions[index], point.m_position, point.m_normal, point.m_weights);
+            }
+        }
+        surfacePointLists.EndListConstruction();
+    }
+
+    void SurfaceDataSystemComponent::GenerateSurfacePoints(
+        AZStd::span<const AZ::Vector3> inPositions, const AZ::Aabb& inPositionBounds,
+        const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointLists) const
+    {
+        SURFACE_DATA_PROFILE_FUNCTION_VERBOSE
+
         const bool useTagFilters = HasValidTags(desiredTags);
         const bool hasModifierTags = useTagFilters && HasAnyMatchingTags(desiredTags, m_registeredModifierTags);
 
@@ -378,14 +512,14 @@ namespace SurfaceData
         }
 
         {
-            SURFACE_DATA_PROFILE_SCOPE_VERBOSE("GetSurfacePointsFromListInternal: StartListConstruction");
+            SURFACE_DATA_PROFILE_SCOPE_VERBOSE("GenerateSurfacePoints: StartListConstruction");
             surfacePointLists.StartListConstruction(inPositions, maxPointsCreatedPerInput, tagFilters);
         }
 
         // Loop through each data provider and generate surface points from the set of input positions.
         // Any generated points that have the same XY coordinates and extremely similar Z values will get combined together.
         {
-            SURFACE_DATA_PROFILE_SCOPE_VERBOSE("GetSurfacePointsFromListInternal: GetSurfacePointsFromList");
+            SURFACE_DATA_PROFILE_SCOPE_VERBOSE("GenerateSurfacePoints: GetSurfacePointsFromList");
             for (const auto& [providerHandle, provider] : m_registeredSurfaceDataProviders)
             {
                 if (ProviderIsApplicable(provider))
@@ -402,7 +536,7 @@ namespace SurfaceData
         // are used to annotate points that occur within a volume.  A common example is marking points as "underwater" for points that occur
         // within a water volume.
         {
-            SURFACE_DATA_PROFILE_SCOPE_VERBOSE("GetSurfacePointsFromListInternal: ModifySurfaceWeights");
+            SURFACE_DATA_PROFILE_SCOPE_VERBOSE("GenerateSurfacePoints: ModifySurfaceWeights");
             for (const auto& [modifierHandle, modifier] : m_registeredSurfaceDataModifiers)
             {
                 bool hasInfiniteBounds = !modifier.m_bounds.IsValid();
@@ -421,6 +555,17 @@ namespace SurfaceData
         surfacePointLists.EndListConstruction();
     }
 
+    void SurfaceDataSystemComponent::NotifySurfaceChanged(
+        const AZ::EntityId& entityId, const AZ::Aabb& oldBounds, const AZ::Aabb& newBounds, const SurfaceTagSet& changedSurfaceTags)
+    {
+        // Invalidate the cached points before anyone gets notified, so listeners that query the surface right away get the new points.
+        m_pointCache.Invalidate(oldBounds);
+        m_pointCache.Invalidate(newBounds);
+
+        SurfaceDataSystemNotificationBus::Broadcast(
+            &SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entityId, oldBounds, newBounds, changedSurfaceTags);
+    }
+
     SurfaceDataRegistryHandle SurfaceDataSystemComponent::RegisterSurfaceDataProviderInternal(const SurfaceDataRegistryEntry& entry)
     {
         AZ_Assert(entry.m_maxPointsCreatedPerInput > 0, "Surface data providers should always create at least 1 point.");
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/hash.h>
+
+#include <SurfaceData/SurfacePointCache.h>
+
+namespace SurfaceData
+{
+    size_t SurfacePointCache::CellKeyHasher::operator()(const CellKey& key) const
+    {
+        size_t seed = 0;
+        AZStd::hash_combine(seed, key.m_cellX, key.m_cellY, key.m_querySignature);
+        return seed;
+    }
+
+    void SurfacePointCache::Reset(float cellSize, size_t maxCells)
+    {
+        AZ_Assert(cellSize > 0.0f, "The cell size of the surface point cache needs to be positive.");
+
+        AZStd::scoped_lock lock(m_mutex);
+        m_cells.clear();
+        m_cellLookup.clear();
+        m_cellSize = cellSize;
+        m_maxCells = maxCells;
+        m_generation++;
+    }
+
+    void SurfacePointCache::Clear()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_cells.clear();
+        m_cellLookup.clear();
+        m_generation++;
+    }
+
+    void SurfacePointCache::Invalidate(const AZ::Aabb& dirtyRegion)
+    {
+        if (!dirtyRegion.IsValid())
+        {
+            Clear();
+            return;
+        }
+
+        AZStd::scoped_lock lock(m_mutex);
+        m_generation++;
+        if (m_cells.empty())
+        {
+            return;
+        }
+
+        const int32_t minCellX = aznumeric_cast<int32_t>(floorf(dirtyRegion.GetMin().GetX() / m_cellSize));
+        const int32_t minCellY = aznumeric_cast<int32_t>(floorf(dirtyRegion.GetMin().GetY() / m_cellSize));
+        const int32_t maxCellX = aznumeric_cast<int32_t>(floorf(dirtyRegion.GetMax().GetX() / m_cellSize));
+        const int32_t maxCellY = aznumeric_cast<int32_t>(floorf(dirtyRegion.GetMax().GetY() / m_cellSize));
+
+        for (auto cell = m_cells.begin(); cell != m_cells.end();)
+        {
+            const CellKey& key = cell->m_key;
+            if ((key.m_cellX >= minCellX) && (key.m_cellX <= maxCellX) && (key.m_cellY >= minCellY) && (key.m_cellY <= maxCellY))
+            {
+                m_cellLookup.erase(key);
+                cell = m_cells.erase(cell);
+            }
+            else
+            {
+                ++cell;
+            }
+        }
+    }
+
+    bool SurfacePointCache::Find(const AZ::Vector3& inPosition, uint64_t querySignature, AZStd::vector<CachedPoint>& outPoints)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+
+        auto lookup = m_cellLookup.find(GetCellKey(inPosition, querySignature));
+        if (lookup == m_cellLookup.end())
+        {
+            return false;
+        }
+
+        // Move the cell to the front of the list to mark it as most recently used.
+        m_cells.splice(m_cells.begin(), m_cells, lookup->second);
+
+        const Cell& cell = *lookup->second;
+        auto entry = cell.m_inPositions.find(GetPositionKey(inPosition));
+        if (entry == cell.m_inPositions.end())
+        {
+            return false;
+        }
+
+        const auto pointsBegin = cell.m_points.begin() + entry->second.m_startIndex;
+        outPoints.insert(outPoints.end(), pointsBegin, pointsBegin + entry->second.m_numPoints);
+        return true;
+    }
+
+    uint64_t SurfacePointCache::GetGeneration() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return m_generation;
+    }
+
+    void SurfacePointCache::Store(
+        const AZ::Vector3& inPosition, uint64_t querySignature, AZStd::span<const CachedPoint> points, uint64_t generation)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+
+        if ((generation != m_generation) || (m_maxCells == 0))
+        {
+            return;
+        }
+
+        const CellKey key = GetCellKey(inPosition, querySignature);
+        auto lookup = m_cellLookup.find(key);
+        if (lookup == m_cellLookup.end())
+        {
+            // Reuse the least recently used cell when the cache is full, so the point buffers don't need to get reallocated.
+            if (m_cells.size() >= m_maxCells)
+            {
+                m_cellLookup.erase(m_cells.back().m_key);
+                m_cells.splice(m_cells.begin(), m_cells, AZStd::prev(m_cells.end()));
+            }
+            else
+            {
+                m_cells.emplace_front();
+            }
+
+            Cell& cell = m_cells.front();
+            cell.m_key = key;
+            cell.m_inPositions.clear();
+            cell.m_points.clear();
+            lookup = m_cellLookup.emplace(key, m_cells.begin()).first;
+        }
+
+        // Concurrent queries can generate the same input position, in which case the first stored points are kept.
+        Cell& cell = *lookup->second;
+        const PointRange range{ aznumeric_cast<uint32_t>(cell.m_points.size()), aznumeric_cast<uint32_t>(points.size()) };
+        if (cell.m_inPositions.emplace(GetPositionKey(inPosition), range).second)
+        {
+            cell.m_points.insert(cell.m_points.end(), points.begin(), points.end());
+        }
+    }
+
+    size_t SurfacePointCache::GetNumCells() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return m_cells.size();
+    }
+
+    uint64_t SurfacePointCache::GetPositionKey(const AZ::Vector3& inPosition)
+    {
+        // Turn -0 into +0, so both of them produce the same key.
+        const float x = (inPosition.GetX() == 0.0f) ? 0.0f : inPosition.GetX();
+        const float y = (inPosition.GetY() == 0.0f) ? 0.0f : inPosition.GetY();
+        uint32_t xBits, yBits;
+        memcpy(&xBits, &x, sizeof(xBits));
+        memcpy(&yBits, &y, sizeof(yBits));
+        return (static_cast<uint64_t>(xBits) << 32) | static_cast<uint64_t>(yBits);
+    }
+
+    SurfacePointCache::CellKey SurfacePointCache::GetCellKey(const AZ::Vector3& inPosition, uint64_t querySignature) const
+    {
+        CellKey key;
+        key.m_cellX = aznumeric_cast<int32_t>(floorf(inPosition.GetX() / m_cellSize));
+        key.m_cellY = aznumeric_cast<int32_t>(floorf(inPosition.GetY() / m_cellSize));
+        key.m_querySignature = querySignature;
+        return key;
+    }
+} // namespace SurfaceData
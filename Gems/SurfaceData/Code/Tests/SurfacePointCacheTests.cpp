@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+
+#include <SurfaceData/SurfacePointCache.h>
+
+namespace UnitTest
+{
+    class SurfacePointCacheTests
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        static SurfaceData::SurfacePointCache::CachedPoint CreatePoint(const AZ::Vector3& position)
+        {
+            SurfaceData::SurfacePointCache::CachedPoint point;
+            point.m_position = position;
+            point.m_normal = AZ::Vector3::CreateAxisZ();
+            point.m_weights.AddSurfaceTagWeight(AZ::Crc32("test_tag"), 1.0f);
+            return point;
+        }
+    };
+
+    TEST_F(SurfacePointCacheTests, StoredPointsCanBeFound)
+    {
+        constexpr uint64_t querySignature = 1;
+        SurfaceData::SurfacePointCache cache;
+        cache.Reset(16.0f, 4);
+
+        // Include negative positions and an input position without any points.
+        const AZ::Vector3 inPositions[] = { AZ::Vector3(0.0f, 0.0f, 0.0f), AZ::Vector3(10.5f, -3.0f, 0.0f), AZ::Vector3(-20.0f, -0.5f, 0.0f) };
+        const SurfaceData::SurfacePointCache::CachedPoint points[] = { CreatePoint(AZ::Vector3(0.0f, 0.0f, 5.0f)),
+                                                                       CreatePoint(AZ::Vector3(0.0f, 0.0f, 1.0f)) };
+        cache.Store(inPositions[0], querySignature, points, cache.GetGeneration());
+        cache.Store(inPositions[1], querySignature, AZStd::span<const SurfaceData::SurfacePointCache::CachedPoint>(points, 1), cache.GetGeneration());
+        cache.Store(inPositions[2], querySignature, {}, cache.GetGeneration());
+
+        AZStd::vector<SurfaceData::SurfacePointCache::CachedPoint> foundPoints;
+        EXPECT_TRUE(cache.Find(inPositions[0], querySignature, foundPoints));
+        ASSERT_EQ(foundPoints.size(), 2);
+        EXPECT_EQ(foundPoints[0].m_position, points[0].m_position);
+        EXPECT_EQ(foundPoints[1].m_position, points[1].m_position);
+        EXPECT_TRUE(foundPoints[1].m_weights.HasMatchingTag(AZ::Crc32("test_tag")));
+
+        // Found points get appended.
+        EXPECT_TRUE(cache.Find(inPositions[1], querySignature, foundPoints));
+        EXPECT_EQ(foundPoints.size(), 3);
+        EXPECT_TRUE(cache.Find(inPositions[2], querySignature, foundPoints));
+        EXPECT_EQ(foundPoints.size(), 3);
+
+        // A nearby position in the same cell and the same position with a different query signature were never stored.
+        EXPECT_FALSE(cache.Find(AZ::Vector3(0.5f, 0.0f, 0.0f), querySignature, foundPoints));
+        EXPECT_FALSE(cache.Find(inPositions[0], querySignature + 1, foundPoints));
+        EXPECT_EQ(foundPoints.size(), 3);
+    }
+
+    TEST_F(SurfacePointCacheTests, InvalidateRemovesOnlyOverlappingCells)
+    {
+        constexpr uint64_t querySignature = 1;
+        SurfaceData::SurfacePointCache cache;
+        cache.Reset(16.0f, 16);
+
+        const AZ::Vector3 inPosition1(1.0f, 1.0f, 0.0f);
+        const AZ::Vector3 inPosition2(65.0f, 1.0f, 0.0f);
+        const SurfaceData::SurfacePointCache::CachedPoint point = CreatePoint(inPosition1);
+        cache.Store(inPosition1, querySignature, { &point, 1 }, cache.GetGeneration());
+        cache.Store(inPosition2, querySignature, { &point, 1 }, cache.GetGeneration());
+        EXPECT_EQ(cache.GetNumCells(), 2);
+
+        cache.Invalidate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(2.0f)));
+
+        AZStd::vector<SurfaceData::SurfacePointCache::CachedPoint> foundPoints;
+        EXPECT_FALSE(cache.Find(inPosition1, querySignature, foundPoints));
+        EXPECT_TRUE(cache.Find(inPosition2, querySignature, foundPoints));
+        EXPECT_EQ(cache.GetNumCells(), 1);
+
+        // Invalid bounds are infinite and remove everything.
+        cache.Invalidate(AZ::Aabb::CreateNull());
+        EXPECT_EQ(cache.GetNumCells(), 0);
+    }
+
+    TEST_F(SurfacePointCacheTests, PointsFromBeforeAnInvalidationAreNotStored)
+    {
+        constexpr uint64_t querySignature = 1;
+        SurfaceData::SurfacePointCache cache;
+        cache.Reset(16.0f, 16);
+
+        // Simulate points that got generated while their region got invalidated.
+        const uint64_t generation = cache.GetGeneration();
+        cache.Invalidate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(100.0f), AZ::Vector3(200.0f)));
+        cache.Store(AZ::Vector3(1.0f), querySignature, {}, generation);
+
+        AZStd::vector<SurfaceData::SurfacePointCache::CachedPoint> foundPoints;
+        EXPECT_FALSE(cache.Find(AZ::Vector3(1.0f), querySignature, foundPoints));
+    }
+
+    TEST_F(SurfacePointCacheTests, LeastRecentlyUsedCellIsEvicted)
+    {
+        constexpr uint64_t querySignature = 1;
+        SurfaceData::SurfacePointCache cache;
+        cache.Reset(16.0f, 2);
+
+        const AZ::Vector3 inPosition1(0.0f, 0.0f, 0.0f);
+        const AZ::Vector3 inPosition2(16.0f, 0.0f, 0.0f);
+        const AZ::Vector3 inPosition3(32.0f, 0.0f, 0.0f);
+        cache.Store(inPosition1, querySignature, {}, cache.GetGeneration());
+        cache.Store(inPosition2, querySignature, {}, cache.GetGeneration());
+
+        // Touch the first cell, so the second one becomes the least recently used.
+        AZStd::vector<SurfaceData::SurfacePointCache::CachedPoint> foundPoints;
+        EXPECT_TRUE(cache.Find(inPosition1, querySignature, foundPoints));
+
+        cache.Store(inPosition3, querySignature, {}, cache.GetGeneration());
+        EXPECT_EQ(cache.GetNumCells(), 2);
+        EXPECT_TRUE(cache.Find(inPosition1, querySignature, foundPoints));
+        EXPECT_FALSE(cache.Find(inPosition2, querySignature, foundPoints));
+        EXPECT_TRUE(cache.Find(inPosition3, querySignature, foundPoints));
+    }
+} // namespace UnitTest
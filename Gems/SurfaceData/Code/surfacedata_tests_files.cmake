@@ -14,6 +14,7 @@ set(FILES
     Tests/SurfaceDataTest.cpp
     Tests/SurfaceDataTestFixtures.cpp
     Tests/SurfaceDataTestFixtures.h
+    Tests/SurfacePointCacheTests.cpp
     Source/SurfaceDataModule.cpp
     Source/SurfaceDataModule.h
 )
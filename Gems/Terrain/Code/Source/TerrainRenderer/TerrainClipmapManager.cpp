@@ -17,6 +17,16 @@
 
 namespace Terrain
 {
+    AZ_CVAR(
+        uint32_t,
+        r_terrainClipmapUpdateTexelBudget,
+        2u * 1024u * 1024u,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of texels per frame to regenerate in each of the macro and detail clipmap stacks when the view moves.\n"
+        "The coarsest level always gets updated, and finer levels that don't fit into the budget catch up in later frames.\n"
+        "0: unlimited");
+
     AZ_CVAR(
         uint32_t,
         r_terrainClipmapDebugOverlay,
@@ -644,11 +654,11 @@ namespace Terrain
         }
 
         // macro clipmap data:
+        UpdateClipmapBounds(currentViewPosition, uint32_t(r_terrainClipmapUpdateTexelBudget), m_macroClipmapBounds, m_macroClipmapUpdateRegions);
+
         for (uint32_t clipmapIndex = 0; clipmapIndex < m_macroClipmapStackSize; ++clipmapIndex)
         {
-            ClipmapBounds& clipmapBounds = m_macroClipmapBounds[clipmapIndex];
-
-            ClipmapBoundsRegionList updateRegionList = clipmapBounds.UpdateCenter(currentViewPosition);
+            const ClipmapBounds& clipmapBounds = m_macroClipmapBounds[clipmapIndex];
 
             // write updated center
             Vector2i center = clipmapBounds.GetModCenter();
@@ -658,15 +668,6 @@ namespace Terrain
             AZ::Vector2 centerWorld = clipmapBounds.GetCenterInWorldSpace();
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_macro[0] = centerWorld.GetX();
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_macro[1] = centerWorld.GetY();
-
-            for (uint32_t i = 0; i < updateRegionList.size(); ++i)
-            {
-                AZStd::array<uint32_t, 4> aabb = { aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_y),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_y) };
-                m_macroClipmapUpdateRegions.push_back(ClipmapUpdateRegion(clipmapIndex, aabb));
-            }
         }
 
         uint32_t updateRegionCount = aznumeric_cast<uint32_t>(m_macroClipmapUpdateRegions.size());
@@ -690,11 +691,11 @@ namespace Terrain
         }
 
         // detail clipmap data:
+        UpdateClipmapBounds(currentViewPosition, uint32_t(r_terrainClipmapUpdateTexelBudget), m_detailClipmapBounds, m_detailClipmapUpdateRegions);
+
         for (uint32_t clipmapIndex = 0; clipmapIndex < m_detailClipmapStackSize; ++clipmapIndex)
         {
-            ClipmapBounds& clipmapBounds = m_detailClipmapBounds[clipmapIndex];
-
-            ClipmapBoundsRegionList updateRegionList = clipmapBounds.UpdateCenter(currentViewPosition);
+            const ClipmapBounds& clipmapBounds = m_detailClipmapBounds[clipmapIndex];
 
             // write updated center
             Vector2i center = clipmapBounds.GetModCenter();
@@ -704,15 +705,6 @@ namespace Terrain
             AZ::Vector2 centerWorld = clipmapBounds.GetCenterInWorldSpace();
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_detail[0] = centerWorld.GetX();
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_detail[1] = centerWorld.GetY();
-
-            for (uint32_t i = 0; i < updateRegionList.size(); ++i)
-            {
-                AZStd::array<uint32_t, 4> aabb = { aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_y),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_y) };
-                m_detailClipmapUpdateRegions.push_back(ClipmapUpdateRegion(clipmapIndex, aabb));
-            }
         }
 
         updateRegionCount = aznumeric_cast<uint32_t>(m_detailClipmapUpdateRegions.size());
@@ -736,6 +728,49 @@ namespace Terrain
         }
     }
 
+    void TerrainClipmapManager::UpdateClipmapBounds(
+        const AZ::Vector2& viewPosition,
+        uint32_t texelBudget,
+        AZStd::vector<ClipmapBounds>& clipmapBoundsList,
+        AZStd::vector<ClipmapUpdateRegion>& outUpdateRegions)
+    {
+        // Go from the coarsest level, which is the fall back for everything and always gets updated, to the finest level.
+        uint32_t updatedTexels = 0;
+        for (int32_t clipmapIndex = aznumeric_cast<int32_t>(clipmapBoundsList.size()) - 1; clipmapIndex >= 0; --clipmapIndex)
+        {
+            ClipmapBounds updatedBounds = clipmapBoundsList[clipmapIndex];
+            ClipmapBoundsRegionList updateRegionList = updatedBounds.UpdateCenter(viewPosition);
+
+            uint32_t regionTexels = 0;
+            for (const ClipmapBoundsRegion& region : updateRegionList)
+            {
+                regionTexels += aznumeric_cast<uint32_t>(
+                    (region.m_localAabb.m_max.m_x - region.m_localAabb.m_min.m_x) *
+                    (region.m_localAabb.m_max.m_y - region.m_localAabb.m_min.m_y));
+            }
+
+            // Once the budget is used up, leave this level and all the finer ones at their current centers. Their contents stay
+            // valid for those centers, so they catch up in later frames while the shaders use the coarser levels near the view.
+            const bool isCoarsestLevel = (clipmapIndex == aznumeric_cast<int32_t>(clipmapBoundsList.size()) - 1);
+            if (texelBudget > 0 && !isCoarsestLevel && (updatedTexels + regionTexels > texelBudget))
+            {
+                break;
+            }
+
+            clipmapBoundsList[clipmapIndex] = updatedBounds;
+            updatedTexels += regionTexels;
+
+            for (const ClipmapBoundsRegion& region : updateRegionList)
+            {
+                AZStd::array<uint32_t, 4> aabb = { aznumeric_cast<uint32_t>(region.m_localAabb.m_min.m_x),
+                                                   aznumeric_cast<uint32_t>(region.m_localAabb.m_min.m_y),
+                                                   aznumeric_cast<uint32_t>(region.m_localAabb.m_max.m_x),
+                                                   aznumeric_cast<uint32_t>(region.m_localAabb.m_max.m_y) };
+                outUpdateRegions.push_back(ClipmapUpdateRegion(aznumeric_cast<uint32_t>(clipmapIndex), aabb));
+            }
+        }
+    }
+
     AZ::Data::Instance<AZ::RPI::AttachmentImage> TerrainClipmapManager::GetClipmapImage(ClipmapName clipmapName) const
     {
         AZ_Assert(clipmapName < ClipmapName::Count, "Must be a valid ClipmapName enum.");
@@ -337,6 +337,13 @@ namespace Terrain
         AZStd::vector<ClipmapUpdateRegion> m_macroClipmapUpdateRegions;
         AZStd::vector<ClipmapUpdateRegion> m_detailClipmapUpdateRegions;
 
+        //! Move the clipmap centers to the view position and gather the regions to regenerate, within the given texel budget.
+        static void UpdateClipmapBounds(
+            const AZ::Vector2& viewPosition,
+            uint32_t texelBudget,
+            AZStd::vector<ClipmapBounds>& clipmapBoundsList,
+            AZStd::vector<ClipmapUpdateRegion>& outUpdateRegions);
+
         //! Terrain SRG input.
         AZ::RHI::ShaderInputNameIndex m_terrainSrgClipmapDataIndex = ClipmapDataShaderInput;
         AZ::RHI::ShaderInputNameIndex m_terrainSrgClipmapImageIndex[ClipmapName::Count];
@@ -158,6 +158,7 @@ namespace Terrain
         }
         m_candidateSectors.clear();
         m_sectorsThatNeedSrgCompiled.clear();
+        ClearQueuedSectorUpdates();
         RemoveRayTracedMeshes();
         m_sectorLods.clear();
         m_xyPositions.clear();
@@ -213,10 +214,6 @@ namespace Terrain
 
     void TerrainMeshManager::CheckLodGridsForUpdate(AZ::Vector3 newPosition)
     {
-        // lods of sectors that need updating, separated by LOD level.
-        AZStd::vector<AZStd::vector<Sector*>> sectorsToUpdate(m_sectorLods.size());
-        bool anySectorsUpdated = false;
-
         for (uint32_t lodLevel = 0; lodLevel < m_sectorLods.size(); ++lodLevel)
         {
             SectorLodGrid& lodGrid = m_sectorLods.at(lodLevel);
@@ -267,20 +264,44 @@ namespace Terrain
                         if (sector.m_worldCoord != worldCoord)
                         {
                             sector.m_worldCoord = worldCoord;
-                            sectorsToUpdate.at(lodLevel).push_back(&sector);
-                            anySectorsUpdated = true;
+                            QueueSectorUpdate(sector, lodLevel);
                         }
                     }
                 }
             }
         }
+    }
 
-        if (anySectorsUpdated)
+    void TerrainMeshManager::QueueSectorUpdate(Sector& sector, uint32_t lodLevel)
+    {
+        if (!sector.m_isQueuedForUpdate)
         {
-            ProcessSectorUpdates(sectorsToUpdate);
-            return;
+            sector.m_isQueuedForUpdate = true;
+            m_queuedSectorUpdates.at(lodLevel).push_back(&sector);
+            m_hasQueuedSectorUpdates = true;
+        }
+    }
+
+    void TerrainMeshManager::ClearQueuedSectorUpdates()
+    {
+        for (AZStd::vector<Sector*>& sectors : m_queuedSectorUpdates)
+        {
+            for (Sector* sector : sectors)
+            {
+                sector->m_isQueuedForUpdate = false;
+            }
+            sectors.clear();
         }
+        m_hasQueuedSectorUpdates = false;
+    }
 
+    void TerrainMeshManager::ProcessQueuedSectorUpdates()
+    {
+        if (m_hasQueuedSectorUpdates)
+        {
+            ProcessSectorUpdates(m_queuedSectorUpdates);
+            ClearQueuedSectorUpdates();
+        }
     }
 
     AZ::RHI::StreamBufferView TerrainMeshManager::CreateStreamBufferView(AZ::Data::Instance<AZ::RPI::Buffer>& buffer, uint32_t offset)
@@ -440,10 +461,12 @@ namespace Terrain
         m_sectorLods.clear();
         m_candidateSectors.clear();
         m_sectorsThatNeedSrgCompiled.clear();
+        ClearQueuedSectorUpdates();
         RemoveRayTracedMeshes();
 
         const uint8_t lodCount = aznumeric_cast<uint8_t>(AZStd::ceilf(log2f(AZStd::GetMax(1.0f, m_config.m_renderDistance / m_config.m_firstLodDistance)) + 1.0f));
         m_sectorLods.reserve(lodCount);
+        m_queuedSectorUpdates.resize(lodCount);
         
         // Create all the sectors with uninitialized SRGs. The SRGs will be updated later by CheckLodGridsForUpdate().
         m_indexBufferView =
@@ -497,6 +520,7 @@ namespace Terrain
     {
         AZ::Vector3 mainCameraPosition = mainView->GetCameraTransform().GetTranslation();
         CheckLodGridsForUpdate(mainCameraPosition);
+        ProcessQueuedSectorUpdates();
 
         for (Sector* sector : m_sectorsThatNeedSrgCompiled)
         {
@@ -634,6 +658,7 @@ namespace Terrain
 
     void TerrainMeshManager::OnTerrainDataDestroyBegin()
     {
+        ClearQueuedSectorUpdates();
         m_sectorLods.clear();
         m_candidateSectors.clear();
         m_sectorsThatNeedSrgCompiled.clear();
@@ -665,18 +690,14 @@ namespace Terrain
             {
                 if (!m_rebuildSectors)
                 {
-                    // Rebuild any sectors in the dirty region if they aren't all being rebuilt
-                    AZStd::vector<AZStd::vector<Sector*>> sectorsToUpdate(m_sectorLods.size());
+                    // Queue any sectors in the dirty region if they aren't all being rebuilt. Terrain data often changes several
+                    // times per frame while editing, so the sectors are only regenerated once during the next DrawMeshes().
                     ForOverlappingSectors(dirtyRegion,
-                        [&sectorsToUpdate](Sector& sectorData, uint32_t lodLevel)
+                        [this](Sector& sectorData, uint32_t lodLevel)
                         {
-                            sectorsToUpdate.at(lodLevel).push_back(&sectorData);
+                            QueueSectorUpdate(sectorData, lodLevel);
                         }
                     );
-                    if (!sectorsToUpdate.empty())
-                    {
-                        ProcessSectorUpdates(sectorsToUpdate);
-                    }
                 }
             }
         }
@@ -1134,6 +1155,7 @@ namespace Terrain
                 sector->m_srg->SetConstant(m_patchDataIndex, objectSrgData);
                 if (!sector->m_isQueuedForSrgCompile)
                 {
+                    sector->m_isQueuedForSrgCompile = true;
                     m_sectorsThatNeedSrgCompiled.push_back(sector);
                 }
                 sector->m_hasData = false; // mark the terrain as not having data for now. Once a job runs if it actually has data it'll flip to true.
@@ -172,6 +172,7 @@ namespace Terrain
 
             bool m_hasData = false;
             bool m_isQueuedForSrgCompile = false;
+            bool m_isQueuedForUpdate = false;
         };
 
         struct SectorLodGrid
@@ -269,6 +270,9 @@ namespace Terrain
         void GatherMeshData(SectorDataRequest request, AZStd::vector<HeightNormalVertex>& meshHeightsNormals, AZ::Aabb& meshAabb, bool& terrainExistsAnywhere);
 
         void CheckLodGridsForUpdate(AZ::Vector3 newPosition);
+        void QueueSectorUpdate(Sector& sector, uint32_t lodLevel);
+        void ClearQueuedSectorUpdates();
+        void ProcessQueuedSectorUpdates();
         void ProcessSectorUpdates(AZStd::vector<AZStd::vector<Sector*>>& sectorUpdates);
 
         AZ::Data::Instance<AZ::RPI::Buffer> CreateMeshBufferInstance(
@@ -310,6 +314,11 @@ namespace Terrain
         AZStd::vector<SectorLodGrid> m_sectorLods;
         AZStd::vector<CandidateSector> m_candidateSectors;
         AZStd::vector<Sector*> m_sectorsThatNeedSrgCompiled;
+
+        // Sectors that need their mesh data regenerated, separated by LOD level. Updates from camera movement and from terrain
+        // data changes are collected here and processed together once per frame, so a sector is never regenerated twice in a frame.
+        AZStd::vector<AZStd::vector<Sector*>> m_queuedSectorUpdates;
+        bool m_hasQueuedSectorUpdates = false;
         uint32_t m_1dSectorCount = 0;
 
         // Sector x/y positions used to make it easier to calculate x/y positions for ray tracing meshes. This is particularly
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace Terrain
+{
+    //! A cache of terrain values evaluated at the points of a terrain query grid.
+    //! The grid points are grouped into square tiles, and the least recently used tile gets evicted once the maximum number of tiles
+    //! is reached. Values are only valid until a region containing them gets invalidated, which the terrain system does with the same
+    //! dirty regions that it sends out through OnTerrainDataChanged.
+    //! All methods are thread-safe so that the cache can be used from the terrain query jobs.
+    template<typename ValueType>
+    class TerrainQueryCache
+    {
+    public:
+        static constexpr int32_t TileSize = 32;
+
+        //! Remove all cached values and set up the grid.
+        //! @param queryResolution The distance between two grid points in meters.
+        //! @param maxTiles The maximum number of tiles kept in the cache.
+        void Reset(float queryResolution, size_t maxTiles);
+
+        //! Remove all cached values.
+        void Clear();
+
+        //! Remove the cached values of all tiles that overlap the 2D bounds of the given region.
+        void Invalidate(const AZ::Aabb& dirtyRegion);
+
+        //! Look up the cached value for a position on the query grid.
+        //! @return True if the value was found in the cache.
+        bool Find(const AZ::Vector2& gridPosition, ValueType& outValue);
+
+        //! Get the current generation, which changes every time values get invalidated.
+        //! Values that got evaluated outside of the cache should only be stored with the generation from before their evaluation,
+        //! so that values evaluated during an invalidation never end up in the cache.
+        uint64_t GetGeneration() const;
+
+        //! Store a value for a position on the query grid, unless the cache got invalidated since the given generation.
+        void Store(const AZ::Vector2& gridPosition, const ValueType& value, uint64_t generation);
+
+        float GetQueryResolution() const;
+        size_t GetNumTiles() const;
+
+    private:
+        struct Tile
+        {
+            uint64_t m_key = 0;
+            int32_t m_tileX = 0;
+            int32_t m_tileY = 0;
+            AZStd::vector<ValueType> m_values;
+            AZStd::vector<bool> m_valid;
+        };
+        using TileList = AZStd::list<Tile>;
+
+        static uint64_t GetTileKey(int32_t tileX, int32_t tileY);
+        static int32_t FloorDivide(int32_t value, int32_t divisor);
+        void GetGridIndices(const AZ::Vector2& gridPosition, int32_t& outX, int32_t& outY) const;
+
+        mutable AZStd::mutex m_mutex;
+        TileList m_tiles; //!< Sorted from most to least recently used.
+        AZStd::unordered_map<uint64_t, typename TileList::iterator> m_tileLookup;
+        float m_queryResolution = 1.0f;
+        size_t m_maxTiles = 0;
+        uint64_t m_generation = 0;
+    };
+
+    template<typename ValueType>
+    void TerrainQueryCache<ValueType>::Reset(float queryResolution, size_t maxTiles)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_tiles.clear();
+        m_tileLookup.clear();
+        m_queryResolution = queryResolution;
+        m_maxTiles = maxTiles;
+        m_generation++;
+    }
+
+    template<typename ValueType>
+    void TerrainQueryCache<ValueType>::Clear()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_tiles.clear();
+        m_tileLookup.clear();
+        m_generation++;
+    }
+
+    template<typename ValueType>
+    void TerrainQueryCache<ValueType>::Invalidate(const AZ::Aabb& dirtyRegion)
+    {
+        if (!dirtyRegion.IsValid())
+        {
+            return;
+        }
+
+        AZStd::scoped_lock lock(m_mutex);
+        m_generation++;
+        if (m_tiles.empty())
+        {
+            return;
+        }
+
+        // Grid points on the edge of the region are affected as well, so round the region outwards to whole grid points.
+        const int32_t minX = aznumeric_cast<int32_t>(floorf(dirtyRegion.GetMin().GetX() / m_queryResolution));
+        const int32_t minY = aznumeric_cast<int32_t>(floorf(dirtyRegion.GetMin().GetY() / m_queryResolution));
+        const int32_t maxX = aznumeric_cast<int32_t>(ceilf(dirtyRegion.GetMax().GetX() / m_queryResolution));
+        const int32_t maxY = aznumeric_cast<int32_t>(ceilf(dirtyRegion.GetMax().GetY() / m_queryResolution));
+        const int32_t minTileX = FloorDivide(minX, TileSize);
+        const int32_t minTileY = FloorDivide(minY, TileSize);
+        const int32_t maxTileX = FloorDivide(maxX, TileSize);
+        const int32_t maxTileY = FloorDivide(maxY, TileSize);
+
+        for (auto tile = m_tiles.begin(); tile != m_tiles.end();)
+        {
+            if ((tile->m_tileX >= minTileX) && (tile->m_tileX <= maxTileX) && (tile->m_tileY >= minTileY) && (tile->m_tileY <= maxTileY))
+            {
+                m_tileLookup.erase(tile->m_key);
+                tile = m_tiles.erase(tile);
+            }
+            else
+            {
+                ++tile;
+            }
+        }
+    }
+
+    template<typename ValueType>
+    bool TerrainQueryCache<ValueType>::Find(const AZ::Vector2& gridPosition, ValueType& outValue)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+
+        int32_t x, y;
+        GetGridIndices(gridPosition, x, y);
+        const int32_t tileX = FloorDivide(x, TileSize);
+        const int32_t tileY = FloorDivide(y, TileSize);
+        const size_t index = ((y - tileY * TileSize) * TileSize) + (x - tileX * TileSize);
+
+        auto lookup = m_tileLookup.find(GetTileKey(tileX, tileY));
+        if (lookup == m_tileLookup.end())
+        {
+            return false;
+        }
+
+        // Move the tile to the front of the list to mark it as most recently used.
+        m_tiles.splice(m_tiles.begin(), m_tiles, lookup->second);
+
+        const Tile& tile = *lookup->second;
+        if (!tile.m_valid[index])
+        {
+            return false;
+        }
+
+        outValue = tile.m_values[index];
+        return true;
+    }
+
+    template<typename ValueType>
+    uint64_t TerrainQueryCache<ValueType>::GetGeneration() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return m_generation;
+    }
+
+    template<typename ValueType>
+    void TerrainQueryCache<ValueType>::Store(const AZ::Vector2& gridPosition, const ValueType& value, uint64_t generation)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+
+        int32_t x, y;
+        GetGridIndices(gridPosition, x, y);
+        const int32_t tileX = FloorDivide(x, TileSize);
+        const int32_t tileY = FloorDivide(y, TileSize);
+        const size_t index = ((y - tileY * TileSize) * TileSize) + (x - tileX * TileSize);
+        const uint64_t key = GetTileKey(tileX, tileY);
+
+        if ((generation != m_generation) || (m_maxTiles == 0))
+        {
+            return;
+        }
+
+        auto lookup = m_tileLookup.find(key);
+        if (lookup == m_tileLookup.end())
+        {
+            // Reuse the least recently used tile when the cache is full, so the value buffers don't need to get reallocated.
+            if (m_tiles.size() >= m_maxTiles)
+            {
+                m_tileLookup.erase(m_tiles.back().m_key);
+                m_tiles.splice(m_tiles.begin(), m_tiles, AZStd::prev(m_tiles.end()));
+            }
+            else
+            {
+                m_tiles.emplace_front();
+                m_tiles.front().m_values.resize(TileSize * TileSize);
+                m_tiles.front().m_valid.resize(TileSize * TileSize);
+            }
+
+            Tile& tile = m_tiles.front();
+            tile.m_key = key;
+            tile.m_tileX = tileX;
+            tile.m_tileY = tileY;
+            AZStd::fill(tile.m_valid.begin(), tile.m_valid.end(), false);
+            lookup = m_tileLookup.emplace(key, m_tiles.begin()).first;
+        }
+
+        Tile& tile = *lookup->second;
+        tile.m_values[index] = value;
+        tile.m_valid[index] = true;
+    }
+
+    template<typename ValueType>
+    float TerrainQueryCache<ValueType>::GetQueryResolution() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return m_queryResolution;
+    }
+
+    template<typename ValueType>
+    size_t TerrainQueryCache<ValueType>::GetNumTiles() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return m_tiles.size();
+    }
+
+    template<typename ValueType>
+    uint64_t TerrainQueryCache<ValueType>::GetTileKey(int32_t tileX, int32_t tileY)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(tileX)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(tileY));
+    }
+
+    template<typename ValueType>
+    int32_t TerrainQueryCache<ValueType>::FloorDivide(int32_t value, int32_t divisor)
+    {
+        // Integer division rounds towards zero, but the tiles need to be rounded down for negative grid indices as well.
+        return (value >= 0) ? (value / divisor) : ((value - divisor + 1) / divisor);
+    }
+
+    template<typename ValueType>
+    void TerrainQueryCache<ValueType>::GetGridIndices(const AZ::Vector2& gridPosition, int32_t& outX, int32_t& outY) const
+    {
+        // The positions are expected to be on the grid already, so rounding only removes floating point error.
+        outX = aznumeric_cast<int32_t>(floorf((gridPosition.GetX() / m_queryResolution) + 0.5f));
+        outY = aznumeric_cast<int32_t>(floorf((gridPosition.GetY() / m_queryResolution) + 0.5f));
+    }
+} // namespace Terrain
@@ -7,6 +7,7 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/sort.h>
 #include <SurfaceData/SurfaceDataTypes.h>
@@ -25,6 +26,14 @@ using namespace Terrain;
 
 AZ_DEFINE_BUDGET(Terrain);
 
+AZ_CVAR(bool,
+    terrain_queryCacheEnabled,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Cache the terrain heights and surface weights evaluated on the query grids, so repeated queries of a region become memory reads."
+);
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/key lookup.
@@ -88,6 +97,7 @@ void TerrainSystem::Activate()
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = true;
     m_cachedAreaBounds = AZ::Aabb::CreateNull();
+    ResetQueryCaches();
 
     {
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
@@ -138,6 +148,8 @@ void TerrainSystem::Deactivate()
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = false;
+    m_heightCache.Clear();
+    m_surfaceWeightsCache.Clear();
 
     AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
         &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataDestroyEnd);
@@ -295,6 +307,18 @@ AZ::Aabb TerrainSystem::ClampZBoundsToHeightBounds(const AZ::Aabb& aabb) const
     return AZ::Aabb::CreateFromMinMax(min, max);
 }
 
+void TerrainSystem::InvalidateQueryCaches(const AZ::Aabb& dirtyRegion)
+{
+    m_heightCache.Invalidate(dirtyRegion);
+    m_surfaceWeightsCache.Invalidate(dirtyRegion);
+}
+
+void TerrainSystem::ResetQueryCaches()
+{
+    m_heightCache.Reset(m_currentSettings.m_heightQueryResolution, MaxHeightCacheTiles);
+    m_surfaceWeightsCache.Reset(m_currentSettings.m_surfaceDataQueryResolution, MaxSurfaceWeightsCacheTiles);
+}
+
 // Generate positions to be queried based on the sampler type.
 void TerrainSystem::GenerateQueryPositions(const AZStd::span<const AZ::Vector3>& inPositions,
     AZStd::vector<AZ::Vector3>& outPositions, float queryResolution,
@@ -481,7 +505,52 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
 
     // This will be unused for heights. It's fine if it's empty.
     AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
-    MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+
+    // Positions on the query grid can be read from the height cache, so only the positions missing from the cache need to be queried.
+    const bool useCache = terrain_queryCacheEnabled && (sampler != AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+    if (!useCache)
+    {
+        MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+    }
+    else
+    {
+        const uint64_t cacheGeneration = m_heightCache.GetGeneration();
+        AZStd::vector<size_t> uncachedIndices;
+        AZStd::vector<AZ::Vector3> uncachedPositions;
+        for (size_t index = 0; index < outPositions.size(); index++)
+        {
+            CachedHeight cachedHeight;
+            if (m_heightCache.Find(AZ::Vector2(outPositions[index]), cachedHeight))
+            {
+                outPositions[index].SetZ(cachedHeight.m_height);
+                outTerrainExists[index] = cachedHeight.m_terrainExists;
+            }
+            else
+            {
+                uncachedIndices.emplace_back(index);
+                uncachedPositions.emplace_back(outPositions[index]);
+            }
+        }
+
+        if (!uncachedPositions.empty())
+        {
+            AZStd::vector<bool> uncachedTerrainExists(uncachedPositions.size(), false);
+            MakeBulkQueries(uncachedPositions, uncachedPositions, uncachedTerrainExists, outSurfaceWeights, callback);
+
+            for (size_t i = 0; i < uncachedIndices.size(); i++)
+            {
+                const size_t index = uncachedIndices[i];
+                outPositions[index] = uncachedPositions[i];
+                outTerrainExists[index] = uncachedTerrainExists[i];
+
+                // The height of holes differs between the single and the bulk height queries, so only cache the values both agree on.
+                if (uncachedTerrainExists[i])
+                {
+                    m_heightCache.Store(AZ::Vector2(uncachedPositions[i]), { uncachedPositions[i].GetZ(), true }, cacheGeneration);
+                }
+            }
+        }
+    }
 
     // Compute/store the final result
     for (size_t i = 0, iteratorIndex = 0; i < inPositions.size(); i++, iteratorIndex += indexStepSize)
@@ -543,10 +612,10 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             const AZ::Vector2 pos1 = pos0 + AZ::Vector2(queryResolution);
 
             AZStd::array<bool,4> exists = { false, false, false, false };
-            const AZStd::array<float, 4> queriedHeights = { GetTerrainAreaHeight(pos0.GetX(), pos0.GetY(), exists[0]),
-                                                            GetTerrainAreaHeight(pos1.GetX(), pos0.GetY(), exists[1]),
-                                                            GetTerrainAreaHeight(pos0.GetX(), pos1.GetY(), exists[2]),
-                                                            GetTerrainAreaHeight(pos1.GetX(), pos1.GetY(), exists[3]) };
+            const AZStd::array<float, 4> queriedHeights = { GetTerrainAreaHeightOnGrid(pos0.GetX(), pos0.GetY(), exists[0]),
+                                                            GetTerrainAreaHeightOnGrid(pos1.GetX(), pos0.GetY(), exists[1]),
+                                                            GetTerrainAreaHeightOnGrid(pos0.GetX(), pos1.GetY(), exists[2]),
+                                                            GetTerrainAreaHeightOnGrid(pos1.GetX(), pos1.GetY(), exists[3]) };
 
             InterpolateHeights(queriedHeights, exists, normalizedDelta.GetX(), normalizedDelta.GetY(), height, terrainExists);
         }
@@ -558,7 +627,7 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             AZ::Vector2 clampedPosition;
             RoundPosition(x, y, queryResolution, clampedPosition);
 
-            height = GetTerrainAreaHeight(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists);
+            height = GetTerrainAreaHeightOnGrid(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists);
         }
         break;
 
@@ -614,6 +683,32 @@ float TerrainSystem::GetTerrainAreaHeight(float x, float y, bool& terrainExists)
     return height;
 }
 
+float TerrainSystem::GetTerrainAreaHeightOnGrid(float x, float y, bool& terrainExists) const
+{
+    if (!terrain_queryCacheEnabled)
+    {
+        return GetTerrainAreaHeight(x, y, terrainExists);
+    }
+
+    const AZ::Vector2 gridPosition(x, y);
+    CachedHeight cachedHeight;
+    if (m_heightCache.Find(gridPosition, cachedHeight))
+    {
+        terrainExists = cachedHeight.m_terrainExists;
+        return cachedHeight.m_height;
+    }
+
+    const uint64_t cacheGeneration = m_heightCache.GetGeneration();
+    const float height = GetTerrainAreaHeight(x, y, terrainExists);
+
+    // The height of holes differs between the single and the bulk height queries, so only cache the values both agree on.
+    if (terrainExists)
+    {
+        m_heightCache.Store(gridPosition, { height, terrainExists }, cacheGeneration);
+    }
+    return height;
+}
+
 float TerrainSystem::GetHeight(const AZ::Vector3& position, Sampler sampler, bool* terrainExistsPtr) const
 {
     return GetHeightSynchronous(position.GetX(), position.GetY(), sampler, terrainExistsPtr);
@@ -1305,7 +1400,40 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
     
     // This will be unused for surface weights. It's fine if it's empty.
     AZStd::vector<AZ::Vector3> outPositions;
-    MakeBulkQueries(queryPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+
+    // Positions on the query grid can be read from the surface weights cache, so only the positions missing from the cache need to be queried.
+    const bool useCache = terrain_queryCacheEnabled && (querySampler != Sampler::EXACT);
+    if (!useCache)
+    {
+        MakeBulkQueries(queryPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+        return;
+    }
+
+    const uint64_t cacheGeneration = m_surfaceWeightsCache.GetGeneration();
+    AZStd::vector<size_t> uncachedIndices;
+    AZStd::vector<AZ::Vector3> uncachedPositions;
+    for (size_t index = 0; index < queryPositions.size(); index++)
+    {
+        if (!m_surfaceWeightsCache.Find(AZ::Vector2(queryPositions[index]), outSurfaceWeightsList[index]))
+        {
+            uncachedIndices.emplace_back(index);
+            uncachedPositions.emplace_back(queryPositions[index]);
+        }
+    }
+
+    if (uncachedPositions.empty())
+    {
+        return;
+    }
+
+    AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> uncachedSurfaceWeights(uncachedPositions.size());
+    MakeBulkQueries(uncachedPositions, outPositions, terrainExists, uncachedSurfaceWeights, callback);
+
+    for (size_t i = 0; i < uncachedIndices.size(); i++)
+    {
+        outSurfaceWeightsList[uncachedIndices[i]] = uncachedSurfaceWeights[i];
+        m_surfaceWeightsCache.Store(AZ::Vector2(uncachedPositions[i]), uncachedSurfaceWeights[i], cacheGeneration);
+    }
 }
 
 void TerrainSystem::GetOrderedSurfaceWeights(
@@ -1350,19 +1478,29 @@ void TerrainSystem::GetOrderedSurfaceWeights(
         break;
     }
 
+    const bool useCache = terrain_queryCacheEnabled && (sampler != AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+    if (useCache && m_surfaceWeightsCache.Find(AZ::Vector2(inPosition), outSurfaceWeights))
+    {
+        return;
+    }
+    const uint64_t cacheGeneration = m_surfaceWeightsCache.GetGeneration();
+
     AZ::Aabb bounds;
     AZ::EntityId bestAreaId = FindBestAreaEntityAtPosition(inPosition, bounds);
 
-    if (!bestAreaId.IsValid())
+    if (bestAreaId.IsValid())
     {
-        return;
-    }
+        // Get all the surfaces with weights at the given point.
+        Terrain::TerrainAreaSurfaceRequestBus::Event(
+            bestAreaId, &Terrain::TerrainAreaSurfaceRequestBus::Events::GetSurfaceWeights, inPosition, outSurfaceWeights);
 
-    // Get all the surfaces with weights at the given point.
-    Terrain::TerrainAreaSurfaceRequestBus::Event(
-        bestAreaId, &Terrain::TerrainAreaSurfaceRequestBus::Events::GetSurfaceWeights, inPosition, outSurfaceWeights);
+        AZStd::sort(outSurfaceWeights.begin(), outSurfaceWeights.end(), AzFramework::SurfaceData::SurfaceTagWeightComparator());
+    }
 
-    AZStd::sort(outSurfaceWeights.begin(), outSurfaceWeights.end(), AzFramework::SurfaceData::SurfaceTagWeightComparator());
+    if (useCache)
+    {
+        m_surfaceWeightsCache.Store(AZ::Vector2(inPosition), outSurfaceWeights, cacheGeneration);
+    }
 }
 
 void TerrainSystem::GetSurfaceWeights(
@@ -1686,6 +1824,7 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
 
     m_registeredAreas[areaId] = { aabb, useGroundPlane };
     m_dirtyRegion.AddAabb(aabb);
+    InvalidateQueryCaches(aabb);
     m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
         AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
     m_cachedAreaBounds.AddAabb(aabb);
@@ -1706,6 +1845,7 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
             if (areaId == entityId)
             {
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
+                InvalidateQueryCaches(areaData.m_areaBounds);
                 m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
                     AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
 
@@ -1760,6 +1900,7 @@ void TerrainSystem::RefreshRegion(
     const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask)
 {
     m_dirtyRegion.AddAabb(dirtyRegion);
+    InvalidateQueryCaches(dirtyRegion);
 
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
     m_terrainDirtyMask |= changeMask;
@@ -1804,6 +1945,9 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+
+        // The query resolutions or the height range might have changed, which affects every cached value.
+        ResetQueryCaches();
     }
 
     if (terrainSettingsChanged || (m_terrainDirtyMask != AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::None))
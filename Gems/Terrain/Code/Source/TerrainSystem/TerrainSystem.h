@@ -25,6 +25,7 @@
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
+#include <TerrainSystem/TerrainQueryCache.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
 AZ_DECLARE_BUDGET(Terrain);
@@ -233,6 +234,8 @@ namespace Terrain
             bool* terrainExistsPtr) const;
         float GetHeightSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
         float GetTerrainAreaHeight(float x, float y, bool& terrainExists) const;
+        //! Same as GetTerrainAreaHeight, but for positions on the height query grid, which get looked up in the height cache first.
+        float GetTerrainAreaHeightOnGrid(float x, float y, bool& terrainExists) const;
         AZ::Vector3 GetNormalSynchronous(const AZ::Vector3& position, Sampler sampler, bool* terrainExistsPtr) const;
 
         typedef AZStd::function<void(
@@ -286,6 +289,11 @@ namespace Terrain
         void RecalculateCachedBounds();
         AZ::Aabb ClampZBoundsToHeightBounds(const AZ::Aabb& aabb) const;
 
+        //! Remove the cached query results in the given region, this needs to happen for every region that gets added to m_dirtyRegion.
+        void InvalidateQueryCaches(const AZ::Aabb& dirtyRegion);
+        //! Remove all cached query results and set up the caches for the current query resolutions.
+        void ResetQueryCaches();
+
         struct TerrainSystemSettings
         {
             AzFramework::Terrain::FloatRange m_heightRange;
@@ -314,6 +322,18 @@ namespace Terrain
 
         mutable TerrainRaycastContext m_terrainRaycastContext;
 
+        // Caches of the values evaluated on the height and surface data query grids, so that repeated queries of the same regions
+        // don't need to walk through the terrain areas and their gradients again.
+        struct CachedHeight
+        {
+            float m_height;
+            bool m_terrainExists;
+        };
+        static constexpr size_t MaxHeightCacheTiles = 256;
+        static constexpr size_t MaxSurfaceWeightsCacheTiles = 64;
+        mutable TerrainQueryCache<CachedHeight> m_heightCache;
+        mutable TerrainQueryCache<AzFramework::SurfaceData::SurfaceTagWeightList> m_surfaceWeightsCache;
+
         AZ::JobManager* m_terrainJobManager = nullptr;
         mutable AZStd::mutex m_activeTerrainJobContextMutex;
         mutable AZStd::condition_variable m_activeTerrainJobContextMutexConditionVariable;
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <gmock/gmock.h>
+
+#include <TerrainSystem/TerrainQueryCache.h>
+
+namespace UnitTest
+{
+    class TerrainQueryCacheTests
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    TEST_F(TerrainQueryCacheTests, StoredValuesCanBeFound)
+    {
+        Terrain::TerrainQueryCache<float> cache;
+        cache.Reset(0.5f, 4);
+
+        // Include negative positions, which use a different rounding for the tile coordinates.
+        const AZ::Vector2 positions[] = { AZ::Vector2(0.0f, 0.0f), AZ::Vector2(10.5f, -3.0f), AZ::Vector2(-20.0f, -0.5f) };
+        for (const AZ::Vector2& position : positions)
+        {
+            cache.Store(position, position.GetX() + position.GetY(), cache.GetGeneration());
+        }
+
+        for (const AZ::Vector2& position : positions)
+        {
+            float value = 0.0f;
+            EXPECT_TRUE(cache.Find(position, value));
+            EXPECT_EQ(value, position.GetX() + position.GetY());
+        }
+
+        // A neighboring grid point in the same tile was never stored.
+        float value = 0.0f;
+        EXPECT_FALSE(cache.Find(AZ::Vector2(0.5f, 0.0f), value));
+    }
+
+    TEST_F(TerrainQueryCacheTests, InvalidateRemovesOnlyOverlappingTiles)
+    {
+        Terrain::TerrainQueryCache<float> cache;
+        cache.Reset(1.0f, 16);
+
+        const float tileSize = aznumeric_cast<float>(Terrain::TerrainQueryCache<float>::TileSize);
+        const AZ::Vector2 position1(1.0f, 1.0f);
+        const AZ::Vector2 position2(tileSize * 4.0f + 1.0f, 1.0f);
+        cache.Store(position1, 1.0f, cache.GetGeneration());
+        cache.Store(position2, 2.0f, cache.GetGeneration());
+        EXPECT_EQ(cache.GetNumTiles(), 2);
+
+        cache.Invalidate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(2.0f)));
+
+        float value = 0.0f;
+        EXPECT_FALSE(cache.Find(position1, value));
+        EXPECT_TRUE(cache.Find(position2, value));
+        EXPECT_EQ(cache.GetNumTiles(), 1);
+    }
+
+    TEST_F(TerrainQueryCacheTests, ValuesFromBeforeAnInvalidationAreNotStored)
+    {
+        Terrain::TerrainQueryCache<float> cache;
+        cache.Reset(1.0f, 16);
+
+        // Simulate a value that got evaluated while its region got invalidated.
+        const uint64_t generation = cache.GetGeneration();
+        cache.Invalidate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(100.0f), AZ::Vector3(200.0f)));
+        cache.Store(AZ::Vector2(1.0f), 1.0f, generation);
+
+        float value = 0.0f;
+        EXPECT_FALSE(cache.Find(AZ::Vector2(1.0f), value));
+    }
+
+    TEST_F(TerrainQueryCacheTests, LeastRecentlyUsedTileIsEvicted)
+    {
+        Terrain::TerrainQueryCache<float> cache;
+        cache.Reset(1.0f, 2);
+
+        const float tileSize = aznumeric_cast<float>(Terrain::TerrainQueryCache<float>::TileSize);
+        const AZ::Vector2 position1(0.0f, 0.0f);
+        const AZ::Vector2 position2(tileSize, 0.0f);
+        const AZ::Vector2 position3(tileSize * 2.0f, 0.0f);
+        cache.Store(position1, 1.0f, cache.GetGeneration());
+        cache.Store(position2, 2.0f, cache.GetGeneration());
+
+        // Touch the first tile, so the second one becomes the least recently used.
+        float value = 0.0f;
+        EXPECT_TRUE(cache.Find(position1, value));
+
+        cache.Store(position3, 3.0f, cache.GetGeneration());
+        EXPECT_EQ(cache.GetNumTiles(), 2);
+        EXPECT_TRUE(cache.Find(position1, value));
+        EXPECT_FALSE(cache.Find(position2, value));
+        EXPECT_TRUE(cache.Find(position3, value));
+        EXPECT_EQ(value, 3.0f);
+    }
+} // namespace UnitTest
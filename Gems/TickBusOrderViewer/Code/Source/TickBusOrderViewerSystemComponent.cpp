@@ -6,6 +6,9 @@
  *
  */
 
+#include <AzCore/Component/ParallelTick.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 
@@ -13,6 +16,39 @@
 
 namespace TickBusOrderViewer
 {
+    static void print_tickbus_handlers([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZ_Printf("TickBusOrderViewer", "TickBus handlers in tick order:\n");
+        AZ::TickBus::EnumerateHandlers([](AZ::TickEvents* handler)
+        {
+            AZ_Printf("TickBusOrderViewer", "  %d %s\n", handler->GetTickOrder(), handler->RTTI_GetTypeName());
+            return true;
+        });
+    }
+
+    static void print_parallel_tick_schedule([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZ::IParallelTickScheduler* scheduler = AZ::Interface<AZ::IParallelTickScheduler>::Get();
+        if (scheduler == nullptr)
+        {
+            AZ_Printf("TickBusOrderViewer", "There is no parallel tick scheduler\n");
+            return;
+        }
+
+        AZ_Printf("TickBusOrderViewer", "Parallel tick schedule, the handlers of a stage run concurrently:\n");
+        scheduler->VisitSchedule([](int tickOrder, uint32_t stageIndex, uint32_t taskCount, const AZStd::vector<AZ::ParallelTickHandler*>& handlers)
+        {
+            AZ_Printf("TickBusOrderViewer", "  %d stage %u, %zu handlers in %u tasks\n", tickOrder, stageIndex, handlers.size(), taskCount);
+            for (const AZ::ParallelTickHandler* handler : handlers)
+            {
+                AZ_Printf("TickBusOrderViewer", "    %s\n", handler->GetParallelTickName());
+            }
+        });
+    }
+
+    AZ_CONSOLEFREEFUNC(print_tickbus_handlers, AZ::ConsoleFunctorFlags::Null, "Prints the TickBus handlers in the order they're ticked");
+    AZ_CONSOLEFREEFUNC(print_parallel_tick_schedule, AZ::ConsoleFunctorFlags::Null, "Prints the stages and tasks the parallel tick handlers are scheduled in");
+
     void TickBusOrderViewerSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
@@ -24,7 +60,7 @@ namespace TickBusOrderViewer
             {
                 ec->Class<TickBusOrderViewerSystemComponent>(
                     "TickBusOrderViewer", 
-                    "Provides a console command for viewing tick bus order, print_tickbus_handlers.")
+                    "Provides console commands for viewing tick bus order, print_tickbus_handlers and print_parallel_tick_schedule.")
                     ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                     ;
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/any.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Math/Vector3.h>
@@ -90,6 +91,24 @@ namespace Vegetation
                 m_instanceSpawner->DestroyInstance(id, instance);
             }
         }
+        AZ_INLINE void CreateInstances(AZStd::span<const InstanceData> instanceDatas, AZStd::span<InstancePtr> outInstances)
+        {
+            if (m_instanceSpawner)
+            {
+                m_instanceSpawner->CreateInstances(instanceDatas, outInstances);
+            }
+            else
+            {
+                AZStd::fill(outInstances.begin(), outInstances.end(), nullptr);
+            }
+        }
+        AZ_INLINE void DestroyInstances(AZStd::span<const InstanceId> ids, AZStd::span<const InstancePtr> instances)
+        {
+            if (m_instanceSpawner)
+            {
+                m_instanceSpawner->DestroyInstances(ids, instances);
+            }
+        }
 
         // We use the InstanceSpawner pointer as the notification bus ID since the InstanceSpawner is
         // the one that will actually broadcast out the notifications.  Multiple Descriptors can point to
@@ -9,6 +9,7 @@
 
 #include <AzCore/RTTI/TypeInfoSimple.h>
 #include <AzCore/RTTI/RTTIMacros.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Component/EntityId.h>
@@ -79,6 +80,16 @@ namespace Vegetation
         //! Destroy a single instance.
         virtual void DestroyInstance(InstanceId id, InstancePtr instance) = 0;
 
+        //! Create a group of instances at once.  The instance system collects consecutive instances of the same descriptor into
+        //! one call, so spawners that can submit many instances more efficiently than one at a time should override this.
+        //! The default implementation calls CreateInstance() for each instance.
+        //! @param instanceDatas The instances to create.
+        //! @param outInstances [out] One entry per instance, set to nullptr for any instance that couldn't be created.
+        virtual void CreateInstances(AZStd::span<const InstanceData> instanceDatas, AZStd::span<InstancePtr> outInstances);
+
+        //! Destroy a group of instances at once.  The default implementation calls DestroyInstance() for each instance.
+        virtual void DestroyInstances(AZStd::span<const InstanceId> ids, AZStd::span<const InstancePtr> instances);
+
         //! Check for data equivalency.  Subclasses are expected to implement this.
         bool operator==(const InstanceSpawner& rhs) const { return DataIsEquivalent(rhs); };
 
@@ -22,6 +22,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
@@ -1082,6 +1083,13 @@ namespace Vegetation
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
         UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
 
+        return AddSector(AZStd::move(sectorInfo));
+    }
+
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::AddSector(SectorInfo&& sectorInfo)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
         UpdateSectorCallbacks(sectorInfoRef);
@@ -1594,6 +1602,9 @@ namespace Vegetation
             m_updateWorkList.end());
         AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Refreshed RequestedUpdate list should not be larger than the view rectangle.");
 
+        // Any surface points generated ahead of time might be out of date now, so they'll get regenerated as needed.
+        m_preparedSectorPoints.clear();
+
         // Clear our delete work list, we'll recreate it and sort it again below.
         // Note: We do NOT clear m_updateWorkList, because we use it to incrementally determine any new
         // updates to add to the queue.  Without it, we wouldn't know if a previous data change caused
@@ -1779,11 +1790,16 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
+            PrepareSectorPoints(vegTasks);
+
             auto& updateEntry = m_updateWorkList.back();
             SectorId sectorId = updateEntry.first;
             UpdateMode mode = updateEntry.second;
             m_updateWorkList.pop_back();
 
+            // Fill requests reuse the existing surface points, so only the other modes have prepared points.
+            auto preparedSector = (mode != UpdateMode::Fill) ? m_preparedSectorPoints.find(sectorId) : m_preparedSectorPoints.end();
+
             {
                 AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
 
@@ -1797,7 +1813,15 @@ namespace Vegetation
                     {
                         auto sectorInfo = vegTasks->GetSector(sectorId);
                         AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        if (preparedSector != m_preparedSectorPoints.end())
+                        {
+                            sectorInfo->m_baseContext.m_availablePoints = AZStd::move(preparedSector->second.m_baseContext.m_availablePoints);
+                            sectorInfo->m_baseContext.m_masks = AZStd::move(preparedSector->second.m_baseContext.m_masks);
+                        }
+                        else
+                        {
+                            vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        }
                         vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                     }
                     break;
@@ -1813,13 +1837,20 @@ namespace Vegetation
                     case UpdateMode::Create:
                     {
                         AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        auto sectorInfo = (preparedSector != m_preparedSectorPoints.end())
+                            ? vegTasks->AddSector(AZStd::move(preparedSector->second))
+                            : vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
                         vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                     }
                     break;
                 }
             }
 
+            if (preparedSector != m_preparedSectorPoints.end())
+            {
+                m_preparedSectorPoints.erase(preparedSector);
+            }
+
             return true;
         }
 
@@ -1827,4 +1858,59 @@ namespace Vegetation
         return false;
     }
 
+    void AreaSystemComponent::UpdateContext::PrepareSectorPoints(VegetationThreadTasks* vegTasks)
+    {
+        // Nothing to do if the next sector doesn't need new surface points or already has them.
+        const auto& nextEntry = m_updateWorkList.back();
+        if ((nextEntry.second == UpdateMode::Fill) || (m_preparedSectorPoints.find(nextEntry.first) != m_preparedSectorPoints.end()))
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const int sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+        const int sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+        const SnapMode sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+
+        // The work list is sorted with the closest sectors at the end, so walking backwards from the end
+        // prepares the sectors in the same order that they'll get processed in.
+        AZStd::vector<SectorInfo*> sectorsToPrepare;
+        sectorsToPrepare.reserve(MaxSectorsToPrepare);
+        for (auto entry = m_updateWorkList.rbegin(); (entry != m_updateWorkList.rend()) && (sectorsToPrepare.size() < MaxSectorsToPrepare); ++entry)
+        {
+            if ((entry->second == UpdateMode::Fill) || (m_preparedSectorPoints.find(entry->first) != m_preparedSectorPoints.end()))
+            {
+                continue;
+            }
+
+            SectorInfo& sectorInfo = m_preparedSectorPoints[entry->first];
+            sectorInfo.m_id = entry->first;
+            sectorInfo.m_bounds = VegetationThreadTasks::GetSectorBounds(entry->first, sectorSizeInMeters);
+            sectorsToPrepare.push_back(&sectorInfo);
+        }
+
+        if (sectorsToPrepare.size() == 1)
+        {
+            vegTasks->UpdateSectorPoints(*sectorsToPrepare[0], sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+            return;
+        }
+
+        // UpdateSectorPoints only writes to the given sector and queries the surface data system, so the sectors
+        // can be processed in parallel.
+        AZ::JobCompletion jobCompletion;
+        for (SectorInfo* sectorInfo : sectorsToPrepare)
+        {
+            auto job = AZ::CreateJobFunction(
+                [vegTasks, sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode]()
+                {
+                    vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                },
+                true);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
 }
@@ -292,6 +292,8 @@ namespace Vegetation
             SectorInfo* GetSector(const SectorId& sectorId);
 
             SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Add a sector whose id, bounds, and surface points have already been set up.
+            SectorInfo* AddSector(SectorInfo&& sectorInfo);
             void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
             void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
             void DeleteSector(const SectorId& sectorId);
@@ -430,6 +432,7 @@ namespace Vegetation
         private:
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
             bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            void PrepareSectorPoints(VegetationThreadTasks* vegTasks);
 
             enum class UpdateMode
             {
@@ -446,6 +449,15 @@ namespace Vegetation
             // be recalculated.
             AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateWorkList;
 
+            // Surface points that were generated ahead of time for the next sectors in m_updateWorkList.  Generating the surface
+            // points is the part of a sector update that doesn't touch any vegetation areas, so it can run for several sectors
+            // in parallel, while the claiming still runs one sector at a time.  The map is cleared whenever the work lists
+            // get refreshed, since the surface data might have changed.
+            AZStd::unordered_map<SectorId, SectorInfo> m_preparedSectorPoints;
+
+            // The maximum number of sectors to generate surface points for in parallel.
+            static constexpr size_t MaxSectorsToPrepare = 8;
+
             // Sector counts of the number of expected sectors in the view rectangle vs the number of sectors
             // currently active.  These are used to "load balance" sector deletes and creates so that we don't have
             // too many sectors active at any one point in time.
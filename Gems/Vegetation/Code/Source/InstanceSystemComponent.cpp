@@ -285,10 +285,7 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::CreateInstance, instanceData.m_instanceId, instanceData.m_position, instanceData.m_id));
 
         //queue render node related tasks to process on the main thread
-        AddTask([this, instanceData]() {
-            CreateInstanceNode(instanceData);
-            m_createTaskCount--;
-        });
+        AddTask({ Task::Type::Create, instanceData });
 
         m_createTaskCount++;
     }
@@ -306,13 +303,10 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::DeleteInstance, instanceId));
 
         //queue render node related tasks to process on the main thread
-        AddTask([this, instanceId]() {
-            ReleaseInstanceNode(instanceId);
-
-            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-            m_instanceDeletionSet.erase(instanceId);
-            m_destroyTaskCount--;
-        });
+        Task task;
+        task.m_type = Task::Type::Destroy;
+        task.m_instanceData.m_instanceId = instanceId;
+        AddTask(task);
 
         AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
         m_instanceDeletionSet.insert(instanceId);
@@ -442,17 +436,13 @@ namespace Vegetation
         return instanceData.m_instanceId == InvalidInstanceId || m_instanceDeletionSet.find(instanceData.m_instanceId) != m_instanceDeletionSet.end();
     }
 
-    void InstanceSystemComponent::CreateInstanceNode(const InstanceData& instanceData)
+    void InstanceSystemComponent::CreateInstanceNodes(AZStd::span<const Task> tasks)
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
-        if (IsInstanceSkippable(instanceData))
-        {
-            return;
-        }
-
         // Only support valid, registered descriptors with loaded assets
-        if (!instanceData.m_descriptorPtr || !instanceData.m_descriptorPtr->IsLoaded())
+        DescriptorPtr descriptorPtr = tasks.front().m_instanceData.m_descriptorPtr;
+        if (!descriptorPtr || !descriptorPtr->IsLoaded())
         {
             //descriptor and mesh must be valid but it's not an error
             //an edit, asset change, or other event could have released descriptors or render groups on this or another thread
@@ -463,7 +453,7 @@ namespace Vegetation
         {
             AZStd::lock_guard<decltype(m_uniqueDescriptorsMutex)> lock(m_uniqueDescriptorsMutex);
 
-            auto descItr = m_uniqueDescriptors.find(instanceData.m_descriptorPtr);
+            auto descItr = m_uniqueDescriptors.find(descriptorPtr);
             if (descItr == m_uniqueDescriptors.end())
             {
                 //descriptor must be registered with the system to create an instance.
@@ -472,41 +462,97 @@ namespace Vegetation
             }
         }
 
-        InstancePtr opaqueInstanceData = instanceData.m_descriptorPtr->CreateInstance(instanceData);
+        m_instanceDataScratch.clear();
+        {
+            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
+            for (const Task& task : tasks)
+            {
+                AZ_Assert(task.m_instanceData.m_descriptorPtr == descriptorPtr, "Expected all create tasks of a run to share a descriptor.");
+                if (!IsInstanceSkippable(task.m_instanceData))
+                {
+                    m_instanceDataScratch.push_back(task.m_instanceData);
+                }
+            }
+        }
+
+        if (m_instanceDataScratch.empty())
+        {
+            return;
+        }
 
-        if (opaqueInstanceData)
+        m_instancePtrScratch.resize(m_instanceDataScratch.size());
+        descriptorPtr->CreateInstances(m_instanceDataScratch, m_instancePtrScratch);
+
+        AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
+        for (size_t index = 0; index < m_instanceDataScratch.size(); ++index)
         {
-            AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            AZ_Assert(m_instanceMap.find(instanceData.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceData.m_instanceId);
-            m_instanceMap[instanceData.m_instanceId] = AZStd::make_pair(instanceData.m_descriptorPtr, opaqueInstanceData);
-            m_instanceCount = static_cast<int>(m_instanceMap.size());
+            const InstanceData& instanceData = m_instanceDataScratch[index];
+            InstancePtr opaqueInstanceData = m_instancePtrScratch[index];
+            if (opaqueInstanceData)
+            {
+                AZ_Assert(m_instanceMap.find(instanceData.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceData.m_instanceId);
+                m_instanceMap[instanceData.m_instanceId] = AZStd::make_pair(descriptorPtr, opaqueInstanceData);
+            }
         }
+        m_instanceCount = static_cast<int>(m_instanceMap.size());
     }
 
-    void InstanceSystemComponent::ReleaseInstanceNode(InstanceId instanceId)
+    void InstanceSystemComponent::ReleaseInstanceNodes(AZStd::span<const Task> tasks)
     {
         AZ_PROFILE_FUNCTION(Vegetation);
 
-        DescriptorPtr descriptor = nullptr;
-        InstancePtr opaqueInstanceData = nullptr;
+        m_instanceIdScratch.clear();
+        m_descriptorScratch.clear();
+        m_instancePtrScratch.clear();
 
         {
             AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            auto instanceItr = m_instanceMap.find(instanceId);
-            if (instanceItr != m_instanceMap.end())
+            for (const Task& task : tasks)
             {
-                descriptor = instanceItr->second.first;
-                opaqueInstanceData = instanceItr->second.second;
-                m_instanceMap.erase(instanceItr);
+                auto instanceItr = m_instanceMap.find(task.m_instanceData.m_instanceId);
+                if (instanceItr != m_instanceMap.end())
+                {
+                    if (instanceItr->second.second)
+                    {
+                        m_instanceIdScratch.push_back(instanceItr->first);
+                        m_descriptorScratch.push_back(instanceItr->second.first);
+                        m_instancePtrScratch.push_back(instanceItr->second.second);
+                    }
+                    m_instanceMap.erase(instanceItr);
+                }
             }
             m_instanceCount = static_cast<int>(m_instanceMap.size());
         }
 
-        if (opaqueInstanceData)
+        // destroy consecutive instances of the same descriptor together
+        for (size_t startIndex = 0; startIndex < m_instanceIdScratch.size();)
         {
-            descriptor->DestroyInstance(instanceId, opaqueInstanceData);
+            size_t endIndex = startIndex + 1;
+            while (endIndex < m_instanceIdScratch.size() && m_descriptorScratch[endIndex] == m_descriptorScratch[startIndex])
+            {
+                ++endIndex;
+            }
+
+            const size_t count = endIndex - startIndex;
+            m_descriptorScratch[startIndex]->DestroyInstances(
+                AZStd::span<const InstanceId>(m_instanceIdScratch.data() + startIndex, count),
+                AZStd::span<const InstancePtr>(m_instancePtrScratch.data() + startIndex, count));
+            startIndex = endIndex;
+        }
+
+        {
+            AZStd::lock_guard<decltype(m_instanceIdMutex)> scopedLock(m_instanceIdMutex);
+            for (const Task& task : tasks)
+            {
+                ReleaseInstanceId(task.m_instanceData.m_instanceId);
+            }
+        }
+
+        AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
+        for (const Task& task : tasks)
+        {
+            m_instanceDeletionSet.erase(task.m_instanceData.m_instanceId);
         }
-        ReleaseInstanceId(instanceId);
     }
 
     bool InstanceSystemComponent::HasTasks() const
@@ -564,9 +610,30 @@ namespace Vegetation
         auto removedTasksPtr = AZStd::make_shared<TaskList>();
         while (GetTasks(*removedTasksPtr))
         {
-            for (const auto& task : (*removedTasksPtr).back())
+            // tasks must run in the order they were queued, so only consecutive tasks of the same type are grouped
+            const TaskBatch& tasks = removedTasksPtr->back();
+            for (size_t startIndex = 0; startIndex < tasks.size();)
             {
-                task();
+                const Task& firstTask = tasks[startIndex];
+                size_t endIndex = startIndex + 1;
+                while (endIndex < tasks.size() && tasks[endIndex].m_type == firstTask.m_type &&
+                    (firstTask.m_type == Task::Type::Destroy || tasks[endIndex].m_instanceData.m_descriptorPtr == firstTask.m_instanceData.m_descriptorPtr))
+                {
+                    ++endIndex;
+                }
+
+                const AZStd::span<const Task> run(tasks.data() + startIndex, endIndex - startIndex);
+                if (firstTask.m_type == Task::Type::Create)
+                {
+                    CreateInstanceNodes(run);
+                    m_createTaskCount -= static_cast<int>(run.size());
+                }
+                else
+                {
+                    ReleaseInstanceNodes(run);
+                    m_destroyTaskCount -= static_cast<int>(run.size());
+                }
+                startIndex = endIndex;
             }
 
             currentTime = AZStd::chrono::steady_clock::now();
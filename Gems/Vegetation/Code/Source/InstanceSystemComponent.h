@@ -17,6 +17,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/function/function_fwd.h>
 
@@ -124,10 +125,13 @@ namespace Vegetation
 
         ////////////////////////////////////////////////////////////////
         // vegetation instance management
+        struct Task;
         bool IsInstanceSkippable(const InstanceData& instanceData) const;
-        void CreateInstanceNode(const InstanceData& instanceData);
 
-        void ReleaseInstanceNode(InstanceId instanceId);
+        // create or release the instances of a run of consecutive tasks of the same type in one pass, so the spawners
+        // can submit the whole run at once. create runs are expected to share the same descriptor.
+        void CreateInstanceNodes(AZStd::span<const Task> tasks);
+        void ReleaseInstanceNodes(AZStd::span<const Task> tasks);
 
         mutable AZStd::recursive_mutex m_instanceMapMutex;
         AZStd::unordered_map<InstanceId, AZStd::pair<DescriptorPtr, InstancePtr>> m_instanceMap;
@@ -137,13 +141,29 @@ namespace Vegetation
 
         ////////////////////////////////////////////////////////////////
         // Task management
-        using Task = AZStd::function<void(void)>;
+        struct Task
+        {
+            enum class Type : AZ::u8
+            {
+                Create,
+                Destroy
+            };
+
+            Type m_type = Type::Create;
+            InstanceData m_instanceData; // only the instance id is used by destroy tasks
+        };
         using TaskBatch = AZStd::vector<Task>;
         using TaskList = AZStd::list<TaskBatch>;
         TaskList m_mainThreadTaskQueue;
         mutable AZStd::recursive_mutex m_mainThreadTaskMutex;
         mutable AZStd::recursive_mutex m_mainThreadTaskInProgressMutex;
 
+        // scratch buffers for the task runs, only used on the main thread while the tasks are in progress
+        AZStd::vector<InstanceData> m_instanceDataScratch;
+        AZStd::vector<InstanceId> m_instanceIdScratch;
+        AZStd::vector<DescriptorPtr> m_descriptorScratch;
+        AZStd::vector<InstancePtr> m_instancePtrScratch;
+
         bool HasTasks() const;
         void AddTask(const Task& task);
         void ClearTasks();
@@ -16,6 +16,7 @@
 
 #include <Vegetation/Ebuses/FilterRequestBus.h>
 #include <Vegetation/Ebuses/InstanceSystemRequestBus.h>
+#include <Vegetation/InstanceData.h>
 #include <Vegetation/InstanceSpawner.h>
 #include <Vegetation/EmptyInstanceSpawner.h>
 #include <Vegetation/PrefabInstanceSpawner.h>
@@ -35,6 +36,27 @@ namespace Vegetation
         }
     }
 
+    void InstanceSpawner::CreateInstances(AZStd::span<const InstanceData> instanceDatas, AZStd::span<InstancePtr> outInstances)
+    {
+        AZ_Assert(instanceDatas.size() == outInstances.size(), "input and output lists are different sizes (%zu vs %zu).",
+            instanceDatas.size(), outInstances.size());
+
+        for (size_t index = 0; index < instanceDatas.size(); ++index)
+        {
+            outInstances[index] = CreateInstance(instanceDatas[index]);
+        }
+    }
+
+    void InstanceSpawner::DestroyInstances(AZStd::span<const InstanceId> ids, AZStd::span<const InstancePtr> instances)
+    {
+        AZ_Assert(ids.size() == instances.size(), "input lists are different sizes (%zu vs %zu).", ids.size(), instances.size());
+
+        for (size_t index = 0; index < ids.size(); ++index)
+        {
+            DestroyInstance(ids[index], instances[index]);
+        }
+    }
+
     namespace Details
     {
         AzFramework::GenericAssetHandler<DescriptorListAsset>* s_vegetationDescriptorListAssetHandler = nullptr;
@@ -100,6 +100,23 @@ namespace UnitTest
         instanceSpawner.DestroyInstance(0, instance);
     }
 
+    TEST_F(EmptyInstanceSpawnerTests, CreateAndDestroyMultipleInstances)
+    {
+        // The default bulk implementation should "create" and "destroy" every instance of the list without errors.
+
+        Vegetation::EmptyInstanceSpawner instanceSpawner;
+        Vegetation::InstanceData instanceDatas[3];
+        Vegetation::InstancePtr instances[3] = { nullptr, nullptr, nullptr };
+        instanceSpawner.CreateInstances(instanceDatas, instances);
+        for (Vegetation::InstancePtr instance : instances)
+        {
+            EXPECT_TRUE(instance);
+        }
+
+        const Vegetation::InstanceId ids[3] = { 0, 1, 2 };
+        instanceSpawner.DestroyInstances(ids, instances);
+    }
+
     TEST_F(EmptyInstanceSpawnerTests, SpawnerRegisteredWithDescriptor)
     {
         // Validate that the Descriptor successfully gets EmptyInstanceSpawner registered with it,
@@ -266,6 +266,13 @@ namespace WhiteBox
         //! Return user edge handles for a given vertex.
         //! @note The edge handles returned will only include 'user' edges.
         EdgeHandles VertexUserEdgeHandles(const WhiteBoxMesh& whiteBox, VertexHandle vertexHandle);
+
+        //! Return all face handles that share a given vertex.
+        FaceHandles VertexFaceHandles(const WhiteBoxMesh& whiteBox, VertexHandle vertexHandle);
+
+        //! Return the unique face handles that share any of the given vertices.
+        //! @note These are the faces whose normals and uvs change when the vertices are moved.
+        FaceHandles VerticesFaceHandles(const WhiteBoxMesh& whiteBox, const VertexHandles& vertexHandles);
         ///////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         ///////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -654,6 +661,11 @@ namespace WhiteBox
         //! Recalculate all normals of each face in the mesh.
         void CalculateNormals(WhiteBoxMesh& whiteBox);
 
+        //! Recalculate the normals of the given faces only.
+        //! @note Prefer this to recalculating the whole mesh while interactively moving vertices, the faces
+        //! returned by VerticesFaceHandles for the moved vertices are the only ones affected.
+        void CalculateNormals(WhiteBoxMesh& whiteBox, const FaceHandles& faceHandles);
+
         //! Zero/clear all uvs.
         void ZeroUVs(WhiteBoxMesh& whiteBox);
 
@@ -661,6 +673,10 @@ namespace WhiteBox
         //! @note This will produce a tiling effect across each side of the mesh.
         void CalculatePlanarUVs(WhiteBoxMesh& whiteBox);
 
+        //! Calculate planar uvs for the halfedges of the given faces only.
+        //! @note The face normals must be up to date (see CalculateNormals).
+        void CalculatePlanarUVs(WhiteBoxMesh& whiteBox, const FaceHandles& faceHandles);
+
         //! Hide an edge to merge two polygons that share the same edge.
         //! Return the handle to the merged polygon.
         PolygonHandle HideEdge(WhiteBoxMesh& whiteBox, EdgeHandle edgeHandle);
@@ -558,7 +558,6 @@ namespace WhiteBox
         AZStd::vector<FaceVertHandles> BuildNewVertexFaceHandles(
             WhiteBoxMesh& whiteBox, const Internal::AppendedVerts& appendedVerts, const FaceHandles& existingFaces);
         void RemoveFaces(WhiteBoxMesh& whiteBox, const FaceHandles& faceHandles);
-        void CalculatePlanarUVs(WhiteBoxMesh& whiteBox, const FaceHandles& faceHandles);
 
         // restores WhiteBoxMesh properties, use when properties have not been initialized or have been cleared
         static void InitializeWhiteBoxMesh(WhiteBoxMesh& whiteBox)
@@ -1874,6 +1873,38 @@ namespace WhiteBox
             return vertexEdgeHandles;
         }
 
+        FaceHandles VertexFaceHandles(const WhiteBoxMesh& whiteBox, const VertexHandle vertexHandle)
+        {
+            AZ_PROFILE_FUNCTION(AzToolsFramework);
+
+            FaceHandles faceHandles;
+            for (Mesh::ConstVertexFaceCCWIter vertexFaceIt = whiteBox.mesh.cvf_ccwiter(om_vh(vertexHandle));
+                 vertexFaceIt.is_valid(); ++vertexFaceIt)
+            {
+                faceHandles.push_back(wb_fh(*vertexFaceIt));
+            }
+
+            return faceHandles;
+        }
+
+        FaceHandles VerticesFaceHandles(const WhiteBoxMesh& whiteBox, const VertexHandles& vertexHandles)
+        {
+            AZ_PROFILE_FUNCTION(AzToolsFramework);
+
+            FaceHandles faceHandles;
+            for (const auto& vertexHandle : vertexHandles)
+            {
+                const auto vertexFaceHandles = VertexFaceHandles(whiteBox, vertexHandle);
+                faceHandles.insert(faceHandles.end(), vertexFaceHandles.begin(), vertexFaceHandles.end());
+            }
+
+            // faces are shared between neighboring vertices, only return each one once
+            AZStd::sort(faceHandles.begin(), faceHandles.end());
+            faceHandles.erase(AZStd::unique(faceHandles.begin(), faceHandles.end()), faceHandles.end());
+
+            return faceHandles;
+        }
+
         template<typename EdgeFn>
         static AZStd::vector<AZ::Vector3> VertexUserEdges(
             const WhiteBoxMesh& whiteBox, const VertexHandle vertexHandle, EdgeFn&& edgeFn)
@@ -2645,6 +2676,16 @@ namespace WhiteBox
             whiteBox.mesh.update_normals();
         }
 
+        void CalculateNormals(WhiteBoxMesh& whiteBox, const FaceHandles& faceHandles)
+        {
+            AZ_PROFILE_FUNCTION(AzToolsFramework);
+
+            for (const auto& faceHandle : faceHandles)
+            {
+                whiteBox.mesh.set_normal(om_fh(faceHandle), whiteBox.mesh.calc_face_normal(om_fh(faceHandle)));
+            }
+        }
+
         void ZeroUVs(WhiteBoxMesh& whiteBox)
         {
             AZ_PROFILE_FUNCTION(AzToolsFramework);
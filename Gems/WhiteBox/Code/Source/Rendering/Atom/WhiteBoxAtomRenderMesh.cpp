@@ -20,10 +20,15 @@
 #include <Atom/RPI.Reflect/Model/ModelLodAssetCreator.h>
 #include <Atom/RPI.Reflect/ResourcePoolAssetCreator.h>
 #include <AtomLyIntegration/CommonFeatures/Material/MaterialComponentBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/PackedVector3.h>
 
 namespace WhiteBox
 {
+    AZ_CVAR(
+        bool, cl_whiteBoxIncrementalRenderMeshUpdates, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Only upload the changed vertices of the render mesh while editing instead of recreating it after every change");
+
     AtomRenderMesh::AtomRenderMesh(AZ::EntityId entityId)
         : m_entityId(entityId)
     {
@@ -78,16 +83,16 @@ namespace WhiteBox
         return AreAttributesValid();
     }
 
-    bool AtomRenderMesh::UpdateMeshBuffers(const WhiteBoxMeshAtomData& meshData)
+    bool AtomRenderMesh::UpdateMeshBuffers(const WhiteBoxMeshAtomData& meshData, const WhiteBoxMeshAtomData& previousMeshData)
     {
-        UpdateAttributeBuffer<AttributeType::Position>(meshData.GetPositions());
-        UpdateAttributeBuffer<AttributeType::Normal>(meshData.GetNormals());
-        UpdateAttributeBuffer<AttributeType::Tangent>(meshData.GetTangents());
-        UpdateAttributeBuffer<AttributeType::Bitangent>(meshData.GetBitangents());
-        UpdateAttributeBuffer<AttributeType::UV>(meshData.GetUVs());
-        UpdateAttributeBuffer<AttributeType::Color>(meshData.GetColors());
-
-        return AreAttributesValid();
+        // the index buffer is a [0, vertexCount) sequence so only changes with the vertex count (see DoesMeshRequireFullRebuild)
+        return UpdateAttributeBuffer<AttributeType::Position>(meshData.GetPositions(), previousMeshData.GetPositions()) &&
+            UpdateAttributeBuffer<AttributeType::Normal>(meshData.GetNormals(), previousMeshData.GetNormals()) &&
+            UpdateAttributeBuffer<AttributeType::Tangent>(meshData.GetTangents(), previousMeshData.GetTangents()) &&
+            UpdateAttributeBuffer<AttributeType::Bitangent>(meshData.GetBitangents(), previousMeshData.GetBitangents()) &&
+            UpdateAttributeBuffer<AttributeType::UV>(meshData.GetUVs(), previousMeshData.GetUVs()) &&
+            UpdateAttributeBuffer<AttributeType::Color>(meshData.GetColors(), previousMeshData.GetColors()) &&
+            AreAttributesValid();
     }
 
     void AtomRenderMesh::AddLodBuffers(AZ::RPI::ModelLodAssetCreator& modelLodCreator)
@@ -225,40 +230,38 @@ namespace WhiteBox
         }
 
         m_vertexCount = meshData.VertexCount();
+        m_modelAabb = meshData.GetAabb();
 
         return true;
     }
 
-    bool AtomRenderMesh::DoesMeshRequireFullRebuild([[maybe_unused]] const WhiteBoxMeshAtomData& meshData) const
+    bool AtomRenderMesh::DoesMeshRequireFullRebuild(const WhiteBoxMeshAtomData& meshData) const
     {
-        // this has been disabled due to a some recent updates with Atom that a) cause visual artefacts
-        // when updating the buffers and b) have a big performance boost when rebuilding from scratch anyway.
-        //
-        // this method for building the mesh will probably be replace anyway when the Atom DynamicDraw support
-        // comes online.
-        return true; // meshData.VertexCount() != m_vertexCount;
+        // the buffers can only be updated in place while the number of vertices stays the same, and the bounds of
+        // the model can't be updated without recreating it so the mesh must also stay within them (otherwise it
+        // would be culled incorrectly)
+        return !cl_whiteBoxIncrementalRenderMeshUpdates || !m_meshData || !m_meshHandle.IsValid() ||
+            meshData.VertexCount() != m_vertexCount || !m_modelAabb.Contains(meshData.GetAabb());
     }
 
     void AtomRenderMesh::BuildMesh(const WhiteBoxRenderData& renderData, const AZ::Transform& worldFromLocal)
     {
         const WhiteBoxFaces culledFaceList = BuildCulledWhiteBoxFaces(renderData.m_faces);
-        const WhiteBoxMeshAtomData meshData(culledFaceList);
+        auto meshData = AZStd::make_unique<WhiteBoxMeshAtomData>(culledFaceList);
 
-        if (DoesMeshRequireFullRebuild(meshData))
-        {
-            if (!CreateMesh(meshData))
-            {
-                return;
-            }
-        }
-        else
+        // while dragging, only the vertices of the faces that were modified differ from the previous mesh data
+        // and only that range of each buffer is uploaded
+        if (DoesMeshRequireFullRebuild(*meshData) || !UpdateMeshBuffers(*meshData, *m_meshData))
         {
-            if (!UpdateMeshBuffers(meshData))
+            if (!CreateMesh(*meshData))
             {
+                m_meshData.reset();
                 return;
             }
         }
 
+        m_meshData = AZStd::move(meshData);
+
         UpdateTransform(worldFromLocal);
     }
 
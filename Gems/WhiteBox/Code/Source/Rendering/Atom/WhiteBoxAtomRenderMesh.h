@@ -18,6 +18,7 @@
 #include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
 #include <AtomLyIntegration/CommonFeatures/Mesh/MeshHandleStateBus.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Aabb.h>
 #include <AzCore/Name/Name.h>
 
 namespace AZ::RPI
@@ -63,20 +64,22 @@ namespace WhiteBox
             m_attributes[attribute_index] = AZStd::make_unique<AttributeBuffer<AttributeTypeT>>(data);
         }
 
-        //! Updates an attribute buffer in the slot dictated by AttributeTypeT.
+        //! Updates the elements of an attribute buffer in the slot dictated by AttributeTypeT that differ from the
+        //! data the buffer was last filled with.
         template<AttributeType AttributeTypeT, typename VertexStreamDataType>
-        void UpdateAttributeBuffer(const AZStd::vector<VertexStreamDataType>& data)
+        bool UpdateAttributeBuffer(
+            const AZStd::vector<VertexStreamDataType>& data, const AZStd::vector<VertexStreamDataType>& previousData)
         {
             const auto attribute_index = static_cast<size_t>(AttributeTypeT);
             auto& att = AZStd::get<attribute_index>(m_attributes[attribute_index]);
-            att->UpdateData(data);
+            return att->UpdateChangedData(data, previousData);
         }
 
         // MeshHandleStateRequestBus overrides ...
         const AZ::Render::MeshFeatureProcessorInterface::MeshHandle* GetMeshHandle() const override;
 
         bool CreateMeshBuffers(const WhiteBoxMeshAtomData& meshData);
-        bool UpdateMeshBuffers(const WhiteBoxMeshAtomData& meshData);
+        bool UpdateMeshBuffers(const WhiteBoxMeshAtomData& meshData, const WhiteBoxMeshAtomData& previousMeshData);
         bool MeshRequiresFullRebuild(const WhiteBoxMeshAtomData& meshData) const;
         bool CreateMesh(const WhiteBoxMeshAtomData& meshData);
         bool CreateLodAsset(const WhiteBoxMeshAtomData& meshData);
@@ -95,6 +98,9 @@ namespace WhiteBox
         AZ::Render::MeshFeatureProcessorInterface::MeshHandle m_meshHandle;
         AZ::Data::Instance<AZ::RPI::Material> m_materialInstance;
         uint32_t m_vertexCount = 0;
+        AZ::Aabb m_modelAabb = AZ::Aabb::CreateNull(); //!< The bounds the model was created with.
+        //! The data the mesh buffers currently hold, used to only upload what changed on the next update.
+        AZStd::unique_ptr<WhiteBoxMeshAtomData> m_meshData;
         AZStd::unique_ptr<IndexBuffer> m_indexBuffer;
         AZStd::array<
             AZStd::variant<
@@ -119,6 +119,11 @@ namespace WhiteBox
         template<typename VertexStreamDataType>
         bool UpdateData(const AZStd::vector<VertexStreamDataType>& data);
 
+        //! Update only the elements of the attribute buffer that differ from the previous data.
+        template<typename VertexStreamDataType>
+        bool UpdateChangedData(
+            const AZStd::vector<VertexStreamDataType>& data, const AZStd::vector<VertexStreamDataType>& previousData);
+
     private:
         typename Trait::BufferType m_buffer;
         AZ::RHI::ShaderSemantic m_shaderSemantic;
@@ -195,6 +200,28 @@ namespace WhiteBox
         return true;
     }
 
+    template<AttributeType AttributeTypeT>
+    template<typename VertexStreamDataType>
+    bool AttributeBuffer<AttributeTypeT>::UpdateChangedData(
+        const AZStd::vector<VertexStreamDataType>& data, const AZStd::vector<VertexStreamDataType>& previousData)
+    {
+        const auto [firstElement, elementCount] = ChangedElementRange(previousData, data);
+        if (elementCount == 0)
+        {
+            return true;
+        }
+
+        if (!m_buffer.UpdateData(data, firstElement, elementCount))
+        {
+            AZ_Error(
+                "AttributeBuffer", false, "Couldn't update buffer for attribute %s",
+                m_shaderSemantic.ToString().c_str());
+            return false;
+        }
+
+        return true;
+    }
+
     //! Attribute buffer alias for position attributes.
     using PositionAttribute = AttributeBuffer<AttributeType::Position>;
 
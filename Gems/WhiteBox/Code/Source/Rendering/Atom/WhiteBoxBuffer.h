@@ -71,6 +71,9 @@ namespace WhiteBox
         //! Update the buffer contents with the new data.
         bool UpdateData(const AZStd::vector<VertexStreamDataType>& data);
 
+        //! Update only the given range of elements in the buffer with the corresponding elements of the new data.
+        bool UpdateData(const AZStd::vector<VertexStreamDataType>& data, uint32_t firstElement, uint32_t elementCount);
+
     private:
         AZ::Data::Asset<AZ::RPI::BufferAsset> m_buffer;
         AZ::RHI::BufferViewDescriptor m_bufferViewDescriptor;
@@ -152,6 +155,13 @@ namespace WhiteBox
 
     template<typename VertexStreamDataType>
     bool Buffer<VertexStreamDataType>::UpdateData(const AZStd::vector<VertexStreamDataType>& data)
+    {
+        return UpdateData(data, 0, static_cast<uint32_t>(data.size()));
+    }
+
+    template<typename VertexStreamDataType>
+    bool Buffer<VertexStreamDataType>::UpdateData(
+        const AZStd::vector<VertexStreamDataType>& data, const uint32_t firstElement, const uint32_t elementCount)
     {
         if (!IsValid())
         {
@@ -167,17 +177,18 @@ namespace WhiteBox
             return false;
         }
 
-        const uint32_t elementCount = static_cast<uint32_t>(data.size());
         const uint32_t elementSize = sizeof(VertexStreamDataType);
+        const uint32_t byteOffset = firstElement * elementSize;
         const uint32_t bufferSize = elementCount * elementSize;
 
-        if (bufferSize > m_bufferViewDescriptor.m_elementCount * m_bufferViewDescriptor.m_elementSize)
+        if (firstElement + elementCount > data.size() ||
+            byteOffset + bufferSize > m_bufferViewDescriptor.m_elementCount * m_bufferViewDescriptor.m_elementSize)
         {
             AZ_Error("UpdateData", false, "Specfied buffer update exceeds capacity.");
             return false;
         }
 
-        if (!buffer->UpdateData(data.data(), bufferSize))
+        if (!buffer->UpdateData(data.data() + firstElement, bufferSize, byteOffset))
         {
             AZ_Error("UpdateData", false, "Buffer could not be updated.");
             m_isValid = false;
@@ -187,6 +198,40 @@ namespace WhiteBox
         return true;
     }
 
+    //! Returns the first element and the number of elements from there on that differ between the previous and the
+    //! current data, the number of elements is zero if both are identical.
+    //! @note Both vectors must have the same size.
+    template<typename VertexStreamDataType>
+    AZStd::pair<uint32_t, uint32_t> ChangedElementRange(
+        const AZStd::vector<VertexStreamDataType>& previousData, const AZStd::vector<VertexStreamDataType>& data)
+    {
+        AZ_Assert(previousData.size() == data.size(), "Can only compare vertex streams of the same size.");
+
+        const auto elementChanged = [&previousData, &data](const size_t index)
+        {
+            return memcmp(&previousData[index], &data[index], sizeof(VertexStreamDataType)) != 0;
+        };
+
+        size_t first = 0;
+        while (first < data.size() && !elementChanged(first))
+        {
+            ++first;
+        }
+
+        if (first == data.size())
+        {
+            return { 0, 0 };
+        }
+
+        size_t last = data.size() - 1;
+        while (last > first && !elementChanged(last))
+        {
+            --last;
+        }
+
+        return { static_cast<uint32_t>(first), static_cast<uint32_t>(last - first + 1) };
+    }
+
     //! Buffer alias for unsigned 32 bit integer indices.
     using IndexBuffer = Buffer<uint32_t>;
 
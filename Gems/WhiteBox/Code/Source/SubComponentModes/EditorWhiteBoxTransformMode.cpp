@@ -610,8 +610,10 @@ namespace WhiteBox
                 manipulator->SetLocalPosition(transformSelection->m_localPosition + action.LocalPositionOffset());
             }
 
-            Api::CalculateNormals(*whiteBox);
-            Api::CalculatePlanarUVs(*whiteBox);
+            const Api::FaceHandles dirtyFaceHandles =
+                Api::VerticesFaceHandles(*whiteBox, transformSelection->m_vertexHandles);
+            Api::CalculateNormals(*whiteBox, dirtyFaceHandles);
+            Api::CalculatePlanarUVs(*whiteBox, dirtyFaceHandles);
 
             EditorWhiteBoxComponentNotificationBus::Event(
                 entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
@@ -702,8 +704,10 @@ namespace WhiteBox
                     manipulator->SetLocalOrientation(action.LocalOrientation());
                 }
 
-                Api::CalculateNormals(*whiteBox);
-                Api::CalculatePlanarUVs(*whiteBox);
+                const Api::FaceHandles dirtyFaceHandles =
+                    Api::VerticesFaceHandles(*whiteBox, transformSelection->m_vertexHandles);
+                Api::CalculateNormals(*whiteBox, dirtyFaceHandles);
+                Api::CalculatePlanarUVs(*whiteBox, dirtyFaceHandles);
                 EditorWhiteBoxComponentNotificationBus::Event(
                     entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
             };
@@ -797,8 +801,10 @@ namespace WhiteBox
                 Api::SetVertexPosition(*whiteBox, vertexHandle, vertexPosition);
             }
 
-            Api::CalculateNormals(*whiteBox);
-            Api::CalculatePlanarUVs(*whiteBox);
+            const Api::FaceHandles dirtyFaceHandles =
+                Api::VerticesFaceHandles(*whiteBox, transformSelection->m_vertexHandles);
+            Api::CalculateNormals(*whiteBox, dirtyFaceHandles);
+            Api::CalculatePlanarUVs(*whiteBox, dirtyFaceHandles);
             EditorWhiteBoxComponentNotificationBus::Event(
                 entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
         };
@@ -146,8 +146,10 @@ namespace WhiteBox
                             ScalePosition(normalizedScale, m_initialVertexPositions[vertexIndex], polygonSpace));
                     }
 
-                    Api::CalculateNormals(*whiteBox);
-                    Api::CalculatePlanarUVs(*whiteBox);
+                    // only the faces around the scaled vertices have changed
+                    const Api::FaceHandles dirtyFaceHandles = Api::VerticesFaceHandles(*whiteBox, vertexHandles);
+                    Api::CalculateNormals(*whiteBox, dirtyFaceHandles);
+                    Api::CalculatePlanarUVs(*whiteBox, dirtyFaceHandles);
 
                     // update all manipulator positions
                     for (size_t manipulatorIndex = 0; manipulatorIndex < m_scaleManipulators.size(); ++manipulatorIndex)
@@ -247,8 +247,11 @@ namespace WhiteBox
                         &EditorWhiteBoxDefaultModeRequestBus::Events::RefreshVertexSelectionModifier);
                 }
 
-                Api::CalculateNormals(*whiteBox);
-                Api::CalculatePlanarUVs(*whiteBox);
+                // appending recalculates the whole mesh, otherwise only the faces around the moved vertices have changed
+                const Api::FaceHandles dirtyFaceHandles =
+                    Api::VerticesFaceHandles(*whiteBox, VertexHandlesForEdges(*whiteBox, m_edgeHandles));
+                Api::CalculateNormals(*whiteBox, dirtyFaceHandles);
+                Api::CalculatePlanarUVs(*whiteBox, dirtyFaceHandles);
 
                 EditorWhiteBoxComponentNotificationBus::Event(
                     m_entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
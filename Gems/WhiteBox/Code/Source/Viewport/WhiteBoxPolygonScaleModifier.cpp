@@ -144,6 +144,7 @@ namespace WhiteBox
 
         const float currentOffset = action.LocalPositionOffset().GetLength();
         const float extrusion = fabsf(currentOffset - m_offsetWhenExtruded);
+        bool appended = false;
         // only extrude after having moved a small amount (to prevent overlapping verts
         // and normals being calculated incorrectly)
         if (extrusion > 0.0f && m_appendStage == AppendStage::Initiated)
@@ -157,6 +158,7 @@ namespace WhiteBox
             m_polygonHandle = polygonHandle;
 
             m_appendStage = AppendStage::Complete;
+            appended = true;
         }
 
         if (m_appendStage == AppendStage::None || m_appendStage == AppendStage::Complete)
@@ -169,9 +171,9 @@ namespace WhiteBox
             const float normalizedUniformScale =
                 AZ::GetMax(uniformScale / m_startingDistance, static_cast<float>(cl_whiteBoxModifierMidpointEpsilon));
 
+            // have to set the position of all vertices, not just those bound to manipulators
+            const auto vertexHandles = Api::PolygonVertexHandles(*whiteBox, m_polygonHandle);
             {
-                // have to set the position of all vertices, not just those bound to manipulators
-                const auto vertexHandles = Api::PolygonVertexHandles(*whiteBox, m_polygonHandle);
                 const AZ::Transform polygonSpace = Api::PolygonSpace(*whiteBox, m_polygonHandle, m_midPoint);
                 for (size_t vertexIndex = 0; vertexIndex < vertexHandles.size(); ++vertexIndex)
                 {
@@ -181,8 +183,19 @@ namespace WhiteBox
                 }
             }
 
-            Api::CalculateNormals(*whiteBox);
-            Api::CalculatePlanarUVs(*whiteBox);
+            if (appended)
+            {
+                // appending added new faces, recalculate the whole mesh once
+                Api::CalculateNormals(*whiteBox);
+                Api::CalculatePlanarUVs(*whiteBox);
+            }
+            else
+            {
+                // only the faces around the scaled vertices have changed
+                const Api::FaceHandles dirtyFaceHandles = Api::VerticesFaceHandles(*whiteBox, vertexHandles);
+                Api::CalculateNormals(*whiteBox, dirtyFaceHandles);
+                Api::CalculatePlanarUVs(*whiteBox, dirtyFaceHandles);
+            }
 
             {
                 // border vertex handles match those used for manipulators
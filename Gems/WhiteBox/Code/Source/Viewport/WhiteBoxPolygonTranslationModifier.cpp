@@ -115,6 +115,7 @@ namespace WhiteBox
                     sharedState->m_initiateAppendPosition = action.LocalPosition();
                 }
 
+                bool appended = false;
                 if (sharedState->m_appendStage == AppendStage::Initiated)
                 {
                     const AZ::Vector3 extrudeVector = action.LocalPosition() - sharedState->m_initiateAppendPosition;
@@ -131,6 +132,7 @@ namespace WhiteBox
                         m_vertexHandles =
                             Api::PolygonVertexHandles(*whiteBox, appendedPolygonHandles.m_appendedPolygonHandle);
                         sharedState->m_appendStage = AppendStage::Complete;
+                        appended = true;
 
                         // remember the current offset when we start extruding (to stop any snapping)
                         sharedState->m_activeAppendOffset = action.LocalPositionOffset();
@@ -207,10 +209,20 @@ namespace WhiteBox
                         &EditorWhiteBoxDefaultModeRequestBus::Events::RefreshVertexSelectionModifier);
                 }
 
-                Api::CalculateNormals(*whiteBox);
-                Api::CalculatePlanarUVs(*whiteBox);
+                if (appended)
+                {
+                    // extruding added new faces, recalculate the whole mesh once
+                    Api::CalculateNormals(*whiteBox);
+                    Api::CalculatePlanarUVs(*whiteBox);
+                }
+                else
+                {
+                    // only the faces around the moved vertices have changed
+                    const Api::FaceHandles dirtyFaceHandles = Api::VerticesFaceHandles(*whiteBox, m_vertexHandles);
+                    Api::CalculateNormals(*whiteBox, dirtyFaceHandles);
+                    Api::CalculatePlanarUVs(*whiteBox, dirtyFaceHandles);
+                }
 
-                // inefficient but easy/effective - just rebuild the whole mesh after every change
                 EditorWhiteBoxComponentNotificationBus::Event(
                     m_entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
             });
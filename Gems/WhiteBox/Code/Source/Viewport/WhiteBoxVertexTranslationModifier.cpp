@@ -210,8 +210,10 @@ namespace WhiteBox
                         &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
                 }
 
-                Api::CalculateNormals(*whiteBox);
-                Api::CalculatePlanarUVs(*whiteBox);
+                // only the faces around the moved vertex have changed
+                const Api::FaceHandles dirtyFaceHandles = Api::VertexFaceHandles(*whiteBox, m_vertexHandle);
+                Api::CalculateNormals(*whiteBox, dirtyFaceHandles);
+                Api::CalculatePlanarUVs(*whiteBox, dirtyFaceHandles);
             });
 
         m_translationManipulator->InstallInvalidateCallback(
@@ -227,6 +227,76 @@ namespace UnitTest
         EXPECT_THAT(allHalfedgeHandles, ElementsAreArray(expectedHalfedgeHandles, std::size(expectedHalfedgeHandles)));
     }
 
+    TEST_F(WhiteBoxTestFixture, FacesAroundVertex)
+    {
+        namespace Api = WhiteBox::Api;
+        using ::testing::Contains;
+
+        Api::InitializeAsUnitCube(*m_whiteBox);
+
+        const Api::FaceHandles faceHandles = Api::VertexFaceHandles(*m_whiteBox, Api::VertexHandle{0});
+
+        // one face per outgoing halfedge in a closed mesh
+        EXPECT_EQ(faceHandles.size(), Api::VertexOutgoingHalfedgeHandles(*m_whiteBox, Api::VertexHandle{0}).size());
+        for (const auto& faceHandle : faceHandles)
+        {
+            EXPECT_THAT(Api::FaceVertexHandles(*m_whiteBox, faceHandle), Contains(Api::VertexHandle{0}));
+        }
+    }
+
+    TEST_F(WhiteBoxTestFixture, FacesAroundVerticesAreUnique)
+    {
+        namespace Api = WhiteBox::Api;
+
+        Api::InitializeAsUnitCube(*m_whiteBox);
+
+        // every face shares three of the vertices but must only be returned once
+        const Api::FaceHandles faceHandles = Api::VerticesFaceHandles(*m_whiteBox, Api::MeshVertexHandles(*m_whiteBox));
+
+        EXPECT_EQ(faceHandles.size(), Api::MeshFaceCount(*m_whiteBox));
+    }
+
+    TEST_F(WhiteBoxTestFixture, PartialNormalsAndUVsMatchFullRecalculation)
+    {
+        namespace Api = WhiteBox::Api;
+
+        Api::InitializeAsUnitCube(*m_whiteBox);
+
+        const Api::VertexHandles vertexHandles = { Api::VertexHandle{0} };
+        Api::SetVertexPosition(
+            *m_whiteBox, vertexHandles.front(),
+            Api::VertexPosition(*m_whiteBox, vertexHandles.front()) + AZ::Vector3(0.25f, -0.5f, 0.75f));
+
+        const Api::FaceHandles dirtyFaceHandles = Api::VerticesFaceHandles(*m_whiteBox, vertexHandles);
+        Api::CalculateNormals(*m_whiteBox, dirtyFaceHandles);
+        Api::CalculatePlanarUVs(*m_whiteBox, dirtyFaceHandles);
+
+        const Api::FaceHandles faceHandles = Api::MeshFaceHandles(*m_whiteBox);
+        AZStd::vector<AZ::Vector3> partialNormals;
+        AZStd::vector<AZ::Vector2> partialUVs;
+        for (const auto& faceHandle : faceHandles)
+        {
+            partialNormals.push_back(Api::FaceNormal(*m_whiteBox, faceHandle));
+            for (const auto& halfedgeHandle : Api::FaceHalfedgeHandles(*m_whiteBox, faceHandle))
+            {
+                partialUVs.push_back(Api::HalfedgeUV(*m_whiteBox, halfedgeHandle));
+            }
+        }
+
+        Api::CalculateNormals(*m_whiteBox);
+        Api::CalculatePlanarUVs(*m_whiteBox);
+
+        size_t uvIndex = 0;
+        for (size_t faceIndex = 0; faceIndex < faceHandles.size(); ++faceIndex)
+        {
+            EXPECT_THAT(partialNormals[faceIndex], IsClose(Api::FaceNormal(*m_whiteBox, faceHandles[faceIndex])));
+            for (const auto& halfedgeHandle : Api::FaceHalfedgeHandles(*m_whiteBox, faceHandles[faceIndex]))
+            {
+                EXPECT_THAT(partialUVs[uvIndex++], IsClose(Api::HalfedgeUV(*m_whiteBox, halfedgeHandle)));
+            }
+        }
+    }
+
     TEST_F(WhiteBoxTestFixture, VerticesForFace)
     {
         namespace Api = WhiteBox::Api;
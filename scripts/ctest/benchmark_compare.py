@@ -0,0 +1,87 @@
+"""
+Copyright (c) Contributors to the Open 3D Engine Project.
+For complete copyright and license terms please see the LICENSE at the root of this distribution.
+
+SPDX-License-Identifier: Apache-2.0 OR MIT
+
+Compares two sets of googlebenchmark json results, e.g. the BenchmarkResults directories produced by running
+"ctest -L FRAMEWORK_googlebenchmark" on two commits, and reports the benchmarks that got slower.
+"""
+import argparse
+import glob
+import json
+import os
+import sys
+
+
+def _load_results(path):
+    """
+    Load the benchmark results from a json file or from all json files in a directory.
+    :param path: Path to a googlebenchmark json output file or to a directory of them.
+    :return: Dictionary of "<file>/<benchmark name>" to the benchmark entry.
+    """
+    files = sorted(glob.glob(os.path.join(path, '*.json'))) if os.path.isdir(path) else [path]
+    results = {}
+    for file_path in files:
+        with open(file_path) as result_file:
+            content = json.load(result_file)
+        prefix = os.path.splitext(os.path.basename(file_path))[0]
+        for entry in content.get('benchmarks', []):
+            # Only compare the plain runs, not the mean/median/stddev aggregates of repeated runs
+            if entry.get('run_type', 'iteration') != 'iteration':
+                continue
+            results[f"{prefix}/{entry['name']}"] = entry
+    return results
+
+
+def compare(baseline_path, current_path, metric, threshold):
+    """
+    Compare the current results against the baseline results.
+    :param baseline_path: Results to compare against.
+    :param current_path: Results to check.
+    :param metric: Either 'real_time' or 'cpu_time'.
+    :param threshold: Relative slowdown, e.g. 0.1 for 10%, above which a benchmark counts as a regression.
+    :return: List of (name, baseline time, current time, relative change) for the regressed benchmarks.
+    """
+    baseline = _load_results(baseline_path)
+    current = _load_results(current_path)
+    regressions = []
+    for name in sorted(set(baseline) & set(current)):
+        baseline_time = baseline[name][metric]
+        current_time = current[name][metric]
+        if baseline_time <= 0:
+            continue
+        change = (current_time - baseline_time) / baseline_time
+        unit = current[name].get('time_unit', 'ns')
+        print(f'{name}: {baseline_time:.3f}{unit} -> {current_time:.3f}{unit} ({change:+.1%})')
+        if change > threshold:
+            regressions.append((name, baseline_time, current_time, change))
+
+    for name in sorted(set(baseline) - set(current)):
+        print(f'{name}: missing from the current results')
+    for name in sorted(set(current) - set(baseline)):
+        print(f'{name}: new benchmark')
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compares two sets of googlebenchmark json results.')
+    parser.add_argument('baseline', help='Json result file or directory of the baseline run.')
+    parser.add_argument('current', help='Json result file or directory of the run to check.')
+    parser.add_argument('--metric', choices=['real_time', 'cpu_time'], default='cpu_time',
+                        help='Time to compare. Defaults to cpu_time, which is less sensitive to machine load.')
+    parser.add_argument('--threshold', type=float, default=0.1,
+                        help='Relative slowdown above which a benchmark counts as a regression. Defaults to 0.1 (10%%).')
+    args = parser.parse_args()
+
+    regressions = compare(args.baseline, args.current, args.metric, args.threshold)
+    if regressions:
+        print(f'\n{len(regressions)} benchmark(s) regressed by more than {args.threshold:.0%}:')
+        for name, baseline_time, current_time, change in regressions:
+            print(f'  {name}: {baseline_time:.3f} -> {current_time:.3f} ({change:+.1%})')
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())